@@ -0,0 +1,70 @@
+#include "runtime/FlatHashSet.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace py;
+
+static void BM_FlatHashSetInsert(benchmark::State &state)
+{
+	const auto count = state.range(0);
+	for (auto _ : state) {
+		FlatHashSet set;
+		for (int64_t i = 0; i < count; ++i) { set.insert(Number{ i }); }
+		benchmark::DoNotOptimize(set.size());
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_FlatHashSetInsert)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+static void BM_FlatHashSetInsertExisting(benchmark::State &state)
+{
+	const auto count = state.range(0);
+	FlatHashSet set;
+	for (int64_t i = 0; i < count; ++i) { set.insert(Number{ i }); }
+	for (auto _ : state) {
+		for (int64_t i = 0; i < count; ++i) { benchmark::DoNotOptimize(set.insert(Number{ i })); }
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_FlatHashSetInsertExisting)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+static void BM_FlatHashSetContains(benchmark::State &state)
+{
+	const auto count = state.range(0);
+	FlatHashSet set;
+	for (int64_t i = 0; i < count; i += 2) { set.insert(Number{ i }); }
+	for (auto _ : state) {
+		for (int64_t i = 0; i < count; ++i) {
+			benchmark::DoNotOptimize(set.contains(Number{ i }));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_FlatHashSetContains)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+static void BM_FlatHashSetEraseAndInsert(benchmark::State &state)
+{
+	const auto count = state.range(0);
+	FlatHashSet set;
+	for (int64_t i = 0; i < count; ++i) { set.insert(Number{ i }); }
+	int64_t next = count;
+	for (auto _ : state) {
+		set.erase(Number{ next - count });
+		set.insert(Number{ next++ });
+	}
+}
+BENCHMARK(BM_FlatHashSetEraseAndInsert)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+static void BM_FlatHashSetIntersection(benchmark::State &state)
+{
+	const auto count = state.range(0);
+	FlatHashSet lhs;
+	FlatHashSet rhs;
+	for (int64_t i = 0; i < count; ++i) {
+		lhs.insert(Number{ i });
+		rhs.insert(Number{ i * 2 });
+	}
+	for (auto _ : state) { benchmark::DoNotOptimize(lhs.intersection(rhs)); }
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_FlatHashSetIntersection)->RangeMultiplier(10)->Range(1'000, 100'000);
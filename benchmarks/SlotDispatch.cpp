@@ -0,0 +1,35 @@
+#include "runtime/PyInteger.hpp"
+#include "runtime/PyString.hpp"
+#include "vm/VM.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace py;
+
+// Calls into the native types through the function pointers of their SlotTable, which is built at
+// compile time by TypePrototype::create
+static void BM_SlotAddInteger(benchmark::State &state)
+{
+	[[maybe_unused]] auto scope = VirtualMachine::the().heap().scoped_gc_pause();
+	auto *lhs = PyInteger::create(int64_t{ 40 }).unwrap();
+	auto *rhs = PyInteger::create(int64_t{ 2 }).unwrap();
+	for (auto _ : state) { benchmark::DoNotOptimize(lhs->add(rhs)); }
+}
+BENCHMARK(BM_SlotAddInteger);
+
+static void BM_SlotHashString(benchmark::State &state)
+{
+	[[maybe_unused]] auto scope = VirtualMachine::the().heap().scoped_gc_pause();
+	auto *str = PyString::create("slot_dispatch").unwrap();
+	for (auto _ : state) { benchmark::DoNotOptimize(str->hash()); }
+}
+BENCHMARK(BM_SlotHashString);
+
+static void BM_SlotEqInteger(benchmark::State &state)
+{
+	[[maybe_unused]] auto scope = VirtualMachine::the().heap().scoped_gc_pause();
+	auto *lhs = PyInteger::create(int64_t{ 42 }).unwrap();
+	auto *rhs = PyInteger::create(int64_t{ 42 }).unwrap();
+	for (auto _ : state) { benchmark::DoNotOptimize(lhs->eq(rhs)); }
+}
+BENCHMARK(BM_SlotEqInteger);
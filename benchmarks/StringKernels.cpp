@@ -0,0 +1,146 @@
+#include "runtime/PyString.hpp"
+#include "runtime/StringKernels.hpp"
+#include "vm/VM.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <span>
+#include <string>
+
+using namespace py;
+
+namespace {
+// log lines with a few non-ASCII codepoints, as written by a web server
+std::string log_lines(size_t count)
+{
+	std::string result;
+	for (size_t i = 0; i < count; ++i) {
+		result += fmt::format(
+			"2024-01-01T00:{:02}:{:02} INFO  request served in {}ms for user café-{}\n",
+			(i / 60) % 60,
+			i % 60,
+			i % 97,
+			i);
+	}
+	return result;
+}
+
+// rows of a CSV export, with padded fields
+std::string csv_rows(size_t count)
+{
+	std::string result = "id,name,city,amount,comment\n";
+	for (size_t i = 0; i < count; ++i) {
+		result += fmt::format(
+			"  {},user_{},Zürich,{}.{:02},  no comment  \n", i, i, i * 7, i % 100);
+	}
+	return result;
+}
+
+const std::string &log_input()
+{
+	static const auto input = log_lines(10'000);
+	return input;
+}
+
+const std::string &csv_input()
+{
+	static const auto input = csv_rows(10'000);
+	return input;
+}
+}// namespace
+
+static void BM_LogFindMissingLevel(benchmark::State &state)
+{
+	const auto &input = log_input();
+	for (auto _ : state) { benchmark::DoNotOptimize(string_kernels::find(input, "ERROR")); }
+	state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_LogFindMissingLevel);
+
+static void BM_LogCountLines(benchmark::State &state)
+{
+	const auto &input = log_input();
+	for (auto _ : state) { benchmark::DoNotOptimize(string_kernels::count(input, "\n")); }
+	state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_LogCountLines);
+
+static void BM_LogIsAscii(benchmark::State &state)
+{
+	const auto &input = log_input();
+	for (auto _ : state) { benchmark::DoNotOptimize(string_kernels::is_ascii(input)); }
+	state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_LogIsAscii);
+
+static void BM_LogUtf8Length(benchmark::State &state)
+{
+	const auto &input = log_input();
+	for (auto _ : state) { benchmark::DoNotOptimize(string_kernels::utf8_length(input)); }
+	state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_LogUtf8Length);
+
+static void BM_LogValidateUtf8(benchmark::State &state)
+{
+	const auto &input = log_input();
+	for (auto _ : state) { benchmark::DoNotOptimize(string_kernels::find_invalid_utf8(input)); }
+	state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_LogValidateUtf8);
+
+static void BM_LogLower(benchmark::State &state)
+{
+	const auto &input = log_input();
+	std::string output;
+	for (auto _ : state) {
+		output = input;
+		string_kernels::to_lower_ascii(output.data(), output.size());
+		benchmark::DoNotOptimize(output.data());
+	}
+	state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_LogLower);
+
+static void BM_LogDecode(benchmark::State &state)
+{
+	[[maybe_unused]] auto scope = VirtualMachine::the().heap().scoped_gc_pause();
+	const auto &input = log_input();
+	const std::span<const std::byte> bytes{ reinterpret_cast<const std::byte *>(input.data()),
+		input.size() };
+	for (auto _ : state) { benchmark::DoNotOptimize(PyString::decode(bytes, "utf-8", "strict")); }
+	state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_LogDecode);
+
+// splits every row on the separator and strips the whitespace around each field
+static void BM_CsvSplitAndStripFields(benchmark::State &state)
+{
+	const std::string_view input = csv_input();
+	for (auto _ : state) {
+		size_t fields = 0;
+		for (size_t start = 0; start < input.size();) {
+			auto end = string_kernels::find(input, ",", start);
+			const auto line_end = string_kernels::find(input, "\n", start);
+			if (end == std::string_view::npos || end > line_end) { end = line_end; }
+			if (end == std::string_view::npos) { break; }
+			const auto field = input.substr(start, end - start);
+			const auto first = string_kernels::first_non_whitespace(field);
+			const auto last = string_kernels::last_non_whitespace(field);
+			benchmark::DoNotOptimize(field.substr(first, last > first ? last - first : 0));
+			fields++;
+			start = end + 1;
+		}
+		benchmark::DoNotOptimize(fields);
+	}
+	state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_CsvSplitAndStripFields);
+
+static void BM_CsvCountField(benchmark::State &state)
+{
+	const auto &input = csv_input();
+	for (auto _ : state) { benchmark::DoNotOptimize(string_kernels::count(input, "Zürich")); }
+	state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_CsvCountField);
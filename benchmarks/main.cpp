@@ -0,0 +1,18 @@
+#include "interpreter/Interpreter.hpp"
+#include "vm/VM.hpp"
+
+#include <benchmark/benchmark.h>
+
+int main(int argc, char **argv)
+{
+	auto &vm = VirtualMachine::the();
+	vm.heap().set_start_stack_pointer(bit_cast<uintptr_t *>(argv));
+	initialize_types();
+
+	::benchmark::Initialize(&argc, argv);
+	if (::benchmark::ReportUnrecognizedArguments(argc, argv)) { return EXIT_FAILURE; }
+	::benchmark::RunSpecifiedBenchmarks();
+	::benchmark::Shutdown();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+# coding: utf-8
+
+# Generator throughput benchmark: every item goes through a pipeline of generators, so the run
+# time is dominated by suspending and resuming generator frames.
+
+def numbers(n):
+	i = 0
+	while i < n:
+		yield i
+		i = i + 1
+
+def squares(it):
+	for x in it:
+		yield x * x
+
+def evens(it):
+	for x in it:
+		if x % 2 == 0:
+			yield x
+
+def accumulator():
+	total = 0
+	while True:
+		value = yield total
+		total = total + value
+
+n = 20000
+
+total = 0
+for x in evens(squares(numbers(n))):
+	total = total + x
+
+acc = accumulator()
+next(acc)
+for x in numbers(n):
+	result = acc.send(x)
+
+expected = 0
+for x in range(n):
+	if x % 2 == 0:
+		expected = expected + x * x
+
+assert total == expected
+assert result == n * (n - 1) // 2
@@ -78,3 +78,109 @@ def class_closure():
         assert False
 
 class_closure()
+
+def instance_attributes():
+    class Point:
+        def __init__(self, x, y):
+            self.x = x
+            self.y = y
+
+    a = Point(1, 2)
+    b = Point(3, 4)
+    b.z = 5
+    assert a.x + a.y == 3
+    assert b.x + b.y + b.z == 12
+    assert not hasattr(a, "z")
+
+    a.x = 10
+    d = a.__dict__
+    assert d["x"] == 10
+    assert d["y"] == 2
+    d["w"] = 7
+    assert a.w == 7
+    a.v = 8
+    assert a.__dict__["v"] == 8
+
+    many = Point(0, 0)
+    for i in range(100):
+        setattr(many, f"attr{i}", i)
+    assert getattr(many, "attr99") == 99
+    assert many.x == 0
+
+instance_attributes()
+
+
+def method_calls():
+    class Counter:
+        def __init__(self, start=0):
+            self.value = start
+
+        def add(self, amount=1, scale=1):
+            self.value += amount * scale
+            return self.value
+
+    c = Counter(1)
+    assert c.add() == 2
+    assert c.add(2) == 4
+    assert c.add(amount=3, scale=2) == 10
+    assert c.add(1, scale=5) == 15
+
+    c.add = lambda amount: amount
+    assert c.add(42) == 42
+
+    values = []
+    values.append(1)
+    list.append(values, 2)
+    assert values == [1, 2]
+    assert "a,b".split(",") == ["a", "b"]
+    assert "-".join(["a", "b"]) == "a-b"
+    assert str.join("+", ["x", "y"]) == "x+y"
+
+method_calls()
+
+def instance_attributes_layout():
+    class Base:
+        def __init__(self):
+            self.a = 1
+
+    class WithSlots(Base):
+        __slots__ = ("s",)
+
+    class Derived(WithSlots):
+        pass
+
+    obj = Derived()
+    obj.s = 2
+    obj.b = 3
+    assert obj.a + obj.s + obj.b == 6
+    assert obj.__dict__ == {"a": 1, "b": 3}
+
+    class MyList(list):
+        pass
+
+    l = MyList()
+    l.append(1)
+    l.tag = "tagged"
+    assert l.tag == "tagged"
+    assert l == [1]
+
+    obj.__dict__ = {"c": 4}
+    assert obj.c == 4
+    assert not hasattr(obj, "a")
+    assert obj.s == 2
+
+instance_attributes_layout()
+
+def method_cache():
+    class A:
+        def f(self):
+            return 1
+
+    a = A()
+    for _ in range(10):
+        assert a.f() == 1
+
+    A.f = lambda self: 2
+    assert a.f() == 2, "Modifying a class should invalidate its cached methods"
+
+method_cache()
@@ -66,3 +66,36 @@ def nonlocal_func():
         assert x == 2
     assert x == 1
 assert x == 0
+
+def closures_outlive_recycled_frames():
+    def make_counter(start):
+        count = start
+        def increment():
+            nonlocal count
+            count += 1
+            return count
+        return increment
+
+    counters = [make_counter(i * 10) for i in range(100)]
+    for i, counter in enumerate(counters):
+        assert counter() == i * 10 + 1
+    assert counters[0]() == 2
+    assert counters[99]() == 992
+
+    def fails(value):
+        cell = value
+        def get():
+            return cell
+        getters.append(get)
+        raise ValueError(value)
+
+    getters = []
+    for i in range(10):
+        try:
+            fails(i)
+        except ValueError:
+            pass
+        assert make_counter(i)() == i + 1
+    assert [get() for get in getters] == list(range(10))
+
+closures_outlive_recycled_frames()
@@ -5,4 +5,36 @@ assert solution == 42
 
 a = False
 solution = 42 if a else 21
-assert solution == 21
\ No newline at end of file
+assert solution == 21
+
+def iterate_builtin_iterators():
+    chars = []
+    for c in "añb€":
+        chars.append(c)
+    assert chars == ["a", "ñ", "b", "€"]
+
+    total = 0
+    for i, item in enumerate({"a": 1, "b": 2}.items()):
+        k, v = item
+        total += i + v
+    assert total == 4
+
+    pairs = []
+    for a, b in zip([1, 2, 3], (4, 5)):
+        pairs.append(a + b)
+    assert pairs == [5, 7]
+
+    class Countdown:
+        def __init__(self, n):
+            self.n = n
+        def __iter__(self):
+            return self
+        def __next__(self):
+            if self.n == 0:
+                raise StopIteration
+            self.n -= 1
+            return self.n
+
+    assert [x for x in Countdown(3)] == [2, 1, 0]
+
+iterate_builtin_iterators()
@@ -45,3 +45,58 @@ def dict_setdefault():
     assert a["b"] == 10
 
 dict_setdefault()
+
+def dict_order_and_equality():
+    a = {}
+    for i in range(300):
+        a[i] = i
+    for i in range(0, 300, 3):
+        a.pop(i)
+    a[0] = "zero"
+    keys = list(a.keys())
+    assert len(keys) == 201
+    assert keys[0] == 1
+    assert keys[1] == 2
+    assert keys[-1] == 0
+    assert a[299] == 299
+    assert {"x": 1, "y": 2} == {"y": 2, "x": 1}
+    assert {"x": 1, "y": 2} != {"x": 1, "y": 3}
+
+dict_order_and_equality()
+
+def dict_changed_size_during_iteration():
+    a = {1: 1, 2: 2}
+    raised = False
+    try:
+        for k in a:
+            a[k + 10] = 1
+    except RuntimeError:
+        raised = True
+    assert raised, "Adding a key while iterating over a dict should raise a RuntimeError"
+    assert len(a) == 3
+
+    raised = False
+    try:
+        for v in a.values():
+            a.pop(1)
+    except RuntimeError:
+        raised = True
+    assert raised, "Removing a key while iterating over a dict should raise a RuntimeError"
+
+    a = {1: 1, 2: 2}
+    raised = False
+    try:
+        for k in a:
+            del a[k]
+            a[k + 10] = 1
+    except RuntimeError:
+        raised = True
+    assert raised, "Replacing a key while iterating over a dict should raise a RuntimeError"
+
+    a = {1: 1, 2: 2}
+    for k in a:
+        a[k] = k + 1
+    assert a[1] == 2
+    assert a[2] == 3
+
+dict_changed_size_during_iteration()
@@ -10,4 +10,18 @@ def simple_with_conversions():
     msg = f"""hello {{ {name}{name!r} {name!s} }}"""
     assert msg == "hello { Python'Python' Python }"
 
-simple_with_conversions()
\ No newline at end of file
+simple_with_conversions()
+
+def with_numbers():
+    count = 42
+    big = 2 ** 70
+    ratio = 0.5
+    flag = True
+    msg = f"{count} items, {big} bytes, {ratio} done, {flag}, {-count!s} {count!r}"
+    assert msg == "42 items, 1180591620717411303424 bytes, 0.5 done, True, -42 42"
+    assert ", ".join(f"{i}é" for i in range(3)) == "0é, 1é, 2é"
+    assert "".join(["a", "b"]) == "ab"
+    assert "-".join(("x",)) == "x"
+    assert "-".join([]) == ""
+
+with_numbers()
@@ -56,4 +56,87 @@ def bar():
     return 42
 
 assert bar() == 21
-assert bar == new_bar
\ No newline at end of file
+assert bar == new_bar
+
+def f5(a, b, c=3, *, d, e=5):
+    return a, b, c, d, e
+
+def f6(a, b=2, *args, c, **kwargs):
+    def inner():
+        return a, b, args, c, kwargs
+    return inner()
+
+def f7(a, /, b, **kwargs):
+    return a, b, kwargs
+
+def test_keyword_arguments():
+    assert f5(1, 2, d=4) == (1, 2, 3, 4, 5)
+    assert f5(1, b=2, d=4, e=6) == (1, 2, 3, 4, 6)
+    assert f5(d=4, c=0, b=2, a=1) == (1, 2, 0, 4, 5)
+
+    try:
+        f5(1, d=4)
+        assert False, "Should raise TypeError for a missing positional argument"
+    except TypeError:
+        pass
+
+    try:
+        f5(1, 2)
+        assert False, "Should raise TypeError for a missing keyword only argument"
+    except TypeError:
+        pass
+
+    try:
+        f5(1, 2, d=4, a=1)
+        assert False, "Should raise TypeError when an argument is given twice"
+    except TypeError:
+        pass
+
+    try:
+        f5(1, 2, d=4, f=6)
+        assert False, "Should raise TypeError for an unexpected keyword argument"
+    except TypeError:
+        pass
+
+    assert f6(1, c=3) == (1, 2, (), 3, {})
+    assert f6(b=0, a=1, c=3, d=4) == (1, 0, (), 3, {'d': 4})
+    assert f6(1, 2, 3, 4, c=5) == (1, 2, (3, 4), 5, {})
+
+    assert f7(1, 2) == (1, 2, {})
+    assert f7(1, b=2, a=3) == (1, 2, {'a': 3})
+
+test_keyword_arguments()
+
+
+import sys
+
+def countdown(n):
+    if n == 0:
+        return 0
+    return 1 + countdown(n - 1)
+
+def recurse_forever(n):
+    return recurse_forever(n + 1)
+
+def test_recursion_limit():
+    assert countdown(900) == 900
+
+    try:
+        recurse_forever(0)
+        assert False, "Should raise RecursionError"
+    except RecursionError:
+        pass
+
+    assert countdown(10) == 10
+
+    default_limit = sys.getrecursionlimit()
+    sys.setrecursionlimit(50)
+    try:
+        countdown(100)
+        assert False, "Should raise RecursionError with a lower recursion limit"
+    except RecursionError:
+        pass
+    sys.setrecursionlimit(default_limit)
+    assert sys.getrecursionlimit() == default_limit
+
+test_recursion_limit()
@@ -43,3 +43,36 @@ assert issubclass(Derived, object)
 assert Base.mro() == [Base, object]
 assert Derived.mro() == [Derived, Base, Base1, object]
 assert Derived.__bases__ == (Base, Base1)
+
+
+def class_attribute_updates():
+    class Base:
+        def greet(self):
+            return "base"
+
+    class Middle(Base):
+        pass
+
+    class Leaf(Middle):
+        pass
+
+    leaf = Leaf()
+    for _ in range(3):
+        assert leaf.greet() == "base"
+    assert not hasattr(leaf, "extra")
+
+    Base.greet = lambda self: "patched"
+    assert leaf.greet() == "patched"
+
+    Base.extra = 1
+    assert leaf.extra == 1
+    assert Leaf.extra == 1
+
+    Middle.greet = lambda self: "middle"
+    assert leaf.greet() == "middle"
+    assert Base().greet() == "patched"
+
+    Base.extra = 2
+    assert Leaf.extra == 2
+
+class_attribute_updates()
@@ -23,3 +23,135 @@ except IndexError:
     exception_raised = True
 finally:
     assert exception_raised, "list.pop with empty list should raise an IndexError"
+
+def test_sort():
+    a = [5, 3, 9, 1, 3, -2]
+    a.sort()
+    assert a == [-2, 1, 3, 3, 5, 9], "list.sort should sort ints in place"
+
+    a = [2.5, -1.0, 10.25, 0.0]
+    a.sort(reverse=True)
+    assert a == [10.25, 2.5, 0.0, -1.0], "list.sort with reverse should sort in descending order"
+
+    a = ["pear", "apple", "fig", "épée", "banana"]
+    a.sort()
+    assert a == ["apple", "banana", "fig", "pear", "épée"], "list.sort should sort strs by code point"
+
+    a = [(1, "b"), (0, "c"), (1, "a"), (0, "d")]
+    a.sort(key=lambda x: x[0])
+    assert a == [(0, "c"), (0, "d"), (1, "b"), (1, "a")], "list.sort should be stable"
+
+    a.sort(key=lambda x: x[0], reverse=True)
+    assert a == [(1, "b"), (1, "a"), (0, "c"), (0, "d")], "list.sort with reverse should be stable"
+
+    a = [3, 1.5, 2, 0.5]
+    a.sort()
+    assert a == [0.5, 1.5, 2, 3], "list.sort should compare ints with floats"
+
+test_sort()
+
+def test_sort_key():
+    calls = []
+    def key(x):
+        calls.append(x)
+        return -x
+
+    a = list(range(100))
+    a.sort(key=key)
+    assert a == list(range(99, -1, -1)), "list.sort should sort by key"
+    assert len(calls) == 100, "list.sort should call the key function once per element"
+
+    a = [i * 7919 % 1000 for i in range(1000)]
+    b = sorted(a)
+    for i in range(999):
+        assert b[i] <= b[i + 1], "sorted should sort long lists"
+    assert sorted(b, reverse=True) == b[::-1], "sorted with reverse should sort in descending order"
+
+test_sort_key()
+
+def test_sort_errors():
+    a = [1, "a", 2]
+    try:
+        exception_raised = False
+        a.sort()
+    except TypeError:
+        exception_raised = True
+    finally:
+        assert exception_raised, "list.sort should raise comparison errors"
+    assert len(a) == 3, "list.sort should keep the elements on error"
+
+    a = [3, 2, 1]
+    def append_key(x):
+        a.append(x)
+        return x
+
+    try:
+        exception_raised = False
+        a.sort(key=append_key)
+    except ValueError:
+        exception_raised = True
+    finally:
+        assert exception_raised, "list.sort should raise if the list is modified during the sort"
+    assert a == [1, 2, 3], "list.sort should keep the sorted elements when the list is modified"
+
+test_sort_errors()
+
+def test_storage_strategies():
+    a = [1, 2, 3]
+    a.append(4.5)
+    assert a == [1, 2, 3, 4.5], "appending a float to a list of ints should keep the ints"
+    a.append("x")
+    assert a[-1] == "x" and a[3] == 4.5, "appending a str to a list of numbers should keep the numbers"
+
+    a = []
+    a.append(1.5)
+    a.append(2)
+    assert a == [1.5, 2] and type(a[1]) is int, "an int appended to a list of floats should stay an int"
+
+    a = [1.0, 2.0]
+    a[0] = 3
+    assert a == [3, 2.0] and type(a[0]) is int, "storing an int in a list of floats should keep the int"
+
+    a = [1, 2, 3]
+    a[1] = 2.5
+    a.append(None)
+    assert a == [1, 2.5, 3, None], "storing other objects in a list of ints should keep the ints"
+
+    a = [1, 2, 3]
+    a.extend([4.0, 5])
+    assert a == [1, 2, 3, 4.0, 5], "extending a list of ints with other objects should keep the ints"
+    assert a[1:4] == [2, 3, 4.0], "slicing a list should keep its elements"
+    assert [1, 2] + [3.0] == [1, 2, 3.0], "concatenating lists with different elements should keep them"
+
+    a = [9223372036854775807, 1]
+    a.append(9223372036854775807 + 1)
+    assert a[2] == 9223372036854775808, "ints that do not fit in 64 bits should be kept exactly"
+    assert sum(a) == 18446744073709551616, "sum should not overflow"
+
+    total = 0
+    for x in [1.5, 2.5]:
+        total += x
+    assert total == 4.0, "iterating over a list of floats should yield the floats"
+    a, b = [1, 2.5]
+    assert a == 1 and b == 2.5, "unpacking a list should yield its elements"
+    assert tuple([1, 2]) == (1, 2), "converting a list of ints to a tuple should keep the ints"
+
+test_storage_strategies()
+
+def test_sum():
+    assert sum([]) == 0, "sum of an empty list should be 0"
+    assert sum([1, 2, 3]) == 6, "sum should add up ints"
+    assert sum([1, 2, 3], 10) == 16, "sum should start from start"
+    assert sum([0.5, 0.25], start=1) == 1.75, "sum should add up floats"
+    assert sum([1, 0.5]) == 1.5, "sum should add up ints and floats"
+    assert sum(x for x in range(5)) == 10, "sum should add up any iterable"
+    assert sum([[1], [2]], []) == [1, 2], "sum should add up any objects"
+    try:
+        exception_raised = False
+        sum(["a", "b"], "")
+    except TypeError:
+        exception_raised = True
+    finally:
+        assert exception_raised, "sum should not add up strs"
+
+test_sum()
@@ -20,6 +20,9 @@ assert int(1.0) == 1, "Create a int from a literal float"
 
 assert -a == -1, "Failed to turn positive integer to negative integer"
 assert -c == -10.0, "Failed to turn positive float to negative float"
+int64_min = -9223372036854775807 - 1
+assert -int64_min == 9223372036854775808, "Negating the smallest int64 should not overflow"
+assert -(-int64_min) == int64_min, "Negating a big integer back should give an int64"
 
 assert (a + c) * 2 == 22, "Failed to respect operator precedence with parenthesis"
 
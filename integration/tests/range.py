@@ -34,4 +34,21 @@ def test_subscript():
     r = range(0, 20, 2)
     assert r[5] == 10
 
-test_subscript()
\ No newline at end of file
+test_subscript()
+
+def test_int64_bounds():
+    big = 2 ** 63
+    assert [x for x in range(big - 3, big + 1)] == [big - 3, big - 2, big - 1, big]
+    assert [x for x in range(-big, big, big)] == [-big, 0]
+    assert range(-big, big, big)[-1] == 0
+    assert [x for x in reversed(range(0, 5, 2))] == [4, 2, 0]
+    assert [x for x in range(5, 0, -2)] == [5, 3, 1]
+    assert [x for x in range(0)] == []
+    try:
+        range(0, 10, 0)
+    except ValueError:
+        assert True
+    else:
+        assert False, "A zero step should raise a ValueError"
+
+test_int64_bounds()
@@ -74,4 +74,84 @@ def set_union():
     else:
         assert False
 
-set_union()
\ No newline at end of file
+set_union()
+
+def set_bulk_operations():
+    a = set()
+    a.update(list(range(1000)))
+    a.update(tuple(range(500, 1500)))
+    a.update({-1, -2})
+    assert len(a) == 1502
+
+    b = set(range(0, 2000, 2))
+    assert len(a.intersection(b)) == 750
+    assert a & b == a.intersection(b)
+    assert a.intersection(b, range(100)) == set(range(0, 100, 2))
+    assert a.intersection() == a
+
+    assert len(a.difference(b)) == 752
+    assert a - b == a.difference(b)
+    assert a.difference(b, [-1, -2]) == set(range(1, 1500, 2))
+
+    seen = 0
+    for x in a:
+        assert x in a
+        seen += 1
+    assert seen == len(a)
+
+    while a:
+        a.pop()
+    assert len(a) == 0
+
+set_bulk_operations()
+
+def frozenset_operations():
+    f = frozenset(range(10))
+    s = set(range(0, 20, 2))
+
+    difference = f - s
+    assert type(difference) is frozenset
+    assert set(difference) == {1, 3, 5, 7, 9}
+
+    intersection = f & s
+    assert type(intersection) is frozenset
+    assert set(intersection) == {0, 2, 4, 6, 8}
+    assert set(f & frozenset([3, 30])) == {3}
+
+    assert s - f == {10, 12, 14, 16, 18}
+    assert s & f == {0, 2, 4, 6, 8}
+
+    try:
+        f - [1, 2]
+    except TypeError:
+        assert True
+    else:
+        assert False
+
+frozenset_operations()
+
+def set_changed_size_during_iteration():
+    a = set(range(10))
+    try:
+        for x in a:
+            a.add(x + 100)
+    except RuntimeError:
+        assert True
+    else:
+        assert False
+
+    b = set(range(10))
+    try:
+        for x in b:
+            b.discard(x)
+    except RuntimeError:
+        assert True
+    else:
+        assert False
+
+    # the set may change as long as the iteration is over
+    for x in set(a):
+        a.add(x + 1000)
+    assert len(a) == 22
+
+set_changed_size_during_iteration()
@@ -18,3 +18,54 @@ else:
     assert False
 a.bar = -1
 assert a.bar == -1
+
+try:
+    a.other = 1
+except AttributeError:
+    pass
+else:
+    assert False, "instances of classes with __slots__ should not accept other attributes"
+
+assert not hasattr(a, "__dict__")
+
+class B(A):
+    __slots__ = ("qux",)
+    def __init__(self):
+        super().__init__()
+        self.qux = 3
+
+b = B()
+b.bar = 4
+assert b.baz == 1
+assert b.bar == 4
+assert b.qux == 3
+assert not hasattr(b, "__dict__")
+
+class C(B):
+    pass
+
+c = C()
+c.qux = 5
+c.other = 6
+assert c.qux == 5
+assert c.baz == 1
+assert c.other == 6
+assert c.__dict__ == {"other": 6}
+
+class D:
+    __slots__ = ("x", "__dict__")
+
+d = D()
+d.x = 1
+d.y = 2
+assert d.x + d.y == 3
+assert "x" not in d.__dict__
+
+try:
+    class E:
+        __slots__ = ("x",)
+        x = 1
+except ValueError:
+    pass
+else:
+    assert False, "a slot that conflicts with a class variable should raise a ValueError"
@@ -235,4 +235,74 @@ test_replace()
 def test_translate():
     assert "foo".translate({ord("f"): "b"}) == "boo"
 
-test_translate()
\ No newline at end of file
+test_translate()
+
+def test_non_ascii_length_and_slices():
+    a = "héllo wörld 😃!"
+    assert len(a) == 14
+    assert a[1] == "é"
+    assert a[-1] == "!"
+    assert a[-2] == "😃"
+    assert a[1:5] == "éllo"
+    assert a[::-1] == "!😃 dlröw olléh"
+    assert a[5:5] == ""
+    assert "ascii"[1:4] == "sci"
+    assert "ascii"[::2] == "aci"
+    assert a.isascii() == False
+    assert "ascii".isascii()
+
+test_non_ascii_length_and_slices()
+
+def test_long_string_operations():
+    line = "2024-01-01T00:00:00 INFO  café served request in 12ms for ünïcode user"
+    assert line.find("INFO") == 20
+    assert line.find("INFO", 0, 23) == -1
+    assert line.count(" ") == 10
+    assert line.upper().startswith("2024-01-01T00:00:00 INFO  CAF")
+    assert line.lower().find("info") == 20
+    assert line.split("é") == ["2024-01-01T00:00:00 INFO  caf", " served request in 12ms for ünïcode user"]
+    assert line.replace("é", "e").replace("ü", "u") == "2024-01-01T00:00:00 INFO  cafe served request in 12ms for unïcode user"
+    row = "   \t 1,foo,10,bar,20,baz,30,qux,40,quux,50 \n\r "
+    assert row.strip() == "1,foo,10,bar,20,baz,30,qux,40,quux,50"
+    assert row.rstrip() == "   \t 1,foo,10,bar,20,baz,30,qux,40,quux,50"
+    assert " \n\t ".strip() == ""
+    assert " \n\t ".rstrip() == ""
+    assert "12345678901234567890123456789012345678901234567890".isdigit()
+    assert not "1234567890123456789012345678901234567890123456789x".isdigit()
+
+test_long_string_operations()
+
+def test_non_ascii_find_and_decode():
+    assert "héllo".find("l", 2) == 2
+    assert "héllo".find("l", 3) == 3
+    assert "héllo".find("l", -2) == 3
+    assert "héllo".find("o", 0, 4) == -1
+    assert "héllo".rfind("l") == 3
+    assert "héllo".rfind("l", 0, 3) == 2
+    assert "abc".rfind("") == 3
+    assert "ünïcode ünïcode".find("code", 5) == 11
+    assert "ünïcode ünïcode".count("ï", 3) == 1
+
+    assert b"caf\xc3\xa9".decode() == "café"
+    assert str(b"caf\xc3\xa9", "utf-8") == "café"
+    assert len((b"2024-01-01 caf\xc3\xa9 " * 10).decode("utf-8")) == 160
+    try:
+        b"abc\xffdef".decode()
+    except UnicodeDecodeError:
+        pass
+    else:
+        assert False
+    try:
+        b"abc\xe2\x82".decode()
+    except ValueError:
+        pass
+    else:
+        assert False
+    try:
+        str(b"\xed\xa0\x80", "utf8")
+    except UnicodeDecodeError:
+        pass
+    else:
+        assert False
+
+test_non_ascii_find_and_decode()
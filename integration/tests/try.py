@@ -1,3 +1,5 @@
+import sys
+
 def reaches_finally_without_exception():
     reaches_finally = False
     try:
@@ -171,4 +173,45 @@ def try_else_return_from_finally_with_exception():
     finally:
         return 4
 
-assert try_else_return_from_finally_with_exception() == 4
\ No newline at end of file
+assert try_else_return_from_finally_with_exception() == 4
+
+def count_present_keys(d, keys):
+    found = 0
+    for key in keys:
+        try:
+            d[key]
+            found += 1
+        except KeyError:
+            pass
+    return found
+
+assert count_present_keys({1: 1, 3: 3}, range(1000)) == 2
+
+def traceback_is_created_when_requested():
+    def inner():
+        return 1 + "a"
+    try:
+        inner()
+    except TypeError:
+        exc_type, exc, tb = sys.exc_info()
+        assert exc_type is TypeError
+        assert tb is not None
+        assert exc.__traceback__ is tb
+        return True
+    return False
+
+assert traceback_is_created_when_requested()
+
+def break_out_of_try():
+    for i in range(3):
+        try:
+            break
+        except ValueError:
+            return "wrong handler"
+    try:
+        a = 1 + "a"
+    except TypeError:
+        return "ok"
+    return "not raised"
+
+assert break_out_of_try() == "ok"
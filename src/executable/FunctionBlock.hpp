@@ -9,6 +9,18 @@
 
 using InstructionVector = std::vector<std::unique_ptr<Instruction>>;
 
+// An exception raised by any instruction in [start, end) is handled by the instruction at index
+// `handler`. Entries are sorted by `start`, do not overlap and always describe the innermost
+// handler, so a lookup never has to consider more than one entry.
+struct ExceptionTableEntry
+{
+	size_t start;
+	size_t end;
+	size_t handler;
+};
+
+using ExceptionTable = std::vector<ExceptionTableEntry>;
+
 struct FunctionMetaData
 {
 	std::string function_name;
@@ -19,11 +31,11 @@ struct FunctionMetaData
 	std::vector<std::string> freevars;
 	std::vector<std::string> names;
 	std::string filename;
-	size_t first_line_number;
-	size_t arg_count;
-	size_t positional_arg_count;
-	size_t kwonly_arg_count;
-	size_t nlocals;
+	size_t first_line_number{ 0 };
+	size_t arg_count{ 0 };
+	size_t positional_arg_count{ 0 };
+	size_t kwonly_arg_count{ 0 };
+	size_t nlocals{ 0 };
 	std::vector<size_t> cell2arg;
 	std::vector<py::Value> consts;
 	CodeFlags flags = CodeFlags::create();
@@ -33,6 +45,7 @@ struct FunctionBlock
 {
 	FunctionMetaData metadata;
 	InstructionVector blocks;
+	ExceptionTable exception_table;
 	std::string to_string() const;
 };
 
@@ -4,7 +4,6 @@
 #include "runtime/BaseException.hpp"
 #include "runtime/PyFrame.hpp"
 #include "runtime/PyModule.hpp"
-#include "runtime/PyTraceback.hpp"
 #include "serialization/deserialize.hpp"
 #include "serialization/serialize.hpp"
 
@@ -15,6 +14,7 @@ Bytecode::Bytecode(size_t register_count,
 	size_t stack_size,
 	std::string function_name,
 	InstructionVector instructions,
+	ExceptionTable exception_table,
 	std::shared_ptr<Program> program)
 	: Function(register_count,
 		locals_count,
@@ -22,15 +22,31 @@ Bytecode::Bytecode(size_t register_count,
 		function_name,
 		FunctionExecutionBackend::BYTECODE,
 		std::move(program)),
-	  m_instructions(std::move(instructions))
+	  m_instructions(std::move(instructions)), m_exception_table(std::move(exception_table))
 {}
 
+std::optional<size_t> Bytecode::exception_handler(size_t instruction_idx) const
+{
+	auto it = std::upper_bound(m_exception_table.begin(),
+		m_exception_table.end(),
+		instruction_idx,
+		[](size_t idx, const ExceptionTableEntry &entry) { return idx < entry.start; });
+	if (it == m_exception_table.begin()) { return std::nullopt; }
+	--it;
+	if (instruction_idx < it->end) { return it->handler; }
+	return std::nullopt;
+}
+
 std::string Bytecode::to_string() const
 {
 	std::ostringstream os;
 	for (const auto &ins : m_instructions) {
 		os << fmt::format("    {} {}", (void *)ins.get(), ins->to_string()) << '\n';
 	}
+	for (const auto &entry : m_exception_table) {
+		os << fmt::format("    exception table: [{}, {}) -> {}", entry.start, entry.end, entry.handler)
+		   << '\n';
+	}
 
 	return os.str();
 }
@@ -53,6 +69,13 @@ std::vector<uint8_t> Bytecode::serialize() const
 		auto serialized_instruction = ins->serialize();
 		result.insert(result.end(), serialized_instruction.begin(), serialized_instruction.end());
 	}
+
+	py::serialize(m_exception_table.size(), result);
+	for (const auto &entry : m_exception_table) {
+		py::serialize(entry.start, result);
+		py::serialize(entry.end, result);
+		py::serialize(entry.handler, result);
+	}
 	return result;
 }
 
@@ -78,8 +101,23 @@ std::unique_ptr<Bytecode> Bytecode::deserialize(std::span<const uint8_t> &buffer
 		instructions.push_back(std::move(instruction));
 	}
 
-	return std::make_unique<Bytecode>(
-		register_count, locals_count, stack_size, function_name, std::move(instructions), std::move(program));
+	ExceptionTable exception_table;
+	const auto exception_table_size = py::deserialize<size_t>(buffer);
+	exception_table.reserve(exception_table_size);
+	for (size_t i = 0; i < exception_table_size; ++i) {
+		const auto start = py::deserialize<size_t>(buffer);
+		const auto end = py::deserialize<size_t>(buffer);
+		const auto handler = py::deserialize<size_t>(buffer);
+		exception_table.push_back(ExceptionTableEntry{ start, end, handler });
+	}
+
+	return std::make_unique<Bytecode>(register_count,
+		locals_count,
+		stack_size,
+		function_name,
+		std::move(instructions),
+		std::move(exception_table),
+		std::move(program));
 }
 
 PyResult<Value> Bytecode::call(VirtualMachine &vm, Interpreter &interpreter) const
@@ -120,7 +158,6 @@ py::PyResult<py::Value> Bytecode::eval_loop(VirtualMachine &vm, Interpreter &int
 	std::optional<Value> value;
 
 	const auto stack_depth = vm.stack().size();
-	const auto initial_ip = vm.instruction_pointer();
 
 	const auto end_instruction_it = end();
 	for (; vm.instruction_pointer() != end_instruction_it;
@@ -138,27 +175,23 @@ py::PyResult<py::Value> Bytecode::eval_loop(VirtualMachine &vm, Interpreter &int
 		// vm.dump();
 		if (result.is_err()) {
 			auto *exception = result.unwrap_err();
-			size_t tb_lineno = 0;
-			size_t tb_lasti = std::distance(initial_ip, current_ip);
-			PyTraceback *tb_next = exception->traceback();
-			auto traceback =
-				PyTraceback::create(interpreter.execution_frame(), tb_lasti, tb_lineno, tb_next);
-			ASSERT(traceback.is_ok())
-			exception->set_traceback(traceback.unwrap());
+			const size_t instruction_idx = std::distance(begin(), current_ip);
+			// the traceback is only materialized if someone asks for it, so an exception that is
+			// caught and discarded does not allocate a PyTraceback per frame it unwinds
+			exception->add_traceback_entry(interpreter.execution_frame(), instruction_idx, 0);
+			// the exception refers to the frame now, so the frame must not be recycled
+			interpreter.execution_frame()->escape();
 
 			interpreter.raise_exception(exception);
 
-			ASSERT(vm.state().cleanup.size() > 0);
-			if (!vm.state().cleanup.top()) {
-				ASSERT(vm.state().cleanup.size() == 1);
+			if (auto handler = exception_handler(instruction_idx); handler.has_value()) {
+				// the loop increment moves the instruction pointer onto the handler
+				vm.set_instruction_pointer(std::next(begin(), *handler - 1));
+			} else {
 				// when a function returns without handling the exception do not copy the value
 				// to the callers the return register
 				vm.pop_frame(false);
 				return result;
-			} else {
-				auto [exit_cleanup_type, exit_ins] = *vm.state().cleanup.top();
-				vm.leave_cleanup_handling();
-				vm.set_instruction_pointer(exit_ins);
 			}
 		} else {
 			value = result.unwrap();
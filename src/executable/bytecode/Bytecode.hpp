@@ -7,6 +7,7 @@
 #include "forward.hpp"
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <span>
 #include <string>
@@ -15,6 +16,7 @@
 class Bytecode : public Function
 {
 	const InstructionVector m_instructions;
+	const ExceptionTable m_exception_table;
 
   public:
 	Bytecode(size_t register_count,
@@ -22,11 +24,18 @@ class Bytecode : public Function
 		size_t stack_size,
 		std::string function_name,
 		InstructionVector instructions,
+		ExceptionTable exception_table,
 		std::shared_ptr<Program> program);
 
 	auto begin() const { return m_instructions.begin(); }
 	auto end() const { return m_instructions.end(); }
 
+	const ExceptionTable &exception_table() const { return m_exception_table; }
+
+	// returns the index of the instruction that handles an exception raised by the instruction at
+	// `instruction_idx`, if it is covered by the exception table
+	std::optional<size_t> exception_handler(size_t instruction_idx) const;
+
 	std::string to_string() const override;
 
 	std::vector<uint8_t> serialize() const override;
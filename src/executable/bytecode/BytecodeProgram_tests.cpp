@@ -3,6 +3,10 @@
 #include "executable/common.hpp"
 #include "lexer/Lexer.hpp"
 #include "parser/Parser.hpp"
+#include "runtime/PyCode.hpp"
+#include "runtime/PyTuple.hpp"
+#include "serialization/deserialize.hpp"
+#include "serialization/serialize.hpp"
 #include "vm/VM.hpp"
 
 #include "gtest/gtest.h"
@@ -69,4 +73,46 @@ TEST_F(BytecodeProgramRun, DeserializesMultipleFunctions)
 	ASSERT_TRUE(!serialized_bytecode.empty());
 	// auto deserialized_bytecode = BytecodeProgram::deserialize(serialized_bytecode);
 	// ASSERT_EQ(VirtualMachine::the().execute(deserialized_bytecode), EXIT_SUCCESS);
-}
\ No newline at end of file
+}
+
+TEST_F(BytecodeProgramRun, SerializesIntegerConstantsThatDoNotFitInInt64)
+{
+	static constexpr std::string_view program =
+		"a = 1267650600228229401496703205376\n"
+		"b = (9223372036854775808, -1)\n";
+
+	auto bytecode_program = generate_bytecode(program);
+	auto serialized_bytecode = bytecode_program->serialize();
+	auto deserialized_bytecode = BytecodeProgram::deserialize(serialized_bytecode);
+
+	auto *original = as<py::PyCode>(bytecode_program->main_function());
+	auto *deserialized = as<py::PyCode>(deserialized_bytecode->main_function());
+	ASSERT_TRUE(original);
+	ASSERT_TRUE(deserialized);
+	ASSERT_EQ(original->consts()->size(), deserialized->consts()->size());
+	size_t big_int_count = 0;
+	for (size_t i = 0; i < original->consts()->size(); ++i) {
+		const auto &expected = original->consts()->elements()[i];
+		const auto &value = deserialized->consts()->elements()[i];
+		if (auto *number = std::get_if<py::Number>(&expected)) {
+			ASSERT_TRUE(std::holds_alternative<py::Number>(value));
+			EXPECT_EQ(std::get<py::Number>(value), *number);
+			if (std::holds_alternative<py::BigIntType>(number->value)) { big_int_count++; }
+		}
+	}
+	EXPECT_EQ(big_int_count, 2);
+}
+
+TEST(Serialization, RoundTripsNegativeBigIntegers)
+{
+	const py::Value value{ py::Number{
+		py::BigIntType{ "-340282366920938463463374607431768211457" } } };
+	std::vector<uint8_t> buffer;
+	py::serialize(value, buffer);
+
+	std::span<const uint8_t> span{ buffer };
+	const auto result = py::deserialize<py::Value>(span);
+	EXPECT_TRUE(span.empty());
+	ASSERT_TRUE(std::holds_alternative<py::Number>(result));
+	EXPECT_EQ(std::get<py::Number>(result), std::get<py::Number>(value));
+}
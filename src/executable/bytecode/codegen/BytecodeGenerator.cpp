@@ -10,7 +10,6 @@
 #include "executable/bytecode/instructions/BuildString.hpp"
 #include "executable/bytecode/instructions/BuildTuple.hpp"
 #include "executable/bytecode/instructions/ClearExceptionState.hpp"
-#include "executable/bytecode/instructions/ClearTopCleanup.hpp"
 #include "executable/bytecode/instructions/CompareOperation.hpp"
 #include "executable/bytecode/instructions/DeleteFast.hpp"
 #include "executable/bytecode/instructions/DeleteGlobal.hpp"
@@ -40,7 +39,6 @@
 #include "executable/bytecode/instructions/JumpIfNotExceptionMatch.hpp"
 #include "executable/bytecode/instructions/JumpIfTrue.hpp"
 #include "executable/bytecode/instructions/JumpIfTrueOrPop.hpp"
-#include "executable/bytecode/instructions/LeaveExceptionHandling.hpp"
 #include "executable/bytecode/instructions/ListAppend.hpp"
 #include "executable/bytecode/instructions/ListExtend.hpp"
 #include "executable/bytecode/instructions/ListToTuple.hpp"
@@ -63,8 +61,6 @@
 #include "executable/bytecode/instructions/ReRaise.hpp"
 #include "executable/bytecode/instructions/ReturnValue.hpp"
 #include "executable/bytecode/instructions/SetAdd.hpp"
-#include "executable/bytecode/instructions/SetupExceptionHandling.hpp"
-#include "executable/bytecode/instructions/SetupWith.hpp"
 #include "executable/bytecode/instructions/StoreAttr.hpp"
 #include "executable/bytecode/instructions/StoreDeref.hpp"
 #include "executable/bytecode/instructions/StoreFast.hpp"
@@ -349,7 +345,7 @@ BytecodeValue *BytecodeGenerator::load_var(const std::string &name)
 		emit<LoadGlobal>(dst->get_register(), load_name(name, m_function_id)->get_index());
 	} break;
 	case VariablesResolver::Visibility::NAME: {
-		emit<LoadName>(dst->get_register(), name);
+		emit<LoadName>(dst->get_register(), load_name(name, m_function_id)->get_index());
 	} break;
 	case VariablesResolver::Visibility::LOCAL: {
 		auto *value = [&]() -> BytecodeStackValue * {
@@ -374,7 +370,7 @@ BytecodeValue *BytecodeGenerator::load_var(const std::string &name)
 			dst->get_register(), std::get<BytecodeFreeValue *>(l)->get_free_var_index());
 	} break;
 	case VariablesResolver::Visibility::HIDDEN: {
-		emit<LoadName>(dst->get_register(), name);
+		emit<LoadName>(dst->get_register(), load_name(name, m_function_id)->get_index());
 	} break;
 	}
 	return dst;
@@ -628,42 +624,11 @@ Value *BytecodeGenerator::generate_function(const FunctionType *node)
 	create_nested_scope(node->name(), function_name);
 	std::vector<std::pair<std::string, BytecodeFreeValue *>> captures;
 
-	for (const auto &arg_name : node->args()->argument_names()) {
-		if (auto it = symbol_map.get_visible_symbol(arg_name);
-			it.has_value() && it->get().visibility == VariablesResolver::Visibility::CELL) {
-			auto *value = create_free_value(arg_name);
-			m_stack.top().locals.emplace(arg_name, value);
-		}
-	}
-	for (const auto &arg_name : node->args()->kw_only_argument_names()) {
-		if (auto it = symbol_map.get_visible_symbol(arg_name);
-			it.has_value() && it->get().visibility == VariablesResolver::Visibility::CELL) {
-			auto *value = create_free_value(arg_name);
-			m_stack.top().locals.emplace(arg_name, value);
-		}
-	}
-	if (node->args()->vararg()) {
-		const auto &arg_name = node->args()->vararg()->name();
-		if (auto it = symbol_map.get_visible_symbol(arg_name);
-			it.has_value() && it->get().visibility == VariablesResolver::Visibility::CELL) {
-			auto *value = create_free_value(arg_name);
-			m_stack.top().locals.emplace(arg_name, value);
-		}
-	}
-	if (node->args()->kwarg()) {
-		const auto &arg_name = node->args()->kwarg()->name();
-		if (auto it = symbol_map.get_visible_symbol(arg_name);
-			it.has_value() && it->get().visibility == VariablesResolver::Visibility::CELL) {
-			auto *value = create_free_value(arg_name);
-			m_stack.top().locals.emplace(arg_name, value);
-		}
-	}
-
+	// the index of a cell is its index in cellvars, including for the arguments that are
+	// captured by an inner scope, so that cellvars names the cells of the frame
 	for (const auto &cellvar : f->function_info().function.metadata.cellvars) {
-		if (!m_stack.top().locals.contains(cellvar)) {
-			auto *value = create_free_value(cellvar);
-			m_stack.top().locals.emplace(cellvar, value);
-		}
+		auto *value = create_free_value(cellvar);
+		m_stack.top().locals.emplace(cellvar, value);
 	}
 	for (const auto &capture : m_variable_visibility.at(function_name)->captures) {
 		auto *value = create_free_value(capture);
@@ -797,6 +762,8 @@ Value *BytecodeGenerator::generate_function(const FunctionType *node)
 	// TODO
 	// f->function_info().function.metadata.filename = ;
 	f->function_info().function.metadata.arg_count = arg_count;
+	f->function_info().function.metadata.positional_arg_count =
+		node->args()->posonlyargs().size();
 	f->function_info().function.metadata.kwonly_arg_count = kwonly_arg_count;
 	f->function_info().function.metadata.cell2arg = std::move(cell2arg);
 	f->function_info().function.metadata.varnames.insert(
@@ -869,7 +836,6 @@ Value *BytecodeGenerator::visit(const Lambda *node)
 
 	const auto &cellvars = f->function_info().function.metadata.cellvars;
 	const size_t arg_count_ = node->args()->argument_names().size()
-							  + node->args()->kw_only_argument_names().size()
 							  + node->args()->kw_only_argument_names().size()
 							  + static_cast<size_t>(node->args()->vararg() != nullptr)
 							  + static_cast<size_t>(node->args()->kwarg() != nullptr);
@@ -878,47 +844,17 @@ Value *BytecodeGenerator::visit(const Lambda *node)
 	create_nested_scope("<lambda>", function_name);
 	std::vector<std::pair<std::string, BytecodeFreeValue *>> captures;
 
-	for (const auto &arg_name : node->args()->argument_names()) {
-		if (auto it = symbol_map.get_visible_symbol(arg_name);
-			it.has_value() && it->get().visibility == VariablesResolver::Visibility::CELL) {
-			auto *value = create_free_value(arg_name);
-			m_stack.top().locals.emplace(arg_name, value);
-		}
-	}
-	for (const auto &arg_name : node->args()->kw_only_argument_names()) {
-		if (auto it = symbol_map.get_visible_symbol(arg_name);
-			it.has_value() && it->get().visibility == VariablesResolver::Visibility::CELL) {
-			auto *value = create_free_value(arg_name);
-			m_stack.top().locals.emplace(arg_name, value);
-		}
-	}
-	if (node->args()->vararg()) {
-		const auto &arg_name = node->args()->vararg()->name();
-		if (auto it = symbol_map.get_visible_symbol(arg_name);
-			it.has_value() && it->get().visibility == VariablesResolver::Visibility::CELL) {
-			auto *value = create_free_value(arg_name);
-			m_stack.top().locals.emplace(arg_name, value);
-		}
-	}
-	if (node->args()->kwarg()) {
-		const auto &arg_name = node->args()->kwarg()->name();
-		if (auto it = symbol_map.get_visible_symbol(arg_name);
-			it.has_value() && it->get().visibility == VariablesResolver::Visibility::CELL) {
-			auto *value = create_free_value(arg_name);
-			m_stack.top().locals.emplace(arg_name, value);
-		}
+	// the index of a cell is its index in cellvars, including for the arguments that are
+	// captured by an inner scope, so that cellvars names the cells of the frame
+	for (const auto &cellvar : f->function_info().function.metadata.cellvars) {
+		auto *value = create_free_value(cellvar);
+		m_stack.top().locals.emplace(cellvar, value);
 	}
 	for (const auto &capture : m_variable_visibility.at(function_name)->captures) {
 		auto *value = create_free_value(capture);
 		captures.emplace_back(capture, value);
 		m_stack.top().locals.emplace(capture, value);
 	}
-	for (const auto &cellvar : f->function_info().function.metadata.cellvars) {
-		if (!m_stack.top().locals.contains(cellvar)) {
-			auto *value = create_free_value(cellvar);
-			m_stack.top().locals.emplace(cellvar, value);
-		}
-	}
 
 	auto *block = allocate_block(f->function_info().function_id);
 	auto *old_block = m_current_block;
@@ -1044,6 +980,8 @@ Value *BytecodeGenerator::visit(const Lambda *node)
 	// TODO
 	// f->function_info().function.metadata.filename = ;
 	f->function_info().function.metadata.arg_count = arg_count;
+	f->function_info().function.metadata.positional_arg_count =
+		node->args()->posonlyargs().size();
 	f->function_info().function.metadata.kwonly_arg_count = kwonly_arg_count;
 	f->function_info().function.metadata.cell2arg = std::move(cell2arg);
 	f->function_info().function.metadata.flags = flags;
@@ -1121,23 +1059,18 @@ Value *BytecodeGenerator::visit(const Return *node)
 		emit<ClearExceptionState>();
 	}
 
-	// if (auto it = m_current_exception_depth.find(m_function_id);
-	// 	it != m_current_exception_depth.end()) {
-	// 	size_t depth = it->second;
-	// 	while (depth-- > 0) { emit<LeaveExceptionHandling>(); }
-	// }
-
-	const auto transforms = m_return_transform[m_function_id];
-	if (!transforms.empty()) {
+	// the code of the enclosing with/try statements runs from the innermost to the outermost
+	// statement, each one only covered by the exception handlers outside of its statement
+	auto transforms = m_return_transform[m_function_id];
+	auto exception_handlers = m_exception_handlers[m_current_block];
+	std::for_each(transforms.rbegin(), transforms.rend(), [this](const ReturnTransform &t) {
 		m_return_transform[m_function_id].pop_back();
-		transforms.back()(true);
-		std::for_each(transforms.rbegin() + 1, transforms.rend(), [this](const auto &f) {
-			m_return_transform[m_function_id].pop_back();
-			f(false);
-		});
-	}
-	m_return_transform[m_function_id] = std::move(transforms);
+		m_exception_handlers[m_current_block].resize(t.exception_handler_depth);
+		t.transform();
+	});
 	emit<ReturnValue>(src->get_register());
+	m_return_transform[m_function_id] = std::move(transforms);
+	m_exception_handlers[m_current_block] = std::move(exception_handlers);
 	return src;
 }
 
@@ -1224,8 +1157,6 @@ Value *BytecodeGenerator::visit(const Call *node)
 	std::vector<BytecodeValue *> keyword_values;
 	std::vector<Register> keywords;
 
-	auto *func = generate(node->function().get(), m_function_id);
-
 	auto is_args_expansion = [](const std::shared_ptr<ast::ASTNode> &node) {
 		return node->node_type() == ast::ASTNodeType::Starred;
 	};
@@ -1239,6 +1170,23 @@ Value *BytecodeGenerator::visit(const Call *node)
 	bool requires_kwargs_expansion =
 		std::any_of(node->keywords().begin(), node->keywords().end(), is_kwargs_expansion);
 
+	BytecodeValue *func = nullptr;
+	BytecodeValue *self = nullptr;
+	if (auto attr = as<Attribute>(node->function());
+		attr && !requires_args_expansion && !requires_kwargs_expansion) {
+		// "foo.bar(...)": load the method and its receiver into separate registers, so that
+		// MethodCall can pass the receiver as the first argument without a bound method object
+		auto *this_value = generate(attr->value().get(), m_function_id);
+		func = create_value();
+		self = create_value();
+		emit<LoadMethod>(func->get_register(),
+			self->get_register(),
+			this_value->get_register(),
+			load_name(attr->attr(), m_function_id)->get_index());
+	} else {
+		func = generate(node->function().get(), m_function_id);
+	}
+
 	if (requires_args_expansion || requires_kwargs_expansion) {
 		if (!node->args().empty()) { requires_args_expansion = true; }
 		BytecodeValue *list_value = nullptr;
@@ -1335,23 +1283,23 @@ Value *BytecodeGenerator::visit(const Call *node)
 			requires_args_expansion,
 			requires_kwargs_expansion);
 	} else {
-		if (node->function()->node_type() == ASTNodeType::Attribute) {
+		if (self) {
 			std::vector<Register> arg_registers;
+			std::vector<Register> keyword_registers;
+
 			arg_registers.reserve(arg_values.size());
 			for (const auto &arg : arg_values) { arg_registers.push_back(arg->get_register()); }
-			if (keyword_values.empty()) {
-				emit<MethodCall>(func->get_register(), std::move(arg_registers));
-			} else {
-				std::vector<Register> keyword_registers;
-				keyword_registers.reserve(keyword_values.size());
-				for (const auto &kw : keyword_values) {
-					keyword_registers.push_back(kw->get_register());
-				}
-				emit<FunctionCallWithKeywords>(func->get_register(),
-					std::move(arg_registers),
-					std::move(keyword_registers),
-					std::move(keywords));
+
+			keyword_registers.reserve(keyword_values.size());
+			for (const auto &kw : keyword_values) {
+				keyword_registers.push_back(kw->get_register());
 			}
+
+			emit<MethodCall>(func->get_register(),
+				self->get_register(),
+				std::move(arg_registers),
+				std::move(keyword_registers),
+				std::move(keywords));
 		} else {
 			std::vector<Register> arg_registers;
 			std::vector<Register> keyword_registers;
@@ -1708,7 +1656,7 @@ Value *BytecodeGenerator::visit(const ClassDefinition *node)
 	const auto return_none_register = allocate_register();
 
 	// class definition preamble, a la CPython
-	emit<LoadName>(name_register, "__name__");
+	emit<LoadName>(name_register, load_name("__name__", class_id)->get_index());
 	emit<StoreName>("__module__", name_register);
 	emit<LoadConst>(
 		qualname_register, load_const(py::String{ node->name() }, class_id)->get_index());
@@ -2160,18 +2108,14 @@ Value *BytecodeGenerator::visit(const With *node)
 		with_item_results.push_back(generate(item.get(), m_function_id));
 	}
 
-	emit<SetupWith>(cleanup_label);
-
 	set_insert_point(body_block);
 
-	auto with_exit_factory = [this, &with_item_results](bool first) {
+	auto with_exit_factory = [this, &with_item_results]() {
 		auto exit_label = make_label(fmt::format("WITH_EXIT_{}", exit_label_count), m_function_id);
 		for (const auto &item : with_item_results) {
 			auto *exit_result = create_value();
 			auto *exit_method = create_value();
 
-			if (!first) emit<LeaveExceptionHandling>();
-
 			// the result of the call to __exit__ is stored in the return register (r0)
 			// so we need to save the current value of r0 and restore it after calling the
 			// method
@@ -2193,12 +2137,13 @@ Value *BytecodeGenerator::visit(const With *node)
 	{
 		ScopedWithStatement scope{ *this, with_exit_factory, m_function_id };
 
+		push_exception_handler(cleanup_label);
 		for (const auto &statement : node->body()) { generate(statement.get(), m_function_id); }
-		emit<LeaveExceptionHandling>();
+		pop_exception_handler();
 		auto *cleanup_block = allocate_block(m_function_id);
 		set_insert_point(cleanup_block);
 		bind(cleanup_label);
-		with_exit_factory(true);
+		with_exit_factory();
 
 		auto *next_block = allocate_block(m_function_id);
 		set_insert_point(next_block);
@@ -2211,12 +2156,15 @@ Value *BytecodeGenerator::visit(const WithItem *node)
 {
 	auto *ctx_expr_result = generate(node->context_expr().get(), m_function_id);
 	auto *enter_method = create_value();
+	auto *enter_self = create_value();
 	auto *ctx_expr = create_value();
 	emit<Move>(ctx_expr->get_register(), ctx_expr_result->get_register());
 	emit<LoadMethod>(enter_method->get_register(),
+		enter_self->get_register(),
 		ctx_expr->get_register(),
 		load_name("__enter__", m_function_id)->get_index());
-	emit<MethodCall>(enter_method->get_register(), std::vector<Register>{});
+	emit<MethodCall>(
+		enter_method->get_register(), enter_self->get_register(), std::vector<Register>{});
 	auto *enter_result = create_return_value();
 
 	if (auto optional_vars = node->optional_vars()) {
@@ -2277,13 +2225,10 @@ Value *BytecodeGenerator::visit(const Try *node)
 	auto finally_label =
 		make_label(fmt::format("TRY_FINALLY_OP_COUNT_{}", try_op_count++), m_function_id);
 
-	emit<SetupExceptionHandling>(next_exception_label);
-
 	auto *body_block = allocate_block(m_function_id);
 	set_insert_point(body_block);
 
-	auto finally_code_with_exception = [this, &node](bool first) {
-		if (!first) emit<LeaveExceptionHandling>();
+	auto finally_code_with_exception = [this, &node]() {
 		if (node->finalbody().empty()) {
 			auto *empty_finally_block = allocate_block(m_function_id);
 			set_insert_point(empty_finally_block);
@@ -2303,9 +2248,9 @@ Value *BytecodeGenerator::visit(const Try *node)
 	{
 		ScopedTryStatement try_scope{ *this, finally_code_with_exception, m_function_id };
 
+		push_exception_handler(next_exception_label);
 		for (const auto &statement : node->body()) { generate(statement.get(), m_function_id); }
-
-		emit<LeaveExceptionHandling>();
+		pop_exception_handler();
 
 		if (!node->orelse().empty()) {
 			ASSERT(orelse_label)
@@ -2314,8 +2259,6 @@ Value *BytecodeGenerator::visit(const Try *node)
 			emit<Jump>(finally_label);
 		}
 
-		const size_t exception_depth = m_current_exception_depth[m_function_id];
-
 		for (const auto &handler : node->handlers()) {
 			auto *exception_handler_block = allocate_block(m_function_id);
 			set_insert_point(exception_handler_block);
@@ -2338,10 +2281,7 @@ Value *BytecodeGenerator::visit(const Try *node)
 			set_insert_point(exception_handler_body);
 			{
 				ScopedClearExceptionBeforeReturn s{ *this, m_function_id };
-				// emit<LeaveExceptionHandling>();
-				m_current_exception_depth[m_function_id] = exception_depth - 1;
 				for (const auto &el : handler->body()) { generate(el.get(), m_function_id); }
-				m_current_exception_depth[m_function_id] = exception_depth;
 				emit<ClearExceptionState>();
 			}
 			emit<Jump>(finally_label);
@@ -2358,8 +2298,6 @@ Value *BytecodeGenerator::visit(const Try *node)
 
 	if (next_exception_label) bind(next_exception_label);
 
-	// emit<LeaveExceptionHandling>();
-
 	if (node->finalbody().empty()) {
 		auto *empty_finally_block = allocate_block(m_function_id);
 		set_insert_point(empty_finally_block);
@@ -3119,9 +3057,32 @@ std::shared_ptr<Program> BytecodeGenerator::generate_executable(std::string file
 	ASSERT(m_frame_stack_value_count.size() == 2)
 	ASSERT(m_frame_free_var_count.size() == 2)
 	relocate_labels(m_functions);
+	for (auto &function : m_functions.functions) {
+		auto ranges = m_exception_ranges.find(&function.blocks);
+		if (ranges == m_exception_ranges.end()) { continue; }
+		function.exception_table.reserve(ranges->second.size());
+		for (const auto &range : ranges->second) {
+			function.exception_table.push_back(ExceptionTableEntry{
+				range.start, range.end, static_cast<size_t>(range.handler->position()) });
+		}
+	}
 	return BytecodeProgram::create(std::move(m_functions), filename, argv);
 }
 
+void BytecodeGenerator::add_exception_range(size_t instruction_idx)
+{
+	auto handlers = m_exception_handlers.find(m_current_block);
+	if (handlers == m_exception_handlers.end() || handlers->second.empty()) { return; }
+	const auto &handler = handlers->second.back();
+	auto &ranges = m_exception_ranges[m_current_block];
+	if (!ranges.empty() && ranges.back().end == instruction_idx
+		&& ranges.back().handler == handler) {
+		ranges.back().end++;
+		return;
+	}
+	ranges.push_back(ExceptionRange{ instruction_idx, instruction_idx + 1, handler });
+}
+
 InstructionVector *BytecodeGenerator::allocate_block(size_t function_id)
 {
 	ASSERT(function_id < m_functions.functions.size())
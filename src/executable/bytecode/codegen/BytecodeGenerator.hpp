@@ -187,24 +187,21 @@ class BytecodeGenerator : public ast::CodeGenerator
 		bool requires_cleanup{ false };
 	};
 
+	// Registers the code that has to run when a return statement leaves the body of a with/try
+	// statement. The transform runs outside of the exception handlers of the statement, so it
+	// has to be created before the statement pushes them.
 	struct ScopedWithStatement
 	{
 		ScopedWithStatement(BytecodeGenerator &generator_,
-			std::function<void(bool)> return_transform,
+			std::function<void()> return_transform,
 			size_t function_id_)
 			: generator(generator_), function_id(function_id_)
 		{
-			generator.m_return_transform[function_id].push_back(std::move(return_transform));
-			generator.m_current_exception_depth[function_id]++;
+			generator.m_return_transform[function_id].push_back(ReturnTransform{
+				std::move(return_transform), generator.exception_handler_depth() });
 		}
 
-		~ScopedWithStatement()
-		{
-			ASSERT(generator.m_current_exception_depth[function_id] > 0);
-
-			generator.m_return_transform[function_id].pop_back();
-			generator.m_current_exception_depth[function_id]--;
-		}
+		~ScopedWithStatement() { generator.m_return_transform[function_id].pop_back(); }
 
 	  protected:
 		BytecodeGenerator &generator;
@@ -214,7 +211,7 @@ class BytecodeGenerator : public ast::CodeGenerator
 	struct ScopedTryStatement : ScopedWithStatement
 	{
 		ScopedTryStatement(BytecodeGenerator &generator_,
-			std::function<void(bool)> return_transform,
+			std::function<void()> return_transform,
 			size_t function_id_)
 			: ScopedWithStatement(generator_, return_transform, function_id_)
 		{}
@@ -248,9 +245,31 @@ class BytecodeGenerator : public ast::CodeGenerator
 	ASTContext m_ctx;
 	std::stack<Scope> m_stack;
 
+	struct ReturnTransform
+	{
+		std::function<void()> transform;
+		// the number of exception handlers that enclose the statement that registered the
+		// transform
+		size_t exception_handler_depth;
+	};
+
+	struct ExceptionRange
+	{
+		size_t start;
+		size_t end;
+		std::shared_ptr<Label> handler;
+	};
+
 	std::set<size_t> m_clear_exception_before_return_functions;
-	std::unordered_map<size_t, std::vector<std::function<void(bool)>>> m_return_transform;
-	std::unordered_map<size_t, size_t> m_current_exception_depth;
+	std::unordered_map<size_t, std::vector<ReturnTransform>> m_return_transform;
+
+	// Exception handlers are resolved at compile time: the handlers of the try/with statements
+	// enclosing the insert point of a function are kept in a stack (innermost last), and every
+	// emitted instruction is added to the range of the innermost one. The ranges become the
+	// exception table of the function.
+	std::unordered_map<const InstructionVector *, std::vector<std::shared_ptr<Label>>>
+		m_exception_handlers;
+	std::unordered_map<const InstructionVector *, std::vector<ExceptionRange>> m_exception_ranges;
 
   public:
 	static std::shared_ptr<Program> compile(std::shared_ptr<ast::Module> node,
@@ -264,9 +283,31 @@ class BytecodeGenerator : public ast::CodeGenerator
 	template<typename OpType, typename... Args> void emit(Args &&...args)
 	{
 		ASSERT(m_current_block)
+		add_exception_range(m_current_block->size());
 		m_current_block->push_back(std::make_unique<OpType>(std::forward<Args>(args)...));
 	}
 
+	void add_exception_range(size_t instruction_idx);
+
+	void push_exception_handler(std::shared_ptr<Label> handler)
+	{
+		ASSERT(m_current_block)
+		m_exception_handlers[m_current_block].push_back(std::move(handler));
+	}
+
+	void pop_exception_handler()
+	{
+		ASSERT(m_current_block)
+		ASSERT(!m_exception_handlers[m_current_block].empty())
+		m_exception_handlers[m_current_block].pop_back();
+	}
+
+	size_t exception_handler_depth()
+	{
+		ASSERT(m_current_block)
+		return m_exception_handlers[m_current_block].size();
+	}
+
 	friend std::ostream &operator<<(std::ostream &os, BytecodeGenerator &generator);
 
 	std::string to_string() const;
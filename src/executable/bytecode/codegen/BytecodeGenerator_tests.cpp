@@ -1,14 +1,17 @@
+#include "../Bytecode.hpp"
 #include "../BytecodeProgram.hpp"
 #include "BytecodeGenerator.hpp"
 #include "executable/common.hpp"
 #include "lexer/Lexer.hpp"
 #include "parser/Parser.hpp"
+#include "runtime/PyCode.hpp"
 
 #include "gtest/gtest.h"
 
 
 namespace {
-std::shared_ptr<BytecodeProgram> generate_bytecode(std::string_view program)
+std::shared_ptr<BytecodeProgram> generate_bytecode(std::string_view program,
+	compiler::Backend backend = compiler::Backend::BYTECODE_GENERATOR)
 {
 	auto lexer = Lexer::create(std::string(program), "_bytecode_generator_tests_.py");
 	parser::Parser p{ lexer };
@@ -17,8 +20,8 @@ std::shared_ptr<BytecodeProgram> generate_bytecode(std::string_view program)
 	auto module = as<ast::Module>(p.module());
 	ASSERT(module)
 
-	return std::static_pointer_cast<BytecodeProgram>(compiler::compile(
-		module, {}, compiler::Backend::BYTECODE_GENERATOR, compiler::OptimizationLevel::None));
+	return std::static_pointer_cast<BytecodeProgram>(
+		compiler::compile(module, {}, backend, compiler::OptimizationLevel::None));
 }
 }// namespace
 
@@ -44,3 +47,62 @@ TEST(BytecodeGenerator, EmitsProgramWithFunctionDefinitions)
 	ASSERT_EQ(bytecode_generator->functions().size(), 2);
 	ASSERT_TRUE(bytecode_generator->main_function());
 }
+
+
+TEST(BytecodeGenerator, EmitsExceptionTableForTryStatements)
+{
+	constexpr std::string_view program =
+		"def foo(arg):\n"
+		"   try:\n"
+		"      try:\n"
+		"         arg = arg + 1\n"
+		"      except TypeError:\n"
+		"         arg = 1\n"
+		"      arg = arg * 2\n"
+		"   except ValueError:\n"
+		"      return 0\n"
+		"   return arg\n";
+
+	auto bytecode_generator = generate_bytecode(program);
+	ASSERT_EQ(bytecode_generator->functions().size(), 1);
+	const auto *function =
+		static_cast<const Bytecode *>(bytecode_generator->functions()[0]->function().get());
+	const auto &exception_table = function->exception_table();
+
+	// the body of the inner try statement, then the inner handler and the rest of the outer body
+	ASSERT_EQ(exception_table.size(), 2);
+	const auto &inner = exception_table[0];
+	const auto &outer = exception_table[1];
+	EXPECT_LT(inner.start, inner.end);
+	EXPECT_EQ(inner.end, outer.start);
+	EXPECT_LT(outer.start, outer.end);
+	// handlers are not covered by the exception table entry they handle
+	EXPECT_GE(inner.handler, inner.end);
+	EXPECT_LT(inner.handler, outer.end);
+	EXPECT_GE(outer.handler, outer.end);
+}
+
+TEST(BytecodeGenerator, EmitsUnboundMethodCallsWithMLIRBackend)
+{
+	constexpr std::string_view program =
+		"def foo(values):\n"
+		"   values.append(1)\n"
+		"   return values.index(1, start=0)\n";
+
+	auto bytecode_program = generate_bytecode(program, compiler::Backend::MLIR);
+	ASSERT_EQ(bytecode_program->functions().size(), 1);
+	const auto *function =
+		static_cast<const Bytecode *>(bytecode_program->functions()[0]->function().get());
+
+	size_t load_method_count = 0;
+	size_t method_call_count = 0;
+	for (const auto &instruction : *function) {
+		if (instruction->id() == LOAD_METHOD) { load_method_count++; }
+		if (instruction->id() == METHOD_CALL) { method_call_count++; }
+		// the receiver is passed to the call, so the method is never bound
+		EXPECT_NE(instruction->id(), FUNCTION_CALL);
+		EXPECT_NE(instruction->id(), FUNCTION_CALL_WITH_KW);
+	}
+	EXPECT_EQ(load_method_count, 2);
+	EXPECT_EQ(method_call_count, 2);
+}
@@ -1,4 +1,5 @@
 #include "BinarySubscript.hpp"
+#include "runtime/PyList.hpp"
 #include "runtime/PyObject.hpp"
 #include "runtime/Value.hpp"
 #include "vm/VM.hpp"
@@ -8,6 +9,20 @@ using namespace py;
 PyResult<Value> BinarySubscript::execute(VirtualMachine &vm, Interpreter &) const
 {
 	auto object_value = vm.reg(m_src);
+	// list[int] reads unboxed elements without boxing them
+	if (auto *obj = std::get_if<PyObject *>(&object_value); obj && *obj) {
+		if (auto *list = as<PyList>(*obj)) {
+			if (auto index = ListStorage::unbox_int(vm.reg(m_index))) {
+				const auto size = static_cast<int64_t>(list->storage().size());
+				if (*index < 0) { *index += size; }
+				if (*index >= 0 && *index < size) {
+					vm.reg(m_dst) = list->storage()[*index];
+					return Ok(vm.reg(m_dst));
+				}
+			}
+		}
+	}
+
 	auto object = PyObject::from(object_value);
 	if (object.is_err()) return object;
 
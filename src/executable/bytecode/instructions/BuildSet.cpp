@@ -15,7 +15,7 @@ PyResult<Value> BuildSet::execute(VirtualMachine &vm, Interpreter &) const
 			start = std::next(start);
 		}
 	}
-	return PySet::create(elements).and_then([&vm, this](PySet *set) {
+	return PySet::create(std::move(elements)).and_then([&vm, this](PySet *set) {
 		vm.reg(m_dst) = set;
 		return Ok(set);
 	});
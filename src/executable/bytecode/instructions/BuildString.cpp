@@ -6,28 +6,22 @@ using namespace py;
 
 PyResult<Value> BuildString::execute(VirtualMachine &vm, Interpreter &) const
 {
-	std::vector<Value> elements;
-	elements.reserve(m_size);
+	// the pieces stay alive on the stack until the result is built
+	PyString::Builder builder{ m_size };
 	if (m_size > 0) {
-		auto *start = vm.sp() - m_size;
-		while (start != vm.sp()) {
-			elements.push_back(*start);
-			start = std::next(start);
-		}
-	}
-	std::string result_string;
-	for (const auto &el : elements) {
-		if (std::holds_alternative<String>(el)) {
-			result_string += std::get<String>(el).s;
-		} else if (std::holds_alternative<PyObject *>(el)) {
-			ASSERT(as<PyString>(std::get<PyObject *>(el)));
-			result_string += as<PyString>(std::get<PyObject *>(el))->value();
-		} else {
-			TODO();
+		for (auto *it = vm.sp() - m_size; it != vm.sp(); it = std::next(it)) {
+			if (std::holds_alternative<String>(*it)) {
+				builder.append(std::get<String>(*it).s);
+			} else if (std::holds_alternative<PyObject *>(*it)) {
+				ASSERT(as<PyString>(std::get<PyObject *>(*it)));
+				builder.append(*as<PyString>(std::get<PyObject *>(*it)));
+			} else {
+				TODO();
+			}
 		}
 	}
 
-	return PyString::create(std::move(result_string)).and_then([&vm, this](PyString *str) {
+	return builder.build().and_then([&vm, this](PyString *str) {
 		vm.reg(m_dst) = str;
 		return Ok(str);
 	});
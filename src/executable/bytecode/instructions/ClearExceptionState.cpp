@@ -3,7 +3,6 @@
 #include "runtime/BaseException.hpp"
 #include "runtime/PyFrame.hpp"
 #include "runtime/PyNone.hpp"
-#include "runtime/PyTraceback.hpp"
 
 using namespace py;
 
@@ -24,7 +23,7 @@ PyResult<Value> ClearExceptionState::execute(VirtualMachine &, Interpreter &inte
 	// }
 	if (interpreter.execution_frame()->exception_info().has_value()) {
 		while (interpreter.execution_frame()->exception_info().has_value()
-			   && (interpreter.execution_frame()->exception_info()->traceback->m_tb_frame
+			   && (interpreter.execution_frame()->exception_info()->frame
 				   == interpreter.execution_frame())) {
 			interpreter.execution_frame()->pop_exception();
 		}
@@ -3,9 +3,6 @@
 #include "interpreter/Interpreter.hpp"
 #include "runtime/PyFrame.hpp"
 #include "runtime/PyNone.hpp"
-#include "runtime/PyTraceback.hpp"
-#include "runtime/PyType.hpp"
-#include "runtime/StopIteration.hpp"
 #include "vm/VM.hpp"
 
 #include "../serialization/serialize.hpp"
@@ -18,19 +15,17 @@ PyResult<Value> ForIter::execute(VirtualMachine &vm, Interpreter &) const
 	ASSERT(m_body_offset.has_value())
 	auto iterator = vm.reg(m_src);
 	if (auto *iterable_object = std::get_if<PyObject *>(&iterator)) {
-		const auto &next_value = (*iterable_object)->next();
-		if (next_value.is_err()) {
-			auto *last_exception = next_value.unwrap_err();
-			if (last_exception->type()->issubclass(stop_iteration()->type())) {
-				vm.set_instruction_pointer(vm.instruction_pointer() + *m_offset);
-				return Ok(py_none());
-			} else {
-				return Err(next_value.unwrap_err());
-			}
+		// builtin iterators signal exhaustion without creating a StopIteration
+		auto next_value = (*iterable_object)->try_next();
+		if (next_value.is_err()) { return Err(next_value.unwrap_err()); }
+		auto value = next_value.unwrap();
+		if (!value.has_value()) {
+			vm.set_instruction_pointer(vm.instruction_pointer() + *m_offset);
+			return Ok(py_none());
 		}
-		vm.reg(m_dst) = next_value.unwrap();
+		vm.reg(m_dst) = *value;
 		vm.set_instruction_pointer(vm.instruction_pointer() + *m_body_offset);
-		return Ok(Value{ next_value.unwrap() });
+		return Ok(std::move(*value));
 	} else {
 		// this is probably always going to be something that went wrong internally
 		TODO();
@@ -1,4 +1,5 @@
 #include "FormatValue.hpp"
+#include "runtime/PyInteger.hpp"
 #include "runtime/PyString.hpp"
 #include "vm/VM.hpp"
 
@@ -8,6 +9,29 @@ PyResult<Value> FormatValue::execute(VirtualMachine &vm, Interpreter &) const
 {
 	auto src = vm.reg(m_src);
 
+	// str() of a str or an int does not need to go through the type's slots
+	if (m_conversion == 0
+		|| static_cast<PyString::ReplacementField::Conversion>(m_conversion)
+			   == PyString::ReplacementField::Conversion::STR) {
+		if (auto *number = std::get_if<Number>(&src); number && number->is_integer()) {
+			return PyString::create(number->to_string()).and_then([&vm, this](PyString *str) {
+				vm.reg(m_dst) = str;
+				return Ok(str);
+			});
+		} else if (std::holds_alternative<PyObject *>(src)) {
+			auto *obj = std::get<PyObject *>(src);
+			if (as<PyString>(obj)) {
+				vm.reg(m_dst) = obj;
+				return Ok(src);
+			} else if (auto *integer = as<PyInteger>(obj)) {
+				return PyString::create(integer->to_string()).and_then([&vm, this](PyString *str) {
+					vm.reg(m_dst) = str;
+					return Ok(str);
+				});
+			}
+		}
+	}
+
 	return PyObject::from(src)
 		.and_then([this](PyObject *obj) {
 			if (m_conversion == 0) { return obj->str(); }
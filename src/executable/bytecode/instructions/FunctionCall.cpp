@@ -1,7 +1,5 @@
 #include "FunctionCall.hpp"
-#include "runtime/PyDict.hpp"
-#include "runtime/PyFunction.hpp"
-#include "runtime/PyTuple.hpp"
+#include "runtime/PyObject.hpp"
 #include "vm/VM.hpp"
 
 using namespace py;
@@ -12,19 +10,12 @@ PyResult<Value> FunctionCall::execute(VirtualMachine &vm, Interpreter &) const
 	ASSERT(std::get_if<PyObject *>(&func));
 	auto callable_object = std::get<PyObject *>(func);
 
-	std::vector<Value> args;
-	args.reserve(m_size);
-	if (m_size > 0) {
-		auto *el = vm.sp() - m_size;
-		for (; el < vm.sp(); ++el) { args.push_back(*el); }
-	}
-
-	auto args_tuple = PyTuple::create(args);
-	if (args_tuple.is_err()) { return Err(args_tuple.unwrap_err()); }
-	spdlog::debug("args_tuple: {}", (void *)args_tuple.unwrap());
+	// the arguments were pushed onto the stack by the caller, and stay there until after the call
+	// returns, so the callee can read them in place
+	const std::span<const Value> args{ vm.sp() - m_size, m_size };
 	spdlog::debug("calling function: \'{}\'", callable_object->to_string());
 
-	auto result = callable_object->call(args_tuple.unwrap(), nullptr);
+	auto result = callable_object->vectorcall(args);
 	if (result.is_ok()) {
 		vm.reg(0) = result.unwrap();
 		return Ok(Value{ result.unwrap() });
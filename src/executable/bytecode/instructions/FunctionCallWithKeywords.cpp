@@ -2,9 +2,7 @@
 #include "FunctionCall.hpp"
 
 #include "interpreter/Interpreter.hpp"
-#include "runtime/PyDict.hpp"
 #include "runtime/PyFrame.hpp"
-#include "runtime/PyTuple.hpp"
 #include "vm/VM.hpp"
 
 #include "../serialization/serialize.hpp"
@@ -18,30 +16,22 @@ PyResult<Value> FunctionCallWithKeywords::execute(VirtualMachine &vm,
 	ASSERT(std::get_if<PyObject *>(&func));
 	auto function_object = std::get<PyObject *>(func);
 
-	std::vector<Value> args;
-	for (const auto &arg_register : m_args) { args.push_back(vm.reg(arg_register)); }
-	auto args_tuple = PyTuple::create(args);
-
-	if (args_tuple.is_err()) { return Err(args_tuple.unwrap_err()); }
-	ASSERT(args_tuple.is_ok());
-
-	PyDict::MapType map;
-
 	ASSERT(m_kwargs.size() == m_keywords.size())
 
+	ArgumentBuffer args{ m_args.size() + m_kwargs.size() };
+	std::vector<std::string_view> kwnames;
+	kwnames.reserve(m_keywords.size());
+
+	size_t idx = 0;
+	for (const auto &arg_register : m_args) { args[idx++] = vm.reg(arg_register); }
 	for (size_t i = 0; i < m_kwargs.size(); ++i) {
-		const auto &keyword = interpreter.execution_frame()->names(m_keywords[i]);
-		map.insert_or_assign(String{ keyword }, vm.reg(m_kwargs[i]));
+		kwnames.push_back(interpreter.execution_frame()->names(m_keywords[i]));
+		args[idx++] = vm.reg(m_kwargs[i]);
 	}
 
-	auto kwargs_dict = PyDict::create(map);
-	if (kwargs_dict.is_err()) { return Err(kwargs_dict.unwrap_err()); }
-	ASSERT(kwargs_dict.is_ok());
-
 	spdlog::debug("calling function with arguments: \'{}\'", function_object->to_string());
 
-	if (auto result = function_object->call(args_tuple.unwrap(), kwargs_dict.unwrap());
-		result.is_ok()) {
+	if (auto result = function_object->vectorcall(args.values(), kwnames); result.is_ok()) {
 		vm.reg(0) = result.unwrap();
 		return Ok(Value{ result.unwrap() });
 	} else {
@@ -10,22 +10,22 @@ using namespace py;
 
 PyResult<Value> ImportFrom::execute(VirtualMachine &vm, Interpreter &interpreter) const
 {
-	const std::string name = interpreter.execution_frame()->names(m_name);
+	auto *name = interpreter.execution_frame()->interned_name(m_name);
 	const auto &from = vm.reg(m_from);
 
 	ASSERT(as<PyModule>(PyObject::from(from).unwrap()));
 
 	auto module = as<PyModule>(PyObject::from(from).unwrap());
-	auto obj_ = module->get_attribute(PyString::create(name).unwrap());
+	auto obj_ = module->get_attribute(name);
 
 	return obj_
 		.and_then([&vm, this](PyObject *obj) {
 			vm.reg(m_destination) = obj;
 			return Ok(obj);
 		})
-		.or_else([&name, &module](auto) -> PyResult<PyObject *> {
-			return Err(
-				import_error("cannot import name {} from {}", name, module->name()->value()));
+		.or_else([name, &module](auto) -> PyResult<PyObject *> {
+			return Err(import_error(
+				"cannot import name {} from {}", name->value(), module->name()->value()));
 		});
 }
 
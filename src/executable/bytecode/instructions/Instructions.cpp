@@ -8,7 +8,6 @@
 #include "BuildString.hpp"
 #include "BuildTuple.hpp"
 #include "ClearExceptionState.hpp"
-#include "ClearTopCleanup.hpp"
 #include "CompareOperation.hpp"
 #include "DeleteName.hpp"
 #include "DeleteSubscript.hpp"
@@ -32,7 +31,6 @@
 #include "JumpIfNotExceptionMatch.hpp"
 #include "JumpIfTrue.hpp"
 #include "JumpIfTrueOrPop.hpp"
-#include "LeaveExceptionHandling.hpp"
 #include "ListAppend.hpp"
 #include "ListExtend.hpp"
 #include "ListToTuple.hpp"
@@ -56,8 +54,6 @@
 #include "ReturnValue.hpp"
 #include "SetAdd.hpp"
 #include "SetUpdate.hpp"
-#include "SetupExceptionHandling.hpp"
-#include "SetupWith.hpp"
 #include "StoreAttr.hpp"
 #include "StoreDeref.hpp"
 #include "StoreFast.hpp"
@@ -83,7 +79,7 @@ std::unique_ptr<Instruction> deserialize(std::span<const uint8_t> &instruction_b
 	switch (instruction_code) {
 	case LOAD_NAME: {
 		const auto dst = deserialize<uint8_t>(instruction_buffer);
-		const auto object_name = deserialize<std::string>(instruction_buffer);
+		const auto object_name = deserialize<uint8_t>(instruction_buffer);
 		return std::make_unique<LoadName>(dst, object_name);
 	} break;
 	case LOAD_CONST: {
@@ -194,12 +190,21 @@ std::unique_ptr<Instruction> deserialize(std::span<const uint8_t> &instruction_b
 		const auto dst = deserialize<uint8_t>(instruction_buffer);
 		const auto value_source = deserialize<uint8_t>(instruction_buffer);
 		const auto method_name = deserialize<uint8_t>(instruction_buffer);
+		const auto has_self_destination = deserialize<uint8_t>(instruction_buffer);
+		const auto self_destination = deserialize<uint8_t>(instruction_buffer);
+		if (has_self_destination) {
+			return std::make_unique<LoadMethod>(dst, self_destination, value_source, method_name);
+		}
 		return std::make_unique<LoadMethod>(dst, value_source, method_name);
 	}
 	case METHOD_CALL: {
 		const auto caller = deserialize<uint8_t>(instruction_buffer);
+		const auto self = deserialize<uint8_t>(instruction_buffer);
 		auto args = deserialize<std::vector<uint8_t>>(instruction_buffer);
-		return std::make_unique<MethodCall>(caller, std::move(args));
+		auto kwargs = deserialize<std::vector<uint8_t>>(instruction_buffer);
+		auto keywords = deserialize<std::vector<uint8_t>>(instruction_buffer);
+		return std::make_unique<MethodCall>(
+			caller, self, std::move(args), std::move(kwargs), std::move(keywords));
 	}
 	case STORE_ATTR: {
 		const auto dst = deserialize<uint8_t>(instruction_buffer);
@@ -312,10 +317,6 @@ std::unique_ptr<Instruction> deserialize(std::span<const uint8_t> &instruction_b
 		const auto size = deserialize<uint8_t>(instruction_buffer);
 		return std::make_unique<BuildList>(dst, size);
 	}
-	case SETUP_EXCEPTION_HANDLING: {
-		const auto offset = deserialize<uint32_t>(instruction_buffer);
-		return std::make_unique<SetupExceptionHandling>(offset);
-	}
 	case JUMP_FORWARD: {
 		const auto offset = deserialize<uint32_t>(instruction_buffer);
 		return std::make_unique<JumpForward>(offset);
@@ -394,21 +395,11 @@ std::unique_ptr<Instruction> deserialize(std::span<const uint8_t> &instruction_b
 		const auto src = deserialize<uint8_t>(instruction_buffer);
 		return std::make_unique<LoadDeref>(dst, src);
 	}
-	case LEAVE_EXCEPTION_HANDLING: {
-		return std::make_unique<LeaveExceptionHandling>();
-	}
 	case DELETE_SUBSCRIPT: {
 		const auto value = deserialize<uint8_t>(instruction_buffer);
 		const auto index = deserialize<uint8_t>(instruction_buffer);
 		return std::make_unique<DeleteSubscript>(value, index);
 	}
-	case SETUP_WITH: {
-		const auto offset = deserialize<uint32_t>(instruction_buffer);
-		return std::make_unique<SetupWith>(offset);
-	}
-	case CLEAR_TOP_CLEANUP: {
-		return std::make_unique<ClearTopCleanup>();
-	}
 	case UNPACK_SEQUENCE: {
 		const auto dst = deserialize<std::vector<uint8_t>>(instruction_buffer);
 		const auto src = deserialize<uint8_t>(instruction_buffer);
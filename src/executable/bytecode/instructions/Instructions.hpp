@@ -56,7 +56,6 @@ static constexpr uint8_t METHOD_CALL = 38;
 static constexpr uint8_t MOVE = 39;
 static constexpr uint8_t RAISE_VARARGS = 40;
 static constexpr uint8_t RETURN_VALUE = 41;
-static constexpr uint8_t SETUP_EXCEPTION_HANDLING = 42;
 static constexpr uint8_t STORE_ATTR = 43;
 static constexpr uint8_t STORE_DEREF = 44;
 static constexpr uint8_t STORE_FAST = 45;
@@ -68,10 +67,7 @@ static constexpr uint8_t UNPACK_SEQUENCE = 50;
 static constexpr uint8_t CONTINUE = 51;
 static constexpr uint8_t RERAISE = 52;
 static constexpr uint8_t WITH_EXCEPT_START = 53;
-static constexpr uint8_t LEAVE_EXCEPTION_HANDLING = 54;
 static constexpr uint8_t DELETE_SUBSCRIPT = 55;
-static constexpr uint8_t SETUP_WITH = 56;
-static constexpr uint8_t CLEAR_TOP_CLEANUP = 57;
 static constexpr uint8_t LIST_APPEND = 58;
 static constexpr uint8_t SET_ADD = 59;
 static constexpr uint8_t BUILD_SET = 60;
@@ -1,5 +1,6 @@
 #include "ListAppend.hpp"
 #include "runtime/PyList.hpp"
+#include "runtime/PyNone.hpp"
 #include "runtime/PyTuple.hpp"
 #include "vm/VM.hpp"
 
@@ -16,8 +17,10 @@ PyResult<Value> ListAppend::execute(VirtualMachine &vm, Interpreter &) const
 	ASSERT(pylist)
 	ASSERT(as<PyList>(pylist))
 
-	return PyObject::from(value).and_then(
-		[pylist](PyObject *element) { return as<PyList>(pylist)->append(element); });
+	// ints and floats are stored unboxed by lists with the int or float strategy, so the value is
+	// not boxed here
+	as<PyList>(pylist)->storage().push_back(value);
+	return Ok(Value{ py_none() });
 }
 
 std::vector<uint8_t> ListAppend::serialize() const
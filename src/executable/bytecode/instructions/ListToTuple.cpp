@@ -14,7 +14,7 @@ PyResult<Value> ListToTuple::execute(VirtualMachine &vm, Interpreter &) const
 	auto *pylist = std::get<PyObject *>(list);
 	ASSERT(as<PyList>(pylist))
 
-	auto result = PyTuple::create(as<PyList>(pylist)->elements());
+	auto result = PyTuple::create(as<PyList>(pylist)->storage().values());
 	if (result.is_ok()) {
 		vm.reg(m_tuple) = result.unwrap();
 		return Ok(Value{ result.unwrap() });
@@ -11,7 +11,7 @@ using namespace py;
 PyResult<Value> LoadAttr::execute(VirtualMachine &vm, Interpreter &interpreter) const
 {
 	auto this_value = vm.reg(m_value_source);
-	const auto &attribute_name = interpreter.execution_frame()->names(m_attr_name);
+	auto *attribute_name = interpreter.execution_frame()->interned_name(m_attr_name);
 	spdlog::debug("This object: {}",
 		std::visit(
 			[](const auto &val) {
@@ -22,16 +22,14 @@ PyResult<Value> LoadAttr::execute(VirtualMachine &vm, Interpreter &interpreter)
 			this_value));
 	auto result = [&]() -> PyResult<Value> {
 		if (auto *this_obj = std::get_if<PyObject *>(&this_value)) {
-			auto name = PyString::create(attribute_name);
-			if (auto r = (*this_obj)->get_attribute(name.unwrap()); r.is_ok()) {
+			if (auto r = (*this_obj)->get_attribute(attribute_name); r.is_ok()) {
 				return Ok(Value{ r.unwrap() });
 			} else {
 				return Err(r.unwrap_err());
 			}
 		} else {
-			auto result = PyObject::from(this_value).and_then([&attribute_name](PyObject *obj) {
-				auto name = PyString::create(attribute_name);
-				return obj->get_attribute(name.unwrap());
+			auto result = PyObject::from(this_value).and_then([attribute_name](PyObject *obj) {
+				return obj->get_attribute(attribute_name);
 			});
 			if (result.is_ok()) {
 				return Ok(Value{ result.unwrap() });
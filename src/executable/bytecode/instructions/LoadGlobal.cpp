@@ -15,20 +15,14 @@ PyResult<Value> LoadGlobal::execute(VirtualMachine &vm, Interpreter &interpreter
 {
 	auto *globals = interpreter.execution_frame()->globals();
 	const auto &builtins = interpreter.execution_frame()->builtins()->symbol_table()->map();
-	const auto &object_name = interpreter.execution_frame()->names(m_object_name);
-
-
-	PyString *name = nullptr;
+	auto *name = interpreter.execution_frame()->interned_name(m_object_name);
 
 	if (auto *g = as<PyDict>(globals)) {
-		if (const auto &it = g->map().find(String{ object_name }); it != g->map().end()) {
+		if (const auto &it = g->map().find(name); it != g->map().end()) {
 			vm.reg(m_destination) = it->second;
 			return Ok(it->second);
 		}
 	} else {
-		auto name_ = PyString::create(object_name);
-		if (name_.is_err()) { return Err(name_.unwrap_err()); }
-		name = name_.unwrap();
 		auto it = globals->as_mapping().unwrap().getitem(name);
 		if (it.is_ok()) {
 			vm.reg(m_destination) = it.unwrap();
@@ -38,18 +32,12 @@ PyResult<Value> LoadGlobal::execute(VirtualMachine &vm, Interpreter &interpreter
 		}
 	}
 
-	if (!name) {
-		auto name_ = PyString::create(object_name);
-		if (name_.is_err()) { return Err(name_.unwrap_err()); }
-		name = name_.unwrap();
-	}
-
 	if (const auto &it = builtins.find(name); it != builtins.end()) {
 		vm.reg(m_destination) = it->second;
 		return Ok(it->second);
 	}
 
-	return Err(name_error("name '{:s}' is not defined", object_name));
+	return Err(name_error("name '{:s}' is not defined", name->value()));
 }
 
 std::vector<uint8_t> LoadGlobal::serialize() const
@@ -14,17 +14,24 @@ using namespace py;
 PyResult<Value> LoadMethod::execute(VirtualMachine &vm, Interpreter &interpreter) const
 {
 	auto this_value = vm.reg(m_value_source);
-	const auto &method_name = interpreter.execution_frame()->names(m_method_name);
+	auto *name = interpreter.execution_frame()->interned_name(m_method_name);
 	auto this_obj_ = PyObject::from(this_value);
 	if (this_obj_.is_err()) { return Err(this_obj_.unwrap_err()); }
 	auto *this_obj = this_obj_.unwrap();
-	auto name = PyString::create(method_name);
-	return name
-		.and_then([this_obj](PyString *method_name) { return this_obj->get_method(method_name); })
-		.and_then([&vm, this](PyObject *method_obj) {
-			vm.reg(m_destination) = method_obj;
-			return Ok(method_obj);
-		});
+
+	if (m_self_destination.has_value()) {
+		auto method = this_obj->get_unbound_method(name);
+		if (method.is_err()) { return Err(method.unwrap_err()); }
+		auto [method_obj, unbound] = method.unwrap();
+		vm.reg(m_destination) = method_obj;
+		vm.reg(*m_self_destination) = unbound ? this_obj : nullptr;
+		return Ok(Value{ method_obj });
+	}
+
+	return this_obj->get_method(name).and_then([&vm, this](PyObject *method_obj) {
+		vm.reg(m_destination) = method_obj;
+		return Ok(method_obj);
+	});
 }
 
 std::vector<uint8_t> LoadMethod::serialize() const
@@ -34,5 +41,7 @@ std::vector<uint8_t> LoadMethod::serialize() const
 		m_destination,
 		m_value_source,
 		m_method_name,
+		m_self_destination.has_value(),
+		m_self_destination.value_or(0),
 	};
 }
@@ -2,10 +2,17 @@
 
 #include "Instructions.hpp"
 
+#include <optional>
+
 
 class LoadMethod final : public Instruction
 {
 	Register m_destination;
+	// When set, a method that is defined on the type of the object is not bound: the plain
+	// function is stored in m_destination and the object in m_self_destination, to be passed as
+	// the first argument by MethodCall. For any other attribute the callable is stored in
+	// m_destination and m_self_destination is set to nullptr.
+	std::optional<Register> m_self_destination;
 	Register m_value_source;
 	Register m_method_name;
 
@@ -15,8 +22,23 @@ class LoadMethod final : public Instruction
 		  m_method_name(std::move(method_name))
 	{}
 
+	LoadMethod(Register destination,
+		Register self_destination,
+		Register value_source,
+		Register method_name)
+		: m_destination(destination), m_self_destination(self_destination),
+		  m_value_source(value_source), m_method_name(method_name)
+	{}
+
 	std::string to_string() const final
 	{
+		if (m_self_destination.has_value()) {
+			return fmt::format("LOAD_METHOD     r{:<3} r{:<3} r{:<3} ({})",
+				m_destination,
+				*m_self_destination,
+				m_value_source,
+				m_method_name);
+		}
 		return fmt::format(
 			"LOAD_METHOD     r{:<3} r{:<3} ({})", m_destination, m_value_source, m_method_name);
 	}
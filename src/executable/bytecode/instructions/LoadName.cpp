@@ -2,13 +2,15 @@
 #include "executable/bytecode/serialization/serialize.hpp"
 #include "interpreter/Interpreter.hpp"
 #include "runtime/NameError.hpp"
+#include "runtime/PyFrame.hpp"
 #include "vm/VM.hpp"
 
 using namespace py;
 
 PyResult<Value> LoadName::execute(VirtualMachine &vm, Interpreter &interpreter) const
 {
-	if (auto result = interpreter.get_object(m_object_name); result.is_ok()) {
+	auto *name = interpreter.execution_frame()->interned_name(m_object_name);
+	if (auto result = interpreter.get_object(name); result.is_ok()) {
 		vm.reg(m_destination) = result.unwrap();
 		return Ok(Value{ result.unwrap() });
 	} else {
@@ -18,12 +20,9 @@ PyResult<Value> LoadName::execute(VirtualMachine &vm, Interpreter &interpreter)
 
 std::vector<uint8_t> LoadName::serialize() const
 {
-	std::vector<uint8_t> result = {
+	return {
 		LOAD_NAME,
 		m_destination,
+		m_object_name,
 	};
-
-	py::serialize(m_object_name, result);
-
-	return result;
 }
@@ -6,11 +6,11 @@
 class LoadName final : public Instruction
 {
 	Register m_destination;
-	std::string m_object_name;
+	Register m_object_name;
 
   public:
-	LoadName(Register destination, std::string object_name)
-		: m_destination(destination), m_object_name(std::move(object_name))
+	LoadName(Register destination, Register object_name)
+		: m_destination(destination), m_object_name(object_name)
 	{}
 	~LoadName() override {}
 	std::string to_string() const final
@@ -1,37 +1,39 @@
 #include "MethodCall.hpp"
-#include "FunctionCall.hpp"
-
-#include "runtime/AttributeError.hpp"
-#include "runtime/PyDict.hpp"
-#include "runtime/PyMethodDescriptor.hpp"
-#include "runtime/PySlotWrapper.hpp"
-#include "runtime/PyString.hpp"
-#include "runtime/PyTuple.hpp"
-#include "runtime/PyType.hpp"
+
+#include "interpreter/Interpreter.hpp"
+#include "runtime/PyFrame.hpp"
 #include "vm/VM.hpp"
 
 #include "../serialization/serialize.hpp"
 
 using namespace py;
 
-PyResult<Value> MethodCall::execute(VirtualMachine &vm, Interpreter &) const
+PyResult<Value> MethodCall::execute(VirtualMachine &vm, Interpreter &interpreter) const
 {
 	const auto &method = vm.reg(m_caller);
 	auto *method_obj = std::get<PyObject *>(method);
 	ASSERT(method_obj)
 
-	std::vector<Value> args;
-	for (const auto &arg_register : m_args) { args.push_back(vm.reg(arg_register)); }
+	ASSERT(m_kwargs.size() == m_keywords.size())
+
+	auto *self = std::get<PyObject *>(vm.reg(m_self));
+	const size_t self_offset = self ? 1 : 0;
 
-	auto args_tuple = PyTuple::create(args);
-	if (args_tuple.is_err()) { return Err(args_tuple.unwrap_err()); }
+	ArgumentBuffer args{ self_offset + m_args.size() + m_kwargs.size() };
+	if (self) { args[0] = self; }
+	size_t idx = self_offset;
+	for (const auto &arg_register : m_args) { args[idx++] = vm.reg(arg_register); }
 
-	// FIXME: process kwargs
-	PyDict *kwargs = nullptr;
+	std::vector<std::string_view> kwnames;
+	kwnames.reserve(m_keywords.size());
+	for (size_t i = 0; i < m_kwargs.size(); ++i) {
+		kwnames.push_back(interpreter.execution_frame()->names(m_keywords[i]));
+		args[idx++] = vm.reg(m_kwargs[i]);
+	}
 
 	spdlog::debug("calling method: \'{}\'", method_obj->to_string());
 
-	auto result = method_obj->call(args_tuple.unwrap(), kwargs);
+	auto result = method_obj->vectorcall(args.values(), kwnames);
 	if (result.is_err()) return Err(result.unwrap_err());
 	vm.reg(0) = result.unwrap();
 	return Ok(Value{ result.unwrap() });
@@ -42,7 +44,10 @@ std::vector<uint8_t> MethodCall::serialize() const
 	std::vector<uint8_t> result{
 		METHOD_CALL,
 		m_caller,
+		m_self,
 	};
 	py::serialize(m_args, result);
+	py::serialize(m_kwargs, result);
+	py::serialize(m_keywords, result);
 	return result;
-}
\ No newline at end of file
+}
@@ -2,21 +2,34 @@
 
 #include "Instructions.hpp"
 
+// Calls the callable loaded by a LoadMethod with a self destination. If that register holds an
+// object, it is prepended to the positional arguments
 class MethodCall final : public Instruction
 {
 	const Register m_caller;
+	const Register m_self;
 	const std::vector<Register> m_args;
+	const std::vector<Register> m_kwargs;
+	const std::vector<Register> m_keywords;
 
   public:
-	MethodCall(Register caller, std::vector<Register> &&args)
-		: m_caller(caller), m_args(std::move(args))
+	MethodCall(Register caller,
+		Register self,
+		std::vector<Register> &&args,
+		std::vector<Register> &&kwargs = {},
+		std::vector<Register> &&keywords = {})
+		: m_caller(caller), m_self(self), m_args(std::move(args)), m_kwargs(std::move(kwargs)),
+		  m_keywords(std::move(keywords))
 	{}
 
 	std::string to_string() const final
 	{
 		std::string args_regs{};
 		for (const auto arg : m_args) { args_regs += fmt::format(" r{:<3}", arg); }
-		return fmt::format("CALL_METHOD     r{:<3} {}", m_caller, args_regs);
+		for (size_t i = 0; i < m_kwargs.size(); ++i) {
+			args_regs += fmt::format(" ({})=r{:<3}", m_keywords[i], m_kwargs[i]);
+		}
+		return fmt::format("CALL_METHOD     r{:<3} r{:<3} {}", m_caller, m_self, args_regs);
 	}
 
 	py::PyResult<py::Value> execute(VirtualMachine &vm, Interpreter &interpreter) const final;
@@ -3,7 +3,6 @@
 #include "runtime/BaseException.hpp"
 #include "runtime/PyFrame.hpp"
 #include "runtime/PyFunction.hpp"
-#include "runtime/PyTraceback.hpp"
 #include "runtime/PyTuple.hpp"
 #include "runtime/PyType.hpp"
 #include "runtime/RuntimeError.hpp"
@@ -39,7 +38,7 @@ PyResult<Value> RaiseVarargs::execute(VirtualMachine &vm, Interpreter &) const
 			return Err(runtime_error("No active exception to reraise"));
 		}
 		auto *exc = vm.interpreter().execution_frame()->pop_exception();
-		exc->set_traceback(exc->traceback()->m_tb_next);
+		exc->pop_traceback_entry();
 		return Err(exc);
 	}
 }
@@ -10,7 +10,7 @@ using namespace py;
 PyResult<Value> StoreAttr::execute(VirtualMachine &vm, Interpreter &intepreter) const
 {
 	auto this_value = vm.reg(m_dst);
-	const auto &attr_name_ = intepreter.execution_frame()->names(m_attr_name);
+	auto *attr_name = intepreter.execution_frame()->interned_name(m_attr_name);
 	spdlog::debug("This object: {}",
 		std::visit(
 			[](const auto &val) {
@@ -22,9 +22,7 @@ PyResult<Value> StoreAttr::execute(VirtualMachine &vm, Interpreter &intepreter)
 	if (auto *this_obj = std::get_if<PyObject *>(&this_value)) {
 		auto other_obj = PyObject::from(vm.reg(m_src));
 		if (other_obj.is_err()) return Err(other_obj.unwrap_err());
-		auto attr_name = PyString::create(attr_name_);
-		if (attr_name.is_err()) { return Err(attr_name.unwrap_err()); }
-		if (auto result = (*this_obj)->setattribute(attr_name.unwrap(), other_obj.unwrap());
+		if (auto result = (*this_obj)->setattribute(attr_name, other_obj.unwrap());
 			result.is_ok()) {
 			return Ok(py_none());
 		} else {
@@ -1,4 +1,5 @@
 #include "StoreSubscript.hpp"
+#include "runtime/PyList.hpp"
 #include "runtime/PyNone.hpp"
 #include "vm/VM.hpp"
 
@@ -7,6 +8,20 @@ using namespace py;
 PyResult<Value> StoreSubscript::execute(VirtualMachine &vm, Interpreter &) const
 {
 	auto object_value = vm.reg(m_obj);
+	// list[int] = value stores ints and floats unboxed in lists with the int or float strategy
+	if (auto *obj = std::get_if<PyObject *>(&object_value); obj && *obj) {
+		if (auto *list = as<PyList>(*obj)) {
+			if (auto index = ListStorage::unbox_int(vm.reg(m_slice))) {
+				const auto size = static_cast<int64_t>(list->storage().size());
+				if (*index < 0) { *index += size; }
+				if (*index >= 0 && *index < size) {
+					list->storage().set(*index, vm.reg(m_src));
+					return Ok(py_none());
+				}
+			}
+		}
+	}
+
 	auto object = PyObject::from(object_value);
 	if (object.is_err()) return object;
 
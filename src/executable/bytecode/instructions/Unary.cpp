@@ -44,7 +44,19 @@ PyResult<Value> unary_negative(const Value &val)
 	return std::visit(
 		overloaded{ [](const Number &val) -> PyResult<Value> {
 					   return Ok(std::visit(
-						   [](const auto &v) { return Value{ Number{ -v } }; }, val.value));
+						   overloaded{
+							   [](const int64_t &v) {
+								   int64_t result;
+								   if (__builtin_sub_overflow(int64_t{ 0 }, v, &result))
+									   [[unlikely]] {
+									   return Value{ Number{
+										   -BigIntType{ static_cast<long>(v) } } };
+								   }
+								   return Value{ Number{ result } };
+							   },
+							   [](const auto &v) { return Value{ Number{ -v } }; },
+						   },
+						   val.value));
 				   },
 			[](const String &) -> PyResult<Value> {
 				return Err(type_error("bad operand type for unary -: 'str'"));
@@ -40,19 +40,18 @@ PyResult<Value> UnpackExpand::execute(VirtualMachine &vm, Interpreter &) const
 					});
 				}
 			} else if (auto *pylist = as<PyList>(*obj)) {
-				if (pylist->elements().size() < m_destination.size()) {
+				const auto &elements = pylist->storage();
+				if (elements.size() < m_destination.size()) {
 					return Err(value_error("not enough values to unpack (expected {}, got {})",
 						m_destination.size(),
-						pylist->elements().size()));
+						elements.size()));
 				} else {
 					size_t i = 0;
 					for (; i < m_destination.size(); ++i) {
-						vm.reg(m_destination[i]) = pylist->elements()[i];
+						vm.reg(m_destination[i]) = elements[i];
 					}
 					std::vector<Value> rest;
-					for (; i < pylist->elements().size(); ++i) {
-						rest.push_back(pylist->elements()[i]);
-					}
+					for (; i < elements.size(); ++i) { rest.push_back(elements[i]); }
 					return PyList::create(std::move(rest)).and_then([this, &vm](auto *rest) {
 						vm.reg(m_rest) = rest;
 						return Ok(Value{ py_none() });
@@ -36,16 +36,18 @@ PyResult<Value> UnpackSequence::execute(VirtualMachine &vm, Interpreter &) const
 					return Ok(Value{ py_none() });
 				}
 			} else if (auto *pylist = as<PyList>(*obj)) {
-				if (pylist->elements().size() > m_destination.size()) {
+				const auto &elements = pylist->storage();
+				if (elements.size() > m_destination.size()) {
 					return Err(value_error(
 						"too many values to unpack (expected {})", m_destination.size()));
-				} else if (pylist->elements().size() < m_destination.size()) {
+				} else if (elements.size() < m_destination.size()) {
 					return Err(value_error("not enough values to unpack (expected {}, got {})",
 						m_destination.size(),
-						pylist->elements().size()));
+						elements.size()));
 				} else {
-					size_t idx{ 0 };
-					for (const auto &el : pylist->elements()) { vm.reg(m_destination[idx++]) = el; }
+					for (size_t idx = 0; idx < elements.size(); ++idx) {
+						vm.reg(m_destination[idx]) = elements[idx];
+					}
 					return Ok(Value{ py_none() });
 				}
 			} else {
@@ -24,9 +24,10 @@ PyResult<Value> WithExceptStart::execute(VirtualMachine &vm, Interpreter &interp
 
 	auto args_tuple = [&]() {
 		if (auto exc = interpreter.execution_frame()->exception_info()) {
+			auto *traceback = exc->exception->traceback();
 			return PyTuple::create(static_cast<PyObject *>(exc->exception_type),
 				static_cast<PyObject *>(exc->exception),
-				exc->traceback ? static_cast<PyObject *>(exc->traceback) : py_none());
+				traceback ? static_cast<PyObject *>(traceback) : py_none());
 		} else {
 			return PyTuple::create(py_none(), py_none(), py_none());
 		}
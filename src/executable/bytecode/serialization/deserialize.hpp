@@ -114,6 +114,14 @@ inline auto deserialize(std::span<const uint8_t> &buffer)
 		case ValueType::TUPLE: {
 			return Tuple{ .elements = deserialize<std::vector<Value>>(buffer) };
 		}
+		case ValueType::BIG_INT: {
+			const bool is_negative = deserialize<bool>(buffer);
+			const auto limbs = deserialize<std::vector<uint64_t>>(buffer);
+			BigIntType result;
+			mpz_import(result.get_mpz_t(), limbs.size(), -1, sizeof(uint64_t), 0, 0, limbs.data());
+			if (is_negative) { result = -result; }
+			return Number{ result };
+		}
 		}
 	} else {
 		[]<bool flag = false>() { static_assert(flag, "unsupported deserialization type"); }();
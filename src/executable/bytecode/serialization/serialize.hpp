@@ -33,6 +33,7 @@ enum class ValueType {
 	BOOL = 6,
 	OBJECT = 7,
 	TUPLE = 8,
+	BIG_INT = 9,
 };
 
 template<typename T> inline void serialize(const T &value, std::vector<uint8_t> &result)
@@ -67,56 +68,71 @@ inline void serialize(const VectorType &value, std::vector<uint8_t> &result)
 	for (const auto &el : value) { serialize(el, result); }
 }
 
-template<> inline void serialize<PyTuple *>(PyTuple *const &value, std::vector<uint8_t> &result)
+template<> inline void serialize<Value>(const Value &value, std::vector<uint8_t> &result)
 {
-	serialize(value->size(), result);
-	for (const auto &el : value->elements()) {
-		std::visit(
-			overloaded{
-				[&](const Number &val) {
-					std::visit(overloaded{
-								   [&](const BigIntType &v) {
-									   ASSERT(v.fits_ulong_p());
-									   const auto int_value = v.get_ui();
-									   serialize(static_cast<uint8_t>(ValueType::INT64), result);
-									   serialize(int_value, result);
-								   },
-								   [&](const double &v) {
-									   serialize(static_cast<uint8_t>(ValueType::F64), result);
-									   serialize(v, result);
-								   },
+	std::visit(
+		overloaded{
+			[&](const Number &val) {
+				std::visit(overloaded{
+							   [&](const int64_t &v) {
+								   serialize(static_cast<uint8_t>(ValueType::INT64), result);
+								   serialize(v, result);
+							   },
+							   [&](const BigIntType &v) {
+								   // the sign, then the magnitude as little endian 64 bit limbs
+								   serialize(static_cast<uint8_t>(ValueType::BIG_INT), result);
+								   serialize(v < 0, result);
+								   std::vector<uint64_t> limbs(
+									   (mpz_sizeinbase(v.get_mpz_t(), 2) + 63) / 64);
+								   size_t count = 0;
+								   mpz_export(limbs.data(),
+									   &count,
+									   -1,
+									   sizeof(uint64_t),
+									   0,
+									   0,
+									   v.get_mpz_t());
+								   limbs.resize(count);
+								   serialize(limbs, result);
+							   },
+							   [&](const double &v) {
+								   serialize(static_cast<uint8_t>(ValueType::F64), result);
+								   serialize(v, result);
 							   },
-						val.value);
-				},
-				[&](const String &val) {
-					serialize(static_cast<uint8_t>(ValueType::STRING), result);
-					serialize(val.s, result);
-				},
-				[&](const Bytes &bytes) {
-					serialize(static_cast<uint8_t>(ValueType::BYTES), result);
-					serialize(bytes.b, result);
-				},
-				[&](const Ellipsis &) {
-					serialize(static_cast<uint8_t>(ValueType::ELLIPSIS), result);
-				},
-				[&](const NameConstant &val) {
-					std::visit(overloaded{ [&](const bool &v) {
-											  serialize(
-												  static_cast<uint8_t>(ValueType::BOOL), result);
-											  serialize(v, result);
-										  },
-								   [&](const NoneType &) {
-									   serialize(static_cast<uint8_t>(ValueType::NONE), result);
-								   } },
-						val.value);
-				},
-				[&](const Tuple &tuple) {
-					serialize(static_cast<uint8_t>(ValueType::TUPLE), result);
-					serialize(tuple.elements, result);
-				},
-				[&](PyObject *const &) { TODO(); },
+						   },
+					val.value);
+			},
+			[&](const String &val) {
+				serialize(static_cast<uint8_t>(ValueType::STRING), result);
+				serialize(val.s, result);
+			},
+			[&](const Bytes &bytes) {
+				serialize(static_cast<uint8_t>(ValueType::BYTES), result);
+				serialize(bytes.b, result);
+			},
+			[&](const Ellipsis &) { serialize(static_cast<uint8_t>(ValueType::ELLIPSIS), result); },
+			[&](const NameConstant &val) {
+				std::visit(overloaded{ [&](const bool &v) {
+										  serialize(static_cast<uint8_t>(ValueType::BOOL), result);
+										  serialize(v, result);
+									  },
+							   [&](const NoneType &) {
+								   serialize(static_cast<uint8_t>(ValueType::NONE), result);
+							   } },
+					val.value);
 			},
-			el);
-	}// namespace py
+			[&](const Tuple &tuple) {
+				serialize(static_cast<uint8_t>(ValueType::TUPLE), result);
+				serialize(tuple.elements, result);
+			},
+			[&](PyObject *const &) { TODO(); },
+		},
+		value);
+}
+
+template<> inline void serialize<PyTuple *>(PyTuple *const &value, std::vector<uint8_t> &result)
+{
+	serialize(value->size(), result);
+	for (const auto &el : value->elements()) { serialize(el, result); }
 }
 }// namespace py
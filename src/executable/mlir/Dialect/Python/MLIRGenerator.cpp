@@ -1410,6 +1410,12 @@ ast::Value *MLIRGenerator::visit(const ast::Constant *node)
 												  value);
 										  return new_value(op);
 									  },
+									  [this, node](int64_t int_value) {
+										  return new_value(load_const(m_context.builder(),
+											  py::BigIntType{ static_cast<long>(int_value) },
+											  m_context.filename(),
+											  node->source_location()));
+									  },
 									  [this, node](const py::BigIntType &int_value) {
 										  return new_value(load_const(m_context.builder(),
 											  int_value,
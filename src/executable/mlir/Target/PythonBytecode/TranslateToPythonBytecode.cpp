@@ -37,7 +37,6 @@
 #include "executable/bytecode/instructions/JumpIfFalse.hpp"
 #include "executable/bytecode/instructions/JumpIfNotExceptionMatch.hpp"
 #include "executable/bytecode/instructions/JumpIfTrue.hpp"
-#include "executable/bytecode/instructions/LeaveExceptionHandling.hpp"
 #include "executable/bytecode/instructions/ListAppend.hpp"
 #include "executable/bytecode/instructions/ListExtend.hpp"
 #include "executable/bytecode/instructions/ListToTuple.hpp"
@@ -50,6 +49,7 @@
 #include "executable/bytecode/instructions/LoadFast.hpp"
 #include "executable/bytecode/instructions/LoadGlobal.hpp"
 #include "executable/bytecode/instructions/LoadMethod.hpp"
+#include "executable/bytecode/instructions/MethodCall.hpp"
 #include "executable/bytecode/instructions/LoadName.hpp"
 #include "executable/bytecode/instructions/MakeFunction.hpp"
 #include "executable/bytecode/instructions/Move.hpp"
@@ -60,8 +60,6 @@
 #include "executable/bytecode/instructions/ReturnValue.hpp"
 #include "executable/bytecode/instructions/SetAdd.hpp"
 #include "executable/bytecode/instructions/SetUpdate.hpp"
-#include "executable/bytecode/instructions/SetupExceptionHandling.hpp"
-#include "executable/bytecode/instructions/SetupWith.hpp"
 #include "executable/bytecode/instructions/StoreAttr.hpp"
 #include "executable/bytecode/instructions/StoreDeref.hpp"
 #include "executable/bytecode/instructions/StoreFast.hpp"
@@ -100,12 +98,17 @@
 #include <optional>
 #include <ranges>
 #include <set>
+#include <unordered_map>
 
 using namespace mlir;
 
 namespace codegen {
 
 namespace {
+	// registers that LinearScanRegisterAllocation hands out, the registers above them hold the
+	// receivers of unbound method calls
+	constexpr size_t kAllocatableRegisterCount = 32;
+
 	bool is_function_call(mlir::Value value)
 	{
 		return mlir::isa<mlir::emitpybytecode::FunctionCallOp>(value.getDefiningOp())
@@ -119,6 +122,59 @@ namespace {
 		auto result = mlir::getTopologicallySortedBlocks(region);
 		return std::vector<mlir::Block *>{ result.begin(), result.end() };
 	}
+
+	// Computes the stack of active exception handlers on entry of every block of a function.
+	// SETUP_EXC_HANDLE and SETUP_WITH push their handler for the body successor only, and
+	// LEAVE_EXCEPTION_HANDLE pops it again. A block reached with different stacks (e.g. a loop exit
+	// reached from a `break` inside a `try`) only keeps the handlers that are common to all paths.
+	std::unordered_map<mlir::Block *, std::vector<mlir::Block *>> exceptionHandlerStacks(
+		mlir::Region &region)
+	{
+		std::unordered_map<mlir::Block *, std::vector<mlir::Block *>> entry_stacks;
+		if (region.empty()) { return entry_stacks; }
+
+		std::vector<mlir::Block *> worklist{ &region.front() };
+		entry_stacks[&region.front()] = {};
+
+		auto propagate = [&entry_stacks, &worklist](
+							 mlir::Block *successor, const std::vector<mlir::Block *> &stack) {
+			auto [it, inserted] = entry_stacks.try_emplace(successor, stack);
+			if (!inserted) {
+				auto &current = it->second;
+				auto [current_it, _] =
+					std::mismatch(current.begin(), current.end(), stack.begin(), stack.end());
+				if (current_it == current.end()) { return; }
+				current.erase(current_it, current.end());
+			}
+			worklist.push_back(successor);
+		};
+
+		while (!worklist.empty()) {
+			auto *block = worklist.back();
+			worklist.pop_back();
+			auto stack = entry_stacks.at(block);
+			for (auto &op : block->getOperations()) {
+				if (mlir::isa<mlir::emitpybytecode::LeaveExceptionHandle>(op)) {
+					ASSERT(!stack.empty());
+					stack.pop_back();
+				}
+			}
+			auto *terminator = block->getTerminator();
+			if (auto setup = mlir::dyn_cast<mlir::emitpybytecode::SetupExceptionHandle>(terminator)) {
+				propagate(setup.getHandler(), stack);
+				stack.push_back(setup.getHandler());
+				propagate(setup.getBody(), stack);
+			} else if (auto setup = mlir::dyn_cast<mlir::emitpybytecode::SetupWith>(terminator)) {
+				propagate(setup.getHandler(), stack);
+				stack.push_back(setup.getHandler());
+				propagate(setup.getBody(), stack);
+			} else {
+				for (auto *successor : terminator->getSuccessors()) { propagate(successor, stack); }
+			}
+		}
+
+		return entry_stacks;
+	}
 }// namespace
 
 using ForwardedOutput = std::pair<mlir::Operation *, size_t>;
@@ -528,7 +584,7 @@ struct LinearScanRegisterAllocation
 		std::multiset<LiveIntervalAnalysis::LiveInterval, decltype(increasing_endpoint_cmp)>
 			handled;
 
-		std::bitset<32> free;
+		std::bitset<kAllocatableRegisterCount> free;
 		free.set();
 
 		for (const auto &interval : unhandled) {
@@ -778,6 +834,19 @@ struct PythonBytecodeEmitter
 		size_t m_kwonly_arg_count{ 0 };
 		size_t m_stack_size{ 0 };
 		CodeFlags m_flags = CodeFlags::create();
+		// receiver registers of the LoadMethod operations whose method is loaded unbound, until
+		// the call that consumes them is emitted
+		std::unordered_map<mlir::Operation *, Register> m_method_receivers;
+		size_t m_max_method_receivers{ 0 };
+
+		struct ExceptionRange
+		{
+			size_t start;
+			size_t end;
+			mlir::Block *handler;
+			std::shared_ptr<Label> handler_label;
+		};
+		std::vector<ExceptionRange> m_exception_ranges;
 
 		void set_varargs() { m_flags.set(CodeFlags::Flag::VARARGS); }
 
@@ -873,6 +942,8 @@ struct PythonBytecodeEmitter
 
 	std::vector<BlockLabel> m_block_labels;
 	std::vector<BlockOffset> m_block_offsets;
+	// handlers of the `try`/`with` blocks enclosing the operation being emitted, innermost last
+	std::vector<mlir::Block *> m_exception_handlers;
 
 	PythonBytecodeEmitter() = default;
 
@@ -884,6 +955,43 @@ struct PythonBytecodeEmitter
 
 	size_t add_name(std::string_view str) { return current_function().add_name(str); }
 
+	// A method that is only used as the callee of a call in the same block is loaded unbound, with
+	// its receiver in a register of its own, so that the call doesn't allocate a bound method.
+	// Calls in a block are nested, so the receivers of pending calls form a stack.
+	std::optional<Register> method_receiver(mlir::emitpybytecode::LoadMethod &op)
+	{
+		auto method = op.getMethod();
+		if (!method.hasOneUse()) { return std::nullopt; }
+		auto *user = *method.getUsers().begin();
+		if (user->getBlock() != op->getBlock()) { return std::nullopt; }
+		const bool is_callee = llvm::TypeSwitch<mlir::Operation *, bool>(user)
+								   .Case<mlir::emitpybytecode::FunctionCallOp,
+									   mlir::emitpybytecode::FunctionCallWithKeywordsOp>(
+									   [&method](auto call) { return call.getCallee() == method; })
+								   .Default([](auto) { return false; });
+		if (!is_callee) { return std::nullopt; }
+
+		auto &function = current_function();
+		const auto receiver = kAllocatableRegisterCount + function.m_method_receivers.size();
+		ASSERT(receiver <= std::numeric_limits<Register>::max());
+		function.m_method_receivers.emplace(op.getOperation(), static_cast<Register>(receiver));
+		function.m_max_method_receivers =
+			std::max(function.m_max_method_receivers, function.m_method_receivers.size());
+		return static_cast<Register>(receiver);
+	}
+
+	// The receiver register of the unbound method that `callee` holds, if any
+	std::optional<Register> take_method_receiver(mlir::Value callee)
+	{
+		auto &receivers = current_function().m_method_receivers;
+		if (auto it = receivers.find(callee.getDefiningOp()); it != receivers.end()) {
+			const auto receiver = it->second;
+			receivers.erase(it);
+			return receiver;
+		}
+		return std::nullopt;
+	}
+
 	size_t get_cell_index(std::string_view str) { return current_function().get_cell_index(str); }
 
 	size_t add_const(::py::Value value) { return current_function().add_const(std::move(value)); }
@@ -1124,6 +1232,29 @@ struct PythonBytecodeEmitter
 	template<typename OpType> LogicalResult emitOperation(OpType &op);
 
 	void push(Register value);
+
+	void add_exception_range(FunctionInfo &function, size_t start, size_t end, mlir::Block *handler)
+	{
+		if (start == end) { return; }
+		auto &ranges = function.m_exception_ranges;
+		if (!ranges.empty() && ranges.back().end == start && ranges.back().handler == handler) {
+			ranges.back().end = end;
+			return;
+		}
+		auto label = m_block_labels.emplace_back(handler, std::make_shared<Label>("", 0)).m_label;
+		ranges.push_back(FunctionInfo::ExceptionRange{ start, end, handler, std::move(label) });
+	}
+
+	ExceptionTable exception_table(const FunctionInfo &function) const
+	{
+		ExceptionTable table;
+		table.reserve(function.m_exception_ranges.size());
+		for (const auto &range : function.m_exception_ranges) {
+			table.push_back(ExceptionTableEntry{
+				range.start, range.end, static_cast<size_t>(range.handler_label->position()) });
+		}
+		return table;
+	}
 };
 
 template<> LogicalResult PythonBytecodeEmitter::emitOperation(Operation &op)
@@ -1352,24 +1483,31 @@ template<> LogicalResult PythonBytecodeEmitter::emitOperation(mlir::emitpybyteco
 	return success();
 }
 
+// Entering and leaving a `try`/`with` body is free at runtime: the handlers are described by the
+// function's exception table, so only a jump to the body is emitted when it does not follow
+// directly.
 template<>
 LogicalResult PythonBytecodeEmitter::emitOperation(mlir::emitpybytecode::SetupExceptionHandle &op)
 {
-	auto &handler_label =
-		m_block_labels.emplace_back(op.getHandler(), std::make_shared<Label>("", 0));
-	emit<SetupExceptionHandling>(handler_label.m_label);
-	auto &body_label = m_block_labels.emplace_back(op.getBody(), std::make_shared<Label>("", 0));
-	emit<Jump>(body_label.m_label);
+	auto this_block = std::find(
+		m_sorted_blocks.top().begin(), m_sorted_blocks.top().end(), op.getOperation()->getBlock());
+	if (std::next(this_block) == m_sorted_blocks.top().end()
+		|| *std::next(this_block) != op.getBody()) {
+		auto &body_label = m_block_labels.emplace_back(op.getBody(), std::make_shared<Label>("", 0));
+		emit<Jump>(body_label.m_label);
+	}
 	return success();
 }
 
 template<> LogicalResult PythonBytecodeEmitter::emitOperation(mlir::emitpybytecode::SetupWith &op)
 {
-	auto &handler_label =
-		m_block_labels.emplace_back(op.getHandler(), std::make_shared<Label>("", 0));
-	emit<SetupWith>(handler_label.m_label);
-	auto &body_label = m_block_labels.emplace_back(op.getBody(), std::make_shared<Label>("", 0));
-	emit<Jump>(body_label.m_label);
+	auto this_block = std::find(
+		m_sorted_blocks.top().begin(), m_sorted_blocks.top().end(), op.getOperation()->getBlock());
+	if (std::next(this_block) == m_sorted_blocks.top().end()
+		|| *std::next(this_block) != op.getBody()) {
+		auto &body_label = m_block_labels.emplace_back(op.getBody(), std::make_shared<Label>("", 0));
+		emit<Jump>(body_label.m_label);
+	}
 	return success();
 }
 
@@ -1383,7 +1521,8 @@ LogicalResult PythonBytecodeEmitter::emitOperation(mlir::emitpybytecode::WithExc
 template<>
 LogicalResult PythonBytecodeEmitter::emitOperation(mlir::emitpybytecode::LeaveExceptionHandle &)
 {
-	emit<LeaveExceptionHandling>();
+	ASSERT(!m_exception_handlers.empty());
+	m_exception_handlers.pop_back();
 	return success();
 }
 
@@ -1418,6 +1557,7 @@ template<> LogicalResult PythonBytecodeEmitter::emitOperation(mlir::func::FuncOp
 	enter_function_op(op);
 
 	m_sorted_blocks.push(sortBlocks(region));
+	auto exception_handler_stacks = exceptionHandlerStacks(region);
 	// llvm::outs() << "-----------------------------------------------\n";
 	// for (auto *block : m_sorted_blocks.top()) {
 	// 	block->print(llvm::outs());
@@ -1427,8 +1567,19 @@ template<> LogicalResult PythonBytecodeEmitter::emitOperation(mlir::func::FuncOp
 		m_block_offsets.emplace_back(block, op_idx);
 		if (!sortTopologically(block)) { std::abort(); }
 		const auto start = function_info.instructions.size();
+		if (auto it = exception_handler_stacks.find(block); it != exception_handler_stacks.end()) {
+			m_exception_handlers = it->second;
+		} else {
+			m_exception_handlers.clear();
+		}
 		for (auto &op : block->getOperations()) {
+			const auto op_start = function_info.instructions.size();
+			auto *handler = m_exception_handlers.empty() ? nullptr : m_exception_handlers.back();
 			if (failed(emitOperation(op))) { return failure(); }
+			if (handler) {
+				add_exception_range(
+					function_info, op_start, function_info.instructions.size(), handler);
+			}
 		}
 		op_idx += function_info.instructions.size() - start;
 	}
@@ -1588,8 +1739,15 @@ LogicalResult PythonBytecodeEmitter::emitOperation(mlir::emitpybytecode::LoadAtt
 
 template<> LogicalResult PythonBytecodeEmitter::emitOperation(mlir::emitpybytecode::LoadMethod &op)
 {
-	emit<LoadMethod>(
-		get_register(op.getMethod()), get_register(op.getSelf()), add_name(op.getMethodName()));
+	if (auto receiver = method_receiver(op)) {
+		emit<LoadMethod>(get_register(op.getMethod()),
+			*receiver,
+			get_register(op.getSelf()),
+			add_name(op.getMethodName()));
+	} else {
+		emit<LoadMethod>(
+			get_register(op.getMethod()), get_register(op.getSelf()), add_name(op.getMethodName()));
+	}
 	return success();
 }
 
@@ -1736,6 +1894,14 @@ LogicalResult PythonBytecodeEmitter::emitOperation(mlir::emitpybytecode::StoreDe
 template<>
 LogicalResult PythonBytecodeEmitter::emitOperation(mlir::emitpybytecode::FunctionCallOp &op)
 {
+	if (auto receiver = take_method_receiver(op.getCallee())) {
+		std::vector<Register> arg_registers;
+		arg_registers.reserve(op.getArgs().size());
+		for (const auto &arg : op.getArgs()) { arg_registers.push_back(get_register(arg)); }
+		emit<MethodCall>(get_register(op.getCallee()), *receiver, std::move(arg_registers));
+		return success();
+	}
+
 	const auto arg_size = op.getArgs().size();
 	for (const auto &arg : op.getArgs()) { push(get_register(arg)); }
 	emit<FunctionCall>(get_register(op.getCallee()), arg_size, 0);
@@ -1762,6 +1928,15 @@ LogicalResult PythonBytecodeEmitter::emitOperation(
 		keywords_registers.push_back(add_name(keyword));
 	}
 
+	if (auto receiver = take_method_receiver(op.getCallee())) {
+		emit<MethodCall>(get_register(op.getCallee()),
+			*receiver,
+			std::move(arg_registers),
+			std::move(kwarg_registers),
+			std::move(keywords_registers));
+		return success();
+	}
+
 	emit<FunctionCallWithKeywords>(get_register(op.getCallee()),
 		std::move(arg_registers),
 		std::move(kwarg_registers),
@@ -1868,7 +2043,7 @@ template<> LogicalResult PythonBytecodeEmitter::emitOperation(mlir::emitpybyteco
 
 template<> LogicalResult PythonBytecodeEmitter::emitOperation(mlir::emitpybytecode::LoadNameOp &op)
 {
-	emit<LoadName>(get_register(op.getOutput()), op.getName().str());
+	emit<LoadName>(get_register(op.getOutput()), add_name(op.getName()));
 	return success();
 }
 
@@ -2024,12 +2199,14 @@ std::shared_ptr<Program> translateToPythonBytecode(Operation *op)
 			.metadata =
 				FunctionMetaData{
 					.function_name = "__main__",
-					.register_count = 32,
+					.register_count =
+						kAllocatableRegisterCount + emitter.m_module.m_max_method_receivers,
 					.stack_size = emitter.m_module.m_stack_size,
 					.names = std::move(emitter.m_module.m_names),
 					.consts = std::move(emitter.m_module.m_consts),
 				},
 			.blocks = std::move(instructions),
+			.exception_table = emitter.exception_table(emitter.m_module),
 		};
 		func_blocks.functions.push_back(std::move(fb_module));
 	}
@@ -2039,7 +2216,7 @@ std::shared_ptr<Program> translateToPythonBytecode(Operation *op)
 			.metadata =
 				FunctionMetaData{
 					.function_name = name,
-					.register_count = 32,
+					.register_count = kAllocatableRegisterCount + fn.m_max_method_receivers,
 					.stack_size = stack_size,
 					.cellvars = std::move(fn.m_cellvars),
 					.varnames = std::move(fn.m_varnames),
@@ -2052,6 +2229,7 @@ std::shared_ptr<Program> translateToPythonBytecode(Operation *op)
 					.flags = std::move(fn.m_flags),
 				},
 			.blocks = std::move(fn.instructions),
+			.exception_table = emitter.exception_table(fn),
 		};
 		func_blocks.functions.push_back(std::move(fb));
 	}
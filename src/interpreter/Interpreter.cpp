@@ -247,30 +247,56 @@ PyModule *Interpreter::get_imported_module(PyString *name) const
 	return nullptr;
 }
 
+ScopedStack::ScopedStack(size_t register_count, size_t locals_count, size_t stack_size)
+	: top_frame(register_count,
+		locals_count,
+		stack_size,
+		VirtualMachine::the().stack().empty() ? InstructionVector::const_iterator{}
+											  : VirtualMachine::the().instruction_pointer(),
+		&VirtualMachine::the())
+{
+	VirtualMachine::the().push_frame(top_frame);
+}
+
+ScopedStack::ScopedStack(std::unique_ptr<StackFrame> resumable_frame_)
+	: resumable_frame(std::move(resumable_frame_))
+{
+	auto &vm = VirtualMachine::the();
+	resumable_frame->return_address =
+		vm.stack().empty() ? InstructionVector::const_iterator{} : vm.instruction_pointer();
+	resumable_frame->restore();
+}
+
 ScopedStack::~ScopedStack()
 {
 	auto &vm = VirtualMachine::the();
-	if (!vm.stack().empty() && top_frame && &vm.stack().top().get() == top_frame.get()) {
-		vm.pop_frame(true);
-	}
+	const auto *frame = resumable_frame ? resumable_frame.get() : &top_frame;
+	if (!vm.stack().empty() && &vm.stack().top().get() == frame) { vm.pop_frame(true); }
 }
 
 std::unique_ptr<StackFrame> ScopedStack::release()
 {
-	ASSERT(top_frame);
 	auto &vm = VirtualMachine::the();
+	ASSERT(resumable_frame);
+	ASSERT(&vm.stack().top().get() == resumable_frame.get());
 	vm.pop_frame(true);
-	return StackFrame::create(top_frame->clone());
+	return std::move(resumable_frame);
 }
 
 ScopedStack Interpreter::setup_call_stack(const std::unique_ptr<Function> &func,
 	PyFrame *function_frame)
 {
-	auto &vm = VirtualMachine::the();
-	auto frame = vm.setup_call_stack(function_frame->m_register_count,
+	return ScopedStack{ function_frame->m_register_count,
 		func->locals_count(),
-		func->stack_size() + function_frame->freevars().size());
-	return ScopedStack{ std::move(frame) };
+		func->stack_size() + function_frame->freevars().size() };
+}
+
+ScopedStack Interpreter::setup_resumable_call_stack(const std::unique_ptr<Function> &func,
+	PyFrame *function_frame)
+{
+	return ScopedStack{ StackFrame::create_resumable(function_frame->m_register_count,
+		func->stack_size() + function_frame->freevars().size(),
+		&VirtualMachine::the()) };
 }
 
 PyResult<PyObject *> Interpreter::call(const std::unique_ptr<Function> &func,
@@ -345,7 +371,7 @@ PyResult<std::monostate> Interpreter::store_object(const std::string &name, cons
 	return m_current_frame->put_local(name, value);
 }
 
-PyResult<Value> Interpreter::get_object(const std::string &name)
+PyResult<Value> Interpreter::get_object(PyString *name)
 {
 	ASSERT(execution_frame()->locals())
 	ASSERT(execution_frame()->globals())
@@ -355,21 +381,14 @@ PyResult<Value> Interpreter::get_object(const std::string &name)
 	auto *globals = execution_frame()->globals();
 	const auto &builtins = execution_frame()->builtins()->symbol_table()->map();
 
+	// `name` is interned by the code object, like the str keys of every namespace
 	return [&]() -> PyResult<Value> {
-		const auto &name_value = String{ name };
-		PyString *pystr_name = nullptr;
-
 		if (auto *locals_ = as<PyDict>(locals)) {
-			if (const auto &it = locals_->map().find(name_value); it != locals_->map().end()) {
-				return Ok(std::move(it->second));
+			if (const auto &it = locals_->map().find(name); it != locals_->map().end()) {
+				return Ok(it->second);
 			}
 		} else {
-			if (!pystr_name) {
-				auto name_ = PyString::create(name);
-				if (name_.is_err()) { return name_; }
-				pystr_name = name_.unwrap();
-			}
-			if (auto r = locals->as_mapping().unwrap().getitem(pystr_name); r.is_ok()) {
+			if (auto r = locals->as_mapping().unwrap().getitem(name); r.is_ok()) {
 				return r;
 			} else if (r.unwrap_err()->type() != KeyError::class_type()) {
 				return r;
@@ -377,34 +396,40 @@ PyResult<Value> Interpreter::get_object(const std::string &name)
 		}
 
 		if (auto *globals_ = as<PyDict>(globals)) {
-			if (const auto &it = globals_->map().find(name_value); it != globals_->map().end()) {
-				return Ok(std::move(it->second));
+			if (const auto &it = globals_->map().find(name); it != globals_->map().end()) {
+				return Ok(it->second);
 			}
 		} else {
-			if (!pystr_name) {
-				auto name_ = PyString::create(name);
-				if (name_.is_err()) { return name_; }
-				pystr_name = name_.unwrap();
-			}
-			if (auto r = globals->as_mapping().unwrap().getitem(pystr_name); r.is_ok()) {
+			if (auto r = globals->as_mapping().unwrap().getitem(name); r.is_ok()) {
 				return r;
 			} else if (r.unwrap_err()->type() != KeyError::class_type()) {
 				return r;
 			}
 		}
 
-		if (!pystr_name) {
-			auto name_ = PyString::create(name);
-			if (name_.is_err()) { return name_; }
-			pystr_name = name_.unwrap();
-		}
-		if (const auto &it = builtins.find(pystr_name); it != builtins.end()) {
-			return Ok(std::move(it->second));
+		if (const auto &it = builtins.find(name); it != builtins.end()) {
+			return Ok(it->second);
 		}
-		return Err(name_error("name '{:s}' is not defined", name));
+		return Err(name_error("name '{:s}' is not defined", name->value()));
 	}();
 }
 
+PyFrame *Interpreter::take_pooled_frame()
+{
+	if (m_frame_pool.empty()) { return nullptr; }
+	auto *frame = m_frame_pool.back();
+	m_frame_pool.pop_back();
+	return frame;
+}
+
+void Interpreter::release_frame(PyFrame *frame)
+{
+	static constexpr size_t kFramePoolSize = 64;
+	if (frame->escaped() || m_frame_pool.size() >= kFramePoolSize) { return; }
+	frame->recycle();
+	m_frame_pool.push_back(frame);
+}
+
 void Interpreter::visit_graph(::Cell::Visitor &visitor)
 {
 	if (m_current_frame) {
@@ -421,4 +446,5 @@ void Interpreter::visit_graph(::Cell::Visitor &visitor)
 	if (m_builtins) visitor.visit(*m_builtins);
 	if (m_importlib) visitor.visit(*m_importlib);
 	if (m_import_func) visitor.visit(*m_import_func);
+	for (auto *frame : m_frame_pool) { visitor.visit(*frame); }
 }
@@ -9,11 +9,21 @@
 
 class BytecodeProgram;
 
+// Owns the stack frame of a call, which lives on the C++ stack for the duration of the call, and
+// pops it from the VM when going out of scope
 struct ScopedStack
+	: NonCopyable
+	, NonMoveable
 {
-	std::unique_ptr<StackFrame> top_frame;
+	StackFrame top_frame;
+	// set instead of `top_frame` when the frame has to outlive this scope (generators and coroutines)
+	std::unique_ptr<StackFrame> resumable_frame;
+
+	ScopedStack(size_t register_count, size_t locals_count, size_t stack_size);
+	explicit ScopedStack(std::unique_ptr<StackFrame> resumable_frame);
 	~ScopedStack();
 
+	// detaches the resumable frame from the VM stack, so that it can be resumed later
 	std::unique_ptr<StackFrame> release();
 };
 
@@ -31,6 +41,8 @@ class Interpreter
 	py::PyObject *m_import_func{ nullptr };
 	std::string m_entry_script;
 	std::vector<std::string> m_argv;
+	// frames of returned function calls that did not escape, handed out again by PyFrame::create
+	std::vector<py::PyFrame *> m_frame_pool;
 
   public:
 	struct Config
@@ -51,7 +63,7 @@ class Interpreter
 	[[nodiscard]] py::PyResult<std::monostate> store_object(const std::string &name,
 		const py::Value &value);
 
-	py::PyResult<py::Value> get_object(const std::string &name);
+	py::PyResult<py::Value> get_object(py::PyString *name);
 
 	template<typename PyObjectType, typename... Args>
 	py::PyObject *allocate_object(const std::string &name, Args &&...args)
@@ -84,6 +96,8 @@ class Interpreter
 	const std::vector<std::string> &argv() const { return m_argv; }
 
 	ScopedStack setup_call_stack(const std::unique_ptr<Function> &, py::PyFrame *function_frame);
+	ScopedStack setup_resumable_call_stack(const std::unique_ptr<Function> &,
+		py::PyFrame *function_frame);
 	py::PyResult<py::PyObject *> call(const std::unique_ptr<Function> &,
 		py::PyFrame *function_frame);
 
@@ -98,6 +112,9 @@ class Interpreter
 		py::PyTuple *args,
 		py::PyDict *kwargs);
 
+	py::PyFrame *take_pooled_frame();
+	void release_frame(py::PyFrame *);
+
 	void visit_graph(::Cell::Visitor &);
 
   private:
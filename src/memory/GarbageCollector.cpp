@@ -2,11 +2,13 @@
 #include "interpreter/Interpreter.hpp"
 #include "interpreter/InterpreterSession.hpp"
 #include "memory/Heap.hpp"
+#include "runtime/MethodCache.hpp"
 #include "runtime/PyCode.hpp"
 #include "runtime/PyDict.hpp"
 #include "runtime/PyFrame.hpp"
 #include "runtime/PyModule.hpp"
 #include "runtime/PyObject.hpp"
+#include "runtime/PyString.hpp"
 #include "runtime/PyType.hpp"
 #include "vm/VM.hpp"
 
@@ -105,10 +107,10 @@ std::stack<Cell *> MarkSweepGC::collect_roots(const Heap &heap) const
 	auto roots = collect_roots_on_the_stack(heap, m_stack_bottom);
 
 	spdlog::trace("adding objects in VM stack to roots");
-	for (const auto &s : VirtualMachine::the().stack_objects()) {
-		for (const auto &val : s) {
-			if (std::holds_alternative<PyObject *>(*val)) {
-				auto *obj = std::get<PyObject *>(*val);
+	VirtualMachine::the().visit_stack_frames([&heap, &roots](std::span<const Value> values) {
+		for (const auto &val : values) {
+			if (std::holds_alternative<PyObject *>(val)) {
+				auto *obj = std::get<PyObject *>(val);
 				if (obj) {
 					if (!is_static_memory(bit_cast<uint8_t *>(obj), heap)) {
 						auto *obj_header = bit_cast<GarbageCollected *>(
@@ -118,29 +120,31 @@ std::stack<Cell *> MarkSweepGC::collect_roots(const Heap &heap) const
 				}
 			}
 		}
-	}
+	});
 
-	if (VirtualMachine::the().has_interpreter()) {
-		auto &interpreter = VirtualMachine::the().interpreter();
-		struct AddRoot : Cell::Visitor
+	struct AddRoot : Cell::Visitor
+	{
+		const Heap &heap_;
+		std::stack<Cell *> &roots_;
+		AddRoot(const Heap &heap, std::stack<Cell *> &roots_) : heap_(heap), roots_(roots_) {}
+		void visit(Cell &cell)
 		{
-			const Heap &heap_;
-			std::stack<Cell *> &roots_;
-			AddRoot(const Heap &heap, std::stack<Cell *> &roots_) : heap_(heap), roots_(roots_) {}
-			void visit(Cell &cell)
-			{
-				auto *obj = static_cast<PyObject *>(&cell);
-				if (obj) {
-					if (!is_static_memory(bit_cast<uint8_t *>(obj), heap_)) {
-						auto *obj_header = bit_cast<GarbageCollected *>(
-							bit_cast<uint8_t *>(obj) - sizeof(GarbageCollected));
-						add_root(obj_header, roots_);
-					}
+			auto *obj = static_cast<PyObject *>(&cell);
+			if (obj) {
+				if (!is_static_memory(bit_cast<uint8_t *>(obj), heap_)) {
+					auto *obj_header = bit_cast<GarbageCollected *>(
+						bit_cast<uint8_t *>(obj) - sizeof(GarbageCollected));
+					add_root(obj_header, roots_);
 				}
 			}
-		} visitor{ heap, roots };
+		}
+	} visitor{ heap, roots };
+
+	if (VirtualMachine::the().has_interpreter()) {
+		auto &interpreter = VirtualMachine::the().interpreter();
 		interpreter.visit_graph(visitor);
 	}
+
 	return roots;
 }
 
@@ -262,6 +266,16 @@ void MarkSweepGC::sweep(Heap &heap) const
 {
 	spdlog::trace("MarkSweepGC::sweep start");
 
+	// the intern table and the method cache hold weak references to strings, so the entries of
+	// strings that are about to be deallocated are dropped before their memory is reused. Only the
+	// strings allocated by this heap are considered, since the tables are shared by every heap
+	const auto is_unreachable = [&heap](const PyString &str) {
+		auto *memory = bit_cast<uint8_t *>(&str) - sizeof(GarbageCollected);
+		return heap.slab().has_address(memory) && bit_cast<GarbageCollected *>(memory)->white();
+	};
+	PyString::erase_interned_if(is_unreachable);
+	MethodCache::the().erase_if(is_unreachable);
+
 	// TODO: once the ideal block sizes are fixed there should be an iterator
 	//       returning a list of all blocks
 	std::array blocks = {
@@ -1,5 +1,6 @@
 #include "GarbageCollector.hpp"
 #include "Heap_test.hpp"
+#include "runtime/PyString.hpp"
 
 namespace {
 
@@ -77,4 +78,21 @@ TEST_F(TestHeap, GarbageCollectorDeallocatesGCPointersWhenStackFrameIsPopped)
 	m_heap->collect_garbage();
 
 	ASSERT_EQ(g_counter, 5);
-}
\ No newline at end of file
+}
+
+TEST_F(TestHeap, GarbageCollectorErasesUnreachableInternedStrings)
+{
+	auto *str = m_heap->allocate<py::PyString>(std::string{ "unreachable_interned_string" });
+	ASSERT_EQ(py::PyString::intern(str).unwrap(), str);
+
+	// nothing is marked, so the string is swept as if it were unreachable
+	auto &gc = static_cast<MarkSweepGC &>(m_heap->garbage_collector());
+	gc.mark_all_cell_unreachable(*m_heap);
+	gc.sweep(*m_heap);
+
+	// the entry is gone, so interning the value again allocates a new string in the VM heap
+	auto interned = py::PyString::intern("unreachable_interned_string");
+	ASSERT_TRUE(interned.is_ok());
+	EXPECT_NE(static_cast<void *>(interned.unwrap()), static_cast<void *>(str));
+	EXPECT_TRUE(interned.unwrap()->is_interned());
+}
@@ -1,5 +1,7 @@
 #include "Heap.hpp"
 #include "GarbageCollector.hpp"
+#include "runtime/MethodCache.hpp"
+#include "runtime/PyString.hpp"
 #include "runtime/PyType.hpp"
 
 using namespace py;
@@ -163,6 +165,18 @@ Heap::Heap()
 	m_gc = std::make_unique<MarkSweepGC>();
 }
 
+void Heap::reset()
+{
+	collect_garbage();
+	// the intern table is global, so it must not keep the strings of this heap once they are freed
+	PyString::erase_interned_if([this](const PyString &str) {
+		return m_slab.has_address(bit_cast<uint8_t *>(&str) - sizeof(GarbageCollected));
+	});
+	// and neither must the method cache, which is keyed by the address of interned strings
+	MethodCache::the().clear();
+	m_slab.reset();
+}
+
 void Heap::collect_garbage()
 {
 	if (m_gc) m_gc->run(*this);
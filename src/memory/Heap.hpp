@@ -311,7 +311,7 @@ class Heap
 	friend struct TestHeap;
 
 	std::unique_ptr<uint8_t[]> m_static_memory;
-	size_t m_static_memory_size{ 1 * MB };
+	size_t m_static_memory_size{ StaticMemorySize };
 	size_t m_static_offset{ 8 };
 	Slab m_slab;
 	std::unique_ptr<GarbageCollector> m_gc;
@@ -348,11 +348,7 @@ class Heap
 	static std::unique_ptr<Heap> create() { return std::unique_ptr<Heap>(new Heap); }
 
   public:
-	void reset()
-	{
-		collect_garbage();
-		m_slab.reset();
-	}
+	void reset();
 
 	void set_start_stack_pointer(uintptr_t *address) { m_bottom_stack_pointer = address; }
 
@@ -409,6 +405,9 @@ class Heap
 		return std::shared_ptr<T>(ptr, [](T *) { return; });
 	}
 
+	// the size of the region of immortal objects allocated with allocate_static
+	static constexpr size_t StaticMemorySize = 1 * MB;
+
 	const uint8_t *static_memory() const { return m_static_memory.get(); }
 	size_t static_memory_size() const { return m_static_memory_size; }
 
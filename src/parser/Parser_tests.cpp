@@ -22,8 +22,12 @@ void compare_constant(const std::shared_ptr<ASTNode> &result,
 	ASSERT_EQ(result_value->index(), expected_value->index());
 	std::visit(
 		overloaded{ [&](const Number &number_value) {
-					   if (auto *int_result = std::get_if<BigIntType>(&number_value.value)) {
+					   if (auto *int_result = std::get_if<int64_t>(&number_value.value)) {
 						   ASSERT_EQ(*int_result,
+							   std::get<int64_t>(std::get<Number>(*expected_value).value));
+					   } else if (auto *big_int_result =
+									  std::get_if<BigIntType>(&number_value.value)) {
+						   ASSERT_EQ(*big_int_result,
 							   std::get<BigIntType>(std::get<Number>(*expected_value).value));
 					   } else if (auto *double_result = std::get_if<double>(&number_value.value)) {
 						   ASSERT_EQ(*double_result,
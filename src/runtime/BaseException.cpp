@@ -81,6 +81,30 @@ void BaseException::visit_graph(Visitor &visitor)
 	PyObject::visit_graph(visitor);
 	if (m_args) visitor.visit(*m_args);
 	if (m_traceback) visitor.visit(*m_traceback);
+	for (const auto &entry : m_pending_traceback) {
+		if (entry.frame) visitor.visit(*entry.frame);
+	}
+}
+
+PyTraceback *BaseException::traceback()
+{
+	for (size_t i = 0; i < m_pending_traceback.size(); ++i) {
+		const auto &entry = m_pending_traceback[i];
+		auto tb = PyTraceback::create(entry.frame, entry.lasti, entry.lineno, m_traceback);
+		ASSERT(tb.is_ok())
+		m_traceback = tb.unwrap();
+	}
+	m_pending_traceback.clear();
+	return m_traceback;
+}
+
+void BaseException::pop_traceback_entry()
+{
+	if (!m_pending_traceback.empty()) {
+		m_pending_traceback.pop_back();
+	} else if (m_traceback) {
+		m_traceback = m_traceback->m_tb_next;
+	}
 }
 
 std::string BaseException::to_string() const
@@ -98,11 +122,11 @@ std::string BaseException::to_string() const
 	}
 }
 
-std::string BaseException::format_traceback() const
+std::string BaseException::format_traceback()
 {
 	std::ostringstream out;
 	out << "Traceback (most recent call last):\n";
-	auto *tb = m_traceback;
+	auto *tb = traceback();
 	while (tb) {
 		out << fmt::format("  File \"{}\", line {}, in {}\n",
 			"TODO",
@@ -131,7 +155,12 @@ namespace {
 
 	std::unique_ptr<TypePrototype> register_base_exception()
 	{
-		return std::move(klass<BaseException>("BaseException").type);
+		return std::move(klass<BaseException>("BaseException")
+							 .property_readonly("__traceback__",
+								 [](BaseException *self) -> PyResult<PyObject *> {
+									 return Ok(self->traceback());
+								 })
+							 .type);
 	}
 }// namespace
 
@@ -12,9 +12,21 @@ class BaseException : public PyBaseObject
 	friend BaseException *as<>(PyObject *obj);
 	friend const BaseException *as<>(const PyObject *obj);
 
+	// A frame the exception unwound through, recorded while the exception propagates. These are
+	// only turned into PyTraceback objects when the traceback is requested, so exceptions that are
+	// caught and discarded never allocate a traceback.
+	struct TracebackEntry
+	{
+		PyFrame *frame;
+		size_t lasti;
+		size_t lineno;
+	};
+
   protected:
 	PyTuple *m_args{ nullptr };
 	PyTraceback *m_traceback{ nullptr };
+	// innermost frame first
+	std::vector<TracebackEntry> m_pending_traceback;
 
 	BaseException(PyType *type);
 
@@ -37,10 +49,22 @@ class BaseException : public PyBaseObject
 
 	PyTuple *args() const { return m_args; }
 
-	PyTraceback *traceback() const { return m_traceback; }
-	void set_traceback(PyTraceback *tb) { m_traceback = tb; }
-
-	std::string format_traceback() const;
+	PyTraceback *traceback();
+	void set_traceback(PyTraceback *tb)
+	{
+		m_traceback = tb;
+		m_pending_traceback.clear();
+	}
+
+	void add_traceback_entry(PyFrame *frame, size_t lasti, size_t lineno)
+	{
+		m_pending_traceback.push_back(TracebackEntry{ frame, lasti, lineno });
+	}
+	// drops the outermost traceback entry, i.e. the one added by the last frame that saw the
+	// exception
+	void pop_traceback_entry();
+
+	std::string format_traceback();
 
 	static std::function<std::unique_ptr<TypePrototype>()> type_factory();
 
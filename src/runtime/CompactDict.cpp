@@ -0,0 +1,303 @@
+#include "CompactDict.hpp"
+#include "PyString.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+using namespace py;
+
+CompactDict::const_iterator::const_iterator(const CompactDict *dict, size_t index)
+	: m_dict(dict), m_index(index)
+{
+	while (m_index < m_dict->m_entries.size() && is_tombstone(m_dict->m_entries[m_index])) {
+		m_index++;
+	}
+}
+
+CompactDict::const_iterator &CompactDict::const_iterator::operator++()
+{
+	do {
+		m_index++;
+	} while (m_index < m_dict->m_entries.size() && is_tombstone(m_dict->m_entries[m_index]));
+	return *this;
+}
+
+size_t CompactDict::hash(const Value &key)
+{
+	if (auto *obj = std::get_if<PyObject *>(&key)) {
+		// skips the __hash__ slot dispatch, the hash of a str is cached
+		if (auto *str = as<PyString>(*obj)) { return str->__hash__().unwrap(); }
+	}
+	return ValueHash{}(key);
+}
+
+bool CompactDict::is_tombstone(const value_type &entry)
+{
+	auto *obj = std::get_if<PyObject *>(&entry.first);
+	return obj && !*obj;
+}
+
+int64_t CompactDict::index_at(size_t slot) const
+{
+	const auto *ptr = m_index.data() + slot * m_index_width;
+	switch (m_index_width) {
+	case 1: {
+		const auto value = *ptr;
+		if (value == 0xFF) { return kEmpty; }
+		if (value == 0xFE) { return kDummy; }
+		return value;
+	}
+	case 2: {
+		uint16_t value;
+		std::memcpy(&value, ptr, sizeof(value));
+		if (value == 0xFFFF) { return kEmpty; }
+		if (value == 0xFFFE) { return kDummy; }
+		return value;
+	}
+	case 4: {
+		uint32_t value;
+		std::memcpy(&value, ptr, sizeof(value));
+		if (value == 0xFFFFFFFF) { return kEmpty; }
+		if (value == 0xFFFFFFFE) { return kDummy; }
+		return value;
+	}
+	default: {
+		int64_t value;
+		std::memcpy(&value, ptr, sizeof(value));
+		return value;
+	}
+	}
+}
+
+void CompactDict::set_index(size_t slot, int64_t entry)
+{
+	// kEmpty and kDummy truncate to the all ones patterns that index_at decodes
+	auto *ptr = m_index.data() + slot * m_index_width;
+	switch (m_index_width) {
+	case 1: {
+		*ptr = static_cast<uint8_t>(entry);
+	} break;
+	case 2: {
+		const auto value = static_cast<uint16_t>(entry);
+		std::memcpy(ptr, &value, sizeof(value));
+	} break;
+	case 4: {
+		const auto value = static_cast<uint32_t>(entry);
+		std::memcpy(ptr, &value, sizeof(value));
+	} break;
+	default: {
+		std::memcpy(ptr, &entry, sizeof(entry));
+	} break;
+	}
+}
+
+CompactDict::LookupResult CompactDict::lookup(const Value &key, size_t hash) const
+{
+	if (m_capacity == 0) { return { 0, kEmpty }; }
+	if (m_str_keys_only) {
+		if (auto *str = std::get_if<String>(&key)) { return lookup_str(str->s, nullptr, hash); }
+		if (auto *obj = std::get_if<PyObject *>(&key)) {
+			if (auto *str = as<PyString>(*obj)) { return lookup_str(str->value(), str, hash); }
+		}
+	}
+	const size_t mask = m_capacity - 1;
+	size_t slot = hash & mask;
+	for (size_t perturb = hash;; perturb >>= 5) {
+		const auto entry = index_at(slot);
+		if (entry == kEmpty) { return { slot, kEmpty }; }
+		if (entry >= 0 && m_hashes[entry] == hash && m_entries[entry].first == key) {
+			return { slot, entry };
+		}
+		slot = (slot * 5 + perturb + 1) & mask;
+	}
+}
+
+CompactDict::LookupResult
+	CompactDict::lookup_str(std::string_view key, const PyString *key_str, size_t hash) const
+{
+	const size_t mask = m_capacity - 1;
+	size_t slot = hash & mask;
+	for (size_t perturb = hash;; perturb >>= 5) {
+		const auto entry = index_at(slot);
+		if (entry == kEmpty) { return { slot, kEmpty }; }
+		if (entry >= 0) {
+			// every key is an exact str in this mode
+			const auto *entry_str =
+				static_cast<const PyString *>(std::get<PyObject *>(m_entries[entry].first));
+			if (entry_str == key_str) { return { slot, entry }; }
+			if (m_hashes[entry] == hash
+				&& !(key_str && key_str->is_interned() && entry_str->is_interned())
+				&& entry_str->value() == key) {
+				return { slot, entry };
+			}
+		}
+		slot = (slot * 5 + perturb + 1) & mask;
+	}
+}
+
+size_t CompactDict::find_empty_slot(size_t hash) const
+{
+	const size_t mask = m_capacity - 1;
+	size_t slot = hash & mask;
+	for (size_t perturb = hash; index_at(slot) != kEmpty; perturb >>= 5) {
+		slot = (slot * 5 + perturb + 1) & mask;
+	}
+	return slot;
+}
+
+void CompactDict::rebuild(size_t capacity)
+{
+	ASSERT(std::has_single_bit(capacity))
+	ASSERT(capacity * 2 / 3 >= m_size)
+
+	if (m_size != m_entries.size()) {
+		size_t live = 0;
+		for (size_t i = 0; i < m_entries.size(); ++i) {
+			if (is_tombstone(m_entries[i])) { continue; }
+			if (live != i) {
+				m_entries[live] = std::move(m_entries[i]);
+				m_hashes[live] = m_hashes[i];
+			}
+			live++;
+		}
+		m_entries.erase(m_entries.begin() + live, m_entries.end());
+		m_hashes.resize(live);
+	}
+
+	m_capacity = capacity;
+	if (capacity <= 0x80) {
+		m_index_width = 1;
+	} else if (capacity <= 0x8000) {
+		m_index_width = 2;
+	} else if (capacity <= 0x80000000) {
+		m_index_width = 4;
+	} else {
+		m_index_width = 8;
+	}
+	m_index.assign(m_capacity * m_index_width, 0xFF);
+	for (size_t i = 0; i < m_entries.size(); ++i) {
+		set_index(find_empty_slot(m_hashes[i]), static_cast<int64_t>(i));
+	}
+	m_fill = m_size;
+	m_version++;
+}
+
+std::pair<CompactDict::iterator, bool>
+	CompactDict::insert_new(const Value &key, const Value &value, size_t hash)
+{
+	if (m_fill + 1 > usable()) {
+		rebuild(std::max(kMinCapacity, std::bit_ceil((m_size + 1) * 3)));
+	}
+	const auto entry = m_entries.size();
+	if (auto *str = std::get_if<String>(&key)) {
+		auto interned = PyString::intern(str->s);
+		ASSERT(interned.is_ok())
+		m_entries.emplace_back(static_cast<PyObject *>(interned.unwrap()), value);
+	} else {
+		if (m_str_keys_only) {
+			auto *obj = std::get_if<PyObject *>(&key);
+			m_str_keys_only = obj && as<PyString>(*obj);
+		}
+		m_entries.emplace_back(key, value);
+	}
+	set_index(find_empty_slot(hash), static_cast<int64_t>(entry));
+	m_hashes.push_back(hash);
+	m_size++;
+	m_fill++;
+	m_version++;
+	return { const_iterator{ this, entry }, true };
+}
+
+CompactDict::const_iterator CompactDict::find(const Value &key) const
+{
+	const auto result = lookup(key, hash(key));
+	if (result.entry == kEmpty) { return end(); }
+	return const_iterator{ this, static_cast<size_t>(result.entry) };
+}
+
+const Value &CompactDict::at(const Value &key) const
+{
+	const auto result = lookup(key, hash(key));
+	ASSERT(result.entry != kEmpty)
+	return m_entries[result.entry].second;
+}
+
+std::pair<CompactDict::iterator, bool> CompactDict::insert_or_assign(const Value &key,
+	const Value &value)
+{
+	const auto h = hash(key);
+	if (const auto result = lookup(key, h); result.entry != kEmpty) {
+		m_entries[result.entry].second = value;
+		return { const_iterator{ this, static_cast<size_t>(result.entry) }, false };
+	}
+	return insert_new(key, value, h);
+}
+
+std::pair<CompactDict::iterator, bool> CompactDict::insert(const value_type &entry)
+{
+	const auto h = hash(entry.first);
+	if (const auto result = lookup(entry.first, h); result.entry != kEmpty) {
+		return { const_iterator{ this, static_cast<size_t>(result.entry) }, false };
+	}
+	return insert_new(entry.first, entry.second, h);
+}
+
+CompactDict::iterator CompactDict::erase(const_iterator it)
+{
+	ASSERT(it.m_dict == this)
+	ASSERT(it.m_index < m_entries.size())
+
+	const auto position = it.m_index;
+	const auto result = lookup(m_entries[position].first, m_hashes[position]);
+	ASSERT(result.entry == static_cast<int64_t>(position))
+
+	set_index(result.slot, kDummy);
+	m_entries[position] = { Value{ static_cast<PyObject *>(nullptr) },
+		Value{ static_cast<PyObject *>(nullptr) } };
+	m_size--;
+	m_version++;
+
+	if (m_size == 0) {
+		clear();
+		return end();
+	}
+	return const_iterator{ this, position + 1 };
+}
+
+size_t CompactDict::erase(const Value &key)
+{
+	auto it = find(key);
+	if (it == end()) { return 0; }
+	erase(it);
+	return 1;
+}
+
+void CompactDict::clear()
+{
+	m_entries.clear();
+	m_hashes.clear();
+	std::fill(m_index.begin(), m_index.end(), 0xFF);
+	m_size = 0;
+	m_fill = 0;
+	m_str_keys_only = true;
+	m_version++;
+}
+
+void CompactDict::reserve(size_t size)
+{
+	if (size <= usable()) { return; }
+	rebuild(std::max(kMinCapacity, std::bit_ceil(size * 3 / 2 + 1)));
+	m_entries.reserve(size);
+	m_hashes.reserve(size);
+}
+
+bool CompactDict::operator==(const CompactDict &other) const
+{
+	if (m_size != other.m_size) { return false; }
+	for (const auto &[key, value] : *this) {
+		const auto it = other.find(key);
+		if (it == other.end() || !(it->second == value)) { return false; }
+	}
+	return true;
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "PyObject.hpp"
+#include "runtime/Value.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace py {
+
+// Insertion ordered hash map from Value to Value, laid out like the CPython 3.6 dict:
+//  * a dense array of entries in insertion order, each with the cached hash of its key, and
+//  * a sparse open addressing table of indices into the entries, stored with the narrowest of
+//    1, 2, 4 or 8 bytes per slot that can address every entry.
+// Keys are hashed once, on insertion or lookup, and probes compare the cached hashes before
+// calling the (possibly slot dispatched) equality. Removed entries are left as tombstones and
+// compacted away when the index table is rebuilt.
+// String keys are stored as the interned PyString with the same value, so a str key only has one
+// representation. While every key is an exact str the dict is in "str keys only" mode, where
+// lookups with a str compare by identity, then by the cached hash, then by value, without
+// dispatching to __eq__.
+class CompactDict
+{
+  public:
+	using key_type = Value;
+	using mapped_type = Value;
+	using value_type = std::pair<Value, Value>;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+
+	class const_iterator
+	{
+		friend CompactDict;
+
+		const CompactDict *m_dict{ nullptr };
+		size_t m_index{ 0 };
+
+		const_iterator(const CompactDict *dict, size_t index);
+
+	  public:
+		using difference_type = CompactDict::difference_type;
+		using value_type = CompactDict::value_type;
+		using pointer = const value_type *;
+		using reference = const value_type &;
+		using iterator_category = std::forward_iterator_tag;
+
+		const_iterator() = default;
+
+		reference operator*() const { return m_dict->m_entries[m_index]; }
+		pointer operator->() const { return &m_dict->m_entries[m_index]; }
+
+		const_iterator &operator++();
+		const_iterator operator++(int)
+		{
+			auto tmp = *this;
+			++(*this);
+			return tmp;
+		}
+
+		// an iterator that was left past the last entry by a removal compares equal to end()
+		bool operator==(const const_iterator &other) const
+		{
+			if (m_dict != other.m_dict) { return false; }
+			if (!m_dict) { return true; }
+			const auto size = m_dict->m_entries.size();
+			return std::min(m_index, size) == std::min(other.m_index, size);
+		}
+	};
+	using iterator = const_iterator;
+
+  private:
+	std::vector<value_type> m_entries;
+	std::vector<size_t> m_hashes;
+	// the index table, m_capacity slots of m_index_width bytes each
+	std::vector<uint8_t> m_index;
+	size_t m_capacity{ 0 };
+	uint8_t m_index_width{ 1 };
+	// live entries
+	size_t m_size{ 0 };
+	// index slots that are not empty, i.e. live entries and tombstones
+	size_t m_fill{ 0 };
+	// true while every key that was inserted is an exact str
+	bool m_str_keys_only{ true };
+	// bumped whenever a key is added or removed, or the entries are moved, so that iterators can
+	// tell that the dict was mutated under them
+	uint64_t m_version{ 0 };
+
+  public:
+	CompactDict() = default;
+
+	const_iterator begin() const { return const_iterator{ this, 0 }; }
+	const_iterator end() const { return const_iterator{ this, m_entries.size() }; }
+
+	size_t size() const { return m_size; }
+	bool empty() const { return m_size == 0; }
+	uint64_t version() const { return m_version; }
+
+	const_iterator find(const Value &key) const;
+	bool contains(const Value &key) const { return lookup(key, hash(key)).entry != kEmpty; }
+	size_t count(const Value &key) const { return contains(key) ? 1 : 0; }
+	const Value &at(const Value &key) const;
+
+	std::pair<iterator, bool> insert_or_assign(const Value &key, const Value &value);
+	std::pair<iterator, bool> insert(const value_type &entry);
+	std::pair<iterator, bool> emplace(const Value &key, const Value &value)
+	{
+		return insert({ key, value });
+	}
+
+	iterator erase(const_iterator it);
+	size_t erase(const Value &key);
+
+	void clear();
+	void reserve(size_t size);
+
+	// dicts compare equal when they have the same keys mapped to equal values, in any order
+	bool operator==(const CompactDict &other) const;
+
+  private:
+	static constexpr int64_t kEmpty = -1;
+	static constexpr int64_t kDummy = -2;
+	static constexpr size_t kMinCapacity = 8;
+
+	struct LookupResult
+	{
+		// position in the index table of the key, or of the empty slot that ends its probe chain
+		size_t slot;
+		// position in the entries of the key, or kEmpty
+		int64_t entry;
+	};
+
+	static size_t hash(const Value &key);
+	static bool is_tombstone(const value_type &entry);
+
+	LookupResult lookup(const Value &key, size_t hash) const;
+	LookupResult lookup_str(std::string_view key, const PyString *key_str, size_t hash) const;
+	int64_t index_at(size_t slot) const;
+	void set_index(size_t slot, int64_t entry);
+	size_t find_empty_slot(size_t hash) const;
+	std::pair<iterator, bool> insert_new(const Value &key, const Value &value, size_t hash);
+	void rebuild(size_t capacity);
+	size_t usable() const { return m_capacity * 2 / 3; }
+};
+
+}// namespace py
@@ -0,0 +1,294 @@
+#include "FlatHashSet.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <tuple>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace py;
+
+namespace {
+// The hash of an integer is the integer itself and the hash of many objects is derived from their
+// address, so the bits are mixed before they are split into the probe start and the 7 bit tag
+size_t mix(size_t hash)
+{
+	const auto product = static_cast<__uint128_t>(hash) * 0x9E3779B97F4A7C15ull;
+	return static_cast<size_t>(product) ^ static_cast<size_t>(product >> 64);
+}
+
+size_t h1(size_t mixed) { return mixed >> 7; }
+int8_t h2(size_t mixed) { return static_cast<int8_t>(mixed & 0x7F); }
+
+// the control bytes of 16 consecutive slots, each match returns a bitmask with bit i set if
+// the control byte of slot i matches
+struct Group
+{
+#if defined(__SSE2__)
+	__m128i control;
+
+	explicit Group(const int8_t *ptr)
+		: control(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)))
+	{}
+
+	uint32_t match(int8_t tag) const
+	{
+		return static_cast<uint32_t>(
+			_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), control)));
+	}
+
+	// empty and deleted are the only control values with the sign bit set
+	uint32_t match_empty_or_deleted() const
+	{
+		return static_cast<uint32_t>(_mm_movemask_epi8(control));
+	}
+#else
+	const int8_t *control;
+
+	explicit Group(const int8_t *ptr) : control(ptr) {}
+
+	uint32_t match(int8_t tag) const
+	{
+		uint32_t result = 0;
+		for (size_t i = 0; i < 16; ++i) {
+			if (control[i] == tag) { result |= 1u << i; }
+		}
+		return result;
+	}
+
+	uint32_t match_empty_or_deleted() const
+	{
+		uint32_t result = 0;
+		for (size_t i = 0; i < 16; ++i) {
+			if (control[i] < 0) { result |= 1u << i; }
+		}
+		return result;
+	}
+#endif
+};
+}// namespace
+
+FlatHashSet::const_iterator::const_iterator(const FlatHashSet *set, size_t slot)
+	: m_set(set), m_slot(slot)
+{
+	while (m_slot < m_set->m_capacity && m_set->m_control[m_slot] < 0) { m_slot++; }
+}
+
+FlatHashSet::const_iterator &FlatHashSet::const_iterator::operator++()
+{
+	do {
+		m_slot++;
+	} while (m_slot < m_set->m_capacity && m_set->m_control[m_slot] < 0);
+	return *this;
+}
+
+size_t FlatHashSet::hash(const Value &key) { return mix(ValueHash{}(key)); }
+
+size_t FlatHashSet::capacity_for(size_t size)
+{
+	// at most 7/8 of the slots are used
+	return std::max(kMinCapacity, std::bit_ceil(size + size / 7 + 1));
+}
+
+size_t FlatHashSet::find_slot(const Value &key, size_t hash) const
+{
+	if (m_capacity == 0) { return m_capacity; }
+	const auto tag = h2(hash);
+	const size_t mask = m_capacity - 1;
+	size_t offset = h1(hash) & mask;
+	// triangular probing over groups visits every group of a power of two table
+	for (size_t step = kGroupWidth;; step += kGroupWidth) {
+		const Group group{ m_control.data() + offset };
+		for (auto matches = group.match(tag); matches; matches &= matches - 1) {
+			const auto slot = (offset + std::countr_zero(matches)) & mask;
+			if (m_slots[slot].hash == hash && m_slots[slot].value == key) { return slot; }
+		}
+		if (group.match(kEmpty)) { return m_capacity; }
+		offset = (offset + step) & mask;
+	}
+}
+
+size_t FlatHashSet::find_non_full_slot(size_t hash) const
+{
+	const size_t mask = m_capacity - 1;
+	size_t offset = h1(hash) & mask;
+	for (size_t step = kGroupWidth;; step += kGroupWidth) {
+		const Group group{ m_control.data() + offset };
+		if (const auto matches = group.match_empty_or_deleted()) {
+			return (offset + std::countr_zero(matches)) & mask;
+		}
+		offset = (offset + step) & mask;
+	}
+}
+
+std::pair<size_t, bool> FlatHashSet::find_or_prepare_insert(const Value &key, size_t hash) const
+{
+	ASSERT(m_capacity > 0)
+	const auto tag = h2(hash);
+	const size_t mask = m_capacity - 1;
+	size_t offset = h1(hash) & mask;
+	// the first empty or deleted slot of the probe sequence, i.e. what find_non_full_slot returns
+	size_t non_full_slot = m_capacity;
+	for (size_t step = kGroupWidth;; step += kGroupWidth) {
+		const Group group{ m_control.data() + offset };
+		for (auto matches = group.match(tag); matches; matches &= matches - 1) {
+			const auto slot = (offset + std::countr_zero(matches)) & mask;
+			if (m_slots[slot].hash == hash && m_slots[slot].value == key) { return { slot, true }; }
+		}
+		const auto non_full = group.match_empty_or_deleted();
+		if (non_full_slot == m_capacity && non_full) {
+			non_full_slot = (offset + std::countr_zero(non_full)) & mask;
+		}
+		if (group.match(kEmpty)) { return { non_full_slot, false }; }
+		offset = (offset + step) & mask;
+	}
+}
+
+void FlatHashSet::set_control(size_t slot, int8_t control)
+{
+	m_control[slot] = control;
+	if (slot < kGroupWidth) { m_control[m_capacity + slot] = control; }
+}
+
+void FlatHashSet::rehash(size_t capacity)
+{
+	ASSERT(std::has_single_bit(capacity))
+	ASSERT(capacity >= kMinCapacity)
+
+	auto control = std::move(m_control);
+	auto slots = std::move(m_slots);
+	const auto old_capacity = m_capacity;
+
+	m_capacity = capacity;
+	m_control.assign(m_capacity + kGroupWidth, kEmpty);
+	m_slots.resize(m_capacity);
+	for (size_t i = 0; i < old_capacity; ++i) {
+		if (control[i] < 0) { continue; }
+		const auto slot = find_non_full_slot(slots[i].hash);
+		set_control(slot, h2(slots[i].hash));
+		m_slots[slot] = std::move(slots[i]);
+	}
+	ASSERT(m_capacity - m_capacity / 8 > m_size)
+	m_growth_left = m_capacity - m_capacity / 8 - m_size;
+}
+
+size_t FlatHashSet::insert_at(size_t slot, const Value &key, size_t hash)
+{
+	if (m_growth_left == 0 && m_control[slot] == kEmpty) {
+		// drop the deleted slots if that frees enough room, otherwise grow
+		if (m_size * 32 <= m_capacity * 25) {
+			rehash(m_capacity);
+		} else {
+			rehash(capacity_for(m_size + 1));
+		}
+		slot = find_non_full_slot(hash);
+	}
+	if (m_control[slot] == kEmpty) { m_growth_left--; }
+	set_control(slot, h2(hash));
+	m_slots[slot] = Slot{ key, hash };
+	m_size++;
+	return slot;
+}
+
+size_t FlatHashSet::insert_new(const Value &key, size_t hash)
+{
+	if (m_capacity == 0) { rehash(kMinCapacity); }
+	return insert_at(find_non_full_slot(hash), key, hash);
+}
+
+FlatHashSet::const_iterator FlatHashSet::find(const Value &key) const
+{
+	return const_iterator{ this, find_slot(key, hash(key)) };
+}
+
+std::pair<FlatHashSet::iterator, bool> FlatHashSet::insert(const Value &key)
+{
+	const auto h = hash(key);
+	if (m_capacity == 0) { rehash(kMinCapacity); }
+	const auto [slot, found] = find_or_prepare_insert(key, h);
+	if (found) { return { const_iterator{ this, slot }, false }; }
+	return { const_iterator{ this, insert_at(slot, key, h) }, true };
+}
+
+void FlatHashSet::merge(const FlatHashSet &other)
+{
+	if (this == &other) { return; }
+	reserve(m_size + other.m_size);
+	for (auto it = other.begin(); it != other.end(); ++it) {
+		const auto h = other.m_slots[it.m_slot].hash;
+		if (find_slot(*it, h) == m_capacity) { insert_new(*it, h); }
+	}
+}
+
+FlatHashSet FlatHashSet::intersection(const FlatHashSet &other) const
+{
+	// probe the larger set with the elements of the smaller one
+	const auto &[smaller, larger] =
+		m_size <= other.m_size ? std::tie(*this, other) : std::tie(other, *this);
+	FlatHashSet result;
+	result.reserve(smaller.m_size);
+	for (auto it = smaller.begin(); it != smaller.end(); ++it) {
+		const auto h = smaller.m_slots[it.m_slot].hash;
+		if (larger.find_slot(*it, h) != larger.m_capacity) { result.insert_new(*it, h); }
+	}
+	return result;
+}
+
+FlatHashSet FlatHashSet::difference(const FlatHashSet &other) const
+{
+	FlatHashSet result;
+	result.reserve(m_size);
+	for (auto it = begin(); it != end(); ++it) {
+		const auto h = m_slots[it.m_slot].hash;
+		if (other.find_slot(*it, h) == other.m_capacity) { result.insert_new(*it, h); }
+	}
+	return result;
+}
+
+FlatHashSet::iterator FlatHashSet::erase(const_iterator it)
+{
+	ASSERT(it.m_set == this)
+	ASSERT(it.m_slot < m_capacity && m_control[it.m_slot] >= 0)
+
+	m_size--;
+	if (m_size == 0) {
+		clear();
+		return end();
+	}
+	set_control(it.m_slot, kDeleted);
+	m_slots[it.m_slot].value = Value{ static_cast<PyObject *>(nullptr) };
+	return ++it;
+}
+
+size_t FlatHashSet::erase(const Value &key)
+{
+	auto it = find(key);
+	if (it == end()) { return 0; }
+	erase(it);
+	return 1;
+}
+
+void FlatHashSet::clear()
+{
+	std::fill(m_control.begin(), m_control.end(), kEmpty);
+	std::fill(m_slots.begin(), m_slots.end(), Slot{ Value{ static_cast<PyObject *>(nullptr) }, 0 });
+	m_size = 0;
+	m_growth_left = m_capacity - m_capacity / 8;
+}
+
+void FlatHashSet::reserve(size_t size)
+{
+	if (size <= m_size + m_growth_left) { return; }
+	rehash(capacity_for(size));
+}
+
+bool FlatHashSet::operator==(const FlatHashSet &other) const
+{
+	if (m_size != other.m_size) { return false; }
+	for (auto it = begin(); it != end(); ++it) {
+		if (other.find_slot(*it, m_slots[it.m_slot].hash) == other.m_capacity) { return false; }
+	}
+	return true;
+}
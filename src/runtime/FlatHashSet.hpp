@@ -0,0 +1,156 @@
+#pragma once
+
+#include "PyObject.hpp"
+#include "runtime/Value.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace py {
+
+// Unordered hash set of Values, laid out as a "Swiss table":
+//  * a flat array of slots, each holding an element and the cached hash of that element, and
+//  * one control byte per slot that marks the slot as empty or deleted, or holds a 7 bit tag
+//    taken from the hash of the element in the slot.
+// Probes load the control bytes of 16 consecutive slots at once (with SSE2 on x86-64) and only
+// compare the elements, with the possibly slot dispatched equality, of slots whose tag matches.
+// Operations between two sets reuse the cached hashes, so elements are hashed once.
+class FlatHashSet
+{
+  public:
+	using key_type = Value;
+	using value_type = Value;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+
+	class const_iterator
+	{
+		friend FlatHashSet;
+
+		const FlatHashSet *m_set{ nullptr };
+		size_t m_slot{ 0 };
+
+		const_iterator(const FlatHashSet *set, size_t slot);
+
+	  public:
+		using difference_type = FlatHashSet::difference_type;
+		using value_type = FlatHashSet::value_type;
+		using pointer = const value_type *;
+		using reference = const value_type &;
+		using iterator_category = std::forward_iterator_tag;
+
+		const_iterator() = default;
+
+		reference operator*() const { return m_set->m_slots[m_slot].value; }
+		pointer operator->() const { return &m_set->m_slots[m_slot].value; }
+
+		// position of the element in the slot array, see FlatHashSet::from_slot
+		size_t slot() const { return m_slot; }
+
+		const_iterator &operator++();
+		const_iterator operator++(int)
+		{
+			auto tmp = *this;
+			++(*this);
+			return tmp;
+		}
+
+		bool operator==(const const_iterator &other) const
+		{
+			return m_set == other.m_set && m_slot == other.m_slot;
+		}
+	};
+	using iterator = const_iterator;
+
+  private:
+	// the hash is stored next to the element, so a probe that finds the element only touches a
+	// single cache line of the slot array. It is stored already mixed (see FlatHashSet::hash), so
+	// that rehashing and operations between sets do not have to mix it again
+	struct Slot
+	{
+		Value value;
+		size_t hash;
+	};
+
+	// m_capacity control bytes, followed by a copy of the first kGroupWidth control bytes so that a
+	// group can be loaded at any slot without wrapping around the end of the table
+	std::vector<int8_t> m_control;
+	std::vector<Slot> m_slots;
+	size_t m_capacity{ 0 };
+	size_t m_size{ 0 };
+	// number of empty slots that can still be filled before the table has to be rehashed
+	size_t m_growth_left{ 0 };
+
+  public:
+	FlatHashSet() = default;
+
+	const_iterator begin() const { return const_iterator{ this, 0 }; }
+	const_iterator end() const { return const_iterator{ this, m_capacity }; }
+
+	// the first element at or after `slot`, used to resume an iteration that does not keep an
+	// iterator around
+	const_iterator from_slot(size_t slot) const
+	{
+		return const_iterator{ this, std::min(slot, m_capacity) };
+	}
+
+	size_t size() const { return m_size; }
+	bool empty() const { return m_size == 0; }
+	// number of slots, a power of two
+	size_t capacity() const { return m_capacity; }
+
+	const_iterator find(const Value &key) const;
+	bool contains(const Value &key) const { return find(key) != end(); }
+	size_t count(const Value &key) const { return contains(key) ? 1 : 0; }
+
+	std::pair<iterator, bool> insert(const Value &key);
+	iterator insert(const_iterator, const Value &key) { return insert(key).first; }
+	template<typename InputIt> void insert(InputIt first, InputIt last)
+	{
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+						  typename std::iterator_traits<InputIt>::iterator_category>) {
+			reserve(m_size + std::distance(first, last));
+		}
+		for (; first != last; ++first) { insert(*first); }
+	}
+
+	// inserts every element of `other`, without hashing them again
+	void merge(const FlatHashSet &other);
+	// the elements of this set that are (not) in `other`, without hashing them again
+	FlatHashSet intersection(const FlatHashSet &other) const;
+	FlatHashSet difference(const FlatHashSet &other) const;
+
+	iterator erase(const_iterator it);
+	size_t erase(const Value &key);
+
+	void clear();
+	void reserve(size_t size);
+
+	// sets compare equal when they have the same elements
+	bool operator==(const FlatHashSet &other) const;
+
+  private:
+	static constexpr int8_t kEmpty = -128;
+	static constexpr int8_t kDeleted = -2;
+	static constexpr size_t kGroupWidth = 16;
+	static constexpr size_t kMinCapacity = kGroupWidth;
+
+	static size_t hash(const Value &key);
+	size_t find_slot(const Value &key, size_t hash) const;
+	size_t find_non_full_slot(size_t hash) const;
+	// the slot of `key` and true if it is in the set, otherwise the slot where it would be
+	// inserted and false, found with a single probe
+	std::pair<size_t, bool> find_or_prepare_insert(const Value &key, size_t hash) const;
+	void set_control(size_t slot, int8_t control);
+	// inserts a key that is not in the set, `slot` is the result of find_non_full_slot
+	size_t insert_at(size_t slot, const Value &key, size_t hash);
+	size_t insert_new(const Value &key, size_t hash);
+	void rehash(size_t capacity);
+	static size_t capacity_for(size_t size);
+};
+
+}// namespace py
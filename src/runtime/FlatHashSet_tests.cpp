@@ -0,0 +1,123 @@
+#include "FlatHashSet.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace py;
+
+namespace {
+// the 7/8 load factor leaves room for 14 elements in the smallest table
+constexpr size_t kMinCapacity = 16;
+constexpr size_t kMinCapacityGrowth = 14;
+
+bool contains_range(const FlatHashSet &set, int64_t begin, int64_t end)
+{
+	for (int64_t i = begin; i < end; ++i) {
+		if (!set.contains(Number{ i })) { return false; }
+	}
+	return true;
+}
+}// namespace
+
+TEST(FlatHashSet, EraseAndReinsertWithNoGrowthLeft)
+{
+	FlatHashSet set;
+	for (int64_t i = 0; i < static_cast<int64_t>(kMinCapacityGrowth); ++i) {
+		ASSERT_TRUE(set.insert(Number{ i }).second);
+	}
+	ASSERT_EQ(set.capacity(), kMinCapacity);
+
+	// a key that is already there is found before the table is considered full
+	EXPECT_FALSE(set.insert(Number{ int64_t{ 3 } }).second);
+	EXPECT_EQ(set.capacity(), kMinCapacity);
+
+	ASSERT_EQ(set.erase(Number{ int64_t{ 5 } }), 1);
+	EXPECT_FALSE(set.contains(Number{ int64_t{ 5 } }));
+	EXPECT_TRUE(set.insert(Number{ int64_t{ 5 } }).second);
+	EXPECT_FALSE(set.insert(Number{ int64_t{ 5 } }).second);
+
+	EXPECT_EQ(set.size(), kMinCapacityGrowth);
+	EXPECT_TRUE(contains_range(set, 0, kMinCapacityGrowth));
+	EXPECT_EQ(std::distance(set.begin(), set.end()), static_cast<int64_t>(kMinCapacityGrowth));
+}
+
+TEST(FlatHashSet, RehashesInPlaceWhenDeletedSlotsRunOut)
+{
+	FlatHashSet set;
+	for (int64_t i = 0; i < 8; ++i) { set.insert(Number{ i }); }
+	ASSERT_EQ(set.capacity(), kMinCapacity);
+
+	// every erase leaves a deleted slot behind, so the table runs out of empty slots many times
+	// over, and is rehashed at the same capacity because it is never more than half full
+	for (int64_t i = 8; i < 1000; ++i) {
+		ASSERT_EQ(set.erase(Number{ i - 8 }), 1);
+		ASSERT_TRUE(set.insert(Number{ i }).second);
+		ASSERT_EQ(set.capacity(), kMinCapacity);
+	}
+
+	EXPECT_EQ(set.size(), 8);
+	EXPECT_TRUE(contains_range(set, 992, 1000));
+	EXPECT_FALSE(set.contains(Number{ int64_t{ 991 } }));
+	EXPECT_EQ(std::distance(set.begin(), set.end()), 8);
+}
+
+TEST(FlatHashSet, IterationResumesFromSlotAfterRehash)
+{
+	FlatHashSet set;
+	for (int64_t i = 0; i < 8; ++i) { set.insert(Number{ i }); }
+	auto it = set.begin();
+	std::advance(it, 3);
+	const auto slot = it.slot();
+
+	// grow: the slot now refers to a position in the new table and the iteration resumes from
+	// there without reading past the table or stopping on an empty slot
+	for (int64_t i = 8; i < 200; ++i) { set.insert(Number{ i }); }
+	ASSERT_GT(set.capacity(), kMinCapacity);
+	size_t visited = 0;
+	for (auto resumed = set.from_slot(slot); resumed != set.end(); ++resumed) {
+		ASSERT_TRUE(set.contains(*resumed));
+		visited++;
+	}
+	EXPECT_LE(visited, set.size());
+
+	// shrink the live elements so that the next insertions rehash in place
+	for (int64_t i = 0; i < 190; ++i) { set.erase(Number{ i }); }
+	const auto capacity = set.capacity();
+	const auto last_slot = set.capacity() - 1;
+	for (int64_t i = 200; i < 400; ++i) {
+		set.erase(Number{ i - 10 });
+		set.insert(Number{ i });
+	}
+	EXPECT_EQ(set.capacity(), capacity);
+	for (auto resumed = set.from_slot(last_slot); resumed != set.end(); ++resumed) {
+		ASSERT_TRUE(set.contains(*resumed));
+	}
+
+	EXPECT_TRUE(set.from_slot(set.capacity() + 1) == set.end());
+	EXPECT_EQ(std::distance(set.from_slot(0), set.end()), 10);
+}
+
+TEST(FlatHashSet, SetOperationsReuseStoredHashes)
+{
+	FlatHashSet evens;
+	FlatHashSet small;
+	for (int64_t i = 0; i < 100; i += 2) { evens.insert(Number{ i }); }
+	for (int64_t i = 0; i < 10; ++i) { small.insert(Number{ i }); }
+
+	const auto intersection = small.intersection(evens);
+	EXPECT_EQ(intersection.size(), 5);
+	EXPECT_TRUE(intersection == evens.intersection(small));
+
+	const auto difference = small.difference(evens);
+	EXPECT_EQ(difference.size(), 5);
+	for (const auto &el : difference) {
+		EXPECT_FALSE(evens.contains(el));
+		EXPECT_TRUE(small.contains(el));
+	}
+
+	auto merged = evens;
+	merged.merge(small);
+	EXPECT_EQ(merged.size(), 55);
+	EXPECT_TRUE(contains_range(merged, 0, 10));
+	merged.merge(merged);
+	EXPECT_EQ(merged.size(), 55);
+}
@@ -70,6 +70,8 @@ template<typename T> PyResult<PyObject *> GeneratorInterface<T>::send(PyObject *
 	ASSERT(as<PyCode>(m_code));
 
 	m_frame->m_f_back = VirtualMachine::the().interpreter().execution_frame();
+	// escape() stops at frames that already escaped, so the new callers have to be marked here
+	if (m_frame->escaped() && m_frame->m_f_back) { m_frame->m_f_back->escape(); }
 	auto result = VirtualMachine::the().interpreter().call(
 		as<PyCode>(m_code)->function(), m_frame, *m_stack_frame);
 
@@ -109,7 +111,7 @@ template<typename T> void GeneratorInterface<T>::visit_graph(Visitor &visitor)
 		for (const auto &exc : *m_exception_stack) {
 			if (exc.exception) visitor.visit(*exc.exception);
 			if (exc.exception_type) visitor.visit(*exc.exception_type);
-			if (exc.traceback) visitor.visit(*exc.traceback);
+			if (exc.frame) visitor.visit(*exc.frame);
 		}
 	}
 
@@ -0,0 +1,660 @@
+#include "ListSort.hpp"
+#include "ListStorage.hpp"
+#include "PyList.hpp"
+#include "PyNone.hpp"
+#include "PyString.hpp"
+#include "PyTuple.hpp"
+#include "interpreter/Interpreter.hpp"
+#include "vm/VM.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+using namespace py;
+
+namespace {
+
+// Timsort over an array of trivially copyable items, ported from CPython's Objects/listobject.c.
+// `Compare` returns either a bool, for native keys, or a PyResult<bool> when the comparison calls
+// into Python. The first failed comparison stops the sort and leaves the array in some
+// permutation of its original items.
+template<typename T, typename Compare> class TimSort
+{
+	static_assert(std::is_trivially_copyable_v<T>);
+
+	static constexpr bool kCanFail =
+		std::is_same_v<std::invoke_result_t<Compare &, const T &, const T &>, PyResult<bool>>;
+	// runs shorter than this are extended with a binary insertion sort
+	static constexpr ptrdiff_t kMinMerge = 64;
+	// initial number of consecutive wins of one run before a merge switches to galloping
+	static constexpr ptrdiff_t kMinGallop = 7;
+
+	struct Run
+	{
+		ptrdiff_t base;
+		ptrdiff_t length;
+	};
+
+	// where merge_lo_loop/merge_hi_loop stopped, merge_lo/merge_hi move the remaining items
+	enum class MergeEnd {
+		Done,
+		CopyTail,
+		Failed,
+	};
+
+	struct MergeState
+	{
+		ptrdiff_t dest;
+		ptrdiff_t a;
+		ptrdiff_t b;
+		ptrdiff_t na;
+		ptrdiff_t nb;
+	};
+
+	std::vector<T> &m_array;
+	Compare m_compare;
+	std::vector<T> m_tmp;
+	std::vector<Run> m_runs;
+	ptrdiff_t m_min_gallop{ kMinGallop };
+	BaseException *m_error{ nullptr };
+
+  public:
+	TimSort(std::vector<T> &array, Compare compare) : m_array(array), m_compare(std::move(compare))
+	{}
+
+	PyResult<std::monostate> sort()
+	{
+		const auto n = static_cast<ptrdiff_t>(m_array.size());
+		if (n < 2) { return Ok(std::monostate{}); }
+
+		const auto min_run = compute_min_run(n);
+		ptrdiff_t lo = 0;
+		while (lo < n) {
+			bool descending = false;
+			auto run = count_run(lo, n, descending);
+			if (failed()) { break; }
+			if (descending) { std::reverse(m_array.begin() + lo, m_array.begin() + lo + run); }
+			if (run < min_run) {
+				const auto forced = std::min(min_run, n - lo);
+				if (!binary_sort(lo, lo + forced, lo + run)) { break; }
+				run = forced;
+			}
+			m_runs.push_back(Run{ lo, run });
+			if (!merge_collapse()) { break; }
+			lo += run;
+		}
+		if (!failed()) { merge_force_collapse(); }
+
+		if (failed()) { return Err(m_error); }
+		return Ok(std::monostate{});
+	}
+
+  private:
+	bool less(const T &lhs, const T &rhs)
+	{
+		if constexpr (kCanFail) {
+			auto result = m_compare(lhs, rhs);
+			if (result.is_err()) {
+				m_error = result.unwrap_err();
+				return false;
+			}
+			return result.unwrap();
+		} else {
+			return m_compare(lhs, rhs);
+		}
+	}
+
+	bool failed() const
+	{
+		if constexpr (kCanFail) {
+			return m_error != nullptr;
+		} else {
+			return false;
+		}
+	}
+
+	// n itself if it is small, otherwise a value in [kMinMerge / 2, kMinMerge] such that
+	// n / min_run is a power of two, or slightly less than one, so that the final merges are
+	// balanced
+	static ptrdiff_t compute_min_run(ptrdiff_t n)
+	{
+		ptrdiff_t r = 0;
+		while (n >= kMinMerge) {
+			r |= n & 1;
+			n >>= 1;
+		}
+		return n + r;
+	}
+
+	// length of the run starting at lo, which is either non-descending or strictly descending so
+	// that reversing it keeps the sort stable
+	ptrdiff_t count_run(ptrdiff_t lo, ptrdiff_t hi, bool &descending)
+	{
+		if (lo + 1 == hi) { return 1; }
+		const T *array = m_array.data();
+		descending = less(array[lo + 1], array[lo]);
+		if (failed()) { return 0; }
+		ptrdiff_t i = lo + 2;
+		for (; i < hi; ++i) {
+			const bool is_less = less(array[i], array[i - 1]);
+			if (failed()) { return 0; }
+			if (is_less != descending) { break; }
+		}
+		return i - lo;
+	}
+
+	// sorts [lo, hi) given that [lo, start) is already sorted
+	bool binary_sort(ptrdiff_t lo, ptrdiff_t hi, ptrdiff_t start)
+	{
+		T *array = m_array.data();
+		for (; start < hi; ++start) {
+			const T pivot = array[start];
+			ptrdiff_t l = lo;
+			ptrdiff_t r = start;
+			while (l < r) {
+				const auto m = l + ((r - l) >> 1);
+				const bool is_less = less(pivot, array[m]);
+				if (failed()) { return false; }
+				if (is_less) {
+					r = m;
+				} else {
+					l = m + 1;
+				}
+			}
+			std::copy_backward(array + l, array + start, array + start + 1);
+			array[l] = pivot;
+		}
+		return true;
+	}
+
+	// the position k in the sorted base[0, n) such that base[k - 1] < key <= base[k], starting the
+	// search at base[hint] and galloping away from it with steps of 1, 3, 7, ..., 2^i - 1
+	ptrdiff_t gallop_left(const T &key, const T *base, ptrdiff_t n, ptrdiff_t hint)
+	{
+		ptrdiff_t last_offset = 0;
+		ptrdiff_t offset = 1;
+		const bool key_is_greater = less(base[hint], key);
+		if (failed()) { return 0; }
+		if (key_is_greater) {
+			// base[hint] < key, gallop right until
+			// base[hint + last_offset] < key <= base[hint + offset]
+			const auto max_offset = n - hint;
+			while (offset < max_offset) {
+				const bool is_less = less(base[hint + offset], key);
+				if (failed()) { return 0; }
+				if (!is_less) { break; }
+				last_offset = offset;
+				offset = (offset << 1) + 1;
+			}
+			offset = std::min(offset, max_offset);
+			last_offset += hint;
+			offset += hint;
+		} else {
+			// key <= base[hint], gallop left until
+			// base[hint - offset] < key <= base[hint - last_offset]
+			const auto max_offset = hint + 1;
+			while (offset < max_offset) {
+				const bool is_less = less(base[hint - offset], key);
+				if (failed()) { return 0; }
+				if (is_less) { break; }
+				last_offset = offset;
+				offset = (offset << 1) + 1;
+			}
+			offset = std::min(offset, max_offset);
+			const auto k = last_offset;
+			last_offset = hint - offset;
+			offset = hint - k;
+		}
+
+		// base[last_offset] < key <= base[offset], binary search in between
+		++last_offset;
+		while (last_offset < offset) {
+			const auto m = last_offset + ((offset - last_offset) >> 1);
+			const bool is_less = less(base[m], key);
+			if (failed()) { return 0; }
+			if (is_less) {
+				last_offset = m + 1;
+			} else {
+				offset = m;
+			}
+		}
+		return offset;
+	}
+
+	// like gallop_left, but the position k such that base[k - 1] <= key < base[k], i.e. after any
+	// items equal to key
+	ptrdiff_t gallop_right(const T &key, const T *base, ptrdiff_t n, ptrdiff_t hint)
+	{
+		ptrdiff_t last_offset = 0;
+		ptrdiff_t offset = 1;
+		const bool key_is_less = less(key, base[hint]);
+		if (failed()) { return 0; }
+		if (key_is_less) {
+			// key < base[hint], gallop left until
+			// base[hint - offset] <= key < base[hint - last_offset]
+			const auto max_offset = hint + 1;
+			while (offset < max_offset) {
+				const bool is_less = less(key, base[hint - offset]);
+				if (failed()) { return 0; }
+				if (!is_less) { break; }
+				last_offset = offset;
+				offset = (offset << 1) + 1;
+			}
+			offset = std::min(offset, max_offset);
+			const auto k = last_offset;
+			last_offset = hint - offset;
+			offset = hint - k;
+		} else {
+			// base[hint] <= key, gallop right until
+			// base[hint + last_offset] <= key < base[hint + offset]
+			const auto max_offset = n - hint;
+			while (offset < max_offset) {
+				const bool is_less = less(key, base[hint + offset]);
+				if (failed()) { return 0; }
+				if (is_less) { break; }
+				last_offset = offset;
+				offset = (offset << 1) + 1;
+			}
+			offset = std::min(offset, max_offset);
+			last_offset += hint;
+			offset += hint;
+		}
+
+		// base[last_offset] <= key < base[offset], binary search in between
+		++last_offset;
+		while (last_offset < offset) {
+			const auto m = last_offset + ((offset - last_offset) >> 1);
+			const bool is_less = less(key, base[m]);
+			if (failed()) { return 0; }
+			if (is_less) {
+				offset = m;
+			} else {
+				last_offset = m + 1;
+			}
+		}
+		return offset;
+	}
+
+	// merges the adjacent runs a = [s.a, s.a + s.na) and b = [s.b, s.b + s.nb) in place, with
+	// s.na <= s.nb, where run a has been moved to m_tmp and s.a indexes into it.
+	// The first item of b is known to be smaller than every item of a and the last item of a is
+	// known to be larger than every item of b.
+	MergeEnd merge_lo_loop(MergeState &s)
+	{
+		T *array = m_array.data();
+		const T *tmp = m_tmp.data();
+
+		array[s.dest++] = array[s.b++];
+		if (--s.nb == 0) { return MergeEnd::Done; }
+		if (s.na == 1) { return MergeEnd::CopyTail; }
+
+		auto min_gallop = m_min_gallop;
+		for (;;) {
+			ptrdiff_t a_count = 0;
+			ptrdiff_t b_count = 0;
+
+			// one item at a time, until one of the runs wins min_gallop times in a row
+			for (;;) {
+				const bool b_first = less(array[s.b], tmp[s.a]);
+				if (failed()) { return MergeEnd::Failed; }
+				if (b_first) {
+					array[s.dest++] = array[s.b++];
+					++b_count;
+					a_count = 0;
+					if (--s.nb == 0) { return MergeEnd::Done; }
+					if (b_count >= min_gallop) { break; }
+				} else {
+					array[s.dest++] = tmp[s.a++];
+					++a_count;
+					b_count = 0;
+					if (--s.na == 1) { return MergeEnd::CopyTail; }
+					if (a_count >= min_gallop) { break; }
+				}
+			}
+
+			// gallop until neither run wins kMinGallop times in a row, making it easier to get back
+			// into galloping the longer it pays off
+			++min_gallop;
+			do {
+				min_gallop -= min_gallop > 1;
+				m_min_gallop = min_gallop;
+
+				auto k = gallop_right(array[s.b], tmp + s.a, s.na, 0);
+				if (failed()) { return MergeEnd::Failed; }
+				a_count = k;
+				if (k) {
+					std::copy(tmp + s.a, tmp + s.a + k, array + s.dest);
+					s.dest += k;
+					s.a += k;
+					s.na -= k;
+					if (s.na == 1) { return MergeEnd::CopyTail; }
+					// only possible with an inconsistent comparison
+					if (s.na == 0) { return MergeEnd::Done; }
+				}
+				array[s.dest++] = array[s.b++];
+				if (--s.nb == 0) { return MergeEnd::Done; }
+
+				k = gallop_left(tmp[s.a], array + s.b, s.nb, 0);
+				if (failed()) { return MergeEnd::Failed; }
+				b_count = k;
+				if (k) {
+					std::copy(array + s.b, array + s.b + k, array + s.dest);
+					s.dest += k;
+					s.b += k;
+					s.nb -= k;
+					if (s.nb == 0) { return MergeEnd::Done; }
+				}
+				array[s.dest++] = tmp[s.a++];
+				if (--s.na == 1) { return MergeEnd::CopyTail; }
+			} while (a_count >= kMinGallop || b_count >= kMinGallop);
+			++min_gallop;
+			m_min_gallop = min_gallop;
+		}
+	}
+
+	bool merge_lo(ptrdiff_t base_a, ptrdiff_t na, ptrdiff_t base_b, ptrdiff_t nb)
+	{
+		m_tmp.assign(m_array.begin() + base_a, m_array.begin() + base_a + na);
+		MergeState s{ .dest = base_a, .a = 0, .b = base_b, .na = na, .nb = nb };
+		const auto end = merge_lo_loop(s);
+
+		T *array = m_array.data();
+		const T *tmp = m_tmp.data();
+		if (end == MergeEnd::CopyTail) {
+			// the last item of a goes after the rest of b
+			ASSERT(s.na == 1 && s.nb > 0)
+			std::copy(array + s.b, array + s.b + s.nb, array + s.dest);
+			array[s.dest + s.nb] = tmp[s.a];
+		} else {
+			// the rest of a, if any, is still in m_tmp
+			std::copy(tmp + s.a, tmp + s.a + s.na, array + s.dest);
+		}
+		return end != MergeEnd::Failed;
+	}
+
+	// the mirror image of merge_lo_loop, for s.na >= s.nb, where run b has been moved to m_tmp and
+	// the runs are merged from the right: s.dest, s.a and s.b index the last item of the output
+	// and of the runs
+	MergeEnd merge_hi_loop(MergeState &s, ptrdiff_t base_a)
+	{
+		T *array = m_array.data();
+		const T *tmp = m_tmp.data();
+
+		array[s.dest--] = array[s.a--];
+		if (--s.na == 0) { return MergeEnd::Done; }
+		if (s.nb == 1) { return MergeEnd::CopyTail; }
+
+		auto min_gallop = m_min_gallop;
+		for (;;) {
+			ptrdiff_t a_count = 0;
+			ptrdiff_t b_count = 0;
+
+			for (;;) {
+				const bool a_last = less(tmp[s.b], array[s.a]);
+				if (failed()) { return MergeEnd::Failed; }
+				if (a_last) {
+					array[s.dest--] = array[s.a--];
+					++a_count;
+					b_count = 0;
+					if (--s.na == 0) { return MergeEnd::Done; }
+					if (a_count >= min_gallop) { break; }
+				} else {
+					array[s.dest--] = tmp[s.b--];
+					++b_count;
+					a_count = 0;
+					if (--s.nb == 1) { return MergeEnd::CopyTail; }
+					if (b_count >= min_gallop) { break; }
+				}
+			}
+
+			++min_gallop;
+			do {
+				min_gallop -= min_gallop > 1;
+				m_min_gallop = min_gallop;
+
+				auto k = gallop_right(tmp[s.b], array + base_a, s.na, s.na - 1);
+				if (failed()) { return MergeEnd::Failed; }
+				k = s.na - k;
+				a_count = k;
+				if (k) {
+					s.dest -= k;
+					s.a -= k;
+					std::copy_backward(
+						array + s.a + 1, array + s.a + 1 + k, array + s.dest + 1 + k);
+					s.na -= k;
+					if (s.na == 0) { return MergeEnd::Done; }
+				}
+				array[s.dest--] = tmp[s.b--];
+				if (--s.nb == 1) { return MergeEnd::CopyTail; }
+				// only possible with an inconsistent comparison
+				if (s.nb == 0) { return MergeEnd::Done; }
+
+				k = gallop_left(array[s.a], tmp, s.nb, s.nb - 1);
+				if (failed()) { return MergeEnd::Failed; }
+				k = s.nb - k;
+				b_count = k;
+				if (k) {
+					s.dest -= k;
+					s.b -= k;
+					std::copy(tmp + s.b + 1, tmp + s.b + 1 + k, array + s.dest + 1);
+					s.nb -= k;
+					if (s.nb == 1) { return MergeEnd::CopyTail; }
+					if (s.nb == 0) { return MergeEnd::Done; }
+				}
+				array[s.dest--] = array[s.a--];
+				if (--s.na == 0) { return MergeEnd::Done; }
+			} while (a_count >= kMinGallop || b_count >= kMinGallop);
+			++min_gallop;
+			m_min_gallop = min_gallop;
+		}
+	}
+
+	bool merge_hi(ptrdiff_t base_a, ptrdiff_t na, ptrdiff_t base_b, ptrdiff_t nb)
+	{
+		m_tmp.assign(m_array.begin() + base_b, m_array.begin() + base_b + nb);
+		MergeState s{
+			.dest = base_b + nb - 1, .a = base_a + na - 1, .b = nb - 1, .na = na, .nb = nb
+		};
+		const auto end = merge_hi_loop(s, base_a);
+
+		T *array = m_array.data();
+		const T *tmp = m_tmp.data();
+		if (end == MergeEnd::CopyTail) {
+			// the first item of b goes before the rest of a
+			ASSERT(s.nb == 1 && s.na > 0)
+			s.dest -= s.na;
+			s.a -= s.na;
+			std::copy_backward(
+				array + s.a + 1, array + s.a + 1 + s.na, array + s.dest + 1 + s.na);
+			array[s.dest] = tmp[s.b];
+		} else {
+			// the rest of b, if any, is still at the start of m_tmp
+			std::copy(tmp, tmp + s.nb, array + s.dest - (s.nb - 1));
+		}
+		return end != MergeEnd::Failed;
+	}
+
+	// merges the runs i and i + 1 of the stack
+	bool merge_at(size_t i)
+	{
+		auto base_a = m_runs[i].base;
+		auto na = m_runs[i].length;
+		const auto base_b = m_runs[i + 1].base;
+		auto nb = m_runs[i + 1].length;
+		ASSERT(base_a + na == base_b)
+
+		m_runs[i].length = na + nb;
+		m_runs.erase(m_runs.begin() + i + 1);
+
+		// items of a that are not greater than the first item of b are already in place
+		const auto k = gallop_right(m_array[base_b], m_array.data() + base_a, na, 0);
+		if (failed()) { return false; }
+		base_a += k;
+		na -= k;
+		if (na == 0) { return true; }
+
+		// as are the items of b that are not smaller than the last item of a
+		nb = gallop_left(m_array[base_a + na - 1], m_array.data() + base_b, nb, nb - 1);
+		if (failed()) { return false; }
+		if (nb == 0) { return true; }
+
+		if (na <= nb) { return merge_lo(base_a, na, base_b, nb); }
+		return merge_hi(base_a, na, base_b, nb);
+	}
+
+	// restores the invariants on the lengths of the three topmost runs A, B and C of the stack:
+	// A > B + C and B > C, so that the run lengths grow at least as fast as the Fibonacci numbers
+	bool merge_collapse()
+	{
+		while (m_runs.size() > 1) {
+			auto n = m_runs.size() - 2;
+			if ((n > 0 && m_runs[n - 1].length <= m_runs[n].length + m_runs[n + 1].length)
+				|| (n > 1 && m_runs[n - 2].length <= m_runs[n - 1].length + m_runs[n].length)) {
+				if (m_runs[n - 1].length < m_runs[n + 1].length) { --n; }
+			} else if (m_runs[n].length > m_runs[n + 1].length) {
+				break;
+			}
+			if (!merge_at(n)) { return false; }
+		}
+		return true;
+	}
+
+	bool merge_force_collapse()
+	{
+		while (m_runs.size() > 1) {
+			auto n = m_runs.size() - 2;
+			if (n > 0 && m_runs[n - 1].length < m_runs[n + 1].length) { --n; }
+			if (!merge_at(n)) { return false; }
+		}
+		return true;
+	}
+};
+
+template<typename T, typename Compare> TimSort(std::vector<T> &, Compare) -> TimSort<T, Compare>;
+
+template<typename Key> struct SortItem
+{
+	Key key;
+	size_t index;
+};
+
+// sorts the indices of `keys` and then moves the elements into that order. With `reverse` the
+// items start out reversed and the sorted items are reversed again, so that equal keys keep their
+// original order.
+template<typename Key, typename Less>
+PyResult<std::monostate>
+	sort_by(std::vector<Value> &elements, const std::vector<Key> &keys, bool reverse, Less less)
+{
+	const auto n = elements.size();
+	std::vector<SortItem<Key>> items;
+	items.reserve(n);
+	for (size_t i = 0; i < n; ++i) {
+		const auto index = reverse ? n - 1 - i : i;
+		items.push_back(SortItem<Key>{ keys[index], index });
+	}
+
+	auto result = TimSort{ items,
+		[&less](const SortItem<Key> &lhs, const SortItem<Key> &rhs) {
+			return less(lhs.key, rhs.key);
+		} }
+					  .sort();
+	if (result.is_err()) { return result; }
+
+	if (reverse) { std::reverse(items.begin(), items.end()); }
+	std::vector<Value> sorted;
+	sorted.reserve(n);
+	for (const auto &item : items) { sorted.push_back(std::move(elements[item.index])); }
+	elements = std::move(sorted);
+
+	return Ok(std::monostate{});
+}
+
+std::optional<std::string_view> native_str(const Value &value)
+{
+	if (auto *str = std::get_if<String>(&value)) { return std::string_view{ str->s }; }
+	if (auto *obj = std::get_if<PyObject *>(&value)) {
+		if (auto *str = as<PyString>(*obj)) { return std::string_view{ str->value() }; }
+	}
+	return std::nullopt;
+}
+
+// the keys converted with `to_native`, if every key can be converted
+template<typename Key, typename ToNative>
+std::optional<std::vector<Key>> native_keys(std::span<const Value> keys, ToNative to_native)
+{
+	std::vector<Key> result;
+	result.reserve(keys.size());
+	for (const auto &key : keys) {
+		auto native = to_native(key);
+		if (!native.has_value()) { return std::nullopt; }
+		result.push_back(*native);
+	}
+	return result;
+}
+}// namespace
+
+PyResult<std::monostate> py::list_sort(std::vector<Value> &elements, PyObject *key, bool reverse)
+{
+	// the keys are kept in a list so that they are reachable by the garbage collector
+	PyList *keys_list = nullptr;
+	if (key && key != py_none()) {
+		auto keys_list_ = PyList::create();
+		if (keys_list_.is_err()) { return Err(keys_list_.unwrap_err()); }
+		keys_list = keys_list_.unwrap();
+		keys_list->as_object_storage().reserve(elements.size());
+		for (const auto &element : elements) {
+			auto args = PyTuple::create(element);
+			if (args.is_err()) { return Err(args.unwrap_err()); }
+			auto key_value = key->call(args.unwrap(), nullptr);
+			if (key_value.is_err()) { return Err(key_value.unwrap_err()); }
+			keys_list->as_object_storage().push_back(key_value.unwrap());
+		}
+	}
+	if (elements.size() < 2) { return Ok(std::monostate{}); }
+
+	const std::span<const Value> keys =
+		keys_list ? std::span<const Value>{ keys_list->as_object_storage() }
+				  : std::span<const Value>{ elements };
+
+	// homogeneous keys of a builtin type can be compared without going through __lt__, which
+	// cannot be overridden for exact ints, floats and strs. UTF-8 preserves the code point order,
+	// so strs compare bytewise.
+	if (auto ints = native_keys<int64_t>(keys, ListStorage::unbox_int)) {
+		return sort_by(elements, *ints, reverse, std::less<int64_t>{});
+	}
+	if (auto floats = native_keys<double>(keys, ListStorage::unbox_float)) {
+		return sort_by(elements, *floats, reverse, std::less<double>{});
+	}
+	if (auto strs = native_keys<std::string_view>(keys, native_str)) {
+		return sort_by(elements, *strs, reverse, std::less<std::string_view>{});
+	}
+
+	std::vector<const Value *> generic_keys;
+	generic_keys.reserve(keys.size());
+	for (const auto &k : keys) { generic_keys.push_back(&k); }
+	auto &interpreter = VirtualMachine::the().interpreter();
+	return sort_by(elements,
+		generic_keys,
+		reverse,
+		[&interpreter](const Value *lhs, const Value *rhs) -> PyResult<bool> {
+			return less_than(*lhs, *rhs, interpreter).and_then([&interpreter](const Value &result) {
+				return truthy(result, interpreter);
+			});
+		});
+}
+
+PyResult<std::monostate> py::list_sort(std::vector<int64_t> &elements, bool reverse)
+{
+	if (reverse) { return TimSort{ elements, std::greater<int64_t>{} }.sort(); }
+	return TimSort{ elements, std::less<int64_t>{} }.sort();
+}
+
+PyResult<std::monostate> py::list_sort(std::vector<double> &elements, bool reverse)
+{
+	// greater keeps equal elements, such as 0.0 and -0.0, in their original order
+	if (reverse) { return TimSort{ elements, std::greater<double>{} }.sort(); }
+	return TimSort{ elements, std::less<double>{} }.sort();
+}
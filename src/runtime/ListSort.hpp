@@ -0,0 +1,25 @@
+#pragma once
+
+#include "PyObject.hpp"
+#include "runtime/Value.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace py {
+
+// Stable sort of `elements` in ascending order of `key(element)`, or of the elements themselves
+// when `key` is nullptr, using Timsort (natural runs, binary insertion sort and galloping merges,
+// see CPython's Objects/listsort.txt). The key function is called once per element.
+// When every key is an int that fits in 64 bits, every key is a float or every key is a str, the
+// keys are compared natively instead of with __lt__.
+// With `reverse` the order is descending, and equal elements still keep their original order.
+// `elements` must be owned by a heap object, e.g. a PyList, as the sort can run Python code
+// that triggers a garbage collection. On error `elements` is left in its original order.
+PyResult<std::monostate> list_sort(std::vector<Value> &elements, PyObject *key, bool reverse);
+
+// The same sort over the unboxed elements of a list with the int or float storage strategy.
+PyResult<std::monostate> list_sort(std::vector<int64_t> &elements, bool reverse);
+PyResult<std::monostate> list_sort(std::vector<double> &elements, bool reverse);
+
+}// namespace py
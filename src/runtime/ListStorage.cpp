@@ -0,0 +1,212 @@
+#include "ListStorage.hpp"
+#include "PyFloat.hpp"
+#include "PyInteger.hpp"
+
+#include <algorithm>
+
+using namespace py;
+
+ListStorage::ListStorage(std::vector<Value> elements)
+{
+	if (std::all_of(elements.begin(), elements.end(), [](const Value &value) {
+			return unbox_int(value).has_value();
+		})) {
+		std::vector<int64_t> ints;
+		ints.reserve(elements.size());
+		for (const auto &value : elements) { ints.push_back(*unbox_int(value)); }
+		m_storage = std::move(ints);
+	} else if (std::all_of(elements.begin(), elements.end(), [](const Value &value) {
+				   return unbox_float(value).has_value();
+			   })) {
+		std::vector<double> floats;
+		floats.reserve(elements.size());
+		for (const auto &value : elements) { floats.push_back(*unbox_float(value)); }
+		m_storage = std::move(floats);
+	} else {
+		m_storage = std::move(elements);
+	}
+}
+
+std::optional<int64_t> ListStorage::unbox_int(const Value &value)
+{
+	const Number *number = std::get_if<Number>(&value);
+	if (auto *obj = std::get_if<PyObject *>(&value); obj && *obj) {
+		if (auto *integer = as<PyInteger>(*obj)) { number = &integer->value(); }
+	}
+	if (number) {
+		if (auto *i = std::get_if<int64_t>(&number->value)) { return *i; }
+	}
+	return std::nullopt;
+}
+
+std::optional<double> ListStorage::unbox_float(const Value &value)
+{
+	const Number *number = std::get_if<Number>(&value);
+	if (auto *obj = std::get_if<PyObject *>(&value); obj && *obj) {
+		if (auto *float_ = as<PyFloat>(*obj)) { number = &float_->value(); }
+	}
+	if (number) {
+		if (auto *d = std::get_if<double>(&number->value)) { return *d; }
+	}
+	return std::nullopt;
+}
+
+ListStorage::Strategy ListStorage::strategy() const
+{
+	if (as_ints()) { return Strategy::Int; }
+	if (as_floats()) { return Strategy::Float; }
+	return Strategy::Object;
+}
+
+size_t ListStorage::size() const
+{
+	return std::visit([](const auto &elements) { return elements.size(); }, m_storage);
+}
+
+Value ListStorage::operator[](size_t index) const
+{
+	if (auto *ints = as_ints()) { return Number{ (*ints)[index] }; }
+	if (auto *floats = as_floats()) { return Number{ (*floats)[index] }; }
+	return (*as_objects())[index];
+}
+
+void ListStorage::prepare_for(const Value &value)
+{
+	if (auto *ints = as_ints()) {
+		if (unbox_int(value).has_value()) { return; }
+		if (ints->empty() && unbox_float(value).has_value()) {
+			m_storage = std::vector<double>{};
+			return;
+		}
+	} else if (auto *floats = as_floats()) {
+		if (unbox_float(value).has_value()) { return; }
+		if (floats->empty() && unbox_int(value).has_value()) {
+			m_storage = std::vector<int64_t>{};
+			return;
+		}
+	} else {
+		return;
+	}
+	generalize();
+}
+
+void ListStorage::set(size_t index, const Value &value)
+{
+	if (auto *ints = as_ints()) {
+		if (auto i = unbox_int(value)) {
+			(*ints)[index] = *i;
+			return;
+		}
+	} else if (auto *floats = as_floats()) {
+		if (auto d = unbox_float(value)) {
+			(*floats)[index] = *d;
+			return;
+		}
+	} else {
+		(*as_objects())[index] = value;
+		return;
+	}
+	prepare_for(value);
+	set(index, value);
+}
+
+void ListStorage::push_back(const Value &value)
+{
+	if (auto *ints = as_ints()) {
+		if (auto i = unbox_int(value)) {
+			ints->push_back(*i);
+			return;
+		}
+	} else if (auto *floats = as_floats()) {
+		if (auto d = unbox_float(value)) {
+			floats->push_back(*d);
+			return;
+		}
+	} else {
+		as_objects()->push_back(value);
+		return;
+	}
+	prepare_for(value);
+	push_back(value);
+}
+
+void ListStorage::insert(size_t index, const Value &value)
+{
+	if (auto *ints = as_ints()) {
+		if (auto i = unbox_int(value)) {
+			ints->insert(ints->begin() + index, *i);
+			return;
+		}
+	} else if (auto *floats = as_floats()) {
+		if (auto d = unbox_float(value)) {
+			floats->insert(floats->begin() + index, *d);
+			return;
+		}
+	} else {
+		as_objects()->insert(as_objects()->begin() + index, value);
+		return;
+	}
+	prepare_for(value);
+	insert(index, value);
+}
+
+void ListStorage::extend(const ListStorage &other)
+{
+	if (other.empty()) { return; }
+	if (this == &other) {
+		auto copy = other;
+		extend(copy);
+		return;
+	}
+	if (empty() && strategy() != Strategy::Object) {
+		m_storage = other.m_storage;
+		return;
+	}
+	if (m_storage.index() == other.m_storage.index()) {
+		std::visit(
+			[&other](auto &elements) {
+				const auto &other_elements =
+					std::get<std::remove_reference_t<decltype(elements)>>(other.m_storage);
+				elements.insert(elements.end(), other_elements.begin(), other_elements.end());
+			},
+			m_storage);
+		return;
+	}
+	auto &elements = generalize();
+	elements.reserve(elements.size() + other.size());
+	for (size_t i = 0; i < other.size(); ++i) { elements.push_back(other[i]); }
+}
+
+void ListStorage::erase(size_t first, size_t last)
+{
+	std::visit(
+		[first, last](auto &elements) {
+			elements.erase(elements.begin() + first, elements.begin() + last);
+		},
+		m_storage);
+}
+
+void ListStorage::clear()
+{
+	std::visit([](auto &elements) { elements.clear(); }, m_storage);
+}
+
+void ListStorage::reserve(size_t size)
+{
+	std::visit([size](auto &elements) { elements.reserve(size); }, m_storage);
+}
+
+std::vector<Value> ListStorage::values() const
+{
+	if (auto *objects = as_objects()) { return *objects; }
+	std::vector<Value> result;
+	result.reserve(size());
+	for (size_t i = 0; i < size(); ++i) { result.push_back((*this)[i]); }
+	return result;
+}
+
+std::vector<Value> &ListStorage::generalize()
+{
+	if (!as_objects()) { m_storage = values(); }
+	return *as_objects();
+}
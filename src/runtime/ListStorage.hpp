@@ -0,0 +1,89 @@
+#pragma once
+
+#include "PyObject.hpp"
+#include "runtime/Value.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <variant>
+#include <vector>
+
+namespace py {
+
+// The elements of a list, stored with one of three strategies (as in PyPy):
+//  * Int, the unboxed int64_t value of every element, when they are all ints that fit in 64 bits,
+//  * Float, the unboxed double of every element, when they are all floats, or
+//  * Object, a Value per element.
+// A new list starts out with the int strategy. While the list is empty an element that its
+// strategy cannot represent picks the strategy, otherwise such an element switches the list to
+// the object strategy, which it keeps from then on. Unboxed elements are read back as Number
+// values, so reading or iterating over them does not allocate.
+class ListStorage
+{
+  public:
+	enum class Strategy {
+		Int,
+		Float,
+		Object,
+	};
+
+  private:
+	std::variant<std::vector<int64_t>, std::vector<double>, std::vector<Value>> m_storage;
+
+  public:
+	ListStorage() = default;
+	// picks the narrowest strategy that can represent every element
+	explicit ListStorage(std::vector<Value> elements);
+
+	// the value of an exact int that fits in an int64_t, or of an exact float
+	static std::optional<int64_t> unbox_int(const Value &value);
+	static std::optional<double> unbox_float(const Value &value);
+
+	Strategy strategy() const;
+
+	size_t size() const;
+	bool empty() const { return size() == 0; }
+
+	Value operator[](size_t index) const;
+	void set(size_t index, const Value &value);
+
+	void push_back(const Value &value);
+	void insert(size_t index, const Value &value);
+	// appends the elements of `other`, without boxing them if both use the same strategy
+	void extend(const ListStorage &other);
+
+	void erase(size_t index) { erase(index, index + 1); }
+	void erase(size_t first, size_t last);
+	void pop_back() { erase(size() - 1); }
+	void clear();
+	void reserve(size_t size);
+
+	// a copy of the elements as Values, the storage itself is left unchanged
+	std::vector<Value> values() const;
+
+	// the underlying elements if they use that strategy, otherwise nullptr
+	std::vector<Value> *as_objects() { return std::get_if<std::vector<Value>>(&m_storage); }
+	const std::vector<Value> *as_objects() const
+	{
+		return std::get_if<std::vector<Value>>(&m_storage);
+	}
+	std::vector<int64_t> *as_ints() { return std::get_if<std::vector<int64_t>>(&m_storage); }
+	const std::vector<int64_t> *as_ints() const
+	{
+		return std::get_if<std::vector<int64_t>>(&m_storage);
+	}
+	std::vector<double> *as_floats() { return std::get_if<std::vector<double>>(&m_storage); }
+	const std::vector<double> *as_floats() const
+	{
+		return std::get_if<std::vector<double>>(&m_storage);
+	}
+
+	// switches to the object strategy and returns the elements
+	std::vector<Value> &generalize();
+
+  private:
+	// makes sure that the strategy can represent `value`, switching strategy if needed
+	void prepare_for(const Value &value);
+};
+
+}// namespace py
@@ -0,0 +1,29 @@
+#include "MethodCache.hpp"
+
+#include <limits>
+
+namespace py {
+
+MethodCache &MethodCache::the()
+{
+	static MethodCache cache;
+	return cache;
+}
+
+void MethodCache::erase_if(const std::function<bool(const PyString &)> &predicate)
+{
+	for (auto &entry : m_entries) {
+		if (entry.name && predicate(*entry.name)) { entry = Entry{}; }
+	}
+}
+
+void MethodCache::clear() { m_entries.fill(Entry{}); }
+
+uint32_t MethodCache::next_version_tag()
+{
+	static uint32_t next_tag = 1;
+	if (next_tag == std::numeric_limits<uint32_t>::max()) { return 0; }
+	return next_tag++;
+}
+
+}// namespace py
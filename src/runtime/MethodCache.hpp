@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+namespace py {
+
+class PyObject;
+class PyString;
+
+// A global, direct-mapped cache of PyType::lookup results, keyed by the version tag of the type
+// and the interned attribute name, so that a lookup is a pointer comparison. A type gets a version
+// tag the first time it is looked up, and loses it (together with all of its subclasses) whenever
+// its dictionary is modified, so stale entries can never match again. Absent attributes are cached
+// as nullptr.
+// The names are not kept alive by the cache: the garbage collector drops the entries of the
+// interned strings it frees, before their address can be reused.
+class MethodCache
+{
+  public:
+	static constexpr size_t kSizeExponent = 12;
+	static constexpr size_t kSize = size_t{ 1 } << kSizeExponent;
+
+  private:
+	struct Entry
+	{
+		uint32_t version_tag{ 0 };
+		const PyString *name{ nullptr };
+		PyObject *value{ nullptr };
+	};
+
+	std::array<Entry, kSize> m_entries;
+	uint64_t m_hits{ 0 };
+	uint64_t m_misses{ 0 };
+
+	MethodCache() = default;
+
+	static size_t index(uint32_t version_tag, const PyString *name)
+	{
+		// objects are pointer aligned, so the low bits of their address are always zero
+		return (static_cast<size_t>(version_tag) * 2654435761u
+				   ^ (reinterpret_cast<uintptr_t>(name) >> 3))
+			   & (kSize - 1);
+	}
+
+  public:
+	static MethodCache &the();
+
+	// Returns the cached result for the interned `name` in the type with `version_tag`, which is
+	// nullptr if the type has no such attribute, or std::nullopt on a cache miss
+	std::optional<PyObject *> lookup(uint32_t version_tag, const PyString *name)
+	{
+		const auto &entry = m_entries[index(version_tag, name)];
+		if (entry.version_tag == version_tag && entry.name == name) {
+			m_hits++;
+			return entry.value;
+		}
+		m_misses++;
+		return std::nullopt;
+	}
+
+	void store(uint32_t version_tag, const PyString *name, PyObject *value)
+	{
+		m_entries[index(version_tag, name)] = Entry{ version_tag, name, value };
+	}
+
+	// Drops the entries whose name satisfies `predicate`
+	void erase_if(const std::function<bool(const PyString &)> &predicate);
+
+	void clear();
+
+	// Returns a new version tag, or 0 once all the tags have been handed out
+	static uint32_t next_version_tag();
+
+	uint64_t hits() const { return m_hits; }
+	uint64_t misses() const { return m_misses; }
+};
+
+}// namespace py
@@ -26,8 +26,8 @@ std::string PyBool::to_string() const { return value() ? "True" : "False"; }
 
 bool PyBool::value() const
 {
-	ASSERT(std::holds_alternative<BigIntType>(m_value.value));
-	return static_cast<bool>(std::get<BigIntType>(m_value.value));
+	ASSERT(std::holds_alternative<int64_t>(m_value.value));
+	return static_cast<bool>(std::get<int64_t>(m_value.value));
 }
 
 PyResult<PyObject *> PyBool::__new__(const PyType *type, PyTuple *args, PyDict *kwargs)
@@ -50,7 +50,7 @@ PyResult<PyObject *> PyBool::__repr__() const { return PyString::create(to_strin
 
 PyResult<bool> PyBool::true_()
 {
-	ASSERT(std::holds_alternative<BigIntType>(m_value.value));
+	ASSERT(std::holds_alternative<int64_t>(m_value.value));
 	return Ok(value());
 }
 
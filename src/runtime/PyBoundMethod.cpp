@@ -39,16 +39,18 @@ std::string PyBoundMethod::to_string() const
 
 PyResult<PyObject *> PyBoundMethod::__repr__() const { return PyString::create(to_string()); }
 
+PyResult<PyObject *> PyBoundMethod::vectorcall(std::span<const Value> args,
+	std::span<const std::string_view> kwnames)
+{
+	return call_with_self(m_method, m_self, args, kwnames);
+}
+
 PyResult<PyObject *> PyBoundMethod::__call__(PyTuple *args, PyDict *kwargs)
 {
-	// first create new args tuple -> (self, *args)
-	std::vector<Value> new_args_vector;
-	new_args_vector.reserve(args->size() + 1);
-	new_args_vector.push_back(m_self);
-	for (const auto &arg : args->elements()) { new_args_vector.push_back(arg); }
-	auto args_ = PyTuple::create(new_args_vector);
-	if (args_.is_err()) { return args_; }
-	return m_method->call(args_.unwrap(), kwargs);
+	return call_with_vector_args(
+		args, kwargs, [this](std::span<const Value> args, std::span<const std::string_view> kwnames) {
+			return vectorcall(args, kwnames);
+		});
 }
 
 PyType *PyBoundMethod::static_type() const { return types::bound_method(); }
@@ -23,6 +23,8 @@ class PyBoundMethod : public PyBaseObject
 	std::string to_string() const override;
 
 	PyResult<PyObject *> __repr__() const;
+	PyResult<PyObject *> vectorcall(std::span<const Value> args,
+		std::span<const std::string_view> kwnames);
 	PyResult<PyObject *> __call__(PyTuple *args, PyDict *kwargs);
 
 	void visit_graph(Visitor &visitor) override;
@@ -2,6 +2,7 @@
 #include "MemoryError.hpp"
 #include "PyBytes.hpp"
 #include "StopIteration.hpp"
+#include "StringKernels.hpp"
 #include "runtime/IndexError.hpp"
 #include "runtime/PyBool.hpp"
 #include "runtime/PyDict.hpp"
@@ -222,11 +223,13 @@ PyResult<PyObject *> PyByteArray::find(PyTuple *args, PyDict *kwargs) const
 		return Ok(pos);
 	};
 
-	auto find = [value = static_cast<std::byte>(pattern_int.as_size_t())](
+	auto find = [value = static_cast<char>(pattern_int.as_size_t())](
 					std::span<const std::byte> bytes, size_t start) -> int64_t {
-		auto it = std::ranges::find(bytes, value);
-		if (it == bytes.end()) { return -1; }
-		return start + std::distance(bytes.begin(), it);
+		const auto pos = string_kernels::find(
+			std::string_view{ reinterpret_cast<const char *>(bytes.data()), bytes.size() },
+			std::string_view{ &value, 1 });
+		if (pos == std::string_view::npos) { return -1; }
+		return start + pos;
 	};
 
 	if (!start && !end) {
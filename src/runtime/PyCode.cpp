@@ -3,11 +3,13 @@
 #include "PyAsyncGenerator.hpp"
 #include "PyCell.hpp"
 #include "PyCoroutine.hpp"
+#include "PyDict.hpp"
 #include "PyFrame.hpp"
 #include "PyFunction.hpp"
 #include "PyGenerator.hpp"
-#include "PyList.hpp"
+#include "PyString.hpp"
 #include "PyTuple.hpp"
+#include "RecursionError.hpp"
 #include "executable/Function.hpp"
 #include "executable/bytecode/Bytecode.hpp"
 #include "executable/bytecode/instructions/Instructions.hpp"
@@ -17,8 +19,81 @@
 #include "types/api.hpp"
 #include "types/builtin.hpp"
 
+#include <bit>
+
 namespace py {
 
+KeywordTable::KeywordTable(std::span<const std::string> argument_names, size_t first_keyword_index)
+{
+	ASSERT(first_keyword_index <= argument_names.size());
+	const size_t keyword_count = argument_names.size() - first_keyword_index;
+	if (keyword_count == 0) { return; }
+
+	std::vector<size_t> hashes;
+	hashes.reserve(keyword_count);
+	for (size_t i = first_keyword_index; i < argument_names.size(); ++i) {
+		hashes.push_back(std::hash<std::string_view>{}(argument_names[i]));
+	}
+
+	// grow the table until every name lands in its own bucket. Past the size limit just keep the
+	// smallest table and resolve the collisions with linear probing, lookups remain correct.
+	const size_t min_size = std::bit_ceil(keyword_count + 1);
+	const size_t max_size = std::max(min_size, std::bit_ceil(keyword_count * kMaxSizeFactor));
+	size_t size = min_size;
+	for (; size <= max_size; size <<= 1) {
+		std::vector<bool> used(size, false);
+		const bool is_perfect = std::all_of(hashes.begin(), hashes.end(), [&](size_t hash) {
+			const size_t bucket = hash & (size - 1);
+			if (used[bucket]) { return false; }
+			used[bucket] = true;
+			return true;
+		});
+		if (is_perfect) { break; }
+	}
+	if (size > max_size) { size = min_size; }
+
+	m_mask = size - 1;
+	m_buckets.resize(size);
+	for (size_t i = 0; i < keyword_count; ++i) {
+		size_t bucket = hashes[i] & m_mask;
+		while (m_buckets[bucket].index != kEmpty) { bucket = (bucket + 1) & m_mask; }
+		m_buckets[bucket] = Bucket{ hashes[i], static_cast<uint32_t>(first_keyword_index + i) };
+	}
+}
+
+std::optional<size_t> KeywordTable::find(std::string_view name,
+	std::span<const std::string> argument_names) const
+{
+	if (m_buckets.empty()) { return {}; }
+	const size_t hash = std::hash<std::string_view>{}(name);
+	for (size_t bucket = hash & m_mask;; bucket = (bucket + 1) & m_mask) {
+		const auto &entry = m_buckets[bucket];
+		if (entry.index == kEmpty) { return {}; }
+		if (entry.hash == hash && argument_names[entry.index] == name) { return entry.index; }
+	}
+}
+
+namespace {
+	BaseException *missing_arguments_error(std::string_view function_name,
+		std::string_view kind,
+		const std::vector<std::string_view> &names)
+	{
+		ASSERT(!names.empty());
+		std::string names_str;
+		for (size_t i = 0; i < names.size(); ++i) {
+			if (i > 0) { names_str += names.size() == 2 ? " " : ", "; }
+			if (i > 0 && i == names.size() - 1) { names_str += "and "; }
+			names_str += fmt::format("'{}'", names[i]);
+		}
+		return type_error("{}() missing {} required {} argument{}: {}",
+			function_name,
+			names.size(),
+			kind,
+			names.size() == 1 ? "" : "s",
+			names_str);
+	}
+}// namespace
+
 template<> PyCode *as(PyObject *obj)
 {
 	if (obj->type() == types::code()) { return static_cast<PyCode *>(obj); }
@@ -60,7 +135,36 @@ PyCode::PyCode(std::unique_ptr<Function> &&function,
 	  m_freevars(std::move(freevars)), m_positional_only_arg_count(positional_arg_count),
 	  m_kwonly_arg_count(kwonly_arg_count), m_name(std::move(name)), m_names(std::move(names)),
 	  m_nlocals(nlocals), m_stack_size(stack_size), m_varnames(std::move(varnames))
-{}
+{
+	const size_t total_arguments_count = m_arg_count + m_kwonly_arg_count
+										 + m_flags.is_set(CodeFlags::Flag::VARARGS)
+										 + m_flags.is_set(CodeFlags::Flag::VARKEYWORDS);
+	ASSERT(total_arguments_count <= m_varnames.size());
+
+	// arguments captured by an inner scope live in a cell, all the other arguments are laid out
+	// in order at the start of the stack locals. The name of an argument is the name of its cell
+	// or of its stack local, varnames doesn't always list the arguments in the same place.
+	m_argument_slots.reserve(total_arguments_count);
+	m_argument_names.reserve(total_arguments_count);
+	for (size_t arg_idx = 0, stack_local_index = 0; arg_idx < total_arguments_count; ++arg_idx) {
+		if (auto it = std::find(m_cell2arg.begin(), m_cell2arg.end(), arg_idx);
+			it != m_cell2arg.end()) {
+			const auto free_var_idx = std::distance(m_cell2arg.begin(), it);
+			ASSERT(static_cast<size_t>(free_var_idx) < m_cellvars.size());
+			m_argument_slots.push_back(ArgumentSlot{ true, static_cast<size_t>(free_var_idx) });
+			m_argument_names.push_back(m_cellvars[free_var_idx]);
+		} else {
+			ASSERT(stack_local_index < m_varnames.size());
+			m_argument_names.push_back(m_varnames[stack_local_index]);
+			m_argument_slots.push_back(ArgumentSlot{ false, stack_local_index++ });
+		}
+	}
+
+	// positional only arguments cannot be passed by keyword
+	ASSERT(m_positional_only_arg_count <= m_arg_count);
+	m_keyword_table = KeywordTable{ argument_names().subspan(0, m_arg_count + m_kwonly_arg_count),
+		m_positional_only_arg_count };
+}
 
 PyResult<PyCode *> PyCode::create(std::unique_ptr<Function> &&function,
 	std::vector<size_t> cell2arg,
@@ -98,6 +202,12 @@ PyResult<PyCode *> PyCode::create(std::unique_ptr<Function> &&function,
 		std::move(varnames));
 	if (!result) { return Err(memory_error(sizeof(PyCode))); }
 	result->m_program = std::move(program);
+	result->m_interned_names.reserve(result->m_names.size());
+	for (const auto &name : result->m_names) {
+		auto interned_name = PyString::intern(name);
+		if (interned_name.is_err()) { return Err(interned_name.unwrap_err()); }
+		result->m_interned_names.push_back(interned_name.unwrap());
+	}
 	return Ok(result);
 }
 
@@ -144,11 +254,19 @@ const PyTuple *PyCode::consts() const { return m_consts; }
 
 const std::vector<std::string> &PyCode::names() const { return m_names; }
 
+PyString *PyCode::interned_name(size_t index) const
+{
+	ASSERT(index < m_interned_names.size())
+	return m_interned_names[index];
+}
+
 void PyCode::visit_graph(Visitor &visitor)
 {
 	PyObject::visit_graph(visitor);
 	if (m_consts) { visitor.visit(*m_consts); }
 	if (m_lnotab) { visitor.visit(*m_lnotab); }
+	// the intern table is weak, the code object keeps its names alive
+	for (auto *name : m_interned_names) { visitor.visit(*name); }
 	m_program->visit_functions(visitor);
 }
 
@@ -164,14 +282,19 @@ PyObject *PyCode::make_function(const std::string &function_name,
 
 PyResult<PyObject *> PyCode::eval(PyObject *globals,
 	PyObject *locals,
-	PyTuple *args,
-	PyDict *kwargs,
+	std::span<const Value> args,
+	std::span<const std::string_view> kwnames,
 	const std::vector<Value> &defaults,
 	const std::vector<Value> &kw_defaults,
-	const std::vector<Value> &closure,
+	std::span<const Value> closure,
 	PyString *name) const
 {
-	auto *function_frame = PyFrame::create(VirtualMachine::the().interpreter().execution_frame(),
+	auto &vm = VirtualMachine::the();
+	if (vm.stack().size() >= vm.recursion_limit()) [[unlikely]] {
+		return Err(recursion_error("maximum recursion depth exceeded"));
+	}
+
+	auto *function_frame = PyFrame::create(vm.interpreter().execution_frame(),
 		register_count(),
 		cellvars_count() + freevars_count(),
 		const_cast<PyCode *>(this),
@@ -180,8 +303,13 @@ PyResult<PyObject *> PyCode::eval(PyObject *globals,
 		consts(),
 		names(),
 		nullptr);
+	// generator and coroutine frames are suspended and resumed in place, so they cannot borrow
+	// their registers and locals from the VM stack
+	const bool is_resumable =
+		m_flags.is_set(CodeFlags::Flag::GENERATOR) || m_flags.is_set(CodeFlags::Flag::COROUTINE);
 	[[maybe_unused]] auto scoped_stack =
-		VirtualMachine::the().interpreter().setup_call_stack(m_function, function_frame);
+		is_resumable ? vm.interpreter().setup_resumable_call_stack(m_function, function_frame)
+					 : vm.interpreter().setup_call_stack(m_function, function_frame);
 
 	for (size_t i = 0; i < cellvars_count(); ++i) {
 		auto cell = PyCell::create();
@@ -189,214 +317,94 @@ PyResult<PyObject *> PyCode::eval(PyObject *globals,
 		function_frame->freevars()[i] = cell.unwrap();
 	}
 
-	const size_t total_named_arguments_count = m_arg_count + m_kwonly_arg_count;
-	const size_t total_arguments_count = total_named_arguments_count
-										 + m_flags.is_set(CodeFlags::Flag::VARARGS)
-										 + m_flags.is_set(CodeFlags::Flag::VARKEYWORDS);
-	const size_t arg_cells_count = std::count_if(m_cell2arg.begin(),
-		m_cell2arg.end(),
-		[total_arguments_count](size_t arg_idx) { return total_arguments_count != arg_idx; });
-
-	ASSERT(total_arguments_count >= arg_cells_count);
-	for (size_t i = 0; i < total_arguments_count - arg_cells_count; ++i) {
-		VirtualMachine::the().stack_local(i) = nullptr;
-	}
-	// keeps track of the offset of the arg given that the Cell objects are not put on the stack
-	std::vector<size_t> arg_stack_offset(total_arguments_count, 0);
-	for (size_t i = 0; i < total_arguments_count; ++i) {
-		const bool arg_is_cell =
-			std::find(m_cell2arg.begin(), m_cell2arg.end(), i) == m_cell2arg.end();
-		if (arg_is_cell) {
-			if (i > 0) { arg_stack_offset[i] = arg_stack_offset[i - 1]; }
+	auto stack_locals = vm.stack_locals();
+	const auto cells = function_frame->freevars();
+	const auto bind = [&](size_t arg_idx, const Value &value) {
+		const auto &slot = m_argument_slots[arg_idx];
+		if (slot.is_cell) {
+			ASSERT(cells[slot.index]);
+			cells[slot.index]->set_cell(value);
 		} else {
-			if (i > 0) {
-				arg_stack_offset[i] = arg_stack_offset[i - 1] + 1;
-			} else {
-				arg_stack_offset[i]++;
-			}
+			stack_locals[slot.index] = value;
 		}
-	}
+	};
+	const auto is_bound = [&](size_t arg_idx) {
+		const auto &slot = m_argument_slots[arg_idx];
+		const auto &value = slot.is_cell ? cells[slot.index]->content() : stack_locals[slot.index];
+		return !std::holds_alternative<PyObject *>(value) || std::get<PyObject *>(value);
+	};
 
-	ASSERT(m_arg_count <= m_varnames.size());
-	std::vector<std::string> positional_args{ m_varnames.begin(),
-		m_varnames.begin() + m_arg_count };
-
-	ASSERT(total_named_arguments_count <= m_varnames.size());
-	std::vector<std::string> keyword_only_args{ m_varnames.begin() + m_arg_count,
-		m_varnames.begin() + total_named_arguments_count };
-
-	size_t args_count = 0;
-	size_t kwargs_count = 0;
-
-	if (args) {
-		size_t max_args = std::min(args->size(), m_arg_count);
-		for (size_t idx = 0, stack_local_index = 0; idx < max_args; ++idx) {
-			const auto &obj = args->elements()[idx];
-			if (auto it = std::find(m_cell2arg.begin(), m_cell2arg.end(), idx);
-				it != m_cell2arg.end()) {
-				const auto free_var_idx = std::distance(m_cell2arg.begin(), it);
-				ASSERT(function_frame->freevars()[free_var_idx]);
-				function_frame->freevars()[free_var_idx]->set_cell(obj);
-			} else {
-				VirtualMachine::the().stack_local(stack_local_index++) = obj;
-			}
-		}
-		args_count = max_args;
-	}
-	if (kwargs) {
-		const auto &argnames = m_varnames;
-		for (const auto &[key, value] : kwargs->map()) {
-			ASSERT(std::holds_alternative<String>(key))
-			auto key_str = std::get<String>(key);
-			auto arg_iter = std::find(m_varnames.begin(), m_varnames.end(), key_str.s);
-			if (arg_iter == m_varnames.end()) {
-				if (m_flags.is_set(CodeFlags::Flag::VARKEYWORDS)) {
-					continue;
-				} else {
-					return Err(type_error(
-						"{}() got an unexpected keyword argument '{}'", name->value(), key_str.s));
-				}
-			}
-			auto &arg =
-				VirtualMachine::the().stack_local(std::distance(argnames.begin(), arg_iter));
-
-			if (std::holds_alternative<PyObject *>(arg)) {
-				if (std::get<PyObject *>(arg)) {
-					return Err(type_error(
-						"{}() got multiple values for argument '{}'", name->value(), key_str.s));
-				}
-			}
-			if (auto it = std::find(m_cell2arg.begin(), m_cell2arg.end(), kwargs_count);
-				it != m_cell2arg.end()) {
-				const auto free_var_idx = std::distance(m_cell2arg.begin(), it);
-				ASSERT(function_frame->freevars()[free_var_idx]);
-				function_frame->freevars()[free_var_idx]->set_cell(value);
-			}
-			arg = value;
-			kwargs_count++;
-		}
-	}
+	const size_t total_named_arguments_count = m_arg_count + m_kwonly_arg_count;
+	ASSERT(kwnames.size() <= args.size());
+	const size_t positional_args_count = args.size() - kwnames.size();
+	const size_t args_count = std::min(positional_args_count, m_arg_count);
 
-	if (m_arg_count > 0 && !defaults.empty()) {
-		auto default_iter = defaults.rbegin();
-		int64_t i = m_arg_count - 1;
-		while (default_iter != defaults.rend()) {
-			ASSERT(i >= 0);
-			if (auto it = std::find(m_cell2arg.begin(), m_cell2arg.end(), static_cast<size_t>(i));
-				it != m_cell2arg.end()) {
-				const auto free_var_idx = std::distance(m_cell2arg.begin(), it);
-				ASSERT(function_frame->freevars()[free_var_idx]);
-				auto *cell = function_frame->freevars()[free_var_idx];
-				if (std::holds_alternative<PyObject *>(cell->content())
-					&& !std::get<PyObject *>(cell->content())) {
-					cell->set_cell(*default_iter);
-				}
-			} else {
-				const size_t index = i - arg_stack_offset[i];
-				const auto &arg = VirtualMachine::the().stack_local(index);
-				if (std::holds_alternative<PyObject *>(arg) && !std::get<PyObject *>(arg)) {
-					VirtualMachine::the().stack_local(index) = *default_iter;
-				}
-			}
-			default_iter = std::next(default_iter);
-			i--;
-		}
-	}
-	if (m_kwonly_arg_count + m_arg_count > 0 && !kw_defaults.empty()) {
-		auto kw_default_iter = kw_defaults.rbegin();
-		int64_t i = m_kwonly_arg_count + m_arg_count - 1;
-		while (kw_default_iter != kw_defaults.rend()) {
-			ASSERT(i >= 0);
-			if (auto it = std::find(m_cell2arg.begin(), m_cell2arg.end(), static_cast<size_t>(i));
-				it != m_cell2arg.end()) {
-				const auto free_var_idx = std::distance(m_cell2arg.begin(), it);
-				ASSERT(function_frame->freevars()[free_var_idx]);
-				auto *cell = function_frame->freevars()[free_var_idx];
-				if (std::holds_alternative<PyObject *>(cell->content())
-					&& !std::get<PyObject *>(cell->content())) {
-					cell->set_cell(*kw_default_iter);
-				}
-			} else {
-				const size_t index = i - arg_stack_offset[i];
-				const auto &arg = VirtualMachine::the().stack_local(index);
-				if (std::holds_alternative<PyObject *>(arg) && !std::get<PyObject *>(arg)) {
-					VirtualMachine::the().stack_local(index) = *kw_default_iter;
-				}
-			}
-			kw_default_iter = std::next(kw_default_iter);
-			i--;
-		}
-	}
+	for (size_t idx = 0; idx < args_count; ++idx) { bind(idx, args[idx]); }
 
 	if (m_flags.is_set(CodeFlags::Flag::VARARGS)) {
-		auto remaining_args_list_ = PyList::create();
-		if (remaining_args_list_.is_err()) { return remaining_args_list_; }
-		auto *remaining_args_list = remaining_args_list_.unwrap();
-		if (args) {
-			for (size_t idx = args_count; idx < args->size(); ++idx) {
-				remaining_args_list->elements().push_back(args->elements()[idx]);
-			}
-		}
-		auto args_ = PyTuple::create(remaining_args_list->elements());
+		// *args is the only case where the positional arguments have to be packed into a tuple
+		auto args_ = PyTuple::create(std::vector<Value>{
+			args.begin() + args_count, args.begin() + positional_args_count });
 		if (args_.is_err()) { return args_; }
-		if (auto it = std::find(m_cell2arg.begin(), m_cell2arg.end(), total_named_arguments_count);
-			it != m_cell2arg.end()) {
-			const auto free_var_idx = std::distance(m_cell2arg.begin(), it);
-			ASSERT(function_frame->freevars()[free_var_idx]);
-			auto *cell = function_frame->freevars()[free_var_idx];
-			if (std::holds_alternative<PyObject *>(cell->content())
-				&& !std::get<PyObject *>(cell->content())) {
-				cell->set_cell(args_.unwrap());
-			}
-		} else {
-			const size_t local_index = total_named_arguments_count
-									   + m_flags.is_set(CodeFlags::Flag::VARARGS) - arg_cells_count
-									   - 1;
-			VirtualMachine::the().stack_local(local_index) = args_.unwrap();
-		}
-	} else if (args_count < args->size()) {
-		return Err(type_error("{}() takes {} positional arguments but {} given",
+		bind(total_named_arguments_count, args_.unwrap());
+	} else if (args_count < positional_args_count) {
+		return Err(type_error("{}() takes {} positional arguments but {} were given",
 			name->value(),
-			args_count,
-			args->size()));
+			m_arg_count,
+			positional_args_count));
 	}
 
+	PyDict *remaining_kwargs = nullptr;
 	if (m_flags.is_set(CodeFlags::Flag::VARKEYWORDS)) {
 		auto remaining_kwargs_ = PyDict::create();
 		if (remaining_kwargs_.is_err()) { return remaining_kwargs_; }
-		auto *remaining_kwargs = remaining_kwargs_.unwrap();
-		if (kwargs) {
-			const auto &argnames = m_varnames;
-			for (const auto &[key, value] : kwargs->map()) {
-				auto key_str = std::get<String>(key);
-				auto arg_iter = std::find(argnames.begin(), argnames.end(), key_str.s);
-				if (arg_iter == argnames.end()) {
-					remaining_kwargs->insert(key, value);
-					kwargs_count++;
-					continue;
-				}
+		remaining_kwargs = remaining_kwargs_.unwrap();
+		bind(total_named_arguments_count + m_flags.is_set(CodeFlags::Flag::VARARGS),
+			remaining_kwargs);
+	}
+
+	for (size_t kw_idx = 0; kw_idx < kwnames.size(); ++kw_idx) {
+		const auto &key = kwnames[kw_idx];
+		const auto &value = args[positional_args_count + kw_idx];
+		if (auto arg_idx = m_keyword_table.find(key, argument_names()); arg_idx.has_value()) {
+			if (is_bound(*arg_idx)) {
+				return Err(
+					type_error("{}() got multiple values for argument '{}'", name->value(), key));
 			}
+			bind(*arg_idx, value);
+		} else if (remaining_kwargs) {
+			remaining_kwargs->insert(String{ std::string{ key } }, value);
+		} else {
+			return Err(
+				type_error("{}() got an unexpected keyword argument '{}'", name->value(), key));
 		}
-		const size_t kwargs_index = [&]() {
-			if (m_flags.is_set(CodeFlags::Flag::VARARGS)) {
-				return total_named_arguments_count + 1;
-			} else {
-				return total_named_arguments_count;
-			}
-		}();
-		if (auto it = std::find(m_cell2arg.begin(), m_cell2arg.end(), kwargs_index);
-			it != m_cell2arg.end()) {
-			const auto free_var_idx = std::distance(m_cell2arg.begin(), it);
-			ASSERT(function_frame->freevars()[free_var_idx]);
-			auto *cell = function_frame->freevars()[free_var_idx];
-			if (std::holds_alternative<PyObject *>(cell->content())
-				&& !std::get<PyObject *>(cell->content())) {
-				cell->set_cell(remaining_kwargs);
+	}
+
+	// defaults fill the trailing positional arguments and kw_defaults the trailing keyword only
+	// arguments that were not passed by the caller
+	ASSERT(defaults.size() <= m_arg_count);
+	for (size_t idx = 0, arg_idx = m_arg_count - defaults.size(); idx < defaults.size();
+		 ++idx, ++arg_idx) {
+		if (!is_bound(arg_idx)) { bind(arg_idx, defaults[idx]); }
+	}
+	ASSERT(kw_defaults.size() <= total_named_arguments_count);
+	for (size_t idx = 0, arg_idx = total_named_arguments_count - kw_defaults.size();
+		 idx < kw_defaults.size();
+		 ++idx, ++arg_idx) {
+		if (!is_bound(arg_idx)) { bind(arg_idx, kw_defaults[idx]); }
+	}
+
+	for (size_t arg_idx = 0; arg_idx < total_named_arguments_count; ++arg_idx) {
+		if (!is_bound(arg_idx)) {
+			// report all the missing arguments of the same kind at once
+			const bool is_positional = arg_idx < m_arg_count;
+			const size_t end = is_positional ? m_arg_count : total_named_arguments_count;
+			std::vector<std::string_view> missing;
+			for (; arg_idx < end; ++arg_idx) {
+				if (!is_bound(arg_idx)) { missing.push_back(argument_names()[arg_idx]); }
 			}
-		} else {
-			const size_t local_index =
-				kwargs_index + m_flags.is_set(CodeFlags::Flag::VARKEYWORDS) - arg_cells_count - 1;
-			VirtualMachine::the().stack_local(local_index) = remaining_kwargs;
+			return Err(missing_arguments_error(
+				name->value(), is_positional ? "positional" : "keyword-only", missing));
 		}
 	}
 
@@ -434,7 +442,9 @@ PyResult<PyObject *> PyCode::eval(PyObject *globals,
 				return Ok(generator);
 			});
 	} else {
-		return VirtualMachine::the().interpreter().call(m_function, function_frame);
+		auto result = VirtualMachine::the().interpreter().call(m_function, function_frame);
+		VirtualMachine::the().interpreter().release_frame(function_frame);
+		return result;
 	}
 }
 
@@ -1,9 +1,38 @@
 #include "PyObject.hpp"
 #include "executable/Program.hpp"
+
+#include <optional>
 #include <span>
 
 namespace py {
 
+// Maps the names of the parameters that can be passed as keyword arguments to their argument
+// index. The table is grown until every name hashes to its own bucket, so a lookup is usually a
+// single probe and one string comparison.
+class KeywordTable
+{
+	static constexpr uint32_t kEmpty = std::numeric_limits<uint32_t>::max();
+	// upper bound on the table size, as a multiple of the number of names, when searching for a
+	// collision free layout
+	static constexpr size_t kMaxSizeFactor = 8;
+
+	struct Bucket
+	{
+		size_t hash{ 0 };
+		uint32_t index{ kEmpty };
+	};
+
+	std::vector<Bucket> m_buckets;
+	size_t m_mask{ 0 };
+
+  public:
+	KeywordTable() = default;
+	KeywordTable(std::span<const std::string> argument_names, size_t first_keyword_index);
+
+	std::optional<size_t> find(std::string_view name,
+		std::span<const std::string> argument_names) const;
+};
+
 class PyCode : public PyBaseObject
 {
   public:
@@ -39,6 +68,8 @@ class PyCode : public PyBaseObject
 	const std::string m_name;
 	// tuple of names other than arguments and function locals
 	const std::vector<std::string> m_names;
+	// m_names as interned strings, so that attribute and global lookups don't allocate
+	std::vector<PyString *> m_interned_names;
 	// number of local variables
 	const size_t m_nlocals;
 	// virtual machine stack space required
@@ -48,6 +79,20 @@ class PyCode : public PyBaseObject
 
 	std::shared_ptr<Program> m_program;
 
+	// where each argument is stored in the frame
+	struct ArgumentSlot
+	{
+		// the argument is captured by an inner scope and is stored in a cell
+		bool is_cell;
+		// index of the cell in the frame free variables, or index of the stack local
+		size_t index;
+	};
+
+	// argument binding plan, computed once from the signature
+	std::vector<ArgumentSlot> m_argument_slots;
+	std::vector<std::string> m_argument_names;
+	KeywordTable m_keyword_table;
+
 	PyCode(PyType *);
 
 	PyCode(std::unique_ptr<Function> &&function,
@@ -91,6 +136,8 @@ class PyCode : public PyBaseObject
 
 	PyObject *call(PyTuple *args, PyDict *kwargs);
 	const std::vector<std::string> &varnames() const { return m_varnames; }
+	// names of the arguments, including the * and ** arguments, in argument index order
+	std::span<const std::string> argument_names() const { return m_argument_names; }
 
 	std::string to_string() const override;
 
@@ -107,6 +154,7 @@ class PyCode : public PyBaseObject
 
 	const std::string &name() const { return m_name; }
 	const std::vector<std::string> &names() const;
+	PyString *interned_name(size_t index) const;
 
 	const std::unique_ptr<Function> &function() const { return m_function; }
 
@@ -121,11 +169,11 @@ class PyCode : public PyBaseObject
 
 	PyResult<PyObject *> eval(PyObject *globals,
 		PyObject *locals,
-		PyTuple *args,
-		PyDict *kwargs,
+		std::span<const Value> args,
+		std::span<const std::string_view> kwnames,
 		const std::vector<Value> &defaults,
 		const std::vector<Value> &kw_defaults,
-		const std::vector<Value> &closure,
+		std::span<const Value> closure,
 		PyString *name) const;
 
 	PyObject *make_function(const std::string &function_name,
@@ -5,6 +5,7 @@
 #include "PyNone.hpp"
 #include "PyString.hpp"
 #include "PyTuple.hpp"
+#include "RuntimeError.hpp"
 #include "StopIteration.hpp"
 #include "ValueError.hpp"
 #include "runtime/PyObject.hpp"
@@ -787,7 +788,9 @@ PyDictItemsIterator::PyDictItemsIterator(PyType *type) : PyBaseObject(type) {}
 
 PyDictItemsIterator::PyDictItemsIterator(const PyDictItems &pydict_items)
 	: PyBaseObject(types::BuiltinTypes::the().dict_items_iterator()), m_pydictitems(pydict_items),
-	  m_current_iterator(m_pydictitems->get().m_pydict->get().map().begin())
+	  m_current_iterator(m_pydictitems->get().m_pydict->get().map().begin()),
+	  m_dict_size(m_pydictitems->get().m_pydict->get().map().size()),
+	  m_dict_version(m_pydictitems->get().m_pydict->get().map().version())
 {}
 
 PyDictItemsIterator::PyDictItemsIterator(const PyDictItems &pydict_items, size_t position)
@@ -834,14 +837,25 @@ std::string PyDictItemsIterator::to_string() const
 
 PyResult<PyObject *> PyDictItemsIterator::__repr__() const { return PyString::create(to_string()); }
 
-PyResult<PyObject *> PyDictItemsIterator::__next__()
+PyResult<PyObject *> PyDictItemsIterator::__next__() { return next_from_iternext(iternext()); }
+
+PyResult<std::optional<Value>> PyDictItemsIterator::iternext()
 {
-	if (m_current_iterator != m_pydictitems->get().m_pydict->get().map().end()) {
+	const auto &map = m_pydictitems->get().m_pydict->get().map();
+	if (map.size() != m_dict_size) {
+		return Err(runtime_error("dictionary changed size during iteration"));
+	}
+	if (map.version() != m_dict_version) {
+		return Err(runtime_error("dictionary keys changed during iteration"));
+	}
+	if (m_current_iterator != map.end()) {
 		const auto &[key, value] = *m_current_iterator;
 		m_current_iterator++;
-		return PyTuple::create(key, value);
+		auto item = PyTuple::create(key, value);
+		if (item.is_err()) { return Err(item.unwrap_err()); }
+		return Ok(std::optional<Value>{ item.unwrap() });
 	}
-	return Err(stop_iteration());
+	return Ok(std::optional<Value>{});
 }
 
 bool PyDictItemsIterator::operator==(const PyDictItemsIterator &other) const
@@ -888,7 +902,9 @@ PyDictKeyIterator::PyDictKeyIterator(PyType *type) : PyBaseObject(type) {}
 
 PyDictKeyIterator::PyDictKeyIterator(const PyDictKeys &pydict_keys)
 	: PyBaseObject(types::BuiltinTypes::the().dict_key_iterator()), m_pydictkeys(pydict_keys),
-	  m_current_iterator(m_pydictkeys->get().m_pydict->get().map().begin())
+	  m_current_iterator(m_pydictkeys->get().m_pydict->get().map().begin()),
+	  m_dict_size(m_pydictkeys->get().m_pydict->get().map().size()),
+	  m_dict_version(m_pydictkeys->get().m_pydict->get().map().version())
 {}
 
 PyDictKeyIterator::PyDictKeyIterator(const PyDictKeys &pydict_keys, size_t position)
@@ -931,14 +947,23 @@ std::string PyDictKeyIterator::to_string() const
 
 PyResult<PyObject *> PyDictKeyIterator::__repr__() const { return PyString::create(to_string()); }
 
-PyResult<PyObject *> PyDictKeyIterator::__next__()
+PyResult<PyObject *> PyDictKeyIterator::__next__() { return next_from_iternext(iternext()); }
+
+PyResult<std::optional<Value>> PyDictKeyIterator::iternext()
 {
-	if (m_current_iterator != m_pydictkeys->get().m_pydict->get().map().end()) {
+	const auto &map = m_pydictkeys->get().m_pydict->get().map();
+	if (map.size() != m_dict_size) {
+		return Err(runtime_error("dictionary changed size during iteration"));
+	}
+	if (map.version() != m_dict_version) {
+		return Err(runtime_error("dictionary keys changed during iteration"));
+	}
+	if (m_current_iterator != map.end()) {
 		const auto &key = m_current_iterator->first;
 		m_current_iterator++;
-		return PyObject::from(key);
+		return Ok(std::optional<Value>{ key });
 	}
-	return Err(stop_iteration());
+	return Ok(std::optional<Value>{});
 }
 
 bool PyDictKeyIterator::operator==(const PyDictKeyIterator &other) const
@@ -985,7 +1010,9 @@ PyDictValueIterator::PyDictValueIterator(PyType *type) : PyBaseObject(type) {}
 
 PyDictValueIterator::PyDictValueIterator(const PyDictValues &pydict_values)
 	: PyBaseObject(types::BuiltinTypes::the().dict_value_iterator()), m_pydictvalues(pydict_values),
-	  m_current_iterator(m_pydictvalues->get().m_pydict->get().map().begin())
+	  m_current_iterator(m_pydictvalues->get().m_pydict->get().map().begin()),
+	  m_dict_size(m_pydictvalues->get().m_pydict->get().map().size()),
+	  m_dict_version(m_pydictvalues->get().m_pydict->get().map().version())
 {}
 
 PyDictValueIterator::PyDictValueIterator(const PyDictValues &pydict_values, size_t position)
@@ -1013,8 +1040,10 @@ PyResult<PyDictValueIterator *> PyDictValueIterator::create(const PyDictValues &
 void PyDictValueIterator::visit_graph(Visitor &visitor)
 {
 	PyObject::visit_graph(visitor);
-	if (std::holds_alternative<PyObject *>(m_current_iterator->second)) {
-		visitor.visit(*std::get<PyObject *>(m_current_iterator->second));
+	if (m_current_iterator != m_pydictvalues->get().m_pydict->get().map().end()) {
+		if (std::holds_alternative<PyObject *>(m_current_iterator->second)) {
+			visitor.visit(*std::get<PyObject *>(m_current_iterator->second));
+		}
 	}
 
 	visitor.visit(const_cast<PyDictValues &>(m_pydictvalues->get()));
@@ -1027,14 +1056,23 @@ std::string PyDictValueIterator::to_string() const
 
 PyResult<PyObject *> PyDictValueIterator::__repr__() const { return PyString::create(to_string()); }
 
-PyResult<PyObject *> PyDictValueIterator::__next__()
+PyResult<PyObject *> PyDictValueIterator::__next__() { return next_from_iternext(iternext()); }
+
+PyResult<std::optional<Value>> PyDictValueIterator::iternext()
 {
-	if (m_current_iterator != m_pydictvalues->get().m_pydict->get().map().end()) {
+	const auto &map = m_pydictvalues->get().m_pydict->get().map();
+	if (map.size() != m_dict_size) {
+		return Err(runtime_error("dictionary changed size during iteration"));
+	}
+	if (map.version() != m_dict_version) {
+		return Err(runtime_error("dictionary keys changed during iteration"));
+	}
+	if (m_current_iterator != map.end()) {
 		const auto &value = m_current_iterator->second;
 		m_current_iterator++;
-		return PyObject::from(value);
+		return Ok(std::optional<Value>{ value });
 	}
-	return Err(stop_iteration());
+	return Ok(std::optional<Value>{});
 }
 
 bool PyDictValueIterator::operator==(const PyDictValueIterator &other) const
@@ -1,10 +1,9 @@
 #pragma once
 
+#include "CompactDict.hpp"
 #include "PyObject.hpp"
 #include "runtime/Value.hpp"
 
-#include <tsl/ordered_map.h>
-
 #include <variant>
 
 namespace py {
@@ -21,7 +20,7 @@ class PyDictValueIterator;
 class PyDict : public PyBaseObject
 {
   public:
-	using MapType = tsl::ordered_map<Value, Value, ValueHash>;
+	using MapType = CompactDict;
 
   private:
 	friend class ::Heap;
@@ -173,6 +172,10 @@ class PyDictItemsIterator : public PyBaseObject
 
 	const std::optional<std::reference_wrapper<const PyDictItems>> m_pydictitems;
 	PyDict::MapType::const_iterator m_current_iterator;
+	// the size and version of the dict when the iterator was created, the dict must not be
+	// resized or have its keys changed while it is iterated over
+	size_t m_dict_size{ 0 };
+	uint64_t m_dict_version{ 0 };
 
 	PyDictItemsIterator(PyType *);
 
@@ -193,6 +196,7 @@ class PyDictItemsIterator : public PyBaseObject
 
 	PyResult<PyObject *> __repr__() const;
 	PyResult<PyObject *> __next__();
+	PyResult<std::optional<Value>> iternext();
 
 	bool operator==(const PyDictItemsIterator &) const;
 	value_type operator*() const;
@@ -213,6 +217,10 @@ class PyDictKeyIterator : public PyBaseObject
 
 	const std::optional<std::reference_wrapper<const PyDictKeys>> m_pydictkeys;
 	PyDict::MapType::const_iterator m_current_iterator;
+	// the size and version of the dict when the iterator was created, the dict must not be
+	// resized or have its keys changed while it is iterated over
+	size_t m_dict_size{ 0 };
+	uint64_t m_dict_version{ 0 };
 
 	PyDictKeyIterator(PyType *);
 
@@ -233,6 +241,7 @@ class PyDictKeyIterator : public PyBaseObject
 
 	PyResult<PyObject *> __repr__() const;
 	PyResult<PyObject *> __next__();
+	PyResult<std::optional<Value>> iternext();
 
 	bool operator==(const PyDictKeyIterator &) const;
 	value_type operator*() const;
@@ -252,6 +261,10 @@ class PyDictValueIterator : public PyBaseObject
 
 	const std::optional<std::reference_wrapper<const PyDictValues>> m_pydictvalues;
 	PyDict::MapType::const_iterator m_current_iterator;
+	// the size and version of the dict when the iterator was created, the dict must not be
+	// resized or have its keys changed while it is iterated over
+	size_t m_dict_size{ 0 };
+	uint64_t m_dict_version{ 0 };
 
 	PyDictValueIterator(PyType *);
 
@@ -273,6 +286,7 @@ class PyDictValueIterator : public PyBaseObject
 
 	PyResult<PyObject *> __repr__() const;
 	PyResult<PyObject *> __next__();
+	PyResult<std::optional<Value>> iternext();
 
 	bool operator==(const PyDictValueIterator &) const;
 	value_type operator*() const;
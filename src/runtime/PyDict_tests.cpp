@@ -18,4 +18,70 @@ TEST(PyDict, StringLookup)
 	ASSERT_TRUE(foo_.is_ok());
 	auto *foo = foo_.unwrap();
 	ASSERT_TRUE(dict->map().contains(foo));
-}
\ No newline at end of file
+
+	// String keys are stored as the interned str
+	const auto &key = dict->map().begin()->first;
+	ASSERT_TRUE(std::holds_alternative<PyObject *>(key));
+	EXPECT_EQ(std::get<PyObject *>(key), PyString::intern("foo").unwrap());
+
+	// and are still found once the dict holds keys that are not strings
+	dict->insert(Number{ int64_t{ 42 } }, py_none());
+	EXPECT_TRUE(dict->map().contains(String{ "foo" }));
+	EXPECT_TRUE(dict->map().contains(foo));
+	EXPECT_FALSE(dict->map().contains(String{ "bar" }));
+}
+TEST(PyDict, CompactDictKeepsInsertionOrderAcrossRemovalsAndResizes)
+{
+	CompactDict map;
+	// 1000 entries need 2 byte indices, and the removals leave tombstones to compact
+	for (int64_t i = 0; i < 1000; ++i) { map.insert_or_assign(Number{ i }, Number{ i * 2 }); }
+	for (int64_t i = 0; i < 1000; i += 2) { ASSERT_EQ(map.erase(Number{ i }), 1); }
+	for (int64_t i = 1000; i < 1100; ++i) { map.insert_or_assign(Number{ i }, Number{ i * 2 }); }
+	map.insert_or_assign(Number{ int64_t{ 1 } }, String{ "one" });
+
+	ASSERT_EQ(map.size(), 600);
+	EXPECT_FALSE(map.contains(Number{ int64_t{ 0 } }));
+	EXPECT_TRUE(map.at(Number{ int64_t{ 1 } }) == Value{ String{ "one" } });
+
+	int64_t expected = 1;
+	for (const auto &[key, value] : map) {
+		EXPECT_TRUE(key == Value{ Number{ expected } });
+		expected += expected < 999 ? 2 : 1;
+	}
+	EXPECT_EQ(expected, 1100);
+
+	CompactDict copy;
+	for (auto it = map.begin(); it != map.end(); ++it) {
+		copy.insert({ it->first, it->second });
+	}
+	EXPECT_TRUE(copy == map);
+	copy.erase(copy.begin());
+	EXPECT_FALSE(copy == map);
+}
+
+TEST(PyDict, CompactDictVersionChangesWhenKeysChange)
+{
+	CompactDict map;
+	auto version = map.version();
+	map.insert_or_assign(Number{ int64_t{ 1 } }, Number{ int64_t{ 1 } });
+	EXPECT_NE(map.version(), version);
+
+	// assigning to an existing key doesn't change the keys
+	version = map.version();
+	map.insert_or_assign(Number{ int64_t{ 1 } }, Number{ int64_t{ 2 } });
+	map.insert({ Number{ int64_t{ 1 } }, Number{ int64_t{ 3 } } });
+	EXPECT_EQ(map.version(), version);
+
+	// removing a key and adding another one keeps the size, but not the version
+	map.insert_or_assign(Number{ int64_t{ 2 } }, Number{ int64_t{ 2 } });
+	version = map.version();
+	const auto size = map.size();
+	map.erase(Number{ int64_t{ 1 } });
+	map.insert_or_assign(Number{ int64_t{ 3 } }, Number{ int64_t{ 3 } });
+	EXPECT_EQ(map.size(), size);
+	EXPECT_NE(map.version(), version);
+
+	version = map.version();
+	map.clear();
+	EXPECT_NE(map.version(), version);
+}
@@ -41,11 +41,17 @@ PyResult<PyObject *> PyEnumerate::__new__(const PyType *type, PyTuple *args, PyD
 
 PyResult<PyObject *> PyEnumerate::__iter__() const { return Ok(const_cast<PyEnumerate *>(this)); }
 
-PyResult<PyObject *> PyEnumerate::__next__()
+PyResult<PyObject *> PyEnumerate::__next__() { return next_from_iternext(iternext()); }
+
+PyResult<std::optional<Value>> PyEnumerate::iternext()
 {
-	auto value = m_iterator->next();
+	auto value = m_iterator->try_next();
 	if (value.is_err()) { return value; }
-	return PyTuple::create(Number{ m_current_index++ }, value.unwrap());
+	auto next_value = value.unwrap();
+	if (!next_value.has_value()) { return value; }
+	auto item = PyTuple::create(Number{ m_current_index++ }, *next_value);
+	if (item.is_err()) { return Err(item.unwrap_err()); }
+	return Ok(std::optional<Value>{ item.unwrap() });
 }
 
 PyType *PyEnumerate::static_type() const { return types::enumerate(); }
@@ -21,6 +21,7 @@ class PyEnumerate : public PyBaseObject
 
 	PyResult<PyObject *> __iter__() const;
 	PyResult<PyObject *> __next__();
+	PyResult<std::optional<Value>> iternext();
 
 	void visit_graph(Visitor &) override;
 
@@ -10,6 +10,7 @@
 #include "PyTraceback.hpp"
 #include "PyType.hpp"
 #include "executable/Function.hpp"
+#include "interpreter/Interpreter.hpp"
 #include "types/api.hpp"
 #include "types/builtin.hpp"
 
@@ -29,8 +30,8 @@ template<> const PyFrame *as(const PyObject *obj)
 
 PyFrame::PyFrame(PyType *type) : PyBaseObject(type) {}
 
-PyFrame::PyFrame(const std::vector<std::string> names)
-	: PyBaseObject(types::BuiltinTypes::the().frame()), m_names(std::move(names))
+PyFrame::PyFrame(const std::vector<std::string> &names)
+	: PyBaseObject(types::BuiltinTypes::the().frame()), m_names(&names)
 {}
 
 PyFrame *PyFrame::create(PyFrame *parent,
@@ -40,32 +41,45 @@ PyFrame *PyFrame::create(PyFrame *parent,
 	PyObject *globals,
 	PyObject *locals,
 	const PyTuple *consts,
-	const std::vector<std::string> names,
+	const std::vector<std::string> &names,
 	PyObject *generator)
 {
 	// TODO: handle wrong type here or somewhere else
 	if (globals->as_mapping().is_err()) { TODO(); }
-	if (locals->as_mapping().is_err()) { TODO(); }
 	if (!globals->type()->underlying_type().mapping_type_protocol->__getitem__.has_value()) {
 		TODO();
 	}
-	if (!locals->type()->underlying_type().mapping_type_protocol->__getitem__.has_value()) {
-		TODO();
+	if (locals) {
+		if (locals->as_mapping().is_err()) { TODO(); }
+		if (!locals->type()->underlying_type().mapping_type_protocol->__getitem__.has_value()) {
+			TODO();
+		}
 	}
 
-	auto *new_frame = VirtualMachine::the().heap().allocate<PyFrame>(std::move(names));
+	auto *new_frame = [&names]() -> PyFrame * {
+		auto &vm = VirtualMachine::the();
+		if (vm.has_interpreter()) {
+			if (auto *frame = vm.interpreter().take_pooled_frame()) {
+				frame->m_names = &names;
+				return frame;
+			}
+		}
+		return vm.heap().allocate<PyFrame>(names);
+	}();
 	new_frame->m_f_back = parent;
 	new_frame->m_register_count = register_count;
 	new_frame->m_globals = globals;
 	new_frame->m_locals = locals;
 	new_frame->m_consts = consts;
 	new_frame->m_f_code = code;
-	new_frame->m_freevars = std::vector<PyCell *>(free_vars_count, nullptr);
+	new_frame->m_freevar_storage.assign(free_vars_count, nullptr);
+	new_frame->m_freevars = new_frame->m_freevar_storage;
 
 	if (new_frame->m_f_back) {
 		new_frame->m_builtins = new_frame->m_f_back->m_builtins;
 		new_frame->m_exception_stack = new_frame->m_f_back->m_exception_stack;
 	} else {
+		ASSERT(new_frame->m_locals);
 		auto builtins = [new_frame]() -> PyResult<PyObject *> {
 			if (auto *locals = as<PyDict>(new_frame->m_locals)) {
 				if (auto value = (*locals)[String{ "__builtins__" }]; value.has_value()) {
@@ -93,10 +107,12 @@ PyFrame *PyFrame::create(PyFrame *parent,
 void PyFrame::push_exception(BaseException *exception)
 {
 	ASSERT(exception)
+	// the exception stack is shared with the callers, which may pop the entry
+	escape();
 	spdlog::debug("PyFrame::push_exception: current exception count {}", m_exception_stack->size());
 	m_exception_stack->push_back(ExceptionStackItem{ .exception = exception,
 		.exception_type = exception->type(),
-		.traceback = exception->traceback() });
+		.frame = this });
 	spdlog::debug("PyFrame::push_exception: pushed exception {}",
 		m_exception_stack->back().exception->to_string());
 	spdlog::debug("PyFrame::push_exception: added exception, stack has now {} exceptions",
@@ -116,10 +132,16 @@ BaseException *PyFrame::pop_exception()
 	return exception;
 }
 
+PyObject *PyFrame::locals_namespace() const
+{
+	if (!m_locals) { m_locals = PyDict::create().unwrap(); }
+	return m_locals;
+}
+
 PyResult<std::monostate> PyFrame::put_local(const std::string &name, const Value &value)
 {
 	ASSERT(!std::holds_alternative<PyObject *>(value) || std::get<PyObject *>(value));
-	if (auto *locals = as<PyDict>(m_locals)) {
+	if (auto *locals = as<PyDict>(locals_namespace())) {
 		locals->insert(String{ name }, value);
 		return Ok(std::monostate{});
 	} else {
@@ -141,6 +163,7 @@ PyResult<std::monostate> PyFrame::put_global(const std::string &name, const Valu
 
 PyObject *PyFrame::locals() const
 {
+	locals_namespace();
 	auto insert = [this](const Value &key, const Value &value) {
 		if (auto l = as<PyDict>(m_locals)) {
 			l->insert(key, value);
@@ -194,9 +217,6 @@ PyObject *PyFrame::globals() const { return m_globals; }
 
 PyModule *PyFrame::builtins() const { return m_builtins; }
 
-const std::vector<PyCell *> &PyFrame::freevars() const { return m_freevars; }
-std::vector<PyCell *> &PyFrame::freevars() { return m_freevars; }
-
 PyFrame *PyFrame::exit()
 {
 	spdlog::debug("Leaving PyFrame '{}' and entering PyFrame '{}'",
@@ -206,6 +226,29 @@ PyFrame *PyFrame::exit()
 	return m_f_back;
 }
 
+void PyFrame::escape()
+{
+	for (auto *frame = this; frame && !frame->m_escaped; frame = frame->m_f_back) {
+		frame->m_escaped = true;
+	}
+}
+
+void PyFrame::recycle()
+{
+	ASSERT(!m_escaped)
+	m_f_back = nullptr;
+	m_builtins = nullptr;
+	m_globals = nullptr;
+	m_locals = nullptr;
+	m_f_code = nullptr;
+	m_generator = nullptr;
+	m_names = nullptr;
+	m_consts = nullptr;
+	m_freevar_storage.clear();
+	m_freevars = {};
+	m_exception_stack.reset();
+}
+
 std::string PyFrame::to_string() const
 {
 	const auto locals = m_locals ? m_locals->to_string() : "";
@@ -227,12 +270,14 @@ void PyFrame::visit_graph(Visitor &visitor)
 	if (m_globals) visitor.visit(*m_globals);
 	if (m_builtins) visitor.visit(*m_builtins);
 	if (m_f_code) visitor.visit(*m_f_code);
-	for (const auto &exception_stack_item : *m_exception_stack) {
-		if (exception_stack_item.exception) { visitor.visit(*exception_stack_item.exception); }
-		if (exception_stack_item.exception_type) {
-			visitor.visit(*exception_stack_item.exception_type);
+	if (m_exception_stack) {
+		for (const auto &exception_stack_item : *m_exception_stack) {
+			if (exception_stack_item.exception) { visitor.visit(*exception_stack_item.exception); }
+			if (exception_stack_item.exception_type) {
+				visitor.visit(*exception_stack_item.exception_type);
+			}
+			if (exception_stack_item.frame) { visitor.visit(*exception_stack_item.frame); }
 		}
-		if (exception_stack_item.traceback) { visitor.visit(*exception_stack_item.traceback); }
 	}
 	if (m_f_back) { visitor.visit(*m_f_back); }
 	for (const auto &freevar : m_freevars) {
@@ -251,8 +296,15 @@ Value PyFrame::consts(size_t index) const
 
 const std::string &PyFrame::names(size_t index) const
 {
-	ASSERT(index < m_names.size())
-	return m_names[index];
+	ASSERT(index < m_names->size())
+	return (*m_names)[index];
+}
+
+PyString *PyFrame::interned_name(size_t index) const
+{
+	ASSERT(m_f_code)
+	ASSERT(m_names == &m_f_code->names())
+	return m_f_code->interned_name(index);
 }
 
 namespace {
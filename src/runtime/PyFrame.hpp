@@ -6,6 +6,7 @@
 #include "vm/VM.hpp"
 
 #include <memory>
+#include <span>
 #include <unordered_map>
 
 namespace py {
@@ -21,13 +22,14 @@ class PyFrame : public PyBaseObject
 	{
 		BaseException *exception{ nullptr };
 		PyType *exception_type{ nullptr };
-		PyTraceback *traceback{ nullptr };
+		// the frame that was executing when the exception was pushed
+		PyFrame *frame{ nullptr };
 	};
 
   private:
 	PyFrame(PyType *);
 
-	PyFrame(const std::vector<std::string>);
+	PyFrame(const std::vector<std::string> &names);
 
   protected:
 	// next outer frame object (this frame’s caller)
@@ -36,18 +38,25 @@ class PyFrame : public PyBaseObject
 	PyModule *m_builtins{ nullptr };
 	// global namespace seen by this frame
 	PyObject *m_globals{ nullptr };
-	// local namespace seen by this frame
-	PyObject *m_locals{ nullptr };
+	// local namespace seen by this frame. Function frames keep their locals in the VM stack, so
+	// for them the namespace is only created when it is first needed (e.g. by `locals()`)
+	mutable PyObject *m_locals{ nullptr };
 	// code segment
 	PyCode *m_f_code{ nullptr };
 	// generator object
 	PyObject *m_generator{ nullptr };
 
 	size_t m_register_count;
-	const std::vector<std::string> m_names;
+	// shared with the code object, which outlives the frame
+	const std::vector<std::string> *m_names{ nullptr };
 	const PyTuple *m_consts;
-	std::vector<PyCell *> m_freevars;
+	std::span<PyCell *> m_freevars;
+	// backs m_freevars, and keeps its capacity when the frame is recycled
+	std::vector<PyCell *> m_freevar_storage;
 	std::shared_ptr<std::vector<ExceptionStackItem>> m_exception_stack;
+	// set once the frame can be reached after its call returned (e.g. through a traceback), in
+	// which case it is not recycled
+	bool m_escaped{ false };
 
   public:
 	static PyFrame *create(PyFrame *parent,
@@ -57,7 +66,7 @@ class PyFrame : public PyBaseObject
 		PyObject *globals,
 		PyObject *locals,
 		const PyTuple *consts,
-		const std::vector<std::string> names,
+		const std::vector<std::string> &names,
 		PyObject *generator);
 
 	[[nodiscard]] PyResult<std::monostate> put_local(const std::string &name, const Value &);
@@ -76,6 +85,10 @@ class PyFrame : public PyBaseObject
 
 	PyFrame *exit();
 
+	// marks this frame and its callers, which are reachable through f_back, as escaped
+	void escape();
+	bool escaped() const { return m_escaped; }
+
 	PyObject *globals() const;
 	PyObject *locals() const;
 	PyModule *builtins() const;
@@ -83,10 +96,10 @@ class PyFrame : public PyBaseObject
 	PyObject *generator() const { return m_generator; }
 	void set_generator(PyObject *generator) { m_generator = generator; }
 
-	const std::vector<PyCell *> &freevars() const;
-	std::vector<PyCell *> &freevars();
+	std::span<PyCell *> freevars() const { return m_freevars; }
 	Value consts(size_t index) const;
 	const std::string &names(size_t index) const;
+	PyString *interned_name(size_t index) const;
 
 	std::string to_string() const override;
 	void visit_graph(Visitor &) override;
@@ -97,6 +110,11 @@ class PyFrame : public PyBaseObject
 
   private:
 	PyFrame();
+
+	PyObject *locals_namespace() const;
+
+	// drops everything the frame refers to, so that it can be handed out again by create()
+	void recycle();
 };
 
 }// namespace py
@@ -28,7 +28,7 @@ PyFrozenSet::PyFrozenSet(SetType elements) : PyFrozenSet() { m_elements = std::m
 
 PyResult<PyFrozenSet *> PyFrozenSet::create(SetType elements)
 {
-	auto *result = VirtualMachine::the().heap().allocate<PyFrozenSet>(elements);
+	auto *result = VirtualMachine::the().heap().allocate<PyFrozenSet>(std::move(elements));
 	if (!result) { return Err(memory_error(sizeof(PyFrozenSet))); }
 	return Ok(result);
 }
@@ -99,7 +99,7 @@ PyResult<PyObject *> PyFrozenSet::__new__(const PyType *type, PyTuple *args, PyD
 
 		if (value_.unwrap_err()->type() != stop_iteration()->type()) { return value_; }
 
-		return PyFrozenSet::create(set);
+		return PyFrozenSet::create(std::move(set));
 	} else {
 		return Err(type_error("frozenset expected at most 1 argument, got {}", args->size()));
 	}
@@ -160,6 +160,38 @@ PyResult<bool> PyFrozenSet::__contains__(const PyObject *value) const
 	return Ok(m_elements.contains(value_));
 }
 
+namespace {
+	const PyFrozenSet::SetType *set_elements(const PyObject *obj)
+	{
+		if (obj->type()->issubclass(types::frozenset())) {
+			return &static_cast<const PyFrozenSet &>(*obj).elements();
+		} else if (obj->type()->issubclass(types::set())) {
+			return &static_cast<const PySet &>(*obj).elements();
+		}
+		return nullptr;
+	}
+}// namespace
+
+PyResult<PyObject *> PyFrozenSet::__sub__(const PyObject *other) const
+{
+	const auto *other_elements = set_elements(other);
+	if (!other_elements) {
+		return Err(type_error(
+			"unsupported operand type(s) for -: 'frozenset' and '{}'", other->type()->name()));
+	}
+	return PyFrozenSet::create(m_elements.difference(*other_elements));
+}
+
+PyResult<PyObject *> PyFrozenSet::__and__(PyObject *other)
+{
+	const auto *other_elements = set_elements(other);
+	if (!other_elements) {
+		return Err(type_error(
+			"unsupported operand type(s) for &: 'frozenset' and '{}'", other->type()->name()));
+	}
+	return PyFrozenSet::create(m_elements.intersection(*other_elements));
+}
+
 
 void PyFrozenSet::visit_graph(Visitor &visitor)
 {
@@ -1,7 +1,7 @@
 #pragma once
 
+#include "FlatHashSet.hpp"
 #include "PyObject.hpp"
-#include <unordered_set>
 
 namespace py {
 
@@ -10,7 +10,7 @@ class PyFrozenSet : public PyBaseObject
 	friend class ::Heap;
 
   public:
-	using SetType = std::unordered_set<Value, ValueHash>;
+	using SetType = FlatHashSet;
 
   private:
 	SetType m_elements;
@@ -31,6 +31,8 @@ class PyFrozenSet : public PyBaseObject
 	PyResult<size_t> __len__() const;
 	PyResult<PyObject *> __eq__(const PyObject *other) const;
 	PyResult<bool> __contains__(const PyObject *value) const;
+	PyResult<PyObject *> __sub__(const PyObject *other) const;
+	PyResult<PyObject *> __and__(PyObject *other);
 
 
 	const SetType &elements() const { return m_elements; }
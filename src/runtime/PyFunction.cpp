@@ -45,12 +45,13 @@ PyFunction::PyFunction(std::vector<Value> defaults,
 
 	if (!m_closure) { m_closure = PyTuple::create().unwrap(); }
 
+	auto *name_key = PyString::intern("__name__").unwrap();
 	if (auto g = as<PyDict>(globals)) {
-		if (auto it = g->map().find(String{ "__name__" }); it != g->map().end()) {
+		if (auto it = g->map().find(name_key); it != g->map().end()) {
 			m_module = PyObject::from(it->second).unwrap();
 		}
 	} else {
-		auto it = globals->getitem(PyString::create("__name__").unwrap());
+		auto it = globals->getitem(name_key);
 		ASSERT(!it.is_err());
 		if (it.is_ok()) { m_module = it.unwrap(); }
 	}
@@ -95,23 +96,34 @@ PyResult<PyObject *> PyFunction::__get__(PyObject *instance, PyObject * /*owner*
 	return PyBoundMethod::create(instance, const_cast<PyFunction *>(this));
 }
 
-PyResult<PyObject *> PyFunction::call_with_frame(PyObject *ns, PyTuple *args, PyDict *kwargs) const
+PyResult<PyObject *> PyFunction::call_with_frame(PyObject *ns,
+	std::span<const Value> args,
+	std::span<const std::string_view> kwnames) const
 {
 	return m_code->eval(m_globals,
 		ns,
 		args,
-		kwargs,
+		kwnames,
 		m_defaults,
 		m_kwonly_defaults,
-		m_closure ? m_closure->elements() : std::vector<Value>{},
+		m_closure ? std::span<const Value>{ m_closure->elements() } : std::span<const Value>{},
 		m_name);
 }
 
+PyResult<PyObject *> PyFunction::vectorcall(std::span<const Value> args,
+	std::span<const std::string_view> kwnames)
+{
+	// the locals of a function live in the VM stack, the frame only creates a namespace dict for
+	// them on demand
+	return call_with_frame(nullptr, args, kwnames);
+}
+
 PyResult<PyObject *> PyFunction::__call__(PyTuple *args, PyDict *kwargs)
 {
-	auto function_locals = PyDict::create();
-	if (function_locals.is_err()) { return function_locals; }
-	return call_with_frame(function_locals.unwrap(), args, kwargs);
+	return call_with_vector_args(
+		args, kwargs, [this](std::span<const Value> args, std::span<const std::string_view> kwnames) {
+			return vectorcall(args, kwnames);
+		});
 }
 
 std::string PyFunction::to_string() const
@@ -164,7 +176,11 @@ PyNativeFunction::PyNativeFunction(PyType *type) : PyBaseObject(type) {}
 PyNativeFunction::PyNativeFunction(std::string &&name, FunctionType &&function)
 	: PyBaseObject(types::BuiltinTypes::the().native_function()), m_name(std::move(name)),
 	  m_function(std::move(function))
-{}
+{
+	if (std::holds_alternative<FastFunctionType>(m_function)) {
+		m_flags = MethodFlags::create(MethodFlags::Flag::FASTCALL);
+	}
+}
 
 std::string PyNativeFunction::to_string() const
 {
@@ -178,8 +194,22 @@ std::string PyNativeFunction::to_string() const
 	}
 }
 
+PyResult<PyObject *> PyNativeFunction::vectorcall(std::span<const Value> args,
+	std::span<const std::string_view> kwnames)
+{
+	if (m_flags.is_set(MethodFlags::Flag::FASTCALL)) {
+		return std::get<FastFunctionType>(m_function)(args, kwnames);
+	}
+	return pack_vector_args(args, kwnames).and_then([this](std::pair<PyTuple *, PyDict *> args) {
+		return __call__(args.first, args.second);
+	});
+}
+
 PyResult<PyObject *> PyNativeFunction::__call__(PyTuple *args, PyDict *kwargs)
 {
+	if (m_flags.is_set(MethodFlags::Flag::FASTCALL)) {
+		return call_with_vector_args(args, kwargs, std::get<FastFunctionType>(m_function));
+	}
 	auto result_reg_value = VirtualMachine::the().reg(0);
 	auto result = [this, args, kwargs]() {
 		if (is_method()) {
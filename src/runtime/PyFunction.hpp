@@ -38,8 +38,12 @@ class PyFunction : public PyBaseObject
 	const std::vector<Value> &defaults() const { return m_defaults; }
 	const std::vector<Value> &kwonly_defaults() const { return m_kwonly_defaults; }
 
-	PyResult<PyObject *> call_with_frame(PyObject *ns, PyTuple *args, PyDict *kwargs) const;
+	PyResult<PyObject *> call_with_frame(PyObject *ns,
+		std::span<const Value> args,
+		std::span<const std::string_view> kwnames) const;
 
+	PyResult<PyObject *> vectorcall(std::span<const Value> args,
+		std::span<const std::string_view> kwnames);
 	PyResult<PyObject *> __call__(PyTuple *args, PyDict *kwargs);
 	PyString *function_name() const { return m_name; }
 
@@ -62,13 +66,16 @@ class PyNativeFunction : public PyBaseObject
 	using MethodSignature = PyResult<PyObject *>(PyObject *, PyTuple *, PyDict *);
 	using FreeFunctionType = std::function<FreeFunctionSignature>;
 	using MethodType = std::function<MethodSignature>;
-	using FunctionType = std::variant<FreeFunctionType, MethodType>;
+	// functions using the fast calling convention (MethodFlags::Flag::FASTCALL)
+	using FastFunctionType = VectorCallFunctionType;
+	using FunctionType = std::variant<FreeFunctionType, MethodType, FastFunctionType>;
 
 	using FreeFunctionPointerType = typename std::add_pointer_t<FreeFunctionSignature>;
 	using MethodPointerType = typename std::add_pointer_t<MethodSignature>;
 
 	std::string m_name;
 	FunctionType m_function;
+	MethodFlags m_flags;
 	PyObject *m_self{ nullptr };
 	std::vector<PyObject *> m_captures;
 
@@ -106,6 +113,16 @@ class PyNativeFunction : public PyBaseObject
 		return Ok(result);
 	}
 
+	template<typename... Args>
+	static PyResult<PyNativeFunction *>
+		create(std::string name, FastFunctionType function, Args &&...args)
+	{
+		auto *result = VirtualMachine::the().heap().allocate<PyNativeFunction>(
+			std::move(name), std::move(function), nullptr, std::forward<Args>(args)...);
+		if (!result) { return Err(memory_error(sizeof(PyNativeFunction))); }
+		return Ok(result);
+	}
+
 	PyResult<PyObject *> operator()(PyTuple *args, PyDict *kwargs)
 	{
 		ASSERT(is_function());
@@ -122,6 +139,8 @@ class PyNativeFunction : public PyBaseObject
 
 	bool is_method() const { return std::holds_alternative<MethodType>(m_function); }
 
+	const MethodFlags &flags() const { return m_flags; }
+
 	std::optional<FreeFunctionPointerType> free_function_pointer()
 	{
 		if (!is_function()) { return std::nullopt; }
@@ -139,6 +158,8 @@ class PyNativeFunction : public PyBaseObject
 	std::string to_string() const override;
 
 	const std::string &name() const { return m_name; }
+	PyResult<PyObject *> vectorcall(std::span<const Value> args,
+		std::span<const std::string_view> kwnames);
 	PyResult<PyObject *> __call__(PyTuple *args, PyDict *kwargs);
 	PyResult<PyObject *> __repr__() const;
 
@@ -5,6 +5,7 @@
 #include "TypeError.hpp"
 #include "ValueError.hpp"
 #include "interpreter/Interpreter.hpp"
+#include "memory/Heap.hpp"
 #include "runtime/PyObject.hpp"
 #include "runtime/Value.hpp"
 #include "types/api.hpp"
@@ -12,6 +13,8 @@
 #include "utilities.hpp"
 #include "vm/VM.hpp"
 
+#include <array>
+
 namespace py {
 
 template<> PyInteger *as(PyObject *obj)
@@ -28,23 +31,41 @@ template<> const PyInteger *as(const PyObject *obj)
 
 PyInteger::PyInteger(PyType *type) : Interface(type) {}
 
+PyInteger::PyInteger(int64_t value)
+	: Interface(Number{ value }, types::BuiltinTypes::the().integer())
+{}
+
 PyInteger::PyInteger(BigIntType value)
 	: Interface(Number{ std::move(value) }, types::BuiltinTypes::the().integer())
 {}
 
-PyInteger::PyInteger(TypePrototype &type, BigIntType value)
-	: Interface(Number{ std::move(value) }, type)
-{}
+PyInteger::PyInteger(TypePrototype &type, int64_t value) : Interface(Number{ value }, type) {}
+
+// the small integer cache shares the static region with the other immortal objects, such as None
+// and the builtin types, so a SMALL_INT_CACHE_MIN/MAX range must leave most of it free
+static_assert((PyInteger::kSmallIntMax - PyInteger::kSmallIntMin + 1) * sizeof(PyInteger)
+				  <= Heap::StaticMemorySize / 4,
+	"SMALL_INT_CACHE_MIN and SMALL_INT_CACHE_MAX do not fit in the static region of the heap");
 
 PyResult<PyInteger *> PyInteger::create(int64_t value)
 {
-	return PyInteger::create(BigIntType{ value });
+	auto &heap = VirtualMachine::the().heap();
+	if (value >= kSmallIntMin && value <= kSmallIntMax) {
+		static std::array<PyInteger *, kSmallIntMax - kSmallIntMin + 1> small_ints{};
+		auto *&small_int = small_ints[value - kSmallIntMin];
+		if (!small_int) { small_int = heap.allocate_static<PyInteger>(value).get(); }
+		return Ok(small_int);
+	}
+	auto *result = heap.allocate<PyInteger>(value);
+	if (!result) { return Err(memory_error(sizeof(PyInteger))); }
+	return Ok(result);
 }
 
 PyResult<PyInteger *> PyInteger::create(BigIntType value)
 {
+	if (value.fits_slong_p()) { return PyInteger::create(static_cast<int64_t>(value.get_si())); }
 	auto &heap = VirtualMachine::the().heap();
-	auto *result = heap.allocate<PyInteger>(value);
+	auto *result = heap.allocate<PyInteger>(std::move(value));
 	if (!result) { return Err(memory_error(sizeof(PyInteger))); }
 	return Ok(result);
 }
@@ -89,6 +110,10 @@ PyResult<PyObject *> PyInteger::__new__(const PyType *type, PyTuple *args, PyDic
 
 PyResult<int64_t> PyInteger::__hash__() const
 {
+	if (std::holds_alternative<BigIntType>(m_value.value)) {
+		const auto &value = std::get<BigIntType>(m_value.value);
+		return Ok(static_cast<int64_t>(mpz_fdiv_ui(value.get_mpz_t(), kBigIntHashModulus)));
+	}
 	const auto value = as_i64();
 	if (value == -1) return Ok(-2);
 	return Ok(value);
@@ -121,8 +146,14 @@ PyResult<PyObject *> PyInteger::__xor__(PyObject *obj)
 			type_error("unsupported operand type(s) for |: 'int' and '{}'", obj->type()->name()));
 	}
 
-	mpz_class result = std::get<BigIntType>(m_value.value);
-	result ^= std::get<BigIntType>(static_cast<const PyInteger &>(*obj).value().value);
+	const auto &other = static_cast<const PyInteger &>(*obj).value();
+	if (std::holds_alternative<int64_t>(m_value.value)
+		&& std::holds_alternative<int64_t>(other.value)) {
+		return PyInteger::create(std::get<int64_t>(m_value.value) ^ std::get<int64_t>(other.value));
+	}
+
+	mpz_class result = m_value.as_big_int();
+	result ^= other.as_big_int();
 
 	return PyInteger::create(std::move(result));
 }
@@ -193,8 +224,8 @@ PyResult<PyObject *> PyInteger::to_bytes(PyTuple *args, PyDict *kwargs) const
 	std::unique_ptr<std::byte[]> bytes = std::make_unique<std::byte[]>(length);
 	const int32_t order = byteorder == "big" ? 1 : -1;
 	auto l = length;
-	void *result = mpz_export(
-		bytes.get(), &l, order, 1, order, 0, std::get<BigIntType>(m_value.value).get_mpz_t());
+	const auto value = as_big_int();
+	void *result = mpz_export(bytes.get(), &l, order, 1, order, 0, value.get_mpz_t());
 	ASSERT(result);
 	if (l > length) {
 		// FIXME: should be an OverflowError
@@ -268,23 +299,23 @@ PyResult<PyObject *> PyInteger::from_bytes(PyType *type, PyTuple *args, PyDict *
 
 int64_t PyInteger::as_i64() const
 {
-	ASSERT(std::holds_alternative<BigIntType>(m_value.value));
-	ASSERT(std::get<BigIntType>(m_value.value).fits_slong_p());
-	return std::get<BigIntType>(m_value.value).get_si();
+	// BigIntType values are always demoted to int64_t when they fit, so anything stored as a
+	// BigIntType is out of range here
+	ASSERT(std::holds_alternative<int64_t>(m_value.value));
+	return std::get<int64_t>(m_value.value);
 }
 
 size_t PyInteger::as_size_t() const
 {
-	ASSERT(std::holds_alternative<BigIntType>(m_value.value));
+	if (std::holds_alternative<int64_t>(m_value.value)) {
+		ASSERT(std::get<int64_t>(m_value.value) >= 0);
+		return static_cast<size_t>(std::get<int64_t>(m_value.value));
+	}
 	ASSERT(std::get<BigIntType>(m_value.value).fits_ulong_p());
 	return std::get<BigIntType>(m_value.value).get_ui();
 }
 
-BigIntType PyInteger::as_big_int() const
-{
-	ASSERT(std::holds_alternative<BigIntType>(m_value.value));
-	return std::get<BigIntType>(m_value.value);
-}
+BigIntType PyInteger::as_big_int() const { return m_value.as_big_int(); }
 
 PyType *PyInteger::static_type() const { return types::integer(); }
 
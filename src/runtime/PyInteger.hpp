@@ -2,20 +2,39 @@
 
 #include "PyNumber.hpp"
 
+#ifndef SMALL_INT_CACHE_MIN
+#define SMALL_INT_CACHE_MIN -5
+#endif
+
+#ifndef SMALL_INT_CACHE_MAX
+#define SMALL_INT_CACHE_MAX 1024
+#endif
+
 namespace py {
 
 class PyInteger : public Interface<PyNumber, PyInteger>
 {
 	friend class ::Heap;
 
+	PyInteger(int64_t);
 	PyInteger(BigIntType);
 
   protected:
 	PyInteger(PyType *);
 
-	PyInteger(TypePrototype &, BigIntType);
+	PyInteger(TypePrototype &, int64_t);
 
   public:
+	// Integers that do not fit in an int64_t are hashed modulo the Mersenne prime 2**61 - 1, like
+	// in CPython
+	static constexpr unsigned long kBigIntHashModulus = (1ul << 61) - 1;
+
+	// Integers in [kSmallIntMin, kSmallIntMax] are immortal singletons allocated in the static
+	// region, so that loop indices, lengths and other common results do not hit the GC heap
+	static constexpr int64_t kSmallIntMin = SMALL_INT_CACHE_MIN;
+	static constexpr int64_t kSmallIntMax = SMALL_INT_CACHE_MAX;
+	static_assert(kSmallIntMin <= 0 && kSmallIntMax >= 0);
+
 	static PyResult<PyInteger *> create(int64_t);
 
 	static PyResult<PyInteger *> create(BigIntType);
@@ -26,6 +45,7 @@ class PyInteger : public Interface<PyNumber, PyInteger>
 
 	PyResult<PyObject *> __and__(PyObject *obj);
 	PyResult<PyObject *> __or__(PyObject *obj);
+	PyResult<PyObject *> __xor__(PyObject *obj);
 
 	PyResult<PyObject *> __lshift__(const PyObject *other) const;
 	PyResult<PyObject *> __rshift__(const PyObject *other) const;
@@ -1,5 +1,6 @@
 #include "PyList.hpp"
 #include "IndexError.hpp"
+#include "ListSort.hpp"
 #include "MemoryError.hpp"
 #include "PyBool.hpp"
 #include "PyDict.hpp"
@@ -50,21 +51,21 @@ PyList::PyList() : PyBaseObject(types::BuiltinTypes::the().list()) {}
 
 PyList::PyList(PyType *type) : PyBaseObject(type) {}
 
-PyList::PyList(std::vector<Value> elements) : PyList() { m_elements = std::move(elements); }
+PyList::PyList(ListStorage storage) : PyList() { m_storage = std::move(storage); }
 
 PyResult<PyList *> PyList::create(std::vector<Value> elements)
 {
-	auto *result = VirtualMachine::the().heap().allocate<PyList>(std::move(elements));
-	if (!result) { return Err(memory_error(sizeof(PyList))); }
-	return Ok(result);
+	return create(ListStorage{ std::move(elements) });
 }
 
 PyResult<PyList *> PyList::create(std::span<const Value> s)
 {
-	std::vector<Value> elements{ s.size(), nullptr };
-	for (size_t idx = 0; auto el : s) { elements[idx++] = el; }
+	return create(ListStorage{ std::vector<Value>{ s.begin(), s.end() } });
+}
 
-	auto *result = VirtualMachine::the().heap().allocate<PyList>(std::move(elements));
+PyResult<PyList *> PyList::create(ListStorage storage)
+{
+	auto *result = VirtualMachine::the().heap().allocate<PyList>(std::move(storage));
 	if (!result) { return Err(memory_error(sizeof(PyList))); }
 	return Ok(result);
 }
@@ -93,19 +94,20 @@ PyResult<PyObject *> PyList::__new__(const PyType *type, PyTuple *args, PyDict *
 	if (result.is_err()) { return Err(result.unwrap_err()); }
 
 	auto [iterable] = result.unwrap();
-	if (!iterable) { return PyList::create(); }
+
+	// subclasses of list are allocated with the room for their __slots__ and attributes
+	auto els_ = type->underlying_type().__alloc__(const_cast<PyType *>(type));
+	if (els_.is_err()) { return els_; }
+	auto *els = static_cast<PyList *>(els_.unwrap());
+	if (!iterable) { return Ok(els); }
 
 	auto iterator_ = iterable->iter();
 	if (iterator_.is_err()) { return iterator_; }
 	auto iterator = iterator_.unwrap();
 
-	auto els_ = PyList::create();
-	if (els_.is_err()) { return Err(els_.unwrap_err()); }
-	auto els = els_.unwrap();
-
 	auto value = iterator->next();
 	while (value.is_ok()) {
-		els->elements().push_back(value.unwrap());
+		els->m_storage.push_back(value.unwrap());
 		value = iterator->next();
 	}
 
@@ -116,12 +118,17 @@ PyResult<PyObject *> PyList::__new__(const PyType *type, PyTuple *args, PyDict *
 
 PyResult<PyObject *> PyList::append(PyObject *element)
 {
-	m_elements.push_back(element);
+	m_storage.push_back(element);
 	return Ok(py_none());
 }
 
 PyResult<PyObject *> PyList::extend(PyObject *iterable)
 {
+	if (auto *other = as<PyList>(iterable)) {
+		m_storage.extend(other->m_storage);
+		return Ok(py_none());
+	}
+
 	auto iterator = iterable->iter();
 	if (iterator.is_err()) return iterator;
 
@@ -136,14 +143,14 @@ PyResult<PyObject *> PyList::extend(PyObject *iterable)
 
 	if (!value.unwrap_err()->type()->issubclass(stop_iteration()->type())) { return value; }
 
-	m_elements.insert(m_elements.end(), tmp_list->elements().begin(), tmp_list->elements().end());
+	m_storage.extend(tmp_list->m_storage);
 
 	return Ok(py_none());
 }
 
 PyResult<PyObject *> PyList::pop(PyObject *index)
 {
-	if (m_elements.empty()) { return Err(index_error("pop from empty list")); }
+	if (m_storage.empty()) { return Err(index_error("pop from empty list")); }
 
 	if (index) {
 		if (!as<PyInteger>(index)) {
@@ -152,36 +159,32 @@ PyResult<PyObject *> PyList::pop(PyObject *index)
 		}
 		auto idx = [index, this]() -> PyResult<size_t> {
 			auto idx_value = as<PyInteger>(index)->as_i64();
-			size_t idx = m_elements.size();
+			size_t idx = m_storage.size();
 			if (idx_value < 0) {
-				if (static_cast<uint64_t>(std::abs(idx_value)) > m_elements.size()) {
+				if (static_cast<uint64_t>(std::abs(idx_value)) > m_storage.size()) {
 					return Err(index_error("pop index '{}' out of range for list of size '{}'",
 						idx,
-						m_elements.size()));
+						m_storage.size()));
 				}
 				idx += idx_value;
 			} else {
 				idx = static_cast<size_t>(idx_value);
 			}
-			if (idx >= m_elements.size()) {
+			if (idx >= m_storage.size()) {
 				return Err(index_error(
-					"pop index '{}' out of range for list of size '{}'", idx, m_elements.size()));
+					"pop index '{}' out of range for list of size '{}'", idx, m_storage.size()));
 			}
 			return Ok(idx);
 		}();
 		return idx.and_then([this](size_t idx) {
-			return PyObject::from(m_elements[idx]).and_then([this, idx](PyObject *el) {
-				if (idx == m_elements.size()) {
-					m_elements.pop_back();
-				} else {
-					m_elements.erase(m_elements.begin() + idx);
-				}
+			return PyObject::from(m_storage[idx]).and_then([this, idx](PyObject *el) {
+				m_storage.erase(idx);
 				return Ok(el);
 			});
 		});
 	} else {
-		return PyObject::from(m_elements.back()).and_then([this](PyObject *el) {
-			m_elements.pop_back();
+		return PyObject::from(m_storage[m_storage.size() - 1]).and_then([this](PyObject *el) {
+			m_storage.pop_back();
 			return Ok(el);
 		});
 	}
@@ -224,15 +227,9 @@ PyResult<PyObject *> PyList::__repr__() const
 			el);
 	};
 	os << "[";
-	if (!m_elements.empty()) {
-		auto it = m_elements.begin();
-		while (std::next(it) != m_elements.end()) {
-			auto r = repr(*it);
-			if (r.is_err()) { return r; }
-			os << std::move(r.unwrap()->value()) << ", ";
-			std::advance(it, 1);
-		}
-		auto r = repr(*it);
+	for (size_t i = 0; i < m_storage.size(); ++i) {
+		if (i > 0) { os << ", "; }
+		auto r = repr(m_storage[i]);
 		if (r.is_err()) { return r; }
 		os << std::move(r.unwrap()->value());
 	}
@@ -252,25 +249,25 @@ PyResult<PyObject *> PyList::__iter__() const
 PyResult<PyObject *> PyList::__getitem__(int64_t index)
 {
 	if (index < 0) {
-		if (static_cast<size_t>(std::abs(index)) > m_elements.size()) {
+		if (static_cast<size_t>(std::abs(index)) > m_storage.size()) {
 			return Err(index_error("list index out of range"));
 		}
-		index += m_elements.size();
+		index += m_storage.size();
 	}
 	ASSERT(index >= 0);
-	if (static_cast<size_t>(index) >= m_elements.size()) {
+	if (static_cast<size_t>(index) >= m_storage.size()) {
 		return Err(index_error("list index out of range"));
 	}
-	return PyObject::from(m_elements[index]);
+	return PyObject::from(m_storage[index]);
 }
 
 PyResult<std::monostate> PyList::__setitem__(int64_t index, PyObject *value)
 {
-	if (index < 0) { index += m_elements.size(); }
-	if (static_cast<size_t>(index) >= m_elements.size()) {
+	if (index < 0) { index += m_storage.size(); }
+	if (static_cast<size_t>(index) >= m_storage.size()) {
 		return Err(index_error("list index out of range"));
 	}
-	m_elements[index] = value;
+	m_storage.set(index, value);
 	return Ok(std::monostate{});
 }
 
@@ -285,17 +282,17 @@ PyResult<std::monostate> PyList::__delitem__(PyObject *key)
 		if (index_value >= 0) {
 			ASSERT(index_value.fits_ulong_p());
 			const auto index = index_value.get_ui();
-			if (index > m_elements.size()) {
+			if (index > m_storage.size()) {
 				return Err(index_error("list deletion index out of range"));
 			}
 			return Ok(index);
 		} else {
 			ASSERT(index_value.fits_slong_p());
 			const auto index = index_value.get_si();
-			if (static_cast<size_t>(std::abs(index)) > m_elements.size()) {
+			if (static_cast<size_t>(std::abs(index)) > m_storage.size()) {
 				return Err(index_error("list deletion index out of range"));
 			}
-			return Ok(m_elements.size() - std::abs(index));
+			return Ok(m_storage.size() - std::abs(index));
 		}
 		ASSERT_NOT_REACHED();
 	};
@@ -303,7 +300,7 @@ PyResult<std::monostate> PyList::__delitem__(PyObject *key)
 	auto delete_index = [this, validate_index](BigIntType index_value) -> PyResult<std::monostate> {
 		const auto index = validate_index(index_value);
 		if (index.is_err()) { return Err(index.unwrap_err()); }
-		m_elements.erase(m_elements.begin() + index.unwrap());
+		m_storage.erase(index.unwrap());
 		return Ok(std::monostate{});
 	};
 
@@ -313,10 +310,10 @@ PyResult<std::monostate> PyList::__delitem__(PyObject *key)
 		if (unpack_indices.is_err()) { return Err(unpack_indices.unwrap_err()); }
 		auto [start, stop, step] = unpack_indices.unwrap();
 		start = start == std::numeric_limits<int64_t>::max()
-					? static_cast<int64_t>(m_elements.size()) - 1
+					? static_cast<int64_t>(m_storage.size()) - 1
 					: start;
 		stop = stop == std::numeric_limits<int64_t>::min()
-				   ? static_cast<int64_t>(m_elements.size()) - 1
+				   ? static_cast<int64_t>(m_storage.size()) - 1
 				   : start;
 		if (step == 0) { return Err(value_error("slice step cannot be zero")); }
 		auto start_index = validate_index(start);
@@ -328,7 +325,7 @@ PyResult<std::monostate> PyList::__delitem__(PyObject *key)
 		if (step > 0) {
 			if (start > stop) { return Ok(std::monostate{}); }
 			if (step == 1) {
-				m_elements.erase(m_elements.begin() + start, m_elements.begin() + stop);
+				m_storage.erase(start, stop);
 			} else {
 				for (auto idx = start; idx < stop; idx += step) {
 					auto result = delete_index(idx);
@@ -364,19 +361,19 @@ PyResult<PyObject *> PyList::__getitem__(PyObject *index)
 		const auto [start_, end_, step] = indices_.unwrap();
 
 		const auto [start, end, slice_length] =
-			PySlice::adjust_indices(start_, end_, step, m_elements.size());
+			PySlice::adjust_indices(start_, end_, step, m_storage.size());
 
 		if (slice_length == 0) { return PyList::create(); }
-		if (start == 0 && end == static_cast<int64_t>(m_elements.size()) && step == 1) {
+		if (start == 0 && end == static_cast<int64_t>(m_storage.size()) && step == 1) {
 			// shallow copy of the list since we need all elements
-			return PyList::create(m_elements);
+			return PyList::create(m_storage);
 		}
 
 		auto new_list = PyList::create();
 		if (new_list.is_err()) return new_list;
 
 		for (int64_t idx = start, i = 0; i < slice_length; idx += step, ++i) {
-			new_list.unwrap()->elements().push_back(m_elements[idx]);
+			new_list.unwrap()->m_storage.push_back(m_storage[idx]);
 		}
 		return new_list;
 	} else {
@@ -397,17 +394,17 @@ PyResult<std::monostate> PyList::__setitem__(PyObject *index, PyObject *value)
 			if (index_value >= 0) {
 				ASSERT(index_value.fits_ulong_p());
 				const auto index = index_value.get_ui();
-				if (index > m_elements.size()) {
+				if (index > m_storage.size()) {
 					return Err(index_error("list assignment index out of range"));
 				}
 				return Ok(index);
 			} else {
 				ASSERT(index_value.fits_slong_p());
 				const auto index = index_value.get_si();
-				if (static_cast<size_t>(std::abs(index)) > m_elements.size()) {
+				if (static_cast<size_t>(std::abs(index)) > m_storage.size()) {
 					return Err(index_error("list assignment index out of range"));
 				}
-				return Ok(m_elements.size() - std::abs(index));
+				return Ok(m_storage.size() - std::abs(index));
 			}
 			ASSERT_NOT_REACHED();
 		};
@@ -416,10 +413,10 @@ PyResult<std::monostate> PyList::__setitem__(PyObject *index, PyObject *value)
 		if (unpack_indices.is_err()) { return Err(unpack_indices.unwrap_err()); }
 		auto [start, stop, step] = unpack_indices.unwrap();
 		start = start == std::numeric_limits<int64_t>::max()
-					? static_cast<int64_t>(m_elements.size()) - 1
+					? static_cast<int64_t>(m_storage.size()) - 1
 					: start;
 		stop = stop == std::numeric_limits<int64_t>::min()
-				   ? static_cast<int64_t>(m_elements.size()) - 1
+				   ? static_cast<int64_t>(m_storage.size()) - 1
 				   : start;
 		if (step == 0) { return Err(value_error("slice step cannot be zero")); }
 		if (step != 1) { TODO(); }
@@ -435,11 +432,11 @@ PyResult<std::monostate> PyList::__setitem__(PyObject *index, PyObject *value)
 		for (; i < stop && val.is_ok(); i += step) {
 			auto index_ = validate_index(i);
 			if (index_.is_err()) { return Err(index_.unwrap_err()); }
-			m_elements[index_.unwrap()] = val.unwrap();
+			m_storage.set(index_.unwrap(), val.unwrap());
 			val = value_iter.unwrap()->next();
 		}
 		while (val.is_ok()) {
-			m_elements.insert(m_elements.begin() + i, val.unwrap());
+			m_storage.insert(i, val.unwrap());
 			val = value_iter.unwrap()->next();
 			++i;
 		}
@@ -455,7 +452,7 @@ PyResult<std::monostate> PyList::__setitem__(PyObject *index, PyObject *value)
 		type_error("list indices must be integers or slices, not {}", index->type()->name()));
 }
 
-PyResult<size_t> PyList::__len__() const { return Ok(m_elements.size()); }
+PyResult<size_t> PyList::__len__() const { return Ok(m_storage.size()); }
 
 PyResult<PyObject *> PyList::__add__(const PyObject *other) const
 {
@@ -464,12 +461,10 @@ PyResult<PyObject *> PyList::__add__(const PyObject *other) const
 			type_error("can only concatenate list (not \"{}\") to list", other->type()->name()));
 	}
 	const auto &other_list = static_cast<const PyList &>(*other);
-	auto result = PyList::create(this->elements());
+	auto result = PyList::create(m_storage);
 	if (result.is_err()) { return result; }
 
-	result.unwrap()->elements().insert(result.unwrap()->elements().end(),
-		other_list.elements().begin(),
-		other_list.elements().end());
+	result.unwrap()->m_storage.extend(other_list.m_storage);
 
 	return result;
 }
@@ -477,13 +472,11 @@ PyResult<PyObject *> PyList::__add__(const PyObject *other) const
 PyResult<PyObject *> PyList::__mul__(size_t count) const
 {
 	if (count <= 0) { return PyList::create(); }
-	std::vector<Value> values;
-	values.reserve(count * m_elements.size());
-	for (auto _ : std::views::iota(size_t{ 0 }, count)) {
-		values.insert(values.end(), m_elements.begin(), m_elements.end());
-	}
+	auto storage = m_storage;
+	storage.reserve(count * m_storage.size());
+	for (auto _ : std::views::iota(size_t{ 1 }, count)) { storage.extend(m_storage); }
 
-	return PyList::create(std::move(values));
+	return PyList::create(std::move(storage));
 }
 
 PyResult<PyObject *> PyList::__eq__(const PyObject *other) const
@@ -494,19 +487,19 @@ PyResult<PyObject *> PyList::__eq__(const PyObject *other) const
 	// Value contains PyObject* so we can't just compare vectors with std::vector::operator==
 	// otherwise if we compare PyObject* with PyObject* we compare the pointers, rather
 	// than PyObject::__eq__(const PyObject*)
-	if (m_elements.size() != other_list->elements().size()) { return Ok(py_false()); }
+	if (m_storage.size() != other_list->m_storage.size()) { return Ok(py_false()); }
+	if (auto *ints = m_storage.as_ints(); ints && other_list->m_storage.as_ints()) {
+		return Ok(*ints == *other_list->m_storage.as_ints() ? py_true() : py_false());
+	}
 	auto &interpreter = VirtualMachine::the().interpreter();
-	const bool result = std::equal(m_elements.begin(),
-		m_elements.end(),
-		other_list->elements().begin(),
-		[&interpreter](const auto &lhs, const auto &rhs) -> bool {
-			const auto &result = equals(lhs, rhs, interpreter);
-			ASSERT(result.is_ok())
-			auto is_true = truthy(result.unwrap(), interpreter);
-			ASSERT(is_true.is_ok())
-			return is_true.unwrap();
-		});
-	return Ok(result ? py_true() : py_false());
+	for (size_t i = 0; i < m_storage.size(); ++i) {
+		const auto &result = equals(m_storage[i], other_list->m_storage[i], interpreter);
+		ASSERT(result.is_ok())
+		auto is_true = truthy(result.unwrap(), interpreter);
+		ASSERT(is_true.is_ok())
+		if (!is_true.unwrap()) { return Ok(py_false()); }
+	}
+	return Ok(py_true());
 }
 
 PyResult<PyObject *> PyList::__reversed__() const
@@ -514,33 +507,45 @@ PyResult<PyObject *> PyList::__reversed__() const
 	return PyListReverseIterator::create(*const_cast<PyList *>(this));
 }
 
-PyResult<PyObject *> PyList::sort()
-{
-	PyResult<PyObject *> result = Ok(py_none());
-	std::sort(m_elements.begin(),
-		m_elements.end(),
-		[&result](const Value &lhs, const Value &rhs) -> bool {
-			if (auto cmp = less_than(lhs, rhs, VirtualMachine::the().interpreter()); cmp.is_ok()) {
-				auto is_true = truthy(cmp.unwrap(), VirtualMachine::the().interpreter());
-				if (is_true.is_err()) {
-					result = Err(is_true.unwrap_err());
-					return true;
-				}
-				return is_true.unwrap();
-			} else {
-				return false;
-			}
-		});
-
-	return result;
+PyResult<PyObject *> PyList::sort(PyObject *key, bool reverse)
+{
+	// the elements are sorted in a list that Python code cannot reach, so that a key function or
+	// a comparison that modifies this list cannot invalidate the sort
+	auto sorting_ = PyList::create();
+	if (sorting_.is_err()) { return sorting_; }
+	auto *sorting = sorting_.unwrap();
+	std::swap(sorting->m_storage, m_storage);
+
+	if (key == py_none()) { key = nullptr; }
+	auto &storage = sorting->m_storage;
+	auto result = [&]() -> PyResult<std::monostate> {
+		if (!key && storage.as_ints()) { return list_sort(*storage.as_ints(), reverse); }
+		if (!key && storage.as_floats()) { return list_sort(*storage.as_floats(), reverse); }
+		if (auto *objects = storage.as_objects()) { return list_sort(*objects, key, reverse); }
+		// the key function sees the boxed elements, which are then unboxed again
+		auto elements = PyList::create(storage.values());
+		if (elements.is_err()) { return Err(elements.unwrap_err()); }
+		auto &objects = elements.unwrap()->m_storage.generalize();
+		auto sorted = list_sort(objects, key, reverse);
+		if (sorted.is_ok()) { storage = ListStorage{ objects }; }
+		return sorted;
+	}();
+
+	const bool modified = !m_storage.empty();
+	std::swap(sorting->m_storage, m_storage);
+	if (result.is_err()) { return Err(result.unwrap_err()); }
+	if (modified) { return Err(value_error("list modified during sort")); }
+	return Ok(py_none());
 }
 
 void PyList::visit_graph(Visitor &visitor)
 {
 	PyObject::visit_graph(visitor);
-	for (auto &el : m_elements) {
-		if (std::holds_alternative<PyObject *>(el)) {
-			if (std::get<PyObject *>(el) != this) visitor.visit(*std::get<PyObject *>(el));
+	if (auto *elements = m_storage.as_objects()) {
+		for (auto &el : *elements) {
+			if (std::holds_alternative<PyObject *>(el)) {
+				if (std::get<PyObject *>(el) != this) visitor.visit(*std::get<PyObject *>(el));
+			}
 		}
 	}
 }
@@ -569,7 +574,37 @@ namespace {
 						if (result.is_err()) return Err(result.unwrap_err());
 						return static_cast<PyList *>(self)->pop(std::get<0>(result.unwrap()));
 					})
-				.def("sort", &PyList::sort)
+				.def(
+					"sort",
+					+[](PyObject *self, PyTuple *args, PyDict *kwargs) -> PyResult<PyObject *> {
+						if (args && !args->elements().empty()) {
+							return Err(type_error("sort() takes no positional arguments"));
+						}
+						PyObject *key = nullptr;
+						bool reverse = false;
+						if (kwargs) {
+							for (const auto &[name, value] : kwargs->map()) {
+								auto name_ = PyObject::from(name);
+								if (name_.is_err()) { return name_; }
+								const auto name_str = name_.unwrap()->to_string();
+								if (name_str == "key") {
+									auto key_ = PyObject::from(value);
+									if (key_.is_err()) { return key_; }
+									key = key_.unwrap();
+								} else if (name_str == "reverse") {
+									auto reverse_ =
+										truthy(value, VirtualMachine::the().interpreter());
+									if (reverse_.is_err()) { return Err(reverse_.unwrap_err()); }
+									reverse = reverse_.unwrap();
+								} else {
+									return Err(
+										type_error("'{}' is an invalid keyword argument for sort()",
+											name_str));
+								}
+							}
+						}
+						return static_cast<PyList *>(self)->sort(key, reverse);
+					})
 				.classmethod(
 					"__class_getitem__",
 					+[](PyType *type, PyTuple *args, PyDict *kwargs) {
@@ -614,12 +649,14 @@ void PyListIterator::visit_graph(Visitor &visitor)
 
 PyResult<PyObject *> PyListIterator::__repr__() const { return PyString::create(to_string()); }
 
-PyResult<PyObject *> PyListIterator::__next__()
+PyResult<PyObject *> PyListIterator::__next__() { return next_from_iternext(iternext()); }
+
+PyResult<std::optional<Value>> PyListIterator::iternext()
 {
-	if (m_current_index < m_pylist.elements().size())
-		return std::visit([](const auto &element) { return PyObject::from(element); },
-			m_pylist.elements()[m_current_index++]);
-	return Err(stop_iteration());
+	if (m_current_index < m_pylist.storage().size()) {
+		return Ok(std::optional<Value>{ m_pylist.storage()[m_current_index++] });
+	}
+	return Ok(std::optional<Value>{});
 }
 
 PyType *PyListIterator::static_type() const { return types::list_iterator(); }
@@ -652,7 +689,7 @@ PyListReverseIterator::PyListReverseIterator(PyList &pylist, size_t start_index)
 
 PyResult<PyListReverseIterator *> PyListReverseIterator::create(PyList &lst)
 {
-	auto list_size = lst.elements().size();
+	auto list_size = lst.storage().size();
 	auto *result = VirtualMachine::the().heap().allocate<PyListReverseIterator>(lst, list_size - 1);
 	if (!result) { return Err(memory_error(sizeof(PyListReverseIterator))); }
 	return Ok(result);
@@ -670,14 +707,19 @@ PyResult<PyObject *> PyListReverseIterator::__iter__() const
 }
 
 PyResult<PyObject *> PyListReverseIterator::__next__()
+{
+	return next_from_iternext(iternext());
+}
+
+PyResult<std::optional<Value>> PyListReverseIterator::iternext()
 {
 	if (m_pylist.has_value()) {
-		if (m_current_index < m_pylist->get().elements().size())
-			return std::visit([](const auto &element) { return PyObject::from(element); },
-				m_pylist->get().elements()[m_current_index--]);
+		if (m_current_index < m_pylist->get().storage().size()) {
+			return Ok(std::optional<Value>{ m_pylist->get().storage()[m_current_index--] });
+		}
 		m_pylist = std::nullopt;
 	}
-	return Err(stop_iteration());
+	return Ok(std::optional<Value>{});
 }
 
 PyType *PyListReverseIterator::static_type() const { return types::list_reverseiterator(); }
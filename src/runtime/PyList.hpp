@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ListStorage.hpp"
 #include "PyObject.hpp"
 
 namespace py {
@@ -10,13 +11,14 @@ class PyList
 {
 	friend class ::Heap;
 
-	std::vector<Value> m_elements;
+	ListStorage m_storage;
 
 	PyList(PyType *);
 
   public:
 	static PyResult<PyList *> create(std::vector<Value> elements);
 	static PyResult<PyList *> create(std::span<const Value> elements);
+	static PyResult<PyList *> create(ListStorage storage);
 	static PyResult<PyList *> create();
 
 	std::string to_string() const override;
@@ -37,8 +39,12 @@ class PyList
 	PyResult<PyObject *> __mul__(size_t count) const;
 	PyResult<PyObject *> __eq__(const PyObject *other) const;
 
-	const std::vector<Value> &elements() const { return m_elements; }
-	std::vector<Value> &elements() { return m_elements; }
+	// switches the list to the object strategy and returns its elements. Use storage() to read or
+	// append elements without giving up the unboxed strategies
+	std::vector<Value> &as_object_storage() { return m_storage.generalize(); }
+
+	const ListStorage &storage() const { return m_storage; }
+	ListStorage &storage() { return m_storage; }
 
 	void visit_graph(Visitor &) override;
 
@@ -49,14 +55,15 @@ class PyList
 	PyResult<PyObject *> __class_getitem__(PyType *cls, PyObject *args);
 	PyResult<PyObject *> __reversed__() const;
 
-	PyResult<PyObject *> sort();
+	// stable sort by key(element), see list_sort
+	PyResult<PyObject *> sort(PyObject *key, bool reverse);
 
 	static std::function<std::unique_ptr<TypePrototype>()> type_factory();
 	PyType *static_type() const override;
 
   private:
 	PyList();
-	PyList(std::vector<Value> elements);
+	PyList(ListStorage storage);
 };
 
 
@@ -76,6 +83,7 @@ class PyListIterator : public PyBaseObject
 
 	PyResult<PyObject *> __repr__() const;
 	PyResult<PyObject *> __next__();
+	PyResult<std::optional<Value>> iternext();
 
 	static std::function<std::unique_ptr<TypePrototype>()> type_factory();
 	PyType *static_type() const override;
@@ -100,6 +108,7 @@ class PyListReverseIterator : public PyBaseObject
 
 	PyResult<PyObject *> __iter__() const;
 	PyResult<PyObject *> __next__();
+	PyResult<std::optional<Value>> iternext();
 
 	static std::function<std::unique_ptr<TypePrototype>()> type_factory();
 	PyType *static_type() const override;
@@ -41,10 +41,10 @@ PyResult<PyObject *> PyMap::__new__(const PyType *type, PyTuple *args, PyDict *k
 		});
 		if (iter_.is_err()) { return iter_; }
 		auto *iter = iter_.unwrap();
-		iters_list->elements().push_back(iter);
+		iters_list->storage().push_back(iter);
 	}
 
-	auto iters_ = PyTuple::create(iters_list->elements());
+	auto iters_ = PyTuple::create(iters_list->storage().values());
 	if (iters_.is_err()) { return iters_; }
 	auto *iters = iters_.unwrap();
 
@@ -71,10 +71,10 @@ PyResult<PyObject *> PyMap::__next__()
 		auto *iter = iter_.unwrap();
 		auto value = iter->next();
 		if (value.is_err()) { return value; }
-		args->elements().push_back(value.unwrap());
+		args->storage().push_back(value.unwrap());
 	}
 
-	auto args_tuple = PyTuple::create(args->elements());
+	auto args_tuple = PyTuple::create(args->storage().values());
 	if (args_tuple.is_err()) { return args_tuple; }
 	return m_func->call(args_tuple.unwrap(), nullptr);
 }
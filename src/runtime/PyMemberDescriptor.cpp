@@ -1,4 +1,5 @@
 #include "PyMemberDescriptor.hpp"
+#include "AttributeError.hpp"
 #include "MemoryError.hpp"
 #include "PyString.hpp"
 #include "PyType.hpp"
@@ -33,6 +34,11 @@ PyMemberDescriptor::PyMemberDescriptor(PyString *name,
 	  m_member_setter(std::move(setter))
 {}
 
+PyMemberDescriptor::PyMemberDescriptor(PyString *name, PyType *underlying_type, size_t offset)
+	: PyBaseObject(types::BuiltinTypes::the().member_descriptor()), m_name(name),
+	  m_underlying_type(underlying_type), m_offset(offset)
+{}
+
 PyResult<PyMemberDescriptor *> PyMemberDescriptor::create(PyString *name,
 	PyType *underlying_type,
 	std::function<PyResult<PyObject *>(PyObject *)> member,
@@ -44,6 +50,15 @@ PyResult<PyMemberDescriptor *> PyMemberDescriptor::create(PyString *name,
 	return Ok(obj);
 }
 
+PyResult<PyMemberDescriptor *>
+	PyMemberDescriptor::create(PyString *name, PyType *underlying_type, size_t offset)
+{
+	auto *obj =
+		VirtualMachine::the().heap().allocate<PyMemberDescriptor>(name, underlying_type, offset);
+	if (!obj) { return Err(memory_error(sizeof(PyMemberDescriptor))); }
+	return Ok(obj);
+}
+
 void PyMemberDescriptor::visit_graph(Visitor &visitor)
 {
 	PyObject::visit_graph(visitor);
@@ -72,6 +87,16 @@ PyResult<PyObject *> PyMemberDescriptor::__get__(PyObject *instance, PyObject *
 				instance->type()->underlying_type().__name__));
 	}
 
+	if (m_offset.has_value()) {
+		auto *value = *bit_cast<PyObject **>(bit_cast<uint8_t *>(instance) + *m_offset);
+		if (!value) {
+			return Err(attribute_error("'{}' object has no attribute '{}'",
+				instance->type()->name(),
+				m_name->value()));
+		}
+		return Ok(value);
+	}
+
 	return m_member_accessor(instance);
 }
 
@@ -84,6 +109,11 @@ PyResult<std::monostate> PyMemberDescriptor::__set__(PyObject *obj, PyObject *va
 			obj->type()->underlying_type().__name__));
 	}
 
+	if (m_offset.has_value()) {
+		*bit_cast<PyObject **>(bit_cast<uint8_t *>(obj) + *m_offset) = value;
+		return Ok(std::monostate{});
+	}
+
 	return m_member_setter(obj, value);
 }
 
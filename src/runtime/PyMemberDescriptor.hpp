@@ -11,6 +11,9 @@ class PyMemberDescriptor : public PyBaseObject
 	PyType *m_underlying_type;
 	std::function<PyResult<PyObject *>(PyObject *)> m_member_accessor;
 	std::function<PyResult<std::monostate>(PyObject *, PyObject *)> m_member_setter;
+	// members that store a __slots__ entry are read and written directly at this offset from the
+	// start of the instance, instead of going through the accessor functions
+	std::optional<size_t> m_offset;
 
 	friend class ::Heap;
 
@@ -21,12 +24,17 @@ class PyMemberDescriptor : public PyBaseObject
 		std::function<PyResult<PyObject *>(PyObject *)> member,
 		std::function<PyResult<std::monostate>(PyObject *, PyObject *)> member_setter);
 
+	PyMemberDescriptor(PyString *name, PyType *underlying_type, size_t offset);
+
   public:
 	static PyResult<PyMemberDescriptor *> create(PyString *name,
 		PyType *underlying_type,
 		std::function<PyResult<PyObject *>(PyObject *)> member,
 		std::function<PyResult<std::monostate>(PyObject *, PyObject *)> member_setter);
 
+	static PyResult<PyMemberDescriptor *>
+		create(PyString *name, PyType *underlying_type, size_t offset);
+
 	PyString *name() { return m_name; }
 
 	std::string to_string() const override;
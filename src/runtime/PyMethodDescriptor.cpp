@@ -77,6 +77,33 @@ PyResult<PyObject *> PyMethodDescriptor::__call__(PyTuple *args, PyDict *kwargs)
 	return m_method->get().method(self, args, kwargs);
 }
 
+PyResult<PyObject *> PyMethodDescriptor::vectorcall(std::span<const Value> args,
+	std::span<const std::string_view> kwnames)
+{
+	if (args.size() == kwnames.size()) {
+		return Err(type_error("descriptor '{}' of '{}' object needs an argument",
+			m_name->value(),
+			m_underlying_type->name()));
+	}
+	auto self_ = PyObject::from(args[0]);
+	if (self_.is_err()) return self_;
+	auto *self = self_.unwrap();
+	if (self->type() != m_underlying_type && !self->type()->issubclass(m_underlying_type)) {
+		return Err(
+			type_error("descriptor '{}' for '{}' objects "
+					   "doesn't apply to a '{}' object",
+				m_name->value(),
+				m_underlying_type->underlying_type().__name__,
+				self->type()->underlying_type().__name__));
+	}
+
+	ASSERT(m_method);
+	return pack_vector_args(args.subspan(1), kwnames)
+		.and_then([this, self](std::pair<PyTuple *, PyDict *> args) {
+			return m_method->get().method(self, args.first, args.second);
+		});
+}
+
 PyResult<PyObject *> PyMethodDescriptor::__get__(PyObject *instance, PyObject * /*owner*/) const
 {
 	if (!instance) { return Ok(const_cast<PyMethodDescriptor *>(this)); }
@@ -48,6 +48,9 @@ class PyMethodDescriptor : public PyBaseObject
 
 	PyResult<PyObject *> __repr__() const;
 	PyResult<PyObject *> __call__(PyTuple *args, PyDict *kwargs);
+	// the first positional argument is self
+	PyResult<PyObject *> vectorcall(std::span<const Value> args,
+		std::span<const std::string_view> kwnames);
 	PyResult<PyObject *> __get__(PyObject *, PyObject *) const;
 
 	void visit_graph(Visitor &visitor) override;
@@ -34,7 +34,13 @@ const PyNumber *PyNumber::as_number(const PyObject *obj)
 PyResult<PyObject *> PyNumber::__abs__() const
 {
 	return PyNumber::create(
-		std::visit(overloaded{ [](const auto &val) { return Number{ std::abs(val) }; },
+		std::visit(overloaded{ [](const double &val) { return Number{ std::abs(val) }; },
+					   [](const int64_t &val) {
+						   if (val == std::numeric_limits<int64_t>::min()) [[unlikely]] {
+							   return Number{ -BigIntType{ static_cast<long>(val) } };
+						   }
+						   return Number{ std::abs(val) };
+					   },
 					   [](const mpz_class &val) {
 						   mpz_class result{};
 						   mpz_abs(result.get_mpz_t(), val.get_mpz_t());
@@ -45,8 +51,18 @@ PyResult<PyObject *> PyNumber::__abs__() const
 
 PyResult<PyObject *> PyNumber::__neg__() const
 {
-	return PyNumber::create(
-		std::visit([](const auto &val) { return Number{ -val }; }, m_value.value));
+	return PyNumber::create(std::visit(
+		overloaded{
+			[](const int64_t &val) {
+				int64_t result;
+				if (__builtin_sub_overflow(int64_t{ 0 }, val, &result)) [[unlikely]] {
+					return Number{ -BigIntType{ static_cast<long>(val) } };
+				}
+				return Number{ result };
+			},
+			[](const auto &val) { return Number{ -val }; },
+		},
+		m_value.value));
 }
 
 PyResult<PyObject *> PyNumber::__pos__() const
@@ -60,6 +76,9 @@ PyResult<PyObject *> PyNumber::__invert__() const
 	if (std::holds_alternative<double>(m_value.value)) {
 		return Err(type_error("bad operand type for unary ~: 'float'"));
 	}
+	if (std::holds_alternative<int64_t>(m_value.value)) {
+		return PyNumber::create(Number{ ~std::get<int64_t>(m_value.value) });
+	}
 	return PyNumber::create(Number{ ~std::get<BigIntType>(m_value.value) });
 }
 
@@ -118,9 +137,9 @@ PyResult<PyObject *> PyNumber::__pow__(const PyObject *obj, const PyObject *modu
 			return Ok(not_implemented());
 		}
 		mpz_class result{};
-		mpz_class lhs = std::holds_alternative<BigIntType>( m_value.value) ? std::get<BigIntType>(m_value.value) : BigIntType{std::get<double>(m_value.value)};
-		mpz_class rhs = std::holds_alternative<BigIntType>( rhs_->value().value) ? std::get<BigIntType>(rhs_->value().value) : BigIntType{std::get<double>(rhs_->value().value)};
-		mpz_class modulo = std::holds_alternative<BigIntType>( modulo_->value().value) ? std::get<BigIntType>(modulo_->value().value) : BigIntType{std::get<double>(modulo_->value().value)};
+		mpz_class lhs = m_value.is_integer() ? m_value.as_big_int() : BigIntType{std::get<double>(m_value.value)};
+		mpz_class rhs = rhs_->value().is_integer() ? rhs_->value().as_big_int() : BigIntType{std::get<double>(rhs_->value().value)};
+		mpz_class modulo = modulo_->value().is_integer() ? modulo_->value().as_big_int() : BigIntType{std::get<double>(modulo_->value().value)};
 		mpz_powm(result.get_mpz_t(), lhs.get_mpz_t(), rhs.get_mpz_t(), modulo.get_mpz_t());
 
 		return PyNumber::create(Number{result});
@@ -225,6 +244,8 @@ PyResult<bool> PyNumber::__bool__() const
 {
 	if (std::holds_alternative<double>(m_value.value)) {
 		return Ok(std::fpclassify(std::get<double>(m_value.value)) != FP_ZERO);
+	} else if (std::holds_alternative<int64_t>(m_value.value)) {
+		return Ok(std::get<int64_t>(m_value.value) != 0);
 	} else {
 		return Ok(static_cast<bool>(std::get<BigIntType>(m_value.value)));
 	}
@@ -234,6 +255,8 @@ PyResult<PyNumber *> PyNumber::create(const Number &number)
 {
 	if (std::holds_alternative<double>(number.value)) {
 		return PyFloat::create(std::get<double>(number.value));
+	} else if (std::holds_alternative<int64_t>(number.value)) {
+		return PyInteger::create(std::get<int64_t>(number.value));
 	} else {
 		return PyInteger::create(std::get<mpz_class>(number.value));
 	}
@@ -9,4 +9,62 @@ TEST(PyNumber, SatisfiesRelevantConcepts)
 {
 	// ASSERT_TRUE(HasAdd<PyNumber>);
 	// ASSERT_TRUE(HasRepr<PyNumber>);
-}
\ No newline at end of file
+}
+
+TEST(PyNumber, IntegerArithmeticPromotesOnOverflow)
+{
+	const Number max{ std::numeric_limits<int64_t>::max() };
+	const Number min{ std::numeric_limits<int64_t>::min() };
+
+	const auto sum = max + Number{ 1 };
+	ASSERT_TRUE(std::holds_alternative<BigIntType>(sum.value));
+	EXPECT_EQ(std::get<BigIntType>(sum.value), BigIntType{ "9223372036854775808" });
+
+	const auto difference = min - Number{ 1 };
+	ASSERT_TRUE(std::holds_alternative<BigIntType>(difference.value));
+	EXPECT_EQ(std::get<BigIntType>(difference.value), BigIntType{ "-9223372036854775809" });
+
+	const auto product = max * Number{ 2 };
+	ASSERT_TRUE(std::holds_alternative<BigIntType>(product.value));
+	EXPECT_EQ(std::get<BigIntType>(product.value), BigIntType{ "18446744073709551614" });
+
+	const auto power = Number{ 2 }.exp(Number{ 64 });
+	ASSERT_TRUE(std::holds_alternative<BigIntType>(power.value));
+	EXPECT_EQ(std::get<BigIntType>(power.value), BigIntType{ "18446744073709551616" });
+
+	const auto shifted = Number{ 1 } << Number{ 63 };
+	ASSERT_TRUE(std::holds_alternative<BigIntType>(shifted.value));
+	EXPECT_EQ(std::get<BigIntType>(shifted.value), BigIntType{ "9223372036854775808" });
+
+	const auto quotient = min.floordiv(Number{ -1 });
+	ASSERT_TRUE(std::holds_alternative<BigIntType>(quotient.value));
+	EXPECT_EQ(std::get<BigIntType>(quotient.value), BigIntType{ "9223372036854775808" });
+}
+
+TEST(PyNumber, BigIntegersAreDemotedWhenTheyFit)
+{
+	const Number big{ BigIntType{ "9223372036854775808" } };
+	ASSERT_TRUE(std::holds_alternative<BigIntType>(big.value));
+
+	const auto result = big - Number{ 1 };
+	ASSERT_TRUE(std::holds_alternative<int64_t>(result.value));
+	EXPECT_EQ(std::get<int64_t>(result.value), std::numeric_limits<int64_t>::max());
+	EXPECT_EQ(result, Number{ std::numeric_limits<int64_t>::max() });
+}
+
+TEST(PyNumber, IntegerDivisionRoundsTowardsNegativeInfinity)
+{
+	EXPECT_EQ(Number{ 7 }.floordiv(Number{ 2 }), Number{ 3 });
+	EXPECT_EQ(Number{ -7 }.floordiv(Number{ 2 }), Number{ -4 });
+	EXPECT_EQ(Number{ 7 }.floordiv(Number{ -2 }), Number{ -4 });
+	EXPECT_EQ(Number{ -7 }.floordiv(Number{ -2 }), Number{ 3 });
+
+	EXPECT_EQ(Number{ 7 } % Number{ 3 }, Number{ 1 });
+	EXPECT_EQ(Number{ -7 } % Number{ 3 }, Number{ 2 });
+	EXPECT_EQ(Number{ 7 } % Number{ -3 }, Number{ -2 });
+	EXPECT_EQ(Number{ -7 } % Number{ -3 }, Number{ -1 });
+
+	const Number big{ BigIntType{ "-100000000000000000000" } };
+	EXPECT_EQ(big.floordiv(Number{ 3 }), Number{ BigIntType{ "-33333333333333333334" } });
+	EXPECT_EQ(big % Number{ 3 }, Number{ 2 });
+}
@@ -4,12 +4,15 @@
 #include "NotImplemented.hpp"
 #include "NotImplementedError.hpp"
 #include "PyBool.hpp"
+#include "PyBoundMethod.hpp"
 #include "PyBytes.hpp"
 #include "PyDict.hpp"
 #include "PyEllipsis.hpp"
+#include "PyFunction.hpp"
 #include "PyGenericAlias.hpp"
 #include "PyInteger.hpp"
 #include "PyIterator.hpp"
+#include "PyMethodDescriptor.hpp"
 #include "PyNone.hpp"
 #include "PyNumber.hpp"
 #include "PySlotWrapper.hpp"
@@ -17,6 +20,7 @@
 #include "PyString.hpp"
 #include "PyTuple.hpp"
 #include "PyType.hpp"
+#include "Shape.hpp"
 #include "StopIteration.hpp"
 #include "TypeError.hpp"
 #include "types/api.hpp"
@@ -62,10 +66,12 @@ size_t ValueHash::operator()(const Value &value) const
 		overloaded{ [](const Number &number) -> size_t {
 					   if (std::holds_alternative<double>(number.value)) {
 						   return std::hash<double>{}(std::get<double>(number.value));
+					   } else if (std::holds_alternative<int64_t>(number.value)) {
+						   if (std::get<int64_t>(number.value) == -1) return -2;
+						   return std::get<int64_t>(number.value);
 					   } else {
-						   if (std::get<BigIntType>(number.value) == -1) return -2;
-						   ASSERT(std::get<BigIntType>(number.value).fits_ulong_p());
-						   return std::get<BigIntType>(number.value).get_ui();
+						   return mpz_fdiv_ui(std::get<BigIntType>(number.value).get_mpz_t(),
+							   PyInteger::kBigIntHashModulus);
 					   }
 				   },
 			[](const String &s) -> size_t { return std::hash<std::string>{}(s.s); },
@@ -94,7 +100,9 @@ namespace {
 	{
 		if constexpr (std::is_base_of_v<PyObject,
 						  typename std::remove_pointer_t<typename std::remove_cvref_t<T>>>) {
-			return value;
+			// a missing object, such as the instance passed to __get__ when the attribute is
+			// looked up on the type, is None in Python land
+			return static_cast<const PyObject *>(value ? value : py_none());
 		} else {
 			return PyObject::from(value).unwrap();
 		}
@@ -111,13 +119,12 @@ namespace {
 		if (std::holds_alternative<SlotFunctionType>(slot)) {
 			return std::get<SlotFunctionType>(slot)(self, args, kwargs);
 		} else if (std::holds_alternative<PyObject *>(slot)) {
-			std::vector<Value> args_;
-			args_.reserve(args->size() + 1);
-			args_.push_back(self);
-			args_.insert(args_.end(), args->elements().begin(), args->elements().end());
-			return PyTuple::create(args_).and_then([&slot, kwargs](PyTuple *args) -> ResultType {
-				return std::get<PyObject *>(slot)->call(args, kwargs);
-			});
+			return call_with_vector_args(args,
+				kwargs,
+				[&slot, self](std::span<const Value> args,
+					std::span<const std::string_view> kwnames) -> ResultType {
+					return call_with_self(std::get<PyObject *>(slot), self, args, kwnames);
+				});
 		} else {
 			TODO();
 		}
@@ -136,11 +143,9 @@ namespace {
 			//		  PyObject constness (right?). But for the internal calls handled above
 			//		  which are resolved in the C++ runtime, we want to enforce constness
 			//		  so we end up with the awkward line below. But how could we do better?
-			auto args = PyTuple::create(const_cast<PyObject *>(
-				static_cast<const PyObject *>(to_object(std::forward<Args>(args_))))...);
-			if (args.is_err()) { return Err(args.unwrap_err()); }
-			PyDict *kwargs = nullptr;
-			return std::get<PyObject *>(slot)->call(args.unwrap(), kwargs);
+			const std::array<Value, sizeof...(Args)> args{ const_cast<PyObject *>(
+				static_cast<const PyObject *>(to_object(std::forward<Args>(args_))))... };
+			return std::get<PyObject *>(slot)->vectorcall(args);
 		} else {
 			TODO();
 		}
@@ -163,26 +168,24 @@ namespace {
 			//		  PyObject constness (right?). But for the internal calls handled above
 			//		  which are resolved in the C++ runtime, we want to enforce constness
 			//		  so we end up with the awkward line below. But how could we do better?
-			auto args = PyTuple::create(const_cast<PyObject *>(
-				static_cast<const PyObject *>(to_object(std::forward<Args>(args_))))...);
-			if (args.is_err()) { return Err(args.unwrap_err()); }
-			PyDict *kwargs = nullptr;
+			const std::array<Value, sizeof...(Args)> args{ const_cast<PyObject *>(
+				static_cast<const PyObject *>(to_object(std::forward<Args>(args_))))... };
 			if constexpr (std::is_same_v<typename ResultType::OkType, bool>) {
-				auto result = callable->call(args.unwrap(), kwargs);
+				auto result = callable->vectorcall(args);
 				if (result.is_err()) return Err(result.unwrap_err());
 				if (!as<PyBool>(result.unwrap())) {
 					return Err(type_error(std::string(conversion_error_message)));
 				}
 				return Ok(as<PyBool>(result.unwrap())->value());
 			} else if constexpr (std::is_integral_v<typename ResultType::OkType>) {
-				auto result = callable->call(args.unwrap(), kwargs);
+				auto result = callable->vectorcall(args);
 				if (result.is_err()) return Err(result.unwrap_err());
 				if (!as<PyInteger>(result.unwrap())) {
 					return Err(type_error(std::string(conversion_error_message)));
 				}
 				return Ok(as<PyInteger>(result.unwrap())->as_i64());
 			} else if constexpr (std::is_same_v<typename ResultType::OkType, std::monostate>) {
-				auto result = callable->call(args.unwrap(), kwargs);
+				auto result = callable->vectorcall(args);
 				if (result.is_err()) {
 					return Err(result.unwrap_err());
 				} else {
@@ -195,12 +198,106 @@ namespace {
 			TODO();
 		}
 	}
+
+	template<typename FunctionPointerType, typename SlotFunctionType>
+	FunctionPointerType slot_table_entry(
+		const std::optional<std::variant<SlotFunctionType, PyObject *>> &slot,
+		FunctionPointerType trampoline)
+	{
+		if (!slot.has_value()) { return nullptr; }
+		if (std::holds_alternative<SlotFunctionType>(*slot)) {
+			if (auto *fn = std::get<SlotFunctionType>(*slot).template target<FunctionPointerType>()) {
+				return *fn;
+			}
+		}
+		return trampoline;
+	}
 }// namespace
 
+SlotTable SlotTable::create(const TypePrototype &type)
+{
+	SlotTable table;
+	table.hash = slot_table_entry(type.__hash__, +[](const PyObject *self) {
+		return call_slot(
+			*self->type_prototype().__hash__, "__hash__ method should return an integer", self);
+	});
+	table.eq = slot_table_entry(type.__eq__, +[](const PyObject *self, const PyObject *other) {
+		return call_slot(*self->type_prototype().__eq__, self, other);
+	});
+	table.ne = slot_table_entry(type.__ne__, +[](const PyObject *self, const PyObject *other) {
+		return call_slot(*self->type_prototype().__ne__, self, other);
+	});
+	table.lt = slot_table_entry(type.__lt__, +[](const PyObject *self, const PyObject *other) {
+		return call_slot(*self->type_prototype().__lt__, self, other);
+	});
+	table.le = slot_table_entry(type.__le__, +[](const PyObject *self, const PyObject *other) {
+		return call_slot(*self->type_prototype().__le__, self, other);
+	});
+	table.gt = slot_table_entry(type.__gt__, +[](const PyObject *self, const PyObject *other) {
+		return call_slot(*self->type_prototype().__gt__, self, other);
+	});
+	table.ge = slot_table_entry(type.__ge__, +[](const PyObject *self, const PyObject *other) {
+		return call_slot(*self->type_prototype().__ge__, self, other);
+	});
+	table.add = slot_table_entry(type.__add__, +[](const PyObject *self, const PyObject *other) {
+		return call_slot(*self->type_prototype().__add__, self, other);
+	});
+	table.sub = slot_table_entry(type.__sub__, +[](const PyObject *self, const PyObject *other) {
+		return call_slot(*self->type_prototype().__sub__, self, other);
+	});
+	table.mul = slot_table_entry(type.__mul__, +[](const PyObject *self, const PyObject *other) {
+		return call_slot(*self->type_prototype().__mul__, self, other);
+	});
+	if (type.mapping_type_protocol.has_value()) {
+		table.getitem = slot_table_entry(
+			type.mapping_type_protocol->__getitem__, +[](PyObject *self, PyObject *key) {
+				return call_slot(*self->type_prototype().mapping_type_protocol->__getitem__,
+					self,
+					key);
+			});
+		table.len =
+			slot_table_entry(type.mapping_type_protocol->__len__, +[](const PyObject *self) {
+				return call_slot(*self->type_prototype().mapping_type_protocol->__len__,
+					"object cannot be interpreted as an integer",
+					self);
+			});
+	}
+	table.bool_ = slot_table_entry(type.__bool__, +[](const PyObject *self) {
+		return call_slot(*self->type_prototype().__bool__, "__bool__ should return bool", self);
+	});
+	table.iter = slot_table_entry(type.__iter__, +[](const PyObject *self) {
+		return call_slot(*self->type_prototype().__iter__, self);
+	});
+	table.repr = slot_table_entry(type.__repr__, +[](const PyObject *self) {
+		return call_slot(*self->type_prototype().__repr__, self);
+	});
+	return table;
+}
+
+void SlotTable::fill_missing(const SlotTable &other)
+{
+	if (!hash) { hash = other.hash; }
+	if (!eq) { eq = other.eq; }
+	if (!ne) { ne = other.ne; }
+	if (!lt) { lt = other.lt; }
+	if (!le) { le = other.le; }
+	if (!gt) { gt = other.gt; }
+	if (!ge) { ge = other.ge; }
+	if (!add) { add = other.add; }
+	if (!sub) { sub = other.sub; }
+	if (!mul) { mul = other.mul; }
+	if (!getitem) { getitem = other.getitem; }
+	if (!len) { len = other.len; }
+	if (!bool_) { bool_ = other.bool_; }
+	if (!iter) { iter = other.iter; }
+	if (!repr) { repr = other.repr; }
+}
+
 
 PyResult<size_t> PyMappingWrapper::len()
 {
 	ASSERT(m_object->type_prototype().mapping_type_protocol.has_value());
+	if (auto len_fn = m_object->type_prototype().slot_table.len) { return len_fn(m_object); }
 	if (m_object->type_prototype().mapping_type_protocol->__len__.has_value()) {
 		return call_slot(*m_object->type_prototype().mapping_type_protocol->__len__,
 			"object cannot be interpreted as an integer",
@@ -401,10 +498,34 @@ PyObject::PyObject(PyType *type) : Cell(), m_type(type) { ASSERT(type); }
 
 const TypePrototype &PyObject::type_prototype() const { return type()->underlying_type(); }
 
+ShapeAttributes **PyObject::shape_attributes_slot() const
+{
+	if (m_attributes) { return nullptr; }
+	const auto offset = type_prototype().instance_attributes_offset;
+	if (offset == 0) { return nullptr; }
+	return bit_cast<ShapeAttributes **>(bit_cast<uint8_t *>(this) + offset);
+}
+
+ShapeAttributes *PyObject::shape_attributes() const
+{
+	if (auto **slot = shape_attributes_slot()) { return *slot; }
+	return nullptr;
+}
+
+const Shape *PyObject::shape() const
+{
+	// an object that has shape storage but no attributes yet doesn't have a ShapeAttributes either
+	if (auto **slot = shape_attributes_slot()) { return *slot ? (*slot)->shape() : Shape::root(); }
+	return nullptr;
+}
+
 void PyObject::visit_graph(Visitor &visitor)
 {
 	if (m_attributes) { visitor.visit(*m_attributes); }
-	for (size_t i = 0, offset = type()->underlying_type().basicsize; i < type()->__slots__.size();
+	if (auto *attributes = shape_attributes()) { visitor.visit(*attributes); }
+	const auto &prototype = type_prototype();
+	for (size_t i = 0, offset = prototype.basicsize - prototype.slot_count * sizeof(PyObject *);
+		 i < prototype.slot_count;
 		 ++i, offset += sizeof(PyObject *)) {
 		auto *slot = *bit_cast<PyObject **>(bit_cast<uint8_t *>(this) + offset);
 		if (slot) { visitor.visit(*slot); }
@@ -543,6 +664,20 @@ PyResult<PyObject *> PyObject::richcompare(const PyObject *other, RichCompare op
 	}
 }
 
+namespace {
+	PyResult<PyObject *> call_eq(const PyObject *self, const PyObject *other)
+	{
+		if (auto eq_fn = self->type_prototype().slot_table.eq) { return eq_fn(self, other); }
+		return call_slot(*self->type_prototype().__eq__, self, other);
+	}
+
+	PyResult<PyObject *> call_ne(const PyObject *self, const PyObject *other)
+	{
+		if (auto ne_fn = self->type_prototype().slot_table.ne) { return ne_fn(self, other); }
+		return call_slot(*self->type_prototype().__ne__, self, other);
+	}
+}// namespace
+
 PyResult<PyObject *> PyObject::eq(const PyObject *other) const
 {
 	if (this == other) { return Ok(py_true()); }
@@ -550,19 +685,19 @@ PyResult<PyObject *> PyObject::eq(const PyObject *other) const
 	if (type() != other->type() && other->type()->issubclass(type())
 		&& other->type()->underlying_type().__eq__.has_value()) {
 		checked_reverse_op = true;
-		if (auto result = call_slot(*other->type()->underlying_type().__eq__, other, this);
+		if (auto result = call_eq(other, this);
 			result.is_err() || (result.is_ok() && result.unwrap() != not_implemented())) {
 			return result;
 		}
 	}
 	if (type_prototype().__eq__.has_value()) {
-		if (auto result = call_slot(*type_prototype().__eq__, this, other);
+		if (auto result = call_eq(this, other);
 			result.is_err() || (result.is_ok() && result.unwrap() != not_implemented())) {
 			return result;
 		}
 	}
 	if (!checked_reverse_op && other->type()->underlying_type().__eq__.has_value()) {
-		if (auto result = call_slot(*other->type()->underlying_type().__eq__, other, this);
+		if (auto result = call_eq(other, this);
 			result.is_err() || (result.is_ok() && result.unwrap() != not_implemented())) {
 			return result;
 		}
@@ -572,6 +707,7 @@ PyResult<PyObject *> PyObject::eq(const PyObject *other) const
 
 PyResult<PyObject *> PyObject::ge(const PyObject *other) const
 {
+	if (auto ge_fn = type_prototype().slot_table.ge) { return ge_fn(this, other); }
 	if (type_prototype().__ge__.has_value()) {
 		return call_slot(*type_prototype().__ge__, this, other);
 	}
@@ -580,6 +716,7 @@ PyResult<PyObject *> PyObject::ge(const PyObject *other) const
 
 PyResult<PyObject *> PyObject::gt(const PyObject *other) const
 {
+	if (auto gt_fn = type_prototype().slot_table.gt) { return gt_fn(this, other); }
 	if (type_prototype().__gt__.has_value()) {
 		return call_slot(*type_prototype().__gt__, this, other);
 	}
@@ -588,6 +725,7 @@ PyResult<PyObject *> PyObject::gt(const PyObject *other) const
 
 PyResult<PyObject *> PyObject::le(const PyObject *other) const
 {
+	if (auto le_fn = type_prototype().slot_table.le) { return le_fn(this, other); }
 	if (type_prototype().__le__.has_value()) {
 		return call_slot(*type_prototype().__le__, this, other);
 	}
@@ -596,6 +734,7 @@ PyResult<PyObject *> PyObject::le(const PyObject *other) const
 
 PyResult<PyObject *> PyObject::lt(const PyObject *other) const
 {
+	if (auto lt_fn = type_prototype().slot_table.lt) { return lt_fn(this, other); }
 	if (type_prototype().__lt__.has_value()) {
 		return call_slot(*type_prototype().__lt__, this, other);
 	}
@@ -609,19 +748,19 @@ PyResult<PyObject *> PyObject::ne(const PyObject *other) const
 	if (type() != other->type() && other->type()->issubclass(type())
 		&& other->type()->underlying_type().__ne__.has_value()) {
 		checked_reverse_op = true;
-		if (auto result = call_slot(*other->type()->underlying_type().__ne__, other, this);
+		if (auto result = call_ne(other, this);
 			result.is_err() || (result.is_ok() && result.unwrap() != not_implemented())) {
 			return result;
 		}
 	}
 	if (type_prototype().__ne__.has_value()) {
-		if (auto result = call_slot(*type_prototype().__ne__, this, other);
+		if (auto result = call_ne(this, other);
 			result.is_err() || (result.is_ok() && result.unwrap() != not_implemented())) {
 			return result;
 		}
 	}
 	if (!checked_reverse_op && other->type()->underlying_type().__ne__.has_value()) {
-		if (auto result = call_slot(*other->type()->underlying_type().__ne__, other, this);
+		if (auto result = call_ne(other, this);
 			result.is_err() || (result.is_ok() && result.unwrap() != not_implemented())) {
 			return result;
 		}
@@ -662,7 +801,8 @@ PyResult<std::monostate> PyObject::setattribute(PyObject *attribute, PyObject *v
 PyResult<PyString *> PyObject::repr() const
 {
 	if (type_prototype().__repr__.has_value()) {
-		return call_slot(*type_prototype().__repr__, this)
+		auto repr_fn = type_prototype().slot_table.repr;
+		return (repr_fn ? repr_fn(this) : call_slot(*type_prototype().__repr__, this))
 			.and_then([](PyObject *str) -> PyResult<PyString *> {
 				if (!as<PyString>(str)) {
 					return Err(
@@ -695,6 +835,7 @@ PyResult<PyString *> PyObject::str()
 
 PyResult<int64_t> PyObject::hash() const
 {
+	if (auto hash_fn = type_prototype().slot_table.hash) { return hash_fn(this); }
 	if (type_prototype().__hash__.has_value()) {
 		return call_slot(
 			*type_prototype().__hash__, "__hash__ method should return an integer", this);
@@ -711,9 +852,86 @@ PyResult<PyObject *> PyObject::call(PyTuple *args, PyDict *kwargs)
 	return Err(type_error("'{}' object is not callable", type_prototype().__name__));
 }
 
+PyResult<PyObject *> PyObject::vectorcall(std::span<const Value> args,
+	std::span<const std::string_view> kwnames)
+{
+	ASSERT(kwnames.size() <= args.size());
+	if (auto *function = as<PyFunction>(this)) { return function->vectorcall(args, kwnames); }
+	if (auto *method = as<PyBoundMethod>(this)) { return method->vectorcall(args, kwnames); }
+	if (auto *descriptor = as<PyMethodDescriptor>(this)) {
+		return descriptor->vectorcall(args, kwnames);
+	}
+	if (auto *native_function = as<PyNativeFunction>(this)) {
+		return native_function->vectorcall(args, kwnames);
+	}
+	// only instances of `type` itself, a metaclass may override __call__
+	if (type() == types::type()) { return static_cast<PyType *>(this)->vectorcall(args, kwnames); }
+
+	return pack_vector_args(args, kwnames).and_then([this](std::pair<PyTuple *, PyDict *> args) {
+		return call(args.first, args.second);
+	});
+}
+
+PyResult<std::span<const Value>> unpack_vector_args(PyTuple *args,
+	PyDict *kwargs,
+	std::optional<ArgumentBuffer> &buffer,
+	std::vector<std::string_view> &kwnames)
+{
+	if (!kwargs || kwargs->map().empty()) {
+		if (!args) { return Ok(std::span<const Value>{}); }
+		return Ok(std::span<const Value>{ args->elements() });
+	}
+
+	const size_t args_count = args ? args->size() : 0;
+	auto &args_ = buffer.emplace(args_count + kwargs->size());
+	kwnames.reserve(kwargs->size());
+	for (size_t i = 0; i < args_count; ++i) { args_[i] = args->elements()[i]; }
+	size_t idx = args_count;
+	for (const auto &[key, value] : kwargs->map()) {
+		if (std::holds_alternative<String>(key)) {
+			kwnames.push_back(std::get<String>(key).s);
+		} else if (auto *key_str = as<PyString>(PyObject::from(key).unwrap())) {
+			kwnames.push_back(key_str->value());
+		} else {
+			return Err(type_error("keywords must be strings"));
+		}
+		args_[idx++] = value;
+	}
+	return Ok(args_.values());
+}
+
+PyResult<std::pair<PyTuple *, PyDict *>> pack_vector_args(std::span<const Value> args,
+	std::span<const std::string_view> kwnames)
+{
+	const size_t args_count = args.size() - kwnames.size();
+	auto args_tuple = PyTuple::create(std::vector<Value>{ args.begin(), args.begin() + args_count });
+	if (args_tuple.is_err()) { return Err(args_tuple.unwrap_err()); }
+	if (kwnames.empty()) { return Ok(std::make_pair(args_tuple.unwrap(), nullptr)); }
+
+	PyDict::MapType map;
+	for (size_t i = 0; i < kwnames.size(); ++i) {
+		map.insert_or_assign(String{ std::string{ kwnames[i] } }, args[args_count + i]);
+	}
+	auto kwargs_dict = PyDict::create(std::move(map));
+	if (kwargs_dict.is_err()) { return Err(kwargs_dict.unwrap_err()); }
+	return Ok(std::make_pair(args_tuple.unwrap(), kwargs_dict.unwrap()));
+}
+
+PyResult<PyObject *> call_with_self(PyObject *callable,
+	PyObject *self,
+	std::span<const Value> args,
+	std::span<const std::string_view> kwnames)
+{
+	ArgumentBuffer args_{ args.size() + 1 };
+	args_[0] = self;
+	for (size_t i = 0; i < args.size(); ++i) { args_[i + 1] = args[i]; }
+	return callable->vectorcall(args_.values(), kwnames);
+}
+
 
 PyResult<PyObject *> PyObject::add(const PyObject *other) const
 {
+	if (auto add_fn = type_prototype().slot_table.add) { return add_fn(this, other); }
 	if (type_prototype().__add__.has_value()) {
 		return call_slot(*type_prototype().__add__, this, other);
 	} else if (other->type_prototype().__add__.has_value()) {
@@ -728,6 +946,7 @@ PyResult<PyObject *> PyObject::add(const PyObject *other) const
 
 PyResult<PyObject *> PyObject::subtract(const PyObject *other) const
 {
+	if (auto sub_fn = type_prototype().slot_table.sub) { return sub_fn(this, other); }
 	if (type_prototype().__sub__.has_value()) {
 		return call_slot(*type_prototype().__sub__, this, other);
 	}
@@ -738,7 +957,12 @@ PyResult<PyObject *> PyObject::subtract(const PyObject *other) const
 
 PyResult<PyObject *> PyObject::multiply(const PyObject *other) const
 {
-	if (type_prototype().__mul__.has_value()) {
+	if (auto mul_fn = type_prototype().slot_table.mul) {
+		auto result = mul_fn(this, other);
+		if (result.is_err() || (result.is_ok() && result.unwrap() != not_implemented())) {
+			return result;
+		}
+	} else if (type_prototype().__mul__.has_value()) {
 		auto result = call_slot(*type_prototype().__mul__, this, other);
 		if (result.is_err() || (result.is_ok() && result.unwrap() != not_implemented())) {
 			return result;
@@ -936,6 +1160,7 @@ PyResult<PyObject *> PyObject::invert() const
 
 PyResult<bool> PyObject::true_()
 {
+	if (auto bool_fn = type_prototype().slot_table.bool_) { return bool_fn(this); }
 	if (type_prototype().__bool__.has_value()) {
 		return call_slot(*type_prototype().__bool__, "__bool__ should return bool", this);
 	} else if (auto mapping = as_mapping();
@@ -953,6 +1178,7 @@ PyResult<bool> PyObject::true_()
 
 PyResult<PyObject *> PyObject::iter() const
 {
+	if (auto iter_fn = type_prototype().slot_table.iter) { return iter_fn(this); }
 	if (type_prototype().__iter__.has_value()) {
 		return call_slot(*type_prototype().__iter__, this);
 	}
@@ -974,6 +1200,26 @@ PyResult<PyObject *> PyObject::next()
 	return Err(type_error("'{}' object is not an iterator", type()->name()));
 }
 
+PyResult<std::optional<Value>> PyObject::try_next()
+{
+	if (auto iternext = type_prototype().iternext) { return iternext(this); }
+
+	auto value = next();
+	if (value.is_ok()) { return Ok(std::optional<Value>{ value.unwrap() }); }
+	if (value.unwrap_err()->type()->issubclass(StopIteration::class_type())) {
+		return Ok(std::optional<Value>{});
+	}
+	return Err(value.unwrap_err());
+}
+
+PyResult<PyObject *> PyObject::next_from_iternext(PyResult<std::optional<Value>> value)
+{
+	if (value.is_err()) { return Err(value.unwrap_err()); }
+	auto next_value = value.unwrap();
+	if (!next_value.has_value()) { return Err(stop_iteration()); }
+	return PyObject::from(*next_value);
+}
+
 PyResult<PyObject *> PyObject::get(PyObject *instance, PyObject *owner) const
 {
 	if (type_prototype().__get__.has_value()) {
@@ -1022,14 +1268,12 @@ PyResult<int32_t> PyObject::init(PyTuple *args, PyDict *kwargs)
 		if (std::holds_alternative<InitSlotFunctionType>(*type_prototype().__init__)) {
 			return std::get<InitSlotFunctionType>(*type_prototype().__init__)(this, args, kwargs);
 		} else {
-			std::vector<Value> new_args;
-			new_args.reserve(args->size() + 1);
-			new_args.push_back(this);
-			new_args.insert(new_args.end(), args->elements().begin(), args->elements().end());
-			auto args_ = PyTuple::create(new_args);
-			if (args_.is_err()) return Err(args_.unwrap_err());
-			auto result =
-				std::get<PyObject *>(*type_prototype().__init__)->call(args_.unwrap(), kwargs);
+			auto *init = std::get<PyObject *>(*type_prototype().__init__);
+			auto result = call_with_vector_args(args,
+				kwargs,
+				[this, init](std::span<const Value> args, std::span<const std::string_view> kwnames) {
+					return call_with_self(init, this, args, kwnames);
+				});
 			if (result.is_err()) return Err(result.unwrap_err());
 			if (auto *obj = result.unwrap(); obj != py_none()) {
 				return Err(type_error(
@@ -1041,8 +1285,28 @@ PyResult<int32_t> PyObject::init(PyTuple *args, PyDict *kwargs)
 	TODO();
 }
 
+PyResult<int32_t> PyObject::init(std::span<const Value> args,
+	std::span<const std::string_view> kwnames)
+{
+	if (type_prototype().__init__.has_value()
+		&& std::holds_alternative<PyObject *>(*type_prototype().__init__)) {
+		auto *init = std::get<PyObject *>(*type_prototype().__init__);
+		auto result = call_with_self(init, this, args, kwnames);
+		if (result.is_err()) return Err(result.unwrap_err());
+		if (auto *obj = result.unwrap(); obj != py_none()) {
+			return Err(
+				type_error("__init__() should return None, not '{}'", obj->type()->to_string()));
+		}
+		return Ok(0);
+	}
+	auto args_ = pack_vector_args(args, kwnames);
+	if (args_.is_err()) return Err(args_.unwrap_err());
+	return init(args_.unwrap().first, args_.unwrap().second);
+}
+
 PyResult<PyObject *> PyObject::getitem(PyObject *key)
 {
+	if (auto getitem_fn = type_prototype().slot_table.getitem) { return getitem_fn(this, key); }
 	if (as_mapping().is_ok() && type_prototype().mapping_type_protocol->__getitem__.has_value()) {
 		return call_slot(*type_prototype().mapping_type_protocol->__getitem__, this, key);
 	} else if (as_sequence().is_ok()
@@ -1116,11 +1380,13 @@ PyResult<PyObject *> PyObject::__eq__(const PyObject *other) const
 PyResult<PyObject *> PyObject::__ne__(const PyObject *other) const
 {
 	if (!type_prototype().__eq__.has_value()) { return Ok(not_implemented()); }
-	return call_slot(*type_prototype().__eq__, this, other).and_then([](PyObject *obj) {
-		return truthy(obj, VirtualMachine::the().interpreter()).and_then([](bool value) {
-			return Ok(value ? py_true() : py_false());
+	return call_slot(*type_prototype().__eq__, this, other)
+		.and_then([](PyObject *obj) -> PyResult<PyObject *> {
+			if (obj == not_implemented()) { return Ok(obj); }
+			return truthy(obj, VirtualMachine::the().interpreter()).and_then([](bool value) {
+				return Ok(value ? py_false() : py_true());
+			});
 		});
-	});
 }
 
 PyResult<PyObject *> PyObject::__getattribute__(PyObject *attribute) const
@@ -1151,6 +1417,8 @@ PyResult<PyObject *> PyObject::__getattribute__(PyObject *attribute) const
 		if (auto it = dict.find(name); it != dict.end()) { return PyObject::from(it->second); }
 		// FIXME: we should abort here if PyDict returns an exception that is not an
 		// AttributeError
+	} else if (auto *attributes = shape_attributes()) {
+		if (const auto *value = attributes->find(name->value())) { return PyObject::from(*value); }
 	}
 
 	if (descriptor_.has_value() && descriptor_has_get) {
@@ -1242,6 +1510,10 @@ PyResult<PyObject *> PyObject::get_method(PyObject *name) const
 	if (m_attributes) {
 		const auto &dict = m_attributes->map();
 		if (auto it = dict.find(name); it != dict.end()) { return PyObject::from(it->second); }
+	} else if (auto *attributes = shape_attributes(); attributes && as<PyString>(name)) {
+		if (const auto *value = attributes->find(as<PyString>(name)->value())) {
+			return PyObject::from(*value);
+		}
 	}
 
 	if (descriptor_.has_value() && method_found) {
@@ -1254,6 +1526,41 @@ PyResult<PyObject *> PyObject::get_method(PyObject *name) const
 		"'{}' object has no attribute '{}'", type_prototype().__name__, name->to_string()));
 }
 
+PyResult<std::pair<PyObject *, bool>> PyObject::get_unbound_method(PyObject *name) const
+{
+	const auto &getattribute_ = type()->underlying_type().__getattribute__;
+	const bool default_getattribute =
+		getattribute_.has_value()
+		&& get_address(*getattribute_)
+			   == get_address(*types::object()->underlying_type().__getattribute__);
+
+	if (default_getattribute && as<PyString>(name)) {
+		auto descriptor_ = type()->lookup(name);
+		if (descriptor_.has_value() && descriptor_->is_err()) {
+			return Err(descriptor_->unwrap_err());
+		}
+		if (descriptor_.has_value()) {
+			auto *descriptor = descriptor_->unwrap();
+			if (descriptor->type() == types::function()
+				|| descriptor->type() == types::method_wrapper()) {
+				// functions are non-data descriptors, so they are shadowed by instance attributes
+				const bool shadowed = [this, name]() {
+					if (m_attributes) { return m_attributes->map().contains(name); }
+					if (auto *attributes = shape_attributes()) {
+						return attributes->find(as<PyString>(name)->value()) != nullptr;
+					}
+					return false;
+				}();
+				if (!shadowed) { return Ok(std::pair{ descriptor, true }); }
+			}
+		}
+	}
+
+	return get_method(name).and_then([](PyObject *method) {
+		return Ok(std::pair{ method, false });
+	});
+}
+
 PyResult<std::monostate> PyObject::__setattribute__(PyObject *attribute, PyObject *value)
 {
 	if (!as<PyString>(attribute)) {
@@ -1271,6 +1578,23 @@ PyResult<std::monostate> PyObject::__setattribute__(PyObject *attribute, PyObjec
 		}
 	}
 
+	if (auto **attributes = shape_attributes_slot()) {
+		if (!*attributes) {
+			*attributes = VirtualMachine::the().heap().allocate<ShapeAttributes>();
+			if (!*attributes) { return Err(memory_error(sizeof(ShapeAttributes))); }
+		}
+		if ((*attributes)->set(as<PyString>(attribute)->value(), value)) {
+			return Ok(std::monostate{});
+		}
+		// the shape transition tree is full, so this object has to use a dictionary from now on
+		if (auto dict = instance_dict(); dict.is_err()) { return Err(dict.unwrap_err()); }
+	} else if (!m_attributes && type()->underlying_type().is_heaptype
+			   && type()->underlying_type().has_instance_dict) {
+		// instances of heap types without room for a ShapeAttributes pointer, e.g. subclasses of
+		// builtins other than object, create their attribute dictionary on the first assignment
+		if (auto dict = instance_dict(); dict.is_err()) { return Err(dict.unwrap_err()); }
+	}
+
 	if (!m_attributes) {
 		if (descriptor_.has_value() && descriptor_->is_ok()) {
 			return Err(attribute_error(
@@ -1286,6 +1610,22 @@ PyResult<std::monostate> PyObject::__setattribute__(PyObject *attribute, PyObjec
 	return Ok(std::monostate{});
 }
 
+PyResult<PyDict *> PyObject::instance_dict()
+{
+	if (m_attributes) { return Ok(m_attributes); }
+	auto dict = PyDict::create();
+	if (dict.is_err()) { return dict; }
+	if (auto **attributes = shape_attributes_slot(); attributes && *attributes) {
+		const auto &keys = (*attributes)->shape()->keys();
+		for (size_t i = 0; i < keys.size(); ++i) {
+			dict.unwrap()->insert(String{ keys[i] }, (**attributes)[i]);
+		}
+		*attributes = nullptr;
+	}
+	m_attributes = dict.unwrap();
+	return dict;
+}
+
 PyResult<int64_t> PyObject::__hash__() const { return Ok(bit_cast<size_t>(this) >> 4); }
 
 bool PyObject::is_callable() const { return type_prototype().__call__.has_value(); }
@@ -1411,6 +1751,11 @@ std::function<std::unique_ptr<TypePrototype>()> PyObject::type_factory()
 }
 
 namespace detail {
-	size_t slot_count(PyType *t) { return t->__slots__.size(); }
+	size_t extra_bytes(PyType *t)
+	{
+		const auto &prototype = t->underlying_type();
+		return prototype.slot_count * sizeof(PyObject *)
+			   + (prototype.instance_attributes_offset > 0 ? sizeof(ShapeAttributes *) : 0);
+	}
 }// namespace detail
 }// namespace py
@@ -8,10 +8,13 @@
 #include "runtime/forward.hpp"
 #include "vm/VM.hpp"
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 
 #include <spdlog/fmt/fmt.h>
 
@@ -27,6 +30,8 @@ enum class RichCompare {
 };
 
 class PyObject;
+class Shape;
+class ShapeAttributes;
 
 class MethodFlags
 {
@@ -85,6 +90,12 @@ struct PropertyDefinition
 };
 
 using CallSlotFunctionType = std::function<PyResult<PyObject *>(PyObject *, PyTuple *, PyDict *)>;
+// Fast calling convention: `args` holds the positional arguments followed by the values of the
+// keyword arguments, whose names are listed (in the same order) in `kwnames`.
+// Native fast functions are stored as plain function pointers, so that calling them doesn't go
+// through std::function.
+using VectorCallFunctionType = PyResult<PyObject *> (*)(std::span<const Value> /* args */,
+	std::span<const std::string_view> /* kwnames */);
 using StrSlotFunctionType = std::function<PyResult<PyObject *>(PyObject *)>;
 using NewSlotFunctionType =
 	std::function<PyResult<PyObject *>(const PyType *, PyTuple *, PyDict *)>;
@@ -118,6 +129,9 @@ using ContainsSlotFunctionType = std::function<PyResult<bool>(PyObject *, PyObje
 using ReprSlotFunctionType = std::function<PyResult<PyObject *>(const PyObject *)>;
 using IterSlotFunctionType = std::function<PyResult<PyObject *>(const PyObject *)>;
 using NextSlotFunctionType = std::function<PyResult<PyObject *>(PyObject *)>;
+// Returns the next value of a builtin iterator, or std::nullopt when it is exhausted, so that
+// loops over builtin iterators never have to create a StopIteration
+using IterNextFunctionType = PyResult<std::optional<Value>> (*)(PyObject *);
 
 using AbsSlotFunctionType = std::function<PyResult<PyObject *>(const PyObject *)>;
 using NegSlotFunctionType = std::function<PyResult<PyObject *>(const PyObject *)>;
@@ -206,6 +220,45 @@ struct PyBufferProcs
 	std::function<PyResult<std::monostate>(PyObject *, PyBuffer &)> releasebuffer;
 };
 
+struct TypePrototype;
+
+// Raw function pointers for the slots dispatched on the hottest paths, packed into two cache lines.
+// The prototype remains the source of truth. Native types get a table generated at compile time by
+// TypePrototype::create (see native_slot_table), and only fill the entries it lacks once the type
+// is ready. Heap types build theirs at runtime with create(), where slots implemented in Python
+// point to a trampoline that calls through the prototype. An empty entry means that dispatch has
+// to go through the prototype.
+struct alignas(64) SlotTable
+{
+	using HashFunctionType = PyResult<int64_t> (*)(const PyObject *);
+	using BinaryFunctionType = PyResult<PyObject *> (*)(const PyObject *, const PyObject *);
+	using GetItemFunctionType = PyResult<PyObject *> (*)(PyObject *, PyObject *);
+	using LenFunctionType = PyResult<size_t> (*)(const PyObject *);
+	using BoolFunctionType = PyResult<bool> (*)(const PyObject *);
+	using UnaryFunctionType = PyResult<PyObject *> (*)(const PyObject *);
+
+	HashFunctionType hash{ nullptr };
+	BinaryFunctionType eq{ nullptr };
+	BinaryFunctionType ne{ nullptr };
+	BinaryFunctionType lt{ nullptr };
+	BinaryFunctionType le{ nullptr };
+	BinaryFunctionType gt{ nullptr };
+	BinaryFunctionType ge{ nullptr };
+	BinaryFunctionType add{ nullptr };
+	BinaryFunctionType sub{ nullptr };
+	BinaryFunctionType mul{ nullptr };
+	GetItemFunctionType getitem{ nullptr };
+	LenFunctionType len{ nullptr };
+	BoolFunctionType bool_{ nullptr };
+	UnaryFunctionType iter{ nullptr };
+	UnaryFunctionType repr{ nullptr };
+
+	static SlotTable create(const TypePrototype &);
+
+	// fills in the empty entries with the ones of `other`
+	void fill_missing(const SlotTable &other);
+};
+
 struct TypePrototype
 {
   private:
@@ -223,6 +276,16 @@ struct TypePrototype
   public:
 	std::string __name__;
 	size_t basicsize;
+	// Instances of heap types with __slots__ keep the slot values in the last `slot_count` pointers
+	// of the object body, including the slots inherited from heap type bases
+	size_t slot_count{ 0 };
+	// Whether instances of a heap type can have attributes besides their __slots__
+	bool has_instance_dict{ true };
+	// Instances of heap types that only derive from object start out without an attribute
+	// dictionary. They keep a ShapeAttributes pointer at this offset of the object body until the
+	// dictionary is materialized by PyObject::instance_dict(). Zero if instances have no such
+	// pointer.
+	size_t instance_attributes_offset{ 0 };
 
 	PyType *__base__{ nullptr };
 	std::vector<PyType *> __bases__{ nullptr };
@@ -267,6 +330,9 @@ struct TypePrototype
 	std::optional<std::variant<ReprSlotFunctionType, PyObject *>> __repr__;
 	std::optional<std::variant<IterSlotFunctionType, PyObject *>> __iter__;
 	std::optional<std::variant<NextSlotFunctionType, PyObject *>> __next__;
+	// only set by builtin iterators and never inherited, so a subclass that overrides __next__
+	// always goes through the slot above
+	IterNextFunctionType iternext{ nullptr };
 	std::optional<std::variant<HashSlotFunctionType, PyObject *>> __hash__;
 
 	std::optional<std::variant<CompareSlotFunctionType, PyObject *>> __eq__;
@@ -278,6 +344,9 @@ struct TypePrototype
 
 	std::optional<PyBufferProcs> as_buffer;
 
+	// rebuilt by PyType whenever the slots above change
+	SlotTable slot_table;
+
 	std::vector<MemberDefinition> __members__;
 	std::vector<PropertyDefinition> __getset__;
 	std::vector<MethodDefinition> __methods__;
@@ -316,6 +385,66 @@ size_t get_address(const std::variant<std::function<T(U...)>, PyObject *> &f)
 
 enum class LookupAttrResult { NOT_FOUND = 0, FOUND = 1 };
 
+// Contiguous storage for the arguments of a fast call that can't be passed straight from the
+// caller, e.g. when they are scattered across registers or when `self` has to be prepended.
+// Short argument lists are stored inline, so that the common case doesn't allocate.
+class ArgumentBuffer
+	: NonCopyable
+	, NonMoveable
+{
+	static constexpr size_t InlineCapacity = 8;
+
+	std::array<Value, InlineCapacity> m_inline;
+	std::vector<Value> m_overflow;
+	std::span<Value> m_values;
+
+  public:
+	explicit ArgumentBuffer(size_t size)
+	{
+		if (size <= InlineCapacity) {
+			m_values = std::span{ m_inline.data(), size };
+		} else {
+			m_overflow.resize(size);
+			m_values = std::span{ m_overflow };
+		}
+	}
+
+	Value &operator[](size_t idx) { return m_values[idx]; }
+	size_t size() const { return m_values.size(); }
+	std::span<const Value> values() const { return m_values; }
+};
+
+// Lays out the arguments of a tuple/dict call as expected by the fast calling convention. The
+// tuple elements are used in place when there are no keyword arguments, otherwise the arguments
+// are copied to `buffer` and the keyword names are appended to `kwnames`
+PyResult<std::span<const Value>> unpack_vector_args(PyTuple *args,
+	PyDict *kwargs,
+	std::optional<ArgumentBuffer> &buffer,
+	std::vector<std::string_view> &kwnames);
+
+// Unpacks the arguments of a tuple/dict call into the layout of the fast calling convention and
+// forwards them to `fn`
+template<typename FunctionType>
+PyResult<PyObject *> call_with_vector_args(PyTuple *args, PyDict *kwargs, FunctionType &&fn)
+{
+	std::optional<ArgumentBuffer> buffer;
+	std::vector<std::string_view> kwnames;
+	auto values = unpack_vector_args(args, kwargs, buffer, kwnames);
+	if (values.is_err()) { return Err(values.unwrap_err()); }
+	return fn(values.unwrap(), std::span<const std::string_view>{ kwnames });
+}
+
+// Packs the arguments of a fast call into an args tuple and a kwargs dict. The dict is nullptr if
+// there are no keyword arguments
+PyResult<std::pair<PyTuple *, PyDict *>> pack_vector_args(std::span<const Value> args,
+	std::span<const std::string_view> kwnames);
+
+// Calls `callable` with `self` prepended to the positional arguments
+PyResult<PyObject *> call_with_self(PyObject *callable,
+	PyObject *self,
+	std::span<const Value> args,
+	std::span<const std::string_view> kwnames);
+
 class PyMappingWrapper
 {
 	PyObject *m_object;
@@ -358,6 +487,11 @@ class PyObject : public Cell
 	std::variant<std::reference_wrapper<const TypePrototype>, PyType *> m_type;
 	PyDict *m_attributes{ nullptr };
 
+	// The location of the ShapeAttributes pointer in the object body, or nullptr if this object
+	// doesn't store its attributes in a ShapeAttributes
+	ShapeAttributes **shape_attributes_slot() const;
+	ShapeAttributes *shape_attributes() const;
+
   public:
 	PyObject() = delete;
 	PyObject(const TypePrototype &type);
@@ -419,10 +553,17 @@ class PyObject : public Cell
 	virtual PyResult<bool> true_();
 	PyResult<PyObject *> iter() const;
 	PyResult<PyObject *> next();
+	// like next(), but signals the end of the iteration with std::nullopt instead of StopIteration
+	PyResult<std::optional<Value>> try_next();
+	// implements __next__ for iterators that provide iternext()
+	static PyResult<PyObject *> next_from_iternext(PyResult<std::optional<Value>> value);
 
 	PyResult<PyObject *> call(PyTuple *args, PyDict *kwargs);
+	PyResult<PyObject *> vectorcall(std::span<const Value> args,
+		std::span<const std::string_view> kwnames = {});
 	virtual PyResult<PyObject *> new_(PyTuple *args, PyDict *kwargs) const;
 	PyResult<int32_t> init(PyTuple *args, PyDict *kwargs);
+	PyResult<int32_t> init(std::span<const Value> args, std::span<const std::string_view> kwnames);
 
 	PyResult<PyObject *> getitem(PyObject *key);
 	PyResult<PyObject *> getitem(size_t index);
@@ -446,7 +587,15 @@ class PyObject : public Cell
 	const TypePrototype &type_prototype() const;
 	const PyDict *attributes() const { return m_attributes; }
 	PyDict *attributes() { return m_attributes; }
+	const Shape *shape() const;
+	// Returns the attribute dictionary, moving the attributes out of the shape storage first if
+	// needed. From then on the dictionary is the only storage for the attributes of this object.
+	PyResult<PyDict *> instance_dict();
 	PyResult<PyObject *> get_method(PyObject *name) const;
+	// Like get_method(), but a plain function or method descriptor found on the type is returned
+	// unbound, with the second element set to true, so that the caller can pass this object as the
+	// first argument instead of allocating a bound method
+	PyResult<std::pair<PyObject *, bool>> get_unbound_method(PyObject *name) const;
 	PyResult<PyObject *> get_attribute(PyObject *name) const;
 	std::tuple<PyResult<PyObject *>, LookupAttrResult> lookup_attribute(PyObject *name) const;
 
@@ -468,8 +617,97 @@ template<> PyResult<PyObject *> PyObject::from(const Value &value);
 BaseException *memory_error(size_t failed_allocation_size);
 
 namespace detail {
-	size_t slot_count(PyType *);
-}
+	size_t extra_bytes(PyType *);
+
+	// The slot table of a native type, derived at compile time from the same concepts that
+	// TypePrototype::create uses to fill in the prototype slots.
+	template<typename Type> constexpr SlotTable native_slot_table()
+	{
+		using namespace concepts;
+
+		SlotTable table;
+		if constexpr (HasHash<Type>) {
+			table.hash = +[](const PyObject *self) -> PyResult<int64_t> {
+				return static_cast<const Type *>(self)->__hash__();
+			};
+		}
+		if constexpr (HasEq<Type>) {
+			table.eq = +[](const PyObject *self, const PyObject *other) -> PyResult<PyObject *> {
+				return static_cast<const Type *>(self)->__eq__(other);
+			};
+		}
+		if constexpr (HasNe<Type>) {
+			table.ne = +[](const PyObject *self, const PyObject *other) -> PyResult<PyObject *> {
+				return static_cast<const Type *>(self)->__ne__(other);
+			};
+		}
+		if constexpr (HasLt<Type>) {
+			table.lt = +[](const PyObject *self, const PyObject *other) -> PyResult<PyObject *> {
+				return static_cast<const Type *>(self)->__lt__(other);
+			};
+		}
+		if constexpr (HasLe<Type>) {
+			table.le = +[](const PyObject *self, const PyObject *other) -> PyResult<PyObject *> {
+				return static_cast<const Type *>(self)->__le__(other);
+			};
+		}
+		if constexpr (HasGt<Type>) {
+			table.gt = +[](const PyObject *self, const PyObject *other) -> PyResult<PyObject *> {
+				return static_cast<const Type *>(self)->__gt__(other);
+			};
+		}
+		if constexpr (HasGe<Type>) {
+			table.ge = +[](const PyObject *self, const PyObject *other) -> PyResult<PyObject *> {
+				return static_cast<const Type *>(self)->__ge__(other);
+			};
+		}
+		// sequences implement + and * with their concat and repeat slots
+		if constexpr (!std::is_base_of_v<PySequence, Type> && HasAdd<Type>) {
+			table.add = +[](const PyObject *self, const PyObject *other) -> PyResult<PyObject *> {
+				return static_cast<const Type *>(self)->__add__(other);
+			};
+		}
+		if constexpr (HasSub<Type>) {
+			table.sub = +[](const PyObject *self, const PyObject *other) -> PyResult<PyObject *> {
+				return static_cast<const Type *>(self)->__sub__(other);
+			};
+		}
+		if constexpr (!(std::is_base_of_v<PySequence, Type> && HasRepeat<Type>) && HasMul<Type>) {
+			table.mul = +[](const PyObject *self, const PyObject *other) -> PyResult<PyObject *> {
+				return static_cast<const Type *>(self)->__mul__(other);
+			};
+		}
+		if constexpr (HasGetItem<Type>) {
+			table.getitem = +[](PyObject *self, PyObject *name) -> PyResult<PyObject *> {
+				return static_cast<Type *>(self)->__getitem__(name);
+			};
+		}
+		if constexpr (HasLength<Type>) {
+			table.len = +[](const PyObject *self) -> PyResult<size_t> {
+				return static_cast<const Type *>(self)->__len__();
+			};
+		}
+		if constexpr (HasBool<Type>) {
+			table.bool_ = +[](const PyObject *self) -> PyResult<bool> {
+				return static_cast<const Type *>(self)->__bool__();
+			};
+		}
+		if constexpr (HasIter<Type>) {
+			table.iter = +[](const PyObject *self) -> PyResult<PyObject *> {
+				return static_cast<const Type *>(self)->__iter__();
+			};
+		}
+		if constexpr (HasRepr<Type>) {
+			table.repr = +[](const PyObject *self) -> PyResult<PyObject *> {
+				return static_cast<const Type *>(self)->__repr__();
+			};
+		}
+		return table;
+	}
+}// namespace detail
+
+template<typename Type>
+inline constexpr SlotTable native_slot_table = detail::native_slot_table<Type>();
 
 template<typename Type, typename... Args>
 std::unique_ptr<TypePrototype> TypePrototype::create(std::string_view name, Args &&...args)
@@ -482,9 +720,8 @@ std::unique_ptr<TypePrototype> TypePrototype::create(std::string_view name, Args
 	type_prototype->basicsize = sizeof(Type);
 	type_prototype->__alloc__ = [](PyType *t) -> PyResult<PyObject *> {
 		auto *obj = [t]() -> Type * {
-			if (const auto nslots = py::detail::slot_count(t); nslots > 0) {
-				return VirtualMachine::the().heap().allocate_with_extra_bytes<Type>(
-					nslots * sizeof(PyObject *), t);
+			if (const auto extra_bytes = py::detail::extra_bytes(t); extra_bytes > 0) {
+				return VirtualMachine::the().heap().allocate_with_extra_bytes<Type>(extra_bytes, t);
 			} else {
 				return VirtualMachine::the().heap().allocate<Type>(t);
 			};
@@ -567,6 +804,11 @@ std::unique_ptr<TypePrototype> TypePrototype::create(std::string_view name, Args
 			return static_cast<Type *>(self)->__next__();
 		};
 	}
+	if constexpr (HasIterNext<Type>) {
+		type_prototype->iternext = +[](PyObject *self) -> PyResult<std::optional<Value>> {
+			return static_cast<Type *>(self)->iternext();
+		};
+	}
 	if constexpr (HasLength<Type>) {
 		if (!type_prototype->mapping_type_protocol.has_value()) {
 			type_prototype->mapping_type_protocol =
@@ -842,6 +1084,8 @@ std::unique_ptr<TypePrototype> TypePrototype::create(std::string_view name, Args
 	type_prototype->traverse =
 		+[](PyObject *self, Cell::Visitor &visitor) { self->visit_graph(visitor); };
 
+	type_prototype->slot_table = native_slot_table<Type>;
+
 	return type_prototype;
 }
 
@@ -16,7 +16,55 @@
 
 namespace py {
 
-PyRange::PyRange(PyType *type) : PyBaseObject(type) {}
+namespace {
+	using Bounds = std::variant<PyRange::Int64Bounds, PyRange::BigIntBounds>;
+
+	Bounds make_bounds(const Number &start, const Number &stop, const Number &step)
+	{
+		if (std::holds_alternative<int64_t>(start.value)
+			&& std::holds_alternative<int64_t>(stop.value)
+			&& std::holds_alternative<int64_t>(step.value)) {
+			return PyRange::Int64Bounds{ std::get<int64_t>(start.value),
+				std::get<int64_t>(stop.value),
+				std::get<int64_t>(step.value) };
+		}
+		return PyRange::BigIntBounds{ start.as_big_int(), stop.as_big_int(), step.as_big_int() };
+	}
+
+	// The element count of an int64_t range always fits in an uint64_t. The arithmetic is done on
+	// unsigned values so that it cannot overflow, even for range(INT64_MIN, INT64_MAX).
+	uint64_t length(const PyRange::Int64Bounds &bounds)
+	{
+		const auto start = static_cast<uint64_t>(bounds.start);
+		const auto stop = static_cast<uint64_t>(bounds.stop);
+		const auto step = static_cast<uint64_t>(bounds.step);
+		if (bounds.step > 0 && bounds.start < bounds.stop) {
+			return (stop - start - 1) / step + 1;
+		} else if (bounds.step < 0 && bounds.start > bounds.stop) {
+			return (start - stop - 1) / (0 - step) + 1;
+		}
+		return 0;
+	}
+
+	BigIntType length(const PyRange::BigIntBounds &bounds)
+	{
+		if (bounds.step > 0 && bounds.start < bounds.stop) {
+			return (bounds.stop - bounds.start - 1) / bounds.step + 1;
+		} else if (bounds.step < 0 && bounds.start > bounds.stop) {
+			return (bounds.start - bounds.stop - 1) / (-bounds.step) + 1;
+		}
+		return 0;
+	}
+
+	// start + index * step, for an index that is known to be within the range
+	int64_t element_at(const PyRange::Int64Bounds &bounds, uint64_t index)
+	{
+		return static_cast<int64_t>(
+			static_cast<uint64_t>(bounds.start) + index * static_cast<uint64_t>(bounds.step));
+	}
+}// namespace
+
+PyRange::PyRange(PyType *type) : PyBaseObject(type), m_bounds(Int64Bounds{ 0, 0, 1 }) {}
 
 PyResult<PyObject *> PyRange::__new__(const PyType *type, PyTuple *args, PyDict *kwargs)
 {
@@ -74,6 +122,9 @@ PyResult<PyObject *> PyRange::__new__(const PyType *type, PyTuple *args, PyDict
 				return Err(type_error("'{}' object cannot be interpreted as an integer",
 					step_.unwrap()->type()->name()));
 			}
+			if (step->value() == Number{ 0 }) {
+				return Err(value_error("range() arg 3 must not be zero"));
+			}
 			return VirtualMachine::the().heap().allocate<PyRange>(start, stop, step);
 		}
 		ASSERT_NOT_REACHED();
@@ -85,34 +136,56 @@ PyResult<PyObject *> PyRange::__new__(const PyType *type, PyTuple *args, PyDict
 }
 
 PyRange::PyRange(BigIntType start, BigIntType stop, BigIntType step)
-	: PyBaseObject(types::BuiltinTypes::the().range()), m_start(start), m_stop(stop), m_step(step)
+	: PyBaseObject(types::BuiltinTypes::the().range()),
+	  m_bounds(make_bounds(
+		  Number{ std::move(start) }, Number{ std::move(stop) }, Number{ std::move(step) }))
+{}
+
+PyRange::PyRange(int64_t start, int64_t stop, int64_t step)
+	: PyBaseObject(types::BuiltinTypes::the().range()), m_bounds(Int64Bounds{ start, stop, step })
 {}
 
 PyRange::PyRange(PyInteger *stop)
 	: PyBaseObject(types::BuiltinTypes::the().range()),
-	  m_stop(std::get<BigIntType>(stop->value().value))
+	  m_bounds(make_bounds(Number{ 0 }, stop->value(), Number{ 1 }))
 {}
 
 PyRange::PyRange(PyInteger *start, PyInteger *stop)
 	: PyBaseObject(types::BuiltinTypes::the().range()),
-	  m_start(std::get<BigIntType>(start->value().value)),
-	  m_stop(std::get<BigIntType>(stop->value().value))
+	  m_bounds(make_bounds(start->value(), stop->value(), Number{ 1 }))
 {}
 
 PyRange::PyRange(PyInteger *start, PyInteger *stop, PyInteger *step)
 	: PyBaseObject(types::BuiltinTypes::the().range()),
-	  m_start(std::get<BigIntType>(start->value().value)),
-	  m_stop(std::get<BigIntType>(stop->value().value)),
-	  m_step(std::get<BigIntType>(step->value().value))
+	  m_bounds(make_bounds(start->value(), stop->value(), step->value()))
 {}
 
+BigIntType PyRange::start() const
+{
+	return std::visit([](const auto &bounds) { return BigIntType{ bounds.start }; }, m_bounds);
+}
+
+BigIntType PyRange::stop() const
+{
+	return std::visit([](const auto &bounds) { return BigIntType{ bounds.stop }; }, m_bounds);
+}
+
+BigIntType PyRange::step() const
+{
+	return std::visit([](const auto &bounds) { return BigIntType{ bounds.step }; }, m_bounds);
+}
+
 std::string PyRange::to_string() const
 {
-	if (m_step == 1) {
-		return fmt::format("range({}, {})", m_start, m_stop);
-	} else {
-		return fmt::format("range({}, {}, {})", m_start, m_stop, m_step);
-	}
+	return std::visit(
+		[](const auto &bounds) {
+			if (bounds.step == 1) {
+				return fmt::format("range({}, {})", bounds.start, bounds.stop);
+			} else {
+				return fmt::format("range({}, {}, {})", bounds.start, bounds.stop, bounds.step);
+			}
+		},
+		m_bounds);
 }
 
 PyResult<PyObject *> PyRange::__repr__() const { return PyString::create(to_string()); }
@@ -129,24 +202,51 @@ PyResult<PyObject *> PyRange::__reversed__() const
 {
 	// reversed(range(start, stop, step)) -> range(start+(n-1)*step, start-step, -step)
 	// where n is the number of integers in the range.
-	const BigIntType n = (m_stop - m_start) / m_step;
-	BigIntType start = m_start + (n - 1) * m_step;
-	BigIntType stop = m_start - m_step;
-	BigIntType step = -m_step;
-
-	auto *range = VirtualMachine::the().heap().allocate<PyRange>(start, stop, step);
+	auto *range = [this]() -> PyRange * {
+		if (auto *bounds = int64_bounds()) {
+			const auto n = length(*bounds);
+			int64_t stop;
+			if (n > 0 && bounds->step != std::numeric_limits<int64_t>::min()
+				&& !__builtin_sub_overflow(bounds->start, bounds->step, &stop)) {
+				return VirtualMachine::the().heap().allocate<PyRange>(
+					element_at(*bounds, n - 1), stop, -bounds->step);
+			}
+		}
+		const BigIntType start = this->start();
+		const BigIntType step = this->step();
+		const BigIntType n = length(BigIntBounds{ start, this->stop(), step });
+		return VirtualMachine::the().heap().allocate<PyRange>(
+			BigIntType{ start + (n - 1) * step }, BigIntType{ start - step }, BigIntType{ -step });
+	}();
 	if (!range) { return Err(memory_error(sizeof(PyRange))); }
 
 	return range->__iter__();
 }
 
-PyResult<PyObject *> PyRange::__getitem__(int64_t index_) const
+PyResult<PyObject *> PyRange::__getitem__(int64_t index) const
 {
-	BigIntType index = index_;
-	const BigIntType n = (m_stop - m_start) / m_step;
-	if (index < 0) { index += n; }
-	if (index >= n) { return Err(index_error("range object index out of range")); }
-	return PyInteger::create(m_start + m_step * index);
+	if (auto *bounds = int64_bounds()) {
+		const auto n = length(*bounds);
+		// an int64_t index is always within [-n, n) when it is in range, since n < 2**64
+		if (index < 0) {
+			const auto offset = 0 - static_cast<uint64_t>(index);
+			if (offset > n) { return Err(index_error("range object index out of range")); }
+			return PyInteger::create(element_at(*bounds, n - offset));
+		}
+		if (static_cast<uint64_t>(index) >= n) {
+			return Err(index_error("range object index out of range"));
+		}
+		return PyInteger::create(element_at(*bounds, static_cast<uint64_t>(index)));
+	}
+
+	const auto &bounds = std::get<BigIntBounds>(m_bounds);
+	BigIntType big_index = index;
+	const BigIntType n = length(bounds);
+	if (big_index < 0) { big_index += n; }
+	if (big_index < 0 || big_index >= n) {
+		return Err(index_error("range object index out of range"));
+	}
+	return PyInteger::create(BigIntType{ bounds.start + bounds.step * big_index });
 }
 
 PyResult<PyObject *> PyRange::__getitem__(PyObject *key) const
@@ -167,9 +267,11 @@ PyResult<PyObject *> PyRange::__getitem__(PyObject *key) const
 				   ? -1
 				   : stop;
 
-		BigIntType new_step = step * m_step;
-		BigIntType new_start = m_start + (start * m_step);
-		BigIntType new_stop = m_start + (stop * m_step);
+		const BigIntType range_start = this->start();
+		const BigIntType range_step = this->step();
+		BigIntType new_step = step * range_step;
+		BigIntType new_start = range_start + (start * range_step);
+		BigIntType new_stop = range_start + (stop * range_step);
 
 		auto *obj = VirtualMachine::the().heap().allocate<PyRange>(new_start, new_stop, new_step);
 		if (!obj) { return Err(memory_error(sizeof(PyRange))); }
@@ -203,9 +305,15 @@ std::function<std::unique_ptr<TypePrototype>()> PyRange::type_factory()
 
 
 PyRangeIterator::PyRangeIterator(const PyRange &pyrange)
-	: PyBaseObject(types::BuiltinTypes::the().range_iterator()), m_pyrange(pyrange),
-	  m_current_index(m_pyrange.start())
-{}
+	: PyBaseObject(types::BuiltinTypes::the().range_iterator()), m_pyrange(pyrange)
+{
+	if (auto *bounds = m_pyrange.int64_bounds()) {
+		m_next = bounds->start;
+		m_remaining = length(*bounds);
+	} else {
+		m_current_index = m_pyrange.start();
+	}
+}
 
 std::string PyRangeIterator::to_string() const
 {
@@ -214,21 +322,34 @@ std::string PyRangeIterator::to_string() const
 
 PyResult<PyObject *> PyRangeIterator::__repr__() const { return PyString::create(to_string()); }
 
-PyResult<PyObject *> PyRangeIterator::__next__()
+PyResult<PyObject *> PyRangeIterator::__next__() { return next_from_iternext(iternext()); }
+
+PyResult<std::optional<Value>> PyRangeIterator::iternext()
 {
-	auto within_range = [this](const BigIntType &current) {
-		if (m_pyrange.step() < 0) {
-			return current > m_pyrange.stop();
+	if (auto *bounds = m_pyrange.int64_bounds()) {
+		if (m_remaining == 0) { return Ok(std::optional<Value>{}); }
+		const auto value = m_next;
+		// wraps around after the last element, which is never read
+		m_next = static_cast<int64_t>(
+			static_cast<uint64_t>(m_next) + static_cast<uint64_t>(bounds->step));
+		m_remaining--;
+		return Ok(std::optional<Value>{ Number{ value } });
+	}
+
+	const auto &bounds = std::get<PyRange::BigIntBounds>(m_pyrange.m_bounds);
+	auto within_range = [&bounds](const BigIntType &current) {
+		if (bounds.step < 0) {
+			return current > bounds.stop;
 		} else {
-			return current < m_pyrange.stop();
+			return current < bounds.stop;
 		}
 	};
 	if (within_range(m_current_index)) {
-		auto result = PyNumber::from(Number{ m_current_index });
-		m_current_index += m_pyrange.step();
-		return result;
+		auto result = std::optional<Value>{ Number{ m_current_index } };
+		m_current_index += bounds.step;
+		return Ok(std::move(result));
 	}
-	return Err(stop_iteration());
+	return Ok(std::optional<Value>{});
 }
 
 PyResult<PyObject *> PyRangeIterator::__iter__() const
@@ -4,13 +4,32 @@
 
 namespace py {
 
+class PyRangeIterator;
+
 class PyRange : public PyBaseObject
 {
 	friend class ::Heap;
+	friend class PyRangeIterator;
 
-	const BigIntType m_start{ 0 };
-	const BigIntType m_stop;
-	const BigIntType m_step{ 1 };
+  public:
+	// Ranges whose bounds fit in an int64_t, which is almost all of them, are stored, indexed and
+	// iterated without touching GMP. Only ranges outside int64_t fall back to BigIntType bounds.
+	struct Int64Bounds
+	{
+		int64_t start;
+		int64_t stop;
+		int64_t step;
+	};
+
+	struct BigIntBounds
+	{
+		BigIntType start;
+		BigIntType stop;
+		BigIntType step;
+	};
+
+  private:
+	const std::variant<Int64Bounds, BigIntBounds> m_bounds;
 
 	PyRange(PyType *);
 
@@ -23,9 +42,11 @@ class PyRange : public PyBaseObject
 	PyResult<PyObject *> __getitem__(int64_t index) const;
 	PyResult<PyObject *> __getitem__(PyObject *key) const;
 
-	const BigIntType &start() const { return m_start; }
-	const BigIntType &stop() const { return m_stop; }
-	const BigIntType &step() const { return m_step; }
+	BigIntType start() const;
+	BigIntType stop() const;
+	BigIntType step() const;
+
+	const Int64Bounds *int64_bounds() const { return std::get_if<Int64Bounds>(&m_bounds); }
 
 	PyResult<PyObject *> __reversed__() const;
 
@@ -34,6 +55,7 @@ class PyRange : public PyBaseObject
 
   private:
 	PyRange(BigIntType start, BigIntType stop, BigIntType step);
+	PyRange(int64_t start, int64_t stop, int64_t step);
 	PyRange(PyInteger *stop);
 	PyRange(PyInteger *start, PyInteger *stop);
 	PyRange(PyInteger *start, PyInteger *stop, PyInteger *step);
@@ -45,6 +67,10 @@ class PyRangeIterator : public PyBaseObject
 	friend class ::Heap;
 
 	const PyRange &m_pyrange;
+	// iteration state of ranges with int64_t bounds
+	int64_t m_next{ 0 };
+	uint64_t m_remaining{ 0 };
+	// iteration state of ranges outside int64_t
 	BigIntType m_current_index;
 
   public:
@@ -54,6 +80,7 @@ class PyRangeIterator : public PyBaseObject
 
 	PyResult<PyObject *> __repr__() const;
 	PyResult<PyObject *> __next__();
+	PyResult<std::optional<Value>> iternext();
 	PyResult<PyObject *> __iter__() const;
 
 	static std::function<std::unique_ptr<TypePrototype>()> type_factory();
@@ -6,10 +6,12 @@
 #include "PyFrozenSet.hpp"
 #include "PyFunction.hpp"
 #include "PyInteger.hpp"
+#include "PyList.hpp"
 #include "PyNone.hpp"
 #include "PyNumber.hpp"
 #include "PyString.hpp"
 #include "PyTuple.hpp"
+#include "RuntimeError.hpp"
 #include "StopIteration.hpp"
 #include "interpreter/Interpreter.hpp"
 #include "runtime/NotImplementedError.hpp"
@@ -45,7 +47,7 @@ PySet::PySet(SetType elements) : PySet() { m_elements = std::move(elements); }
 
 PyResult<PySet *> PySet::create(SetType elements)
 {
-	auto *result = VirtualMachine::the().heap().allocate<PySet>(elements);
+	auto *result = VirtualMachine::the().heap().allocate<PySet>(std::move(elements));
 	if (!result) { return Err(memory_error(sizeof(PySet))); }
 	return Ok(result);
 }
@@ -82,6 +84,25 @@ PyResult<PyObject *> PySet::remove(PyObject *element)
 
 PyResult<PySet *> PySet::update(PyObject *others)
 {
+	// sized collections are inserted in bulk, without going through the iterator protocol
+	if (others->type()->issubclass(types::set())) {
+		m_elements.merge(static_cast<const PySet &>(*others).elements());
+		return Ok(this);
+	} else if (others->type()->issubclass(types::frozenset())) {
+		m_elements.merge(static_cast<const PyFrozenSet &>(*others).elements());
+		return Ok(this);
+	} else if (auto *tuple = as<PyTuple>(others)) {
+		m_elements.insert(tuple->elements().begin(), tuple->elements().end());
+		return Ok(this);
+	} else if (auto *list = as<PyList>(others)) {
+		// the list can be mutated by the __hash__ or __eq__ of its elements, so it is not iterated
+		// with iterators
+		const auto &elements = list->storage();
+		m_elements.reserve(m_elements.size() + elements.size());
+		for (size_t i = 0; i < elements.size(); ++i) { m_elements.insert(elements[i]); }
+		return Ok(this);
+	}
+
 	auto others_iterator = others->iter();
 	if (others_iterator.is_err()) { return Err(others_iterator.unwrap_err()); }
 
@@ -98,31 +119,85 @@ PyResult<PySet *> PySet::update(PyObject *others)
 	return Ok(this);
 }
 
+namespace {
+	const PySet::SetType *set_elements(const PyObject *obj)
+	{
+		if (obj->type()->issubclass(types::set())) {
+			return &static_cast<const PySet &>(*obj).elements();
+		} else if (obj->type()->issubclass(types::frozenset())) {
+			return &static_cast<const PyFrozenSet &>(*obj).elements();
+		}
+		return nullptr;
+	}
+
+	template<typename FunctionType>
+	PyResult<std::monostate> for_each_element(PyObject *iterable, FunctionType &&f)
+	{
+		auto iterator = iterable->iter();
+		if (iterator.is_err()) { return Err(iterator.unwrap_err()); }
+
+		auto value = iterator.unwrap()->next();
+		while (value.is_ok()) {
+			f(value.unwrap());
+			value = iterator.unwrap()->next();
+		}
+
+		if (!value.unwrap_err()->type()->issubclass(types::stop_iteration())) {
+			return Err(value.unwrap_err());
+		}
+		return Ok(std::monostate{});
+	}
+}// namespace
+
 PyResult<PySet *> PySet::intersection(PyTuple *args, PyDict *kwargs) const
 {
 	if (kwargs && kwargs->map().size() > 0) {
 		return Err(type_error("intersection() takes no keyword arguments"));
 	}
 
-	SetType result;
-	for (const auto &el_ : m_elements) {
-		auto el_obj_ = PyObject::from(el_);
-		if (el_obj_.is_err()) { return Err(el_obj_.unwrap_err()); }
-		auto *el = el_obj_.unwrap();
-		bool contains_value = true;
-		for (size_t i = 1; i < args->elements().size(); ++i) {
-			const auto &arg = args->elements()[i];
-			auto obj_ = PyObject::from(arg);
-			if (obj_.is_err()) { return Err(obj_.unwrap_err()); }
-			auto contains_ = obj_.unwrap()->contains(el);
-			if (contains_.is_err()) { return Err(contains_.unwrap_err()); }
-			contains_value &= contains_.unwrap();
-			if (!contains_value) { break; }
+	auto result = m_elements;
+	for (size_t i = 0; args && i < args->elements().size(); ++i) {
+		auto other_ = PyObject::from(args->elements()[i]);
+		if (other_.is_err()) { return Err(other_.unwrap_err()); }
+		auto *other = other_.unwrap();
+
+		if (const auto *other_elements = set_elements(other)) {
+			result = result.intersection(*other_elements);
+			continue;
+		}
+		// the result only holds elements of this set, which are kept alive by it
+		SetType next;
+		auto r = for_each_element(other, [&result, &next](PyObject *value) {
+			if (auto it = result.find(value); it != result.end()) { next.insert(*it); }
+		});
+		if (r.is_err()) { return Err(r.unwrap_err()); }
+		result = std::move(next);
+	}
+
+	return PySet::create(std::move(result));
+}
+
+PyResult<PySet *> PySet::difference(PyTuple *args, PyDict *kwargs) const
+{
+	if (kwargs && kwargs->map().size() > 0) {
+		return Err(type_error("difference() takes no keyword arguments"));
+	}
+
+	auto result = m_elements;
+	for (size_t i = 0; args && i < args->elements().size(); ++i) {
+		auto other_ = PyObject::from(args->elements()[i]);
+		if (other_.is_err()) { return Err(other_.unwrap_err()); }
+		auto *other = other_.unwrap();
+
+		if (const auto *other_elements = set_elements(other)) {
+			result = result.difference(*other_elements);
+			continue;
 		}
-		if (contains_value) { result.insert(el_); }
+		auto r = for_each_element(other, [&result](PyObject *value) { result.erase(value); });
+		if (r.is_err()) { return Err(r.unwrap_err()); }
 	}
 
-	return PySet::create(result);
+	return PySet::create(std::move(result));
 }
 
 PyResult<PyObject *> PySet::pop()
@@ -175,8 +250,7 @@ PyResult<std::monostate>
 	PySet::union_helper(const PyObject *other, SetType &result, bool strict) const
 {
 	if (other->type()->issubclass(types::set())) {
-		const auto &elements = static_cast<const PySet &>(*other).elements();
-		result.insert(elements.begin(), elements.end());
+		result.merge(static_cast<const PySet &>(*other).elements());
 	} else {
 		if (strict) {
 			return Err(type_error(
@@ -329,21 +403,24 @@ PyResult<bool> PySet::__contains__(const PyObject *value) const
 	return Ok(m_elements.contains(value_));
 }
 
+PyResult<PyObject *> PySet::__sub__(const PyObject *other) const
+{
+	const auto *other_elements = set_elements(other);
+	if (!other_elements) {
+		return Err(
+			type_error("unsupported operand type(s) for -: 'set' and '{}'", other->type()->name()));
+	}
+	return PySet::create(m_elements.difference(*other_elements));
+}
+
 PyResult<PyObject *> PySet::__and__(PyObject *other)
 {
-	if (!other->type()->issubclass(types::set())) {
+	const auto *other_elements = set_elements(other);
+	if (!other_elements) {
 		return Err(
 			type_error("unsupported operand type(s) for &: 'set' and '{}'", other->type()->name()));
 	}
-	const auto *other_set = static_cast<PySet *>(other);
-
-	SetType result;
-	std::copy_if(m_elements.begin(),
-		m_elements.end(),
-		std::inserter(result, result.begin()),
-		[other_set](const auto &element) { return other_set->m_elements.contains(element); });
-
-	return PySet::create(result);
+	return PySet::create(m_elements.intersection(*other_elements));
 }
 
 PyResult<PyObject *> PySet::__or__(PyObject *other)
@@ -378,6 +455,7 @@ namespace {
 							 .def("discard", &PySet::discard)
 							 .def("remove", &PySet::remove)
 							 .def("intersection", &PySet::intersection)
+							 .def("difference", &PySet::difference)
 							 .def("update", &PySet::update)
 							 .def("pop", &PySet::pop)
 							 .def("issubset", &PySet::issubset)
@@ -398,11 +476,13 @@ std::function<std::unique_ptr<TypePrototype>()> PySet::type_factory()
 PySetIterator::PySetIterator(PyType *type) : PyBaseObject(type) {}
 
 PySetIterator::PySetIterator(const PySet &pyset)
-	: PyBaseObject(types::BuiltinTypes::the().set_iterator()), m_pyset(pyset)
+	: PyBaseObject(types::BuiltinTypes::the().set_iterator()), m_pyset(pyset),
+	  m_set_size(pyset.elements().size())
 {}
 
 PySetIterator::PySetIterator(const PyFrozenSet &pyset)
-	: PyBaseObject(types::BuiltinTypes::the().set_iterator()), m_pyset(pyset)
+	: PyBaseObject(types::BuiltinTypes::the().set_iterator()), m_pyset(pyset),
+	  m_set_size(pyset.elements().size())
 {}
 
 std::string PySetIterator::to_string() const
@@ -430,10 +510,14 @@ PyResult<PyObject *> PySetIterator::__next__()
 	return std::visit(
 		[&]<typename T>(const T &set_ref) -> PyResult<PyObject *> {
 			if constexpr (!std::is_same_v<T, std::monostate>) {
-				const auto &set = set_ref.get();
-				if (m_current_index < set.elements().size()) {
-					return std::visit([](const auto &element) { return PyObject::from(element); },
-						*std::next(set.elements().begin(), m_current_index++));
+				const auto &elements = set_ref.get().elements();
+				if (elements.size() != m_set_size) {
+					return Err(runtime_error("Set changed size during iteration"));
+				}
+				if (auto it = elements.from_slot(m_current_index); it != elements.end()) {
+					m_current_index = it.slot() + 1;
+					return std::visit(
+						[](const auto &element) { return PyObject::from(element); }, *it);
 				}
 				return Err(stop_iteration());
 			} else {
@@ -1,7 +1,7 @@
 #pragma once
 
+#include "FlatHashSet.hpp"
 #include "PyObject.hpp"
-#include <unordered_set>
 
 namespace py {
 
@@ -10,7 +10,7 @@ class PySet : public PyBaseObject
 	friend class ::Heap;
 
   public:
-	using SetType = std::unordered_set<Value, ValueHash>;
+	using SetType = FlatHashSet;
 
   private:
 	SetType m_elements;
@@ -34,6 +34,7 @@ class PySet : public PyBaseObject
 	PyResult<PyObject *> __lt__(const PyObject *other) const;
 	PyResult<bool> __contains__(const PyObject *value) const;
 
+	PyResult<PyObject *> __sub__(const PyObject *other) const;
 	PyResult<PyObject *> __and__(PyObject *other);
 	PyResult<PyObject *> __or__(PyObject *obj);
 
@@ -47,6 +48,7 @@ class PySet : public PyBaseObject
 	PyResult<PyObject *> remove(PyObject *element);
 	PyResult<PySet *> update(PyObject *iterable);
 	PyResult<PySet *> intersection(PyTuple *args, PyDict *kwargs) const;
+	PyResult<PySet *> difference(PyTuple *args, PyDict *kwargs) const;
 	PyResult<PyObject *> pop();
 	PyResult<PyObject *> issubset(const PyObject *other) const;
 	PyResult<PyObject *> union_(PyTuple *others, PyDict *kwargs) const;
@@ -70,7 +72,11 @@ class PySetIterator : public PyBaseObject
 		std::reference_wrapper<const PySet>,
 		std::reference_wrapper<const PyFrozenSet>>
 		m_pyset;
+	// the slot of the set's hash table to continue the iteration from
 	size_t m_current_index{ 0 };
+	// the size of the set when the iterator was created, adding or removing elements may move
+	// the elements to other slots, so the set must not be resized while it is iterated over
+	size_t m_set_size{ 0 };
 
 	PySetIterator(PyType *);
 
@@ -246,7 +246,7 @@ constexpr void Slot::initialize(
 							if (std::holds_alternative<double>(std::get<Number>(el).value)) {
 								return Err(type_error("expected integer type, but got float"));
 							}
-							return Ok(std::get<BigIntType>(std::get<Number>(el).value).get_si());
+							return Ok(std::get<int64_t>(std::get<Number>(el).value));
 						} else {
 							TODO();
 						}
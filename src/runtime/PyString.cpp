@@ -10,7 +10,9 @@
 #include "PyNone.hpp"
 #include "PySlice.hpp"
 #include "StopIteration.hpp"
+#include "StringKernels.hpp"
 #include "TypeError.hpp"
+#include "UnicodeDecodeError.hpp"
 #include "ValueError.hpp"
 #include "runtime/PyBytes.hpp"
 #include "runtime/PyObject.hpp"
@@ -20,9 +22,11 @@
 #include "utilities.hpp"
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <optional>
 #include <span>
+#include <unordered_map>
 
 #include <unicode/stringpiece.h>
 #include <unicode/uchar.h>
@@ -119,13 +123,120 @@ namespace utf8 {
 PyString::PyString(PyType *type) : PyBaseObject(type) {}
 
 PyResult<PyString *> PyString::create(const std::string &value)
+{
+	return PyString::create(std::string{ value });
+}
+
+PyResult<PyString *> PyString::create(std::string &&value)
 {
 	auto &heap = VirtualMachine::the().heap();
-	auto *result = heap.allocate<PyString>(value);
+	// The empty string and the single character Latin-1 strings are immortal singletons
+	// allocated in the static region. The latter are indexed by their codepoint, which is encoded
+	// in one byte for ASCII and in two bytes (lead byte 0xC2 or 0xC3) for the rest of Latin-1.
+	if (value.empty()) {
+		static PyString *empty_string = nullptr;
+		if (!empty_string) { empty_string = heap.allocate_static<PyString>(value).get(); }
+		return Ok(empty_string);
+	} else if (value.size() <= 2) {
+		static std::array<PyString *, 256> latin1_strings{};
+		const auto lead = static_cast<uint8_t>(value[0]);
+		std::optional<uint8_t> codepoint;
+		if (value.size() == 1 && lead < 0x80) {
+			codepoint = lead;
+		} else if (value.size() == 2 && (lead == 0xC2 || lead == 0xC3)) {
+			codepoint = static_cast<uint8_t>(((lead & 0x1F) << 6) | (value[1] & 0x3F));
+		}
+		if (codepoint.has_value()) {
+			auto *&str = latin1_strings[*codepoint];
+			if (!str) { str = heap.allocate_static<PyString>(value).get(); }
+			return Ok(str);
+		}
+	}
+	auto *result = heap.allocate<PyString>(std::move(value));
 	if (!result) { return Err(memory_error(sizeof(PyString))); }
 	return Ok(result);
 }
 
+void PyString::Builder::append(const PyString &str)
+{
+	m_pieces.push_back(Piece{ str.value(), str.m_length, str.m_is_ascii });
+	m_size += str.value().size();
+}
+
+void PyString::Builder::append(std::string_view str)
+{
+	const auto length = string_kernels::utf8_length(str);
+	m_pieces.push_back(Piece{ str, length, length == str.size() });
+	m_size += str.size();
+}
+
+PyResult<PyString *> PyString::Builder::build() const
+{
+	std::string result;
+	result.reserve(m_size);
+	size_t length = 0;
+	bool is_ascii = true;
+	for (const auto &piece : m_pieces) {
+		result.append(piece.bytes);
+		length += piece.length;
+		is_ascii &= piece.is_ascii;
+	}
+	// the empty and single character strings are singletons
+	if (result.size() <= 2) { return PyString::create(std::move(result)); }
+
+	auto *str =
+		VirtualMachine::the().heap().allocate<PyString>(std::move(result), length, is_ascii);
+	if (!str) { return Err(memory_error(sizeof(PyString))); }
+	return Ok(str);
+}
+
+namespace {
+	// the keys point into the value of the interned string, so an entry has to be erased before
+	// its string is deallocated
+	std::unordered_map<std::string_view, PyString *> &intern_table()
+	{
+		static std::unordered_map<std::string_view, PyString *> table;
+		return table;
+	}
+}// namespace
+
+PyResult<PyString *> PyString::intern(const std::string &value)
+{
+	if (auto it = intern_table().find(value); it != intern_table().end()) { return Ok(it->second); }
+	return PyString::create(value).and_then([](PyString *str) -> PyResult<PyString *> {
+		// a string created from a value is always an exact str, so unlike intern(PyString *) this
+		// does not need to look up its type, which may still be initializing when dict keys of
+		// builtin types are interned
+		str->m_interned = true;
+		intern_table().emplace(str->value(), str);
+		return Ok(str);
+	});
+}
+
+PyResult<PyString *> PyString::intern(PyString *str)
+{
+	if (str->m_interned) { return Ok(str); }
+	if (auto it = intern_table().find(str->value()); it != intern_table().end()) {
+		return Ok(it->second);
+	}
+	// instances of str subclasses are not interned, only their value is
+	if (str->type() != types::str()) {
+		return PyString::create(str->value()).and_then([](PyString *s) { return intern(s); });
+	}
+	str->m_interned = true;
+	intern_table().emplace(str->value(), str);
+	return Ok(str);
+}
+
+void PyString::erase_interned_if(const std::function<bool(const PyString &)> &predicate)
+{
+	std::erase_if(intern_table(), [&predicate](const auto &entry) {
+		if (!predicate(*entry.second)) { return false; }
+		entry.second->m_interned = false;
+		return true;
+	});
+}
+
 PyResult<PyString *> PyString::create(PyObject *obj)
 {
 	if (auto *s = as<PyString>(obj)) {
@@ -152,35 +263,9 @@ PyResult<PyString *> PyString::create(const Bytes &bytes, const std::string &enc
 			}
 		}
 		return PyString::create(result);
-	} else if (encoding == "utf8") {
-		std::string result;
-		auto it = bytes.b.begin();
-		while (it != bytes.b.end()) {
-			if (*it > std::byte{ 127 }) {
-				return Err(value_error(
-					"'utf-8' codec can't decode byte {} in position {}: invalid start byte",
-					*it,
-					std::distance(bytes.b.begin(), it)));
-			}
-			auto length = utf8::codepoint_length(static_cast<char>(*it));
-			if (!utf8::codepoint(bit_cast<const char *>(it.base()), length).has_value()) {
-				return Err(value_error(
-					"'utf-8' codec can't decode byte {} in position {}: invalidutf8 codepoint ",
-					*it,
-					std::distance(bytes.b.begin(), it)));
-			}
-			for (size_t i = 0; i < length; ++i) {
-				if (it == bytes.b.end()) {
-					return Err(value_error(
-						"'utf-8' codec can't decode byte {} in position {}: invalidutf8 codepoint ",
-						*it,
-						std::distance(bytes.b.begin(), it)));
-				}
-				result.push_back(static_cast<char>(*it));
-				it++;
-			}
-		}
-		return PyString::create(result);
+	} else if (encoding == "utf8" || encoding == "utf-8") {
+		return PyString::decode(
+			std::span<const std::byte>{ bytes.b.data(), bytes.b.size() }, "utf-8", "strict");
 	}
 	TODO();
 }
@@ -226,12 +311,19 @@ PyResult<PyObject *> PyString::__new__(const PyType *type, PyTuple *args, PyDict
 }
 
 PyString::PyString(std::string s)
-	: PyBaseObject(types::BuiltinTypes::the().str()), m_value(std::move(s))
+	: PyBaseObject(types::BuiltinTypes::the().str()), m_value(std::move(s)),
+	  m_length(string_kernels::utf8_length(m_value)), m_is_ascii(m_length == m_value.size())
+{}
+
+PyString::PyString(std::string s, size_t length, bool is_ascii)
+	: PyBaseObject(types::BuiltinTypes::the().str()), m_value(std::move(s)), m_length(length),
+	  m_is_ascii(is_ascii)
 {}
 
 PyResult<int64_t> PyString::__hash__() const
 {
-	return Ok(static_cast<int64_t>(std::hash<std::string>{}(m_value)));
+	if (m_hash == 0) { m_hash = std::hash<std::string>{}(m_value); }
+	return Ok(static_cast<int64_t>(m_hash));
 }
 
 PyResult<PyObject *> PyString::__repr__() const
@@ -244,7 +336,10 @@ PyResult<PyObject *> PyString::__str__() const { return Ok(const_cast<PyString *
 PyResult<PyObject *> PyString::__add__(const PyObject *obj) const
 {
 	if (auto rhs = as<PyString>(obj)) {
-		return PyString::create(m_value + rhs->value());
+		Builder builder{ 2 };
+		builder.append(*this);
+		builder.append(*rhs);
+		return builder.build();
 	} else {
 		return Err(type_error("unsupported operand type(s) for +: \'{}\' and \'{}\'",
 			type()->name(),
@@ -258,6 +353,7 @@ PyResult<PyObject *> PyString::__eq__(const PyObject *obj) const
 {
 	if (this == obj) return Ok(py_true());
 	if (auto obj_string = as<PyString>(obj)) {
+		if (m_interned && obj_string->m_interned) { return Ok(py_false()); }
 		return Ok(m_value == obj_string->value() ? py_true() : py_false());
 	} else {
 		return Err(type_error("'==' not supported between instances of '{}' and '{}'",
@@ -291,17 +387,6 @@ PyResult<PyObject *> PyString::__lt__(const PyObject *obj) const
 	}
 }
 
-size_t PyString::size() const
-{
-	size_t size{ 0 };
-	for (auto it = m_value.begin(); it != m_value.end();) {
-		const auto codepoint_byte_size = utf8::codepoint_length(*it);
-		size++;
-		it += codepoint_byte_size;
-	}
-	return size;
-}
-
 PyResult<size_t> PyString::__len__() const { return Ok(size()); }
 
 PyResult<bool> PyString::__bool__() const { return Ok(!m_value.empty()); }
@@ -358,27 +443,10 @@ PyResult<PyObject *> PyString::isalpha() const
 // FIXME: assumes string only has ASCII characters
 PyResult<PyObject *> PyString::isdigit() const
 {
-	if (m_value.empty()) { return Ok(py_false()); }
-
-	auto it = std::find_if_not(
-		m_value.begin(), m_value.end(), [](const unsigned char c) { return std::isdigit(c); });
-	if (it == m_value.end()) {
-		return Ok(py_true());
-	} else {
-		return Ok(py_false());
-	}
+	return Ok(string_kernels::is_ascii_digits(m_value) ? py_true() : py_false());
 }
 
-PyResult<PyObject *> PyString::isascii() const
-{
-	for (size_t i = 0; i < m_value.size();) {
-		const auto length = utf8::codepoint_length(m_value[i]);
-		const auto codepoint = utf8::codepoint(m_value.c_str(), length);
-		if (codepoint > 0x7F) { return Ok(py_false()); }
-		i += length;
-	}
-	return Ok(py_true());
-}
+PyResult<PyObject *> PyString::isascii() const { return Ok(m_is_ascii ? py_true() : py_false()); }
 
 // FIXME: assumes string only has ASCII characters
 PyResult<PyObject *> PyString::islower() const
@@ -412,15 +480,19 @@ PyResult<PyObject *> PyString::isupper() const
 
 size_t PyString::get_position_from_slice(int64_t pos) const
 {
-	if (pos < 0) {
-		pos = m_value.size() - pos;
-		// TODO: handle case where the negative start index is less than size of string
-		ASSERT(pos > 0)
-	}
-	return pos;
+	const auto length = static_cast<int64_t>(m_length);
+	if (pos < 0) { pos = std::max(pos + length, int64_t{ 0 }); }
+	pos = std::min(pos, length);
+	if (m_is_ascii) { return static_cast<size_t>(pos); }
+	return string_kernels::utf8_offset(m_value, static_cast<size_t>(pos));
+}
+
+size_t PyString::codepoint_index(size_t byte_offset) const
+{
+	if (m_is_ascii) { return byte_offset; }
+	return string_kernels::utf8_length(std::string_view{ m_value }.substr(0, byte_offset));
 }
 
-// FIXME: assumes string only has ASCII characters
 PyResult<PyObject *> PyString::find(PyTuple *args, PyDict *kwargs) const
 {
 	ASSERT(args && args->size() <= 3 && args->size() > 0)
@@ -449,7 +521,7 @@ PyResult<PyObject *> PyString::find(PyTuple *args, PyDict *kwargs) const
 	}
 
 	if (!start && !end) {
-		result = m_value.find(pattern->value().c_str());
+		result = string_kernels::find(m_value, pattern->value());
 	} else if (!end) {
 		size_t start_ =
 			std::visit(overloaded{
@@ -462,7 +534,7 @@ PyResult<PyObject *> PyString::find(PyTuple *args, PyDict *kwargs) const
 						   },
 					   },
 				start->value().value);
-		result = m_value.find(pattern->value().c_str(), start_);
+		result = string_kernels::find(m_value, pattern->value(), start_);
 	} else {
 		size_t start_ =
 			std::visit(overloaded{
@@ -485,17 +557,19 @@ PyResult<PyObject *> PyString::find(PyTuple *args, PyDict *kwargs) const
 									 },
 								 },
 			end->value().value);
-		size_t subtring_size = end_ - start_;
-		result = m_value.find(pattern->value().c_str(), start_, subtring_size);
+		const auto substring = std::string_view{ m_value }.substr(0, end_);
+		result = string_kernels::find(substring, pattern->value(), start_);
+		if (result != std::string::npos && result + pattern->value().size() > end_) {
+			result = std::string::npos;
+		}
 	}
 	if (result == std::string::npos) {
 		return PyInteger::create(int64_t{ -1 });
 	} else {
-		return PyInteger::create(static_cast<int64_t>(result));
+		return PyInteger::create(static_cast<int64_t>(codepoint_index(result)));
 	}
 }
 
-// FIXME: assumes string only has ASCII characters
 PyResult<PyObject *> PyString::rfind(PyTuple *args, PyDict *kwargs) const
 {
 	ASSERT(args && args->size() <= 3 && args->size() > 0)
@@ -563,21 +637,20 @@ PyResult<PyObject *> PyString::rfind(PyTuple *args, PyDict *kwargs) const
 			end->value().value);
 	}
 
-	std::optional<size_t> result;
-	while (start_idx < end_idx) {
-		start_idx = m_value.find(pattern->value(), start_idx);
-		if (start_idx < end_idx) { result = start_idx++; }
+	size_t result{ std::string::npos };
+	if (start_idx <= end_idx) {
+		result = std::string_view{ m_value }.substr(0, end_idx).rfind(pattern->value());
+		if (result != std::string::npos && result < start_idx) { result = std::string::npos; }
 	}
 
-	if (result.has_value()) {
-		return PyInteger::create(static_cast<int64_t>(*result));
-	} else {
+	if (result == std::string::npos) {
 		return PyInteger::create(int64_t{ -1 });
+	} else {
+		return PyInteger::create(static_cast<int64_t>(codepoint_index(result)));
 	}
 }
 
 
-// FIXME: assumes string only has ASCII characters
 PyResult<PyObject *> PyString::count(PyTuple *args, PyDict *kwargs) const
 {
 	ASSERT(args && args->size() <= 3 && args->size() > 0)
@@ -639,23 +712,12 @@ PyResult<PyObject *> PyString::count(PyTuple *args, PyDict *kwargs) const
 		}
 	}();
 
-	auto iter = m_value.begin() + start_;
-	const auto end_it = m_value.begin() + end_;
-
-	while (iter != end_it) {
-		std::string_view substring{ &(*iter), static_cast<size_t>(std::distance(iter, end_it)) };
-		if (auto pos = substring.find(pattern->value()); pos != std::string_view::npos) {
-			result++;
-			// if we advance to the end of the substring match, do we still have enough of
-			// a substring left to find another match
-			if (std::distance(iter + pos + pattern->value().size(), end_it)
-				>= static_cast<int64_t>(pattern->value().size()))
-				iter += pos + pattern->value().size();
-			else {
-				break;
-			}
+	if (start_ <= end_ && end_ <= m_value.size()) {
+		const auto substring = std::string_view{ m_value }.substr(start_, end_ - start_);
+		if (pattern->value().empty()) {
+			result = string_kernels::utf8_length(substring) + 1;
 		} else {
-			break;
+			result = string_kernels::count(substring, pattern->value());
 		}
 	}
 
@@ -857,38 +919,58 @@ PyResult<PyObject *> PyString::join(PyTuple *args, PyDict *kwargs) const
 	auto iterable = PyObject::from(args->elements()[0]);
 	if (iterable.is_err()) return iterable;
 
+	const auto build = [this](std::span<const Value> elements) -> PyResult<PyObject *> {
+		Builder builder{ elements.empty() ? 0 : 2 * elements.size() - 1 };
+		for (size_t idx = 0; idx < elements.size(); ++idx) {
+			if (idx > 0) { builder.append(*this); }
+			if (std::holds_alternative<String>(elements[idx])) {
+				builder.append(std::get<String>(elements[idx]).s);
+				continue;
+			}
+			auto obj = PyObject::from(elements[idx]);
+			if (obj.is_err()) { return obj; }
+			auto *str = as<PyString>(obj.unwrap());
+			if (!str) {
+				return Err(type_error("sequence item {}: expected str instance, {} found",
+					idx,
+					obj.unwrap()->type()->name()));
+			}
+			builder.append(*str);
+		}
+		return builder.build();
+	};
+
+	// the builder refers to the pieces without copying them, so they have to stay reachable from
+	// a container until the result is built
+	// a list of strs uses the object strategy, any other list fails in the generic path below
+	if (auto *list = as<PyList>(iterable.unwrap()); list && list->storage().as_objects()) {
+		return build(*list->storage().as_objects());
+	}
+	if (auto *tuple = as<PyTuple>(iterable.unwrap())) { return build(tuple->elements()); }
+
 	auto iterator_ = iterable.unwrap()->iter();
 	if (iterator_.is_err()) return iterator_;
 
+	auto elements_ = PyList::create();
+	if (elements_.is_err()) { return elements_; }
+	auto *elements = elements_.unwrap();
+
 	auto *iterator = iterator_.unwrap();
 	auto value = iterator->next();
-	size_t idx = 0;
-	std::string new_string;
 	while (value.is_ok()) {
-		if (!as<PyString>(value.unwrap())) {
-			return Err(type_error("sequence item {}: expected str instance, {} found",
-				idx,
-				value.unwrap()->type()->name()));
-		}
-		new_string.append(as<PyString>(value.unwrap())->value());
+		elements->storage().push_back(value.unwrap());
 		value = iterator->next();
-		if (value.is_ok()) { new_string.append(m_value); }
-	};
+	}
 
 	if (value.is_err() && value.unwrap_err()->type() != stop_iteration()->type()) { return value; }
-	return PyString::create(new_string);
+	return build(elements->as_object_storage());
 }
 
 // FIXME: assumes string only has ASCII characters
 PyResult<PyObject *> PyString::lower() const
 {
 	auto new_string = m_value;
-	std::transform(new_string.begin(),
-		new_string.end(),
-		new_string.begin(),
-		[](const unsigned char c) -> unsigned char {
-			return static_cast<unsigned char>(std::tolower(c));
-		});
+	string_kernels::to_lower_ascii(new_string.data(), new_string.size());
 	return PyString::create(new_string);
 }
 
@@ -896,12 +978,7 @@ PyResult<PyObject *> PyString::lower() const
 PyResult<PyObject *> PyString::upper() const
 {
 	auto new_string = m_value;
-	std::transform(new_string.begin(),
-		new_string.end(),
-		new_string.begin(),
-		[](const unsigned char c) -> unsigned char {
-			return static_cast<unsigned char>(std::toupper(c));
-		});
+	string_kernels::to_upper_ascii(new_string.data(), new_string.size());
 	return PyString::create(new_string);
 }
 
@@ -946,16 +1023,12 @@ PyResult<PyObject *> PyString::strip(PyTuple *args, PyDict *kwargs) const
 	if (chars.is_err()) return Err(chars.unwrap_err());
 
 	if (chars.unwrap().empty()) {
-		const auto it_start = std::find_if(
-			m_value.begin(), m_value.end(), [](const auto &el) { return !std::isspace(el); });
-		const auto it_end = std::find_if(
-			m_value.rbegin(), m_value.rend(), [](const auto &el) { return !std::isspace(el); });
+		const auto start = string_kernels::first_non_whitespace(m_value);
+		if (start == m_value.size()) { return PyString::create(""); }
+		const auto end = string_kernels::last_non_whitespace(m_value);
 
-		if (it_start == m_value.begin() && it_end == m_value.rend()) {
-			return Ok(const_cast<PyString *>(this));
-		}
-		std::string result{ it_start, it_end.base() };
-		return PyString::create(result);
+		if (start == 0 && end == m_value.size()) { return Ok(const_cast<PyString *>(this)); }
+		return PyString::create(m_value.substr(start, end - start));
 	} else {
 		const auto codepoints = this->codepoints();
 		const auto patterns = chars.unwrap();
@@ -1005,15 +1078,9 @@ PyResult<PyObject *> PyString::rstrip(PyTuple *args, PyDict *kwargs) const
 	if (chars.is_err()) return Err(chars.unwrap_err());
 
 	if (chars.unwrap().empty()) {
-		const auto it = std::find_if(
-			m_value.rbegin(), m_value.rend(), [](const auto &el) { return !std::isspace(el); });
-		if (it != m_value.rend()) {
-			const size_t idx = std::distance(it, m_value.rend());
-			std::string result{ m_value.begin(), m_value.begin() + idx };
-			return PyString::create(result);
-		} else {
-			return Ok(const_cast<PyString *>(this));
-		}
+		const auto end = string_kernels::last_non_whitespace(m_value);
+		if (end == m_value.size()) { return Ok(const_cast<PyString *>(this)); }
+		return PyString::create(m_value.substr(0, end));
 	} else {
 		const auto codepoints = this->codepoints();
 		auto codepoints_it = codepoints.rbegin();
@@ -1042,15 +1109,15 @@ PyResult<PyList *> PyString::split(PyTuple *args, PyDict *kwargs) const
 {
 	ASSERT(!kwargs || kwargs->map().empty());
 
-	const auto sep_ = [args]() -> PyResult<std::vector<uint32_t>> {
-		if (!args || args->size() == 0) { return Ok(std::vector<uint32_t>{}); }
+	const auto sep_ = [args]() -> PyResult<std::string> {
+		if (!args || args->size() == 0) { return Ok(std::string{}); }
 		auto args0 = PyObject::from(args->elements()[0]);
 
-		if (args0.unwrap() == py_none()) { return Ok(std::vector<uint32_t>{}); }
+		if (args0.unwrap() == py_none()) { return Ok(std::string{}); }
 		auto str = as<PyString>(args0.unwrap());
 		if (!str) { return Err(type_error("")); }
 		if (str->value().empty()) { return Err(value_error("empty separator")); }
-		return Ok(str->codepoints());
+		return Ok(str->value());
 	}();
 
 	if (sep_.is_err()) { return Err(sep_.unwrap_err()); }
@@ -1079,30 +1146,18 @@ PyResult<PyList *> PyString::split(PyTuple *args, PyDict *kwargs) const
 
 	if (!sep.empty()) {
 		size_t start = 0;
-		const auto cps = codepoints();
-		for (size_t i = 0; i < cps.size();) {
-			if (result->elements().size() >= maxsplit) { break; }
-			bool is_match = true;
-			for (size_t j = 0; j < sep.size(); ++j) {
-				if (cps[i + j] != sep[j]) {
-					is_match = false;
-					break;
-				}
-			}
-			if (is_match) {
-				auto el = PyString::create(m_value.substr(start, i - start));
-				if (el.is_err()) { return Err(el.unwrap_err()); }
-				result->elements().push_back(el.unwrap());
-				i += sep.size();
-				start = i;
-			} else {
-				++i;
-			}
+		for (size_t i = string_kernels::find(m_value, sep); i != std::string::npos;
+			 i = string_kernels::find(m_value, sep, start)) {
+			if (result->storage().size() >= maxsplit) { break; }
+			auto el = PyString::create(m_value.substr(start, i - start));
+			if (el.is_err()) { return Err(el.unwrap_err()); }
+			result->storage().push_back(el.unwrap());
+			start = i + sep.size();
 		}
 		// handle remainder
 		auto el = PyString::create(m_value.substr(start, m_value.size() - start));
 		if (el.is_err()) { return Err(el.unwrap_err()); }
-		result->elements().push_back(el.unwrap());
+		result->storage().push_back(el.unwrap());
 	} else {
 		// If sep is not specified or is None, a different splitting algorithm is applied: runs of
 		// consecutive whitespace are regarded as a single separator, and the result will contain no
@@ -1112,13 +1167,13 @@ PyResult<PyList *> PyString::split(PyTuple *args, PyDict *kwargs) const
 		size_t start = 0;
 		size_t end = start;
 		for (const auto &el : m_value) {
-			if (result->elements().size() >= maxsplit) { break; }
+			if (result->storage().size() >= maxsplit) { break; }
 			if (std::isspace(el)) {
 				if (end != start) {
 					if (!std::isspace(m_value[start])) {
 						auto el = PyString::create(m_value.substr(start, end - start));
 						if (el.is_err()) { return Err(el.unwrap_err()); }
-						result->elements().push_back(el.unwrap());
+						result->storage().push_back(el.unwrap());
 					}
 					end++;
 					start = end;
@@ -1135,7 +1190,7 @@ PyResult<PyList *> PyString::split(PyTuple *args, PyDict *kwargs) const
 		if (!remainder.empty()) {
 			auto el = PyString::create(std::string{ remainder });
 			if (el.is_err()) { return Err(el.unwrap_err()); }
-			result->elements().push_back(el.unwrap());
+			result->storage().push_back(el.unwrap());
 		}
 	}
 
@@ -1143,9 +1198,75 @@ PyResult<PyList *> PyString::split(PyTuple *args, PyDict *kwargs) const
 }
 
 
+void PyString::build_codepoints() const
+{
+	ASSERT(!m_is_ascii)
+	ASSERT(std::holds_alternative<std::monostate>(m_codepoints))
+
+	const auto codepoints = this->codepoints();
+	const auto max_codepoint = *std::max_element(codepoints.begin(), codepoints.end());
+	if (max_codepoint <= 0xFF) {
+		m_codepoints = std::vector<uint8_t>(codepoints.begin(), codepoints.end());
+	} else if (max_codepoint <= 0xFFFF) {
+		m_codepoints = std::vector<uint16_t>(codepoints.begin(), codepoints.end());
+	} else {
+		m_codepoints = std::move(codepoints);
+	}
+}
+
+uint32_t PyString::codepoint_at(size_t index) const
+{
+	ASSERT(index < m_length)
+	if (m_is_ascii) { return static_cast<uint8_t>(m_value[index]); }
+	if (std::holds_alternative<std::monostate>(m_codepoints)) { build_codepoints(); }
+	return std::visit(
+		overloaded{
+			[](std::monostate) -> uint32_t {
+				ASSERT_NOT_REACHED();
+				return 0;
+			},
+			[index](const auto &codepoints) -> uint32_t { return codepoints[index]; },
+		},
+		m_codepoints);
+}
+
+PyResult<PyString *> PyString::substring(int64_t start, int64_t step, int64_t length) const
+{
+	if (m_is_ascii) {
+		if (step == 1) { return PyString::create(m_value.substr(start, length)); }
+		std::string result;
+		result.reserve(length);
+		for (int64_t idx = start, i = 0; i < length; idx += step, ++i) {
+			result.push_back(m_value[idx]);
+		}
+		return PyString::create(result);
+	}
+
+	std::string result;
+	for (int64_t idx = start, i = 0; i < length; idx += step, ++i) {
+		const auto cp = utf8::utf8chr(codepoint_at(idx));
+		ASSERT(cp.has_value())
+		result.append(*cp);
+	}
+	return PyString::create(result);
+}
+
 std::vector<uint32_t> PyString::codepoints() const
 {
+	if (m_is_ascii) { return std::vector<uint32_t>(m_value.begin(), m_value.end()); }
+	if (!std::holds_alternative<std::monostate>(m_codepoints)) {
+		return std::visit(
+			overloaded{
+				[](std::monostate) { return std::vector<uint32_t>{}; },
+				[](const auto &codepoints) {
+					return std::vector<uint32_t>(codepoints.begin(), codepoints.end());
+				},
+			},
+			m_codepoints);
+	}
+
 	std::vector<uint32_t> codepoints;
+	codepoints.reserve(m_length);
 
 	for (size_t i = 0; i < m_value.size();) {
 		const auto length = utf8::codepoint_length(m_value[i]);
@@ -1184,32 +1305,17 @@ PyResult<PyObject *> PyString::__getitem__(PyObject *index)
 		const auto i = index_int->as_i64();
 		return (*this)[i];
 	} else if (auto slice = as<PySlice>(index)) {
-		const auto codepoints = this->codepoints();
 		auto indices_ = slice->unpack();
 		if (indices_.is_err()) return Err(indices_.unwrap_err());
 		const auto [start_, end_, step] = indices_.unwrap();
 
 		const auto [start, end, slice_length] =
-			PySlice::adjust_indices(start_, end_, step, codepoints.size());
+			PySlice::adjust_indices(start_, end_, step, m_length);
 
-		if (slice_length == 0) { return PyList::create(); }
-		if (start == 0 && end == static_cast<int64_t>(codepoints.size()) && step == 1) {
-			return Ok(this);
-		}
+		if (slice_length == 0) { return PyString::create(""); }
+		if (start == 0 && end == static_cast<int64_t>(m_length) && step == 1) { return Ok(this); }
 
-		std::string new_str;
-		std::string str;
-
-		for (int64_t idx = start, i = 0; i < slice_length; idx += step, ++i) {
-			const auto cp = codepoints[idx];
-			// is this a valid unicode codepoint?
-			ASSERT(cp < 0x110000);
-			icu::UnicodeString uni_str(static_cast<UChar32>(cp));
-			str.clear();
-			uni_str.toUTF8String(str);
-			new_str += str;
-		}
-		return PyString::create(new_str);
+		return substring(start, step, slice_length);
 	} else {
 		return Err(
 			type_error("str indices must be integers or slices, not {}", index->type()->name()));
@@ -1228,12 +1334,7 @@ PyResult<PyObject *> PyString::operator[](int64_t index) const
 
 	if (index >= str_size) { return Err(index_error("string index out of range")); }
 
-	const auto cp = codepoints()[index];
-	ASSERT(cp < 0x110000);
-	icu::UnicodeString uni_str(static_cast<UChar32>(cp));
-	std::string str;
-	uni_str.toUTF8String(str);
-	return PyString::create(str);
+	return substring(index, 1, 1);
 }
 
 PyResult<std::string> PyString::FormatSpec::apply(PyObject *obj) const
@@ -1609,7 +1710,7 @@ PyResult<PyString *> PyString::from_encoded_object(const PyObject *obj,
 	ASSERT(obj);
 
 	if (obj->type()->issubclass(types::bytes())) {
-		if (!encoding.empty() && encoding != "utf-8") {
+		if (!encoding.empty() && encoding != "utf-8" && encoding != "utf8") {
 			return Err(not_implemented_error(
 				"only utf-8 encoding implemented for 'str' decoding, got {}", encoding));
 		}
@@ -1624,39 +1725,36 @@ PyResult<PyString *> PyString::from_encoded_object(const PyObject *obj,
 	return Err(not_implemented_error("PyString::from_encoded_object only implemented for 'bytes'"));
 }
 
+namespace {
+	BaseException *utf8_decode_error(std::string_view bytes, size_t position)
+	{
+		const auto invalid = string_kernels::describe_invalid_utf8(bytes, position);
+		if (invalid.end - invalid.start == 1) {
+			return unicode_decode_error(
+				"'utf-8' codec can't decode byte 0x{:02x} in position {}: {}",
+				static_cast<uint8_t>(bytes[invalid.start]),
+				invalid.start,
+				invalid.reason);
+		}
+		return unicode_decode_error("'utf-8' codec can't decode bytes in position {}-{}: {}",
+			invalid.start,
+			invalid.end - 1,
+			invalid.reason);
+	}
+}// namespace
+
 PyResult<PyString *> PyString::decode(std::span<const std::byte> bytes,
 	const std::string &encoding,
 	const std::string & /*errors*/)
 {
-	if (encoding.empty() || encoding == "utf-8") {
-		icu::UnicodeString uni_str{ static_cast<int32_t>(bytes.size()), UChar32{}, 0 };
-		std::string encoded_cp;
-		encoded_cp.reserve(4);
-		while (!bytes.empty()) {
-			auto c = bytes.front();
-			ASSERT(
-				static_cast<int>(c) < static_cast<int>(std::numeric_limits<unsigned char>::max()));
-			auto size = utf8::codepoint_length(static_cast<char>(bytes.front()));
-			if (size > bytes.size()) {
-				return Err(value_error("str.decode: malformed utf-8 sequence"));
-			}
-			for (const auto &el : bytes.subspan(0, bytes.size())) {
-				ASSERT(static_cast<int>(el)
-					   < static_cast<int>(std::numeric_limits<unsigned char>::max()));
-				encoded_cp.push_back(static_cast<char>(el));
-			}
-			const auto cp = utf8::codepoint(encoded_cp.data(), size);
-			if (!cp.has_value()) {
-				return Err(value_error("invalid utf-8 encoded codepoint {}", encoded_cp));
-			}
-			encoded_cp.clear();
-			uni_str.append(UChar32{ static_cast<int32_t>(*cp) });
-			bytes = bytes.subspan(size);
+	if (encoding.empty() || encoding == "utf-8" || encoding == "utf8") {
+		// the value of a str is its UTF-8 encoding, so valid input is used as is
+		const std::string_view str{ reinterpret_cast<const char *>(bytes.data()), bytes.size() };
+		if (const auto invalid = string_kernels::find_invalid_utf8(str);
+			invalid != std::string_view::npos) {
+			return Err(utf8_decode_error(str, invalid));
 		}
-		std::string result;
-		result.reserve(uni_str.length() * 2);
-		uni_str.toUTF8String(result);
-		return PyString::create(std::move(result));
+		return PyString::create(std::string{ str });
 	}
 
 	return Err(not_implemented_error("str.decode only implemented for 'utf-8' encoding"));
@@ -1697,41 +1795,34 @@ PyResult<PyObject *> PyString::replace(PyTuple *args, PyDict *kwargs) const
 		return count->as_size_t();
 	}();
 
+	if (!old->value().empty()) {
+		// UTF-8 is self-synchronizing, so a byte match of a valid needle is a codepoint match
+		const auto &needle = old->value();
+		std::string result;
+		result.reserve(m_value.size());
+		size_t start = 0;
+		for (size_t counter = 0, pos = string_kernels::find(m_value, needle);
+			 counter < count_ && pos != std::string::npos;
+			 ++counter, pos = string_kernels::find(m_value, needle, start)) {
+			result.append(m_value, start, pos - start);
+			result.append(new_->value());
+			start = pos + needle.size();
+		}
+		result.append(m_value, start);
+		return PyString::create(result);
+	}
+
 	size_t counter = 0;
 	icu::UnicodeString result;
 	const auto cps = codepoints();
-	if (old->value().empty()) {
-		for (auto it = cps.begin(); it != cps.end(); ++it, ++counter) {
-			if (counter < count_) {
-				for (const auto &el : new_->value()) { result.append(UChar32{ el }); }
-			}
-			result.append(UChar32(*it));
-		}
+	for (auto it = cps.begin(); it != cps.end(); ++it, ++counter) {
 		if (counter < count_) {
 			for (const auto &el : new_->value()) { result.append(UChar32{ el }); }
 		}
-	} else {
-		const auto old_cps = old->codepoints();
-
-		for (auto it = cps.begin(); it != cps.end();) {
-			if (old_cps.size() > static_cast<size_t>(std::distance(it, cps.end()))) {
-				while (it != cps.end()) {
-					result.append(UChar32(*it));
-					++it;
-				}
-				break;
-			}
-			std::span next{ it, it + old_cps.size() };
-			if (counter < count_
-				&& std::equal(next.begin(), next.end(), old_cps.begin(), old_cps.end())) {
-				for (const auto &el : new_->value()) { result.append(el); }
-				it += old_cps.size();
-				counter++;
-			} else {
-				result.append(UChar32(*it));
-				++it;
-			}
-		}
+		result.append(UChar32(*it));
+	}
+	if (counter < count_) {
+		for (const auto &el : new_->value()) { result.append(UChar32{ el }); }
 	}
 
 	std::string result_str;
@@ -1843,17 +1934,19 @@ void PyStringIterator::visit_graph(Visitor &visitor)
 
 PyResult<PyObject *> PyStringIterator::__repr__() const { return PyString::create(to_string()); }
 
-PyResult<PyObject *> PyStringIterator::__next__()
+PyResult<PyObject *> PyStringIterator::__next__() { return next_from_iternext(iternext()); }
+
+PyResult<std::optional<Value>> PyStringIterator::iternext()
 {
-	if (m_current_index < m_pystring.size()) {
-		const auto cp = m_pystring.codepoints()[m_current_index++];
-		ASSERT(cp < 0x110000);
-		icu::UnicodeString uni_str(static_cast<UChar32>(cp));
-		std::string str;
-		uni_str.toUTF8String(str);
-		return PyString::create(str);
-	}
-	return Err(stop_iteration());
+	const auto &value = m_pystring.value();
+	if (m_current_index < value.size()) {
+		const auto length = utf8::codepoint_length(value[m_current_index]);
+		auto str = PyString::create(value.substr(m_current_index, length));
+		m_current_index += length;
+		if (str.is_err()) { return Err(str.unwrap_err()); }
+		return Ok(std::optional<Value>{ str.unwrap() });
+	}
+	return Ok(std::optional<Value>{});
 }
 
 PyType *PyStringIterator::static_type() const { return types::str_iterator(); }
@@ -5,6 +5,9 @@
 #include "runtime/Value.hpp"
 
 #include <optional>
+#include <string_view>
+#include <variant>
+#include <vector>
 
 namespace py {
 
@@ -12,6 +15,22 @@ class PyString : public PyBaseObject
 {
 	friend class ::Heap;
 	std::string m_value;
+	// number of codepoints in m_value
+	size_t m_length{ 0 };
+	// every codepoint is encoded in a single byte, so codepoint i is m_value[i]
+	bool m_is_ascii{ true };
+	// The codepoints of a non-ASCII string, stored with the narrowest of 1, 2 or 4 bytes per
+	// codepoint that fits all of them. Built the first time a codepoint is accessed by index.
+	mutable std::variant<std::monostate,
+		std::vector<uint8_t>,
+		std::vector<uint16_t>,
+		std::vector<uint32_t>>
+		m_codepoints;
+	// cached hash of m_value, 0 until it is first computed
+	mutable size_t m_hash{ 0 };
+	// interned strings are the only instance of their value in the intern table, so two different
+	// interned strings are never equal
+	bool m_interned{ false };
 
 	PyString(PyType *);
 
@@ -46,13 +65,46 @@ class PyString : public PyBaseObject
 		static std::optional<Conversion> get_conversion(char);
 	};
 
+	// Concatenates pieces into a new str. The pieces are only recorded by append, so build() can
+	// size the result exactly and write it with a single allocation. The codepoint length of the
+	// result is summed from the pieces rather than recomputed.
+	class Builder
+	{
+		struct Piece
+		{
+			std::string_view bytes;
+			size_t length;
+			bool is_ascii;
+		};
+		std::vector<Piece> m_pieces;
+		size_t m_size{ 0 };
+
+	  public:
+		explicit Builder(size_t pieces = 0) { m_pieces.reserve(pieces); }
+
+		// the pieces are not copied, so they have to be kept alive until build() returns
+		void append(const PyString &);
+		void append(std::string_view);
+
+		PyResult<PyString *> build() const;
+	};
+
   public:
 	static PyResult<PyString *> create(const std::string &value);
+	static PyResult<PyString *> create(std::string &&value);
 
 	static PyResult<PyString *> create(PyObject *);
 
 	static PyResult<PyString *> create(const Bytes &, const std::string &encoding);
 
+	// Returns the interned string with this value, creating it if needed. The intern table does
+	// not keep its strings alive: the garbage collector drops the entries of unreachable strings.
+	static PyResult<PyString *> intern(const std::string &value);
+	static PyResult<PyString *> intern(PyString *);
+	static void erase_interned_if(const std::function<bool(const PyString &)> &predicate);
+
+	bool is_interned() const { return m_interned; }
+
 	static PyResult<PyString *> create(PyString *self, PyTuple *args, PyDict *kwargs)
 	{
 		// FIXME with proper error handling
@@ -68,7 +120,10 @@ class PyString : public PyBaseObject
 	std::optional<uint32_t> codepoint() const;
 
 	std::string to_string() const override { return m_value; }
-	size_t size() const;
+	// number of codepoints
+	size_t size() const { return m_length; }
+	bool is_ascii() const { return m_is_ascii; }
+	uint32_t codepoint_at(size_t index) const;
 
 	static PyResult<PyObject *> __new__(const PyType *type, PyTuple *args, PyDict *kwargs);
 	PyResult<PyObject *> __repr__() const;
@@ -131,9 +186,16 @@ class PyString : public PyBaseObject
 	static PyResult<PyString *> chr(BigIntType cp);
 
   private:
-	PyString(std::string s);
+	explicit PyString(std::string s);
+	PyString(std::string s, size_t length, bool is_ascii);
 
+	// byte offset of a codepoint index given as a start or end argument, e.g. of find(), which
+	// counts from the end when negative and is clamped to the string
 	size_t get_position_from_slice(int64_t) const;
+	// codepoint index of a byte offset that starts a codepoint
+	size_t codepoint_index(size_t byte_offset) const;
+	void build_codepoints() const;
+	PyResult<PyString *> substring(int64_t start, int64_t step, int64_t length) const;
 
 	PyResult<PyString *> printf(const PyObject *values) const;
 };
@@ -143,6 +205,7 @@ class PyStringIterator : public PyBaseObject
 	friend class ::Heap;
 
 	const PyString &m_pystring;
+	// byte offset into the UTF-8 encoded string
 	size_t m_current_index{ 0 };
 
   public:
@@ -154,6 +217,7 @@ class PyStringIterator : public PyBaseObject
 
 	PyResult<PyObject *> __repr__() const;
 	PyResult<PyObject *> __next__();
+	PyResult<std::optional<Value>> iternext();
 
 	static std::function<std::unique_ptr<TypePrototype>()> type_factory();
 	PyType *static_type() const override;
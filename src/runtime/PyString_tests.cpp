@@ -12,4 +12,58 @@ TEST(PyString, hash)
 	auto object_hash = foo_obj_.unwrap()->hash();
 	ASSERT_TRUE(object_hash.is_ok());
 	ASSERT_EQ(ValueHash{}(foo), object_hash.unwrap());
-}
\ No newline at end of file
+}
+
+TEST(PyString, intern)
+{
+	auto interned = PyString::intern("attribute_name");
+	ASSERT_TRUE(interned.is_ok());
+	EXPECT_TRUE(interned.unwrap()->is_interned());
+	EXPECT_EQ(PyString::intern("attribute_name").unwrap(), interned.unwrap());
+
+	auto other = PyString::create("attribute_name");
+	ASSERT_TRUE(other.is_ok());
+	EXPECT_NE(other.unwrap(), interned.unwrap());
+	EXPECT_FALSE(other.unwrap()->is_interned());
+	EXPECT_EQ(PyString::intern(other.unwrap()).unwrap(), interned.unwrap());
+	EXPECT_TRUE(Value{ other.unwrap() } == Value{ interned.unwrap() });
+}
+
+TEST(PyString, codepoint_indexing)
+{
+	auto ascii = PyString::create("abc");
+	ASSERT_TRUE(ascii.is_ok());
+	EXPECT_TRUE(ascii.unwrap()->is_ascii());
+	EXPECT_EQ(ascii.unwrap()->size(), 3);
+	EXPECT_EQ(ascii.unwrap()->codepoint_at(2), 'c');
+
+	auto unicode = PyString::create("aé😃");
+	ASSERT_TRUE(unicode.is_ok());
+	EXPECT_FALSE(unicode.unwrap()->is_ascii());
+	EXPECT_EQ(unicode.unwrap()->size(), 3);
+	EXPECT_EQ(unicode.unwrap()->codepoint_at(0), 'a');
+	EXPECT_EQ(unicode.unwrap()->codepoint_at(1), 0xE9);
+	EXPECT_EQ(unicode.unwrap()->codepoint_at(2), 0x1F603);
+}
+
+TEST(PyString, builder)
+{
+	auto separator = PyString::create(", ");
+	auto name = PyString::create("wörld");
+	ASSERT_TRUE(separator.is_ok());
+	ASSERT_TRUE(name.is_ok());
+
+	PyString::Builder builder{ 3 };
+	builder.append("hello");
+	builder.append(*separator.unwrap());
+	builder.append(*name.unwrap());
+	auto result = builder.build();
+	ASSERT_TRUE(result.is_ok());
+	EXPECT_EQ(result.unwrap()->value(), "hello, wörld");
+	EXPECT_EQ(result.unwrap()->size(), 12);
+	EXPECT_FALSE(result.unwrap()->is_ascii());
+
+	auto empty = PyString::Builder{}.build();
+	ASSERT_TRUE(empty.is_ok());
+	EXPECT_EQ(empty.unwrap(), PyString::create("").unwrap());
+}
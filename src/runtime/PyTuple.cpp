@@ -80,13 +80,18 @@ PyTuple::PyTuple(PyType *type, const std::vector<PyObject *> &elements)
 
 PyResult<PyTuple *> PyTuple::create()
 {
-	auto &heap = VirtualMachine::the().heap();
-	if (auto *obj = heap.allocate<PyTuple>()) { return Ok(obj); }
-	return Err(memory_error(sizeof(PyTuple)));
+	// the empty tuple is immutable and immortal, so every `()` shares the same object
+	static PyTuple *empty_tuple = nullptr;
+	if (!empty_tuple) {
+		auto &heap = VirtualMachine::the().heap();
+		empty_tuple = heap.allocate_static<PyTuple>().get();
+	}
+	return Ok(empty_tuple);
 }
 
 PyResult<PyTuple *> PyTuple::create(std::vector<Value> &&elements)
 {
+	if (elements.empty()) { return PyTuple::create(); }
 	auto &heap = VirtualMachine::the().heap();
 	if (auto *obj = heap.allocate<PyTuple>(std::move(elements))) { return Ok(obj); }
 	return Err(memory_error(sizeof(PyTuple)));
@@ -94,6 +99,7 @@ PyResult<PyTuple *> PyTuple::create(std::vector<Value> &&elements)
 
 PyResult<PyTuple *> PyTuple::create(PyType *type, std::vector<Value> elements)
 {
+	if (type == types::tuple() && elements.empty()) { return PyTuple::create(); }
 	auto &heap = VirtualMachine::the().heap();
 	if (auto *obj = heap.allocate<PyTuple>(type, std::move(elements))) { return Ok(obj); }
 	return Err(memory_error(sizeof(PyTuple)));
@@ -101,6 +107,7 @@ PyResult<PyTuple *> PyTuple::create(PyType *type, std::vector<Value> elements)
 
 PyResult<PyTuple *> PyTuple::create(PyType *type, const std::vector<PyObject *> &elements)
 {
+	if (type == types::tuple() && elements.empty()) { return PyTuple::create(); }
 	auto &heap = VirtualMachine::the().heap();
 	if (auto *obj = heap.allocate<PyTuple>(type, elements)) { return Ok(obj); }
 	return Err(memory_error(sizeof(PyTuple)));
@@ -108,6 +115,7 @@ PyResult<PyTuple *> PyTuple::create(PyType *type, const std::vector<PyObject *>
 
 PyResult<PyTuple *> PyTuple::create(const std::vector<PyObject *> &elements)
 {
+	if (elements.empty()) { return PyTuple::create(); }
 	auto &heap = VirtualMachine::the().heap();
 	if (auto *obj = heap.allocate<PyTuple>(elements)) { return Ok(obj); }
 	return Err(memory_error(sizeof(PyTuple)));
@@ -115,6 +123,7 @@ PyResult<PyTuple *> PyTuple::create(const std::vector<PyObject *> &elements)
 
 PyResult<PyTuple *> PyTuple::create(std::vector<PyObject *> &&elements)
 {
+	if (elements.empty()) { return PyTuple::create(); }
 	auto &heap = VirtualMachine::the().heap();
 	if (auto *obj = heap.allocate<PyTuple>(make_value_vector(std::move(elements)))) {
 		return Ok(obj);
@@ -187,13 +196,13 @@ PyResult<PyObject *> PyTuple::__new__(const PyType *type, PyTuple *args, PyDict
 
 	auto value = iterator->next();
 	while (value.is_ok()) {
-		els->elements().push_back(value.unwrap());
+		els->storage().push_back(value.unwrap());
 		value = iterator->next();
 	}
 
 	if (!value.unwrap_err()->type()->issubclass(stop_iteration()->type())) { return value; }
 
-	return PyTuple::create(const_cast<PyType *>(type), els->elements());
+	return PyTuple::create(const_cast<PyType *>(type), els->storage().values());
 }
 
 PyResult<PyObject *> PyTuple::__repr__() const { return PyString::create(to_string()); }
@@ -348,12 +357,14 @@ std::string PyTupleIterator::to_string() const
 
 PyResult<PyObject *> PyTupleIterator::__repr__() const { return PyString::create(to_string()); }
 
-PyResult<PyObject *> PyTupleIterator::__next__()
+PyResult<PyObject *> PyTupleIterator::__next__() { return next_from_iternext(iternext()); }
+
+PyResult<std::optional<Value>> PyTupleIterator::iternext()
 {
-	if (m_current_index < m_pytuple.elements().size())
-		return std::visit([](const auto &element) { return PyObject::from(element); },
-			m_pytuple.elements()[m_current_index++]);
-	return Err(stop_iteration());
+	if (m_current_index < m_pytuple.elements().size()) {
+		return Ok(std::optional<Value>{ m_pytuple.elements()[m_current_index++] });
+	}
+	return Ok(std::optional<Value>{});
 }
 
 bool PyTupleIterator::operator==(const PyTupleIterator &other) const
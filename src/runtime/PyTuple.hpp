@@ -94,6 +94,7 @@ class PyTupleIterator : public PyBaseObject
 
 	PyResult<PyObject *> __repr__() const;
 	PyResult<PyObject *> __next__();
+	PyResult<std::optional<Value>> iternext();
 
 	bool operator==(const PyTupleIterator &) const;
 	PyResult<PyObject *> operator*() const;
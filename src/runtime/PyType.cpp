@@ -1,5 +1,6 @@
 #include "PyType.hpp"
 #include "AttributeError.hpp"
+#include "MethodCache.hpp"
 #include "PyBool.hpp"
 #include "PyBoundMethod.hpp"
 #include "PyBuiltInMethod.hpp"
@@ -18,6 +19,7 @@
 #include "PySlotWrapper.hpp"
 #include "PyStaticMethod.hpp"
 #include "PyString.hpp"
+#include "Shape.hpp"
 #include "StopIteration.hpp"
 #include "TypeError.hpp"
 #include "ValueError.hpp"
@@ -370,8 +372,30 @@ PyResult<PyObject *> PyType::__getattribute__(PyObject *attribute) const
 		"type object '{}' has no attribute '{}'", underlying_type().__name__, name->value()));
 }
 
+PyResult<std::monostate> PyType::__setattribute__(PyObject *attribute, PyObject *value)
+{
+	auto result = PyObject::__setattribute__(attribute, value);
+	if (result.is_ok()) { modified(); }
+	return result;
+}
+
 std::optional<PyResult<PyObject *>> PyType::lookup(PyObject *name) const
 {
+	// the cache is keyed by the interned name, which the names of code objects already are
+	auto *name_str = [name]() -> PyString * {
+		auto *str = as<PyString>(name);
+		if (!str || str->is_interned()) { return str; }
+		auto interned = PyString::intern(str);
+		return interned.is_ok() ? interned.unwrap() : nullptr;
+	}();
+	const bool use_cache = name_str && assign_version_tag();
+	if (use_cache) {
+		if (auto cached = MethodCache::the().lookup(m_version_tag, name_str); cached.has_value()) {
+			if (!*cached) { return std::nullopt; }
+			return PyResult<PyObject *>(Ok(*cached));
+		}
+	}
+
 	auto mro = mro_internal();
 	if (mro.is_err()) { return mro; }
 	for (const auto &t_ : mro.unwrap()->elements()) {
@@ -380,16 +404,54 @@ std::optional<PyResult<PyObject *>> PyType::lookup(PyObject *name) const
 		ASSERT(t)
 		ASSERT(t->underlying_type().__dict__)
 		const auto &dict = t->underlying_type().__dict__->map();
-		if (auto it = dict.find(name); it != dict.end()) { return PyObject::from(it->second); }
+		if (auto it = dict.find(name); it != dict.end()) {
+			// only objects are kept alive by the dictionary, a PyObject created from any other
+			// value could be collected while the cache still points to it
+			if (use_cache && std::holds_alternative<PyObject *>(it->second)) {
+				MethodCache::the().store(m_version_tag, name_str, std::get<PyObject *>(it->second));
+			}
+			return PyObject::from(it->second);
+		}
 	}
+	if (use_cache) { MethodCache::the().store(m_version_tag, name_str, nullptr); }
 	return std::nullopt;
 }
 
+bool PyType::assign_version_tag() const
+{
+	if (m_version_tag != 0) { return true; }
+	if (!underlying_type().is_ready || !__mro__) { return false; }
+	// a type only has a valid tag if all of its bases have one, which lets modified() stop at
+	// types without a tag
+	for (const auto &el : __mro__->elements()) {
+		auto *base = as<PyType>(std::get<PyObject *>(el));
+		ASSERT(base)
+		if (base != this && !base->assign_version_tag()) { return false; }
+	}
+	m_version_tag = MethodCache::next_version_tag();
+	return m_version_tag != 0;
+}
+
+void PyType::modified()
+{
+	if (m_version_tag == 0) { return; }
+	m_version_tag = 0;
+	for (auto *subclass : m_subclasses) { subclass->modified(); }
+}
+
+PyType::~PyType()
+{
+	for (auto *base : m_registered_bases) { std::erase(base->m_subclasses, this); }
+	for (auto *subclass : m_subclasses) { std::erase(subclass->m_registered_bases, this); }
+}
+
 PyResult<PyObject *> PyType::heap_object_allocation(PyType *type)
 {
 	return type->mro()
 		.and_then([type](PyList *mro) -> PyResult<PyObject *> {
-			for (const auto &el : mro->elements()) {
+			const auto &mro_storage = mro->storage();
+			for (size_t i = 0; i < mro_storage.size(); ++i) {
+				const auto el = mro_storage[i];
 				ASSERT(std::holds_alternative<PyObject *>(el));
 				ASSERT(as<PyType>(std::get<PyObject *>(el)));
 				auto *t = as<PyType>(std::get<PyObject *>(el));
@@ -398,16 +460,6 @@ PyResult<PyObject *> PyType::heap_object_allocation(PyType *type)
 				}
 			}
 			return types::object()->underlying_type().__alloc__(type);
-		})
-		.and_then([](PyObject *obj) -> PyResult<PyObject *> {
-			if (!obj->attributes()) {
-				if (auto dict = PyDict::create(); dict.is_ok()) {
-					obj->m_attributes = dict.unwrap();
-				} else {
-					return dict;
-				}
-			}
-			return Ok(obj);
 		});
 }
 
@@ -420,6 +472,8 @@ PyResult<std::monostate> PyType::initialize(const std::string &name,
 	if (dict_.is_err()) { return Err(dict_.unwrap_err()); }
 	auto *dict = dict_.unwrap();
 	bool may_add_dict = base->attributes() == nullptr;
+	const bool declares_slots = dict->map().contains(String{ "__slots__" });
+	bool slots_have_dict = false;
 	if (auto it = dict->map().find(String{ "__slots__" }); it != dict->map().end()) {
 		// has slots
 		auto slots_ = PyObject::from(it->second);
@@ -435,7 +489,7 @@ PyResult<std::monostate> PyType::initialize(const std::string &name,
 
 			auto value_ = iter.unwrap()->next();
 			while (value_.is_ok()) {
-				slots_list.unwrap()->elements().push_back(value_.unwrap());
+				slots_list.unwrap()->storage().push_back(value_.unwrap());
 				value_ = iter.unwrap()->next();
 			}
 
@@ -443,7 +497,7 @@ PyResult<std::monostate> PyType::initialize(const std::string &name,
 				return Err(value_.unwrap_err());
 			}
 
-			slots = PyTuple::create(slots_list.unwrap()->elements()).unwrap();
+			slots = PyTuple::create(slots_list.unwrap()->storage().values()).unwrap();
 		}
 		ASSERT(as<PyTuple>(slots));
 
@@ -461,7 +515,14 @@ PyResult<std::monostate> PyType::initialize(const std::string &name,
 
 		__slots__.reserve(nslots);
 		for (const auto &el : as<PyTuple>(slots)->elements()) {
-			__slots__.push_back(PyObject::from(el).unwrap());
+			auto *slot = PyObject::from(el).unwrap();
+			// __dict__ and __weakref__ only enable features, they don't need any storage
+			if (as<PyString>(slot)->value() == "__dict__") {
+				slots_have_dict = true;
+				continue;
+			}
+			if (as<PyString>(slot)->value() == "__weakref__") { continue; }
+			__slots__.push_back(slot);
 		}
 
 		// TODO: should we mangle and sort slots?
@@ -470,7 +531,39 @@ PyResult<std::monostate> PyType::initialize(const std::string &name,
 	underlying_type().__name__ = name;
 	underlying_type().__bases__ = std::move(bases);
 	underlying_type().__base__ = base;
-	underlying_type().basicsize = base->underlying_type().basicsize;
+	underlying_type().basicsize =
+		base->underlying_type().basicsize + __slots__.size() * sizeof(PyObject *);
+	underlying_type().slot_count = base->underlying_type().slot_count + __slots__.size();
+	underlying_type().has_instance_dict =
+		!declares_slots || slots_have_dict
+		|| std::any_of(underlying_type().__bases__.begin(),
+			underlying_type().__bases__.end(),
+			[](PyType *b) {
+				return b->underlying_type().is_heaptype && b->underlying_type().has_instance_dict;
+			});
+
+	// Only objects allocated by object's __alloc__ have room for the ShapeAttributes pointer, the
+	// other builtin types may allocate instances of their subclasses themselves. Instances of all
+	// other types with an instance dict store their attributes in a PyDict.
+	const bool derives_only_from_object =
+		std::all_of(underlying_type().__bases__.begin(),
+			underlying_type().__bases__.end(),
+			[](PyType *b) {
+				return b == types::object()
+					   || (b->underlying_type().is_heaptype
+						   && b->underlying_type().instance_attributes_offset > 0);
+			});
+	if (underlying_type().has_instance_dict && derives_only_from_object) {
+		if (base->underlying_type().instance_attributes_offset > 0) {
+			underlying_type().instance_attributes_offset =
+				base->underlying_type().instance_attributes_offset;
+		} else {
+			// the pointer goes right after the object body of the base, before the slots of this
+			// type
+			underlying_type().instance_attributes_offset = base->underlying_type().basicsize;
+			underlying_type().basicsize += sizeof(ShapeAttributes *);
+		}
+	}
 
 	underlying_type().__dict__ = dict;
 	m_attributes = dict;
@@ -561,32 +654,43 @@ PyResult<std::monostate> PyType::initialize(const std::string &name,
 		}
 	}
 
-	if (!__slots__.empty()) {
-		size_t additional_offset = 0;
-		for (const auto &slot : __slots__) {
-			const auto name = as<PyString>(slot)->value();
-			underlying_type().add_member(MemberDefinition{
-				.name = name,
-				.member_accessor = [additional_offset, name = std::move(name)](
-									   PyObject *self) -> PyResult<PyObject *> {
-					const auto object_offset =
-						self->type()->underlying_type().basicsize + additional_offset;
-					auto *obj = *bit_cast<PyObject **>(bit_cast<uint8_t *>(self) + object_offset);
-					if (!obj) { return Err(attribute_error(name)); }
-					return Ok(obj);
-				},
-				.member_setter = [additional_offset](
-									 PyObject *self, PyObject *value) -> PyResult<std::monostate> {
-					const auto offset =
-						self->type()->underlying_type().basicsize + additional_offset;
-					uint8_t *self_address = bit_cast<uint8_t *>(self);
-					uint8_t *slot_address = self_address + offset;
-					*bit_cast<PyObject **>(slot_address) = value;
-					return Ok(std::monostate{});
-				},
-			});
-			additional_offset += sizeof(PyObject *);
+	// the slots of this type come right after the slots of its base
+	for (size_t offset = underlying_type().basicsize - __slots__.size() * sizeof(PyObject *);
+		 auto *slot : __slots__) {
+		auto *slot_name = as<PyString>(slot);
+		if (m_attributes->map().contains(slot_name)) {
+			return Err(value_error(
+				"'{}' in __slots__ conflicts with class variable", slot_name->value()));
 		}
+		auto descriptor = PyMemberDescriptor::create(slot_name, this, offset);
+		if (descriptor.is_err()) { return Err(descriptor.unwrap_err()); }
+		m_attributes->insert(slot_name, descriptor.unwrap());
+		offset += sizeof(PyObject *);
+	}
+
+	auto dict_name = PyString::create("__dict__");
+	if (dict_name.is_err()) { return Err(dict_name.unwrap_err()); }
+	const bool has_dict = underlying_type().has_instance_dict;
+	const bool inherits_dict = std::any_of(underlying_type().__bases__.begin(),
+		underlying_type().__bases__.end(),
+		[&dict_name](PyType *b) { return b->lookup(dict_name.unwrap()).has_value(); });
+	if (has_dict && !inherits_dict && !dict->map().contains(String{ "__dict__" })) {
+		underlying_type().add_property(PropertyDefinition{
+			.name = "__dict__",
+			.member_getter = [](PyObject *self) -> PyResult<PyObject *> {
+				return self->instance_dict();
+			},
+			.member_setter = [](PyObject *self, PyObject *value) -> PyResult<std::monostate> {
+				auto *new_dict = as<PyDict>(value);
+				if (!new_dict) {
+					return Err(type_error("__dict__ must be set to a dictionary, not a '{}'",
+						value->type()->name()));
+				}
+				if (auto **attributes = self->shape_attributes_slot()) { *attributes = nullptr; }
+				self->m_attributes = new_dict;
+				return Ok(std::monostate{});
+			},
+		});
 	}
 
 	underlying_type().__alloc__ = &PyType::heap_object_allocation;
@@ -594,6 +698,7 @@ PyResult<std::monostate> PyType::initialize(const std::string &name,
 	if (result.is_err()) { return Err(result.unwrap_err()); }
 
 	fixup_slots();
+	modified();
 
 	return Ok(std::monostate{});
 }
@@ -1284,7 +1389,22 @@ PyResult<std::monostate> PyType::ready()
 		}
 	}
 
-	// TODO: add subclass
+	for (auto *b : underlying_type().__bases__) {
+		if (!b || std::find(m_registered_bases.begin(), m_registered_bases.end(), b)
+					  != m_registered_bases.end()) {
+			continue;
+		}
+		b->m_subclasses.push_back(this);
+		m_registered_bases.push_back(b);
+	}
+
+	if (underlying_type().is_heaptype) {
+		underlying_type().slot_table = SlotTable::create(underlying_type());
+	} else {
+		// the table of a native type was generated by TypePrototype::create, it only lacks the
+		// slots that the prototype inherited from its bases or found in its __dict__ above
+		underlying_type().slot_table.fill_missing(SlotTable::create(underlying_type()));
+	}
 
 	// Done!
 	underlying_type().is_ready = true;
@@ -1419,6 +1539,7 @@ namespace {
 void PyType::fixup_slots()
 {
 	for (auto &&slot : slotdefs) { update_slot(this, slot); }
+	underlying_type().slot_table = SlotTable::create(underlying_type());
 }
 
 PyResult<PyObject *> PyType::__new__(const PyType *type_, PyTuple *args, PyDict *kwargs)
@@ -1529,15 +1650,19 @@ PyResult<PyType *> PyType::build_type(const PyType *metatype,
 		}
 	}
 
-	return PyType::create(const_cast<PyType *>(metatype)).and_then([&](PyType *type) {
-		type->underlying_type().is_heaptype = true;
-		type->__mro__ = nullptr;
-		type->initialize(type_name->value(), base, std::move(bases), ns);
+	return PyType::create(const_cast<PyType *>(metatype))
+		.and_then([&](PyType *type) -> PyResult<PyType *> {
+			type->underlying_type().is_heaptype = true;
+			type->__mro__ = nullptr;
+			if (auto result = type->initialize(type_name->value(), base, std::move(bases), ns);
+				result.is_err()) {
+				return Err(result.unwrap_err());
+			}
 
-		spdlog::trace("Created type@{} #{}", (void *)type, type->name());
+			spdlog::trace("Created type@{} #{}", (void *)type, type->name());
 
-		return Ok(type);
-	});
+			return Ok(type);
+		});
 }
 
 PyResult<const PyType *> PyType::calculate_metaclass(const PyType *type_,
@@ -1593,6 +1718,38 @@ PyResult<PyObject *> PyType::__call__(PyTuple *args, PyDict *kwargs) const
 	return obj_;
 }
 
+PyResult<PyObject *> PyType::vectorcall(std::span<const Value> args,
+	std::span<const std::string_view> kwnames) const
+{
+	const auto &new_slot = underlying_type().__new__;
+	const auto &init_slot = underlying_type().__init__;
+	const auto &object_new_slot = types::object()->underlying_type().__new__;
+	ASSERT(object_new_slot.has_value());
+
+	// object.__new__ ignores its arguments when __init__ is overridden, so in that case the
+	// instance can be created without packing the arguments into a tuple, and they can be
+	// forwarded to __init__ as they are
+	if (this != types::type() && new_slot.has_value()
+		&& std::holds_alternative<NewSlotFunctionType>(*new_slot) && init_slot.has_value()
+		&& std::holds_alternative<PyObject *>(*init_slot)
+		&& get_address(*new_slot) == get_address(*object_new_slot)) {
+		auto empty_args = PyTuple::create();
+		if (empty_args.is_err()) { return empty_args; }
+		auto obj_ = new_(empty_args.unwrap(), nullptr);
+		if (obj_.is_err()) { return obj_; }
+		if (auto *obj = obj_.unwrap(); obj->type() == this) {
+			if (auto res = obj->init(args, kwnames); res.is_err()) {
+				return Err(res.unwrap_err());
+			}
+		}
+		return obj_;
+	}
+
+	return pack_vector_args(args, kwnames).and_then([this](std::pair<PyTuple *, PyDict *> args) {
+		return __call__(args.first, args.second);
+	});
+}
+
 std::string PyType::to_string() const
 {
 	return fmt::format("<class '{}'>", underlying_type().__name__);
@@ -13,6 +13,13 @@ class PyType : public PyBaseObject
   private:
 	std::variant<std::reference_wrapper<TypePrototype>, std::unique_ptr<TypePrototype>>
 		m_underlying_type;
+	// the key of this type's entries in the MethodCache, 0 if the type has no valid tag
+	mutable uint32_t m_version_tag{ 0 };
+	// The types that have this type as a base, and the bases this type registered itself with.
+	// Neither list keeps its types alive, instead each type unlinks itself from the other list
+	// when it is destroyed, so that it doesn't matter in which order they are collected.
+	std::vector<PyType *> m_subclasses;
+	std::vector<PyType *> m_registered_bases;
 
   public:
 	PyString *__name__{ nullptr };
@@ -31,14 +38,19 @@ class PyType : public PyBaseObject
 	static PyResult<PyType *> create(PyType *);
 
   public:
+	~PyType() override;
+
 	static PyType *initialize(TypePrototype &type_prototype);
 	static PyType *initialize(std::unique_ptr<TypePrototype> &&type_prototype);
 
 	std::string name() const;
 
 	PyResult<PyObject *> __call__(PyTuple *args, PyDict *kwargs) const;
+	PyResult<PyObject *> vectorcall(std::span<const Value> args,
+		std::span<const std::string_view> kwnames) const;
 	PyResult<PyObject *> __repr__() const;
 	PyResult<PyObject *> __getattribute__(PyObject *attribute) const;
+	PyResult<std::monostate> __setattribute__(PyObject *attribute, PyObject *value);
 
 	PyResult<PyObject *> new_(PyTuple *args, PyDict *kwargs) const override;
 
@@ -78,6 +90,10 @@ class PyType : public PyBaseObject
 
 	std::optional<PyResult<PyObject *>> lookup(PyObject *name) const;
 
+	// Invalidates the cached lookups of this type and all its subclasses. Has to be called
+	// whenever the dictionary of a type is modified after the type is ready.
+	void modified();
+
 	PyDict *dict() { return m_attributes; }
 
 	static PyResult<PyObject *> heap_object_allocation(PyType *);
@@ -97,6 +113,7 @@ class PyType : public PyBaseObject
 	PyResult<std::monostate> inherit_slots(PyType *base);
 	void inherit_special(PyType *base);
 	void fixup_slots();
+	bool assign_version_tag() const;
 
 	PyResult<std::monostate> initialize(const std::string &name,
 		PyType *base,
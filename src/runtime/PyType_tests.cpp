@@ -1,4 +1,7 @@
+#include "MethodCache.hpp"
+#include "PyInteger.hpp"
 #include "PyList.hpp"
+#include "PyString.hpp"
 #include "PyTuple.hpp"
 #include "PyType.hpp"
 #include "types/builtin.hpp"
@@ -18,10 +21,10 @@ TEST(PyType, ObjectClassParent)
 	ASSERT_TRUE(mro_.is_ok());
 	auto *mro = mro_.unwrap();
 	ASSERT_TRUE(mro);
-	EXPECT_EQ(mro->elements().size(), 1);
+	EXPECT_EQ(mro->storage().size(), 1);
 
-	EXPECT_TRUE(std::holds_alternative<PyObject *>(mro->elements()[0]));
-	auto *mro_0 = std::get<PyObject *>(mro->elements()[0]);
+	EXPECT_TRUE(std::holds_alternative<PyObject *>(mro->storage()[0]));
+	auto *mro_0 = std::get<PyObject *>(mro->storage()[0]);
 	EXPECT_EQ(mro_0, types::object());
 }
 
@@ -49,11 +52,11 @@ TEST(PyType, InheritanceTriangle)
 	ASSERT_TRUE(C_mro_.is_ok());
 	auto *C_mro = C_mro_.unwrap();
 	ASSERT_TRUE(C_mro);
-	EXPECT_EQ(C_mro->elements().size(), 4);
-	EXPECT_EQ(std::get<PyObject *>(C_mro->elements()[0]), C);
-	EXPECT_EQ(std::get<PyObject *>(C_mro->elements()[1]), B1);
-	EXPECT_EQ(std::get<PyObject *>(C_mro->elements()[2]), B2);
-	EXPECT_EQ(std::get<PyObject *>(C_mro->elements()[3]), types::object());
+	EXPECT_EQ(C_mro->storage().size(), 4);
+	EXPECT_EQ(std::get<PyObject *>(C_mro->storage()[0]), C);
+	EXPECT_EQ(std::get<PyObject *>(C_mro->storage()[1]), B1);
+	EXPECT_EQ(std::get<PyObject *>(C_mro->storage()[2]), B2);
+	EXPECT_EQ(std::get<PyObject *>(C_mro->storage()[3]), types::object());
 }
 
 TEST(PyType, InheritanceDiamond)
@@ -69,10 +72,82 @@ TEST(PyType, InheritanceDiamond)
 	ASSERT_TRUE(C_mro_.is_ok());
 	auto *C_mro = C_mro_.unwrap();
 	ASSERT_TRUE(C_mro);
-	EXPECT_EQ(C_mro->elements().size(), 5);
-	EXPECT_EQ(std::get<PyObject *>(C_mro->elements()[0]), C);
-	EXPECT_EQ(std::get<PyObject *>(C_mro->elements()[1]), B1);
-	EXPECT_EQ(std::get<PyObject *>(C_mro->elements()[2]), B2);
-	EXPECT_EQ(std::get<PyObject *>(C_mro->elements()[3]), A);
-	EXPECT_EQ(std::get<PyObject *>(C_mro->elements()[4]), types::object());
+	EXPECT_EQ(C_mro->storage().size(), 5);
+	EXPECT_EQ(std::get<PyObject *>(C_mro->storage()[0]), C);
+	EXPECT_EQ(std::get<PyObject *>(C_mro->storage()[1]), B1);
+	EXPECT_EQ(std::get<PyObject *>(C_mro->storage()[2]), B2);
+	EXPECT_EQ(std::get<PyObject *>(C_mro->storage()[3]), A);
+	EXPECT_EQ(std::get<PyObject *>(C_mro->storage()[4]), types::object());
+}
+
+TEST(PyType, SlotTableUsesNativeFunctionPointers)
+{
+	[[maybe_unused]] auto scope = VirtualMachine::the().heap().scoped_gc_pause();
+	const auto &int_type = types::integer()->underlying_type();
+	ASSERT_TRUE(int_type.__add__.has_value());
+	ASSERT_NE(int_type.slot_table.add, nullptr);
+	EXPECT_EQ(int_type.slot_table.add, native_slot_table<PyInteger>.add);
+	EXPECT_EQ(int_type.slot_table.hash, native_slot_table<PyInteger>.hash);
+
+	auto *lhs = PyInteger::create(int64_t{ 40 }).unwrap();
+	auto *rhs = PyInteger::create(int64_t{ 2 }).unwrap();
+	auto result = lhs->add(rhs);
+	ASSERT_TRUE(result.is_ok());
+	ASSERT_TRUE(as<PyInteger>(result.unwrap()));
+	EXPECT_EQ(as<PyInteger>(result.unwrap())->as_i64(), 42);
+}
+
+TEST(PyType, SlotTableTrampolineForPythonSlots)
+{
+	[[maybe_unused]] auto scope = VirtualMachine::the().heap().scoped_gc_pause();
+	auto *prototype = new_type("WithPythonHash", { types::object() });
+	PyType *type = PyType::initialize(std::unique_ptr<TypePrototype>(prototype));
+	type->underlying_type().__hash__ = types::object();
+	type->underlying_type().slot_table = SlotTable::create(type->underlying_type());
+
+	ASSERT_TRUE(type->underlying_type().slot_table.hash);
+	EXPECT_NE(type->underlying_type().slot_table.hash,
+		types::object()->underlying_type().slot_table.hash);
+}
+
+TEST(PyType, MethodCacheHitsRepeatedLookups)
+{
+	[[maybe_unused]] auto scope = VirtualMachine::the().heap().scoped_gc_pause();
+	PyType *A =
+		PyType::initialize(std::unique_ptr<TypePrototype>(new_type("A", { types::object() })));
+	PyType *B = PyType::initialize(std::unique_ptr<TypePrototype>(new_type("B", { A })));
+	auto *name = PyString::intern("method_cache_test_attribute").unwrap();
+	auto *value = PyInteger::create(int64_t{ 1 }).unwrap();
+	ASSERT_TRUE(A->__setattribute__(name, value).is_ok());
+
+	auto &cache = MethodCache::the();
+	const auto misses = cache.misses();
+	auto first = B->lookup(name);
+	ASSERT_TRUE(first.has_value() && first->is_ok());
+	EXPECT_EQ(first->unwrap(), value);
+	EXPECT_EQ(cache.misses(), misses + 1);
+
+	const auto hits = cache.hits();
+	for (size_t i = 0; i < 10; ++i) {
+		auto result = B->lookup(name);
+		ASSERT_TRUE(result.has_value() && result->is_ok());
+		EXPECT_EQ(result->unwrap(), value);
+	}
+	EXPECT_EQ(cache.hits(), hits + 10);
+	EXPECT_EQ(cache.misses(), misses + 1);
+
+	// absent attributes are cached too
+	auto *missing = PyString::intern("method_cache_test_missing").unwrap();
+	EXPECT_FALSE(B->lookup(missing).has_value());
+	EXPECT_FALSE(B->lookup(missing).has_value());
+	EXPECT_EQ(cache.hits(), hits + 11);
+
+	// modifying a base invalidates the entries of its subclasses
+	auto *new_value = PyInteger::create(int64_t{ 2 }).unwrap();
+	ASSERT_TRUE(A->__setattribute__(name, new_value).is_ok());
+	const auto misses_before_update = cache.misses();
+	auto updated = B->lookup(name);
+	ASSERT_TRUE(updated.has_value() && updated->is_ok());
+	EXPECT_EQ(updated->unwrap(), new_value);
+	EXPECT_EQ(cache.misses(), misses_before_update + 1);
 }
@@ -39,24 +39,24 @@ PyResult<PyObject *> PyZip::__new__(const PyType *type, PyTuple *args, PyDict *k
 
 PyResult<PyObject *> PyZip::__iter__() const { return Ok(const_cast<PyZip *>(this)); }
 
-PyResult<PyObject *> PyZip::__next__()
+PyResult<PyObject *> PyZip::__next__() { return next_from_iternext(iternext()); }
+
+PyResult<std::optional<Value>> PyZip::iternext()
 {
-	if (m_iterators.empty()) {
-		return Err(stop_iteration());
-	} else {
-		// use a list here because it is mutable
-		auto els = PyList::create();
-		if (els.is_err()) { return els; }
-		for (auto *it : m_iterators) {
-			if (auto value = it->next(); value.is_ok()) {
-				els.unwrap()->elements().push_back(value.unwrap());
-			} else {
-				return value;
-			}
-		}
-		return PyTuple::create(els.unwrap()->elements());
-		;
+	if (m_iterators.empty()) { return Ok(std::optional<Value>{}); }
+
+	std::vector<Value> elements;
+	elements.reserve(m_iterators.size());
+	for (auto *it : m_iterators) {
+		auto value = it->try_next();
+		if (value.is_err()) { return value; }
+		auto next_value = value.unwrap();
+		if (!next_value.has_value()) { return value; }
+		elements.push_back(std::move(*next_value));
 	}
+	auto item = PyTuple::create(std::move(elements));
+	if (item.is_err()) { return Err(item.unwrap_err()); }
+	return Ok(std::optional<Value>{ item.unwrap() });
 }
 
 PyType *PyZip::static_type() const { return types::zip(); }
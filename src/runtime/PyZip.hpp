@@ -20,6 +20,7 @@ class PyZip : public PyBaseObject
 
 	PyResult<PyObject *> __iter__() const;
 	PyResult<PyObject *> __next__();
+	PyResult<std::optional<Value>> iternext();
 
 	void visit_graph(Visitor &) override;
 
@@ -0,0 +1,47 @@
+#include "RecursionError.hpp"
+#include "PyString.hpp"
+#include "types/api.hpp"
+#include "types/builtin.hpp"
+
+namespace py {
+
+RecursionError::RecursionError(PyType *type) : RuntimeError(type) {}
+
+RecursionError::RecursionError(PyTuple *args)
+	: RuntimeError(types::BuiltinTypes::the().recursion_error(), args)
+{}
+
+PyResult<PyObject *> RecursionError::__new__(const PyType *type, PyTuple *args, PyDict *kwargs)
+{
+	ASSERT(type == types::recursion_error());
+	ASSERT(!kwargs || kwargs->map().empty())
+	return Ok(RecursionError::create(args));
+}
+
+PyType *RecursionError::static_type() const
+{
+	ASSERT(types::recursion_error());
+	return types::recursion_error();
+}
+
+namespace {
+
+	std::once_flag recursion_error_flag;
+
+	std::unique_ptr<TypePrototype> register_recursion_error()
+	{
+		return std::move(
+			klass<RecursionError>("RecursionError", RuntimeError::class_type()).type);
+	}
+}// namespace
+
+std::function<std::unique_ptr<TypePrototype>()> RecursionError::type_factory()
+{
+	return []() {
+		static std::unique_ptr<TypePrototype> type = nullptr;
+		std::call_once(recursion_error_flag, []() { type = register_recursion_error(); });
+		return std::move(type);
+	};
+}
+
+}// namespace py
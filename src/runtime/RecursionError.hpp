@@ -0,0 +1,45 @@
+#pragma once
+
+#include "PyString.hpp"
+#include "PyTuple.hpp"
+#include "RuntimeError.hpp"
+#include "vm/VM.hpp"
+
+namespace py {
+
+class RecursionError : public RuntimeError
+{
+	friend class ::Heap;
+	template<typename... Args>
+	friend BaseException *recursion_error(const std::string &message, Args &&...args);
+
+  private:
+	RecursionError(PyType *type);
+
+	RecursionError(PyTuple *args);
+
+	static RecursionError *create(PyTuple *args)
+	{
+		auto &heap = VirtualMachine::the().heap();
+		return heap.allocate<RecursionError>(args);
+	}
+
+  public:
+	static PyResult<PyObject *> __new__(const PyType *type, PyTuple *args, PyDict *kwargs);
+
+	static std::function<std::unique_ptr<TypePrototype>()> type_factory();
+
+	PyType *static_type() const override;
+};
+
+template<typename... Args>
+inline BaseException *recursion_error(const std::string &message, Args &&...args)
+{
+	auto msg = PyString::create(fmt::format(message, std::forward<Args>(args)...));
+	ASSERT(msg.is_ok())
+	auto args_tuple = PyTuple::create(msg.unwrap());
+	ASSERT(args_tuple.is_ok())
+	return RecursionError::create(args_tuple.unwrap());
+}
+
+}// namespace py
@@ -22,8 +22,10 @@ template<> const RuntimeError *as(const PyObject *obj)
 
 RuntimeError::RuntimeError(PyType *type) : Exception(type) {}
 
+RuntimeError::RuntimeError(const TypePrototype &type, PyTuple *args) : Exception(type, args) {}
+
 RuntimeError::RuntimeError(PyTuple *args)
-	: Exception(types::BuiltinTypes::the().runtime_error(), args)
+	: RuntimeError(types::BuiltinTypes::the().runtime_error(), args)
 {}
 
 PyResult<RuntimeError *> RuntimeError::create(PyTuple *args)
@@ -34,6 +36,12 @@ PyResult<RuntimeError *> RuntimeError::create(PyTuple *args)
 	return Ok(obj);
 }
 
+PyType *RuntimeError::class_type()
+{
+	ASSERT(types::runtime_error());
+	return types::runtime_error();
+}
+
 PyType *RuntimeError::static_type() const
 {
 	ASSERT(types::runtime_error());
@@ -13,9 +13,12 @@ class RuntimeError : public Exception
 	template<typename... Args>
 	friend BaseException *runtime_error(const std::string &message, Args &&...args);
 
-  private:
+  protected:
 	RuntimeError(PyType *);
 
+	RuntimeError(const TypePrototype &type, PyTuple *args);
+
+  private:
 	RuntimeError(PyTuple *args);
 
 	static PyResult<RuntimeError *> create(PyTuple *args);
@@ -23,6 +26,8 @@ class RuntimeError : public Exception
   public:
 	static std::function<std::unique_ptr<TypePrototype>()> type_factory();
 
+	static PyType *class_type();
+
 	PyType *static_type() const override;
 };
 
@@ -0,0 +1,86 @@
+#include "Shape.hpp"
+
+#include "PyObject.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace py {
+
+namespace {
+	size_t shape_count = 1;
+}// namespace
+
+Shape::Shape(const Shape &parent, std::string key) : m_keys(parent.m_keys)
+{
+	m_keys.push_back(std::move(key));
+}
+
+Shape *Shape::root()
+{
+	static Shape root;
+	return &root;
+}
+
+std::optional<size_t> Shape::lookup(std::string_view name) const
+{
+	// instances rarely have more than a handful of attributes, so a linear scan beats hashing
+	for (size_t i = 0; i < m_keys.size(); ++i) {
+		if (m_keys[i] == name) { return i; }
+	}
+	return std::nullopt;
+}
+
+Shape *Shape::add(const std::string &name)
+{
+	if (auto it = m_transitions.find(name); it != m_transitions.end()) { return it->second.get(); }
+	if (size() >= kMaxAttributes || shape_count >= kMaxShapes) { return nullptr; }
+	shape_count++;
+	auto [it, _] = m_transitions.emplace(name, std::unique_ptr<Shape>(new Shape(*this, name)));
+	return it->second.get();
+}
+
+size_t Shape::capacity(size_t size)
+{
+	if (size == 0) { return 0; }
+	return std::max(size_t{ 4 }, std::bit_ceil(size));
+}
+
+const Value *ShapeAttributes::find(std::string_view name) const
+{
+	if (auto index = m_shape->lookup(name); index.has_value()) { return &m_values[*index]; }
+	return nullptr;
+}
+
+bool ShapeAttributes::set(const std::string &name, const Value &value)
+{
+	if (auto index = m_shape->lookup(name); index.has_value()) {
+		m_values[*index] = value;
+		return true;
+	}
+	auto *shape = m_shape->add(name);
+	if (!shape) { return false; }
+	const auto size = m_shape->size();
+	if (Shape::capacity(size + 1) > Shape::capacity(size)) {
+		auto values = std::make_unique<Value[]>(Shape::capacity(size + 1));
+		std::move(m_values.get(), m_values.get() + size, values.get());
+		m_values = std::move(values);
+	}
+	m_values[size] = value;
+	m_shape = shape;
+	return true;
+}
+
+std::string ShapeAttributes::to_string() const
+{
+	return fmt::format("ShapeAttributes(size={})", m_shape->size());
+}
+
+void ShapeAttributes::visit_graph(Visitor &visitor)
+{
+	for (size_t i = 0; i < m_shape->size(); ++i) {
+		if (auto *obj = std::get_if<PyObject *>(&m_values[i]); obj && *obj) { visitor.visit(**obj); }
+	}
+}
+
+}// namespace py
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Value.hpp"
+#include "memory/GarbageCollector.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace py {
+
+// A Shape (or hidden class) describes the layout of the attributes of an instance: the position of
+// an attribute name in the shape is the index of its value in the instance's attribute array.
+// Shapes form a transition tree rooted at Shape::root(), so instances that get the same attributes
+// added in the same order share a single Shape, and the attribute names are stored once per Shape
+// instead of once per instance.
+// Shapes are never freed, so the tree is bounded. An instance that would need a Shape with more
+// than kMaxAttributes attributes, or a new Shape once there are kMaxShapes of them, falls back to
+// storing its attributes in a PyDict.
+class Shape
+{
+	std::vector<std::string> m_keys;
+	std::unordered_map<std::string, std::unique_ptr<Shape>> m_transitions;
+
+	Shape() = default;
+	Shape(const Shape &parent, std::string key);
+
+  public:
+	static constexpr size_t kMaxAttributes = 64;
+	static constexpr size_t kMaxShapes = 1 << 14;
+
+	Shape(const Shape &) = delete;
+	Shape &operator=(const Shape &) = delete;
+
+	static Shape *root();
+
+	std::optional<size_t> lookup(std::string_view name) const;
+
+	// Returns the Shape with `name` added at the end, or nullptr if the transition tree can't grow
+	// any further
+	Shape *add(const std::string &name);
+
+	size_t size() const { return m_keys.size(); }
+	const std::vector<std::string> &keys() const { return m_keys; }
+
+	// The number of values an attribute array has room for when it holds `size` values
+	static size_t capacity(size_t size);
+};
+
+// The attribute values of an instance of a heap type that derives from object, at the index its
+// Shape gives to each attribute name. Only instances of such types keep a pointer to one, so other
+// objects don't pay for the shape storage.
+class ShapeAttributes : public Cell
+{
+	Shape *m_shape{ Shape::root() };
+	std::unique_ptr<Value[]> m_values;
+
+  public:
+	ShapeAttributes() = default;
+
+	const Shape *shape() const { return m_shape; }
+
+	const Value &operator[](size_t index) const { return m_values[index]; }
+
+	const Value *find(std::string_view name) const;
+
+	// Returns false if `name` is a new attribute and the transition tree can't grow any further
+	bool set(const std::string &name, const Value &value);
+
+	std::string to_string() const override;
+	void visit_graph(Visitor &) override;
+};
+
+}// namespace py
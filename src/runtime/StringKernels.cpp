@@ -0,0 +1,717 @@
+#include "StringKernels.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PY_STRING_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace py::string_kernels {
+
+namespace {
+	namespace scalar {
+		bool is_ascii(const char *data, size_t size)
+		{
+			for (size_t i = 0; i < size; ++i) {
+				if (static_cast<uint8_t>(data[i]) >= 0x80) { return false; }
+			}
+			return true;
+		}
+
+		size_t utf8_length(const char *data, size_t size)
+		{
+			size_t length = 0;
+			for (size_t i = 0; i < size; ++i) {
+				length += (static_cast<uint8_t>(data[i]) & 0xC0) != 0x80;
+			}
+			return length;
+		}
+
+		// the valid range of the second byte of a sequence, which excludes overlong encodings,
+		// surrogates and codepoints above U+10FFFF, and the length of the sequence, or 0 if
+		// `lead` cannot start a sequence
+		struct Utf8Lead
+		{
+			size_t length;
+			uint8_t lower;
+			uint8_t upper;
+		};
+
+		Utf8Lead utf8_lead(uint8_t lead)
+		{
+			if (lead < 0x80) { return { 1, 0, 0 }; }
+			if (lead >= 0xC2 && lead <= 0xDF) { return { 2, 0x80, 0xBF }; }
+			if (lead == 0xE0) { return { 3, 0xA0, 0xBF }; }
+			if (lead == 0xED) { return { 3, 0x80, 0x9F }; }
+			if (lead >= 0xE1 && lead <= 0xEF) { return { 3, 0x80, 0xBF }; }
+			if (lead == 0xF0) { return { 4, 0x90, 0xBF }; }
+			if (lead >= 0xF1 && lead <= 0xF3) { return { 4, 0x80, 0xBF }; }
+			if (lead == 0xF4) { return { 4, 0x80, 0x8F }; }
+			return { 0, 0, 0 };
+		}
+
+		// length of the valid sequence at the start of data, or 0 if it is invalid or truncated
+		size_t utf8_sequence_length(const uint8_t *data, size_t size)
+		{
+			const auto lead = utf8_lead(data[0]);
+			if (lead.length <= 1) { return lead.length; }
+			if (size < lead.length || data[1] < lead.lower || data[1] > lead.upper) { return 0; }
+			for (size_t i = 2; i < lead.length; ++i) {
+				if ((data[i] & 0xC0) != 0x80) { return 0; }
+			}
+			return lead.length;
+		}
+
+		size_t find_invalid_utf8(const char *data, size_t size)
+		{
+			const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+			for (size_t i = 0; i < size;) {
+				const auto length = utf8_sequence_length(bytes + i, size - i);
+				if (length == 0) { return i; }
+				i += length;
+			}
+			return std::string_view::npos;
+		}
+
+		bool is_ascii_digits(const char *data, size_t size)
+		{
+			for (size_t i = 0; i < size; ++i) {
+				if (static_cast<uint8_t>(data[i] - '0') > 9) { return false; }
+			}
+			return true;
+		}
+
+		bool is_whitespace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+		size_t first_non_whitespace(const char *data, size_t size)
+		{
+			size_t i = 0;
+			while (i < size && is_whitespace(data[i])) { ++i; }
+			return i;
+		}
+
+		size_t last_non_whitespace(const char *data, size_t size)
+		{
+			while (size > 0 && is_whitespace(data[size - 1])) { --size; }
+			return size;
+		}
+
+		void to_lower_ascii(char *data, size_t size)
+		{
+			for (size_t i = 0; i < size; ++i) {
+				if (data[i] >= 'A' && data[i] <= 'Z') { data[i] += 'a' - 'A'; }
+			}
+		}
+
+		void to_upper_ascii(char *data, size_t size)
+		{
+			for (size_t i = 0; i < size; ++i) {
+				if (data[i] >= 'a' && data[i] <= 'z') { data[i] -= 'a' - 'A'; }
+			}
+		}
+
+		size_t find(const char *haystack, size_t size, const char *needle, size_t needle_size)
+		{
+			if (needle_size > size) { return std::string_view::npos; }
+			return std::string_view{ haystack, size }.find(
+				std::string_view{ needle, needle_size });
+		}
+	}// namespace scalar
+
+#if defined(PY_STRING_KERNELS_X86)
+	// SSE2 is part of the x86-64 baseline, so these need no runtime check
+	namespace sse2 {
+		bool is_ascii(const char *data, size_t size)
+		{
+			size_t i = 0;
+			__m128i acc = _mm_setzero_si128();
+			for (; i + 16 <= size; i += 16) {
+				acc = _mm_or_si128(
+					acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)));
+			}
+			if (_mm_movemask_epi8(acc) != 0) { return false; }
+			return scalar::is_ascii(data + i, size - i);
+		}
+
+		size_t utf8_length(const char *data, size_t size)
+		{
+			size_t i = 0;
+			size_t length = 0;
+			// continuation bytes are 0b10xxxxxx, which is [-128, -65] as a signed byte
+			const __m128i continuation_max = _mm_set1_epi8(-65);
+			for (; i + 16 <= size; i += 16) {
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+				const int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(chunk, continuation_max));
+				length += std::popcount(static_cast<uint32_t>(mask));
+			}
+			return length + scalar::utf8_length(data + i, size - i);
+		}
+
+		// skips the ASCII blocks and validates the other sequences one by one
+		size_t find_invalid_utf8(const char *data, size_t size)
+		{
+			const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+			size_t i = 0;
+			while (i < size) {
+				if (i + 16 <= size
+					&& _mm_movemask_epi8(
+						   _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)))
+						   == 0) {
+					i += 16;
+					continue;
+				}
+				const auto length = scalar::utf8_sequence_length(bytes + i, size - i);
+				if (length == 0) { return i; }
+				i += length;
+			}
+			return std::string_view::npos;
+		}
+
+		bool is_ascii_digits(const char *data, size_t size)
+		{
+			size_t i = 0;
+			const __m128i zero = _mm_set1_epi8('0');
+			const __m128i nine = _mm_set1_epi8(9);
+			for (; i + 16 <= size; i += 16) {
+				const __m128i chunk = _mm_sub_epi8(
+					_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)), zero);
+				const __m128i in_range = _mm_cmpeq_epi8(_mm_min_epu8(chunk, nine), chunk);
+				if (_mm_movemask_epi8(in_range) != 0xFFFF) { return false; }
+			}
+			return scalar::is_ascii_digits(data + i, size - i);
+		}
+
+		__m128i whitespace_mask(__m128i chunk)
+		{
+			const __m128i space = _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' '));
+			const __m128i control = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('\t' - 1)),
+				_mm_cmplt_epi8(chunk, _mm_set1_epi8('\r' + 1)));
+			return _mm_or_si128(space, control);
+		}
+
+		size_t first_non_whitespace(const char *data, size_t size)
+		{
+			size_t i = 0;
+			for (; i + 16 <= size; i += 16) {
+				const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(whitespace_mask(
+									  _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)))))
+								  ^ 0xFFFF;
+				if (mask != 0) { return i + std::countr_zero(mask); }
+			}
+			return i + scalar::first_non_whitespace(data + i, size - i);
+		}
+
+		size_t last_non_whitespace(const char *data, size_t size)
+		{
+			for (; size >= 16; size -= 16) {
+				const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(whitespace_mask(
+									  _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+										  data + size - 16)))))
+								  ^ 0xFFFF;
+				if (mask != 0) { return size - 16 + (32 - std::countl_zero(mask)); }
+			}
+			return scalar::last_non_whitespace(data, size);
+		}
+
+		__m128i case_mask(__m128i chunk, char first, char last)
+		{
+			return _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(first - 1)),
+				_mm_cmplt_epi8(chunk, _mm_set1_epi8(last + 1)));
+		}
+
+		void to_lower_ascii(char *data, size_t size)
+		{
+			size_t i = 0;
+			const __m128i offset = _mm_set1_epi8('a' - 'A');
+			for (; i + 16 <= size; i += 16) {
+				auto *ptr = reinterpret_cast<__m128i *>(data + i);
+				const __m128i chunk = _mm_loadu_si128(ptr);
+				const __m128i mask = case_mask(chunk, 'A', 'Z');
+				_mm_storeu_si128(ptr, _mm_add_epi8(chunk, _mm_and_si128(mask, offset)));
+			}
+			scalar::to_lower_ascii(data + i, size - i);
+		}
+
+		void to_upper_ascii(char *data, size_t size)
+		{
+			size_t i = 0;
+			const __m128i offset = _mm_set1_epi8('a' - 'A');
+			for (; i + 16 <= size; i += 16) {
+				auto *ptr = reinterpret_cast<__m128i *>(data + i);
+				const __m128i chunk = _mm_loadu_si128(ptr);
+				const __m128i mask = case_mask(chunk, 'a', 'z');
+				_mm_storeu_si128(ptr, _mm_sub_epi8(chunk, _mm_and_si128(mask, offset)));
+			}
+			scalar::to_upper_ascii(data + i, size - i);
+		}
+
+		// Compares the first and the last byte of the needle against 16 candidate positions at a
+		// time, and only verifies the candidates where both match.
+		size_t find(const char *haystack, size_t size, const char *needle, size_t needle_size)
+		{
+			if (needle_size == 0 || needle_size > size) {
+				return scalar::find(haystack, size, needle, needle_size);
+			}
+			const __m128i first = _mm_set1_epi8(needle[0]);
+			const __m128i last = _mm_set1_epi8(needle[needle_size - 1]);
+			const size_t candidates = size - needle_size + 1;
+			size_t i = 0;
+			for (; i + 16 <= candidates; i += 16) {
+				const __m128i block_first =
+					_mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + i));
+				const __m128i block_last = _mm_loadu_si128(
+					reinterpret_cast<const __m128i *>(haystack + i + needle_size - 1));
+				auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+					_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last))));
+				while (mask != 0) {
+					const auto offset = static_cast<size_t>(std::countr_zero(mask));
+					if (std::memcmp(haystack + i + offset + 1, needle + 1, needle_size - 1) == 0) {
+						return i + offset;
+					}
+					mask &= mask - 1;
+				}
+			}
+			const auto result = scalar::find(haystack + i, size - i, needle, needle_size);
+			return result == std::string_view::npos ? result : i + result;
+		}
+	}// namespace sse2
+
+	namespace avx2 {
+		__attribute__((target("avx2"))) bool is_ascii(const char *data, size_t size)
+		{
+			size_t i = 0;
+			__m256i acc = _mm256_setzero_si256();
+			for (; i + 32 <= size; i += 32) {
+				acc = _mm256_or_si256(
+					acc, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i)));
+			}
+			if (_mm256_movemask_epi8(acc) != 0) { return false; }
+			return sse2::is_ascii(data + i, size - i);
+		}
+
+		__attribute__((target("avx2,popcnt"))) size_t utf8_length(const char *data, size_t size)
+		{
+			size_t i = 0;
+			size_t length = 0;
+			const __m256i continuation_max = _mm256_set1_epi8(-65);
+			for (; i + 32 <= size; i += 32) {
+				const __m256i chunk =
+					_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+				const int mask = _mm256_movemask_epi8(_mm256_cmpgt_epi8(chunk, continuation_max));
+				length += std::popcount(static_cast<uint32_t>(mask));
+			}
+			return length + sse2::utf8_length(data + i, size - i);
+		}
+
+		// Validates 32 bytes at a time with the lookup algorithm from "Validating UTF-8 In Less
+		// Than One Instruction Per Byte" (Keiser, Lemire): three table lookups on the nibbles of
+		// each byte and of the byte before it classify every invalid two byte pattern, and the
+		// bytes two and three positions back tell which continuation bytes are expected. The
+		// scalar validator finds the offending sequence once a block is rejected, and checks the
+		// sequence that is cut off by the end of the last block.
+		namespace utf8 {
+			constexpr uint8_t kTooShort = 1 << 0;
+			constexpr uint8_t kTooLong = 1 << 1;
+			constexpr uint8_t kOverlong3 = 1 << 2;
+			constexpr uint8_t kTooLarge = 1 << 3;
+			constexpr uint8_t kSurrogate = 1 << 4;
+			constexpr uint8_t kOverlong2 = 1 << 5;
+			constexpr uint8_t kTooLarge1000 = 1 << 6;
+			constexpr uint8_t kOverlong4 = 1 << 6;
+			constexpr uint8_t kTwoConts = 1 << 7;
+			constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+			__attribute__((target("avx2"))) __m256i lookup(__m256i table, __m256i nibbles)
+			{
+				return _mm256_shuffle_epi8(table, nibbles);
+			}
+
+			__attribute__((target("avx2"))) __m256i high_nibbles(__m256i input)
+			{
+				return _mm256_and_si256(_mm256_srli_epi16(input, 4), _mm256_set1_epi8(0x0F));
+			}
+
+			// the input shifted right by N bytes, with the last N bytes of `previous` shifted in
+			template<int N>
+			__attribute__((target("avx2"))) __m256i previous(__m256i input, __m256i previous)
+			{
+				return _mm256_alignr_epi8(
+					input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+			}
+
+			__attribute__((target("avx2"))) __m256i special_cases(__m256i input, __m256i prev1)
+			{
+				// clang-format off
+				const __m256i byte_1_high = lookup(_mm256_setr_epi8(
+					// 0_______ ________ <ASCII in byte 1>
+					kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+					// 10______ ________ <continuation in byte 1>
+					kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+					// 1100____ ________ <two byte lead in byte 1>
+					kTooShort | kOverlong2,
+					// 1101____ ________ <two byte lead in byte 1>
+					kTooShort,
+					// 1110____ ________ <three byte lead in byte 1>
+					kTooShort | kOverlong3 | kSurrogate,
+					// 1111____ ________ <four+ byte lead in byte 1>
+					static_cast<char>(kTooShort | kTooLarge | kTooLarge1000 | kOverlong4),
+					kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+					kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+					kTooShort | kOverlong2,
+					kTooShort,
+					kTooShort | kOverlong3 | kSurrogate,
+					static_cast<char>(kTooShort | kTooLarge | kTooLarge1000 | kOverlong4)),
+					high_nibbles(prev1));
+				constexpr auto kLarge = static_cast<char>(kCarry | kTooLarge | kTooLarge1000);
+				const __m256i byte_1_low = lookup(_mm256_setr_epi8(
+					// ____0000 ________
+					static_cast<char>(kCarry | kOverlong3 | kOverlong2 | kOverlong4),
+					// ____0001 ________
+					static_cast<char>(kCarry | kOverlong2),
+					// ____001_ ________
+					static_cast<char>(kCarry), static_cast<char>(kCarry),
+					// ____0100 ________
+					static_cast<char>(kCarry | kTooLarge),
+					// ____0101 ________ to ____1100 ________
+					kLarge, kLarge, kLarge, kLarge, kLarge, kLarge, kLarge, kLarge,
+					// ____1101 ________
+					static_cast<char>(kLarge | kSurrogate),
+					// ____111_ ________
+					kLarge, kLarge,
+					static_cast<char>(kCarry | kOverlong3 | kOverlong2 | kOverlong4),
+					static_cast<char>(kCarry | kOverlong2),
+					static_cast<char>(kCarry), static_cast<char>(kCarry),
+					static_cast<char>(kCarry | kTooLarge),
+					kLarge, kLarge, kLarge, kLarge, kLarge, kLarge, kLarge, kLarge,
+					static_cast<char>(kLarge | kSurrogate),
+					kLarge, kLarge),
+					_mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)));
+				constexpr auto kCont = static_cast<char>(kTooLong | kOverlong2 | kTwoConts);
+				const __m256i byte_2_high = lookup(_mm256_setr_epi8(
+					// ________ 0_______ <ASCII in byte 2>
+					kTooShort, kTooShort, kTooShort, kTooShort,
+					kTooShort, kTooShort, kTooShort, kTooShort,
+					// ________ 1000____
+					static_cast<char>(kCont | kOverlong3 | kTooLarge1000 | kOverlong4),
+					// ________ 1001____
+					static_cast<char>(kCont | kOverlong3 | kTooLarge),
+					// ________ 101_____
+					static_cast<char>(kCont | kSurrogate | kTooLarge),
+					static_cast<char>(kCont | kSurrogate | kTooLarge),
+					// ________ 11______
+					kTooShort, kTooShort, kTooShort, kTooShort,
+					kTooShort, kTooShort, kTooShort, kTooShort,
+					kTooShort, kTooShort, kTooShort, kTooShort,
+					static_cast<char>(kCont | kOverlong3 | kTooLarge1000 | kOverlong4),
+					static_cast<char>(kCont | kOverlong3 | kTooLarge),
+					static_cast<char>(kCont | kSurrogate | kTooLarge),
+					static_cast<char>(kCont | kSurrogate | kTooLarge),
+					kTooShort, kTooShort, kTooShort, kTooShort),
+					high_nibbles(input));
+				// clang-format on
+				return _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+			}
+
+			__attribute__((target("avx2"))) __m256i multibyte_lengths(__m256i input,
+				__m256i previous_input,
+				__m256i special_cases)
+			{
+				// only 111_____ and 1111____ are >= 0x80 after these subtractions
+				const __m256i is_third_byte = _mm256_subs_epu8(
+					previous<2>(input, previous_input), _mm256_set1_epi8(0xE0 - 0x80));
+				const __m256i is_fourth_byte = _mm256_subs_epu8(
+					previous<3>(input, previous_input), _mm256_set1_epi8(0xF0 - 0x80));
+				const __m256i must_be_continuation = _mm256_and_si256(
+					_mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(0x80));
+				return _mm256_xor_si256(must_be_continuation, special_cases);
+			}
+		}// namespace utf8
+
+		// the start of the sequence that contains the byte before `i`, if it may continue at `i`
+		size_t utf8_sequence_boundary(const char *data, size_t i)
+		{
+			for (size_t back = 1; back <= 3 && back <= i; ++back) {
+				if ((static_cast<uint8_t>(data[i - back]) & 0xC0) != 0x80) { return i - back; }
+			}
+			return i;
+		}
+
+		__attribute__((target("avx2"))) size_t find_invalid_utf8(const char *data, size_t size)
+		{
+			size_t i = 0;
+			__m256i previous_input = _mm256_setzero_si256();
+			for (; i + 32 <= size; i += 32) {
+				const __m256i input =
+					_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+				const __m256i special_cases =
+					utf8::special_cases(input, utf8::previous<1>(input, previous_input));
+				const __m256i error =
+					utf8::multibyte_lengths(input, previous_input, special_cases);
+				if (!_mm256_testz_si256(error, error)) { break; }
+				previous_input = input;
+			}
+			const auto start = utf8_sequence_boundary(data, i);
+			const auto result = scalar::find_invalid_utf8(data + start, size - start);
+			return result == std::string_view::npos ? result : start + result;
+		}
+
+		__attribute__((target("avx2"))) bool is_ascii_digits(const char *data, size_t size)
+		{
+			size_t i = 0;
+			const __m256i zero = _mm256_set1_epi8('0');
+			const __m256i nine = _mm256_set1_epi8(9);
+			for (; i + 32 <= size; i += 32) {
+				const __m256i chunk = _mm256_sub_epi8(
+					_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i)), zero);
+				const __m256i in_range = _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, nine), chunk);
+				if (static_cast<uint32_t>(_mm256_movemask_epi8(in_range)) != 0xFFFFFFFF) {
+					return false;
+				}
+			}
+			return sse2::is_ascii_digits(data + i, size - i);
+		}
+
+		__attribute__((target("avx2"))) __m256i whitespace_mask(__m256i chunk)
+		{
+			const __m256i space = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' '));
+			const __m256i control =
+				_mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('\t' - 1)),
+					_mm256_cmpgt_epi8(_mm256_set1_epi8('\r' + 1), chunk));
+			return _mm256_or_si256(space, control);
+		}
+
+		__attribute__((target("avx2,bmi"))) size_t first_non_whitespace(const char *data,
+			size_t size)
+		{
+			size_t i = 0;
+			for (; i + 32 <= size; i += 32) {
+				const auto mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(whitespace_mask(
+					_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i)))));
+				if (mask != 0) { return i + std::countr_zero(mask); }
+			}
+			return i + sse2::first_non_whitespace(data + i, size - i);
+		}
+
+		__attribute__((target("avx2,lzcnt"))) size_t last_non_whitespace(const char *data,
+			size_t size)
+		{
+			for (; size >= 32; size -= 32) {
+				const auto mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(whitespace_mask(
+					_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + size - 32)))));
+				if (mask != 0) { return size - std::countl_zero(mask); }
+			}
+			return sse2::last_non_whitespace(data, size);
+		}
+
+		__attribute__((target("avx2"))) __m256i case_mask(__m256i chunk, char first, char last)
+		{
+			return _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8(first - 1)),
+				_mm256_cmpgt_epi8(_mm256_set1_epi8(last + 1), chunk));
+		}
+
+		__attribute__((target("avx2"))) void to_lower_ascii(char *data, size_t size)
+		{
+			size_t i = 0;
+			const __m256i offset = _mm256_set1_epi8('a' - 'A');
+			for (; i + 32 <= size; i += 32) {
+				auto *ptr = reinterpret_cast<__m256i *>(data + i);
+				const __m256i chunk = _mm256_loadu_si256(ptr);
+				const __m256i mask = case_mask(chunk, 'A', 'Z');
+				_mm256_storeu_si256(ptr, _mm256_add_epi8(chunk, _mm256_and_si256(mask, offset)));
+			}
+			sse2::to_lower_ascii(data + i, size - i);
+		}
+
+		__attribute__((target("avx2"))) void to_upper_ascii(char *data, size_t size)
+		{
+			size_t i = 0;
+			const __m256i offset = _mm256_set1_epi8('a' - 'A');
+			for (; i + 32 <= size; i += 32) {
+				auto *ptr = reinterpret_cast<__m256i *>(data + i);
+				const __m256i chunk = _mm256_loadu_si256(ptr);
+				const __m256i mask = case_mask(chunk, 'a', 'z');
+				_mm256_storeu_si256(ptr, _mm256_sub_epi8(chunk, _mm256_and_si256(mask, offset)));
+			}
+			sse2::to_upper_ascii(data + i, size - i);
+		}
+
+		__attribute__((target("avx2,bmi"))) size_t find(const char *haystack,
+			size_t size,
+			const char *needle,
+			size_t needle_size)
+		{
+			if (needle_size == 0 || needle_size > size) {
+				return scalar::find(haystack, size, needle, needle_size);
+			}
+			const __m256i first = _mm256_set1_epi8(needle[0]);
+			const __m256i last = _mm256_set1_epi8(needle[needle_size - 1]);
+			const size_t candidates = size - needle_size + 1;
+			size_t i = 0;
+			for (; i + 32 <= candidates; i += 32) {
+				const __m256i block_first =
+					_mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + i));
+				const __m256i block_last = _mm256_loadu_si256(
+					reinterpret_cast<const __m256i *>(haystack + i + needle_size - 1));
+				auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(
+					_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last))));
+				while (mask != 0) {
+					const auto offset = static_cast<size_t>(std::countr_zero(mask));
+					if (std::memcmp(haystack + i + offset + 1, needle + 1, needle_size - 1) == 0) {
+						return i + offset;
+					}
+					mask &= mask - 1;
+				}
+			}
+			const auto result = sse2::find(haystack + i, size - i, needle, needle_size);
+			return result == std::string_view::npos ? result : i + result;
+		}
+	}// namespace avx2
+#endif
+
+	struct Kernels
+	{
+		bool (*is_ascii)(const char *, size_t);
+		size_t (*utf8_length)(const char *, size_t);
+		size_t (*find_invalid_utf8)(const char *, size_t);
+		bool (*is_ascii_digits)(const char *, size_t);
+		size_t (*first_non_whitespace)(const char *, size_t);
+		size_t (*last_non_whitespace)(const char *, size_t);
+		void (*to_lower_ascii)(char *, size_t);
+		void (*to_upper_ascii)(char *, size_t);
+		size_t (*find)(const char *, size_t, const char *, size_t);
+	};
+
+	const Kernels &kernels()
+	{
+		static const Kernels kernels = []() {
+#if defined(PY_STRING_KERNELS_X86)
+			__builtin_cpu_init();
+			// the AVX2 kernels also use tzcnt (bmi), lzcnt and popcnt
+			if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi")
+				&& __builtin_cpu_supports("lzcnt") && __builtin_cpu_supports("popcnt")) {
+				return Kernels{
+					.is_ascii = avx2::is_ascii,
+					.utf8_length = avx2::utf8_length,
+					.find_invalid_utf8 = avx2::find_invalid_utf8,
+					.is_ascii_digits = avx2::is_ascii_digits,
+					.first_non_whitespace = avx2::first_non_whitespace,
+					.last_non_whitespace = avx2::last_non_whitespace,
+					.to_lower_ascii = avx2::to_lower_ascii,
+					.to_upper_ascii = avx2::to_upper_ascii,
+					.find = avx2::find,
+				};
+			}
+			return Kernels{
+				.is_ascii = sse2::is_ascii,
+				.utf8_length = sse2::utf8_length,
+				.find_invalid_utf8 = sse2::find_invalid_utf8,
+				.is_ascii_digits = sse2::is_ascii_digits,
+				.first_non_whitespace = sse2::first_non_whitespace,
+				.last_non_whitespace = sse2::last_non_whitespace,
+				.to_lower_ascii = sse2::to_lower_ascii,
+				.to_upper_ascii = sse2::to_upper_ascii,
+				.find = sse2::find,
+			};
+#else
+			return Kernels{
+				.is_ascii = scalar::is_ascii,
+				.utf8_length = scalar::utf8_length,
+				.find_invalid_utf8 = scalar::find_invalid_utf8,
+				.is_ascii_digits = scalar::is_ascii_digits,
+				.first_non_whitespace = scalar::first_non_whitespace,
+				.last_non_whitespace = scalar::last_non_whitespace,
+				.to_lower_ascii = scalar::to_lower_ascii,
+				.to_upper_ascii = scalar::to_upper_ascii,
+				.find = scalar::find,
+			};
+#endif
+		}();
+		return kernels;
+	}
+}// namespace
+
+bool is_ascii(std::string_view str) { return kernels().is_ascii(str.data(), str.size()); }
+
+size_t utf8_length(std::string_view str) { return kernels().utf8_length(str.data(), str.size()); }
+
+size_t utf8_offset(std::string_view str, size_t codepoint)
+{
+	// skip the blocks that end before the codepoint with the vectorised length count
+	constexpr size_t kBlockSize = 64;
+	size_t offset = 0;
+	for (; offset + kBlockSize <= str.size(); offset += kBlockSize) {
+		const auto length = kernels().utf8_length(str.data() + offset, kBlockSize);
+		if (length > codepoint) { break; }
+		codepoint -= length;
+	}
+	for (; offset < str.size(); ++offset) {
+		if ((static_cast<uint8_t>(str[offset]) & 0xC0) == 0x80) { continue; }
+		if (codepoint == 0) { return offset; }
+		codepoint--;
+	}
+	return str.size();
+}
+
+size_t find_invalid_utf8(std::string_view str)
+{
+	return kernels().find_invalid_utf8(str.data(), str.size());
+}
+
+InvalidUtf8 describe_invalid_utf8(std::string_view str, size_t start)
+{
+	const auto *bytes = reinterpret_cast<const uint8_t *>(str.data());
+	const auto lead = scalar::utf8_lead(bytes[start]);
+	if (lead.length == 0) { return { start, start + 1, "invalid start byte" }; }
+	// the longest valid prefix of the sequence is rejected, up to the first invalid byte
+	for (size_t i = 1; i < lead.length; ++i) {
+		if (start + i == str.size()) { return { start, str.size(), "unexpected end of data" }; }
+		const auto byte = bytes[start + i];
+		const bool valid =
+			i == 1 ? byte >= lead.lower && byte <= lead.upper : (byte & 0xC0) == 0x80;
+		if (!valid) { return { start, start + i, "invalid continuation byte" }; }
+	}
+	return { start, start + lead.length, "invalid continuation byte" };
+}
+
+bool is_ascii_digits(std::string_view str)
+{
+	return !str.empty() && kernels().is_ascii_digits(str.data(), str.size());
+}
+
+size_t find(std::string_view haystack, std::string_view needle, size_t start)
+{
+	if (start > haystack.size()) { return std::string_view::npos; }
+	const auto result = kernels().find(
+		haystack.data() + start, haystack.size() - start, needle.data(), needle.size());
+	return result == std::string_view::npos ? result : start + result;
+}
+
+size_t count(std::string_view haystack, std::string_view needle)
+{
+	if (needle.empty()) { return haystack.size() + 1; }
+	size_t result = 0;
+	for (size_t pos = find(haystack, needle); pos != std::string_view::npos;
+		 pos = find(haystack, needle, pos + needle.size())) {
+		result++;
+	}
+	return result;
+}
+
+void to_lower_ascii(char *data, size_t size) { kernels().to_lower_ascii(data, size); }
+
+void to_upper_ascii(char *data, size_t size) { kernels().to_upper_ascii(data, size); }
+
+size_t first_non_whitespace(std::string_view str)
+{
+	return kernels().first_non_whitespace(str.data(), str.size());
+}
+
+size_t last_non_whitespace(std::string_view str)
+{
+	return kernels().last_non_whitespace(str.data(), str.size());
+}
+
+}// namespace py::string_kernels
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace py::string_kernels {
+
+// Byte-level kernels used by the str and bytes implementations. On x86-64 every kernel has an
+// AVX2 variant that is selected at runtime when the CPU supports it, with SSE2 (always available
+// on x86-64) as the baseline. Other targets use the scalar implementation.
+
+// true if every byte is < 0x80
+bool is_ascii(std::string_view);
+
+// number of UTF-8 codepoints, i.e. the number of bytes that are not continuation bytes
+size_t utf8_length(std::string_view);
+
+// byte offset of the codepoint at index `codepoint` of a valid UTF-8 string, or its size if the
+// string has fewer codepoints
+size_t utf8_offset(std::string_view, size_t codepoint);
+
+// index of the first byte of the first sequence that is not valid UTF-8, i.e. an invalid lead
+// byte, a missing continuation byte, an overlong encoding, a surrogate or a codepoint above
+// U+10FFFF, or npos if the input is valid
+size_t find_invalid_utf8(std::string_view);
+
+// how the utf-8 codec reports the invalid sequence that starts at `start`, as found by
+// find_invalid_utf8: the bytes [start, end) are rejected because of `reason`
+struct InvalidUtf8
+{
+	size_t start;
+	size_t end;
+	std::string_view reason;
+};
+InvalidUtf8 describe_invalid_utf8(std::string_view, size_t start);
+
+// true if the input is non-empty and only contains the bytes '0'-'9'
+bool is_ascii_digits(std::string_view);
+
+// index of the first occurence of needle in haystack at or after start, or npos
+size_t find(std::string_view haystack, std::string_view needle, size_t start = 0);
+
+// number of non-overlapping occurences of needle in haystack
+size_t count(std::string_view haystack, std::string_view needle);
+
+// maps 'A'-'Z' to 'a'-'z' (or the reverse) in place and leaves every other byte untouched
+void to_lower_ascii(char *data, size_t size);
+void to_upper_ascii(char *data, size_t size);
+
+// index of the first/one past the last byte that is not ASCII whitespace (" \t\n\v\f\r")
+size_t first_non_whitespace(std::string_view);
+size_t last_non_whitespace(std::string_view);
+
+}// namespace py::string_kernels
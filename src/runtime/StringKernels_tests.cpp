@@ -0,0 +1,101 @@
+#include "StringKernels.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace py;
+
+TEST(StringKernels, utf8_length)
+{
+	// long enough to go through the vectorised loop and the scalar tail
+	const std::string str = "log line with a few non-ASCII codepoints: é, ö and 😃 at the end";
+	EXPECT_EQ(string_kernels::utf8_length(str), 63);
+	EXPECT_FALSE(string_kernels::is_ascii(str));
+	EXPECT_TRUE(string_kernels::is_ascii("2024-01-01T00:00:00 INFO request served in 12ms"));
+}
+
+TEST(StringKernels, find)
+{
+	const std::string csv = "id,name,value\n1,foo,10\n2,bar,20\n3,baz,30\n4,foo,40\n";
+	EXPECT_EQ(string_kernels::find(csv, "foo"), 16);
+	EXPECT_EQ(string_kernels::find(csv, "foo", 18), 43);
+	EXPECT_EQ(string_kernels::find(csv, "qux"), std::string_view::npos);
+	EXPECT_EQ(string_kernels::find(csv, "\n"), 13);
+	EXPECT_EQ(string_kernels::count(csv, "\n"), 5);
+	EXPECT_EQ(string_kernels::count(csv, "foo"), 2);
+}
+
+TEST(StringKernels, case_mapping_and_whitespace)
+{
+	std::string str = "  \tMixed Case ASCII, with ümlauts and digits 0123456789\r\n";
+	string_kernels::to_upper_ascii(str.data(), str.size());
+	EXPECT_EQ(str, "  \tMIXED CASE ASCII, WITH üMLAUTS AND DIGITS 0123456789\r\n");
+	string_kernels::to_lower_ascii(str.data(), str.size());
+	EXPECT_EQ(str, "  \tmixed case ascii, with ümlauts and digits 0123456789\r\n");
+	EXPECT_EQ(string_kernels::first_non_whitespace(str), 3);
+	EXPECT_EQ(string_kernels::last_non_whitespace(str), str.size() - 2);
+	EXPECT_TRUE(string_kernels::is_ascii_digits("0123456789012345678901234567890123456789"));
+	EXPECT_FALSE(string_kernels::is_ascii_digits("012345678901234567890123456789012345678x"));
+	EXPECT_FALSE(string_kernels::is_ascii_digits(""));
+}
+
+TEST(StringKernels, utf8_offset)
+{
+	EXPECT_EQ(string_kernels::utf8_offset("héllo", 2), 3);
+	EXPECT_EQ(string_kernels::utf8_offset("héllo", 5), 6);
+	EXPECT_EQ(string_kernels::utf8_offset("héllo", 10), 6);
+
+	// crosses the blocks that are skipped with the vectorised length count
+	std::string str;
+	for (size_t i = 0; i < 50; ++i) { str += "aé😃"; }
+	for (size_t i = 0; i < 150; ++i) {
+		const auto offset = string_kernels::utf8_offset(str, i);
+		EXPECT_EQ(string_kernels::utf8_length(std::string_view{ str }.substr(0, offset)), i);
+		EXPECT_NE(static_cast<uint8_t>(str[offset]) & 0xC0, 0x80);
+	}
+}
+
+TEST(StringKernels, utf8_validation)
+{
+	std::string valid;
+	for (size_t i = 0; i < 20; ++i) { valid += "2024-01-01 é ünïcödé 😃 \xf4\x8f\xbf\xbf ok\n"; }
+	EXPECT_EQ(string_kernels::find_invalid_utf8(valid), std::string_view::npos);
+	EXPECT_EQ(string_kernels::find_invalid_utf8(""), std::string_view::npos);
+
+	// every position of the vectorised blocks and of the scalar tail
+	for (size_t i = 0; i < valid.size(); ++i) {
+		if ((static_cast<uint8_t>(valid[i]) & 0xC0) == 0x80) { continue; }
+		auto invalid_lead = valid;
+		invalid_lead[i] = '\xff';
+		EXPECT_EQ(string_kernels::find_invalid_utf8(invalid_lead), i);
+		if (static_cast<uint8_t>(valid[i]) >= 0xC0) {
+			EXPECT_EQ(string_kernels::find_invalid_utf8(valid.substr(0, i + 1)), i);
+			auto missing_continuation = valid;
+			missing_continuation[i + 1] = 'a';
+			EXPECT_EQ(string_kernels::find_invalid_utf8(missing_continuation), i);
+		}
+	}
+
+	const std::string padding(45, 'a');
+	for (const auto *sequence : { "\xc0\xaf", "\xc1\xbf", "\xe0\x80\xaf", "\xed\xa0\x80",
+			 "\xf0\x80\x80\xaf", "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\x80", "\xbf" }) {
+		EXPECT_EQ(string_kernels::find_invalid_utf8(sequence), 0) << sequence;
+		EXPECT_EQ(string_kernels::find_invalid_utf8(padding + sequence + padding), padding.size())
+			<< sequence;
+	}
+}
+
+TEST(StringKernels, describe_invalid_utf8)
+{
+	const auto check = [](std::string_view str, size_t end, std::string_view reason) {
+		const auto invalid = string_kernels::describe_invalid_utf8(str, 1);
+		EXPECT_EQ(invalid.start, 1);
+		EXPECT_EQ(invalid.end, end);
+		EXPECT_EQ(invalid.reason, reason);
+	};
+	check("a\xff", 2, "invalid start byte");
+	check("a\x80", 2, "invalid start byte");
+	check("a\xe2\x82", 3, "unexpected end of data");
+	check("a\xe2\x28\xa1", 2, "invalid continuation byte");
+	check("a\xe2\x82\x28", 3, "invalid continuation byte");
+	check("a\xed\xa0\x80", 2, "invalid continuation byte");
+}
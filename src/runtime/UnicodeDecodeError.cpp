@@ -0,0 +1,47 @@
+#include "UnicodeDecodeError.hpp"
+#include "PyString.hpp"
+#include "types/api.hpp"
+#include "types/builtin.hpp"
+
+namespace py {
+
+UnicodeDecodeError::UnicodeDecodeError(PyType *type) : ValueError(type) {}
+
+UnicodeDecodeError::UnicodeDecodeError(PyTuple *args)
+	: ValueError(types::BuiltinTypes::the().unicode_decode_error(), args)
+{}
+
+PyResult<PyObject *> UnicodeDecodeError::__new__(const PyType *type, PyTuple *args, PyDict *kwargs)
+{
+	ASSERT(type == types::unicode_decode_error());
+	ASSERT(!kwargs || kwargs->map().empty())
+	return Ok(UnicodeDecodeError::create(args));
+}
+
+PyType *UnicodeDecodeError::static_type() const
+{
+	ASSERT(types::unicode_decode_error());
+	return types::unicode_decode_error();
+}
+
+namespace {
+
+	std::once_flag unicode_decode_error_flag;
+
+	std::unique_ptr<TypePrototype> register_unicode_decode_error()
+	{
+		return std::move(
+			klass<UnicodeDecodeError>("UnicodeDecodeError", ValueError::class_type()).type);
+	}
+}// namespace
+
+std::function<std::unique_ptr<TypePrototype>()> UnicodeDecodeError::type_factory()
+{
+	return []() {
+		static std::unique_ptr<TypePrototype> type = nullptr;
+		std::call_once(unicode_decode_error_flag, []() { type = register_unicode_decode_error(); });
+		return std::move(type);
+	};
+}
+
+}// namespace py
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "PyString.hpp"
+#include "PyTuple.hpp"
+#include "ValueError.hpp"
+#include "vm/VM.hpp"
+
+namespace py {
+
+class UnicodeDecodeError : public ValueError
+{
+	friend class ::Heap;
+	template<typename... Args>
+	friend BaseException *unicode_decode_error(const std::string &message, Args &&...args);
+
+  private:
+	UnicodeDecodeError(PyType *type);
+
+	UnicodeDecodeError(PyTuple *args);
+
+	static UnicodeDecodeError *create(PyTuple *args)
+	{
+		auto &heap = VirtualMachine::the().heap();
+		return heap.allocate<UnicodeDecodeError>(args);
+	}
+
+  public:
+	static PyResult<PyObject *> __new__(const PyType *type, PyTuple *args, PyDict *kwargs);
+
+	static std::function<std::unique_ptr<TypePrototype>()> type_factory();
+
+	PyType *static_type() const override;
+};
+
+template<typename... Args>
+inline BaseException *unicode_decode_error(const std::string &message, Args &&...args)
+{
+	auto msg = PyString::create(fmt::format(message, std::forward<Args>(args)...));
+	ASSERT(msg.is_ok())
+	auto args_tuple = PyTuple::create(msg.unwrap());
+	ASSERT(args_tuple.is_ok())
+	return UnicodeDecodeError::create(args_tuple.unwrap());
+}
+
+}// namespace py
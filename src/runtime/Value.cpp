@@ -18,33 +18,77 @@
 
 using namespace py;
 
+namespace {
+// Helpers used by the mixed-representation arithmetic below. Integer operands that end up in the
+// BigIntType paths are widened here, so that the int64_t fast paths stay free of GMP.
+BigIntType to_big_int(int64_t value) { return BigIntType{ static_cast<long>(value) }; }
+const BigIntType &to_big_int(const BigIntType &value) { return value; }
+
+double to_double(int64_t value) { return static_cast<double>(value); }
+double to_double(const BigIntType &value) { return value.get_d(); }
+double to_double(double value) { return value; }
+}// namespace
+
 std::string Number::to_string() const
 {
 	return std::visit([](const auto &value) { return fmt::format("{}", value); }, value);
 }
 
+BigIntType Number::as_big_int() const
+{
+	ASSERT(is_integer());
+	if (std::holds_alternative<int64_t>(value)) { return to_big_int(std::get<int64_t>(value)); }
+	return std::get<BigIntType>(value);
+}
+
 Number Number::exp(const Number &rhs) const
 {
 	return std::visit(
 		overloaded{
-			[](const mpz_class &lhs_value, const mpz_class &rhs_value) -> Number {
-				if (rhs_value.fits_ulong_p()) {
-					mpz_class result{};
-					mpz_pow_ui(result.get_mpz_t(), lhs_value.get_mpz_t(), rhs_value.get_ui());
-					return Number{ std::move(result) };
-				} else {
-					return Number{ std::pow(lhs_value.get_d(), rhs_value.get_d()) };
+			[](const int64_t &lhs_value, const int64_t &rhs_value) -> Number {
+				if (rhs_value < 0) {
+					return Number{ std::pow(to_double(lhs_value), to_double(rhs_value)) };
 				}
-			},
-			[](const mpz_class &lhs_value, const double &rhs_value) -> Number {
-				return Number{ std::pow(lhs_value.get_d(), rhs_value) };
-			},
-			[](const double &lhs_value, const mpz_class &rhs_value) -> Number {
-				return Number{ std::pow(lhs_value, rhs_value.get_d()) };
+				int64_t result{ 1 };
+				int64_t base = lhs_value;
+				int64_t exponent = rhs_value;
+				while (exponent > 0) {
+					if ((exponent & 1)
+						&& __builtin_mul_overflow(result, base, &result)) [[unlikely]] {
+						break;
+					}
+					exponent >>= 1;
+					if (exponent > 0 && __builtin_mul_overflow(base, base, &base)) [[unlikely]] {
+						break;
+					}
+				}
+				if (exponent == 0) { return Number{ result }; }
+				BigIntType big_result{};
+				mpz_pow_ui(big_result.get_mpz_t(),
+					to_big_int(lhs_value).get_mpz_t(),
+					static_cast<unsigned long>(rhs_value));
+				return Number{ std::move(big_result) };
 			},
 			[](const double &lhs_value, const double &rhs_value) -> Number {
 				return Number{ std::pow(lhs_value, rhs_value) };
 			},
+			[](const double &lhs_value, const auto &rhs_value) -> Number {
+				return Number{ std::pow(lhs_value, to_double(rhs_value)) };
+			},
+			[](const auto &lhs_value, const double &rhs_value) -> Number {
+				return Number{ std::pow(to_double(lhs_value), rhs_value) };
+			},
+			[](const auto &lhs_value, const auto &rhs_value) -> Number {
+				const auto &exponent = to_big_int(rhs_value);
+				if (exponent.fits_ulong_p()) {
+					BigIntType result{};
+					mpz_pow_ui(
+						result.get_mpz_t(), to_big_int(lhs_value).get_mpz_t(), exponent.get_ui());
+					return Number{ std::move(result) };
+				} else {
+					return Number{ std::pow(to_double(lhs_value), to_double(rhs_value)) };
+				}
+			},
 		},
 		value,
 		rhs.value);
@@ -53,17 +97,25 @@ Number Number::exp(const Number &rhs) const
 Number Number::operator+(const Number &rhs) const
 {
 	return std::visit(overloaded{
-						  [](const mpz_class &lhs_value, const mpz_class &rhs_value) -> Number {
+						  [](const int64_t &lhs_value, const int64_t &rhs_value) -> Number {
+							  int64_t result;
+							  if (__builtin_add_overflow(lhs_value, rhs_value, &result))
+								  [[unlikely]] {
+								  return Number{ to_big_int(lhs_value) + to_big_int(rhs_value) };
+							  }
+							  return Number{ result };
+						  },
+						  [](const double &lhs_value, const double &rhs_value) -> Number {
 							  return Number{ lhs_value + rhs_value };
 						  },
-						  [](const mpz_class &lhs_value, const double &rhs_value) -> Number {
-							  return Number{ lhs_value.get_d() + rhs_value };
+						  [](const double &lhs_value, const auto &rhs_value) -> Number {
+							  return Number{ lhs_value + to_double(rhs_value) };
 						  },
-						  [](const double &lhs_value, const mpz_class &rhs_value) -> Number {
-							  return Number{ lhs_value + rhs_value.get_d() };
+						  [](const auto &lhs_value, const double &rhs_value) -> Number {
+							  return Number{ to_double(lhs_value) + rhs_value };
 						  },
-						  [](const double &lhs_value, const double &rhs_value) -> Number {
-							  return Number{ lhs_value + rhs_value };
+						  [](const auto &lhs_value, const auto &rhs_value) -> Number {
+							  return Number{ to_big_int(lhs_value) + to_big_int(rhs_value) };
 						  },
 					  },
 		value,
@@ -73,17 +125,25 @@ Number Number::operator+(const Number &rhs) const
 Number Number::operator-(const Number &rhs) const
 {
 	return std::visit(overloaded{
-						  [](const mpz_class &lhs_value, const mpz_class &rhs_value) -> Number {
+						  [](const int64_t &lhs_value, const int64_t &rhs_value) -> Number {
+							  int64_t result;
+							  if (__builtin_sub_overflow(lhs_value, rhs_value, &result))
+								  [[unlikely]] {
+								  return Number{ to_big_int(lhs_value) - to_big_int(rhs_value) };
+							  }
+							  return Number{ result };
+						  },
+						  [](const double &lhs_value, const double &rhs_value) -> Number {
 							  return Number{ lhs_value - rhs_value };
 						  },
-						  [](const mpz_class &lhs_value, const double &rhs_value) -> Number {
-							  return Number{ lhs_value.get_d() - rhs_value };
+						  [](const double &lhs_value, const auto &rhs_value) -> Number {
+							  return Number{ lhs_value - to_double(rhs_value) };
 						  },
-						  [](const double &lhs_value, const mpz_class &rhs_value) -> Number {
-							  return Number{ lhs_value - rhs_value.get_d() };
+						  [](const auto &lhs_value, const double &rhs_value) -> Number {
+							  return Number{ to_double(lhs_value) - rhs_value };
 						  },
-						  [](const double &lhs_value, const double &rhs_value) -> Number {
-							  return Number{ lhs_value - rhs_value };
+						  [](const auto &lhs_value, const auto &rhs_value) -> Number {
+							  return Number{ to_big_int(lhs_value) - to_big_int(rhs_value) };
 						  },
 					  },
 		value,
@@ -93,18 +153,31 @@ Number Number::operator-(const Number &rhs) const
 Number Number::operator%(const Number &rhs) const
 {
 	return std::visit(overloaded{
-						  [](const mpz_class &lhs_value, const mpz_class &rhs_value) -> Number {
-							  return Number{ lhs_value % rhs_value };
-						  },
-						  [](const mpz_class &lhs_value, const double &rhs_value) -> Number {
-							  return Number{ std::fmod(lhs_value.get_d(), rhs_value) };
-						  },
-						  [](const double &lhs_value, const mpz_class &rhs_value) -> Number {
-							  return Number{ std::fmod(lhs_value, rhs_value.get_d()) };
+						  [](const int64_t &lhs_value, const int64_t &rhs_value) -> Number {
+							  // INT64_MIN % -1 traps on x86, but the result is always 0
+							  if (rhs_value == -1) { return Number{ int64_t{ 0 } }; }
+							  int64_t result = lhs_value % rhs_value;
+							  if (result != 0 && ((result < 0) != (rhs_value < 0))) {
+								  result += rhs_value;
+							  }
+							  return Number{ result };
 						  },
 						  [](const double &lhs_value, const double &rhs_value) -> Number {
 							  return Number{ std::fmod(lhs_value, rhs_value) };
 						  },
+						  [](const double &lhs_value, const auto &rhs_value) -> Number {
+							  return Number{ std::fmod(lhs_value, to_double(rhs_value)) };
+						  },
+						  [](const auto &lhs_value, const double &rhs_value) -> Number {
+							  return Number{ std::fmod(to_double(lhs_value), rhs_value) };
+						  },
+						  [](const auto &lhs_value, const auto &rhs_value) -> Number {
+							  BigIntType result{};
+							  mpz_fdiv_r(result.get_mpz_t(),
+								  to_big_int(lhs_value).get_mpz_t(),
+								  to_big_int(rhs_value).get_mpz_t());
+							  return Number{ std::move(result) };
+						  },
 					  },
 		value,
 		rhs.value);
@@ -112,20 +185,10 @@ Number Number::operator%(const Number &rhs) const
 
 Number Number::operator/(const Number &other) const
 {
-	return std::visit(overloaded{
-						  [](const mpz_class &lhs_value, const mpz_class &rhs_value) -> Number {
-							  return Number{ lhs_value.get_d() / rhs_value.get_d() };
-						  },
-						  [](const mpz_class &lhs_value, const double &rhs_value) -> Number {
-							  return Number{ lhs_value.get_d() / rhs_value };
-						  },
-						  [](const double &lhs_value, const mpz_class &rhs_value) -> Number {
-							  return Number{ lhs_value / rhs_value.get_d() };
-						  },
-						  [](const double &lhs_value, const double &rhs_value) -> Number {
-							  return Number{ lhs_value / rhs_value };
-						  },
-					  },
+	return std::visit(
+		[](const auto &lhs_value, const auto &rhs_value) -> Number {
+			return Number{ to_double(lhs_value) / to_double(rhs_value) };
+		},
 		value,
 		other.value);
 }
@@ -133,17 +196,25 @@ Number Number::operator/(const Number &other) const
 Number Number::operator*(const Number &other) const
 {
 	return std::visit(overloaded{
-						  [](const mpz_class &lhs_value, const mpz_class &rhs_value) -> Number {
+						  [](const int64_t &lhs_value, const int64_t &rhs_value) -> Number {
+							  int64_t result;
+							  if (__builtin_mul_overflow(lhs_value, rhs_value, &result))
+								  [[unlikely]] {
+								  return Number{ to_big_int(lhs_value) * to_big_int(rhs_value) };
+							  }
+							  return Number{ result };
+						  },
+						  [](const double &lhs_value, const double &rhs_value) -> Number {
 							  return Number{ lhs_value * rhs_value };
 						  },
-						  [](const mpz_class &lhs_value, const double &rhs_value) -> Number {
-							  return Number{ lhs_value.get_d() * rhs_value };
+						  [](const double &lhs_value, const auto &rhs_value) -> Number {
+							  return Number{ lhs_value * to_double(rhs_value) };
 						  },
-						  [](const double &lhs_value, const mpz_class &rhs_value) -> Number {
-							  return Number{ lhs_value * rhs_value.get_d() };
+						  [](const auto &lhs_value, const double &rhs_value) -> Number {
+							  return Number{ to_double(lhs_value) * rhs_value };
 						  },
-						  [](const double &lhs_value, const double &rhs_value) -> Number {
-							  return Number{ lhs_value * rhs_value };
+						  [](const auto &lhs_value, const auto &rhs_value) -> Number {
+							  return Number{ to_big_int(lhs_value) * to_big_int(rhs_value) };
 						  },
 					  },
 		value,
@@ -180,22 +251,32 @@ bool Number::operator==(const Number &rhs) const
 Number Number::operator<<(const Number &rhs) const
 {
 	return std::visit(overloaded{
-						  [](const mpz_class &lhs_value, const mpz_class &rhs_value) -> Number {
-							  ASSERT(rhs_value.fits_ulong_p());
-							  return Number{ lhs_value << rhs_value.get_ui() };
+						  [](const int64_t &lhs_value, const int64_t &rhs_value) -> Number {
+							  ASSERT(rhs_value >= 0);
+							  if (rhs_value < 63) {
+								  const int64_t result = lhs_value << rhs_value;
+								  if ((result >> rhs_value) == lhs_value) { return Number{ result }; }
+							  }
+							  return Number{ to_big_int(lhs_value)
+											 << static_cast<unsigned long>(rhs_value) };
 						  },
-						  [](const mpz_class &, const double &) -> Number {
+						  [](const double &, const double &) -> Number {
 							  // should raise error
 							  TODO();
 						  },
-						  [](const double &, const mpz_class &) -> Number {
+						  [](const double &, const auto &) -> Number {
 							  // should raise error
 							  TODO();
 						  },
-						  [](const double &, const double &) -> Number {
+						  [](const auto &, const double &) -> Number {
 							  // should raise error
 							  TODO();
 						  },
+						  [](const auto &lhs_value, const auto &rhs_value) -> Number {
+							  const auto &shift = to_big_int(rhs_value);
+							  ASSERT(shift.fits_ulong_p());
+							  return Number{ to_big_int(lhs_value) << shift.get_ui() };
+						  },
 					  },
 		value,
 		rhs.value);
@@ -204,22 +285,30 @@ Number Number::operator<<(const Number &rhs) const
 Number Number::operator>>(const Number &rhs) const
 {
 	return std::visit(overloaded{
-						  [](const BigIntType &lhs_value, const BigIntType &rhs_value) -> Number {
-							  ASSERT(rhs_value.fits_ulong_p());
-							  return Number{ lhs_value >> rhs_value.get_ui() };
+						  [](const int64_t &lhs_value, const int64_t &rhs_value) -> Number {
+							  ASSERT(rhs_value >= 0);
+							  if (rhs_value > 63) {
+								  return Number{ lhs_value < 0 ? int64_t{ -1 } : int64_t{ 0 } };
+							  }
+							  return Number{ lhs_value >> rhs_value };
 						  },
-						  [](const BigIntType &, const double &) -> Number {
+						  [](const double &, const double &) -> Number {
 							  // should raise error
 							  TODO();
 						  },
-						  [](const double &, const BigIntType &) -> Number {
+						  [](const double &, const auto &) -> Number {
 							  // should raise error
 							  TODO();
 						  },
-						  [](const double &, const double &) -> Number {
+						  [](const auto &, const double &) -> Number {
 							  // should raise error
 							  TODO();
 						  },
+						  [](const auto &lhs_value, const auto &rhs_value) -> Number {
+							  const auto &shift = to_big_int(rhs_value);
+							  ASSERT(shift.fits_ulong_p());
+							  return Number{ to_big_int(lhs_value) >> shift.get_ui() };
+						  },
 					  },
 		value,
 		rhs.value);
@@ -260,18 +349,34 @@ Number Number::floordiv(const Number &other) const
 {
 	return std::visit(
 		overloaded{
-			[](const double &lhs, const BigIntType &rhs) -> Number {
-				return Number{ BigIntType{ BigIntType{ lhs } / rhs }.get_d() };
-			},
-			[](const BigIntType &lhs, const double &rhs) -> Number {
-				return Number{ BigIntType{ lhs / BigIntType{ rhs } }.get_d() };
-			},
-			[](const BigIntType &lhs, const BigIntType &rhs) -> Number {
-				return Number{ BigIntType{ lhs / rhs } };
+			[](const int64_t &lhs, const int64_t &rhs) -> Number {
+				// INT64_MIN // -1 is the only quotient that does not fit in an int64_t
+				if (rhs == -1) {
+					int64_t result;
+					if (__builtin_sub_overflow(int64_t{ 0 }, lhs, &result)) [[unlikely]] {
+						return Number{ -to_big_int(lhs) };
+					}
+					return Number{ result };
+				}
+				int64_t result = lhs / rhs;
+				if ((lhs % rhs != 0) && ((lhs < 0) != (rhs < 0))) { --result; }
+				return Number{ result };
 			},
 			[](const double &lhs, const double &rhs) -> Number {
 				return Number{ BigIntType{ BigIntType{ lhs } / BigIntType{ rhs } }.get_d() };
 			},
+			[](const double &lhs, const auto &rhs) -> Number {
+				return Number{ BigIntType{ BigIntType{ lhs } / to_big_int(rhs) }.get_d() };
+			},
+			[](const auto &lhs, const double &rhs) -> Number {
+				return Number{ BigIntType{ to_big_int(lhs) / BigIntType{ rhs } }.get_d() };
+			},
+			[](const auto &lhs, const auto &rhs) -> Number {
+				BigIntType result{};
+				mpz_fdiv_q(
+					result.get_mpz_t(), to_big_int(lhs).get_mpz_t(), to_big_int(rhs).get_mpz_t());
+				return Number{ std::move(result) };
+			},
 		},
 		value,
 		other.value);
@@ -398,7 +503,7 @@ bool Bytes::operator==(const PyObject *other) const
 
 constexpr unsigned char to_digit_value(char value)
 {
-	if (value >= 0 && value <= 9) { return value; }
+	if (value >= '0' && value <= '9') { return value - '0'; }
 	if (value >= 'a' && value <= 'z') { return (value - 'a') + 10; }
 	if (value >= 'A' && value <= 'Z') { return (value - 'A') + 10; }
 	return 37;
@@ -883,15 +988,15 @@ PyResult<Value> and_(const Value &lhs, const Value &rhs, Interpreter &)
 	return std::visit(
 		overloaded{
 			[](const Number &lhs_value, const Number &rhs_value) -> PyResult<Value> {
-				if (std::holds_alternative<BigIntType>(lhs_value.value)
-					&& std::holds_alternative<BigIntType>(rhs_value.value)) {
-					return Ok(Number{ std::get<BigIntType>(lhs_value.value)
-									  & std::get<BigIntType>(rhs_value.value) });
+				if (std::holds_alternative<int64_t>(lhs_value.value)
+					&& std::holds_alternative<int64_t>(rhs_value.value)) {
+					return Ok(Number{ std::get<int64_t>(lhs_value.value)
+									  & std::get<int64_t>(rhs_value.value) });
+				} else if (lhs_value.is_integer() && rhs_value.is_integer()) {
+					return Ok(Number{ lhs_value.as_big_int() & rhs_value.as_big_int() });
 				} else {
-					const std::string lhs_type =
-						std::holds_alternative<BigIntType>(lhs_value.value) ? "int" : "float";
-					const std::string rhs_type =
-						std::holds_alternative<BigIntType>(rhs_value.value) ? "int" : "float";
+					const std::string lhs_type = lhs_value.is_integer() ? "int" : "float";
+					const std::string rhs_type = rhs_value.is_integer() ? "int" : "float";
 					return Err(type_error(
 						"unsupported operand type(s) for &: '{}' and '{}'", lhs_type, rhs_type));
 				}
@@ -912,15 +1017,15 @@ PyResult<Value> or_(const Value &lhs, const Value &rhs, Interpreter &)
 	return std::visit(
 		overloaded{
 			[](const Number &lhs_value, const Number &rhs_value) -> PyResult<Value> {
-				if (std::holds_alternative<BigIntType>(lhs_value.value)
-					&& std::holds_alternative<BigIntType>(rhs_value.value)) {
-					return Ok(Number{ std::get<BigIntType>(lhs_value.value)
-									  | std::get<BigIntType>(rhs_value.value) });
+				if (std::holds_alternative<int64_t>(lhs_value.value)
+					&& std::holds_alternative<int64_t>(rhs_value.value)) {
+					return Ok(Number{ std::get<int64_t>(lhs_value.value)
+									  | std::get<int64_t>(rhs_value.value) });
+				} else if (lhs_value.is_integer() && rhs_value.is_integer()) {
+					return Ok(Number{ lhs_value.as_big_int() | rhs_value.as_big_int() });
 				} else {
-					const std::string lhs_type =
-						std::holds_alternative<BigIntType>(lhs_value.value) ? "int" : "float";
-					const std::string rhs_type =
-						std::holds_alternative<BigIntType>(rhs_value.value) ? "int" : "float";
+					const std::string lhs_type = lhs_value.is_integer() ? "int" : "float";
+					const std::string rhs_type = rhs_value.is_integer() ? "int" : "float";
 					return Err(type_error(
 						"unsupported operand type(s) for &: '{}' and '{}'", lhs_type, rhs_type));
 				}
@@ -984,6 +1089,15 @@ bool operator==(const Value &lhs_value, const Value &rhs_value)
 {
 	const auto result =
 		std::visit(overloaded{ [](PyObject *const lhs, PyObject *const rhs) {
+								  if (lhs == rhs) { return true; }
+								  // e.g. dict lookups of attribute names
+								  if (auto *lhs_str = as<PyString>(lhs)) {
+									  if (auto *rhs_str = as<PyString>(rhs);
+										  rhs_str && lhs_str->is_interned()
+										  && rhs_str->is_interned()) {
+										  return false;
+									  }
+								  }
 								  auto r = lhs->richcompare(rhs, RichCompare::Py_EQ);
 								  ASSERT(r.is_ok())
 								  return r.unwrap() == py_true();
@@ -9,7 +9,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <concepts>
 #include <cstddef>
+#include <limits>
 #include <sstream>
 #include <variant>
 #include <vector>
@@ -31,7 +33,38 @@ using BigIntType = mpz_class;
 struct Number
 {
 	// Should we use `mpf_class` instead of `double`?
-	std::variant<double, BigIntType> value;
+	// Integers are stored inline as a machine word whenever they fit, and only promoted to a
+	// BigIntType when an operation overflows. BigIntType values that fit in an int64_t are always
+	// demoted, so each integer value has exactly one representation.
+	std::variant<double, int64_t, BigIntType> value;
+
+	Number() = default;
+	explicit Number(double v) : value(v) {}
+	template<std::integral T> explicit Number(T v)
+	{
+		if constexpr (std::is_unsigned_v<T> && sizeof(T) >= sizeof(int64_t)) {
+			if (v > static_cast<T>(std::numeric_limits<int64_t>::max())) {
+				value = BigIntType{ static_cast<unsigned long>(v) };
+				return;
+			}
+		}
+		value = static_cast<int64_t>(v);
+	}
+	explicit Number(BigIntType v)
+	{
+		if (v.fits_slong_p()) {
+			value = static_cast<int64_t>(v.get_si());
+		} else {
+			value = std::move(v);
+		}
+	}
+	template<typename T, typename U>
+	explicit Number(const __gmp_expr<T, U> &expr) : Number(BigIntType{ expr })
+	{}
+
+	bool is_integer() const { return !std::holds_alternative<double>(value); }
+	BigIntType as_big_int() const;
+
 	friend std::ostream &operator<<(std::ostream &os, const Number &number)
 	{
 		os << number.to_string();
@@ -22,7 +22,11 @@ template<> const ValueError *as(const PyObject *obj)
 
 ValueError::ValueError(PyType *type) : Exception(type) {}
 
-ValueError::ValueError(PyTuple *args) : Exception(types::BuiltinTypes::the().value_error(), args) {}
+ValueError::ValueError(TypePrototype &type, PyTuple *args) : Exception(type, args) {}
+
+ValueError::ValueError(PyTuple *args)
+	: ValueError(types::BuiltinTypes::the().value_error(), args)
+{}
 
 PyResult<ValueError *> ValueError::create(PyTuple *args)
 {
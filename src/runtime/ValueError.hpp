@@ -13,9 +13,12 @@ class ValueError : public Exception
 	template<typename... Args>
 	friend BaseException *value_error(const std::string &message, Args &&...args);
 
-  private:
+  protected:
 	ValueError(PyType *type);
 
+	ValueError(TypePrototype &type, PyTuple *args);
+
+  private:
 	ValueError(PyTuple *args);
 
   public:
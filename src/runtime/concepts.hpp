@@ -221,6 +221,12 @@ namespace concepts {
 		obj->__next__();
 	};
 
+	template<typename T>
+	concept HasIterNext = requires(T *obj)
+	{
+		obj->iternext();
+	};
+
 	namespace detail {
 		template<typename T> constexpr bool has_add()
 		{
@@ -19,571 +19,558 @@ std::vector<uint8_t> _bootstrap
     117, 108, 101, 95, 108, 111, 99, 107, 115, 30, 
     2, 1, 2, 0, 0, 47, 0, 12, 0, 0, 
     0, 0, 0, 0, 0, 95, 98, 108, 111, 99, 
-    107, 105, 110, 103, 95, 111, 110, 35, 2, 12, 
-    0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 
-    116, 105, 109, 101, 69, 114, 114, 111, 114, 30, 
-    1, 4, 36, 3, 1, 0, 0, 0, 0, 28, 
-    4, 74, 3, 74, 1, 74, 2, 10, 4, 3, 
-    0, 75, 1, 0, 75, 1, 0, 75, 1, 0, 
-    47, 0, 14, 0, 0, 0, 0, 0, 0, 0, 
-    95, 68, 101, 97, 100, 108, 111, 99, 107, 69, 
-    114, 114, 111, 114, 30, 1, 5, 36, 2, 1, 
+    107, 105, 110, 103, 95, 111, 110, 35, 2, 0, 
+    30, 1, 4, 36, 3, 1, 0, 0, 0, 0, 
+    28, 4, 74, 3, 74, 1, 74, 2, 10, 4, 
+    3, 0, 75, 1, 0, 75, 1, 0, 75, 1, 
+    0, 47, 0, 14, 0, 0, 0, 0, 0, 0, 
+    0, 95, 68, 101, 97, 100, 108, 111, 99, 107, 
+    69, 114, 114, 111, 114, 30, 1, 5, 36, 2, 
+    1, 0, 0, 0, 0, 28, 3, 74, 2, 74, 
+    1, 10, 3, 2, 0, 75, 1, 0, 75, 1, 
+    0, 47, 0, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 77, 111, 100, 117, 108, 101, 76, 111, 
+    99, 107, 30, 1, 6, 36, 2, 1, 0, 0, 
+    0, 0, 28, 3, 74, 2, 74, 1, 10, 3, 
+    2, 0, 75, 1, 0, 75, 1, 219, 47, 0, 
+    16, 0, 0, 0, 0, 0, 0, 0, 95, 68, 
+    117, 109, 109, 121, 77, 111, 100, 117, 108, 101, 
+    76, 111, 99, 107, 30, 1, 7, 36, 2, 1, 
     0, 0, 0, 0, 28, 3, 74, 2, 74, 1, 
-    10, 3, 2, 0, 75, 1, 0, 75, 1, 0, 
-    47, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
+    10, 3, 2, 0, 75, 1, 240, 75, 1, 96, 
+    47, 0, 18, 0, 0, 0, 0, 0, 0, 0, 
     95, 77, 111, 100, 117, 108, 101, 76, 111, 99, 
-    107, 30, 1, 6, 36, 2, 1, 0, 0, 0, 
-    0, 28, 3, 74, 2, 74, 1, 10, 3, 2, 
-    0, 75, 1, 0, 75, 1, 219, 47, 0, 16, 
-    0, 0, 0, 0, 0, 0, 0, 95, 68, 117, 
-    109, 109, 121, 77, 111, 100, 117, 108, 101, 76, 
-    111, 99, 107, 30, 1, 7, 36, 2, 1, 0, 
-    0, 0, 0, 28, 3, 74, 2, 74, 1, 10, 
-    3, 2, 0, 75, 1, 240, 75, 1, 96, 47, 
-    0, 18, 0, 0, 0, 0, 0, 0, 0, 95, 
-    77, 111, 100, 117, 108, 101, 76, 111, 99, 107, 
-    77, 97, 110, 97, 103, 101, 114, 30, 1, 8, 
-    36, 0, 1, 0, 0, 0, 0, 47, 0, 16, 
-    0, 0, 0, 0, 0, 0, 0, 95, 103, 101, 
-    116, 95, 109, 111, 100, 117, 108, 101, 95, 108, 
-    111, 99, 107, 30, 1, 9, 36, 0, 1, 0, 
-    0, 0, 0, 47, 0, 19, 0, 0, 0, 0, 
-    0, 0, 0, 95, 108, 111, 99, 107, 95, 117, 
-    110, 108, 111, 99, 107, 95, 109, 111, 100, 117, 
-    108, 101, 30, 1, 10, 36, 0, 1, 0, 0, 
-    0, 0, 47, 0, 25, 0, 0, 0, 0, 0, 
-    0, 0, 95, 99, 97, 108, 108, 95, 119, 105, 
-    116, 104, 95, 102, 114, 97, 109, 101, 115, 95, 
-    114, 101, 109, 111, 118, 101, 100, 30, 1, 11, 
-    30, 0, 12, 74, 1, 36, 2, 0, 0, 1, 
-    0, 0, 75, 1, 189, 47, 2, 16, 0, 0, 
-    0, 0, 0, 0, 0, 95, 118, 101, 114, 98, 
-    111, 115, 101, 95, 109, 101, 115, 115, 97, 103, 
-    101, 30, 0, 13, 36, 1, 0, 0, 0, 0, 
-    0, 47, 1, 17, 0, 0, 0, 0, 0, 0, 
-    0, 95, 114, 101, 113, 117, 105, 114, 101, 115, 
-    95, 98, 117, 105, 108, 116, 105, 110, 30, 0, 
-    14, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
-    16, 0, 0, 0, 0, 0, 0, 0, 95, 114, 
-    101, 113, 117, 105, 114, 101, 115, 95, 102, 114, 
-    111, 122, 101, 110, 30, 0, 15, 36, 1, 0, 
-    0, 0, 0, 0, 47, 1, 17, 0, 0, 0, 
+    107, 77, 97, 110, 97, 103, 101, 114, 30, 1, 
+    8, 36, 0, 1, 0, 0, 0, 0, 47, 0, 
+    16, 0, 0, 0, 0, 0, 0, 0, 95, 103, 
+    101, 116, 95, 109, 111, 100, 117, 108, 101, 95, 
+    108, 111, 99, 107, 30, 1, 9, 36, 0, 1, 
+    0, 0, 0, 0, 47, 0, 19, 0, 0, 0, 
+    0, 0, 0, 0, 95, 108, 111, 99, 107, 95, 
+    117, 110, 108, 111, 99, 107, 95, 109, 111, 100, 
+    117, 108, 101, 30, 1, 10, 36, 0, 1, 0, 
+    0, 0, 0, 47, 0, 25, 0, 0, 0, 0, 
+    0, 0, 0, 95, 99, 97, 108, 108, 95, 119, 
+    105, 116, 104, 95, 102, 114, 97, 109, 101, 115, 
+    95, 114, 101, 109, 111, 118, 101, 100, 30, 1, 
+    11, 30, 0, 12, 74, 1, 36, 2, 0, 0, 
+    1, 0, 0, 75, 1, 189, 47, 2, 16, 0, 
+    0, 0, 0, 0, 0, 0, 95, 118, 101, 114, 
+    98, 111, 115, 101, 95, 109, 101, 115, 115, 97, 
+    103, 101, 30, 0, 13, 36, 1, 0, 0, 0, 
+    0, 0, 47, 1, 17, 0, 0, 0, 0, 0, 
+    0, 0, 95, 114, 101, 113, 117, 105, 114, 101, 
+    115, 95, 98, 117, 105, 108, 116, 105, 110, 30, 
+    0, 14, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 16, 0, 0, 0, 0, 0, 0, 0, 95, 
+    114, 101, 113, 117, 105, 114, 101, 115, 95, 102, 
+    114, 111, 122, 101, 110, 30, 0, 15, 36, 1, 
+    0, 0, 0, 0, 0, 47, 1, 17, 0, 0, 
+    0, 0, 0, 0, 0, 95, 108, 111, 97, 100, 
+    95, 109, 111, 100, 117, 108, 101, 95, 115, 104, 
+    105, 109, 30, 0, 16, 36, 1, 0, 0, 0, 
+    0, 0, 47, 1, 12, 0, 0, 0, 0, 0, 
+    0, 0, 95, 109, 111, 100, 117, 108, 101, 95, 
+    114, 101, 112, 114, 30, 3, 17, 36, 1, 3, 
+    0, 0, 0, 0, 28, 2, 74, 1, 74, 3, 
+    10, 2, 2, 0, 75, 1, 218, 75, 1, 0, 
+    47, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
+    77, 111, 100, 117, 108, 101, 83, 112, 101, 99, 
+    30, 1, 1, 30, 0, 1, 30, 2, 18, 74, 
+    1, 74, 0, 36, 3, 2, 0, 2, 0, 0, 
+    75, 1, 188, 75, 1, 26, 47, 3, 16, 0, 
+    0, 0, 0, 0, 0, 0, 115, 112, 101, 99, 
+    95, 102, 114, 111, 109, 95, 108, 111, 97, 100, 
+    101, 114, 30, 0, 1, 30, 1, 1, 30, 2, 
+    19, 74, 0, 74, 1, 36, 3, 2, 2, 0, 
+    0, 0, 75, 1, 188, 75, 1, 213, 47, 3, 
+    17, 0, 0, 0, 0, 0, 0, 0, 95, 115, 
+    112, 101, 99, 95, 102, 114, 111, 109, 95, 109, 
+    111, 100, 117, 108, 101, 30, 0, 20, 30, 1, 
+    21, 74, 0, 36, 2, 1, 0, 1, 0, 0, 
+    75, 1, 188, 47, 2, 18, 0, 0, 0, 0, 
+    0, 0, 0, 95, 105, 110, 105, 116, 95, 109, 
+    111, 100, 117, 108, 101, 95, 97, 116, 116, 114, 
+    115, 30, 0, 22, 36, 1, 0, 0, 0, 0, 
+    0, 47, 1, 16, 0, 0, 0, 0, 0, 0, 
+    0, 109, 111, 100, 117, 108, 101, 95, 102, 114, 
+    111, 109, 95, 115, 112, 101, 99, 30, 0, 23, 
+    36, 1, 0, 0, 0, 0, 0, 47, 1, 22, 
+    0, 0, 0, 0, 0, 0, 0, 95, 109, 111, 
+    100, 117, 108, 101, 95, 114, 101, 112, 114, 95, 
+    102, 114, 111, 109, 95, 115, 112, 101, 99, 30, 
+    0, 24, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 5, 0, 0, 0, 0, 0, 0, 0, 95, 
+    101, 120, 101, 99, 30, 0, 25, 36, 1, 0, 
+    0, 0, 0, 0, 47, 1, 25, 0, 0, 0, 
     0, 0, 0, 0, 95, 108, 111, 97, 100, 95, 
-    109, 111, 100, 117, 108, 101, 95, 115, 104, 105, 
-    109, 30, 0, 16, 36, 1, 0, 0, 0, 0, 
-    0, 47, 1, 12, 0, 0, 0, 0, 0, 0, 
-    0, 95, 109, 111, 100, 117, 108, 101, 95, 114, 
-    101, 112, 114, 30, 3, 17, 36, 1, 3, 0, 
-    0, 0, 0, 28, 2, 74, 1, 74, 3, 10, 
-    2, 2, 0, 75, 1, 218, 75, 1, 0, 47, 
-    0, 10, 0, 0, 0, 0, 0, 0, 0, 77, 
-    111, 100, 117, 108, 101, 83, 112, 101, 99, 30, 
-    1, 1, 30, 0, 1, 30, 2, 18, 74, 1, 
-    74, 0, 36, 3, 2, 0, 2, 0, 0, 75, 
-    1, 188, 75, 1, 26, 47, 3, 16, 0, 0, 
-    0, 0, 0, 0, 0, 115, 112, 101, 99, 95, 
-    102, 114, 111, 109, 95, 108, 111, 97, 100, 101, 
-    114, 30, 0, 1, 30, 1, 1, 30, 2, 19, 
-    74, 0, 74, 1, 36, 3, 2, 2, 0, 0, 
-    0, 75, 1, 188, 75, 1, 213, 47, 3, 17, 
-    0, 0, 0, 0, 0, 0, 0, 95, 115, 112, 
-    101, 99, 95, 102, 114, 111, 109, 95, 109, 111, 
-    100, 117, 108, 101, 30, 0, 20, 30, 1, 21, 
-    74, 0, 36, 2, 1, 0, 1, 0, 0, 75, 
-    1, 188, 47, 2, 18, 0, 0, 0, 0, 0, 
-    0, 0, 95, 105, 110, 105, 116, 95, 109, 111, 
-    100, 117, 108, 101, 95, 97, 116, 116, 114, 115, 
-    30, 0, 22, 36, 1, 0, 0, 0, 0, 0, 
-    47, 1, 16, 0, 0, 0, 0, 0, 0, 0, 
-    109, 111, 100, 117, 108, 101, 95, 102, 114, 111, 
-    109, 95, 115, 112, 101, 99, 30, 0, 23, 36, 
-    1, 0, 0, 0, 0, 0, 47, 1, 22, 0, 
-    0, 0, 0, 0, 0, 0, 95, 109, 111, 100, 
-    117, 108, 101, 95, 114, 101, 112, 114, 95, 102, 
-    114, 111, 109, 95, 115, 112, 101, 99, 30, 0, 
-    24, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
-    5, 0, 0, 0, 0, 0, 0, 0, 95, 101, 
-    120, 101, 99, 30, 0, 25, 36, 1, 0, 0, 
-    0, 0, 0, 47, 1, 25, 0, 0, 0, 0, 
-    0, 0, 0, 95, 108, 111, 97, 100, 95, 98, 
-    97, 99, 107, 119, 97, 114, 100, 95, 99, 111, 
-    109, 112, 97, 116, 105, 98, 108, 101, 30, 0, 
-    26, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
-    14, 0, 0, 0, 0, 0, 0, 0, 95, 108, 
-    111, 97, 100, 95, 117, 110, 108, 111, 99, 107, 
-    101, 100, 30, 0, 27, 36, 1, 0, 0, 0, 
-    0, 0, 47, 1, 5, 0, 0, 0, 0, 0, 
-    0, 0, 95, 108, 111, 97, 100, 30, 3, 28, 
-    36, 1, 3, 0, 0, 0, 0, 28, 2, 74, 
-    1, 74, 3, 10, 2, 2, 0, 75, 1, 188, 
-    75, 1, 244, 47, 0, 15, 0, 0, 0, 0, 
-    0, 0, 0, 66, 117, 105, 108, 116, 105, 110, 
-    73, 109, 112, 111, 114, 116, 101, 114, 30, 1, 
-    29, 36, 2, 1, 0, 0, 0, 0, 28, 3, 
-    74, 2, 74, 1, 10, 3, 2, 0, 75, 1, 
-    188, 75, 1, 170, 47, 0, 14, 0, 0, 0, 
-    0, 0, 0, 0, 70, 114, 111, 122, 101, 110, 
-    73, 109, 112, 111, 114, 116, 101, 114, 30, 1, 
-    30, 36, 2, 1, 0, 0, 0, 0, 28, 3, 
-    74, 2, 74, 1, 10, 3, 2, 0, 75, 1, 
-    188, 75, 1, 50, 47, 0, 18, 0, 0, 0, 
-    0, 0, 0, 0, 95, 73, 109, 112, 111, 114, 
-    116, 76, 111, 99, 107, 67, 111, 110, 116, 101, 
-    120, 116, 30, 1, 31, 36, 0, 1, 0, 0, 
-    0, 0, 47, 0, 13, 0, 0, 0, 0, 0, 
-    0, 0, 95, 114, 101, 115, 111, 108, 118, 101, 
-    95, 110, 97, 109, 101, 30, 1, 32, 36, 0, 
-    1, 0, 0, 0, 0, 47, 0, 17, 0, 0, 
+    98, 97, 99, 107, 119, 97, 114, 100, 95, 99, 
+    111, 109, 112, 97, 116, 105, 98, 108, 101, 30, 
+    0, 26, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 14, 0, 0, 0, 0, 0, 0, 0, 95, 
+    108, 111, 97, 100, 95, 117, 110, 108, 111, 99, 
+    107, 101, 100, 30, 0, 27, 36, 1, 0, 0, 
+    0, 0, 0, 47, 1, 5, 0, 0, 0, 0, 
+    0, 0, 0, 95, 108, 111, 97, 100, 30, 3, 
+    28, 36, 1, 3, 0, 0, 0, 0, 28, 2, 
+    74, 1, 74, 3, 10, 2, 2, 0, 75, 1, 
+    188, 75, 1, 244, 47, 0, 15, 0, 0, 0, 
+    0, 0, 0, 0, 66, 117, 105, 108, 116, 105, 
+    110, 73, 109, 112, 111, 114, 116, 101, 114, 30, 
+    1, 29, 36, 2, 1, 0, 0, 0, 0, 28, 
+    3, 74, 2, 74, 1, 10, 3, 2, 0, 75, 
+    1, 188, 75, 1, 170, 47, 0, 14, 0, 0, 
+    0, 0, 0, 0, 0, 70, 114, 111, 122, 101, 
+    110, 73, 109, 112, 111, 114, 116, 101, 114, 30, 
+    1, 30, 36, 2, 1, 0, 0, 0, 0, 28, 
+    3, 74, 2, 74, 1, 10, 3, 2, 0, 75, 
+    1, 188, 75, 1, 50, 47, 0, 18, 0, 0, 
+    0, 0, 0, 0, 0, 95, 73, 109, 112, 111, 
+    114, 116, 76, 111, 99, 107, 67, 111, 110, 116, 
+    101, 120, 116, 30, 1, 31, 36, 0, 1, 0, 
+    0, 0, 0, 47, 0, 13, 0, 0, 0, 0, 
+    0, 0, 0, 95, 114, 101, 115, 111, 108, 118, 
+    101, 95, 110, 97, 109, 101, 30, 1, 32, 36, 
+    0, 1, 0, 0, 0, 0, 47, 0, 17, 0, 
+    0, 0, 0, 0, 0, 0, 95, 102, 105, 110, 
+    100, 95, 115, 112, 101, 99, 95, 108, 101, 103, 
+    97, 99, 121, 30, 1, 1, 30, 0, 33, 74, 
+    1, 36, 2, 0, 1, 0, 0, 0, 75, 1, 
+    164, 47, 2, 10, 0, 0, 0, 0, 0, 0, 
+    0, 95, 102, 105, 110, 100, 95, 115, 112, 101, 
+    99, 30, 0, 34, 36, 1, 0, 0, 0, 0, 
+    0, 47, 1, 13, 0, 0, 0, 0, 0, 0, 
+    0, 95, 115, 97, 110, 105, 116, 121, 95, 99, 
+    104, 101, 99, 107, 30, 0, 35, 47, 0, 15, 
+    0, 0, 0, 0, 0, 0, 0, 95, 69, 82, 
+    82, 95, 77, 83, 71, 95, 80, 82, 69, 70, 
+    73, 88, 35, 2, 1, 30, 0, 36, 0, 1, 
+    2, 0, 0, 47, 1, 8, 0, 0, 0, 0, 
+    0, 0, 0, 95, 69, 82, 82, 95, 77, 83, 
+    71, 30, 0, 37, 36, 1, 0, 0, 0, 0, 
+    0, 47, 1, 23, 0, 0, 0, 0, 0, 0, 
+    0, 95, 102, 105, 110, 100, 95, 97, 110, 100, 
+    95, 108, 111, 97, 100, 95, 117, 110, 108, 111, 
+    99, 107, 101, 100, 35, 3, 2, 10, 3, 0, 
+    0, 47, 0, 14, 0, 0, 0, 0, 0, 0, 
+    0, 95, 78, 69, 69, 68, 83, 95, 76, 79, 
+    65, 68, 73, 78, 71, 30, 2, 38, 36, 0, 
+    2, 0, 0, 0, 0, 47, 0, 14, 0, 0, 
     0, 0, 0, 0, 0, 95, 102, 105, 110, 100, 
-    95, 115, 112, 101, 99, 95, 108, 101, 103, 97, 
-    99, 121, 30, 1, 1, 30, 0, 33, 74, 1, 
-    36, 2, 0, 1, 0, 0, 0, 75, 1, 164, 
-    47, 2, 10, 0, 0, 0, 0, 0, 0, 0, 
-    95, 102, 105, 110, 100, 95, 115, 112, 101, 99, 
-    30, 0, 34, 36, 1, 0, 0, 0, 0, 0, 
-    47, 1, 13, 0, 0, 0, 0, 0, 0, 0, 
-    95, 115, 97, 110, 105, 116, 121, 95, 99, 104, 
-    101, 99, 107, 30, 0, 35, 47, 0, 15, 0, 
-    0, 0, 0, 0, 0, 0, 95, 69, 82, 82, 
-    95, 77, 83, 71, 95, 80, 82, 69, 70, 73, 
-    88, 35, 2, 15, 0, 0, 0, 0, 0, 0, 
-    0, 95, 69, 82, 82, 95, 77, 83, 71, 95, 
-    80, 82, 69, 70, 73, 88, 30, 0, 36, 0, 
-    1, 2, 0, 0, 47, 1, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 69, 82, 82, 95, 77, 
-    83, 71, 30, 0, 37, 36, 1, 0, 0, 0, 
-    0, 0, 47, 1, 23, 0, 0, 0, 0, 0, 
-    0, 0, 95, 102, 105, 110, 100, 95, 97, 110, 
-    100, 95, 108, 111, 97, 100, 95, 117, 110, 108, 
-    111, 99, 107, 101, 100, 35, 3, 6, 0, 0, 
-    0, 0, 0, 0, 0, 111, 98, 106, 101, 99, 
-    116, 10, 3, 0, 0, 47, 0, 14, 0, 0, 
-    0, 0, 0, 0, 0, 95, 78, 69, 69, 68, 
-    83, 95, 76, 79, 65, 68, 73, 78, 71, 30, 
-    2, 38, 36, 0, 2, 0, 0, 0, 0, 47, 
-    0, 14, 0, 0, 0, 0, 0, 0, 0, 95, 
-    102, 105, 110, 100, 95, 97, 110, 100, 95, 108, 
-    111, 97, 100, 30, 2, 1, 30, 0, 39, 30, 
-    1, 40, 74, 2, 74, 0, 36, 3, 1, 2, 
-    0, 0, 0, 75, 1, 187, 75, 1, 0, 47, 
-    3, 11, 0, 0, 0, 0, 0, 0, 0, 95, 
-    103, 99, 100, 95, 105, 109, 112, 111, 114, 116, 
-    30, 0, 20, 30, 1, 41, 74, 0, 36, 2, 
-    1, 0, 1, 0, 0, 75, 1, 188, 47, 2, 
-    16, 0, 0, 0, 0, 0, 0, 0, 95, 104, 
-    97, 110, 100, 108, 101, 95, 102, 114, 111, 109, 
-    108, 105, 115, 116, 30, 0, 42, 36, 1, 0, 
-    0, 0, 0, 0, 47, 1, 17, 0, 0, 0, 
-    0, 0, 0, 0, 95, 99, 97, 108, 99, 95, 
-    95, 95, 112, 97, 99, 107, 97, 103, 101, 95, 
-    95, 30, 0, 1, 30, 1, 1, 4, 2, 0, 
-    30, 3, 39, 30, 4, 43, 74, 0, 74, 1, 
-    74, 2, 74, 3, 36, 5, 4, 4, 0, 0, 
-    0, 75, 1, 201, 75, 1, 189, 75, 1, 218, 
-    75, 1, 189, 47, 5, 10, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 105, 109, 112, 111, 114, 
-    116, 95, 95, 30, 0, 44, 36, 1, 0, 0, 
-    0, 0, 0, 47, 1, 18, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 117, 105, 108, 116, 105, 
-    110, 95, 102, 114, 111, 109, 95, 110, 97, 109, 
-    101, 30, 0, 45, 36, 1, 0, 0, 0, 0, 
-    0, 47, 1, 6, 0, 0, 0, 0, 0, 0, 
-    0, 95, 115, 101, 116, 117, 112, 30, 0, 46, 
-    36, 1, 0, 0, 0, 0, 0, 47, 1, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 105, 110, 
-    115, 116, 97, 108, 108, 30, 0, 47, 36, 1, 
-    0, 0, 0, 0, 0, 47, 1, 27, 0, 0, 
-    0, 0, 0, 0, 0, 95, 105, 110, 115, 116, 
-    97, 108, 108, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 95, 105, 109, 112, 111, 114, 116, 101, 
-    114, 115, 17, 0, 0, 0, 0, 30, 0, 1, 
-    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    95, 97, 110, 100, 95, 108, 111, 97, 100, 30, 
+    2, 1, 30, 0, 39, 30, 1, 40, 74, 2, 
+    74, 0, 36, 3, 1, 2, 0, 0, 0, 75, 
+    1, 187, 75, 1, 0, 47, 3, 11, 0, 0, 
+    0, 0, 0, 0, 0, 95, 103, 99, 100, 95, 
+    105, 109, 112, 111, 114, 116, 30, 0, 20, 30, 
+    1, 41, 74, 0, 36, 2, 1, 0, 1, 0, 
+    0, 75, 1, 188, 47, 2, 16, 0, 0, 0, 
+    0, 0, 0, 0, 95, 104, 97, 110, 100, 108, 
+    101, 95, 102, 114, 111, 109, 108, 105, 115, 116, 
+    30, 0, 42, 36, 1, 0, 0, 0, 0, 0, 
+    47, 1, 17, 0, 0, 0, 0, 0, 0, 0, 
+    95, 99, 97, 108, 99, 95, 95, 95, 112, 97, 
+    99, 107, 97, 103, 101, 95, 95, 30, 0, 1, 
+    30, 1, 1, 4, 2, 0, 30, 3, 39, 30, 
+    4, 43, 74, 0, 74, 1, 74, 2, 74, 3, 
+    36, 5, 4, 4, 0, 0, 0, 75, 1, 201, 
+    75, 1, 189, 75, 1, 218, 75, 1, 189, 47, 
+    5, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 105, 109, 112, 111, 114, 116, 95, 95, 30, 
+    0, 44, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 18, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 117, 105, 108, 116, 105, 110, 95, 102, 114, 
+    111, 109, 95, 110, 97, 109, 101, 30, 0, 45, 
+    36, 1, 0, 0, 0, 0, 0, 47, 1, 6, 
+    0, 0, 0, 0, 0, 0, 0, 95, 115, 101, 
+    116, 117, 112, 30, 0, 46, 36, 1, 0, 0, 
+    0, 0, 0, 47, 1, 8, 0, 0, 0, 0, 
+    0, 0, 0, 95, 105, 110, 115, 116, 97, 108, 
+    108, 30, 0, 47, 36, 1, 0, 0, 0, 0, 
+    0, 47, 1, 27, 0, 0, 0, 0, 0, 0, 
+    0, 95, 105, 110, 115, 116, 97, 108, 108, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 95, 105, 
+    109, 112, 111, 114, 116, 101, 114, 115, 17, 0, 
+    0, 0, 0, 30, 0, 1, 41, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 
-    0, 0, 0, 0, 2, 83, 1, 0, 0, 0, 
-    0, 0, 0, 67, 111, 114, 101, 32, 105, 109, 
-    112, 108, 101, 109, 101, 110, 116, 97, 116, 105, 
-    111, 110, 32, 111, 102, 32, 105, 109, 112, 111, 
-    114, 116, 46, 10, 10, 84, 104, 105, 115, 32, 
-    109, 111, 100, 117, 108, 101, 32, 105, 115, 32, 
-    78, 79, 84, 32, 109, 101, 97, 110, 116, 32, 
-    116, 111, 32, 98, 101, 32, 100, 105, 114, 101, 
-    99, 116, 108, 121, 32, 105, 109, 112, 111, 114, 
-    116, 101, 100, 33, 32, 73, 116, 32, 104, 97, 
-    115, 32, 98, 101, 101, 110, 32, 100, 101, 115, 
-    105, 103, 110, 101, 100, 32, 115, 117, 99, 104, 
-    10, 116, 104, 97, 116, 32, 105, 116, 32, 99, 
-    97, 110, 32, 98, 101, 32, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 112, 101, 100, 32, 105, 
-    110, 116, 111, 32, 80, 121, 116, 104, 111, 110, 
-    32, 97, 115, 32, 116, 104, 101, 32, 105, 109, 
-    112, 108, 101, 109, 101, 110, 116, 97, 116, 105, 
-    111, 110, 32, 111, 102, 32, 105, 109, 112, 111, 
-    114, 116, 46, 32, 65, 115, 10, 115, 117, 99, 
-    104, 32, 105, 116, 32, 114, 101, 113, 117, 105, 
-    114, 101, 115, 32, 116, 104, 101, 32, 105, 110, 
-    106, 101, 99, 116, 105, 111, 110, 32, 111, 102, 
-    32, 115, 112, 101, 99, 105, 102, 105, 99, 32, 
-    109, 111, 100, 117, 108, 101, 115, 32, 97, 110, 
-    100, 32, 97, 116, 116, 114, 105, 98, 117, 116, 
-    101, 115, 32, 105, 110, 32, 111, 114, 100, 101, 
-    114, 32, 116, 111, 10, 119, 111, 114, 107, 46, 
-    32, 79, 110, 101, 32, 115, 104, 111, 117, 108, 
-    100, 32, 117, 115, 101, 32, 105, 109, 112, 111, 
-    114, 116, 108, 105, 98, 32, 97, 115, 32, 116, 
-    104, 101, 32, 112, 117, 98, 108, 105, 99, 45, 
-    102, 97, 99, 105, 110, 103, 32, 118, 101, 114, 
-    115, 105, 111, 110, 32, 111, 102, 32, 116, 104, 
-    105, 115, 32, 109, 111, 100, 117, 108, 101, 46, 
-    10, 10, 5, 2, 21, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    48, 0, 0, 0, 0, 0, 0, 0, 2, 83, 
+    1, 0, 0, 0, 0, 0, 0, 67, 111, 114, 
+    101, 32, 105, 109, 112, 108, 101, 109, 101, 110, 
+    116, 97, 116, 105, 111, 110, 32, 111, 102, 32, 
+    105, 109, 112, 111, 114, 116, 46, 10, 10, 84, 
+    104, 105, 115, 32, 109, 111, 100, 117, 108, 101, 
+    32, 105, 115, 32, 78, 79, 84, 32, 109, 101, 
+    97, 110, 116, 32, 116, 111, 32, 98, 101, 32, 
+    100, 105, 114, 101, 99, 116, 108, 121, 32, 105, 
+    109, 112, 111, 114, 116, 101, 100, 33, 32, 73, 
+    116, 32, 104, 97, 115, 32, 98, 101, 101, 110, 
+    32, 100, 101, 115, 105, 103, 110, 101, 100, 32, 
+    115, 117, 99, 104, 10, 116, 104, 97, 116, 32, 
+    105, 116, 32, 99, 97, 110, 32, 98, 101, 32, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 112, 
+    101, 100, 32, 105, 110, 116, 111, 32, 80, 121, 
+    116, 104, 111, 110, 32, 97, 115, 32, 116, 104, 
+    101, 32, 105, 109, 112, 108, 101, 109, 101, 110, 
+    116, 97, 116, 105, 111, 110, 32, 111, 102, 32, 
+    105, 109, 112, 111, 114, 116, 46, 32, 65, 115, 
+    10, 115, 117, 99, 104, 32, 105, 116, 32, 114, 
+    101, 113, 117, 105, 114, 101, 115, 32, 116, 104, 
+    101, 32, 105, 110, 106, 101, 99, 116, 105, 111, 
+    110, 32, 111, 102, 32, 115, 112, 101, 99, 105, 
+    102, 105, 99, 32, 109, 111, 100, 117, 108, 101, 
+    115, 32, 97, 110, 100, 32, 97, 116, 116, 114, 
+    105, 98, 117, 116, 101, 115, 32, 105, 110, 32, 
+    111, 114, 100, 101, 114, 32, 116, 111, 10, 119, 
+    111, 114, 107, 46, 32, 79, 110, 101, 32, 115, 
+    104, 111, 117, 108, 100, 32, 117, 115, 101, 32, 
+    105, 109, 112, 111, 114, 116, 108, 105, 98, 32, 
+    97, 115, 32, 116, 104, 101, 32, 112, 117, 98, 
+    108, 105, 99, 45, 102, 97, 99, 105, 110, 103, 
+    32, 118, 101, 114, 115, 105, 111, 110, 32, 111, 
+    102, 32, 116, 104, 105, 115, 32, 109, 111, 100, 
+    117, 108, 101, 46, 10, 10, 5, 2, 21, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 95, 119, 114, 
+    97, 112, 46, 50, 54, 58, 48, 2, 27, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 95, 110, 101, 
+    119, 95, 109, 111, 100, 117, 108, 101, 46, 51, 
+    52, 58, 48, 2, 41, 0, 0, 0, 0, 0, 
     0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 95, 119, 114, 97, 112, 46, 50, 
-    54, 58, 48, 2, 27, 0, 0, 0, 0, 0, 
+    97, 112, 46, 95, 95, 99, 108, 97, 115, 115, 
+    95, 95, 95, 68, 101, 97, 100, 108, 111, 99, 
+    107, 69, 114, 114, 111, 114, 95, 95, 46, 52, 
+    55, 58, 48, 2, 38, 0, 0, 0, 0, 0, 
     0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 95, 110, 101, 119, 95, 109, 111, 
-    100, 117, 108, 101, 46, 51, 52, 58, 48, 2, 
-    41, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    95, 99, 108, 97, 115, 115, 95, 95, 95, 68, 
-    101, 97, 100, 108, 111, 99, 107, 69, 114, 114, 
-    111, 114, 95, 95, 46, 52, 55, 58, 48, 2, 
-    38, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    95, 99, 108, 97, 115, 115, 95, 95, 95, 77, 
-    111, 100, 117, 108, 101, 76, 111, 99, 107, 95, 
-    95, 46, 53, 49, 58, 48, 2, 44, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 95, 95, 99, 108, 
-    97, 115, 115, 95, 95, 95, 68, 117, 109, 109, 
-    121, 77, 111, 100, 117, 108, 101, 76, 111, 99, 
-    107, 95, 95, 46, 49, 50, 56, 58, 48, 2, 
-    46, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    95, 99, 108, 97, 115, 115, 95, 95, 95, 77, 
-    111, 100, 117, 108, 101, 76, 111, 99, 107, 77, 
-    97, 110, 97, 103, 101, 114, 95, 95, 46, 49, 
-    52, 57, 58, 48, 2, 33, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 103, 101, 116, 95, 109, 
-    111, 100, 117, 108, 101, 95, 108, 111, 99, 107, 
-    46, 49, 54, 53, 58, 48, 2, 36, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 95, 108, 111, 99, 
-    107, 95, 117, 110, 108, 111, 99, 107, 95, 109, 
-    111, 100, 117, 108, 101, 46, 50, 48, 50, 58, 
-    48, 2, 42, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 99, 97, 108, 108, 95, 119, 105, 116, 
-    104, 95, 102, 114, 97, 109, 101, 115, 95, 114, 
-    101, 109, 111, 118, 101, 100, 46, 50, 49, 57, 
-    58, 48, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 2, 33, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 118, 101, 114, 98, 111, 115, 101, 95, 
-    109, 101, 115, 115, 97, 103, 101, 46, 50, 51, 
-    48, 58, 48, 2, 34, 0, 0, 0, 0, 0, 
+    97, 112, 46, 95, 95, 99, 108, 97, 115, 115, 
+    95, 95, 95, 77, 111, 100, 117, 108, 101, 76, 
+    111, 99, 107, 95, 95, 46, 53, 49, 58, 48, 
+    2, 44, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
+    95, 95, 99, 108, 97, 115, 115, 95, 95, 95, 
+    68, 117, 109, 109, 121, 77, 111, 100, 117, 108, 
+    101, 76, 111, 99, 107, 95, 95, 46, 49, 50, 
+    56, 58, 48, 2, 46, 0, 0, 0, 0, 0, 
     0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 95, 114, 101, 113, 117, 105, 114, 
-    101, 115, 95, 98, 117, 105, 108, 116, 105, 110, 
-    46, 50, 51, 56, 58, 48, 2, 33, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 95, 114, 101, 113, 
-    117, 105, 114, 101, 115, 95, 102, 114, 111, 122, 
-    101, 110, 46, 50, 52, 57, 58, 48, 2, 34, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 95, 108, 
-    111, 97, 100, 95, 109, 111, 100, 117, 108, 101, 
-    95, 115, 104, 105, 109, 46, 50, 54, 49, 58, 
-    48, 2, 29, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 109, 111, 100, 117, 108, 101, 95, 114, 
-    101, 112, 114, 46, 50, 55, 55, 58, 48, 2, 
-    38, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    95, 99, 108, 97, 115, 115, 95, 95, 77, 111, 
-    100, 117, 108, 101, 83, 112, 101, 99, 95, 95, 
-    46, 51, 49, 51, 58, 48, 2, 33, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 115, 112, 101, 99, 
-    95, 102, 114, 111, 109, 95, 108, 111, 97, 100, 
-    101, 114, 46, 52, 49, 52, 58, 48, 2, 34, 
+    97, 112, 46, 95, 95, 99, 108, 97, 115, 115, 
+    95, 95, 95, 77, 111, 100, 117, 108, 101, 76, 
+    111, 99, 107, 77, 97, 110, 97, 103, 101, 114, 
+    95, 95, 46, 49, 52, 57, 58, 48, 2, 33, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 95, 115, 
-    112, 101, 99, 95, 102, 114, 111, 109, 95, 109, 
-    111, 100, 117, 108, 101, 46, 52, 52, 48, 58, 
-    48, 6, 0, 2, 35, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 95, 105, 110, 105, 116, 95, 109, 
-    111, 100, 117, 108, 101, 95, 97, 116, 116, 114, 
-    115, 46, 52, 56, 53, 58, 48, 2, 33, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 109, 111, 100, 
-    117, 108, 101, 95, 102, 114, 111, 109, 95, 115, 
-    112, 101, 99, 46, 53, 53, 55, 58, 48, 2, 
-    39, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    109, 111, 100, 117, 108, 101, 95, 114, 101, 112, 
-    114, 95, 102, 114, 111, 109, 95, 115, 112, 101, 
-    99, 46, 53, 55, 52, 58, 48, 2, 22, 0, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 103, 
+    101, 116, 95, 109, 111, 100, 117, 108, 101, 95, 
+    108, 111, 99, 107, 46, 49, 54, 53, 58, 48, 
+    2, 36, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
+    95, 108, 111, 99, 107, 95, 117, 110, 108, 111, 
+    99, 107, 95, 109, 111, 100, 117, 108, 101, 46, 
+    50, 48, 50, 58, 48, 2, 42, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 46, 95, 99, 97, 108, 108, 
+    95, 119, 105, 116, 104, 95, 102, 114, 97, 109, 
+    101, 115, 95, 114, 101, 109, 111, 118, 101, 100, 
+    46, 50, 49, 57, 58, 48, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 2, 33, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 46, 95, 118, 101, 114, 98, 
+    111, 115, 101, 95, 109, 101, 115, 115, 97, 103, 
+    101, 46, 50, 51, 48, 58, 48, 2, 34, 0, 
     0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 95, 101, 120, 
-    101, 99, 46, 53, 57, 49, 58, 48, 2, 42, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 95, 108, 
-    111, 97, 100, 95, 98, 97, 99, 107, 119, 97, 
-    114, 100, 95, 99, 111, 109, 112, 97, 116, 105, 
-    98, 108, 101, 46, 54, 50, 49, 58, 48, 2, 
-    31, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    108, 111, 97, 100, 95, 117, 110, 108, 111, 99, 
-    107, 101, 100, 46, 54, 53, 56, 58, 48, 2, 
-    22, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    108, 111, 97, 100, 46, 55, 48, 48, 58, 48, 
-    2, 43, 0, 0, 0, 0, 0, 0, 0, 95, 
+    116, 115, 116, 114, 97, 112, 46, 95, 114, 101, 
+    113, 117, 105, 114, 101, 115, 95, 98, 117, 105, 
+    108, 116, 105, 110, 46, 50, 51, 56, 58, 48, 
+    2, 33, 0, 0, 0, 0, 0, 0, 0, 95, 
     98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    95, 95, 99, 108, 97, 115, 115, 95, 95, 66, 
-    117, 105, 108, 116, 105, 110, 73, 109, 112, 111, 
-    114, 116, 101, 114, 95, 95, 46, 55, 49, 53, 
-    58, 48, 2, 42, 0, 0, 0, 0, 0, 0, 
+    95, 114, 101, 113, 117, 105, 114, 101, 115, 95, 
+    102, 114, 111, 122, 101, 110, 46, 50, 52, 57, 
+    58, 48, 2, 34, 0, 0, 0, 0, 0, 0, 
     0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 46, 95, 95, 99, 108, 97, 115, 115, 95, 
-    95, 70, 114, 111, 122, 101, 110, 73, 109, 112, 
-    111, 114, 116, 101, 114, 95, 95, 46, 55, 57, 
-    48, 58, 48, 2, 46, 0, 0, 0, 0, 0, 
+    112, 46, 95, 108, 111, 97, 100, 95, 109, 111, 
+    100, 117, 108, 101, 95, 115, 104, 105, 109, 46, 
+    50, 54, 49, 58, 48, 2, 29, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 46, 95, 109, 111, 100, 117, 
+    108, 101, 95, 114, 101, 112, 114, 46, 50, 55, 
+    55, 58, 48, 2, 38, 0, 0, 0, 0, 0, 
     0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
     97, 112, 46, 95, 95, 99, 108, 97, 115, 115, 
-    95, 95, 95, 73, 109, 112, 111, 114, 116, 76, 
-    111, 99, 107, 67, 111, 110, 116, 101, 120, 116, 
-    95, 95, 46, 56, 54, 57, 58, 48, 2, 30, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 95, 114, 
-    101, 115, 111, 108, 118, 101, 95, 110, 97, 109, 
-    101, 46, 56, 56, 50, 58, 48, 2, 34, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 95, 102, 105, 
-    110, 100, 95, 115, 112, 101, 99, 95, 108, 101, 
-    103, 97, 99, 121, 46, 56, 57, 49, 58, 48, 
-    2, 27, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 95, 77, 111, 100, 117, 108, 101, 83, 112, 
+    101, 99, 95, 95, 46, 51, 49, 51, 58, 48, 
+    2, 33, 0, 0, 0, 0, 0, 0, 0, 95, 
     98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    95, 102, 105, 110, 100, 95, 115, 112, 101, 99, 
-    46, 57, 48, 48, 58, 48, 2, 30, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 95, 115, 97, 110, 
-    105, 116, 121, 95, 99, 104, 101, 99, 107, 46, 
-    57, 52, 55, 58, 48, 2, 16, 0, 0, 0, 
-    0, 0, 0, 0, 78, 111, 32, 109, 111, 100, 
-    117, 108, 101, 32, 110, 97, 109, 101, 100, 32, 
-    2, 4, 0, 0, 0, 0, 0, 0, 0, 123, 
-    33, 114, 125, 2, 40, 0, 0, 0, 0, 0, 
+    115, 112, 101, 99, 95, 102, 114, 111, 109, 95, 
+    108, 111, 97, 100, 101, 114, 46, 52, 49, 52, 
+    58, 48, 2, 34, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 95, 115, 112, 101, 99, 95, 102, 114, 
+    111, 109, 95, 109, 111, 100, 117, 108, 101, 46, 
+    52, 52, 48, 58, 48, 6, 0, 2, 35, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 95, 105, 110, 
+    105, 116, 95, 109, 111, 100, 117, 108, 101, 95, 
+    97, 116, 116, 114, 115, 46, 52, 56, 53, 58, 
+    48, 2, 33, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 109, 111, 100, 117, 108, 101, 95, 102, 114, 
+    111, 109, 95, 115, 112, 101, 99, 46, 53, 53, 
+    55, 58, 48, 2, 39, 0, 0, 0, 0, 0, 
     0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 95, 102, 105, 110, 100, 95, 97, 
-    110, 100, 95, 108, 111, 97, 100, 95, 117, 110, 
-    108, 111, 99, 107, 101, 100, 46, 57, 54, 54, 
-    58, 48, 2, 32, 0, 0, 0, 0, 0, 0, 
+    97, 112, 46, 95, 109, 111, 100, 117, 108, 101, 
+    95, 114, 101, 112, 114, 95, 102, 114, 111, 109, 
+    95, 115, 112, 101, 99, 46, 53, 55, 52, 58, 
+    48, 2, 22, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 95, 101, 120, 101, 99, 46, 53, 57, 49, 
+    58, 48, 2, 42, 0, 0, 0, 0, 0, 0, 
     0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 46, 95, 102, 105, 110, 100, 95, 97, 110, 
-    100, 95, 108, 111, 97, 100, 46, 49, 48, 48, 
-    49, 58, 48, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 29, 0, 0, 0, 0, 0, 0, 
+    112, 46, 95, 108, 111, 97, 100, 95, 98, 97, 
+    99, 107, 119, 97, 114, 100, 95, 99, 111, 109, 
+    112, 97, 116, 105, 98, 108, 101, 46, 54, 50, 
+    49, 58, 48, 2, 31, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 46, 95, 108, 111, 97, 100, 95, 117, 
+    110, 108, 111, 99, 107, 101, 100, 46, 54, 53, 
+    56, 58, 48, 2, 22, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 46, 95, 108, 111, 97, 100, 46, 55, 
+    48, 48, 58, 48, 2, 43, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 46, 95, 95, 99, 108, 97, 115, 
+    115, 95, 95, 66, 117, 105, 108, 116, 105, 110, 
+    73, 109, 112, 111, 114, 116, 101, 114, 95, 95, 
+    46, 55, 49, 53, 58, 48, 2, 42, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 46, 95, 95, 99, 108, 
+    97, 115, 115, 95, 95, 70, 114, 111, 122, 101, 
+    110, 73, 109, 112, 111, 114, 116, 101, 114, 95, 
+    95, 46, 55, 57, 48, 58, 48, 2, 46, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 95, 95, 99, 
+    108, 97, 115, 115, 95, 95, 95, 73, 109, 112, 
+    111, 114, 116, 76, 111, 99, 107, 67, 111, 110, 
+    116, 101, 120, 116, 95, 95, 46, 56, 54, 57, 
+    58, 48, 2, 30, 0, 0, 0, 0, 0, 0, 
     0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 46, 95, 103, 99, 100, 95, 105, 109, 112, 
-    111, 114, 116, 46, 49, 48, 49, 55, 58, 48, 
-    2, 34, 0, 0, 0, 0, 0, 0, 0, 95, 
+    112, 46, 95, 114, 101, 115, 111, 108, 118, 101, 
+    95, 110, 97, 109, 101, 46, 56, 56, 50, 58, 
+    48, 2, 34, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 95, 102, 105, 110, 100, 95, 115, 112, 101, 
+    99, 95, 108, 101, 103, 97, 99, 121, 46, 56, 
+    57, 49, 58, 48, 2, 27, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 46, 95, 102, 105, 110, 100, 95, 
+    115, 112, 101, 99, 46, 57, 48, 48, 58, 48, 
+    2, 30, 0, 0, 0, 0, 0, 0, 0, 95, 
     98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    95, 104, 97, 110, 100, 108, 101, 95, 102, 114, 
-    111, 109, 108, 105, 115, 116, 46, 49, 48, 51, 
-    50, 58, 48, 2, 35, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 95, 99, 97, 108, 99, 95, 95, 
-    95, 112, 97, 99, 107, 97, 103, 101, 95, 95, 
-    46, 49, 48, 54, 57, 58, 48, 2, 28, 0, 
+    95, 115, 97, 110, 105, 116, 121, 95, 99, 104, 
+    101, 99, 107, 46, 57, 52, 55, 58, 48, 2, 
+    16, 0, 0, 0, 0, 0, 0, 0, 78, 111, 
+    32, 109, 111, 100, 117, 108, 101, 32, 110, 97, 
+    109, 101, 100, 32, 2, 4, 0, 0, 0, 0, 
+    0, 0, 0, 123, 33, 114, 125, 2, 40, 0, 
     0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 95, 95, 105, 
-    109, 112, 111, 114, 116, 95, 95, 46, 49, 48, 
-    57, 54, 58, 48, 2, 36, 0, 0, 0, 0, 
+    116, 115, 116, 114, 97, 112, 46, 95, 102, 105, 
+    110, 100, 95, 97, 110, 100, 95, 108, 111, 97, 
+    100, 95, 117, 110, 108, 111, 99, 107, 101, 100, 
+    46, 57, 54, 54, 58, 48, 2, 32, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 46, 95, 102, 105, 110, 
+    100, 95, 97, 110, 100, 95, 108, 111, 97, 100, 
+    46, 49, 48, 48, 49, 58, 48, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 2, 29, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 46, 95, 103, 99, 100, 
+    95, 105, 109, 112, 111, 114, 116, 46, 49, 48, 
+    49, 55, 58, 48, 2, 34, 0, 0, 0, 0, 
     0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 98, 117, 105, 108, 116, 
-    105, 110, 95, 102, 114, 111, 109, 95, 110, 97, 
-    109, 101, 46, 49, 49, 51, 51, 58, 48, 2, 
-    24, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    115, 101, 116, 117, 112, 46, 49, 49, 52, 48, 
-    58, 48, 2, 26, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 46, 95, 105, 110, 115, 116, 97, 108, 108, 
-    46, 49, 49, 55, 53, 58, 48, 2, 45, 0, 
+    114, 97, 112, 46, 95, 104, 97, 110, 100, 108, 
+    101, 95, 102, 114, 111, 109, 108, 105, 115, 116, 
+    46, 49, 48, 51, 50, 58, 48, 2, 35, 0, 
     0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 95, 105, 110, 
-    115, 116, 97, 108, 108, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 95, 105, 109, 112, 111, 114, 
-    116, 101, 114, 115, 46, 49, 49, 56, 51, 58, 
-    48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    116, 115, 116, 114, 97, 112, 46, 95, 99, 97, 
+    108, 99, 95, 95, 95, 112, 97, 99, 107, 97, 
+    103, 101, 95, 95, 46, 49, 48, 54, 57, 58, 
+    48, 2, 28, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 95, 95, 105, 109, 112, 111, 114, 116, 95, 
+    95, 46, 49, 48, 57, 54, 58, 48, 2, 36, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 98, 
+    117, 105, 108, 116, 105, 110, 95, 102, 114, 111, 
+    109, 95, 110, 97, 109, 101, 46, 49, 49, 51, 
+    51, 58, 48, 2, 24, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 46, 95, 115, 101, 116, 117, 112, 46, 
+    49, 49, 52, 48, 58, 48, 2, 26, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 46, 95, 105, 110, 115, 
+    116, 97, 108, 108, 46, 49, 49, 55, 53, 58, 
+    48, 2, 45, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 95, 105, 110, 115, 116, 97, 108, 108, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 95, 105, 
+    109, 112, 111, 114, 116, 101, 114, 115, 46, 49, 
+    49, 56, 51, 58, 48, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    8, 0, 0, 0, 0, 0, 0, 0, 60, 109, 
-    111, 100, 117, 108, 101, 62, 0, 0, 0, 0, 
+    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
+    0, 0, 60, 109, 111, 100, 117, 108, 101, 62, 
+    3, 0, 0, 0, 0, 0, 0, 0, 12, 0, 
+    0, 0, 0, 0, 0, 0, 82, 117, 110, 116, 
+    105, 109, 101, 69, 114, 114, 111, 114, 15, 0, 
+    0, 0, 0, 0, 0, 0, 95, 69, 82, 82, 
+    95, 77, 83, 71, 95, 80, 82, 69, 70, 73, 
+    88, 6, 0, 0, 0, 0, 0, 0, 0, 111, 
+    98, 106, 101, 99, 116, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 46, 95, 95, 99, 108, 97, 115, 
+    115, 95, 95, 95, 73, 109, 112, 111, 114, 116, 
+    76, 111, 99, 107, 67, 111, 110, 116, 101, 120, 
+    116, 95, 95, 46, 56, 54, 57, 58, 48, 0, 
+    14, 0, 0, 0, 0, 0, 0, 0, 33, 0, 
+    0, 47, 0, 10, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 109, 111, 100, 117, 108, 101, 95, 
+    95, 30, 2, 0, 47, 2, 12, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 113, 117, 97, 108, 
+    110, 97, 109, 101, 95, 95, 30, 1, 1, 30, 
+    0, 2, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 9, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 101, 110, 116, 101, 114, 95, 95, 30, 0, 
+    3, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    101, 120, 105, 116, 95, 95, 17, 0, 0, 0, 
+    0, 29, 0, 0, 41, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 99, 108, 97, 115, 
+    115, 95, 95, 4, 0, 0, 0, 0, 0, 0, 
+    0, 2, 18, 0, 0, 0, 0, 0, 0, 0, 
+    95, 73, 109, 112, 111, 114, 116, 76, 111, 99, 
+    107, 67, 111, 110, 116, 101, 120, 116, 2, 36, 
+    0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 
+    116, 101, 120, 116, 32, 109, 97, 110, 97, 103, 
+    101, 114, 32, 102, 111, 114, 32, 116, 104, 101, 
+    32, 105, 109, 112, 111, 114, 116, 32, 108, 111, 
+    99, 107, 46, 2, 45, 0, 0, 0, 0, 0, 
     0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 95, 95, 99, 108, 97, 115, 115, 
-    95, 95, 95, 73, 109, 112, 111, 114, 116, 76, 
-    111, 99, 107, 67, 111, 110, 116, 101, 120, 116, 
-    95, 95, 46, 56, 54, 57, 58, 48, 0, 14, 
-    0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 
-    47, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 109, 111, 100, 117, 108, 101, 95, 95, 
-    30, 2, 0, 47, 2, 12, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 113, 117, 97, 108, 110, 
-    97, 109, 101, 95, 95, 30, 1, 1, 30, 0, 
-    2, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
-    9, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    101, 110, 116, 101, 114, 95, 95, 30, 0, 3, 
-    36, 1, 0, 0, 0, 0, 0, 47, 1, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 101, 
-    120, 105, 116, 95, 95, 17, 0, 0, 0, 0, 
-    29, 0, 0, 41, 0, 1, 0, 0, 0, 0, 
+    97, 112, 46, 95, 73, 109, 112, 111, 114, 116, 
+    76, 111, 99, 107, 67, 111, 110, 116, 101, 120, 
+    116, 46, 95, 95, 101, 110, 116, 101, 114, 95, 
+    95, 46, 56, 55, 51, 58, 52, 2, 44, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 95, 73, 109, 
+    112, 111, 114, 116, 76, 111, 99, 107, 67, 111, 
+    110, 116, 101, 120, 116, 46, 95, 95, 101, 120, 
+    105, 116, 95, 95, 46, 56, 55, 55, 58, 52, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 99, 108, 97, 
-    115, 115, 95, 95, 4, 0, 0, 0, 0, 0, 
-    0, 0, 2, 18, 0, 0, 0, 0, 0, 0, 
-    0, 95, 73, 109, 112, 111, 114, 116, 76, 111, 
-    99, 107, 67, 111, 110, 116, 101, 120, 116, 2, 
-    36, 0, 0, 0, 0, 0, 0, 0, 67, 111, 
-    110, 116, 101, 120, 116, 32, 109, 97, 110, 97, 
-    103, 101, 114, 32, 102, 111, 114, 32, 116, 104, 
-    101, 32, 105, 109, 112, 111, 114, 116, 32, 108, 
-    111, 99, 107, 46, 2, 45, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 73, 109, 112, 111, 114, 
-    116, 76, 111, 99, 107, 67, 111, 110, 116, 101, 
-    120, 116, 46, 95, 95, 101, 110, 116, 101, 114, 
-    95, 95, 46, 56, 55, 51, 58, 52, 2, 44, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 95, 73, 
-    109, 112, 111, 114, 116, 76, 111, 99, 107, 67, 
-    111, 110, 116, 101, 120, 116, 46, 95, 95, 101, 
-    120, 105, 116, 95, 95, 46, 56, 55, 55, 58, 
-    52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 
+    0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 99, 
+    108, 97, 115, 115, 95, 95, 95, 73, 109, 112, 
+    111, 114, 116, 76, 111, 99, 107, 67, 111, 110, 
+    116, 101, 120, 116, 95, 95, 1, 0, 0, 0, 
+    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 110, 97, 109, 101, 95, 95, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    29, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    99, 108, 97, 115, 115, 95, 95, 95, 73, 109, 
-    112, 111, 114, 116, 76, 111, 99, 107, 67, 111, 
-    110, 116, 101, 120, 116, 95, 95, 1, 0, 0, 
-    0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 110, 97, 109, 101, 95, 
-    95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 
+    0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 
-    0, 42, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    95, 95, 99, 108, 97, 115, 115, 95, 95, 70, 
-    114, 111, 122, 101, 110, 73, 109, 112, 111, 114, 
-    116, 101, 114, 95, 95, 46, 55, 57, 48, 58, 
-    48, 0, 121, 0, 0, 0, 0, 0, 0, 0, 
-    33, 0, 0, 47, 0, 10, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 109, 111, 100, 117, 108, 
-    101, 95, 95, 30, 2, 0, 47, 2, 12, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 113, 117, 
-    97, 108, 110, 97, 109, 101, 95, 95, 30, 1, 
-    1, 30, 0, 2, 47, 0, 7, 0, 0, 0, 
-    0, 0, 0, 0, 95, 79, 82, 73, 71, 73, 
-    78, 33, 2, 1, 30, 0, 3, 36, 1, 0, 
-    0, 0, 0, 0, 47, 1, 11, 0, 0, 0, 
-    0, 0, 0, 0, 109, 111, 100, 117, 108, 101, 
-    95, 114, 101, 112, 114, 35, 4, 11, 0, 0, 
-    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
-    101, 95, 114, 101, 112, 114, 74, 4, 10, 2, 
-    1, 0, 75, 1, 0, 47, 0, 11, 0, 0, 
-    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
-    101, 95, 114, 101, 112, 114, 33, 2, 2, 30, 
-    0, 4, 30, 1, 4, 30, 3, 5, 74, 0, 
-    74, 1, 36, 4, 3, 2, 0, 0, 0, 75, 
-    1, 0, 75, 1, 0, 47, 4, 9, 0, 0, 
-    0, 0, 0, 0, 0, 102, 105, 110, 100, 95, 
-    115, 112, 101, 99, 35, 1, 9, 0, 0, 0, 
-    0, 0, 0, 0, 102, 105, 110, 100, 95, 115, 
-    112, 101, 99, 74, 1, 10, 2, 1, 0, 75, 
-    1, 0, 47, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 102, 105, 110, 100, 95, 115, 112, 101, 
-    99, 33, 1, 2, 30, 0, 4, 30, 2, 6, 
-    74, 0, 36, 3, 2, 1, 0, 0, 0, 75, 
-    1, 0, 47, 3, 11, 0, 0, 0, 0, 0, 
-    0, 0, 102, 105, 110, 100, 95, 109, 111, 100, 
-    117, 108, 101, 35, 2, 11, 0, 0, 0, 0, 
-    0, 0, 0, 102, 105, 110, 100, 95, 109, 111, 
-    100, 117, 108, 101, 74, 2, 10, 1, 1, 0, 
-    75, 1, 0, 47, 0, 11, 0, 0, 0, 0, 
-    0, 0, 0, 102, 105, 110, 100, 95, 109, 111, 
-    100, 117, 108, 101, 33, 1, 2, 30, 0, 7, 
-    36, 2, 0, 0, 0, 0, 0, 47, 2, 13, 
-    0, 0, 0, 0, 0, 0, 0, 99, 114, 101, 
-    97, 116, 101, 95, 109, 111, 100, 117, 108, 101, 
-    35, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
-    99, 114, 101, 97, 116, 101, 95, 109, 111, 100, 
-    117, 108, 101, 74, 4, 10, 1, 1, 0, 75, 
-    1, 0, 47, 0, 13, 0, 0, 0, 0, 0, 
-    0, 0, 99, 114, 101, 97, 116, 101, 95, 109, 
-    111, 100, 117, 108, 101, 33, 1, 1, 30, 0, 
-    8, 36, 2, 0, 0, 0, 0, 0, 47, 2, 
-    11, 0, 0, 0, 0, 0, 0, 0, 101, 120, 
-    101, 99, 95, 109, 111, 100, 117, 108, 101, 35, 
-    4, 11, 0, 0, 0, 0, 0, 0, 0, 101, 
-    120, 101, 99, 95, 109, 111, 100, 117, 108, 101, 
+    0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 
+    42, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
+    95, 99, 108, 97, 115, 115, 95, 95, 70, 114, 
+    111, 122, 101, 110, 73, 109, 112, 111, 114, 116, 
+    101, 114, 95, 95, 46, 55, 57, 48, 58, 48, 
+    0, 121, 0, 0, 0, 0, 0, 0, 0, 33, 
+    0, 0, 47, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 109, 111, 100, 117, 108, 101, 
+    95, 95, 30, 2, 0, 47, 2, 12, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 113, 117, 97, 
+    108, 110, 97, 109, 101, 95, 95, 30, 1, 1, 
+    30, 0, 2, 47, 0, 7, 0, 0, 0, 0, 
+    0, 0, 0, 95, 79, 82, 73, 71, 73, 78, 
+    33, 2, 1, 30, 0, 3, 36, 1, 0, 0, 
+    0, 0, 0, 47, 1, 11, 0, 0, 0, 0, 
+    0, 0, 0, 109, 111, 100, 117, 108, 101, 95, 
+    114, 101, 112, 114, 35, 4, 4, 74, 4, 10, 
+    2, 1, 0, 75, 1, 0, 47, 0, 11, 0, 
+    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
+    108, 101, 95, 114, 101, 112, 114, 33, 2, 2, 
+    30, 0, 4, 30, 1, 4, 30, 3, 5, 74, 
+    0, 74, 1, 36, 4, 3, 2, 0, 0, 0, 
+    75, 1, 0, 75, 1, 0, 47, 4, 9, 0, 
+    0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 
+    95, 115, 112, 101, 99, 35, 1, 5, 74, 1, 
+    10, 2, 1, 0, 75, 1, 0, 47, 0, 9, 
+    0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 
+    100, 95, 115, 112, 101, 99, 33, 1, 2, 30, 
+    0, 4, 30, 2, 6, 74, 0, 36, 3, 2, 
+    1, 0, 0, 0, 75, 1, 0, 47, 3, 11, 
+    0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 
+    100, 95, 109, 111, 100, 117, 108, 101, 35, 2, 
+    6, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
+    47, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
+    102, 105, 110, 100, 95, 109, 111, 100, 117, 108, 
+    101, 33, 1, 2, 30, 0, 7, 36, 2, 0, 
+    0, 0, 0, 0, 47, 2, 13, 0, 0, 0, 
+    0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 
+    95, 109, 111, 100, 117, 108, 101, 35, 4, 7, 
     74, 4, 10, 1, 1, 0, 75, 1, 0, 47, 
-    0, 11, 0, 0, 0, 0, 0, 0, 0, 101, 
-    120, 101, 99, 95, 109, 111, 100, 117, 108, 101, 
-    33, 1, 2, 30, 0, 9, 36, 2, 0, 0, 
-    0, 0, 0, 47, 2, 11, 0, 0, 0, 0, 
-    0, 0, 0, 108, 111, 97, 100, 95, 109, 111, 
-    100, 117, 108, 101, 35, 4, 11, 0, 0, 0, 
-    0, 0, 0, 0, 108, 111, 97, 100, 95, 109, 
-    111, 100, 117, 108, 101, 74, 4, 10, 1, 1, 
-    0, 75, 1, 0, 47, 0, 11, 0, 0, 0, 
-    0, 0, 0, 0, 108, 111, 97, 100, 95, 109, 
-    111, 100, 117, 108, 101, 33, 1, 2, 33, 2, 
-    3, 30, 0, 10, 36, 3, 0, 0, 0, 0, 
-    0, 47, 3, 8, 0, 0, 0, 0, 0, 0, 
-    0, 103, 101, 116, 95, 99, 111, 100, 101, 35, 
-    5, 8, 0, 0, 0, 0, 0, 0, 0, 103, 
-    101, 116, 95, 99, 111, 100, 101, 74, 5, 10, 
-    2, 1, 0, 75, 1, 0, 74, 0, 74, 0, 
-    10, 1, 1, 0, 75, 1, 0, 39, 3, 0, 
-    75, 0, 0, 47, 3, 8, 0, 0, 0, 0, 
-    0, 0, 0, 103, 101, 116, 95, 99, 111, 100, 
-    101, 33, 1, 2, 33, 2, 3, 30, 0, 11, 
-    36, 3, 0, 0, 0, 0, 0, 47, 3, 10, 
-    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
-    95, 115, 111, 117, 114, 99, 101, 35, 5, 10, 
-    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
-    95, 115, 111, 117, 114, 99, 101, 74, 5, 10, 
-    2, 1, 0, 75, 1, 0, 74, 0, 74, 0, 
-    10, 1, 1, 0, 75, 1, 0, 39, 3, 0, 
-    75, 0, 0, 47, 3, 10, 0, 0, 0, 0, 
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 99, 
+    114, 101, 97, 116, 101, 95, 109, 111, 100, 117, 
+    108, 101, 33, 1, 1, 30, 0, 8, 36, 2, 
+    0, 0, 0, 0, 0, 47, 2, 11, 0, 0, 
+    0, 0, 0, 0, 0, 101, 120, 101, 99, 95, 
+    109, 111, 100, 117, 108, 101, 35, 4, 8, 74, 
+    4, 10, 1, 1, 0, 75, 1, 0, 47, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 101, 120, 
+    101, 99, 95, 109, 111, 100, 117, 108, 101, 33, 
+    1, 2, 30, 0, 9, 36, 2, 0, 0, 0, 
+    0, 0, 47, 2, 11, 0, 0, 0, 0, 0, 
+    0, 0, 108, 111, 97, 100, 95, 109, 111, 100, 
+    117, 108, 101, 35, 4, 9, 74, 4, 10, 1, 
+    1, 0, 75, 1, 0, 47, 0, 11, 0, 0, 
+    0, 0, 0, 0, 0, 108, 111, 97, 100, 95, 
+    109, 111, 100, 117, 108, 101, 33, 1, 2, 33, 
+    2, 3, 30, 0, 10, 36, 3, 0, 0, 0, 
+    0, 0, 47, 3, 8, 0, 0, 0, 0, 0, 
+    0, 0, 103, 101, 116, 95, 99, 111, 100, 101, 
+    35, 5, 10, 74, 5, 10, 2, 1, 0, 75, 
+    1, 0, 74, 0, 74, 0, 10, 1, 1, 0, 
+    75, 1, 0, 39, 3, 0, 75, 0, 0, 47, 
+    3, 8, 0, 0, 0, 0, 0, 0, 0, 103, 
+    101, 116, 95, 99, 111, 100, 101, 33, 1, 2, 
+    33, 2, 3, 30, 0, 11, 36, 3, 0, 0, 
+    0, 0, 0, 47, 3, 10, 0, 0, 0, 0, 
     0, 0, 0, 103, 101, 116, 95, 115, 111, 117, 
-    114, 99, 101, 33, 1, 2, 33, 2, 3, 30, 
-    0, 12, 36, 3, 0, 0, 0, 0, 0, 47, 
-    3, 10, 0, 0, 0, 0, 0, 0, 0, 105, 
-    115, 95, 112, 97, 99, 107, 97, 103, 101, 35, 
-    5, 10, 0, 0, 0, 0, 0, 0, 0, 105, 
-    115, 95, 112, 97, 99, 107, 97, 103, 101, 74, 
-    5, 10, 2, 1, 0, 75, 1, 0, 74, 0, 
-    74, 0, 10, 1, 1, 0, 75, 1, 0, 39, 
-    3, 0, 75, 0, 0, 47, 3, 10, 0, 0, 
-    0, 0, 0, 0, 0, 105, 115, 95, 112, 97, 
-    99, 107, 97, 103, 101, 17, 0, 0, 0, 0, 
-    29, 0, 0, 41, 0, 1, 0, 0, 0, 0, 
+    114, 99, 101, 35, 5, 11, 74, 5, 10, 2, 
+    1, 0, 75, 1, 0, 74, 0, 74, 0, 10, 
+    1, 1, 0, 75, 1, 0, 39, 3, 0, 75, 
+    0, 0, 47, 3, 10, 0, 0, 0, 0, 0, 
+    0, 0, 103, 101, 116, 95, 115, 111, 117, 114, 
+    99, 101, 33, 1, 2, 33, 2, 3, 30, 0, 
+    12, 36, 3, 0, 0, 0, 0, 0, 47, 3, 
+    10, 0, 0, 0, 0, 0, 0, 0, 105, 115, 
+    95, 112, 97, 99, 107, 97, 103, 101, 35, 5, 
+    12, 74, 5, 10, 2, 1, 0, 75, 1, 0, 
+    74, 0, 74, 0, 10, 1, 1, 0, 75, 1, 
+    0, 39, 3, 0, 75, 0, 0, 47, 3, 10, 
+    0, 0, 0, 0, 0, 0, 0, 105, 115, 95, 
+    112, 97, 99, 107, 97, 103, 101, 17, 0, 0, 
+    0, 0, 29, 0, 0, 41, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
     0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
@@ -662,7 +649,7 @@ std::vector<uint8_t> _bootstrap
     0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 
     0, 0, 95, 95, 99, 108, 97, 115, 115, 95, 
     95, 70, 114, 111, 122, 101, 110, 73, 109, 112, 
-    111, 114, 116, 101, 114, 95, 95, 4, 0, 0, 
+    111, 114, 116, 101, 114, 95, 95, 13, 0, 0, 
     0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 
     0, 0, 0, 95, 95, 110, 97, 109, 101, 95, 
     95, 12, 0, 0, 0, 0, 0, 0, 0, 115, 
@@ -671,699 +658,726 @@ std::vector<uint8_t> _bootstrap
     108, 97, 115, 115, 109, 101, 116, 104, 111, 100, 
     16, 0, 0, 0, 0, 0, 0, 0, 95, 114, 
     101, 113, 117, 105, 114, 101, 115, 95, 102, 114, 
-    111, 122, 101, 110, 0, 0, 0, 0, 0, 0, 
+    111, 122, 101, 110, 11, 0, 0, 0, 0, 0, 
+    0, 0, 109, 111, 100, 117, 108, 101, 95, 114, 
+    101, 112, 114, 9, 0, 0, 0, 0, 0, 0, 
+    0, 102, 105, 110, 100, 95, 115, 112, 101, 99, 
+    11, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
+    110, 100, 95, 109, 111, 100, 117, 108, 101, 13, 
+    0, 0, 0, 0, 0, 0, 0, 99, 114, 101, 
+    97, 116, 101, 95, 109, 111, 100, 117, 108, 101, 
+    11, 0, 0, 0, 0, 0, 0, 0, 101, 120, 
+    101, 99, 95, 109, 111, 100, 117, 108, 101, 11, 
+    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
+    100, 95, 109, 111, 100, 117, 108, 101, 8, 0, 
+    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
+    99, 111, 100, 101, 10, 0, 0, 0, 0, 0, 
+    0, 0, 103, 101, 116, 95, 115, 111, 117, 114, 
+    99, 101, 10, 0, 0, 0, 0, 0, 0, 0, 
+    105, 115, 95, 112, 97, 99, 107, 97, 103, 101, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
-    0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 95, 95, 99, 108, 97, 115, 115, 
-    95, 95, 77, 111, 100, 117, 108, 101, 83, 112, 
-    101, 99, 95, 95, 46, 51, 49, 51, 58, 48, 
-    0, 73, 0, 0, 0, 0, 0, 0, 0, 33, 
-    0, 0, 47, 0, 10, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 109, 111, 100, 117, 108, 101, 
-    95, 95, 30, 2, 0, 47, 2, 12, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 113, 117, 97, 
-    108, 110, 97, 109, 101, 95, 95, 30, 1, 1, 
-    30, 0, 2, 30, 1, 2, 30, 2, 2, 30, 
-    3, 3, 74, 0, 74, 1, 74, 2, 36, 4, 
-    3, 0, 3, 0, 0, 75, 1, 0, 75, 1, 
-    0, 75, 1, 0, 47, 4, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 105, 110, 105, 116, 
-    95, 95, 30, 0, 4, 36, 1, 0, 0, 0, 
-    0, 0, 47, 1, 8, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 114, 101, 112, 114, 95, 95, 
-    30, 0, 5, 36, 1, 0, 0, 0, 0, 0, 
-    47, 1, 6, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 101, 113, 95, 95, 33, 3, 1, 30, 
-    0, 6, 36, 1, 0, 0, 0, 0, 0, 47, 
-    1, 6, 0, 0, 0, 0, 0, 0, 0, 99, 
-    97, 99, 104, 101, 100, 35, 4, 6, 0, 0, 
+    0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    38, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
+    95, 99, 108, 97, 115, 115, 95, 95, 77, 111, 
+    100, 117, 108, 101, 83, 112, 101, 99, 95, 95, 
+    46, 51, 49, 51, 58, 48, 0, 73, 0, 0, 
+    0, 0, 0, 0, 0, 33, 0, 0, 47, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    109, 111, 100, 117, 108, 101, 95, 95, 30, 2, 
+    0, 47, 2, 12, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 113, 117, 97, 108, 110, 97, 109, 
+    101, 95, 95, 30, 1, 1, 30, 0, 2, 30, 
+    1, 2, 30, 2, 2, 30, 3, 3, 74, 0, 
+    74, 1, 74, 2, 36, 4, 3, 0, 3, 0, 
+    0, 75, 1, 0, 75, 1, 0, 75, 1, 0, 
+    47, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 105, 110, 105, 116, 95, 95, 30, 0, 
+    4, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    114, 101, 112, 114, 95, 95, 30, 0, 5, 36, 
+    1, 0, 0, 0, 0, 0, 47, 1, 6, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 101, 113, 
+    95, 95, 33, 3, 1, 30, 0, 6, 36, 1, 
+    0, 0, 0, 0, 0, 47, 1, 6, 0, 0, 
     0, 0, 0, 0, 0, 99, 97, 99, 104, 101, 
-    100, 74, 4, 10, 3, 1, 0, 75, 1, 0, 
-    47, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
-    99, 97, 99, 104, 101, 100, 35, 2, 6, 0, 
-    0, 0, 0, 0, 0, 0, 99, 97, 99, 104, 
-    101, 100, 27, 1, 2, 2, 30, 0, 7, 36, 
+    100, 35, 4, 3, 74, 4, 10, 3, 1, 0, 
+    75, 1, 0, 47, 0, 6, 0, 0, 0, 0, 
+    0, 0, 0, 99, 97, 99, 104, 101, 100, 35, 
+    2, 3, 27, 1, 2, 2, 30, 0, 7, 36, 
     2, 0, 0, 0, 0, 0, 47, 2, 6, 0, 
     0, 0, 0, 0, 0, 0, 99, 97, 99, 104, 
-    101, 100, 35, 4, 6, 0, 0, 0, 0, 0, 
-    0, 0, 99, 97, 99, 104, 101, 100, 74, 4, 
-    10, 1, 1, 0, 75, 1, 0, 47, 0, 6, 
-    0, 0, 0, 0, 0, 0, 0, 99, 97, 99, 
-    104, 101, 100, 33, 1, 1, 30, 0, 8, 36, 
-    2, 0, 0, 0, 0, 0, 47, 2, 6, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 114, 101, 
-    110, 116, 35, 4, 6, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 114, 101, 110, 116, 74, 4, 
-    10, 1, 1, 0, 75, 1, 0, 47, 0, 6, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 
-    101, 110, 116, 33, 1, 1, 30, 0, 9, 36, 
-    2, 0, 0, 0, 0, 0, 47, 2, 12, 0, 
-    0, 0, 0, 0, 0, 0, 104, 97, 115, 95, 
-    108, 111, 99, 97, 116, 105, 111, 110, 35, 4, 
-    12, 0, 0, 0, 0, 0, 0, 0, 104, 97, 
-    115, 95, 108, 111, 99, 97, 116, 105, 111, 110, 
-    74, 4, 10, 1, 1, 0, 75, 1, 0, 47, 
-    0, 12, 0, 0, 0, 0, 0, 0, 0, 104, 
-    97, 115, 95, 108, 111, 99, 97, 116, 105, 111, 
-    110, 35, 1, 12, 0, 0, 0, 0, 0, 0, 
-    0, 104, 97, 115, 95, 108, 111, 99, 97, 116, 
-    105, 111, 110, 27, 2, 1, 2, 30, 0, 10, 
-    36, 1, 0, 0, 0, 0, 0, 47, 1, 12, 
-    0, 0, 0, 0, 0, 0, 0, 104, 97, 115, 
-    95, 108, 111, 99, 97, 116, 105, 111, 110, 35, 
-    4, 12, 0, 0, 0, 0, 0, 0, 0, 104, 
-    97, 115, 95, 108, 111, 99, 97, 116, 105, 111, 
-    110, 74, 4, 10, 2, 1, 0, 75, 1, 0, 
-    47, 0, 12, 0, 0, 0, 0, 0, 0, 0, 
+    101, 100, 35, 4, 3, 74, 4, 10, 1, 1, 
+    0, 75, 1, 0, 47, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 99, 97, 99, 104, 101, 100, 
+    33, 1, 1, 30, 0, 8, 36, 2, 0, 0, 
+    0, 0, 0, 47, 2, 6, 0, 0, 0, 0, 
+    0, 0, 0, 112, 97, 114, 101, 110, 116, 35, 
+    4, 4, 74, 4, 10, 1, 1, 0, 75, 1, 
+    0, 47, 0, 6, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 114, 101, 110, 116, 33, 1, 1, 
+    30, 0, 9, 36, 2, 0, 0, 0, 0, 0, 
+    47, 2, 12, 0, 0, 0, 0, 0, 0, 0, 
     104, 97, 115, 95, 108, 111, 99, 97, 116, 105, 
-    111, 110, 17, 0, 0, 0, 0, 29, 0, 0, 
-    41, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    111, 110, 35, 4, 5, 74, 4, 10, 1, 1, 
+    0, 75, 1, 0, 47, 0, 12, 0, 0, 0, 
+    0, 0, 0, 0, 104, 97, 115, 95, 108, 111, 
+    99, 97, 116, 105, 111, 110, 35, 1, 5, 27, 
+    2, 1, 2, 30, 0, 10, 36, 1, 0, 0, 
+    0, 0, 0, 47, 1, 12, 0, 0, 0, 0, 
+    0, 0, 0, 104, 97, 115, 95, 108, 111, 99, 
+    97, 116, 105, 111, 110, 35, 4, 5, 74, 4, 
+    10, 2, 1, 0, 75, 1, 0, 47, 0, 12, 
+    0, 0, 0, 0, 0, 0, 0, 104, 97, 115, 
+    95, 108, 111, 99, 97, 116, 105, 111, 110, 17, 
+    0, 0, 0, 0, 29, 0, 0, 41, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 99, 108, 97, 115, 115, 95, 
-    95, 11, 0, 0, 0, 0, 0, 0, 0, 2, 
-    10, 0, 0, 0, 0, 0, 0, 0, 77, 111, 
-    100, 117, 108, 101, 83, 112, 101, 99, 2, 208, 
-    5, 0, 0, 0, 0, 0, 0, 84, 104, 101, 
-    32, 115, 112, 101, 99, 105, 102, 105, 99, 97, 
-    116, 105, 111, 110, 32, 102, 111, 114, 32, 97, 
-    32, 109, 111, 100, 117, 108, 101, 44, 32, 117, 
-    115, 101, 100, 32, 102, 111, 114, 32, 108, 111, 
-    97, 100, 105, 110, 103, 46, 10, 10, 32, 32, 
-    32, 32, 65, 32, 109, 111, 100, 117, 108, 101, 
-    39, 115, 32, 115, 112, 101, 99, 32, 105, 115, 
-    32, 116, 104, 101, 32, 115, 111, 117, 114, 99, 
-    101, 32, 102, 111, 114, 32, 105, 110, 102, 111, 
-    114, 109, 97, 116, 105, 111, 110, 32, 97, 98, 
-    111, 117, 116, 32, 116, 104, 101, 32, 109, 111, 
-    100, 117, 108, 101, 46, 32, 32, 70, 111, 114, 
-    10, 32, 32, 32, 32, 100, 97, 116, 97, 32, 
-    97, 115, 115, 111, 99, 105, 97, 116, 101, 100, 
-    32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 
-    109, 111, 100, 117, 108, 101, 44, 32, 105, 110, 
-    99, 108, 117, 100, 105, 110, 103, 32, 115, 111, 
-    117, 114, 99, 101, 44, 32, 117, 115, 101, 32, 
-    116, 104, 101, 32, 115, 112, 101, 99, 39, 115, 
-    10, 32, 32, 32, 32, 108, 111, 97, 100, 101, 
-    114, 46, 10, 10, 32, 32, 32, 32, 96, 110, 
-    97, 109, 101, 96, 32, 105, 115, 32, 116, 104, 
-    101, 32, 97, 98, 115, 111, 108, 117, 116, 101, 
-    32, 110, 97, 109, 101, 32, 111, 102, 32, 116, 
-    104, 101, 32, 109, 111, 100, 117, 108, 101, 46, 
-    32, 32, 96, 108, 111, 97, 100, 101, 114, 96, 
-    32, 105, 115, 32, 116, 104, 101, 32, 108, 111, 
-    97, 100, 101, 114, 10, 32, 32, 32, 32, 116, 
-    111, 32, 117, 115, 101, 32, 119, 104, 101, 110, 
-    32, 108, 111, 97, 100, 105, 110, 103, 32, 116, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 9, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 99, 
+    108, 97, 115, 115, 95, 95, 11, 0, 0, 0, 
+    0, 0, 0, 0, 2, 10, 0, 0, 0, 0, 
+    0, 0, 0, 77, 111, 100, 117, 108, 101, 83, 
+    112, 101, 99, 2, 208, 5, 0, 0, 0, 0, 
+    0, 0, 84, 104, 101, 32, 115, 112, 101, 99, 
+    105, 102, 105, 99, 97, 116, 105, 111, 110, 32, 
+    102, 111, 114, 32, 97, 32, 109, 111, 100, 117, 
+    108, 101, 44, 32, 117, 115, 101, 100, 32, 102, 
+    111, 114, 32, 108, 111, 97, 100, 105, 110, 103, 
+    46, 10, 10, 32, 32, 32, 32, 65, 32, 109, 
+    111, 100, 117, 108, 101, 39, 115, 32, 115, 112, 
+    101, 99, 32, 105, 115, 32, 116, 104, 101, 32, 
+    115, 111, 117, 114, 99, 101, 32, 102, 111, 114, 
+    32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 
+    111, 110, 32, 97, 98, 111, 117, 116, 32, 116, 
     104, 101, 32, 109, 111, 100, 117, 108, 101, 46, 
-    32, 32, 96, 112, 97, 114, 101, 110, 116, 96, 
-    32, 105, 115, 32, 116, 104, 101, 32, 110, 97, 
-    109, 101, 32, 111, 102, 32, 116, 104, 101, 10, 
-    32, 32, 32, 32, 112, 97, 99, 107, 97, 103, 
-    101, 32, 116, 104, 101, 32, 109, 111, 100, 117, 
-    108, 101, 32, 105, 115, 32, 105, 110, 46, 32, 
-    32, 84, 104, 101, 32, 112, 97, 114, 101, 110, 
-    116, 32, 105, 115, 32, 100, 101, 114, 105, 118, 
-    101, 100, 32, 102, 114, 111, 109, 32, 116, 104, 
-    101, 32, 110, 97, 109, 101, 46, 10, 10, 32, 
-    32, 32, 32, 96, 105, 115, 95, 112, 97, 99, 
-    107, 97, 103, 101, 96, 32, 100, 101, 116, 101, 
-    114, 109, 105, 110, 101, 115, 32, 105, 102, 32, 
-    116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 
-    32, 105, 115, 32, 99, 111, 110, 115, 105, 100, 
-    101, 114, 101, 100, 32, 97, 32, 112, 97, 99, 
-    107, 97, 103, 101, 32, 111, 114, 10, 32, 32, 
-    32, 32, 110, 111, 116, 46, 32, 32, 79, 110, 
-    32, 109, 111, 100, 117, 108, 101, 115, 32, 116, 
-    104, 105, 115, 32, 105, 115, 32, 114, 101, 102, 
-    108, 101, 99, 116, 101, 100, 32, 98, 121, 32, 
-    116, 104, 101, 32, 96, 95, 95, 112, 97, 116, 
-    104, 95, 95, 96, 32, 97, 116, 116, 114, 105, 
-    98, 117, 116, 101, 46, 10, 10, 32, 32, 32, 
-    32, 96, 111, 114, 105, 103, 105, 110, 96, 32, 
-    105, 115, 32, 116, 104, 101, 32, 115, 112, 101, 
-    99, 105, 102, 105, 99, 32, 108, 111, 99, 97, 
-    116, 105, 111, 110, 32, 117, 115, 101, 100, 32, 
-    98, 121, 32, 116, 104, 101, 32, 108, 111, 97, 
-    100, 101, 114, 32, 102, 114, 111, 109, 32, 119, 
-    104, 105, 99, 104, 32, 116, 111, 10, 32, 32, 
-    32, 32, 108, 111, 97, 100, 32, 116, 104, 101, 
-    32, 109, 111, 100, 117, 108, 101, 44, 32, 105, 
-    102, 32, 116, 104, 97, 116, 32, 105, 110, 102, 
-    111, 114, 109, 97, 116, 105, 111, 110, 32, 105, 
-    115, 32, 97, 118, 97, 105, 108, 97, 98, 108, 
-    101, 46, 32, 32, 87, 104, 101, 110, 32, 102, 
-    105, 108, 101, 110, 97, 109, 101, 32, 105, 115, 
-    10, 32, 32, 32, 32, 115, 101, 116, 44, 32, 
-    111, 114, 105, 103, 105, 110, 32, 119, 105, 108, 
-    108, 32, 109, 97, 116, 99, 104, 46, 10, 10, 
-    32, 32, 32, 32, 96, 104, 97, 115, 95, 108, 
-    111, 99, 97, 116, 105, 111, 110, 96, 32, 105, 
-    110, 100, 105, 99, 97, 116, 101, 115, 32, 116, 
-    104, 97, 116, 32, 97, 32, 115, 112, 101, 99, 
-    39, 115, 32, 34, 111, 114, 105, 103, 105, 110, 
-    34, 32, 114, 101, 102, 108, 101, 99, 116, 115, 
-    32, 97, 32, 108, 111, 99, 97, 116, 105, 111, 
-    110, 46, 10, 32, 32, 32, 32, 87, 104, 101, 
-    110, 32, 116, 104, 105, 115, 32, 105, 115, 32, 
-    84, 114, 117, 101, 44, 32, 96, 95, 95, 102, 
-    105, 108, 101, 95, 95, 96, 32, 97, 116, 116, 
-    114, 105, 98, 117, 116, 101, 32, 111, 102, 32, 
-    116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 
-    32, 105, 115, 32, 115, 101, 116, 46, 10, 10, 
-    32, 32, 32, 32, 96, 99, 97, 99, 104, 101, 
-    100, 96, 32, 105, 115, 32, 116, 104, 101, 32, 
-    108, 111, 99, 97, 116, 105, 111, 110, 32, 111, 
-    102, 32, 116, 104, 101, 32, 99, 97, 99, 104, 
-    101, 100, 32, 98, 121, 116, 101, 99, 111, 100, 
-    101, 32, 102, 105, 108, 101, 44, 32, 105, 102, 
-    32, 97, 110, 121, 46, 32, 32, 73, 116, 10, 
-    32, 32, 32, 32, 99, 111, 114, 114, 101, 115, 
-    112, 111, 110, 100, 115, 32, 116, 111, 32, 116, 
-    104, 101, 32, 96, 95, 95, 99, 97, 99, 104, 
-    101, 100, 95, 95, 96, 32, 97, 116, 116, 114, 
-    105, 98, 117, 116, 101, 46, 10, 10, 32, 32, 
-    32, 32, 96, 115, 117, 98, 109, 111, 100, 117, 
-    108, 101, 95, 115, 101, 97, 114, 99, 104, 95, 
-    108, 111, 99, 97, 116, 105, 111, 110, 115, 96, 
-    32, 105, 115, 32, 116, 104, 101, 32, 115, 101, 
-    113, 117, 101, 110, 99, 101, 32, 111, 102, 32, 
-    112, 97, 116, 104, 32, 101, 110, 116, 114, 105, 
-    101, 115, 32, 116, 111, 10, 32, 32, 32, 32, 
-    115, 101, 97, 114, 99, 104, 32, 119, 104, 101, 
-    110, 32, 105, 109, 112, 111, 114, 116, 105, 110, 
-    103, 32, 115, 117, 98, 109, 111, 100, 117, 108, 
-    101, 115, 46, 32, 32, 73, 102, 32, 115, 101, 
-    116, 44, 32, 105, 115, 95, 112, 97, 99, 107, 
-    97, 103, 101, 32, 115, 104, 111, 117, 108, 100, 
-    32, 98, 101, 10, 32, 32, 32, 32, 84, 114, 
-    117, 101, 45, 45, 97, 110, 100, 32, 70, 97, 
-    108, 115, 101, 32, 111, 116, 104, 101, 114, 119, 
-    105, 115, 101, 46, 10, 10, 32, 32, 32, 32, 
-    80, 97, 99, 107, 97, 103, 101, 115, 32, 97, 
-    114, 101, 32, 115, 105, 109, 112, 108, 121, 32, 
-    109, 111, 100, 117, 108, 101, 115, 32, 116, 104, 
-    97, 116, 32, 40, 109, 97, 121, 41, 32, 104, 
-    97, 118, 101, 32, 115, 117, 98, 109, 111, 100, 
-    117, 108, 101, 115, 46, 32, 32, 73, 102, 32, 
-    97, 32, 115, 112, 101, 99, 10, 32, 32, 32, 
-    32, 104, 97, 115, 32, 97, 32, 110, 111, 110, 
-    45, 78, 111, 110, 101, 32, 118, 97, 108, 117, 
-    101, 32, 105, 110, 32, 96, 115, 117, 98, 109, 
-    111, 100, 117, 108, 101, 95, 115, 101, 97, 114, 
-    99, 104, 95, 108, 111, 99, 97, 116, 105, 111, 
-    110, 115, 96, 44, 32, 116, 104, 101, 32, 105, 
-    109, 112, 111, 114, 116, 10, 32, 32, 32, 32, 
-    115, 121, 115, 116, 101, 109, 32, 119, 105, 108, 
-    108, 32, 99, 111, 110, 115, 105, 100, 101, 114, 
-    32, 109, 111, 100, 117, 108, 101, 115, 32, 108, 
-    111, 97, 100, 101, 100, 32, 102, 114, 111, 109, 
-    32, 116, 104, 101, 32, 115, 112, 101, 99, 32, 
-    97, 115, 32, 112, 97, 99, 107, 97, 103, 101, 
-    115, 46, 10, 10, 32, 32, 32, 32, 79, 110, 
-    108, 121, 32, 102, 105, 110, 100, 101, 114, 115, 
-    32, 40, 115, 101, 101, 32, 105, 109, 112, 111, 
-    114, 116, 108, 105, 98, 46, 97, 98, 99, 46, 
-    77, 101, 116, 97, 80, 97, 116, 104, 70, 105, 
-    110, 100, 101, 114, 32, 97, 110, 100, 10, 32, 
-    32, 32, 32, 105, 109, 112, 111, 114, 116, 108, 
-    105, 98, 46, 97, 98, 99, 46, 80, 97, 116, 
-    104, 69, 110, 116, 114, 121, 70, 105, 110, 100, 
-    101, 114, 41, 32, 115, 104, 111, 117, 108, 100, 
-    32, 109, 111, 100, 105, 102, 121, 32, 77, 111, 
-    100, 117, 108, 101, 83, 112, 101, 99, 32, 105, 
-    110, 115, 116, 97, 110, 99, 101, 115, 46, 10, 
-    10, 32, 32, 32, 32, 5, 2, 36, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 77, 111, 100, 117, 
-    108, 101, 83, 112, 101, 99, 46, 95, 95, 105, 
-    110, 105, 116, 95, 95, 46, 51, 53, 48, 58, 
-    52, 2, 36, 0, 0, 0, 0, 0, 0, 0, 
+    32, 32, 70, 111, 114, 10, 32, 32, 32, 32, 
+    100, 97, 116, 97, 32, 97, 115, 115, 111, 99, 
+    105, 97, 116, 101, 100, 32, 119, 105, 116, 104, 
+    32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 
+    101, 44, 32, 105, 110, 99, 108, 117, 100, 105, 
+    110, 103, 32, 115, 111, 117, 114, 99, 101, 44, 
+    32, 117, 115, 101, 32, 116, 104, 101, 32, 115, 
+    112, 101, 99, 39, 115, 10, 32, 32, 32, 32, 
+    108, 111, 97, 100, 101, 114, 46, 10, 10, 32, 
+    32, 32, 32, 96, 110, 97, 109, 101, 96, 32, 
+    105, 115, 32, 116, 104, 101, 32, 97, 98, 115, 
+    111, 108, 117, 116, 101, 32, 110, 97, 109, 101, 
+    32, 111, 102, 32, 116, 104, 101, 32, 109, 111, 
+    100, 117, 108, 101, 46, 32, 32, 96, 108, 111, 
+    97, 100, 101, 114, 96, 32, 105, 115, 32, 116, 
+    104, 101, 32, 108, 111, 97, 100, 101, 114, 10, 
+    32, 32, 32, 32, 116, 111, 32, 117, 115, 101, 
+    32, 119, 104, 101, 110, 32, 108, 111, 97, 100, 
+    105, 110, 103, 32, 116, 104, 101, 32, 109, 111, 
+    100, 117, 108, 101, 46, 32, 32, 96, 112, 97, 
+    114, 101, 110, 116, 96, 32, 105, 115, 32, 116, 
+    104, 101, 32, 110, 97, 109, 101, 32, 111, 102, 
+    32, 116, 104, 101, 10, 32, 32, 32, 32, 112, 
+    97, 99, 107, 97, 103, 101, 32, 116, 104, 101, 
+    32, 109, 111, 100, 117, 108, 101, 32, 105, 115, 
+    32, 105, 110, 46, 32, 32, 84, 104, 101, 32, 
+    112, 97, 114, 101, 110, 116, 32, 105, 115, 32, 
+    100, 101, 114, 105, 118, 101, 100, 32, 102, 114, 
+    111, 109, 32, 116, 104, 101, 32, 110, 97, 109, 
+    101, 46, 10, 10, 32, 32, 32, 32, 96, 105, 
+    115, 95, 112, 97, 99, 107, 97, 103, 101, 96, 
+    32, 100, 101, 116, 101, 114, 109, 105, 110, 101, 
+    115, 32, 105, 102, 32, 116, 104, 101, 32, 109, 
+    111, 100, 117, 108, 101, 32, 105, 115, 32, 99, 
+    111, 110, 115, 105, 100, 101, 114, 101, 100, 32, 
+    97, 32, 112, 97, 99, 107, 97, 103, 101, 32, 
+    111, 114, 10, 32, 32, 32, 32, 110, 111, 116, 
+    46, 32, 32, 79, 110, 32, 109, 111, 100, 117, 
+    108, 101, 115, 32, 116, 104, 105, 115, 32, 105, 
+    115, 32, 114, 101, 102, 108, 101, 99, 116, 101, 
+    100, 32, 98, 121, 32, 116, 104, 101, 32, 96, 
+    95, 95, 112, 97, 116, 104, 95, 95, 96, 32, 
+    97, 116, 116, 114, 105, 98, 117, 116, 101, 46, 
+    10, 10, 32, 32, 32, 32, 96, 111, 114, 105, 
+    103, 105, 110, 96, 32, 105, 115, 32, 116, 104, 
+    101, 32, 115, 112, 101, 99, 105, 102, 105, 99, 
+    32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 
+    117, 115, 101, 100, 32, 98, 121, 32, 116, 104, 
+    101, 32, 108, 111, 97, 100, 101, 114, 32, 102, 
+    114, 111, 109, 32, 119, 104, 105, 99, 104, 32, 
+    116, 111, 10, 32, 32, 32, 32, 108, 111, 97, 
+    100, 32, 116, 104, 101, 32, 109, 111, 100, 117, 
+    108, 101, 44, 32, 105, 102, 32, 116, 104, 97, 
+    116, 32, 105, 110, 102, 111, 114, 109, 97, 116, 
+    105, 111, 110, 32, 105, 115, 32, 97, 118, 97, 
+    105, 108, 97, 98, 108, 101, 46, 32, 32, 87, 
+    104, 101, 110, 32, 102, 105, 108, 101, 110, 97, 
+    109, 101, 32, 105, 115, 10, 32, 32, 32, 32, 
+    115, 101, 116, 44, 32, 111, 114, 105, 103, 105, 
+    110, 32, 119, 105, 108, 108, 32, 109, 97, 116, 
+    99, 104, 46, 10, 10, 32, 32, 32, 32, 96, 
+    104, 97, 115, 95, 108, 111, 99, 97, 116, 105, 
+    111, 110, 96, 32, 105, 110, 100, 105, 99, 97, 
+    116, 101, 115, 32, 116, 104, 97, 116, 32, 97, 
+    32, 115, 112, 101, 99, 39, 115, 32, 34, 111, 
+    114, 105, 103, 105, 110, 34, 32, 114, 101, 102, 
+    108, 101, 99, 116, 115, 32, 97, 32, 108, 111, 
+    99, 97, 116, 105, 111, 110, 46, 10, 32, 32, 
+    32, 32, 87, 104, 101, 110, 32, 116, 104, 105, 
+    115, 32, 105, 115, 32, 84, 114, 117, 101, 44, 
+    32, 96, 95, 95, 102, 105, 108, 101, 95, 95, 
+    96, 32, 97, 116, 116, 114, 105, 98, 117, 116, 
+    101, 32, 111, 102, 32, 116, 104, 101, 32, 109, 
+    111, 100, 117, 108, 101, 32, 105, 115, 32, 115, 
+    101, 116, 46, 10, 10, 32, 32, 32, 32, 96, 
+    99, 97, 99, 104, 101, 100, 96, 32, 105, 115, 
+    32, 116, 104, 101, 32, 108, 111, 99, 97, 116, 
+    105, 111, 110, 32, 111, 102, 32, 116, 104, 101, 
+    32, 99, 97, 99, 104, 101, 100, 32, 98, 121, 
+    116, 101, 99, 111, 100, 101, 32, 102, 105, 108, 
+    101, 44, 32, 105, 102, 32, 97, 110, 121, 46, 
+    32, 32, 73, 116, 10, 32, 32, 32, 32, 99, 
+    111, 114, 114, 101, 115, 112, 111, 110, 100, 115, 
+    32, 116, 111, 32, 116, 104, 101, 32, 96, 95, 
+    95, 99, 97, 99, 104, 101, 100, 95, 95, 96, 
+    32, 97, 116, 116, 114, 105, 98, 117, 116, 101, 
+    46, 10, 10, 32, 32, 32, 32, 96, 115, 117, 
+    98, 109, 111, 100, 117, 108, 101, 95, 115, 101, 
+    97, 114, 99, 104, 95, 108, 111, 99, 97, 116, 
+    105, 111, 110, 115, 96, 32, 105, 115, 32, 116, 
+    104, 101, 32, 115, 101, 113, 117, 101, 110, 99, 
+    101, 32, 111, 102, 32, 112, 97, 116, 104, 32, 
+    101, 110, 116, 114, 105, 101, 115, 32, 116, 111, 
+    10, 32, 32, 32, 32, 115, 101, 97, 114, 99, 
+    104, 32, 119, 104, 101, 110, 32, 105, 109, 112, 
+    111, 114, 116, 105, 110, 103, 32, 115, 117, 98, 
+    109, 111, 100, 117, 108, 101, 115, 46, 32, 32, 
+    73, 102, 32, 115, 101, 116, 44, 32, 105, 115, 
+    95, 112, 97, 99, 107, 97, 103, 101, 32, 115, 
+    104, 111, 117, 108, 100, 32, 98, 101, 10, 32, 
+    32, 32, 32, 84, 114, 117, 101, 45, 45, 97, 
+    110, 100, 32, 70, 97, 108, 115, 101, 32, 111, 
+    116, 104, 101, 114, 119, 105, 115, 101, 46, 10, 
+    10, 32, 32, 32, 32, 80, 97, 99, 107, 97, 
+    103, 101, 115, 32, 97, 114, 101, 32, 115, 105, 
+    109, 112, 108, 121, 32, 109, 111, 100, 117, 108, 
+    101, 115, 32, 116, 104, 97, 116, 32, 40, 109, 
+    97, 121, 41, 32, 104, 97, 118, 101, 32, 115, 
+    117, 98, 109, 111, 100, 117, 108, 101, 115, 46, 
+    32, 32, 73, 102, 32, 97, 32, 115, 112, 101, 
+    99, 10, 32, 32, 32, 32, 104, 97, 115, 32, 
+    97, 32, 110, 111, 110, 45, 78, 111, 110, 101, 
+    32, 118, 97, 108, 117, 101, 32, 105, 110, 32, 
+    96, 115, 117, 98, 109, 111, 100, 117, 108, 101, 
+    95, 115, 101, 97, 114, 99, 104, 95, 108, 111, 
+    99, 97, 116, 105, 111, 110, 115, 96, 44, 32, 
+    116, 104, 101, 32, 105, 109, 112, 111, 114, 116, 
+    10, 32, 32, 32, 32, 115, 121, 115, 116, 101, 
+    109, 32, 119, 105, 108, 108, 32, 99, 111, 110, 
+    115, 105, 100, 101, 114, 32, 109, 111, 100, 117, 
+    108, 101, 115, 32, 108, 111, 97, 100, 101, 100, 
+    32, 102, 114, 111, 109, 32, 116, 104, 101, 32, 
+    115, 112, 101, 99, 32, 97, 115, 32, 112, 97, 
+    99, 107, 97, 103, 101, 115, 46, 10, 10, 32, 
+    32, 32, 32, 79, 110, 108, 121, 32, 102, 105, 
+    110, 100, 101, 114, 115, 32, 40, 115, 101, 101, 
+    32, 105, 109, 112, 111, 114, 116, 108, 105, 98, 
+    46, 97, 98, 99, 46, 77, 101, 116, 97, 80, 
+    97, 116, 104, 70, 105, 110, 100, 101, 114, 32, 
+    97, 110, 100, 10, 32, 32, 32, 32, 105, 109, 
+    112, 111, 114, 116, 108, 105, 98, 46, 97, 98, 
+    99, 46, 80, 97, 116, 104, 69, 110, 116, 114, 
+    121, 70, 105, 110, 100, 101, 114, 41, 32, 115, 
+    104, 111, 117, 108, 100, 32, 109, 111, 100, 105, 
+    102, 121, 32, 77, 111, 100, 117, 108, 101, 83, 
+    112, 101, 99, 32, 105, 110, 115, 116, 97, 110, 
+    99, 101, 115, 46, 10, 10, 32, 32, 32, 32, 
+    5, 2, 36, 0, 0, 0, 0, 0, 0, 0, 
     95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
     46, 77, 111, 100, 117, 108, 101, 83, 112, 101, 
-    99, 46, 95, 95, 114, 101, 112, 114, 95, 95, 
-    46, 51, 54, 50, 58, 52, 2, 34, 0, 0, 
+    99, 46, 95, 95, 105, 110, 105, 116, 95, 95, 
+    46, 51, 53, 48, 58, 52, 2, 36, 0, 0, 
     0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
     115, 116, 114, 97, 112, 46, 77, 111, 100, 117, 
-    108, 101, 83, 112, 101, 99, 46, 95, 95, 101, 
-    113, 95, 95, 46, 51, 55, 50, 58, 52, 2, 
-    34, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 77, 
-    111, 100, 117, 108, 101, 83, 112, 101, 99, 46, 
-    99, 97, 99, 104, 101, 100, 46, 51, 56, 52, 
-    58, 52, 2, 34, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 46, 77, 111, 100, 117, 108, 101, 83, 112, 
-    101, 99, 46, 99, 97, 99, 104, 101, 100, 46, 
-    51, 57, 51, 58, 52, 2, 34, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 46, 77, 111, 100, 117, 108, 
-    101, 83, 112, 101, 99, 46, 112, 97, 114, 101, 
-    110, 116, 46, 51, 57, 55, 58, 52, 2, 40, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 77, 111, 
-    100, 117, 108, 101, 83, 112, 101, 99, 46, 104, 
-    97, 115, 95, 108, 111, 99, 97, 116, 105, 111, 
-    110, 46, 52, 48, 53, 58, 52, 2, 40, 0, 
+    108, 101, 83, 112, 101, 99, 46, 95, 95, 114, 
+    101, 112, 114, 95, 95, 46, 51, 54, 50, 58, 
+    52, 2, 34, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 77, 111, 100, 117, 108, 101, 83, 112, 101, 
+    99, 46, 95, 95, 101, 113, 95, 95, 46, 51, 
+    55, 50, 58, 52, 2, 34, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 46, 77, 111, 100, 117, 108, 101, 
+    83, 112, 101, 99, 46, 99, 97, 99, 104, 101, 
+    100, 46, 51, 56, 52, 58, 52, 2, 34, 0, 
     0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
     116, 115, 116, 114, 97, 112, 46, 77, 111, 100, 
-    117, 108, 101, 83, 112, 101, 99, 46, 104, 97, 
-    115, 95, 108, 111, 99, 97, 116, 105, 111, 110, 
-    46, 52, 48, 57, 58, 52, 0, 0, 0, 0, 
+    117, 108, 101, 83, 112, 101, 99, 46, 99, 97, 
+    99, 104, 101, 100, 46, 51, 57, 51, 58, 52, 
+    2, 34, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
+    77, 111, 100, 117, 108, 101, 83, 112, 101, 99, 
+    46, 112, 97, 114, 101, 110, 116, 46, 51, 57, 
+    55, 58, 52, 2, 40, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 46, 77, 111, 100, 117, 108, 101, 83, 
+    112, 101, 99, 46, 104, 97, 115, 95, 108, 111, 
+    99, 97, 116, 105, 111, 110, 46, 52, 48, 53, 
+    58, 52, 2, 40, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 77, 111, 100, 117, 108, 101, 83, 112, 
+    101, 99, 46, 104, 97, 115, 95, 108, 111, 99, 
+    97, 116, 105, 111, 110, 46, 52, 48, 57, 58, 
+    52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
-    0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 99, 108, 97, 115, 115, 
-    95, 95, 77, 111, 100, 117, 108, 101, 83, 112, 
-    101, 99, 95, 95, 3, 0, 0, 0, 0, 0, 
     0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 110, 97, 109, 101, 95, 95, 8, 0, 
-    0, 0, 0, 0, 0, 0, 112, 114, 111, 112, 
-    101, 114, 116, 121, 6, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 116, 116, 101, 114, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 
+    21, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    99, 108, 97, 115, 115, 95, 95, 77, 111, 100, 
+    117, 108, 101, 83, 112, 101, 99, 95, 95, 6, 
+    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 110, 97, 109, 
+    101, 95, 95, 8, 0, 0, 0, 0, 0, 0, 
+    0, 112, 114, 111, 112, 101, 114, 116, 121, 6, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 
+    116, 101, 114, 6, 0, 0, 0, 0, 0, 0, 
+    0, 99, 97, 99, 104, 101, 100, 6, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 114, 101, 110, 
+    116, 12, 0, 0, 0, 0, 0, 0, 0, 104, 
+    97, 115, 95, 108, 111, 99, 97, 116, 105, 111, 
+    110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    18, 0, 0, 0, 0, 0, 0, 0, 43, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 95, 95, 99, 
-    108, 97, 115, 115, 95, 95, 66, 117, 105, 108, 
-    116, 105, 110, 73, 109, 112, 111, 114, 116, 101, 
-    114, 95, 95, 46, 55, 49, 53, 58, 48, 0, 
-    118, 0, 0, 0, 0, 0, 0, 0, 33, 0, 
-    0, 47, 0, 10, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 109, 111, 100, 117, 108, 101, 95, 
-    95, 30, 2, 0, 47, 2, 12, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 113, 117, 97, 108, 
-    110, 97, 109, 101, 95, 95, 30, 1, 1, 30, 
-    0, 2, 47, 0, 7, 0, 0, 0, 0, 0, 
-    0, 0, 95, 79, 82, 73, 71, 73, 78, 33, 
-    2, 1, 30, 0, 3, 36, 1, 0, 0, 0, 
-    0, 0, 47, 1, 11, 0, 0, 0, 0, 0, 
-    0, 0, 109, 111, 100, 117, 108, 101, 95, 114, 
-    101, 112, 114, 35, 4, 11, 0, 0, 0, 0, 
-    0, 0, 0, 109, 111, 100, 117, 108, 101, 95, 
-    114, 101, 112, 114, 74, 4, 10, 2, 1, 0, 
-    75, 1, 0, 47, 0, 11, 0, 0, 0, 0, 
-    0, 0, 0, 109, 111, 100, 117, 108, 101, 95, 
-    114, 101, 112, 114, 33, 2, 2, 30, 0, 4, 
-    30, 1, 4, 30, 3, 5, 74, 0, 74, 1, 
-    36, 4, 3, 2, 0, 0, 0, 75, 1, 0, 
-    75, 1, 0, 47, 4, 9, 0, 0, 0, 0, 
-    0, 0, 0, 102, 105, 110, 100, 95, 115, 112, 
-    101, 99, 35, 1, 9, 0, 0, 0, 0, 0, 
-    0, 0, 102, 105, 110, 100, 95, 115, 112, 101, 
-    99, 74, 1, 10, 2, 1, 0, 75, 1, 0, 
-    47, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 110, 100, 95, 115, 112, 101, 99, 33, 
-    1, 2, 30, 0, 4, 30, 2, 6, 74, 0, 
-    36, 3, 2, 1, 0, 0, 0, 75, 1, 0, 
-    47, 3, 11, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 110, 100, 95, 109, 111, 100, 117, 108, 
-    101, 35, 2, 11, 0, 0, 0, 0, 0, 0, 
-    0, 102, 105, 110, 100, 95, 109, 111, 100, 117, 
-    108, 101, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 47, 0, 11, 0, 0, 0, 0, 0, 0, 
-    0, 102, 105, 110, 100, 95, 109, 111, 100, 117, 
-    108, 101, 33, 1, 2, 30, 0, 7, 36, 2, 
-    0, 0, 0, 0, 0, 47, 2, 13, 0, 0, 
-    0, 0, 0, 0, 0, 99, 114, 101, 97, 116, 
-    101, 95, 109, 111, 100, 117, 108, 101, 35, 4, 
-    13, 0, 0, 0, 0, 0, 0, 0, 99, 114, 
-    101, 97, 116, 101, 95, 109, 111, 100, 117, 108, 
-    101, 74, 4, 10, 1, 1, 0, 75, 1, 0, 
-    47, 0, 13, 0, 0, 0, 0, 0, 0, 0, 
-    99, 114, 101, 97, 116, 101, 95, 109, 111, 100, 
-    117, 108, 101, 33, 1, 2, 30, 0, 8, 36, 
-    2, 0, 0, 0, 0, 0, 47, 2, 11, 0, 
-    0, 0, 0, 0, 0, 0, 101, 120, 101, 99, 
-    95, 109, 111, 100, 117, 108, 101, 35, 4, 11, 
-    0, 0, 0, 0, 0, 0, 0, 101, 120, 101, 
-    99, 95, 109, 111, 100, 117, 108, 101, 74, 4, 
-    10, 1, 1, 0, 75, 1, 0, 47, 0, 11, 
+    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 
+    0, 43, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
+    95, 95, 99, 108, 97, 115, 115, 95, 95, 66, 
+    117, 105, 108, 116, 105, 110, 73, 109, 112, 111, 
+    114, 116, 101, 114, 95, 95, 46, 55, 49, 53, 
+    58, 48, 0, 118, 0, 0, 0, 0, 0, 0, 
+    0, 33, 0, 0, 47, 0, 10, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 109, 111, 100, 117, 
+    108, 101, 95, 95, 30, 2, 0, 47, 2, 12, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 113, 
+    117, 97, 108, 110, 97, 109, 101, 95, 95, 30, 
+    1, 1, 30, 0, 2, 47, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 95, 79, 82, 73, 71, 
+    73, 78, 33, 2, 1, 30, 0, 3, 36, 1, 
+    0, 0, 0, 0, 0, 47, 1, 11, 0, 0, 
+    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
+    101, 95, 114, 101, 112, 114, 35, 4, 5, 74, 
+    4, 10, 2, 1, 0, 75, 1, 0, 47, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 109, 111, 
+    100, 117, 108, 101, 95, 114, 101, 112, 114, 33, 
+    2, 2, 30, 0, 4, 30, 1, 4, 30, 3, 
+    5, 74, 0, 74, 1, 36, 4, 3, 2, 0, 
+    0, 0, 75, 1, 0, 75, 1, 0, 47, 4, 
+    9, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
+    110, 100, 95, 115, 112, 101, 99, 35, 1, 6, 
+    74, 1, 10, 2, 1, 0, 75, 1, 0, 47, 
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
+    105, 110, 100, 95, 115, 112, 101, 99, 33, 1, 
+    2, 30, 0, 4, 30, 2, 6, 74, 0, 36, 
+    3, 2, 1, 0, 0, 0, 75, 1, 0, 47, 
+    3, 11, 0, 0, 0, 0, 0, 0, 0, 102, 
+    105, 110, 100, 95, 109, 111, 100, 117, 108, 101, 
+    35, 2, 7, 74, 2, 10, 1, 1, 0, 75, 
+    1, 0, 47, 0, 11, 0, 0, 0, 0, 0, 
+    0, 0, 102, 105, 110, 100, 95, 109, 111, 100, 
+    117, 108, 101, 33, 1, 2, 30, 0, 7, 36, 
+    2, 0, 0, 0, 0, 0, 47, 2, 13, 0, 
+    0, 0, 0, 0, 0, 0, 99, 114, 101, 97, 
+    116, 101, 95, 109, 111, 100, 117, 108, 101, 35, 
+    4, 8, 74, 4, 10, 1, 1, 0, 75, 1, 
+    0, 47, 0, 13, 0, 0, 0, 0, 0, 0, 
+    0, 99, 114, 101, 97, 116, 101, 95, 109, 111, 
+    100, 117, 108, 101, 33, 1, 2, 30, 0, 8, 
+    36, 2, 0, 0, 0, 0, 0, 47, 2, 11, 
     0, 0, 0, 0, 0, 0, 0, 101, 120, 101, 
-    99, 95, 109, 111, 100, 117, 108, 101, 33, 1, 
-    2, 33, 2, 3, 30, 0, 9, 36, 3, 0, 
-    0, 0, 0, 0, 47, 3, 8, 0, 0, 0, 
+    99, 95, 109, 111, 100, 117, 108, 101, 35, 4, 
+    9, 74, 4, 10, 1, 1, 0, 75, 1, 0, 
+    47, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
+    101, 120, 101, 99, 95, 109, 111, 100, 117, 108, 
+    101, 33, 1, 2, 33, 2, 3, 30, 0, 9, 
+    36, 3, 0, 0, 0, 0, 0, 47, 3, 8, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    95, 99, 111, 100, 101, 35, 5, 10, 74, 5, 
+    10, 2, 1, 0, 75, 1, 0, 74, 0, 74, 
+    0, 10, 1, 1, 0, 75, 1, 0, 39, 3, 
+    0, 75, 0, 0, 47, 3, 8, 0, 0, 0, 
     0, 0, 0, 0, 103, 101, 116, 95, 99, 111, 
-    100, 101, 35, 5, 8, 0, 0, 0, 0, 0, 
-    0, 0, 103, 101, 116, 95, 99, 111, 100, 101, 
-    74, 5, 10, 2, 1, 0, 75, 1, 0, 74, 
-    0, 74, 0, 10, 1, 1, 0, 75, 1, 0, 
-    39, 3, 0, 75, 0, 0, 47, 3, 8, 0, 
-    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
-    99, 111, 100, 101, 33, 1, 2, 33, 2, 3, 
-    30, 0, 10, 36, 3, 0, 0, 0, 0, 0, 
-    47, 3, 10, 0, 0, 0, 0, 0, 0, 0, 
-    103, 101, 116, 95, 115, 111, 117, 114, 99, 101, 
-    35, 5, 10, 0, 0, 0, 0, 0, 0, 0, 
-    103, 101, 116, 95, 115, 111, 117, 114, 99, 101, 
-    74, 5, 10, 2, 1, 0, 75, 1, 0, 74, 
-    0, 74, 0, 10, 1, 1, 0, 75, 1, 0, 
-    39, 3, 0, 75, 0, 0, 47, 3, 10, 0, 
-    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
-    115, 111, 117, 114, 99, 101, 33, 1, 2, 33, 
-    2, 3, 30, 0, 11, 36, 3, 0, 0, 0, 
+    100, 101, 33, 1, 2, 33, 2, 3, 30, 0, 
+    10, 36, 3, 0, 0, 0, 0, 0, 47, 3, 
+    10, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
+    116, 95, 115, 111, 117, 114, 99, 101, 35, 5, 
+    11, 74, 5, 10, 2, 1, 0, 75, 1, 0, 
+    74, 0, 74, 0, 10, 1, 1, 0, 75, 1, 
+    0, 39, 3, 0, 75, 0, 0, 47, 3, 10, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    95, 115, 111, 117, 114, 99, 101, 33, 1, 2, 
+    33, 2, 3, 30, 0, 11, 36, 3, 0, 0, 
+    0, 0, 0, 47, 3, 10, 0, 0, 0, 0, 
+    0, 0, 0, 105, 115, 95, 112, 97, 99, 107, 
+    97, 103, 101, 35, 5, 12, 74, 5, 10, 2, 
+    1, 0, 75, 1, 0, 74, 0, 74, 0, 10, 
+    1, 1, 0, 75, 1, 0, 39, 3, 0, 75, 
     0, 0, 47, 3, 10, 0, 0, 0, 0, 0, 
     0, 0, 105, 115, 95, 112, 97, 99, 107, 97, 
-    103, 101, 35, 5, 10, 0, 0, 0, 0, 0, 
-    0, 0, 105, 115, 95, 112, 97, 99, 107, 97, 
-    103, 101, 74, 5, 10, 2, 1, 0, 75, 1, 
-    0, 74, 0, 74, 0, 10, 1, 1, 0, 75, 
-    1, 0, 39, 3, 0, 75, 0, 0, 47, 3, 
-    10, 0, 0, 0, 0, 0, 0, 0, 105, 115, 
-    95, 112, 97, 99, 107, 97, 103, 101, 33, 1, 
-    2, 33, 2, 4, 74, 2, 10, 1, 1, 0, 
-    75, 1, 0, 47, 0, 11, 0, 0, 0, 0, 
-    0, 0, 0, 108, 111, 97, 100, 95, 109, 111, 
-    100, 117, 108, 101, 17, 0, 0, 0, 0, 29, 
-    0, 0, 41, 0, 1, 0, 0, 0, 0, 0, 
+    103, 101, 33, 1, 2, 33, 2, 4, 74, 2, 
+    10, 1, 1, 0, 75, 1, 0, 47, 0, 11, 
+    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
+    100, 95, 109, 111, 100, 117, 108, 101, 17, 0, 
+    0, 0, 0, 29, 0, 0, 41, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 99, 108, 97, 115, 
-    115, 95, 95, 12, 0, 0, 0, 0, 0, 0, 
-    0, 2, 15, 0, 0, 0, 0, 0, 0, 0, 
-    66, 117, 105, 108, 116, 105, 110, 73, 109, 112, 
-    111, 114, 116, 101, 114, 2, 144, 0, 0, 0, 
-    0, 0, 0, 0, 77, 101, 116, 97, 32, 112, 
-    97, 116, 104, 32, 105, 109, 112, 111, 114, 116, 
-    32, 102, 111, 114, 32, 98, 117, 105, 108, 116, 
-    45, 105, 110, 32, 109, 111, 100, 117, 108, 101, 
-    115, 46, 10, 10, 32, 32, 32, 32, 65, 108, 
-    108, 32, 109, 101, 116, 104, 111, 100, 115, 32, 
-    97, 114, 101, 32, 101, 105, 116, 104, 101, 114, 
-    32, 99, 108, 97, 115, 115, 32, 111, 114, 32, 
-    115, 116, 97, 116, 105, 99, 32, 109, 101, 116, 
-    104, 111, 100, 115, 32, 116, 111, 32, 97, 118, 
-    111, 105, 100, 32, 116, 104, 101, 32, 110, 101, 
-    101, 100, 32, 116, 111, 10, 32, 32, 32, 32, 
-    105, 110, 115, 116, 97, 110, 116, 105, 97, 116, 
-    101, 32, 116, 104, 101, 32, 99, 108, 97, 115, 
-    115, 46, 10, 10, 32, 32, 32, 32, 2, 8, 
-    0, 0, 0, 0, 0, 0, 0, 98, 117, 105, 
-    108, 116, 45, 105, 110, 2, 44, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 99, 108, 
+    97, 115, 115, 95, 95, 12, 0, 0, 0, 0, 
+    0, 0, 0, 2, 15, 0, 0, 0, 0, 0, 
+    0, 0, 66, 117, 105, 108, 116, 105, 110, 73, 
+    109, 112, 111, 114, 116, 101, 114, 2, 144, 0, 
+    0, 0, 0, 0, 0, 0, 77, 101, 116, 97, 
+    32, 112, 97, 116, 104, 32, 105, 109, 112, 111, 
+    114, 116, 32, 102, 111, 114, 32, 98, 117, 105, 
+    108, 116, 45, 105, 110, 32, 109, 111, 100, 117, 
+    108, 101, 115, 46, 10, 10, 32, 32, 32, 32, 
+    65, 108, 108, 32, 109, 101, 116, 104, 111, 100, 
+    115, 32, 97, 114, 101, 32, 101, 105, 116, 104, 
+    101, 114, 32, 99, 108, 97, 115, 115, 32, 111, 
+    114, 32, 115, 116, 97, 116, 105, 99, 32, 109, 
+    101, 116, 104, 111, 100, 115, 32, 116, 111, 32, 
+    97, 118, 111, 105, 100, 32, 116, 104, 101, 32, 
+    110, 101, 101, 100, 32, 116, 111, 10, 32, 32, 
+    32, 32, 105, 110, 115, 116, 97, 110, 116, 105, 
+    97, 116, 101, 32, 116, 104, 101, 32, 99, 108, 
+    97, 115, 115, 46, 10, 10, 32, 32, 32, 32, 
+    2, 8, 0, 0, 0, 0, 0, 0, 0, 98, 
+    117, 105, 108, 116, 45, 105, 110, 2, 44, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 66, 117, 105, 
+    108, 116, 105, 110, 73, 109, 112, 111, 114, 116, 
+    101, 114, 46, 109, 111, 100, 117, 108, 101, 95, 
+    114, 101, 112, 114, 46, 55, 50, 54, 58, 52, 
+    5, 2, 42, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 66, 117, 105, 108, 116, 105, 110, 73, 109, 
+    112, 111, 114, 116, 101, 114, 46, 102, 105, 110, 
+    100, 95, 115, 112, 101, 99, 46, 55, 51, 53, 
+    58, 52, 2, 44, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 66, 117, 105, 108, 116, 105, 110, 73, 
+    109, 112, 111, 114, 116, 101, 114, 46, 102, 105, 
+    110, 100, 95, 109, 111, 100, 117, 108, 101, 46, 
+    55, 52, 52, 58, 52, 2, 46, 0, 0, 0, 
     0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
     116, 114, 97, 112, 46, 66, 117, 105, 108, 116, 
     105, 110, 73, 109, 112, 111, 114, 116, 101, 114, 
-    46, 109, 111, 100, 117, 108, 101, 95, 114, 101, 
-    112, 114, 46, 55, 50, 54, 58, 52, 5, 2, 
-    42, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 66, 
-    117, 105, 108, 116, 105, 110, 73, 109, 112, 111, 
-    114, 116, 101, 114, 46, 102, 105, 110, 100, 95, 
-    115, 112, 101, 99, 46, 55, 51, 53, 58, 52, 
+    46, 99, 114, 101, 97, 116, 101, 95, 109, 111, 
+    100, 117, 108, 101, 46, 55, 53, 54, 58, 52, 
     2, 44, 0, 0, 0, 0, 0, 0, 0, 95, 
     98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
     66, 117, 105, 108, 116, 105, 110, 73, 109, 112, 
-    111, 114, 116, 101, 114, 46, 102, 105, 110, 100, 
-    95, 109, 111, 100, 117, 108, 101, 46, 55, 52, 
-    52, 58, 52, 2, 46, 0, 0, 0, 0, 0, 
+    111, 114, 116, 101, 114, 46, 101, 120, 101, 99, 
+    95, 109, 111, 100, 117, 108, 101, 46, 55, 54, 
+    52, 58, 52, 2, 41, 0, 0, 0, 0, 0, 
     0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
     97, 112, 46, 66, 117, 105, 108, 116, 105, 110, 
-    73, 109, 112, 111, 114, 116, 101, 114, 46, 99, 
-    114, 101, 97, 116, 101, 95, 109, 111, 100, 117, 
-    108, 101, 46, 55, 53, 54, 58, 52, 2, 44, 
+    73, 109, 112, 111, 114, 116, 101, 114, 46, 103, 
+    101, 116, 95, 99, 111, 100, 101, 46, 55, 54, 
+    57, 58, 52, 2, 43, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 46, 66, 117, 105, 108, 116, 105, 110, 
+    73, 109, 112, 111, 114, 116, 101, 114, 46, 103, 
+    101, 116, 95, 115, 111, 117, 114, 99, 101, 46, 
+    55, 55, 53, 58, 52, 2, 43, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 46, 66, 117, 105, 108, 116, 
+    105, 110, 73, 109, 112, 111, 114, 116, 101, 114, 
+    46, 105, 115, 95, 112, 97, 99, 107, 97, 103, 
+    101, 46, 55, 56, 49, 58, 52, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 
+    0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 99, 108, 97, 115, 
+    115, 95, 95, 66, 117, 105, 108, 116, 105, 110, 
+    73, 109, 112, 111, 114, 116, 101, 114, 95, 95, 
+    13, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 110, 97, 
+    109, 101, 95, 95, 12, 0, 0, 0, 0, 0, 
+    0, 0, 115, 116, 97, 116, 105, 99, 109, 101, 
+    116, 104, 111, 100, 11, 0, 0, 0, 0, 0, 
+    0, 0, 99, 108, 97, 115, 115, 109, 101, 116, 
+    104, 111, 100, 17, 0, 0, 0, 0, 0, 0, 
+    0, 95, 114, 101, 113, 117, 105, 114, 101, 115, 
+    95, 98, 117, 105, 108, 116, 105, 110, 17, 0, 
+    0, 0, 0, 0, 0, 0, 95, 108, 111, 97, 
+    100, 95, 109, 111, 100, 117, 108, 101, 95, 115, 
+    104, 105, 109, 11, 0, 0, 0, 0, 0, 0, 
+    0, 109, 111, 100, 117, 108, 101, 95, 114, 101, 
+    112, 114, 9, 0, 0, 0, 0, 0, 0, 0, 
+    102, 105, 110, 100, 95, 115, 112, 101, 99, 11, 
+    0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 
+    100, 95, 109, 111, 100, 117, 108, 101, 13, 0, 
+    0, 0, 0, 0, 0, 0, 99, 114, 101, 97, 
+    116, 101, 95, 109, 111, 100, 117, 108, 101, 11, 
+    0, 0, 0, 0, 0, 0, 0, 101, 120, 101, 
+    99, 95, 109, 111, 100, 117, 108, 101, 8, 0, 
+    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
+    99, 111, 100, 101, 10, 0, 0, 0, 0, 0, 
+    0, 0, 103, 101, 116, 95, 115, 111, 117, 114, 
+    99, 101, 10, 0, 0, 0, 0, 0, 0, 0, 
+    105, 115, 95, 112, 97, 99, 107, 97, 103, 101, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    44, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
+    95, 99, 108, 97, 115, 115, 95, 95, 95, 68, 
+    117, 109, 109, 121, 77, 111, 100, 117, 108, 101, 
+    76, 111, 99, 107, 95, 95, 46, 49, 50, 56, 
+    58, 48, 0, 20, 0, 0, 0, 0, 0, 0, 
+    0, 33, 0, 0, 47, 0, 10, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 109, 111, 100, 117, 
+    108, 101, 95, 95, 30, 2, 0, 47, 2, 12, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 113, 
+    117, 97, 108, 110, 97, 109, 101, 95, 95, 30, 
+    1, 1, 30, 0, 2, 36, 1, 0, 0, 0, 
+    0, 0, 47, 1, 8, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 105, 110, 105, 116, 95, 95, 
+    30, 0, 3, 36, 1, 0, 0, 0, 0, 0, 
+    47, 1, 7, 0, 0, 0, 0, 0, 0, 0, 
+    97, 99, 113, 117, 105, 114, 101, 30, 0, 4, 
+    36, 1, 0, 0, 0, 0, 0, 47, 1, 7, 
+    0, 0, 0, 0, 0, 0, 0, 114, 101, 108, 
+    101, 97, 115, 101, 30, 0, 5, 36, 1, 0, 
+    0, 0, 0, 0, 47, 1, 8, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 114, 101, 112, 114, 
+    95, 95, 17, 0, 0, 0, 0, 29, 0, 0, 
+    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 99, 108, 97, 115, 115, 95, 95, 6, 
+    0, 0, 0, 0, 0, 0, 0, 2, 16, 0, 
+    0, 0, 0, 0, 0, 0, 95, 68, 117, 109, 
+    109, 121, 77, 111, 100, 117, 108, 101, 76, 111, 
+    99, 107, 2, 86, 0, 0, 0, 0, 0, 0, 
+    0, 65, 32, 115, 105, 109, 112, 108, 101, 32, 
+    95, 77, 111, 100, 117, 108, 101, 76, 111, 99, 
+    107, 32, 101, 113, 117, 105, 118, 97, 108, 101, 
+    110, 116, 32, 102, 111, 114, 32, 80, 121, 116, 
+    104, 111, 110, 32, 98, 117, 105, 108, 100, 115, 
+    32, 119, 105, 116, 104, 111, 117, 116, 10, 32, 
+    32, 32, 32, 109, 117, 108, 116, 105, 45, 116, 
+    104, 114, 101, 97, 100, 105, 110, 103, 32, 115, 
+    117, 112, 112, 111, 114, 116, 46, 2, 42, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 95, 68, 117, 
+    109, 109, 121, 77, 111, 100, 117, 108, 101, 76, 
+    111, 99, 107, 46, 95, 95, 105, 110, 105, 116, 
+    95, 95, 46, 49, 51, 50, 58, 52, 2, 41, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 66, 117, 
-    105, 108, 116, 105, 110, 73, 109, 112, 111, 114, 
-    116, 101, 114, 46, 101, 120, 101, 99, 95, 109, 
-    111, 100, 117, 108, 101, 46, 55, 54, 52, 58, 
-    52, 2, 41, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 66, 117, 105, 108, 116, 105, 110, 73, 109, 
-    112, 111, 114, 116, 101, 114, 46, 103, 101, 116, 
-    95, 99, 111, 100, 101, 46, 55, 54, 57, 58, 
-    52, 2, 43, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 66, 117, 105, 108, 116, 105, 110, 73, 109, 
-    112, 111, 114, 116, 101, 114, 46, 103, 101, 116, 
-    95, 115, 111, 117, 114, 99, 101, 46, 55, 55, 
-    53, 58, 52, 2, 43, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 66, 117, 105, 108, 116, 105, 110, 
-    73, 109, 112, 111, 114, 116, 101, 114, 46, 105, 
-    115, 95, 112, 97, 99, 107, 97, 103, 101, 46, 
-    55, 56, 49, 58, 52, 0, 0, 0, 0, 0, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 68, 
+    117, 109, 109, 121, 77, 111, 100, 117, 108, 101, 
+    76, 111, 99, 107, 46, 97, 99, 113, 117, 105, 
+    114, 101, 46, 49, 51, 54, 58, 52, 2, 41, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 68, 
+    117, 109, 109, 121, 77, 111, 100, 117, 108, 101, 
+    76, 111, 99, 107, 46, 114, 101, 108, 101, 97, 
+    115, 101, 46, 49, 52, 48, 58, 52, 2, 42, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 68, 
+    117, 109, 109, 121, 77, 111, 100, 117, 108, 101, 
+    76, 111, 99, 107, 46, 95, 95, 114, 101, 112, 
+    114, 95, 95, 46, 49, 52, 53, 58, 52, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 
-    0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 99, 108, 97, 115, 115, 95, 
-    95, 66, 117, 105, 108, 116, 105, 110, 73, 109, 
-    112, 111, 114, 116, 101, 114, 95, 95, 5, 0, 
-    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 110, 97, 109, 101, 
-    95, 95, 12, 0, 0, 0, 0, 0, 0, 0, 
-    115, 116, 97, 116, 105, 99, 109, 101, 116, 104, 
-    111, 100, 11, 0, 0, 0, 0, 0, 0, 0, 
-    99, 108, 97, 115, 115, 109, 101, 116, 104, 111, 
-    100, 17, 0, 0, 0, 0, 0, 0, 0, 95, 
-    114, 101, 113, 117, 105, 114, 101, 115, 95, 98, 
-    117, 105, 108, 116, 105, 110, 17, 0, 0, 0, 
-    0, 0, 0, 0, 95, 108, 111, 97, 100, 95, 
-    109, 111, 100, 117, 108, 101, 95, 115, 104, 105, 
-    109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 99, 108, 
+    97, 115, 115, 95, 95, 95, 68, 117, 109, 109, 
+    121, 77, 111, 100, 117, 108, 101, 76, 111, 99, 
+    107, 95, 95, 1, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 110, 97, 109, 101, 95, 95, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 44, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    95, 95, 99, 108, 97, 115, 115, 95, 95, 95, 
-    68, 117, 109, 109, 121, 77, 111, 100, 117, 108, 
-    101, 76, 111, 99, 107, 95, 95, 46, 49, 50, 
-    56, 58, 48, 0, 20, 0, 0, 0, 0, 0, 
-    0, 0, 33, 0, 0, 47, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 109, 111, 100, 
-    117, 108, 101, 95, 95, 30, 2, 0, 47, 2, 
-    12, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    113, 117, 97, 108, 110, 97, 109, 101, 95, 95, 
-    30, 1, 1, 30, 0, 2, 36, 1, 0, 0, 
-    0, 0, 0, 47, 1, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 105, 110, 105, 116, 95, 
-    95, 30, 0, 3, 36, 1, 0, 0, 0, 0, 
-    0, 47, 1, 7, 0, 0, 0, 0, 0, 0, 
-    0, 97, 99, 113, 117, 105, 114, 101, 30, 0, 
-    4, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
-    7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 
-    108, 101, 97, 115, 101, 30, 0, 5, 36, 1, 
-    0, 0, 0, 0, 0, 47, 1, 8, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 114, 101, 112, 
-    114, 95, 95, 17, 0, 0, 0, 0, 29, 0, 
-    0, 41, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 99, 108, 97, 115, 115, 
-    95, 95, 6, 0, 0, 0, 0, 0, 0, 0, 
-    2, 16, 0, 0, 0, 0, 0, 0, 0, 95, 
-    68, 117, 109, 109, 121, 77, 111, 100, 117, 108, 
-    101, 76, 111, 99, 107, 2, 86, 0, 0, 0, 
-    0, 0, 0, 0, 65, 32, 115, 105, 109, 112, 
-    108, 101, 32, 95, 77, 111, 100, 117, 108, 101, 
-    76, 111, 99, 107, 32, 101, 113, 117, 105, 118, 
-    97, 108, 101, 110, 116, 32, 102, 111, 114, 32, 
-    80, 121, 116, 104, 111, 110, 32, 98, 117, 105, 
-    108, 100, 115, 32, 119, 105, 116, 104, 111, 117, 
-    116, 10, 32, 32, 32, 32, 109, 117, 108, 116, 
-    105, 45, 116, 104, 114, 101, 97, 100, 105, 110, 
-    103, 32, 115, 117, 112, 112, 111, 114, 116, 46, 
-    2, 42, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    95, 68, 117, 109, 109, 121, 77, 111, 100, 117, 
-    108, 101, 76, 111, 99, 107, 46, 95, 95, 105, 
-    110, 105, 116, 95, 95, 46, 49, 51, 50, 58, 
-    52, 2, 41, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 68, 117, 109, 109, 121, 77, 111, 100, 
-    117, 108, 101, 76, 111, 99, 107, 46, 97, 99, 
-    113, 117, 105, 114, 101, 46, 49, 51, 54, 58, 
-    52, 2, 41, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 68, 117, 109, 109, 121, 77, 111, 100, 
-    117, 108, 101, 76, 111, 99, 107, 46, 114, 101, 
-    108, 101, 97, 115, 101, 46, 49, 52, 48, 58, 
-    52, 2, 42, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 68, 117, 109, 109, 121, 77, 111, 100, 
-    117, 108, 101, 76, 111, 99, 107, 46, 95, 95, 
-    114, 101, 112, 114, 95, 95, 46, 49, 52, 53, 
-    58, 52, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 
+    0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 46, 95, 95, 99, 108, 
+    97, 115, 115, 95, 95, 95, 68, 101, 97, 100, 
+    108, 111, 99, 107, 69, 114, 114, 111, 114, 95, 
+    95, 46, 52, 55, 58, 48, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 33, 0, 0, 47, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    109, 111, 100, 117, 108, 101, 95, 95, 30, 2, 
+    0, 47, 2, 12, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 113, 117, 97, 108, 110, 97, 109, 
+    101, 95, 95, 17, 0, 0, 0, 0, 29, 0, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 99, 108, 97, 115, 115, 95, 95, 
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 14, 
+    0, 0, 0, 0, 0, 0, 0, 95, 68, 101, 
+    97, 100, 108, 111, 99, 107, 69, 114, 114, 111, 
+    114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 27, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 99, 108, 97, 115, 115, 95, 95, 95, 68, 
-    117, 109, 109, 121, 77, 111, 100, 117, 108, 101, 
-    76, 111, 99, 107, 95, 95, 1, 0, 0, 0, 
-    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 110, 97, 109, 101, 95, 95, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 
+    25, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    99, 108, 97, 115, 115, 95, 95, 95, 68, 101, 
+    97, 100, 108, 111, 99, 107, 69, 114, 114, 111, 
+    114, 95, 95, 1, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 110, 97, 109, 101, 95, 95, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 46, 95, 105, 110, 115, 
+    116, 97, 108, 108, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 95, 105, 109, 112, 111, 114, 116, 
+    101, 114, 115, 46, 49, 49, 56, 51, 58, 48, 
+    0, 16, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 30, 1, 1, 4, 0, 0, 14, 2, 
+    4, 0, 1, 45, 0, 2, 32, 0, 0, 46, 
+    0, 0, 32, 2, 0, 34, 1, 2, 3, 1, 
+    32, 33, 0, 1, 27, 2, 0, 5, 33, 3, 
+    2, 1, 4, 2, 3, 38, 1, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    41, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    95, 99, 108, 97, 115, 115, 95, 95, 95, 68, 
-    101, 97, 100, 108, 111, 99, 107, 69, 114, 114, 
-    111, 114, 95, 95, 46, 52, 55, 58, 48, 0, 
-    7, 0, 0, 0, 0, 0, 0, 0, 33, 0, 
-    0, 47, 0, 10, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 109, 111, 100, 117, 108, 101, 95, 
-    95, 30, 2, 0, 47, 2, 12, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 113, 117, 97, 108, 
-    110, 97, 109, 101, 95, 95, 17, 0, 0, 0, 
-    0, 29, 0, 0, 41, 0, 1, 0, 0, 0, 
+    0, 0, 0, 30, 2, 2, 41, 2, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 99, 108, 
-    97, 115, 115, 95, 95, 1, 0, 0, 0, 0, 
-    0, 0, 0, 2, 14, 0, 0, 0, 0, 0, 
-    0, 0, 95, 68, 101, 97, 100, 108, 111, 99, 
-    107, 69, 114, 114, 111, 114, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 2, 57, 
+    0, 0, 0, 0, 0, 0, 0, 73, 110, 115, 
+    116, 97, 108, 108, 32, 105, 109, 112, 111, 114, 
+    116, 101, 114, 115, 32, 116, 104, 97, 116, 32, 
+    114, 101, 113, 117, 105, 114, 101, 32, 101, 120, 
+    116, 101, 114, 110, 97, 108, 32, 102, 105, 108, 
+    101, 115, 121, 115, 116, 101, 109, 32, 97, 99, 
+    99, 101, 115, 115, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 99, 108, 97, 115, 115, 
-    95, 95, 95, 68, 101, 97, 100, 108, 111, 99, 
-    107, 69, 114, 114, 111, 114, 95, 95, 1, 0, 
-    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 110, 97, 109, 101, 
-    95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 105, 110, 115, 116, 97, 108, 108, 95, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 
+    0, 95, 105, 110, 115, 116, 97, 108, 108, 95, 
     101, 120, 116, 101, 114, 110, 97, 108, 95, 105, 
-    109, 112, 111, 114, 116, 101, 114, 115, 46, 49, 
-    49, 56, 51, 58, 48, 0, 18, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 30, 1, 1, 
-    4, 0, 0, 14, 2, 4, 0, 1, 45, 0, 
-    2, 32, 0, 0, 46, 0, 0, 32, 2, 0, 
-    34, 1, 2, 3, 33, 0, 1, 27, 2, 0, 
-    5, 33, 3, 2, 1, 4, 2, 3, 74, 4, 
-    10, 1, 1, 0, 75, 1, 0, 30, 2, 2, 
-    41, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    109, 112, 111, 114, 116, 101, 114, 115, 6, 0, 
+    0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 3, 0, 0, 0, 0, 0, 0, 
+    0, 115, 121, 115, 8, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 110, 97, 109, 101, 95, 95, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 105, 
+    110, 115, 116, 97, 108, 108, 26, 0, 0, 0, 
+    0, 0, 0, 0, 95, 102, 114, 111, 122, 101, 
+    110, 95, 105, 109, 112, 111, 114, 116, 108, 105, 
+    98, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    7, 0, 0, 0, 0, 0, 0, 0, 109, 111, 
+    100, 117, 108, 101, 115, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 26, 0, 0, 0, 0, 0, 0, 0, 95, 
+    102, 114, 111, 122, 101, 110, 95, 105, 109, 112, 
+    111, 114, 116, 108, 105, 98, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 33, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 26, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 105, 
+    110, 115, 116, 97, 108, 108, 46, 49, 49, 55, 
+    53, 58, 48, 0, 21, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 33, 1, 0, 32, 2, 
+    0, 32, 3, 1, 74, 2, 74, 3, 10, 1, 
+    2, 0, 75, 1, 0, 75, 1, 0, 33, 4, 
+    1, 27, 0, 4, 5, 34, 1, 0, 4, 1, 
+    32, 33, 2, 2, 38, 1, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 2, 57, 0, 0, 0, 0, 
-    0, 0, 0, 73, 110, 115, 116, 97, 108, 108, 
-    32, 105, 109, 112, 111, 114, 116, 101, 114, 115, 
-    32, 116, 104, 97, 116, 32, 114, 101, 113, 117, 
-    105, 114, 101, 32, 101, 120, 116, 101, 114, 110, 
-    97, 108, 32, 102, 105, 108, 101, 115, 121, 115, 
-    116, 101, 109, 32, 97, 99, 99, 101, 115, 115, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 33, 3, 1, 27, 0, 3, 5, 34, 
+    1, 0, 4, 1, 32, 33, 2, 3, 38, 1, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 30, 3, 1, 41, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 2, 48, 0, 0, 0, 0, 0, 0, 0, 
+    73, 110, 115, 116, 97, 108, 108, 32, 105, 109, 
+    112, 111, 114, 116, 101, 114, 115, 32, 102, 111, 
+    114, 32, 98, 117, 105, 108, 116, 105, 110, 32, 
+    97, 110, 100, 32, 102, 114, 111, 122, 101, 110, 
+    32, 109, 111, 100, 117, 108, 101, 115, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 27, 
-    0, 0, 0, 0, 0, 0, 0, 95, 105, 110, 
-    115, 116, 97, 108, 108, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 95, 105, 109, 112, 111, 114, 
-    116, 101, 114, 115, 6, 0, 0, 0, 0, 0, 
-    0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 3, 
-    0, 0, 0, 0, 0, 0, 0, 115, 121, 115, 
-    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    110, 97, 109, 101, 95, 95, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 105, 110, 115, 116, 97, 
-    108, 108, 26, 0, 0, 0, 0, 0, 0, 0, 
-    95, 102, 114, 111, 122, 101, 110, 95, 105, 109, 
-    112, 111, 114, 116, 108, 105, 98, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 7, 0, 0, 0, 
-    0, 0, 0, 0, 109, 111, 100, 117, 108, 101, 
-    115, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 
-    0, 0, 0, 0, 0, 95, 102, 114, 111, 122, 
-    101, 110, 95, 105, 109, 112, 111, 114, 116, 108, 
-    105, 98, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
-    0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 105, 110, 115, 116, 97, 
-    108, 108, 46, 49, 49, 55, 53, 58, 48, 0, 
-    25, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
-    0, 33, 1, 0, 32, 2, 0, 32, 3, 1, 
-    74, 2, 74, 3, 10, 1, 2, 0, 75, 1, 
-    0, 75, 1, 0, 33, 4, 1, 27, 0, 4, 
-    5, 34, 1, 0, 4, 33, 2, 2, 74, 2, 
-    10, 1, 1, 0, 75, 1, 0, 33, 3, 1, 
-    27, 0, 3, 5, 34, 1, 0, 4, 33, 2, 
-    3, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
-    30, 3, 1, 41, 3, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 48, 0, 
-    0, 0, 0, 0, 0, 0, 73, 110, 115, 116, 
-    97, 108, 108, 32, 105, 109, 112, 111, 114, 116, 
-    101, 114, 115, 32, 102, 111, 114, 32, 98, 117, 
-    105, 108, 116, 105, 110, 32, 97, 110, 100, 32, 
-    102, 114, 111, 122, 101, 110, 32, 109, 111, 100, 
-    117, 108, 101, 115, 5, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    6, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
+    0, 0, 0, 0, 0, 0, 95, 105, 110, 115, 
+    116, 97, 108, 108, 6, 0, 0, 0, 0, 0, 
+    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
+    95, 115, 101, 116, 117, 112, 3, 0, 0, 0, 
+    0, 0, 0, 0, 115, 121, 115, 15, 0, 0, 
+    0, 0, 0, 0, 0, 66, 117, 105, 108, 116, 
+    105, 110, 73, 109, 112, 111, 114, 116, 101, 114, 
+    14, 0, 0, 0, 0, 0, 0, 0, 70, 114, 
+    111, 122, 101, 110, 73, 109, 112, 111, 114, 116, 
+    101, 114, 6, 0, 0, 0, 0, 0, 0, 0, 
+    97, 112, 112, 101, 110, 100, 9, 0, 0, 0, 
+    0, 0, 0, 0, 109, 101, 116, 97, 95, 112, 
+    97, 116, 104, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 115, 121, 115, 
+    95, 109, 111, 100, 117, 108, 101, 11, 0, 0, 
+    0, 0, 0, 0, 0, 95, 105, 109, 112, 95, 
+    109, 111, 100, 117, 108, 101, 33, 0, 0, 0, 
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 
+    24, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
+    115, 101, 116, 117, 112, 46, 49, 49, 52, 48, 
+    58, 48, 0, 147, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 32, 1, 1, 46, 0, 1, 
+    32, 2, 0, 46, 1, 2, 33, 1, 2, 33, 
+    2, 1, 74, 2, 10, 1, 1, 0, 75, 1, 
+    0, 45, 2, 0, 33, 1, 1, 27, 2, 1, 
+    13, 34, 3, 2, 11, 1, 32, 38, 3, 32, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 13, 1, 0, 17, 0, 0, 
+    0, 0, 9, 0, 1, 67, 0, 0, 0, 0, 
+    0, 0, 0, 50, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 3, 0, 45, 4, 2, 45, 3, 
+    3, 17, 0, 0, 0, 0, 33, 2, 3, 32, 
+    3, 3, 32, 4, 2, 74, 0, 74, 3, 74, 
+    4, 10, 2, 2, 0, 75, 1, 230, 75, 1, 
+    68, 39, 5, 0, 75, 0, 0, 79, 6, 5, 
+    19, 5, 48, 0, 0, 0, 32, 2, 4, 33, 
+    3, 1, 27, 4, 3, 14, 6, 5, 2, 4, 
+    8, 79, 3, 5, 22, 5, 15, 0, 0, 0, 
+    33, 2, 0, 34, 3, 2, 12, 1, 32, 32, 
+    4, 4, 74, 0, 38, 3, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
-    0, 0, 95, 105, 110, 115, 116, 97, 108, 108, 
-    6, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
-    0, 0, 0, 0, 0, 0, 95, 115, 101, 116, 
-    117, 112, 3, 0, 0, 0, 0, 0, 0, 0, 
-    115, 121, 115, 15, 0, 0, 0, 0, 0, 0, 
-    0, 66, 117, 105, 108, 116, 105, 110, 73, 109, 
-    112, 111, 114, 116, 101, 114, 14, 0, 0, 0, 
-    0, 0, 0, 0, 70, 114, 111, 122, 101, 110, 
-    73, 109, 112, 111, 114, 116, 101, 114, 6, 0, 
-    0, 0, 0, 0, 0, 0, 97, 112, 112, 101, 
-    110, 100, 9, 0, 0, 0, 0, 0, 0, 0, 
-    109, 101, 116, 97, 95, 112, 97, 116, 104, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
-    0, 0, 0, 115, 121, 115, 95, 109, 111, 100, 
-    117, 108, 101, 11, 0, 0, 0, 0, 0, 0, 
-    0, 95, 105, 109, 112, 95, 109, 111, 100, 117, 
-    108, 101, 32, 0, 0, 0, 0, 0, 0, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 31, 0, 
-    0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 46, 95, 115, 101, 116, 117, 
-    112, 46, 49, 49, 52, 48, 58, 48, 0, 149, 
-    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
-    32, 1, 1, 46, 0, 1, 32, 2, 0, 46, 
-    1, 2, 33, 1, 2, 33, 2, 1, 74, 2, 
-    10, 1, 1, 0, 75, 1, 0, 45, 2, 0, 
-    33, 1, 1, 27, 2, 1, 13, 34, 3, 2, 
-    11, 10, 3, 0, 0, 13, 1, 0, 17, 0, 
-    0, 0, 0, 9, 0, 1, 69, 0, 0, 0, 
-    0, 0, 0, 0, 50, 2, 0, 0, 0, 0, 
-    0, 0, 0, 2, 3, 0, 45, 4, 2, 45, 
-    3, 3, 17, 0, 0, 0, 0, 33, 2, 3, 
-    32, 3, 3, 32, 4, 2, 74, 0, 74, 3, 
-    74, 4, 10, 2, 2, 0, 75, 1, 230, 75, 
-    1, 68, 39, 5, 0, 75, 0, 0, 79, 6, 
-    5, 19, 5, 50, 0, 0, 0, 32, 2, 4, 
-    33, 3, 1, 27, 4, 3, 14, 6, 5, 2, 
-    4, 8, 79, 3, 5, 22, 5, 17, 0, 0, 
-    0, 33, 2, 0, 34, 3, 2, 12, 32, 4, 
-    4, 74, 0, 74, 4, 10, 3, 1, 0, 75, 
-    1, 196, 39, 2, 0, 75, 0, 0, 79, 5, 
+    0, 0, 39, 2, 0, 75, 0, 0, 79, 5, 
     2, 22, 2, 2, 0, 0, 0, 17, 0, 0, 
     0, 0, 17, 32, 0, 0, 0, 33, 2, 5, 
     45, 5, 2, 17, 0, 0, 0, 0, 17, 3, 
@@ -1376,7 +1390,7 @@ std::vector<uint8_t> _bootstrap
     3, 74, 4, 10, 2, 2, 0, 75, 1, 188, 
     75, 1, 189, 39, 5, 0, 75, 0, 0, 17, 
     0, 0, 0, 0, 17, 0, 0, 0, 0, 9, 
-    0, 1, 0, 0, 0, 0, 187, 255, 255, 255, 
+    0, 1, 0, 0, 0, 0, 189, 255, 255, 255, 
     17, 0, 0, 0, 0, 33, 0, 1, 27, 1, 
     0, 13, 33, 2, 8, 1, 0, 1, 2, 45, 
     7, 0, 30, 1, 1, 30, 0, 2, 30, 2, 
@@ -1399,398 +1413,416 @@ std::vector<uint8_t> _bootstrap
     0, 0, 17, 0, 0, 0, 0, 9, 0, 4, 
     0, 0, 0, 0, 216, 255, 255, 255, 17, 0, 
     0, 0, 0, 30, 0, 4, 41, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
-    2, 250, 0, 0, 0, 0, 0, 0, 0, 83, 
-    101, 116, 117, 112, 32, 105, 109, 112, 111, 114, 
-    116, 108, 105, 98, 32, 98, 121, 32, 105, 109, 
-    112, 111, 114, 116, 105, 110, 103, 32, 110, 101, 
-    101, 100, 101, 100, 32, 98, 117, 105, 108, 116, 
-    45, 105, 110, 32, 109, 111, 100, 117, 108, 101, 
-    115, 32, 97, 110, 100, 32, 105, 110, 106, 101, 
-    99, 116, 105, 110, 103, 32, 116, 104, 101, 109, 
-    10, 32, 32, 32, 32, 105, 110, 116, 111, 32, 
-    116, 104, 101, 32, 103, 108, 111, 98, 97, 108, 
-    32, 110, 97, 109, 101, 115, 112, 97, 99, 101, 
-    46, 10, 10, 32, 32, 32, 32, 65, 115, 32, 
-    115, 121, 115, 32, 105, 115, 32, 110, 101, 101, 
-    100, 101, 100, 32, 102, 111, 114, 32, 115, 121, 
-    115, 46, 109, 111, 100, 117, 108, 101, 115, 32, 
-    97, 99, 99, 101, 115, 115, 32, 97, 110, 100, 
-    32, 95, 105, 109, 112, 32, 105, 115, 32, 110, 
-    101, 101, 100, 101, 100, 32, 116, 111, 32, 108, 
-    111, 97, 100, 32, 98, 117, 105, 108, 116, 45, 
-    105, 110, 10, 32, 32, 32, 32, 109, 111, 100, 
-    117, 108, 101, 115, 44, 32, 116, 104, 111, 115, 
-    101, 32, 116, 119, 111, 32, 109, 111, 100, 117, 
-    108, 101, 115, 32, 109, 117, 115, 116, 32, 98, 
-    101, 32, 101, 120, 112, 108, 105, 99, 105, 116, 
-    108, 121, 32, 112, 97, 115, 115, 101, 100, 32, 
-    105, 110, 46, 10, 10, 32, 32, 32, 32, 2, 
-    7, 0, 0, 0, 0, 0, 0, 0, 95, 116, 
-    104, 114, 101, 97, 100, 2, 9, 0, 0, 0, 
-    0, 0, 0, 0, 95, 119, 97, 114, 110, 105, 
-    110, 103, 115, 2, 8, 0, 0, 0, 0, 0, 
-    0, 0, 95, 119, 101, 97, 107, 114, 101, 102, 
-    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 2, 250, 
+    0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 
+    117, 112, 32, 105, 109, 112, 111, 114, 116, 108, 
+    105, 98, 32, 98, 121, 32, 105, 109, 112, 111, 
+    114, 116, 105, 110, 103, 32, 110, 101, 101, 100, 
+    101, 100, 32, 98, 117, 105, 108, 116, 45, 105, 
+    110, 32, 109, 111, 100, 117, 108, 101, 115, 32, 
+    97, 110, 100, 32, 105, 110, 106, 101, 99, 116, 
+    105, 110, 103, 32, 116, 104, 101, 109, 10, 32, 
+    32, 32, 32, 105, 110, 116, 111, 32, 116, 104, 
+    101, 32, 103, 108, 111, 98, 97, 108, 32, 110, 
+    97, 109, 101, 115, 112, 97, 99, 101, 46, 10, 
+    10, 32, 32, 32, 32, 65, 115, 32, 115, 121, 
+    115, 32, 105, 115, 32, 110, 101, 101, 100, 101, 
+    100, 32, 102, 111, 114, 32, 115, 121, 115, 46, 
+    109, 111, 100, 117, 108, 101, 115, 32, 97, 99, 
+    99, 101, 115, 115, 32, 97, 110, 100, 32, 95, 
+    105, 109, 112, 32, 105, 115, 32, 110, 101, 101, 
+    100, 101, 100, 32, 116, 111, 32, 108, 111, 97, 
+    100, 32, 98, 117, 105, 108, 116, 45, 105, 110, 
+    10, 32, 32, 32, 32, 109, 111, 100, 117, 108, 
+    101, 115, 44, 32, 116, 104, 111, 115, 101, 32, 
+    116, 119, 111, 32, 109, 111, 100, 117, 108, 101, 
+    115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 
+    101, 120, 112, 108, 105, 99, 105, 116, 108, 121, 
+    32, 112, 97, 115, 115, 101, 100, 32, 105, 110, 
+    46, 10, 10, 32, 32, 32, 32, 2, 7, 0, 
+    0, 0, 0, 0, 0, 0, 95, 116, 104, 114, 
+    101, 97, 100, 2, 9, 0, 0, 0, 0, 0, 
+    0, 0, 95, 119, 97, 114, 110, 105, 110, 103, 
+    115, 2, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 119, 101, 97, 107, 114, 101, 102, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 95, 115, 
-    101, 116, 117, 112, 15, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    95, 105, 109, 112, 3, 0, 0, 0, 0, 0, 
-    0, 0, 115, 121, 115, 4, 0, 0, 0, 0, 
-    0, 0, 0, 116, 121, 112, 101, 10, 0, 0, 
-    0, 0, 0, 0, 0, 105, 115, 105, 110, 115, 
-    116, 97, 110, 99, 101, 15, 0, 0, 0, 0, 
-    0, 0, 0, 66, 117, 105, 108, 116, 105, 110, 
-    73, 109, 112, 111, 114, 116, 101, 114, 14, 0, 
-    0, 0, 0, 0, 0, 0, 70, 114, 111, 122, 
-    101, 110, 73, 109, 112, 111, 114, 116, 101, 114, 
-    17, 0, 0, 0, 0, 0, 0, 0, 95, 115, 
-    112, 101, 99, 95, 102, 114, 111, 109, 95, 109, 
-    111, 100, 117, 108, 101, 18, 0, 0, 0, 0, 
-    0, 0, 0, 95, 105, 110, 105, 116, 95, 109, 
-    111, 100, 117, 108, 101, 95, 97, 116, 116, 114, 
-    115, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 110, 97, 109, 101, 95, 95, 18, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 117, 105, 108, 
-    116, 105, 110, 95, 102, 114, 111, 109, 95, 110, 
-    97, 109, 101, 7, 0, 0, 0, 0, 0, 0, 
-    0, 115, 101, 116, 97, 116, 116, 114, 5, 0, 
-    0, 0, 0, 0, 0, 0, 105, 116, 101, 109, 
-    115, 9, 0, 0, 0, 0, 0, 0, 0, 105, 
-    115, 95, 102, 114, 111, 122, 101, 110, 7, 0, 
-    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
-    108, 101, 115, 20, 0, 0, 0, 0, 0, 0, 
-    0, 98, 117, 105, 108, 116, 105, 110, 95, 109, 
-    111, 100, 117, 108, 101, 95, 110, 97, 109, 101, 
-    115, 0, 0, 0, 0, 0, 0, 0, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    31, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
+    0, 0, 0, 0, 0, 0, 95, 115, 101, 116, 
+    117, 112, 15, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 95, 105, 
+    109, 112, 3, 0, 0, 0, 0, 0, 0, 0, 
+    115, 121, 115, 4, 0, 0, 0, 0, 0, 0, 
+    0, 116, 121, 112, 101, 10, 0, 0, 0, 0, 
+    0, 0, 0, 105, 115, 105, 110, 115, 116, 97, 
+    110, 99, 101, 15, 0, 0, 0, 0, 0, 0, 
+    0, 66, 117, 105, 108, 116, 105, 110, 73, 109, 
+    112, 111, 114, 116, 101, 114, 14, 0, 0, 0, 
+    0, 0, 0, 0, 70, 114, 111, 122, 101, 110, 
+    73, 109, 112, 111, 114, 116, 101, 114, 17, 0, 
+    0, 0, 0, 0, 0, 0, 95, 115, 112, 101, 
+    99, 95, 102, 114, 111, 109, 95, 109, 111, 100, 
+    117, 108, 101, 18, 0, 0, 0, 0, 0, 0, 
+    0, 95, 105, 110, 105, 116, 95, 109, 111, 100, 
+    117, 108, 101, 95, 97, 116, 116, 114, 115, 8, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 110, 
+    97, 109, 101, 95, 95, 18, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 117, 105, 108, 116, 105, 
+    110, 95, 102, 114, 111, 109, 95, 110, 97, 109, 
+    101, 7, 0, 0, 0, 0, 0, 0, 0, 115, 
+    101, 116, 97, 116, 116, 114, 5, 0, 0, 0, 
+    0, 0, 0, 0, 105, 116, 101, 109, 115, 9, 
+    0, 0, 0, 0, 0, 0, 0, 105, 115, 95, 
+    102, 114, 111, 122, 101, 110, 7, 0, 0, 0, 
+    0, 0, 0, 0, 109, 111, 100, 117, 108, 101, 
+    115, 20, 0, 0, 0, 0, 0, 0, 0, 98, 
+    117, 105, 108, 116, 105, 110, 95, 109, 111, 100, 
+    117, 108, 101, 95, 110, 97, 109, 101, 115, 0, 
     0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 115, 121, 115, 95, 109, 
-    111, 100, 117, 108, 101, 11, 0, 0, 0, 0, 
-    0, 0, 0, 95, 105, 109, 112, 95, 109, 111, 
-    100, 117, 108, 101, 11, 0, 0, 0, 0, 0, 
-    0, 0, 109, 111, 100, 117, 108, 101, 95, 116, 
-    121, 112, 101, 6, 0, 0, 0, 0, 0, 0, 
-    0, 109, 111, 100, 117, 108, 101, 4, 0, 0, 
-    0, 0, 0, 0, 0, 110, 97, 109, 101, 6, 
-    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
-    100, 101, 114, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 112, 101, 99, 11, 0, 0, 0, 0, 
-    0, 0, 0, 115, 101, 108, 102, 95, 109, 111, 
-    100, 117, 108, 101, 12, 0, 0, 0, 0, 0, 
-    0, 0, 98, 117, 105, 108, 116, 105, 110, 95, 
-    110, 97, 109, 101, 14, 0, 0, 0, 0, 0, 
-    0, 0, 98, 117, 105, 108, 116, 105, 110, 95, 
-    109, 111, 100, 117, 108, 101, 32, 0, 0, 0, 
-    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 
-    28, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    95, 105, 109, 112, 111, 114, 116, 95, 95, 46, 
-    49, 48, 57, 54, 58, 48, 0, 141, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 32, 1, 
-    4, 30, 0, 1, 6, 2, 1, 0, 0, 79, 
-    3, 2, 22, 2, 30, 0, 0, 0, 32, 0, 
-    1, 30, 1, 2, 6, 2, 0, 1, 7, 79, 
-    3, 2, 22, 2, 3, 0, 0, 0, 30, 0, 
-    2, 2, 1, 0, 17, 2, 0, 0, 0, 32, 
-    1, 1, 17, 0, 0, 0, 0, 45, 7, 1, 
-    33, 2, 1, 32, 1, 7, 74, 1, 10, 2, 
-    1, 0, 75, 1, 104, 45, 8, 0, 33, 1, 
-    0, 32, 2, 0, 32, 3, 8, 32, 4, 4, 
-    74, 2, 74, 3, 74, 4, 10, 1, 3, 0, 
-    75, 1, 53, 75, 1, 0, 75, 1, 217, 45, 
-    5, 0, 17, 7, 0, 0, 0, 33, 1, 0, 
-    32, 2, 0, 74, 2, 10, 1, 1, 0, 75, 
-    1, 178, 45, 5, 0, 17, 0, 0, 0, 0, 
-    32, 0, 3, 49, 1, 0, 3, 79, 2, 1, 
-    22, 1, 24, 0, 0, 0, 33, 2, 4, 32, 
-    1, 5, 30, 3, 3, 74, 1, 74, 3, 10, 
-    2, 2, 0, 75, 1, 188, 75, 1, 189, 79, 
-    4, 0, 22, 0, 2, 0, 0, 0, 32, 1, 
-    5, 41, 1, 33, 2, 5, 32, 1, 5, 32, 
-    3, 3, 33, 4, 0, 74, 1, 74, 3, 74, 
-    4, 10, 2, 3, 0, 75, 1, 188, 75, 1, 
-    189, 75, 1, 25, 41, 0, 32, 1, 4, 30, 
+    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 115, 121, 115, 95, 109, 111, 100, 
+    117, 108, 101, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 105, 109, 112, 95, 109, 111, 100, 117, 
+    108, 101, 11, 0, 0, 0, 0, 0, 0, 0, 
+    109, 111, 100, 117, 108, 101, 95, 116, 121, 112, 
+    101, 6, 0, 0, 0, 0, 0, 0, 0, 109, 
+    111, 100, 117, 108, 101, 4, 0, 0, 0, 0, 
+    0, 0, 0, 110, 97, 109, 101, 6, 0, 0, 
+    0, 0, 0, 0, 0, 108, 111, 97, 100, 101, 
+    114, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+    112, 101, 99, 11, 0, 0, 0, 0, 0, 0, 
+    0, 115, 101, 108, 102, 95, 109, 111, 100, 117, 
+    108, 101, 12, 0, 0, 0, 0, 0, 0, 0, 
+    98, 117, 105, 108, 116, 105, 110, 95, 110, 97, 
+    109, 101, 14, 0, 0, 0, 0, 0, 0, 0, 
+    98, 117, 105, 108, 116, 105, 110, 95, 109, 111, 
+    100, 117, 108, 101, 33, 0, 0, 0, 0, 0, 
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
+    28, 0, 0, 0, 0, 0, 0, 0, 28, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 95, 95, 105, 
+    109, 112, 111, 114, 116, 95, 95, 46, 49, 48, 
+    57, 54, 58, 48, 0, 135, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 32, 1, 4, 30, 
     0, 1, 6, 2, 1, 0, 0, 79, 3, 2, 
-    22, 2, 52, 0, 0, 0, 32, 0, 0, 49, 
-    1, 0, 3, 79, 2, 1, 22, 1, 46, 0, 
-    0, 0, 33, 2, 2, 32, 1, 0, 74, 1, 
-    10, 2, 1, 0, 75, 1, 84, 33, 3, 2, 
-    32, 1, 0, 34, 2, 1, 6, 30, 4, 4, 
-    74, 0, 74, 4, 10, 2, 1, 0, 75, 1, 
-    188, 39, 1, 0, 75, 0, 0, 30, 5, 1, 
-    1, 2, 1, 5, 74, 0, 74, 2, 10, 3, 
-    1, 0, 75, 1, 0, 39, 4, 0, 75, 0, 
-    0, 0, 1, 0, 4, 1, 45, 6, 1, 33, 
-    0, 3, 27, 1, 0, 7, 32, 2, 5, 27, 
-    0, 2, 8, 30, 3, 2, 33, 2, 2, 32, 
-    4, 5, 27, 5, 4, 8, 74, 0, 74, 5, 
-    10, 2, 1, 0, 75, 1, 189, 39, 6, 0, 
-    75, 0, 0, 32, 4, 6, 0, 2, 6, 4, 
-    1, 30, 5, 2, 62, 4, 3, 3, 2, 5, 
-    1, 6, 0, 4, 1, 2, 1, 6, 41, 2, 
-    32, 0, 5, 41, 0, 33, 1, 0, 32, 0, 
-    0, 34, 2, 0, 6, 30, 3, 4, 74, 3, 
-    10, 2, 1, 0, 75, 1, 189, 30, 4, 1, 
-    1, 2, 0, 4, 74, 2, 10, 1, 1, 0, 
-    75, 1, 188, 41, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
-    0, 0, 0, 0, 0, 0, 0, 2, 215, 1, 
-    0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 
-    114, 116, 32, 97, 32, 109, 111, 100, 117, 108, 
-    101, 46, 10, 10, 32, 32, 32, 32, 84, 104, 
-    101, 32, 39, 103, 108, 111, 98, 97, 108, 115, 
-    39, 32, 97, 114, 103, 117, 109, 101, 110, 116, 
-    32, 105, 115, 32, 117, 115, 101, 100, 32, 116, 
-    111, 32, 105, 110, 102, 101, 114, 32, 119, 104, 
-    101, 114, 101, 32, 116, 104, 101, 32, 105, 109, 
-    112, 111, 114, 116, 32, 105, 115, 32, 111, 99, 
-    99, 117, 114, 114, 105, 110, 103, 32, 102, 114, 
-    111, 109, 10, 32, 32, 32, 32, 116, 111, 32, 
-    104, 97, 110, 100, 108, 101, 32, 114, 101, 108, 
-    97, 116, 105, 118, 101, 32, 105, 109, 112, 111, 
-    114, 116, 115, 46, 32, 84, 104, 101, 32, 39, 
-    108, 111, 99, 97, 108, 115, 39, 32, 97, 114, 
-    103, 117, 109, 101, 110, 116, 32, 105, 115, 32, 
-    105, 103, 110, 111, 114, 101, 100, 46, 32, 84, 
-    104, 101, 10, 32, 32, 32, 32, 39, 102, 114, 
-    111, 109, 108, 105, 115, 116, 39, 32, 97, 114, 
-    103, 117, 109, 101, 110, 116, 32, 115, 112, 101, 
-    99, 105, 102, 105, 101, 115, 32, 119, 104, 97, 
-    116, 32, 115, 104, 111, 117, 108, 100, 32, 101, 
-    120, 105, 115, 116, 32, 97, 115, 32, 97, 116, 
-    116, 114, 105, 98, 117, 116, 101, 115, 32, 111, 
-    110, 32, 116, 104, 101, 32, 109, 111, 100, 117, 
-    108, 101, 10, 32, 32, 32, 32, 98, 101, 105, 
-    110, 103, 32, 105, 109, 112, 111, 114, 116, 101, 
-    100, 32, 40, 101, 46, 103, 46, 32, 96, 96, 
-    102, 114, 111, 109, 32, 109, 111, 100, 117, 108, 
-    101, 32, 105, 109, 112, 111, 114, 116, 32, 60, 
-    102, 114, 111, 109, 108, 105, 115, 116, 62, 96, 
-    96, 41, 46, 32, 32, 84, 104, 101, 32, 39, 
-    108, 101, 118, 101, 108, 39, 10, 32, 32, 32, 
-    32, 97, 114, 103, 117, 109, 101, 110, 116, 32, 
-    114, 101, 112, 114, 101, 115, 101, 110, 116, 115, 
-    32, 116, 104, 101, 32, 112, 97, 99, 107, 97, 
-    103, 101, 32, 108, 111, 99, 97, 116, 105, 111, 
-    110, 32, 116, 111, 32, 105, 109, 112, 111, 114, 
-    116, 32, 102, 114, 111, 109, 32, 105, 110, 32, 
-    97, 32, 114, 101, 108, 97, 116, 105, 118, 101, 
-    10, 32, 32, 32, 32, 105, 109, 112, 111, 114, 
-    116, 32, 40, 101, 46, 103, 46, 32, 96, 96, 
-    102, 114, 111, 109, 32, 46, 46, 112, 107, 103, 
-    32, 105, 109, 112, 111, 114, 116, 32, 109, 111, 
-    100, 96, 96, 32, 119, 111, 117, 108, 100, 32, 
-    104, 97, 118, 101, 32, 97, 32, 39, 108, 101, 
-    118, 101, 108, 39, 32, 111, 102, 32, 50, 41, 
-    46, 10, 10, 32, 32, 32, 32, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 5, 2, 8, 0, 
+    22, 2, 30, 0, 0, 0, 32, 0, 1, 30, 
+    1, 2, 6, 2, 0, 1, 7, 79, 3, 2, 
+    22, 2, 3, 0, 0, 0, 30, 0, 2, 2, 
+    1, 0, 17, 2, 0, 0, 0, 32, 1, 1, 
+    17, 0, 0, 0, 0, 45, 7, 1, 33, 2, 
+    1, 32, 1, 7, 74, 1, 10, 2, 1, 0, 
+    75, 1, 104, 45, 8, 0, 33, 1, 0, 32, 
+    2, 0, 32, 3, 8, 32, 4, 4, 74, 2, 
+    74, 3, 74, 4, 10, 1, 3, 0, 75, 1, 
+    53, 75, 1, 0, 75, 1, 217, 45, 5, 0, 
+    17, 7, 0, 0, 0, 33, 1, 0, 32, 2, 
+    0, 74, 2, 10, 1, 1, 0, 75, 1, 178, 
+    45, 5, 0, 17, 0, 0, 0, 0, 32, 0, 
+    3, 49, 1, 0, 3, 79, 2, 1, 22, 1, 
+    24, 0, 0, 0, 33, 2, 4, 32, 1, 5, 
+    30, 3, 3, 74, 1, 74, 3, 10, 2, 2, 
+    0, 75, 1, 188, 75, 1, 189, 79, 4, 0, 
+    22, 0, 2, 0, 0, 0, 32, 1, 5, 41, 
+    1, 33, 2, 5, 32, 1, 5, 32, 3, 3, 
+    33, 4, 0, 74, 1, 74, 3, 74, 4, 10, 
+    2, 3, 0, 75, 1, 188, 75, 1, 189, 75, 
+    1, 25, 41, 0, 32, 1, 4, 30, 0, 1, 
+    6, 2, 1, 0, 0, 79, 3, 2, 22, 2, 
+    48, 0, 0, 0, 32, 0, 0, 49, 1, 0, 
+    3, 79, 2, 1, 22, 1, 42, 0, 0, 0, 
+    33, 2, 2, 32, 1, 0, 74, 1, 10, 2, 
+    1, 0, 75, 1, 84, 33, 3, 2, 32, 1, 
+    0, 34, 2, 1, 6, 1, 32, 30, 4, 4, 
+    74, 0, 38, 2, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    39, 1, 0, 75, 0, 0, 30, 5, 1, 1, 
+    2, 1, 5, 74, 0, 74, 2, 10, 3, 1, 
+    0, 75, 1, 0, 39, 4, 0, 75, 0, 0, 
+    0, 1, 0, 4, 1, 45, 6, 1, 33, 0, 
+    3, 27, 1, 0, 7, 32, 2, 5, 27, 0, 
+    2, 8, 30, 3, 2, 33, 2, 2, 32, 4, 
+    5, 27, 5, 4, 8, 74, 0, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 39, 6, 0, 75, 0, 
+    0, 32, 4, 6, 0, 2, 6, 4, 1, 30, 
+    5, 2, 62, 4, 3, 3, 2, 5, 1, 6, 
+    0, 4, 1, 2, 1, 6, 41, 2, 32, 0, 
+    5, 41, 0, 33, 1, 0, 32, 0, 0, 34, 
+    2, 0, 6, 1, 32, 30, 3, 4, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 30, 4, 1, 1, 
+    2, 0, 4, 74, 2, 10, 1, 1, 0, 75, 
+    1, 188, 41, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 2, 215, 1, 0, 0, 0, 
+    0, 0, 0, 73, 109, 112, 111, 114, 116, 32, 
+    97, 32, 109, 111, 100, 117, 108, 101, 46, 10, 
+    10, 32, 32, 32, 32, 84, 104, 101, 32, 39, 
+    103, 108, 111, 98, 97, 108, 115, 39, 32, 97, 
+    114, 103, 117, 109, 101, 110, 116, 32, 105, 115, 
+    32, 117, 115, 101, 100, 32, 116, 111, 32, 105, 
+    110, 102, 101, 114, 32, 119, 104, 101, 114, 101, 
+    32, 116, 104, 101, 32, 105, 109, 112, 111, 114, 
+    116, 32, 105, 115, 32, 111, 99, 99, 117, 114, 
+    114, 105, 110, 103, 32, 102, 114, 111, 109, 10, 
+    32, 32, 32, 32, 116, 111, 32, 104, 97, 110, 
+    100, 108, 101, 32, 114, 101, 108, 97, 116, 105, 
+    118, 101, 32, 105, 109, 112, 111, 114, 116, 115, 
+    46, 32, 84, 104, 101, 32, 39, 108, 111, 99, 
+    97, 108, 115, 39, 32, 97, 114, 103, 117, 109, 
+    101, 110, 116, 32, 105, 115, 32, 105, 103, 110, 
+    111, 114, 101, 100, 46, 32, 84, 104, 101, 10, 
+    32, 32, 32, 32, 39, 102, 114, 111, 109, 108, 
+    105, 115, 116, 39, 32, 97, 114, 103, 117, 109, 
+    101, 110, 116, 32, 115, 112, 101, 99, 105, 102, 
+    105, 101, 115, 32, 119, 104, 97, 116, 32, 115, 
+    104, 111, 117, 108, 100, 32, 101, 120, 105, 115, 
+    116, 32, 97, 115, 32, 97, 116, 116, 114, 105, 
+    98, 117, 116, 101, 115, 32, 111, 110, 32, 116, 
+    104, 101, 32, 109, 111, 100, 117, 108, 101, 10, 
+    32, 32, 32, 32, 98, 101, 105, 110, 103, 32, 
+    105, 109, 112, 111, 114, 116, 101, 100, 32, 40, 
+    101, 46, 103, 46, 32, 96, 96, 102, 114, 111, 
+    109, 32, 109, 111, 100, 117, 108, 101, 32, 105, 
+    109, 112, 111, 114, 116, 32, 60, 102, 114, 111, 
+    109, 108, 105, 115, 116, 62, 96, 96, 41, 46, 
+    32, 32, 84, 104, 101, 32, 39, 108, 101, 118, 
+    101, 108, 39, 10, 32, 32, 32, 32, 97, 114, 
+    103, 117, 109, 101, 110, 116, 32, 114, 101, 112, 
+    114, 101, 115, 101, 110, 116, 115, 32, 116, 104, 
+    101, 32, 112, 97, 99, 107, 97, 103, 101, 32, 
+    108, 111, 99, 97, 116, 105, 111, 110, 32, 116, 
+    111, 32, 105, 109, 112, 111, 114, 116, 32, 102, 
+    114, 111, 109, 32, 105, 110, 32, 97, 32, 114, 
+    101, 108, 97, 116, 105, 118, 101, 10, 32, 32, 
+    32, 32, 105, 109, 112, 111, 114, 116, 32, 40, 
+    101, 46, 103, 46, 32, 96, 96, 102, 114, 111, 
+    109, 32, 46, 46, 112, 107, 103, 32, 105, 109, 
+    112, 111, 114, 116, 32, 109, 111, 100, 96, 96, 
+    32, 119, 111, 117, 108, 100, 32, 104, 97, 118, 
+    101, 32, 97, 32, 39, 108, 101, 118, 101, 108, 
+    39, 32, 111, 102, 32, 50, 41, 46, 10, 10, 
+    32, 32, 32, 32, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 5, 2, 8, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 112, 97, 116, 104, 95, 
+    95, 2, 1, 0, 0, 0, 0, 0, 0, 0, 
+    46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    105, 109, 112, 111, 114, 116, 95, 95, 9, 0, 
+    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
+    0, 0, 0, 0, 95, 103, 99, 100, 95, 105, 
+    109, 112, 111, 114, 116, 17, 0, 0, 0, 0, 
+    0, 0, 0, 95, 99, 97, 108, 99, 95, 95, 
+    95, 112, 97, 99, 107, 97, 103, 101, 95, 95, 
+    3, 0, 0, 0, 0, 0, 0, 0, 108, 101, 
+    110, 3, 0, 0, 0, 0, 0, 0, 0, 115, 
+    121, 115, 7, 0, 0, 0, 0, 0, 0, 0, 
+    104, 97, 115, 97, 116, 116, 114, 16, 0, 0, 
+    0, 0, 0, 0, 0, 95, 104, 97, 110, 100, 
+    108, 101, 95, 102, 114, 111, 109, 108, 105, 115, 
+    116, 9, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 114, 116, 105, 116, 105, 111, 110, 7, 0, 
+    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
+    108, 101, 115, 8, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 110, 97, 109, 101, 95, 95, 0, 
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 110, 97, 109, 101, 7, 0, 0, 
+    0, 0, 0, 0, 0, 103, 108, 111, 98, 97, 
+    108, 115, 6, 0, 0, 0, 0, 0, 0, 0, 
+    108, 111, 99, 97, 108, 115, 8, 0, 0, 0, 
+    0, 0, 0, 0, 102, 114, 111, 109, 108, 105, 
+    115, 116, 5, 0, 0, 0, 0, 0, 0, 0, 
+    108, 101, 118, 101, 108, 6, 0, 0, 0, 0, 
+    0, 0, 0, 109, 111, 100, 117, 108, 101, 7, 
+    0, 0, 0, 0, 0, 0, 0, 99, 117, 116, 
+    95, 111, 102, 102, 8, 0, 0, 0, 0, 0, 
+    0, 0, 103, 108, 111, 98, 97, 108, 115, 95, 
+    7, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    99, 107, 97, 103, 101, 33, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 35, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 99, 
+    97, 108, 99, 95, 95, 95, 112, 97, 99, 107, 
+    97, 103, 101, 95, 95, 46, 49, 48, 54, 57, 
+    58, 48, 0, 90, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 32, 1, 0, 34, 2, 1, 
+    2, 1, 32, 30, 3, 1, 38, 2, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 45, 1, 0, 32, 2, 0, 
+    34, 1, 2, 2, 1, 32, 30, 3, 2, 38, 
+    1, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 45, 2, 0, 
+    32, 1, 1, 30, 0, 3, 6, 2, 1, 0, 
+    7, 79, 3, 2, 22, 2, 35, 0, 0, 0, 
+    32, 0, 2, 30, 1, 3, 6, 2, 0, 1, 
+    7, 79, 3, 2, 22, 2, 27, 0, 0, 0, 
+    33, 0, 0, 34, 1, 0, 3, 0, 0, 30, 
+    2, 4, 33, 3, 1, 30, 4, 5, 12, 1, 
+    2, 0, 0, 0, 0, 0, 0, 0, 2, 3, 
+    1, 0, 0, 0, 0, 0, 0, 0, 4, 1, 
+    0, 0, 0, 0, 0, 0, 0, 5, 32, 5, 
+    0, 30, 0, 6, 1, 1, 5, 0, 45, 1, 
+    1, 30, 0, 7, 32, 1, 0, 6, 2, 0, 
+    1, 9, 79, 3, 2, 19, 2, 8, 0, 0, 
+    0, 32, 0, 1, 34, 1, 0, 4, 1, 32, 
+    30, 2, 8, 38, 1, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 30, 3, 9, 1, 1, 0, 3, 45, 1, 
+    1, 17, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 17, 0, 0, 0, 0, 32, 0, 1, 41, 
+    0, 32, 1, 2, 27, 0, 1, 6, 41, 0, 
+    32, 1, 2, 30, 0, 3, 6, 2, 1, 0, 
+    7, 79, 3, 2, 19, 2, 5, 0, 0, 0, 
+    32, 0, 1, 32, 1, 2, 27, 3, 1, 6, 
+    6, 2, 0, 3, 1, 17, 0, 0, 0, 0, 
+    79, 0, 2, 19, 2, 25, 0, 0, 0, 33, 
+    0, 0, 34, 1, 0, 3, 0, 0, 30, 2, 
+    10, 32, 0, 1, 73, 3, 0, 1, 30, 4, 
+    11, 32, 0, 2, 27, 5, 0, 6, 73, 6, 
+    5, 1, 30, 0, 12, 74, 2, 74, 3, 74, 
+    4, 74, 6, 74, 0, 72, 5, 5, 75, 1, 
+    0, 75, 1, 18, 75, 1, 189, 75, 1, 0, 
+    75, 1, 248, 33, 7, 1, 30, 2, 5, 12, 
+    1, 2, 0, 0, 0, 0, 0, 0, 0, 5, 
+    7, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    1, 0, 0, 0, 0, 0, 0, 0, 5, 17, 
+    0, 0, 0, 0, 32, 0, 1, 41, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 2, 
+    167, 0, 0, 0, 0, 0, 0, 0, 67, 97, 
+    108, 99, 117, 108, 97, 116, 101, 32, 119, 104, 
+    97, 116, 32, 95, 95, 112, 97, 99, 107, 97, 
+    103, 101, 95, 95, 32, 115, 104, 111, 117, 108, 
+    100, 32, 98, 101, 46, 10, 10, 32, 32, 32, 
+    32, 95, 95, 112, 97, 99, 107, 97, 103, 101, 
+    95, 95, 32, 105, 115, 32, 110, 111, 116, 32, 
+    103, 117, 97, 114, 97, 110, 116, 101, 101, 100, 
+    32, 116, 111, 32, 98, 101, 32, 100, 101, 102, 
+    105, 110, 101, 100, 32, 111, 114, 32, 99, 111, 
+    117, 108, 100, 32, 98, 101, 32, 115, 101, 116, 
+    32, 116, 111, 32, 78, 111, 110, 101, 10, 32, 
+    32, 32, 32, 116, 111, 32, 114, 101, 112, 114, 
+    101, 115, 101, 110, 116, 32, 116, 104, 97, 116, 
+    32, 105, 116, 115, 32, 112, 114, 111, 112, 101, 
+    114, 32, 118, 97, 108, 117, 101, 32, 105, 115, 
+    32, 117, 110, 107, 110, 111, 119, 110, 46, 10, 
+    10, 32, 32, 32, 32, 2, 11, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 112, 97, 99, 107, 
+    97, 103, 101, 95, 95, 2, 8, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 115, 112, 101, 99, 
+    95, 95, 5, 2, 89, 0, 0, 0, 0, 0, 
+    0, 0, 99, 97, 110, 39, 116, 32, 114, 101, 
+    115, 111, 108, 118, 101, 32, 112, 97, 99, 107, 
+    97, 103, 101, 32, 102, 114, 111, 109, 32, 95, 
+    95, 115, 112, 101, 99, 95, 95, 32, 111, 114, 
+    32, 95, 95, 112, 97, 99, 107, 97, 103, 101, 
+    95, 95, 44, 32, 102, 97, 108, 108, 105, 110, 
+    103, 32, 98, 97, 99, 107, 32, 111, 110, 32, 
+    95, 95, 110, 97, 109, 101, 95, 95, 32, 97, 
+    110, 100, 32, 95, 95, 112, 97, 116, 104, 95, 
+    95, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    2, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 110, 97, 109, 101, 95, 95, 2, 8, 0, 
     0, 0, 0, 0, 0, 0, 95, 95, 112, 97, 
     116, 104, 95, 95, 2, 1, 0, 0, 0, 0, 
     0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 
-    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 105, 109, 112, 111, 114, 116, 95, 
-    95, 9, 0, 0, 0, 0, 0, 0, 0, 11, 
-    0, 0, 0, 0, 0, 0, 0, 95, 103, 99, 
-    100, 95, 105, 109, 112, 111, 114, 116, 17, 0, 
-    0, 0, 0, 0, 0, 0, 95, 99, 97, 108, 
-    99, 95, 95, 95, 112, 97, 99, 107, 97, 103, 
-    101, 95, 95, 3, 0, 0, 0, 0, 0, 0, 
-    0, 108, 101, 110, 3, 0, 0, 0, 0, 0, 
-    0, 0, 115, 121, 115, 7, 0, 0, 0, 0, 
-    0, 0, 0, 104, 97, 115, 97, 116, 116, 114, 
-    16, 0, 0, 0, 0, 0, 0, 0, 95, 104, 
-    97, 110, 100, 108, 101, 95, 102, 114, 111, 109, 
-    108, 105, 115, 116, 9, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 114, 116, 105, 116, 105, 111, 
-    110, 7, 0, 0, 0, 0, 0, 0, 0, 109, 
-    111, 100, 117, 108, 101, 115, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 110, 97, 109, 101, 
-    95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 
-    9, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 
-    7, 0, 0, 0, 0, 0, 0, 0, 103, 108, 
-    111, 98, 97, 108, 115, 6, 0, 0, 0, 0, 
-    0, 0, 0, 108, 111, 99, 97, 108, 115, 8, 
-    0, 0, 0, 0, 0, 0, 0, 102, 114, 111, 
-    109, 108, 105, 115, 116, 5, 0, 0, 0, 0, 
-    0, 0, 0, 108, 101, 118, 101, 108, 6, 0, 
-    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
-    108, 101, 7, 0, 0, 0, 0, 0, 0, 0, 
-    99, 117, 116, 95, 111, 102, 102, 8, 0, 0, 
-    0, 0, 0, 0, 0, 103, 108, 111, 98, 97, 
-    108, 115, 95, 7, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 99, 107, 97, 103, 101, 32, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 
-    0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 99, 97, 108, 99, 95, 95, 95, 112, 
-    97, 99, 107, 97, 103, 101, 95, 95, 46, 49, 
-    48, 54, 57, 58, 48, 0, 96, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 32, 1, 0, 
-    34, 2, 1, 2, 30, 3, 1, 74, 3, 10, 
-    2, 1, 0, 75, 1, 0, 45, 1, 0, 32, 
-    2, 0, 34, 1, 2, 2, 30, 3, 2, 74, 
-    3, 10, 1, 1, 0, 75, 1, 0, 45, 2, 
-    0, 32, 1, 1, 30, 0, 3, 6, 2, 1, 
-    0, 7, 79, 3, 2, 22, 2, 37, 0, 0, 
-    0, 32, 0, 2, 30, 1, 3, 6, 2, 0, 
-    1, 7, 79, 3, 2, 22, 2, 29, 0, 0, 
-    0, 33, 0, 0, 34, 1, 0, 3, 30, 2, 
-    4, 33, 3, 1, 30, 4, 5, 12, 1, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 3, 1, 
-    0, 0, 0, 0, 0, 0, 0, 4, 1, 0, 
-    0, 0, 0, 0, 0, 0, 5, 32, 5, 0, 
-    30, 0, 6, 1, 1, 5, 0, 45, 1, 1, 
-    30, 0, 7, 32, 1, 0, 6, 2, 0, 1, 
-    9, 79, 3, 2, 19, 2, 10, 0, 0, 0, 
-    32, 0, 1, 34, 1, 0, 4, 30, 2, 8, 
-    74, 2, 10, 1, 1, 0, 75, 1, 189, 30, 
-    3, 9, 1, 1, 0, 3, 45, 1, 1, 17, 
-    0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 
-    0, 0, 0, 0, 32, 0, 1, 41, 0, 32, 
-    1, 2, 27, 0, 1, 6, 41, 0, 32, 1, 
-    2, 30, 0, 3, 6, 2, 1, 0, 7, 79, 
-    3, 2, 19, 2, 5, 0, 0, 0, 32, 0, 
-    1, 32, 1, 2, 27, 3, 1, 6, 6, 2, 
-    0, 3, 1, 17, 0, 0, 0, 0, 79, 0, 
-    2, 19, 2, 25, 0, 0, 0, 33, 0, 0, 
-    34, 1, 0, 3, 30, 2, 10, 32, 0, 1, 
-    73, 3, 0, 1, 30, 4, 11, 32, 0, 2, 
-    27, 5, 0, 6, 73, 6, 5, 1, 30, 0, 
-    12, 74, 2, 74, 3, 74, 4, 74, 6, 74, 
-    0, 72, 5, 5, 75, 1, 0, 75, 1, 18, 
-    75, 1, 189, 75, 1, 0, 75, 1, 248, 33, 
-    7, 1, 30, 2, 5, 12, 1, 2, 0, 0, 
-    0, 0, 0, 0, 0, 5, 7, 1, 0, 0, 
-    0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 
-    0, 0, 0, 0, 5, 17, 0, 0, 0, 0, 
-    32, 0, 1, 41, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 
-    0, 0, 0, 0, 0, 0, 0, 2, 167, 0, 
-    0, 0, 0, 0, 0, 0, 67, 97, 108, 99, 
-    117, 108, 97, 116, 101, 32, 119, 104, 97, 116, 
-    32, 95, 95, 112, 97, 99, 107, 97, 103, 101, 
-    95, 95, 32, 115, 104, 111, 117, 108, 100, 32, 
-    98, 101, 46, 10, 10, 32, 32, 32, 32, 95, 
-    95, 112, 97, 99, 107, 97, 103, 101, 95, 95, 
-    32, 105, 115, 32, 110, 111, 116, 32, 103, 117, 
-    97, 114, 97, 110, 116, 101, 101, 100, 32, 116, 
-    111, 32, 98, 101, 32, 100, 101, 102, 105, 110, 
-    101, 100, 32, 111, 114, 32, 99, 111, 117, 108, 
-    100, 32, 98, 101, 32, 115, 101, 116, 32, 116, 
-    111, 32, 78, 111, 110, 101, 10, 32, 32, 32, 
-    32, 116, 111, 32, 114, 101, 112, 114, 101, 115, 
-    101, 110, 116, 32, 116, 104, 97, 116, 32, 105, 
-    116, 115, 32, 112, 114, 111, 112, 101, 114, 32, 
-    118, 97, 108, 117, 101, 32, 105, 115, 32, 117, 
-    110, 107, 110, 111, 119, 110, 46, 10, 10, 32, 
-    32, 32, 32, 2, 11, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 32, 0, 0, 0, 0, 0, 
     0, 0, 95, 95, 112, 97, 99, 107, 97, 103, 
-    101, 95, 95, 2, 8, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 115, 112, 101, 99, 95, 95, 
-    5, 2, 89, 0, 0, 0, 0, 0, 0, 0, 
-    99, 97, 110, 39, 116, 32, 114, 101, 115, 111, 
-    108, 118, 101, 32, 112, 97, 99, 107, 97, 103, 
-    101, 32, 102, 114, 111, 109, 32, 95, 95, 115, 
-    112, 101, 99, 95, 95, 32, 111, 114, 32, 95, 
-    95, 112, 97, 99, 107, 97, 103, 101, 95, 95, 
-    44, 32, 102, 97, 108, 108, 105, 110, 103, 32, 
-    98, 97, 99, 107, 32, 111, 110, 32, 95, 95, 
-    110, 97, 109, 101, 95, 95, 32, 97, 110, 100, 
-    32, 95, 95, 112, 97, 116, 104, 95, 95, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 2, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 110, 
-    97, 109, 101, 95, 95, 2, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 112, 97, 116, 104, 
-    95, 95, 2, 1, 0, 0, 0, 0, 0, 0, 
-    0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 32, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 112, 97, 99, 107, 97, 103, 101, 95, 
-    95, 32, 33, 61, 32, 95, 95, 115, 112, 101, 
-    99, 95, 95, 46, 112, 97, 114, 101, 110, 116, 
-    32, 40, 2, 4, 0, 0, 0, 0, 0, 0, 
-    0, 32, 33, 61, 32, 2, 1, 0, 0, 0, 
-    0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 
+    101, 95, 95, 32, 33, 61, 32, 95, 95, 115, 
+    112, 101, 99, 95, 95, 46, 112, 97, 114, 101, 
+    110, 116, 32, 40, 2, 4, 0, 0, 0, 0, 
+    0, 0, 0, 32, 33, 61, 32, 2, 1, 0, 
+    0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
-    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
-    0, 0, 95, 99, 97, 108, 99, 95, 95, 95, 
-    112, 97, 99, 107, 97, 103, 101, 95, 95, 7, 
-    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
-    0, 0, 0, 0, 0, 95, 119, 97, 114, 110, 
-    105, 110, 103, 115, 13, 0, 0, 0, 0, 0, 
-    0, 0, 73, 109, 112, 111, 114, 116, 87, 97, 
-    114, 110, 105, 110, 103, 3, 0, 0, 0, 0, 
-    0, 0, 0, 103, 101, 116, 4, 0, 0, 0, 
-    0, 0, 0, 0, 119, 97, 114, 110, 10, 0, 
-    0, 0, 0, 0, 0, 0, 114, 112, 97, 114, 
-    116, 105, 116, 105, 111, 110, 10, 0, 0, 0, 
-    0, 0, 0, 0, 115, 116, 97, 99, 107, 108, 
-    101, 118, 101, 108, 6, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 114, 101, 110, 116, 0, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
-    0, 0, 103, 108, 111, 98, 97, 108, 115, 7, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 99, 
-    107, 97, 103, 101, 4, 0, 0, 0, 0, 0, 
-    0, 0, 115, 112, 101, 99, 32, 0, 0, 0, 
-    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
-    0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 
-    34, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    104, 97, 110, 100, 108, 101, 95, 102, 114, 111, 
-    109, 108, 105, 115, 116, 46, 49, 48, 51, 50, 
-    58, 48, 0, 169, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 32, 1, 1, 13, 0, 1, 
-    17, 0, 0, 0, 0, 9, 1, 0, 124, 0, 
-    0, 0, 0, 0, 0, 0, 45, 4, 1, 17, 
-    0, 0, 0, 0, 33, 2, 0, 32, 3, 4, 
-    33, 4, 1, 74, 0, 74, 3, 74, 4, 10, 
-    2, 2, 0, 75, 1, 0, 75, 1, 0, 39, 
-    5, 0, 75, 0, 0, 49, 6, 5, 3, 79, 
-    2, 6, 22, 6, 109, 0, 0, 0, 32, 2, 
-    4, 30, 3, 1, 6, 4, 2, 3, 0, 79, 
-    5, 4, 22, 4, 76, 0, 0, 0, 33, 2, 
-    4, 32, 3, 0, 32, 4, 4, 74, 0, 74, 
-    3, 74, 4, 10, 2, 2, 0, 75, 1, 80, 
-    75, 1, 45, 39, 5, 0, 75, 0, 0, 49, 
-    6, 5, 3, 79, 2, 6, 19, 6, 61, 0, 
-    0, 0, 30, 2, 2, 34, 3, 2, 11, 32, 
-    4, 0, 27, 2, 4, 13, 32, 5, 4, 74, 
-    0, 74, 2, 74, 5, 10, 3, 2, 0, 75, 
-    1, 201, 75, 1, 0, 39, 4, 0, 75, 0, 
-    0, 45, 6, 4, 42, 1, 0, 0, 0, 17, 
-    31, 0, 0, 0, 33, 2, 7, 46, 8, 2, 
-    21, 2, 27, 0, 0, 0, 33, 3, 8, 27, 
-    2, 3, 14, 32, 4, 6, 6, 3, 2, 4, 
-    0, 79, 5, 3, 19, 3, 16, 0, 0, 0, 
-    33, 2, 9, 27, 4, 2, 15, 34, 5, 4, 
-    12, 32, 2, 6, 33, 4, 10, 74, 0, 74, 
-    2, 74, 4, 10, 5, 2, 0, 75, 1, 189, 
-    75, 1, 0, 39, 6, 0, 75, 0, 0, 30, 
-    7, 3, 6, 3, 6, 7, 7, 17, 0, 0, 
-    0, 0, 79, 2, 3, 22, 3, 1, 0, 0, 
-    0, 52, 17, 0, 0, 0, 0, 17, 42, 0, 
-    0, 0, 52, 33, 2, 6, 32, 3, 2, 32, 
-    4, 6, 74, 0, 74, 3, 74, 4, 10, 2, 
-    2, 0, 75, 1, 243, 75, 1, 189, 39, 5, 
-    0, 75, 0, 0, 54, 17, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
+    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 0, 0, 0, 95, 99, 97, 108, 99, 95, 
+    95, 95, 112, 97, 99, 107, 97, 103, 101, 95, 
+    95, 7, 0, 0, 0, 0, 0, 0, 0, 9, 
+    0, 0, 0, 0, 0, 0, 0, 95, 119, 97, 
+    114, 110, 105, 110, 103, 115, 13, 0, 0, 0, 
+    0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 
+    87, 97, 114, 110, 105, 110, 103, 3, 0, 0, 
+    0, 0, 0, 0, 0, 103, 101, 116, 4, 0, 
+    0, 0, 0, 0, 0, 0, 119, 97, 114, 110, 
+    10, 0, 0, 0, 0, 0, 0, 0, 114, 112, 
+    97, 114, 116, 105, 116, 105, 111, 110, 10, 0, 
+    0, 0, 0, 0, 0, 0, 115, 116, 97, 99, 
+    107, 108, 101, 118, 101, 108, 6, 0, 0, 0, 
+    0, 0, 0, 0, 112, 97, 114, 101, 110, 116, 
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
+    0, 0, 0, 0, 103, 108, 111, 98, 97, 108, 
+    115, 7, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 99, 107, 97, 103, 101, 4, 0, 0, 0, 
+    0, 0, 0, 0, 115, 112, 101, 99, 33, 0, 
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 
+    0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 95, 104, 97, 110, 100, 108, 101, 95, 102, 
+    114, 111, 109, 108, 105, 115, 116, 46, 49, 48, 
+    51, 50, 58, 48, 0, 159, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 32, 1, 1, 13, 
+    0, 1, 17, 0, 0, 0, 0, 9, 1, 0, 
+    114, 0, 0, 0, 0, 0, 0, 0, 45, 4, 
+    1, 17, 0, 0, 0, 0, 33, 2, 0, 32, 
+    3, 4, 33, 4, 1, 74, 0, 74, 3, 74, 
+    4, 10, 2, 2, 0, 75, 1, 0, 75, 1, 
+    0, 39, 5, 0, 75, 0, 0, 49, 6, 5, 
+    3, 79, 2, 6, 22, 6, 99, 0, 0, 0, 
+    32, 2, 4, 30, 3, 1, 6, 4, 2, 3, 
+    0, 79, 5, 4, 22, 4, 66, 0, 0, 0, 
+    33, 2, 4, 32, 3, 0, 32, 4, 4, 74, 
+    0, 74, 3, 74, 4, 10, 2, 2, 0, 75, 
+    1, 80, 75, 1, 45, 39, 5, 0, 75, 0, 
+    0, 49, 6, 5, 3, 79, 2, 6, 19, 6, 
+    51, 0, 0, 0, 30, 2, 2, 34, 3, 2, 
+    11, 1, 32, 32, 4, 0, 27, 2, 4, 13, 
+    32, 5, 4, 74, 0, 38, 3, 32, 2, 0, 
+    0, 0, 0, 0, 0, 0, 2, 5, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 39, 4, 0, 75, 0, 0, 
+    45, 6, 4, 17, 27, 0, 0, 0, 33, 2, 
+    7, 46, 8, 2, 21, 2, 23, 0, 0, 0, 
+    33, 3, 8, 27, 2, 3, 14, 32, 4, 6, 
+    6, 3, 2, 4, 0, 79, 5, 3, 19, 3, 
+    12, 0, 0, 0, 33, 2, 9, 27, 4, 2, 
+    15, 34, 5, 4, 12, 1, 32, 32, 2, 6, 
+    33, 4, 10, 74, 0, 38, 5, 32, 2, 0, 
+    0, 0, 0, 0, 0, 0, 2, 4, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 39, 6, 0, 75, 0, 0, 
+    30, 7, 3, 6, 3, 6, 7, 7, 17, 0, 
+    0, 0, 0, 79, 2, 3, 22, 3, 1, 0, 
+    0, 0, 52, 17, 0, 0, 0, 0, 17, 41, 
+    0, 0, 0, 52, 33, 2, 6, 32, 3, 2, 
+    32, 4, 6, 74, 0, 74, 3, 74, 4, 10, 
+    2, 2, 0, 75, 1, 243, 75, 1, 189, 39, 
+    5, 0, 75, 0, 0, 17, 0, 0, 0, 0, 
     17, 0, 0, 0, 0, 17, 24, 0, 0, 0, 
     32, 2, 3, 49, 0, 2, 3, 79, 3, 0, 
     19, 0, 9, 0, 0, 0, 33, 2, 4, 32, 
@@ -1805,7 +1837,7 @@ std::vector<uint8_t> _bootstrap
     0, 0, 17, 17, 0, 0, 0, 0, 17, 0, 
     0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 
     0, 0, 0, 9, 1, 0, 0, 0, 0, 0, 
-    132, 255, 255, 255, 17, 37, 0, 0, 0, 32, 
+    142, 255, 255, 255, 17, 37, 0, 0, 0, 32, 
     0, 3, 79, 1, 0, 22, 0, 3, 0, 0, 
     0, 30, 1, 6, 45, 5, 1, 17, 6, 0, 
     0, 0, 32, 0, 0, 27, 1, 0, 13, 30, 
@@ -1818,439 +1850,509 @@ std::vector<uint8_t> _bootstrap
     74, 5, 72, 6, 4, 75, 1, 0, 75, 1, 
     189, 75, 1, 188, 75, 1, 189, 74, 6, 10, 
     1, 1, 0, 75, 1, 188, 40, 1, 0, 32, 
-    1, 0, 41, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
-    0, 0, 0, 0, 0, 0, 2, 238, 0, 0, 
-    0, 0, 0, 0, 0, 70, 105, 103, 117, 114, 
-    101, 32, 111, 117, 116, 32, 119, 104, 97, 116, 
-    32, 95, 95, 105, 109, 112, 111, 114, 116, 95, 
-    95, 32, 115, 104, 111, 117, 108, 100, 32, 114, 
-    101, 116, 117, 114, 110, 46, 10, 10, 32, 32, 
-    32, 32, 84, 104, 101, 32, 105, 109, 112, 111, 
-    114, 116, 95, 32, 112, 97, 114, 97, 109, 101, 
-    116, 101, 114, 32, 105, 115, 32, 97, 32, 99, 
-    97, 108, 108, 97, 98, 108, 101, 32, 119, 104, 
-    105, 99, 104, 32, 116, 97, 107, 101, 115, 32, 
-    116, 104, 101, 32, 110, 97, 109, 101, 32, 111, 
-    102, 32, 109, 111, 100, 117, 108, 101, 32, 116, 
-    111, 10, 32, 32, 32, 32, 105, 109, 112, 111, 
-    114, 116, 46, 32, 73, 116, 32, 105, 115, 32, 
-    114, 101, 113, 117, 105, 114, 101, 100, 32, 116, 
-    111, 32, 100, 101, 99, 111, 117, 112, 108, 101, 
-    32, 116, 104, 101, 32, 102, 117, 110, 99, 116, 
-    105, 111, 110, 32, 102, 114, 111, 109, 32, 97, 
-    115, 115, 117, 109, 105, 110, 103, 32, 105, 109, 
-    112, 111, 114, 116, 108, 105, 98, 39, 115, 10, 
-    32, 32, 32, 32, 105, 109, 112, 111, 114, 116, 
-    32, 105, 109, 112, 108, 101, 109, 101, 110, 116, 
-    97, 116, 105, 111, 110, 32, 105, 115, 32, 100, 
-    101, 115, 105, 114, 101, 100, 46, 10, 10, 32, 
-    32, 32, 32, 2, 1, 0, 0, 0, 0, 0, 
-    0, 0, 42, 2, 5, 0, 0, 0, 0, 0, 
-    0, 0, 123, 125, 46, 123, 125, 5, 2, 7, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 97, 
-    108, 108, 95, 95, 6, 1, 2, 13, 0, 0, 
-    0, 0, 0, 0, 0, 96, 96, 102, 114, 111, 
-    109, 32, 108, 105, 115, 116, 39, 39, 2, 8, 
-    0, 0, 0, 0, 0, 0, 0, 46, 95, 95, 
-    97, 108, 108, 95, 95, 2, 8, 0, 0, 0, 
-    0, 0, 0, 0, 73, 116, 101, 109, 32, 105, 
-    110, 32, 2, 18, 0, 0, 0, 0, 0, 0, 
-    0, 32, 109, 117, 115, 116, 32, 98, 101, 32, 
-    115, 116, 114, 44, 32, 110, 111, 116, 32, 0, 
+    1, 0, 41, 1, 2, 0, 0, 0, 0, 0, 
+    0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 
+    51, 0, 0, 0, 0, 0, 0, 0, 51, 0, 
+    0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 
+    0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 
+    0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 2, 238, 0, 0, 0, 0, 0, 0, 
+    0, 70, 105, 103, 117, 114, 101, 32, 111, 117, 
+    116, 32, 119, 104, 97, 116, 32, 95, 95, 105, 
+    109, 112, 111, 114, 116, 95, 95, 32, 115, 104, 
+    111, 117, 108, 100, 32, 114, 101, 116, 117, 114, 
+    110, 46, 10, 10, 32, 32, 32, 32, 84, 104, 
+    101, 32, 105, 109, 112, 111, 114, 116, 95, 32, 
+    112, 97, 114, 97, 109, 101, 116, 101, 114, 32, 
+    105, 115, 32, 97, 32, 99, 97, 108, 108, 97, 
+    98, 108, 101, 32, 119, 104, 105, 99, 104, 32, 
+    116, 97, 107, 101, 115, 32, 116, 104, 101, 32, 
+    110, 97, 109, 101, 32, 111, 102, 32, 109, 111, 
+    100, 117, 108, 101, 32, 116, 111, 10, 32, 32, 
+    32, 32, 105, 109, 112, 111, 114, 116, 46, 32, 
+    73, 116, 32, 105, 115, 32, 114, 101, 113, 117, 
+    105, 114, 101, 100, 32, 116, 111, 32, 100, 101, 
+    99, 111, 117, 112, 108, 101, 32, 116, 104, 101, 
+    32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 
+    102, 114, 111, 109, 32, 97, 115, 115, 117, 109, 
+    105, 110, 103, 32, 105, 109, 112, 111, 114, 116, 
+    108, 105, 98, 39, 115, 10, 32, 32, 32, 32, 
+    105, 109, 112, 111, 114, 116, 32, 105, 109, 112, 
+    108, 101, 109, 101, 110, 116, 97, 116, 105, 111, 
+    110, 32, 105, 115, 32, 100, 101, 115, 105, 114, 
+    101, 100, 46, 10, 10, 32, 32, 32, 32, 2, 
+    1, 0, 0, 0, 0, 0, 0, 0, 42, 2, 
+    5, 0, 0, 0, 0, 0, 0, 0, 123, 125, 
+    46, 123, 125, 5, 2, 7, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 97, 108, 108, 95, 95, 
+    6, 1, 2, 13, 0, 0, 0, 0, 0, 0, 
+    0, 96, 96, 102, 114, 111, 109, 32, 108, 105, 
+    115, 116, 39, 39, 2, 8, 0, 0, 0, 0, 
+    0, 0, 0, 46, 95, 95, 97, 108, 108, 95, 
+    95, 2, 8, 0, 0, 0, 0, 0, 0, 0, 
+    73, 116, 101, 109, 32, 105, 110, 32, 2, 18, 
+    0, 0, 0, 0, 0, 0, 0, 32, 109, 117, 
+    115, 116, 32, 98, 101, 32, 115, 116, 114, 44, 
+    32, 110, 111, 116, 32, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 0, 0, 0, 0, 0, 16, 0, 
-    0, 0, 0, 0, 0, 0, 95, 104, 97, 110, 
-    100, 108, 101, 95, 102, 114, 111, 109, 108, 105, 
-    115, 116, 18, 0, 0, 0, 0, 0, 0, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 105, 115, 
-    105, 110, 115, 116, 97, 110, 99, 101, 3, 0, 
-    0, 0, 0, 0, 0, 0, 115, 116, 114, 9, 
-    0, 0, 0, 0, 0, 0, 0, 84, 121, 112, 
-    101, 69, 114, 114, 111, 114, 4, 0, 0, 0, 
-    0, 0, 0, 0, 116, 121, 112, 101, 7, 0, 
-    0, 0, 0, 0, 0, 0, 104, 97, 115, 97, 
-    116, 116, 114, 16, 0, 0, 0, 0, 0, 0, 
-    0, 95, 104, 97, 110, 100, 108, 101, 95, 102, 
-    114, 111, 109, 108, 105, 115, 116, 25, 0, 0, 
-    0, 0, 0, 0, 0, 95, 99, 97, 108, 108, 
-    95, 119, 105, 116, 104, 95, 102, 114, 97, 109, 
-    101, 115, 95, 114, 101, 109, 111, 118, 101, 100, 
-    19, 0, 0, 0, 0, 0, 0, 0, 77, 111, 
-    100, 117, 108, 101, 78, 111, 116, 70, 111, 117, 
-    110, 100, 69, 114, 114, 111, 114, 3, 0, 0, 
-    0, 0, 0, 0, 0, 101, 120, 99, 3, 0, 
-    0, 0, 0, 0, 0, 0, 115, 121, 115, 14, 
-    0, 0, 0, 0, 0, 0, 0, 95, 78, 69, 
-    69, 68, 83, 95, 76, 79, 65, 68, 73, 78, 
-    71, 6, 0, 0, 0, 0, 0, 0, 0, 102, 
-    111, 114, 109, 97, 116, 3, 0, 0, 0, 0, 
-    0, 0, 0, 103, 101, 116, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 110, 97, 109, 101, 
-    95, 95, 4, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 
+    0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 
+    0, 0, 95, 104, 97, 110, 100, 108, 101, 95, 
+    102, 114, 111, 109, 108, 105, 115, 116, 18, 0, 
+    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
+    0, 0, 0, 0, 105, 115, 105, 110, 115, 116, 
+    97, 110, 99, 101, 3, 0, 0, 0, 0, 0, 
+    0, 0, 115, 116, 114, 9, 0, 0, 0, 0, 
+    0, 0, 0, 84, 121, 112, 101, 69, 114, 114, 
+    111, 114, 4, 0, 0, 0, 0, 0, 0, 0, 
+    116, 121, 112, 101, 7, 0, 0, 0, 0, 0, 
+    0, 0, 104, 97, 115, 97, 116, 116, 114, 16, 
+    0, 0, 0, 0, 0, 0, 0, 95, 104, 97, 
+    110, 100, 108, 101, 95, 102, 114, 111, 109, 108, 
+    105, 115, 116, 25, 0, 0, 0, 0, 0, 0, 
+    0, 95, 99, 97, 108, 108, 95, 119, 105, 116, 
+    104, 95, 102, 114, 97, 109, 101, 115, 95, 114, 
+    101, 109, 111, 118, 101, 100, 19, 0, 0, 0, 
+    0, 0, 0, 0, 77, 111, 100, 117, 108, 101, 
+    78, 111, 116, 70, 111, 117, 110, 100, 69, 114, 
+    114, 111, 114, 3, 0, 0, 0, 0, 0, 0, 
+    0, 101, 120, 99, 3, 0, 0, 0, 0, 0, 
+    0, 0, 115, 121, 115, 14, 0, 0, 0, 0, 
+    0, 0, 0, 95, 78, 69, 69, 68, 83, 95, 
+    76, 79, 65, 68, 73, 78, 71, 6, 0, 0, 
+    0, 0, 0, 0, 0, 102, 111, 114, 109, 97, 
+    116, 3, 0, 0, 0, 0, 0, 0, 0, 103, 
+    101, 116, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 110, 97, 109, 101, 95, 95, 4, 0, 
+    0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 
+    7, 0, 0, 0, 0, 0, 0, 0, 109, 111, 
+    100, 117, 108, 101, 115, 7, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 97, 108, 108, 95, 95, 
+    9, 0, 0, 0, 0, 0, 0, 0, 114, 101, 
+    99, 117, 114, 115, 105, 118, 101, 0, 0, 0, 
+    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
+    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
+    0, 109, 111, 100, 117, 108, 101, 8, 0, 0, 
+    0, 0, 0, 0, 0, 102, 114, 111, 109, 108, 
+    105, 115, 116, 7, 0, 0, 0, 0, 0, 0, 
+    0, 105, 109, 112, 111, 114, 116, 95, 9, 0, 
+    0, 0, 0, 0, 0, 0, 114, 101, 99, 117, 
+    114, 115, 105, 118, 101, 1, 0, 0, 0, 0, 
+    0, 0, 0, 120, 5, 0, 0, 0, 0, 0, 
+    0, 0, 119, 104, 101, 114, 101, 9, 0, 0, 
+    0, 0, 0, 0, 0, 102, 114, 111, 109, 95, 
+    110, 97, 109, 101, 33, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    25, 0, 0, 0, 0, 0, 0, 0, 32, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 95, 102, 105, 
+    110, 100, 95, 97, 110, 100, 95, 108, 111, 97, 
+    100, 46, 49, 48, 48, 49, 58, 48, 0, 93, 
+    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
+    33, 1, 0, 32, 2, 0, 74, 2, 10, 1, 
+    1, 0, 75, 1, 0, 34, 3, 0, 6, 1, 
+    32, 74, 0, 38, 3, 32, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    39, 1, 0, 75, 0, 0, 17, 10, 0, 0, 
+    0, 34, 1, 0, 7, 0, 0, 74, 0, 53, 
+    2, 1, 39, 2, 0, 75, 0, 0, 79, 3, 
+    2, 22, 2, 1, 0, 0, 0, 52, 5, 17, 
+    24, 0, 0, 0, 33, 1, 1, 27, 2, 1, 
+    10, 34, 3, 2, 8, 1, 32, 32, 1, 0, 
+    33, 2, 2, 74, 0, 38, 3, 32, 2, 0, 
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 39, 4, 0, 75, 0, 0, 
+    45, 2, 4, 32, 1, 2, 33, 2, 2, 6, 
+    3, 1, 2, 6, 79, 4, 3, 22, 3, 40, 
+    0, 0, 0, 17, 0, 0, 0, 0, 34, 1, 
+    0, 7, 1, 32, 30, 2, 1, 74, 0, 38, 
+    1, 32, 3, 0, 0, 0, 0, 0, 0, 0, 
+    2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 
+    3, 0, 75, 0, 0, 5, 17, 0, 0, 0, 
+    0, 32, 1, 2, 30, 2, 1, 6, 3, 1, 
+    2, 6, 79, 4, 3, 19, 3, 16, 0, 0, 
+    0, 30, 1, 2, 34, 2, 1, 9, 1, 32, 
+    32, 3, 0, 74, 0, 38, 2, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 39, 1, 0, 75, 0, 0, 45, 
+    3, 1, 33, 2, 4, 32, 1, 3, 32, 3, 
+    0, 74, 0, 12, 2, 1, 0, 0, 0, 0, 
+    0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 
+    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 
+    0, 11, 39, 4, 0, 75, 0, 0, 40, 1, 
+    4, 33, 1, 5, 32, 2, 0, 74, 0, 74, 
+    2, 10, 1, 1, 0, 75, 1, 188, 39, 3, 
+    0, 75, 0, 0, 32, 4, 2, 41, 4, 33, 
+    1, 3, 32, 2, 0, 32, 3, 1, 74, 0, 
+    74, 2, 74, 3, 10, 1, 2, 0, 75, 1, 
+    189, 75, 1, 70, 39, 4, 0, 75, 0, 0, 
+    34, 5, 0, 7, 1, 32, 30, 1, 1, 38, 
+    5, 32, 3, 0, 0, 0, 0, 0, 0, 0, 
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+    41, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 12, 0, 
+    0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 
+    0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 
+    0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 
+    12, 0, 0, 0, 0, 0, 0, 0, 77, 0, 
+    0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 
+    0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 2, 25, 0, 0, 0, 0, 
+    0, 0, 0, 70, 105, 110, 100, 32, 97, 110, 
+    100, 32, 108, 111, 97, 100, 32, 116, 104, 101, 
+    32, 109, 111, 100, 117, 108, 101, 46, 5, 2, 
+    40, 0, 0, 0, 0, 0, 0, 0, 105, 109, 
+    112, 111, 114, 116, 32, 111, 102, 32, 123, 125, 
+    32, 104, 97, 108, 116, 101, 100, 59, 32, 78, 
+    111, 110, 101, 32, 105, 110, 32, 115, 121, 115, 
+    46, 109, 111, 100, 117, 108, 101, 115, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 
+    0, 0, 0, 0, 0, 95, 102, 105, 110, 100, 
+    95, 97, 110, 100, 95, 108, 111, 97, 100, 12, 
+    0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 
+    0, 0, 0, 0, 0, 95, 77, 111, 100, 117, 
+    108, 101, 76, 111, 99, 107, 77, 97, 110, 97, 
+    103, 101, 114, 3, 0, 0, 0, 0, 0, 0, 
+    0, 115, 121, 115, 14, 0, 0, 0, 0, 0, 
+    0, 0, 95, 78, 69, 69, 68, 83, 95, 76, 
+    79, 65, 68, 73, 78, 71, 23, 0, 0, 0, 
+    0, 0, 0, 0, 95, 102, 105, 110, 100, 95, 
+    97, 110, 100, 95, 108, 111, 97, 100, 95, 117, 
+    110, 108, 111, 99, 107, 101, 100, 19, 0, 0, 
+    0, 0, 0, 0, 0, 77, 111, 100, 117, 108, 
+    101, 78, 111, 116, 70, 111, 117, 110, 100, 69, 
+    114, 114, 111, 114, 19, 0, 0, 0, 0, 0, 
+    0, 0, 95, 108, 111, 99, 107, 95, 117, 110, 
+    108, 111, 99, 107, 95, 109, 111, 100, 117, 108, 
+    101, 9, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 101, 110, 116, 101, 114, 95, 95, 8, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 101, 120, 
+    105, 116, 95, 95, 3, 0, 0, 0, 0, 0, 
+    0, 0, 103, 101, 116, 6, 0, 0, 0, 0, 
+    0, 0, 0, 102, 111, 114, 109, 97, 116, 7, 
+    0, 0, 0, 0, 0, 0, 0, 109, 111, 100, 
+    117, 108, 101, 115, 4, 0, 0, 0, 0, 0, 
+    0, 0, 110, 97, 109, 101, 0, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
     110, 97, 109, 101, 7, 0, 0, 0, 0, 0, 
-    0, 0, 109, 111, 100, 117, 108, 101, 115, 7, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 97, 
-    108, 108, 95, 95, 9, 0, 0, 0, 0, 0, 
-    0, 0, 114, 101, 99, 117, 114, 115, 105, 118, 
-    101, 0, 0, 0, 0, 0, 0, 0, 0, 7, 
-    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
-    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
-    101, 8, 0, 0, 0, 0, 0, 0, 0, 102, 
-    114, 111, 109, 108, 105, 115, 116, 7, 0, 0, 
-    0, 0, 0, 0, 0, 105, 109, 112, 111, 114, 
-    116, 95, 9, 0, 0, 0, 0, 0, 0, 0, 
-    114, 101, 99, 117, 114, 115, 105, 118, 101, 1, 
-    0, 0, 0, 0, 0, 0, 0, 120, 5, 0, 
-    0, 0, 0, 0, 0, 0, 119, 104, 101, 114, 
-    101, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
-    114, 111, 109, 95, 110, 97, 109, 101, 32, 0, 
+    0, 0, 105, 109, 112, 111, 114, 116, 95, 6, 
+    0, 0, 0, 0, 0, 0, 0, 109, 111, 100, 
+    117, 108, 101, 7, 0, 0, 0, 0, 0, 0, 
+    0, 109, 101, 115, 115, 97, 103, 101, 33, 0, 
     0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 
-    0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
+    0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 
     95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 102, 105, 110, 100, 95, 97, 110, 100, 
-    95, 108, 111, 97, 100, 46, 49, 48, 48, 49, 
-    58, 48, 0, 113, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 33, 1, 0, 32, 2, 0, 
-    74, 2, 10, 1, 1, 0, 75, 1, 0, 34, 
-    3, 0, 6, 74, 0, 10, 3, 0, 0, 39, 
-    1, 0, 75, 0, 0, 56, 1, 0, 0, 0, 
-    17, 10, 0, 0, 0, 34, 1, 0, 7, 74, 
-    0, 53, 2, 1, 39, 2, 0, 75, 0, 0, 
-    79, 3, 2, 22, 2, 1, 0, 0, 0, 52, 
-    5, 17, 35, 0, 0, 0, 33, 1, 1, 27, 
-    2, 1, 10, 34, 3, 2, 8, 32, 1, 0, 
-    33, 2, 2, 74, 0, 74, 1, 74, 2, 10, 
-    3, 2, 0, 75, 1, 189, 75, 1, 202, 39, 
-    4, 0, 75, 0, 0, 45, 2, 4, 32, 1, 
-    2, 33, 2, 2, 6, 3, 1, 2, 6, 79, 
-    4, 3, 22, 3, 49, 0, 0, 0, 54, 17, 
-    0, 0, 0, 0, 34, 1, 0, 7, 30, 2, 
-    1, 74, 0, 74, 2, 74, 2, 74, 2, 10, 
-    1, 3, 0, 75, 1, 189, 75, 1, 61, 75, 
-    1, 189, 39, 3, 0, 75, 0, 0, 5, 17, 
-    0, 0, 0, 0, 32, 1, 2, 30, 2, 1, 
-    6, 3, 1, 2, 6, 79, 4, 3, 19, 3, 
-    18, 0, 0, 0, 30, 1, 2, 34, 2, 1, 
-    9, 32, 3, 0, 74, 0, 74, 3, 10, 2, 
-    1, 0, 75, 1, 0, 39, 1, 0, 75, 0, 
-    0, 45, 3, 1, 33, 2, 4, 32, 1, 3, 
-    32, 3, 0, 74, 0, 12, 2, 1, 0, 0, 
-    0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 
-    0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 
-    0, 0, 0, 11, 39, 4, 0, 75, 0, 0, 
-    40, 1, 4, 33, 1, 5, 32, 2, 0, 74, 
-    0, 74, 2, 10, 1, 1, 0, 75, 1, 188, 
-    39, 3, 0, 75, 0, 0, 32, 4, 2, 41, 
-    4, 33, 1, 3, 32, 2, 0, 32, 3, 1, 
-    74, 0, 74, 2, 74, 3, 10, 1, 2, 0, 
-    75, 1, 189, 75, 1, 70, 39, 4, 0, 75, 
-    0, 0, 34, 5, 0, 7, 30, 1, 1, 74, 
-    1, 74, 1, 74, 1, 10, 5, 3, 0, 75, 
-    1, 188, 75, 1, 189, 75, 1, 59, 5, 41, 
-    4, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    46, 95, 102, 105, 110, 100, 95, 115, 112, 101, 
+    99, 95, 108, 101, 103, 97, 99, 121, 46, 56, 
+    57, 49, 58, 48, 0, 22, 0, 0, 0, 0, 
+    0, 0, 0, 32, 0, 0, 34, 1, 0, 1, 
+    1, 32, 32, 2, 1, 32, 3, 2, 38, 1, 
+    32, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 45, 3, 0, 
+    32, 1, 3, 30, 0, 0, 6, 2, 1, 0, 
+    6, 79, 3, 2, 22, 2, 9, 0, 0, 0, 
+    33, 1, 0, 32, 2, 1, 32, 3, 3, 74, 
+    2, 74, 3, 10, 1, 2, 0, 75, 1, 0, 
+    75, 1, 188, 41, 0, 30, 1, 0, 41, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 2, 25, 0, 0, 0, 0, 0, 
-    0, 0, 70, 105, 110, 100, 32, 97, 110, 100, 
-    32, 108, 111, 97, 100, 32, 116, 104, 101, 32, 
-    109, 111, 100, 117, 108, 101, 46, 5, 2, 40, 
-    0, 0, 0, 0, 0, 0, 0, 105, 109, 112, 
-    111, 114, 116, 32, 111, 102, 32, 123, 125, 32, 
-    104, 97, 108, 116, 101, 100, 59, 32, 78, 111, 
-    110, 101, 32, 105, 110, 32, 115, 121, 115, 46, 
-    109, 111, 100, 117, 108, 101, 115, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 
-    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 
-    0, 0, 0, 0, 95, 102, 105, 110, 100, 95, 
-    97, 110, 100, 95, 108, 111, 97, 100, 12, 0, 
-    0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 
-    0, 0, 0, 0, 95, 77, 111, 100, 117, 108, 
-    101, 76, 111, 99, 107, 77, 97, 110, 97, 103, 
-    101, 114, 3, 0, 0, 0, 0, 0, 0, 0, 
-    115, 121, 115, 14, 0, 0, 0, 0, 0, 0, 
-    0, 95, 78, 69, 69, 68, 83, 95, 76, 79, 
-    65, 68, 73, 78, 71, 23, 0, 0, 0, 0, 
-    0, 0, 0, 95, 102, 105, 110, 100, 95, 97, 
-    110, 100, 95, 108, 111, 97, 100, 95, 117, 110, 
-    108, 111, 99, 107, 101, 100, 19, 0, 0, 0, 
-    0, 0, 0, 0, 77, 111, 100, 117, 108, 101, 
-    78, 111, 116, 70, 111, 117, 110, 100, 69, 114, 
-    114, 111, 114, 19, 0, 0, 0, 0, 0, 0, 
-    0, 95, 108, 111, 99, 107, 95, 117, 110, 108, 
-    111, 99, 107, 95, 109, 111, 100, 117, 108, 101, 
-    9, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    101, 110, 116, 101, 114, 95, 95, 8, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 101, 120, 105, 
-    116, 95, 95, 3, 0, 0, 0, 0, 0, 0, 
-    0, 103, 101, 116, 6, 0, 0, 0, 0, 0, 
-    0, 0, 102, 111, 114, 109, 97, 116, 7, 0, 
-    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
-    108, 101, 115, 4, 0, 0, 0, 0, 0, 0, 
-    0, 110, 97, 109, 101, 0, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
-    97, 109, 101, 7, 0, 0, 0, 0, 0, 0, 
-    0, 105, 109, 112, 111, 114, 116, 95, 6, 0, 
-    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
-    108, 101, 7, 0, 0, 0, 0, 0, 0, 0, 
-    109, 101, 115, 115, 97, 103, 101, 32, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
-    0, 34, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    95, 102, 105, 110, 100, 95, 115, 112, 101, 99, 
-    95, 108, 101, 103, 97, 99, 121, 46, 56, 57, 
-    49, 58, 48, 0, 26, 0, 0, 0, 0, 0, 
-    0, 0, 32, 0, 0, 34, 1, 0, 1, 32, 
-    2, 1, 32, 3, 2, 74, 2, 74, 3, 10, 
-    1, 2, 0, 75, 1, 0, 75, 1, 0, 45, 
-    3, 0, 32, 1, 3, 30, 0, 0, 6, 2, 
-    1, 0, 6, 79, 3, 2, 22, 2, 9, 0, 
-    0, 0, 33, 1, 0, 32, 2, 1, 32, 3, 
-    3, 74, 2, 74, 3, 10, 1, 2, 0, 75, 
-    1, 0, 75, 1, 188, 41, 0, 30, 1, 0, 
-    41, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 0, 0, 0, 95, 102, 
+    105, 110, 100, 95, 115, 112, 101, 99, 95, 108, 
+    101, 103, 97, 99, 121, 2, 0, 0, 0, 0, 
+    0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 
+    0, 115, 112, 101, 99, 95, 102, 114, 111, 109, 
+    95, 108, 111, 97, 100, 101, 114, 11, 0, 0, 
+    0, 0, 0, 0, 0, 102, 105, 110, 100, 95, 
+    109, 111, 100, 117, 108, 101, 0, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
+    102, 105, 110, 100, 101, 114, 4, 0, 0, 0, 
+    0, 0, 0, 0, 110, 97, 109, 101, 4, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
+    6, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
+    97, 100, 101, 114, 33, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 44, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 95, 73, 109, 
+    112, 111, 114, 116, 76, 111, 99, 107, 67, 111, 
+    110, 116, 101, 120, 116, 46, 95, 95, 101, 120, 
+    105, 116, 95, 95, 46, 56, 55, 55, 58, 52, 
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 33, 1, 0, 34, 2, 1, 1, 1, 
+    32, 38, 2, 32, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 30, 1, 
+    1, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
-    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
-    0, 0, 95, 102, 105, 110, 100, 95, 115, 112, 
-    101, 99, 95, 108, 101, 103, 97, 99, 121, 2, 
-    0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 
-    0, 0, 0, 0, 0, 115, 112, 101, 99, 95, 
-    102, 114, 111, 109, 95, 108, 111, 97, 100, 101, 
-    114, 11, 0, 0, 0, 0, 0, 0, 0, 102, 
-    105, 110, 100, 95, 109, 111, 100, 117, 108, 101, 
-    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 102, 105, 110, 100, 101, 114, 
-    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
-    109, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 6, 0, 0, 0, 0, 0, 
-    0, 0, 108, 111, 97, 100, 101, 114, 32, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 2, 60, 0, 0, 0, 0, 0, 
+    0, 0, 82, 101, 108, 101, 97, 115, 101, 32, 
+    116, 104, 101, 32, 105, 109, 112, 111, 114, 116, 
+    32, 108, 111, 99, 107, 32, 114, 101, 103, 97, 
+    114, 100, 108, 101, 115, 115, 32, 111, 102, 32, 
+    97, 110, 121, 32, 114, 97, 105, 115, 101, 100, 
+    32, 101, 120, 99, 101, 112, 116, 105, 111, 110, 
+    115, 46, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 101, 120, 105, 116, 95, 95, 2, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 95, 105, 109, 112, 12, 0, 
+    0, 0, 0, 0, 0, 0, 114, 101, 108, 101, 
+    97, 115, 101, 95, 108, 111, 99, 107, 0, 0, 
     0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
     0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 73, 109, 112, 111, 114, 116, 76, 111, 
-    99, 107, 67, 111, 110, 116, 101, 120, 116, 46, 
-    95, 95, 101, 120, 105, 116, 95, 95, 46, 56, 
-    55, 55, 58, 52, 0, 6, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 33, 1, 0, 34, 
-    2, 1, 1, 10, 2, 0, 0, 30, 1, 1, 
-    41, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 2, 60, 0, 0, 0, 0, 
-    0, 0, 0, 82, 101, 108, 101, 97, 115, 101, 
-    32, 116, 104, 101, 32, 105, 109, 112, 111, 114, 
-    116, 32, 108, 111, 99, 107, 32, 114, 101, 103, 
-    97, 114, 100, 108, 101, 115, 115, 32, 111, 102, 
-    32, 97, 110, 121, 32, 114, 97, 105, 115, 101, 
-    100, 32, 101, 120, 99, 101, 112, 116, 105, 111, 
-    110, 115, 46, 5, 0, 0, 0, 0, 0, 0, 
+    0, 0, 115, 101, 108, 102, 8, 0, 0, 0, 
+    0, 0, 0, 0, 101, 120, 99, 95, 116, 121, 
+    112, 101, 9, 0, 0, 0, 0, 0, 0, 0, 
+    101, 120, 99, 95, 118, 97, 108, 117, 101, 13, 
+    0, 0, 0, 0, 0, 0, 0, 101, 120, 99, 
+    95, 116, 114, 97, 99, 101, 98, 97, 99, 107, 
+    33, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 46, 95, 73, 109, 112, 111, 114, 116, 
+    76, 111, 99, 107, 67, 111, 110, 116, 101, 120, 
+    116, 46, 95, 95, 101, 110, 116, 101, 114, 95, 
+    95, 46, 56, 55, 51, 58, 52, 0, 6, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 33, 
+    1, 0, 34, 2, 1, 1, 1, 32, 38, 2, 
+    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 30, 1, 1, 41, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 24, 0, 0, 0, 0, 0, 0, 0, 65, 
+    99, 113, 117, 105, 114, 101, 32, 116, 104, 101, 
+    32, 105, 109, 112, 111, 114, 116, 32, 108, 111, 
+    99, 107, 46, 5, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 101, 120, 105, 116, 95, 95, 2, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 95, 105, 109, 112, 12, 
-    0, 0, 0, 0, 0, 0, 0, 114, 101, 108, 
-    101, 97, 115, 101, 95, 108, 111, 99, 107, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 101, 110, 116, 101, 114, 95, 95, 
+    2, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 95, 105, 109, 112, 
+    12, 0, 0, 0, 0, 0, 0, 0, 97, 99, 
+    113, 117, 105, 114, 101, 95, 108, 111, 99, 107, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 115, 101, 108, 102, 34, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
+    0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 77, 111, 100, 117, 108, 101, 83, 112, 101, 
+    99, 46, 95, 95, 114, 101, 112, 114, 95, 95, 
+    46, 51, 54, 50, 58, 52, 0, 69, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 34, 1, 
+    0, 0, 1, 32, 32, 2, 0, 27, 3, 2, 
+    3, 38, 1, 32, 1, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 
+    2, 1, 34, 1, 2, 0, 1, 32, 32, 3, 
+    0, 27, 2, 3, 4, 74, 0, 38, 1, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 39, 4, 0, 75, 0, 
+    0, 74, 0, 74, 4, 3, 3, 2, 75, 1, 
+    0, 75, 1, 0, 45, 1, 3, 32, 0, 0, 
+    27, 1, 0, 5, 30, 2, 2, 6, 0, 1, 
+    2, 7, 79, 3, 0, 19, 0, 12, 0, 0, 
+    0, 32, 1, 1, 34, 2, 1, 1, 1, 32, 
+    30, 0, 3, 34, 1, 0, 0, 1, 33, 32, 
+    3, 0, 27, 4, 3, 5, 38, 1, 33, 1, 
     0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 115, 101, 108, 102, 8, 0, 0, 
-    0, 0, 0, 0, 0, 101, 120, 99, 95, 116, 
-    121, 112, 101, 9, 0, 0, 0, 0, 0, 0, 
-    0, 101, 120, 99, 95, 118, 97, 108, 117, 101, 
-    13, 0, 0, 0, 0, 0, 0, 0, 101, 120, 
-    99, 95, 116, 114, 97, 99, 101, 98, 97, 99, 
-    107, 32, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 73, 109, 112, 111, 114, 
-    116, 76, 111, 99, 107, 67, 111, 110, 116, 101, 
-    120, 116, 46, 95, 95, 101, 110, 116, 101, 114, 
-    95, 95, 46, 56, 55, 51, 58, 52, 0, 6, 
-    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
-    33, 1, 0, 34, 2, 1, 1, 10, 2, 0, 
-    0, 30, 1, 1, 41, 1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 24, 
-    0, 0, 0, 0, 0, 0, 0, 65, 99, 113, 
-    117, 105, 114, 101, 32, 116, 104, 101, 32, 105, 
-    109, 112, 111, 114, 116, 32, 108, 111, 99, 107, 
-    46, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 74, 0, 38, 2, 32, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 39, 3, 0, 75, 0, 0, 
+    17, 0, 0, 0, 0, 32, 0, 0, 27, 1, 
+    0, 6, 30, 2, 2, 6, 0, 1, 2, 7, 
+    79, 3, 0, 19, 0, 12, 0, 0, 0, 32, 
+    1, 1, 34, 2, 1, 1, 1, 32, 30, 0, 
+    4, 34, 1, 0, 0, 1, 33, 32, 3, 0, 
+    27, 4, 3, 6, 38, 1, 33, 1, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 9, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 101, 110, 116, 101, 114, 95, 95, 2, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 95, 105, 109, 112, 12, 0, 
-    0, 0, 0, 0, 0, 0, 97, 99, 113, 117, 
-    105, 114, 101, 95, 108, 111, 99, 107, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 108, 102, 32, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 
-    36, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 77, 
-    111, 100, 117, 108, 101, 83, 112, 101, 99, 46, 
-    95, 95, 114, 101, 112, 114, 95, 95, 46, 51, 
-    54, 50, 58, 52, 0, 87, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 34, 1, 0, 0, 
-    32, 2, 0, 27, 3, 2, 3, 74, 3, 10, 
-    1, 1, 0, 75, 1, 0, 30, 2, 1, 34, 
-    1, 2, 0, 32, 3, 0, 27, 2, 3, 4, 
-    74, 0, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 39, 4, 0, 75, 0, 0, 74, 0, 74, 
-    4, 3, 3, 2, 75, 1, 0, 75, 1, 0, 
-    45, 1, 3, 32, 0, 0, 27, 1, 0, 5, 
-    30, 2, 2, 6, 0, 1, 2, 7, 79, 3, 
-    0, 19, 0, 16, 0, 0, 0, 32, 1, 1, 
-    34, 2, 1, 1, 30, 0, 3, 34, 1, 0, 
-    0, 32, 3, 0, 27, 4, 3, 5, 74, 4, 
-    10, 1, 1, 0, 75, 1, 0, 74, 0, 74, 
-    0, 10, 2, 1, 0, 75, 1, 0, 39, 3, 
-    0, 75, 0, 0, 17, 0, 0, 0, 0, 32, 
-    0, 0, 27, 1, 0, 6, 30, 2, 2, 6, 
-    0, 1, 2, 7, 79, 3, 0, 19, 0, 16, 
-    0, 0, 0, 32, 1, 1, 34, 2, 1, 1, 
-    30, 0, 4, 34, 1, 0, 0, 32, 3, 0, 
-    27, 4, 3, 6, 74, 4, 10, 1, 1, 0, 
-    75, 1, 0, 74, 0, 74, 0, 10, 2, 1, 
-    0, 75, 1, 0, 39, 3, 0, 75, 0, 0, 
-    17, 0, 0, 0, 0, 30, 0, 5, 34, 1, 
-    0, 0, 32, 2, 0, 27, 0, 2, 7, 27, 
+    0, 0, 74, 0, 38, 2, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 39, 3, 0, 75, 0, 0, 17, 0, 
+    0, 0, 0, 30, 0, 5, 34, 1, 0, 0, 
+    1, 32, 32, 2, 0, 27, 0, 2, 7, 27, 
     3, 0, 8, 30, 2, 6, 34, 4, 2, 2, 
-    32, 5, 1, 74, 5, 10, 4, 1, 0, 75, 
-    1, 0, 74, 0, 74, 3, 74, 0, 10, 1, 
-    2, 0, 75, 1, 0, 75, 1, 0, 39, 2, 
-    0, 75, 0, 0, 41, 2, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    1, 33, 32, 5, 1, 38, 4, 33, 1, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    7, 0, 0, 0, 0, 0, 0, 0, 2, 9, 
-    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
-    101, 61, 123, 33, 114, 125, 2, 11, 0, 0, 
-    0, 0, 0, 0, 0, 108, 111, 97, 100, 101, 
-    114, 61, 123, 33, 114, 125, 5, 2, 11, 0, 
-    0, 0, 0, 0, 0, 0, 111, 114, 105, 103, 
-    105, 110, 61, 123, 33, 114, 125, 2, 29, 0, 
+    0, 0, 0, 74, 0, 38, 1, 32, 2, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 39, 2, 0, 75, 0, 0, 
+    41, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
+    0, 0, 2, 9, 0, 0, 0, 0, 0, 0, 
+    0, 110, 97, 109, 101, 61, 123, 33, 114, 125, 
+    2, 11, 0, 0, 0, 0, 0, 0, 0, 108, 
+    111, 97, 100, 101, 114, 61, 123, 33, 114, 125, 
+    5, 2, 11, 0, 0, 0, 0, 0, 0, 0, 
+    111, 114, 105, 103, 105, 110, 61, 123, 33, 114, 
+    125, 2, 29, 0, 0, 0, 0, 0, 0, 0, 
+    115, 117, 98, 109, 111, 100, 117, 108, 101, 95, 
+    115, 101, 97, 114, 99, 104, 95, 108, 111, 99, 
+    97, 116, 105, 111, 110, 115, 61, 123, 125, 2, 
+    6, 0, 0, 0, 0, 0, 0, 0, 123, 125, 
+    40, 123, 125, 41, 2, 2, 0, 0, 0, 0, 
+    0, 0, 0, 44, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 114, 101, 112, 114, 95, 95, 
+    9, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
+    0, 0, 0, 0, 0, 0, 102, 111, 114, 109, 
+    97, 116, 6, 0, 0, 0, 0, 0, 0, 0, 
+    97, 112, 112, 101, 110, 100, 4, 0, 0, 0, 
+    0, 0, 0, 0, 106, 111, 105, 110, 4, 0, 
+    0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 
+    6, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
+    97, 100, 101, 114, 6, 0, 0, 0, 0, 0, 
+    0, 0, 111, 114, 105, 103, 105, 110, 26, 0, 
     0, 0, 0, 0, 0, 0, 115, 117, 98, 109, 
     111, 100, 117, 108, 101, 95, 115, 101, 97, 114, 
     99, 104, 95, 108, 111, 99, 97, 116, 105, 111, 
-    110, 115, 61, 123, 125, 2, 6, 0, 0, 0, 
-    0, 0, 0, 0, 123, 125, 40, 123, 125, 41, 
-    2, 2, 0, 0, 0, 0, 0, 0, 0, 44, 
-    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    110, 115, 9, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 99, 108, 97, 115, 115, 95, 95, 8, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 110, 
+    97, 109, 101, 95, 95, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+    101, 108, 102, 4, 0, 0, 0, 0, 0, 0, 
+    0, 97, 114, 103, 115, 32, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 44, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 77, 
+    111, 100, 117, 108, 101, 76, 111, 99, 107, 77, 
+    97, 110, 97, 103, 101, 114, 46, 95, 95, 105, 
+    110, 105, 116, 95, 95, 46, 49, 53, 49, 58, 
+    52, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    32, 0, 1, 32, 1, 0, 43, 1, 0, 0, 
+    30, 2, 0, 32, 0, 0, 43, 0, 2, 1, 
+    30, 1, 0, 41, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 
-    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    114, 101, 112, 114, 95, 95, 9, 0, 0, 0, 
-    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
-    0, 0, 102, 111, 114, 109, 97, 116, 6, 0, 
-    0, 0, 0, 0, 0, 0, 97, 112, 112, 101, 
-    110, 100, 4, 0, 0, 0, 0, 0, 0, 0, 
-    106, 111, 105, 110, 4, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 6, 0, 0, 0, 
-    0, 0, 0, 0, 108, 111, 97, 100, 101, 114, 
-    6, 0, 0, 0, 0, 0, 0, 0, 111, 114, 
-    105, 103, 105, 110, 26, 0, 0, 0, 0, 0, 
-    0, 0, 115, 117, 98, 109, 111, 100, 117, 108, 
-    101, 95, 115, 101, 97, 114, 99, 104, 95, 108, 
-    111, 99, 97, 116, 105, 111, 110, 115, 9, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 99, 108, 
-    97, 115, 115, 95, 95, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 110, 97, 109, 101, 95, 
-    95, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 115, 101, 108, 102, 4, 
-    0, 0, 0, 0, 0, 0, 0, 97, 114, 103, 
-    115, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 77, 111, 100, 117, 108, 
-    101, 76, 111, 99, 107, 77, 97, 110, 97, 103, 
-    101, 114, 46, 95, 95, 105, 110, 105, 116, 95, 
-    95, 46, 49, 53, 49, 58, 52, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 32, 0, 1, 32, 
-    1, 0, 43, 1, 0, 0, 30, 2, 0, 32, 
-    0, 0, 43, 0, 2, 1, 30, 1, 0, 41, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 105, 110, 105, 116, 95, 
+    95, 2, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 95, 110, 97, 
+    109, 101, 5, 0, 0, 0, 0, 0, 0, 0, 
+    95, 108, 111, 99, 107, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+    101, 108, 102, 4, 0, 0, 0, 0, 0, 0, 
+    0, 110, 97, 109, 101, 33, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 33, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 103, 
+    101, 116, 95, 109, 111, 100, 117, 108, 101, 95, 
+    108, 111, 99, 107, 46, 49, 54, 53, 58, 48, 
+    0, 69, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 33, 1, 0, 34, 2, 1, 7, 1, 
+    32, 38, 2, 32, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 105, 110, 105, 116, 95, 95, 2, 
-    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
-    0, 0, 0, 0, 0, 95, 110, 97, 109, 101, 
-    5, 0, 0, 0, 0, 0, 0, 0, 95, 108, 
-    111, 99, 107, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
-    102, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
-    97, 109, 101, 32, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 8, 
-    0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 95, 103, 101, 116, 
-    95, 109, 111, 100, 117, 108, 101, 95, 108, 111, 
-    99, 107, 46, 49, 54, 53, 58, 48, 0, 77, 
-    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
-    33, 1, 0, 34, 2, 1, 7, 10, 2, 0, 
-    0, 42, 1, 0, 0, 0, 17, 4, 0, 0, 
-    0, 33, 1, 0, 34, 2, 1, 8, 10, 2, 
-    0, 0, 52, 42, 1, 0, 0, 0, 17, 7, 
-    0, 0, 0, 33, 0, 2, 21, 0, 4, 0, 
-    0, 0, 30, 1, 1, 45, 1, 1, 5, 17, 
-    8, 0, 0, 0, 52, 33, 1, 1, 32, 2, 
-    0, 1, 3, 1, 2, 10, 3, 0, 0, 45, 
-    1, 0, 54, 17, 0, 0, 0, 0, 32, 0, 
-    1, 30, 1, 1, 6, 2, 0, 1, 6, 79, 
-    3, 2, 19, 2, 38, 0, 0, 0, 33, 0, 
-    3, 30, 1, 1, 6, 2, 0, 1, 6, 79, 
-    3, 2, 22, 2, 7, 0, 0, 0, 33, 1, 
-    5, 32, 2, 0, 74, 2, 10, 1, 1, 0, 
-    75, 1, 0, 45, 1, 0, 17, 7, 0, 0, 
-    0, 33, 1, 4, 32, 2, 0, 74, 2, 10, 
-    1, 1, 0, 75, 1, 0, 45, 1, 0, 17, 
-    0, 0, 0, 0, 32, 0, 0, 30, 1, 2, 
-    74, 0, 36, 2, 1, 1, 0, 0, 0, 75, 
-    1, 0, 45, 2, 2, 33, 0, 6, 34, 1, 
-    0, 9, 32, 2, 1, 32, 3, 2, 74, 2, 
-    74, 3, 10, 1, 2, 0, 75, 1, 0, 75, 
-    1, 0, 33, 4, 1, 32, 1, 0, 48, 4, 
-    1, 0, 17, 0, 0, 0, 0, 54, 17, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 17, 4, 
     0, 0, 0, 33, 1, 0, 34, 2, 1, 8, 
-    10, 2, 0, 0, 17, 0, 0, 0, 0, 32, 
-    0, 1, 41, 0, 0, 0, 0, 0, 0, 0, 
+    1, 32, 38, 2, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 
+    17, 7, 0, 0, 0, 33, 0, 2, 21, 0, 
+    4, 0, 0, 0, 30, 1, 1, 45, 1, 1, 
+    5, 17, 7, 0, 0, 0, 52, 33, 1, 1, 
+    32, 2, 0, 1, 3, 1, 2, 10, 3, 0, 
+    0, 45, 1, 0, 17, 0, 0, 0, 0, 32, 
+    0, 1, 30, 1, 1, 6, 2, 0, 1, 6, 
+    79, 3, 2, 19, 2, 34, 0, 0, 0, 33, 
+    0, 3, 30, 1, 1, 6, 2, 0, 1, 6, 
+    79, 3, 2, 22, 2, 7, 0, 0, 0, 33, 
+    1, 5, 32, 2, 0, 74, 2, 10, 1, 1, 
+    0, 75, 1, 0, 45, 1, 0, 17, 7, 0, 
+    0, 0, 33, 1, 4, 32, 2, 0, 74, 2, 
+    10, 1, 1, 0, 75, 1, 0, 45, 1, 0, 
+    17, 0, 0, 0, 0, 32, 0, 0, 30, 1, 
+    2, 74, 0, 36, 2, 1, 1, 0, 0, 0, 
+    75, 1, 0, 45, 2, 2, 33, 0, 6, 34, 
+    1, 0, 9, 1, 32, 32, 2, 1, 32, 3, 
+    2, 38, 1, 32, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    33, 4, 1, 32, 1, 0, 48, 4, 1, 0, 
+    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    33, 1, 0, 34, 2, 1, 8, 1, 32, 38, 
+    2, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 32, 0, 1, 41, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
+    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
+    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 
+    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
+    22, 0, 0, 0, 0, 0, 0, 0, 62, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
     0, 0, 0, 0, 0, 0, 2, 139, 0, 0, 
@@ -2313,533 +2415,612 @@ std::vector<uint8_t> _bootstrap
     111, 117, 114, 99, 101, 46, 55, 55, 53, 58, 
     52, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
     30, 0, 0, 30, 1, 1, 41, 1, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    2, 56, 0, 0, 0, 0, 0, 0, 0, 82, 
-    101, 116, 117, 114, 110, 32, 78, 111, 110, 101, 
-    32, 97, 115, 32, 98, 117, 105, 108, 116, 45, 
-    105, 110, 32, 109, 111, 100, 117, 108, 101, 115, 
-    32, 100, 111, 32, 110, 111, 116, 32, 104, 97, 
-    118, 101, 32, 115, 111, 117, 114, 99, 101, 32, 
-    99, 111, 100, 101, 46, 5, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 2, 56, 
+    0, 0, 0, 0, 0, 0, 0, 82, 101, 116, 
+    117, 114, 110, 32, 78, 111, 110, 101, 32, 97, 
+    115, 32, 98, 117, 105, 108, 116, 45, 105, 110, 
+    32, 109, 111, 100, 117, 108, 101, 115, 32, 100, 
+    111, 32, 110, 111, 116, 32, 104, 97, 118, 101, 
+    32, 115, 111, 117, 114, 99, 101, 32, 99, 111, 
+    100, 101, 46, 5, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
+    0, 103, 101, 116, 95, 115, 111, 117, 114, 99, 
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
-    0, 0, 0, 103, 101, 116, 95, 115, 111, 117, 
-    114, 99, 101, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 99, 108, 115, 8, 0, 
-    0, 0, 0, 0, 0, 0, 102, 117, 108, 108, 
-    110, 97, 109, 101, 32, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    9, 0, 0, 0, 0, 0, 0, 0, 39, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 95, 109, 111, 
-    100, 117, 108, 101, 95, 114, 101, 112, 114, 95, 
-    102, 114, 111, 109, 95, 115, 112, 101, 99, 46, 
-    53, 55, 52, 58, 48, 0, 70, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 32, 1, 0, 
-    27, 0, 1, 1, 30, 2, 1, 6, 1, 0, 
-    2, 6, 79, 3, 1, 22, 1, 3, 0, 0, 
-    0, 32, 0, 0, 27, 1, 0, 1, 17, 2, 
-    0, 0, 0, 30, 1, 2, 17, 0, 0, 0, 
-    0, 45, 1, 1, 32, 2, 0, 27, 0, 2, 
-    2, 30, 1, 1, 6, 2, 0, 1, 6, 79, 
-    3, 2, 22, 2, 27, 0, 0, 0, 32, 0, 
-    0, 27, 1, 0, 3, 79, 2, 1, 22, 1, 
-    12, 0, 0, 0, 30, 0, 3, 34, 1, 0, 
-    0, 32, 2, 0, 27, 3, 2, 1, 32, 4, 
-    0, 27, 2, 4, 2, 74, 3, 74, 2, 10, 
-    1, 2, 0, 75, 1, 0, 75, 1, 0, 41, 
-    0, 30, 1, 4, 34, 2, 1, 0, 32, 3, 
-    1, 32, 1, 0, 27, 4, 1, 2, 74, 3, 
-    74, 4, 10, 2, 2, 0, 75, 1, 0, 75, 
-    1, 0, 41, 0, 32, 1, 0, 27, 0, 1, 
-    4, 30, 2, 1, 6, 1, 0, 2, 6, 79, 
-    3, 1, 22, 1, 11, 0, 0, 0, 30, 0, 
-    5, 34, 1, 0, 0, 32, 2, 1, 32, 3, 
-    0, 27, 4, 3, 4, 74, 2, 74, 4, 10, 
-    1, 2, 0, 75, 1, 0, 75, 1, 0, 41, 
-    0, 30, 1, 6, 34, 2, 1, 0, 32, 3, 
-    1, 74, 3, 10, 2, 1, 0, 75, 1, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 99, 108, 115, 8, 0, 0, 0, 
+    0, 0, 0, 0, 102, 117, 108, 108, 110, 97, 
+    109, 101, 33, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
+    0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 46, 95, 109, 111, 100, 117, 
+    108, 101, 95, 114, 101, 112, 114, 95, 102, 114, 
+    111, 109, 95, 115, 112, 101, 99, 46, 53, 55, 
+    52, 58, 48, 0, 56, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 32, 1, 0, 27, 0, 
+    1, 1, 30, 2, 1, 6, 1, 0, 2, 6, 
+    79, 3, 1, 22, 1, 3, 0, 0, 0, 32, 
+    0, 0, 27, 1, 0, 1, 17, 2, 0, 0, 
+    0, 30, 1, 2, 17, 0, 0, 0, 0, 45, 
+    1, 1, 32, 2, 0, 27, 0, 2, 2, 30, 
+    1, 1, 6, 2, 0, 1, 6, 79, 3, 2, 
+    22, 2, 19, 0, 0, 0, 32, 0, 0, 27, 
+    1, 0, 3, 79, 2, 1, 22, 1, 8, 0, 
+    0, 0, 30, 0, 3, 34, 1, 0, 0, 1, 
+    32, 32, 2, 0, 27, 3, 2, 1, 32, 4, 
+    0, 27, 2, 4, 2, 38, 1, 32, 2, 0, 
+    0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 41, 0, 30, 1, 4, 34, 
+    2, 1, 0, 1, 32, 32, 3, 1, 32, 1, 
+    0, 27, 4, 1, 2, 38, 2, 32, 2, 0, 
+    0, 0, 0, 0, 0, 0, 3, 4, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 41, 0, 32, 1, 0, 27, 
+    0, 1, 4, 30, 2, 1, 6, 1, 0, 2, 
+    6, 79, 3, 1, 22, 1, 7, 0, 0, 0, 
+    30, 0, 5, 34, 1, 0, 0, 1, 32, 32, 
+    2, 1, 32, 3, 0, 27, 4, 3, 4, 38, 
+    1, 32, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 
+    30, 1, 6, 34, 2, 1, 0, 1, 32, 32, 
+    3, 1, 38, 2, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
-    0, 0, 0, 0, 2, 38, 0, 0, 0, 0, 
-    0, 0, 0, 82, 101, 116, 117, 114, 110, 32, 
-    116, 104, 101, 32, 114, 101, 112, 114, 32, 116, 
-    111, 32, 117, 115, 101, 32, 102, 111, 114, 32, 
-    116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 
-    46, 5, 2, 1, 0, 0, 0, 0, 0, 0, 
-    0, 63, 2, 18, 0, 0, 0, 0, 0, 0, 
-    0, 60, 109, 111, 100, 117, 108, 101, 32, 123, 
-    33, 114, 125, 32, 40, 123, 125, 41, 62, 2, 
-    23, 0, 0, 0, 0, 0, 0, 0, 60, 109, 
-    111, 100, 117, 108, 101, 32, 123, 33, 114, 125, 
-    32, 102, 114, 111, 109, 32, 123, 33, 114, 125, 
-    62, 2, 20, 0, 0, 0, 0, 0, 0, 0, 
-    60, 109, 111, 100, 117, 108, 101, 32, 123, 33, 
-    114, 125, 32, 40, 123, 33, 114, 125, 41, 62, 
-    2, 13, 0, 0, 0, 0, 0, 0, 0, 60, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
+    0, 0, 2, 38, 0, 0, 0, 0, 0, 0, 
+    0, 82, 101, 116, 117, 114, 110, 32, 116, 104, 
+    101, 32, 114, 101, 112, 114, 32, 116, 111, 32, 
+    117, 115, 101, 32, 102, 111, 114, 32, 116, 104, 
+    101, 32, 109, 111, 100, 117, 108, 101, 46, 5, 
+    2, 1, 0, 0, 0, 0, 0, 0, 0, 63, 
+    2, 18, 0, 0, 0, 0, 0, 0, 0, 60, 
     109, 111, 100, 117, 108, 101, 32, 123, 33, 114, 
-    125, 62, 0, 0, 0, 0, 0, 0, 0, 0, 
+    125, 32, 40, 123, 125, 41, 62, 2, 23, 0, 
+    0, 0, 0, 0, 0, 0, 60, 109, 111, 100, 
+    117, 108, 101, 32, 123, 33, 114, 125, 32, 102, 
+    114, 111, 109, 32, 123, 33, 114, 125, 62, 2, 
+    20, 0, 0, 0, 0, 0, 0, 0, 60, 109, 
+    111, 100, 117, 108, 101, 32, 123, 33, 114, 125, 
+    32, 40, 123, 33, 114, 125, 41, 62, 2, 13, 
+    0, 0, 0, 0, 0, 0, 0, 60, 109, 111, 
+    100, 117, 108, 101, 32, 123, 33, 114, 125, 62, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
-    0, 22, 0, 0, 0, 0, 0, 0, 0, 95, 
-    109, 111, 100, 117, 108, 101, 95, 114, 101, 112, 
-    114, 95, 102, 114, 111, 109, 95, 115, 112, 101, 
-    99, 5, 0, 0, 0, 0, 0, 0, 0, 6, 
-    0, 0, 0, 0, 0, 0, 0, 102, 111, 114, 
-    109, 97, 116, 4, 0, 0, 0, 0, 0, 0, 
-    0, 110, 97, 109, 101, 6, 0, 0, 0, 0, 
-    0, 0, 0, 111, 114, 105, 103, 105, 110, 12, 
-    0, 0, 0, 0, 0, 0, 0, 104, 97, 115, 
-    95, 108, 111, 99, 97, 116, 105, 111, 110, 6, 
-    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
-    100, 101, 114, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 115, 112, 101, 
-    99, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
-    97, 109, 101, 32, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 95, 103, 101, 116, 
-    95, 109, 111, 100, 117, 108, 101, 95, 108, 111, 
-    99, 107, 46, 99, 98, 46, 49, 56, 52, 58, 
-    49, 50, 0, 31, 0, 0, 0, 0, 0, 0, 
-    0, 33, 1, 0, 34, 2, 1, 2, 10, 2, 
-    0, 0, 42, 1, 0, 0, 0, 17, 4, 0, 
-    0, 0, 33, 1, 0, 34, 2, 1, 3, 10, 
-    2, 0, 0, 52, 33, 0, 1, 34, 1, 0, 
-    4, 32, 2, 1, 74, 2, 10, 1, 1, 0, 
-    75, 1, 0, 32, 3, 0, 6, 1, 0, 3, 
-    6, 79, 2, 1, 19, 1, 4, 0, 0, 0, 
-    33, 0, 1, 32, 1, 1, 55, 0, 1, 17, 
-    0, 0, 0, 0, 54, 17, 0, 0, 0, 0, 
-    33, 1, 0, 34, 2, 1, 3, 10, 2, 0, 
-    0, 17, 0, 0, 0, 0, 30, 0, 0, 41, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 22, 
+    0, 0, 0, 0, 0, 0, 0, 95, 109, 111, 
+    100, 117, 108, 101, 95, 114, 101, 112, 114, 95, 
+    102, 114, 111, 109, 95, 115, 112, 101, 99, 5, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 102, 111, 114, 109, 97, 
+    116, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
+    97, 109, 101, 6, 0, 0, 0, 0, 0, 0, 
+    0, 111, 114, 105, 103, 105, 110, 12, 0, 0, 
+    0, 0, 0, 0, 0, 104, 97, 115, 95, 108, 
+    111, 99, 97, 116, 105, 111, 110, 6, 0, 0, 
+    0, 0, 0, 0, 0, 108, 111, 97, 100, 101, 
+    114, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 112, 101, 99, 4, 
+    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
+    101, 33, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 46, 95, 103, 101, 116, 95, 109, 
+    111, 100, 117, 108, 101, 95, 108, 111, 99, 107, 
+    46, 99, 98, 46, 49, 56, 52, 58, 49, 50, 
+    0, 27, 0, 0, 0, 0, 0, 0, 0, 33, 
+    1, 0, 34, 2, 1, 2, 1, 32, 38, 2, 
+    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 17, 4, 0, 0, 0, 
+    33, 1, 0, 34, 2, 1, 3, 1, 32, 38, 
+    2, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 52, 33, 0, 1, 
+    34, 1, 0, 4, 1, 32, 32, 2, 1, 38, 
+    1, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 32, 3, 0, 
+    6, 1, 0, 3, 6, 79, 2, 1, 19, 1, 
+    4, 0, 0, 0, 33, 0, 1, 32, 1, 1, 
+    55, 0, 1, 17, 0, 0, 0, 0, 17, 0, 
+    0, 0, 0, 33, 1, 0, 34, 2, 1, 3, 
+    1, 32, 38, 2, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 
+    0, 0, 0, 0, 30, 0, 0, 41, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 20, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 99, 98, 5, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 95, 
-    105, 109, 112, 13, 0, 0, 0, 0, 0, 0, 
-    0, 95, 109, 111, 100, 117, 108, 101, 95, 108, 
-    111, 99, 107, 115, 12, 0, 0, 0, 0, 0, 
-    0, 0, 97, 99, 113, 117, 105, 114, 101, 95, 
-    108, 111, 99, 107, 12, 0, 0, 0, 0, 0, 
-    0, 0, 114, 101, 108, 101, 97, 115, 101, 95, 
-    108, 111, 99, 107, 3, 0, 0, 0, 0, 0, 
-    0, 0, 103, 101, 116, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 114, 
-    101, 102, 4, 0, 0, 0, 0, 0, 0, 0, 
-    110, 97, 109, 101, 32, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    9, 0, 0, 0, 0, 0, 0, 0, 34, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 95, 108, 111, 
-    97, 100, 95, 109, 111, 100, 117, 108, 101, 95, 
-    115, 104, 105, 109, 46, 50, 54, 49, 58, 48, 
-    0, 40, 0, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 33, 1, 0, 32, 2, 1, 32, 3, 
-    0, 74, 2, 74, 3, 10, 1, 2, 0, 75, 
-    1, 0, 75, 1, 0, 45, 2, 0, 32, 1, 
-    1, 33, 0, 1, 27, 2, 0, 4, 6, 3, 
-    1, 2, 8, 79, 0, 3, 22, 3, 6, 0, 
-    0, 0, 33, 1, 3, 32, 2, 2, 74, 2, 
-    10, 1, 1, 0, 75, 1, 0, 41, 0, 33, 
-    1, 1, 27, 0, 1, 4, 32, 2, 1, 1, 
-    1, 0, 2, 45, 3, 1, 33, 2, 2, 32, 
-    1, 2, 32, 3, 3, 74, 1, 74, 3, 10, 
-    2, 2, 0, 75, 1, 0, 75, 1, 0, 33, 
-    4, 1, 27, 0, 4, 4, 32, 1, 1, 1, 
-    2, 0, 1, 41, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 2, 128, 0, 
-    0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 
-    32, 116, 104, 101, 32, 115, 112, 101, 99, 105, 
-    102, 105, 101, 100, 32, 109, 111, 100, 117, 108, 
-    101, 32, 105, 110, 116, 111, 32, 115, 121, 115, 
-    46, 109, 111, 100, 117, 108, 101, 115, 32, 97, 
-    110, 100, 32, 114, 101, 116, 117, 114, 110, 32, 
-    105, 116, 46, 10, 10, 32, 32, 32, 32, 84, 
-    104, 105, 115, 32, 109, 101, 116, 104, 111, 100, 
-    32, 105, 115, 32, 100, 101, 112, 114, 101, 99, 
-    97, 116, 101, 100, 46, 32, 32, 85, 115, 101, 
-    32, 108, 111, 97, 100, 101, 114, 46, 101, 120, 
-    101, 99, 95, 109, 111, 100, 117, 108, 101, 32, 
-    105, 110, 115, 116, 101, 97, 100, 46, 10, 10, 
-    32, 32, 32, 32, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 
-    0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 
-    0, 95, 108, 111, 97, 100, 95, 109, 111, 100, 
-    117, 108, 101, 95, 115, 104, 105, 109, 5, 0, 
-    0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 
-    0, 0, 0, 0, 115, 112, 101, 99, 95, 102, 
-    114, 111, 109, 95, 108, 111, 97, 100, 101, 114, 
-    3, 0, 0, 0, 0, 0, 0, 0, 115, 121, 
-    115, 5, 0, 0, 0, 0, 0, 0, 0, 95, 
-    101, 120, 101, 99, 5, 0, 0, 0, 0, 0, 
-    0, 0, 95, 108, 111, 97, 100, 7, 0, 0, 
-    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
-    101, 115, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 115, 101, 108, 102, 
-    8, 0, 0, 0, 0, 0, 0, 0, 102, 117, 
-    108, 108, 110, 97, 109, 101, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 112, 101, 99, 6, 0, 
-    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
-    108, 101, 32, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 15, 0, 
-    0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 46, 95, 115, 97, 110, 105, 
-    116, 121, 95, 99, 104, 101, 99, 107, 46, 57, 
-    52, 55, 58, 48, 0, 93, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 99, 98, 5, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 95, 105, 109, 112, 13, 0, 0, 
+    0, 0, 0, 0, 0, 95, 109, 111, 100, 117, 
+    108, 101, 95, 108, 111, 99, 107, 115, 12, 0, 
+    0, 0, 0, 0, 0, 0, 97, 99, 113, 117, 
+    105, 114, 101, 95, 108, 111, 99, 107, 12, 0, 
+    0, 0, 0, 0, 0, 0, 114, 101, 108, 101, 
+    97, 115, 101, 95, 108, 111, 99, 107, 3, 0, 
+    0, 0, 0, 0, 0, 0, 103, 101, 116, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 114, 101, 102, 4, 0, 0, 0, 
+    0, 0, 0, 0, 110, 97, 109, 101, 32, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
+    0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 95, 108, 111, 97, 100, 95, 109, 111, 100, 
+    117, 108, 101, 95, 115, 104, 105, 109, 46, 50, 
+    54, 49, 58, 48, 0, 40, 0, 0, 0, 0, 
     0, 0, 0, 30, 0, 0, 33, 1, 0, 32, 
-    2, 0, 33, 3, 1, 74, 2, 74, 3, 10, 
-    1, 2, 0, 75, 1, 0, 75, 1, 0, 49, 
-    4, 0, 3, 79, 1, 4, 22, 4, 61, 0, 
-    0, 0, 32, 0, 2, 30, 1, 1, 6, 2, 
-    0, 1, 2, 79, 3, 2, 22, 2, 50, 0, 
-    0, 0, 32, 0, 2, 30, 1, 1, 6, 2, 
-    0, 1, 4, 79, 3, 2, 19, 2, 17, 0, 
-    0, 0, 33, 1, 0, 32, 2, 1, 33, 3, 
-    1, 74, 2, 74, 3, 10, 1, 2, 0, 75, 
-    1, 0, 75, 1, 0, 49, 4, 0, 3, 79, 
-    1, 4, 22, 4, 28, 0, 0, 0, 32, 0, 
-    1, 49, 1, 0, 3, 79, 2, 1, 22, 1, 
-    18, 0, 0, 0, 17, 0, 0, 0, 0, 17, 
-    0, 0, 0, 0, 32, 0, 0, 49, 1, 0, 
-    3, 79, 2, 1, 19, 1, 4, 0, 0, 0, 
-    32, 0, 2, 30, 2, 1, 6, 1, 0, 2, 
-    0, 17, 0, 0, 0, 0, 79, 0, 1, 19, 
-    1, 42, 0, 0, 0, 33, 2, 4, 30, 1, 
-    2, 74, 1, 10, 2, 1, 0, 75, 1, 248, 
-    40, 1, 0, 33, 1, 5, 30, 2, 3, 74, 
-    2, 10, 1, 1, 0, 75, 1, 95, 40, 1, 
-    0, 33, 1, 2, 30, 2, 4, 74, 2, 10, 
-    1, 1, 0, 75, 1, 215, 40, 1, 0, 33, 
-    1, 4, 30, 2, 5, 74, 2, 10, 1, 1, 
-    0, 75, 1, 89, 40, 1, 0, 33, 1, 2, 
-    30, 0, 6, 34, 2, 0, 6, 33, 3, 3, 
-    32, 4, 0, 74, 4, 10, 3, 1, 0, 75, 
-    1, 189, 74, 0, 74, 0, 10, 2, 1, 0, 
-    75, 1, 251, 39, 5, 0, 75, 0, 0, 74, 
-    5, 10, 1, 1, 0, 75, 1, 250, 40, 1, 
-    0, 30, 1, 7, 41, 1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    2, 1, 32, 3, 0, 74, 2, 74, 3, 10, 
+    1, 2, 0, 75, 1, 0, 75, 1, 0, 45, 
+    2, 0, 32, 1, 1, 33, 0, 1, 27, 2, 
+    0, 4, 6, 3, 1, 2, 8, 79, 0, 3, 
+    22, 3, 6, 0, 0, 0, 33, 1, 3, 32, 
+    2, 2, 74, 2, 10, 1, 1, 0, 75, 1, 
+    0, 41, 0, 33, 1, 1, 27, 0, 1, 4, 
+    32, 2, 1, 1, 1, 0, 2, 45, 3, 1, 
+    33, 2, 2, 32, 1, 2, 32, 3, 3, 74, 
+    1, 74, 3, 10, 2, 2, 0, 75, 1, 0, 
+    75, 1, 0, 33, 4, 1, 27, 0, 4, 4, 
+    32, 1, 1, 1, 2, 0, 1, 41, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    8, 0, 0, 0, 0, 0, 0, 0, 2, 28, 
-    0, 0, 0, 0, 0, 0, 0, 86, 101, 114, 
-    105, 102, 121, 32, 97, 114, 103, 117, 109, 101, 
-    110, 116, 115, 32, 97, 114, 101, 32, 34, 115, 
-    97, 110, 101, 34, 46, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 17, 0, 0, 0, 0, 
-    0, 0, 0, 69, 109, 112, 116, 121, 32, 109, 
-    111, 100, 117, 108, 101, 32, 110, 97, 109, 101, 
-    2, 54, 0, 0, 0, 0, 0, 0, 0, 97, 
-    116, 116, 101, 109, 112, 116, 101, 100, 32, 114, 
-    101, 108, 97, 116, 105, 118, 101, 32, 105, 109, 
-    112, 111, 114, 116, 32, 119, 105, 116, 104, 32, 
-    110, 111, 32, 107, 110, 111, 119, 110, 32, 112, 
-    97, 114, 101, 110, 116, 32, 112, 97, 99, 107, 
-    97, 103, 101, 2, 31, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 112, 97, 99, 107, 97, 103, 
-    101, 95, 95, 32, 110, 111, 116, 32, 115, 101, 
-    116, 32, 116, 111, 32, 97, 32, 115, 116, 114, 
-    105, 110, 103, 2, 18, 0, 0, 0, 0, 0, 
-    0, 0, 108, 101, 118, 101, 108, 32, 109, 117, 
-    115, 116, 32, 98, 101, 32, 62, 61, 32, 48, 
-    2, 31, 0, 0, 0, 0, 0, 0, 0, 109, 
-    111, 100, 117, 108, 101, 32, 110, 97, 109, 101, 
-    32, 109, 117, 115, 116, 32, 98, 101, 32, 115, 
-    116, 114, 44, 32, 110, 111, 116, 32, 123, 125, 
-    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    128, 0, 0, 0, 0, 0, 0, 0, 76, 111, 
+    97, 100, 32, 116, 104, 101, 32, 115, 112, 101, 
+    99, 105, 102, 105, 101, 100, 32, 109, 111, 100, 
+    117, 108, 101, 32, 105, 110, 116, 111, 32, 115, 
+    121, 115, 46, 109, 111, 100, 117, 108, 101, 115, 
+    32, 97, 110, 100, 32, 114, 101, 116, 117, 114, 
+    110, 32, 105, 116, 46, 10, 10, 32, 32, 32, 
+    32, 84, 104, 105, 115, 32, 109, 101, 116, 104, 
+    111, 100, 32, 105, 115, 32, 100, 101, 112, 114, 
+    101, 99, 97, 116, 101, 100, 46, 32, 32, 85, 
+    115, 101, 32, 108, 111, 97, 100, 101, 114, 46, 
+    101, 120, 101, 99, 95, 109, 111, 100, 117, 108, 
+    101, 32, 105, 110, 115, 116, 101, 97, 100, 46, 
+    10, 10, 32, 32, 32, 32, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 
-    13, 0, 0, 0, 0, 0, 0, 0, 95, 115, 
-    97, 110, 105, 116, 121, 95, 99, 104, 101, 99, 
-    107, 7, 0, 0, 0, 0, 0, 0, 0, 10, 
-    0, 0, 0, 0, 0, 0, 0, 105, 115, 105, 
-    110, 115, 116, 97, 110, 99, 101, 3, 0, 0, 
-    0, 0, 0, 0, 0, 115, 116, 114, 9, 0, 
-    0, 0, 0, 0, 0, 0, 84, 121, 112, 101, 
-    69, 114, 114, 111, 114, 4, 0, 0, 0, 0, 
-    0, 0, 0, 116, 121, 112, 101, 10, 0, 0, 
-    0, 0, 0, 0, 0, 86, 97, 108, 117, 101, 
-    69, 114, 114, 111, 114, 11, 0, 0, 0, 0, 
-    0, 0, 0, 73, 109, 112, 111, 114, 116, 69, 
-    114, 114, 111, 114, 6, 0, 0, 0, 0, 0, 
-    0, 0, 102, 111, 114, 109, 97, 116, 0, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 7, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 99, 107, 97, 103, 
-    101, 5, 0, 0, 0, 0, 0, 0, 0, 108, 
-    101, 118, 101, 108, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
+    0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    0, 0, 0, 95, 108, 111, 97, 100, 95, 109, 
+    111, 100, 117, 108, 101, 95, 115, 104, 105, 109, 
+    5, 0, 0, 0, 0, 0, 0, 0, 16, 0, 
+    0, 0, 0, 0, 0, 0, 115, 112, 101, 99, 
+    95, 102, 114, 111, 109, 95, 108, 111, 97, 100, 
+    101, 114, 3, 0, 0, 0, 0, 0, 0, 0, 
+    115, 121, 115, 5, 0, 0, 0, 0, 0, 0, 
+    0, 95, 101, 120, 101, 99, 5, 0, 0, 0, 
+    0, 0, 0, 0, 95, 108, 111, 97, 100, 7, 
+    0, 0, 0, 0, 0, 0, 0, 109, 111, 100, 
+    117, 108, 101, 115, 0, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 8, 0, 0, 0, 0, 0, 0, 0, 
+    102, 117, 108, 108, 110, 97, 109, 101, 4, 0, 
+    0, 0, 0, 0, 0, 0, 115, 112, 101, 99, 
+    6, 0, 0, 0, 0, 0, 0, 0, 109, 111, 
+    100, 117, 108, 101, 33, 0, 0, 0, 0, 0, 
     0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 34, 0, 
+    15, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
     0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 77, 111, 100, 
-    117, 108, 101, 83, 112, 101, 99, 46, 95, 95, 
-    101, 113, 95, 95, 46, 51, 55, 50, 58, 52, 
-    0, 56, 0, 0, 0, 0, 0, 0, 0, 32, 
-    0, 0, 27, 1, 0, 2, 45, 2, 1, 42, 
-    1, 0, 0, 0, 17, 9, 0, 0, 0, 33, 
-    0, 0, 21, 0, 4, 0, 0, 0, 33, 1, 
-    1, 5, 17, 0, 0, 0, 0, 41, 1, 52, 
-    30, 0, 0, 41, 0, 32, 1, 0, 27, 0, 
-    1, 3, 32, 2, 1, 27, 1, 2, 3, 6, 
-    3, 0, 1, 0, 79, 2, 3, 19, 3, 33, 
-    0, 0, 0, 32, 0, 0, 27, 1, 0, 4, 
-    32, 2, 1, 27, 0, 2, 4, 6, 3, 1, 
-    0, 0, 79, 2, 3, 19, 3, 26, 0, 0, 
-    0, 32, 0, 0, 27, 1, 0, 5, 32, 2, 
-    1, 27, 0, 2, 5, 6, 3, 1, 0, 0, 
-    79, 2, 3, 19, 3, 19, 0, 0, 0, 32, 
-    0, 2, 32, 1, 1, 27, 2, 1, 2, 6, 
-    3, 0, 2, 0, 79, 1, 3, 19, 3, 13, 
-    0, 0, 0, 32, 0, 0, 27, 1, 0, 6, 
-    32, 2, 1, 27, 0, 2, 6, 6, 3, 1, 
-    0, 0, 79, 2, 3, 19, 3, 6, 0, 0, 
-    0, 32, 0, 0, 27, 1, 0, 7, 32, 2, 
-    1, 27, 0, 2, 7, 6, 3, 1, 0, 0, 
-    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
-    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    116, 115, 116, 114, 97, 112, 46, 95, 115, 97, 
+    110, 105, 116, 121, 95, 99, 104, 101, 99, 107, 
+    46, 57, 52, 55, 58, 48, 0, 91, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
+    0, 32, 2, 0, 33, 3, 1, 74, 2, 74, 
+    3, 10, 1, 2, 0, 75, 1, 0, 75, 1, 
+    0, 49, 4, 0, 3, 79, 1, 4, 22, 4, 
+    61, 0, 0, 0, 32, 0, 2, 30, 1, 1, 
+    6, 2, 0, 1, 2, 79, 3, 2, 22, 2, 
+    50, 0, 0, 0, 32, 0, 2, 30, 1, 1, 
+    6, 2, 0, 1, 4, 79, 3, 2, 19, 2, 
+    17, 0, 0, 0, 33, 1, 0, 32, 2, 1, 
+    33, 3, 1, 74, 2, 74, 3, 10, 1, 2, 
+    0, 75, 1, 0, 75, 1, 0, 49, 4, 0, 
+    3, 79, 1, 4, 22, 4, 28, 0, 0, 0, 
+    32, 0, 1, 49, 1, 0, 3, 79, 2, 1, 
+    22, 1, 18, 0, 0, 0, 17, 0, 0, 0, 
+    0, 17, 0, 0, 0, 0, 32, 0, 0, 49, 
+    1, 0, 3, 79, 2, 1, 19, 1, 4, 0, 
+    0, 0, 32, 0, 2, 30, 2, 1, 6, 1, 
+    0, 2, 0, 17, 0, 0, 0, 0, 79, 0, 
+    1, 19, 1, 40, 0, 0, 0, 33, 2, 4, 
+    30, 1, 2, 74, 1, 10, 2, 1, 0, 75, 
+    1, 248, 40, 1, 0, 33, 1, 5, 30, 2, 
+    3, 74, 2, 10, 1, 1, 0, 75, 1, 95, 
+    40, 1, 0, 33, 1, 2, 30, 2, 4, 74, 
+    2, 10, 1, 1, 0, 75, 1, 215, 40, 1, 
+    0, 33, 1, 4, 30, 2, 5, 74, 2, 10, 
+    1, 1, 0, 75, 1, 89, 40, 1, 0, 33, 
+    1, 2, 30, 0, 6, 34, 2, 0, 6, 1, 
+    32, 33, 3, 3, 32, 4, 0, 74, 4, 10, 
+    3, 1, 0, 75, 1, 189, 74, 0, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 39, 5, 0, 75, 
+    0, 0, 74, 5, 10, 1, 1, 0, 75, 1, 
+    250, 40, 1, 0, 30, 1, 7, 41, 1, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 2, 
+    28, 0, 0, 0, 0, 0, 0, 0, 86, 101, 
+    114, 105, 102, 121, 32, 97, 114, 103, 117, 109, 
+    101, 110, 116, 115, 32, 97, 114, 101, 32, 34, 
+    115, 97, 110, 101, 34, 46, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 17, 0, 0, 0, 
+    0, 0, 0, 0, 69, 109, 112, 116, 121, 32, 
+    109, 111, 100, 117, 108, 101, 32, 110, 97, 109, 
+    101, 2, 54, 0, 0, 0, 0, 0, 0, 0, 
+    97, 116, 116, 101, 109, 112, 116, 101, 100, 32, 
+    114, 101, 108, 97, 116, 105, 118, 101, 32, 105, 
+    109, 112, 111, 114, 116, 32, 119, 105, 116, 104, 
+    32, 110, 111, 32, 107, 110, 111, 119, 110, 32, 
+    112, 97, 114, 101, 110, 116, 32, 112, 97, 99, 
+    107, 97, 103, 101, 2, 31, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 112, 97, 99, 107, 97, 
+    103, 101, 95, 95, 32, 110, 111, 116, 32, 115, 
+    101, 116, 32, 116, 111, 32, 97, 32, 115, 116, 
+    114, 105, 110, 103, 2, 18, 0, 0, 0, 0, 
+    0, 0, 0, 108, 101, 118, 101, 108, 32, 109, 
+    117, 115, 116, 32, 98, 101, 32, 62, 61, 32, 
+    48, 2, 31, 0, 0, 0, 0, 0, 0, 0, 
+    109, 111, 100, 117, 108, 101, 32, 110, 97, 109, 
+    101, 32, 109, 117, 115, 116, 32, 98, 101, 32, 
+    115, 116, 114, 44, 32, 110, 111, 116, 32, 123, 
+    125, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 101, 113, 95, 95, 8, 0, 
-    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 
-    0, 0, 0, 0, 65, 116, 116, 114, 105, 98, 
-    117, 116, 101, 69, 114, 114, 111, 114, 14, 0, 
-    0, 0, 0, 0, 0, 0, 78, 111, 116, 73, 
-    109, 112, 108, 101, 109, 101, 110, 116, 101, 100, 
-    26, 0, 0, 0, 0, 0, 0, 0, 115, 117, 
-    98, 109, 111, 100, 117, 108, 101, 95, 115, 101, 
-    97, 114, 99, 104, 95, 108, 111, 99, 97, 116, 
-    105, 111, 110, 115, 4, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 6, 0, 0, 0, 
-    0, 0, 0, 0, 108, 111, 97, 100, 101, 114, 
-    6, 0, 0, 0, 0, 0, 0, 0, 111, 114, 
-    105, 103, 105, 110, 6, 0, 0, 0, 0, 0, 
-    0, 0, 99, 97, 99, 104, 101, 100, 12, 0, 
-    0, 0, 0, 0, 0, 0, 104, 97, 115, 95, 
-    108, 111, 99, 97, 116, 105, 111, 110, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 95, 
+    115, 97, 110, 105, 116, 121, 95, 99, 104, 101, 
+    99, 107, 7, 0, 0, 0, 0, 0, 0, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 105, 115, 
+    105, 110, 115, 116, 97, 110, 99, 101, 3, 0, 
+    0, 0, 0, 0, 0, 0, 115, 116, 114, 9, 
+    0, 0, 0, 0, 0, 0, 0, 84, 121, 112, 
+    101, 69, 114, 114, 111, 114, 4, 0, 0, 0, 
+    0, 0, 0, 0, 116, 121, 112, 101, 10, 0, 
+    0, 0, 0, 0, 0, 0, 86, 97, 108, 117, 
+    101, 69, 114, 114, 111, 114, 11, 0, 0, 0, 
+    0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 
+    69, 114, 114, 111, 114, 6, 0, 0, 0, 0, 
+    0, 0, 0, 102, 111, 114, 109, 97, 116, 0, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 110, 97, 109, 101, 7, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 99, 107, 97, 
+    103, 101, 5, 0, 0, 0, 0, 0, 0, 0, 
+    108, 101, 118, 101, 108, 32, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 34, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 77, 111, 
+    100, 117, 108, 101, 83, 112, 101, 99, 46, 95, 
+    95, 101, 113, 95, 95, 46, 51, 55, 50, 58, 
+    52, 0, 55, 0, 0, 0, 0, 0, 0, 0, 
+    32, 0, 0, 27, 1, 0, 2, 45, 2, 1, 
+    17, 9, 0, 0, 0, 33, 0, 0, 21, 0, 
+    4, 0, 0, 0, 33, 1, 1, 5, 17, 0, 
+    0, 0, 0, 41, 1, 52, 30, 0, 0, 41, 
+    0, 32, 1, 0, 27, 0, 1, 3, 32, 2, 
+    1, 27, 1, 2, 3, 6, 3, 0, 1, 0, 
+    79, 2, 3, 19, 3, 33, 0, 0, 0, 32, 
+    0, 0, 27, 1, 0, 4, 32, 2, 1, 27, 
+    0, 2, 4, 6, 3, 1, 0, 0, 79, 2, 
+    3, 19, 3, 26, 0, 0, 0, 32, 0, 0, 
+    27, 1, 0, 5, 32, 2, 1, 27, 0, 2, 
+    5, 6, 3, 1, 0, 0, 79, 2, 3, 19, 
+    3, 19, 0, 0, 0, 32, 0, 2, 32, 1, 
+    1, 27, 2, 1, 2, 6, 3, 0, 2, 0, 
+    79, 1, 3, 19, 3, 13, 0, 0, 0, 32, 
+    0, 0, 27, 1, 0, 6, 32, 2, 1, 27, 
+    0, 2, 6, 6, 3, 1, 0, 0, 79, 2, 
+    3, 19, 3, 6, 0, 0, 0, 32, 0, 0, 
+    27, 1, 0, 7, 32, 2, 1, 27, 0, 2, 
+    7, 6, 3, 1, 0, 0, 17, 0, 0, 0, 
+    0, 17, 0, 0, 0, 0, 41, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
     0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 108, 102, 5, 0, 0, 0, 
-    0, 0, 0, 0, 111, 116, 104, 101, 114, 4, 
-    0, 0, 0, 0, 0, 0, 0, 115, 109, 115, 
-    108, 32, 0, 0, 0, 0, 0, 0, 0, 10, 
-    0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 
-    0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 102, 105, 110, 100, 95, 
-    115, 112, 101, 99, 46, 57, 48, 48, 58, 48, 
-    0, 182, 0, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 33, 1, 0, 27, 0, 1, 10, 45, 
-    3, 0, 32, 1, 3, 30, 0, 1, 6, 2, 
-    1, 0, 6, 79, 3, 2, 22, 2, 14, 0, 
-    0, 0, 32, 0, 3, 49, 1, 0, 3, 79, 
-    2, 1, 19, 1, 16, 0, 0, 0, 33, 0, 
-    2, 34, 1, 0, 7, 30, 2, 2, 33, 3, 
-    3, 74, 2, 74, 3, 10, 1, 2, 0, 75, 
-    1, 0, 75, 1, 0, 17, 6, 0, 0, 0, 
-    33, 1, 1, 30, 2, 3, 74, 2, 10, 1, 
-    1, 0, 75, 1, 215, 40, 1, 0, 32, 1, 
-    0, 33, 0, 0, 27, 2, 0, 11, 6, 3, 
-    1, 2, 8, 45, 4, 3, 32, 1, 3, 13, 
-    0, 1, 17, 0, 0, 0, 0, 9, 1, 0, 
-    97, 0, 0, 0, 0, 0, 0, 0, 45, 5, 
-    1, 17, 0, 0, 0, 0, 33, 2, 4, 74, 
-    0, 10, 2, 0, 0, 39, 3, 0, 75, 0, 
-    0, 34, 4, 3, 8, 74, 0, 10, 4, 0, 
-    0, 39, 2, 0, 75, 0, 0, 56, 1, 0, 
-    0, 0, 17, 10, 0, 0, 0, 34, 2, 3, 
-    9, 74, 0, 53, 4, 2, 39, 4, 0, 75, 
-    0, 0, 79, 5, 4, 22, 4, 1, 0, 0, 
-    0, 52, 5, 17, 66, 0, 0, 0, 42, 1, 
-    0, 0, 0, 17, 27, 0, 0, 0, 33, 2, 
-    5, 21, 2, 24, 0, 0, 0, 33, 4, 6, 
-    32, 2, 5, 32, 5, 0, 32, 6, 1, 74, 
-    0, 74, 2, 74, 5, 74, 6, 10, 4, 3, 
-    0, 75, 1, 148, 75, 1, 0, 75, 1, 254, 
-    39, 7, 0, 75, 0, 0, 45, 7, 7, 32, 
-    2, 7, 30, 4, 1, 6, 5, 2, 4, 6, 
-    79, 6, 5, 22, 5, 2, 0, 0, 0, 5, 
-    17, 24, 0, 0, 0, 17, 0, 0, 0, 0, 
-    17, 44, 0, 0, 0, 52, 32, 2, 5, 27, 
-    4, 2, 12, 45, 6, 4, 54, 17, 0, 0, 
-    0, 0, 32, 2, 6, 32, 4, 0, 32, 5, 
-    1, 32, 6, 2, 74, 0, 74, 4, 74, 5, 
-    74, 6, 10, 2, 3, 0, 75, 1, 221, 75, 
-    1, 189, 75, 1, 0, 39, 7, 0, 75, 0, 
-    0, 45, 7, 7, 17, 0, 0, 0, 0, 54, 
-    17, 0, 0, 0, 0, 34, 2, 3, 9, 30, 
-    4, 1, 74, 0, 74, 4, 74, 4, 74, 4, 
-    10, 2, 3, 0, 75, 1, 188, 75, 1, 189, 
-    75, 1, 88, 39, 3, 0, 75, 0, 0, 5, 
-    17, 0, 0, 0, 0, 32, 2, 7, 30, 3, 
-    1, 6, 4, 2, 3, 7, 79, 5, 4, 22, 
-    4, 4, 0, 0, 0, 17, 0, 0, 0, 0, 
-    9, 1, 0, 0, 0, 0, 0, 159, 255, 255, 
-    255, 30, 2, 1, 41, 2, 32, 0, 4, 49, 
-    1, 0, 3, 79, 2, 1, 19, 1, 5, 0, 
-    0, 0, 32, 0, 0, 33, 2, 0, 27, 3, 
-    2, 11, 6, 1, 0, 3, 8, 17, 0, 0, 
-    0, 0, 79, 0, 1, 22, 1, 2, 0, 0, 
-    0, 32, 0, 7, 41, 0, 33, 1, 0, 27, 
-    0, 1, 11, 32, 2, 0, 1, 1, 0, 2, 
-    45, 8, 1, 42, 1, 0, 0, 0, 17, 9, 
-    0, 0, 0, 33, 0, 5, 21, 0, 4, 0, 
-    0, 0, 32, 1, 7, 5, 17, 0, 0, 0, 
-    0, 41, 1, 52, 30, 0, 1, 41, 0, 32, 
-    1, 8, 27, 0, 1, 13, 45, 9, 0, 54, 
-    17, 0, 0, 0, 0, 32, 0, 9, 30, 1, 
-    1, 6, 2, 0, 1, 6, 79, 3, 2, 22, 
-    2, 3, 0, 0, 0, 32, 0, 9, 17, 0, 
-    0, 0, 0, 41, 0, 32, 1, 7, 17, 0, 
-    0, 0, 0, 41, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 2, 21, 0, 
-    0, 0, 0, 0, 0, 0, 70, 105, 110, 100, 
-    32, 97, 32, 109, 111, 100, 117, 108, 101, 39, 
-    115, 32, 115, 112, 101, 99, 46, 5, 2, 22, 
-    0, 0, 0, 0, 0, 0, 0, 115, 121, 115, 
-    46, 109, 101, 116, 97, 95, 112, 97, 116, 104, 
-    32, 105, 115, 32, 101, 109, 112, 116, 121, 2, 
-    53, 0, 0, 0, 0, 0, 0, 0, 115, 121, 
-    115, 46, 109, 101, 116, 97, 95, 112, 97, 116, 
-    104, 32, 105, 115, 32, 78, 111, 110, 101, 44, 
-    32, 80, 121, 116, 104, 111, 110, 32, 105, 115, 
-    32, 108, 105, 107, 101, 108, 121, 32, 115, 104, 
-    117, 116, 116, 105, 110, 103, 32, 100, 111, 119, 
-    110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    13, 0, 0, 0, 0, 0, 0, 0, 55, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 95, 102, 
-    105, 110, 100, 95, 115, 112, 101, 99, 14, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 115, 121, 115, 11, 0, 0, 
-    0, 0, 0, 0, 0, 73, 109, 112, 111, 114, 
-    116, 69, 114, 114, 111, 114, 9, 0, 0, 0, 
-    0, 0, 0, 0, 95, 119, 97, 114, 110, 105, 
-    110, 103, 115, 13, 0, 0, 0, 0, 0, 0, 
-    0, 73, 109, 112, 111, 114, 116, 87, 97, 114, 
-    110, 105, 110, 103, 18, 0, 0, 0, 0, 0, 
-    0, 0, 95, 73, 109, 112, 111, 114, 116, 76, 
-    111, 99, 107, 67, 111, 110, 116, 101, 120, 116, 
-    14, 0, 0, 0, 0, 0, 0, 0, 65, 116, 
-    116, 114, 105, 98, 117, 116, 101, 69, 114, 114, 
-    111, 114, 17, 0, 0, 0, 0, 0, 0, 0, 
-    95, 102, 105, 110, 100, 95, 115, 112, 101, 99, 
-    95, 108, 101, 103, 97, 99, 121, 4, 0, 0, 
-    0, 0, 0, 0, 0, 119, 97, 114, 110, 9, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 101, 
-    110, 116, 101, 114, 95, 95, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 101, 120, 105, 116, 
-    95, 95, 9, 0, 0, 0, 0, 0, 0, 0, 
-    109, 101, 116, 97, 95, 112, 97, 116, 104, 7, 
-    0, 0, 0, 0, 0, 0, 0, 109, 111, 100, 
-    117, 108, 101, 115, 9, 0, 0, 0, 0, 0, 
-    0, 0, 102, 105, 110, 100, 95, 115, 112, 101, 
-    99, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 115, 112, 101, 99, 95, 95, 0, 0, 0, 
-    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 110, 97, 109, 101, 4, 0, 0, 0, 0, 
-    0, 0, 0, 112, 97, 116, 104, 6, 0, 0, 
-    0, 0, 0, 0, 0, 116, 97, 114, 103, 101, 
-    116, 9, 0, 0, 0, 0, 0, 0, 0, 109, 
-    101, 116, 97, 95, 112, 97, 116, 104, 9, 0, 
-    0, 0, 0, 0, 0, 0, 105, 115, 95, 114, 
-    101, 108, 111, 97, 100, 6, 0, 0, 0, 0, 
-    0, 0, 0, 102, 105, 110, 100, 101, 114, 9, 
-    0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 
-    100, 95, 115, 112, 101, 99, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 112, 101, 99, 6, 0, 
-    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
-    108, 101, 8, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 115, 112, 101, 99, 95, 95, 32, 0, 
-    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
-    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
-    0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 109, 111, 100, 117, 108, 101, 95, 114, 
-    101, 112, 114, 46, 50, 55, 55, 58, 48, 0, 
-    126, 0, 0, 0, 0, 0, 0, 0, 33, 1, 
-    0, 32, 2, 0, 30, 3, 0, 30, 4, 1, 
-    74, 2, 74, 3, 74, 4, 10, 1, 3, 0, 
-    75, 1, 0, 75, 1, 0, 75, 1, 0, 45, 
-    1, 0, 33, 1, 1, 32, 2, 1, 30, 3, 
-    2, 74, 2, 74, 3, 10, 1, 2, 0, 75, 
-    1, 0, 75, 1, 0, 79, 4, 0, 19, 0, 
-    8, 0, 0, 0, 42, 1, 0, 0, 0, 17, 
-    94, 0, 0, 0, 33, 0, 2, 21, 0, 3, 
-    0, 0, 0, 5, 17, 0, 0, 0, 0, 17, 
-    1, 0, 0, 0, 52, 42, 1, 0, 0, 0, 
-    17, 5, 0, 0, 0, 33, 0, 3, 21, 0, 
-    2, 0, 0, 0, 5, 17, 12, 0, 0, 0, 
-    52, 32, 0, 0, 27, 1, 0, 7, 45, 2, 
-    1, 54, 17, 0, 0, 0, 0, 32, 0, 2, 
-    30, 1, 1, 6, 2, 0, 1, 7, 79, 3, 
-    2, 22, 2, 64, 0, 0, 0, 17, 0, 0, 
-    0, 0, 42, 1, 0, 0, 0, 17, 7, 0, 
-    0, 0, 33, 0, 3, 21, 0, 4, 0, 0, 
-    0, 30, 1, 3, 45, 3, 1, 5, 17, 6, 
-    0, 0, 0, 52, 32, 0, 0, 27, 1, 0, 
-    8, 45, 3, 1, 54, 17, 0, 0, 0, 0, 
-    42, 1, 0, 0, 0, 17, 31, 0, 0, 0, 
-    33, 0, 3, 21, 0, 26, 0, 0, 0, 32, 
-    1, 1, 30, 0, 1, 6, 2, 1, 0, 6, 
-    79, 3, 2, 22, 2, 12, 0, 0, 0, 30, 
-    0, 4, 34, 1, 0, 6, 32, 2, 3, 32, 
-    3, 1, 74, 2, 74, 3, 10, 1, 2, 0, 
-    75, 1, 25, 75, 1, 4, 5, 17, 0, 0, 
-    0, 0, 41, 0, 30, 1, 5, 34, 2, 1, 
-    6, 32, 3, 3, 74, 3, 10, 2, 1, 0, 
-    75, 1, 127, 5, 17, 0, 0, 0, 0, 41, 
-    0, 52, 30, 0, 1, 41, 0, 32, 1, 0, 
-    27, 0, 1, 9, 45, 4, 0, 54, 17, 0, 
-    0, 0, 0, 30, 0, 6, 34, 1, 0, 6, 
-    32, 2, 3, 32, 3, 4, 74, 2, 74, 3, 
-    10, 1, 2, 0, 75, 1, 75, 75, 1, 189, 
-    17, 0, 0, 0, 0, 41, 0, 33, 1, 4, 
-    32, 2, 2, 74, 2, 10, 1, 1, 0, 75, 
-    1, 219, 17, 0, 0, 0, 0, 41, 0, 32, 
-    1, 1, 34, 2, 1, 5, 32, 3, 0, 74, 
-    3, 10, 2, 1, 0, 75, 1, 188, 17, 0, 
-    0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 101, 113, 95, 95, 
+    8, 0, 0, 0, 0, 0, 0, 0, 14, 0, 
+    0, 0, 0, 0, 0, 0, 65, 116, 116, 114, 
+    105, 98, 117, 116, 101, 69, 114, 114, 111, 114, 
+    14, 0, 0, 0, 0, 0, 0, 0, 78, 111, 
+    116, 73, 109, 112, 108, 101, 109, 101, 110, 116, 
+    101, 100, 26, 0, 0, 0, 0, 0, 0, 0, 
+    115, 117, 98, 109, 111, 100, 117, 108, 101, 95, 
+    115, 101, 97, 114, 99, 104, 95, 108, 111, 99, 
+    97, 116, 105, 111, 110, 115, 4, 0, 0, 0, 
+    0, 0, 0, 0, 110, 97, 109, 101, 6, 0, 
+    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
+    101, 114, 6, 0, 0, 0, 0, 0, 0, 0, 
+    111, 114, 105, 103, 105, 110, 6, 0, 0, 0, 
+    0, 0, 0, 0, 99, 97, 99, 104, 101, 100, 
+    12, 0, 0, 0, 0, 0, 0, 0, 104, 97, 
+    115, 95, 108, 111, 99, 97, 116, 105, 111, 110, 
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 115, 101, 108, 102, 5, 0, 
+    0, 0, 0, 0, 0, 0, 111, 116, 104, 101, 
+    114, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+    109, 115, 108, 33, 0, 0, 0, 0, 0, 0, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 28, 
+    0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 46, 95, 102, 105, 110, 
+    100, 95, 115, 112, 101, 99, 46, 57, 48, 48, 
+    58, 48, 0, 166, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 33, 1, 0, 27, 0, 1, 
+    10, 45, 3, 0, 32, 1, 3, 30, 0, 1, 
+    6, 2, 1, 0, 6, 79, 3, 2, 22, 2, 
+    10, 0, 0, 0, 32, 0, 3, 49, 1, 0, 
+    3, 79, 2, 1, 19, 1, 12, 0, 0, 0, 
+    33, 0, 2, 34, 1, 0, 7, 1, 32, 30, 
+    2, 2, 33, 3, 3, 38, 1, 32, 2, 0, 
+    0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 17, 6, 0, 0, 0, 33, 
+    1, 1, 30, 2, 3, 74, 2, 10, 1, 1, 
+    0, 75, 1, 215, 40, 1, 0, 32, 1, 0, 
+    33, 0, 0, 27, 2, 0, 11, 6, 3, 1, 
+    2, 8, 45, 4, 3, 32, 1, 3, 13, 0, 
+    1, 17, 0, 0, 0, 0, 9, 1, 0, 87, 
+    0, 0, 0, 0, 0, 0, 0, 45, 5, 1, 
+    17, 0, 0, 0, 0, 33, 2, 4, 74, 0, 
+    10, 2, 0, 0, 39, 3, 0, 75, 0, 0, 
+    34, 4, 3, 8, 1, 32, 74, 0, 38, 4, 
+    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 39, 2, 0, 75, 0, 
+    0, 17, 10, 0, 0, 0, 34, 2, 3, 9, 
+    0, 0, 74, 0, 53, 4, 2, 39, 4, 0, 
+    75, 0, 0, 79, 5, 4, 22, 4, 1, 0, 
+    0, 0, 52, 5, 17, 57, 0, 0, 0, 17, 
+    27, 0, 0, 0, 33, 2, 5, 21, 2, 24, 
+    0, 0, 0, 33, 4, 6, 32, 2, 5, 32, 
+    5, 0, 32, 6, 1, 74, 0, 74, 2, 74, 
+    5, 74, 6, 10, 4, 3, 0, 75, 1, 148, 
+    75, 1, 0, 75, 1, 254, 39, 7, 0, 75, 
+    0, 0, 45, 7, 7, 32, 2, 7, 30, 4, 
+    1, 6, 5, 2, 4, 6, 79, 6, 5, 22, 
+    5, 2, 0, 0, 0, 5, 17, 23, 0, 0, 
+    0, 17, 0, 0, 0, 0, 17, 36, 0, 0, 
+    0, 52, 32, 2, 5, 27, 4, 2, 12, 45, 
+    6, 4, 17, 0, 0, 0, 0, 32, 2, 6, 
+    32, 4, 0, 32, 5, 1, 32, 6, 2, 74, 
+    0, 74, 4, 74, 5, 74, 6, 10, 2, 3, 
+    0, 75, 1, 221, 75, 1, 189, 75, 1, 0, 
+    39, 7, 0, 75, 0, 0, 45, 7, 7, 17, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 34, 
+    2, 3, 9, 1, 32, 30, 4, 1, 74, 0, 
+    38, 2, 32, 3, 0, 0, 0, 0, 0, 0, 
+    0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    39, 3, 0, 75, 0, 0, 5, 17, 0, 0, 
+    0, 0, 32, 2, 7, 30, 3, 1, 6, 4, 
+    2, 3, 7, 79, 5, 4, 22, 4, 4, 0, 
+    0, 0, 17, 0, 0, 0, 0, 9, 1, 0, 
+    0, 0, 0, 0, 169, 255, 255, 255, 30, 2, 
+    1, 41, 2, 32, 0, 4, 49, 1, 0, 3, 
+    79, 2, 1, 19, 1, 5, 0, 0, 0, 32, 
+    0, 0, 33, 2, 0, 27, 3, 2, 11, 6, 
+    1, 0, 3, 8, 17, 0, 0, 0, 0, 79, 
+    0, 1, 22, 1, 2, 0, 0, 0, 32, 0, 
+    7, 41, 0, 33, 1, 0, 27, 0, 1, 11, 
+    32, 2, 0, 1, 1, 0, 2, 45, 8, 1, 
+    17, 9, 0, 0, 0, 33, 0, 5, 21, 0, 
+    4, 0, 0, 0, 32, 1, 7, 5, 17, 0, 
+    0, 0, 0, 41, 1, 52, 30, 0, 1, 41, 
+    0, 32, 1, 8, 27, 0, 1, 13, 45, 9, 
+    0, 17, 0, 0, 0, 0, 32, 0, 9, 30, 
+    1, 1, 6, 2, 0, 1, 6, 79, 3, 2, 
+    22, 2, 3, 0, 0, 0, 32, 0, 9, 17, 
+    0, 0, 0, 0, 41, 0, 32, 1, 7, 17, 
+    0, 0, 0, 0, 41, 1, 7, 0, 0, 0, 
+    0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 
+    0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 
+    47, 0, 0, 0, 0, 0, 0, 0, 57, 0, 
+    0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 
+    0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 
+    0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 
+    85, 0, 0, 0, 0, 0, 0, 0, 47, 0, 
+    0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 
+    0, 0, 0, 0, 88, 0, 0, 0, 0, 0, 
+    0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 
+    88, 0, 0, 0, 0, 0, 0, 0, 105, 0, 
+    0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 
+    0, 0, 0, 0, 141, 0, 0, 0, 0, 0, 
+    0, 0, 142, 0, 0, 0, 0, 0, 0, 0, 
+    142, 0, 0, 0, 0, 0, 0, 0, 151, 0, 
+    0, 0, 0, 0, 0, 0, 154, 0, 0, 0, 
+    0, 0, 0, 0, 142, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 2, 21, 0, 0, 0, 0, 
+    0, 0, 0, 70, 105, 110, 100, 32, 97, 32, 
+    109, 111, 100, 117, 108, 101, 39, 115, 32, 115, 
+    112, 101, 99, 46, 5, 2, 22, 0, 0, 0, 
+    0, 0, 0, 0, 115, 121, 115, 46, 109, 101, 
+    116, 97, 95, 112, 97, 116, 104, 32, 105, 115, 
+    32, 101, 109, 112, 116, 121, 2, 53, 0, 0, 
+    0, 0, 0, 0, 0, 115, 121, 115, 46, 109, 
+    101, 116, 97, 95, 112, 97, 116, 104, 32, 105, 
+    115, 32, 78, 111, 110, 101, 44, 32, 80, 121, 
+    116, 104, 111, 110, 32, 105, 115, 32, 108, 105, 
+    107, 101, 108, 121, 32, 115, 104, 117, 116, 116, 
+    105, 110, 103, 32, 100, 111, 119, 110, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 
+    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
+    0, 0, 0, 0, 0, 95, 102, 105, 110, 100, 
+    95, 115, 112, 101, 99, 14, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 115, 121, 115, 11, 0, 0, 0, 0, 0, 
+    0, 0, 73, 109, 112, 111, 114, 116, 69, 114, 
+    114, 111, 114, 9, 0, 0, 0, 0, 0, 0, 
+    0, 95, 119, 97, 114, 110, 105, 110, 103, 115, 
+    13, 0, 0, 0, 0, 0, 0, 0, 73, 109, 
+    112, 111, 114, 116, 87, 97, 114, 110, 105, 110, 
+    103, 18, 0, 0, 0, 0, 0, 0, 0, 95, 
+    73, 109, 112, 111, 114, 116, 76, 111, 99, 107, 
+    67, 111, 110, 116, 101, 120, 116, 14, 0, 0, 
+    0, 0, 0, 0, 0, 65, 116, 116, 114, 105, 
+    98, 117, 116, 101, 69, 114, 114, 111, 114, 17, 
+    0, 0, 0, 0, 0, 0, 0, 95, 102, 105, 
+    110, 100, 95, 115, 112, 101, 99, 95, 108, 101, 
+    103, 97, 99, 121, 4, 0, 0, 0, 0, 0, 
+    0, 0, 119, 97, 114, 110, 9, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 101, 110, 116, 101, 
+    114, 95, 95, 8, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 101, 120, 105, 116, 95, 95, 9, 
+    0, 0, 0, 0, 0, 0, 0, 109, 101, 116, 
+    97, 95, 112, 97, 116, 104, 7, 0, 0, 0, 
+    0, 0, 0, 0, 109, 111, 100, 117, 108, 101, 
+    115, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
+    105, 110, 100, 95, 115, 112, 101, 99, 8, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 115, 112, 
+    101, 99, 95, 95, 0, 0, 0, 0, 0, 0, 
+    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+    109, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 6, 0, 0, 0, 0, 0, 
+    0, 0, 116, 97, 114, 103, 101, 116, 9, 0, 
+    0, 0, 0, 0, 0, 0, 109, 101, 116, 97, 
+    95, 112, 97, 116, 104, 9, 0, 0, 0, 0, 
+    0, 0, 0, 105, 115, 95, 114, 101, 108, 111, 
+    97, 100, 6, 0, 0, 0, 0, 0, 0, 0, 
+    102, 105, 110, 100, 101, 114, 9, 0, 0, 0, 
+    0, 0, 0, 0, 102, 105, 110, 100, 95, 115, 
+    112, 101, 99, 4, 0, 0, 0, 0, 0, 0, 
+    0, 115, 112, 101, 99, 6, 0, 0, 0, 0, 
+    0, 0, 0, 109, 111, 100, 117, 108, 101, 8, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 115, 
+    112, 101, 99, 95, 95, 33, 0, 0, 0, 0, 
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
+    0, 17, 0, 0, 0, 0, 0, 0, 0, 29, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 109, 
+    111, 100, 117, 108, 101, 95, 114, 101, 112, 114, 
+    46, 50, 55, 55, 58, 48, 0, 107, 0, 0, 
+    0, 0, 0, 0, 0, 33, 1, 0, 32, 2, 
+    0, 30, 3, 0, 30, 4, 1, 74, 2, 74, 
+    3, 74, 4, 10, 1, 3, 0, 75, 1, 0, 
+    75, 1, 0, 75, 1, 0, 45, 1, 0, 33, 
+    1, 1, 32, 2, 1, 30, 3, 2, 74, 2, 
+    74, 3, 10, 1, 2, 0, 75, 1, 0, 75, 
+    1, 0, 79, 4, 0, 19, 0, 7, 0, 0, 
+    0, 17, 78, 0, 0, 0, 33, 0, 2, 21, 
+    0, 3, 0, 0, 0, 5, 17, 0, 0, 0, 
+    0, 17, 1, 0, 0, 0, 52, 17, 5, 0, 
+    0, 0, 33, 0, 3, 21, 0, 2, 0, 0, 
+    0, 5, 17, 11, 0, 0, 0, 52, 32, 0, 
+    0, 27, 1, 0, 7, 45, 2, 1, 17, 0, 
+    0, 0, 0, 32, 0, 2, 30, 1, 1, 6, 
+    2, 0, 1, 7, 79, 3, 2, 22, 2, 50, 
+    0, 0, 0, 17, 0, 0, 0, 0, 17, 7, 
+    0, 0, 0, 33, 0, 3, 21, 0, 4, 0, 
+    0, 0, 30, 1, 3, 45, 3, 1, 5, 17, 
+    5, 0, 0, 0, 52, 32, 0, 0, 27, 1, 
+    0, 8, 45, 3, 1, 17, 0, 0, 0, 0, 
+    17, 25, 0, 0, 0, 33, 0, 3, 21, 0, 
+    20, 0, 0, 0, 32, 1, 1, 30, 0, 1, 
+    6, 2, 1, 0, 6, 79, 3, 2, 22, 2, 
+    8, 0, 0, 0, 30, 0, 4, 34, 1, 0, 
+    6, 1, 32, 32, 2, 3, 32, 3, 1, 38, 
+    1, 32, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 17, 
+    0, 0, 0, 0, 41, 0, 30, 1, 5, 34, 
+    2, 1, 6, 1, 32, 32, 3, 3, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 5, 17, 0, 0, 
+    0, 0, 41, 0, 52, 30, 0, 1, 41, 0, 
+    32, 1, 0, 27, 0, 1, 9, 45, 4, 0, 
+    17, 0, 0, 0, 0, 30, 0, 6, 34, 1, 
+    0, 6, 1, 32, 32, 2, 3, 32, 3, 4, 
+    38, 1, 32, 2, 0, 0, 0, 0, 0, 0, 
+    0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 
+    0, 0, 0, 0, 41, 0, 33, 1, 4, 32, 
+    2, 2, 74, 2, 10, 1, 1, 0, 75, 1, 
+    219, 17, 0, 0, 0, 0, 41, 0, 32, 1, 
+    1, 34, 2, 1, 5, 1, 32, 32, 3, 0, 
+    38, 2, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 
+    0, 0, 0, 41, 0, 8, 0, 0, 0, 0, 
+    0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 
+    0, 23, 0, 0, 0, 0, 0, 0, 0, 23, 
+    0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 
+    0, 35, 0, 0, 0, 0, 0, 0, 0, 38, 
+    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
+    0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 
+    0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 
+    0, 46, 0, 0, 0, 0, 0, 0, 0, 53, 
+    0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 
+    0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 
+    0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 
+    0, 58, 0, 0, 0, 0, 0, 0, 0, 58, 
+    0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 
+    0, 0, 0, 0, 0, 86, 0, 0, 0, 0, 
+    0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 
+    0, 101, 0, 0, 0, 0, 0, 0, 0, 107, 
+    0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 
     0, 0, 0, 0, 0, 0, 0, 2, 10, 0, 
@@ -2901,210 +3082,226 @@ std::vector<uint8_t> _bootstrap
     0, 75, 1, 41, 32, 3, 0, 74, 0, 74, 
     3, 10, 0, 1, 0, 75, 1, 59, 39, 1, 
     0, 75, 0, 0, 41, 1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 
-    0, 0, 0, 0, 0, 95, 110, 101, 119, 95, 
-    109, 111, 100, 117, 108, 101, 2, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 116, 121, 112, 101, 3, 0, 0, 0, 
-    0, 0, 0, 0, 115, 121, 115, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 110, 97, 109, 101, 32, 0, 0, 0, 0, 
-    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
-    0, 12, 0, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 95, 114, 
-    101, 115, 111, 108, 118, 101, 95, 110, 97, 109, 
-    101, 46, 56, 56, 50, 58, 48, 0, 51, 0, 
-    0, 0, 0, 0, 0, 0, 30, 0, 0, 32, 
-    1, 1, 34, 2, 1, 2, 30, 3, 1, 32, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 
+    0, 0, 0, 95, 110, 101, 119, 95, 109, 111, 
+    100, 117, 108, 101, 2, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    116, 121, 112, 101, 3, 0, 0, 0, 0, 0, 
+    0, 0, 115, 121, 115, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
+    97, 109, 101, 33, 0, 0, 0, 0, 0, 0, 
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 12, 
+    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 46, 95, 114, 101, 115, 
+    111, 108, 118, 101, 95, 110, 97, 109, 101, 46, 
+    56, 56, 50, 58, 48, 0, 41, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 32, 1, 1, 
+    34, 2, 1, 2, 1, 32, 30, 3, 1, 32, 
     1, 2, 30, 4, 2, 0, 5, 1, 4, 1, 
-    74, 3, 74, 5, 10, 2, 2, 0, 75, 1, 
-    0, 75, 1, 0, 45, 3, 0, 33, 2, 0, 
-    32, 1, 3, 74, 1, 10, 2, 1, 0, 75, 
-    1, 0, 32, 3, 2, 6, 1, 0, 3, 2, 
-    79, 2, 1, 22, 1, 19, 0, 0, 0, 32, 
-    0, 3, 30, 1, 3, 1, 2, 0, 1, 45, 
-    4, 2, 32, 1, 0, 79, 0, 1, 22, 1, 
-    2, 0, 0, 0, 32, 0, 4, 17, 19, 0, 
-    0, 0, 30, 1, 4, 34, 2, 1, 3, 32, 
-    3, 4, 32, 1, 0, 74, 3, 74, 1, 10, 
-    2, 2, 0, 75, 1, 0, 75, 1, 0, 17, 
-    9, 0, 0, 0, 33, 1, 1, 30, 2, 5, 
-    74, 0, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 39, 3, 0, 75, 0, 0, 40, 1, 3, 
-    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 2, 50, 0, 0, 0, 0, 
-    0, 0, 0, 82, 101, 115, 111, 108, 118, 101, 
-    32, 97, 32, 114, 101, 108, 97, 116, 105, 118, 
-    101, 32, 109, 111, 100, 117, 108, 101, 32, 110, 
-    97, 109, 101, 32, 116, 111, 32, 97, 110, 32, 
-    97, 98, 115, 111, 108, 117, 116, 101, 32, 111, 
-    110, 101, 46, 2, 1, 0, 0, 0, 0, 0, 
-    0, 0, 46, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 5, 0, 0, 0, 0, 0, 0, 0, 
-    123, 125, 46, 123, 125, 2, 50, 0, 0, 0, 
-    0, 0, 0, 0, 97, 116, 116, 101, 109, 112, 
-    116, 101, 100, 32, 114, 101, 108, 97, 116, 105, 
-    118, 101, 32, 105, 109, 112, 111, 114, 116, 32, 
-    98, 101, 121, 111, 110, 100, 32, 116, 111, 112, 
-    45, 108, 101, 118, 101, 108, 32, 112, 97, 99, 
-    107, 97, 103, 101, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 
-    0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 
-    0, 95, 114, 101, 115, 111, 108, 118, 101, 95, 
-    110, 97, 109, 101, 4, 0, 0, 0, 0, 0, 
+    38, 2, 32, 2, 0, 0, 0, 0, 0, 0, 
+    0, 3, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 
+    3, 0, 33, 2, 0, 32, 1, 3, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 32, 3, 2, 6, 
+    1, 0, 3, 2, 79, 2, 1, 22, 1, 15, 
+    0, 0, 0, 32, 0, 3, 30, 1, 3, 1, 
+    2, 0, 1, 45, 4, 2, 32, 1, 0, 79, 
+    0, 1, 22, 1, 2, 0, 0, 0, 32, 0, 
+    4, 17, 15, 0, 0, 0, 30, 1, 4, 34, 
+    2, 1, 3, 1, 32, 32, 3, 4, 32, 1, 
+    0, 38, 2, 32, 2, 0, 0, 0, 0, 0, 
+    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 9, 0, 0, 0, 33, 1, 1, 30, 2, 
+    5, 74, 0, 74, 2, 10, 1, 1, 0, 75, 
+    1, 0, 39, 3, 0, 75, 0, 0, 40, 1, 
+    3, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
+    0, 0, 0, 2, 50, 0, 0, 0, 0, 0, 
+    0, 0, 82, 101, 115, 111, 108, 118, 101, 32, 
+    97, 32, 114, 101, 108, 97, 116, 105, 118, 101, 
+    32, 109, 111, 100, 117, 108, 101, 32, 110, 97, 
+    109, 101, 32, 116, 111, 32, 97, 110, 32, 97, 
+    98, 115, 111, 108, 117, 116, 101, 32, 111, 110, 
+    101, 46, 2, 1, 0, 0, 0, 0, 0, 0, 
+    0, 46, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 5, 0, 0, 0, 0, 0, 0, 0, 123, 
+    125, 46, 123, 125, 2, 50, 0, 0, 0, 0, 
+    0, 0, 0, 97, 116, 116, 101, 109, 112, 116, 
+    101, 100, 32, 114, 101, 108, 97, 116, 105, 118, 
+    101, 32, 105, 109, 112, 111, 114, 116, 32, 98, 
+    101, 121, 111, 110, 100, 32, 116, 111, 112, 45, 
+    108, 101, 118, 101, 108, 32, 112, 97, 99, 107, 
+    97, 103, 101, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 
+    0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 
+    95, 114, 101, 115, 111, 108, 118, 101, 95, 110, 
+    97, 109, 101, 4, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 108, 
+    101, 110, 11, 0, 0, 0, 0, 0, 0, 0, 
+    73, 109, 112, 111, 114, 116, 69, 114, 114, 111, 
+    114, 6, 0, 0, 0, 0, 0, 0, 0, 114, 
+    115, 112, 108, 105, 116, 6, 0, 0, 0, 0, 
+    0, 0, 0, 102, 111, 114, 109, 97, 116, 0, 
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 110, 97, 109, 101, 7, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 99, 107, 97, 
+    103, 101, 5, 0, 0, 0, 0, 0, 0, 0, 
+    108, 101, 118, 101, 108, 4, 0, 0, 0, 0, 
+    0, 0, 0, 98, 105, 116, 115, 4, 0, 0, 
+    0, 0, 0, 0, 0, 98, 97, 115, 101, 33, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 70, 114, 111, 122, 101, 110, 73, 109, 
+    112, 111, 114, 116, 101, 114, 46, 109, 111, 100, 
+    117, 108, 101, 95, 114, 101, 112, 114, 46, 56, 
+    48, 49, 58, 52, 0, 9, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 30, 1, 1, 34, 
+    2, 1, 1, 1, 32, 32, 0, 0, 27, 1, 
+    0, 2, 33, 3, 0, 27, 4, 3, 3, 38, 
+    2, 32, 2, 0, 0, 0, 0, 0, 0, 0, 
+    1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 115, 0, 0, 0, 0, 0, 0, 0, 82, 
+    101, 116, 117, 114, 110, 32, 114, 101, 112, 114, 
+    32, 102, 111, 114, 32, 116, 104, 101, 32, 109, 
+    111, 100, 117, 108, 101, 46, 10, 10, 32, 32, 
+    32, 32, 32, 32, 32, 32, 84, 104, 101, 32, 
+    109, 101, 116, 104, 111, 100, 32, 105, 115, 32, 
+    100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 
+    46, 32, 32, 84, 104, 101, 32, 105, 109, 112, 
+    111, 114, 116, 32, 109, 97, 99, 104, 105, 110, 
+    101, 114, 121, 32, 100, 111, 101, 115, 32, 116, 
+    104, 101, 32, 106, 111, 98, 32, 105, 116, 115, 
+    101, 108, 102, 46, 10, 10, 32, 32, 32, 32, 
+    32, 32, 32, 32, 2, 18, 0, 0, 0, 0, 
+    0, 0, 0, 60, 109, 111, 100, 117, 108, 101, 
+    32, 123, 33, 114, 125, 32, 40, 123, 125, 41, 
+    62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    108, 101, 110, 11, 0, 0, 0, 0, 0, 0, 
-    0, 73, 109, 112, 111, 114, 116, 69, 114, 114, 
-    111, 114, 6, 0, 0, 0, 0, 0, 0, 0, 
-    114, 115, 112, 108, 105, 116, 6, 0, 0, 0, 
-    0, 0, 0, 0, 102, 111, 114, 109, 97, 116, 
-    0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 110, 97, 109, 101, 7, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 99, 107, 
-    97, 103, 101, 5, 0, 0, 0, 0, 0, 0, 
-    0, 108, 101, 118, 101, 108, 4, 0, 0, 0, 
-    0, 0, 0, 0, 98, 105, 116, 115, 4, 0, 
-    0, 0, 0, 0, 0, 0, 98, 97, 115, 101, 
-    32, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 70, 114, 111, 122, 101, 110, 73, 
-    109, 112, 111, 114, 116, 101, 114, 46, 109, 111, 
-    100, 117, 108, 101, 95, 114, 101, 112, 114, 46, 
-    56, 48, 49, 58, 52, 0, 13, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 30, 1, 1, 
-    34, 2, 1, 1, 32, 0, 0, 27, 1, 0, 
-    2, 33, 3, 0, 27, 4, 3, 3, 74, 1, 
-    74, 4, 10, 2, 2, 0, 75, 1, 188, 75, 
-    1, 188, 41, 0, 0, 0, 0, 0, 0, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 109, 111, 
+    100, 117, 108, 101, 95, 114, 101, 112, 114, 4, 
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 
+    0, 0, 0, 0, 0, 70, 114, 111, 122, 101, 
+    110, 73, 109, 112, 111, 114, 116, 101, 114, 6, 
+    0, 0, 0, 0, 0, 0, 0, 102, 111, 114, 
+    109, 97, 116, 8, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 110, 97, 109, 101, 95, 95, 7, 
+    0, 0, 0, 0, 0, 0, 0, 95, 79, 82, 
+    73, 71, 73, 78, 0, 0, 0, 0, 0, 0, 
     0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 2, 115, 0, 0, 
-    0, 0, 0, 0, 0, 82, 101, 116, 117, 114, 
-    110, 32, 114, 101, 112, 114, 32, 102, 111, 114, 
-    32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 
-    101, 46, 10, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 84, 104, 101, 32, 109, 101, 116, 104, 
-    111, 100, 32, 105, 115, 32, 100, 101, 112, 114, 
-    101, 99, 97, 116, 101, 100, 46, 32, 32, 84, 
-    104, 101, 32, 105, 109, 112, 111, 114, 116, 32, 
-    109, 97, 99, 104, 105, 110, 101, 114, 121, 32, 
-    100, 111, 101, 115, 32, 116, 104, 101, 32, 106, 
-    111, 98, 32, 105, 116, 115, 101, 108, 102, 46, 
-    10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
-    2, 18, 0, 0, 0, 0, 0, 0, 0, 60, 
-    109, 111, 100, 117, 108, 101, 32, 123, 33, 114, 
-    125, 32, 40, 123, 125, 41, 62, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 109, 32, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 95, 95, 99, 108, 97, 115, 115, 95, 
+    95, 95, 77, 111, 100, 117, 108, 101, 76, 111, 
+    99, 107, 77, 97, 110, 97, 103, 101, 114, 95, 
+    95, 46, 49, 52, 57, 58, 48, 0, 16, 0, 
+    0, 0, 0, 0, 0, 0, 33, 0, 0, 47, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 109, 111, 100, 117, 108, 101, 95, 95, 30, 
+    2, 0, 47, 2, 12, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 113, 117, 97, 108, 110, 97, 
+    109, 101, 95, 95, 30, 1, 1, 36, 0, 1, 
+    0, 0, 0, 0, 47, 0, 8, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 105, 110, 105, 116, 
+    95, 95, 30, 1, 2, 36, 0, 1, 0, 0, 
+    0, 0, 47, 0, 9, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 101, 110, 116, 101, 114, 95, 
+    95, 30, 1, 3, 36, 0, 1, 0, 0, 0, 
+    0, 47, 0, 8, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 101, 120, 105, 116, 95, 95, 17, 
+    0, 0, 0, 0, 29, 0, 0, 41, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
-    0, 0, 0, 0, 109, 111, 100, 117, 108, 101, 
-    95, 114, 101, 112, 114, 4, 0, 0, 0, 0, 
-    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 
-    0, 70, 114, 111, 122, 101, 110, 73, 109, 112, 
-    111, 114, 116, 101, 114, 6, 0, 0, 0, 0, 
-    0, 0, 0, 102, 111, 114, 109, 97, 116, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 110, 
-    97, 109, 101, 95, 95, 7, 0, 0, 0, 0, 
-    0, 0, 0, 95, 79, 82, 73, 71, 73, 78, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 109, 32, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 9, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 99, 
+    108, 97, 115, 115, 95, 95, 4, 0, 0, 0, 
+    0, 0, 0, 0, 2, 18, 0, 0, 0, 0, 
+    0, 0, 0, 95, 77, 111, 100, 117, 108, 101, 
+    76, 111, 99, 107, 77, 97, 110, 97, 103, 101, 
+    114, 2, 44, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 95, 77, 111, 100, 117, 108, 101, 76, 111, 
+    99, 107, 77, 97, 110, 97, 103, 101, 114, 46, 
+    95, 95, 105, 110, 105, 116, 95, 95, 46, 49, 
+    53, 49, 58, 52, 2, 45, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 46, 95, 77, 111, 100, 117, 108, 
+    101, 76, 111, 99, 107, 77, 97, 110, 97, 103, 
+    101, 114, 46, 95, 95, 101, 110, 116, 101, 114, 
+    95, 95, 46, 49, 53, 53, 58, 52, 2, 44, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 95, 95, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 77, 
+    111, 100, 117, 108, 101, 76, 111, 99, 107, 77, 
+    97, 110, 97, 103, 101, 114, 46, 95, 95, 101, 
+    120, 105, 116, 95, 95, 46, 49, 53, 57, 58, 
+    52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    29, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
     99, 108, 97, 115, 115, 95, 95, 95, 77, 111, 
     100, 117, 108, 101, 76, 111, 99, 107, 77, 97, 
-    110, 97, 103, 101, 114, 95, 95, 46, 49, 52, 
-    57, 58, 48, 0, 16, 0, 0, 0, 0, 0, 
-    0, 0, 33, 0, 0, 47, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 109, 111, 100, 
-    117, 108, 101, 95, 95, 30, 2, 0, 47, 2, 
-    12, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    113, 117, 97, 108, 110, 97, 109, 101, 95, 95, 
-    30, 1, 1, 36, 0, 1, 0, 0, 0, 0, 
-    47, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 105, 110, 105, 116, 95, 95, 30, 1, 
-    2, 36, 0, 1, 0, 0, 0, 0, 47, 0, 
-    9, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    101, 110, 116, 101, 114, 95, 95, 30, 1, 3, 
-    36, 0, 1, 0, 0, 0, 0, 47, 0, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 101, 
-    120, 105, 116, 95, 95, 17, 0, 0, 0, 0, 
-    29, 0, 0, 41, 0, 1, 0, 0, 0, 0, 
+    110, 97, 103, 101, 114, 95, 95, 1, 0, 0, 
+    0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 110, 97, 109, 101, 95, 
+    95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 36, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
+    95, 77, 111, 100, 117, 108, 101, 76, 111, 99, 
+    107, 46, 95, 95, 105, 110, 105, 116, 95, 95, 
+    46, 53, 55, 58, 52, 0, 24, 0, 0, 0, 
+    0, 0, 0, 0, 33, 1, 0, 34, 2, 1, 
+    1, 1, 32, 38, 2, 32, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 99, 108, 97, 
-    115, 115, 95, 95, 4, 0, 0, 0, 0, 0, 
-    0, 0, 2, 18, 0, 0, 0, 0, 0, 0, 
-    0, 95, 77, 111, 100, 117, 108, 101, 76, 111, 
-    99, 107, 77, 97, 110, 97, 103, 101, 114, 2, 
-    44, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    77, 111, 100, 117, 108, 101, 76, 111, 99, 107, 
-    77, 97, 110, 97, 103, 101, 114, 46, 95, 95, 
-    105, 110, 105, 116, 95, 95, 46, 49, 53, 49, 
-    58, 52, 2, 45, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 46, 95, 77, 111, 100, 117, 108, 101, 76, 
-    111, 99, 107, 77, 97, 110, 97, 103, 101, 114, 
-    46, 95, 95, 101, 110, 116, 101, 114, 95, 95, 
-    46, 49, 53, 53, 58, 52, 2, 44, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 95, 77, 111, 100, 
-    117, 108, 101, 76, 111, 99, 107, 77, 97, 110, 
-    97, 103, 101, 114, 46, 95, 95, 101, 120, 105, 
-    116, 95, 95, 46, 49, 53, 57, 58, 52, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 
+    32, 1, 0, 43, 1, 0, 2, 33, 2, 0, 
+    34, 1, 2, 1, 1, 32, 38, 1, 32, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 99, 108, 
-    97, 115, 115, 95, 95, 95, 77, 111, 100, 117, 
-    108, 101, 76, 111, 99, 107, 77, 97, 110, 97, 
-    103, 101, 114, 95, 95, 1, 0, 0, 0, 0, 
-    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 110, 97, 109, 101, 95, 95, 0, 
+    0, 0, 0, 32, 2, 0, 43, 2, 0, 3, 
+    32, 1, 1, 32, 0, 0, 43, 0, 1, 4, 
+    30, 2, 0, 32, 0, 0, 43, 0, 2, 5, 
+    30, 1, 1, 32, 0, 0, 43, 0, 1, 6, 
+    30, 2, 1, 32, 0, 0, 43, 0, 2, 7, 
+    30, 1, 0, 41, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 36, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 95, 77, 
-    111, 100, 117, 108, 101, 76, 111, 99, 107, 46, 
-    95, 95, 105, 110, 105, 116, 95, 95, 46, 53, 
-    55, 58, 52, 0, 24, 0, 0, 0, 0, 0, 
-    0, 0, 33, 1, 0, 34, 2, 1, 1, 10, 
-    2, 0, 0, 32, 1, 0, 43, 1, 0, 2, 
-    33, 2, 0, 34, 1, 2, 1, 10, 1, 0, 
-    0, 32, 2, 0, 43, 2, 0, 3, 32, 1, 
-    1, 32, 0, 0, 43, 0, 1, 4, 30, 2, 
-    0, 32, 0, 0, 43, 0, 2, 5, 30, 1, 
-    1, 32, 0, 0, 43, 0, 1, 6, 30, 2, 
-    1, 32, 0, 0, 43, 0, 2, 7, 30, 1, 
-    0, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
     0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
@@ -3144,174 +3341,191 @@ std::vector<uint8_t> _bootstrap
     1, 2, 45, 1, 3, 33, 1, 0, 32, 2, 
     1, 31, 3, 0, 74, 2, 74, 3, 10, 1, 
     2, 0, 75, 1, 0, 75, 1, 0, 32, 4, 
-    1, 41, 4, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    1, 41, 4, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 102, 120, 110, 2, 0, 0, 0, 
-    0, 0, 0, 0, 2, 49, 0, 0, 0, 0, 
-    0, 0, 0, 68, 101, 99, 111, 114, 97, 116, 
-    111, 114, 32, 116, 111, 32, 118, 101, 114, 105, 
-    102, 121, 32, 116, 104, 101, 32, 110, 97, 109, 
-    101, 100, 32, 109, 111, 100, 117, 108, 101, 32, 
-    105, 115, 32, 98, 117, 105, 108, 116, 45, 105, 
-    110, 46, 2, 60, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 46, 95, 114, 101, 113, 117, 105, 114, 101, 
-    115, 95, 98, 117, 105, 108, 116, 105, 110, 46, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 102, 120, 110, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 49, 0, 0, 0, 0, 0, 0, 
+    0, 68, 101, 99, 111, 114, 97, 116, 111, 114, 
+    32, 116, 111, 32, 118, 101, 114, 105, 102, 121, 
+    32, 116, 104, 101, 32, 110, 97, 109, 101, 100, 
+    32, 109, 111, 100, 117, 108, 101, 32, 105, 115, 
+    32, 98, 117, 105, 108, 116, 45, 105, 110, 46, 
+    2, 60, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
     95, 114, 101, 113, 117, 105, 114, 101, 115, 95, 
-    98, 117, 105, 108, 116, 105, 110, 95, 119, 114, 
-    97, 112, 112, 101, 114, 46, 50, 52, 48, 58, 
-    52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    98, 117, 105, 108, 116, 105, 110, 46, 95, 114, 
+    101, 113, 117, 105, 114, 101, 115, 95, 98, 117, 
+    105, 108, 116, 105, 110, 95, 119, 114, 97, 112, 
+    112, 101, 114, 46, 50, 52, 48, 58, 52, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
-    17, 0, 0, 0, 0, 0, 0, 0, 95, 114, 
-    101, 113, 117, 105, 114, 101, 115, 95, 98, 117, 
-    105, 108, 116, 105, 110, 1, 0, 0, 0, 0, 
-    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
-    0, 95, 119, 114, 97, 112, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 17, 0, 
+    0, 0, 0, 0, 0, 0, 95, 114, 101, 113, 
+    117, 105, 114, 101, 115, 95, 98, 117, 105, 108, 
+    116, 105, 110, 1, 0, 0, 0, 0, 0, 0, 
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 95, 
+    119, 114, 97, 112, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 102, 120, 
+    110, 25, 0, 0, 0, 0, 0, 0, 0, 95, 
+    114, 101, 113, 117, 105, 114, 101, 115, 95, 98, 
+    117, 105, 108, 116, 105, 110, 95, 119, 114, 97, 
+    112, 112, 101, 114, 33, 0, 0, 0, 0, 0, 
     0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    102, 120, 110, 25, 0, 0, 0, 0, 0, 0, 
-    0, 95, 114, 101, 113, 117, 105, 114, 101, 115, 
-    95, 98, 117, 105, 108, 116, 105, 110, 95, 119, 
-    114, 97, 112, 112, 101, 114, 32, 0, 0, 0, 
+    7, 0, 0, 0, 0, 0, 0, 0, 33, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 95, 118, 101, 
+    114, 98, 111, 115, 101, 95, 109, 101, 115, 115, 
+    97, 103, 101, 46, 50, 51, 48, 58, 48, 0, 
+    45, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
+    0, 33, 1, 0, 27, 0, 1, 4, 27, 2, 
+    0, 5, 32, 1, 1, 6, 0, 2, 1, 5, 
+    79, 3, 0, 19, 0, 35, 0, 0, 0, 32, 
+    1, 0, 34, 2, 1, 2, 1, 32, 30, 3, 
+    1, 30, 1, 2, 74, 3, 74, 1, 4, 4, 
+    2, 75, 1, 0, 75, 1, 0, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 49, 1, 0, 3, 79, 
+    2, 1, 19, 1, 5, 0, 0, 0, 30, 0, 
+    3, 32, 1, 0, 0, 2, 0, 1, 0, 45, 
+    0, 2, 17, 0, 0, 0, 0, 33, 1, 1, 
+    32, 0, 0, 34, 2, 0, 3, 0, 0, 32, 
+    3, 2, 3, 0, 0, 24, 0, 3, 25, 4, 
+    0, 30, 3, 4, 2, 5, 0, 11, 2, 4, 
+    0, 1, 0, 33, 3, 0, 27, 2, 3, 6, 
+    74, 0, 12, 1, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 
+    7, 39, 4, 0, 75, 0, 0, 17, 0, 0, 
+    0, 0, 30, 0, 4, 41, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 2, 61, 0, 
+    0, 0, 0, 0, 0, 0, 80, 114, 105, 110, 
+    116, 32, 116, 104, 101, 32, 109, 101, 115, 115, 
+    97, 103, 101, 32, 116, 111, 32, 115, 116, 100, 
+    101, 114, 114, 32, 105, 102, 32, 45, 118, 47, 
+    80, 89, 84, 72, 79, 78, 86, 69, 82, 66, 
+    79, 83, 69, 32, 105, 115, 32, 116, 117, 114, 
+    110, 101, 100, 32, 111, 110, 46, 2, 1, 0, 
+    0, 0, 0, 0, 0, 0, 35, 2, 7, 0, 
+    0, 0, 0, 0, 0, 0, 105, 109, 112, 111, 
+    114, 116, 32, 2, 2, 0, 0, 0, 0, 0, 
+    0, 0, 35, 32, 5, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
+    0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 
+    0, 0, 95, 118, 101, 114, 98, 111, 115, 101, 
+    95, 109, 101, 115, 115, 97, 103, 101, 8, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 115, 121, 115, 5, 0, 0, 
+    0, 0, 0, 0, 0, 112, 114, 105, 110, 116, 
+    10, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+    97, 114, 116, 115, 119, 105, 116, 104, 6, 0, 
+    0, 0, 0, 0, 0, 0, 102, 111, 114, 109, 
+    97, 116, 5, 0, 0, 0, 0, 0, 0, 0, 
+    102, 108, 97, 103, 115, 7, 0, 0, 0, 0, 
+    0, 0, 0, 118, 101, 114, 98, 111, 115, 101, 
+    6, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+    100, 101, 114, 114, 4, 0, 0, 0, 0, 0, 
+    0, 0, 102, 105, 108, 101, 0, 0, 0, 0, 
     0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
     0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 
-    33, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    109, 101, 115, 115, 97, 103, 101, 9, 0, 0, 
+    0, 0, 0, 0, 0, 118, 101, 114, 98, 111, 
+    115, 105, 116, 121, 4, 0, 0, 0, 0, 0, 
+    0, 0, 97, 114, 103, 115, 33, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 
+    40, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
     111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    118, 101, 114, 98, 111, 115, 101, 95, 109, 101, 
-    115, 115, 97, 103, 101, 46, 50, 51, 48, 58, 
-    48, 0, 47, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 33, 1, 0, 27, 0, 1, 4, 
-    27, 2, 0, 5, 32, 1, 1, 6, 0, 2, 
-    1, 5, 79, 3, 0, 19, 0, 37, 0, 0, 
-    0, 32, 1, 0, 34, 2, 1, 2, 30, 3, 
-    1, 30, 1, 2, 74, 3, 74, 1, 4, 4, 
-    2, 75, 1, 0, 75, 1, 0, 74, 4, 10, 
-    2, 1, 0, 75, 1, 0, 49, 1, 0, 3, 
-    79, 2, 1, 19, 1, 5, 0, 0, 0, 30, 
-    0, 3, 32, 1, 0, 0, 2, 0, 1, 0, 
-    45, 0, 2, 17, 0, 0, 0, 0, 33, 1, 
-    1, 32, 0, 0, 34, 2, 0, 3, 32, 3, 
-    2, 3, 0, 0, 24, 0, 3, 25, 4, 0, 
-    30, 3, 4, 2, 5, 0, 11, 2, 4, 0, 
-    1, 0, 33, 3, 0, 27, 2, 3, 6, 74, 
-    0, 12, 1, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    2, 1, 0, 0, 0, 0, 0, 0, 0, 7, 
-    39, 4, 0, 75, 0, 0, 17, 0, 0, 0, 
-    0, 30, 0, 4, 41, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    77, 111, 100, 117, 108, 101, 76, 111, 99, 107, 
+    46, 104, 97, 115, 95, 100, 101, 97, 100, 108, 
+    111, 99, 107, 46, 54, 53, 58, 52, 0, 50, 
+    0, 0, 0, 0, 0, 0, 0, 33, 1, 0, 
+    34, 2, 1, 3, 1, 32, 38, 2, 32, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    5, 0, 0, 0, 0, 0, 0, 0, 2, 61, 
-    0, 0, 0, 0, 0, 0, 0, 80, 114, 105, 
-    110, 116, 32, 116, 104, 101, 32, 109, 101, 115, 
-    115, 97, 103, 101, 32, 116, 111, 32, 115, 116, 
-    100, 101, 114, 114, 32, 105, 102, 32, 45, 118, 
-    47, 80, 89, 84, 72, 79, 78, 86, 69, 82, 
-    66, 79, 83, 69, 32, 105, 115, 32, 116, 117, 
-    114, 110, 101, 100, 32, 111, 110, 46, 2, 1, 
-    0, 0, 0, 0, 0, 0, 0, 35, 2, 7, 
-    0, 0, 0, 0, 0, 0, 0, 105, 109, 112, 
-    111, 114, 116, 32, 2, 2, 0, 0, 0, 0, 
-    0, 0, 0, 35, 32, 5, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
-    0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 
-    0, 0, 0, 95, 118, 101, 114, 98, 111, 115, 
-    101, 95, 109, 101, 115, 115, 97, 103, 101, 8, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 115, 121, 115, 5, 0, 
-    0, 0, 0, 0, 0, 0, 112, 114, 105, 110, 
-    116, 10, 0, 0, 0, 0, 0, 0, 0, 115, 
-    116, 97, 114, 116, 115, 119, 105, 116, 104, 6, 
-    0, 0, 0, 0, 0, 0, 0, 102, 111, 114, 
-    109, 97, 116, 5, 0, 0, 0, 0, 0, 0, 
-    0, 102, 108, 97, 103, 115, 7, 0, 0, 0, 
-    0, 0, 0, 0, 118, 101, 114, 98, 111, 115, 
-    101, 6, 0, 0, 0, 0, 0, 0, 0, 115, 
-    116, 100, 101, 114, 114, 4, 0, 0, 0, 0, 
-    0, 0, 0, 102, 105, 108, 101, 0, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
-    0, 109, 101, 115, 115, 97, 103, 101, 9, 0, 
-    0, 0, 0, 0, 0, 0, 118, 101, 114, 98, 
-    111, 115, 105, 116, 121, 4, 0, 0, 0, 0, 
-    0, 0, 0, 97, 114, 103, 115, 32, 0, 0, 
-    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
-    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
-    0, 40, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    95, 77, 111, 100, 117, 108, 101, 76, 111, 99, 
-    107, 46, 104, 97, 115, 95, 100, 101, 97, 100, 
-    108, 111, 99, 107, 46, 54, 53, 58, 52, 0, 
-    54, 0, 0, 0, 0, 0, 0, 0, 33, 1, 
-    0, 34, 2, 1, 3, 10, 2, 0, 0, 45, 
-    1, 0, 32, 2, 0, 27, 0, 2, 6, 45, 
-    2, 0, 33, 2, 1, 10, 2, 0, 0, 45, 
-    3, 0, 17, 0, 0, 0, 0, 30, 0, 0, 
-    79, 1, 0, 22, 0, 2, 0, 0, 0, 30, 
-    1, 1, 41, 1, 33, 0, 2, 34, 1, 0, 
-    4, 32, 2, 2, 74, 2, 10, 1, 1, 0, 
-    75, 1, 0, 45, 4, 0, 32, 1, 4, 30, 
-    0, 1, 6, 2, 1, 0, 6, 79, 3, 2, 
-    22, 2, 24, 0, 0, 0, 32, 0, 4, 27, 
-    1, 0, 6, 45, 2, 1, 32, 0, 2, 32, 
-    1, 1, 6, 2, 0, 1, 0, 79, 3, 2, 
-    22, 2, 14, 0, 0, 0, 32, 0, 2, 32, 
-    1, 3, 6, 2, 0, 1, 8, 79, 3, 2, 
-    22, 2, 7, 0, 0, 0, 32, 0, 3, 34, 
-    1, 0, 5, 32, 2, 2, 74, 2, 10, 1, 
-    1, 0, 75, 1, 0, 17, 219, 255, 255, 255, 
-    30, 0, 2, 41, 0, 30, 1, 0, 41, 1, 
-    30, 0, 2, 41, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 6, 1, 5, 
-    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 45, 1, 0, 32, 2, 0, 27, 
+    0, 2, 6, 45, 2, 0, 33, 2, 1, 38, 
+    2, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 45, 3, 0, 17, 
+    0, 0, 0, 0, 30, 0, 0, 79, 1, 0, 
+    22, 0, 2, 0, 0, 0, 30, 1, 1, 41, 
+    1, 33, 0, 2, 34, 1, 0, 4, 1, 32, 
+    32, 2, 2, 38, 1, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 45, 4, 0, 32, 1, 4, 30, 0, 1, 
+    6, 2, 1, 0, 6, 79, 3, 2, 22, 2, 
+    22, 0, 0, 0, 32, 0, 4, 27, 1, 0, 
+    6, 45, 2, 1, 32, 0, 2, 32, 1, 1, 
+    6, 2, 0, 1, 0, 79, 3, 2, 22, 2, 
+    12, 0, 0, 0, 32, 0, 2, 32, 1, 3, 
+    6, 2, 0, 1, 8, 79, 3, 2, 22, 2, 
+    5, 0, 0, 0, 32, 0, 3, 34, 1, 0, 
+    5, 1, 32, 32, 2, 2, 38, 1, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 17, 223, 255, 255, 255, 30, 
+    0, 2, 41, 0, 30, 1, 0, 41, 1, 30, 
+    0, 2, 41, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 6, 1, 5, 6, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    7, 0, 0, 0, 0, 0, 0, 0, 12, 0, 
+    0, 0, 0, 0, 0, 0, 104, 97, 115, 95, 
+    100, 101, 97, 100, 108, 111, 99, 107, 7, 0, 
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
+    0, 0, 0, 0, 95, 116, 104, 114, 101, 97, 
+    100, 3, 0, 0, 0, 0, 0, 0, 0, 115, 
+    101, 116, 12, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 108, 111, 99, 107, 105, 110, 103, 95, 
+    111, 110, 9, 0, 0, 0, 0, 0, 0, 0, 
+    103, 101, 116, 95, 105, 100, 101, 110, 116, 3, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    3, 0, 0, 0, 0, 0, 0, 0, 97, 100, 
+    100, 5, 0, 0, 0, 0, 0, 0, 0, 111, 
+    119, 110, 101, 114, 0, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 2, 0, 0, 0, 0, 0, 0, 0, 
+    109, 101, 3, 0, 0, 0, 0, 0, 0, 0, 
+    116, 105, 100, 4, 0, 0, 0, 0, 0, 0, 
+    0, 115, 101, 101, 110, 4, 0, 0, 0, 0, 
+    0, 0, 0, 108, 111, 99, 107, 33, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 45, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
+    95, 77, 111, 100, 117, 108, 101, 76, 111, 99, 
+    107, 77, 97, 110, 97, 103, 101, 114, 46, 95, 
+    95, 101, 110, 116, 101, 114, 95, 95, 46, 49, 
+    53, 53, 58, 52, 0, 14, 0, 0, 0, 0, 
+    0, 0, 0, 33, 1, 0, 32, 2, 0, 27, 
+    3, 2, 3, 74, 3, 10, 1, 1, 0, 75, 
+    1, 0, 32, 2, 0, 43, 2, 0, 1, 32, 
+    1, 0, 27, 2, 1, 1, 34, 3, 2, 2, 
+    1, 32, 38, 3, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 
+    1, 0, 41, 1, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
-    0, 12, 0, 0, 0, 0, 0, 0, 0, 104, 
-    97, 115, 95, 100, 101, 97, 100, 108, 111, 99, 
-    107, 7, 0, 0, 0, 0, 0, 0, 0, 7, 
-    0, 0, 0, 0, 0, 0, 0, 95, 116, 104, 
-    114, 101, 97, 100, 3, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 116, 12, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 108, 111, 99, 107, 105, 
-    110, 103, 95, 111, 110, 9, 0, 0, 0, 0, 
-    0, 0, 0, 103, 101, 116, 95, 105, 100, 101, 
-    110, 116, 3, 0, 0, 0, 0, 0, 0, 0, 
-    103, 101, 116, 3, 0, 0, 0, 0, 0, 0, 
-    0, 97, 100, 100, 5, 0, 0, 0, 0, 0, 
-    0, 0, 111, 119, 110, 101, 114, 0, 0, 0, 
-    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 101, 108, 102, 2, 0, 0, 0, 0, 
-    0, 0, 0, 109, 101, 3, 0, 0, 0, 0, 
-    0, 0, 0, 116, 105, 100, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 101, 101, 110, 4, 0, 
-    0, 0, 0, 0, 0, 0, 108, 111, 99, 107, 
-    32, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 95, 77, 111, 100, 117, 108, 101, 
-    76, 111, 99, 107, 77, 97, 110, 97, 103, 101, 
-    114, 46, 95, 95, 101, 110, 116, 101, 114, 95, 
-    95, 46, 49, 53, 53, 58, 52, 0, 14, 0, 
-    0, 0, 0, 0, 0, 0, 33, 1, 0, 32, 
-    2, 0, 27, 3, 2, 3, 74, 3, 10, 1, 
-    1, 0, 75, 1, 0, 32, 2, 0, 43, 2, 
-    0, 1, 32, 1, 0, 27, 2, 1, 1, 34, 
-    3, 2, 2, 10, 3, 0, 0, 30, 1, 0, 
-    41, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
     1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
@@ -3331,132 +3545,139 @@ std::vector<uint8_t> _bootstrap
     110, 97, 109, 101, 0, 0, 0, 0, 0, 0, 
     0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
     4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
-    108, 102, 32, 0, 0, 0, 0, 0, 0, 0, 
+    108, 102, 33, 0, 0, 0, 0, 0, 0, 0, 
     2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
     0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 
     0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
     116, 114, 97, 112, 46, 70, 114, 111, 122, 101, 
     110, 73, 109, 112, 111, 114, 116, 101, 114, 46, 
     103, 101, 116, 95, 99, 111, 100, 101, 46, 56, 
-    52, 56, 58, 52, 0, 8, 0, 0, 0, 0, 
+    52, 56, 58, 52, 0, 6, 0, 0, 0, 0, 
     0, 0, 0, 30, 0, 0, 33, 1, 0, 34, 
-    2, 1, 1, 32, 3, 1, 74, 3, 10, 2, 
-    1, 0, 75, 1, 188, 41, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    2, 1, 1, 1, 32, 32, 3, 1, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 3, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
-    45, 0, 0, 0, 0, 0, 0, 0, 82, 101, 
-    116, 117, 114, 110, 32, 116, 104, 101, 32, 99, 
-    111, 100, 101, 32, 111, 98, 106, 101, 99, 116, 
-    32, 102, 111, 114, 32, 116, 104, 101, 32, 102, 
-    114, 111, 122, 101, 110, 32, 109, 111, 100, 117, 
-    108, 101, 46, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 45, 
+    0, 0, 0, 0, 0, 0, 0, 82, 101, 116, 
+    117, 114, 110, 32, 116, 104, 101, 32, 99, 111, 
+    100, 101, 32, 111, 98, 106, 101, 99, 116, 32, 
+    102, 111, 114, 32, 116, 104, 101, 32, 102, 114, 
+    111, 122, 101, 110, 32, 109, 111, 100, 117, 108, 
+    101, 46, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
-    103, 101, 116, 95, 99, 111, 100, 101, 2, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 95, 105, 109, 112, 17, 0, 
-    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
-    102, 114, 111, 122, 101, 110, 95, 111, 98, 106, 
-    101, 99, 116, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 99, 108, 115, 
-    8, 0, 0, 0, 0, 0, 0, 0, 102, 117, 
-    108, 108, 110, 97, 109, 101, 32, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    45, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 70, 
-    114, 111, 122, 101, 110, 73, 109, 112, 111, 114, 
-    116, 101, 114, 46, 99, 114, 101, 97, 116, 101, 
-    95, 109, 111, 100, 117, 108, 101, 46, 56, 50, 
-    54, 58, 52, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 30, 0, 0, 30, 1, 1, 41, 1, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 2, 42, 0, 0, 0, 0, 0, 0, 
-    0, 85, 115, 101, 32, 100, 101, 102, 97, 117, 
-    108, 116, 32, 115, 101, 109, 97, 110, 116, 105, 
-    99, 115, 32, 102, 111, 114, 32, 109, 111, 100, 
-    117, 108, 101, 32, 99, 114, 101, 97, 116, 105, 
-    111, 110, 46, 5, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 103, 
+    101, 116, 95, 99, 111, 100, 101, 2, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 95, 105, 109, 112, 17, 0, 0, 
+    0, 0, 0, 0, 0, 103, 101, 116, 95, 102, 
+    114, 111, 122, 101, 110, 95, 111, 98, 106, 101, 
+    99, 116, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 99, 108, 115, 8, 
+    0, 0, 0, 0, 0, 0, 0, 102, 117, 108, 
+    108, 110, 97, 109, 101, 32, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 45, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 70, 114, 
+    111, 122, 101, 110, 73, 109, 112, 111, 114, 116, 
+    101, 114, 46, 99, 114, 101, 97, 116, 101, 95, 
+    109, 111, 100, 117, 108, 101, 46, 56, 50, 54, 
+    58, 52, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 30, 1, 1, 41, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    42, 0, 0, 0, 0, 0, 0, 0, 85, 115, 
+    101, 32, 100, 101, 102, 97, 117, 108, 116, 32, 
+    115, 101, 109, 97, 110, 116, 105, 99, 115, 32, 
+    102, 111, 114, 32, 109, 111, 100, 117, 108, 101, 
+    32, 99, 114, 101, 97, 116, 105, 111, 110, 46, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 
-    0, 99, 114, 101, 97, 116, 101, 95, 109, 111, 
-    100, 117, 108, 101, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 99, 108, 115, 4, 
-    0, 0, 0, 0, 0, 0, 0, 115, 112, 101, 
-    99, 32, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
-    0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 77, 111, 100, 117, 108, 
-    101, 76, 111, 99, 107, 46, 95, 95, 114, 101, 
-    112, 114, 95, 95, 46, 49, 50, 52, 58, 52, 
-    0, 18, 0, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 34, 1, 0, 1, 32, 2, 0, 27, 
-    3, 2, 2, 33, 4, 0, 32, 2, 0, 74, 
-    2, 10, 4, 1, 0, 75, 1, 0, 74, 0, 
-    74, 3, 74, 0, 10, 1, 2, 0, 75, 1, 
-    0, 75, 1, 0, 39, 5, 0, 75, 0, 0, 
-    41, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    13, 0, 0, 0, 0, 0, 0, 0, 99, 114, 
+    101, 97, 116, 101, 95, 109, 111, 100, 117, 108, 
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 99, 108, 115, 4, 0, 0, 0, 
+    0, 0, 0, 0, 115, 112, 101, 99, 33, 0, 
     0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 2, 23, 0, 0, 0, 0, 
-    0, 0, 0, 95, 77, 111, 100, 117, 108, 101, 
-    76, 111, 99, 107, 40, 123, 33, 114, 125, 41, 
-    32, 97, 116, 32, 123, 125, 0, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 95, 77, 111, 100, 117, 108, 101, 76, 111, 
+    99, 107, 46, 95, 95, 114, 101, 112, 114, 95, 
+    95, 46, 49, 50, 52, 58, 52, 0, 14, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 34, 
+    1, 0, 1, 1, 32, 32, 2, 0, 27, 3, 
+    2, 2, 33, 4, 0, 32, 2, 0, 74, 2, 
+    10, 4, 1, 0, 75, 1, 0, 74, 0, 38, 
+    1, 32, 2, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 5, 
+    0, 75, 0, 0, 41, 5, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 2, 23, 0, 0, 
+    0, 0, 0, 0, 0, 95, 77, 111, 100, 117, 
+    108, 101, 76, 111, 99, 107, 40, 123, 33, 114, 
+    125, 41, 32, 97, 116, 32, 123, 125, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
-    0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 114, 101, 112, 114, 95, 
-    95, 3, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 105, 100, 6, 
-    0, 0, 0, 0, 0, 0, 0, 102, 111, 114, 
-    109, 97, 116, 4, 0, 0, 0, 0, 0, 0, 
-    0, 110, 97, 109, 101, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 32, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 95, 95, 99, 108, 
-    97, 115, 115, 95, 95, 95, 77, 111, 100, 117, 
-    108, 101, 76, 111, 99, 107, 95, 95, 46, 53, 
-    49, 58, 48, 0, 23, 0, 0, 0, 0, 0, 
-    0, 0, 33, 0, 0, 47, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 109, 111, 100, 
-    117, 108, 101, 95, 95, 30, 2, 0, 47, 2, 
-    12, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    113, 117, 97, 108, 110, 97, 109, 101, 95, 95, 
-    30, 1, 1, 30, 0, 2, 36, 1, 0, 0, 
-    0, 0, 0, 47, 1, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 105, 110, 105, 116, 95, 
-    95, 30, 0, 3, 36, 1, 0, 0, 0, 0, 
-    0, 47, 1, 12, 0, 0, 0, 0, 0, 0, 
-    0, 104, 97, 115, 95, 100, 101, 97, 100, 108, 
-    111, 99, 107, 30, 0, 4, 36, 1, 0, 0, 
-    0, 0, 0, 47, 1, 7, 0, 0, 0, 0, 
-    0, 0, 0, 97, 99, 113, 117, 105, 114, 101, 
-    30, 0, 5, 36, 1, 0, 0, 0, 0, 0, 
-    47, 1, 7, 0, 0, 0, 0, 0, 0, 0, 
-    114, 101, 108, 101, 97, 115, 101, 30, 0, 6, 
-    36, 1, 0, 0, 0, 0, 0, 47, 1, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 114, 
-    101, 112, 114, 95, 95, 17, 0, 0, 0, 0, 
-    29, 0, 0, 41, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 114, 101, 112, 
+    114, 95, 95, 3, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 105, 
+    100, 6, 0, 0, 0, 0, 0, 0, 0, 102, 
+    111, 114, 109, 97, 116, 4, 0, 0, 0, 0, 
+    0, 0, 0, 110, 97, 109, 101, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 115, 101, 108, 102, 32, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 95, 
+    99, 108, 97, 115, 115, 95, 95, 95, 77, 111, 
+    100, 117, 108, 101, 76, 111, 99, 107, 95, 95, 
+    46, 53, 49, 58, 48, 0, 23, 0, 0, 0, 
+    0, 0, 0, 0, 33, 0, 0, 47, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 109, 
+    111, 100, 117, 108, 101, 95, 95, 30, 2, 0, 
+    47, 2, 12, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 113, 117, 97, 108, 110, 97, 109, 101, 
+    95, 95, 30, 1, 1, 30, 0, 2, 36, 1, 
+    0, 0, 0, 0, 0, 47, 1, 8, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 105, 110, 105, 
+    116, 95, 95, 30, 0, 3, 36, 1, 0, 0, 
+    0, 0, 0, 47, 1, 12, 0, 0, 0, 0, 
+    0, 0, 0, 104, 97, 115, 95, 100, 101, 97, 
+    100, 108, 111, 99, 107, 30, 0, 4, 36, 1, 
+    0, 0, 0, 0, 0, 47, 1, 7, 0, 0, 
+    0, 0, 0, 0, 0, 97, 99, 113, 117, 105, 
+    114, 101, 30, 0, 5, 36, 1, 0, 0, 0, 
+    0, 0, 47, 1, 7, 0, 0, 0, 0, 0, 
+    0, 0, 114, 101, 108, 101, 97, 115, 101, 30, 
+    0, 6, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 114, 101, 112, 114, 95, 95, 17, 0, 0, 
+    0, 0, 29, 0, 0, 41, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
     0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
@@ -3528,246 +3749,260 @@ std::vector<uint8_t> _bootstrap
     32, 0, 0, 27, 1, 0, 0, 30, 2, 0, 
     63, 1, 2, 0, 43, 0, 1, 0, 30, 2, 
     1, 41, 2, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 6, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 6, 1, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
+    0, 97, 99, 113, 117, 105, 114, 101, 1, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 99, 111, 117, 110, 116, 0, 
     0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
-    0, 0, 0, 97, 99, 113, 117, 105, 114, 101, 
-    1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
-    0, 0, 0, 0, 0, 0, 99, 111, 117, 110, 
-    116, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 115, 101, 108, 102, 32, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 115, 101, 108, 102, 32, 0, 0, 
     0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 46, 77, 111, 100, 117, 108, 101, 83, 112, 
-    101, 99, 46, 99, 97, 99, 104, 101, 100, 46, 
-    51, 57, 51, 58, 52, 0, 5, 0, 0, 0, 
-    0, 0, 0, 0, 32, 0, 1, 32, 1, 0, 
-    43, 1, 0, 0, 30, 2, 0, 41, 2, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 34, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
+    77, 111, 100, 117, 108, 101, 83, 112, 101, 99, 
+    46, 99, 97, 99, 104, 101, 100, 46, 51, 57, 
+    51, 58, 52, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 32, 0, 1, 32, 1, 0, 43, 1, 
+    0, 0, 30, 2, 0, 41, 2, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 6, 0, 0, 0, 0, 0, 0, 0, 99, 
-    97, 99, 104, 101, 100, 1, 0, 0, 0, 0, 
-    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
-    0, 95, 99, 97, 99, 104, 101, 100, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 108, 102, 6, 0, 0, 0, 
-    0, 0, 0, 0, 99, 97, 99, 104, 101, 100, 
-    32, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
-    0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 95, 114, 101, 113, 117, 105, 114, 
-    101, 115, 95, 102, 114, 111, 122, 101, 110, 46, 
-    95, 114, 101, 113, 117, 105, 114, 101, 115, 95, 
-    102, 114, 111, 122, 101, 110, 95, 119, 114, 97, 
-    112, 112, 101, 114, 46, 50, 53, 49, 58, 52, 
-    0, 31, 0, 0, 0, 0, 0, 0, 0, 33, 
-    0, 0, 34, 1, 0, 2, 32, 2, 1, 74, 
-    2, 10, 1, 1, 0, 75, 1, 0, 49, 3, 
-    0, 3, 79, 1, 3, 19, 3, 13, 0, 0, 
-    0, 33, 1, 1, 30, 0, 0, 34, 2, 0, 
-    3, 32, 3, 1, 74, 3, 10, 2, 1, 0, 
-    75, 1, 0, 32, 4, 1, 74, 0, 12, 1, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 4, 1, 0, 
-    0, 0, 0, 0, 0, 0, 4, 39, 2, 0, 
-    75, 0, 0, 40, 1, 2, 31, 1, 0, 32, 
-    2, 0, 32, 3, 1, 74, 2, 74, 3, 10, 
-    1, 2, 0, 75, 1, 0, 75, 1, 0, 41, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 2, 27, 0, 0, 0, 0, 0, 
-    0, 0, 123, 33, 114, 125, 32, 105, 115, 32, 
-    110, 111, 116, 32, 97, 32, 102, 114, 111, 122, 
-    101, 110, 32, 109, 111, 100, 117, 108, 101, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 99, 97, 99, 104, 101, 
+    100, 1, 0, 0, 0, 0, 0, 0, 0, 7, 
+    0, 0, 0, 0, 0, 0, 0, 95, 99, 97, 
+    99, 104, 101, 100, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 6, 0, 0, 0, 0, 0, 0, 0, 
+    99, 97, 99, 104, 101, 100, 33, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 
+    58, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
+    114, 101, 113, 117, 105, 114, 101, 115, 95, 102, 
+    114, 111, 122, 101, 110, 46, 95, 114, 101, 113, 
+    117, 105, 114, 101, 115, 95, 102, 114, 111, 122, 
+    101, 110, 95, 119, 114, 97, 112, 112, 101, 114, 
+    46, 50, 53, 49, 58, 52, 0, 27, 0, 0, 
+    0, 0, 0, 0, 0, 33, 0, 0, 34, 1, 
+    0, 2, 1, 32, 32, 2, 1, 38, 1, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 49, 3, 0, 3, 79, 
+    1, 3, 19, 3, 11, 0, 0, 0, 33, 1, 
+    1, 30, 0, 0, 34, 2, 0, 3, 1, 32, 
+    32, 3, 1, 38, 2, 32, 1, 0, 0, 0, 
     0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 102, 120, 110, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 7, 0, 0, 0, 0, 0, 0, 0, 24, 
-    0, 0, 0, 0, 0, 0, 0, 95, 114, 101, 
-    113, 117, 105, 114, 101, 115, 95, 102, 114, 111, 
-    122, 101, 110, 95, 119, 114, 97, 112, 112, 101, 
-    114, 5, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 95, 105, 109, 
-    112, 11, 0, 0, 0, 0, 0, 0, 0, 73, 
-    109, 112, 111, 114, 116, 69, 114, 114, 111, 114, 
-    9, 0, 0, 0, 0, 0, 0, 0, 105, 115, 
-    95, 102, 114, 111, 122, 101, 110, 6, 0, 0, 
-    0, 0, 0, 0, 0, 102, 111, 114, 109, 97, 
-    116, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
-    97, 109, 101, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
-    102, 8, 0, 0, 0, 0, 0, 0, 0, 102, 
-    117, 108, 108, 110, 97, 109, 101, 32, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 42, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    95, 68, 117, 109, 109, 121, 77, 111, 100, 117, 
-    108, 101, 76, 111, 99, 107, 46, 95, 95, 105, 
-    110, 105, 116, 95, 95, 46, 49, 51, 50, 58, 
-    52, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
-    32, 0, 1, 32, 1, 0, 43, 1, 0, 0, 
-    30, 2, 0, 32, 0, 0, 43, 0, 2, 1, 
-    30, 1, 1, 41, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 32, 4, 1, 74, 0, 12, 1, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 
+    0, 0, 0, 0, 4, 39, 2, 0, 75, 0, 
+    0, 40, 1, 2, 31, 1, 0, 32, 2, 0, 
+    32, 3, 1, 74, 2, 74, 3, 10, 1, 2, 
+    0, 75, 1, 0, 75, 1, 0, 41, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    27, 0, 0, 0, 0, 0, 0, 0, 123, 33, 
+    114, 125, 32, 105, 115, 32, 110, 111, 116, 32, 
+    97, 32, 102, 114, 111, 122, 101, 110, 32, 109, 
+    111, 100, 117, 108, 101, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 102, 120, 
+    110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 
+    0, 0, 0, 95, 114, 101, 113, 117, 105, 114, 
+    101, 115, 95, 102, 114, 111, 122, 101, 110, 95, 
+    119, 114, 97, 112, 112, 101, 114, 5, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 95, 105, 109, 112, 11, 0, 0, 
+    0, 0, 0, 0, 0, 73, 109, 112, 111, 114, 
+    116, 69, 114, 114, 111, 114, 9, 0, 0, 0, 
+    0, 0, 0, 0, 105, 115, 95, 102, 114, 111, 
+    122, 101, 110, 6, 0, 0, 0, 0, 0, 0, 
+    0, 102, 111, 114, 109, 97, 116, 4, 0, 0, 
+    0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 115, 101, 108, 102, 8, 0, 0, 
+    0, 0, 0, 0, 0, 102, 117, 108, 108, 110, 
+    97, 109, 101, 32, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 46, 95, 68, 117, 109, 
+    109, 121, 77, 111, 100, 117, 108, 101, 76, 111, 
+    99, 107, 46, 95, 95, 105, 110, 105, 116, 95, 
+    95, 46, 49, 51, 50, 58, 52, 0, 8, 0, 
+    0, 0, 0, 0, 0, 0, 32, 0, 1, 32, 
+    1, 0, 43, 1, 0, 0, 30, 2, 0, 32, 
+    0, 0, 43, 0, 2, 1, 30, 1, 1, 41, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 105, 110, 105, 116, 
-    95, 95, 2, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
-    109, 101, 5, 0, 0, 0, 0, 0, 0, 0, 
-    99, 111, 117, 110, 116, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 4, 0, 0, 0, 0, 0, 0, 
-    0, 110, 97, 109, 101, 32, 0, 0, 0, 0, 
     0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 36, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 95, 98, 
-    117, 105, 108, 116, 105, 110, 95, 102, 114, 111, 
-    109, 95, 110, 97, 109, 101, 46, 49, 49, 51, 
-    51, 58, 48, 0, 26, 0, 0, 0, 0, 0, 
-    0, 0, 33, 0, 0, 34, 1, 0, 3, 32, 
-    2, 0, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 45, 1, 0, 32, 1, 1, 30, 0, 0, 
-    6, 2, 1, 0, 6, 79, 3, 2, 19, 2, 
-    8, 0, 0, 0, 33, 1, 1, 30, 2, 1, 
-    32, 3, 0, 0, 4, 2, 3, 0, 74, 4, 
-    10, 1, 1, 0, 75, 1, 0, 40, 1, 0, 
-    33, 1, 2, 32, 2, 1, 74, 2, 10, 1, 
-    1, 0, 75, 1, 0, 41, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 5, 
-    2, 25, 0, 0, 0, 0, 0, 0, 0, 110, 
-    111, 32, 98, 117, 105, 108, 116, 45, 105, 110, 
-    32, 109, 111, 100, 117, 108, 101, 32, 110, 97, 
-    109, 101, 100, 32, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 117, 105, 108, 116, 105, 110, 95, 
-    102, 114, 111, 109, 95, 110, 97, 109, 101, 4, 
-    0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 
-    0, 0, 0, 0, 0, 66, 117, 105, 108, 116, 
-    105, 110, 73, 109, 112, 111, 114, 116, 101, 114, 
-    11, 0, 0, 0, 0, 0, 0, 0, 73, 109, 
-    112, 111, 114, 116, 69, 114, 114, 111, 114, 14, 
-    0, 0, 0, 0, 0, 0, 0, 95, 108, 111, 
-    97, 100, 95, 117, 110, 108, 111, 99, 107, 101, 
-    100, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
-    105, 110, 100, 95, 115, 112, 101, 99, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    105, 110, 105, 116, 95, 95, 2, 0, 0, 0, 
     0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 112, 101, 99, 32, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 
-    0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 119, 114, 97, 112, 46, 50, 54, 58, 
-    48, 0, 70, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 30, 1, 1, 30, 0, 2, 30, 
-    2, 3, 30, 3, 4, 74, 1, 74, 0, 74, 
-    2, 74, 3, 3, 4, 4, 75, 1, 0, 75, 
-    1, 0, 75, 1, 0, 75, 1, 0, 13, 5, 
-    4, 17, 0, 0, 0, 0, 9, 0, 5, 42, 
-    0, 0, 0, 0, 0, 0, 0, 45, 2, 0, 
-    17, 0, 0, 0, 0, 33, 1, 0, 32, 2, 
-    1, 32, 3, 2, 74, 0, 74, 2, 74, 3, 
-    10, 1, 2, 0, 75, 1, 0, 75, 1, 0, 
-    39, 4, 0, 75, 0, 0, 79, 6, 4, 19, 
-    4, 25, 0, 0, 0, 33, 1, 1, 32, 2, 
-    0, 32, 3, 2, 33, 4, 2, 32, 6, 1, 
-    32, 7, 2, 74, 0, 74, 6, 74, 7, 10, 
-    4, 2, 0, 75, 1, 0, 75, 1, 0, 39, 
-    8, 0, 75, 0, 0, 74, 0, 74, 2, 74, 
-    3, 74, 8, 10, 1, 3, 0, 75, 1, 189, 
-    75, 1, 221, 75, 1, 189, 39, 9, 0, 75, 
-    0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 
-    0, 0, 9, 0, 5, 0, 0, 0, 0, 214, 
-    255, 255, 255, 17, 0, 0, 0, 0, 32, 0, 
-    0, 27, 1, 0, 4, 34, 2, 1, 3, 32, 
-    3, 1, 27, 1, 3, 4, 74, 1, 10, 2, 
-    1, 0, 75, 1, 249, 30, 3, 5, 41, 3, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 110, 97, 109, 101, 5, 0, 0, 0, 
+    0, 0, 0, 0, 99, 111, 117, 110, 116, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 115, 101, 108, 102, 4, 0, 0, 
+    0, 0, 0, 0, 0, 110, 97, 109, 101, 33, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 95, 98, 117, 105, 108, 116, 105, 110, 
+    95, 102, 114, 111, 109, 95, 110, 97, 109, 101, 
+    46, 49, 49, 51, 51, 58, 48, 0, 24, 0, 
+    0, 0, 0, 0, 0, 0, 33, 0, 0, 34, 
+    1, 0, 3, 1, 32, 32, 2, 0, 38, 1, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 45, 1, 0, 32, 
+    1, 1, 30, 0, 0, 6, 2, 1, 0, 6, 
+    79, 3, 2, 19, 2, 8, 0, 0, 0, 33, 
+    1, 1, 30, 2, 1, 32, 3, 0, 0, 4, 
+    2, 3, 0, 74, 4, 10, 1, 1, 0, 75, 
+    1, 0, 40, 1, 0, 33, 1, 2, 32, 2, 
+    1, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
+    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
-    0, 0, 2, 47, 0, 0, 0, 0, 0, 0, 
-    0, 83, 105, 109, 112, 108, 101, 32, 115, 117, 
-    98, 115, 116, 105, 116, 117, 116, 101, 32, 102, 
-    111, 114, 32, 102, 117, 110, 99, 116, 111, 111, 
-    108, 115, 46, 117, 112, 100, 97, 116, 101, 95, 
-    119, 114, 97, 112, 112, 101, 114, 46, 2, 10, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 109, 
-    111, 100, 117, 108, 101, 95, 95, 2, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 110, 97, 
-    109, 101, 95, 95, 2, 12, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 113, 117, 97, 108, 110, 
-    97, 109, 101, 95, 95, 2, 7, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 100, 111, 99, 95, 
-    95, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 5, 2, 25, 0, 0, 0, 0, 0, 
+    0, 0, 110, 111, 32, 98, 117, 105, 108, 116, 
+    45, 105, 110, 32, 109, 111, 100, 117, 108, 101, 
+    32, 110, 97, 109, 101, 100, 32, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 95, 
-    119, 114, 97, 112, 5, 0, 0, 0, 0, 0, 
-    0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 
-    104, 97, 115, 97, 116, 116, 114, 7, 0, 0, 
-    0, 0, 0, 0, 0, 115, 101, 116, 97, 116, 
-    116, 114, 7, 0, 0, 0, 0, 0, 0, 0, 
-    103, 101, 116, 97, 116, 116, 114, 6, 0, 0, 
-    0, 0, 0, 0, 0, 117, 112, 100, 97, 116, 
-    101, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 100, 105, 99, 116, 95, 95, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
+    0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 117, 105, 108, 116, 
+    105, 110, 95, 102, 114, 111, 109, 95, 110, 97, 
+    109, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
+    15, 0, 0, 0, 0, 0, 0, 0, 66, 117, 
+    105, 108, 116, 105, 110, 73, 109, 112, 111, 114, 
+    116, 101, 114, 11, 0, 0, 0, 0, 0, 0, 
+    0, 73, 109, 112, 111, 114, 116, 69, 114, 114, 
+    111, 114, 14, 0, 0, 0, 0, 0, 0, 0, 
+    95, 108, 111, 97, 100, 95, 117, 110, 108, 111, 
+    99, 107, 101, 100, 9, 0, 0, 0, 0, 0, 
+    0, 0, 102, 105, 110, 100, 95, 115, 112, 101, 
+    99, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 110, 97, 109, 101, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 112, 101, 
+    99, 33, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 
+    0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 46, 95, 119, 114, 97, 112, 46, 
+    50, 54, 58, 48, 0, 68, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 30, 1, 1, 30, 
+    0, 2, 30, 2, 3, 30, 3, 4, 74, 1, 
+    74, 0, 74, 2, 74, 3, 3, 4, 4, 75, 
+    1, 0, 75, 1, 0, 75, 1, 0, 75, 1, 
+    0, 13, 5, 4, 17, 0, 0, 0, 0, 9, 
+    0, 5, 42, 0, 0, 0, 0, 0, 0, 0, 
+    45, 2, 0, 17, 0, 0, 0, 0, 33, 1, 
+    0, 32, 2, 1, 32, 3, 2, 74, 0, 74, 
+    2, 74, 3, 10, 1, 2, 0, 75, 1, 0, 
+    75, 1, 0, 39, 4, 0, 75, 0, 0, 79, 
+    6, 4, 19, 4, 25, 0, 0, 0, 33, 1, 
+    1, 32, 2, 0, 32, 3, 2, 33, 4, 2, 
+    32, 6, 1, 32, 7, 2, 74, 0, 74, 6, 
+    74, 7, 10, 4, 2, 0, 75, 1, 0, 75, 
+    1, 0, 39, 8, 0, 75, 0, 0, 74, 0, 
+    74, 2, 74, 3, 74, 8, 10, 1, 3, 0, 
+    75, 1, 189, 75, 1, 221, 75, 1, 189, 39, 
+    9, 0, 75, 0, 0, 17, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 9, 0, 5, 0, 0, 
+    0, 0, 214, 255, 255, 255, 17, 0, 0, 0, 
+    0, 32, 0, 0, 27, 1, 0, 4, 34, 2, 
+    1, 3, 1, 32, 32, 3, 1, 27, 1, 3, 
+    4, 38, 2, 32, 1, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 
+    3, 5, 41, 3, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 2, 47, 0, 0, 0, 0, 
+    0, 0, 0, 83, 105, 109, 112, 108, 101, 32, 
+    115, 117, 98, 115, 116, 105, 116, 117, 116, 101, 
+    32, 102, 111, 114, 32, 102, 117, 110, 99, 116, 
+    111, 111, 108, 115, 46, 117, 112, 100, 97, 116, 
+    101, 95, 119, 114, 97, 112, 112, 101, 114, 46, 
+    2, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 109, 111, 100, 117, 108, 101, 95, 95, 2, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    110, 97, 109, 101, 95, 95, 2, 12, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 113, 117, 97, 
+    108, 110, 97, 109, 101, 95, 95, 2, 7, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 100, 111, 
+    99, 95, 95, 5, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
+    0, 95, 119, 114, 97, 112, 5, 0, 0, 0, 
+    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
+    0, 0, 104, 97, 115, 97, 116, 116, 114, 7, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 
+    97, 116, 116, 114, 7, 0, 0, 0, 0, 0, 
+    0, 0, 103, 101, 116, 97, 116, 116, 114, 6, 
+    0, 0, 0, 0, 0, 0, 0, 117, 112, 100, 
+    97, 116, 101, 8, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 100, 105, 99, 116, 95, 95, 0, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
     0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 110, 101, 119, 3, 0, 0, 0, 0, 0, 
-    0, 0, 111, 108, 100, 7, 0, 0, 0, 0, 
-    0, 0, 0, 114, 101, 112, 108, 97, 99, 101, 
-    32, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 42, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 46, 95, 99, 97, 108, 108, 95, 119, 
-    105, 116, 104, 95, 102, 114, 97, 109, 101, 115, 
-    95, 114, 101, 109, 111, 118, 101, 100, 46, 50, 
-    49, 57, 58, 48, 0, 12, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 32, 1, 0, 32, 
-    0, 1, 3, 2, 0, 24, 2, 0, 25, 3, 
-    2, 30, 0, 1, 32, 2, 2, 2, 4, 0, 
-    65, 4, 2, 11, 1, 3, 4, 1, 1, 41, 
+    0, 0, 0, 110, 101, 119, 3, 0, 0, 0, 
+    0, 0, 0, 0, 111, 108, 100, 7, 0, 0, 
+    0, 0, 0, 0, 0, 114, 101, 112, 108, 97, 
+    99, 101, 32, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 46, 95, 99, 97, 108, 108, 
+    95, 119, 105, 116, 104, 95, 102, 114, 97, 109, 
+    101, 115, 95, 114, 101, 109, 111, 118, 101, 100, 
+    46, 50, 49, 57, 58, 48, 0, 12, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 32, 1, 
+    0, 32, 0, 1, 3, 2, 0, 24, 2, 0, 
+    25, 3, 2, 30, 0, 1, 32, 2, 2, 2, 
+    4, 0, 65, 4, 2, 11, 1, 3, 4, 1, 
+    1, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
@@ -3816,138 +4051,175 @@ std::vector<uint8_t> _bootstrap
     0, 1, 0, 0, 0, 0, 0, 0, 0, 102, 
     4, 0, 0, 0, 0, 0, 0, 0, 97, 114, 
     103, 115, 4, 0, 0, 0, 0, 0, 0, 0, 
-    107, 119, 100, 115, 32, 0, 0, 0, 0, 0, 
+    107, 119, 100, 115, 33, 0, 0, 0, 0, 0, 
     0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
     10, 0, 0, 0, 0, 0, 0, 0, 35, 0, 
     0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
     116, 115, 116, 114, 97, 112, 46, 95, 77, 111, 
     100, 117, 108, 101, 76, 111, 99, 107, 46, 97, 
     99, 113, 117, 105, 114, 101, 46, 56, 54, 58, 
-    52, 0, 127, 0, 0, 0, 0, 0, 0, 0, 
+    52, 0, 109, 0, 0, 0, 0, 0, 0, 0, 
     30, 0, 0, 33, 1, 0, 34, 2, 1, 3, 
-    10, 2, 0, 0, 45, 1, 0, 32, 2, 0, 
-    33, 0, 1, 32, 1, 1, 48, 0, 1, 2, 
-    42, 1, 0, 0, 0, 17, 4, 0, 0, 0, 
+    1, 32, 38, 2, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 
+    1, 0, 32, 2, 0, 33, 0, 1, 32, 1, 
+    1, 48, 0, 1, 2, 17, 4, 0, 0, 0, 
     33, 0, 1, 32, 1, 1, 55, 0, 1, 52, 
     17, 0, 0, 0, 0, 30, 0, 1, 79, 1, 
-    0, 22, 0, 8, 0, 0, 0, 54, 17, 0, 
-    0, 0, 0, 33, 0, 1, 32, 1, 1, 55, 
-    0, 1, 17, 0, 0, 0, 0, 30, 0, 2, 
-    41, 0, 32, 1, 0, 27, 2, 1, 12, 34, 
-    3, 2, 4, 10, 3, 0, 0, 56, 55, 0, 
-    0, 0, 17, 0, 0, 0, 0, 32, 0, 0, 
-    27, 1, 0, 7, 30, 3, 3, 6, 0, 1, 
-    3, 0, 79, 4, 0, 22, 0, 5, 0, 0, 
-    0, 32, 1, 0, 27, 3, 1, 6, 32, 4, 
-    1, 6, 0, 3, 4, 0, 17, 0, 0, 0, 
-    0, 79, 1, 0, 22, 0, 57, 0, 0, 0, 
-    32, 1, 0, 34, 3, 1, 8, 10, 3, 0, 
-    0, 79, 1, 0, 22, 0, 28, 0, 0, 0, 
-    32, 1, 0, 27, 0, 1, 13, 34, 3, 0, 
-    9, 30, 1, 4, 74, 1, 10, 3, 1, 0, 
-    75, 1, 0, 79, 4, 0, 19, 0, 6, 0, 
-    0, 0, 32, 1, 0, 27, 0, 1, 10, 30, 
-    3, 5, 63, 0, 3, 0, 43, 1, 0, 10, 
-    17, 0, 0, 0, 0, 54, 17, 0, 0, 0, 
-    0, 34, 1, 2, 5, 30, 3, 2, 74, 3, 
-    74, 3, 74, 3, 10, 1, 3, 0, 75, 1, 
-    0, 75, 1, 0, 75, 1, 0, 5, 17, 15, 
-    0, 0, 0, 33, 1, 2, 30, 3, 6, 32, 
-    4, 0, 0, 5, 3, 4, 2, 74, 5, 10, 
-    1, 1, 0, 75, 1, 0, 40, 1, 0, 34, 
-    1, 2, 5, 53, 0, 1, 79, 3, 0, 22, 
-    0, 1, 0, 0, 0, 52, 5, 17, 0, 0, 
-    0, 0, 32, 0, 0, 27, 1, 0, 13, 34, 
-    3, 1, 9, 10, 3, 0, 0, 32, 1, 0, 
-    27, 3, 1, 13, 34, 4, 3, 11, 10, 4, 
-    0, 0, 17, 169, 255, 255, 255, 32, 0, 1, 
-    32, 1, 0, 43, 1, 0, 6, 32, 3, 0, 
-    27, 0, 3, 7, 30, 1, 5, 63, 0, 1, 
-    0, 43, 3, 0, 7, 30, 1, 1, 34, 3, 
-    2, 5, 30, 4, 2, 74, 4, 74, 4, 74, 
-    4, 10, 3, 3, 0, 75, 1, 0, 75, 1, 
-    0, 75, 1, 26, 5, 17, 0, 0, 0, 0, 
-    33, 0, 1, 32, 2, 1, 55, 0, 2, 41, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 22, 0, 7, 0, 0, 0, 17, 0, 0, 
+    0, 0, 33, 0, 1, 32, 1, 1, 55, 0, 
+    1, 17, 0, 0, 0, 0, 30, 0, 2, 41, 
+    0, 32, 1, 0, 27, 2, 1, 12, 34, 3, 
+    2, 4, 1, 32, 38, 3, 32, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
-    0, 0, 0, 2, 185, 0, 0, 0, 0, 0, 
-    0, 0, 10, 32, 32, 32, 32, 32, 32, 32, 
-    32, 65, 99, 113, 117, 105, 114, 101, 32, 116, 
-    104, 101, 32, 109, 111, 100, 117, 108, 101, 32, 
-    108, 111, 99, 107, 46, 32, 32, 73, 102, 32, 
-    97, 32, 112, 111, 116, 101, 110, 116, 105, 97, 
-    108, 32, 100, 101, 97, 100, 108, 111, 99, 107, 
-    32, 105, 115, 32, 100, 101, 116, 101, 99, 116, 
-    101, 100, 44, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 97, 32, 95, 68, 101, 97, 100, 108, 
-    111, 99, 107, 69, 114, 114, 111, 114, 32, 105, 
-    115, 32, 114, 97, 105, 115, 101, 100, 46, 10, 
-    32, 32, 32, 32, 32, 32, 32, 32, 79, 116, 
-    104, 101, 114, 119, 105, 115, 101, 44, 32, 116, 
-    104, 101, 32, 108, 111, 99, 107, 32, 105, 115, 
-    32, 97, 108, 119, 97, 121, 115, 32, 97, 99, 
-    113, 117, 105, 114, 101, 100, 32, 97, 110, 100, 
-    32, 84, 114, 117, 101, 32, 105, 115, 32, 114, 
-    101, 116, 117, 114, 110, 101, 100, 46, 10, 32, 
-    32, 32, 32, 32, 32, 32, 32, 6, 1, 5, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    2, 23, 0, 0, 0, 0, 0, 0, 0, 100, 
-    101, 97, 100, 108, 111, 99, 107, 32, 100, 101, 
-    116, 101, 99, 116, 101, 100, 32, 98, 121, 32, 
-    37, 114, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 17, 0, 0, 0, 0, 32, 0, 0, 27, 
+    1, 0, 7, 30, 3, 3, 6, 0, 1, 3, 
+    0, 79, 4, 0, 22, 0, 5, 0, 0, 0, 
+    32, 1, 0, 27, 3, 1, 6, 32, 4, 1, 
+    6, 0, 3, 4, 0, 17, 0, 0, 0, 0, 
+    79, 1, 0, 22, 0, 48, 0, 0, 0, 32, 
+    1, 0, 34, 3, 1, 8, 1, 32, 38, 3, 
+    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 79, 1, 0, 22, 0, 
+    19, 0, 0, 0, 32, 1, 0, 27, 0, 1, 
+    13, 34, 3, 0, 9, 1, 32, 30, 1, 4, 
+    38, 3, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 79, 4, 
+    0, 19, 0, 6, 0, 0, 0, 32, 1, 0, 
+    27, 0, 1, 10, 30, 3, 5, 63, 0, 3, 
+    0, 43, 1, 0, 10, 17, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 34, 1, 2, 5, 1, 
+    32, 30, 3, 2, 38, 1, 32, 3, 0, 0, 
+    0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 5, 17, 15, 0, 0, 0, 
+    33, 1, 2, 30, 3, 6, 32, 4, 0, 0, 
+    5, 3, 4, 2, 74, 5, 10, 1, 1, 0, 
+    75, 1, 0, 40, 1, 0, 34, 1, 2, 5, 
+    0, 0, 53, 0, 1, 79, 3, 0, 22, 0, 
+    1, 0, 0, 0, 52, 5, 17, 0, 0, 0, 
+    0, 32, 0, 0, 27, 1, 0, 13, 34, 3, 
+    1, 9, 1, 32, 38, 3, 32, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 32, 1, 0, 27, 3, 1, 13, 34, 4, 
+    3, 11, 1, 32, 38, 4, 32, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 17, 180, 255, 255, 255, 32, 0, 1, 32, 
+    1, 0, 43, 1, 0, 6, 32, 3, 0, 27, 
+    0, 3, 7, 30, 1, 5, 63, 0, 1, 0, 
+    43, 3, 0, 7, 30, 1, 1, 34, 3, 2, 
+    5, 1, 32, 30, 4, 2, 38, 3, 32, 3, 
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 5, 17, 0, 0, 
+    0, 0, 33, 0, 1, 32, 2, 1, 55, 0, 
+    2, 41, 1, 8, 0, 0, 0, 0, 0, 0, 
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
+    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 
+    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 25, 
+    0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 
+    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 
+    0, 61, 0, 0, 0, 0, 0, 0, 0, 75, 
+    0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 
+    0, 0, 0, 0, 0, 67, 0, 0, 0, 0, 
+    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
+    0, 67, 0, 0, 0, 0, 0, 0, 0, 75, 
+    0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 
+    0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 
+    0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 91, 
+    0, 0, 0, 0, 0, 0, 0, 109, 0, 0, 
+    0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 2, 185, 0, 0, 0, 
+    0, 0, 0, 0, 10, 32, 32, 32, 32, 32, 
+    32, 32, 32, 65, 99, 113, 117, 105, 114, 101, 
+    32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 
+    101, 32, 108, 111, 99, 107, 46, 32, 32, 73, 
+    102, 32, 97, 32, 112, 111, 116, 101, 110, 116, 
+    105, 97, 108, 32, 100, 101, 97, 100, 108, 111, 
+    99, 107, 32, 105, 115, 32, 100, 101, 116, 101, 
+    99, 116, 101, 100, 44, 10, 32, 32, 32, 32, 
+    32, 32, 32, 32, 97, 32, 95, 68, 101, 97, 
+    100, 108, 111, 99, 107, 69, 114, 114, 111, 114, 
+    32, 105, 115, 32, 114, 97, 105, 115, 101, 100, 
+    46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+    79, 116, 104, 101, 114, 119, 105, 115, 101, 44, 
+    32, 116, 104, 101, 32, 108, 111, 99, 107, 32, 
+    105, 115, 32, 97, 108, 119, 97, 121, 115, 32, 
+    97, 99, 113, 117, 105, 114, 101, 100, 32, 97, 
+    110, 100, 32, 84, 114, 117, 101, 32, 105, 115, 
+    32, 114, 101, 116, 117, 114, 110, 101, 100, 46, 
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 6, 
+    1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 2, 23, 0, 0, 0, 0, 0, 0, 
+    0, 100, 101, 97, 100, 108, 111, 99, 107, 32, 
+    100, 101, 116, 101, 99, 116, 101, 100, 32, 98, 
+    121, 32, 37, 114, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
-    0, 7, 0, 0, 0, 0, 0, 0, 0, 97, 
-    99, 113, 117, 105, 114, 101, 14, 0, 0, 0, 
-    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
-    0, 0, 95, 116, 104, 114, 101, 97, 100, 12, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 108, 
-    111, 99, 107, 105, 110, 103, 95, 111, 110, 14, 
-    0, 0, 0, 0, 0, 0, 0, 95, 68, 101, 
-    97, 100, 108, 111, 99, 107, 69, 114, 114, 111, 
-    114, 9, 0, 0, 0, 0, 0, 0, 0, 103, 
-    101, 116, 95, 105, 100, 101, 110, 116, 9, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 101, 110, 
-    116, 101, 114, 95, 95, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 101, 120, 105, 116, 95, 
-    95, 5, 0, 0, 0, 0, 0, 0, 0, 111, 
-    119, 110, 101, 114, 5, 0, 0, 0, 0, 0, 
-    0, 0, 99, 111, 117, 110, 116, 12, 0, 0, 
-    0, 0, 0, 0, 0, 104, 97, 115, 95, 100, 
-    101, 97, 100, 108, 111, 99, 107, 7, 0, 0, 
-    0, 0, 0, 0, 0, 97, 99, 113, 117, 105, 
-    114, 101, 7, 0, 0, 0, 0, 0, 0, 0, 
-    119, 97, 105, 116, 101, 114, 115, 7, 0, 0, 
-    0, 0, 0, 0, 0, 114, 101, 108, 101, 97, 
-    115, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
-    108, 111, 99, 107, 6, 0, 0, 0, 0, 0, 
-    0, 0, 119, 97, 107, 101, 117, 112, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 108, 102, 3, 0, 0, 0, 
-    0, 0, 0, 0, 116, 105, 100, 32, 0, 0, 
+    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
+    0, 97, 99, 113, 117, 105, 114, 101, 14, 0, 
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
+    0, 0, 0, 0, 95, 116, 104, 114, 101, 97, 
+    100, 12, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 108, 111, 99, 107, 105, 110, 103, 95, 111, 
+    110, 14, 0, 0, 0, 0, 0, 0, 0, 95, 
+    68, 101, 97, 100, 108, 111, 99, 107, 69, 114, 
+    114, 111, 114, 9, 0, 0, 0, 0, 0, 0, 
+    0, 103, 101, 116, 95, 105, 100, 101, 110, 116, 
+    9, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    101, 110, 116, 101, 114, 95, 95, 8, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 101, 120, 105, 
+    116, 95, 95, 5, 0, 0, 0, 0, 0, 0, 
+    0, 111, 119, 110, 101, 114, 5, 0, 0, 0, 
+    0, 0, 0, 0, 99, 111, 117, 110, 116, 12, 
+    0, 0, 0, 0, 0, 0, 0, 104, 97, 115, 
+    95, 100, 101, 97, 100, 108, 111, 99, 107, 7, 
+    0, 0, 0, 0, 0, 0, 0, 97, 99, 113, 
+    117, 105, 114, 101, 7, 0, 0, 0, 0, 0, 
+    0, 0, 119, 97, 105, 116, 101, 114, 115, 7, 
+    0, 0, 0, 0, 0, 0, 0, 114, 101, 108, 
+    101, 97, 115, 101, 4, 0, 0, 0, 0, 0, 
+    0, 0, 108, 111, 99, 107, 6, 0, 0, 0, 
+    0, 0, 0, 0, 119, 97, 107, 101, 117, 112, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 115, 101, 108, 102, 3, 0, 
+    0, 0, 0, 0, 0, 0, 116, 105, 100, 32, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
     0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
-    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
-    0, 36, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    77, 111, 100, 117, 108, 101, 83, 112, 101, 99, 
-    46, 95, 95, 105, 110, 105, 116, 95, 95, 46, 
-    51, 53, 48, 58, 52, 0, 29, 0, 0, 0, 
-    0, 0, 0, 0, 32, 0, 1, 32, 1, 0, 
-    43, 1, 0, 0, 32, 2, 2, 32, 0, 0, 
-    43, 0, 2, 1, 32, 1, 3, 32, 0, 0, 
-    43, 0, 1, 2, 32, 2, 4, 32, 0, 0, 
-    43, 0, 2, 3, 32, 1, 5, 79, 0, 1, 
-    22, 1, 2, 0, 0, 0, 30, 0, 0, 17, 
-    2, 0, 0, 0, 3, 0, 0, 17, 0, 0, 
-    0, 0, 32, 1, 0, 43, 1, 0, 4, 30, 
-    2, 1, 32, 0, 0, 43, 0, 2, 5, 30, 
-    1, 0, 32, 0, 0, 43, 0, 1, 6, 30, 
-    2, 0, 41, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 77, 111, 100, 117, 108, 101, 83, 112, 
+    101, 99, 46, 95, 95, 105, 110, 105, 116, 95, 
+    95, 46, 51, 53, 48, 58, 52, 0, 29, 0, 
+    0, 0, 0, 0, 0, 0, 32, 0, 1, 32, 
+    1, 0, 43, 1, 0, 0, 32, 2, 2, 32, 
+    0, 0, 43, 0, 2, 1, 32, 1, 3, 32, 
+    0, 0, 43, 0, 1, 2, 32, 2, 4, 32, 
+    0, 0, 43, 0, 2, 3, 32, 1, 5, 79, 
+    0, 1, 22, 1, 2, 0, 0, 0, 30, 0, 
+    0, 17, 2, 0, 0, 0, 3, 0, 0, 17, 
+    0, 0, 0, 0, 32, 1, 0, 43, 1, 0, 
+    4, 30, 2, 1, 32, 0, 0, 43, 0, 2, 
+    5, 30, 1, 0, 32, 0, 0, 43, 0, 1, 
+    6, 30, 2, 0, 41, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 5, 6, 0, 0, 
@@ -3994,140 +4266,146 @@ std::vector<uint8_t> _bootstrap
     3, 1, 0, 0, 1, 2, 45, 1, 3, 33, 
     1, 0, 32, 2, 1, 31, 3, 0, 74, 2, 
     74, 3, 10, 1, 2, 0, 75, 1, 0, 75, 
-    1, 0, 32, 4, 1, 41, 4, 1, 0, 0, 
+    1, 0, 32, 4, 1, 41, 4, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 102, 120, 110, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 47, 
-    0, 0, 0, 0, 0, 0, 0, 68, 101, 99, 
-    111, 114, 97, 116, 111, 114, 32, 116, 111, 32, 
-    118, 101, 114, 105, 102, 121, 32, 116, 104, 101, 
-    32, 110, 97, 109, 101, 100, 32, 109, 111, 100, 
-    117, 108, 101, 32, 105, 115, 32, 102, 114, 111, 
-    122, 101, 110, 46, 2, 58, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 114, 101, 113, 117, 105, 
-    114, 101, 115, 95, 102, 114, 111, 122, 101, 110, 
-    46, 95, 114, 101, 113, 117, 105, 114, 101, 115, 
-    95, 102, 114, 111, 122, 101, 110, 95, 119, 114, 
-    97, 112, 112, 101, 114, 46, 50, 53, 49, 58, 
-    52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 102, 120, 110, 2, 0, 
+    0, 0, 0, 0, 0, 0, 2, 47, 0, 0, 
+    0, 0, 0, 0, 0, 68, 101, 99, 111, 114, 
+    97, 116, 111, 114, 32, 116, 111, 32, 118, 101, 
+    114, 105, 102, 121, 32, 116, 104, 101, 32, 110, 
+    97, 109, 101, 100, 32, 109, 111, 100, 117, 108, 
+    101, 32, 105, 115, 32, 102, 114, 111, 122, 101, 
+    110, 46, 2, 58, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 95, 114, 101, 113, 117, 105, 114, 101, 
+    115, 95, 102, 114, 111, 122, 101, 110, 46, 95, 
+    114, 101, 113, 117, 105, 114, 101, 115, 95, 102, 
+    114, 111, 122, 101, 110, 95, 119, 114, 97, 112, 
+    112, 101, 114, 46, 50, 53, 49, 58, 52, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
-    16, 0, 0, 0, 0, 0, 0, 0, 95, 114, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 16, 0, 
+    0, 0, 0, 0, 0, 0, 95, 114, 101, 113, 
+    117, 105, 114, 101, 115, 95, 102, 114, 111, 122, 
+    101, 110, 1, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 95, 119, 
+    114, 97, 112, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 102, 120, 110, 
+    24, 0, 0, 0, 0, 0, 0, 0, 95, 114, 
     101, 113, 117, 105, 114, 101, 115, 95, 102, 114, 
-    111, 122, 101, 110, 1, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
-    95, 119, 114, 97, 112, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 102, 
-    120, 110, 24, 0, 0, 0, 0, 0, 0, 0, 
-    95, 114, 101, 113, 117, 105, 114, 101, 115, 95, 
-    102, 114, 111, 122, 101, 110, 95, 119, 114, 97, 
-    112, 112, 101, 114, 32, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 41, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 95, 68, 117, 
-    109, 109, 121, 77, 111, 100, 117, 108, 101, 76, 
-    111, 99, 107, 46, 114, 101, 108, 101, 97, 115, 
-    101, 46, 49, 52, 48, 58, 52, 0, 19, 0, 
-    0, 0, 0, 0, 0, 0, 32, 0, 0, 27, 
-    1, 0, 1, 30, 2, 0, 6, 0, 1, 2, 
-    0, 79, 3, 0, 19, 0, 6, 0, 0, 0, 
-    33, 1, 0, 30, 2, 1, 74, 2, 10, 1, 
-    1, 0, 75, 1, 0, 40, 1, 0, 32, 1, 
-    0, 27, 0, 1, 1, 30, 2, 2, 63, 0, 
-    2, 1, 43, 1, 0, 1, 30, 2, 3, 41, 
-    2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    111, 122, 101, 110, 95, 119, 114, 97, 112, 112, 
+    101, 114, 32, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 46, 95, 68, 117, 109, 109, 
+    121, 77, 111, 100, 117, 108, 101, 76, 111, 99, 
+    107, 46, 114, 101, 108, 101, 97, 115, 101, 46, 
+    49, 52, 48, 58, 52, 0, 19, 0, 0, 0, 
+    0, 0, 0, 0, 32, 0, 0, 27, 1, 0, 
+    1, 30, 2, 0, 6, 0, 1, 2, 0, 79, 
+    3, 0, 19, 0, 6, 0, 0, 0, 33, 1, 
+    0, 30, 2, 1, 74, 2, 10, 1, 1, 0, 
+    75, 1, 0, 40, 1, 0, 32, 1, 0, 27, 
+    0, 1, 1, 30, 2, 2, 63, 0, 2, 1, 
+    43, 1, 0, 1, 30, 2, 3, 41, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 31, 0, 0, 0, 0, 0, 0, 
-    0, 99, 97, 110, 110, 111, 116, 32, 114, 101, 
-    108, 101, 97, 115, 101, 32, 117, 110, 45, 97, 
-    99, 113, 117, 105, 114, 101, 100, 32, 108, 111, 
-    99, 107, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 31, 
+    0, 0, 0, 0, 0, 0, 0, 99, 97, 110, 
+    110, 111, 116, 32, 114, 101, 108, 101, 97, 115, 
+    101, 32, 117, 110, 45, 97, 99, 113, 117, 105, 
+    114, 101, 100, 32, 108, 111, 99, 107, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 7, 0, 0, 0, 0, 0, 0, 0, 114, 
-    101, 108, 101, 97, 115, 101, 2, 0, 0, 0, 
-    0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 
-    0, 0, 82, 117, 110, 116, 105, 109, 101, 69, 
-    114, 114, 111, 114, 5, 0, 0, 0, 0, 0, 
-    0, 0, 99, 111, 117, 110, 116, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 101, 108, 102, 32, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 34, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 77, 111, 
-    100, 117, 108, 101, 83, 112, 101, 99, 46, 112, 
-    97, 114, 101, 110, 116, 46, 51, 57, 55, 58, 
-    52, 0, 20, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 32, 1, 0, 27, 0, 1, 1, 
-    30, 2, 1, 6, 1, 0, 2, 6, 79, 3, 
-    1, 22, 1, 3, 0, 0, 0, 32, 0, 0, 
-    27, 1, 0, 2, 41, 1, 32, 0, 0, 27, 
-    1, 0, 2, 34, 2, 1, 0, 30, 3, 2, 
-    74, 3, 10, 2, 1, 0, 75, 1, 0, 30, 
-    1, 3, 1, 2, 0, 1, 41, 2, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 114, 101, 108, 101, 97, 
+    115, 101, 2, 0, 0, 0, 0, 0, 0, 0, 
+    12, 0, 0, 0, 0, 0, 0, 0, 82, 117, 
+    110, 116, 105, 109, 101, 69, 114, 114, 111, 114, 
+    5, 0, 0, 0, 0, 0, 0, 0, 99, 111, 
+    117, 110, 116, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 33, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 46, 77, 111, 100, 117, 108, 101, 
+    83, 112, 101, 99, 46, 112, 97, 114, 101, 110, 
+    116, 46, 51, 57, 55, 58, 52, 0, 18, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 32, 
+    1, 0, 27, 0, 1, 1, 30, 2, 1, 6, 
+    1, 0, 2, 6, 79, 3, 1, 22, 1, 3, 
+    0, 0, 0, 32, 0, 0, 27, 1, 0, 2, 
+    41, 1, 32, 0, 0, 27, 1, 0, 2, 34, 
+    2, 1, 0, 1, 32, 30, 3, 2, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 30, 1, 3, 1, 
+    2, 0, 1, 41, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    2, 32, 0, 0, 0, 0, 0, 0, 0, 84, 
-    104, 101, 32, 110, 97, 109, 101, 32, 111, 102, 
-    32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 
-    101, 39, 115, 32, 112, 97, 114, 101, 110, 116, 
-    46, 5, 2, 1, 0, 0, 0, 0, 0, 0, 
-    0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 2, 32, 0, 0, 0, 
+    0, 0, 0, 0, 84, 104, 101, 32, 110, 97, 
+    109, 101, 32, 111, 102, 32, 116, 104, 101, 32, 
+    109, 111, 100, 117, 108, 101, 39, 115, 32, 112, 
+    97, 114, 101, 110, 116, 46, 5, 2, 1, 0, 
+    0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    114, 101, 110, 116, 3, 0, 0, 0, 0, 0, 
-    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
-    114, 112, 97, 114, 116, 105, 116, 105, 111, 110, 
-    26, 0, 0, 0, 0, 0, 0, 0, 115, 117, 
-    98, 109, 111, 100, 117, 108, 101, 95, 115, 101, 
-    97, 114, 99, 104, 95, 108, 111, 99, 97, 116, 
-    105, 111, 110, 115, 4, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 32, 0, 0, 0, 0, 0, 
-    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
-    11, 0, 0, 0, 0, 0, 0, 0, 33, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 115, 112, 101, 
-    99, 95, 102, 114, 111, 109, 95, 108, 111, 97, 
-    100, 101, 114, 46, 52, 49, 52, 58, 48, 0, 
-    90, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
-    0, 33, 1, 0, 32, 2, 1, 30, 3, 1, 
-    74, 2, 74, 3, 10, 1, 2, 0, 75, 1, 
-    0, 75, 1, 0, 79, 4, 0, 22, 0, 37, 
-    0, 0, 0, 32, 1, 3, 30, 0, 2, 6, 
-    2, 1, 0, 6, 79, 3, 2, 19, 2, 67, 
-    0, 0, 0, 33, 1, 0, 32, 2, 1, 30, 
-    3, 3, 74, 2, 74, 3, 10, 1, 2, 0, 
-    75, 1, 0, 75, 1, 0, 79, 4, 0, 22, 
-    0, 3, 0, 0, 0, 30, 1, 4, 45, 3, 
-    1, 17, 53, 0, 0, 0, 42, 1, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
+    0, 0, 0, 112, 97, 114, 101, 110, 116, 3, 
+    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
+    0, 0, 0, 0, 0, 114, 112, 97, 114, 116, 
+    105, 116, 105, 111, 110, 26, 0, 0, 0, 0, 
+    0, 0, 0, 115, 117, 98, 109, 111, 100, 117, 
+    108, 101, 95, 115, 101, 97, 114, 99, 104, 95, 
+    108, 111, 99, 97, 116, 105, 111, 110, 115, 4, 
+    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 101, 108, 102, 33, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 
+    0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 115, 112, 101, 99, 95, 102, 114, 111, 
+    109, 95, 108, 111, 97, 100, 101, 114, 46, 52, 
+    49, 52, 58, 48, 0, 86, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 33, 1, 0, 32, 
+    2, 1, 30, 3, 1, 74, 2, 74, 3, 10, 
+    1, 2, 0, 75, 1, 0, 75, 1, 0, 79, 
+    4, 0, 22, 0, 33, 0, 0, 0, 32, 1, 
+    3, 30, 0, 2, 6, 2, 1, 0, 6, 79, 
+    3, 2, 19, 2, 63, 0, 0, 0, 33, 1, 
+    0, 32, 2, 1, 30, 3, 3, 74, 2, 74, 
+    3, 10, 1, 2, 0, 75, 1, 0, 75, 1, 
+    0, 79, 4, 0, 22, 0, 3, 0, 0, 0, 
+    30, 1, 4, 45, 3, 1, 17, 49, 0, 0, 
     0, 17, 7, 0, 0, 0, 33, 0, 3, 21, 
     0, 4, 0, 0, 0, 30, 1, 2, 45, 3, 
-    1, 5, 17, 10, 0, 0, 0, 52, 32, 0, 
-    1, 34, 1, 0, 5, 32, 2, 0, 74, 2, 
-    10, 1, 1, 0, 75, 1, 0, 45, 3, 0, 
-    54, 17, 0, 0, 0, 0, 17, 34, 0, 0, 
+    1, 5, 17, 7, 0, 0, 0, 52, 32, 0, 
+    1, 34, 1, 0, 5, 1, 32, 32, 2, 0, 
+    38, 1, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 45, 3, 
+    0, 17, 0, 0, 0, 0, 17, 34, 0, 0, 
     0, 33, 0, 1, 30, 1, 2, 6, 2, 0, 
     1, 6, 79, 3, 2, 22, 2, 27, 0, 0, 
     0, 33, 0, 1, 27, 1, 0, 6, 45, 4, 
@@ -4150,688 +4428,794 @@ std::vector<uint8_t> _bootstrap
     32, 5, 3, 12, 1, 2, 0, 0, 0, 0, 
     0, 0, 0, 2, 3, 2, 0, 0, 0, 0, 
     0, 0, 0, 4, 5, 2, 0, 0, 0, 0, 
-    0, 0, 0, 9, 5, 41, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 9, 5, 41, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 0, 0, 0, 0, 0, 37, 
+    0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 2, 
-    53, 0, 0, 0, 0, 0, 0, 0, 82, 101, 
-    116, 117, 114, 110, 32, 97, 32, 109, 111, 100, 
-    117, 108, 101, 32, 115, 112, 101, 99, 32, 98, 
-    97, 115, 101, 100, 32, 111, 110, 32, 118, 97, 
-    114, 105, 111, 117, 115, 32, 108, 111, 97, 100, 
-    101, 114, 32, 109, 101, 116, 104, 111, 100, 115, 
-    46, 2, 12, 0, 0, 0, 0, 0, 0, 0, 
-    103, 101, 116, 95, 102, 105, 108, 101, 110, 97, 
-    109, 101, 5, 2, 10, 0, 0, 0, 0, 0, 
-    0, 0, 105, 115, 95, 112, 97, 99, 107, 97, 
-    103, 101, 6, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
+    0, 0, 0, 0, 0, 2, 53, 0, 0, 0, 
+    0, 0, 0, 0, 82, 101, 116, 117, 114, 110, 
+    32, 97, 32, 109, 111, 100, 117, 108, 101, 32, 
+    115, 112, 101, 99, 32, 98, 97, 115, 101, 100, 
+    32, 111, 110, 32, 118, 97, 114, 105, 111, 117, 
+    115, 32, 108, 111, 97, 100, 101, 114, 32, 109, 
+    101, 116, 104, 111, 100, 115, 46, 2, 12, 0, 
+    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
+    102, 105, 108, 101, 110, 97, 109, 101, 5, 2, 
+    10, 0, 0, 0, 0, 0, 0, 0, 105, 115, 
+    95, 112, 97, 99, 107, 97, 103, 101, 6, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 
-    0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 
-    0, 115, 112, 101, 99, 95, 102, 114, 111, 109, 
-    95, 108, 111, 97, 100, 101, 114, 10, 0, 0, 
-    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
-    0, 0, 0, 104, 97, 115, 97, 116, 116, 114, 
-    19, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 19, 0, 0, 
-    0, 0, 0, 0, 0, 78, 111, 116, 73, 109, 
-    112, 108, 101, 109, 101, 110, 116, 101, 100, 69, 
-    114, 114, 111, 114, 11, 0, 0, 0, 0, 0, 
-    0, 0, 73, 109, 112, 111, 114, 116, 69, 114, 
-    114, 111, 114, 10, 0, 0, 0, 0, 0, 0, 
-    0, 77, 111, 100, 117, 108, 101, 83, 112, 101, 
-    99, 10, 0, 0, 0, 0, 0, 0, 0, 105, 
-    115, 95, 112, 97, 99, 107, 97, 103, 101, 23, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 16, 
     0, 0, 0, 0, 0, 0, 0, 115, 112, 101, 
-    99, 95, 102, 114, 111, 109, 95, 102, 105, 108, 
-    101, 95, 108, 111, 99, 97, 116, 105, 111, 110, 
-    6, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
-    97, 100, 101, 114, 26, 0, 0, 0, 0, 0, 
-    0, 0, 115, 117, 98, 109, 111, 100, 117, 108, 
-    101, 95, 115, 101, 97, 114, 99, 104, 95, 108, 
-    111, 99, 97, 116, 105, 111, 110, 115, 6, 0, 
-    0, 0, 0, 0, 0, 0, 111, 114, 105, 103, 
-    105, 110, 0, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 
-    6, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
-    97, 100, 101, 114, 6, 0, 0, 0, 0, 0, 
-    0, 0, 111, 114, 105, 103, 105, 110, 10, 0, 
-    0, 0, 0, 0, 0, 0, 105, 115, 95, 112, 
-    97, 99, 107, 97, 103, 101, 23, 0, 0, 0, 
-    0, 0, 0, 0, 115, 112, 101, 99, 95, 102, 
-    114, 111, 109, 95, 102, 105, 108, 101, 95, 108, 
-    111, 99, 97, 116, 105, 111, 110, 6, 0, 0, 
-    0, 0, 0, 0, 0, 115, 101, 97, 114, 99, 
-    104, 32, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
-    0, 0, 0, 0, 0, 42, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 68, 117, 109, 109, 121, 
-    77, 111, 100, 117, 108, 101, 76, 111, 99, 107, 
-    46, 95, 95, 114, 101, 112, 114, 95, 95, 46, 
-    49, 52, 53, 58, 52, 0, 18, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 34, 1, 0, 
-    1, 32, 2, 0, 27, 3, 2, 2, 33, 4, 
-    0, 32, 2, 0, 74, 2, 10, 4, 1, 0, 
-    75, 1, 0, 74, 0, 74, 3, 74, 0, 10, 
-    1, 2, 0, 75, 1, 12, 75, 1, 189, 39, 
-    5, 0, 75, 0, 0, 41, 5, 0, 0, 0, 
+    99, 95, 102, 114, 111, 109, 95, 108, 111, 97, 
+    100, 101, 114, 10, 0, 0, 0, 0, 0, 0, 
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 104, 
+    97, 115, 97, 116, 116, 114, 19, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 19, 0, 0, 0, 0, 0, 0, 
+    0, 78, 111, 116, 73, 109, 112, 108, 101, 109, 
+    101, 110, 116, 101, 100, 69, 114, 114, 111, 114, 
+    11, 0, 0, 0, 0, 0, 0, 0, 73, 109, 
+    112, 111, 114, 116, 69, 114, 114, 111, 114, 10, 
+    0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 
+    117, 108, 101, 83, 112, 101, 99, 10, 0, 0, 
+    0, 0, 0, 0, 0, 105, 115, 95, 112, 97, 
+    99, 107, 97, 103, 101, 23, 0, 0, 0, 0, 
+    0, 0, 0, 115, 112, 101, 99, 95, 102, 114, 
+    111, 109, 95, 102, 105, 108, 101, 95, 108, 111, 
+    99, 97, 116, 105, 111, 110, 6, 0, 0, 0, 
+    0, 0, 0, 0, 108, 111, 97, 100, 101, 114, 
+    26, 0, 0, 0, 0, 0, 0, 0, 115, 117, 
+    98, 109, 111, 100, 117, 108, 101, 95, 115, 101, 
+    97, 114, 99, 104, 95, 108, 111, 99, 97, 116, 
+    105, 111, 110, 115, 6, 0, 0, 0, 0, 0, 
+    0, 0, 111, 114, 105, 103, 105, 110, 0, 0, 
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 110, 97, 109, 101, 6, 0, 0, 0, 
+    0, 0, 0, 0, 108, 111, 97, 100, 101, 114, 
+    6, 0, 0, 0, 0, 0, 0, 0, 111, 114, 
+    105, 103, 105, 110, 10, 0, 0, 0, 0, 0, 
+    0, 0, 105, 115, 95, 112, 97, 99, 107, 97, 
+    103, 101, 23, 0, 0, 0, 0, 0, 0, 0, 
+    115, 112, 101, 99, 95, 102, 114, 111, 109, 95, 
+    102, 105, 108, 101, 95, 108, 111, 99, 97, 116, 
+    105, 111, 110, 6, 0, 0, 0, 0, 0, 0, 
+    0, 115, 101, 97, 114, 99, 104, 33, 0, 0, 
     0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
+    0, 42, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
+    95, 68, 117, 109, 109, 121, 77, 111, 100, 117, 
+    108, 101, 76, 111, 99, 107, 46, 95, 95, 114, 
+    101, 112, 114, 95, 95, 46, 49, 52, 53, 58, 
+    52, 0, 14, 0, 0, 0, 0, 0, 0, 0, 
+    30, 0, 0, 34, 1, 0, 1, 1, 32, 32, 
+    2, 0, 27, 3, 2, 2, 33, 4, 0, 32, 
+    2, 0, 74, 2, 10, 4, 1, 0, 75, 1, 
+    0, 74, 0, 38, 1, 32, 2, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
-    28, 0, 0, 0, 0, 0, 0, 0, 95, 68, 
-    117, 109, 109, 121, 77, 111, 100, 117, 108, 101, 
-    76, 111, 99, 107, 40, 123, 33, 114, 125, 41, 
-    32, 97, 116, 32, 123, 125, 0, 0, 0, 0, 
+    0, 0, 39, 5, 0, 75, 0, 0, 41, 5, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    2, 28, 0, 0, 0, 0, 0, 0, 0, 95, 
+    68, 117, 109, 109, 121, 77, 111, 100, 117, 108, 
+    101, 76, 111, 99, 107, 40, 123, 33, 114, 125, 
+    41, 32, 97, 116, 32, 123, 125, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
-    0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 114, 101, 112, 114, 95, 
-    95, 3, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 105, 100, 6, 
-    0, 0, 0, 0, 0, 0, 0, 102, 111, 114, 
-    109, 97, 116, 4, 0, 0, 0, 0, 0, 0, 
-    0, 110, 97, 109, 101, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 32, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 11, 
-    0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 95, 103, 99, 100, 
-    95, 105, 109, 112, 111, 114, 116, 46, 49, 48, 
-    49, 55, 58, 48, 0, 39, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 33, 1, 0, 32, 
-    2, 0, 32, 3, 1, 32, 4, 2, 74, 2, 
-    74, 3, 74, 4, 10, 1, 3, 0, 75, 1, 
-    0, 75, 1, 0, 75, 1, 0, 32, 5, 2, 
-    30, 0, 1, 6, 1, 5, 0, 4, 79, 2, 
-    1, 19, 1, 13, 0, 0, 0, 33, 2, 1, 
-    32, 1, 0, 32, 3, 1, 32, 4, 2, 74, 
-    1, 74, 3, 74, 4, 10, 2, 3, 0, 75, 
-    1, 0, 75, 1, 0, 75, 1, 0, 45, 0, 
-    0, 17, 0, 0, 0, 0, 33, 1, 2, 32, 
-    2, 0, 33, 3, 3, 74, 2, 74, 3, 10, 
-    1, 2, 0, 75, 1, 4, 75, 1, 85, 41, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 2, 50, 1, 0, 0, 0, 0, 
-    0, 0, 73, 109, 112, 111, 114, 116, 32, 97, 
-    110, 100, 32, 114, 101, 116, 117, 114, 110, 32, 
-    116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 
-    32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 
-    105, 116, 115, 32, 110, 97, 109, 101, 44, 32, 
-    116, 104, 101, 32, 112, 97, 99, 107, 97, 103, 
-    101, 32, 116, 104, 101, 32, 99, 97, 108, 108, 
-    32, 105, 115, 10, 32, 32, 32, 32, 98, 101, 
-    105, 110, 103, 32, 109, 97, 100, 101, 32, 102, 
-    114, 111, 109, 44, 32, 97, 110, 100, 32, 116, 
-    104, 101, 32, 108, 101, 118, 101, 108, 32, 97, 
-    100, 106, 117, 115, 116, 109, 101, 110, 116, 46, 
-    10, 10, 32, 32, 32, 32, 84, 104, 105, 115, 
-    32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 
-    114, 101, 112, 114, 101, 115, 101, 110, 116, 115, 
-    32, 116, 104, 101, 32, 103, 114, 101, 97, 116, 
-    101, 115, 116, 32, 99, 111, 109, 109, 111, 110, 
-    32, 100, 101, 110, 111, 109, 105, 110, 97, 116, 
-    111, 114, 32, 111, 102, 32, 102, 117, 110, 99, 
-    116, 105, 111, 110, 97, 108, 105, 116, 121, 10, 
-    32, 32, 32, 32, 98, 101, 116, 119, 101, 101, 
-    110, 32, 105, 109, 112, 111, 114, 116, 95, 109, 
-    111, 100, 117, 108, 101, 32, 97, 110, 100, 32, 
-    95, 95, 105, 109, 112, 111, 114, 116, 95, 95, 
-    46, 32, 84, 104, 105, 115, 32, 105, 110, 99, 
-    108, 117, 100, 101, 115, 32, 115, 101, 116, 116, 
-    105, 110, 103, 32, 95, 95, 112, 97, 99, 107, 
-    97, 103, 101, 95, 95, 32, 105, 102, 10, 32, 
-    32, 32, 32, 116, 104, 101, 32, 108, 111, 97, 
-    100, 101, 114, 32, 100, 105, 100, 32, 110, 111, 
-    116, 46, 10, 10, 32, 32, 32, 32, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
+    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 114, 101, 112, 114, 
+    95, 95, 3, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 105, 100, 
+    6, 0, 0, 0, 0, 0, 0, 0, 102, 111, 
+    114, 109, 97, 116, 4, 0, 0, 0, 0, 0, 
+    0, 0, 110, 97, 109, 101, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 32, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 29, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 46, 95, 103, 99, 
+    100, 95, 105, 109, 112, 111, 114, 116, 46, 49, 
+    48, 49, 55, 58, 48, 0, 39, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 33, 1, 0, 
+    32, 2, 0, 32, 3, 1, 32, 4, 2, 74, 
+    2, 74, 3, 74, 4, 10, 1, 3, 0, 75, 
+    1, 0, 75, 1, 0, 75, 1, 0, 32, 5, 
+    2, 30, 0, 1, 6, 1, 5, 0, 4, 79, 
+    2, 1, 19, 1, 13, 0, 0, 0, 33, 2, 
+    1, 32, 1, 0, 32, 3, 1, 32, 4, 2, 
+    74, 1, 74, 3, 74, 4, 10, 2, 3, 0, 
+    75, 1, 0, 75, 1, 0, 75, 1, 0, 45, 
+    0, 0, 17, 0, 0, 0, 0, 33, 1, 2, 
+    32, 2, 0, 33, 3, 3, 74, 2, 74, 3, 
+    10, 1, 2, 0, 75, 1, 4, 75, 1, 85, 
+    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 50, 1, 0, 0, 0, 0, 0, 
+    0, 73, 109, 112, 111, 114, 116, 32, 97, 110, 
+    100, 32, 114, 101, 116, 117, 114, 110, 32, 116, 
+    104, 101, 32, 109, 111, 100, 117, 108, 101, 32, 
+    98, 97, 115, 101, 100, 32, 111, 110, 32, 105, 
+    116, 115, 32, 110, 97, 109, 101, 44, 32, 116, 
+    104, 101, 32, 112, 97, 99, 107, 97, 103, 101, 
+    32, 116, 104, 101, 32, 99, 97, 108, 108, 32, 
+    105, 115, 10, 32, 32, 32, 32, 98, 101, 105, 
+    110, 103, 32, 109, 97, 100, 101, 32, 102, 114, 
+    111, 109, 44, 32, 97, 110, 100, 32, 116, 104, 
+    101, 32, 108, 101, 118, 101, 108, 32, 97, 100, 
+    106, 117, 115, 116, 109, 101, 110, 116, 46, 10, 
+    10, 32, 32, 32, 32, 84, 104, 105, 115, 32, 
+    102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 
+    101, 112, 114, 101, 115, 101, 110, 116, 115, 32, 
+    116, 104, 101, 32, 103, 114, 101, 97, 116, 101, 
+    115, 116, 32, 99, 111, 109, 109, 111, 110, 32, 
+    100, 101, 110, 111, 109, 105, 110, 97, 116, 111, 
+    114, 32, 111, 102, 32, 102, 117, 110, 99, 116, 
+    105, 111, 110, 97, 108, 105, 116, 121, 10, 32, 
+    32, 32, 32, 98, 101, 116, 119, 101, 101, 110, 
+    32, 105, 109, 112, 111, 114, 116, 95, 109, 111, 
+    100, 117, 108, 101, 32, 97, 110, 100, 32, 95, 
+    95, 105, 109, 112, 111, 114, 116, 95, 95, 46, 
+    32, 84, 104, 105, 115, 32, 105, 110, 99, 108, 
+    117, 100, 101, 115, 32, 115, 101, 116, 116, 105, 
+    110, 103, 32, 95, 95, 112, 97, 99, 107, 97, 
+    103, 101, 95, 95, 32, 105, 102, 10, 32, 32, 
+    32, 32, 116, 104, 101, 32, 108, 111, 97, 100, 
+    101, 114, 32, 100, 105, 100, 32, 110, 111, 116, 
+    46, 10, 10, 32, 32, 32, 32, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
-    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 
+    0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 
+    0, 0, 0, 95, 103, 99, 100, 95, 105, 109, 
+    112, 111, 114, 116, 4, 0, 0, 0, 0, 0, 
+    0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 
+    95, 115, 97, 110, 105, 116, 121, 95, 99, 104, 
+    101, 99, 107, 13, 0, 0, 0, 0, 0, 0, 
+    0, 95, 114, 101, 115, 111, 108, 118, 101, 95, 
+    110, 97, 109, 101, 14, 0, 0, 0, 0, 0, 
+    0, 0, 95, 102, 105, 110, 100, 95, 97, 110, 
+    100, 95, 108, 111, 97, 100, 11, 0, 0, 0, 
     0, 0, 0, 0, 95, 103, 99, 100, 95, 105, 
-    109, 112, 111, 114, 116, 4, 0, 0, 0, 0, 
-    0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 
-    0, 95, 115, 97, 110, 105, 116, 121, 95, 99, 
-    104, 101, 99, 107, 13, 0, 0, 0, 0, 0, 
-    0, 0, 95, 114, 101, 115, 111, 108, 118, 101, 
-    95, 110, 97, 109, 101, 14, 0, 0, 0, 0, 
-    0, 0, 0, 95, 102, 105, 110, 100, 95, 97, 
-    110, 100, 95, 108, 111, 97, 100, 11, 0, 0, 
-    0, 0, 0, 0, 0, 95, 103, 99, 100, 95, 
-    105, 109, 112, 111, 114, 116, 0, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    110, 97, 109, 101, 7, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 99, 107, 97, 103, 101, 5, 
-    0, 0, 0, 0, 0, 0, 0, 108, 101, 118, 
-    101, 108, 32, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 29, 0, 
-    0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 46, 95, 101, 120, 101, 99, 
-    46, 53, 57, 49, 58, 48, 0, 191, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 32, 1, 
-    0, 27, 0, 1, 12, 45, 2, 0, 33, 1, 
-    0, 32, 2, 2, 74, 2, 10, 1, 1, 0, 
-    75, 1, 0, 34, 3, 0, 5, 74, 0, 10, 
-    3, 0, 0, 39, 1, 0, 75, 0, 0, 56, 
-    167, 0, 0, 0, 17, 0, 0, 0, 0, 33, 
-    1, 1, 27, 2, 1, 13, 34, 3, 2, 7, 
-    32, 1, 2, 74, 0, 74, 1, 10, 3, 1, 
-    0, 75, 1, 0, 39, 2, 0, 75, 0, 0, 
+    109, 112, 111, 114, 116, 0, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
+    97, 109, 101, 7, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 99, 107, 97, 103, 101, 5, 0, 
+    0, 0, 0, 0, 0, 0, 108, 101, 118, 101, 
+    108, 33, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 
+    0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 46, 95, 101, 120, 101, 99, 46, 
+    53, 57, 49, 58, 48, 0, 169, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 32, 1, 0, 
+    27, 0, 1, 12, 45, 2, 0, 33, 1, 0, 
+    32, 2, 2, 74, 2, 10, 1, 1, 0, 75, 
+    1, 0, 34, 3, 0, 5, 1, 32, 74, 0, 
+    38, 3, 32, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 39, 1, 0, 
+    75, 0, 0, 17, 0, 0, 0, 0, 33, 1, 
+    1, 27, 2, 1, 13, 34, 3, 2, 7, 1, 
+    32, 32, 1, 2, 74, 0, 38, 3, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 39, 2, 0, 75, 0, 0, 
     32, 4, 1, 6, 1, 2, 4, 7, 79, 3, 
-    1, 22, 1, 134, 0, 0, 0, 42, 1, 0, 
-    0, 0, 17, 19, 0, 0, 0, 33, 1, 1, 
-    27, 2, 1, 13, 34, 3, 2, 9, 32, 1, 
-    0, 27, 2, 1, 12, 74, 0, 74, 2, 10, 
-    3, 1, 0, 75, 1, 0, 39, 4, 0, 75, 
-    0, 0, 45, 1, 4, 32, 2, 1, 33, 1, 
-    1, 27, 3, 1, 13, 32, 4, 0, 27, 1, 
-    4, 12, 48, 3, 1, 2, 52, 32, 1, 0, 
-    27, 2, 1, 14, 30, 3, 1, 6, 1, 2, 
-    3, 6, 79, 4, 1, 22, 1, 46, 0, 0, 
-    0, 33, 2, 3, 32, 1, 0, 32, 3, 1, 
-    30, 4, 2, 74, 0, 12, 2, 2, 0, 0, 
-    0, 0, 0, 0, 0, 1, 3, 1, 0, 0, 
-    0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 
-    0, 0, 0, 0, 15, 39, 5, 0, 75, 0, 
-    0, 33, 6, 4, 32, 1, 0, 27, 2, 1, 
-    14, 30, 3, 3, 74, 0, 74, 2, 74, 3, 
-    10, 6, 2, 0, 75, 1, 0, 75, 1, 0, 
-    39, 1, 0, 75, 0, 0, 49, 4, 1, 3, 
-    79, 2, 4, 22, 4, 11, 0, 0, 0, 32, 
-    1, 0, 27, 2, 1, 14, 34, 3, 2, 11, 
-    32, 1, 1, 74, 0, 74, 1, 10, 3, 1, 
-    0, 75, 1, 0, 39, 2, 0, 75, 0, 0, 
-    17, 11, 0, 0, 0, 32, 1, 0, 27, 2, 
-    1, 14, 34, 3, 2, 10, 32, 1, 2, 74, 
-    0, 74, 1, 10, 3, 1, 0, 75, 1, 0, 
-    39, 2, 0, 75, 0, 0, 17, 0, 0, 0, 
-    0, 17, 15, 0, 0, 0, 32, 1, 0, 27, 
-    2, 1, 16, 30, 3, 1, 6, 1, 2, 3, 
-    6, 79, 4, 1, 22, 1, 46, 0, 0, 0, 
-    33, 2, 3, 32, 1, 0, 32, 3, 1, 30, 
-    4, 2, 74, 0, 12, 2, 2, 0, 0, 0, 
-    0, 0, 0, 0, 1, 3, 1, 0, 0, 0, 
-    0, 0, 0, 0, 4, 1, 0, 0, 0, 0, 
-    0, 0, 0, 15, 39, 5, 0, 75, 0, 0, 
-    17, 0, 0, 0, 0, 54, 17, 0, 0, 0, 
-    0, 33, 1, 1, 27, 2, 1, 13, 34, 3, 
-    2, 9, 32, 1, 0, 27, 2, 1, 12, 74, 
-    0, 74, 2, 10, 3, 1, 0, 75, 1, 0, 
-    39, 4, 0, 75, 0, 0, 45, 1, 4, 32, 
-    2, 1, 33, 1, 1, 27, 3, 1, 13, 32, 
-    4, 0, 27, 1, 4, 12, 48, 3, 1, 2, 
-    17, 0, 0, 0, 0, 54, 17, 0, 0, 0, 
-    0, 34, 1, 0, 6, 30, 2, 1, 74, 0, 
-    74, 2, 74, 2, 74, 2, 10, 1, 3, 0, 
-    75, 1, 0, 75, 1, 73, 75, 1, 0, 39, 
-    3, 0, 75, 0, 0, 5, 17, 34, 0, 0, 
+    1, 22, 1, 117, 0, 0, 0, 17, 17, 0, 
+    0, 0, 33, 1, 1, 27, 2, 1, 13, 34, 
+    3, 2, 9, 1, 32, 32, 1, 0, 27, 2, 
+    1, 12, 74, 0, 38, 3, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 39, 4, 0, 75, 0, 0, 45, 1, 
+    4, 32, 2, 1, 33, 1, 1, 27, 3, 1, 
+    13, 32, 4, 0, 27, 1, 4, 12, 48, 3, 
+    1, 2, 52, 32, 1, 0, 27, 2, 1, 14, 
+    30, 3, 1, 6, 1, 2, 3, 6, 79, 4, 
+    1, 22, 1, 42, 0, 0, 0, 33, 2, 3, 
+    32, 1, 0, 32, 3, 1, 30, 4, 2, 74, 
+    0, 12, 2, 2, 0, 0, 0, 0, 0, 0, 
+    0, 1, 3, 1, 0, 0, 0, 0, 0, 0, 
+    0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 
+    15, 39, 5, 0, 75, 0, 0, 33, 6, 4, 
+    32, 1, 0, 27, 2, 1, 14, 30, 3, 3, 
+    74, 0, 74, 2, 74, 3, 10, 6, 2, 0, 
+    75, 1, 0, 75, 1, 0, 39, 1, 0, 75, 
+    0, 0, 49, 4, 1, 3, 79, 2, 4, 22, 
+    4, 9, 0, 0, 0, 32, 1, 0, 27, 2, 
+    1, 14, 34, 3, 2, 11, 1, 32, 32, 1, 
+    1, 74, 0, 38, 3, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 39, 2, 0, 75, 0, 0, 17, 9, 0, 
+    0, 0, 32, 1, 0, 27, 2, 1, 14, 34, 
+    3, 2, 10, 1, 32, 32, 1, 2, 74, 0, 
+    38, 3, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 2, 
+    0, 75, 0, 0, 17, 0, 0, 0, 0, 17, 
+    15, 0, 0, 0, 32, 1, 0, 27, 2, 1, 
+    16, 30, 3, 1, 6, 1, 2, 3, 6, 79, 
+    4, 1, 22, 1, 36, 0, 0, 0, 33, 2, 
+    3, 32, 1, 0, 32, 3, 1, 30, 4, 2, 
+    74, 0, 12, 2, 2, 0, 0, 0, 0, 0, 
+    0, 0, 1, 3, 1, 0, 0, 0, 0, 0, 
+    0, 0, 4, 1, 0, 0, 0, 0, 0, 0, 
+    0, 15, 39, 5, 0, 75, 0, 0, 17, 0, 
+    0, 0, 0, 17, 0, 0, 0, 0, 33, 1, 
+    1, 27, 2, 1, 13, 34, 3, 2, 9, 1, 
+    32, 32, 1, 0, 27, 2, 1, 12, 74, 0, 
+    38, 3, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 4, 
+    0, 75, 0, 0, 45, 1, 4, 32, 2, 1, 
+    33, 1, 1, 27, 3, 1, 13, 32, 4, 0, 
+    27, 1, 4, 12, 48, 3, 1, 2, 17, 0, 
+    0, 0, 0, 17, 0, 0, 0, 0, 34, 1, 
+    0, 6, 1, 32, 30, 2, 1, 74, 0, 38, 
+    1, 32, 3, 0, 0, 0, 0, 0, 0, 0, 
+    2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 
+    3, 0, 75, 0, 0, 5, 17, 32, 0, 0, 
     0, 33, 1, 2, 30, 2, 4, 32, 3, 0, 
     27, 4, 3, 12, 74, 0, 12, 1, 1, 0, 
     0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 
     0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 
     0, 0, 0, 0, 12, 39, 5, 0, 75, 0, 
     0, 40, 1, 5, 30, 1, 5, 34, 2, 1, 
-    8, 32, 3, 2, 74, 0, 74, 3, 10, 2, 
-    1, 0, 75, 1, 236, 39, 1, 0, 75, 0, 
-    0, 45, 3, 1, 33, 2, 2, 32, 1, 3, 
-    32, 3, 2, 74, 0, 12, 2, 1, 0, 0, 
-    0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 
-    0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 
-    0, 0, 0, 12, 39, 4, 0, 75, 0, 0, 
-    40, 1, 4, 34, 1, 0, 6, 53, 0, 1, 
-    79, 2, 0, 22, 0, 1, 0, 0, 0, 52, 
-    5, 17, 0, 0, 0, 0, 32, 0, 1, 41, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    8, 1, 32, 32, 3, 2, 74, 0, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 3, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
-    0, 0, 0, 2, 70, 0, 0, 0, 0, 0, 
-    0, 0, 69, 120, 101, 99, 117, 116, 101, 32, 
-    116, 104, 101, 32, 115, 112, 101, 99, 39, 115, 
-    32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 
-    32, 109, 111, 100, 117, 108, 101, 32, 105, 110, 
-    32, 97, 110, 32, 101, 120, 105, 115, 116, 105, 
-    110, 103, 32, 109, 111, 100, 117, 108, 101, 39, 
-    115, 32, 110, 97, 109, 101, 115, 112, 97, 99, 
-    101, 46, 5, 6, 1, 2, 11, 0, 0, 0, 
-    0, 0, 0, 0, 101, 120, 101, 99, 95, 109, 
-    111, 100, 117, 108, 101, 2, 14, 0, 0, 0, 
-    0, 0, 0, 0, 109, 105, 115, 115, 105, 110, 
-    103, 32, 108, 111, 97, 100, 101, 114, 2, 30, 
+    0, 0, 0, 0, 0, 0, 39, 1, 0, 75, 
+    0, 0, 45, 3, 1, 33, 2, 2, 32, 1, 
+    3, 32, 3, 2, 74, 0, 12, 2, 1, 0, 
+    0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 
+    0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 
+    0, 0, 0, 0, 12, 39, 4, 0, 75, 0, 
+    0, 40, 1, 4, 34, 1, 0, 6, 0, 0, 
+    53, 0, 1, 79, 2, 0, 22, 0, 1, 0, 
+    0, 0, 52, 5, 17, 0, 0, 0, 0, 32, 
+    0, 1, 41, 0, 7, 0, 0, 0, 0, 0, 
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 
+    27, 0, 0, 0, 0, 0, 0, 0, 160, 0, 
+    0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 
+    0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 
+    0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 
+    28, 0, 0, 0, 0, 0, 0, 0, 45, 0, 
+    0, 0, 0, 0, 0, 0, 160, 0, 0, 0, 
+    0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 
+    0, 0, 108, 0, 0, 0, 0, 0, 0, 0, 
+    28, 0, 0, 0, 0, 0, 0, 0, 108, 0, 
+    0, 0, 0, 0, 0, 0, 126, 0, 0, 0, 
+    0, 0, 0, 0, 160, 0, 0, 0, 0, 0, 
+    0, 0, 135, 0, 0, 0, 0, 0, 0, 0, 
+    144, 0, 0, 0, 0, 0, 0, 0, 28, 0, 
+    0, 0, 0, 0, 0, 0, 144, 0, 0, 0, 
+    0, 0, 0, 0, 160, 0, 0, 0, 0, 0, 
+    0, 0, 160, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
+    0, 0, 2, 70, 0, 0, 0, 0, 0, 0, 
+    0, 69, 120, 101, 99, 117, 116, 101, 32, 116, 
+    104, 101, 32, 115, 112, 101, 99, 39, 115, 32, 
+    115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 
+    109, 111, 100, 117, 108, 101, 32, 105, 110, 32, 
+    97, 110, 32, 101, 120, 105, 115, 116, 105, 110, 
+    103, 32, 109, 111, 100, 117, 108, 101, 39, 115, 
+    32, 110, 97, 109, 101, 115, 112, 97, 99, 101, 
+    46, 5, 6, 1, 2, 11, 0, 0, 0, 0, 
+    0, 0, 0, 101, 120, 101, 99, 95, 109, 111, 
+    100, 117, 108, 101, 2, 14, 0, 0, 0, 0, 
+    0, 0, 0, 109, 105, 115, 115, 105, 110, 103, 
+    32, 108, 111, 97, 100, 101, 114, 2, 30, 0, 
+    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
+    108, 101, 32, 123, 33, 114, 125, 32, 110, 111, 
+    116, 32, 105, 110, 32, 115, 121, 115, 46, 109, 
+    111, 100, 117, 108, 101, 115, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 95, 101, 120, 101, 99, 17, 0, 
+    0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 
+    0, 0, 0, 0, 95, 77, 111, 100, 117, 108, 
+    101, 76, 111, 99, 107, 77, 97, 110, 97, 103, 
+    101, 114, 3, 0, 0, 0, 0, 0, 0, 0, 
+    115, 121, 115, 11, 0, 0, 0, 0, 0, 0, 
+    0, 73, 109, 112, 111, 114, 116, 69, 114, 114, 
+    111, 114, 18, 0, 0, 0, 0, 0, 0, 0, 
+    95, 105, 110, 105, 116, 95, 109, 111, 100, 117, 
+    108, 101, 95, 97, 116, 116, 114, 115, 7, 0, 
+    0, 0, 0, 0, 0, 0, 104, 97, 115, 97, 
+    116, 116, 114, 9, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 101, 110, 116, 101, 114, 95, 95, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    101, 120, 105, 116, 95, 95, 3, 0, 0, 0, 
+    0, 0, 0, 0, 103, 101, 116, 6, 0, 0, 
+    0, 0, 0, 0, 0, 102, 111, 114, 109, 97, 
+    116, 3, 0, 0, 0, 0, 0, 0, 0, 112, 
+    111, 112, 11, 0, 0, 0, 0, 0, 0, 0, 
+    108, 111, 97, 100, 95, 109, 111, 100, 117, 108, 
+    101, 11, 0, 0, 0, 0, 0, 0, 0, 101, 
+    120, 101, 99, 95, 109, 111, 100, 117, 108, 101, 
+    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+    109, 101, 7, 0, 0, 0, 0, 0, 0, 0, 
+    109, 111, 100, 117, 108, 101, 115, 6, 0, 0, 
+    0, 0, 0, 0, 0, 108, 111, 97, 100, 101, 
+    114, 8, 0, 0, 0, 0, 0, 0, 0, 111, 
+    118, 101, 114, 114, 105, 100, 101, 26, 0, 0, 
+    0, 0, 0, 0, 0, 115, 117, 98, 109, 111, 
+    100, 117, 108, 101, 95, 115, 101, 97, 114, 99, 
+    104, 95, 108, 111, 99, 97, 116, 105, 111, 110, 
+    115, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 112, 101, 99, 6, 
     0, 0, 0, 0, 0, 0, 0, 109, 111, 100, 
-    117, 108, 101, 32, 123, 33, 114, 125, 32, 110, 
-    111, 116, 32, 105, 110, 32, 115, 121, 115, 46, 
-    109, 111, 100, 117, 108, 101, 115, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    117, 108, 101, 4, 0, 0, 0, 0, 0, 0, 
+    0, 110, 97, 109, 101, 3, 0, 0, 0, 0, 
+    0, 0, 0, 109, 115, 103, 33, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    34, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 46, 77, 
+    111, 100, 117, 108, 101, 83, 112, 101, 99, 46, 
+    99, 97, 99, 104, 101, 100, 46, 51, 56, 52, 
+    58, 52, 0, 36, 0, 0, 0, 0, 0, 0, 
+    0, 32, 0, 0, 27, 1, 0, 3, 30, 2, 
+    0, 6, 0, 1, 2, 6, 79, 3, 0, 19, 
+    0, 27, 0, 0, 0, 32, 1, 0, 27, 0, 
+    1, 4, 30, 2, 0, 6, 1, 0, 2, 7, 
+    79, 3, 1, 19, 1, 3, 0, 0, 0, 32, 
+    0, 0, 27, 1, 0, 5, 17, 0, 0, 0, 
+    0, 79, 0, 1, 19, 1, 15, 0, 0, 0, 
+    33, 0, 0, 30, 1, 0, 6, 2, 0, 1, 
+    6, 79, 3, 2, 19, 2, 2, 0, 0, 0, 
+    33, 0, 1, 40, 1, 0, 33, 1, 0, 34, 
+    2, 1, 2, 1, 32, 32, 3, 0, 27, 1, 
+    3, 4, 38, 2, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 
-    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
-    0, 0, 0, 0, 95, 101, 120, 101, 99, 17, 
-    0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 
-    0, 0, 0, 0, 0, 95, 77, 111, 100, 117, 
-    108, 101, 76, 111, 99, 107, 77, 97, 110, 97, 
-    103, 101, 114, 3, 0, 0, 0, 0, 0, 0, 
-    0, 115, 121, 115, 11, 0, 0, 0, 0, 0, 
-    0, 0, 73, 109, 112, 111, 114, 116, 69, 114, 
-    114, 111, 114, 18, 0, 0, 0, 0, 0, 0, 
-    0, 95, 105, 110, 105, 116, 95, 109, 111, 100, 
-    117, 108, 101, 95, 97, 116, 116, 114, 115, 7, 
-    0, 0, 0, 0, 0, 0, 0, 104, 97, 115, 
-    97, 116, 116, 114, 9, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 101, 110, 116, 101, 114, 95, 
-    95, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 101, 120, 105, 116, 95, 95, 3, 0, 0, 
-    0, 0, 0, 0, 0, 103, 101, 116, 6, 0, 
-    0, 0, 0, 0, 0, 0, 102, 111, 114, 109, 
-    97, 116, 3, 0, 0, 0, 0, 0, 0, 0, 
-    112, 111, 112, 11, 0, 0, 0, 0, 0, 0, 
-    0, 108, 111, 97, 100, 95, 109, 111, 100, 117, 
-    108, 101, 11, 0, 0, 0, 0, 0, 0, 0, 
-    101, 120, 101, 99, 95, 109, 111, 100, 117, 108, 
-    101, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
-    97, 109, 101, 7, 0, 0, 0, 0, 0, 0, 
-    0, 109, 111, 100, 117, 108, 101, 115, 6, 0, 
-    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
-    101, 114, 8, 0, 0, 0, 0, 0, 0, 0, 
-    111, 118, 101, 114, 114, 105, 100, 101, 26, 0, 
-    0, 0, 0, 0, 0, 0, 115, 117, 98, 109, 
-    111, 100, 117, 108, 101, 95, 115, 101, 97, 114, 
-    99, 104, 95, 108, 111, 99, 97, 116, 105, 111, 
-    110, 115, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 115, 112, 101, 99, 
-    6, 0, 0, 0, 0, 0, 0, 0, 109, 111, 
-    100, 117, 108, 101, 4, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 3, 0, 0, 0, 
-    0, 0, 0, 0, 109, 115, 103, 32, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 34, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    77, 111, 100, 117, 108, 101, 83, 112, 101, 99, 
-    46, 99, 97, 99, 104, 101, 100, 46, 51, 56, 
-    52, 58, 52, 0, 38, 0, 0, 0, 0, 0, 
-    0, 0, 32, 0, 0, 27, 1, 0, 3, 30, 
-    2, 0, 6, 0, 1, 2, 6, 79, 3, 0, 
-    19, 0, 29, 0, 0, 0, 32, 1, 0, 27, 
-    0, 1, 4, 30, 2, 0, 6, 1, 0, 2, 
-    7, 79, 3, 1, 19, 1, 3, 0, 0, 0, 
-    32, 0, 0, 27, 1, 0, 5, 17, 0, 0, 
-    0, 0, 79, 0, 1, 19, 1, 17, 0, 0, 
-    0, 33, 0, 0, 30, 1, 0, 6, 2, 0, 
-    1, 6, 79, 3, 2, 19, 2, 2, 0, 0, 
-    0, 33, 0, 1, 40, 1, 0, 33, 1, 0, 
-    34, 2, 1, 2, 32, 3, 0, 27, 1, 3, 
-    4, 74, 1, 10, 2, 1, 0, 75, 1, 181, 
     32, 3, 0, 43, 3, 0, 3, 17, 0, 0, 
     0, 0, 17, 0, 0, 0, 0, 32, 0, 0, 
     27, 1, 0, 3, 41, 1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
-    0, 0, 0, 0, 0, 0, 99, 97, 99, 104, 
-    101, 100, 6, 0, 0, 0, 0, 0, 0, 0, 
-    19, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 19, 0, 0, 
-    0, 0, 0, 0, 0, 78, 111, 116, 73, 109, 
-    112, 108, 101, 109, 101, 110, 116, 101, 100, 69, 
-    114, 114, 111, 114, 11, 0, 0, 0, 0, 0, 
-    0, 0, 95, 103, 101, 116, 95, 99, 97, 99, 
-    104, 101, 100, 7, 0, 0, 0, 0, 0, 0, 
-    0, 95, 99, 97, 99, 104, 101, 100, 6, 0, 
-    0, 0, 0, 0, 0, 0, 111, 114, 105, 103, 
-    105, 110, 13, 0, 0, 0, 0, 0, 0, 0, 
-    95, 115, 101, 116, 95, 102, 105, 108, 101, 97, 
-    116, 116, 114, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
-    102, 32, 0, 0, 0, 0, 0, 0, 0, 5, 
-    0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 
-    0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 105, 110, 105, 116, 95, 
-    109, 111, 100, 117, 108, 101, 95, 97, 116, 116, 
-    114, 115, 46, 52, 56, 53, 58, 48, 0, 17, 
-    1, 0, 0, 0, 0, 0, 0, 32, 1, 2, 
-    79, 0, 1, 22, 1, 14, 0, 0, 0, 33, 
-    2, 0, 32, 3, 1, 30, 4, 0, 30, 5, 
-    1, 74, 3, 74, 4, 74, 5, 10, 2, 3, 
-    0, 75, 1, 0, 75, 1, 0, 75, 1, 0, 
-    30, 6, 1, 6, 1, 0, 6, 6, 17, 0, 
-    0, 0, 0, 79, 0, 1, 19, 1, 14, 0, 
-    0, 0, 42, 1, 0, 0, 0, 17, 5, 0, 
-    0, 0, 33, 0, 1, 21, 0, 2, 0, 0, 
-    0, 5, 17, 7, 0, 0, 0, 52, 32, 0, 
-    0, 27, 1, 0, 14, 32, 2, 1, 43, 2, 
-    1, 4, 54, 17, 0, 0, 0, 0, 17, 0, 
-    0, 0, 0, 32, 1, 2, 79, 0, 1, 22, 
-    1, 14, 0, 0, 0, 33, 2, 0, 32, 3, 
-    1, 30, 4, 2, 30, 5, 1, 74, 3, 74, 
-    4, 74, 5, 10, 2, 3, 0, 75, 1, 53, 
-    75, 1, 0, 75, 1, 58, 30, 6, 1, 6, 
-    1, 0, 6, 6, 17, 0, 0, 0, 0, 79, 
-    0, 1, 19, 1, 54, 0, 0, 0, 32, 0, 
-    0, 27, 1, 0, 7, 45, 3, 1, 32, 0, 
-    3, 30, 1, 1, 6, 2, 0, 1, 6, 79, 
-    3, 2, 19, 2, 33, 0, 0, 0, 32, 0, 
-    0, 27, 1, 0, 15, 30, 2, 1, 6, 0, 
-    1, 2, 7, 79, 3, 0, 19, 0, 26, 0, 
-    0, 0, 33, 1, 2, 30, 0, 1, 6, 2, 
-    1, 0, 6, 79, 3, 2, 22, 2, 196, 0, 
-    0, 0, 33, 0, 2, 27, 1, 0, 16, 45, 
-    4, 1, 32, 0, 4, 34, 1, 0, 5, 32, 
-    2, 4, 74, 2, 10, 1, 1, 0, 75, 1, 
-    188, 45, 3, 0, 32, 1, 0, 27, 0, 1, 
-    15, 32, 2, 3, 43, 2, 0, 6, 32, 1, 
-    3, 32, 0, 0, 43, 0, 1, 7, 30, 2, 
-    1, 32, 0, 1, 43, 0, 2, 8, 17, 0, 
-    0, 0, 0, 17, 0, 0, 0, 0, 42, 1, 
-    0, 0, 0, 17, 5, 0, 0, 0, 33, 0, 
-    1, 21, 0, 2, 0, 0, 0, 5, 17, 6, 
-    0, 0, 0, 52, 32, 0, 3, 32, 1, 1, 
-    43, 1, 0, 9, 54, 17, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 99, 97, 99, 104, 101, 100, 
+    6, 0, 0, 0, 0, 0, 0, 0, 19, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 19, 0, 0, 0, 0, 
+    0, 0, 0, 78, 111, 116, 73, 109, 112, 108, 
+    101, 109, 101, 110, 116, 101, 100, 69, 114, 114, 
+    111, 114, 11, 0, 0, 0, 0, 0, 0, 0, 
+    95, 103, 101, 116, 95, 99, 97, 99, 104, 101, 
+    100, 7, 0, 0, 0, 0, 0, 0, 0, 95, 
+    99, 97, 99, 104, 101, 100, 6, 0, 0, 0, 
+    0, 0, 0, 0, 111, 114, 105, 103, 105, 110, 
+    13, 0, 0, 0, 0, 0, 0, 0, 95, 115, 
+    101, 116, 95, 102, 105, 108, 101, 97, 116, 116, 
+    114, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 101, 108, 102, 33, 
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
+    0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 
+    0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 95, 105, 110, 105, 116, 95, 109, 111, 
+    100, 117, 108, 101, 95, 97, 116, 116, 114, 115, 
+    46, 52, 56, 53, 58, 48, 0, 1, 1, 0, 
+    0, 0, 0, 0, 0, 32, 1, 2, 79, 0, 
+    1, 22, 1, 14, 0, 0, 0, 33, 2, 0, 
+    32, 3, 1, 30, 4, 0, 30, 5, 1, 74, 
+    3, 74, 4, 74, 5, 10, 2, 3, 0, 75, 
+    1, 0, 75, 1, 0, 75, 1, 0, 30, 6, 
+    1, 6, 1, 0, 6, 6, 17, 0, 0, 0, 
+    0, 79, 0, 1, 19, 1, 12, 0, 0, 0, 
+    17, 5, 0, 0, 0, 33, 0, 1, 21, 0, 
+    2, 0, 0, 0, 5, 17, 6, 0, 0, 0, 
+    52, 32, 0, 0, 27, 1, 0, 14, 32, 2, 
+    1, 43, 2, 1, 4, 17, 0, 0, 0, 0, 
     17, 0, 0, 0, 0, 32, 1, 2, 79, 0, 
     1, 22, 1, 14, 0, 0, 0, 33, 2, 0, 
-    32, 3, 1, 30, 4, 3, 30, 5, 1, 74, 
+    32, 3, 1, 30, 4, 2, 30, 5, 1, 74, 
     3, 74, 4, 74, 5, 10, 2, 3, 0, 75, 
-    1, 136, 75, 1, 189, 75, 1, 0, 30, 6, 
+    1, 53, 75, 1, 0, 75, 1, 58, 30, 6, 
     1, 6, 1, 0, 6, 6, 17, 0, 0, 0, 
-    0, 79, 0, 1, 19, 1, 14, 0, 0, 0, 
-    42, 1, 0, 0, 0, 17, 5, 0, 0, 0, 
-    33, 0, 1, 21, 0, 2, 0, 0, 0, 5, 
-    17, 7, 0, 0, 0, 52, 32, 0, 0, 27, 
-    1, 0, 17, 32, 2, 1, 43, 2, 1, 10, 
-    54, 17, 0, 0, 0, 0, 17, 0, 0, 0, 
-    0, 42, 1, 0, 0, 0, 17, 5, 0, 0, 
-    0, 33, 0, 1, 21, 0, 2, 0, 0, 0, 
-    5, 17, 6, 0, 0, 0, 52, 32, 0, 0, 
-    32, 1, 1, 43, 1, 0, 11, 54, 17, 0, 
+    0, 79, 0, 1, 19, 1, 50, 0, 0, 0, 
+    32, 0, 0, 27, 1, 0, 7, 45, 3, 1, 
+    32, 0, 3, 30, 1, 1, 6, 2, 0, 1, 
+    6, 79, 3, 2, 19, 2, 31, 0, 0, 0, 
+    32, 0, 0, 27, 1, 0, 15, 30, 2, 1, 
+    6, 0, 1, 2, 7, 79, 3, 0, 19, 0, 
+    24, 0, 0, 0, 33, 1, 2, 30, 0, 1, 
+    6, 2, 1, 0, 6, 79, 3, 2, 22, 2, 
+    182, 0, 0, 0, 33, 0, 2, 27, 1, 0, 
+    16, 45, 4, 1, 32, 0, 4, 34, 1, 0, 
+    5, 1, 32, 32, 2, 4, 38, 1, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 45, 3, 0, 32, 1, 0, 
+    27, 0, 1, 15, 32, 2, 3, 43, 2, 0, 
+    6, 32, 1, 3, 32, 0, 0, 43, 0, 1, 
+    7, 30, 2, 1, 32, 0, 1, 43, 0, 2, 
+    8, 17, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 17, 5, 0, 0, 0, 33, 0, 1, 21, 
+    0, 2, 0, 0, 0, 5, 17, 5, 0, 0, 
+    0, 52, 32, 0, 3, 32, 1, 1, 43, 1, 
+    0, 9, 17, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 32, 1, 2, 79, 0, 1, 22, 1, 
+    14, 0, 0, 0, 33, 2, 0, 32, 3, 1, 
+    30, 4, 3, 30, 5, 1, 74, 3, 74, 4, 
+    74, 5, 10, 2, 3, 0, 75, 1, 136, 75, 
+    1, 189, 75, 1, 0, 30, 6, 1, 6, 1, 
+    0, 6, 6, 17, 0, 0, 0, 0, 79, 0, 
+    1, 19, 1, 12, 0, 0, 0, 17, 5, 0, 
+    0, 0, 33, 0, 1, 21, 0, 2, 0, 0, 
+    0, 5, 17, 6, 0, 0, 0, 52, 32, 0, 
+    0, 27, 1, 0, 17, 32, 2, 1, 43, 2, 
+    1, 10, 17, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 17, 5, 0, 0, 0, 33, 0, 1, 
+    21, 0, 2, 0, 0, 0, 5, 17, 5, 0, 
+    0, 0, 52, 32, 0, 0, 32, 1, 1, 43, 
+    1, 0, 11, 17, 0, 0, 0, 0, 32, 1, 
+    2, 79, 0, 1, 22, 1, 14, 0, 0, 0, 
+    33, 2, 0, 32, 3, 1, 30, 4, 4, 30, 
+    5, 1, 74, 3, 74, 4, 74, 5, 10, 2, 
+    3, 0, 75, 1, 188, 75, 1, 189, 75, 1, 
+    250, 30, 6, 1, 6, 1, 0, 6, 6, 17, 
+    0, 0, 0, 0, 79, 0, 1, 19, 1, 19, 
+    0, 0, 0, 32, 0, 0, 27, 1, 0, 15, 
+    30, 2, 1, 6, 0, 1, 2, 7, 79, 3, 
+    0, 19, 0, 12, 0, 0, 0, 17, 5, 0, 
+    0, 0, 33, 0, 1, 21, 0, 2, 0, 0, 
+    0, 5, 17, 6, 0, 0, 0, 52, 32, 0, 
+    0, 27, 1, 0, 15, 32, 2, 1, 43, 2, 
+    1, 12, 17, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 17, 0, 0, 0, 0, 32, 0, 0, 
+    27, 1, 0, 18, 79, 2, 1, 19, 1, 72, 
+    0, 0, 0, 32, 2, 2, 79, 0, 2, 22, 
+    2, 14, 0, 0, 0, 33, 1, 0, 32, 3, 
+    1, 30, 4, 5, 30, 5, 1, 74, 3, 74, 
+    4, 74, 5, 10, 1, 3, 0, 75, 1, 53, 
+    75, 1, 188, 75, 1, 189, 30, 6, 1, 6, 
+    2, 0, 6, 6, 17, 0, 0, 0, 0, 79, 
+    0, 2, 19, 2, 12, 0, 0, 0, 17, 5, 
+    0, 0, 0, 33, 0, 1, 21, 0, 2, 0, 
+    0, 0, 5, 17, 6, 0, 0, 0, 52, 32, 
+    0, 0, 27, 1, 0, 19, 32, 2, 1, 43, 
+    2, 1, 8, 17, 0, 0, 0, 0, 17, 0, 
     0, 0, 0, 32, 1, 2, 79, 0, 1, 22, 
     1, 14, 0, 0, 0, 33, 2, 0, 32, 3, 
-    1, 30, 4, 4, 30, 5, 1, 74, 3, 74, 
+    1, 30, 4, 6, 30, 5, 1, 74, 3, 74, 
     4, 74, 5, 10, 2, 3, 0, 75, 1, 188, 
-    75, 1, 189, 75, 1, 250, 30, 6, 1, 6, 
+    75, 1, 188, 75, 1, 189, 30, 6, 1, 6, 
     1, 0, 6, 6, 17, 0, 0, 0, 0, 79, 
     0, 1, 19, 1, 21, 0, 0, 0, 32, 0, 
-    0, 27, 1, 0, 15, 30, 2, 1, 6, 0, 
+    0, 27, 1, 0, 20, 30, 2, 1, 6, 0, 
     1, 2, 7, 79, 3, 0, 19, 0, 14, 0, 
-    0, 0, 42, 1, 0, 0, 0, 17, 5, 0, 
-    0, 0, 33, 0, 1, 21, 0, 2, 0, 0, 
-    0, 5, 17, 7, 0, 0, 0, 52, 32, 0, 
-    0, 27, 1, 0, 15, 32, 2, 1, 43, 2, 
-    1, 12, 54, 17, 0, 0, 0, 0, 17, 0, 
-    0, 0, 0, 17, 0, 0, 0, 0, 32, 0, 
-    0, 27, 1, 0, 18, 79, 2, 1, 19, 1, 
-    76, 0, 0, 0, 32, 2, 2, 79, 0, 2, 
-    22, 2, 14, 0, 0, 0, 33, 1, 0, 32, 
-    3, 1, 30, 4, 5, 30, 5, 1, 74, 3, 
-    74, 4, 74, 5, 10, 1, 3, 0, 75, 1, 
-    53, 75, 1, 188, 75, 1, 189, 30, 6, 1, 
-    6, 2, 0, 6, 6, 17, 0, 0, 0, 0, 
-    79, 0, 2, 19, 2, 14, 0, 0, 0, 42, 
-    1, 0, 0, 0, 17, 5, 0, 0, 0, 33, 
-    0, 1, 21, 0, 2, 0, 0, 0, 5, 17, 
-    7, 0, 0, 0, 52, 32, 0, 0, 27, 1, 
-    0, 19, 32, 2, 1, 43, 2, 1, 8, 54, 
-    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
-    32, 1, 2, 79, 0, 1, 22, 1, 14, 0, 
-    0, 0, 33, 2, 0, 32, 3, 1, 30, 4, 
-    6, 30, 5, 1, 74, 3, 74, 4, 74, 5, 
-    10, 2, 3, 0, 75, 1, 188, 75, 1, 188, 
-    75, 1, 189, 30, 6, 1, 6, 1, 0, 6, 
-    6, 17, 0, 0, 0, 0, 79, 0, 1, 19, 
-    1, 23, 0, 0, 0, 32, 0, 0, 27, 1, 
-    0, 20, 30, 2, 1, 6, 0, 1, 2, 7, 
-    79, 3, 0, 19, 0, 16, 0, 0, 0, 42, 
-    1, 0, 0, 0, 17, 5, 0, 0, 0, 33, 
-    0, 1, 21, 0, 2, 0, 0, 0, 5, 17, 
-    7, 0, 0, 0, 52, 32, 0, 0, 27, 1, 
-    0, 20, 32, 2, 1, 43, 2, 1, 13, 54, 
-    17, 0, 0, 0, 0, 17, 2, 0, 0, 0, 
-    33, 0, 3, 40, 1, 0, 17, 0, 0, 0, 
-    0, 17, 0, 0, 0, 0, 32, 0, 1, 41, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 17, 5, 0, 0, 0, 33, 0, 1, 
+    21, 0, 2, 0, 0, 0, 5, 17, 6, 0, 
+    0, 0, 52, 32, 0, 0, 27, 1, 0, 20, 
+    32, 2, 1, 43, 2, 1, 13, 17, 0, 0, 
+    0, 0, 17, 2, 0, 0, 0, 33, 0, 3, 
+    40, 1, 0, 17, 0, 0, 0, 0, 17, 0, 
+    0, 0, 0, 32, 0, 1, 41, 0, 14, 0, 
+    0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 
+    0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 
+    0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 
+    25, 0, 0, 0, 0, 0, 0, 0, 29, 0, 
+    0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 
+    0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 
+    0, 0, 90, 0, 0, 0, 0, 0, 0, 0, 
+    90, 0, 0, 0, 0, 0, 0, 0, 95, 0, 
+    0, 0, 0, 0, 0, 0, 98, 0, 0, 0, 
+    0, 0, 0, 0, 90, 0, 0, 0, 0, 0, 
+    0, 0, 119, 0, 0, 0, 0, 0, 0, 0, 
+    120, 0, 0, 0, 0, 0, 0, 0, 120, 0, 
+    0, 0, 0, 0, 0, 0, 125, 0, 0, 0, 
+    0, 0, 0, 0, 129, 0, 0, 0, 0, 0, 
+    0, 0, 120, 0, 0, 0, 0, 0, 0, 0, 
+    131, 0, 0, 0, 0, 0, 0, 0, 132, 0, 
+    0, 0, 0, 0, 0, 0, 132, 0, 0, 0, 
+    0, 0, 0, 0, 137, 0, 0, 0, 0, 0, 
+    0, 0, 140, 0, 0, 0, 0, 0, 0, 0, 
+    132, 0, 0, 0, 0, 0, 0, 0, 166, 0, 
+    0, 0, 0, 0, 0, 0, 167, 0, 0, 0, 
+    0, 0, 0, 0, 167, 0, 0, 0, 0, 0, 
+    0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 
+    176, 0, 0, 0, 0, 0, 0, 0, 167, 0, 
+    0, 0, 0, 0, 0, 0, 202, 0, 0, 0, 
+    0, 0, 0, 0, 203, 0, 0, 0, 0, 0, 
+    0, 0, 203, 0, 0, 0, 0, 0, 0, 0, 
+    208, 0, 0, 0, 0, 0, 0, 0, 212, 0, 
+    0, 0, 0, 0, 0, 0, 203, 0, 0, 0, 
+    0, 0, 0, 0, 239, 0, 0, 0, 0, 0, 
+    0, 0, 240, 0, 0, 0, 0, 0, 0, 0, 
+    240, 0, 0, 0, 0, 0, 0, 0, 245, 0, 
+    0, 0, 0, 0, 0, 0, 249, 0, 0, 0, 
+    0, 0, 0, 0, 240, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
-    0, 0, 0, 2, 8, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 110, 97, 109, 101, 95, 95, 
-    5, 2, 10, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 108, 111, 97, 100, 101, 114, 95, 95, 
-    2, 11, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 112, 97, 99, 107, 97, 103, 101, 95, 95, 
-    2, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 112, 97, 116, 104, 95, 95, 2, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 102, 105, 
-    108, 101, 95, 95, 2, 10, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 99, 97, 99, 104, 101, 
-    100, 95, 95, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
+    0, 0, 0, 0, 2, 8, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 110, 97, 109, 101, 95, 
+    95, 5, 2, 10, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 108, 111, 97, 100, 101, 114, 95, 
+    95, 2, 11, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 112, 97, 99, 107, 97, 103, 101, 95, 
+    95, 2, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 112, 97, 116, 104, 95, 95, 2, 8, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 102, 
+    105, 108, 101, 95, 95, 2, 10, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 99, 97, 99, 104, 
+    101, 100, 95, 95, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 
-    0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 
-    95, 105, 110, 105, 116, 95, 109, 111, 100, 117, 
-    108, 101, 95, 97, 116, 116, 114, 115, 21, 0, 
-    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
-    0, 0, 0, 0, 103, 101, 116, 97, 116, 116, 
-    114, 14, 0, 0, 0, 0, 0, 0, 0, 65, 
-    116, 116, 114, 105, 98, 117, 116, 101, 69, 114, 
-    114, 111, 114, 19, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    19, 0, 0, 0, 0, 0, 0, 0, 78, 111, 
-    116, 73, 109, 112, 108, 101, 109, 101, 110, 116, 
-    101, 100, 69, 114, 114, 111, 114, 8, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 110, 97, 109, 
-    101, 95, 95, 7, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 110, 101, 119, 95, 95, 5, 0, 
-    0, 0, 0, 0, 0, 0, 95, 112, 97, 116, 
-    104, 6, 0, 0, 0, 0, 0, 0, 0, 108, 
-    111, 97, 100, 101, 114, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 102, 105, 108, 101, 95, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 
+    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 
+    0, 95, 105, 110, 105, 116, 95, 109, 111, 100, 
+    117, 108, 101, 95, 97, 116, 116, 114, 115, 21, 
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 103, 101, 116, 97, 116, 
+    116, 114, 14, 0, 0, 0, 0, 0, 0, 0, 
+    65, 116, 116, 114, 105, 98, 117, 116, 101, 69, 
+    114, 114, 111, 114, 19, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 19, 0, 0, 0, 0, 0, 0, 0, 78, 
+    111, 116, 73, 109, 112, 108, 101, 109, 101, 110, 
+    116, 101, 100, 69, 114, 114, 111, 114, 8, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 110, 97, 
+    109, 101, 95, 95, 7, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 110, 101, 119, 95, 95, 5, 
+    0, 0, 0, 0, 0, 0, 0, 95, 112, 97, 
+    116, 104, 6, 0, 0, 0, 0, 0, 0, 0, 
+    108, 111, 97, 100, 101, 114, 8, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 102, 105, 108, 101, 
+    95, 95, 10, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 108, 111, 97, 100, 101, 114, 95, 95, 
+    11, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    112, 97, 99, 107, 97, 103, 101, 95, 95, 8, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 115, 
+    112, 101, 99, 95, 95, 8, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 112, 97, 116, 104, 95, 
     95, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 108, 111, 97, 100, 101, 114, 95, 95, 11, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 112, 
-    97, 99, 107, 97, 103, 101, 95, 95, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 115, 112, 
-    101, 99, 95, 95, 8, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 112, 97, 116, 104, 95, 95, 
-    10, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    99, 97, 99, 104, 101, 100, 95, 95, 4, 0, 
-    0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 
-    26, 0, 0, 0, 0, 0, 0, 0, 115, 117, 
-    98, 109, 111, 100, 117, 108, 101, 95, 115, 101, 
-    97, 114, 99, 104, 95, 108, 111, 99, 97, 116, 
-    105, 111, 110, 115, 16, 0, 0, 0, 0, 0, 
-    0, 0, 95, 78, 97, 109, 101, 115, 112, 97, 
-    99, 101, 76, 111, 97, 100, 101, 114, 6, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 114, 101, 
-    110, 116, 12, 0, 0, 0, 0, 0, 0, 0, 
-    104, 97, 115, 95, 108, 111, 99, 97, 116, 105, 
-    111, 110, 6, 0, 0, 0, 0, 0, 0, 0, 
-    111, 114, 105, 103, 105, 110, 6, 0, 0, 0, 
-    0, 0, 0, 0, 99, 97, 99, 104, 101, 100, 
-    0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 112, 101, 99, 6, 0, 
-    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
-    108, 101, 8, 0, 0, 0, 0, 0, 0, 0, 
-    111, 118, 101, 114, 114, 105, 100, 101, 6, 0, 
-    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
-    101, 114, 16, 0, 0, 0, 0, 0, 0, 0, 
-    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
-    76, 111, 97, 100, 101, 114, 32, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    40, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 77, 
-    111, 100, 117, 108, 101, 83, 112, 101, 99, 46, 
-    104, 97, 115, 95, 108, 111, 99, 97, 116, 105, 
-    111, 110, 46, 52, 48, 53, 58, 52, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 
-    27, 1, 0, 0, 41, 1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    95, 99, 97, 99, 104, 101, 100, 95, 95, 4, 
+    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
+    101, 26, 0, 0, 0, 0, 0, 0, 0, 115, 
+    117, 98, 109, 111, 100, 117, 108, 101, 95, 115, 
+    101, 97, 114, 99, 104, 95, 108, 111, 99, 97, 
+    116, 105, 111, 110, 115, 16, 0, 0, 0, 0, 
+    0, 0, 0, 95, 78, 97, 109, 101, 115, 112, 
+    97, 99, 101, 76, 111, 97, 100, 101, 114, 6, 
+    0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 
+    101, 110, 116, 12, 0, 0, 0, 0, 0, 0, 
+    0, 104, 97, 115, 95, 108, 111, 99, 97, 116, 
+    105, 111, 110, 6, 0, 0, 0, 0, 0, 0, 
+    0, 111, 114, 105, 103, 105, 110, 6, 0, 0, 
+    0, 0, 0, 0, 0, 99, 97, 99, 104, 101, 
+    100, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 112, 101, 99, 6, 
+    0, 0, 0, 0, 0, 0, 0, 109, 111, 100, 
+    117, 108, 101, 8, 0, 0, 0, 0, 0, 0, 
+    0, 111, 118, 101, 114, 114, 105, 100, 101, 6, 
+    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
+    100, 101, 114, 16, 0, 0, 0, 0, 0, 0, 
+    0, 95, 78, 97, 109, 101, 115, 112, 97, 99, 
+    101, 76, 111, 97, 100, 101, 114, 32, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 40, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
+    77, 111, 100, 117, 108, 101, 83, 112, 101, 99, 
+    46, 104, 97, 115, 95, 108, 111, 99, 97, 116, 
+    105, 111, 110, 46, 52, 48, 53, 58, 52, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 32, 0, 
+    0, 27, 1, 0, 0, 41, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 
-    0, 0, 0, 0, 0, 104, 97, 115, 95, 108, 
-    111, 99, 97, 116, 105, 111, 110, 1, 0, 0, 
-    0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 
-    0, 0, 0, 95, 115, 101, 116, 95, 102, 105, 
-    108, 101, 97, 116, 116, 114, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 32, 0, 0, 0, 0, 0, 
-    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
-    9, 0, 0, 0, 0, 0, 0, 0, 34, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 95, 115, 112, 
-    101, 99, 95, 102, 114, 111, 109, 95, 109, 111, 
-    100, 117, 108, 101, 46, 52, 52, 48, 58, 48, 
-    0, 142, 0, 0, 0, 0, 0, 0, 0, 42, 
-    1, 0, 0, 0, 17, 5, 0, 0, 0, 33, 
-    0, 0, 21, 0, 2, 0, 0, 0, 5, 17, 
-    12, 0, 0, 0, 52, 32, 0, 0, 27, 1, 
-    0, 6, 45, 3, 1, 54, 17, 0, 0, 0, 
-    0, 32, 0, 3, 30, 1, 0, 6, 2, 0, 
-    1, 7, 79, 3, 2, 22, 2, 122, 0, 0, 
-    0, 17, 0, 0, 0, 0, 32, 0, 0, 27, 
-    1, 0, 7, 45, 4, 1, 32, 0, 1, 30, 
-    1, 0, 6, 2, 0, 1, 6, 79, 3, 2, 
-    19, 2, 13, 0, 0, 0, 42, 1, 0, 0, 
-    0, 17, 5, 0, 0, 0, 33, 0, 0, 21, 
-    0, 2, 0, 0, 0, 5, 17, 6, 0, 0, 
-    0, 52, 32, 0, 0, 27, 1, 0, 8, 45, 
-    1, 1, 54, 17, 0, 0, 0, 0, 17, 0, 
-    0, 0, 0, 42, 1, 0, 0, 0, 17, 7, 
-    0, 0, 0, 33, 0, 0, 21, 0, 4, 0, 
-    0, 0, 30, 1, 0, 45, 5, 1, 5, 17, 
-    6, 0, 0, 0, 52, 32, 0, 0, 27, 1, 
-    0, 9, 45, 5, 1, 54, 17, 0, 0, 0, 
-    0, 32, 0, 2, 30, 1, 0, 6, 2, 0, 
-    1, 6, 79, 3, 2, 19, 2, 24, 0, 0, 
-    0, 32, 0, 5, 30, 1, 0, 6, 2, 0, 
-    1, 6, 79, 3, 2, 22, 2, 3, 0, 0, 
-    0, 32, 0, 5, 45, 2, 0, 17, 15, 0, 
-    0, 0, 42, 1, 0, 0, 0, 17, 7, 0, 
-    0, 0, 33, 0, 0, 21, 0, 4, 0, 0, 
-    0, 30, 1, 0, 45, 2, 1, 5, 17, 6, 
-    0, 0, 0, 52, 32, 0, 1, 27, 1, 0, 
-    10, 45, 2, 1, 54, 17, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 
+    0, 0, 0, 0, 104, 97, 115, 95, 108, 111, 
+    99, 97, 116, 105, 111, 110, 1, 0, 0, 0, 
+    0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 
+    0, 0, 95, 115, 101, 116, 95, 102, 105, 108, 
+    101, 97, 116, 116, 114, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+    101, 108, 102, 32, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 9, 
+    0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 46, 95, 115, 112, 101, 
+    99, 95, 102, 114, 111, 109, 95, 109, 111, 100, 
+    117, 108, 101, 46, 52, 52, 48, 58, 48, 0, 
+    130, 0, 0, 0, 0, 0, 0, 0, 17, 5, 
+    0, 0, 0, 33, 0, 0, 21, 0, 2, 0, 
+    0, 0, 5, 17, 11, 0, 0, 0, 52, 32, 
+    0, 0, 27, 1, 0, 6, 45, 3, 1, 17, 
+    0, 0, 0, 0, 32, 0, 3, 30, 1, 0, 
+    6, 2, 0, 1, 7, 79, 3, 2, 22, 2, 
+    112, 0, 0, 0, 17, 0, 0, 0, 0, 32, 
+    0, 0, 27, 1, 0, 7, 45, 4, 1, 32, 
+    0, 1, 30, 1, 0, 6, 2, 0, 1, 6, 
+    79, 3, 2, 19, 2, 11, 0, 0, 0, 17, 
+    5, 0, 0, 0, 33, 0, 0, 21, 0, 2, 
+    0, 0, 0, 5, 17, 5, 0, 0, 0, 52, 
+    32, 0, 0, 27, 1, 0, 8, 45, 1, 1, 
     17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
-    42, 1, 0, 0, 0, 17, 7, 0, 0, 0, 
-    33, 0, 0, 21, 0, 4, 0, 0, 0, 30, 
-    1, 0, 45, 6, 1, 5, 17, 6, 0, 0, 
-    0, 52, 32, 0, 0, 27, 1, 0, 11, 45, 
-    6, 1, 54, 17, 0, 0, 0, 0, 42, 1, 
+    17, 7, 0, 0, 0, 33, 0, 0, 21, 0, 
+    4, 0, 0, 0, 30, 1, 0, 45, 5, 1, 
+    5, 17, 5, 0, 0, 0, 52, 32, 0, 0, 
+    27, 1, 0, 9, 45, 5, 1, 17, 0, 0, 
+    0, 0, 32, 0, 2, 30, 1, 0, 6, 2, 
+    0, 1, 6, 79, 3, 2, 19, 2, 22, 0, 
+    0, 0, 32, 0, 5, 30, 1, 0, 6, 2, 
+    0, 1, 6, 79, 3, 2, 22, 2, 3, 0, 
+    0, 0, 32, 0, 5, 45, 2, 0, 17, 13, 
     0, 0, 0, 17, 7, 0, 0, 0, 33, 0, 
     0, 21, 0, 4, 0, 0, 0, 30, 1, 0, 
-    45, 7, 1, 5, 17, 10, 0, 0, 0, 52, 
-    33, 1, 1, 32, 2, 0, 27, 3, 2, 12, 
-    74, 3, 10, 1, 1, 0, 75, 1, 189, 45, 
-    7, 0, 54, 17, 0, 0, 0, 0, 33, 1, 
-    2, 32, 2, 4, 32, 3, 1, 32, 4, 2, 
-    12, 1, 2, 0, 0, 0, 0, 0, 0, 0, 
-    2, 3, 1, 0, 0, 0, 0, 0, 0, 0, 
-    4, 1, 0, 0, 0, 0, 0, 0, 0, 13, 
-    45, 3, 0, 32, 1, 5, 30, 0, 0, 6, 
-    2, 1, 0, 6, 79, 3, 2, 22, 2, 2, 
-    0, 0, 0, 30, 0, 1, 17, 2, 0, 0, 
-    0, 30, 0, 2, 17, 0, 0, 0, 0, 32, 
-    1, 3, 43, 1, 0, 3, 32, 2, 6, 32, 
-    0, 3, 43, 0, 2, 4, 32, 1, 7, 32, 
-    0, 3, 43, 0, 1, 5, 32, 2, 3, 41, 
-    2, 32, 0, 3, 17, 0, 0, 0, 0, 41, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+    45, 2, 1, 5, 17, 5, 0, 0, 0, 52, 
+    32, 0, 1, 27, 1, 0, 10, 45, 2, 1, 
+    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 17, 7, 0, 0, 0, 
+    33, 0, 0, 21, 0, 4, 0, 0, 0, 30, 
+    1, 0, 45, 6, 1, 5, 17, 5, 0, 0, 
+    0, 52, 32, 0, 0, 27, 1, 0, 11, 45, 
+    6, 1, 17, 0, 0, 0, 0, 17, 7, 0, 
+    0, 0, 33, 0, 0, 21, 0, 4, 0, 0, 
+    0, 30, 1, 0, 45, 7, 1, 5, 17, 9, 
+    0, 0, 0, 52, 33, 1, 1, 32, 2, 0, 
+    27, 3, 2, 12, 74, 3, 10, 1, 1, 0, 
+    75, 1, 189, 45, 7, 0, 17, 0, 0, 0, 
+    0, 33, 1, 2, 32, 2, 4, 32, 3, 1, 
+    32, 4, 2, 12, 1, 2, 0, 0, 0, 0, 
+    0, 0, 0, 2, 3, 1, 0, 0, 0, 0, 
+    0, 0, 0, 4, 1, 0, 0, 0, 0, 0, 
+    0, 0, 13, 45, 3, 0, 32, 1, 5, 30, 
+    0, 0, 6, 2, 1, 0, 6, 79, 3, 2, 
+    22, 2, 2, 0, 0, 0, 30, 0, 1, 17, 
+    2, 0, 0, 0, 30, 0, 2, 17, 0, 0, 
+    0, 0, 32, 1, 3, 43, 1, 0, 3, 32, 
+    2, 6, 32, 0, 3, 43, 0, 2, 4, 32, 
+    1, 7, 32, 0, 3, 43, 0, 1, 5, 32, 
+    2, 3, 41, 2, 32, 0, 3, 17, 0, 0, 
+    0, 0, 41, 0, 12, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    24, 0, 0, 0, 0, 0, 0, 0, 25, 0, 
+    0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 
+    0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 
+    25, 0, 0, 0, 0, 0, 0, 0, 35, 0, 
+    0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 
+    0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 
+    0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 
+    46, 0, 0, 0, 0, 0, 0, 0, 36, 0, 
+    0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 
+    0, 0, 0, 0, 61, 0, 0, 0, 0, 0, 
+    0, 0, 61, 0, 0, 0, 0, 0, 0, 0, 
+    68, 0, 0, 0, 0, 0, 0, 0, 71, 0, 
+    0, 0, 0, 0, 0, 0, 61, 0, 0, 0, 
+    0, 0, 0, 0, 74, 0, 0, 0, 0, 0, 
+    0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 
+    75, 0, 0, 0, 0, 0, 0, 0, 82, 0, 
+    0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 
+    0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 
+    0, 0, 86, 0, 0, 0, 0, 0, 0, 0, 
+    87, 0, 0, 0, 0, 0, 0, 0, 87, 0, 
+    0, 0, 0, 0, 0, 0, 94, 0, 0, 0, 
+    0, 0, 0, 0, 101, 0, 0, 0, 0, 0, 
+    0, 0, 87, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 5, 6, 1, 6, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 5, 6, 1, 6, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 
-    0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 
-    0, 0, 0, 0, 0, 95, 115, 112, 101, 99, 
-    95, 102, 114, 111, 109, 95, 109, 111, 100, 117, 
-    108, 101, 14, 0, 0, 0, 0, 0, 0, 0, 
-    14, 0, 0, 0, 0, 0, 0, 0, 65, 116, 
-    116, 114, 105, 98, 117, 116, 101, 69, 114, 114, 
-    111, 114, 4, 0, 0, 0, 0, 0, 0, 0, 
-    108, 105, 115, 116, 10, 0, 0, 0, 0, 0, 
-    0, 0, 77, 111, 100, 117, 108, 101, 83, 112, 
-    101, 99, 13, 0, 0, 0, 0, 0, 0, 0, 
-    95, 115, 101, 116, 95, 102, 105, 108, 101, 97, 
-    116, 116, 114, 6, 0, 0, 0, 0, 0, 0, 
-    0, 99, 97, 99, 104, 101, 100, 26, 0, 0, 
-    0, 0, 0, 0, 0, 115, 117, 98, 109, 111, 
-    100, 117, 108, 101, 95, 115, 101, 97, 114, 99, 
-    104, 95, 108, 111, 99, 97, 116, 105, 111, 110, 
-    115, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 115, 112, 101, 99, 95, 95, 8, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 110, 97, 109, 
-    101, 95, 95, 10, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 108, 111, 97, 100, 101, 114, 95, 
-    95, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 102, 105, 108, 101, 95, 95, 7, 0, 0, 
-    0, 0, 0, 0, 0, 95, 79, 82, 73, 71, 
-    73, 78, 10, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 99, 97, 99, 104, 101, 100, 95, 95, 
+    0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
+    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 0, 0, 0, 95, 115, 112, 101, 99, 95, 
+    102, 114, 111, 109, 95, 109, 111, 100, 117, 108, 
+    101, 14, 0, 0, 0, 0, 0, 0, 0, 14, 
+    0, 0, 0, 0, 0, 0, 0, 65, 116, 116, 
+    114, 105, 98, 117, 116, 101, 69, 114, 114, 111, 
+    114, 4, 0, 0, 0, 0, 0, 0, 0, 108, 
+    105, 115, 116, 10, 0, 0, 0, 0, 0, 0, 
+    0, 77, 111, 100, 117, 108, 101, 83, 112, 101, 
+    99, 13, 0, 0, 0, 0, 0, 0, 0, 95, 
+    115, 101, 116, 95, 102, 105, 108, 101, 97, 116, 
+    116, 114, 6, 0, 0, 0, 0, 0, 0, 0, 
+    99, 97, 99, 104, 101, 100, 26, 0, 0, 0, 
+    0, 0, 0, 0, 115, 117, 98, 109, 111, 100, 
+    117, 108, 101, 95, 115, 101, 97, 114, 99, 104, 
+    95, 108, 111, 99, 97, 116, 105, 111, 110, 115, 
     8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    112, 97, 116, 104, 95, 95, 6, 0, 0, 0, 
-    0, 0, 0, 0, 111, 114, 105, 103, 105, 110, 
-    0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 109, 111, 100, 117, 108, 101, 
-    6, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
-    97, 100, 101, 114, 6, 0, 0, 0, 0, 0, 
-    0, 0, 111, 114, 105, 103, 105, 110, 4, 0, 
-    0, 0, 0, 0, 0, 0, 115, 112, 101, 99, 
-    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
-    109, 101, 8, 0, 0, 0, 0, 0, 0, 0, 
-    108, 111, 99, 97, 116, 105, 111, 110, 6, 0, 
-    0, 0, 0, 0, 0, 0, 99, 97, 99, 104, 
-    101, 100, 26, 0, 0, 0, 0, 0, 0, 0, 
-    115, 117, 98, 109, 111, 100, 117, 108, 101, 95, 
-    115, 101, 97, 114, 99, 104, 95, 108, 111, 99, 
-    97, 116, 105, 111, 110, 115, 32, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
-    46, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 66, 
-    117, 105, 108, 116, 105, 110, 73, 109, 112, 111, 
-    114, 116, 101, 114, 46, 99, 114, 101, 97, 116, 
-    101, 95, 109, 111, 100, 117, 108, 101, 46, 55, 
-    53, 54, 58, 52, 0, 33, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 32, 1, 1, 27, 
-    0, 1, 5, 33, 2, 0, 27, 1, 2, 6, 
-    6, 3, 0, 1, 9, 79, 2, 3, 19, 3, 
-    15, 0, 0, 0, 33, 1, 1, 30, 0, 1, 
-    34, 2, 0, 4, 32, 3, 1, 27, 4, 3, 
-    5, 74, 4, 10, 2, 1, 0, 75, 1, 0, 
+    115, 112, 101, 99, 95, 95, 8, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 110, 97, 109, 101, 
+    95, 95, 10, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 108, 111, 97, 100, 101, 114, 95, 95, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    102, 105, 108, 101, 95, 95, 7, 0, 0, 0, 
+    0, 0, 0, 0, 95, 79, 82, 73, 71, 73, 
+    78, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 99, 97, 99, 104, 101, 100, 95, 95, 8, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 112, 
+    97, 116, 104, 95, 95, 6, 0, 0, 0, 0, 
+    0, 0, 0, 111, 114, 105, 103, 105, 110, 0, 
+    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
+    0, 0, 0, 109, 111, 100, 117, 108, 101, 6, 
+    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
+    100, 101, 114, 6, 0, 0, 0, 0, 0, 0, 
+    0, 111, 114, 105, 103, 105, 110, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 112, 101, 99, 4, 
+    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
+    101, 8, 0, 0, 0, 0, 0, 0, 0, 108, 
+    111, 99, 97, 116, 105, 111, 110, 6, 0, 0, 
+    0, 0, 0, 0, 0, 99, 97, 99, 104, 101, 
+    100, 26, 0, 0, 0, 0, 0, 0, 0, 115, 
+    117, 98, 109, 111, 100, 117, 108, 101, 95, 115, 
+    101, 97, 114, 99, 104, 95, 108, 111, 99, 97, 
+    116, 105, 111, 110, 115, 33, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 46, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 66, 117, 
+    105, 108, 116, 105, 110, 73, 109, 112, 111, 114, 
+    116, 101, 114, 46, 99, 114, 101, 97, 116, 101, 
+    95, 109, 111, 100, 117, 108, 101, 46, 55, 53, 
+    54, 58, 52, 0, 31, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 32, 1, 1, 27, 0, 
+    1, 5, 33, 2, 0, 27, 1, 2, 6, 6, 
+    3, 0, 1, 9, 79, 2, 3, 19, 3, 13, 
+    0, 0, 0, 33, 1, 1, 30, 0, 1, 34, 
+    2, 0, 4, 1, 32, 32, 3, 1, 27, 4, 
+    3, 5, 38, 2, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     32, 3, 1, 27, 2, 3, 5, 74, 0, 12, 
     1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
     1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 
@@ -4840,635 +5224,717 @@ std::vector<uint8_t> _bootstrap
     33, 0, 3, 27, 2, 0, 7, 32, 3, 1, 
     74, 2, 74, 3, 10, 1, 2, 0, 75, 1, 
     188, 75, 1, 0, 41, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 2, 24, 0, 0, 
+    0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 
+    101, 32, 97, 32, 98, 117, 105, 108, 116, 45, 
+    105, 110, 32, 109, 111, 100, 117, 108, 101, 2, 
+    29, 0, 0, 0, 0, 0, 0, 0, 123, 33, 
+    114, 125, 32, 105, 115, 32, 110, 111, 116, 32, 
+    97, 32, 98, 117, 105, 108, 116, 45, 105, 110, 
+    32, 109, 111, 100, 117, 108, 101, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
+    0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 
+    0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 
+    95, 109, 111, 100, 117, 108, 101, 8, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 115, 121, 115, 11, 0, 0, 0, 
+    0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 
+    69, 114, 114, 111, 114, 25, 0, 0, 0, 0, 
+    0, 0, 0, 95, 99, 97, 108, 108, 95, 119, 
+    105, 116, 104, 95, 102, 114, 97, 109, 101, 115, 
+    95, 114, 101, 109, 111, 118, 101, 100, 4, 0, 
+    0, 0, 0, 0, 0, 0, 95, 105, 109, 112, 
+    6, 0, 0, 0, 0, 0, 0, 0, 102, 111, 
+    114, 109, 97, 116, 4, 0, 0, 0, 0, 0, 
+    0, 0, 110, 97, 109, 101, 20, 0, 0, 0, 
+    0, 0, 0, 0, 98, 117, 105, 108, 116, 105, 
+    110, 95, 109, 111, 100, 117, 108, 101, 95, 110, 
+    97, 109, 101, 115, 14, 0, 0, 0, 0, 0, 
+    0, 0, 99, 114, 101, 97, 116, 101, 95, 98, 
+    117, 105, 108, 116, 105, 110, 0, 0, 0, 0, 
     0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 4, 0, 0, 0, 0, 0, 
+    0, 0, 115, 112, 101, 99, 33, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    43, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 46, 70, 
+    114, 111, 122, 101, 110, 73, 109, 112, 111, 114, 
+    116, 101, 114, 46, 102, 105, 110, 100, 95, 109, 
+    111, 100, 117, 108, 101, 46, 56, 49, 55, 58, 
+    52, 0, 12, 0, 0, 0, 0, 0, 0, 0, 
+    30, 0, 0, 33, 1, 0, 34, 2, 1, 1, 
+    1, 32, 32, 3, 1, 38, 2, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 24, 
-    0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 
-    97, 116, 101, 32, 97, 32, 98, 117, 105, 108, 
-    116, 45, 105, 110, 32, 109, 111, 100, 117, 108, 
-    101, 2, 29, 0, 0, 0, 0, 0, 0, 0, 
-    123, 33, 114, 125, 32, 105, 115, 32, 110, 111, 
-    116, 32, 97, 32, 98, 117, 105, 108, 116, 45, 
-    105, 110, 32, 109, 111, 100, 117, 108, 101, 0, 
+    0, 0, 0, 79, 1, 0, 22, 0, 2, 0, 
+    0, 0, 30, 1, 1, 17, 2, 0, 0, 0, 
+    32, 1, 0, 17, 0, 0, 0, 0, 41, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 93, 0, 0, 0, 0, 0, 0, 0, 70, 
+    105, 110, 100, 32, 97, 32, 102, 114, 111, 122, 
+    101, 110, 32, 109, 111, 100, 117, 108, 101, 46, 
+    10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+    84, 104, 105, 115, 32, 109, 101, 116, 104, 111, 
+    100, 32, 105, 115, 32, 100, 101, 112, 114, 101, 
+    99, 97, 116, 101, 100, 46, 32, 32, 85, 115, 
+    101, 32, 102, 105, 110, 100, 95, 115, 112, 101, 
+    99, 40, 41, 32, 105, 110, 115, 116, 101, 97, 
+    100, 46, 10, 10, 32, 32, 32, 32, 32, 32, 
+    32, 32, 5, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 13, 0, 
-    0, 0, 0, 0, 0, 0, 99, 114, 101, 97, 
-    116, 101, 95, 109, 111, 100, 117, 108, 101, 8, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 115, 121, 115, 11, 0, 
-    0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 
-    114, 116, 69, 114, 114, 111, 114, 25, 0, 0, 
-    0, 0, 0, 0, 0, 95, 99, 97, 108, 108, 
-    95, 119, 105, 116, 104, 95, 102, 114, 97, 109, 
-    101, 115, 95, 114, 101, 109, 111, 118, 101, 100, 
-    4, 0, 0, 0, 0, 0, 0, 0, 95, 105, 
-    109, 112, 6, 0, 0, 0, 0, 0, 0, 0, 
-    102, 111, 114, 109, 97, 116, 4, 0, 0, 0, 
-    0, 0, 0, 0, 110, 97, 109, 101, 20, 0, 
-    0, 0, 0, 0, 0, 0, 98, 117, 105, 108, 
-    116, 105, 110, 95, 109, 111, 100, 117, 108, 101, 
-    95, 110, 97, 109, 101, 115, 14, 0, 0, 0, 
-    0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 
-    95, 98, 117, 105, 108, 116, 105, 110, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
     0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 108, 102, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 112, 101, 99, 32, 0, 
+    0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
+    102, 105, 110, 100, 95, 109, 111, 100, 117, 108, 
+    101, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 95, 105, 109, 
+    112, 9, 0, 0, 0, 0, 0, 0, 0, 105, 
+    115, 95, 102, 114, 111, 122, 101, 110, 0, 0, 
     0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 70, 114, 111, 122, 101, 110, 73, 109, 112, 
-    111, 114, 116, 101, 114, 46, 102, 105, 110, 100, 
-    95, 109, 111, 100, 117, 108, 101, 46, 56, 49, 
-    55, 58, 52, 0, 14, 0, 0, 0, 0, 0, 
-    0, 0, 30, 0, 0, 33, 1, 0, 34, 2, 
-    1, 1, 32, 3, 1, 74, 3, 10, 2, 1, 
-    0, 75, 1, 0, 79, 1, 0, 22, 0, 2, 
-    0, 0, 0, 30, 1, 1, 17, 2, 0, 0, 
-    0, 32, 1, 0, 17, 0, 0, 0, 0, 41, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 99, 108, 115, 8, 0, 0, 0, 0, 
+    0, 0, 0, 102, 117, 108, 108, 110, 97, 109, 
+    101, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 33, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 11, 
+    0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 46, 109, 111, 100, 117, 
+    108, 101, 95, 102, 114, 111, 109, 95, 115, 112, 
+    101, 99, 46, 53, 53, 55, 58, 48, 0, 62, 
+    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
+    30, 1, 1, 45, 1, 1, 33, 2, 0, 32, 
+    0, 0, 27, 1, 0, 5, 30, 3, 2, 74, 
+    1, 74, 3, 10, 2, 2, 0, 75, 1, 0, 
+    75, 1, 0, 79, 4, 0, 22, 0, 18, 0, 
+    0, 0, 33, 1, 0, 32, 0, 0, 27, 2, 
+    0, 5, 30, 3, 3, 74, 2, 74, 3, 10, 
+    1, 2, 0, 75, 1, 0, 75, 1, 0, 79, 
+    4, 0, 22, 0, 1, 0, 0, 0, 17, 13, 
+    0, 0, 0, 33, 1, 1, 30, 2, 4, 74, 
+    2, 10, 1, 1, 0, 75, 1, 0, 40, 1, 
+    0, 32, 1, 0, 27, 0, 1, 5, 34, 2, 
+    0, 4, 1, 32, 32, 1, 0, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 45, 1, 0, 17, 0, 
+    0, 0, 0, 32, 0, 1, 30, 1, 1, 6, 
+    2, 0, 1, 6, 79, 3, 2, 19, 2, 8, 
+    0, 0, 0, 33, 1, 2, 32, 2, 0, 27, 
+    3, 2, 6, 74, 3, 10, 1, 1, 0, 75, 
+    1, 0, 45, 1, 0, 17, 0, 0, 0, 0, 
+    33, 1, 3, 32, 2, 0, 32, 3, 1, 74, 
+    2, 74, 3, 10, 1, 2, 0, 75, 1, 0, 
+    75, 1, 0, 32, 4, 1, 41, 4, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 2, 93, 0, 0, 0, 0, 0, 
-    0, 0, 70, 105, 110, 100, 32, 97, 32, 102, 
-    114, 111, 122, 101, 110, 32, 109, 111, 100, 117, 
-    108, 101, 46, 10, 10, 32, 32, 32, 32, 32, 
-    32, 32, 32, 84, 104, 105, 115, 32, 109, 101, 
-    116, 104, 111, 100, 32, 105, 115, 32, 100, 101, 
-    112, 114, 101, 99, 97, 116, 101, 100, 46, 32, 
-    32, 85, 115, 101, 32, 102, 105, 110, 100, 95, 
-    115, 112, 101, 99, 40, 41, 32, 105, 110, 115, 
-    116, 101, 97, 100, 46, 10, 10, 32, 32, 32, 
-    32, 32, 32, 32, 32, 5, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 2, 43, 
+    0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 
+    97, 116, 101, 32, 97, 32, 109, 111, 100, 117, 
+    108, 101, 32, 98, 97, 115, 101, 100, 32, 111, 
+    110, 32, 116, 104, 101, 32, 112, 114, 111, 118, 
+    105, 100, 101, 100, 32, 115, 112, 101, 99, 46, 
+    5, 2, 13, 0, 0, 0, 0, 0, 0, 0, 
+    99, 114, 101, 97, 116, 101, 95, 109, 111, 100, 
+    117, 108, 101, 2, 11, 0, 0, 0, 0, 0, 
+    0, 0, 101, 120, 101, 99, 95, 109, 111, 100, 
+    117, 108, 101, 2, 66, 0, 0, 0, 0, 0, 
+    0, 0, 108, 111, 97, 100, 101, 114, 115, 32, 
+    116, 104, 97, 116, 32, 100, 101, 102, 105, 110, 
+    101, 32, 101, 120, 101, 99, 95, 109, 111, 100, 
+    117, 108, 101, 40, 41, 32, 109, 117, 115, 116, 
+    32, 97, 108, 115, 111, 32, 100, 101, 102, 105, 
+    110, 101, 32, 99, 114, 101, 97, 116, 101, 95, 
+    109, 111, 100, 117, 108, 101, 40, 41, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 
-    0, 0, 0, 102, 105, 110, 100, 95, 109, 111, 
-    100, 117, 108, 101, 2, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    95, 105, 109, 112, 9, 0, 0, 0, 0, 0, 
-    0, 0, 105, 115, 95, 102, 114, 111, 122, 101, 
-    110, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 99, 108, 115, 8, 0, 
-    0, 0, 0, 0, 0, 0, 102, 117, 108, 108, 
-    110, 97, 109, 101, 4, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 116, 104, 32, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
-    33, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 109, 
-    111, 100, 117, 108, 101, 95, 102, 114, 111, 109, 
-    95, 115, 112, 101, 99, 46, 53, 53, 55, 58, 
-    48, 0, 64, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 30, 1, 1, 45, 1, 1, 33, 
-    2, 0, 32, 0, 0, 27, 1, 0, 5, 30, 
-    3, 2, 74, 1, 74, 3, 10, 2, 2, 0, 
-    75, 1, 0, 75, 1, 0, 79, 4, 0, 22, 
-    0, 18, 0, 0, 0, 33, 1, 0, 32, 0, 
-    0, 27, 2, 0, 5, 30, 3, 3, 74, 2, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 
+    0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 
+    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
+    101, 95, 102, 114, 111, 109, 95, 115, 112, 101, 
+    99, 7, 0, 0, 0, 0, 0, 0, 0, 7, 
+    0, 0, 0, 0, 0, 0, 0, 104, 97, 115, 
+    97, 116, 116, 114, 11, 0, 0, 0, 0, 0, 
+    0, 0, 73, 109, 112, 111, 114, 116, 69, 114, 
+    114, 111, 114, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 110, 101, 119, 95, 109, 111, 100, 117, 
+    108, 101, 18, 0, 0, 0, 0, 0, 0, 0, 
+    95, 105, 110, 105, 116, 95, 109, 111, 100, 117, 
+    108, 101, 95, 97, 116, 116, 114, 115, 13, 0, 
+    0, 0, 0, 0, 0, 0, 99, 114, 101, 97, 
+    116, 101, 95, 109, 111, 100, 117, 108, 101, 6, 
+    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
+    100, 101, 114, 4, 0, 0, 0, 0, 0, 0, 
+    0, 110, 97, 109, 101, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+    112, 101, 99, 6, 0, 0, 0, 0, 0, 0, 
+    0, 109, 111, 100, 117, 108, 101, 32, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 44, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
+    66, 117, 105, 108, 116, 105, 110, 73, 109, 112, 
+    111, 114, 116, 101, 114, 46, 101, 120, 101, 99, 
+    95, 109, 111, 100, 117, 108, 101, 46, 55, 54, 
+    52, 58, 52, 0, 12, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 33, 1, 0, 33, 0, 
+    1, 27, 2, 0, 2, 32, 3, 1, 74, 2, 
     74, 3, 10, 1, 2, 0, 75, 1, 0, 75, 
-    1, 0, 79, 4, 0, 22, 0, 1, 0, 0, 
-    0, 17, 15, 0, 0, 0, 33, 1, 1, 30, 
-    2, 4, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 40, 1, 0, 32, 1, 0, 27, 0, 1, 
-    5, 34, 2, 0, 4, 32, 1, 0, 74, 1, 
-    10, 2, 1, 0, 75, 1, 0, 45, 1, 0, 
-    17, 0, 0, 0, 0, 32, 0, 1, 30, 1, 
-    1, 6, 2, 0, 1, 6, 79, 3, 2, 19, 
-    2, 8, 0, 0, 0, 33, 1, 2, 32, 2, 
-    0, 27, 3, 2, 6, 74, 3, 10, 1, 1, 
-    0, 75, 1, 0, 45, 1, 0, 17, 0, 0, 
-    0, 0, 33, 1, 3, 32, 2, 0, 32, 3, 
-    1, 74, 2, 74, 3, 10, 1, 2, 0, 75, 
-    1, 0, 75, 1, 0, 32, 4, 1, 41, 4, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    1, 171, 30, 4, 1, 41, 4, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
-    0, 0, 2, 43, 0, 0, 0, 0, 0, 0, 
-    0, 67, 114, 101, 97, 116, 101, 32, 97, 32, 
-    109, 111, 100, 117, 108, 101, 32, 98, 97, 115, 
-    101, 100, 32, 111, 110, 32, 116, 104, 101, 32, 
-    112, 114, 111, 118, 105, 100, 101, 100, 32, 115, 
-    112, 101, 99, 46, 5, 2, 13, 0, 0, 0, 
-    0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 
-    95, 109, 111, 100, 117, 108, 101, 2, 11, 0, 
-    0, 0, 0, 0, 0, 0, 101, 120, 101, 99, 
-    95, 109, 111, 100, 117, 108, 101, 2, 66, 0, 
-    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
-    101, 114, 115, 32, 116, 104, 97, 116, 32, 100, 
-    101, 102, 105, 110, 101, 32, 101, 120, 101, 99, 
-    95, 109, 111, 100, 117, 108, 101, 40, 41, 32, 
-    109, 117, 115, 116, 32, 97, 108, 115, 111, 32, 
-    100, 101, 102, 105, 110, 101, 32, 99, 114, 101, 
-    97, 116, 101, 95, 109, 111, 100, 117, 108, 101, 
-    40, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 22, 0, 
+    0, 0, 0, 0, 0, 0, 69, 120, 101, 99, 
+    32, 97, 32, 98, 117, 105, 108, 116, 45, 105, 
+    110, 32, 109, 111, 100, 117, 108, 101, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 
-    0, 16, 0, 0, 0, 0, 0, 0, 0, 109, 
-    111, 100, 117, 108, 101, 95, 102, 114, 111, 109, 
-    95, 115, 112, 101, 99, 7, 0, 0, 0, 0, 
-    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
-    0, 104, 97, 115, 97, 116, 116, 114, 11, 0, 
-    0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 
-    114, 116, 69, 114, 114, 111, 114, 11, 0, 0, 
-    0, 0, 0, 0, 0, 95, 110, 101, 119, 95, 
-    109, 111, 100, 117, 108, 101, 18, 0, 0, 0, 
-    0, 0, 0, 0, 95, 105, 110, 105, 116, 95, 
-    109, 111, 100, 117, 108, 101, 95, 97, 116, 116, 
-    114, 115, 13, 0, 0, 0, 0, 0, 0, 0, 
-    99, 114, 101, 97, 116, 101, 95, 109, 111, 100, 
-    117, 108, 101, 6, 0, 0, 0, 0, 0, 0, 
-    0, 108, 111, 97, 100, 101, 114, 4, 0, 0, 
-    0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 115, 112, 101, 99, 6, 0, 0, 
-    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
-    101, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 66, 117, 105, 108, 116, 105, 
-    110, 73, 109, 112, 111, 114, 116, 101, 114, 46, 
-    101, 120, 101, 99, 95, 109, 111, 100, 117, 108, 
-    101, 46, 55, 54, 52, 58, 52, 0, 12, 0, 
-    0, 0, 0, 0, 0, 0, 30, 0, 0, 33, 
-    1, 0, 33, 0, 1, 27, 2, 0, 2, 32, 
-    3, 1, 74, 2, 74, 3, 10, 1, 2, 0, 
-    75, 1, 0, 75, 1, 171, 30, 4, 1, 41, 
-    4, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 2, 22, 0, 0, 0, 0, 0, 
-    0, 0, 69, 120, 101, 99, 32, 97, 32, 98, 
-    117, 105, 108, 116, 45, 105, 110, 32, 109, 111, 
-    100, 117, 108, 101, 5, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
+    0, 0, 0, 0, 0, 0, 101, 120, 101, 99, 
+    95, 109, 111, 100, 117, 108, 101, 3, 0, 0, 
+    0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 
+    0, 0, 0, 95, 99, 97, 108, 108, 95, 119, 
+    105, 116, 104, 95, 102, 114, 97, 109, 101, 115, 
+    95, 114, 101, 109, 111, 118, 101, 100, 4, 0, 
+    0, 0, 0, 0, 0, 0, 95, 105, 109, 112, 
+    12, 0, 0, 0, 0, 0, 0, 0, 101, 120, 
+    101, 99, 95, 98, 117, 105, 108, 116, 105, 110, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 115, 101, 108, 102, 6, 0, 
+    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
+    108, 101, 33, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
+    0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 46, 95, 77, 111, 100, 117, 
+    108, 101, 76, 111, 99, 107, 46, 114, 101, 108, 
+    101, 97, 115, 101, 46, 49, 49, 49, 58, 52, 
+    0, 74, 0, 0, 0, 0, 0, 0, 0, 33, 
+    1, 0, 34, 2, 1, 2, 1, 32, 38, 2, 
+    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 45, 1, 0, 32, 2, 
+    0, 27, 1, 2, 9, 34, 3, 1, 3, 1, 
+    32, 38, 3, 32, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 
+    0, 0, 0, 32, 0, 0, 27, 2, 0, 6, 
+    32, 3, 1, 6, 0, 2, 3, 1, 79, 4, 
+    0, 22, 0, 44, 0, 0, 0, 32, 2, 0, 
+    27, 0, 2, 5, 30, 3, 0, 6, 2, 0, 
+    3, 4, 79, 4, 2, 22, 2, 3, 0, 0, 
+    0, 26, 3, 10, 3, 0, 0, 40, 1, 0, 
+    32, 2, 0, 27, 0, 2, 5, 30, 3, 1, 
+    63, 0, 3, 1, 43, 2, 0, 5, 32, 3, 
+    0, 27, 0, 3, 5, 30, 2, 0, 6, 3, 
+    0, 2, 0, 79, 4, 3, 19, 3, 18, 0, 
+    0, 0, 30, 0, 2, 32, 2, 0, 43, 2, 
+    0, 6, 32, 3, 0, 27, 0, 3, 7, 79, 
+    2, 0, 19, 0, 10, 0, 0, 0, 32, 2, 
+    0, 27, 0, 2, 7, 30, 3, 1, 63, 0, 
+    3, 1, 43, 2, 0, 7, 32, 3, 0, 27, 
+    2, 3, 10, 34, 4, 2, 8, 1, 32, 38, 
+    4, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 34, 2, 1, 4, 1, 32, 30, 3, 2, 
+    38, 2, 32, 3, 0, 0, 0, 0, 0, 0, 
+    0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    5, 17, 13, 0, 0, 0, 33, 2, 1, 30, 
+    3, 3, 74, 3, 10, 2, 1, 0, 75, 1, 
+    0, 40, 1, 0, 34, 2, 1, 4, 0, 0, 
+    53, 0, 2, 79, 1, 0, 22, 0, 1, 0, 
+    0, 0, 52, 5, 17, 0, 0, 0, 0, 30, 
+    0, 2, 41, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    53, 0, 0, 0, 0, 0, 0, 0, 65, 0, 
+    0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 
+    0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 
+    0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 
-    0, 0, 101, 120, 101, 99, 95, 109, 111, 100, 
-    117, 108, 101, 3, 0, 0, 0, 0, 0, 0, 
-    0, 25, 0, 0, 0, 0, 0, 0, 0, 95, 
-    99, 97, 108, 108, 95, 119, 105, 116, 104, 95, 
-    102, 114, 97, 109, 101, 115, 95, 114, 101, 109, 
-    111, 118, 101, 100, 4, 0, 0, 0, 0, 0, 
-    0, 0, 95, 105, 109, 112, 12, 0, 0, 0, 
-    0, 0, 0, 0, 101, 120, 101, 99, 95, 98, 
-    117, 105, 108, 116, 105, 110, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 6, 0, 0, 0, 0, 0, 
-    0, 0, 109, 111, 100, 117, 108, 101, 32, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
-    0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 77, 111, 100, 117, 108, 101, 76, 111, 
-    99, 107, 46, 114, 101, 108, 101, 97, 115, 101, 
-    46, 49, 49, 49, 58, 52, 0, 82, 0, 0, 
-    0, 0, 0, 0, 0, 33, 1, 0, 34, 2, 
-    1, 2, 10, 2, 0, 0, 45, 1, 0, 32, 
-    2, 0, 27, 1, 2, 9, 34, 3, 1, 3, 
-    10, 3, 0, 0, 56, 64, 0, 0, 0, 17, 
-    0, 0, 0, 0, 32, 0, 0, 27, 2, 0, 
-    6, 32, 3, 1, 6, 0, 2, 3, 1, 79, 
-    4, 0, 22, 0, 51, 0, 0, 0, 32, 2, 
-    0, 27, 0, 2, 5, 30, 3, 0, 6, 2, 
-    0, 3, 4, 79, 4, 2, 22, 2, 3, 0, 
-    0, 0, 26, 3, 10, 3, 0, 0, 40, 1, 
-    0, 32, 2, 0, 27, 0, 2, 5, 30, 3, 
-    1, 63, 0, 3, 1, 43, 2, 0, 5, 32, 
-    3, 0, 27, 0, 3, 5, 30, 2, 0, 6, 
-    3, 0, 2, 0, 79, 4, 3, 19, 3, 18, 
-    0, 0, 0, 30, 0, 2, 32, 2, 0, 43, 
-    2, 0, 6, 32, 3, 0, 27, 0, 3, 7, 
-    79, 2, 0, 19, 0, 10, 0, 0, 0, 32, 
-    2, 0, 27, 0, 2, 7, 30, 3, 1, 63, 
-    0, 3, 1, 43, 2, 0, 7, 32, 3, 0, 
-    27, 2, 3, 10, 34, 4, 2, 8, 10, 4, 
-    0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 
-    0, 0, 54, 17, 0, 0, 0, 0, 34, 2, 
-    1, 4, 30, 3, 2, 74, 3, 74, 3, 74, 
-    3, 10, 2, 3, 0, 75, 1, 0, 75, 1, 
-    0, 75, 1, 0, 5, 17, 13, 0, 0, 0, 
-    33, 2, 1, 30, 3, 3, 74, 3, 10, 2, 
-    1, 0, 75, 1, 0, 40, 1, 0, 34, 2, 
-    1, 4, 53, 0, 2, 79, 1, 0, 22, 0, 
-    1, 0, 0, 0, 52, 5, 17, 0, 0, 0, 
-    0, 30, 0, 2, 41, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    5, 2, 31, 0, 0, 0, 0, 0, 0, 0, 
+    99, 97, 110, 110, 111, 116, 32, 114, 101, 108, 
+    101, 97, 115, 101, 32, 117, 110, 45, 97, 99, 
+    113, 117, 105, 114, 101, 100, 32, 108, 111, 99, 
+    107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 5, 2, 31, 0, 
-    0, 0, 0, 0, 0, 0, 99, 97, 110, 110, 
-    111, 116, 32, 114, 101, 108, 101, 97, 115, 101, 
-    32, 117, 110, 45, 97, 99, 113, 117, 105, 114, 
-    101, 100, 32, 108, 111, 99, 107, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
+    7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 
+    108, 101, 97, 115, 101, 11, 0, 0, 0, 0, 
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
+    0, 95, 116, 104, 114, 101, 97, 100, 12, 0, 
+    0, 0, 0, 0, 0, 0, 82, 117, 110, 116, 
+    105, 109, 101, 69, 114, 114, 111, 114, 9, 0, 
+    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
+    105, 100, 101, 110, 116, 9, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 101, 110, 116, 101, 114, 
+    95, 95, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 101, 120, 105, 116, 95, 95, 5, 0, 
+    0, 0, 0, 0, 0, 0, 99, 111, 117, 110, 
+    116, 5, 0, 0, 0, 0, 0, 0, 0, 111, 
+    119, 110, 101, 114, 7, 0, 0, 0, 0, 0, 
+    0, 0, 119, 97, 105, 116, 101, 114, 115, 7, 
+    0, 0, 0, 0, 0, 0, 0, 114, 101, 108, 
+    101, 97, 115, 101, 4, 0, 0, 0, 0, 0, 
+    0, 0, 108, 111, 99, 107, 6, 0, 0, 0, 
+    0, 0, 0, 0, 119, 97, 107, 101, 117, 112, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 115, 101, 108, 102, 3, 0, 
+    0, 0, 0, 0, 0, 0, 116, 105, 100, 33, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    0, 0, 0, 42, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 95, 108, 111, 97, 100, 95, 98, 97, 
+    99, 107, 119, 97, 114, 100, 95, 99, 111, 109, 
+    112, 97, 116, 105, 98, 108, 101, 46, 54, 50, 
+    49, 58, 48, 0, 146, 0, 0, 0, 0, 0, 
+    0, 0, 17, 22, 0, 0, 0, 32, 0, 0, 
+    27, 1, 0, 10, 33, 2, 0, 27, 0, 2, 
+    11, 6, 3, 1, 0, 8, 79, 2, 3, 19, 
+    3, 14, 0, 0, 0, 33, 0, 0, 27, 1, 
+    0, 11, 34, 2, 1, 5, 1, 32, 32, 3, 
+    0, 27, 1, 3, 10, 38, 2, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
-    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
-    0, 0, 0, 0, 114, 101, 108, 101, 97, 115, 
-    101, 11, 0, 0, 0, 0, 0, 0, 0, 7, 
-    0, 0, 0, 0, 0, 0, 0, 95, 116, 104, 
-    114, 101, 97, 100, 12, 0, 0, 0, 0, 0, 
-    0, 0, 82, 117, 110, 116, 105, 109, 101, 69, 
-    114, 114, 111, 114, 9, 0, 0, 0, 0, 0, 
-    0, 0, 103, 101, 116, 95, 105, 100, 101, 110, 
-    116, 9, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 101, 110, 116, 101, 114, 95, 95, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 101, 120, 
-    105, 116, 95, 95, 5, 0, 0, 0, 0, 0, 
-    0, 0, 99, 111, 117, 110, 116, 5, 0, 0, 
-    0, 0, 0, 0, 0, 111, 119, 110, 101, 114, 
-    7, 0, 0, 0, 0, 0, 0, 0, 119, 97, 
-    105, 116, 101, 114, 115, 7, 0, 0, 0, 0, 
-    0, 0, 0, 114, 101, 108, 101, 97, 115, 101, 
-    4, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
-    99, 107, 6, 0, 0, 0, 0, 0, 0, 0, 
-    119, 97, 107, 101, 117, 112, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 3, 0, 0, 0, 0, 0, 
-    0, 0, 116, 105, 100, 32, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 17, 0, 0, 0, 0, 0, 0, 0, 42, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 95, 108, 
-    111, 97, 100, 95, 98, 97, 99, 107, 119, 97, 
-    114, 100, 95, 99, 111, 109, 112, 97, 116, 105, 
-    98, 108, 101, 46, 54, 50, 49, 58, 48, 0, 
-    162, 0, 0, 0, 0, 0, 0, 0, 42, 1, 
-    0, 0, 0, 17, 24, 0, 0, 0, 32, 0, 
-    0, 27, 1, 0, 10, 33, 2, 0, 27, 0, 
-    2, 11, 6, 3, 1, 0, 8, 79, 2, 3, 
-    19, 3, 16, 0, 0, 0, 33, 0, 0, 27, 
-    1, 0, 11, 34, 2, 1, 5, 32, 3, 0, 
-    27, 1, 3, 10, 74, 1, 10, 2, 1, 0, 
-    75, 1, 0, 45, 1, 0, 32, 1, 1, 33, 
+    0, 0, 0, 45, 1, 0, 32, 1, 1, 33, 
     0, 0, 27, 2, 0, 11, 32, 3, 0, 27, 
     0, 3, 10, 48, 2, 0, 1, 17, 0, 0, 
     0, 0, 52, 32, 0, 0, 27, 1, 0, 12, 
-    34, 2, 1, 4, 32, 3, 0, 27, 1, 3, 
-    10, 74, 1, 10, 2, 1, 0, 75, 1, 0, 
-    54, 17, 0, 0, 0, 0, 33, 0, 0, 27, 
-    1, 0, 11, 34, 2, 1, 5, 32, 3, 0, 
-    27, 1, 3, 10, 74, 1, 10, 2, 1, 0, 
-    75, 1, 239, 45, 1, 0, 32, 1, 1, 33, 
-    0, 0, 27, 2, 0, 11, 32, 3, 0, 27, 
-    0, 3, 10, 48, 2, 0, 1, 33, 3, 1, 
-    32, 1, 1, 30, 2, 0, 30, 4, 1, 74, 
-    1, 74, 2, 74, 4, 10, 3, 3, 0, 75, 
-    1, 95, 75, 1, 145, 75, 1, 217, 30, 5, 
-    1, 6, 1, 0, 5, 6, 79, 2, 1, 19, 
-    1, 14, 0, 0, 0, 42, 1, 0, 0, 0, 
-    17, 5, 0, 0, 0, 33, 0, 2, 21, 0, 
-    2, 0, 0, 0, 5, 17, 7, 0, 0, 0, 
-    52, 32, 0, 0, 27, 1, 0, 12, 32, 2, 
-    1, 43, 2, 1, 6, 54, 17, 0, 0, 0, 
-    0, 17, 0, 0, 0, 0, 33, 1, 1, 32, 
-    2, 1, 30, 3, 2, 30, 4, 1, 74, 2, 
-    74, 3, 74, 4, 10, 1, 3, 0, 75, 1, 
-    233, 75, 1, 0, 75, 1, 208, 30, 5, 1, 
-    6, 1, 0, 5, 6, 79, 2, 1, 19, 1, 
-    37, 0, 0, 0, 42, 1, 0, 0, 0, 17, 
+    34, 2, 1, 4, 1, 32, 32, 3, 0, 27, 
+    1, 3, 10, 38, 2, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 17, 0, 0, 0, 0, 33, 0, 0, 27, 
+    1, 0, 11, 34, 2, 1, 5, 1, 32, 32, 
+    3, 0, 27, 1, 3, 10, 38, 2, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 45, 1, 0, 32, 1, 1, 
+    33, 0, 0, 27, 2, 0, 11, 32, 3, 0, 
+    27, 0, 3, 10, 48, 2, 0, 1, 33, 3, 
+    1, 32, 1, 1, 30, 2, 0, 30, 4, 1, 
+    74, 1, 74, 2, 74, 4, 10, 3, 3, 0, 
+    75, 1, 95, 75, 1, 145, 75, 1, 217, 30, 
+    5, 1, 6, 1, 0, 5, 6, 79, 2, 1, 
+    19, 1, 12, 0, 0, 0, 17, 5, 0, 0, 
+    0, 33, 0, 2, 21, 0, 2, 0, 0, 0, 
+    5, 17, 6, 0, 0, 0, 52, 32, 0, 0, 
+    27, 1, 0, 12, 32, 2, 1, 43, 2, 1, 
+    6, 17, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 33, 1, 1, 32, 2, 1, 30, 3, 2, 
+    30, 4, 1, 74, 2, 74, 3, 74, 4, 10, 
+    1, 3, 0, 75, 1, 233, 75, 1, 0, 75, 
+    1, 208, 30, 5, 1, 6, 1, 0, 5, 6, 
+    79, 2, 1, 19, 1, 33, 0, 0, 0, 17, 
     5, 0, 0, 0, 33, 0, 2, 21, 0, 2, 
-    0, 0, 0, 5, 17, 30, 0, 0, 0, 52, 
+    0, 0, 0, 5, 17, 27, 0, 0, 0, 52, 
     32, 0, 1, 27, 1, 0, 13, 32, 2, 1, 
     43, 2, 1, 7, 33, 3, 3, 32, 1, 1, 
     30, 2, 3, 74, 1, 74, 2, 10, 3, 2, 
     0, 75, 1, 188, 75, 1, 189, 49, 4, 0, 
-    3, 79, 1, 4, 19, 4, 12, 0, 0, 0, 
+    3, 79, 1, 4, 19, 4, 10, 0, 0, 0, 
     32, 0, 0, 27, 1, 0, 10, 34, 2, 1, 
-    8, 30, 3, 4, 74, 3, 10, 2, 1, 0, 
-    75, 1, 70, 30, 1, 5, 1, 2, 0, 1, 
-    32, 3, 1, 43, 3, 2, 7, 17, 0, 0, 
-    0, 0, 54, 17, 0, 0, 0, 0, 17, 0, 
+    8, 1, 32, 30, 3, 4, 38, 2, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 30, 1, 5, 1, 2, 0, 
+    1, 32, 3, 1, 43, 3, 2, 7, 17, 0, 
+    0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 
     0, 0, 0, 33, 1, 1, 32, 2, 1, 30, 
     3, 6, 30, 4, 1, 74, 2, 74, 3, 74, 
     4, 10, 1, 3, 0, 75, 1, 188, 75, 1, 
     189, 75, 1, 27, 30, 5, 1, 6, 1, 0, 
-    5, 6, 79, 2, 1, 19, 1, 13, 0, 0, 
-    0, 42, 1, 0, 0, 0, 17, 5, 0, 0, 
-    0, 33, 0, 2, 21, 0, 2, 0, 0, 0, 
-    5, 17, 6, 0, 0, 0, 52, 32, 0, 0, 
-    32, 1, 1, 43, 1, 0, 9, 54, 17, 0, 
-    0, 0, 0, 17, 0, 0, 0, 0, 32, 0, 
-    1, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
-    0, 0, 0, 0, 0, 2, 10, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 108, 111, 97, 100, 
-    101, 114, 95, 95, 5, 2, 11, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 112, 97, 99, 107, 
-    97, 103, 101, 95, 95, 2, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 112, 97, 116, 104, 
-    95, 95, 2, 1, 0, 0, 0, 0, 0, 0, 
-    0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 8, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 115, 112, 101, 99, 95, 95, 0, 0, 
+    5, 6, 79, 2, 1, 19, 1, 11, 0, 0, 
+    0, 17, 5, 0, 0, 0, 33, 0, 2, 21, 
+    0, 2, 0, 0, 0, 5, 17, 5, 0, 0, 
+    0, 52, 32, 0, 0, 32, 1, 1, 43, 1, 
+    0, 9, 17, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 32, 0, 1, 41, 0, 8, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 23, 
+    0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 
+    0, 59, 0, 0, 0, 0, 0, 0, 0, 59, 
+    0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 
+    0, 0, 0, 0, 0, 68, 0, 0, 0, 0, 
+    0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 
+    0, 85, 0, 0, 0, 0, 0, 0, 0, 86, 
+    0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 
+    0, 0, 0, 0, 0, 91, 0, 0, 0, 0, 
+    0, 0, 0, 116, 0, 0, 0, 0, 0, 0, 
+    0, 86, 0, 0, 0, 0, 0, 0, 0, 133, 
+    0, 0, 0, 0, 0, 0, 0, 134, 0, 0, 
+    0, 0, 0, 0, 0, 134, 0, 0, 0, 0, 
+    0, 0, 0, 139, 0, 0, 0, 0, 0, 0, 
+    0, 142, 0, 0, 0, 0, 0, 0, 0, 134, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 
-    0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 
-    0, 0, 0, 0, 0, 95, 108, 111, 97, 100, 
-    95, 98, 97, 99, 107, 119, 97, 114, 100, 95, 
-    99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 
-    14, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 115, 121, 115, 7, 
-    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
-    97, 116, 116, 114, 14, 0, 0, 0, 0, 0, 
-    0, 0, 65, 116, 116, 114, 105, 98, 117, 116, 
-    101, 69, 114, 114, 111, 114, 7, 0, 0, 0, 
-    0, 0, 0, 0, 104, 97, 115, 97, 116, 116, 
-    114, 11, 0, 0, 0, 0, 0, 0, 0, 108, 
-    111, 97, 100, 95, 109, 111, 100, 117, 108, 101, 
-    3, 0, 0, 0, 0, 0, 0, 0, 112, 111, 
-    112, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 108, 111, 97, 100, 101, 114, 95, 95, 11, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 112, 
-    97, 99, 107, 97, 103, 101, 95, 95, 10, 0, 
-    0, 0, 0, 0, 0, 0, 114, 112, 97, 114, 
-    116, 105, 116, 105, 111, 110, 8, 0, 0, 0, 
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 2, 
+    10, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    108, 111, 97, 100, 101, 114, 95, 95, 5, 2, 
+    11, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    112, 97, 99, 107, 97, 103, 101, 95, 95, 2, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    112, 97, 116, 104, 95, 95, 2, 1, 0, 0, 
+    0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 8, 0, 0, 0, 
     0, 0, 0, 0, 95, 95, 115, 112, 101, 99, 
-    95, 95, 4, 0, 0, 0, 0, 0, 0, 0, 
-    110, 97, 109, 101, 7, 0, 0, 0, 0, 0, 
-    0, 0, 109, 111, 100, 117, 108, 101, 115, 6, 
-    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
-    100, 101, 114, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 110, 97, 109, 101, 95, 95, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 115, 112, 101, 99, 6, 0, 0, 
-    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
-    101, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 70, 114, 111, 122, 101, 110, 
-    73, 109, 112, 111, 114, 116, 101, 114, 46, 108, 
-    111, 97, 100, 95, 109, 111, 100, 117, 108, 101, 
-    46, 56, 51, 57, 58, 52, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
-    0, 32, 2, 0, 32, 3, 1, 74, 2, 74, 
-    3, 10, 1, 2, 0, 75, 1, 0, 75, 1, 
-    188, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 2, 95, 0, 0, 0, 
-    0, 0, 0, 0, 76, 111, 97, 100, 32, 97, 
-    32, 102, 114, 111, 122, 101, 110, 32, 109, 111, 
-    100, 117, 108, 101, 46, 10, 10, 32, 32, 32, 
-    32, 32, 32, 32, 32, 84, 104, 105, 115, 32, 
-    109, 101, 116, 104, 111, 100, 32, 105, 115, 32, 
-    100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 
-    46, 32, 32, 85, 115, 101, 32, 101, 120, 101, 
-    99, 95, 109, 111, 100, 117, 108, 101, 40, 41, 
-    32, 105, 110, 115, 116, 101, 97, 100, 46, 10, 
-    10, 32, 32, 32, 32, 32, 32, 32, 32, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
-    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
-    95, 109, 111, 100, 117, 108, 101, 1, 0, 0, 
-    0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
-    0, 0, 0, 95, 108, 111, 97, 100, 95, 109, 
-    111, 100, 117, 108, 101, 95, 115, 104, 105, 109, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 99, 108, 115, 8, 0, 0, 
-    0, 0, 0, 0, 0, 102, 117, 108, 108, 110, 
-    97, 109, 101, 32, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 11, 
-    0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 95, 108, 111, 97, 
-    100, 95, 117, 110, 108, 111, 99, 107, 101, 100, 
-    46, 54, 53, 56, 58, 48, 0, 128, 0, 0, 
-    0, 0, 0, 0, 0, 32, 0, 0, 27, 1, 
-    0, 10, 30, 2, 0, 6, 0, 1, 2, 7, 
-    79, 3, 0, 19, 0, 13, 0, 0, 0, 33, 
-    1, 0, 32, 0, 0, 27, 2, 0, 10, 30, 
-    3, 1, 74, 2, 74, 3, 10, 1, 2, 0, 
-    75, 1, 0, 75, 1, 0, 49, 4, 0, 3, 
-    79, 1, 4, 22, 4, 104, 0, 0, 0, 17, 
-    0, 0, 0, 0, 33, 1, 2, 32, 2, 0, 
-    74, 2, 10, 1, 1, 0, 75, 1, 0, 45, 
-    1, 0, 30, 1, 2, 32, 0, 0, 43, 0, 
-    1, 7, 42, 1, 0, 0, 0, 17, 4, 0, 
-    0, 0, 30, 0, 3, 32, 1, 0, 43, 1, 
-    0, 7, 52, 32, 0, 1, 33, 1, 3, 27, 
-    2, 1, 11, 32, 3, 0, 27, 1, 3, 12, 
-    48, 2, 1, 0, 42, 1, 0, 0, 0, 17, 
-    15, 0, 0, 0, 42, 1, 0, 0, 0, 17, 
-    5, 0, 0, 0, 33, 0, 5, 21, 0, 2, 
-    0, 0, 0, 5, 17, 8, 0, 0, 0, 52, 
-    33, 0, 3, 27, 1, 0, 11, 32, 2, 0, 
-    27, 0, 2, 12, 55, 1, 0, 54, 17, 0, 
-    0, 0, 0, 52, 32, 0, 0, 27, 1, 0, 
-    10, 30, 2, 0, 6, 0, 1, 2, 6, 79, 
-    3, 0, 22, 0, 8, 0, 0, 0, 32, 1, 
-    0, 27, 0, 1, 10, 34, 2, 0, 8, 32, 
-    1, 1, 74, 1, 10, 2, 1, 0, 75, 1, 
-    0, 17, 7, 0, 0, 0, 32, 0, 0, 27, 
-    1, 0, 13, 30, 2, 0, 6, 0, 1, 2, 
-    6, 79, 3, 0, 22, 0, 39, 0, 0, 0, 
-    17, 0, 0, 0, 0, 54, 17, 0, 0, 0, 
-    0, 33, 0, 3, 27, 1, 0, 11, 34, 2, 
-    1, 9, 32, 3, 0, 27, 1, 3, 12, 74, 
-    1, 10, 2, 1, 0, 75, 1, 0, 45, 1, 
-    0, 32, 1, 1, 33, 0, 3, 27, 2, 0, 
-    11, 32, 3, 0, 27, 0, 3, 12, 48, 2, 
-    0, 1, 33, 3, 6, 30, 1, 4, 32, 0, 
-    0, 27, 2, 0, 12, 32, 4, 0, 27, 5, 
-    4, 10, 74, 1, 74, 2, 74, 5, 10, 3, 
-    3, 0, 75, 1, 0, 75, 1, 0, 75, 1, 
-    0, 54, 17, 0, 0, 0, 0, 30, 0, 3, 
-    32, 1, 0, 43, 1, 0, 7, 17, 0, 0, 
-    0, 0, 32, 0, 1, 41, 0, 33, 1, 4, 
-    30, 2, 5, 32, 3, 0, 27, 4, 3, 12, 
-    12, 1, 1, 0, 0, 0, 0, 0, 0, 0, 
-    2, 1, 0, 0, 0, 0, 0, 0, 0, 4, 
-    1, 0, 0, 0, 0, 0, 0, 0, 12, 40, 
-    1, 0, 33, 1, 1, 32, 2, 0, 74, 2, 
-    10, 1, 1, 0, 75, 1, 0, 41, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
-    0, 5, 2, 11, 0, 0, 0, 0, 0, 0, 
-    0, 101, 120, 101, 99, 95, 109, 111, 100, 117, 
-    108, 101, 6, 1, 6, 0, 2, 18, 0, 0, 
-    0, 0, 0, 0, 0, 105, 109, 112, 111, 114, 
-    116, 32, 123, 33, 114, 125, 32, 35, 32, 123, 
-    33, 114, 125, 2, 14, 0, 0, 0, 0, 0, 
-    0, 0, 109, 105, 115, 115, 105, 110, 103, 32, 
-    108, 111, 97, 100, 101, 114, 0, 0, 0, 0, 
+    95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 
-    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 
-    0, 0, 0, 95, 108, 111, 97, 100, 95, 117, 
-    110, 108, 111, 99, 107, 101, 100, 14, 0, 0, 
-    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
-    0, 0, 0, 104, 97, 115, 97, 116, 116, 114, 
-    25, 0, 0, 0, 0, 0, 0, 0, 95, 108, 
-    111, 97, 100, 95, 98, 97, 99, 107, 119, 97, 
-    114, 100, 95, 99, 111, 109, 112, 97, 116, 105, 
-    98, 108, 101, 16, 0, 0, 0, 0, 0, 0, 
-    0, 109, 111, 100, 117, 108, 101, 95, 102, 114, 
-    111, 109, 95, 115, 112, 101, 99, 3, 0, 0, 
-    0, 0, 0, 0, 0, 115, 121, 115, 11, 0, 
-    0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 
-    114, 116, 69, 114, 114, 111, 114, 8, 0, 0, 
-    0, 0, 0, 0, 0, 75, 101, 121, 69, 114, 
-    114, 111, 114, 16, 0, 0, 0, 0, 0, 0, 
-    0, 95, 118, 101, 114, 98, 111, 115, 101, 95, 
-    109, 101, 115, 115, 97, 103, 101, 13, 0, 0, 
-    0, 0, 0, 0, 0, 95, 105, 110, 105, 116, 
-    105, 97, 108, 105, 122, 105, 110, 103, 11, 0, 
-    0, 0, 0, 0, 0, 0, 101, 120, 101, 99, 
-    95, 109, 111, 100, 117, 108, 101, 3, 0, 0, 
-    0, 0, 0, 0, 0, 112, 111, 112, 6, 0, 
-    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
-    101, 114, 7, 0, 0, 0, 0, 0, 0, 0, 
-    109, 111, 100, 117, 108, 101, 115, 4, 0, 0, 
-    0, 0, 0, 0, 0, 110, 97, 109, 101, 26, 
-    0, 0, 0, 0, 0, 0, 0, 115, 117, 98, 
-    109, 111, 100, 117, 108, 101, 95, 115, 101, 97, 
-    114, 99, 104, 95, 108, 111, 99, 97, 116, 105, 
-    111, 110, 115, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 
+    0, 25, 0, 0, 0, 0, 0, 0, 0, 95, 
+    108, 111, 97, 100, 95, 98, 97, 99, 107, 119, 
+    97, 114, 100, 95, 99, 111, 109, 112, 97, 116, 
+    105, 98, 108, 101, 14, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    115, 121, 115, 7, 0, 0, 0, 0, 0, 0, 
+    0, 103, 101, 116, 97, 116, 116, 114, 14, 0, 
+    0, 0, 0, 0, 0, 0, 65, 116, 116, 114, 
+    105, 98, 117, 116, 101, 69, 114, 114, 111, 114, 
+    7, 0, 0, 0, 0, 0, 0, 0, 104, 97, 
+    115, 97, 116, 116, 114, 11, 0, 0, 0, 0, 
+    0, 0, 0, 108, 111, 97, 100, 95, 109, 111, 
+    100, 117, 108, 101, 3, 0, 0, 0, 0, 0, 
+    0, 0, 112, 111, 112, 10, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 108, 111, 97, 100, 101, 
+    114, 95, 95, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 112, 97, 99, 107, 97, 103, 101, 
+    95, 95, 10, 0, 0, 0, 0, 0, 0, 0, 
+    114, 112, 97, 114, 116, 105, 116, 105, 111, 110, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    115, 112, 101, 99, 95, 95, 4, 0, 0, 0, 
+    0, 0, 0, 0, 110, 97, 109, 101, 7, 0, 
+    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
+    108, 101, 115, 6, 0, 0, 0, 0, 0, 0, 
+    0, 108, 111, 97, 100, 101, 114, 8, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 110, 97, 109, 
+    101, 95, 95, 0, 0, 0, 0, 0, 0, 0, 
     0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
     0, 0, 0, 0, 0, 0, 0, 115, 112, 101, 
     99, 6, 0, 0, 0, 0, 0, 0, 0, 109, 
     111, 100, 117, 108, 101, 32, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 6, 0, 0, 0, 0, 0, 0, 0, 44, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 43, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 46, 66, 117, 
-    105, 108, 116, 105, 110, 73, 109, 112, 111, 114, 
-    116, 101, 114, 46, 109, 111, 100, 117, 108, 101, 
-    95, 114, 101, 112, 114, 46, 55, 50, 54, 58, 
-    52, 0, 22, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 30, 1, 1, 32, 0, 0, 27, 
-    2, 0, 1, 73, 3, 2, 1, 30, 0, 2, 
-    33, 2, 0, 27, 4, 2, 2, 73, 5, 4, 
-    0, 30, 2, 3, 74, 1, 74, 3, 74, 0, 
-    74, 5, 74, 2, 72, 4, 5, 75, 1, 189, 
-    75, 1, 0, 75, 1, 92, 75, 1, 188, 75, 
-    1, 188, 41, 4, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 2, 115, 0, 0, 
-    0, 0, 0, 0, 0, 82, 101, 116, 117, 114, 
-    110, 32, 114, 101, 112, 114, 32, 102, 111, 114, 
-    32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 
-    101, 46, 10, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 84, 104, 101, 32, 109, 101, 116, 104, 
-    111, 100, 32, 105, 115, 32, 100, 101, 112, 114, 
-    101, 99, 97, 116, 101, 100, 46, 32, 32, 84, 
-    104, 101, 32, 105, 109, 112, 111, 114, 116, 32, 
-    109, 97, 99, 104, 105, 110, 101, 114, 121, 32, 
-    100, 111, 101, 115, 32, 116, 104, 101, 32, 106, 
-    111, 98, 32, 105, 116, 115, 101, 108, 102, 46, 
-    10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
-    2, 8, 0, 0, 0, 0, 0, 0, 0, 60, 
-    109, 111, 100, 117, 108, 101, 32, 2, 2, 0, 
-    0, 0, 0, 0, 0, 0, 32, 40, 2, 2, 
-    0, 0, 0, 0, 0, 0, 0, 41, 62, 0, 
+    111, 116, 115, 116, 114, 97, 112, 46, 70, 114, 
+    111, 122, 101, 110, 73, 109, 112, 111, 114, 116, 
+    101, 114, 46, 108, 111, 97, 100, 95, 109, 111, 
+    100, 117, 108, 101, 46, 56, 51, 57, 58, 52, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 33, 1, 0, 32, 2, 0, 32, 3, 
+    1, 74, 2, 74, 3, 10, 1, 2, 0, 75, 
+    1, 0, 75, 1, 188, 41, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 95, 0, 
+    0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 
+    32, 97, 32, 102, 114, 111, 122, 101, 110, 32, 
+    109, 111, 100, 117, 108, 101, 46, 10, 10, 32, 
+    32, 32, 32, 32, 32, 32, 32, 84, 104, 105, 
+    115, 32, 109, 101, 116, 104, 111, 100, 32, 105, 
+    115, 32, 100, 101, 112, 114, 101, 99, 97, 116, 
+    101, 100, 46, 32, 32, 85, 115, 101, 32, 101, 
+    120, 101, 99, 95, 109, 111, 100, 117, 108, 101, 
+    40, 41, 32, 105, 110, 115, 116, 101, 97, 100, 
+    46, 10, 10, 32, 32, 32, 32, 32, 32, 32, 
+    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
+    97, 100, 95, 109, 111, 100, 117, 108, 101, 1, 
+    0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 0, 0, 0, 95, 108, 111, 97, 100, 
+    95, 109, 111, 100, 117, 108, 101, 95, 115, 104, 
+    105, 109, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 99, 108, 115, 8, 
+    0, 0, 0, 0, 0, 0, 0, 102, 117, 108, 
+    108, 110, 97, 109, 101, 33, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 31, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 46, 95, 108, 
+    111, 97, 100, 95, 117, 110, 108, 111, 99, 107, 
+    101, 100, 46, 54, 53, 56, 58, 48, 0, 118, 
+    0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 
+    27, 1, 0, 10, 30, 2, 0, 6, 0, 1, 
+    2, 7, 79, 3, 0, 19, 0, 13, 0, 0, 
+    0, 33, 1, 0, 32, 0, 0, 27, 2, 0, 
+    10, 30, 3, 1, 74, 2, 74, 3, 10, 1, 
+    2, 0, 75, 1, 0, 75, 1, 0, 49, 4, 
+    0, 3, 79, 1, 4, 22, 4, 94, 0, 0, 
+    0, 17, 0, 0, 0, 0, 33, 1, 2, 32, 
+    2, 0, 74, 2, 10, 1, 1, 0, 75, 1, 
+    0, 45, 1, 0, 30, 1, 2, 32, 0, 0, 
+    43, 0, 1, 7, 17, 4, 0, 0, 0, 30, 
+    0, 3, 32, 1, 0, 43, 1, 0, 7, 52, 
+    32, 0, 1, 33, 1, 3, 27, 2, 1, 11, 
+    32, 3, 0, 27, 1, 3, 12, 48, 2, 1, 
+    0, 17, 13, 0, 0, 0, 17, 5, 0, 0, 
+    0, 33, 0, 5, 21, 0, 2, 0, 0, 0, 
+    5, 17, 7, 0, 0, 0, 52, 33, 0, 3, 
+    27, 1, 0, 11, 32, 2, 0, 27, 0, 2, 
+    12, 55, 1, 0, 17, 0, 0, 0, 0, 52, 
+    32, 0, 0, 27, 1, 0, 10, 30, 2, 0, 
+    6, 0, 1, 2, 6, 79, 3, 0, 22, 0, 
+    6, 0, 0, 0, 32, 1, 0, 27, 0, 1, 
+    10, 34, 2, 0, 8, 1, 32, 32, 1, 1, 
+    38, 2, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 17, 7, 
+    0, 0, 0, 32, 0, 0, 27, 1, 0, 13, 
+    30, 2, 0, 6, 0, 1, 2, 6, 79, 3, 
+    0, 22, 0, 35, 0, 0, 0, 17, 0, 0, 
+    0, 0, 17, 0, 0, 0, 0, 33, 0, 3, 
+    27, 1, 0, 11, 34, 2, 1, 9, 1, 32, 
+    32, 3, 0, 27, 1, 3, 12, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 45, 1, 0, 32, 1, 
+    1, 33, 0, 3, 27, 2, 0, 11, 32, 3, 
+    0, 27, 0, 3, 12, 48, 2, 0, 1, 33, 
+    3, 6, 30, 1, 4, 32, 0, 0, 27, 2, 
+    0, 12, 32, 4, 0, 27, 5, 4, 10, 74, 
+    1, 74, 2, 74, 5, 10, 3, 3, 0, 75, 
+    1, 0, 75, 1, 0, 75, 1, 0, 17, 0, 
+    0, 0, 0, 30, 0, 3, 32, 1, 0, 43, 
+    1, 0, 7, 17, 0, 0, 0, 0, 32, 0, 
+    1, 41, 0, 33, 1, 4, 30, 2, 5, 32, 
+    3, 0, 27, 4, 3, 12, 12, 1, 1, 0, 
+    0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 
+    0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 
+    0, 0, 0, 0, 12, 40, 1, 0, 33, 1, 
+    1, 32, 2, 0, 74, 2, 10, 1, 1, 0, 
+    75, 1, 0, 41, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 
+    0, 29, 0, 0, 0, 0, 0, 0, 0, 29, 
+    0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 
+    0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 
+    0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 
+    0, 39, 0, 0, 0, 0, 0, 0, 0, 40, 
+    0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 
+    0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 
+    0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 41, 
+    0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 
+    0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 
+    0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 
+    0, 51, 0, 0, 0, 0, 0, 0, 0, 41, 
+    0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 
+    0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 
+    0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 
+    0, 53, 0, 0, 0, 0, 0, 0, 0, 72, 
+    0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 
+    0, 0, 0, 0, 0, 72, 0, 0, 0, 0, 
+    0, 0, 0, 99, 0, 0, 0, 0, 0, 0, 
+    0, 29, 0, 0, 0, 0, 0, 0, 0, 106, 
+    0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 
+    0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 5, 2, 11, 0, 0, 
+    0, 0, 0, 0, 0, 101, 120, 101, 99, 95, 
+    109, 111, 100, 117, 108, 101, 6, 1, 6, 0, 
+    2, 18, 0, 0, 0, 0, 0, 0, 0, 105, 
+    109, 112, 111, 114, 116, 32, 123, 33, 114, 125, 
+    32, 35, 32, 123, 33, 114, 125, 2, 14, 0, 
+    0, 0, 0, 0, 0, 0, 109, 105, 115, 115, 
+    105, 110, 103, 32, 108, 111, 97, 100, 101, 114, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
-    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
-    108, 101, 95, 114, 101, 112, 114, 3, 0, 0, 
-    0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 
-    0, 0, 0, 66, 117, 105, 108, 116, 105, 110, 
-    73, 109, 112, 111, 114, 116, 101, 114, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 110, 97, 
-    109, 101, 95, 95, 7, 0, 0, 0, 0, 0, 
-    0, 0, 95, 79, 82, 73, 71, 73, 78, 0, 
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 14, 
+    0, 0, 0, 0, 0, 0, 0, 95, 108, 111, 
+    97, 100, 95, 117, 110, 108, 111, 99, 107, 101, 
+    100, 14, 0, 0, 0, 0, 0, 0, 0, 7, 
+    0, 0, 0, 0, 0, 0, 0, 104, 97, 115, 
+    97, 116, 116, 114, 25, 0, 0, 0, 0, 0, 
+    0, 0, 95, 108, 111, 97, 100, 95, 98, 97, 
+    99, 107, 119, 97, 114, 100, 95, 99, 111, 109, 
+    112, 97, 116, 105, 98, 108, 101, 16, 0, 0, 
+    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
+    101, 95, 102, 114, 111, 109, 95, 115, 112, 101, 
+    99, 3, 0, 0, 0, 0, 0, 0, 0, 115, 
+    121, 115, 11, 0, 0, 0, 0, 0, 0, 0, 
+    73, 109, 112, 111, 114, 116, 69, 114, 114, 111, 
+    114, 8, 0, 0, 0, 0, 0, 0, 0, 75, 
+    101, 121, 69, 114, 114, 111, 114, 16, 0, 0, 
+    0, 0, 0, 0, 0, 95, 118, 101, 114, 98, 
+    111, 115, 101, 95, 109, 101, 115, 115, 97, 103, 
+    101, 13, 0, 0, 0, 0, 0, 0, 0, 95, 
+    105, 110, 105, 116, 105, 97, 108, 105, 122, 105, 
+    110, 103, 11, 0, 0, 0, 0, 0, 0, 0, 
+    101, 120, 101, 99, 95, 109, 111, 100, 117, 108, 
+    101, 3, 0, 0, 0, 0, 0, 0, 0, 112, 
+    111, 112, 6, 0, 0, 0, 0, 0, 0, 0, 
+    108, 111, 97, 100, 101, 114, 7, 0, 0, 0, 
+    0, 0, 0, 0, 109, 111, 100, 117, 108, 101, 
+    115, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
+    97, 109, 101, 26, 0, 0, 0, 0, 0, 0, 
+    0, 115, 117, 98, 109, 111, 100, 117, 108, 101, 
+    95, 115, 101, 97, 114, 99, 104, 95, 108, 111, 
+    99, 97, 116, 105, 111, 110, 115, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 115, 112, 101, 99, 6, 0, 0, 0, 0, 
+    0, 0, 0, 109, 111, 100, 117, 108, 101, 32, 
     0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
     0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
-    0, 0, 0, 109, 111, 100, 117, 108, 101, 32, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
-    0, 0, 0, 42, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 
     0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
     112, 46, 66, 117, 105, 108, 116, 105, 110, 73, 
-    109, 112, 111, 114, 116, 101, 114, 46, 102, 105, 
-    110, 100, 95, 115, 112, 101, 99, 46, 55, 51, 
-    53, 58, 52, 0, 24, 0, 0, 0, 0, 0, 
-    0, 0, 32, 0, 2, 30, 1, 0, 6, 2, 
-    0, 1, 7, 79, 3, 2, 22, 2, 17, 0, 
-    0, 0, 33, 0, 0, 34, 1, 0, 2, 32, 
-    2, 1, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 79, 3, 0, 22, 0, 2, 0, 0, 0, 
-    30, 1, 0, 41, 1, 33, 2, 1, 32, 1, 
-    1, 32, 3, 0, 32, 4, 0, 27, 5, 4, 
-    3, 12, 2, 2, 0, 0, 0, 0, 0, 0, 
-    0, 1, 3, 1, 0, 0, 0, 0, 0, 0, 
-    0, 5, 1, 0, 0, 0, 0, 0, 0, 0, 
-    4, 41, 0, 30, 1, 0, 41, 1, 0, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    109, 112, 111, 114, 116, 101, 114, 46, 109, 111, 
+    100, 117, 108, 101, 95, 114, 101, 112, 114, 46, 
+    55, 50, 54, 58, 52, 0, 22, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 30, 1, 1, 
+    32, 0, 0, 27, 2, 0, 1, 73, 3, 2, 
+    1, 30, 0, 2, 33, 2, 0, 27, 4, 2, 
+    2, 73, 5, 4, 0, 30, 2, 3, 74, 1, 
+    74, 3, 74, 0, 74, 5, 74, 2, 72, 4, 
+    5, 75, 1, 189, 75, 1, 0, 75, 1, 92, 
+    75, 1, 188, 75, 1, 188, 41, 4, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 2, 115, 
+    0, 0, 0, 0, 0, 0, 0, 82, 101, 116, 
+    117, 114, 110, 32, 114, 101, 112, 114, 32, 102, 
+    111, 114, 32, 116, 104, 101, 32, 109, 111, 100, 
+    117, 108, 101, 46, 10, 10, 32, 32, 32, 32, 
+    32, 32, 32, 32, 84, 104, 101, 32, 109, 101, 
+    116, 104, 111, 100, 32, 105, 115, 32, 100, 101, 
+    112, 114, 101, 99, 97, 116, 101, 100, 46, 32, 
+    32, 84, 104, 101, 32, 105, 109, 112, 111, 114, 
+    116, 32, 109, 97, 99, 104, 105, 110, 101, 114, 
+    121, 32, 100, 111, 101, 115, 32, 116, 104, 101, 
+    32, 106, 111, 98, 32, 105, 116, 115, 101, 108, 
+    102, 46, 10, 10, 32, 32, 32, 32, 32, 32, 
+    32, 32, 2, 8, 0, 0, 0, 0, 0, 0, 
+    0, 60, 109, 111, 100, 117, 108, 101, 32, 2, 
+    2, 0, 0, 0, 0, 0, 0, 0, 32, 40, 
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 41, 
+    62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 109, 111, 
+    100, 117, 108, 101, 95, 114, 101, 112, 114, 3, 
+    0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 
+    0, 0, 0, 0, 0, 66, 117, 105, 108, 116, 
+    105, 110, 73, 109, 112, 111, 114, 116, 101, 114, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    110, 97, 109, 101, 95, 95, 7, 0, 0, 0, 
+    0, 0, 0, 0, 95, 79, 82, 73, 71, 73, 
+    78, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
+    101, 33, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
+    0, 0, 0, 0, 0, 42, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 46, 66, 117, 105, 108, 116, 105, 
+    110, 73, 109, 112, 111, 114, 116, 101, 114, 46, 
+    102, 105, 110, 100, 95, 115, 112, 101, 99, 46, 
+    55, 51, 53, 58, 52, 0, 22, 0, 0, 0, 
+    0, 0, 0, 0, 32, 0, 2, 30, 1, 0, 
+    6, 2, 0, 1, 7, 79, 3, 2, 22, 2, 
+    15, 0, 0, 0, 33, 0, 0, 34, 1, 0, 
+    2, 1, 32, 32, 2, 1, 38, 1, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 79, 3, 0, 22, 0, 2, 
+    0, 0, 0, 30, 1, 0, 41, 1, 33, 2, 
+    1, 32, 1, 1, 32, 3, 0, 32, 4, 0, 
+    27, 5, 4, 3, 12, 2, 2, 0, 0, 0, 
+    0, 0, 0, 0, 1, 3, 1, 0, 0, 0, 
+    0, 0, 0, 0, 5, 1, 0, 0, 0, 0, 
+    0, 0, 0, 4, 41, 0, 30, 1, 0, 41, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
-    9, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
-    110, 100, 95, 115, 112, 101, 99, 5, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 95, 105, 109, 112, 16, 0, 0, 
-    0, 0, 0, 0, 0, 115, 112, 101, 99, 95, 
-    102, 114, 111, 109, 95, 108, 111, 97, 100, 101, 
-    114, 10, 0, 0, 0, 0, 0, 0, 0, 105, 
-    115, 95, 98, 117, 105, 108, 116, 105, 110, 7, 
-    0, 0, 0, 0, 0, 0, 0, 95, 79, 82, 
-    73, 71, 73, 78, 6, 0, 0, 0, 0, 0, 
-    0, 0, 111, 114, 105, 103, 105, 110, 0, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 99, 108, 115, 8, 0, 0, 0, 0, 
-    0, 0, 0, 102, 117, 108, 108, 110, 97, 109, 
-    101, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
-    97, 116, 104, 6, 0, 0, 0, 0, 0, 0, 
-    0, 116, 97, 114, 103, 101, 116, 32, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
     0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
-    0, 41, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
-    70, 114, 111, 122, 101, 110, 73, 109, 112, 111, 
-    114, 116, 101, 114, 46, 102, 105, 110, 100, 95, 
-    115, 112, 101, 99, 46, 56, 49, 48, 58, 52, 
-    0, 17, 0, 0, 0, 0, 0, 0, 0, 33, 
-    0, 0, 34, 1, 0, 2, 32, 2, 1, 74, 
-    2, 10, 1, 1, 0, 75, 1, 0, 79, 3, 
-    0, 22, 0, 2, 0, 0, 0, 30, 1, 0, 
-    41, 1, 33, 2, 1, 32, 1, 1, 32, 3, 
-    0, 32, 4, 0, 27, 5, 4, 3, 12, 2, 
-    2, 0, 0, 0, 0, 0, 0, 0, 1, 3, 
-    1, 0, 0, 0, 0, 0, 0, 0, 5, 1, 
-    0, 0, 0, 0, 0, 0, 0, 4, 41, 0, 
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
+    105, 110, 100, 95, 115, 112, 101, 99, 5, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 95, 105, 109, 112, 16, 0, 
+    0, 0, 0, 0, 0, 0, 115, 112, 101, 99, 
+    95, 102, 114, 111, 109, 95, 108, 111, 97, 100, 
+    101, 114, 10, 0, 0, 0, 0, 0, 0, 0, 
+    105, 115, 95, 98, 117, 105, 108, 116, 105, 110, 
+    7, 0, 0, 0, 0, 0, 0, 0, 95, 79, 
+    82, 73, 71, 73, 78, 6, 0, 0, 0, 0, 
+    0, 0, 0, 111, 114, 105, 103, 105, 110, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 99, 108, 115, 8, 0, 0, 0, 
+    0, 0, 0, 0, 102, 117, 108, 108, 110, 97, 
+    109, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 6, 0, 0, 0, 0, 0, 
+    0, 0, 116, 97, 114, 103, 101, 116, 33, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 70, 114, 111, 122, 101, 110, 73, 109, 112, 
+    111, 114, 116, 101, 114, 46, 102, 105, 110, 100, 
+    95, 115, 112, 101, 99, 46, 56, 49, 48, 58, 
+    52, 0, 15, 0, 0, 0, 0, 0, 0, 0, 
+    33, 0, 0, 34, 1, 0, 2, 1, 32, 32, 
+    2, 1, 38, 1, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    79, 3, 0, 22, 0, 2, 0, 0, 0, 30, 
+    1, 0, 41, 1, 33, 2, 1, 32, 1, 1, 
+    32, 3, 0, 32, 4, 0, 27, 5, 4, 3, 
+    12, 2, 2, 0, 0, 0, 0, 0, 0, 0, 
+    1, 3, 1, 0, 0, 0, 0, 0, 0, 0, 
+    5, 1, 0, 0, 0, 0, 0, 0, 0, 4, 
+    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
@@ -5494,7 +5960,7 @@ std::vector<uint8_t> _bootstrap
     0, 0, 0, 0, 102, 117, 108, 108, 110, 97, 
     109, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
     112, 97, 116, 104, 6, 0, 0, 0, 0, 0, 
-    0, 0, 116, 97, 114, 103, 101, 116, 32, 0, 
+    0, 0, 116, 97, 114, 103, 101, 116, 33, 0, 
     0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
     0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
     0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 
@@ -5502,611 +5968,669 @@ std::vector<uint8_t> _bootstrap
     46, 66, 117, 105, 108, 116, 105, 110, 73, 109, 
     112, 111, 114, 116, 101, 114, 46, 102, 105, 110, 
     100, 95, 109, 111, 100, 117, 108, 101, 46, 55, 
-    52, 52, 58, 52, 0, 22, 0, 0, 0, 0, 
+    52, 52, 58, 52, 0, 18, 0, 0, 0, 0, 
     0, 0, 0, 30, 0, 0, 32, 1, 0, 34, 
-    2, 1, 0, 32, 3, 1, 32, 1, 2, 74, 
-    3, 74, 1, 10, 2, 2, 0, 75, 1, 0, 
-    75, 1, 0, 45, 3, 0, 32, 1, 3, 30, 
-    0, 1, 6, 2, 1, 0, 7, 79, 3, 2, 
-    22, 2, 2, 0, 0, 0, 30, 0, 1, 17, 
-    3, 0, 0, 0, 32, 1, 3, 27, 0, 1, 
-    1, 17, 0, 0, 0, 0, 41, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    2, 175, 0, 0, 0, 0, 0, 0, 0, 70, 
-    105, 110, 100, 32, 116, 104, 101, 32, 98, 117, 
-    105, 108, 116, 45, 105, 110, 32, 109, 111, 100, 
-    117, 108, 101, 46, 10, 10, 32, 32, 32, 32, 
-    32, 32, 32, 32, 73, 102, 32, 39, 112, 97, 
-    116, 104, 39, 32, 105, 115, 32, 101, 118, 101, 
-    114, 32, 115, 112, 101, 99, 105, 102, 105, 101, 
-    100, 32, 116, 104, 101, 110, 32, 116, 104, 101, 
-    32, 115, 101, 97, 114, 99, 104, 32, 105, 115, 
-    32, 99, 111, 110, 115, 105, 100, 101, 114, 101, 
-    100, 32, 97, 32, 102, 97, 105, 108, 117, 114, 
-    101, 46, 10, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 84, 104, 105, 115, 32, 109, 101, 116, 
-    104, 111, 100, 32, 105, 115, 32, 100, 101, 112, 
-    114, 101, 99, 97, 116, 101, 100, 46, 32, 32, 
-    85, 115, 101, 32, 102, 105, 110, 100, 95, 115, 
-    112, 101, 99, 40, 41, 32, 105, 110, 115, 116, 
-    101, 97, 100, 46, 10, 10, 32, 32, 32, 32, 
-    32, 32, 32, 32, 5, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 1, 0, 1, 32, 32, 3, 1, 32, 1, 
+    2, 38, 2, 32, 2, 0, 0, 0, 0, 0, 
+    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 
-    0, 0, 102, 105, 110, 100, 95, 109, 111, 100, 
-    117, 108, 101, 2, 0, 0, 0, 0, 0, 0, 
-    0, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
-    105, 110, 100, 95, 115, 112, 101, 99, 6, 0, 
-    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
-    101, 114, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 99, 108, 115, 8, 
-    0, 0, 0, 0, 0, 0, 0, 102, 117, 108, 
-    108, 110, 97, 109, 101, 4, 0, 0, 0, 0, 
-    0, 0, 0, 112, 97, 116, 104, 4, 0, 0, 
-    0, 0, 0, 0, 0, 115, 112, 101, 99, 32, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    45, 3, 0, 32, 1, 3, 30, 0, 1, 6, 
+    2, 1, 0, 7, 79, 3, 2, 22, 2, 2, 
+    0, 0, 0, 30, 0, 1, 17, 3, 0, 0, 
+    0, 32, 1, 3, 27, 0, 1, 1, 17, 0, 
     0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 46, 66, 117, 105, 108, 116, 105, 110, 73, 
-    109, 112, 111, 114, 116, 101, 114, 46, 103, 101, 
-    116, 95, 99, 111, 100, 101, 46, 55, 54, 57, 
-    58, 52, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 30, 1, 1, 41, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 2, 175, 0, 0, 0, 
+    0, 0, 0, 0, 70, 105, 110, 100, 32, 116, 
+    104, 101, 32, 98, 117, 105, 108, 116, 45, 105, 
+    110, 32, 109, 111, 100, 117, 108, 101, 46, 10, 
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 73, 
+    102, 32, 39, 112, 97, 116, 104, 39, 32, 105, 
+    115, 32, 101, 118, 101, 114, 32, 115, 112, 101, 
+    99, 105, 102, 105, 101, 100, 32, 116, 104, 101, 
+    110, 32, 116, 104, 101, 32, 115, 101, 97, 114, 
+    99, 104, 32, 105, 115, 32, 99, 111, 110, 115, 
+    105, 100, 101, 114, 101, 100, 32, 97, 32, 102, 
+    97, 105, 108, 117, 114, 101, 46, 10, 10, 32, 
+    32, 32, 32, 32, 32, 32, 32, 84, 104, 105, 
+    115, 32, 109, 101, 116, 104, 111, 100, 32, 105, 
+    115, 32, 100, 101, 112, 114, 101, 99, 97, 116, 
+    101, 100, 46, 32, 32, 85, 115, 101, 32, 102, 
+    105, 110, 100, 95, 115, 112, 101, 99, 40, 41, 
+    32, 105, 110, 115, 116, 101, 97, 100, 46, 10, 
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 5, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 2, 57, 0, 0, 0, 0, 0, 0, 0, 
-    82, 101, 116, 117, 114, 110, 32, 78, 111, 110, 
-    101, 32, 97, 115, 32, 98, 117, 105, 108, 116, 
-    45, 105, 110, 32, 109, 111, 100, 117, 108, 101, 
-    115, 32, 100, 111, 32, 110, 111, 116, 32, 104, 
-    97, 118, 101, 32, 99, 111, 100, 101, 32, 111, 
-    98, 106, 101, 99, 116, 115, 46, 5, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
-    0, 0, 0, 0, 0, 103, 101, 116, 95, 99, 
-    111, 100, 101, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 99, 108, 115, 8, 0, 
-    0, 0, 0, 0, 0, 0, 102, 117, 108, 108, 
-    110, 97, 109, 101, 32, 0, 0, 0, 0, 0, 
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 11, 
+    0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 
+    100, 95, 109, 111, 100, 117, 108, 101, 2, 0, 
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 
+    0, 0, 0, 0, 102, 105, 110, 100, 95, 115, 
+    112, 101, 99, 6, 0, 0, 0, 0, 0, 0, 
+    0, 108, 111, 97, 100, 101, 114, 0, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 99, 108, 115, 8, 0, 0, 0, 0, 0, 
+    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
+    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    116, 104, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 112, 101, 99, 32, 0, 0, 0, 0, 0, 
     0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 60, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 41, 0, 
     0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 95, 114, 101, 
-    113, 117, 105, 114, 101, 115, 95, 98, 117, 105, 
-    108, 116, 105, 110, 46, 95, 114, 101, 113, 117, 
-    105, 114, 101, 115, 95, 98, 117, 105, 108, 116, 
-    105, 110, 95, 119, 114, 97, 112, 112, 101, 114, 
-    46, 50, 52, 48, 58, 52, 0, 28, 0, 0, 
-    0, 0, 0, 0, 0, 32, 0, 1, 33, 1, 
-    0, 27, 2, 1, 3, 6, 3, 0, 2, 9, 
-    79, 1, 3, 19, 3, 13, 0, 0, 0, 33, 
-    1, 1, 30, 0, 0, 34, 2, 0, 2, 32, 
-    3, 1, 74, 3, 10, 2, 1, 0, 75, 1, 
-    0, 32, 4, 1, 74, 0, 12, 1, 1, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 
-    0, 0, 0, 0, 4, 39, 2, 0, 75, 0, 
-    0, 40, 1, 2, 31, 1, 0, 32, 2, 0, 
-    32, 3, 1, 74, 2, 74, 3, 10, 1, 2, 
-    0, 75, 1, 188, 75, 1, 0, 41, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    116, 115, 116, 114, 97, 112, 46, 66, 117, 105, 
+    108, 116, 105, 110, 73, 109, 112, 111, 114, 116, 
+    101, 114, 46, 103, 101, 116, 95, 99, 111, 100, 
+    101, 46, 55, 54, 57, 58, 52, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 30, 
+    1, 1, 41, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 2, 57, 0, 0, 0, 0, 
+    0, 0, 0, 82, 101, 116, 117, 114, 110, 32, 
+    78, 111, 110, 101, 32, 97, 115, 32, 98, 117, 
+    105, 108, 116, 45, 105, 110, 32, 109, 111, 100, 
+    117, 108, 101, 115, 32, 100, 111, 32, 110, 111, 
+    116, 32, 104, 97, 118, 101, 32, 99, 111, 100, 
+    101, 32, 111, 98, 106, 101, 99, 116, 115, 46, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 2, 29, 0, 0, 0, 0, 0, 0, 0, 
-    123, 33, 114, 125, 32, 105, 115, 32, 110, 111, 
-    116, 32, 97, 32, 98, 117, 105, 108, 116, 45, 
-    105, 110, 32, 109, 111, 100, 117, 108, 101, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 102, 120, 110, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 6, 0, 0, 0, 0, 0, 0, 0, 25, 
-    0, 0, 0, 0, 0, 0, 0, 95, 114, 101, 
-    113, 117, 105, 114, 101, 115, 95, 98, 117, 105, 
-    108, 116, 105, 110, 95, 119, 114, 97, 112, 112, 
-    101, 114, 5, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 115, 121, 
-    115, 11, 0, 0, 0, 0, 0, 0, 0, 73, 
-    109, 112, 111, 114, 116, 69, 114, 114, 111, 114, 
-    6, 0, 0, 0, 0, 0, 0, 0, 102, 111, 
-    114, 109, 97, 116, 20, 0, 0, 0, 0, 0, 
-    0, 0, 98, 117, 105, 108, 116, 105, 110, 95, 
-    109, 111, 100, 117, 108, 101, 95, 110, 97, 109, 
-    101, 115, 4, 0, 0, 0, 0, 0, 0, 0, 
-    110, 97, 109, 101, 0, 0, 0, 0, 0, 0, 
     0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
-    108, 102, 8, 0, 0, 0, 0, 0, 0, 0, 
-    102, 117, 108, 108, 110, 97, 109, 101, 32, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
+    116, 95, 99, 111, 100, 101, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 99, 108, 
+    115, 8, 0, 0, 0, 0, 0, 0, 0, 102, 
+    117, 108, 108, 110, 97, 109, 101, 33, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
+    0, 60, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 46, 
+    95, 114, 101, 113, 117, 105, 114, 101, 115, 95, 
+    98, 117, 105, 108, 116, 105, 110, 46, 95, 114, 
+    101, 113, 117, 105, 114, 101, 115, 95, 98, 117, 
+    105, 108, 116, 105, 110, 95, 119, 114, 97, 112, 
+    112, 101, 114, 46, 50, 52, 48, 58, 52, 0, 
+    26, 0, 0, 0, 0, 0, 0, 0, 32, 0, 
+    1, 33, 1, 0, 27, 2, 1, 3, 6, 3, 
+    0, 2, 9, 79, 1, 3, 19, 3, 11, 0, 
+    0, 0, 33, 1, 1, 30, 0, 0, 34, 2, 
+    0, 2, 1, 32, 32, 3, 1, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 32, 4, 1, 74, 0, 
+    12, 1, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 4, 
+    1, 0, 0, 0, 0, 0, 0, 0, 4, 39, 
+    2, 0, 75, 0, 0, 40, 1, 2, 31, 1, 
+    0, 32, 2, 0, 32, 3, 1, 74, 2, 74, 
+    3, 10, 1, 2, 0, 75, 1, 188, 75, 1, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 2, 29, 0, 0, 0, 0, 0, 
+    0, 0, 123, 33, 114, 125, 32, 105, 115, 32, 
+    110, 111, 116, 32, 97, 32, 98, 117, 105, 108, 
+    116, 45, 105, 110, 32, 109, 111, 100, 117, 108, 
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
     0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 95, 77, 111, 100, 117, 108, 101, 76, 111, 
-    99, 107, 77, 97, 110, 97, 103, 101, 114, 46, 
-    95, 95, 101, 120, 105, 116, 95, 95, 46, 49, 
-    53, 57, 58, 52, 0, 6, 0, 0, 0, 0, 
-    0, 0, 0, 32, 0, 0, 27, 1, 0, 1, 
-    34, 2, 1, 0, 10, 2, 0, 0, 30, 1, 
-    0, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 0, 102, 120, 110, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
+    0, 25, 0, 0, 0, 0, 0, 0, 0, 95, 
+    114, 101, 113, 117, 105, 114, 101, 115, 95, 98, 
+    117, 105, 108, 116, 105, 110, 95, 119, 114, 97, 
+    112, 112, 101, 114, 5, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    115, 121, 115, 11, 0, 0, 0, 0, 0, 0, 
+    0, 73, 109, 112, 111, 114, 116, 69, 114, 114, 
+    111, 114, 6, 0, 0, 0, 0, 0, 0, 0, 
+    102, 111, 114, 109, 97, 116, 20, 0, 0, 0, 
+    0, 0, 0, 0, 98, 117, 105, 108, 116, 105, 
+    110, 95, 109, 111, 100, 117, 108, 101, 95, 110, 
+    97, 109, 101, 115, 4, 0, 0, 0, 0, 0, 
+    0, 0, 110, 97, 109, 101, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 8, 0, 0, 0, 0, 0, 
+    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
+    33, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 46, 95, 77, 111, 100, 117, 108, 101, 
+    76, 111, 99, 107, 77, 97, 110, 97, 103, 101, 
+    114, 46, 95, 95, 101, 120, 105, 116, 95, 95, 
+    46, 49, 53, 57, 58, 52, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 32, 0, 0, 27, 1, 
+    0, 1, 34, 2, 1, 0, 1, 32, 38, 2, 
+    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 101, 120, 105, 116, 95, 
-    95, 2, 0, 0, 0, 0, 0, 0, 0, 7, 
-    0, 0, 0, 0, 0, 0, 0, 114, 101, 108, 
-    101, 97, 115, 101, 5, 0, 0, 0, 0, 0, 
-    0, 0, 95, 108, 111, 99, 107, 0, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 101, 108, 102, 4, 0, 0, 0, 0, 
-    0, 0, 0, 97, 114, 103, 115, 6, 0, 0, 
-    0, 0, 0, 0, 0, 107, 119, 97, 114, 103, 
-    115, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 66, 117, 105, 108, 116, 105, 
-    110, 73, 109, 112, 111, 114, 116, 101, 114, 46, 
-    105, 115, 95, 112, 97, 99, 107, 97, 103, 101, 
-    46, 55, 56, 49, 58, 52, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 30, 1, 
-    1, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 2, 52, 0, 0, 0, 
-    0, 0, 0, 0, 82, 101, 116, 117, 114, 110, 
-    32, 70, 97, 108, 115, 101, 32, 97, 115, 32, 
-    98, 117, 105, 108, 116, 45, 105, 110, 32, 109, 
-    111, 100, 117, 108, 101, 115, 32, 97, 114, 101, 
-    32, 110, 101, 118, 101, 114, 32, 112, 97, 99, 
-    107, 97, 103, 101, 115, 46, 6, 0, 0, 0, 
+    0, 0, 0, 0, 0, 30, 1, 0, 41, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 105, 115, 95, 112, 97, 
-    99, 107, 97, 103, 101, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 99, 108, 115, 
-    8, 0, 0, 0, 0, 0, 0, 0, 102, 117, 
-    108, 108, 110, 97, 109, 101, 32, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    36, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    108, 111, 99, 107, 95, 117, 110, 108, 111, 99, 
-    107, 95, 109, 111, 100, 117, 108, 101, 46, 50, 
-    48, 50, 58, 48, 0, 25, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 33, 1, 0, 32, 
-    2, 0, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 45, 1, 0, 42, 1, 0, 0, 0, 17, 
-    5, 0, 0, 0, 33, 0, 1, 21, 0, 2, 
-    0, 0, 0, 5, 17, 10, 0, 0, 0, 52, 
-    32, 1, 1, 34, 2, 1, 2, 10, 2, 0, 
-    0, 54, 17, 0, 0, 0, 0, 32, 1, 1, 
-    34, 2, 1, 3, 10, 2, 0, 0, 17, 0, 
-    0, 0, 0, 30, 0, 1, 41, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    101, 120, 105, 116, 95, 95, 2, 0, 0, 0, 
+    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
+    0, 0, 114, 101, 108, 101, 97, 115, 101, 5, 
+    0, 0, 0, 0, 0, 0, 0, 95, 108, 111, 
+    99, 107, 0, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 115, 101, 108, 102, 
+    4, 0, 0, 0, 0, 0, 0, 0, 97, 114, 
+    103, 115, 6, 0, 0, 0, 0, 0, 0, 0, 
+    107, 119, 97, 114, 103, 115, 32, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    43, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 46, 66, 
+    117, 105, 108, 116, 105, 110, 73, 109, 112, 111, 
+    114, 116, 101, 114, 46, 105, 115, 95, 112, 97, 
+    99, 107, 97, 103, 101, 46, 55, 56, 49, 58, 
+    52, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    30, 0, 0, 30, 1, 1, 41, 1, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 2, 52, 
+    0, 0, 0, 0, 0, 0, 0, 82, 101, 116, 
+    117, 114, 110, 32, 70, 97, 108, 115, 101, 32, 
+    97, 115, 32, 98, 117, 105, 108, 116, 45, 105, 
+    110, 32, 109, 111, 100, 117, 108, 101, 115, 32, 
+    97, 114, 101, 32, 110, 101, 118, 101, 114, 32, 
+    112, 97, 99, 107, 97, 103, 101, 115, 46, 6, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    2, 189, 0, 0, 0, 0, 0, 0, 0, 65, 
-    99, 113, 117, 105, 114, 101, 115, 32, 116, 104, 
-    101, 110, 32, 114, 101, 108, 101, 97, 115, 101, 
-    115, 32, 116, 104, 101, 32, 109, 111, 100, 117, 
-    108, 101, 32, 108, 111, 99, 107, 32, 102, 111, 
-    114, 32, 97, 32, 103, 105, 118, 101, 110, 32, 
-    109, 111, 100, 117, 108, 101, 32, 110, 97, 109, 
-    101, 46, 10, 10, 32, 32, 32, 32, 84, 104, 
-    105, 115, 32, 105, 115, 32, 117, 115, 101, 100, 
-    32, 116, 111, 32, 101, 110, 115, 117, 114, 101, 
-    32, 97, 32, 109, 111, 100, 117, 108, 101, 32, 
-    105, 115, 32, 99, 111, 109, 112, 108, 101, 116, 
-    101, 108, 121, 32, 105, 110, 105, 116, 105, 97, 
-    108, 105, 122, 101, 100, 44, 32, 105, 110, 32, 
-    116, 104, 101, 10, 32, 32, 32, 32, 101, 118, 
-    101, 110, 116, 32, 105, 116, 32, 105, 115, 32, 
-    98, 101, 105, 110, 103, 32, 105, 109, 112, 111, 
-    114, 116, 101, 100, 32, 98, 121, 32, 97, 110, 
-    111, 116, 104, 101, 114, 32, 116, 104, 114, 101, 
-    97, 100, 46, 10, 32, 32, 32, 32, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 105, 115, 
+    95, 112, 97, 99, 107, 97, 103, 101, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 19, 0, 
-    0, 0, 0, 0, 0, 0, 95, 108, 111, 99, 
-    107, 95, 117, 110, 108, 111, 99, 107, 95, 109, 
-    111, 100, 117, 108, 101, 4, 0, 0, 0, 0, 
-    0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 
-    0, 95, 103, 101, 116, 95, 109, 111, 100, 117, 
-    108, 101, 95, 108, 111, 99, 107, 14, 0, 0, 
-    0, 0, 0, 0, 0, 95, 68, 101, 97, 100, 
-    108, 111, 99, 107, 69, 114, 114, 111, 114, 7, 
-    0, 0, 0, 0, 0, 0, 0, 97, 99, 113, 
-    117, 105, 114, 101, 7, 0, 0, 0, 0, 0, 
-    0, 0, 114, 101, 108, 101, 97, 115, 101, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 110, 97, 109, 101, 4, 0, 0, 
-    0, 0, 0, 0, 0, 108, 111, 99, 107, 32, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    99, 108, 115, 8, 0, 0, 0, 0, 0, 0, 
+    0, 102, 117, 108, 108, 110, 97, 109, 101, 33, 
     0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 
     0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 46, 77, 111, 100, 117, 108, 101, 83, 112, 
-    101, 99, 46, 104, 97, 115, 95, 108, 111, 99, 
-    97, 116, 105, 111, 110, 46, 52, 48, 57, 58, 
-    52, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
-    33, 1, 0, 32, 2, 1, 74, 2, 10, 1, 
-    1, 0, 75, 1, 0, 32, 3, 0, 43, 3, 
-    0, 1, 30, 1, 0, 41, 1, 0, 0, 0, 
+    112, 46, 95, 108, 111, 99, 107, 95, 117, 110, 
+    108, 111, 99, 107, 95, 109, 111, 100, 117, 108, 
+    101, 46, 50, 48, 50, 58, 48, 0, 23, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 33, 
+    1, 0, 32, 2, 0, 74, 2, 10, 1, 1, 
+    0, 75, 1, 0, 45, 1, 0, 17, 5, 0, 
+    0, 0, 33, 0, 1, 21, 0, 2, 0, 0, 
+    0, 5, 17, 9, 0, 0, 0, 52, 32, 1, 
+    1, 34, 2, 1, 2, 1, 32, 38, 2, 32, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 32, 
+    1, 1, 34, 2, 1, 3, 1, 32, 38, 2, 
+    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    30, 0, 1, 41, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 8, 
+    0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 
+    0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 
+    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 2, 189, 0, 0, 0, 0, 0, 
+    0, 0, 65, 99, 113, 117, 105, 114, 101, 115, 
+    32, 116, 104, 101, 110, 32, 114, 101, 108, 101, 
+    97, 115, 101, 115, 32, 116, 104, 101, 32, 109, 
+    111, 100, 117, 108, 101, 32, 108, 111, 99, 107, 
+    32, 102, 111, 114, 32, 97, 32, 103, 105, 118, 
+    101, 110, 32, 109, 111, 100, 117, 108, 101, 32, 
+    110, 97, 109, 101, 46, 10, 10, 32, 32, 32, 
+    32, 84, 104, 105, 115, 32, 105, 115, 32, 117, 
+    115, 101, 100, 32, 116, 111, 32, 101, 110, 115, 
+    117, 114, 101, 32, 97, 32, 109, 111, 100, 117, 
+    108, 101, 32, 105, 115, 32, 99, 111, 109, 112, 
+    108, 101, 116, 101, 108, 121, 32, 105, 110, 105, 
+    116, 105, 97, 108, 105, 122, 101, 100, 44, 32, 
+    105, 110, 32, 116, 104, 101, 10, 32, 32, 32, 
+    32, 101, 118, 101, 110, 116, 32, 105, 116, 32, 
+    105, 115, 32, 98, 101, 105, 110, 103, 32, 105, 
+    109, 112, 111, 114, 116, 101, 100, 32, 98, 121, 
+    32, 97, 110, 111, 116, 104, 101, 114, 32, 116, 
+    104, 114, 101, 97, 100, 46, 10, 32, 32, 32, 
+    32, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 19, 0, 0, 0, 0, 0, 0, 0, 95, 
+    108, 111, 99, 107, 95, 117, 110, 108, 111, 99, 
+    107, 95, 109, 111, 100, 117, 108, 101, 4, 0, 
+    0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 
+    0, 0, 0, 0, 95, 103, 101, 116, 95, 109, 
+    111, 100, 117, 108, 101, 95, 108, 111, 99, 107, 
+    14, 0, 0, 0, 0, 0, 0, 0, 95, 68, 
+    101, 97, 100, 108, 111, 99, 107, 69, 114, 114, 
+    111, 114, 7, 0, 0, 0, 0, 0, 0, 0, 
+    97, 99, 113, 117, 105, 114, 101, 7, 0, 0, 
+    0, 0, 0, 0, 0, 114, 101, 108, 101, 97, 
+    115, 101, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 
+    4, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
+    99, 107, 32, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 46, 77, 111, 100, 117, 108, 
+    101, 83, 112, 101, 99, 46, 104, 97, 115, 95, 
+    108, 111, 99, 97, 116, 105, 111, 110, 46, 52, 
+    48, 57, 58, 52, 0, 9, 0, 0, 0, 0, 
+    0, 0, 0, 33, 1, 0, 32, 2, 1, 74, 
+    2, 10, 1, 1, 0, 75, 1, 0, 32, 3, 
+    0, 43, 3, 0, 1, 30, 1, 0, 41, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 12, 
-    0, 0, 0, 0, 0, 0, 0, 104, 97, 115, 
-    95, 108, 111, 99, 97, 116, 105, 111, 110, 2, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    12, 0, 0, 0, 0, 0, 0, 0, 104, 97, 
+    115, 95, 108, 111, 99, 97, 116, 105, 111, 110, 
+    2, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 98, 111, 111, 108, 
+    13, 0, 0, 0, 0, 0, 0, 0, 95, 115, 
+    101, 116, 95, 102, 105, 108, 101, 97, 116, 116, 
+    114, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 98, 111, 111, 108, 13, 
-    0, 0, 0, 0, 0, 0, 0, 95, 115, 101, 
-    116, 95, 102, 105, 108, 101, 97, 116, 116, 114, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 101, 108, 102, 5, 0, 
-    0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 
-    101, 32, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
-    0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 46, 95, 108, 111, 97, 100, 46, 
-    55, 48, 48, 58, 48, 0, 45, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 33, 1, 0, 
-    32, 2, 0, 27, 3, 2, 4, 74, 3, 10, 
-    1, 1, 0, 75, 1, 0, 34, 2, 0, 2, 
-    74, 0, 10, 2, 0, 0, 39, 1, 0, 75, 
-    0, 0, 56, 1, 0, 0, 0, 17, 12, 0, 
-    0, 0, 34, 1, 0, 3, 74, 0, 53, 2, 
-    1, 39, 2, 0, 75, 0, 0, 79, 3, 2, 
-    22, 2, 1, 0, 0, 0, 52, 5, 17, 0, 
-    0, 0, 0, 30, 1, 1, 41, 1, 33, 2, 
-    1, 32, 1, 0, 74, 0, 74, 1, 10, 2, 
-    1, 0, 75, 1, 0, 39, 3, 0, 75, 0, 
-    0, 34, 4, 0, 3, 30, 1, 1, 74, 1, 
-    74, 1, 74, 1, 10, 4, 3, 0, 75, 1, 
-    33, 75, 1, 0, 75, 1, 25, 5, 41, 3, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 115, 101, 108, 102, 5, 
+    0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 
+    117, 101, 33, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
+    0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 46, 95, 108, 111, 97, 100, 
+    46, 55, 48, 48, 58, 48, 0, 38, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
+    0, 32, 2, 0, 27, 3, 2, 4, 74, 3, 
+    10, 1, 1, 0, 75, 1, 0, 34, 2, 0, 
+    2, 1, 32, 74, 0, 38, 2, 32, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 2, 191, 0, 0, 0, 0, 0, 0, 
-    0, 82, 101, 116, 117, 114, 110, 32, 97, 32, 
-    110, 101, 119, 32, 109, 111, 100, 117, 108, 101, 
-    32, 111, 98, 106, 101, 99, 116, 44, 32, 108, 
-    111, 97, 100, 101, 100, 32, 98, 121, 32, 116, 
-    104, 101, 32, 115, 112, 101, 99, 39, 115, 32, 
-    108, 111, 97, 100, 101, 114, 46, 10, 10, 32, 
-    32, 32, 32, 84, 104, 101, 32, 109, 111, 100, 
-    117, 108, 101, 32, 105, 115, 32, 110, 111, 116, 
-    32, 97, 100, 100, 101, 100, 32, 116, 111, 32, 
-    105, 116, 115, 32, 112, 97, 114, 101, 110, 116, 
-    46, 10, 10, 32, 32, 32, 32, 73, 102, 32, 
-    97, 32, 109, 111, 100, 117, 108, 101, 32, 105, 
-    115, 32, 97, 108, 114, 101, 97, 100, 121, 32, 
-    105, 110, 32, 115, 121, 115, 46, 109, 111, 100, 
-    117, 108, 101, 115, 44, 32, 116, 104, 97, 116, 
-    32, 101, 120, 105, 115, 116, 105, 110, 103, 32, 
-    109, 111, 100, 117, 108, 101, 32, 103, 101, 116, 
-    115, 10, 32, 32, 32, 32, 99, 108, 111, 98, 
-    98, 101, 114, 101, 100, 46, 10, 10, 32, 32, 
-    32, 32, 5, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 39, 1, 0, 75, 0, 0, 17, 12, 
+    0, 0, 0, 34, 1, 0, 3, 0, 0, 74, 
+    0, 53, 2, 1, 39, 2, 0, 75, 0, 0, 
+    79, 3, 2, 22, 2, 1, 0, 0, 0, 52, 
+    5, 17, 0, 0, 0, 0, 30, 1, 1, 41, 
+    1, 33, 2, 1, 32, 1, 0, 74, 0, 74, 
+    1, 10, 2, 1, 0, 75, 1, 0, 39, 3, 
+    0, 75, 0, 0, 34, 4, 0, 3, 1, 32, 
+    30, 1, 1, 38, 4, 32, 3, 0, 0, 0, 
+    0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 5, 41, 3, 2, 0, 0, 0, 
+    0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 
+    0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 
+    13, 0, 0, 0, 0, 0, 0, 0, 25, 0, 
+    0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 
+    0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 2, 191, 0, 0, 0, 0, 
+    0, 0, 0, 82, 101, 116, 117, 114, 110, 32, 
+    97, 32, 110, 101, 119, 32, 109, 111, 100, 117, 
+    108, 101, 32, 111, 98, 106, 101, 99, 116, 44, 
+    32, 108, 111, 97, 100, 101, 100, 32, 98, 121, 
+    32, 116, 104, 101, 32, 115, 112, 101, 99, 39, 
+    115, 32, 108, 111, 97, 100, 101, 114, 46, 10, 
+    10, 32, 32, 32, 32, 84, 104, 101, 32, 109, 
+    111, 100, 117, 108, 101, 32, 105, 115, 32, 110, 
+    111, 116, 32, 97, 100, 100, 101, 100, 32, 116, 
+    111, 32, 105, 116, 115, 32, 112, 97, 114, 101, 
+    110, 116, 46, 10, 10, 32, 32, 32, 32, 73, 
+    102, 32, 97, 32, 109, 111, 100, 117, 108, 101, 
+    32, 105, 115, 32, 97, 108, 114, 101, 97, 100, 
+    121, 32, 105, 110, 32, 115, 121, 115, 46, 109, 
+    111, 100, 117, 108, 101, 115, 44, 32, 116, 104, 
+    97, 116, 32, 101, 120, 105, 115, 116, 105, 110, 
+    103, 32, 109, 111, 100, 117, 108, 101, 32, 103, 
+    101, 116, 115, 10, 32, 32, 32, 32, 99, 108, 
+    111, 98, 98, 101, 114, 101, 100, 46, 10, 10, 
+    32, 32, 32, 32, 5, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
-    95, 108, 111, 97, 100, 5, 0, 0, 0, 0, 
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 
-    0, 95, 77, 111, 100, 117, 108, 101, 76, 111, 
-    99, 107, 77, 97, 110, 97, 103, 101, 114, 14, 
-    0, 0, 0, 0, 0, 0, 0, 95, 108, 111, 
-    97, 100, 95, 117, 110, 108, 111, 99, 107, 101, 
-    100, 9, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 101, 110, 116, 101, 114, 95, 95, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 101, 120, 
-    105, 116, 95, 95, 4, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 112, 101, 99, 32, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 43, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 46, 70, 114, 111, 
-    122, 101, 110, 73, 109, 112, 111, 114, 116, 101, 
-    114, 46, 101, 120, 101, 99, 95, 109, 111, 100, 
-    117, 108, 101, 46, 56, 51, 48, 58, 52, 0, 
-    47, 0, 0, 0, 0, 0, 0, 0, 32, 0, 
-    0, 27, 1, 0, 6, 27, 2, 1, 7, 45, 
-    1, 2, 33, 1, 0, 34, 2, 1, 4, 32, 
-    3, 1, 74, 3, 10, 2, 1, 0, 75, 1, 
-    0, 49, 1, 0, 3, 79, 2, 1, 19, 1, 
-    13, 0, 0, 0, 33, 2, 1, 30, 0, 0, 
-    34, 1, 0, 5, 32, 3, 1, 74, 3, 10, 
-    1, 1, 0, 75, 1, 0, 32, 4, 1, 74, 
-    0, 12, 2, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    4, 1, 0, 0, 0, 0, 0, 0, 0, 7, 
-    39, 1, 0, 75, 0, 0, 40, 1, 1, 33, 
-    2, 2, 33, 0, 0, 27, 1, 0, 8, 32, 
-    3, 1, 74, 1, 74, 3, 10, 2, 2, 0, 
-    75, 1, 0, 75, 1, 0, 45, 2, 0, 33, 
-    1, 3, 32, 2, 2, 32, 3, 0, 27, 4, 
-    3, 9, 74, 2, 74, 4, 10, 1, 2, 0, 
-    75, 1, 0, 75, 1, 0, 30, 3, 1, 41, 
-    3, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 2, 27, 0, 0, 0, 0, 0, 
-    0, 0, 123, 33, 114, 125, 32, 105, 115, 32, 
-    110, 111, 116, 32, 97, 32, 102, 114, 111, 122, 
-    101, 110, 32, 109, 111, 100, 117, 108, 101, 5, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 95, 108, 111, 97, 100, 5, 0, 0, 
+    0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 
+    0, 0, 0, 95, 77, 111, 100, 117, 108, 101, 
+    76, 111, 99, 107, 77, 97, 110, 97, 103, 101, 
+    114, 14, 0, 0, 0, 0, 0, 0, 0, 95, 
+    108, 111, 97, 100, 95, 117, 110, 108, 111, 99, 
+    107, 101, 100, 9, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 101, 110, 116, 101, 114, 95, 95, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    101, 120, 105, 116, 95, 95, 4, 0, 0, 0, 
+    0, 0, 0, 0, 110, 97, 109, 101, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 115, 112, 101, 99, 33, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
+    43, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 46, 70, 
+    114, 111, 122, 101, 110, 73, 109, 112, 111, 114, 
+    116, 101, 114, 46, 101, 120, 101, 99, 95, 109, 
+    111, 100, 117, 108, 101, 46, 56, 51, 48, 58, 
+    52, 0, 43, 0, 0, 0, 0, 0, 0, 0, 
+    32, 0, 0, 27, 1, 0, 6, 27, 2, 1, 
+    7, 45, 1, 2, 33, 1, 0, 34, 2, 1, 
+    4, 1, 32, 32, 3, 1, 38, 2, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 49, 1, 0, 3, 79, 2, 
+    1, 19, 1, 11, 0, 0, 0, 33, 2, 1, 
+    30, 0, 0, 34, 1, 0, 5, 1, 32, 32, 
+    3, 1, 38, 1, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    32, 4, 1, 74, 0, 12, 2, 1, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 4, 1, 0, 0, 0, 0, 
+    0, 0, 0, 7, 39, 1, 0, 75, 0, 0, 
+    40, 1, 1, 33, 2, 2, 33, 0, 0, 27, 
+    1, 0, 8, 32, 3, 1, 74, 1, 74, 3, 
+    10, 2, 2, 0, 75, 1, 0, 75, 1, 0, 
+    45, 2, 0, 33, 1, 3, 32, 2, 2, 32, 
+    3, 0, 27, 4, 3, 9, 74, 2, 74, 4, 
+    10, 1, 2, 0, 75, 1, 0, 75, 1, 0, 
+    30, 3, 1, 41, 3, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 10, 0, 0, 0, 0, 0, 0, 0, 11, 
-    0, 0, 0, 0, 0, 0, 0, 101, 120, 101, 
-    99, 95, 109, 111, 100, 117, 108, 101, 10, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 95, 105, 109, 112, 11, 0, 
-    0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 
-    114, 116, 69, 114, 114, 111, 114, 25, 0, 0, 
-    0, 0, 0, 0, 0, 95, 99, 97, 108, 108, 
-    95, 119, 105, 116, 104, 95, 102, 114, 97, 109, 
-    101, 115, 95, 114, 101, 109, 111, 118, 101, 100, 
-    4, 0, 0, 0, 0, 0, 0, 0, 101, 120, 
-    101, 99, 9, 0, 0, 0, 0, 0, 0, 0, 
-    105, 115, 95, 102, 114, 111, 122, 101, 110, 6, 
-    0, 0, 0, 0, 0, 0, 0, 102, 111, 114, 
-    109, 97, 116, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 115, 112, 101, 99, 95, 95, 4, 
-    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
-    101, 17, 0, 0, 0, 0, 0, 0, 0, 103, 
-    101, 116, 95, 102, 114, 111, 122, 101, 110, 95, 
-    111, 98, 106, 101, 99, 116, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 100, 105, 99, 116, 
-    95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
-    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
-    108, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
-    110, 97, 109, 101, 4, 0, 0, 0, 0, 0, 
-    0, 0, 99, 111, 100, 101, 32, 0, 0, 0, 
-    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 
-    40, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 46, 95, 
-    102, 105, 110, 100, 95, 97, 110, 100, 95, 108, 
-    111, 97, 100, 95, 117, 110, 108, 111, 99, 107, 
-    101, 100, 46, 57, 54, 54, 58, 48, 0, 173, 
-    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
-    45, 2, 0, 32, 2, 0, 34, 1, 2, 10, 
-    30, 3, 1, 74, 3, 10, 1, 1, 0, 75, 
-    1, 0, 30, 2, 2, 1, 1, 0, 2, 45, 
-    3, 1, 32, 0, 3, 79, 1, 0, 19, 0, 
-    55, 0, 0, 0, 32, 1, 3, 33, 0, 0, 
-    27, 2, 0, 13, 6, 3, 1, 2, 9, 79, 
-    0, 3, 19, 3, 9, 0, 0, 0, 33, 1, 
-    1, 32, 2, 1, 32, 3, 3, 74, 2, 74, 
-    3, 10, 1, 2, 0, 75, 1, 0, 75, 1, 
-    0, 17, 0, 0, 0, 0, 32, 0, 0, 33, 
-    1, 0, 27, 2, 1, 13, 6, 3, 0, 2, 
-    8, 79, 1, 3, 22, 3, 133, 0, 0, 0, 
-    33, 0, 0, 27, 1, 0, 13, 32, 2, 3, 
-    1, 0, 1, 2, 45, 4, 0, 42, 1, 0, 
-    0, 0, 17, 21, 0, 0, 0, 33, 0, 2, 
-    21, 0, 18, 0, 0, 0, 33, 1, 3, 30, 
-    0, 3, 0, 2, 1, 0, 0, 34, 3, 2, 
-    11, 32, 1, 0, 32, 2, 3, 74, 1, 74, 
-    2, 10, 3, 2, 0, 75, 1, 189, 75, 1, 
-    186, 45, 5, 0, 33, 1, 4, 32, 2, 5, 
-    32, 3, 0, 12, 1, 1, 0, 0, 0, 0, 
-    0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 
-    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 
-    0, 14, 30, 4, 0, 40, 2, 0, 4, 52, 
-    32, 0, 4, 27, 1, 0, 15, 45, 2, 1, 
-    54, 17, 0, 0, 0, 0, 17, 0, 0, 0, 
-    0, 33, 1, 5, 32, 2, 0, 32, 3, 2, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 2, 27, 0, 0, 0, 
+    0, 0, 0, 0, 123, 33, 114, 125, 32, 105, 
+    115, 32, 110, 111, 116, 32, 97, 32, 102, 114, 
+    111, 122, 101, 110, 32, 109, 111, 100, 117, 108, 
+    101, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 101, 
+    120, 101, 99, 95, 109, 111, 100, 117, 108, 101, 
+    10, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 95, 105, 109, 112, 
+    11, 0, 0, 0, 0, 0, 0, 0, 73, 109, 
+    112, 111, 114, 116, 69, 114, 114, 111, 114, 25, 
+    0, 0, 0, 0, 0, 0, 0, 95, 99, 97, 
+    108, 108, 95, 119, 105, 116, 104, 95, 102, 114, 
+    97, 109, 101, 115, 95, 114, 101, 109, 111, 118, 
+    101, 100, 4, 0, 0, 0, 0, 0, 0, 0, 
+    101, 120, 101, 99, 9, 0, 0, 0, 0, 0, 
+    0, 0, 105, 115, 95, 102, 114, 111, 122, 101, 
+    110, 6, 0, 0, 0, 0, 0, 0, 0, 102, 
+    111, 114, 109, 97, 116, 8, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 115, 112, 101, 99, 95, 
+    95, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
+    97, 109, 101, 17, 0, 0, 0, 0, 0, 0, 
+    0, 103, 101, 116, 95, 102, 114, 111, 122, 101, 
+    110, 95, 111, 98, 106, 101, 99, 116, 8, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 100, 105, 
+    99, 116, 95, 95, 0, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    6, 0, 0, 0, 0, 0, 0, 0, 109, 111, 
+    100, 117, 108, 101, 4, 0, 0, 0, 0, 0, 
+    0, 0, 110, 97, 109, 101, 4, 0, 0, 0, 
+    0, 0, 0, 0, 99, 111, 100, 101, 33, 0, 
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 
+    0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 
+    0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    46, 95, 102, 105, 110, 100, 95, 97, 110, 100, 
+    95, 108, 111, 97, 100, 95, 117, 110, 108, 111, 
+    99, 107, 101, 100, 46, 57, 54, 54, 58, 48, 
+    0, 155, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 45, 2, 0, 32, 2, 0, 34, 1, 
+    2, 10, 1, 32, 30, 3, 1, 38, 1, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 30, 2, 2, 1, 1, 
+    0, 2, 45, 3, 1, 32, 0, 3, 79, 1, 
+    0, 19, 0, 49, 0, 0, 0, 32, 1, 3, 
+    33, 0, 0, 27, 2, 0, 13, 6, 3, 1, 
+    2, 9, 79, 0, 3, 19, 3, 9, 0, 0, 
+    0, 33, 1, 1, 32, 2, 1, 32, 3, 3, 
     74, 2, 74, 3, 10, 1, 2, 0, 75, 1, 
-    189, 75, 1, 185, 45, 6, 0, 32, 1, 6, 
-    30, 0, 0, 6, 2, 1, 0, 6, 79, 3, 
-    2, 22, 2, 70, 0, 0, 0, 33, 1, 6, 
-    32, 2, 6, 74, 2, 10, 1, 1, 0, 75, 
-    1, 189, 45, 7, 0, 17, 0, 0, 0, 0, 
-    32, 0, 3, 79, 1, 0, 19, 0, 73, 0, 
-    0, 0, 33, 1, 0, 27, 0, 1, 13, 32, 
-    2, 3, 1, 1, 0, 2, 45, 4, 1, 32, 
-    0, 0, 34, 1, 0, 10, 30, 2, 1, 74, 
-    2, 10, 1, 1, 0, 75, 1, 231, 30, 3, 
-    4, 1, 1, 0, 3, 45, 8, 1, 42, 1, 
-    0, 0, 0, 17, 30, 0, 0, 0, 33, 0, 
-    2, 21, 0, 27, 0, 0, 0, 30, 1, 5, 
+    0, 75, 1, 0, 17, 0, 0, 0, 0, 32, 
+    0, 0, 33, 1, 0, 27, 2, 1, 13, 6, 
+    3, 0, 2, 8, 79, 1, 3, 22, 3, 117, 
+    0, 0, 0, 33, 0, 0, 27, 1, 0, 13, 
+    32, 2, 3, 1, 0, 1, 2, 45, 4, 0, 
+    17, 17, 0, 0, 0, 33, 0, 2, 21, 0, 
+    14, 0, 0, 0, 33, 1, 3, 30, 0, 3, 
+    0, 2, 1, 0, 0, 34, 3, 2, 11, 1, 
+    32, 32, 1, 0, 32, 2, 3, 38, 3, 32, 
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 45, 5, 0, 33, 
+    1, 4, 32, 2, 5, 32, 3, 0, 12, 1, 
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 
+    0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 
+    0, 0, 0, 0, 0, 0, 14, 30, 4, 0, 
+    40, 2, 0, 4, 52, 32, 0, 4, 27, 1, 
+    0, 15, 45, 2, 1, 17, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 33, 1, 5, 32, 2, 
+    0, 32, 3, 2, 74, 2, 74, 3, 10, 1, 
+    2, 0, 75, 1, 189, 75, 1, 185, 45, 6, 
+    0, 32, 1, 6, 30, 0, 0, 6, 2, 1, 
+    0, 6, 79, 3, 2, 22, 2, 62, 0, 0, 
+    0, 33, 1, 6, 32, 2, 6, 74, 2, 10, 
+    1, 1, 0, 75, 1, 189, 45, 7, 0, 17, 
+    0, 0, 0, 0, 32, 0, 3, 79, 1, 0, 
+    19, 0, 63, 0, 0, 0, 33, 1, 0, 27, 
+    0, 1, 13, 32, 2, 3, 1, 1, 0, 2, 
+    45, 4, 1, 32, 0, 0, 34, 1, 0, 10, 
+    1, 32, 30, 2, 1, 38, 1, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 30, 3, 4, 1, 1, 0, 3, 
+    45, 8, 1, 17, 26, 0, 0, 0, 33, 0, 
+    2, 21, 0, 23, 0, 0, 0, 30, 1, 5, 
     32, 0, 3, 73, 2, 0, 1, 30, 3, 6, 
     32, 0, 8, 73, 4, 0, 1, 74, 1, 74, 
     2, 74, 3, 74, 4, 72, 5, 4, 75, 1, 
     0, 75, 1, 166, 75, 1, 189, 75, 1, 0, 
     45, 5, 5, 33, 1, 8, 34, 2, 1, 12, 
-    32, 3, 5, 33, 1, 9, 74, 3, 74, 1, 
-    10, 2, 2, 0, 75, 1, 188, 75, 1, 189, 
-    5, 17, 14, 0, 0, 0, 52, 33, 1, 7, 
-    32, 2, 4, 32, 3, 8, 32, 4, 7, 74, 
-    2, 74, 3, 74, 4, 10, 1, 3, 0, 75, 
-    1, 189, 75, 1, 145, 75, 1, 188, 54, 17, 
-    0, 0, 0, 0, 17, 13, 0, 0, 0, 33, 
-    1, 4, 33, 0, 3, 34, 2, 0, 11, 32, 
-    3, 0, 74, 3, 10, 2, 1, 0, 75, 1, 
-    189, 32, 4, 0, 74, 0, 12, 1, 1, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 
-    0, 0, 0, 0, 14, 39, 2, 0, 75, 0, 
-    0, 40, 1, 2, 32, 0, 7, 41, 0, 33, 
-    1, 0, 27, 0, 1, 13, 32, 2, 0, 1, 
-    1, 0, 2, 41, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 
-    0, 0, 0, 0, 0, 0, 0, 5, 2, 1, 
-    0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 23, 0, 
-    0, 0, 0, 0, 0, 0, 59, 32, 123, 33, 
-    114, 125, 32, 105, 115, 32, 110, 111, 116, 32, 
-    97, 32, 112, 97, 99, 107, 97, 103, 101, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 27, 
-    0, 0, 0, 0, 0, 0, 0, 67, 97, 110, 
-    110, 111, 116, 32, 115, 101, 116, 32, 97, 110, 
-    32, 97, 116, 116, 114, 105, 98, 117, 116, 101, 
-    32, 111, 110, 32, 2, 18, 0, 0, 0, 0, 
-    0, 0, 0, 32, 102, 111, 114, 32, 99, 104, 
-    105, 108, 100, 32, 109, 111, 100, 117, 108, 101, 
-    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 32, 32, 3, 5, 33, 1, 9, 38, 2, 
+    32, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 5, 17, 13, 
+    0, 0, 0, 52, 33, 1, 7, 32, 2, 4, 
+    32, 3, 8, 32, 4, 7, 74, 2, 74, 3, 
+    74, 4, 10, 1, 3, 0, 75, 1, 189, 75, 
+    1, 145, 75, 1, 188, 17, 0, 0, 0, 0, 
+    17, 11, 0, 0, 0, 33, 1, 4, 33, 0, 
+    3, 34, 2, 0, 11, 1, 32, 32, 3, 0, 
+    38, 2, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 32, 4, 
+    0, 74, 0, 12, 1, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 4, 1, 0, 0, 0, 0, 0, 0, 
+    0, 14, 39, 2, 0, 75, 0, 0, 40, 1, 
+    2, 32, 0, 7, 41, 0, 33, 1, 0, 27, 
+    0, 1, 13, 32, 2, 0, 1, 1, 0, 2, 
+    41, 1, 4, 0, 0, 0, 0, 0, 0, 0, 
+    38, 0, 0, 0, 0, 0, 0, 0, 39, 0, 
+    0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 
+    0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 
+    0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 
+    39, 0, 0, 0, 0, 0, 0, 0, 97, 0, 
+    0, 0, 0, 0, 0, 0, 98, 0, 0, 0, 
+    0, 0, 0, 0, 98, 0, 0, 0, 0, 0, 
+    0, 0, 124, 0, 0, 0, 0, 0, 0, 0, 
+    135, 0, 0, 0, 0, 0, 0, 0, 98, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 
-    23, 0, 0, 0, 0, 0, 0, 0, 95, 102, 
-    105, 110, 100, 95, 97, 110, 100, 95, 108, 111, 
-    97, 100, 95, 117, 110, 108, 111, 99, 107, 101, 
-    100, 16, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 115, 121, 115, 
-    25, 0, 0, 0, 0, 0, 0, 0, 95, 99, 
-    97, 108, 108, 95, 119, 105, 116, 104, 95, 102, 
-    114, 97, 109, 101, 115, 95, 114, 101, 109, 111, 
-    118, 101, 100, 14, 0, 0, 0, 0, 0, 0, 
-    0, 65, 116, 116, 114, 105, 98, 117, 116, 101, 
-    69, 114, 114, 111, 114, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 69, 82, 82, 95, 77, 83, 
-    71, 19, 0, 0, 0, 0, 0, 0, 0, 77, 
-    111, 100, 117, 108, 101, 78, 111, 116, 70, 111, 
-    117, 110, 100, 69, 114, 114, 111, 114, 10, 0, 
-    0, 0, 0, 0, 0, 0, 95, 102, 105, 110, 
-    100, 95, 115, 112, 101, 99, 14, 0, 0, 0, 
-    0, 0, 0, 0, 95, 108, 111, 97, 100, 95, 
-    117, 110, 108, 111, 99, 107, 101, 100, 7, 0, 
-    0, 0, 0, 0, 0, 0, 115, 101, 116, 97, 
-    116, 116, 114, 9, 0, 0, 0, 0, 0, 0, 
-    0, 95, 119, 97, 114, 110, 105, 110, 103, 115, 
-    13, 0, 0, 0, 0, 0, 0, 0, 73, 109, 
-    112, 111, 114, 116, 87, 97, 114, 110, 105, 110, 
-    103, 10, 0, 0, 0, 0, 0, 0, 0, 114, 
-    112, 97, 114, 116, 105, 116, 105, 111, 110, 6, 
-    0, 0, 0, 0, 0, 0, 0, 102, 111, 114, 
-    109, 97, 116, 4, 0, 0, 0, 0, 0, 0, 
-    0, 119, 97, 114, 110, 7, 0, 0, 0, 0, 
-    0, 0, 0, 109, 111, 100, 117, 108, 101, 115, 
-    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
-    109, 101, 8, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 112, 97, 116, 104, 95, 95, 0, 0, 
-    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 7, 0, 0, 0, 
-    0, 0, 0, 0, 105, 109, 112, 111, 114, 116, 
-    95, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
-    97, 116, 104, 6, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 114, 101, 110, 116, 13, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 114, 101, 110, 
-    116, 95, 109, 111, 100, 117, 108, 101, 3, 0, 
-    0, 0, 0, 0, 0, 0, 109, 115, 103, 4, 
-    0, 0, 0, 0, 0, 0, 0, 115, 112, 101, 
-    99, 6, 0, 0, 0, 0, 0, 0, 0, 109, 
-    111, 100, 117, 108, 101, 5, 0, 0, 0, 0, 
-    0, 0, 0, 99, 104, 105, 108, 100, 32, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
     0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    46, 70, 114, 111, 122, 101, 110, 73, 109, 112, 
-    111, 114, 116, 101, 114, 46, 103, 101, 116, 95, 
-    115, 111, 117, 114, 99, 101, 46, 56, 53, 52, 
-    58, 52, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 30, 1, 1, 41, 1, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 2, 54, 0, 0, 0, 0, 0, 0, 0, 
-    82, 101, 116, 117, 114, 110, 32, 78, 111, 110, 
-    101, 32, 97, 115, 32, 102, 114, 111, 122, 101, 
-    110, 32, 109, 111, 100, 117, 108, 101, 115, 32, 
-    100, 111, 32, 110, 111, 116, 32, 104, 97, 118, 
-    101, 32, 115, 111, 117, 114, 99, 101, 32, 99, 
-    111, 100, 101, 46, 5, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    7, 0, 0, 0, 0, 0, 0, 0, 5, 2, 
+    1, 0, 0, 0, 0, 0, 0, 0, 46, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 23, 
+    0, 0, 0, 0, 0, 0, 0, 59, 32, 123, 
+    33, 114, 125, 32, 105, 115, 32, 110, 111, 116, 
+    32, 97, 32, 112, 97, 99, 107, 97, 103, 101, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    27, 0, 0, 0, 0, 0, 0, 0, 67, 97, 
+    110, 110, 111, 116, 32, 115, 101, 116, 32, 97, 
+    110, 32, 97, 116, 116, 114, 105, 98, 117, 116, 
+    101, 32, 111, 110, 32, 2, 18, 0, 0, 0, 
+    0, 0, 0, 0, 32, 102, 111, 114, 32, 99, 
+    104, 105, 108, 100, 32, 109, 111, 100, 117, 108, 
+    101, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 
+    0, 23, 0, 0, 0, 0, 0, 0, 0, 95, 
+    102, 105, 110, 100, 95, 97, 110, 100, 95, 108, 
+    111, 97, 100, 95, 117, 110, 108, 111, 99, 107, 
+    101, 100, 16, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 115, 121, 
+    115, 25, 0, 0, 0, 0, 0, 0, 0, 95, 
+    99, 97, 108, 108, 95, 119, 105, 116, 104, 95, 
+    102, 114, 97, 109, 101, 115, 95, 114, 101, 109, 
+    111, 118, 101, 100, 14, 0, 0, 0, 0, 0, 
+    0, 0, 65, 116, 116, 114, 105, 98, 117, 116, 
+    101, 69, 114, 114, 111, 114, 8, 0, 0, 0, 
+    0, 0, 0, 0, 95, 69, 82, 82, 95, 77, 
+    83, 71, 19, 0, 0, 0, 0, 0, 0, 0, 
+    77, 111, 100, 117, 108, 101, 78, 111, 116, 70, 
+    111, 117, 110, 100, 69, 114, 114, 111, 114, 10, 
+    0, 0, 0, 0, 0, 0, 0, 95, 102, 105, 
+    110, 100, 95, 115, 112, 101, 99, 14, 0, 0, 
+    0, 0, 0, 0, 0, 95, 108, 111, 97, 100, 
+    95, 117, 110, 108, 111, 99, 107, 101, 100, 7, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 
+    97, 116, 116, 114, 9, 0, 0, 0, 0, 0, 
+    0, 0, 95, 119, 97, 114, 110, 105, 110, 103, 
+    115, 13, 0, 0, 0, 0, 0, 0, 0, 73, 
+    109, 112, 111, 114, 116, 87, 97, 114, 110, 105, 
+    110, 103, 10, 0, 0, 0, 0, 0, 0, 0, 
+    114, 112, 97, 114, 116, 105, 116, 105, 111, 110, 
+    6, 0, 0, 0, 0, 0, 0, 0, 102, 111, 
+    114, 109, 97, 116, 4, 0, 0, 0, 0, 0, 
+    0, 0, 119, 97, 114, 110, 7, 0, 0, 0, 
+    0, 0, 0, 0, 109, 111, 100, 117, 108, 101, 
+    115, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
+    97, 109, 101, 8, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 112, 97, 116, 104, 95, 95, 0, 
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 110, 97, 109, 101, 7, 0, 0, 
+    0, 0, 0, 0, 0, 105, 109, 112, 111, 114, 
+    116, 95, 4, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 6, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 114, 101, 110, 116, 13, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 114, 101, 
+    110, 116, 95, 109, 111, 100, 117, 108, 101, 3, 
+    0, 0, 0, 0, 0, 0, 0, 109, 115, 103, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 112, 
+    101, 99, 6, 0, 0, 0, 0, 0, 0, 0, 
+    109, 111, 100, 117, 108, 101, 5, 0, 0, 0, 
+    0, 0, 0, 0, 99, 104, 105, 108, 100, 32, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 42, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 46, 70, 114, 111, 122, 101, 110, 73, 109, 
+    112, 111, 114, 116, 101, 114, 46, 103, 101, 116, 
+    95, 115, 111, 117, 114, 99, 101, 46, 56, 53, 
+    52, 58, 52, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 30, 1, 1, 41, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
-    0, 0, 103, 101, 116, 95, 115, 111, 117, 114, 
-    99, 101, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 99, 108, 115, 8, 0, 0, 
-    0, 0, 0, 0, 0, 102, 117, 108, 108, 110, 
-    97, 109, 101, 32, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 46, 70, 114, 111, 122, 
-    101, 110, 73, 109, 112, 111, 114, 116, 101, 114, 
-    46, 105, 115, 95, 112, 97, 99, 107, 97, 103, 
-    101, 46, 56, 54, 48, 58, 52, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 30, 0, 0, 33, 
-    1, 0, 34, 2, 1, 1, 32, 3, 1, 74, 
-    3, 10, 2, 1, 0, 75, 1, 0, 41, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 2, 46, 0, 0, 0, 0, 0, 0, 
-    0, 82, 101, 116, 117, 114, 110, 32, 84, 114, 
-    117, 101, 32, 105, 102, 32, 116, 104, 101, 32, 
-    102, 114, 111, 122, 101, 110, 32, 109, 111, 100, 
-    117, 108, 101, 32, 105, 115, 32, 97, 32, 112, 
-    97, 99, 107, 97, 103, 101, 46, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 54, 0, 0, 0, 0, 0, 0, 0, 82, 
+    101, 116, 117, 114, 110, 32, 78, 111, 110, 101, 
+    32, 97, 115, 32, 102, 114, 111, 122, 101, 110, 
+    32, 109, 111, 100, 117, 108, 101, 115, 32, 100, 
+    111, 32, 110, 111, 116, 32, 104, 97, 118, 101, 
+    32, 115, 111, 117, 114, 99, 101, 32, 99, 111, 
+    100, 101, 46, 5, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
-    0, 0, 0, 0, 105, 115, 95, 112, 97, 99, 
-    107, 97, 103, 101, 2, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    95, 105, 109, 112, 17, 0, 0, 0, 0, 0, 
-    0, 0, 105, 115, 95, 102, 114, 111, 122, 101, 
-    110, 95, 112, 97, 99, 107, 97, 103, 101, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
+    0, 103, 101, 116, 95, 115, 111, 117, 114, 99, 
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
     0, 0, 0, 99, 108, 115, 8, 0, 0, 0, 
     0, 0, 0, 0, 102, 117, 108, 108, 110, 97, 
-    109, 101, 
+    109, 101, 33, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 46, 70, 114, 111, 122, 101, 
+    110, 73, 109, 112, 111, 114, 116, 101, 114, 46, 
+    105, 115, 95, 112, 97, 99, 107, 97, 103, 101, 
+    46, 56, 54, 48, 58, 52, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
+    0, 34, 2, 1, 1, 1, 32, 32, 3, 1, 
+    38, 2, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    2, 46, 0, 0, 0, 0, 0, 0, 0, 82, 
+    101, 116, 117, 114, 110, 32, 84, 114, 117, 101, 
+    32, 105, 102, 32, 116, 104, 101, 32, 102, 114, 
+    111, 122, 101, 110, 32, 109, 111, 100, 117, 108, 
+    101, 32, 105, 115, 32, 97, 32, 112, 97, 99, 
+    107, 97, 103, 101, 46, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 105, 115, 95, 112, 97, 99, 107, 97, 
+    103, 101, 2, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 95, 105, 
+    109, 112, 17, 0, 0, 0, 0, 0, 0, 0, 
+    105, 115, 95, 102, 114, 111, 122, 101, 110, 95, 
+    112, 97, 99, 107, 97, 103, 101, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 99, 108, 115, 8, 0, 0, 0, 0, 0, 
+    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
+    
 };
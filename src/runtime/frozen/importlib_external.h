@@ -1,10 +1,10 @@
 std::vector<uint8_t> _bootstrap_external
 {
-    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
     0, 0, 95, 95, 109, 97, 105, 110, 95, 95, 
-    0, 186, 1, 0, 0, 0, 0, 0, 0, 30, 
+    0, 176, 1, 0, 0, 0, 0, 0, 0, 30, 
     0, 0, 30, 1, 1, 4, 0, 0, 14, 2, 
     3, 0, 1, 47, 2, 4, 0, 0, 0, 0, 
     0, 0, 0, 95, 105, 109, 112, 30, 0, 1, 
@@ -18,353 +18,305 @@ std::vector<uint8_t> _bootstrap_external
     110, 105, 110, 103, 115, 30, 0, 1, 4, 1, 
     0, 14, 2, 7, 1, 0, 47, 2, 7, 0, 
     0, 0, 0, 0, 0, 0, 109, 97, 114, 115, 
-    104, 97, 108, 35, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 115, 121, 115, 27, 1, 0, 8, 
+    104, 97, 108, 35, 0, 5, 27, 1, 0, 8, 
     30, 2, 2, 6, 0, 1, 2, 0, 47, 0, 
     11, 0, 0, 0, 0, 0, 0, 0, 95, 77, 
     83, 95, 87, 73, 78, 68, 79, 87, 83, 35, 
-    1, 11, 0, 0, 0, 0, 0, 0, 0, 95, 
-    77, 83, 95, 87, 73, 78, 68, 79, 87, 83, 
-    79, 0, 1, 22, 1, 5, 0, 0, 0, 30, 
-    0, 1, 4, 1, 0, 14, 2, 9, 1, 0, 
-    47, 2, 3, 0, 0, 0, 0, 0, 0, 0, 
-    95, 111, 115, 17, 9, 0, 0, 0, 30, 0, 
-    1, 4, 1, 0, 14, 2, 10, 1, 0, 47, 
-    2, 3, 0, 0, 0, 0, 0, 0, 0, 95, 
-    111, 115, 30, 0, 1, 4, 1, 0, 14, 2, 
-    11, 1, 0, 47, 2, 6, 0, 0, 0, 0, 
-    0, 0, 0, 119, 105, 110, 114, 101, 103, 17, 
-    0, 0, 0, 0, 35, 0, 11, 0, 0, 0, 
-    0, 0, 0, 0, 95, 77, 83, 95, 87, 73, 
-    78, 68, 79, 87, 83, 79, 1, 0, 22, 0, 
-    6, 0, 0, 0, 30, 1, 3, 74, 1, 3, 
-    0, 1, 75, 1, 0, 47, 0, 15, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 95, 
-    115, 101, 112, 97, 114, 97, 116, 111, 114, 115, 
-    17, 9, 0, 0, 0, 30, 0, 4, 30, 1, 
-    3, 74, 0, 74, 1, 3, 2, 2, 75, 1, 
-    0, 75, 1, 0, 47, 2, 15, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 95, 115, 
-    101, 112, 97, 114, 97, 116, 111, 114, 115, 17, 
-    0, 0, 0, 0, 35, 1, 3, 0, 0, 0, 
-    0, 0, 0, 0, 97, 108, 108, 30, 0, 5, 
-    36, 2, 0, 0, 0, 0, 0, 35, 3, 15, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
-    104, 95, 115, 101, 112, 97, 114, 97, 116, 111, 
-    114, 115, 74, 3, 10, 2, 1, 0, 75, 1, 
-    0, 74, 0, 74, 0, 10, 1, 1, 0, 75, 
-    1, 0, 39, 4, 0, 75, 0, 0, 79, 2, 
-    4, 22, 4, 3, 0, 0, 0, 26, 1, 10, 
-    1, 0, 0, 40, 1, 0, 35, 1, 15, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    95, 115, 101, 112, 97, 114, 97, 116, 111, 114, 
-    115, 30, 0, 1, 1, 2, 1, 0, 47, 2, 
+    1, 13, 79, 0, 1, 22, 1, 5, 0, 0, 
+    0, 30, 0, 1, 4, 1, 0, 14, 2, 9, 
+    1, 0, 47, 2, 3, 0, 0, 0, 0, 0, 
+    0, 0, 95, 111, 115, 17, 9, 0, 0, 0, 
+    30, 0, 1, 4, 1, 0, 14, 2, 10, 1, 
+    0, 47, 2, 3, 0, 0, 0, 0, 0, 0, 
+    0, 95, 111, 115, 30, 0, 1, 4, 1, 0, 
+    14, 2, 11, 1, 0, 47, 2, 6, 0, 0, 
+    0, 0, 0, 0, 0, 119, 105, 110, 114, 101, 
+    103, 17, 0, 0, 0, 0, 35, 0, 13, 79, 
+    1, 0, 22, 0, 6, 0, 0, 0, 30, 1, 
+    3, 74, 1, 3, 0, 1, 75, 1, 0, 47, 
+    0, 15, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 95, 115, 101, 112, 97, 114, 97, 
+    116, 111, 114, 115, 17, 9, 0, 0, 0, 30, 
+    0, 4, 30, 1, 3, 74, 0, 74, 1, 3, 
+    2, 2, 75, 1, 0, 75, 1, 0, 47, 2, 
+    15, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    116, 104, 95, 115, 101, 112, 97, 114, 97, 116, 
+    111, 114, 115, 17, 0, 0, 0, 0, 35, 1, 
+    14, 30, 0, 5, 36, 2, 0, 0, 0, 0, 
+    0, 35, 3, 15, 74, 3, 10, 2, 1, 0, 
+    75, 1, 0, 74, 0, 74, 0, 10, 1, 1, 
+    0, 75, 1, 0, 39, 4, 0, 75, 0, 0, 
+    79, 2, 4, 22, 4, 3, 0, 0, 0, 26, 
+    1, 10, 1, 0, 0, 40, 1, 0, 35, 1, 
+    15, 30, 0, 1, 1, 2, 1, 0, 47, 2, 
     8, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 95, 115, 101, 112, 35, 1, 5, 0, 
-    0, 0, 0, 0, 0, 0, 116, 117, 112, 108, 
-    101, 35, 2, 15, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 95, 115, 101, 112, 97, 
-    114, 97, 116, 111, 114, 115, 74, 2, 10, 1, 
-    1, 0, 75, 1, 0, 47, 0, 14, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 95, 
-    115, 101, 112, 95, 116, 117, 112, 108, 101, 30, 
-    1, 6, 34, 2, 1, 0, 35, 3, 15, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    95, 115, 101, 112, 97, 114, 97, 116, 111, 114, 
-    115, 74, 3, 10, 2, 1, 0, 75, 1, 0, 
-    47, 0, 15, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 95, 115, 101, 112, 97, 114, 
-    97, 116, 111, 114, 115, 30, 2, 7, 36, 1, 
-    2, 0, 0, 0, 0, 35, 3, 15, 0, 0, 
+    116, 104, 95, 115, 101, 112, 35, 1, 16, 35, 
+    2, 15, 74, 2, 10, 1, 1, 0, 75, 1, 
+    0, 47, 0, 14, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 116, 104, 95, 115, 101, 112, 95, 
+    116, 117, 112, 108, 101, 30, 1, 6, 34, 2, 
+    1, 0, 1, 32, 35, 3, 15, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 47, 0, 15, 0, 0, 
     0, 0, 0, 0, 0, 112, 97, 116, 104, 95, 
     115, 101, 112, 97, 114, 97, 116, 111, 114, 115, 
-    74, 3, 10, 1, 1, 0, 75, 1, 0, 47, 
-    0, 20, 0, 0, 0, 0, 0, 0, 0, 95, 
-    112, 97, 116, 104, 115, 101, 112, 115, 95, 119, 
-    105, 116, 104, 95, 99, 111, 108, 111, 110, 30, 
-    1, 8, 74, 1, 4, 0, 1, 75, 1, 0, 
-    47, 0, 35, 0, 0, 0, 0, 0, 0, 0, 
-    95, 67, 65, 83, 69, 95, 73, 78, 83, 69, 
-    78, 83, 73, 84, 73, 86, 69, 95, 80, 76, 
-    65, 84, 70, 79, 82, 77, 83, 95, 83, 84, 
-    82, 95, 75, 69, 89, 30, 1, 9, 30, 0, 
-    10, 74, 1, 74, 0, 4, 2, 2, 75, 1, 
-    0, 75, 1, 0, 47, 2, 37, 0, 0, 0, 
-    0, 0, 0, 0, 95, 67, 65, 83, 69, 95, 
-    73, 78, 83, 69, 78, 83, 73, 84, 73, 86, 
-    69, 95, 80, 76, 65, 84, 70, 79, 82, 77, 
-    83, 95, 66, 89, 84, 69, 83, 95, 75, 69, 
-    89, 35, 0, 37, 0, 0, 0, 0, 0, 0, 
-    0, 95, 67, 65, 83, 69, 95, 73, 78, 83, 
-    69, 78, 83, 73, 84, 73, 86, 69, 95, 80, 
-    76, 65, 84, 70, 79, 82, 77, 83, 95, 66, 
-    89, 84, 69, 83, 95, 75, 69, 89, 35, 1, 
-    35, 0, 0, 0, 0, 0, 0, 0, 95, 67, 
-    65, 83, 69, 95, 73, 78, 83, 69, 78, 83, 
-    73, 84, 73, 86, 69, 95, 80, 76, 65, 84, 
-    70, 79, 82, 77, 83, 95, 83, 84, 82, 95, 
-    75, 69, 89, 0, 2, 0, 1, 0, 47, 2, 
-    27, 0, 0, 0, 0, 0, 0, 0, 95, 67, 
-    65, 83, 69, 95, 73, 78, 83, 69, 78, 83, 
-    73, 84, 73, 86, 69, 95, 80, 76, 65, 84, 
-    70, 79, 82, 77, 83, 30, 0, 11, 36, 1, 
-    0, 0, 0, 0, 0, 47, 1, 16, 0, 0, 
-    0, 0, 0, 0, 0, 95, 109, 97, 107, 101, 
-    95, 114, 101, 108, 97, 120, 95, 99, 97, 115, 
-    101, 30, 0, 12, 36, 1, 0, 0, 0, 0, 
-    0, 47, 1, 12, 0, 0, 0, 0, 0, 0, 
-    0, 95, 112, 97, 99, 107, 95, 117, 105, 110, 
-    116, 51, 50, 30, 0, 13, 36, 1, 0, 0, 
-    0, 0, 0, 47, 1, 14, 0, 0, 0, 0, 
-    0, 0, 0, 95, 117, 110, 112, 97, 99, 107, 
-    95, 117, 105, 110, 116, 51, 50, 30, 0, 14, 
-    36, 1, 0, 0, 0, 0, 0, 47, 1, 14, 
-    0, 0, 0, 0, 0, 0, 0, 95, 117, 110, 
-    112, 97, 99, 107, 95, 117, 105, 110, 116, 49, 
-    54, 35, 0, 11, 0, 0, 0, 0, 0, 0, 
-    0, 95, 77, 83, 95, 87, 73, 78, 68, 79, 
-    87, 83, 79, 1, 0, 22, 0, 4, 0, 0, 
-    0, 30, 1, 15, 36, 0, 1, 0, 0, 0, 
-    0, 47, 0, 10, 0, 0, 0, 0, 0, 0, 
-    0, 95, 112, 97, 116, 104, 95, 106, 111, 105, 
-    110, 17, 4, 0, 0, 0, 30, 0, 16, 36, 
-    1, 0, 0, 0, 0, 0, 47, 1, 10, 0, 
-    0, 0, 0, 0, 0, 0, 95, 112, 97, 116, 
-    104, 95, 106, 111, 105, 110, 17, 0, 0, 0, 
-    0, 30, 0, 17, 36, 1, 0, 0, 0, 0, 
+    30, 2, 7, 36, 1, 2, 0, 0, 0, 0, 
+    35, 3, 15, 74, 3, 10, 1, 1, 0, 75, 
+    1, 0, 47, 0, 20, 0, 0, 0, 0, 0, 
+    0, 0, 95, 112, 97, 116, 104, 115, 101, 112, 
+    115, 95, 119, 105, 116, 104, 95, 99, 111, 108, 
+    111, 110, 30, 1, 8, 74, 1, 4, 0, 1, 
+    75, 1, 0, 47, 0, 35, 0, 0, 0, 0, 
+    0, 0, 0, 95, 67, 65, 83, 69, 95, 73, 
+    78, 83, 69, 78, 83, 73, 84, 73, 86, 69, 
+    95, 80, 76, 65, 84, 70, 79, 82, 77, 83, 
+    95, 83, 84, 82, 95, 75, 69, 89, 30, 1, 
+    9, 30, 0, 10, 74, 1, 74, 0, 4, 2, 
+    2, 75, 1, 0, 75, 1, 0, 47, 2, 37, 
+    0, 0, 0, 0, 0, 0, 0, 95, 67, 65, 
+    83, 69, 95, 73, 78, 83, 69, 78, 83, 73, 
+    84, 73, 86, 69, 95, 80, 76, 65, 84, 70, 
+    79, 82, 77, 83, 95, 66, 89, 84, 69, 83, 
+    95, 75, 69, 89, 35, 0, 17, 35, 1, 18, 
+    0, 2, 0, 1, 0, 47, 2, 27, 0, 0, 
+    0, 0, 0, 0, 0, 95, 67, 65, 83, 69, 
+    95, 73, 78, 83, 69, 78, 83, 73, 84, 73, 
+    86, 69, 95, 80, 76, 65, 84, 70, 79, 82, 
+    77, 83, 30, 0, 11, 36, 1, 0, 0, 0, 
+    0, 0, 47, 1, 16, 0, 0, 0, 0, 0, 
+    0, 0, 95, 109, 97, 107, 101, 95, 114, 101, 
+    108, 97, 120, 95, 99, 97, 115, 101, 30, 0, 
+    12, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
+    12, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
+    97, 99, 107, 95, 117, 105, 110, 116, 51, 50, 
+    30, 0, 13, 36, 1, 0, 0, 0, 0, 0, 
+    47, 1, 14, 0, 0, 0, 0, 0, 0, 0, 
+    95, 117, 110, 112, 97, 99, 107, 95, 117, 105, 
+    110, 116, 51, 50, 30, 0, 14, 36, 1, 0, 
+    0, 0, 0, 0, 47, 1, 14, 0, 0, 0, 
+    0, 0, 0, 0, 95, 117, 110, 112, 97, 99, 
+    107, 95, 117, 105, 110, 116, 49, 54, 35, 0, 
+    13, 79, 1, 0, 22, 0, 4, 0, 0, 0, 
+    30, 1, 15, 36, 0, 1, 0, 0, 0, 0, 
+    47, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 95, 106, 111, 105, 110, 
+    17, 4, 0, 0, 0, 30, 0, 16, 36, 1, 
+    0, 0, 0, 0, 0, 47, 1, 10, 0, 0, 
+    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
+    95, 106, 111, 105, 110, 17, 0, 0, 0, 0, 
+    30, 0, 17, 36, 1, 0, 0, 0, 0, 0, 
+    47, 1, 11, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 95, 115, 112, 108, 105, 
+    116, 30, 0, 18, 36, 1, 0, 0, 0, 0, 
+    0, 47, 1, 10, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 115, 116, 97, 
+    116, 30, 0, 19, 36, 1, 0, 0, 0, 0, 
+    0, 47, 1, 18, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 105, 115, 95, 
+    109, 111, 100, 101, 95, 116, 121, 112, 101, 30, 
+    0, 20, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 12, 0, 0, 0, 0, 0, 0, 0, 95, 
+    112, 97, 116, 104, 95, 105, 115, 102, 105, 108, 
+    101, 30, 0, 21, 36, 1, 0, 0, 0, 0, 
     0, 47, 1, 11, 0, 0, 0, 0, 0, 0, 
-    0, 95, 112, 97, 116, 104, 95, 115, 112, 108, 
-    105, 116, 30, 0, 18, 36, 1, 0, 0, 0, 
-    0, 0, 47, 1, 10, 0, 0, 0, 0, 0, 
-    0, 0, 95, 112, 97, 116, 104, 95, 115, 116, 
-    97, 116, 30, 0, 19, 36, 1, 0, 0, 0, 
-    0, 0, 47, 1, 18, 0, 0, 0, 0, 0, 
-    0, 0, 95, 112, 97, 116, 104, 95, 105, 115, 
-    95, 109, 111, 100, 101, 95, 116, 121, 112, 101, 
-    30, 0, 20, 36, 1, 0, 0, 0, 0, 0, 
-    47, 1, 12, 0, 0, 0, 0, 0, 0, 0, 
-    95, 112, 97, 116, 104, 95, 105, 115, 102, 105, 
-    108, 101, 30, 0, 21, 36, 1, 0, 0, 0, 
-    0, 0, 47, 1, 11, 0, 0, 0, 0, 0, 
-    0, 0, 95, 112, 97, 116, 104, 95, 105, 115, 
-    100, 105, 114, 35, 0, 11, 0, 0, 0, 0, 
-    0, 0, 0, 95, 77, 83, 95, 87, 73, 78, 
-    68, 79, 87, 83, 79, 1, 0, 22, 0, 4, 
-    0, 0, 0, 30, 1, 22, 36, 0, 1, 0, 
-    0, 0, 0, 47, 0, 11, 0, 0, 0, 0, 
-    0, 0, 0, 95, 112, 97, 116, 104, 95, 105, 
-    115, 97, 98, 115, 17, 4, 0, 0, 0, 30, 
-    0, 23, 36, 1, 0, 0, 0, 0, 0, 47, 
-    1, 11, 0, 0, 0, 0, 0, 0, 0, 95, 
-    112, 97, 116, 104, 95, 105, 115, 97, 98, 115, 
-    17, 0, 0, 0, 0, 30, 0, 24, 30, 1, 
-    25, 74, 0, 36, 2, 1, 1, 0, 0, 0, 
-    75, 1, 0, 47, 2, 13, 0, 0, 0, 0, 
-    0, 0, 0, 95, 119, 114, 105, 116, 101, 95, 
-    97, 116, 111, 109, 105, 99, 35, 1, 4, 0, 
-    0, 0, 0, 0, 0, 0, 116, 121, 112, 101, 
-    35, 2, 13, 0, 0, 0, 0, 0, 0, 0, 
-    95, 119, 114, 105, 116, 101, 95, 97, 116, 111, 
-    109, 105, 99, 27, 3, 2, 12, 74, 3, 10, 
+    0, 95, 112, 97, 116, 104, 95, 105, 115, 100, 
+    105, 114, 35, 0, 13, 79, 1, 0, 22, 0, 
+    4, 0, 0, 0, 30, 1, 22, 36, 0, 1, 
+    0, 0, 0, 0, 47, 0, 11, 0, 0, 0, 
+    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
+    105, 115, 97, 98, 115, 17, 4, 0, 0, 0, 
+    30, 0, 23, 36, 1, 0, 0, 0, 0, 0, 
+    47, 1, 11, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 95, 105, 115, 97, 98, 
+    115, 17, 0, 0, 0, 0, 30, 0, 24, 30, 
+    1, 25, 74, 0, 36, 2, 1, 1, 0, 0, 
+    0, 75, 1, 0, 47, 2, 13, 0, 0, 0, 
+    0, 0, 0, 0, 95, 119, 114, 105, 116, 101, 
+    95, 97, 116, 111, 109, 105, 99, 35, 1, 19, 
+    35, 2, 20, 27, 3, 2, 12, 74, 3, 10, 
     1, 1, 0, 75, 1, 0, 47, 0, 10, 0, 
     0, 0, 0, 0, 0, 0, 95, 99, 111, 100, 
     101, 95, 116, 121, 112, 101, 30, 1, 26, 34, 
-    2, 1, 1, 30, 3, 27, 30, 1, 28, 74, 
-    3, 74, 1, 10, 2, 2, 0, 75, 1, 0, 
-    75, 1, 220, 30, 4, 29, 0, 1, 0, 4, 
-    0, 47, 1, 12, 0, 0, 0, 0, 0, 0, 
-    0, 77, 65, 71, 73, 67, 95, 78, 85, 77, 
-    66, 69, 82, 35, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 105, 110, 116, 34, 1, 0, 2, 
-    35, 2, 12, 0, 0, 0, 0, 0, 0, 0, 
-    77, 65, 71, 73, 67, 95, 78, 85, 77, 66, 
-    69, 82, 30, 3, 28, 74, 2, 74, 3, 10, 
-    1, 2, 0, 75, 1, 56, 75, 1, 0, 47, 
-    0, 17, 0, 0, 0, 0, 0, 0, 0, 95, 
-    82, 65, 87, 95, 77, 65, 71, 73, 67, 95, 
-    78, 85, 77, 66, 69, 82, 30, 1, 30, 47, 
-    1, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    80, 89, 67, 65, 67, 72, 69, 30, 2, 31, 
-    47, 2, 4, 0, 0, 0, 0, 0, 0, 0, 
-    95, 79, 80, 84, 30, 1, 32, 74, 1, 3, 
-    0, 1, 75, 1, 21, 47, 0, 15, 0, 0, 
-    0, 0, 0, 0, 0, 83, 79, 85, 82, 67, 
-    69, 95, 83, 85, 70, 70, 73, 88, 69, 83, 
-    30, 1, 33, 74, 1, 3, 0, 1, 75, 1, 
-    0, 47, 0, 17, 0, 0, 0, 0, 0, 0, 
-    0, 66, 89, 84, 69, 67, 79, 68, 69, 95, 
-    83, 85, 70, 70, 73, 88, 69, 83, 35, 1, 
-    17, 0, 0, 0, 0, 0, 0, 0, 66, 89, 
-    84, 69, 67, 79, 68, 69, 95, 83, 85, 70, 
-    70, 73, 88, 69, 83, 47, 1, 23, 0, 0, 
-    0, 0, 0, 0, 0, 68, 69, 66, 85, 71, 
-    95, 66, 89, 84, 69, 67, 79, 68, 69, 95, 
-    83, 85, 70, 70, 73, 88, 69, 83, 47, 1, 
-    27, 0, 0, 0, 0, 0, 0, 0, 79, 80, 
-    84, 73, 77, 73, 90, 69, 68, 95, 66, 89, 
-    84, 69, 67, 79, 68, 69, 95, 83, 85, 70, 
-    70, 73, 88, 69, 83, 30, 0, 34, 30, 1, 
-    34, 30, 2, 35, 74, 0, 74, 1, 36, 3, 
-    2, 1, 1, 0, 0, 75, 1, 58, 75, 1, 
-    193, 47, 3, 17, 0, 0, 0, 0, 0, 0, 
-    0, 99, 97, 99, 104, 101, 95, 102, 114, 111, 
-    109, 95, 115, 111, 117, 114, 99, 101, 30, 0, 
-    36, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
-    17, 0, 0, 0, 0, 0, 0, 0, 115, 111, 
-    117, 114, 99, 101, 95, 102, 114, 111, 109, 95, 
-    99, 97, 99, 104, 101, 30, 0, 37, 36, 1, 
-    0, 0, 0, 0, 0, 47, 1, 15, 0, 0, 
-    0, 0, 0, 0, 0, 95, 103, 101, 116, 95, 
-    115, 111, 117, 114, 99, 101, 102, 105, 108, 101, 
-    30, 0, 38, 36, 1, 0, 0, 0, 0, 0, 
-    47, 1, 11, 0, 0, 0, 0, 0, 0, 0, 
-    95, 103, 101, 116, 95, 99, 97, 99, 104, 101, 
-    100, 30, 0, 39, 36, 1, 0, 0, 0, 0, 
-    0, 47, 1, 10, 0, 0, 0, 0, 0, 0, 
-    0, 95, 99, 97, 108, 99, 95, 109, 111, 100, 
-    101, 30, 0, 40, 36, 1, 0, 0, 0, 0, 
+    2, 1, 1, 1, 32, 30, 3, 27, 30, 1, 
+    28, 38, 2, 32, 2, 0, 0, 0, 0, 0, 
+    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    30, 4, 29, 0, 1, 0, 4, 0, 47, 1, 
+    12, 0, 0, 0, 0, 0, 0, 0, 77, 65, 
+    71, 73, 67, 95, 78, 85, 77, 66, 69, 82, 
+    35, 0, 21, 34, 1, 0, 2, 1, 32, 35, 
+    2, 22, 30, 3, 28, 38, 1, 32, 2, 0, 
+    0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 47, 0, 17, 0, 0, 0, 
+    0, 0, 0, 0, 95, 82, 65, 87, 95, 77, 
+    65, 71, 73, 67, 95, 78, 85, 77, 66, 69, 
+    82, 30, 1, 30, 47, 1, 8, 0, 0, 0, 
+    0, 0, 0, 0, 95, 80, 89, 67, 65, 67, 
+    72, 69, 30, 2, 31, 47, 2, 4, 0, 0, 
+    0, 0, 0, 0, 0, 95, 79, 80, 84, 30, 
+    1, 32, 74, 1, 3, 0, 1, 75, 1, 21, 
+    47, 0, 15, 0, 0, 0, 0, 0, 0, 0, 
+    83, 79, 85, 82, 67, 69, 95, 83, 85, 70, 
+    70, 73, 88, 69, 83, 30, 1, 33, 74, 1, 
+    3, 0, 1, 75, 1, 0, 47, 0, 17, 0, 
+    0, 0, 0, 0, 0, 0, 66, 89, 84, 69, 
+    67, 79, 68, 69, 95, 83, 85, 70, 70, 73, 
+    88, 69, 83, 35, 1, 23, 47, 1, 23, 0, 
+    0, 0, 0, 0, 0, 0, 68, 69, 66, 85, 
+    71, 95, 66, 89, 84, 69, 67, 79, 68, 69, 
+    95, 83, 85, 70, 70, 73, 88, 69, 83, 47, 
+    1, 27, 0, 0, 0, 0, 0, 0, 0, 79, 
+    80, 84, 73, 77, 73, 90, 69, 68, 95, 66, 
+    89, 84, 69, 67, 79, 68, 69, 95, 83, 85, 
+    70, 70, 73, 88, 69, 83, 30, 0, 34, 30, 
+    1, 34, 30, 2, 35, 74, 0, 74, 1, 36, 
+    3, 2, 1, 1, 0, 0, 75, 1, 58, 75, 
+    1, 193, 47, 3, 17, 0, 0, 0, 0, 0, 
+    0, 0, 99, 97, 99, 104, 101, 95, 102, 114, 
+    111, 109, 95, 115, 111, 117, 114, 99, 101, 30, 
+    0, 36, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 17, 0, 0, 0, 0, 0, 0, 0, 115, 
+    111, 117, 114, 99, 101, 95, 102, 114, 111, 109, 
+    95, 99, 97, 99, 104, 101, 30, 0, 37, 36, 
+    1, 0, 0, 0, 0, 0, 47, 1, 15, 0, 
+    0, 0, 0, 0, 0, 0, 95, 103, 101, 116, 
+    95, 115, 111, 117, 114, 99, 101, 102, 105, 108, 
+    101, 30, 0, 38, 36, 1, 0, 0, 0, 0, 
     0, 47, 1, 11, 0, 0, 0, 0, 0, 0, 
-    0, 95, 99, 104, 101, 99, 107, 95, 110, 97, 
-    109, 101, 30, 0, 41, 36, 1, 0, 0, 0, 
-    0, 0, 47, 1, 17, 0, 0, 0, 0, 0, 
-    0, 0, 95, 102, 105, 110, 100, 95, 109, 111, 
-    100, 117, 108, 101, 95, 115, 104, 105, 109, 30, 
-    0, 42, 36, 1, 0, 0, 0, 0, 0, 47, 
-    1, 13, 0, 0, 0, 0, 0, 0, 0, 95, 
-    99, 108, 97, 115, 115, 105, 102, 121, 95, 112, 
-    121, 99, 30, 0, 43, 36, 1, 0, 0, 0, 
-    0, 0, 47, 1, 23, 0, 0, 0, 0, 0, 
-    0, 0, 95, 118, 97, 108, 105, 100, 97, 116, 
-    101, 95, 116, 105, 109, 101, 115, 116, 97, 109, 
-    112, 95, 112, 121, 99, 30, 0, 44, 36, 1, 
-    0, 0, 0, 0, 0, 47, 1, 18, 0, 0, 
-    0, 0, 0, 0, 0, 95, 118, 97, 108, 105, 
-    100, 97, 116, 101, 95, 104, 97, 115, 104, 95, 
-    112, 121, 99, 30, 0, 34, 30, 1, 34, 30, 
-    2, 34, 30, 3, 45, 74, 0, 74, 1, 74, 
-    2, 36, 4, 3, 3, 0, 0, 0, 75, 1, 
-    205, 75, 1, 166, 75, 1, 59, 47, 4, 17, 
-    0, 0, 0, 0, 0, 0, 0, 95, 99, 111, 
-    109, 112, 105, 108, 101, 95, 98, 121, 116, 101, 
-    99, 111, 100, 101, 30, 0, 1, 30, 1, 1, 
-    30, 2, 46, 74, 0, 74, 1, 36, 3, 2, 
-    2, 0, 0, 0, 75, 1, 236, 75, 1, 177, 
-    47, 3, 22, 0, 0, 0, 0, 0, 0, 0, 
-    95, 99, 111, 100, 101, 95, 116, 111, 95, 116, 
-    105, 109, 101, 115, 116, 97, 109, 112, 95, 112, 
-    121, 99, 30, 0, 47, 30, 1, 48, 74, 0, 
-    36, 2, 1, 1, 0, 0, 0, 75, 1, 249, 
-    47, 2, 17, 0, 0, 0, 0, 0, 0, 0, 
-    95, 99, 111, 100, 101, 95, 116, 111, 95, 104, 
-    97, 115, 104, 95, 112, 121, 99, 30, 0, 49, 
-    36, 1, 0, 0, 0, 0, 0, 47, 1, 13, 
-    0, 0, 0, 0, 0, 0, 0, 100, 101, 99, 
-    111, 100, 101, 95, 115, 111, 117, 114, 99, 101, 
-    35, 3, 6, 0, 0, 0, 0, 0, 0, 0, 
-    111, 98, 106, 101, 99, 116, 10, 3, 0, 0, 
-    47, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
-    95, 80, 79, 80, 85, 76, 65, 84, 69, 30, 
-    2, 34, 30, 0, 34, 35, 1, 9, 0, 0, 
-    0, 0, 0, 0, 0, 95, 80, 79, 80, 85, 
-    76, 65, 84, 69, 30, 3, 50, 74, 2, 74, 
-    0, 74, 1, 36, 4, 3, 1, 2, 0, 0, 
-    75, 1, 91, 75, 1, 74, 75, 1, 160, 47, 
-    4, 23, 0, 0, 0, 0, 0, 0, 0, 115, 
-    112, 101, 99, 95, 102, 114, 111, 109, 95, 102, 
-    105, 108, 101, 95, 108, 111, 99, 97, 116, 105, 
-    111, 110, 30, 1, 51, 36, 2, 1, 0, 0, 
-    0, 0, 28, 3, 74, 2, 74, 1, 10, 3, 
-    2, 0, 75, 1, 143, 75, 1, 5, 47, 0, 
-    21, 0, 0, 0, 0, 0, 0, 0, 87, 105, 
-    110, 100, 111, 119, 115, 82, 101, 103, 105, 115, 
-    116, 114, 121, 70, 105, 110, 100, 101, 114, 30, 
-    1, 52, 36, 2, 1, 0, 0, 0, 0, 28, 
-    3, 74, 2, 74, 1, 10, 3, 2, 0, 75, 
-    1, 0, 75, 1, 128, 47, 0, 13, 0, 0, 
-    0, 0, 0, 0, 0, 95, 76, 111, 97, 100, 
-    101, 114, 66, 97, 115, 105, 99, 115, 35, 1, 
-    13, 0, 0, 0, 0, 0, 0, 0, 95, 76, 
-    111, 97, 100, 101, 114, 66, 97, 115, 105, 99, 
-    115, 30, 2, 53, 36, 3, 2, 0, 0, 0, 
-    0, 28, 4, 74, 3, 74, 2, 74, 1, 10, 
-    4, 3, 0, 75, 1, 27, 75, 1, 0, 75, 
-    1, 33, 47, 0, 12, 0, 0, 0, 0, 0, 
-    0, 0, 83, 111, 117, 114, 99, 101, 76, 111, 
-    97, 100, 101, 114, 30, 1, 54, 36, 2, 1, 
+    0, 95, 103, 101, 116, 95, 99, 97, 99, 104, 
+    101, 100, 30, 0, 39, 36, 1, 0, 0, 0, 
+    0, 0, 47, 1, 10, 0, 0, 0, 0, 0, 
+    0, 0, 95, 99, 97, 108, 99, 95, 109, 111, 
+    100, 101, 30, 0, 40, 36, 1, 0, 0, 0, 
+    0, 0, 47, 1, 11, 0, 0, 0, 0, 0, 
+    0, 0, 95, 99, 104, 101, 99, 107, 95, 110, 
+    97, 109, 101, 30, 0, 41, 36, 1, 0, 0, 
+    0, 0, 0, 47, 1, 17, 0, 0, 0, 0, 
+    0, 0, 0, 95, 102, 105, 110, 100, 95, 109, 
+    111, 100, 117, 108, 101, 95, 115, 104, 105, 109, 
+    30, 0, 42, 36, 1, 0, 0, 0, 0, 0, 
+    47, 1, 13, 0, 0, 0, 0, 0, 0, 0, 
+    95, 99, 108, 97, 115, 115, 105, 102, 121, 95, 
+    112, 121, 99, 30, 0, 43, 36, 1, 0, 0, 
+    0, 0, 0, 47, 1, 23, 0, 0, 0, 0, 
+    0, 0, 0, 95, 118, 97, 108, 105, 100, 97, 
+    116, 101, 95, 116, 105, 109, 101, 115, 116, 97, 
+    109, 112, 95, 112, 121, 99, 30, 0, 44, 36, 
+    1, 0, 0, 0, 0, 0, 47, 1, 18, 0, 
+    0, 0, 0, 0, 0, 0, 95, 118, 97, 108, 
+    105, 100, 97, 116, 101, 95, 104, 97, 115, 104, 
+    95, 112, 121, 99, 30, 0, 34, 30, 1, 34, 
+    30, 2, 34, 30, 3, 45, 74, 0, 74, 1, 
+    74, 2, 36, 4, 3, 3, 0, 0, 0, 75, 
+    1, 205, 75, 1, 166, 75, 1, 59, 47, 4, 
+    17, 0, 0, 0, 0, 0, 0, 0, 95, 99, 
+    111, 109, 112, 105, 108, 101, 95, 98, 121, 116, 
+    101, 99, 111, 100, 101, 30, 0, 1, 30, 1, 
+    1, 30, 2, 46, 74, 0, 74, 1, 36, 3, 
+    2, 2, 0, 0, 0, 75, 1, 236, 75, 1, 
+    177, 47, 3, 22, 0, 0, 0, 0, 0, 0, 
+    0, 95, 99, 111, 100, 101, 95, 116, 111, 95, 
+    116, 105, 109, 101, 115, 116, 97, 109, 112, 95, 
+    112, 121, 99, 30, 0, 47, 30, 1, 48, 74, 
+    0, 36, 2, 1, 1, 0, 0, 0, 75, 1, 
+    249, 47, 2, 17, 0, 0, 0, 0, 0, 0, 
+    0, 95, 99, 111, 100, 101, 95, 116, 111, 95, 
+    104, 97, 115, 104, 95, 112, 121, 99, 30, 0, 
+    49, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
+    13, 0, 0, 0, 0, 0, 0, 0, 100, 101, 
+    99, 111, 100, 101, 95, 115, 111, 117, 114, 99, 
+    101, 35, 3, 24, 10, 3, 0, 0, 47, 0, 
+    9, 0, 0, 0, 0, 0, 0, 0, 95, 80, 
+    79, 80, 85, 76, 65, 84, 69, 30, 2, 34, 
+    30, 0, 34, 35, 1, 25, 30, 3, 50, 74, 
+    2, 74, 0, 74, 1, 36, 4, 3, 1, 2, 
+    0, 0, 75, 1, 91, 75, 1, 74, 75, 1, 
+    160, 47, 4, 23, 0, 0, 0, 0, 0, 0, 
+    0, 115, 112, 101, 99, 95, 102, 114, 111, 109, 
+    95, 102, 105, 108, 101, 95, 108, 111, 99, 97, 
+    116, 105, 111, 110, 30, 1, 51, 36, 2, 1, 
     0, 0, 0, 0, 28, 3, 74, 2, 74, 1, 
-    10, 3, 2, 0, 75, 1, 0, 75, 1, 130, 
-    47, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
-    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
-    35, 1, 10, 0, 0, 0, 0, 0, 0, 0, 
+    10, 3, 2, 0, 75, 1, 143, 75, 1, 5, 
+    47, 0, 21, 0, 0, 0, 0, 0, 0, 0, 
+    87, 105, 110, 100, 111, 119, 115, 82, 101, 103, 
+    105, 115, 116, 114, 121, 70, 105, 110, 100, 101, 
+    114, 30, 1, 52, 36, 2, 1, 0, 0, 0, 
+    0, 28, 3, 74, 2, 74, 1, 10, 3, 2, 
+    0, 75, 1, 0, 75, 1, 128, 47, 0, 13, 
+    0, 0, 0, 0, 0, 0, 0, 95, 76, 111, 
+    97, 100, 101, 114, 66, 97, 115, 105, 99, 115, 
+    35, 1, 26, 30, 2, 53, 36, 3, 2, 0, 
+    0, 0, 0, 28, 4, 74, 3, 74, 2, 74, 
+    1, 10, 4, 3, 0, 75, 1, 27, 75, 1, 
+    0, 75, 1, 33, 47, 0, 12, 0, 0, 0, 
+    0, 0, 0, 0, 83, 111, 117, 114, 99, 101, 
+    76, 111, 97, 100, 101, 114, 30, 1, 54, 36, 
+    2, 1, 0, 0, 0, 0, 28, 3, 74, 2, 
+    74, 1, 10, 3, 2, 0, 75, 1, 0, 75, 
+    1, 130, 47, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 70, 105, 108, 101, 76, 111, 97, 100, 
+    101, 114, 35, 1, 27, 35, 2, 28, 30, 3, 
+    55, 36, 4, 3, 0, 0, 0, 0, 28, 5, 
+    74, 4, 74, 3, 74, 1, 74, 2, 10, 5, 
+    4, 0, 75, 1, 172, 75, 1, 156, 75, 1, 
+    0, 75, 1, 131, 47, 0, 16, 0, 0, 0, 
+    0, 0, 0, 0, 83, 111, 117, 114, 99, 101, 
     70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
-    35, 2, 12, 0, 0, 0, 0, 0, 0, 0, 
-    83, 111, 117, 114, 99, 101, 76, 111, 97, 100, 
-    101, 114, 30, 3, 55, 36, 4, 3, 0, 0, 
-    0, 0, 28, 5, 74, 4, 74, 3, 74, 1, 
-    74, 2, 10, 5, 4, 0, 75, 1, 172, 75, 
-    1, 156, 75, 1, 0, 75, 1, 131, 47, 0, 
-    16, 0, 0, 0, 0, 0, 0, 0, 83, 111, 
-    117, 114, 99, 101, 70, 105, 108, 101, 76, 111, 
-    97, 100, 101, 114, 35, 1, 10, 0, 0, 0, 
-    0, 0, 0, 0, 70, 105, 108, 101, 76, 111, 
-    97, 100, 101, 114, 35, 2, 13, 0, 0, 0, 
-    0, 0, 0, 0, 95, 76, 111, 97, 100, 101, 
-    114, 66, 97, 115, 105, 99, 115, 30, 3, 56, 
-    36, 4, 3, 0, 0, 0, 0, 28, 5, 74, 
-    4, 74, 3, 74, 1, 74, 2, 10, 5, 4, 
-    0, 75, 1, 96, 75, 1, 0, 75, 1, 16, 
-    75, 1, 0, 47, 0, 20, 0, 0, 0, 0, 
-    0, 0, 0, 83, 111, 117, 114, 99, 101, 108, 
-    101, 115, 115, 70, 105, 108, 101, 76, 111, 97, 
-    100, 101, 114, 3, 1, 0, 47, 1, 18, 0, 
-    0, 0, 0, 0, 0, 0, 69, 88, 84, 69, 
-    78, 83, 73, 79, 78, 95, 83, 85, 70, 70, 
-    73, 88, 69, 83, 35, 2, 10, 0, 0, 0, 
-    0, 0, 0, 0, 70, 105, 108, 101, 76, 111, 
-    97, 100, 101, 114, 35, 1, 13, 0, 0, 0, 
-    0, 0, 0, 0, 95, 76, 111, 97, 100, 101, 
-    114, 66, 97, 115, 105, 99, 115, 30, 3, 57, 
-    36, 4, 3, 0, 0, 0, 0, 28, 5, 74, 
-    4, 74, 3, 74, 2, 74, 1, 10, 5, 4, 
-    0, 75, 1, 172, 75, 1, 80, 75, 1, 0, 
-    75, 1, 172, 47, 0, 19, 0, 0, 0, 0, 
-    0, 0, 0, 69, 120, 116, 101, 110, 115, 105, 
-    111, 110, 70, 105, 108, 101, 76, 111, 97, 100, 
-    101, 114, 30, 1, 58, 36, 2, 1, 0, 0, 
-    0, 0, 28, 3, 74, 2, 74, 1, 10, 3, 
-    2, 0, 75, 1, 99, 75, 1, 0, 47, 0, 
-    14, 0, 0, 0, 0, 0, 0, 0, 95, 78, 
-    97, 109, 101, 115, 112, 97, 99, 101, 80, 97, 
-    116, 104, 30, 1, 59, 36, 2, 1, 0, 0, 
-    0, 0, 28, 3, 74, 2, 74, 1, 10, 3, 
-    2, 0, 75, 1, 213, 75, 1, 0, 47, 0, 
-    16, 0, 0, 0, 0, 0, 0, 0, 95, 78, 
-    97, 109, 101, 115, 112, 97, 99, 101, 76, 111, 
-    97, 100, 101, 114, 30, 1, 60, 36, 2, 1, 
+    35, 1, 27, 35, 2, 26, 30, 3, 56, 36, 
+    4, 3, 0, 0, 0, 0, 28, 5, 74, 4, 
+    74, 3, 74, 1, 74, 2, 10, 5, 4, 0, 
+    75, 1, 96, 75, 1, 0, 75, 1, 16, 75, 
+    1, 0, 47, 0, 20, 0, 0, 0, 0, 0, 
+    0, 0, 83, 111, 117, 114, 99, 101, 108, 101, 
+    115, 115, 70, 105, 108, 101, 76, 111, 97, 100, 
+    101, 114, 3, 1, 0, 47, 1, 18, 0, 0, 
+    0, 0, 0, 0, 0, 69, 88, 84, 69, 78, 
+    83, 73, 79, 78, 95, 83, 85, 70, 70, 73, 
+    88, 69, 83, 35, 2, 27, 35, 1, 26, 30, 
+    3, 57, 36, 4, 3, 0, 0, 0, 0, 28, 
+    5, 74, 4, 74, 3, 74, 2, 74, 1, 10, 
+    5, 4, 0, 75, 1, 172, 75, 1, 80, 75, 
+    1, 0, 75, 1, 172, 47, 0, 19, 0, 0, 
+    0, 0, 0, 0, 0, 69, 120, 116, 101, 110, 
+    115, 105, 111, 110, 70, 105, 108, 101, 76, 111, 
+    97, 100, 101, 114, 30, 1, 58, 36, 2, 1, 
     0, 0, 0, 0, 28, 3, 74, 2, 74, 1, 
-    10, 3, 2, 0, 75, 1, 172, 75, 1, 30, 
-    47, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
-    80, 97, 116, 104, 70, 105, 110, 100, 101, 114, 
-    30, 1, 61, 36, 2, 1, 0, 0, 0, 0, 
-    28, 3, 74, 2, 74, 1, 10, 3, 2, 0, 
-    75, 1, 172, 75, 1, 8, 47, 0, 10, 0, 
-    0, 0, 0, 0, 0, 0, 70, 105, 108, 101, 
-    70, 105, 110, 100, 101, 114, 30, 1, 34, 30, 
-    0, 62, 74, 1, 36, 2, 0, 1, 0, 0, 
-    0, 75, 1, 58, 47, 2, 14, 0, 0, 0, 
-    0, 0, 0, 0, 95, 102, 105, 120, 95, 117, 
-    112, 95, 109, 111, 100, 117, 108, 101, 30, 0, 
-    63, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
-    27, 0, 0, 0, 0, 0, 0, 0, 95, 103, 
-    101, 116, 95, 115, 117, 112, 112, 111, 114, 116, 
-    101, 100, 95, 102, 105, 108, 101, 95, 108, 111, 
-    97, 100, 101, 114, 115, 30, 0, 64, 36, 1, 
-    0, 0, 0, 0, 0, 47, 1, 6, 0, 0, 
-    0, 0, 0, 0, 0, 95, 115, 101, 116, 117, 
-    112, 30, 0, 65, 36, 1, 0, 0, 0, 0, 
-    0, 47, 1, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 105, 110, 115, 116, 97, 108, 108, 17, 
-    0, 0, 0, 0, 30, 0, 34, 41, 0, 0, 
+    10, 3, 2, 0, 75, 1, 99, 75, 1, 0, 
+    47, 0, 14, 0, 0, 0, 0, 0, 0, 0, 
+    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
+    80, 97, 116, 104, 30, 1, 59, 36, 2, 1, 
+    0, 0, 0, 0, 28, 3, 74, 2, 74, 1, 
+    10, 3, 2, 0, 75, 1, 213, 75, 1, 0, 
+    47, 0, 16, 0, 0, 0, 0, 0, 0, 0, 
+    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
+    76, 111, 97, 100, 101, 114, 30, 1, 60, 36, 
+    2, 1, 0, 0, 0, 0, 28, 3, 74, 2, 
+    74, 1, 10, 3, 2, 0, 75, 1, 172, 75, 
+    1, 30, 47, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 80, 97, 116, 104, 70, 105, 110, 100, 
+    101, 114, 30, 1, 61, 36, 2, 1, 0, 0, 
+    0, 0, 28, 3, 74, 2, 74, 1, 10, 3, 
+    2, 0, 75, 1, 172, 75, 1, 8, 47, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 70, 105, 
+    108, 101, 70, 105, 110, 100, 101, 114, 30, 1, 
+    34, 30, 0, 62, 74, 1, 36, 2, 0, 1, 
+    0, 0, 0, 75, 1, 58, 47, 2, 14, 0, 
+    0, 0, 0, 0, 0, 0, 95, 102, 105, 120, 
+    95, 117, 112, 95, 109, 111, 100, 117, 108, 101, 
+    30, 0, 63, 36, 1, 0, 0, 0, 0, 0, 
+    47, 1, 27, 0, 0, 0, 0, 0, 0, 0, 
+    95, 103, 101, 116, 95, 115, 117, 112, 112, 111, 
+    114, 116, 101, 100, 95, 102, 105, 108, 101, 95, 
+    108, 111, 97, 100, 101, 114, 115, 30, 0, 64, 
+    36, 1, 0, 0, 0, 0, 0, 47, 1, 6, 
+    0, 0, 0, 0, 0, 0, 0, 95, 115, 101, 
+    116, 117, 112, 30, 0, 65, 36, 1, 0, 0, 
+    0, 0, 0, 47, 1, 8, 0, 0, 0, 0, 
+    0, 0, 0, 95, 105, 110, 115, 116, 97, 108, 
+    108, 17, 0, 0, 0, 0, 30, 0, 34, 41, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 
@@ -670,7 +622,7 @@ std::vector<uint8_t> _bootstrap_external
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
     0, 0, 0, 0, 60, 109, 111, 100, 117, 108, 
-    101, 62, 13, 0, 0, 0, 0, 0, 0, 0, 
+    101, 62, 29, 0, 0, 0, 0, 0, 0, 0, 
     4, 0, 0, 0, 0, 0, 0, 0, 106, 111, 
     105, 110, 8, 0, 0, 0, 0, 0, 0, 0, 
     116, 111, 95, 98, 121, 116, 101, 115, 10, 0, 
@@ -689,698 +641,745 @@ std::vector<uint8_t> _bootstrap_external
     116, 6, 0, 0, 0, 0, 0, 0, 0, 119, 
     105, 110, 114, 101, 103, 8, 0, 0, 0, 0, 
     0, 0, 0, 95, 95, 99, 111, 100, 101, 95, 
-    95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 
+    95, 11, 0, 0, 0, 0, 0, 0, 0, 95, 
+    77, 83, 95, 87, 73, 78, 68, 79, 87, 83, 
+    3, 0, 0, 0, 0, 0, 0, 0, 97, 108, 
+    108, 15, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 95, 115, 101, 112, 97, 114, 97, 
+    116, 111, 114, 115, 5, 0, 0, 0, 0, 0, 
+    0, 0, 116, 117, 112, 108, 101, 37, 0, 0, 
+    0, 0, 0, 0, 0, 95, 67, 65, 83, 69, 
+    95, 73, 78, 83, 69, 78, 83, 73, 84, 73, 
+    86, 69, 95, 80, 76, 65, 84, 70, 79, 82, 
+    77, 83, 95, 66, 89, 84, 69, 83, 95, 75, 
+    69, 89, 35, 0, 0, 0, 0, 0, 0, 0, 
+    95, 67, 65, 83, 69, 95, 73, 78, 83, 69, 
+    78, 83, 73, 84, 73, 86, 69, 95, 80, 76, 
+    65, 84, 70, 79, 82, 77, 83, 95, 83, 84, 
+    82, 95, 75, 69, 89, 4, 0, 0, 0, 0, 
+    0, 0, 0, 116, 121, 112, 101, 13, 0, 0, 
+    0, 0, 0, 0, 0, 95, 119, 114, 105, 116, 
+    101, 95, 97, 116, 111, 109, 105, 99, 3, 0, 
+    0, 0, 0, 0, 0, 0, 105, 110, 116, 12, 
+    0, 0, 0, 0, 0, 0, 0, 77, 65, 71, 
+    73, 67, 95, 78, 85, 77, 66, 69, 82, 17, 
+    0, 0, 0, 0, 0, 0, 0, 66, 89, 84, 
+    69, 67, 79, 68, 69, 95, 83, 85, 70, 70, 
+    73, 88, 69, 83, 6, 0, 0, 0, 0, 0, 
+    0, 0, 111, 98, 106, 101, 99, 116, 9, 0, 
+    0, 0, 0, 0, 0, 0, 95, 80, 79, 80, 
+    85, 76, 65, 84, 69, 13, 0, 0, 0, 0, 
+    0, 0, 0, 95, 76, 111, 97, 100, 101, 114, 
+    66, 97, 115, 105, 99, 115, 10, 0, 0, 0, 
+    0, 0, 0, 0, 70, 105, 108, 101, 76, 111, 
+    97, 100, 101, 114, 12, 0, 0, 0, 0, 0, 
+    0, 0, 83, 111, 117, 114, 99, 101, 76, 111, 
+    97, 100, 101, 114, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 
-    0, 48, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
-    95, 99, 108, 97, 115, 115, 95, 95, 80, 97, 
-    116, 104, 70, 105, 110, 100, 101, 114, 95, 95, 
-    46, 49, 51, 49, 53, 58, 48, 0, 92, 0, 
-    0, 0, 0, 0, 0, 0, 33, 0, 0, 47, 
-    0, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 109, 111, 100, 117, 108, 101, 95, 95, 30, 
-    2, 0, 47, 2, 12, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 113, 117, 97, 108, 110, 97, 
-    109, 101, 95, 95, 30, 1, 1, 33, 2, 1, 
-    30, 0, 2, 36, 1, 0, 0, 0, 0, 0, 
-    47, 1, 17, 0, 0, 0, 0, 0, 0, 0, 
-    105, 110, 118, 97, 108, 105, 100, 97, 116, 101, 
-    95, 99, 97, 99, 104, 101, 115, 35, 4, 17, 
-    0, 0, 0, 0, 0, 0, 0, 105, 110, 118, 
-    97, 108, 105, 100, 97, 116, 101, 95, 99, 97, 
-    99, 104, 101, 115, 74, 4, 10, 2, 1, 0, 
-    75, 1, 0, 47, 0, 17, 0, 0, 0, 0, 
+    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 
+    0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 95, 95, 99, 108, 97, 115, 115, 95, 
+    95, 80, 97, 116, 104, 70, 105, 110, 100, 101, 
+    114, 95, 95, 46, 49, 51, 49, 53, 58, 48, 
+    0, 92, 0, 0, 0, 0, 0, 0, 0, 33, 
+    0, 0, 47, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 109, 111, 100, 117, 108, 101, 
+    95, 95, 30, 2, 0, 47, 2, 12, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 113, 117, 97, 
+    108, 110, 97, 109, 101, 95, 95, 30, 1, 1, 
+    33, 2, 1, 30, 0, 2, 36, 1, 0, 0, 
+    0, 0, 0, 47, 1, 17, 0, 0, 0, 0, 
     0, 0, 0, 105, 110, 118, 97, 108, 105, 100, 
     97, 116, 101, 95, 99, 97, 99, 104, 101, 115, 
-    33, 2, 1, 30, 0, 3, 36, 1, 0, 0, 
-    0, 0, 0, 47, 1, 11, 0, 0, 0, 0, 
-    0, 0, 0, 95, 112, 97, 116, 104, 95, 104, 
-    111, 111, 107, 115, 35, 4, 11, 0, 0, 0, 
-    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    104, 111, 111, 107, 115, 74, 4, 10, 2, 1, 
-    0, 75, 1, 0, 47, 0, 11, 0, 0, 0, 
-    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    104, 111, 111, 107, 115, 33, 2, 1, 30, 0, 
-    4, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
-    20, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
-    97, 116, 104, 95, 105, 109, 112, 111, 114, 116, 
-    101, 114, 95, 99, 97, 99, 104, 101, 35, 4, 
-    20, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
-    97, 116, 104, 95, 105, 109, 112, 111, 114, 116, 
-    101, 114, 95, 99, 97, 99, 104, 101, 74, 4, 
-    10, 2, 1, 0, 75, 1, 0, 47, 0, 20, 
-    0, 0, 0, 0, 0, 0, 0, 95, 112, 97, 
-    116, 104, 95, 105, 109, 112, 111, 114, 116, 101, 
-    114, 95, 99, 97, 99, 104, 101, 33, 2, 1, 
-    30, 0, 5, 36, 1, 0, 0, 0, 0, 0, 
-    47, 1, 16, 0, 0, 0, 0, 0, 0, 0, 
-    95, 108, 101, 103, 97, 99, 121, 95, 103, 101, 
-    116, 95, 115, 112, 101, 99, 35, 4, 16, 0, 
-    0, 0, 0, 0, 0, 0, 95, 108, 101, 103, 
-    97, 99, 121, 95, 103, 101, 116, 95, 115, 112, 
-    101, 99, 74, 4, 10, 2, 1, 0, 75, 1, 
-    0, 47, 0, 16, 0, 0, 0, 0, 0, 0, 
-    0, 95, 108, 101, 103, 97, 99, 121, 95, 103, 
-    101, 116, 95, 115, 112, 101, 99, 33, 2, 1, 
-    30, 0, 6, 30, 1, 7, 74, 0, 36, 3, 
-    1, 1, 0, 0, 0, 75, 1, 0, 47, 3, 
-    9, 0, 0, 0, 0, 0, 0, 0, 95, 103, 
-    101, 116, 95, 115, 112, 101, 99, 35, 1, 9, 
-    0, 0, 0, 0, 0, 0, 0, 95, 103, 101, 
-    116, 95, 115, 112, 101, 99, 74, 1, 10, 2, 
-    1, 0, 75, 1, 0, 47, 0, 9, 0, 0, 
-    0, 0, 0, 0, 0, 95, 103, 101, 116, 95, 
-    115, 112, 101, 99, 33, 1, 1, 30, 0, 6, 
-    30, 2, 6, 30, 3, 8, 74, 0, 74, 2, 
-    36, 4, 3, 2, 0, 0, 0, 75, 1, 0, 
-    75, 1, 0, 47, 4, 9, 0, 0, 0, 0, 
-    0, 0, 0, 102, 105, 110, 100, 95, 115, 112, 
-    101, 99, 35, 2, 9, 0, 0, 0, 0, 0, 
-    0, 0, 102, 105, 110, 100, 95, 115, 112, 101, 
-    99, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
+    35, 4, 2, 74, 4, 10, 2, 1, 0, 75, 
+    1, 0, 47, 0, 17, 0, 0, 0, 0, 0, 
+    0, 0, 105, 110, 118, 97, 108, 105, 100, 97, 
+    116, 101, 95, 99, 97, 99, 104, 101, 115, 33, 
+    2, 1, 30, 0, 3, 36, 1, 0, 0, 0, 
+    0, 0, 47, 1, 11, 0, 0, 0, 0, 0, 
+    0, 0, 95, 112, 97, 116, 104, 95, 104, 111, 
+    111, 107, 115, 35, 4, 3, 74, 4, 10, 2, 
+    1, 0, 75, 1, 0, 47, 0, 11, 0, 0, 
+    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
+    95, 104, 111, 111, 107, 115, 33, 2, 1, 30, 
+    0, 4, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 20, 0, 0, 0, 0, 0, 0, 0, 95, 
+    112, 97, 116, 104, 95, 105, 109, 112, 111, 114, 
+    116, 101, 114, 95, 99, 97, 99, 104, 101, 35, 
+    4, 4, 74, 4, 10, 2, 1, 0, 75, 1, 
+    0, 47, 0, 20, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 105, 109, 112, 
+    111, 114, 116, 101, 114, 95, 99, 97, 99, 104, 
+    101, 33, 2, 1, 30, 0, 5, 36, 1, 0, 
+    0, 0, 0, 0, 47, 1, 16, 0, 0, 0, 
+    0, 0, 0, 0, 95, 108, 101, 103, 97, 99, 
+    121, 95, 103, 101, 116, 95, 115, 112, 101, 99, 
+    35, 4, 5, 74, 4, 10, 2, 1, 0, 75, 
+    1, 0, 47, 0, 16, 0, 0, 0, 0, 0, 
+    0, 0, 95, 108, 101, 103, 97, 99, 121, 95, 
+    103, 101, 116, 95, 115, 112, 101, 99, 33, 2, 
+    1, 30, 0, 6, 30, 1, 7, 74, 0, 36, 
+    3, 1, 1, 0, 0, 0, 75, 1, 0, 47, 
+    3, 9, 0, 0, 0, 0, 0, 0, 0, 95, 
+    103, 101, 116, 95, 115, 112, 101, 99, 35, 1, 
+    6, 74, 1, 10, 2, 1, 0, 75, 1, 0, 
     47, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 110, 100, 95, 115, 112, 101, 99, 33, 
-    1, 1, 30, 0, 6, 30, 2, 9, 74, 0, 
-    36, 3, 2, 1, 0, 0, 0, 75, 1, 0, 
-    47, 3, 11, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 110, 100, 95, 109, 111, 100, 117, 108, 
-    101, 35, 2, 11, 0, 0, 0, 0, 0, 0, 
-    0, 102, 105, 110, 100, 95, 109, 111, 100, 117, 
-    108, 101, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 47, 0, 11, 0, 0, 0, 0, 0, 0, 
-    0, 102, 105, 110, 100, 95, 109, 111, 100, 117, 
-    108, 101, 33, 1, 1, 30, 0, 10, 36, 2, 
-    0, 0, 0, 0, 0, 47, 2, 18, 0, 0, 
-    0, 0, 0, 0, 0, 102, 105, 110, 100, 95, 
-    100, 105, 115, 116, 114, 105, 98, 117, 116, 105, 
-    111, 110, 115, 35, 4, 18, 0, 0, 0, 0, 
-    0, 0, 0, 102, 105, 110, 100, 95, 100, 105, 
-    115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 
-    115, 74, 4, 10, 1, 1, 0, 75, 1, 0, 
-    47, 0, 18, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 110, 100, 95, 100, 105, 115, 116, 114, 
-    105, 98, 117, 116, 105, 111, 110, 115, 17, 0, 
-    0, 0, 0, 29, 0, 0, 41, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    95, 103, 101, 116, 95, 115, 112, 101, 99, 33, 
+    1, 1, 30, 0, 6, 30, 2, 6, 30, 3, 
+    8, 74, 0, 74, 2, 36, 4, 3, 2, 0, 
+    0, 0, 75, 1, 0, 75, 1, 0, 47, 4, 
+    9, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
+    110, 100, 95, 115, 112, 101, 99, 35, 2, 7, 
+    74, 2, 10, 1, 1, 0, 75, 1, 0, 47, 
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
+    105, 110, 100, 95, 115, 112, 101, 99, 33, 1, 
+    1, 30, 0, 6, 30, 2, 9, 74, 0, 36, 
+    3, 2, 1, 0, 0, 0, 75, 1, 0, 47, 
+    3, 11, 0, 0, 0, 0, 0, 0, 0, 102, 
+    105, 110, 100, 95, 109, 111, 100, 117, 108, 101, 
+    35, 2, 8, 74, 2, 10, 1, 1, 0, 75, 
+    1, 0, 47, 0, 11, 0, 0, 0, 0, 0, 
+    0, 0, 102, 105, 110, 100, 95, 109, 111, 100, 
+    117, 108, 101, 33, 1, 1, 30, 0, 10, 36, 
+    2, 0, 0, 0, 0, 0, 47, 2, 18, 0, 
+    0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 
+    95, 100, 105, 115, 116, 114, 105, 98, 117, 116, 
+    105, 111, 110, 115, 35, 4, 9, 74, 4, 10, 
+    1, 1, 0, 75, 1, 0, 47, 0, 18, 0, 
+    0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 
+    95, 100, 105, 115, 116, 114, 105, 98, 117, 116, 
+    105, 111, 110, 115, 17, 0, 0, 0, 0, 29, 
+    0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    9, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    99, 108, 97, 115, 115, 95, 95, 11, 0, 0, 
-    0, 0, 0, 0, 0, 2, 10, 0, 0, 0, 
-    0, 0, 0, 0, 80, 97, 116, 104, 70, 105, 
-    110, 100, 101, 114, 2, 62, 0, 0, 0, 0, 
-    0, 0, 0, 77, 101, 116, 97, 32, 112, 97, 
-    116, 104, 32, 102, 105, 110, 100, 101, 114, 32, 
-    102, 111, 114, 32, 115, 121, 115, 46, 112, 97, 
-    116, 104, 32, 97, 110, 100, 32, 112, 97, 99, 
-    107, 97, 103, 101, 32, 95, 95, 112, 97, 116, 
-    104, 95, 95, 32, 97, 116, 116, 114, 105, 98, 
-    117, 116, 101, 115, 46, 2, 55, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 80, 97, 116, 104, 70, 105, 
-    110, 100, 101, 114, 46, 105, 110, 118, 97, 108, 
-    105, 100, 97, 116, 101, 95, 99, 97, 99, 104, 
-    101, 115, 46, 49, 51, 49, 57, 58, 52, 2, 
-    49, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 99, 108, 97, 115, 115, 95, 
+    95, 11, 0, 0, 0, 0, 0, 0, 0, 2, 
+    10, 0, 0, 0, 0, 0, 0, 0, 80, 97, 
+    116, 104, 70, 105, 110, 100, 101, 114, 2, 62, 
+    0, 0, 0, 0, 0, 0, 0, 77, 101, 116, 
+    97, 32, 112, 97, 116, 104, 32, 102, 105, 110, 
+    100, 101, 114, 32, 102, 111, 114, 32, 115, 121, 
+    115, 46, 112, 97, 116, 104, 32, 97, 110, 100, 
+    32, 112, 97, 99, 107, 97, 103, 101, 32, 95, 
+    95, 112, 97, 116, 104, 95, 95, 32, 97, 116, 
+    116, 114, 105, 98, 117, 116, 101, 115, 46, 2, 
+    55, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
     111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
     120, 116, 101, 114, 110, 97, 108, 46, 80, 97, 
-    116, 104, 70, 105, 110, 100, 101, 114, 46, 95, 
-    112, 97, 116, 104, 95, 104, 111, 111, 107, 115, 
-    46, 49, 51, 51, 50, 58, 52, 2, 58, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 80, 97, 116, 104, 
-    70, 105, 110, 100, 101, 114, 46, 95, 112, 97, 
-    116, 104, 95, 105, 109, 112, 111, 114, 116, 101, 
-    114, 95, 99, 97, 99, 104, 101, 46, 49, 51, 
-    52, 53, 58, 52, 2, 54, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 80, 97, 116, 104, 70, 105, 110, 
-    100, 101, 114, 46, 95, 108, 101, 103, 97, 99, 
-    121, 95, 103, 101, 116, 95, 115, 112, 101, 99, 
-    46, 49, 51, 54, 55, 58, 52, 5, 2, 47, 
+    116, 104, 70, 105, 110, 100, 101, 114, 46, 105, 
+    110, 118, 97, 108, 105, 100, 97, 116, 101, 95, 
+    99, 97, 99, 104, 101, 115, 46, 49, 51, 49, 
+    57, 58, 52, 2, 49, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 80, 97, 116, 104, 70, 105, 110, 100, 
+    101, 114, 46, 95, 112, 97, 116, 104, 95, 104, 
+    111, 111, 107, 115, 46, 49, 51, 51, 50, 58, 
+    52, 2, 58, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    80, 97, 116, 104, 70, 105, 110, 100, 101, 114, 
+    46, 95, 112, 97, 116, 104, 95, 105, 109, 112, 
+    111, 114, 116, 101, 114, 95, 99, 97, 99, 104, 
+    101, 46, 49, 51, 52, 53, 58, 52, 2, 54, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
     111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
     116, 101, 114, 110, 97, 108, 46, 80, 97, 116, 
-    104, 70, 105, 110, 100, 101, 114, 46, 95, 103, 
-    101, 116, 95, 115, 112, 101, 99, 46, 49, 51, 
-    56, 50, 58, 52, 2, 47, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 80, 97, 116, 104, 70, 105, 110, 
-    100, 101, 114, 46, 102, 105, 110, 100, 95, 115, 
-    112, 101, 99, 46, 49, 52, 49, 52, 58, 52, 
-    2, 49, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 80, 
-    97, 116, 104, 70, 105, 110, 100, 101, 114, 46, 
-    102, 105, 110, 100, 95, 109, 111, 100, 117, 108, 
-    101, 46, 49, 52, 51, 56, 58, 52, 2, 56, 
+    104, 70, 105, 110, 100, 101, 114, 46, 95, 108, 
+    101, 103, 97, 99, 121, 95, 103, 101, 116, 95, 
+    115, 112, 101, 99, 46, 49, 51, 54, 55, 58, 
+    52, 5, 2, 47, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 80, 97, 116, 104, 70, 105, 110, 100, 101, 
+    114, 46, 95, 103, 101, 116, 95, 115, 112, 101, 
+    99, 46, 49, 51, 56, 50, 58, 52, 2, 47, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
     111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
     116, 101, 114, 110, 97, 108, 46, 80, 97, 116, 
     104, 70, 105, 110, 100, 101, 114, 46, 102, 105, 
-    110, 100, 95, 100, 105, 115, 116, 114, 105, 98, 
-    117, 116, 105, 111, 110, 115, 46, 49, 52, 53, 
-    49, 58, 52, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 
+    110, 100, 95, 115, 112, 101, 99, 46, 49, 52, 
+    49, 52, 58, 52, 2, 49, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 80, 97, 116, 104, 70, 105, 110, 
+    100, 101, 114, 46, 102, 105, 110, 100, 95, 109, 
+    111, 100, 117, 108, 101, 46, 49, 52, 51, 56, 
+    58, 52, 2, 56, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 80, 97, 116, 104, 70, 105, 110, 100, 101, 
+    114, 46, 102, 105, 110, 100, 95, 100, 105, 115, 
+    116, 114, 105, 98, 117, 116, 105, 111, 110, 115, 
+    46, 49, 52, 53, 49, 58, 52, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 
-    0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 99, 108, 97, 115, 115, 95, 95, 80, 
-    97, 116, 104, 70, 105, 110, 100, 101, 114, 95, 
-    95, 2, 0, 0, 0, 0, 0, 0, 0, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 110, 
-    97, 109, 101, 95, 95, 11, 0, 0, 0, 0, 
-    0, 0, 0, 99, 108, 97, 115, 115, 109, 101, 
-    116, 104, 111, 100, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 
+    0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 99, 108, 97, 115, 
+    115, 95, 95, 80, 97, 116, 104, 70, 105, 110, 
+    100, 101, 114, 95, 95, 10, 0, 0, 0, 0, 
+    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 110, 97, 109, 101, 95, 95, 11, 
+    0, 0, 0, 0, 0, 0, 0, 99, 108, 97, 
+    115, 115, 109, 101, 116, 104, 111, 100, 17, 0, 
+    0, 0, 0, 0, 0, 0, 105, 110, 118, 97, 
+    108, 105, 100, 97, 116, 101, 95, 99, 97, 99, 
+    104, 101, 115, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 104, 111, 111, 
+    107, 115, 20, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 95, 105, 109, 112, 111, 
+    114, 116, 101, 114, 95, 99, 97, 99, 104, 101, 
+    16, 0, 0, 0, 0, 0, 0, 0, 95, 108, 
+    101, 103, 97, 99, 121, 95, 103, 101, 116, 95, 
+    115, 112, 101, 99, 9, 0, 0, 0, 0, 0, 
+    0, 0, 95, 103, 101, 116, 95, 115, 112, 101, 
+    99, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
+    105, 110, 100, 95, 115, 112, 101, 99, 11, 0, 
+    0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 
+    95, 109, 111, 100, 117, 108, 101, 18, 0, 0, 
+    0, 0, 0, 0, 0, 102, 105, 110, 100, 95, 
+    100, 105, 115, 116, 114, 105, 98, 117, 116, 105, 
+    111, 110, 115, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 95, 95, 99, 108, 97, 115, 115, 95, 
-    95, 95, 78, 97, 109, 101, 115, 112, 97, 99, 
-    101, 76, 111, 97, 100, 101, 114, 95, 95, 46, 
-    49, 50, 55, 51, 58, 48, 0, 37, 0, 0, 
-    0, 0, 0, 0, 0, 33, 0, 0, 47, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    109, 111, 100, 117, 108, 101, 95, 95, 30, 2, 
-    0, 47, 2, 12, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 113, 117, 97, 108, 110, 97, 109, 
-    101, 95, 95, 30, 1, 1, 36, 0, 1, 0, 
-    0, 0, 0, 47, 0, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 105, 110, 105, 116, 95, 
-    95, 33, 1, 1, 30, 0, 2, 36, 2, 0, 
-    0, 0, 0, 0, 47, 2, 11, 0, 0, 0, 
-    0, 0, 0, 0, 109, 111, 100, 117, 108, 101, 
-    95, 114, 101, 112, 114, 35, 4, 11, 0, 0, 
-    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
-    101, 95, 114, 101, 112, 114, 74, 4, 10, 1, 
-    1, 0, 75, 1, 0, 47, 0, 11, 0, 0, 
-    0, 0, 0, 0, 0, 109, 111, 100, 117, 108, 
-    101, 95, 114, 101, 112, 114, 30, 1, 3, 36, 
-    0, 1, 0, 0, 0, 0, 47, 0, 10, 0, 
-    0, 0, 0, 0, 0, 0, 105, 115, 95, 112, 
-    97, 99, 107, 97, 103, 101, 30, 1, 4, 36, 
-    0, 1, 0, 0, 0, 0, 47, 0, 10, 0, 
-    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
-    115, 111, 117, 114, 99, 101, 30, 1, 5, 36, 
-    0, 1, 0, 0, 0, 0, 47, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
-    99, 111, 100, 101, 30, 1, 6, 36, 0, 1, 
-    0, 0, 0, 0, 47, 0, 13, 0, 0, 0, 
-    0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 
-    95, 109, 111, 100, 117, 108, 101, 30, 1, 7, 
-    36, 0, 1, 0, 0, 0, 0, 47, 0, 11, 
-    0, 0, 0, 0, 0, 0, 0, 101, 120, 101, 
-    99, 95, 109, 111, 100, 117, 108, 101, 30, 1, 
-    8, 36, 0, 1, 0, 0, 0, 0, 47, 0, 
-    11, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
-    97, 100, 95, 109, 111, 100, 117, 108, 101, 17, 
-    0, 0, 0, 0, 29, 0, 0, 41, 0, 1, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 95, 95, 99, 108, 97, 115, 115, 95, 95, 
+    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
+    76, 111, 97, 100, 101, 114, 95, 95, 46, 49, 
+    50, 55, 51, 58, 48, 0, 37, 0, 0, 0, 
+    0, 0, 0, 0, 33, 0, 0, 47, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 109, 
+    111, 100, 117, 108, 101, 95, 95, 30, 2, 0, 
+    47, 2, 12, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 113, 117, 97, 108, 110, 97, 109, 101, 
+    95, 95, 30, 1, 1, 36, 0, 1, 0, 0, 
+    0, 0, 47, 0, 8, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 105, 110, 105, 116, 95, 95, 
+    33, 1, 1, 30, 0, 2, 36, 2, 0, 0, 
+    0, 0, 0, 47, 2, 11, 0, 0, 0, 0, 
+    0, 0, 0, 109, 111, 100, 117, 108, 101, 95, 
+    114, 101, 112, 114, 35, 4, 2, 74, 4, 10, 
+    1, 1, 0, 75, 1, 0, 47, 0, 11, 0, 
+    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
+    108, 101, 95, 114, 101, 112, 114, 30, 1, 3, 
+    36, 0, 1, 0, 0, 0, 0, 47, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 105, 115, 95, 
+    112, 97, 99, 107, 97, 103, 101, 30, 1, 4, 
+    36, 0, 1, 0, 0, 0, 0, 47, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    95, 115, 111, 117, 114, 99, 101, 30, 1, 5, 
+    36, 0, 1, 0, 0, 0, 0, 47, 0, 8, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    95, 99, 111, 100, 101, 30, 1, 6, 36, 0, 
+    1, 0, 0, 0, 0, 47, 0, 13, 0, 0, 
+    0, 0, 0, 0, 0, 99, 114, 101, 97, 116, 
+    101, 95, 109, 111, 100, 117, 108, 101, 30, 1, 
+    7, 36, 0, 1, 0, 0, 0, 0, 47, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 101, 120, 
+    101, 99, 95, 109, 111, 100, 117, 108, 101, 30, 
+    1, 8, 36, 0, 1, 0, 0, 0, 0, 47, 
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 108, 
+    111, 97, 100, 95, 109, 111, 100, 117, 108, 101, 
+    17, 0, 0, 0, 0, 29, 0, 0, 41, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 9, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 99, 108, 97, 115, 115, 95, 95, 9, 0, 
-    0, 0, 0, 0, 0, 0, 2, 16, 0, 0, 
-    0, 0, 0, 0, 0, 95, 78, 97, 109, 101, 
-    115, 112, 97, 99, 101, 76, 111, 97, 100, 101, 
-    114, 2, 52, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    9, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    99, 108, 97, 115, 115, 95, 95, 9, 0, 0, 
+    0, 0, 0, 0, 0, 2, 16, 0, 0, 0, 
+    0, 0, 0, 0, 95, 78, 97, 109, 101, 115, 
+    112, 97, 99, 101, 76, 111, 97, 100, 101, 114, 
+    2, 52, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
+    78, 97, 109, 101, 115, 112, 97, 99, 101, 76, 
+    111, 97, 100, 101, 114, 46, 95, 95, 105, 110, 
+    105, 116, 95, 95, 46, 49, 50, 55, 52, 58, 
+    52, 2, 55, 0, 0, 0, 0, 0, 0, 0, 
     95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
     95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
     95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
-    76, 111, 97, 100, 101, 114, 46, 95, 95, 105, 
-    110, 105, 116, 95, 95, 46, 49, 50, 55, 52, 
-    58, 52, 2, 55, 0, 0, 0, 0, 0, 0, 
+    76, 111, 97, 100, 101, 114, 46, 109, 111, 100, 
+    117, 108, 101, 95, 114, 101, 112, 114, 46, 49, 
+    50, 55, 55, 58, 52, 2, 54, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 95, 78, 97, 109, 101, 115, 
+    112, 97, 99, 101, 76, 111, 97, 100, 101, 114, 
+    46, 105, 115, 95, 112, 97, 99, 107, 97, 103, 
+    101, 46, 49, 50, 56, 54, 58, 52, 2, 54, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 95, 78, 97, 
+    109, 101, 115, 112, 97, 99, 101, 76, 111, 97, 
+    100, 101, 114, 46, 103, 101, 116, 95, 115, 111, 
+    117, 114, 99, 101, 46, 49, 50, 56, 57, 58, 
+    52, 2, 52, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
+    76, 111, 97, 100, 101, 114, 46, 103, 101, 116, 
+    95, 99, 111, 100, 101, 46, 49, 50, 57, 50, 
+    58, 52, 2, 57, 0, 0, 0, 0, 0, 0, 
     0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
     112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
     46, 95, 78, 97, 109, 101, 115, 112, 97, 99, 
-    101, 76, 111, 97, 100, 101, 114, 46, 109, 111, 
-    100, 117, 108, 101, 95, 114, 101, 112, 114, 46, 
-    49, 50, 55, 55, 58, 52, 2, 54, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
-    115, 112, 97, 99, 101, 76, 111, 97, 100, 101, 
-    114, 46, 105, 115, 95, 112, 97, 99, 107, 97, 
-    103, 101, 46, 49, 50, 56, 54, 58, 52, 2, 
-    54, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 95, 78, 
-    97, 109, 101, 115, 112, 97, 99, 101, 76, 111, 
-    97, 100, 101, 114, 46, 103, 101, 116, 95, 115, 
-    111, 117, 114, 99, 101, 46, 49, 50, 56, 57, 
-    58, 52, 2, 52, 0, 0, 0, 0, 0, 0, 
+    101, 76, 111, 97, 100, 101, 114, 46, 99, 114, 
+    101, 97, 116, 101, 95, 109, 111, 100, 117, 108, 
+    101, 46, 49, 50, 57, 53, 58, 52, 2, 55, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 95, 78, 97, 
+    109, 101, 115, 112, 97, 99, 101, 76, 111, 97, 
+    100, 101, 114, 46, 101, 120, 101, 99, 95, 109, 
+    111, 100, 117, 108, 101, 46, 49, 50, 57, 56, 
+    58, 52, 2, 55, 0, 0, 0, 0, 0, 0, 
     0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
     112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
     46, 95, 78, 97, 109, 101, 115, 112, 97, 99, 
-    101, 76, 111, 97, 100, 101, 114, 46, 103, 101, 
-    116, 95, 99, 111, 100, 101, 46, 49, 50, 57, 
-    50, 58, 52, 2, 57, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 95, 78, 97, 109, 101, 115, 112, 97, 
-    99, 101, 76, 111, 97, 100, 101, 114, 46, 99, 
-    114, 101, 97, 116, 101, 95, 109, 111, 100, 117, 
-    108, 101, 46, 49, 50, 57, 53, 58, 52, 2, 
-    55, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 95, 78, 
-    97, 109, 101, 115, 112, 97, 99, 101, 76, 111, 
-    97, 100, 101, 114, 46, 101, 120, 101, 99, 95, 
-    109, 111, 100, 117, 108, 101, 46, 49, 50, 57, 
-    56, 58, 52, 2, 55, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 95, 78, 97, 109, 101, 115, 112, 97, 
-    99, 101, 76, 111, 97, 100, 101, 114, 46, 108, 
-    111, 97, 100, 95, 109, 111, 100, 117, 108, 101, 
-    46, 49, 51, 48, 49, 58, 52, 0, 0, 0, 
+    101, 76, 111, 97, 100, 101, 114, 46, 108, 111, 
+    97, 100, 95, 109, 111, 100, 117, 108, 101, 46, 
+    49, 51, 48, 49, 58, 52, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 
+    0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 99, 108, 97, 115, 
-    115, 95, 95, 95, 78, 97, 109, 101, 115, 112, 
-    97, 99, 101, 76, 111, 97, 100, 101, 114, 95, 
-    95, 2, 0, 0, 0, 0, 0, 0, 0, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 110, 
-    97, 109, 101, 95, 95, 11, 0, 0, 0, 0, 
-    0, 0, 0, 99, 108, 97, 115, 115, 109, 101, 
-    116, 104, 111, 100, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 99, 108, 97, 115, 115, 
+    95, 95, 95, 78, 97, 109, 101, 115, 112, 97, 
+    99, 101, 76, 111, 97, 100, 101, 114, 95, 95, 
+    3, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 110, 97, 
+    109, 101, 95, 95, 11, 0, 0, 0, 0, 0, 
+    0, 0, 99, 108, 97, 115, 115, 109, 101, 116, 
+    104, 111, 100, 11, 0, 0, 0, 0, 0, 0, 
+    0, 109, 111, 100, 117, 108, 101, 95, 114, 101, 
+    112, 114, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 95, 95, 99, 108, 97, 115, 115, 95, 
-    95, 69, 120, 116, 101, 110, 115, 105, 111, 110, 
-    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
-    95, 95, 46, 49, 49, 52, 54, 58, 48, 0, 
-    41, 0, 0, 0, 0, 0, 0, 0, 33, 0, 
-    0, 47, 0, 10, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 109, 111, 100, 117, 108, 101, 95, 
-    95, 30, 2, 0, 47, 2, 12, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 113, 117, 97, 108, 
-    110, 97, 109, 101, 95, 95, 30, 1, 1, 30, 
-    0, 2, 36, 1, 0, 0, 0, 0, 0, 47, 
-    1, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 105, 110, 105, 116, 95, 95, 30, 0, 3, 
-    36, 1, 0, 0, 0, 0, 0, 47, 1, 6, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 101, 
-    113, 95, 95, 30, 0, 4, 36, 1, 0, 0, 
-    0, 0, 0, 47, 1, 8, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 104, 97, 115, 104, 95, 
-    95, 30, 0, 5, 36, 1, 0, 0, 0, 0, 
-    0, 47, 1, 13, 0, 0, 0, 0, 0, 0, 
-    0, 99, 114, 101, 97, 116, 101, 95, 109, 111, 
-    100, 117, 108, 101, 30, 0, 6, 36, 1, 0, 
-    0, 0, 0, 0, 47, 1, 11, 0, 0, 0, 
-    0, 0, 0, 0, 101, 120, 101, 99, 95, 109, 
-    111, 100, 117, 108, 101, 30, 0, 7, 36, 1, 
-    0, 0, 0, 0, 0, 47, 1, 10, 0, 0, 
-    0, 0, 0, 0, 0, 105, 115, 95, 112, 97, 
-    99, 107, 97, 103, 101, 30, 0, 8, 36, 1, 
-    0, 0, 0, 0, 0, 47, 1, 8, 0, 0, 
-    0, 0, 0, 0, 0, 103, 101, 116, 95, 99, 
-    111, 100, 101, 30, 0, 9, 36, 1, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    95, 95, 99, 108, 97, 115, 115, 95, 95, 69, 
+    120, 116, 101, 110, 115, 105, 111, 110, 70, 105, 
+    108, 101, 76, 111, 97, 100, 101, 114, 95, 95, 
+    46, 49, 49, 52, 54, 58, 48, 0, 41, 0, 
+    0, 0, 0, 0, 0, 0, 33, 0, 0, 47, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 109, 111, 100, 117, 108, 101, 95, 95, 30, 
+    2, 0, 47, 2, 12, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 113, 117, 97, 108, 110, 97, 
+    109, 101, 95, 95, 30, 1, 1, 30, 0, 2, 
+    36, 1, 0, 0, 0, 0, 0, 47, 1, 8, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 
+    110, 105, 116, 95, 95, 30, 0, 3, 36, 1, 
+    0, 0, 0, 0, 0, 47, 1, 6, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 101, 113, 95, 
+    95, 30, 0, 4, 36, 1, 0, 0, 0, 0, 
+    0, 47, 1, 8, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 104, 97, 115, 104, 95, 95, 30, 
+    0, 5, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 13, 0, 0, 0, 0, 0, 0, 0, 99, 
+    114, 101, 97, 116, 101, 95, 109, 111, 100, 117, 
+    108, 101, 30, 0, 6, 36, 1, 0, 0, 0, 
+    0, 0, 47, 1, 11, 0, 0, 0, 0, 0, 
+    0, 0, 101, 120, 101, 99, 95, 109, 111, 100, 
+    117, 108, 101, 30, 0, 7, 36, 1, 0, 0, 
     0, 0, 0, 47, 1, 10, 0, 0, 0, 0, 
-    0, 0, 0, 103, 101, 116, 95, 115, 111, 117, 
-    114, 99, 101, 33, 3, 1, 30, 0, 10, 36, 
-    1, 0, 0, 0, 0, 0, 47, 1, 12, 0, 
-    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
-    102, 105, 108, 101, 110, 97, 109, 101, 35, 4, 
+    0, 0, 0, 105, 115, 95, 112, 97, 99, 107, 
+    97, 103, 101, 30, 0, 8, 36, 1, 0, 0, 
+    0, 0, 0, 47, 1, 8, 0, 0, 0, 0, 
+    0, 0, 0, 103, 101, 116, 95, 99, 111, 100, 
+    101, 30, 0, 9, 36, 1, 0, 0, 0, 0, 
+    0, 47, 1, 10, 0, 0, 0, 0, 0, 0, 
+    0, 103, 101, 116, 95, 115, 111, 117, 114, 99, 
+    101, 33, 3, 1, 30, 0, 10, 36, 1, 0, 
+    0, 0, 0, 0, 47, 1, 12, 0, 0, 0, 
+    0, 0, 0, 0, 103, 101, 116, 95, 102, 105, 
+    108, 101, 110, 97, 109, 101, 35, 4, 2, 74, 
+    4, 10, 3, 1, 0, 75, 1, 0, 47, 0, 
     12, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
     116, 95, 102, 105, 108, 101, 110, 97, 109, 101, 
-    74, 4, 10, 3, 1, 0, 75, 1, 0, 47, 
-    0, 12, 0, 0, 0, 0, 0, 0, 0, 103, 
-    101, 116, 95, 102, 105, 108, 101, 110, 97, 109, 
-    101, 17, 0, 0, 0, 0, 29, 0, 0, 41, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 29, 0, 0, 41, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 99, 108, 97, 115, 115, 95, 95, 
-    11, 0, 0, 0, 0, 0, 0, 0, 2, 19, 
-    0, 0, 0, 0, 0, 0, 0, 69, 120, 116, 
-    101, 110, 115, 105, 111, 110, 70, 105, 108, 101, 
-    76, 111, 97, 100, 101, 114, 2, 93, 0, 0, 
-    0, 0, 0, 0, 0, 76, 111, 97, 100, 101, 
-    114, 32, 102, 111, 114, 32, 101, 120, 116, 101, 
-    110, 115, 105, 111, 110, 32, 109, 111, 100, 117, 
-    108, 101, 115, 46, 10, 10, 32, 32, 32, 32, 
-    84, 104, 101, 32, 99, 111, 110, 115, 116, 114, 
-    117, 99, 116, 111, 114, 32, 105, 115, 32, 100, 
-    101, 115, 105, 103, 110, 101, 100, 32, 116, 111, 
-    32, 119, 111, 114, 107, 32, 119, 105, 116, 104, 
-    32, 70, 105, 108, 101, 70, 105, 110, 100, 101, 
-    114, 46, 10, 10, 32, 32, 32, 32, 2, 55, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 69, 120, 116, 
-    101, 110, 115, 105, 111, 110, 70, 105, 108, 101, 
-    76, 111, 97, 100, 101, 114, 46, 95, 95, 105, 
-    110, 105, 116, 95, 95, 46, 49, 49, 53, 52, 
-    58, 52, 2, 53, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 69, 120, 116, 101, 110, 115, 105, 111, 110, 
-    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
-    46, 95, 95, 101, 113, 95, 95, 46, 49, 49, 
-    54, 51, 58, 52, 2, 55, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    9, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    99, 108, 97, 115, 115, 95, 95, 11, 0, 0, 
+    0, 0, 0, 0, 0, 2, 19, 0, 0, 0, 
+    0, 0, 0, 0, 69, 120, 116, 101, 110, 115, 
+    105, 111, 110, 70, 105, 108, 101, 76, 111, 97, 
+    100, 101, 114, 2, 93, 0, 0, 0, 0, 0, 
+    0, 0, 76, 111, 97, 100, 101, 114, 32, 102, 
+    111, 114, 32, 101, 120, 116, 101, 110, 115, 105, 
+    111, 110, 32, 109, 111, 100, 117, 108, 101, 115, 
+    46, 10, 10, 32, 32, 32, 32, 84, 104, 101, 
+    32, 99, 111, 110, 115, 116, 114, 117, 99, 116, 
+    111, 114, 32, 105, 115, 32, 100, 101, 115, 105, 
+    103, 110, 101, 100, 32, 116, 111, 32, 119, 111, 
+    114, 107, 32, 119, 105, 116, 104, 32, 70, 105, 
+    108, 101, 70, 105, 110, 100, 101, 114, 46, 10, 
+    10, 32, 32, 32, 32, 2, 55, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 69, 120, 116, 101, 110, 115, 
+    105, 111, 110, 70, 105, 108, 101, 76, 111, 97, 
+    100, 101, 114, 46, 95, 95, 105, 110, 105, 116, 
+    95, 95, 46, 49, 49, 53, 52, 58, 52, 2, 
+    53, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 69, 120, 
+    116, 101, 110, 115, 105, 111, 110, 70, 105, 108, 
+    101, 76, 111, 97, 100, 101, 114, 46, 95, 95, 
+    101, 113, 95, 95, 46, 49, 49, 54, 51, 58, 
+    52, 2, 55, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    69, 120, 116, 101, 110, 115, 105, 111, 110, 70, 
+    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
+    95, 95, 104, 97, 115, 104, 95, 95, 46, 49, 
+    49, 54, 55, 58, 52, 2, 60, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 69, 120, 116, 101, 110, 115, 
+    105, 111, 110, 70, 105, 108, 101, 76, 111, 97, 
+    100, 101, 114, 46, 99, 114, 101, 97, 116, 101, 
+    95, 109, 111, 100, 117, 108, 101, 46, 49, 49, 
+    55, 48, 58, 52, 2, 58, 0, 0, 0, 0, 
     0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
     114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
     97, 108, 46, 69, 120, 116, 101, 110, 115, 105, 
     111, 110, 70, 105, 108, 101, 76, 111, 97, 100, 
-    101, 114, 46, 95, 95, 104, 97, 115, 104, 95, 
-    95, 46, 49, 49, 54, 55, 58, 52, 2, 60, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 69, 120, 116, 
-    101, 110, 115, 105, 111, 110, 70, 105, 108, 101, 
-    76, 111, 97, 100, 101, 114, 46, 99, 114, 101, 
-    97, 116, 101, 95, 109, 111, 100, 117, 108, 101, 
-    46, 49, 49, 55, 48, 58, 52, 2, 58, 0, 
+    101, 114, 46, 101, 120, 101, 99, 95, 109, 111, 
+    100, 117, 108, 101, 46, 49, 49, 55, 56, 58, 
+    52, 2, 57, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    69, 120, 116, 101, 110, 115, 105, 111, 110, 70, 
+    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
+    105, 115, 95, 112, 97, 99, 107, 97, 103, 101, 
+    46, 49, 49, 56, 52, 58, 52, 2, 55, 0, 
     0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
     116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
     101, 114, 110, 97, 108, 46, 69, 120, 116, 101, 
     110, 115, 105, 111, 110, 70, 105, 108, 101, 76, 
-    111, 97, 100, 101, 114, 46, 101, 120, 101, 99, 
-    95, 109, 111, 100, 117, 108, 101, 46, 49, 49, 
-    55, 56, 58, 52, 2, 57, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 69, 120, 116, 101, 110, 115, 105, 
-    111, 110, 70, 105, 108, 101, 76, 111, 97, 100, 
-    101, 114, 46, 105, 115, 95, 112, 97, 99, 107, 
-    97, 103, 101, 46, 49, 49, 56, 52, 58, 52, 
-    2, 55, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 69, 
-    120, 116, 101, 110, 115, 105, 111, 110, 70, 105, 
-    108, 101, 76, 111, 97, 100, 101, 114, 46, 103, 
-    101, 116, 95, 99, 111, 100, 101, 46, 49, 49, 
-    57, 48, 58, 52, 2, 57, 0, 0, 0, 0, 
+    111, 97, 100, 101, 114, 46, 103, 101, 116, 95, 
+    99, 111, 100, 101, 46, 49, 49, 57, 48, 58, 
+    52, 2, 57, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    69, 120, 116, 101, 110, 115, 105, 111, 110, 70, 
+    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
+    103, 101, 116, 95, 115, 111, 117, 114, 99, 101, 
+    46, 49, 49, 57, 52, 58, 52, 2, 59, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 69, 120, 116, 101, 
+    110, 115, 105, 111, 110, 70, 105, 108, 101, 76, 
+    111, 97, 100, 101, 114, 46, 103, 101, 116, 95, 
+    102, 105, 108, 101, 110, 97, 109, 101, 46, 49, 
+    49, 57, 56, 58, 52, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 99, 108, 97, 115, 115, 95, 
+    95, 69, 120, 116, 101, 110, 115, 105, 111, 110, 
+    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
+    95, 95, 3, 0, 0, 0, 0, 0, 0, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    110, 97, 109, 101, 95, 95, 11, 0, 0, 0, 
+    0, 0, 0, 0, 95, 99, 104, 101, 99, 107, 
+    95, 110, 97, 109, 101, 12, 0, 0, 0, 0, 
+    0, 0, 0, 103, 101, 116, 95, 102, 105, 108, 
+    101, 110, 97, 109, 101, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 
     0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
     114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 69, 120, 116, 101, 110, 115, 105, 
-    111, 110, 70, 105, 108, 101, 76, 111, 97, 100, 
-    101, 114, 46, 103, 101, 116, 95, 115, 111, 117, 
-    114, 99, 101, 46, 49, 49, 57, 52, 58, 52, 
-    2, 59, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 69, 
-    120, 116, 101, 110, 115, 105, 111, 110, 70, 105, 
-    108, 101, 76, 111, 97, 100, 101, 114, 46, 103, 
-    101, 116, 95, 102, 105, 108, 101, 110, 97, 109, 
-    101, 46, 49, 49, 57, 56, 58, 52, 0, 0, 
+    97, 108, 46, 95, 95, 99, 108, 97, 115, 115, 
+    95, 95, 83, 111, 117, 114, 99, 101, 70, 105, 
+    108, 101, 76, 111, 97, 100, 101, 114, 95, 95, 
+    46, 49, 48, 55, 50, 58, 48, 0, 20, 0, 
+    0, 0, 0, 0, 0, 0, 33, 0, 0, 47, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 109, 111, 100, 117, 108, 101, 95, 95, 30, 
+    2, 0, 47, 2, 12, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 113, 117, 97, 108, 110, 97, 
+    109, 101, 95, 95, 30, 1, 1, 30, 0, 2, 
+    36, 1, 0, 0, 0, 0, 0, 47, 1, 10, 
+    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
+    104, 95, 115, 116, 97, 116, 115, 30, 0, 3, 
+    36, 1, 0, 0, 0, 0, 0, 47, 1, 15, 
+    0, 0, 0, 0, 0, 0, 0, 95, 99, 97, 
+    99, 104, 101, 95, 98, 121, 116, 101, 99, 111, 
+    100, 101, 30, 0, 4, 30, 1, 5, 74, 0, 
+    36, 2, 1, 0, 1, 0, 0, 75, 1, 0, 
+    47, 2, 8, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 116, 95, 100, 97, 116, 97, 17, 0, 
+    0, 0, 0, 29, 0, 0, 41, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 99, 108, 97, 
-    115, 115, 95, 95, 69, 120, 116, 101, 110, 115, 
-    105, 111, 110, 70, 105, 108, 101, 76, 111, 97, 
-    100, 101, 114, 95, 95, 2, 0, 0, 0, 0, 
-    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 110, 97, 109, 101, 95, 95, 11, 
-    0, 0, 0, 0, 0, 0, 0, 95, 99, 104, 
-    101, 99, 107, 95, 110, 97, 109, 101, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 99, 108, 
+    97, 115, 115, 95, 95, 6, 0, 0, 0, 0, 
+    0, 0, 0, 2, 16, 0, 0, 0, 0, 0, 
+    0, 0, 83, 111, 117, 114, 99, 101, 70, 105, 
+    108, 101, 76, 111, 97, 100, 101, 114, 2, 62, 
+    0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 
+    99, 114, 101, 116, 101, 32, 105, 109, 112, 108, 
+    101, 109, 101, 110, 116, 97, 116, 105, 111, 110, 
+    32, 111, 102, 32, 83, 111, 117, 114, 99, 101, 
+    76, 111, 97, 100, 101, 114, 32, 117, 115, 105, 
+    110, 103, 32, 116, 104, 101, 32, 102, 105, 108, 
+    101, 32, 115, 121, 115, 116, 101, 109, 46, 2, 
+    54, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 83, 111, 
+    117, 114, 99, 101, 70, 105, 108, 101, 76, 111, 
+    97, 100, 101, 114, 46, 112, 97, 116, 104, 95, 
+    115, 116, 97, 116, 115, 46, 49, 48, 55, 54, 
+    58, 52, 2, 59, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 83, 111, 117, 114, 99, 101, 70, 105, 108, 
+    101, 76, 111, 97, 100, 101, 114, 46, 95, 99, 
+    97, 99, 104, 101, 95, 98, 121, 116, 101, 99, 
+    111, 100, 101, 46, 49, 48, 56, 49, 58, 52, 
+    0, 182, 1, 0, 0, 0, 0, 0, 0, 2, 
+    52, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 83, 111, 
+    117, 114, 99, 101, 70, 105, 108, 101, 76, 111, 
+    97, 100, 101, 114, 46, 115, 101, 116, 95, 100, 
+    97, 116, 97, 46, 49, 48, 56, 54, 58, 52, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 54, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 27, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 99, 
+    108, 97, 115, 115, 95, 95, 83, 111, 117, 114, 
+    99, 101, 70, 105, 108, 101, 76, 111, 97, 100, 
+    101, 114, 95, 95, 1, 0, 0, 0, 0, 0, 
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 110, 97, 109, 101, 95, 95, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 50, 0, 
     0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
     116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 95, 95, 99, 108, 
-    97, 115, 115, 95, 95, 83, 111, 117, 114, 99, 
-    101, 70, 105, 108, 101, 76, 111, 97, 100, 101, 
-    114, 95, 95, 46, 49, 48, 55, 50, 58, 48, 
-    0, 20, 0, 0, 0, 0, 0, 0, 0, 33, 
-    0, 0, 47, 0, 10, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 109, 111, 100, 117, 108, 101, 
-    95, 95, 30, 2, 0, 47, 2, 12, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 113, 117, 97, 
-    108, 110, 97, 109, 101, 95, 95, 30, 1, 1, 
-    30, 0, 2, 36, 1, 0, 0, 0, 0, 0, 
-    47, 1, 10, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 95, 115, 116, 97, 116, 115, 
-    30, 0, 3, 36, 1, 0, 0, 0, 0, 0, 
-    47, 1, 15, 0, 0, 0, 0, 0, 0, 0, 
-    95, 99, 97, 99, 104, 101, 95, 98, 121, 116, 
-    101, 99, 111, 100, 101, 30, 0, 4, 30, 1, 
-    5, 74, 0, 36, 2, 1, 0, 1, 0, 0, 
-    75, 1, 0, 47, 2, 8, 0, 0, 0, 0, 
-    0, 0, 0, 115, 101, 116, 95, 100, 97, 116, 
-    97, 17, 0, 0, 0, 0, 29, 0, 0, 41, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    101, 114, 110, 97, 108, 46, 70, 105, 108, 101, 
+    76, 111, 97, 100, 101, 114, 46, 103, 101, 116, 
+    95, 102, 105, 108, 101, 110, 97, 109, 101, 46, 
+    49, 48, 51, 48, 58, 52, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 32, 1, 
+    0, 27, 0, 1, 0, 41, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 99, 108, 97, 115, 115, 95, 95, 
-    6, 0, 0, 0, 0, 0, 0, 0, 2, 16, 
-    0, 0, 0, 0, 0, 0, 0, 83, 111, 117, 
-    114, 99, 101, 70, 105, 108, 101, 76, 111, 97, 
-    100, 101, 114, 2, 62, 0, 0, 0, 0, 0, 
-    0, 0, 67, 111, 110, 99, 114, 101, 116, 101, 
-    32, 105, 109, 112, 108, 101, 109, 101, 110, 116, 
-    97, 116, 105, 111, 110, 32, 111, 102, 32, 83, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 58, 0, 
+    0, 0, 0, 0, 0, 0, 82, 101, 116, 117, 
+    114, 110, 32, 116, 104, 101, 32, 112, 97, 116, 
+    104, 32, 116, 111, 32, 116, 104, 101, 32, 115, 
+    111, 117, 114, 99, 101, 32, 102, 105, 108, 101, 
+    32, 97, 115, 32, 102, 111, 117, 110, 100, 32, 
+    98, 121, 32, 116, 104, 101, 32, 102, 105, 110, 
+    100, 101, 114, 46, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 
+    0, 103, 101, 116, 95, 102, 105, 108, 101, 110, 
+    97, 109, 101, 1, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 8, 0, 0, 0, 0, 0, 0, 0, 102, 
+    117, 108, 108, 110, 97, 109, 101, 32, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 47, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 83, 
     111, 117, 114, 99, 101, 76, 111, 97, 100, 101, 
-    114, 32, 117, 115, 105, 110, 103, 32, 116, 104, 
-    101, 32, 102, 105, 108, 101, 32, 115, 121, 115, 
-    116, 101, 109, 46, 2, 54, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 83, 111, 117, 114, 99, 101, 70, 
-    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
-    112, 97, 116, 104, 95, 115, 116, 97, 116, 115, 
-    46, 49, 48, 55, 54, 58, 52, 2, 59, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 83, 111, 117, 114, 
-    99, 101, 70, 105, 108, 101, 76, 111, 97, 100, 
-    101, 114, 46, 95, 99, 97, 99, 104, 101, 95, 
-    98, 121, 116, 101, 99, 111, 100, 101, 46, 49, 
-    48, 56, 49, 58, 52, 0, 182, 1, 0, 0, 
-    0, 0, 0, 0, 2, 52, 0, 0, 0, 0, 
+    114, 46, 115, 101, 116, 95, 100, 97, 116, 97, 
+    46, 56, 57, 48, 58, 52, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 30, 1, 
+    1, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 2, 150, 0, 0, 0, 0, 0, 
+    0, 0, 79, 112, 116, 105, 111, 110, 97, 108, 
+    32, 109, 101, 116, 104, 111, 100, 32, 119, 104, 
+    105, 99, 104, 32, 119, 114, 105, 116, 101, 115, 
+    32, 100, 97, 116, 97, 32, 40, 98, 121, 116, 
+    101, 115, 41, 32, 116, 111, 32, 97, 32, 102, 
+    105, 108, 101, 32, 112, 97, 116, 104, 32, 40, 
+    97, 32, 115, 116, 114, 41, 46, 10, 10, 32, 
+    32, 32, 32, 32, 32, 32, 32, 73, 109, 112, 
+    108, 101, 109, 101, 110, 116, 105, 110, 103, 32, 
+    116, 104, 105, 115, 32, 109, 101, 116, 104, 111, 
+    100, 32, 97, 108, 108, 111, 119, 115, 32, 102, 
+    111, 114, 32, 116, 104, 101, 32, 119, 114, 105, 
+    116, 105, 110, 103, 32, 111, 102, 32, 98, 121, 
+    116, 101, 99, 111, 100, 101, 32, 102, 105, 108, 
+    101, 115, 46, 10, 32, 32, 32, 32, 32, 32, 
+    32, 32, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 116, 95, 100, 97, 116, 97, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 4, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 116, 104, 4, 0, 0, 0, 
+    0, 0, 0, 0, 100, 97, 116, 97, 32, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    95, 112, 97, 116, 104, 95, 115, 112, 108, 105, 
+    116, 46, 49, 50, 54, 58, 48, 0, 52, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 33, 
+    1, 0, 30, 0, 1, 29, 2, 0, 74, 2, 
+    4, 3, 1, 75, 1, 0, 36, 4, 0, 0, 
+    0, 1, 3, 33, 2, 1, 74, 2, 10, 4, 
+    1, 0, 75, 1, 0, 74, 0, 74, 0, 10, 
+    1, 1, 0, 75, 1, 0, 39, 3, 0, 75, 
+    0, 0, 45, 1, 3, 32, 0, 1, 30, 1, 
+    2, 6, 2, 0, 1, 2, 79, 3, 2, 22, 
+    2, 20, 0, 0, 0, 31, 0, 0, 30, 1, 
+    3, 32, 2, 1, 30, 3, 3, 62, 4, 3, 
+    1, 2, 3, 1, 5, 0, 4, 31, 1, 0, 
+    32, 0, 1, 30, 2, 4, 0, 3, 0, 2, 
+    0, 30, 4, 3, 30, 0, 3, 62, 2, 3, 
+    3, 4, 0, 1, 6, 1, 2, 74, 5, 74, 
+    6, 4, 0, 2, 75, 1, 0, 75, 1, 0, 
+    41, 0, 30, 1, 5, 31, 0, 0, 74, 1, 
+    74, 0, 4, 2, 2, 75, 1, 173, 75, 1, 
+    0, 41, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 116, 104, 6, 0, 0, 0, 0, 
+    0, 0, 0, 2, 32, 0, 0, 0, 0, 0, 
+    0, 0, 82, 101, 112, 108, 97, 99, 101, 109, 
+    101, 110, 116, 32, 102, 111, 114, 32, 111, 115, 
+    46, 112, 97, 116, 104, 46, 115, 112, 108, 105, 
+    116, 40, 41, 46, 2, 48, 0, 0, 0, 0, 
     0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
     114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 83, 111, 117, 114, 99, 101, 70, 
-    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
-    115, 101, 116, 95, 100, 97, 116, 97, 46, 49, 
-    48, 56, 54, 58, 52, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 99, 108, 97, 115, 115, 95, 
-    95, 83, 111, 117, 114, 99, 101, 70, 105, 108, 
-    101, 76, 111, 97, 100, 101, 114, 95, 95, 1, 
-    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 110, 97, 109, 
-    101, 95, 95, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 70, 105, 108, 101, 76, 111, 97, 100, 101, 
-    114, 46, 103, 101, 116, 95, 102, 105, 108, 101, 
-    110, 97, 109, 101, 46, 49, 48, 51, 48, 58, 
-    52, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 32, 1, 0, 27, 0, 1, 0, 
-    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    97, 108, 46, 95, 112, 97, 116, 104, 95, 115, 
+    112, 108, 105, 116, 46, 60, 103, 101, 110, 101, 
+    120, 112, 114, 62, 46, 49, 50, 56, 58, 49, 
+    49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
     2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 2, 58, 0, 0, 0, 0, 
-    0, 0, 0, 82, 101, 116, 117, 114, 110, 32, 
-    116, 104, 101, 32, 112, 97, 116, 104, 32, 116, 
-    111, 32, 116, 104, 101, 32, 115, 111, 117, 114, 
-    99, 101, 32, 102, 105, 108, 101, 32, 97, 115, 
-    32, 102, 111, 117, 110, 100, 32, 98, 121, 32, 
-    116, 104, 101, 32, 102, 105, 110, 100, 101, 114, 
-    46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
+    0, 0, 0, 0, 0, 0, 95, 112, 97, 116, 
+    104, 95, 115, 112, 108, 105, 116, 2, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 109, 97, 120, 15, 0, 0, 0, 
+    0, 0, 0, 0, 112, 97, 116, 104, 95, 115, 
+    101, 112, 97, 114, 97, 116, 111, 114, 115, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 112, 97, 116, 104, 1, 0, 0, 
+    0, 0, 0, 0, 0, 105, 32, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    12, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
-    116, 95, 102, 105, 108, 101, 110, 97, 109, 101, 
-    1, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 101, 108, 102, 8, 0, 
-    0, 0, 0, 0, 0, 0, 102, 117, 108, 108, 
-    110, 97, 109, 101, 32, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 47, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 83, 111, 117, 114, 
-    99, 101, 76, 111, 97, 100, 101, 114, 46, 115, 
-    101, 116, 95, 100, 97, 116, 97, 46, 56, 57, 
+    55, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 69, 120, 
+    116, 101, 110, 115, 105, 111, 110, 70, 105, 108, 
+    101, 76, 111, 97, 100, 101, 114, 46, 103, 101, 
+    116, 95, 99, 111, 100, 101, 46, 49, 49, 57, 
     48, 58, 52, 0, 3, 0, 0, 0, 0, 0, 
     0, 0, 30, 0, 0, 30, 1, 1, 41, 1, 
-    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 2, 150, 0, 0, 0, 0, 0, 0, 
-    0, 79, 112, 116, 105, 111, 110, 97, 108, 32, 
-    109, 101, 116, 104, 111, 100, 32, 119, 104, 105, 
-    99, 104, 32, 119, 114, 105, 116, 101, 115, 32, 
-    100, 97, 116, 97, 32, 40, 98, 121, 116, 101, 
-    115, 41, 32, 116, 111, 32, 97, 32, 102, 105, 
-    108, 101, 32, 112, 97, 116, 104, 32, 40, 97, 
-    32, 115, 116, 114, 41, 46, 10, 10, 32, 32, 
-    32, 32, 32, 32, 32, 32, 73, 109, 112, 108, 
-    101, 109, 101, 110, 116, 105, 110, 103, 32, 116, 
-    104, 105, 115, 32, 109, 101, 116, 104, 111, 100, 
-    32, 97, 108, 108, 111, 119, 115, 32, 102, 111, 
-    114, 32, 116, 104, 101, 32, 119, 114, 105, 116, 
-    105, 110, 103, 32, 111, 102, 32, 98, 121, 116, 
-    101, 99, 111, 100, 101, 32, 102, 105, 108, 101, 
-    115, 46, 10, 32, 32, 32, 32, 32, 32, 32, 
-    32, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 8, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 116, 95, 100, 97, 116, 97, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 4, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 4, 0, 0, 0, 0, 
-    0, 0, 0, 100, 97, 116, 97, 32, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
-    0, 37, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
-    112, 97, 116, 104, 95, 115, 112, 108, 105, 116, 
-    46, 49, 50, 54, 58, 48, 0, 52, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
-    0, 30, 0, 1, 29, 2, 0, 74, 2, 4, 
-    3, 1, 75, 1, 0, 36, 4, 0, 0, 0, 
-    1, 3, 33, 2, 1, 74, 2, 10, 4, 1, 
-    0, 75, 1, 0, 74, 0, 74, 0, 10, 1, 
-    1, 0, 75, 1, 0, 39, 3, 0, 75, 0, 
-    0, 45, 1, 3, 32, 0, 1, 30, 1, 2, 
-    6, 2, 0, 1, 2, 79, 3, 2, 22, 2, 
-    20, 0, 0, 0, 31, 0, 0, 30, 1, 3, 
-    32, 2, 1, 30, 3, 3, 62, 4, 3, 1, 
-    2, 3, 1, 5, 0, 4, 31, 1, 0, 32, 
-    0, 1, 30, 2, 4, 0, 3, 0, 2, 0, 
-    30, 4, 3, 30, 0, 3, 62, 2, 3, 3, 
-    4, 0, 1, 6, 1, 2, 74, 5, 74, 6, 
-    4, 0, 2, 75, 1, 0, 75, 1, 0, 41, 
-    0, 30, 1, 5, 31, 0, 0, 74, 1, 74, 
-    0, 4, 2, 2, 75, 1, 173, 75, 1, 0, 
-    41, 2, 1, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 116, 104, 6, 0, 0, 0, 
-    0, 0, 0, 0, 2, 32, 0, 0, 0, 0, 
-    0, 0, 0, 82, 101, 112, 108, 97, 99, 101, 
-    109, 101, 110, 116, 32, 102, 111, 114, 32, 111, 
-    115, 46, 112, 97, 116, 104, 46, 115, 112, 108, 
-    105, 116, 40, 41, 46, 2, 48, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 95, 112, 97, 116, 104, 95, 
-    115, 112, 108, 105, 116, 46, 60, 103, 101, 110, 
-    101, 120, 112, 114, 62, 46, 49, 50, 56, 58, 
-    49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 63, 0, 0, 0, 0, 0, 0, 0, 82, 
+    101, 116, 117, 114, 110, 32, 78, 111, 110, 101, 
+    32, 97, 115, 32, 97, 110, 32, 101, 120, 116, 
+    101, 110, 115, 105, 111, 110, 32, 109, 111, 100, 
+    117, 108, 101, 32, 99, 97, 110, 110, 111, 116, 
+    32, 99, 114, 101, 97, 116, 101, 32, 97, 32, 
+    99, 111, 100, 101, 32, 111, 98, 106, 101, 99, 
+    116, 46, 5, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 10, 0, 0, 0, 0, 0, 0, 0, 11, 
-    0, 0, 0, 0, 0, 0, 0, 95, 112, 97, 
-    116, 104, 95, 115, 112, 108, 105, 116, 2, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 109, 97, 120, 15, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 95, 
-    115, 101, 112, 97, 114, 97, 116, 111, 114, 115, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 1, 0, 
-    0, 0, 0, 0, 0, 0, 105, 32, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 55, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 69, 
-    120, 116, 101, 110, 115, 105, 111, 110, 70, 105, 
-    108, 101, 76, 111, 97, 100, 101, 114, 46, 103, 
-    101, 116, 95, 99, 111, 100, 101, 46, 49, 49, 
-    57, 48, 58, 52, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 30, 1, 1, 41, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 2, 63, 0, 0, 0, 0, 0, 
-    0, 0, 82, 101, 116, 117, 114, 110, 32, 78, 
-    111, 110, 101, 32, 97, 115, 32, 97, 110, 32, 
-    101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 
-    109, 111, 100, 117, 108, 101, 32, 99, 97, 110, 
-    110, 111, 116, 32, 99, 114, 101, 97, 116, 101, 
-    32, 97, 32, 99, 111, 100, 101, 32, 111, 98, 
-    106, 101, 99, 116, 46, 5, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    103, 101, 116, 95, 99, 111, 100, 101, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 8, 0, 0, 0, 0, 0, 
+    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
+    33, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
+    0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 95, 76, 111, 97, 100, 101, 114, 66, 
+    97, 115, 105, 99, 115, 46, 101, 120, 101, 99, 
+    95, 109, 111, 100, 117, 108, 101, 46, 56, 52, 
+    51, 58, 52, 0, 34, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 32, 1, 0, 34, 2, 
+    1, 3, 1, 32, 32, 3, 1, 27, 1, 3, 
+    6, 38, 2, 32, 1, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 
+    2, 0, 32, 1, 2, 30, 0, 1, 6, 2, 
+    1, 0, 6, 79, 3, 2, 19, 2, 13, 0, 
+    0, 0, 33, 1, 0, 30, 0, 2, 34, 2, 
+    0, 4, 1, 32, 32, 3, 1, 27, 4, 3, 
+    6, 38, 2, 32, 1, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 
+    0, 74, 0, 10, 1, 1, 0, 75, 1, 0, 
+    39, 3, 0, 75, 0, 0, 40, 1, 3, 33, 
+    0, 1, 34, 1, 0, 5, 1, 32, 33, 2, 
+    2, 32, 3, 2, 32, 4, 1, 27, 5, 4, 
+    7, 38, 1, 32, 3, 0, 0, 0, 0, 0, 
+    0, 0, 2, 3, 5, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 30, 4, 1, 41, 4, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 
-    0, 0, 0, 103, 101, 116, 95, 99, 111, 100, 
-    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 115, 101, 108, 102, 8, 0, 0, 
-    0, 0, 0, 0, 0, 102, 117, 108, 108, 110, 
-    97, 109, 101, 32, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 10, 
-    0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 76, 111, 97, 100, 
-    101, 114, 66, 97, 115, 105, 99, 115, 46, 101, 
-    120, 101, 99, 95, 109, 111, 100, 117, 108, 101, 
-    46, 56, 52, 51, 58, 52, 0, 44, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 32, 1, 
-    0, 34, 2, 1, 3, 32, 3, 1, 27, 1, 
-    3, 6, 74, 1, 10, 2, 1, 0, 75, 1, 
-    0, 45, 2, 0, 32, 1, 2, 30, 0, 1, 
-    6, 2, 1, 0, 6, 79, 3, 2, 19, 2, 
-    15, 0, 0, 0, 33, 1, 0, 30, 0, 2, 
-    34, 2, 0, 4, 32, 3, 1, 27, 4, 3, 
-    6, 74, 4, 10, 2, 1, 0, 75, 1, 0, 
-    74, 0, 74, 0, 10, 1, 1, 0, 75, 1, 
-    0, 39, 3, 0, 75, 0, 0, 40, 1, 3, 
-    33, 0, 1, 34, 1, 0, 5, 33, 2, 2, 
-    32, 3, 2, 32, 4, 1, 27, 5, 4, 7, 
-    74, 2, 74, 3, 74, 5, 10, 1, 3, 0, 
-    75, 1, 0, 75, 1, 0, 75, 1, 0, 30, 
-    4, 1, 41, 4, 0, 0, 0, 0, 0, 0, 
     0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
     0, 0, 0, 0, 0, 0, 2, 19, 0, 0, 
@@ -1434,55 +1433,65 @@ std::vector<uint8_t> _bootstrap_external
     4, 10, 1, 3, 0, 75, 1, 0, 75, 1, 
     0, 75, 1, 172, 32, 5, 0, 43, 5, 0, 
     1, 30, 1, 0, 41, 1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    7, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 105, 110, 
-    105, 116, 95, 95, 2, 0, 0, 0, 0, 0, 
-    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 
-    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
-    80, 97, 116, 104, 5, 0, 0, 0, 0, 0, 
-    0, 0, 95, 112, 97, 116, 104, 0, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 
+    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 105, 110, 105, 116, 
+    95, 95, 2, 0, 0, 0, 0, 0, 0, 0, 
+    14, 0, 0, 0, 0, 0, 0, 0, 95, 78, 
+    97, 109, 101, 115, 112, 97, 99, 101, 80, 97, 
+    116, 104, 5, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 0, 0, 0, 0, 0, 
     0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 101, 108, 102, 4, 0, 0, 0, 0, 
-    0, 0, 0, 110, 97, 109, 101, 4, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 11, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
-    104, 95, 102, 105, 110, 100, 101, 114, 32, 0, 
-    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
-    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 
-    0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    95, 99, 111, 100, 101, 95, 116, 111, 95, 104, 
-    97, 115, 104, 95, 112, 121, 99, 46, 54, 54, 
-    55, 58, 48, 0, 60, 0, 0, 0, 0, 0, 
-    0, 0, 30, 0, 0, 33, 1, 0, 33, 2, 
-    1, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
-    45, 3, 0, 30, 1, 1, 32, 0, 2, 30, 
-    2, 1, 0, 3, 0, 2, 7, 0, 4, 1, 
-    3, 10, 45, 4, 4, 32, 1, 3, 34, 2, 
-    1, 5, 33, 3, 2, 32, 1, 4, 74, 1, 
-    10, 3, 1, 0, 75, 1, 0, 74, 0, 74, 
-    0, 10, 2, 1, 0, 75, 1, 0, 39, 4, 
-    0, 75, 0, 0, 33, 1, 3, 32, 2, 1, 
-    74, 2, 10, 1, 1, 0, 75, 1, 0, 30, 
-    3, 2, 6, 1, 0, 3, 0, 79, 2, 1, 
-    22, 1, 3, 0, 0, 0, 26, 2, 10, 2, 
-    0, 0, 40, 1, 0, 32, 1, 3, 34, 2, 
-    1, 5, 32, 3, 1, 74, 3, 10, 2, 1, 
-    0, 75, 1, 0, 32, 1, 3, 34, 2, 1, 
-    5, 33, 0, 4, 34, 1, 0, 6, 32, 3, 
-    0, 74, 3, 10, 1, 1, 0, 75, 1, 0, 
-    74, 0, 74, 0, 10, 2, 1, 0, 75, 1, 
-    0, 39, 4, 0, 75, 0, 0, 32, 1, 3, 
-    41, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+    101, 108, 102, 4, 0, 0, 0, 0, 0, 0, 
+    0, 110, 97, 109, 101, 4, 0, 0, 0, 0, 
+    0, 0, 0, 112, 97, 116, 104, 11, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 95, 
+    102, 105, 110, 100, 101, 114, 34, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 
+    43, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 95, 99, 
+    111, 100, 101, 95, 116, 111, 95, 104, 97, 115, 
+    104, 95, 112, 121, 99, 46, 54, 54, 55, 58, 
+    48, 0, 52, 0, 0, 0, 0, 0, 0, 0, 
+    30, 0, 0, 33, 1, 0, 33, 2, 1, 74, 
+    2, 10, 1, 1, 0, 75, 1, 0, 45, 3, 
+    0, 30, 1, 1, 32, 0, 2, 30, 2, 1, 
+    0, 3, 0, 2, 7, 0, 4, 1, 3, 10, 
+    45, 4, 4, 32, 1, 3, 34, 2, 1, 5, 
+    1, 32, 33, 3, 2, 32, 1, 4, 74, 1, 
+    10, 3, 1, 0, 75, 1, 0, 74, 0, 38, 
+    2, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 39, 4, 0, 
+    75, 0, 0, 33, 1, 3, 32, 2, 1, 74, 
+    2, 10, 1, 1, 0, 75, 1, 0, 30, 3, 
+    2, 6, 1, 0, 3, 0, 79, 2, 1, 22, 
+    1, 3, 0, 0, 0, 26, 2, 10, 2, 0, 
+    0, 40, 1, 0, 32, 1, 3, 34, 2, 1, 
+    5, 1, 32, 32, 3, 1, 38, 2, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 32, 1, 3, 34, 2, 1, 
+    5, 1, 32, 33, 0, 4, 34, 1, 0, 6, 
+    1, 33, 32, 3, 0, 38, 1, 33, 1, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 74, 0, 38, 2, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 39, 4, 0, 75, 0, 0, 32, 
+    1, 3, 41, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
     0, 0, 0, 0, 2, 38, 0, 0, 0, 0, 
@@ -1519,7 +1528,7 @@ std::vector<uint8_t> _bootstrap_external
     0, 0, 0, 0, 0, 0, 99, 104, 101, 99, 
     107, 101, 100, 4, 0, 0, 0, 0, 0, 0, 
     0, 100, 97, 116, 97, 5, 0, 0, 0, 0, 
-    0, 0, 0, 102, 108, 97, 103, 115, 32, 0, 
+    0, 0, 0, 102, 108, 97, 103, 115, 33, 0, 
     0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
     0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
     0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 
@@ -1528,783 +1537,878 @@ std::vector<uint8_t> _bootstrap_external
     70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
     46, 114, 101, 115, 111, 117, 114, 99, 101, 95, 
     112, 97, 116, 104, 46, 49, 48, 53, 54, 58, 
-    52, 0, 29, 0, 0, 0, 0, 0, 0, 0, 
-    32, 0, 0, 34, 1, 0, 3, 32, 2, 1, 
-    74, 2, 10, 1, 1, 0, 75, 1, 0, 49, 
-    3, 0, 3, 79, 1, 3, 19, 3, 2, 0, 
-    0, 0, 33, 0, 0, 40, 1, 0, 33, 1, 
-    1, 33, 2, 2, 32, 3, 0, 27, 4, 3, 
-    4, 74, 4, 10, 2, 1, 0, 75, 1, 0, 
-    30, 3, 0, 1, 2, 0, 3, 32, 4, 1, 
-    74, 2, 74, 4, 10, 1, 2, 0, 75, 1, 
-    0, 75, 1, 0, 45, 2, 0, 32, 1, 2, 
-    41, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    52, 0, 27, 0, 0, 0, 0, 0, 0, 0, 
+    32, 0, 0, 34, 1, 0, 3, 1, 32, 32, 
+    2, 1, 38, 1, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    49, 3, 0, 3, 79, 1, 3, 19, 3, 2, 
+    0, 0, 0, 33, 0, 0, 40, 1, 0, 33, 
+    1, 1, 33, 2, 2, 32, 3, 0, 27, 4, 
+    3, 4, 74, 4, 10, 2, 1, 0, 75, 1, 
+    0, 30, 3, 0, 1, 2, 0, 3, 32, 4, 
+    1, 74, 2, 74, 4, 10, 1, 2, 0, 75, 
+    1, 0, 75, 1, 0, 45, 2, 0, 32, 1, 
+    2, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
-    0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 
-    114, 101, 115, 111, 117, 114, 99, 101, 95, 112, 
-    97, 116, 104, 5, 0, 0, 0, 0, 0, 0, 
-    0, 17, 0, 0, 0, 0, 0, 0, 0, 70, 
-    105, 108, 101, 78, 111, 116, 70, 111, 117, 110, 
-    100, 69, 114, 114, 111, 114, 10, 0, 0, 0, 
-    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    106, 111, 105, 110, 11, 0, 0, 0, 0, 0, 
-    0, 0, 95, 112, 97, 116, 104, 95, 115, 112, 
-    108, 105, 116, 11, 0, 0, 0, 0, 0, 0, 
-    0, 105, 115, 95, 114, 101, 115, 111, 117, 114, 
-    99, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 0, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
-    108, 102, 8, 0, 0, 0, 0, 0, 0, 0, 
-    114, 101, 115, 111, 117, 114, 99, 101, 4, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    32, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
-    0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 87, 105, 110, 100, 111, 119, 115, 82, 
-    101, 103, 105, 115, 116, 114, 121, 70, 105, 110, 
-    100, 101, 114, 46, 102, 105, 110, 100, 95, 115, 
-    112, 101, 99, 46, 55, 57, 55, 58, 52, 0, 
-    81, 0, 0, 0, 0, 0, 0, 0, 32, 0, 
-    0, 34, 1, 0, 5, 32, 2, 1, 74, 2, 
-    10, 1, 1, 0, 75, 1, 0, 45, 4, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 114, 
+    101, 115, 111, 117, 114, 99, 101, 95, 112, 97, 
+    116, 104, 5, 0, 0, 0, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 0, 0, 0, 70, 105, 
+    108, 101, 78, 111, 116, 70, 111, 117, 110, 100, 
+    69, 114, 114, 111, 114, 10, 0, 0, 0, 0, 
+    0, 0, 0, 95, 112, 97, 116, 104, 95, 106, 
+    111, 105, 110, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 115, 112, 108, 
+    105, 116, 11, 0, 0, 0, 0, 0, 0, 0, 
+    105, 115, 95, 114, 101, 115, 111, 117, 114, 99, 
+    101, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 0, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 8, 0, 0, 0, 0, 0, 0, 0, 114, 
+    101, 115, 111, 117, 114, 99, 101, 4, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 33, 
+    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
+    0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 87, 105, 110, 100, 111, 119, 115, 82, 101, 
+    103, 105, 115, 116, 114, 121, 70, 105, 110, 100, 
+    101, 114, 46, 102, 105, 110, 100, 95, 115, 112, 
+    101, 99, 46, 55, 57, 55, 58, 52, 0, 75, 
+    0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 
+    34, 1, 0, 5, 1, 32, 32, 2, 1, 38, 
+    1, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 45, 4, 0, 
     32, 1, 4, 30, 0, 0, 6, 2, 1, 0, 
-    6, 79, 3, 2, 22, 2, 67, 0, 0, 0, 
-    42, 1, 0, 0, 0, 17, 7, 0, 0, 0, 
-    33, 0, 1, 21, 0, 4, 0, 0, 0, 30, 
-    1, 0, 5, 17, 0, 0, 0, 0, 41, 1, 
-    52, 33, 1, 0, 32, 2, 4, 74, 2, 10, 
-    1, 1, 0, 75, 1, 0, 54, 17, 0, 0, 
-    0, 0, 33, 1, 2, 10, 1, 0, 0, 13, 
-    2, 0, 17, 0, 0, 0, 0, 9, 0, 2, 
-    24, 0, 0, 0, 0, 0, 0, 0, 50, 2, 
-    0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 
-    45, 6, 1, 45, 5, 3, 17, 0, 0, 0, 
-    0, 32, 1, 4, 34, 3, 1, 6, 33, 4, 
-    3, 32, 1, 5, 74, 0, 74, 1, 10, 4, 
-    1, 0, 75, 1, 0, 39, 5, 0, 75, 0, 
-    0, 74, 0, 74, 5, 10, 3, 1, 0, 75, 
-    1, 0, 39, 6, 0, 75, 0, 0, 79, 1, 
-    6, 22, 6, 5, 0, 0, 0, 17, 0, 0, 
-    0, 0, 9, 0, 2, 0, 0, 0, 0, 232, 
-    255, 255, 255, 17, 0, 0, 0, 0, 30, 0, 
-    0, 41, 0, 33, 1, 4, 34, 2, 1, 7, 
-    32, 3, 1, 32, 1, 6, 32, 4, 1, 32, 
-    5, 4, 74, 4, 74, 5, 10, 1, 2, 0, 
-    75, 1, 0, 75, 1, 0, 32, 6, 4, 74, 
-    0, 12, 2, 2, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 6, 1, 0, 0, 0, 0, 0, 0, 0, 
-    8, 39, 1, 0, 75, 0, 0, 45, 7, 1, 
-    32, 0, 7, 41, 0, 30, 1, 0, 41, 1, 
-    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    6, 79, 3, 2, 22, 2, 63, 0, 0, 0, 
+    17, 7, 0, 0, 0, 33, 0, 1, 21, 0, 
+    4, 0, 0, 0, 30, 1, 0, 5, 17, 0, 
+    0, 0, 0, 41, 1, 52, 33, 1, 0, 32, 
+    2, 4, 74, 2, 10, 1, 1, 0, 75, 1, 
+    0, 17, 0, 0, 0, 0, 33, 1, 2, 10, 
+    1, 0, 0, 13, 2, 0, 17, 0, 0, 0, 
+    0, 9, 0, 2, 22, 0, 0, 0, 0, 0, 
+    0, 0, 50, 2, 0, 0, 0, 0, 0, 0, 
+    0, 1, 3, 0, 45, 6, 1, 45, 5, 3, 
+    17, 0, 0, 0, 0, 32, 1, 4, 34, 3, 
+    1, 6, 1, 32, 33, 4, 3, 32, 1, 5, 
+    74, 0, 74, 1, 10, 4, 1, 0, 75, 1, 
+    0, 39, 5, 0, 75, 0, 0, 74, 0, 38, 
+    3, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 39, 6, 0, 
+    75, 0, 0, 79, 1, 6, 22, 6, 5, 0, 
+    0, 0, 17, 0, 0, 0, 0, 9, 0, 2, 
+    0, 0, 0, 0, 234, 255, 255, 255, 17, 0, 
+    0, 0, 0, 30, 0, 0, 41, 0, 33, 1, 
+    4, 34, 2, 1, 7, 0, 0, 32, 3, 1, 
+    32, 1, 6, 32, 4, 1, 32, 5, 4, 74, 
+    4, 74, 5, 10, 1, 2, 0, 75, 1, 0, 
+    75, 1, 0, 32, 6, 4, 74, 0, 12, 2, 
+    2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 6, 1, 
+    0, 0, 0, 0, 0, 0, 0, 8, 39, 1, 
+    0, 75, 0, 0, 45, 7, 1, 32, 0, 7, 
+    41, 0, 30, 1, 0, 41, 1, 2, 0, 0, 
+    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 18, 
+    0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 
+    0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 
+    0, 0, 0, 102, 105, 110, 100, 95, 115, 112, 
+    101, 99, 9, 0, 0, 0, 0, 0, 0, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
+    97, 116, 104, 95, 115, 116, 97, 116, 7, 0, 
+    0, 0, 0, 0, 0, 0, 79, 83, 69, 114, 
+    114, 111, 114, 27, 0, 0, 0, 0, 0, 0, 
+    0, 95, 103, 101, 116, 95, 115, 117, 112, 112, 
+    111, 114, 116, 101, 100, 95, 102, 105, 108, 101, 
+    95, 108, 111, 97, 100, 101, 114, 115, 5, 0, 
+    0, 0, 0, 0, 0, 0, 116, 117, 112, 108, 
+    101, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 16, 
+    0, 0, 0, 0, 0, 0, 0, 95, 115, 101, 
+    97, 114, 99, 104, 95, 114, 101, 103, 105, 115, 
+    116, 114, 121, 8, 0, 0, 0, 0, 0, 0, 
+    0, 101, 110, 100, 115, 119, 105, 116, 104, 16, 
+    0, 0, 0, 0, 0, 0, 0, 115, 112, 101, 
+    99, 95, 102, 114, 111, 109, 95, 108, 111, 97, 
+    100, 101, 114, 6, 0, 0, 0, 0, 0, 0, 
+    0, 111, 114, 105, 103, 105, 110, 0, 0, 0, 
+    0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 99, 108, 115, 8, 0, 0, 0, 0, 0, 
+    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
+    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    116, 104, 6, 0, 0, 0, 0, 0, 0, 0, 
+    116, 97, 114, 103, 101, 116, 8, 0, 0, 0, 
+    0, 0, 0, 0, 102, 105, 108, 101, 112, 97, 
+    116, 104, 8, 0, 0, 0, 0, 0, 0, 0, 
+    115, 117, 102, 102, 105, 120, 101, 115, 6, 0, 
+    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
+    101, 114, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 112, 101, 99, 33, 0, 0, 0, 0, 0, 
     0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 110, 100, 95, 115, 112, 101, 99, 9, 
-    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
-    95, 115, 116, 97, 116, 7, 0, 0, 0, 0, 
-    0, 0, 0, 79, 83, 69, 114, 114, 111, 114, 
-    27, 0, 0, 0, 0, 0, 0, 0, 95, 103, 
-    101, 116, 95, 115, 117, 112, 112, 111, 114, 116, 
-    101, 100, 95, 102, 105, 108, 101, 95, 108, 111, 
-    97, 100, 101, 114, 115, 5, 0, 0, 0, 0, 
-    0, 0, 0, 116, 117, 112, 108, 101, 10, 0, 
+    31, 0, 0, 0, 0, 0, 0, 0, 47, 0, 
     0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 16, 0, 0, 0, 
-    0, 0, 0, 0, 95, 115, 101, 97, 114, 99, 
-    104, 95, 114, 101, 103, 105, 115, 116, 114, 121, 
-    8, 0, 0, 0, 0, 0, 0, 0, 101, 110, 
-    100, 115, 119, 105, 116, 104, 16, 0, 0, 0, 
-    0, 0, 0, 0, 115, 112, 101, 99, 95, 102, 
-    114, 111, 109, 95, 108, 111, 97, 100, 101, 114, 
-    6, 0, 0, 0, 0, 0, 0, 0, 111, 114, 
-    105, 103, 105, 110, 0, 0, 0, 0, 0, 0, 
-    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 99, 108, 
-    115, 8, 0, 0, 0, 0, 0, 0, 0, 102, 
-    117, 108, 108, 110, 97, 109, 101, 4, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 6, 
-    0, 0, 0, 0, 0, 0, 0, 116, 97, 114, 
-    103, 101, 116, 8, 0, 0, 0, 0, 0, 0, 
-    0, 102, 105, 108, 101, 112, 97, 116, 104, 8, 
-    0, 0, 0, 0, 0, 0, 0, 115, 117, 102, 
-    102, 105, 120, 101, 115, 6, 0, 0, 0, 0, 
-    0, 0, 0, 108, 111, 97, 100, 101, 114, 4, 
-    0, 0, 0, 0, 0, 0, 0, 115, 112, 101, 
-    99, 32, 0, 0, 0, 0, 0, 0, 0, 9, 
-    0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 
-    0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 80, 97, 116, 104, 70, 105, 110, 
-    100, 101, 114, 46, 95, 103, 101, 116, 95, 115, 
-    112, 101, 99, 46, 49, 51, 56, 50, 58, 52, 
-    0, 148, 0, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 3, 1, 0, 45, 4, 1, 32, 2, 
-    2, 13, 0, 2, 17, 0, 0, 0, 0, 9, 
-    1, 0, 126, 0, 0, 0, 0, 0, 0, 0, 
-    45, 5, 1, 17, 0, 0, 0, 0, 33, 2, 
-    0, 32, 3, 5, 33, 4, 1, 33, 5, 2, 
-    74, 4, 74, 5, 4, 6, 2, 75, 1, 0, 
-    75, 1, 0, 74, 0, 74, 3, 74, 6, 10, 
-    2, 2, 0, 75, 1, 0, 75, 1, 0, 39, 
-    7, 0, 75, 0, 0, 49, 4, 7, 3, 79, 
-    2, 4, 22, 4, 101, 0, 0, 0, 32, 2, 
-    0, 34, 3, 2, 6, 32, 4, 5, 74, 0, 
-    74, 4, 10, 3, 1, 0, 75, 1, 0, 39, 
-    2, 0, 75, 0, 0, 45, 6, 2, 32, 3, 
-    6, 30, 2, 1, 6, 4, 3, 2, 7, 79, 
-    5, 4, 19, 4, 70, 0, 0, 0, 33, 2, 
-    3, 32, 3, 6, 30, 4, 2, 74, 0, 74, 
-    3, 74, 4, 10, 2, 2, 0, 75, 1, 0, 
-    75, 1, 0, 39, 5, 0, 75, 0, 0, 79, 
-    6, 5, 22, 5, 14, 0, 0, 0, 32, 2, 
-    0, 34, 3, 2, 9, 32, 4, 1, 32, 2, 
-    6, 74, 0, 74, 4, 74, 2, 10, 3, 2, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 80, 97, 116, 104, 
+    70, 105, 110, 100, 101, 114, 46, 95, 103, 101, 
+    116, 95, 115, 112, 101, 99, 46, 49, 51, 56, 
+    50, 58, 52, 0, 132, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 3, 1, 0, 45, 4, 
+    1, 32, 2, 2, 13, 0, 2, 17, 0, 0, 
+    0, 0, 9, 1, 0, 114, 0, 0, 0, 0, 
+    0, 0, 0, 45, 5, 1, 17, 0, 0, 0, 
+    0, 33, 2, 0, 32, 3, 5, 33, 4, 1, 
+    33, 5, 2, 74, 4, 74, 5, 4, 6, 2, 
+    75, 1, 0, 75, 1, 0, 74, 0, 74, 3, 
+    74, 6, 10, 2, 2, 0, 75, 1, 0, 75, 
+    1, 0, 39, 7, 0, 75, 0, 0, 49, 4, 
+    7, 3, 79, 2, 4, 22, 4, 89, 0, 0, 
+    0, 32, 2, 0, 34, 3, 2, 6, 1, 32, 
+    32, 4, 5, 74, 0, 38, 3, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 39, 2, 0, 75, 0, 0, 45, 
+    6, 2, 32, 3, 6, 30, 2, 1, 6, 4, 
+    3, 2, 7, 79, 5, 4, 19, 4, 60, 0, 
+    0, 0, 33, 2, 3, 32, 3, 6, 30, 4, 
+    2, 74, 0, 74, 3, 74, 4, 10, 2, 2, 
     0, 75, 1, 0, 75, 1, 0, 39, 5, 0, 
-    75, 0, 0, 45, 7, 5, 17, 14, 0, 0, 
-    0, 32, 2, 6, 34, 3, 2, 7, 32, 4, 
-    1, 32, 2, 3, 74, 0, 74, 4, 74, 2, 
-    10, 3, 2, 0, 75, 1, 0, 75, 1, 0, 
-    39, 5, 0, 75, 0, 0, 45, 7, 5, 17, 
-    0, 0, 0, 0, 32, 2, 7, 30, 3, 1, 
-    6, 4, 2, 3, 6, 79, 5, 4, 22, 4, 
-    38, 0, 0, 0, 32, 2, 7, 27, 3, 2, 
-    12, 30, 4, 1, 6, 2, 3, 4, 7, 79, 
-    5, 2, 22, 2, 30, 0, 0, 0, 32, 3, 
-    7, 27, 2, 3, 11, 45, 8, 2, 32, 3, 
-    8, 30, 2, 1, 6, 4, 3, 2, 6, 79, 
-    5, 4, 22, 4, 11, 0, 0, 0, 32, 2, 
-    4, 34, 3, 2, 8, 32, 4, 8, 74, 0, 
-    74, 4, 10, 3, 1, 0, 75, 1, 0, 39, 
-    2, 0, 75, 0, 0, 17, 0, 0, 0, 0, 
-    17, 17, 0, 0, 0, 33, 2, 4, 30, 3, 
-    3, 74, 0, 74, 3, 10, 2, 1, 0, 75, 
-    1, 0, 39, 4, 0, 75, 0, 0, 40, 1, 
-    4, 30, 2, 1, 41, 2, 32, 3, 7, 41, 
-    3, 17, 0, 0, 0, 0, 17, 2, 0, 0, 
-    0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 
-    0, 9, 1, 0, 0, 0, 0, 0, 130, 255, 
-    255, 255, 33, 2, 5, 34, 1, 2, 10, 32, 
-    3, 1, 30, 2, 1, 74, 3, 74, 2, 10, 
-    1, 2, 0, 75, 1, 0, 75, 1, 115, 45, 
-    7, 0, 32, 1, 4, 32, 0, 7, 43, 0, 
-    1, 11, 32, 2, 7, 41, 2, 0, 0, 0, 
+    75, 0, 0, 79, 6, 5, 22, 5, 10, 0, 
+    0, 0, 32, 2, 0, 34, 3, 2, 9, 1, 
+    32, 32, 4, 1, 32, 2, 6, 74, 0, 38, 
+    3, 32, 2, 0, 0, 0, 0, 0, 0, 0, 
+    4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 5, 
+    0, 75, 0, 0, 45, 7, 5, 17, 10, 0, 
+    0, 0, 32, 2, 6, 34, 3, 2, 7, 1, 
+    32, 32, 4, 1, 32, 2, 3, 74, 0, 38, 
+    3, 32, 2, 0, 0, 0, 0, 0, 0, 0, 
+    4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 5, 
+    0, 75, 0, 0, 45, 7, 5, 17, 0, 0, 
+    0, 0, 32, 2, 7, 30, 3, 1, 6, 4, 
+    2, 3, 6, 79, 5, 4, 22, 4, 36, 0, 
+    0, 0, 32, 2, 7, 27, 3, 2, 12, 30, 
+    4, 1, 6, 2, 3, 4, 7, 79, 5, 2, 
+    22, 2, 28, 0, 0, 0, 32, 3, 7, 27, 
+    2, 3, 11, 45, 8, 2, 32, 3, 8, 30, 
+    2, 1, 6, 4, 3, 2, 6, 79, 5, 4, 
+    22, 4, 9, 0, 0, 0, 32, 2, 4, 34, 
+    3, 2, 8, 1, 32, 32, 4, 8, 74, 0, 
+    38, 3, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 2, 
+    0, 75, 0, 0, 17, 0, 0, 0, 0, 17, 
+    17, 0, 0, 0, 33, 2, 4, 30, 3, 3, 
+    74, 0, 74, 3, 10, 2, 1, 0, 75, 1, 
+    0, 39, 4, 0, 75, 0, 0, 40, 1, 4, 
+    30, 2, 1, 41, 2, 32, 3, 7, 41, 3, 
+    17, 0, 0, 0, 0, 17, 2, 0, 0, 0, 
+    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    9, 1, 0, 0, 0, 0, 0, 142, 255, 255, 
+    255, 33, 2, 5, 34, 1, 2, 10, 1, 32, 
+    32, 3, 1, 30, 2, 1, 38, 1, 32, 2, 
+    0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 45, 7, 0, 32, 1, 
+    4, 32, 0, 7, 43, 0, 1, 11, 32, 2, 
+    7, 41, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 2, 63, 0, 0, 0, 0, 0, 
+    0, 0, 70, 105, 110, 100, 32, 116, 104, 101, 
+    32, 108, 111, 97, 100, 101, 114, 32, 111, 114, 
+    32, 110, 97, 109, 101, 115, 112, 97, 99, 101, 
+    95, 112, 97, 116, 104, 32, 102, 111, 114, 32, 
+    116, 104, 105, 115, 32, 109, 111, 100, 117, 108, 
+    101, 47, 112, 97, 99, 107, 97, 103, 101, 32, 
+    110, 97, 109, 101, 46, 5, 2, 9, 0, 0, 
+    0, 0, 0, 0, 0, 102, 105, 110, 100, 95, 
+    115, 112, 101, 99, 2, 19, 0, 0, 0, 0, 
+    0, 0, 0, 115, 112, 101, 99, 32, 109, 105, 
+    115, 115, 105, 110, 103, 32, 108, 111, 97, 100, 
+    101, 114, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 2, 
-    63, 0, 0, 0, 0, 0, 0, 0, 70, 105, 
-    110, 100, 32, 116, 104, 101, 32, 108, 111, 97, 
-    100, 101, 114, 32, 111, 114, 32, 110, 97, 109, 
-    101, 115, 112, 97, 99, 101, 95, 112, 97, 116, 
-    104, 32, 102, 111, 114, 32, 116, 104, 105, 115, 
-    32, 109, 111, 100, 117, 108, 101, 47, 112, 97, 
-    99, 107, 97, 103, 101, 32, 110, 97, 109, 101, 
-    46, 5, 2, 9, 0, 0, 0, 0, 0, 0, 
-    0, 102, 105, 110, 100, 95, 115, 112, 101, 99, 
-    2, 19, 0, 0, 0, 0, 0, 0, 0, 115, 
-    112, 101, 99, 32, 109, 105, 115, 115, 105, 110, 
-    103, 32, 108, 111, 97, 100, 101, 114, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 95, 
+    103, 101, 116, 95, 115, 112, 101, 99, 13, 0, 
+    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
+    0, 0, 0, 0, 105, 115, 105, 110, 115, 116, 
+    97, 110, 99, 101, 3, 0, 0, 0, 0, 0, 
+    0, 0, 115, 116, 114, 5, 0, 0, 0, 0, 
+    0, 0, 0, 98, 121, 116, 101, 115, 7, 0, 
+    0, 0, 0, 0, 0, 0, 104, 97, 115, 97, 
+    116, 116, 114, 11, 0, 0, 0, 0, 0, 0, 
+    0, 73, 109, 112, 111, 114, 116, 69, 114, 114, 
+    111, 114, 10, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    20, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
+    97, 116, 104, 95, 105, 109, 112, 111, 114, 116, 
+    101, 114, 95, 99, 97, 99, 104, 101, 9, 0, 
+    0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 
+    95, 115, 112, 101, 99, 6, 0, 0, 0, 0, 
+    0, 0, 0, 101, 120, 116, 101, 110, 100, 16, 
+    0, 0, 0, 0, 0, 0, 0, 95, 108, 101, 
+    103, 97, 99, 121, 95, 103, 101, 116, 95, 115, 
+    112, 101, 99, 10, 0, 0, 0, 0, 0, 0, 
+    0, 77, 111, 100, 117, 108, 101, 83, 112, 101, 
+    99, 26, 0, 0, 0, 0, 0, 0, 0, 115, 
+    117, 98, 109, 111, 100, 117, 108, 101, 95, 115, 
+    101, 97, 114, 99, 104, 95, 108, 111, 99, 97, 
+    116, 105, 111, 110, 115, 6, 0, 0, 0, 0, 
+    0, 0, 0, 108, 111, 97, 100, 101, 114, 0, 
     0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 99, 108, 115, 8, 0, 0, 0, 
+    0, 0, 0, 0, 102, 117, 108, 108, 110, 97, 
+    109, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 6, 0, 0, 0, 0, 0, 
+    0, 0, 116, 97, 114, 103, 101, 116, 14, 0, 
+    0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 
+    115, 112, 97, 99, 101, 95, 112, 97, 116, 104, 
+    5, 0, 0, 0, 0, 0, 0, 0, 101, 110, 
+    116, 114, 121, 6, 0, 0, 0, 0, 0, 0, 
+    0, 102, 105, 110, 100, 101, 114, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 112, 101, 99, 8, 
+    0, 0, 0, 0, 0, 0, 0, 112, 111, 114, 
+    116, 105, 111, 110, 115, 32, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 48, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 95, 95, 99, 
+    108, 97, 115, 115, 95, 95, 70, 105, 108, 101, 
+    70, 105, 110, 100, 101, 114, 95, 95, 46, 49, 
+    52, 54, 53, 58, 48, 0, 43, 0, 0, 0, 
+    0, 0, 0, 0, 33, 0, 0, 47, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 109, 
+    111, 100, 117, 108, 101, 95, 95, 30, 2, 0, 
+    47, 2, 12, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 113, 117, 97, 108, 110, 97, 109, 101, 
+    95, 95, 30, 1, 1, 30, 0, 2, 36, 1, 
+    0, 0, 0, 0, 0, 47, 1, 8, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 105, 110, 105, 
+    116, 95, 95, 30, 0, 3, 36, 1, 0, 0, 
+    0, 0, 0, 47, 1, 17, 0, 0, 0, 0, 
+    0, 0, 0, 105, 110, 118, 97, 108, 105, 100, 
+    97, 116, 101, 95, 99, 97, 99, 104, 101, 115, 
+    33, 0, 1, 47, 0, 11, 0, 0, 0, 0, 
+    0, 0, 0, 102, 105, 110, 100, 95, 109, 111, 
+    100, 117, 108, 101, 30, 2, 4, 36, 0, 2, 
+    0, 0, 0, 0, 47, 0, 11, 0, 0, 0, 
+    0, 0, 0, 0, 102, 105, 110, 100, 95, 108, 
+    111, 97, 100, 101, 114, 30, 2, 5, 36, 0, 
+    2, 0, 0, 0, 0, 47, 0, 9, 0, 0, 
     0, 0, 0, 0, 0, 95, 103, 101, 116, 95, 
-    115, 112, 101, 99, 13, 0, 0, 0, 0, 0, 
-    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
-    105, 115, 105, 110, 115, 116, 97, 110, 99, 101, 
-    3, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
-    114, 5, 0, 0, 0, 0, 0, 0, 0, 98, 
-    121, 116, 101, 115, 7, 0, 0, 0, 0, 0, 
-    0, 0, 104, 97, 115, 97, 116, 116, 114, 11, 
-    0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 
-    111, 114, 116, 69, 114, 114, 111, 114, 10, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 20, 0, 0, 0, 
-    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    105, 109, 112, 111, 114, 116, 101, 114, 95, 99, 
-    97, 99, 104, 101, 9, 0, 0, 0, 0, 0, 
+    115, 112, 101, 99, 30, 2, 6, 30, 0, 7, 
+    74, 2, 36, 1, 0, 1, 0, 0, 0, 75, 
+    1, 0, 47, 1, 9, 0, 0, 0, 0, 0, 
     0, 0, 102, 105, 110, 100, 95, 115, 112, 101, 
-    99, 6, 0, 0, 0, 0, 0, 0, 0, 101, 
-    120, 116, 101, 110, 100, 16, 0, 0, 0, 0, 
-    0, 0, 0, 95, 108, 101, 103, 97, 99, 121, 
-    95, 103, 101, 116, 95, 115, 112, 101, 99, 10, 
-    0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 
-    117, 108, 101, 83, 112, 101, 99, 26, 0, 0, 
-    0, 0, 0, 0, 0, 115, 117, 98, 109, 111, 
-    100, 117, 108, 101, 95, 115, 101, 97, 114, 99, 
-    104, 95, 108, 111, 99, 97, 116, 105, 111, 110, 
-    115, 6, 0, 0, 0, 0, 0, 0, 0, 108, 
-    111, 97, 100, 101, 114, 0, 0, 0, 0, 0, 
-    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
-    108, 115, 8, 0, 0, 0, 0, 0, 0, 0, 
-    102, 117, 108, 108, 110, 97, 109, 101, 4, 0, 
+    99, 30, 0, 8, 36, 1, 0, 0, 0, 0, 
+    0, 47, 1, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 102, 105, 108, 108, 95, 99, 97, 99, 
+    104, 101, 33, 3, 2, 30, 0, 9, 36, 1, 
+    0, 0, 0, 0, 0, 47, 1, 9, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 95, 
+    104, 111, 111, 107, 35, 4, 3, 74, 4, 10, 
+    3, 1, 0, 75, 1, 0, 47, 0, 9, 0, 
     0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 
-    114, 103, 101, 116, 14, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 115, 112, 97, 99, 
-    101, 95, 112, 97, 116, 104, 5, 0, 0, 0, 
-    0, 0, 0, 0, 101, 110, 116, 114, 121, 6, 
-    0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 
-    100, 101, 114, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 112, 101, 99, 8, 0, 0, 0, 0, 
-    0, 0, 0, 112, 111, 114, 116, 105, 111, 110, 
-    115, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 95, 95, 99, 108, 97, 115, 115, 
-    95, 95, 70, 105, 108, 101, 70, 105, 110, 100, 
-    101, 114, 95, 95, 46, 49, 52, 54, 53, 58, 
-    48, 0, 43, 0, 0, 0, 0, 0, 0, 0, 
-    33, 0, 0, 47, 0, 10, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 109, 111, 100, 117, 108, 
-    101, 95, 95, 30, 2, 0, 47, 2, 12, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 113, 117, 
-    97, 108, 110, 97, 109, 101, 95, 95, 30, 1, 
-    1, 30, 0, 2, 36, 1, 0, 0, 0, 0, 
-    0, 47, 1, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 105, 110, 105, 116, 95, 95, 30, 
-    0, 3, 36, 1, 0, 0, 0, 0, 0, 47, 
-    1, 17, 0, 0, 0, 0, 0, 0, 0, 105, 
-    110, 118, 97, 108, 105, 100, 97, 116, 101, 95, 
-    99, 97, 99, 104, 101, 115, 33, 0, 1, 47, 
-    0, 11, 0, 0, 0, 0, 0, 0, 0, 102, 
-    105, 110, 100, 95, 109, 111, 100, 117, 108, 101, 
-    30, 2, 4, 36, 0, 2, 0, 0, 0, 0, 
-    47, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 110, 100, 95, 108, 111, 97, 100, 101, 
-    114, 30, 2, 5, 36, 0, 2, 0, 0, 0, 
-    0, 47, 0, 9, 0, 0, 0, 0, 0, 0, 
-    0, 95, 103, 101, 116, 95, 115, 112, 101, 99, 
-    30, 2, 6, 30, 0, 7, 74, 2, 36, 1, 
-    0, 1, 0, 0, 0, 75, 1, 0, 47, 1, 
-    9, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
-    110, 100, 95, 115, 112, 101, 99, 30, 0, 8, 
-    36, 1, 0, 0, 0, 0, 0, 47, 1, 11, 
-    0, 0, 0, 0, 0, 0, 0, 95, 102, 105, 
-    108, 108, 95, 99, 97, 99, 104, 101, 33, 3, 
-    2, 30, 0, 9, 36, 1, 0, 0, 0, 0, 
-    0, 47, 1, 9, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 95, 104, 111, 111, 107, 
-    35, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 95, 104, 111, 111, 107, 74, 
-    4, 10, 3, 1, 0, 75, 1, 0, 47, 0, 
-    9, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 95, 104, 111, 111, 107, 30, 2, 10, 
-    36, 0, 2, 0, 0, 0, 0, 47, 0, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 114, 
-    101, 112, 114, 95, 95, 17, 0, 0, 0, 0, 
-    29, 0, 0, 41, 0, 1, 0, 0, 0, 0, 
+    95, 104, 111, 111, 107, 30, 2, 10, 36, 0, 
+    2, 0, 0, 0, 0, 47, 0, 8, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 114, 101, 112, 
+    114, 95, 95, 17, 0, 0, 0, 0, 29, 0, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 99, 108, 97, 
-    115, 115, 95, 95, 11, 0, 0, 0, 0, 0, 
-    0, 0, 2, 10, 0, 0, 0, 0, 0, 0, 
-    0, 70, 105, 108, 101, 70, 105, 110, 100, 101, 
-    114, 2, 172, 0, 0, 0, 0, 0, 0, 0, 
-    70, 105, 108, 101, 45, 98, 97, 115, 101, 100, 
-    32, 102, 105, 110, 100, 101, 114, 46, 10, 10, 
-    32, 32, 32, 32, 73, 110, 116, 101, 114, 97, 
-    99, 116, 105, 111, 110, 115, 32, 119, 105, 116, 
-    104, 32, 116, 104, 101, 32, 102, 105, 108, 101, 
-    32, 115, 121, 115, 116, 101, 109, 32, 97, 114, 
-    101, 32, 99, 97, 99, 104, 101, 100, 32, 102, 
-    111, 114, 32, 112, 101, 114, 102, 111, 114, 109, 
-    97, 110, 99, 101, 44, 32, 98, 101, 105, 110, 
-    103, 10, 32, 32, 32, 32, 114, 101, 102, 114, 
-    101, 115, 104, 101, 100, 32, 119, 104, 101, 110, 
-    32, 116, 104, 101, 32, 100, 105, 114, 101, 99, 
-    116, 111, 114, 121, 32, 116, 104, 101, 32, 102, 
-    105, 110, 100, 101, 114, 32, 105, 115, 32, 104, 
-    97, 110, 100, 108, 105, 110, 103, 32, 104, 97, 
-    115, 32, 98, 101, 101, 110, 32, 109, 111, 100, 
-    105, 102, 105, 101, 100, 46, 10, 10, 32, 32, 
-    32, 32, 2, 46, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 70, 105, 108, 101, 70, 105, 110, 100, 101, 
-    114, 46, 95, 95, 105, 110, 105, 116, 95, 95, 
-    46, 49, 52, 55, 52, 58, 52, 2, 55, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 99, 108, 97, 115, 115, 95, 95, 
+    11, 0, 0, 0, 0, 0, 0, 0, 2, 10, 
+    0, 0, 0, 0, 0, 0, 0, 70, 105, 108, 
+    101, 70, 105, 110, 100, 101, 114, 2, 172, 0, 
+    0, 0, 0, 0, 0, 0, 70, 105, 108, 101, 
+    45, 98, 97, 115, 101, 100, 32, 102, 105, 110, 
+    100, 101, 114, 46, 10, 10, 32, 32, 32, 32, 
+    73, 110, 116, 101, 114, 97, 99, 116, 105, 111, 
+    110, 115, 32, 119, 105, 116, 104, 32, 116, 104, 
+    101, 32, 102, 105, 108, 101, 32, 115, 121, 115, 
+    116, 101, 109, 32, 97, 114, 101, 32, 99, 97, 
+    99, 104, 101, 100, 32, 102, 111, 114, 32, 112, 
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 
+    44, 32, 98, 101, 105, 110, 103, 10, 32, 32, 
+    32, 32, 114, 101, 102, 114, 101, 115, 104, 101, 
+    100, 32, 119, 104, 101, 110, 32, 116, 104, 101, 
+    32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 
+    32, 116, 104, 101, 32, 102, 105, 110, 100, 101, 
+    114, 32, 105, 115, 32, 104, 97, 110, 100, 108, 
+    105, 110, 103, 32, 104, 97, 115, 32, 98, 101, 
+    101, 110, 32, 109, 111, 100, 105, 102, 105, 101, 
+    100, 46, 10, 10, 32, 32, 32, 32, 2, 46, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 70, 105, 108, 
+    101, 70, 105, 110, 100, 101, 114, 46, 95, 95, 
+    105, 110, 105, 116, 95, 95, 46, 49, 52, 55, 
+    52, 58, 52, 2, 55, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 70, 105, 108, 101, 70, 105, 110, 100, 
+    101, 114, 46, 105, 110, 118, 97, 108, 105, 100, 
+    97, 116, 101, 95, 99, 97, 99, 104, 101, 115, 
+    46, 49, 52, 57, 48, 58, 52, 2, 49, 0, 
     0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
     116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
     101, 114, 110, 97, 108, 46, 70, 105, 108, 101, 
-    70, 105, 110, 100, 101, 114, 46, 105, 110, 118, 
-    97, 108, 105, 100, 97, 116, 101, 95, 99, 97, 
-    99, 104, 101, 115, 46, 49, 52, 57, 48, 58, 
-    52, 2, 49, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    70, 105, 108, 101, 70, 105, 110, 100, 101, 114, 
-    46, 102, 105, 110, 100, 95, 108, 111, 97, 100, 
-    101, 114, 46, 49, 52, 57, 54, 58, 52, 2, 
-    47, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
-    108, 101, 70, 105, 110, 100, 101, 114, 46, 95, 
-    103, 101, 116, 95, 115, 112, 101, 99, 46, 49, 
-    53, 48, 56, 58, 52, 5, 2, 47, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 70, 105, 108, 101, 70, 
-    105, 110, 100, 101, 114, 46, 102, 105, 110, 100, 
-    95, 115, 112, 101, 99, 46, 49, 53, 49, 51, 
-    58, 52, 2, 49, 0, 0, 0, 0, 0, 0, 
+    70, 105, 110, 100, 101, 114, 46, 102, 105, 110, 
+    100, 95, 108, 111, 97, 100, 101, 114, 46, 49, 
+    52, 57, 54, 58, 52, 2, 47, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 70, 105, 108, 101, 70, 105, 
+    110, 100, 101, 114, 46, 95, 103, 101, 116, 95, 
+    115, 112, 101, 99, 46, 49, 53, 48, 56, 58, 
+    52, 5, 2, 47, 0, 0, 0, 0, 0, 0, 
     0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
     112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
     46, 70, 105, 108, 101, 70, 105, 110, 100, 101, 
-    114, 46, 95, 102, 105, 108, 108, 95, 99, 97, 
-    99, 104, 101, 46, 49, 53, 54, 52, 58, 52, 
-    2, 47, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 70, 
-    105, 108, 101, 70, 105, 110, 100, 101, 114, 46, 
-    112, 97, 116, 104, 95, 104, 111, 111, 107, 46, 
-    49, 53, 57, 53, 58, 52, 2, 46, 0, 0, 
+    114, 46, 102, 105, 110, 100, 95, 115, 112, 101, 
+    99, 46, 49, 53, 49, 51, 58, 52, 2, 49, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 70, 105, 108, 
+    101, 70, 105, 110, 100, 101, 114, 46, 95, 102, 
+    105, 108, 108, 95, 99, 97, 99, 104, 101, 46, 
+    49, 53, 54, 52, 58, 52, 2, 47, 0, 0, 
     0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
     115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
     114, 110, 97, 108, 46, 70, 105, 108, 101, 70, 
-    105, 110, 100, 101, 114, 46, 95, 95, 114, 101, 
-    112, 114, 95, 95, 46, 49, 54, 49, 51, 58, 
-    52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 
+    105, 110, 100, 101, 114, 46, 112, 97, 116, 104, 
+    95, 104, 111, 111, 107, 46, 49, 53, 57, 53, 
+    58, 52, 2, 46, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 70, 105, 108, 101, 70, 105, 110, 100, 101, 
+    114, 46, 95, 95, 114, 101, 112, 114, 95, 95, 
+    46, 49, 54, 49, 51, 58, 52, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    21, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    99, 108, 97, 115, 115, 95, 95, 70, 105, 108, 
-    101, 70, 105, 110, 100, 101, 114, 95, 95, 3, 
-    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 110, 97, 109, 
-    101, 95, 95, 17, 0, 0, 0, 0, 0, 0, 
-    0, 95, 102, 105, 110, 100, 95, 109, 111, 100, 
-    117, 108, 101, 95, 115, 104, 105, 109, 11, 0, 
-    0, 0, 0, 0, 0, 0, 99, 108, 97, 115, 
-    115, 109, 101, 116, 104, 111, 100, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 22, 
-    0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 70, 105, 108, 101, 76, 
-    111, 97, 100, 101, 114, 46, 103, 101, 116, 95, 
-    100, 97, 116, 97, 46, 49, 48, 51, 53, 58, 
-    52, 0, 107, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 33, 1, 0, 32, 2, 0, 33, 
-    3, 1, 33, 4, 2, 74, 3, 74, 4, 4, 
-    5, 2, 75, 1, 0, 75, 1, 0, 74, 2, 
-    74, 5, 10, 1, 2, 0, 75, 1, 0, 75, 
-    1, 0, 79, 3, 0, 22, 0, 45, 0, 0, 
-    0, 33, 1, 3, 34, 2, 1, 9, 32, 3, 
-    1, 30, 1, 1, 74, 3, 74, 1, 10, 2, 
-    2, 0, 75, 1, 0, 75, 1, 0, 34, 4, 
-    0, 6, 74, 0, 10, 4, 0, 0, 39, 1, 
-    0, 75, 0, 0, 45, 2, 1, 56, 1, 0, 
-    0, 0, 17, 11, 0, 0, 0, 34, 1, 0, 
-    7, 74, 0, 53, 2, 1, 39, 2, 0, 75, 
-    0, 0, 79, 3, 2, 22, 2, 1, 0, 0, 
-    0, 52, 5, 17, 0, 0, 0, 0, 17, 43, 
-    0, 0, 0, 32, 1, 2, 34, 2, 1, 8, 
-    74, 0, 10, 2, 0, 0, 39, 3, 0, 75, 
-    0, 0, 34, 1, 0, 7, 30, 2, 2, 74, 
-    2, 74, 2, 74, 2, 10, 1, 3, 0, 75, 
-    1, 0, 75, 1, 0, 75, 1, 0, 5, 41, 
-    3, 33, 0, 3, 34, 1, 0, 5, 33, 2, 
-    4, 32, 3, 1, 74, 3, 10, 2, 1, 0, 
-    75, 1, 0, 74, 0, 74, 0, 10, 1, 1, 
-    0, 75, 1, 0, 39, 4, 0, 75, 0, 0, 
-    34, 2, 4, 6, 10, 2, 0, 0, 45, 2, 
-    0, 56, 1, 0, 0, 0, 17, 10, 0, 0, 
-    0, 34, 1, 4, 7, 53, 0, 1, 79, 2, 
-    0, 22, 0, 1, 0, 0, 0, 52, 5, 17, 
-    0, 0, 0, 0, 17, 0, 0, 0, 0, 30, 
-    0, 2, 41, 0, 32, 1, 2, 34, 2, 1, 
-    8, 10, 2, 0, 0, 34, 1, 4, 7, 30, 
-    2, 2, 74, 0, 74, 2, 74, 2, 74, 2, 
-    10, 1, 3, 0, 75, 1, 173, 75, 1, 0, 
-    75, 1, 174, 39, 3, 0, 75, 0, 0, 5, 
-    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 2, 39, 0, 0, 0, 0, 
-    0, 0, 0, 82, 101, 116, 117, 114, 110, 32, 
-    116, 104, 101, 32, 100, 97, 116, 97, 32, 102, 
-    114, 111, 109, 32, 112, 97, 116, 104, 32, 97, 
-    115, 32, 114, 97, 119, 32, 98, 121, 116, 101, 
-    115, 46, 2, 1, 0, 0, 0, 0, 0, 0, 
-    0, 114, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 99, 108, 97, 115, 
+    115, 95, 95, 70, 105, 108, 101, 70, 105, 110, 
+    100, 101, 114, 95, 95, 4, 0, 0, 0, 0, 
+    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 110, 97, 109, 101, 95, 95, 17, 
+    0, 0, 0, 0, 0, 0, 0, 95, 102, 105, 
+    110, 100, 95, 109, 111, 100, 117, 108, 101, 95, 
+    115, 104, 105, 109, 11, 0, 0, 0, 0, 0, 
+    0, 0, 99, 108, 97, 115, 115, 109, 101, 116, 
+    104, 111, 100, 9, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 116, 104, 95, 104, 111, 111, 107, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 
+    46, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
+    108, 101, 76, 111, 97, 100, 101, 114, 46, 103, 
+    101, 116, 95, 100, 97, 116, 97, 46, 49, 48, 
+    51, 53, 58, 52, 0, 87, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 33, 1, 0, 32, 
+    2, 0, 33, 3, 1, 33, 4, 2, 74, 3, 
+    74, 4, 4, 5, 2, 75, 1, 0, 75, 1, 
+    0, 74, 2, 74, 5, 10, 1, 2, 0, 75, 
+    1, 0, 75, 1, 0, 79, 3, 0, 22, 0, 
+    34, 0, 0, 0, 33, 1, 3, 34, 2, 1, 
+    9, 1, 32, 32, 3, 1, 30, 1, 1, 38, 
+    2, 32, 2, 0, 0, 0, 0, 0, 0, 0, 
+    3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 34, 4, 
+    0, 6, 1, 32, 74, 0, 38, 4, 32, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 39, 1, 0, 75, 0, 0, 45, 
+    2, 1, 17, 11, 0, 0, 0, 34, 1, 0, 
+    7, 0, 0, 74, 0, 53, 2, 1, 39, 2, 
+    0, 75, 0, 0, 79, 3, 2, 22, 2, 1, 
+    0, 0, 0, 52, 5, 17, 0, 0, 0, 0, 
+    17, 34, 0, 0, 0, 32, 1, 2, 34, 2, 
+    1, 8, 1, 32, 74, 0, 38, 2, 32, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 39, 3, 0, 75, 0, 0, 34, 
+    1, 0, 7, 1, 32, 30, 2, 2, 38, 1, 
+    32, 3, 0, 0, 0, 0, 0, 0, 0, 2, 
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 41, 
+    3, 33, 0, 3, 34, 1, 0, 5, 1, 32, 
+    33, 2, 4, 32, 3, 1, 74, 3, 10, 2, 
+    1, 0, 75, 1, 0, 74, 0, 38, 1, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 39, 4, 0, 75, 0, 
+    0, 34, 2, 4, 6, 1, 32, 38, 2, 32, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 
-    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
-    103, 101, 116, 95, 100, 97, 116, 97, 10, 0, 
-    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
-    0, 0, 0, 0, 105, 115, 105, 110, 115, 116, 
-    97, 110, 99, 101, 12, 0, 0, 0, 0, 0, 
-    0, 0, 83, 111, 117, 114, 99, 101, 76, 111, 
-    97, 100, 101, 114, 19, 0, 0, 0, 0, 0, 
-    0, 0, 69, 120, 116, 101, 110, 115, 105, 111, 
-    110, 70, 105, 108, 101, 76, 111, 97, 100, 101, 
-    114, 3, 0, 0, 0, 0, 0, 0, 0, 95, 
-    105, 111, 3, 0, 0, 0, 0, 0, 0, 0, 
-    115, 116, 114, 9, 0, 0, 0, 0, 0, 0, 
-    0, 111, 112, 101, 110, 95, 99, 111, 100, 101, 
-    9, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    101, 110, 116, 101, 114, 95, 95, 8, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 101, 120, 105, 
-    116, 95, 95, 4, 0, 0, 0, 0, 0, 0, 
-    0, 114, 101, 97, 100, 6, 0, 0, 0, 0, 
-    0, 0, 0, 70, 105, 108, 101, 73, 79, 0, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 115, 101, 108, 102, 4, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 4, 
-    0, 0, 0, 0, 0, 0, 0, 102, 105, 108, 
-    101, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 95, 78, 97, 109, 101, 115, 112, 
-    97, 99, 101, 76, 111, 97, 100, 101, 114, 46, 
-    105, 115, 95, 112, 97, 99, 107, 97, 103, 101, 
-    46, 49, 50, 56, 54, 58, 52, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 30, 0, 0, 41, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 6, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 45, 2, 0, 17, 10, 0, 
+    0, 0, 34, 1, 4, 7, 0, 0, 53, 0, 
+    1, 79, 2, 0, 22, 0, 1, 0, 0, 0, 
+    52, 5, 17, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 30, 0, 2, 41, 0, 32, 1, 2, 
+    34, 2, 1, 8, 1, 32, 38, 2, 32, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 34, 1, 4, 7, 1, 32, 30, 
+    2, 2, 74, 0, 38, 1, 32, 3, 0, 0, 
+    0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
-    0, 0, 105, 115, 95, 112, 97, 99, 107, 97, 
-    103, 101, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 101, 108, 102, 8, 0, 
-    0, 0, 0, 0, 0, 0, 102, 117, 108, 108, 
-    110, 97, 109, 101, 32, 0, 0, 0, 0, 0, 
-    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
-    15, 0, 0, 0, 0, 0, 0, 0, 64, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 87, 105, 110, 100, 
-    111, 119, 115, 82, 101, 103, 105, 115, 116, 114, 
-    121, 70, 105, 110, 100, 101, 114, 46, 95, 115, 
-    101, 97, 114, 99, 104, 95, 114, 101, 103, 105, 
-    115, 116, 114, 121, 46, 55, 56, 50, 58, 52, 
-    0, 89, 0, 0, 0, 0, 0, 0, 0, 32, 
-    0, 0, 27, 1, 0, 8, 79, 2, 1, 22, 
-    1, 4, 0, 0, 0, 32, 0, 0, 27, 1, 
-    0, 9, 45, 2, 1, 17, 4, 0, 0, 0, 
-    32, 0, 0, 27, 1, 0, 10, 45, 2, 1, 
-    17, 0, 0, 0, 0, 32, 0, 2, 34, 1, 
-    0, 3, 32, 2, 1, 30, 3, 0, 33, 0, 
-    0, 27, 4, 0, 11, 30, 5, 1, 30, 0, 
-    2, 30, 6, 1, 62, 7, 3, 5, 0, 6, 
-    1, 8, 4, 7, 0, 5, 3, 8, 2, 12, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 5, 2, 
-    0, 0, 0, 0, 0, 0, 0, 12, 13, 45, 
-    3, 0, 42, 1, 0, 0, 0, 17, 7, 0, 
+    0, 0, 0, 0, 39, 3, 0, 75, 0, 0, 
+    5, 41, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 28, 0, 0, 0, 0, 0, 0, 0, 29, 
+    0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 
+    0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 
+    0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 
+    0, 29, 0, 0, 0, 0, 0, 0, 0, 65, 
+    0, 0, 0, 0, 0, 0, 0, 66, 0, 0, 
+    0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 
+    0, 0, 0, 76, 0, 0, 0, 0, 0, 0, 
+    0, 87, 0, 0, 0, 0, 0, 0, 0, 66, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 2, 
+    39, 0, 0, 0, 0, 0, 0, 0, 82, 101, 
+    116, 117, 114, 110, 32, 116, 104, 101, 32, 100, 
+    97, 116, 97, 32, 102, 114, 111, 109, 32, 112, 
+    97, 116, 104, 32, 97, 115, 32, 114, 97, 119, 
+    32, 98, 121, 116, 101, 115, 46, 2, 1, 0, 
+    0, 0, 0, 0, 0, 0, 114, 5, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 
+    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
+    0, 0, 0, 0, 0, 103, 101, 116, 95, 100, 
+    97, 116, 97, 10, 0, 0, 0, 0, 0, 0, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 105, 
+    115, 105, 110, 115, 116, 97, 110, 99, 101, 12, 
+    0, 0, 0, 0, 0, 0, 0, 83, 111, 117, 
+    114, 99, 101, 76, 111, 97, 100, 101, 114, 19, 
+    0, 0, 0, 0, 0, 0, 0, 69, 120, 116, 
+    101, 110, 115, 105, 111, 110, 70, 105, 108, 101, 
+    76, 111, 97, 100, 101, 114, 3, 0, 0, 0, 
+    0, 0, 0, 0, 95, 105, 111, 3, 0, 0, 
+    0, 0, 0, 0, 0, 115, 116, 114, 9, 0, 
+    0, 0, 0, 0, 0, 0, 111, 112, 101, 110, 
+    95, 99, 111, 100, 101, 9, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 101, 110, 116, 101, 114, 
+    95, 95, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 101, 120, 105, 116, 95, 95, 4, 0, 
+    0, 0, 0, 0, 0, 0, 114, 101, 97, 100, 
+    6, 0, 0, 0, 0, 0, 0, 0, 70, 105, 
+    108, 101, 73, 79, 0, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 4, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 4, 0, 0, 0, 0, 0, 
+    0, 0, 102, 105, 108, 101, 32, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    54, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 95, 78, 
+    97, 109, 101, 115, 112, 97, 99, 101, 76, 111, 
+    97, 100, 101, 114, 46, 105, 115, 95, 112, 97, 
+    99, 107, 97, 103, 101, 46, 49, 50, 56, 54, 
+    58, 52, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 41, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 6, 1, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
+    0, 0, 0, 0, 0, 105, 115, 95, 112, 97, 
+    99, 107, 97, 103, 101, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 8, 0, 0, 0, 0, 0, 0, 0, 102, 
+    117, 108, 108, 110, 97, 109, 101, 33, 0, 0, 
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
+    0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 
+    0, 64, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 87, 
+    105, 110, 100, 111, 119, 115, 82, 101, 103, 105, 
+    115, 116, 114, 121, 70, 105, 110, 100, 101, 114, 
+    46, 95, 115, 101, 97, 114, 99, 104, 95, 114, 
+    101, 103, 105, 115, 116, 114, 121, 46, 55, 56, 
+    50, 58, 52, 0, 73, 0, 0, 0, 0, 0, 
+    0, 0, 32, 0, 0, 27, 1, 0, 8, 79, 
+    2, 1, 22, 1, 4, 0, 0, 0, 32, 0, 
+    0, 27, 1, 0, 9, 45, 2, 1, 17, 4, 
+    0, 0, 0, 32, 0, 0, 27, 1, 0, 10, 
+    45, 2, 1, 17, 0, 0, 0, 0, 32, 0, 
+    2, 34, 1, 0, 3, 0, 0, 32, 2, 1, 
+    30, 3, 0, 33, 0, 0, 27, 4, 0, 11, 
+    30, 5, 1, 30, 0, 2, 30, 6, 1, 62, 
+    7, 3, 5, 0, 6, 1, 8, 4, 7, 0, 
+    5, 3, 8, 2, 12, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 5, 2, 0, 0, 0, 0, 0, 
+    0, 0, 12, 13, 45, 3, 0, 17, 7, 0, 
     0, 0, 33, 0, 2, 21, 0, 4, 0, 0, 
     0, 30, 1, 1, 5, 17, 0, 0, 0, 0, 
     41, 1, 52, 32, 0, 0, 34, 1, 0, 4, 
-    32, 2, 3, 74, 2, 10, 1, 1, 0, 75, 
-    1, 0, 34, 3, 0, 5, 74, 0, 10, 3, 
-    0, 0, 39, 1, 0, 75, 0, 0, 45, 4, 
-    1, 56, 1, 0, 0, 0, 17, 10, 0, 0, 
-    0, 34, 1, 0, 6, 74, 0, 53, 2, 1, 
-    39, 2, 0, 75, 0, 0, 79, 3, 2, 22, 
-    2, 1, 0, 0, 0, 52, 5, 17, 26, 0, 
-    0, 0, 33, 1, 1, 34, 2, 1, 7, 32, 
-    3, 4, 30, 1, 3, 74, 0, 74, 3, 74, 
-    1, 10, 2, 2, 0, 75, 1, 0, 75, 1, 
+    1, 32, 32, 2, 3, 38, 1, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 34, 3, 0, 5, 1, 32, 74, 
+    0, 38, 3, 32, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 1, 
+    0, 75, 0, 0, 45, 4, 1, 17, 10, 0, 
+    0, 0, 34, 1, 0, 6, 0, 0, 74, 0, 
+    53, 2, 1, 39, 2, 0, 75, 0, 0, 79, 
+    3, 2, 22, 2, 1, 0, 0, 0, 52, 5, 
+    17, 15, 0, 0, 0, 33, 1, 1, 34, 2, 
+    1, 7, 1, 32, 32, 3, 4, 30, 1, 3, 
+    74, 0, 38, 2, 32, 2, 0, 0, 0, 0, 
+    0, 0, 0, 3, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 39, 4, 0, 75, 0, 0, 45, 5, 4, 
-    54, 17, 0, 0, 0, 0, 34, 1, 0, 6, 
-    30, 2, 1, 74, 2, 74, 2, 74, 2, 10, 
-    1, 3, 0, 75, 1, 0, 75, 1, 0, 75, 
-    1, 0, 5, 17, 0, 0, 0, 0, 54, 17, 
-    0, 0, 0, 0, 32, 0, 5, 41, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    17, 0, 0, 0, 0, 34, 1, 0, 6, 1, 
+    32, 30, 2, 1, 38, 1, 32, 3, 0, 0, 
+    0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 5, 17, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 32, 0, 5, 41, 0, 
+    6, 0, 0, 0, 0, 0, 0, 0, 26, 0, 
+    0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 
+    0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 
+    0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 
+    44, 0, 0, 0, 0, 0, 0, 0, 27, 0, 
+    0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 
+    0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 
+    0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 
+    45, 0, 0, 0, 0, 0, 0, 0, 55, 0, 
+    0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 
+    0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 
+    0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 
+    45, 0, 0, 0, 0, 0, 0, 0, 64, 0, 
+    0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 
+    0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 2, 5, 0, 0, 0, 0, 
+    0, 0, 0, 37, 100, 46, 37, 100, 5, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 
+    0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 
+    0, 0, 0, 0, 95, 115, 101, 97, 114, 99, 
+    104, 95, 114, 101, 103, 105, 115, 116, 114, 121, 
+    14, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 115, 121, 115, 6, 
+    0, 0, 0, 0, 0, 0, 0, 119, 105, 110, 
+    114, 101, 103, 7, 0, 0, 0, 0, 0, 0, 
+    0, 79, 83, 69, 114, 114, 111, 114, 6, 0, 
+    0, 0, 0, 0, 0, 0, 102, 111, 114, 109, 
+    97, 116, 14, 0, 0, 0, 0, 0, 0, 0, 
+    95, 111, 112, 101, 110, 95, 114, 101, 103, 105, 
+    115, 116, 114, 121, 9, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 101, 110, 116, 101, 114, 95, 
+    95, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 101, 120, 105, 116, 95, 95, 10, 0, 0, 
+    0, 0, 0, 0, 0, 81, 117, 101, 114, 121, 
+    86, 97, 108, 117, 101, 11, 0, 0, 0, 0, 
+    0, 0, 0, 68, 69, 66, 85, 71, 95, 66, 
+    85, 73, 76, 68, 12, 0, 0, 0, 0, 0, 
+    0, 0, 82, 69, 71, 73, 83, 84, 82, 89, 
+    95, 75, 69, 89, 18, 0, 0, 0, 0, 0, 
+    0, 0, 82, 69, 71, 73, 83, 84, 82, 89, 
+    95, 75, 69, 89, 95, 68, 69, 66, 85, 71, 
+    12, 0, 0, 0, 0, 0, 0, 0, 118, 101, 
+    114, 115, 105, 111, 110, 95, 105, 110, 102, 111, 
+    8, 0, 0, 0, 0, 0, 0, 0, 102, 117, 
+    108, 108, 110, 97, 109, 101, 11, 0, 0, 0, 
+    0, 0, 0, 0, 115, 121, 115, 95, 118, 101, 
+    114, 115, 105, 111, 110, 0, 0, 0, 0, 0, 
+    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
+    108, 115, 8, 0, 0, 0, 0, 0, 0, 0, 
+    102, 117, 108, 108, 110, 97, 109, 101, 12, 0, 
+    0, 0, 0, 0, 0, 0, 114, 101, 103, 105, 
+    115, 116, 114, 121, 95, 107, 101, 121, 3, 0, 
+    0, 0, 0, 0, 0, 0, 107, 101, 121, 4, 
+    0, 0, 0, 0, 0, 0, 0, 104, 107, 101, 
+    121, 8, 0, 0, 0, 0, 0, 0, 0, 102, 
+    105, 108, 101, 112, 97, 116, 104, 33, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
+    0, 54, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 83, 
+    111, 117, 114, 99, 101, 76, 111, 97, 100, 101, 
+    114, 46, 95, 99, 97, 99, 104, 101, 95, 98, 
+    121, 116, 101, 99, 111, 100, 101, 46, 56, 56, 
+    48, 58, 52, 0, 7, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 32, 1, 0, 34, 2, 
+    1, 0, 1, 32, 32, 3, 2, 32, 1, 3, 
+    38, 2, 32, 2, 0, 0, 0, 0, 0, 0, 
+    0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 2, 5, 0, 0, 0, 0, 0, 0, 0, 
-    37, 100, 46, 37, 100, 5, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 228, 0, 0, 0, 0, 0, 0, 0, 
+    79, 112, 116, 105, 111, 110, 97, 108, 32, 109, 
+    101, 116, 104, 111, 100, 32, 119, 104, 105, 99, 
+    104, 32, 119, 114, 105, 116, 101, 115, 32, 100, 
+    97, 116, 97, 32, 40, 98, 121, 116, 101, 115, 
+    41, 32, 116, 111, 32, 97, 32, 102, 105, 108, 
+    101, 32, 112, 97, 116, 104, 32, 40, 97, 32, 
+    115, 116, 114, 41, 46, 10, 10, 32, 32, 32, 
+    32, 32, 32, 32, 32, 73, 109, 112, 108, 101, 
+    109, 101, 110, 116, 105, 110, 103, 32, 116, 104, 
+    105, 115, 32, 109, 101, 116, 104, 111, 100, 32, 
+    97, 108, 108, 111, 119, 115, 32, 102, 111, 114, 
+    32, 116, 104, 101, 32, 119, 114, 105, 116, 105, 
+    110, 103, 32, 111, 102, 32, 98, 121, 116, 101, 
+    99, 111, 100, 101, 32, 102, 105, 108, 101, 115, 
+    46, 10, 10, 32, 32, 32, 32, 32, 32, 32, 
+    32, 84, 104, 101, 32, 115, 111, 117, 114, 99, 
+    101, 32, 112, 97, 116, 104, 32, 105, 115, 32, 
+    110, 101, 101, 100, 101, 100, 32, 105, 110, 32, 
+    111, 114, 100, 101, 114, 32, 116, 111, 32, 99, 
+    111, 114, 114, 101, 99, 116, 108, 121, 32, 116, 
+    114, 97, 110, 115, 102, 101, 114, 32, 112, 101, 
+    114, 109, 105, 115, 115, 105, 111, 110, 115, 10, 
+    32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 
-    0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 
-    0, 95, 115, 101, 97, 114, 99, 104, 95, 114, 
-    101, 103, 105, 115, 116, 114, 121, 14, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 115, 121, 115, 6, 0, 0, 0, 
-    0, 0, 0, 0, 119, 105, 110, 114, 101, 103, 
-    7, 0, 0, 0, 0, 0, 0, 0, 79, 83, 
-    69, 114, 114, 111, 114, 6, 0, 0, 0, 0, 
-    0, 0, 0, 102, 111, 114, 109, 97, 116, 14, 
-    0, 0, 0, 0, 0, 0, 0, 95, 111, 112, 
-    101, 110, 95, 114, 101, 103, 105, 115, 116, 114, 
-    121, 9, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 101, 110, 116, 101, 114, 95, 95, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 101, 120, 
-    105, 116, 95, 95, 10, 0, 0, 0, 0, 0, 
-    0, 0, 81, 117, 101, 114, 121, 86, 97, 108, 
-    117, 101, 11, 0, 0, 0, 0, 0, 0, 0, 
-    68, 69, 66, 85, 71, 95, 66, 85, 73, 76, 
-    68, 12, 0, 0, 0, 0, 0, 0, 0, 82, 
-    69, 71, 73, 83, 84, 82, 89, 95, 75, 69, 
-    89, 18, 0, 0, 0, 0, 0, 0, 0, 82, 
-    69, 71, 73, 83, 84, 82, 89, 95, 75, 69, 
-    89, 95, 68, 69, 66, 85, 71, 12, 0, 0, 
-    0, 0, 0, 0, 0, 118, 101, 114, 115, 105, 
-    111, 110, 95, 105, 110, 102, 111, 8, 0, 0, 
-    0, 0, 0, 0, 0, 102, 117, 108, 108, 110, 
-    97, 109, 101, 11, 0, 0, 0, 0, 0, 0, 
-    0, 115, 121, 115, 95, 118, 101, 114, 115, 105, 
-    111, 110, 0, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 99, 108, 115, 8, 
-    0, 0, 0, 0, 0, 0, 0, 102, 117, 108, 
-    108, 110, 97, 109, 101, 12, 0, 0, 0, 0, 
-    0, 0, 0, 114, 101, 103, 105, 115, 116, 114, 
-    121, 95, 107, 101, 121, 3, 0, 0, 0, 0, 
-    0, 0, 0, 107, 101, 121, 4, 0, 0, 0, 
-    0, 0, 0, 0, 104, 107, 101, 121, 8, 0, 
-    0, 0, 0, 0, 0, 0, 102, 105, 108, 101, 
-    112, 97, 116, 104, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 
+    0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 
+    0, 0, 0, 0, 0, 95, 99, 97, 99, 104, 
+    101, 95, 98, 121, 116, 101, 99, 111, 100, 101, 
+    1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
+    0, 0, 0, 0, 0, 0, 115, 101, 116, 95, 
+    100, 97, 116, 97, 0, 0, 0, 0, 0, 0, 
     0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 54, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 83, 111, 117, 114, 
-    99, 101, 76, 111, 97, 100, 101, 114, 46, 95, 
-    99, 97, 99, 104, 101, 95, 98, 121, 116, 101, 
-    99, 111, 100, 101, 46, 56, 56, 48, 58, 52, 
-    0, 11, 0, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 32, 1, 0, 34, 2, 1, 0, 32, 
-    3, 2, 32, 1, 3, 74, 3, 74, 1, 10, 
-    2, 2, 0, 75, 1, 0, 75, 1, 195, 41, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 11, 0, 0, 0, 0, 0, 0, 0, 
+    115, 111, 117, 114, 99, 101, 95, 112, 97, 116, 
+    104, 10, 0, 0, 0, 0, 0, 0, 0, 99, 
+    97, 99, 104, 101, 95, 112, 97, 116, 104, 4, 
+    0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 
+    97, 33, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 87, 105, 110, 100, 111, 119, 115, 
+    82, 101, 103, 105, 115, 116, 114, 121, 70, 105, 
+    110, 100, 101, 114, 46, 95, 111, 112, 101, 110, 
+    95, 114, 101, 103, 105, 115, 116, 114, 121, 46, 
+    55, 55, 53, 58, 52, 0, 23, 0, 0, 0, 
+    0, 0, 0, 0, 17, 14, 0, 0, 0, 33, 
+    0, 1, 21, 0, 9, 0, 0, 0, 33, 1, 
+    0, 34, 2, 1, 2, 1, 32, 33, 0, 0, 
+    27, 1, 0, 3, 32, 3, 1, 38, 2, 32, 
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 3, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 5, 17, 0, 0, 
+    0, 0, 41, 0, 52, 30, 0, 0, 41, 0, 
+    33, 1, 0, 34, 2, 1, 2, 1, 32, 33, 
+    0, 0, 27, 1, 0, 4, 32, 3, 1, 38, 
+    2, 32, 2, 0, 0, 0, 0, 0, 0, 0, 
+    1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 
+    0, 0, 0, 41, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 
+    0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 2, 228, 0, 0, 0, 0, 0, 
-    0, 0, 79, 112, 116, 105, 111, 110, 97, 108, 
-    32, 109, 101, 116, 104, 111, 100, 32, 119, 104, 
-    105, 99, 104, 32, 119, 114, 105, 116, 101, 115, 
-    32, 100, 97, 116, 97, 32, 40, 98, 121, 116, 
-    101, 115, 41, 32, 116, 111, 32, 97, 32, 102, 
-    105, 108, 101, 32, 112, 97, 116, 104, 32, 40, 
-    97, 32, 115, 116, 114, 41, 46, 10, 10, 32, 
-    32, 32, 32, 32, 32, 32, 32, 73, 109, 112, 
-    108, 101, 109, 101, 110, 116, 105, 110, 103, 32, 
-    116, 104, 105, 115, 32, 109, 101, 116, 104, 111, 
-    100, 32, 97, 108, 108, 111, 119, 115, 32, 102, 
-    111, 114, 32, 116, 104, 101, 32, 119, 114, 105, 
-    116, 105, 110, 103, 32, 111, 102, 32, 98, 121, 
-    116, 101, 99, 111, 100, 101, 32, 102, 105, 108, 
-    101, 115, 46, 10, 10, 32, 32, 32, 32, 32, 
-    32, 32, 32, 84, 104, 101, 32, 115, 111, 117, 
-    114, 99, 101, 32, 112, 97, 116, 104, 32, 105, 
-    115, 32, 110, 101, 101, 100, 101, 100, 32, 105, 
-    110, 32, 111, 114, 100, 101, 114, 32, 116, 111, 
-    32, 99, 111, 114, 114, 101, 99, 116, 108, 121, 
-    32, 116, 114, 97, 110, 115, 102, 101, 114, 32, 
-    112, 101, 114, 109, 105, 115, 115, 105, 111, 110, 
-    115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 6, 0, 0, 0, 0, 0, 0, 0, 15, 
-    0, 0, 0, 0, 0, 0, 0, 95, 99, 97, 
-    99, 104, 101, 95, 98, 121, 116, 101, 99, 111, 
-    100, 101, 1, 0, 0, 0, 0, 0, 0, 0, 
-    8, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
-    116, 95, 100, 97, 116, 97, 0, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 11, 0, 0, 0, 0, 0, 
-    0, 0, 115, 111, 117, 114, 99, 101, 95, 112, 
-    97, 116, 104, 10, 0, 0, 0, 0, 0, 0, 
-    0, 99, 97, 99, 104, 101, 95, 112, 97, 116, 
-    104, 4, 0, 0, 0, 0, 0, 0, 0, 100, 
-    97, 116, 97, 32, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 6, 
-    0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 87, 105, 110, 100, 111, 
-    119, 115, 82, 101, 103, 105, 115, 116, 114, 121, 
-    70, 105, 110, 100, 101, 114, 46, 95, 111, 112, 
-    101, 110, 95, 114, 101, 103, 105, 115, 116, 114, 
-    121, 46, 55, 55, 53, 58, 52, 0, 32, 0, 
-    0, 0, 0, 0, 0, 0, 42, 1, 0, 0, 
-    0, 17, 18, 0, 0, 0, 33, 0, 1, 21, 
-    0, 13, 0, 0, 0, 33, 1, 0, 34, 2, 
-    1, 2, 33, 0, 0, 27, 1, 0, 3, 32, 
-    3, 1, 74, 1, 74, 3, 10, 2, 2, 0, 
-    75, 1, 0, 75, 1, 0, 5, 17, 0, 0, 
-    0, 0, 41, 0, 52, 30, 0, 0, 41, 0, 
-    33, 1, 0, 34, 2, 1, 2, 33, 0, 0, 
-    27, 1, 0, 4, 32, 3, 1, 74, 1, 74, 
-    3, 10, 2, 2, 0, 75, 1, 172, 75, 1, 
-    172, 17, 0, 0, 0, 0, 41, 0, 0, 0, 
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 
+    0, 95, 111, 112, 101, 110, 95, 114, 101, 103, 
+    105, 115, 116, 114, 121, 5, 0, 0, 0, 0, 
+    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
+    0, 119, 105, 110, 114, 101, 103, 7, 0, 0, 
+    0, 0, 0, 0, 0, 79, 83, 69, 114, 114, 
+    111, 114, 7, 0, 0, 0, 0, 0, 0, 0, 
+    79, 112, 101, 110, 75, 101, 121, 18, 0, 0, 
+    0, 0, 0, 0, 0, 72, 75, 69, 89, 95, 
+    76, 79, 67, 65, 76, 95, 77, 65, 67, 72, 
+    73, 78, 69, 17, 0, 0, 0, 0, 0, 0, 
+    0, 72, 75, 69, 89, 95, 67, 85, 82, 82, 
+    69, 78, 84, 95, 85, 83, 69, 82, 0, 0, 
     0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 99, 108, 115, 3, 0, 0, 0, 0, 
+    0, 0, 0, 107, 101, 121, 32, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
-    14, 0, 0, 0, 0, 0, 0, 0, 95, 111, 
-    112, 101, 110, 95, 114, 101, 103, 105, 115, 116, 
-    114, 121, 5, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 119, 105, 
-    110, 114, 101, 103, 7, 0, 0, 0, 0, 0, 
-    0, 0, 79, 83, 69, 114, 114, 111, 114, 7, 
-    0, 0, 0, 0, 0, 0, 0, 79, 112, 101, 
-    110, 75, 101, 121, 18, 0, 0, 0, 0, 0, 
-    0, 0, 72, 75, 69, 89, 95, 76, 79, 67, 
-    65, 76, 95, 77, 65, 67, 72, 73, 78, 69, 
-    17, 0, 0, 0, 0, 0, 0, 0, 72, 75, 
-    69, 89, 95, 67, 85, 82, 82, 69, 78, 84, 
-    95, 85, 83, 69, 82, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
-    108, 115, 3, 0, 0, 0, 0, 0, 0, 0, 
-    107, 101, 121, 32, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 95, 99, 108, 97, 
-    115, 115, 95, 95, 95, 76, 111, 97, 100, 101, 
-    114, 66, 97, 115, 105, 99, 115, 95, 95, 46, 
-    56, 50, 55, 58, 48, 0, 20, 0, 0, 0, 
-    0, 0, 0, 0, 33, 0, 0, 47, 0, 10, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 109, 
-    111, 100, 117, 108, 101, 95, 95, 30, 2, 0, 
-    47, 2, 12, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 113, 117, 97, 108, 110, 97, 109, 101, 
-    95, 95, 30, 1, 1, 30, 0, 2, 36, 1, 
-    0, 0, 0, 0, 0, 47, 1, 10, 0, 0, 
-    0, 0, 0, 0, 0, 105, 115, 95, 112, 97, 
-    99, 107, 97, 103, 101, 30, 0, 3, 36, 1, 
-    0, 0, 0, 0, 0, 47, 1, 13, 0, 0, 
-    0, 0, 0, 0, 0, 99, 114, 101, 97, 116, 
-    101, 95, 109, 111, 100, 117, 108, 101, 30, 0, 
-    4, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
-    11, 0, 0, 0, 0, 0, 0, 0, 101, 120, 
-    101, 99, 95, 109, 111, 100, 117, 108, 101, 30, 
-    0, 5, 36, 1, 0, 0, 0, 0, 0, 47, 
-    1, 11, 0, 0, 0, 0, 0, 0, 0, 108, 
-    111, 97, 100, 95, 109, 111, 100, 117, 108, 101, 
-    17, 0, 0, 0, 0, 29, 0, 0, 41, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    50, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 95, 95, 
+    99, 108, 97, 115, 115, 95, 95, 95, 76, 111, 
+    97, 100, 101, 114, 66, 97, 115, 105, 99, 115, 
+    95, 95, 46, 56, 50, 55, 58, 48, 0, 20, 
+    0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 
+    47, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 109, 111, 100, 117, 108, 101, 95, 95, 
+    30, 2, 0, 47, 2, 12, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 113, 117, 97, 108, 110, 
+    97, 109, 101, 95, 95, 30, 1, 1, 30, 0, 
+    2, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
+    10, 0, 0, 0, 0, 0, 0, 0, 105, 115, 
+    95, 112, 97, 99, 107, 97, 103, 101, 30, 0, 
+    3, 36, 1, 0, 0, 0, 0, 0, 47, 1, 
+    13, 0, 0, 0, 0, 0, 0, 0, 99, 114, 
+    101, 97, 116, 101, 95, 109, 111, 100, 117, 108, 
+    101, 30, 0, 4, 36, 1, 0, 0, 0, 0, 
+    0, 47, 1, 11, 0, 0, 0, 0, 0, 0, 
+    0, 101, 120, 101, 99, 95, 109, 111, 100, 117, 
+    108, 101, 30, 0, 5, 36, 1, 0, 0, 0, 
+    0, 0, 47, 1, 11, 0, 0, 0, 0, 0, 
+    0, 0, 108, 111, 97, 100, 95, 109, 111, 100, 
+    117, 108, 101, 17, 0, 0, 0, 0, 29, 0, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 99, 108, 97, 115, 115, 95, 95, 6, 
-    0, 0, 0, 0, 0, 0, 0, 2, 13, 0, 
-    0, 0, 0, 0, 0, 0, 95, 76, 111, 97, 
-    100, 101, 114, 66, 97, 115, 105, 99, 115, 2, 
-    83, 0, 0, 0, 0, 0, 0, 0, 66, 97, 
-    115, 101, 32, 99, 108, 97, 115, 115, 32, 111, 
-    102, 32, 99, 111, 109, 109, 111, 110, 32, 99, 
-    111, 100, 101, 32, 110, 101, 101, 100, 101, 100, 
-    32, 98, 121, 32, 98, 111, 116, 104, 32, 83, 
-    111, 117, 114, 99, 101, 76, 111, 97, 100, 101, 
-    114, 32, 97, 110, 100, 10, 32, 32, 32, 32, 
-    83, 111, 117, 114, 99, 101, 108, 101, 115, 115, 
-    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
-    46, 2, 50, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 99, 108, 97, 115, 115, 95, 95, 
+    6, 0, 0, 0, 0, 0, 0, 0, 2, 13, 
+    0, 0, 0, 0, 0, 0, 0, 95, 76, 111, 
+    97, 100, 101, 114, 66, 97, 115, 105, 99, 115, 
+    2, 83, 0, 0, 0, 0, 0, 0, 0, 66, 
+    97, 115, 101, 32, 99, 108, 97, 115, 115, 32, 
+    111, 102, 32, 99, 111, 109, 109, 111, 110, 32, 
+    99, 111, 100, 101, 32, 110, 101, 101, 100, 101, 
+    100, 32, 98, 121, 32, 98, 111, 116, 104, 32, 
+    83, 111, 117, 114, 99, 101, 76, 111, 97, 100, 
+    101, 114, 32, 97, 110, 100, 10, 32, 32, 32, 
+    32, 83, 111, 117, 114, 99, 101, 108, 101, 115, 
+    115, 70, 105, 108, 101, 76, 111, 97, 100, 101, 
+    114, 46, 2, 50, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 95, 76, 111, 97, 100, 101, 114, 66, 97, 
+    115, 105, 99, 115, 46, 105, 115, 95, 112, 97, 
+    99, 107, 97, 103, 101, 46, 56, 51, 50, 58, 
+    52, 2, 53, 0, 0, 0, 0, 0, 0, 0, 
     95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
     95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
     95, 76, 111, 97, 100, 101, 114, 66, 97, 115, 
-    105, 99, 115, 46, 105, 115, 95, 112, 97, 99, 
-    107, 97, 103, 101, 46, 56, 51, 50, 58, 52, 
-    2, 53, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
+    105, 99, 115, 46, 99, 114, 101, 97, 116, 101, 
+    95, 109, 111, 100, 117, 108, 101, 46, 56, 52, 
+    48, 58, 52, 2, 51, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 95, 76, 111, 97, 100, 101, 114, 66, 
+    97, 115, 105, 99, 115, 46, 101, 120, 101, 99, 
+    95, 109, 111, 100, 117, 108, 101, 46, 56, 52, 
+    51, 58, 52, 2, 51, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 95, 76, 111, 97, 100, 101, 114, 66, 
+    97, 115, 105, 99, 115, 46, 108, 111, 97, 100, 
+    95, 109, 111, 100, 117, 108, 101, 46, 56, 53, 
+    49, 58, 52, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 99, 108, 97, 115, 115, 95, 95, 95, 
     76, 111, 97, 100, 101, 114, 66, 97, 115, 105, 
-    99, 115, 46, 99, 114, 101, 97, 116, 101, 95, 
-    109, 111, 100, 117, 108, 101, 46, 56, 52, 48, 
-    58, 52, 2, 51, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 95, 76, 111, 97, 100, 101, 114, 66, 97, 
-    115, 105, 99, 115, 46, 101, 120, 101, 99, 95, 
-    109, 111, 100, 117, 108, 101, 46, 56, 52, 51, 
-    58, 52, 2, 51, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 95, 76, 111, 97, 100, 101, 114, 66, 97, 
-    115, 105, 99, 115, 46, 108, 111, 97, 100, 95, 
-    109, 111, 100, 117, 108, 101, 46, 56, 53, 49, 
-    58, 52, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 
+    99, 115, 95, 95, 1, 0, 0, 0, 0, 0, 
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 110, 97, 109, 101, 95, 95, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    12, 0, 0, 0, 0, 0, 0, 0, 39, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 100, 101, 99, 111, 
+    100, 101, 95, 115, 111, 117, 114, 99, 101, 46, 
+    54, 55, 56, 58, 48, 0, 35, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 30, 1, 1, 
+    4, 0, 0, 14, 2, 5, 0, 1, 45, 1, 
+    2, 33, 0, 0, 34, 1, 0, 1, 1, 32, 
+    32, 2, 0, 38, 1, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 27, 3, 0, 6, 45, 2, 3, 32, 0, 
+    1, 34, 1, 0, 2, 1, 32, 32, 2, 2, 
+    38, 1, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 45, 3, 
+    0, 33, 1, 0, 34, 2, 1, 3, 1, 32, 
+    30, 3, 2, 30, 1, 3, 38, 2, 32, 2, 
+    0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 45, 4, 0, 32, 1, 
+    4, 34, 2, 1, 4, 1, 32, 32, 0, 0, 
+    34, 1, 0, 4, 1, 33, 32, 3, 3, 30, 
+    4, 1, 1, 5, 3, 4, 38, 1, 33, 1, 
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 74, 0, 38, 2, 32, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 24, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 99, 108, 97, 115, 115, 95, 95, 95, 76, 
-    111, 97, 100, 101, 114, 66, 97, 115, 105, 99, 
-    115, 95, 95, 1, 0, 0, 0, 0, 0, 0, 
-    0, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 110, 97, 109, 101, 95, 95, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 12, 
-    0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 100, 101, 99, 111, 100, 
-    101, 95, 115, 111, 117, 114, 99, 101, 46, 54, 
-    55, 56, 58, 48, 0, 47, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 30, 1, 1, 4, 
-    0, 0, 14, 2, 5, 0, 1, 45, 1, 2, 
-    33, 0, 0, 34, 1, 0, 1, 32, 2, 0, 
-    74, 2, 10, 1, 1, 0, 75, 1, 0, 27, 
-    3, 0, 6, 45, 2, 3, 32, 0, 1, 34, 
-    1, 0, 2, 32, 2, 2, 74, 2, 10, 1, 
-    1, 0, 75, 1, 0, 45, 3, 0, 33, 1, 
-    0, 34, 2, 1, 3, 30, 3, 2, 30, 1, 
-    3, 74, 3, 74, 1, 10, 2, 2, 0, 75, 
-    1, 0, 75, 1, 0, 45, 4, 0, 32, 1, 
-    4, 34, 2, 1, 4, 32, 0, 0, 34, 1, 
-    0, 4, 32, 3, 3, 30, 4, 1, 1, 5, 
-    3, 4, 74, 5, 10, 1, 1, 0, 75, 1, 
-    0, 74, 0, 74, 0, 10, 2, 1, 0, 75, 
-    1, 0, 39, 3, 0, 75, 0, 0, 41, 3, 
+    0, 0, 0, 0, 39, 3, 0, 75, 0, 0, 
+    41, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
@@ -2374,134 +2478,139 @@ std::vector<uint8_t> _bootstrap_external
     0, 30, 0, 3, 32, 3, 3, 2, 4, 0, 
     65, 4, 3, 11, 2, 1, 4, 1, 1, 40, 
     1, 0, 30, 1, 3, 41, 1, 0, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 2, 
-    243, 1, 0, 0, 0, 0, 0, 0, 86, 97, 
-    108, 105, 100, 97, 116, 101, 32, 97, 32, 104, 
-    97, 115, 104, 45, 98, 97, 115, 101, 100, 32, 
-    112, 121, 99, 32, 98, 121, 32, 99, 104, 101, 
-    99, 107, 105, 110, 103, 32, 116, 104, 101, 32, 
-    114, 101, 97, 108, 32, 115, 111, 117, 114, 99, 
-    101, 32, 104, 97, 115, 104, 32, 97, 103, 97, 
-    105, 110, 115, 116, 32, 116, 104, 101, 32, 111, 
-    110, 101, 32, 105, 110, 10, 32, 32, 32, 32, 
-    116, 104, 101, 32, 112, 121, 99, 32, 104, 101, 
-    97, 100, 101, 114, 46, 10, 10, 32, 32, 32, 
-    32, 42, 100, 97, 116, 97, 42, 32, 105, 115, 
-    32, 116, 104, 101, 32, 99, 111, 110, 116, 101, 
-    110, 116, 115, 32, 111, 102, 32, 116, 104, 101, 
-    32, 112, 121, 99, 32, 102, 105, 108, 101, 46, 
-    32, 40, 79, 110, 108, 121, 32, 116, 104, 101, 
-    32, 102, 105, 114, 115, 116, 32, 49, 54, 32, 
-    98, 121, 116, 101, 115, 32, 97, 114, 101, 10, 
-    32, 32, 32, 32, 114, 101, 113, 117, 105, 114, 
-    101, 100, 46, 41, 10, 10, 32, 32, 32, 32, 
-    42, 115, 111, 117, 114, 99, 101, 95, 104, 97, 
-    115, 104, 42, 32, 105, 115, 32, 116, 104, 101, 
-    32, 105, 109, 112, 111, 114, 116, 108, 105, 98, 
-    46, 117, 116, 105, 108, 46, 115, 111, 117, 114, 
-    99, 101, 95, 104, 97, 115, 104, 40, 41, 32, 
-    111, 102, 32, 116, 104, 101, 32, 115, 111, 117, 
-    114, 99, 101, 32, 102, 105, 108, 101, 46, 10, 
-    10, 32, 32, 32, 32, 42, 110, 97, 109, 101, 
-    42, 32, 105, 115, 32, 116, 104, 101, 32, 110, 
-    97, 109, 101, 32, 111, 102, 32, 116, 104, 101, 
-    32, 109, 111, 100, 117, 108, 101, 32, 98, 101, 
-    105, 110, 103, 32, 105, 109, 112, 111, 114, 116, 
-    101, 100, 46, 32, 73, 116, 32, 105, 115, 32, 
-    117, 115, 101, 100, 32, 102, 111, 114, 32, 108, 
-    111, 103, 103, 105, 110, 103, 46, 10, 10, 32, 
-    32, 32, 32, 42, 101, 120, 99, 95, 100, 101, 
-    116, 97, 105, 108, 115, 42, 32, 105, 115, 32, 
-    97, 32, 100, 105, 99, 116, 105, 111, 110, 97, 
-    114, 121, 32, 112, 97, 115, 115, 101, 100, 32, 
-    116, 111, 32, 73, 109, 112, 111, 114, 116, 69, 
-    114, 114, 111, 114, 32, 105, 102, 32, 105, 116, 
-    32, 114, 97, 105, 115, 101, 100, 32, 102, 111, 
-    114, 10, 32, 32, 32, 32, 105, 109, 112, 114, 
-    111, 118, 101, 100, 32, 100, 101, 98, 117, 103, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 2, 243, 1, 
+    0, 0, 0, 0, 0, 0, 86, 97, 108, 105, 
+    100, 97, 116, 101, 32, 97, 32, 104, 97, 115, 
+    104, 45, 98, 97, 115, 101, 100, 32, 112, 121, 
+    99, 32, 98, 121, 32, 99, 104, 101, 99, 107, 
+    105, 110, 103, 32, 116, 104, 101, 32, 114, 101, 
+    97, 108, 32, 115, 111, 117, 114, 99, 101, 32, 
+    104, 97, 115, 104, 32, 97, 103, 97, 105, 110, 
+    115, 116, 32, 116, 104, 101, 32, 111, 110, 101, 
+    32, 105, 110, 10, 32, 32, 32, 32, 116, 104, 
+    101, 32, 112, 121, 99, 32, 104, 101, 97, 100, 
+    101, 114, 46, 10, 10, 32, 32, 32, 32, 42, 
+    100, 97, 116, 97, 42, 32, 105, 115, 32, 116, 
+    104, 101, 32, 99, 111, 110, 116, 101, 110, 116, 
+    115, 32, 111, 102, 32, 116, 104, 101, 32, 112, 
+    121, 99, 32, 102, 105, 108, 101, 46, 32, 40, 
+    79, 110, 108, 121, 32, 116, 104, 101, 32, 102, 
+    105, 114, 115, 116, 32, 49, 54, 32, 98, 121, 
+    116, 101, 115, 32, 97, 114, 101, 10, 32, 32, 
+    32, 32, 114, 101, 113, 117, 105, 114, 101, 100, 
+    46, 41, 10, 10, 32, 32, 32, 32, 42, 115, 
+    111, 117, 114, 99, 101, 95, 104, 97, 115, 104, 
+    42, 32, 105, 115, 32, 116, 104, 101, 32, 105, 
+    109, 112, 111, 114, 116, 108, 105, 98, 46, 117, 
+    116, 105, 108, 46, 115, 111, 117, 114, 99, 101, 
+    95, 104, 97, 115, 104, 40, 41, 32, 111, 102, 
+    32, 116, 104, 101, 32, 115, 111, 117, 114, 99, 
+    101, 32, 102, 105, 108, 101, 46, 10, 10, 32, 
+    32, 32, 32, 42, 110, 97, 109, 101, 42, 32, 
+    105, 115, 32, 116, 104, 101, 32, 110, 97, 109, 
+    101, 32, 111, 102, 32, 116, 104, 101, 32, 109, 
+    111, 100, 117, 108, 101, 32, 98, 101, 105, 110, 
+    103, 32, 105, 109, 112, 111, 114, 116, 101, 100, 
+    46, 32, 73, 116, 32, 105, 115, 32, 117, 115, 
+    101, 100, 32, 102, 111, 114, 32, 108, 111, 103, 
     103, 105, 110, 103, 46, 10, 10, 32, 32, 32, 
-    32, 65, 110, 32, 73, 109, 112, 111, 114, 116, 
-    69, 114, 114, 111, 114, 32, 105, 115, 32, 114, 
-    97, 105, 115, 101, 100, 32, 105, 102, 32, 116, 
-    104, 101, 32, 98, 121, 116, 101, 99, 111, 100, 
-    101, 32, 105, 115, 32, 115, 116, 97, 108, 101, 
-    46, 10, 10, 32, 32, 32, 32, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 
-    0, 0, 0, 0, 0, 5, 2, 45, 0, 0, 
-    0, 0, 0, 0, 0, 104, 97, 115, 104, 32, 
-    105, 110, 32, 98, 121, 116, 101, 99, 111, 100, 
-    101, 32, 100, 111, 101, 115, 110, 116, 32, 109, 
-    97, 116, 99, 104, 32, 104, 97, 115, 104, 32, 
-    111, 102, 32, 115, 111, 117, 114, 99, 101, 32, 
+    32, 42, 101, 120, 99, 95, 100, 101, 116, 97, 
+    105, 108, 115, 42, 32, 105, 115, 32, 97, 32, 
+    100, 105, 99, 116, 105, 111, 110, 97, 114, 121, 
+    32, 112, 97, 115, 115, 101, 100, 32, 116, 111, 
+    32, 73, 109, 112, 111, 114, 116, 69, 114, 114, 
+    111, 114, 32, 105, 102, 32, 105, 116, 32, 114, 
+    97, 105, 115, 101, 100, 32, 102, 111, 114, 10, 
+    32, 32, 32, 32, 105, 109, 112, 114, 111, 118, 
+    101, 100, 32, 100, 101, 98, 117, 103, 103, 105, 
+    110, 103, 46, 10, 10, 32, 32, 32, 32, 65, 
+    110, 32, 73, 109, 112, 111, 114, 116, 69, 114, 
+    114, 111, 114, 32, 105, 115, 32, 114, 97, 105, 
+    115, 101, 100, 32, 105, 102, 32, 116, 104, 101, 
+    32, 98, 121, 116, 101, 99, 111, 100, 101, 32, 
+    105, 115, 32, 115, 116, 97, 108, 101, 46, 10, 
+    10, 32, 32, 32, 32, 0, 8, 0, 0, 0, 
+    0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 
+    0, 0, 0, 5, 2, 45, 0, 0, 0, 0, 
+    0, 0, 0, 104, 97, 115, 104, 32, 105, 110, 
+    32, 98, 121, 116, 101, 99, 111, 100, 101, 32, 
+    100, 111, 101, 115, 110, 116, 32, 109, 97, 116, 
+    99, 104, 32, 104, 97, 115, 104, 32, 111, 102, 
+    32, 115, 111, 117, 114, 99, 101, 32, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 
+    0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 
+    0, 0, 0, 0, 0, 95, 118, 97, 108, 105, 
+    100, 97, 116, 101, 95, 104, 97, 115, 104, 95, 
+    112, 121, 99, 1, 0, 0, 0, 0, 0, 0, 
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 73, 
+    109, 112, 111, 114, 116, 69, 114, 114, 111, 114, 
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 100, 97, 116, 97, 11, 0, 
+    0, 0, 0, 0, 0, 0, 115, 111, 117, 114, 
+    99, 101, 95, 104, 97, 115, 104, 4, 0, 0, 
+    0, 0, 0, 0, 0, 110, 97, 109, 101, 11, 
+    0, 0, 0, 0, 0, 0, 0, 101, 120, 99, 
+    95, 100, 101, 116, 97, 105, 108, 115, 33, 0, 
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 
+    0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    95, 99, 108, 97, 115, 115, 105, 102, 121, 95, 
+    112, 121, 99, 46, 53, 53, 57, 58, 48, 0, 
+    120, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
+    0, 32, 1, 0, 30, 0, 1, 30, 2, 2, 
+    30, 3, 1, 62, 4, 3, 0, 2, 3, 1, 
+    5, 1, 4, 45, 3, 5, 32, 1, 3, 33, 
+    0, 0, 6, 2, 1, 0, 1, 79, 3, 2, 
+    22, 2, 73, 0, 0, 0, 33, 1, 3, 32, 
+    2, 0, 74, 2, 10, 1, 1, 0, 75, 1, 
+    0, 30, 3, 3, 6, 1, 0, 3, 2, 79, 
+    2, 1, 22, 1, 44, 0, 0, 0, 33, 2, 
+    5, 32, 1, 0, 30, 0, 2, 30, 3, 4, 
+    30, 4, 1, 62, 5, 3, 0, 3, 4, 1, 
+    6, 1, 5, 74, 6, 10, 2, 1, 0, 75, 
+    1, 0, 45, 5, 0, 32, 2, 5, 30, 0, 
+    5, 49, 1, 0, 2, 0, 3, 2, 1, 9, 
+    79, 0, 3, 19, 3, 79, 0, 0, 0, 30, 
+    0, 6, 32, 1, 5, 73, 2, 1, 1, 30, 
+    3, 7, 32, 1, 1, 73, 4, 1, 1, 74, 
+    0, 74, 2, 74, 3, 74, 4, 72, 5, 4, 
+    75, 1, 0, 75, 1, 0, 75, 1, 0, 75, 
+    1, 0, 45, 4, 5, 33, 2, 2, 32, 0, 
+    4, 74, 0, 4, 1, 1, 75, 1, 0, 30, 
+    3, 1, 32, 4, 2, 2, 3, 0, 65, 3, 
+    4, 11, 2, 1, 3, 1, 1, 40, 1, 0, 
+    30, 1, 8, 32, 0, 1, 73, 2, 0, 1, 
+    74, 1, 74, 2, 72, 3, 2, 75, 1, 0, 
+    75, 1, 0, 45, 4, 3, 33, 1, 1, 34, 
+    2, 1, 6, 1, 32, 30, 3, 9, 32, 1, 
+    4, 38, 2, 32, 2, 0, 0, 0, 0, 0, 
+    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    33, 4, 4, 32, 1, 4, 74, 1, 10, 4, 
+    1, 0, 75, 1, 0, 40, 1, 0, 30, 1, 
+    10, 32, 0, 1, 73, 2, 0, 1, 30, 3, 
+    11, 32, 0, 3, 73, 4, 0, 1, 74, 1, 
+    74, 2, 74, 3, 74, 4, 72, 5, 4, 75, 
+    1, 0, 75, 1, 0, 75, 1, 0, 75, 1, 
+    0, 45, 4, 5, 33, 1, 1, 34, 2, 1, 
+    6, 1, 32, 30, 3, 9, 32, 1, 4, 38, 
+    2, 32, 2, 0, 0, 0, 0, 0, 0, 0, 
+    3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 33, 4, 
+    2, 32, 0, 4, 74, 0, 4, 1, 1, 75, 
+    1, 0, 30, 2, 1, 32, 3, 2, 2, 2, 
+    0, 65, 2, 3, 11, 4, 1, 2, 1, 1, 
+    40, 1, 0, 32, 1, 5, 41, 1, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 7, 0, 0, 0, 0, 0, 0, 0, 18, 
-    0, 0, 0, 0, 0, 0, 0, 95, 118, 97, 
-    108, 105, 100, 97, 116, 101, 95, 104, 97, 115, 
-    104, 95, 112, 121, 99, 1, 0, 0, 0, 0, 
-    0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 
-    0, 73, 109, 112, 111, 114, 116, 69, 114, 114, 
-    111, 114, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 100, 97, 116, 97, 
-    11, 0, 0, 0, 0, 0, 0, 0, 115, 111, 
-    117, 114, 99, 101, 95, 104, 97, 115, 104, 4, 
-    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
-    101, 11, 0, 0, 0, 0, 0, 0, 0, 101, 
-    120, 99, 95, 100, 101, 116, 97, 105, 108, 115, 
-    32, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
-    0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 
-    0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 95, 99, 108, 97, 115, 115, 105, 102, 
-    121, 95, 112, 121, 99, 46, 53, 53, 57, 58, 
-    48, 0, 128, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 32, 1, 0, 30, 0, 1, 30, 
-    2, 2, 30, 3, 1, 62, 4, 3, 0, 2, 
-    3, 1, 5, 1, 4, 45, 3, 5, 32, 1, 
-    3, 33, 0, 0, 6, 2, 1, 0, 1, 79, 
-    3, 2, 22, 2, 77, 0, 0, 0, 33, 1, 
-    3, 32, 2, 0, 74, 2, 10, 1, 1, 0, 
-    75, 1, 0, 30, 3, 3, 6, 1, 0, 3, 
-    2, 79, 2, 1, 22, 1, 44, 0, 0, 0, 
-    33, 2, 5, 32, 1, 0, 30, 0, 2, 30, 
-    3, 4, 30, 4, 1, 62, 5, 3, 0, 3, 
-    4, 1, 6, 1, 5, 74, 6, 10, 2, 1, 
-    0, 75, 1, 0, 45, 5, 0, 32, 2, 5, 
-    30, 0, 5, 49, 1, 0, 2, 0, 3, 2, 
-    1, 9, 79, 0, 3, 19, 3, 87, 0, 0, 
-    0, 30, 0, 6, 32, 1, 5, 73, 2, 1, 
-    1, 30, 3, 7, 32, 1, 1, 73, 4, 1, 
-    1, 74, 0, 74, 2, 74, 3, 74, 4, 72, 
-    5, 4, 75, 1, 0, 75, 1, 0, 75, 1, 
-    0, 75, 1, 0, 45, 4, 5, 33, 2, 2, 
-    32, 0, 4, 74, 0, 4, 1, 1, 75, 1, 
-    0, 30, 3, 1, 32, 4, 2, 2, 3, 0, 
-    65, 3, 4, 11, 2, 1, 3, 1, 1, 40, 
-    1, 0, 30, 1, 8, 32, 0, 1, 73, 2, 
-    0, 1, 74, 1, 74, 2, 72, 3, 2, 75, 
-    1, 0, 75, 1, 0, 45, 4, 3, 33, 1, 
-    1, 34, 2, 1, 6, 30, 3, 9, 32, 1, 
-    4, 74, 3, 74, 1, 10, 2, 2, 0, 75, 
-    1, 0, 75, 1, 0, 33, 4, 4, 32, 1, 
-    4, 74, 1, 10, 4, 1, 0, 75, 1, 0, 
-    40, 1, 0, 30, 1, 10, 32, 0, 1, 73, 
-    2, 0, 1, 30, 3, 11, 32, 0, 3, 73, 
-    4, 0, 1, 74, 1, 74, 2, 74, 3, 74, 
-    4, 72, 5, 4, 75, 1, 0, 75, 1, 0, 
-    75, 1, 0, 75, 1, 0, 45, 4, 5, 33, 
-    1, 1, 34, 2, 1, 6, 30, 3, 9, 32, 
-    1, 4, 74, 3, 74, 1, 10, 2, 2, 0, 
-    75, 1, 0, 75, 1, 0, 33, 4, 2, 32, 
-    0, 4, 74, 0, 4, 1, 1, 75, 1, 0, 
-    30, 2, 1, 32, 3, 2, 2, 2, 0, 65, 
-    2, 3, 11, 4, 1, 2, 1, 1, 40, 1, 
-    0, 32, 1, 5, 41, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     12, 0, 0, 0, 0, 0, 0, 0, 2, 84, 
@@ -2635,136 +2744,146 @@ std::vector<uint8_t> _bootstrap_external
     0, 0, 47, 1, 10, 0, 0, 0, 0, 0, 
     0, 0, 103, 101, 116, 95, 115, 111, 117, 114, 
     99, 101, 17, 0, 0, 0, 0, 29, 0, 0, 
-    41, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 99, 108, 97, 115, 115, 95, 
-    95, 4, 0, 0, 0, 0, 0, 0, 0, 2, 
-    20, 0, 0, 0, 0, 0, 0, 0, 83, 111, 
-    117, 114, 99, 101, 108, 101, 115, 115, 70, 105, 
-    108, 101, 76, 111, 97, 100, 101, 114, 2, 45, 
-    0, 0, 0, 0, 0, 0, 0, 76, 111, 97, 
-    100, 101, 114, 32, 119, 104, 105, 99, 104, 32, 
-    104, 97, 110, 100, 108, 101, 115, 32, 115, 111, 
-    117, 114, 99, 101, 108, 101, 115, 115, 32, 102, 
-    105, 108, 101, 32, 105, 109, 112, 111, 114, 116, 
-    115, 46, 2, 56, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 83, 111, 117, 114, 99, 101, 108, 101, 115, 
-    115, 70, 105, 108, 101, 76, 111, 97, 100, 101, 
-    114, 46, 103, 101, 116, 95, 99, 111, 100, 101, 
-    46, 49, 49, 50, 49, 58, 52, 2, 58, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 83, 111, 117, 114, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 99, 108, 97, 115, 115, 95, 95, 4, 
+    0, 0, 0, 0, 0, 0, 0, 2, 20, 0, 
+    0, 0, 0, 0, 0, 0, 83, 111, 117, 114, 
     99, 101, 108, 101, 115, 115, 70, 105, 108, 101, 
-    76, 111, 97, 100, 101, 114, 46, 103, 101, 116, 
-    95, 115, 111, 117, 114, 99, 101, 46, 49, 49, 
-    51, 55, 58, 52, 0, 0, 0, 0, 0, 0, 
+    76, 111, 97, 100, 101, 114, 2, 45, 0, 0, 
+    0, 0, 0, 0, 0, 76, 111, 97, 100, 101, 
+    114, 32, 119, 104, 105, 99, 104, 32, 104, 97, 
+    110, 100, 108, 101, 115, 32, 115, 111, 117, 114, 
+    99, 101, 108, 101, 115, 115, 32, 102, 105, 108, 
+    101, 32, 105, 109, 112, 111, 114, 116, 115, 46, 
+    2, 56, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 83, 
+    111, 117, 114, 99, 101, 108, 101, 115, 115, 70, 
+    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
+    103, 101, 116, 95, 99, 111, 100, 101, 46, 49, 
+    49, 50, 49, 58, 52, 2, 58, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 83, 111, 117, 114, 99, 101, 
+    108, 101, 115, 115, 70, 105, 108, 101, 76, 111, 
+    97, 100, 101, 114, 46, 103, 101, 116, 95, 115, 
+    111, 117, 114, 99, 101, 46, 49, 49, 51, 55, 
+    58, 52, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 99, 108, 97, 115, 115, 95, 95, 
-    83, 111, 117, 114, 99, 101, 108, 101, 115, 115, 
-    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
-    95, 95, 1, 0, 0, 0, 0, 0, 0, 0, 
-    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    110, 97, 109, 101, 95, 95, 0, 0, 0, 0, 
+    0, 31, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 99, 108, 97, 115, 115, 95, 95, 83, 111, 
+    117, 114, 99, 101, 108, 101, 115, 115, 70, 105, 
+    108, 101, 76, 111, 97, 100, 101, 114, 95, 95, 
+    1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 110, 97, 
+    109, 101, 95, 95, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    33, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
+    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
+    0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 95, 76, 111, 97, 100, 101, 114, 66, 
+    97, 115, 105, 99, 115, 46, 105, 115, 95, 112, 
+    97, 99, 107, 97, 103, 101, 46, 56, 51, 50, 
+    58, 52, 0, 40, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 33, 1, 0, 32, 0, 0, 
+    34, 2, 0, 1, 1, 32, 32, 3, 1, 38, 
+    2, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 74, 0, 74, 
+    0, 10, 1, 1, 0, 75, 1, 0, 39, 4, 
+    0, 75, 0, 0, 30, 2, 1, 1, 0, 4, 
+    2, 45, 2, 0, 32, 2, 2, 34, 1, 2, 
+    2, 1, 32, 30, 3, 2, 30, 2, 1, 38, 
+    1, 32, 2, 0, 0, 0, 0, 0, 0, 0, 
+    3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 30, 4, 
+    3, 1, 1, 0, 4, 45, 3, 1, 32, 0, 
+    1, 34, 1, 0, 3, 1, 32, 30, 2, 2, 
+    38, 1, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 30, 3, 
+    4, 1, 1, 0, 3, 45, 4, 1, 32, 0, 
+    3, 30, 1, 5, 6, 2, 0, 1, 0, 79, 
+    3, 2, 19, 2, 4, 0, 0, 0, 32, 0, 
+    4, 30, 1, 5, 6, 2, 0, 1, 1, 17, 
+    0, 0, 0, 0, 41, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
+    0, 0, 0, 0, 0, 0, 2, 141, 0, 0, 
+    0, 0, 0, 0, 0, 67, 111, 110, 99, 114, 
+    101, 116, 101, 32, 105, 109, 112, 108, 101, 109, 
+    101, 110, 116, 97, 116, 105, 111, 110, 32, 111, 
+    102, 32, 73, 110, 115, 112, 101, 99, 116, 76, 
+    111, 97, 100, 101, 114, 46, 105, 115, 95, 112, 
+    97, 99, 107, 97, 103, 101, 32, 98, 121, 32, 
+    99, 104, 101, 99, 107, 105, 110, 103, 32, 105, 
+    102, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+    116, 104, 101, 32, 112, 97, 116, 104, 32, 114, 
+    101, 116, 117, 114, 110, 101, 100, 32, 98, 121, 
+    32, 103, 101, 116, 95, 102, 105, 108, 101, 110, 
+    97, 109, 101, 32, 104, 97, 115, 32, 97, 32, 
+    102, 105, 108, 101, 110, 97, 109, 101, 32, 111, 
+    102, 32, 39, 95, 95, 105, 110, 105, 116, 95, 
+    95, 46, 112, 121, 39, 46, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 
+    0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 2, 8, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 105, 110, 105, 116, 95, 95, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 
-    5, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
-    0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 95, 76, 111, 97, 100, 101, 
-    114, 66, 97, 115, 105, 99, 115, 46, 105, 115, 
-    95, 112, 97, 99, 107, 97, 103, 101, 46, 56, 
-    51, 50, 58, 52, 0, 48, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 33, 1, 0, 32, 
-    0, 0, 34, 2, 0, 1, 32, 3, 1, 74, 
-    3, 10, 2, 1, 0, 75, 1, 0, 74, 0, 
-    74, 0, 10, 1, 1, 0, 75, 1, 0, 39, 
-    4, 0, 75, 0, 0, 30, 2, 1, 1, 0, 
-    4, 2, 45, 2, 0, 32, 2, 2, 34, 1, 
-    2, 2, 30, 3, 2, 30, 2, 1, 74, 3, 
-    74, 2, 10, 1, 2, 0, 75, 1, 0, 75, 
-    1, 0, 30, 4, 3, 1, 1, 0, 4, 45, 
-    3, 1, 32, 0, 1, 34, 1, 0, 3, 30, 
-    2, 2, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 30, 3, 4, 1, 1, 0, 3, 45, 4, 
-    1, 32, 0, 3, 30, 1, 5, 6, 2, 0, 
-    1, 0, 79, 3, 2, 19, 2, 4, 0, 0, 
-    0, 32, 0, 4, 30, 1, 5, 6, 2, 0, 
-    1, 1, 17, 0, 0, 0, 0, 41, 2, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
-    0, 2, 141, 0, 0, 0, 0, 0, 0, 0, 
-    67, 111, 110, 99, 114, 101, 116, 101, 32, 105, 
-    109, 112, 108, 101, 109, 101, 110, 116, 97, 116, 
-    105, 111, 110, 32, 111, 102, 32, 73, 110, 115, 
-    112, 101, 99, 116, 76, 111, 97, 100, 101, 114, 
-    46, 105, 115, 95, 112, 97, 99, 107, 97, 103, 
-    101, 32, 98, 121, 32, 99, 104, 101, 99, 107, 
-    105, 110, 103, 32, 105, 102, 10, 32, 32, 32, 
-    32, 32, 32, 32, 32, 116, 104, 101, 32, 112, 
-    97, 116, 104, 32, 114, 101, 116, 117, 114, 110, 
-    101, 100, 32, 98, 121, 32, 103, 101, 116, 95, 
-    102, 105, 108, 101, 110, 97, 109, 101, 32, 104, 
-    97, 115, 32, 97, 32, 102, 105, 108, 101, 110, 
-    97, 109, 101, 32, 111, 102, 32, 39, 95, 95, 
-    105, 110, 105, 116, 95, 95, 46, 112, 121, 39, 
-    46, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    2, 1, 0, 0, 0, 0, 0, 0, 0, 46, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 
-    110, 105, 116, 95, 95, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 105, 115, 95, 
+    112, 97, 99, 107, 97, 103, 101, 4, 0, 0, 
+    0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 
+    0, 0, 0, 95, 112, 97, 116, 104, 95, 115, 
+    112, 108, 105, 116, 12, 0, 0, 0, 0, 0, 
+    0, 0, 103, 101, 116, 95, 102, 105, 108, 101, 
+    110, 97, 109, 101, 6, 0, 0, 0, 0, 0, 
+    0, 0, 114, 115, 112, 108, 105, 116, 10, 0, 
+    0, 0, 0, 0, 0, 0, 114, 112, 97, 114, 
+    116, 105, 116, 105, 111, 110, 0, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 8, 0, 0, 0, 0, 0, 
+    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
+    8, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
+    108, 101, 110, 97, 109, 101, 13, 0, 0, 0, 
+    0, 0, 0, 0, 102, 105, 108, 101, 110, 97, 
+    109, 101, 95, 98, 97, 115, 101, 9, 0, 0, 
+    0, 0, 0, 0, 0, 116, 97, 105, 108, 95, 
+    110, 97, 109, 101, 33, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    6, 0, 0, 0, 0, 0, 0, 0, 59, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 87, 105, 110, 100, 
+    111, 119, 115, 82, 101, 103, 105, 115, 116, 114, 
+    121, 70, 105, 110, 100, 101, 114, 46, 102, 105, 
+    110, 100, 95, 109, 111, 100, 117, 108, 101, 46, 
+    56, 49, 51, 58, 52, 0, 17, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 32, 1, 0, 
+    34, 2, 1, 0, 1, 32, 32, 3, 1, 32, 
+    1, 2, 38, 2, 32, 2, 0, 0, 0, 0, 
+    0, 0, 0, 3, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 45, 3, 0, 32, 1, 3, 30, 0, 1, 
+    6, 2, 1, 0, 7, 79, 3, 2, 22, 2, 
+    2, 0, 0, 0, 30, 0, 1, 41, 0, 32, 
+    1, 3, 27, 0, 1, 1, 41, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
-    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
-    0, 0, 105, 115, 95, 112, 97, 99, 107, 97, 
-    103, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
-    11, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
-    97, 116, 104, 95, 115, 112, 108, 105, 116, 12, 
-    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
-    95, 102, 105, 108, 101, 110, 97, 109, 101, 6, 
-    0, 0, 0, 0, 0, 0, 0, 114, 115, 112, 
-    108, 105, 116, 10, 0, 0, 0, 0, 0, 0, 
-    0, 114, 112, 97, 114, 116, 105, 116, 105, 111, 
-    110, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 115, 101, 108, 102, 8, 
-    0, 0, 0, 0, 0, 0, 0, 102, 117, 108, 
-    108, 110, 97, 109, 101, 8, 0, 0, 0, 0, 
-    0, 0, 0, 102, 105, 108, 101, 110, 97, 109, 
-    101, 13, 0, 0, 0, 0, 0, 0, 0, 102, 
-    105, 108, 101, 110, 97, 109, 101, 95, 98, 97, 
-    115, 101, 9, 0, 0, 0, 0, 0, 0, 0, 
-    116, 97, 105, 108, 95, 110, 97, 109, 101, 32, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
-    0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 87, 105, 110, 100, 111, 119, 115, 82, 101, 
-    103, 105, 115, 116, 114, 121, 70, 105, 110, 100, 
-    101, 114, 46, 102, 105, 110, 100, 95, 109, 111, 
-    100, 117, 108, 101, 46, 56, 49, 51, 58, 52, 
-    0, 21, 0, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 32, 1, 0, 34, 2, 1, 0, 32, 
-    3, 1, 32, 1, 2, 74, 3, 74, 1, 10, 
-    2, 2, 0, 75, 1, 0, 75, 1, 0, 45, 
-    3, 0, 32, 1, 3, 30, 0, 1, 6, 2, 
-    1, 0, 7, 79, 3, 2, 22, 2, 2, 0, 
-    0, 0, 30, 0, 1, 41, 0, 32, 1, 3, 
-    27, 0, 1, 1, 41, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     2, 0, 0, 0, 0, 0, 0, 0, 2, 108, 
@@ -2813,2869 +2932,3141 @@ std::vector<uint8_t> _bootstrap_external
     4, 6, 1, 0, 3, 8, 17, 0, 0, 0, 
     0, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 2, 94, 0, 0, 0, 
-    0, 0, 0, 0, 84, 114, 117, 101, 32, 105, 
-    102, 32, 102, 105, 108, 101, 110, 97, 109, 101, 
-    115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 
-    99, 104, 101, 99, 107, 101, 100, 32, 99, 97, 
-    115, 101, 45, 105, 110, 115, 101, 110, 115, 105, 
-    116, 105, 118, 101, 108, 121, 32, 97, 110, 100, 
-    32, 105, 103, 110, 111, 114, 101, 32, 101, 110, 
-    118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 
-    102, 108, 97, 103, 115, 32, 97, 114, 101, 32, 
-    110, 111, 116, 32, 115, 101, 116, 46, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 2, 94, 0, 0, 0, 0, 0, 
+    0, 0, 84, 114, 117, 101, 32, 105, 102, 32, 
+    102, 105, 108, 101, 110, 97, 109, 101, 115, 32, 
+    109, 117, 115, 116, 32, 98, 101, 32, 99, 104, 
+    101, 99, 107, 101, 100, 32, 99, 97, 115, 101, 
+    45, 105, 110, 115, 101, 110, 115, 105, 116, 105, 
+    118, 101, 108, 121, 32, 97, 110, 100, 32, 105, 
+    103, 110, 111, 114, 101, 32, 101, 110, 118, 105, 
+    114, 111, 110, 109, 101, 110, 116, 32, 102, 108, 
+    97, 103, 115, 32, 97, 114, 101, 32, 110, 111, 
+    116, 32, 115, 101, 116, 46, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 107, 
+    101, 121, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
+    0, 0, 0, 0, 95, 114, 101, 108, 97, 120, 
+    95, 99, 97, 115, 101, 5, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 115, 121, 115, 3, 0, 0, 0, 0, 0, 
+    0, 0, 95, 111, 115, 5, 0, 0, 0, 0, 
+    0, 0, 0, 102, 108, 97, 103, 115, 18, 0, 
+    0, 0, 0, 0, 0, 0, 105, 103, 110, 111, 
+    114, 101, 95, 101, 110, 118, 105, 114, 111, 110, 
+    109, 101, 110, 116, 7, 0, 0, 0, 0, 0, 
+    0, 0, 101, 110, 118, 105, 114, 111, 110, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 
     0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 107, 101, 121, 0, 0, 0, 0, 0, 0, 
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 55, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 69, 120, 116, 
+    101, 110, 115, 105, 111, 110, 70, 105, 108, 101, 
+    76, 111, 97, 100, 101, 114, 46, 95, 95, 105, 
+    110, 105, 116, 95, 95, 46, 49, 49, 53, 52, 
+    58, 52, 0, 38, 0, 0, 0, 0, 0, 0, 
+    0, 32, 0, 1, 32, 1, 0, 43, 1, 0, 
+    4, 33, 2, 0, 32, 1, 2, 74, 1, 10, 
+    2, 1, 0, 75, 1, 0, 49, 3, 0, 3, 
+    79, 1, 3, 19, 3, 22, 0, 0, 0, 17, 
+    5, 0, 0, 0, 33, 0, 3, 21, 0, 2, 
+    0, 0, 0, 5, 17, 16, 0, 0, 0, 52, 
+    33, 1, 1, 33, 2, 2, 34, 3, 2, 5, 
+    1, 32, 38, 3, 32, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
-    0, 0, 0, 0, 0, 0, 95, 114, 101, 108, 
-    97, 120, 95, 99, 97, 115, 101, 5, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 115, 121, 115, 3, 0, 0, 0, 
-    0, 0, 0, 0, 95, 111, 115, 5, 0, 0, 
-    0, 0, 0, 0, 0, 102, 108, 97, 103, 115, 
-    18, 0, 0, 0, 0, 0, 0, 0, 105, 103, 
-    110, 111, 114, 101, 95, 101, 110, 118, 105, 114, 
-    111, 110, 109, 101, 110, 116, 7, 0, 0, 0, 
-    0, 0, 0, 0, 101, 110, 118, 105, 114, 111, 
-    110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
-    0, 55, 0, 0, 0, 0, 0, 0, 0, 95, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 
+    2, 2, 74, 0, 74, 0, 74, 2, 10, 1, 
+    2, 0, 75, 1, 0, 75, 1, 0, 39, 3, 
+    0, 75, 0, 0, 45, 2, 3, 17, 0, 0, 
+    0, 0, 17, 0, 0, 0, 0, 32, 0, 2, 
+    32, 1, 0, 43, 1, 0, 6, 30, 2, 0, 
+    41, 2, 2, 0, 0, 0, 0, 0, 0, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 12, 0, 
+    0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
+    0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 
+    12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    105, 110, 105, 116, 95, 95, 7, 0, 0, 0, 
+    0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 
+    0, 0, 95, 112, 97, 116, 104, 95, 105, 115, 
+    97, 98, 115, 10, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 106, 111, 105, 
+    110, 3, 0, 0, 0, 0, 0, 0, 0, 95, 
+    111, 115, 7, 0, 0, 0, 0, 0, 0, 0, 
+    79, 83, 69, 114, 114, 111, 114, 4, 0, 0, 
+    0, 0, 0, 0, 0, 110, 97, 109, 101, 6, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    99, 119, 100, 4, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 116, 104, 0, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+    101, 108, 102, 4, 0, 0, 0, 0, 0, 0, 
+    0, 110, 97, 109, 101, 4, 0, 0, 0, 0, 
+    0, 0, 0, 112, 97, 116, 104, 33, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 
+    0, 35, 0, 0, 0, 0, 0, 0, 0, 95, 
     98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 69, 
-    120, 116, 101, 110, 115, 105, 111, 110, 70, 105, 
-    108, 101, 76, 111, 97, 100, 101, 114, 46, 95, 
-    95, 105, 110, 105, 116, 95, 95, 46, 49, 49, 
-    53, 52, 58, 52, 0, 40, 0, 0, 0, 0, 
-    0, 0, 0, 32, 0, 1, 32, 1, 0, 43, 
-    1, 0, 4, 33, 2, 0, 32, 1, 2, 74, 
-    1, 10, 2, 1, 0, 75, 1, 0, 49, 3, 
-    0, 3, 79, 1, 3, 19, 3, 24, 0, 0, 
-    0, 42, 1, 0, 0, 0, 17, 5, 0, 0, 
-    0, 33, 0, 3, 21, 0, 2, 0, 0, 0, 
-    5, 17, 17, 0, 0, 0, 52, 33, 1, 1, 
-    33, 2, 2, 34, 3, 2, 5, 10, 3, 0, 
-    0, 32, 2, 2, 74, 0, 74, 0, 74, 2, 
-    10, 1, 2, 0, 75, 1, 0, 75, 1, 0, 
-    39, 3, 0, 75, 0, 0, 45, 2, 3, 54, 
-    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
-    32, 0, 2, 32, 1, 0, 43, 1, 0, 6, 
-    30, 2, 0, 41, 2, 0, 0, 0, 0, 0, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
+    112, 97, 116, 104, 95, 106, 111, 105, 110, 46, 
+    57, 48, 58, 52, 0, 151, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 32, 1, 0, 49, 
+    0, 1, 3, 79, 2, 0, 22, 0, 144, 0, 
+    0, 0, 33, 1, 0, 32, 2, 0, 74, 2, 
+    10, 1, 1, 0, 75, 1, 0, 30, 3, 1, 
+    6, 1, 0, 3, 0, 79, 2, 1, 22, 1, 
+    131, 0, 0, 0, 30, 0, 2, 45, 1, 0, 
+    3, 2, 0, 45, 2, 2, 33, 1, 1, 33, 
+    0, 2, 27, 2, 0, 12, 32, 3, 0, 74, 
+    2, 74, 3, 10, 1, 2, 0, 75, 1, 0, 
+    75, 1, 0, 13, 4, 0, 17, 0, 0, 0, 
+    0, 9, 0, 4, 80, 0, 0, 0, 0, 0, 
+    0, 0, 50, 2, 0, 0, 0, 0, 0, 0, 
+    0, 1, 2, 0, 45, 3, 1, 45, 4, 2, 
+    17, 0, 0, 0, 0, 32, 1, 3, 34, 2, 
+    1, 6, 1, 32, 33, 3, 3, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 79, 1, 0, 22, 0, 
+    5, 0, 0, 0, 32, 1, 3, 34, 2, 1, 
+    8, 1, 32, 33, 3, 3, 38, 2, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 79, 
+    1, 0, 22, 0, 44, 0, 0, 0, 32, 1, 
+    3, 34, 2, 1, 8, 1, 32, 30, 3, 3, 
+    38, 2, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 79, 1, 
+    0, 22, 0, 11, 0, 0, 0, 32, 1, 3, 
+    79, 0, 1, 22, 1, 2, 0, 0, 0, 32, 
+    1, 1, 17, 0, 0, 0, 0, 45, 1, 1, 
+    32, 2, 2, 34, 1, 2, 10, 1, 32, 32, 
+    3, 4, 38, 1, 32, 1, 0, 0, 0, 0, 
     0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 26, 0, 0, 0, 32, 1, 1, 34, 2, 
+    1, 9, 1, 32, 38, 2, 32, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 
-    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 105, 110, 105, 
-    116, 95, 95, 7, 0, 0, 0, 0, 0, 0, 
-    0, 11, 0, 0, 0, 0, 0, 0, 0, 95, 
-    112, 97, 116, 104, 95, 105, 115, 97, 98, 115, 
-    10, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
-    97, 116, 104, 95, 106, 111, 105, 110, 3, 0, 
-    0, 0, 0, 0, 0, 0, 95, 111, 115, 7, 
-    0, 0, 0, 0, 0, 0, 0, 79, 83, 69, 
-    114, 114, 111, 114, 4, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 6, 0, 0, 0, 
-    0, 0, 0, 0, 103, 101, 116, 99, 119, 100, 
-    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 0, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 115, 101, 108, 102, 
-    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
-    109, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 32, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
-    20, 0, 0, 0, 0, 0, 0, 0, 35, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 95, 112, 97, 116, 
-    104, 95, 106, 111, 105, 110, 46, 57, 48, 58, 
-    52, 0, 165, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 32, 1, 0, 49, 0, 1, 3, 
-    79, 2, 0, 22, 0, 158, 0, 0, 0, 33, 
-    1, 0, 32, 2, 0, 74, 2, 10, 1, 1, 
-    0, 75, 1, 0, 30, 3, 1, 6, 1, 0, 
-    3, 0, 79, 2, 1, 22, 1, 145, 0, 0, 
-    0, 30, 0, 2, 45, 1, 0, 3, 2, 0, 
-    45, 2, 2, 33, 1, 1, 33, 0, 2, 27, 
-    2, 0, 12, 32, 3, 0, 74, 2, 74, 3, 
-    10, 1, 2, 0, 75, 1, 0, 75, 1, 0, 
-    13, 4, 0, 17, 0, 0, 0, 0, 9, 0, 
-    4, 92, 0, 0, 0, 0, 0, 0, 0, 50, 
-    2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 
-    0, 45, 3, 1, 45, 4, 2, 17, 0, 0, 
-    0, 0, 32, 1, 3, 34, 2, 1, 6, 33, 
-    3, 3, 74, 3, 10, 2, 1, 0, 75, 1, 
-    0, 79, 1, 0, 22, 0, 7, 0, 0, 0, 
-    32, 1, 3, 34, 2, 1, 8, 33, 3, 3, 
-    74, 3, 10, 2, 1, 0, 75, 1, 0, 17, 
-    0, 0, 0, 0, 79, 1, 0, 22, 0, 50, 
-    0, 0, 0, 32, 1, 3, 34, 2, 1, 8, 
-    30, 3, 3, 74, 3, 10, 2, 1, 0, 75, 
-    1, 0, 79, 1, 0, 22, 0, 13, 0, 0, 
-    0, 32, 1, 3, 79, 0, 1, 22, 1, 2, 
-    0, 0, 0, 32, 1, 1, 17, 0, 0, 0, 
-    0, 45, 1, 1, 32, 2, 2, 34, 1, 2, 
-    10, 32, 3, 4, 74, 3, 10, 1, 1, 0, 
-    75, 1, 0, 17, 28, 0, 0, 0, 32, 1, 
-    1, 34, 2, 1, 9, 10, 2, 0, 0, 32, 
-    1, 3, 34, 2, 1, 9, 74, 0, 10, 2, 
-    0, 0, 39, 3, 0, 75, 0, 0, 6, 1, 
-    0, 3, 1, 79, 2, 1, 22, 1, 7, 0, 
-    0, 0, 32, 0, 2, 34, 1, 0, 10, 32, 
-    2, 4, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 17, 8, 0, 0, 0, 32, 0, 3, 45, 
-    1, 0, 32, 2, 4, 74, 2, 3, 0, 1, 
-    75, 1, 0, 45, 2, 0, 17, 0, 0, 0, 
-    0, 17, 0, 0, 0, 0, 17, 19, 0, 0, 
-    0, 32, 0, 3, 34, 1, 0, 7, 33, 2, 
-    4, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
-    79, 3, 0, 22, 0, 2, 0, 0, 0, 32, 
-    0, 1, 17, 0, 0, 0, 0, 45, 1, 0, 
-    33, 2, 5, 32, 0, 4, 0, 1, 2, 0, 
-    0, 74, 1, 3, 3, 1, 75, 1, 200, 45, 
-    2, 3, 17, 0, 0, 0, 0, 17, 0, 0, 
-    0, 0, 9, 0, 4, 0, 0, 0, 0, 164, 
-    255, 255, 255, 17, 0, 0, 0, 0, 30, 0, 
-    4, 36, 1, 0, 0, 0, 0, 0, 32, 2, 
-    2, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
-    45, 2, 0, 33, 1, 0, 32, 2, 2, 74, 
-    2, 10, 1, 1, 0, 75, 1, 29, 30, 3, 
-    1, 6, 1, 0, 3, 0, 79, 2, 1, 19, 
-    1, 5, 0, 0, 0, 32, 0, 2, 30, 2, 
-    5, 1, 3, 0, 2, 49, 1, 3, 3, 17, 
-    0, 0, 0, 0, 79, 0, 1, 22, 1, 9, 
-    0, 0, 0, 32, 2, 1, 33, 0, 5, 34, 
-    1, 0, 11, 32, 3, 2, 74, 3, 10, 1, 
-    1, 0, 75, 1, 219, 0, 4, 2, 0, 0, 
+    0, 32, 1, 3, 34, 2, 1, 9, 1, 32, 
+    74, 0, 38, 2, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 
+    3, 0, 75, 0, 0, 6, 1, 0, 3, 1, 
+    79, 2, 1, 22, 1, 5, 0, 0, 0, 32, 
+    0, 2, 34, 1, 0, 10, 1, 32, 32, 2, 
+    4, 38, 1, 32, 1, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 
+    8, 0, 0, 0, 32, 0, 3, 45, 1, 0, 
+    32, 2, 4, 74, 2, 3, 0, 1, 75, 1, 
+    0, 45, 2, 0, 17, 0, 0, 0, 0, 17, 
+    0, 0, 0, 0, 17, 17, 0, 0, 0, 32, 
+    0, 3, 34, 1, 0, 7, 1, 32, 33, 2, 
+    4, 38, 1, 32, 1, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 
+    3, 0, 22, 0, 2, 0, 0, 0, 32, 0, 
+    1, 17, 0, 0, 0, 0, 45, 1, 0, 33, 
+    2, 5, 32, 0, 4, 0, 1, 2, 0, 0, 
+    74, 1, 3, 3, 1, 75, 1, 200, 45, 2, 
+    3, 17, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 9, 0, 4, 0, 0, 0, 0, 176, 255, 
+    255, 255, 17, 0, 0, 0, 0, 30, 0, 4, 
+    36, 1, 0, 0, 0, 0, 0, 32, 2, 2, 
+    74, 2, 10, 1, 1, 0, 75, 1, 0, 45, 
+    2, 0, 33, 1, 0, 32, 2, 2, 74, 2, 
+    10, 1, 1, 0, 75, 1, 29, 30, 3, 1, 
+    6, 1, 0, 3, 0, 79, 2, 1, 19, 1, 
+    5, 0, 0, 0, 32, 0, 2, 30, 2, 5, 
+    1, 3, 0, 2, 49, 1, 3, 3, 17, 0, 
+    0, 0, 0, 79, 0, 1, 22, 1, 7, 0, 
+    0, 0, 32, 2, 1, 33, 0, 5, 34, 1, 
+    0, 11, 1, 32, 32, 3, 2, 38, 1, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 4, 2, 0, 0, 
     41, 4, 32, 0, 1, 33, 1, 5, 0, 2, 
     0, 1, 0, 41, 2, 32, 0, 0, 30, 1, 
     5, 1, 2, 0, 1, 41, 2, 30, 0, 2, 
     41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 2, 31, 0, 0, 0, 0, 
-    0, 0, 0, 82, 101, 112, 108, 97, 99, 101, 
-    109, 101, 110, 116, 32, 102, 111, 114, 32, 111, 
-    115, 46, 112, 97, 116, 104, 46, 106, 111, 105, 
-    110, 40, 41, 46, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 
-    0, 58, 2, 48, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 95, 112, 97, 116, 104, 95, 106, 111, 105, 
-    110, 46, 60, 108, 105, 115, 116, 99, 111, 109, 
-    112, 62, 46, 49, 49, 51, 58, 49, 53, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
+    0, 0, 2, 31, 0, 0, 0, 0, 0, 0, 
+    0, 82, 101, 112, 108, 97, 99, 101, 109, 101, 
+    110, 116, 32, 102, 111, 114, 32, 111, 115, 46, 
+    112, 97, 116, 104, 46, 106, 111, 105, 110, 40, 
+    41, 46, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 1, 0, 0, 0, 0, 0, 0, 0, 58, 
+    2, 48, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
+    112, 97, 116, 104, 95, 106, 111, 105, 110, 46, 
+    60, 108, 105, 115, 116, 99, 111, 109, 112, 62, 
+    46, 49, 49, 51, 58, 49, 53, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 
-    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
-    95, 106, 111, 105, 110, 13, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 108, 101, 110, 3, 0, 0, 0, 0, 0, 
-    0, 0, 109, 97, 112, 3, 0, 0, 0, 0, 
-    0, 0, 0, 95, 111, 115, 14, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 
+    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 95, 112, 97, 116, 104, 95, 106, 
+    111, 105, 110, 13, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 108, 
+    101, 110, 3, 0, 0, 0, 0, 0, 0, 0, 
+    109, 97, 112, 3, 0, 0, 0, 0, 0, 0, 
+    0, 95, 111, 115, 14, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 116, 104, 95, 115, 101, 112, 
+    95, 116, 117, 112, 108, 101, 15, 0, 0, 0, 
     0, 0, 0, 0, 112, 97, 116, 104, 95, 115, 
-    101, 112, 95, 116, 117, 112, 108, 101, 15, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    95, 115, 101, 112, 97, 114, 97, 116, 111, 114, 
-    115, 8, 0, 0, 0, 0, 0, 0, 0, 112, 
-    97, 116, 104, 95, 115, 101, 112, 10, 0, 0, 
-    0, 0, 0, 0, 0, 115, 116, 97, 114, 116, 
-    115, 119, 105, 116, 104, 6, 0, 0, 0, 0, 
-    0, 0, 0, 114, 115, 116, 114, 105, 112, 8, 
-    0, 0, 0, 0, 0, 0, 0, 101, 110, 100, 
-    115, 119, 105, 116, 104, 8, 0, 0, 0, 0, 
-    0, 0, 0, 99, 97, 115, 101, 102, 111, 108, 
-    100, 6, 0, 0, 0, 0, 0, 0, 0, 97, 
-    112, 112, 101, 110, 100, 4, 0, 0, 0, 0, 
-    0, 0, 0, 106, 111, 105, 110, 15, 0, 0, 
-    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
-    95, 115, 112, 108, 105, 116, 114, 111, 111, 116, 
-    0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
-    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 95, 112, 
-    97, 114, 116, 115, 4, 0, 0, 0, 0, 0, 
-    0, 0, 114, 111, 111, 116, 4, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 8, 0, 
-    0, 0, 0, 0, 0, 0, 110, 101, 119, 95, 
+    101, 112, 97, 114, 97, 116, 111, 114, 115, 8, 
+    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
+    104, 95, 115, 101, 112, 10, 0, 0, 0, 0, 
+    0, 0, 0, 115, 116, 97, 114, 116, 115, 119, 
+    105, 116, 104, 6, 0, 0, 0, 0, 0, 0, 
+    0, 114, 115, 116, 114, 105, 112, 8, 0, 0, 
+    0, 0, 0, 0, 0, 101, 110, 100, 115, 119, 
+    105, 116, 104, 8, 0, 0, 0, 0, 0, 0, 
+    0, 99, 97, 115, 101, 102, 111, 108, 100, 6, 
+    0, 0, 0, 0, 0, 0, 0, 97, 112, 112, 
+    101, 110, 100, 4, 0, 0, 0, 0, 0, 0, 
+    0, 106, 111, 105, 110, 15, 0, 0, 0, 0, 
+    0, 0, 0, 95, 112, 97, 116, 104, 95, 115, 
+    112, 108, 105, 116, 114, 111, 111, 116, 0, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 116, 104, 95, 112, 97, 114, 
+    116, 115, 4, 0, 0, 0, 0, 0, 0, 0, 
     114, 111, 111, 116, 4, 0, 0, 0, 0, 0, 
-    0, 0, 116, 97, 105, 108, 32, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 116, 104, 8, 0, 0, 0, 
+    0, 0, 0, 0, 110, 101, 119, 95, 114, 111, 
+    111, 116, 4, 0, 0, 0, 0, 0, 0, 0, 
+    116, 97, 105, 108, 32, 0, 0, 0, 0, 0, 
     0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    53, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 69, 120, 
-    116, 101, 110, 115, 105, 111, 110, 70, 105, 108, 
-    101, 76, 111, 97, 100, 101, 114, 46, 95, 95, 
-    101, 113, 95, 95, 46, 49, 49, 54, 51, 58, 
-    52, 0, 14, 0, 0, 0, 0, 0, 0, 0, 
-    32, 0, 0, 27, 1, 0, 0, 32, 2, 1, 
-    27, 0, 2, 0, 6, 3, 1, 0, 0, 79, 
-    2, 3, 19, 3, 6, 0, 0, 0, 32, 0, 
-    0, 27, 1, 0, 1, 32, 2, 1, 27, 0, 
-    2, 1, 6, 3, 1, 0, 0, 17, 0, 0, 
-    0, 0, 41, 3, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 53, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 69, 120, 116, 101, 
+    110, 115, 105, 111, 110, 70, 105, 108, 101, 76, 
+    111, 97, 100, 101, 114, 46, 95, 95, 101, 113, 
+    95, 95, 46, 49, 49, 54, 51, 58, 52, 0, 
+    14, 0, 0, 0, 0, 0, 0, 0, 32, 0, 
+    0, 27, 1, 0, 0, 32, 2, 1, 27, 0, 
+    2, 0, 6, 3, 1, 0, 0, 79, 2, 3, 
+    19, 3, 6, 0, 0, 0, 32, 0, 0, 27, 
+    1, 0, 1, 32, 2, 1, 27, 0, 2, 1, 
+    6, 3, 1, 0, 0, 17, 0, 0, 0, 0, 
+    41, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 101, 113, 95, 95, 2, 0, 0, 0, 0, 
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 99, 108, 97, 115, 115, 95, 95, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    100, 105, 99, 116, 95, 95, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 5, 0, 0, 0, 0, 0, 
+    0, 0, 111, 116, 104, 101, 114, 32, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 53, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
+    76, 111, 97, 100, 101, 114, 66, 97, 115, 105, 
+    99, 115, 46, 99, 114, 101, 97, 116, 101, 95, 
+    109, 111, 100, 117, 108, 101, 46, 56, 52, 48, 
+    58, 52, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 30, 1, 1, 41, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    42, 0, 0, 0, 0, 0, 0, 0, 85, 115, 
+    101, 32, 100, 101, 102, 97, 117, 108, 116, 32, 
+    115, 101, 109, 97, 110, 116, 105, 99, 115, 32, 
+    102, 111, 114, 32, 109, 111, 100, 117, 108, 101, 
+    32, 99, 114, 101, 97, 116, 105, 111, 110, 46, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    13, 0, 0, 0, 0, 0, 0, 0, 99, 114, 
+    101, 97, 116, 101, 95, 109, 111, 100, 117, 108, 
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 115, 101, 108, 102, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 112, 101, 99, 33, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 70, 105, 108, 101, 76, 111, 97, 100, 101, 
+    114, 46, 108, 111, 97, 100, 95, 109, 111, 100, 
+    117, 108, 101, 46, 49, 48, 49, 56, 58, 52, 
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 33, 1, 0, 33, 2, 1, 32, 3, 
+    0, 74, 2, 74, 3, 10, 1, 2, 0, 75, 
+    1, 0, 75, 1, 0, 34, 4, 0, 2, 1, 
+    32, 32, 1, 1, 38, 4, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 2, 100, 0, 0, 0, 0, 
+    0, 0, 0, 76, 111, 97, 100, 32, 97, 32, 
+    109, 111, 100, 117, 108, 101, 32, 102, 114, 111, 
+    109, 32, 97, 32, 102, 105, 108, 101, 46, 10, 
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 84, 
+    104, 105, 115, 32, 109, 101, 116, 104, 111, 100, 
+    32, 105, 115, 32, 100, 101, 112, 114, 101, 99, 
+    97, 116, 101, 100, 46, 32, 32, 85, 115, 101, 
+    32, 101, 120, 101, 99, 95, 109, 111, 100, 117, 
+    108, 101, 40, 41, 32, 105, 110, 115, 116, 101, 
+    97, 100, 46, 10, 10, 32, 32, 32, 32, 32, 
+    32, 32, 32, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 99, 108, 
+    97, 115, 115, 95, 95, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 11, 
+    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
+    100, 95, 109, 111, 100, 117, 108, 101, 3, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 115, 117, 112, 101, 114, 10, 
+    0, 0, 0, 0, 0, 0, 0, 70, 105, 108, 
+    101, 76, 111, 97, 100, 101, 114, 11, 0, 0, 
+    0, 0, 0, 0, 0, 108, 111, 97, 100, 95, 
+    109, 111, 100, 117, 108, 101, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 8, 0, 0, 0, 0, 0, 
+    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
+    33, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 
+    0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 95, 99, 104, 101, 99, 107, 95, 110, 
+    97, 109, 101, 46, 95, 119, 114, 97, 112, 46, 
+    53, 51, 51, 58, 56, 0, 67, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 30, 1, 1, 
+    30, 2, 2, 30, 3, 3, 74, 0, 74, 1, 
+    74, 2, 74, 3, 3, 4, 4, 75, 1, 0, 
+    75, 1, 0, 75, 1, 0, 75, 1, 0, 13, 
+    5, 4, 17, 0, 0, 0, 0, 9, 0, 5, 
+    42, 0, 0, 0, 0, 0, 0, 0, 45, 2, 
+    0, 17, 0, 0, 0, 0, 33, 1, 0, 32, 
+    2, 1, 32, 3, 2, 74, 0, 74, 2, 74, 
+    3, 10, 1, 2, 0, 75, 1, 0, 75, 1, 
+    0, 39, 4, 0, 75, 0, 0, 79, 6, 4, 
+    19, 4, 25, 0, 0, 0, 33, 1, 1, 32, 
+    2, 0, 32, 3, 2, 33, 4, 2, 32, 6, 
+    1, 32, 7, 2, 74, 0, 74, 6, 74, 7, 
+    10, 4, 2, 0, 75, 1, 0, 75, 1, 0, 
+    39, 8, 0, 75, 0, 0, 74, 0, 74, 2, 
+    74, 3, 74, 8, 10, 1, 3, 0, 75, 1, 
+    0, 75, 1, 250, 75, 1, 0, 39, 9, 0, 
+    75, 0, 0, 17, 0, 0, 0, 0, 17, 0, 
+    0, 0, 0, 9, 0, 5, 0, 0, 0, 0, 
+    214, 255, 255, 255, 17, 0, 0, 0, 0, 32, 
+    0, 0, 27, 1, 0, 4, 34, 2, 1, 3, 
+    1, 32, 32, 3, 1, 27, 1, 3, 4, 38, 
+    2, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 30, 3, 4, 
+    41, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 2, 10, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 109, 111, 100, 117, 108, 101, 95, 
+    95, 2, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 110, 97, 109, 101, 95, 95, 2, 12, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 113, 
+    117, 97, 108, 110, 97, 109, 101, 95, 95, 2, 
+    7, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    100, 111, 99, 95, 95, 5, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 95, 119, 114, 97, 112, 5, 0, 
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
+    0, 0, 0, 0, 104, 97, 115, 97, 116, 116, 
+    114, 7, 0, 0, 0, 0, 0, 0, 0, 115, 
+    101, 116, 97, 116, 116, 114, 7, 0, 0, 0, 
+    0, 0, 0, 0, 103, 101, 116, 97, 116, 116, 
+    114, 6, 0, 0, 0, 0, 0, 0, 0, 117, 
+    112, 100, 97, 116, 101, 8, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 100, 105, 99, 116, 95, 
+    95, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 110, 101, 119, 3, 0, 
+    0, 0, 0, 0, 0, 0, 111, 108, 100, 7, 
+    0, 0, 0, 0, 0, 0, 0, 114, 101, 112, 
+    108, 97, 99, 101, 33, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 41, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 95, 103, 101, 116, 
+    95, 115, 111, 117, 114, 99, 101, 102, 105, 108, 
+    101, 46, 52, 55, 49, 58, 48, 0, 80, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 33, 
+    1, 0, 32, 2, 0, 74, 2, 10, 1, 1, 
+    0, 75, 1, 0, 30, 3, 1, 6, 1, 0, 
+    3, 0, 79, 2, 1, 22, 1, 68, 0, 0, 
+    0, 32, 0, 0, 34, 1, 0, 5, 1, 32, 
+    30, 2, 2, 38, 1, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 101, 113, 95, 95, 2, 
-    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 99, 108, 97, 
-    115, 115, 95, 95, 8, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 100, 105, 99, 116, 95, 95, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 101, 108, 102, 5, 0, 
-    0, 0, 0, 0, 0, 0, 111, 116, 104, 101, 
-    114, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 95, 76, 111, 97, 100, 101, 114, 
-    66, 97, 115, 105, 99, 115, 46, 99, 114, 101, 
-    97, 116, 101, 95, 109, 111, 100, 117, 108, 101, 
-    46, 56, 52, 48, 58, 52, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 30, 1, 
-    1, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 2, 42, 0, 0, 0, 
-    0, 0, 0, 0, 85, 115, 101, 32, 100, 101, 
-    102, 97, 117, 108, 116, 32, 115, 101, 109, 97, 
-    110, 116, 105, 99, 115, 32, 102, 111, 114, 32, 
-    109, 111, 100, 117, 108, 101, 32, 99, 114, 101, 
-    97, 116, 105, 111, 110, 46, 5, 0, 0, 0, 
+    0, 50, 3, 0, 0, 0, 0, 0, 0, 0, 
+    3, 4, 5, 0, 45, 1, 3, 45, 2, 4, 
+    45, 3, 5, 32, 0, 1, 49, 1, 0, 3, 
+    79, 2, 1, 22, 1, 13, 0, 0, 0, 32, 
+    2, 3, 34, 3, 2, 6, 1, 32, 38, 3, 
+    32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 30, 2, 3, 49, 3, 
+    2, 1, 30, 4, 4, 49, 2, 4, 1, 30, 
+    5, 5, 62, 4, 3, 3, 2, 5, 1, 6, 
+    0, 4, 30, 2, 6, 6, 1, 6, 2, 1, 
+    17, 0, 0, 0, 0, 79, 0, 1, 22, 1, 
+    39, 0, 0, 0, 17, 19, 0, 0, 0, 33, 
+    0, 2, 33, 1, 3, 74, 0, 74, 1, 4, 
+    2, 2, 75, 1, 0, 75, 1, 0, 21, 2, 
+    10, 0, 0, 0, 32, 0, 0, 30, 1, 5, 
+    30, 2, 4, 49, 3, 2, 1, 30, 4, 5, 
+    62, 2, 3, 1, 3, 4, 1, 5, 0, 2, 
+    45, 4, 5, 5, 17, 8, 0, 0, 0, 52, 
+    33, 1, 1, 32, 2, 0, 74, 2, 10, 1, 
+    1, 0, 75, 1, 0, 45, 4, 0, 17, 0, 
+    0, 0, 0, 33, 1, 4, 32, 2, 4, 74, 
+    2, 10, 1, 1, 0, 75, 1, 0, 79, 3, 
+    0, 22, 0, 2, 0, 0, 0, 32, 1, 0, 
+    17, 2, 0, 0, 0, 32, 1, 4, 17, 0, 
+    0, 0, 0, 41, 1, 32, 0, 0, 41, 0, 
+    30, 1, 5, 41, 1, 2, 0, 0, 0, 0, 
+    0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 
+    0, 38, 0, 0, 0, 0, 0, 0, 0, 38, 
+    0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 
+    0, 0, 0, 0, 0, 63, 0, 0, 0, 0, 
+    0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
+    0, 0, 0, 2, 188, 0, 0, 0, 0, 0, 
+    0, 0, 67, 111, 110, 118, 101, 114, 116, 32, 
+    97, 32, 98, 121, 116, 101, 99, 111, 100, 101, 
+    32, 102, 105, 108, 101, 32, 112, 97, 116, 104, 
+    32, 116, 111, 32, 97, 32, 115, 111, 117, 114, 
+    99, 101, 32, 112, 97, 116, 104, 32, 40, 105, 
+    102, 32, 112, 111, 115, 115, 105, 98, 108, 101, 
+    41, 46, 10, 10, 32, 32, 32, 32, 84, 104, 
+    105, 115, 32, 102, 117, 110, 99, 116, 105, 111, 
+    110, 32, 101, 120, 105, 115, 116, 115, 32, 112, 
+    117, 114, 101, 108, 121, 32, 102, 111, 114, 32, 
+    98, 97, 99, 107, 119, 97, 114, 100, 115, 45, 
+    99, 111, 109, 112, 97, 116, 105, 98, 105, 108, 
+    105, 116, 121, 32, 102, 111, 114, 10, 32, 32, 
+    32, 32, 80, 121, 73, 109, 112, 111, 114, 116, 
+    95, 69, 120, 101, 99, 67, 111, 100, 101, 77, 
+    111, 100, 117, 108, 101, 87, 105, 116, 104, 70, 
+    105, 108, 101, 110, 97, 109, 101, 115, 40, 41, 
+    32, 105, 110, 32, 116, 104, 101, 32, 67, 32, 
+    65, 80, 73, 46, 10, 10, 32, 32, 32, 32, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    1, 0, 0, 0, 0, 0, 0, 0, 46, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 5, 2, 2, 
+    0, 0, 0, 0, 0, 0, 0, 112, 121, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 
-    0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 
-    95, 109, 111, 100, 117, 108, 101, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 112, 101, 99, 32, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 49, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 15, 0, 
+    0, 0, 0, 0, 0, 0, 95, 103, 101, 116, 
+    95, 115, 111, 117, 114, 99, 101, 102, 105, 108, 
+    101, 7, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 108, 101, 110, 
+    17, 0, 0, 0, 0, 0, 0, 0, 115, 111, 
+    117, 114, 99, 101, 95, 102, 114, 111, 109, 95, 
+    99, 97, 99, 104, 101, 19, 0, 0, 0, 0, 
+    0, 0, 0, 78, 111, 116, 73, 109, 112, 108, 
+    101, 109, 101, 110, 116, 101, 100, 69, 114, 114, 
+    111, 114, 10, 0, 0, 0, 0, 0, 0, 0, 
+    86, 97, 108, 117, 101, 69, 114, 114, 111, 114, 
+    12, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
+    97, 116, 104, 95, 105, 115, 102, 105, 108, 101, 
+    10, 0, 0, 0, 0, 0, 0, 0, 114, 112, 
+    97, 114, 116, 105, 116, 105, 111, 110, 5, 0, 
+    0, 0, 0, 0, 0, 0, 108, 111, 119, 101, 
+    114, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 
+    0, 0, 0, 0, 0, 98, 121, 116, 101, 99, 
+    111, 100, 101, 95, 112, 97, 116, 104, 4, 0, 
+    0, 0, 0, 0, 0, 0, 114, 101, 115, 116, 
+    1, 0, 0, 0, 0, 0, 0, 0, 95, 9, 
+    0, 0, 0, 0, 0, 0, 0, 101, 120, 116, 
+    101, 110, 115, 105, 111, 110, 11, 0, 0, 0, 
+    0, 0, 0, 0, 115, 111, 117, 114, 99, 101, 
+    95, 112, 97, 116, 104, 32, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 54, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
     111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 70, 105, 108, 
-    101, 76, 111, 97, 100, 101, 114, 46, 108, 111, 
-    97, 100, 95, 109, 111, 100, 117, 108, 101, 46, 
-    49, 48, 49, 56, 58, 52, 0, 15, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
-    0, 33, 2, 1, 32, 3, 0, 74, 2, 74, 
-    3, 10, 1, 2, 0, 75, 1, 0, 75, 1, 
-    0, 34, 4, 0, 2, 32, 1, 1, 74, 1, 
-    10, 4, 1, 0, 75, 1, 138, 41, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    116, 101, 114, 110, 97, 108, 46, 83, 111, 117, 
+    114, 99, 101, 70, 105, 108, 101, 76, 111, 97, 
+    100, 101, 114, 46, 112, 97, 116, 104, 95, 115, 
+    116, 97, 116, 115, 46, 49, 48, 55, 54, 58, 
+    52, 0, 24, 0, 0, 0, 0, 0, 0, 0, 
+    30, 0, 0, 33, 1, 0, 32, 2, 1, 74, 
+    2, 10, 1, 1, 0, 75, 1, 0, 45, 2, 
+    0, 30, 1, 1, 30, 0, 2, 32, 1, 2, 
+    27, 2, 1, 1, 30, 3, 3, 32, 1, 2, 
+    27, 4, 1, 2, 74, 0, 74, 3, 74, 2, 
+    74, 4, 2, 5, 2, 75, 1, 173, 75, 1, 
+    172, 75, 1, 172, 75, 1, 172, 41, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 2, 100, 0, 0, 0, 0, 0, 0, 0, 
-    76, 111, 97, 100, 32, 97, 32, 109, 111, 100, 
-    117, 108, 101, 32, 102, 114, 111, 109, 32, 97, 
-    32, 102, 105, 108, 101, 46, 10, 10, 32, 32, 
-    32, 32, 32, 32, 32, 32, 84, 104, 105, 115, 
-    32, 109, 101, 116, 104, 111, 100, 32, 105, 115, 
-    32, 100, 101, 112, 114, 101, 99, 97, 116, 101, 
-    100, 46, 32, 32, 85, 115, 101, 32, 101, 120, 
-    101, 99, 95, 109, 111, 100, 117, 108, 101, 40, 
-    41, 32, 105, 110, 115, 116, 101, 97, 100, 46, 
-    10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 99, 108, 97, 115, 115, 
-    95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
-    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
-    0, 0, 0, 0, 108, 111, 97, 100, 95, 109, 
-    111, 100, 117, 108, 101, 3, 0, 0, 0, 0, 
-    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
-    0, 115, 117, 112, 101, 114, 10, 0, 0, 0, 
-    0, 0, 0, 0, 70, 105, 108, 101, 76, 111, 
-    97, 100, 101, 114, 11, 0, 0, 0, 0, 0, 
-    0, 0, 108, 111, 97, 100, 95, 109, 111, 100, 
-    117, 108, 101, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
-    102, 8, 0, 0, 0, 0, 0, 0, 0, 102, 
-    117, 108, 108, 110, 97, 109, 101, 32, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 
-    0, 43, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
-    99, 104, 101, 99, 107, 95, 110, 97, 109, 101, 
-    46, 95, 119, 114, 97, 112, 46, 53, 51, 51, 
-    58, 56, 0, 69, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 30, 1, 1, 30, 2, 2, 
-    30, 3, 3, 74, 0, 74, 1, 74, 2, 74, 
-    3, 3, 4, 4, 75, 1, 0, 75, 1, 0, 
-    75, 1, 0, 75, 1, 0, 13, 5, 4, 17, 
-    0, 0, 0, 0, 9, 0, 5, 42, 0, 0, 
-    0, 0, 0, 0, 0, 45, 2, 0, 17, 0, 
-    0, 0, 0, 33, 1, 0, 32, 2, 1, 32, 
-    3, 2, 74, 0, 74, 2, 74, 3, 10, 1, 
-    2, 0, 75, 1, 0, 75, 1, 0, 39, 4, 
-    0, 75, 0, 0, 79, 6, 4, 19, 4, 25, 
-    0, 0, 0, 33, 1, 1, 32, 2, 0, 32, 
-    3, 2, 33, 4, 2, 32, 6, 1, 32, 7, 
-    2, 74, 0, 74, 6, 74, 7, 10, 4, 2, 
-    0, 75, 1, 0, 75, 1, 0, 39, 8, 0, 
-    75, 0, 0, 74, 0, 74, 2, 74, 3, 74, 
-    8, 10, 1, 3, 0, 75, 1, 0, 75, 1, 
-    250, 75, 1, 0, 39, 9, 0, 75, 0, 0, 
-    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
-    9, 0, 5, 0, 0, 0, 0, 214, 255, 255, 
-    255, 17, 0, 0, 0, 0, 32, 0, 0, 27, 
-    1, 0, 4, 34, 2, 1, 3, 32, 3, 1, 
-    27, 1, 3, 4, 74, 1, 10, 2, 1, 0, 
-    75, 1, 172, 30, 3, 4, 41, 3, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 2, 
+    33, 0, 0, 0, 0, 0, 0, 0, 82, 101, 
+    116, 117, 114, 110, 32, 116, 104, 101, 32, 109, 
+    101, 116, 97, 100, 97, 116, 97, 32, 102, 111, 
+    114, 32, 116, 104, 101, 32, 112, 97, 116, 104, 
+    46, 5, 2, 5, 0, 0, 0, 0, 0, 0, 
+    0, 109, 116, 105, 109, 101, 2, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 105, 122, 101, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
-    2, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 109, 111, 100, 117, 108, 101, 95, 95, 2, 
-    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    110, 97, 109, 101, 95, 95, 2, 12, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 113, 117, 97, 
-    108, 110, 97, 109, 101, 95, 95, 2, 7, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 100, 111, 
-    99, 95, 95, 5, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 
-    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
-    0, 95, 119, 114, 97, 112, 5, 0, 0, 0, 
-    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
-    0, 0, 104, 97, 115, 97, 116, 116, 114, 7, 
-    0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 
-    97, 116, 116, 114, 7, 0, 0, 0, 0, 0, 
-    0, 0, 103, 101, 116, 97, 116, 116, 114, 6, 
-    0, 0, 0, 0, 0, 0, 0, 117, 112, 100, 
-    97, 116, 101, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 100, 105, 99, 116, 95, 95, 0, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 110, 101, 119, 3, 0, 0, 0, 
-    0, 0, 0, 0, 111, 108, 100, 7, 0, 0, 
-    0, 0, 0, 0, 0, 114, 101, 112, 108, 97, 
-    99, 101, 32, 0, 0, 0, 0, 0, 0, 0, 
-    5, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
-    0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 95, 103, 101, 116, 95, 115, 
-    111, 117, 114, 99, 101, 102, 105, 108, 101, 46, 
-    52, 55, 49, 58, 48, 0, 84, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 33, 1, 0, 
-    32, 2, 0, 74, 2, 10, 1, 1, 0, 75, 
-    1, 0, 30, 3, 1, 6, 1, 0, 3, 0, 
-    79, 2, 1, 22, 1, 72, 0, 0, 0, 32, 
-    0, 0, 34, 1, 0, 5, 30, 2, 2, 74, 
-    2, 10, 1, 1, 0, 75, 1, 0, 50, 3, 
-    0, 0, 0, 0, 0, 0, 0, 3, 4, 5, 
-    0, 45, 1, 3, 45, 2, 4, 45, 3, 5, 
-    32, 0, 1, 49, 1, 0, 3, 79, 2, 1, 
-    22, 1, 13, 0, 0, 0, 32, 2, 3, 34, 
-    3, 2, 6, 10, 3, 0, 0, 30, 2, 3, 
-    49, 3, 2, 1, 30, 4, 4, 49, 2, 4, 
-    1, 30, 5, 5, 62, 4, 3, 3, 2, 5, 
-    1, 6, 0, 4, 30, 2, 6, 6, 1, 6, 
-    2, 1, 17, 0, 0, 0, 0, 79, 0, 1, 
-    22, 1, 41, 0, 0, 0, 42, 1, 0, 0, 
-    0, 17, 19, 0, 0, 0, 33, 0, 2, 33, 
-    1, 3, 74, 0, 74, 1, 4, 2, 2, 75, 
-    1, 0, 75, 1, 0, 21, 2, 10, 0, 0, 
-    0, 32, 0, 0, 30, 1, 5, 30, 2, 4, 
-    49, 3, 2, 1, 30, 4, 5, 62, 2, 3, 
-    1, 3, 4, 1, 5, 0, 2, 45, 4, 5, 
-    5, 17, 9, 0, 0, 0, 52, 33, 1, 1, 
-    32, 2, 0, 74, 2, 10, 1, 1, 0, 75, 
-    1, 0, 45, 4, 0, 54, 17, 0, 0, 0, 
-    0, 33, 1, 4, 32, 2, 4, 74, 2, 10, 
-    1, 1, 0, 75, 1, 0, 79, 3, 0, 22, 
-    0, 2, 0, 0, 0, 32, 1, 0, 17, 2, 
-    0, 0, 0, 32, 1, 4, 17, 0, 0, 0, 
-    0, 41, 1, 32, 0, 0, 41, 0, 30, 1, 
-    5, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
-    0, 0, 0, 0, 0, 2, 188, 0, 0, 0, 
-    0, 0, 0, 0, 67, 111, 110, 118, 101, 114, 
-    116, 32, 97, 32, 98, 121, 116, 101, 99, 111, 
-    100, 101, 32, 102, 105, 108, 101, 32, 112, 97, 
-    116, 104, 32, 116, 111, 32, 97, 32, 115, 111, 
-    117, 114, 99, 101, 32, 112, 97, 116, 104, 32, 
-    40, 105, 102, 32, 112, 111, 115, 115, 105, 98, 
-    108, 101, 41, 46, 10, 10, 32, 32, 32, 32, 
-    84, 104, 105, 115, 32, 102, 117, 110, 99, 116, 
-    105, 111, 110, 32, 101, 120, 105, 115, 116, 115, 
-    32, 112, 117, 114, 101, 108, 121, 32, 102, 111, 
-    114, 32, 98, 97, 99, 107, 119, 97, 114, 100, 
-    115, 45, 99, 111, 109, 112, 97, 116, 105, 98, 
-    105, 108, 105, 116, 121, 32, 102, 111, 114, 10, 
-    32, 32, 32, 32, 80, 121, 73, 109, 112, 111, 
-    114, 116, 95, 69, 120, 101, 99, 67, 111, 100, 
-    101, 77, 111, 100, 117, 108, 101, 87, 105, 116, 
-    104, 70, 105, 108, 101, 110, 97, 109, 101, 115, 
-    40, 41, 32, 105, 110, 32, 116, 104, 101, 32, 
-    67, 32, 65, 80, 73, 46, 10, 10, 32, 32, 
-    32, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 
-    46, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 5, 
-    2, 2, 0, 0, 0, 0, 0, 0, 0, 112, 
-    121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
+    95, 115, 116, 97, 116, 115, 3, 0, 0, 0, 
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 95, 112, 97, 116, 104, 95, 115, 116, 
+    97, 116, 8, 0, 0, 0, 0, 0, 0, 0, 
+    115, 116, 95, 109, 116, 105, 109, 101, 7, 0, 
+    0, 0, 0, 0, 0, 0, 115, 116, 95, 115, 
+    105, 122, 101, 0, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 2, 0, 0, 0, 0, 0, 0, 
+    0, 115, 116, 33, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
+    114, 110, 97, 108, 46, 95, 112, 97, 116, 104, 
+    95, 106, 111, 105, 110, 46, 49, 50, 48, 58, 
+    52, 0, 14, 0, 0, 0, 0, 0, 0, 0, 
+    30, 0, 0, 33, 1, 0, 34, 2, 1, 1, 
+    1, 32, 30, 0, 1, 36, 1, 0, 0, 0, 
+    0, 0, 32, 3, 0, 74, 3, 10, 1, 1, 
+    0, 75, 1, 173, 74, 0, 38, 2, 32, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 39, 4, 0, 75, 0, 0, 
+    41, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
-    15, 0, 0, 0, 0, 0, 0, 0, 95, 103, 
-    101, 116, 95, 115, 111, 117, 114, 99, 101, 102, 
-    105, 108, 101, 7, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 108, 
-    101, 110, 17, 0, 0, 0, 0, 0, 0, 0, 
-    115, 111, 117, 114, 99, 101, 95, 102, 114, 111, 
-    109, 95, 99, 97, 99, 104, 101, 19, 0, 0, 
-    0, 0, 0, 0, 0, 78, 111, 116, 73, 109, 
-    112, 108, 101, 109, 101, 110, 116, 101, 100, 69, 
-    114, 114, 111, 114, 10, 0, 0, 0, 0, 0, 
-    0, 0, 86, 97, 108, 117, 101, 69, 114, 114, 
-    111, 114, 12, 0, 0, 0, 0, 0, 0, 0, 
-    95, 112, 97, 116, 104, 95, 105, 115, 102, 105, 
-    108, 101, 10, 0, 0, 0, 0, 0, 0, 0, 
-    114, 112, 97, 114, 116, 105, 116, 105, 111, 110, 
-    5, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
-    119, 101, 114, 0, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 13, 
-    0, 0, 0, 0, 0, 0, 0, 98, 121, 116, 
-    101, 99, 111, 100, 101, 95, 112, 97, 116, 104, 
-    4, 0, 0, 0, 0, 0, 0, 0, 114, 101, 
-    115, 116, 1, 0, 0, 0, 0, 0, 0, 0, 
-    95, 9, 0, 0, 0, 0, 0, 0, 0, 101, 
-    120, 116, 101, 110, 115, 105, 111, 110, 11, 0, 
-    0, 0, 0, 0, 0, 0, 115, 111, 117, 114, 
-    99, 101, 95, 112, 97, 116, 104, 32, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
-    0, 54, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 83, 
-    111, 117, 114, 99, 101, 70, 105, 108, 101, 76, 
-    111, 97, 100, 101, 114, 46, 112, 97, 116, 104, 
-    95, 115, 116, 97, 116, 115, 46, 49, 48, 55, 
-    54, 58, 52, 0, 24, 0, 0, 0, 0, 0, 
-    0, 0, 30, 0, 0, 33, 1, 0, 32, 2, 
-    1, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
-    45, 2, 0, 30, 1, 1, 30, 0, 2, 32, 
-    1, 2, 27, 2, 1, 1, 30, 3, 3, 32, 
-    1, 2, 27, 4, 1, 2, 74, 0, 74, 3, 
-    74, 2, 74, 4, 2, 5, 2, 75, 1, 173, 
-    75, 1, 172, 75, 1, 172, 75, 1, 172, 41, 
-    5, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 2, 33, 0, 0, 0, 0, 0, 
-    0, 0, 82, 101, 116, 117, 114, 110, 32, 116, 
-    104, 101, 32, 109, 101, 116, 97, 100, 97, 116, 
-    97, 32, 102, 111, 114, 32, 116, 104, 101, 32, 
-    112, 97, 116, 104, 46, 5, 2, 5, 0, 0, 
-    0, 0, 0, 0, 0, 109, 116, 105, 109, 101, 
-    2, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    105, 122, 101, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 31, 0, 0, 0, 0, 0, 0, 
+    0, 82, 101, 112, 108, 97, 99, 101, 109, 101, 
+    110, 116, 32, 102, 111, 114, 32, 111, 115, 46, 
+    112, 97, 116, 104, 46, 106, 111, 105, 110, 40, 
+    41, 46, 2, 48, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 95, 112, 97, 116, 104, 95, 106, 111, 105, 
+    110, 46, 60, 108, 105, 115, 116, 99, 111, 109, 
+    112, 62, 46, 49, 50, 50, 58, 50, 57, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
-    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 95, 115, 116, 97, 116, 115, 
-    3, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
     0, 0, 0, 0, 0, 0, 95, 112, 97, 116, 
-    104, 95, 115, 116, 97, 116, 8, 0, 0, 0, 
-    0, 0, 0, 0, 115, 116, 95, 109, 116, 105, 
-    109, 101, 7, 0, 0, 0, 0, 0, 0, 0, 
-    115, 116, 95, 115, 105, 122, 101, 0, 0, 0, 
+    104, 95, 106, 111, 105, 110, 2, 0, 0, 0, 
+    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 116, 104, 95, 115, 101, 112, 
+    4, 0, 0, 0, 0, 0, 0, 0, 106, 111, 
+    105, 110, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
+    95, 112, 97, 114, 116, 115, 33, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    41, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 95, 109, 
+    97, 107, 101, 95, 114, 101, 108, 97, 120, 95, 
+    99, 97, 115, 101, 46, 53, 54, 58, 48, 0, 
+    34, 0, 0, 0, 0, 0, 0, 0, 33, 0, 
+    0, 27, 1, 0, 4, 34, 2, 1, 3, 1, 
+    32, 33, 3, 1, 38, 2, 32, 1, 0, 0, 
     0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 101, 108, 102, 4, 0, 0, 0, 0, 
-    0, 0, 0, 112, 97, 116, 104, 2, 0, 0, 
-    0, 0, 0, 0, 0, 115, 116, 32, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 36, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
-    112, 97, 116, 104, 95, 106, 111, 105, 110, 46, 
-    49, 50, 48, 58, 52, 0, 16, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 33, 1, 0, 
-    34, 2, 1, 1, 30, 0, 1, 36, 1, 0, 
-    0, 0, 0, 0, 32, 3, 0, 74, 3, 10, 
-    1, 1, 0, 75, 1, 173, 74, 0, 74, 0, 
-    10, 2, 1, 0, 75, 1, 10, 39, 4, 0, 
-    75, 0, 0, 41, 4, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 31, 0, 
-    0, 0, 0, 0, 0, 0, 82, 101, 112, 108, 
-    97, 99, 101, 109, 101, 110, 116, 32, 102, 111, 
-    114, 32, 111, 115, 46, 112, 97, 116, 104, 46, 
-    106, 111, 105, 110, 40, 41, 46, 2, 48, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 95, 112, 97, 116, 
-    104, 95, 106, 111, 105, 110, 46, 60, 108, 105, 
-    115, 116, 99, 111, 109, 112, 62, 46, 49, 50, 
-    50, 58, 50, 57, 0, 0, 0, 0, 0, 0, 
+    0, 0, 79, 1, 0, 22, 0, 4, 0, 0, 
+    0, 30, 1, 0, 36, 0, 1, 0, 0, 0, 
+    0, 45, 0, 0, 17, 21, 0, 0, 0, 33, 
+    0, 0, 27, 1, 0, 4, 34, 2, 1, 3, 
+    1, 32, 33, 3, 2, 38, 2, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 79, 1, 0, 22, 0, 3, 0, 
+    0, 0, 30, 1, 1, 44, 0, 1, 17, 3, 
+    0, 0, 0, 30, 0, 2, 44, 0, 0, 17, 
+    0, 0, 0, 0, 30, 0, 3, 29, 1, 0, 
+    74, 1, 4, 2, 1, 75, 1, 82, 36, 3, 
+    0, 0, 0, 1, 2, 45, 0, 3, 17, 0, 
+    0, 0, 0, 32, 0, 0, 41, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
-    0, 95, 112, 97, 116, 104, 95, 106, 111, 105, 
-    110, 2, 0, 0, 0, 0, 0, 0, 0, 8, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
-    104, 95, 115, 101, 112, 4, 0, 0, 0, 0, 
-    0, 0, 0, 106, 111, 105, 110, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 95, 112, 97, 114, 116, 
-    115, 32, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 95, 109, 97, 107, 101, 95, 114, 
-    101, 108, 97, 120, 95, 99, 97, 115, 101, 46, 
-    53, 54, 58, 48, 0, 38, 0, 0, 0, 0, 
-    0, 0, 0, 33, 0, 0, 27, 1, 0, 4, 
-    34, 2, 1, 3, 33, 3, 1, 74, 3, 10, 
-    2, 1, 0, 75, 1, 0, 79, 1, 0, 22, 
-    0, 4, 0, 0, 0, 30, 1, 0, 36, 0, 
-    1, 0, 0, 0, 0, 45, 0, 0, 17, 23, 
-    0, 0, 0, 33, 0, 0, 27, 1, 0, 4, 
-    34, 2, 1, 3, 33, 3, 2, 74, 3, 10, 
-    2, 1, 0, 75, 1, 0, 79, 1, 0, 22, 
-    0, 3, 0, 0, 0, 30, 1, 1, 44, 0, 
-    1, 17, 3, 0, 0, 0, 30, 0, 2, 44, 
-    0, 0, 17, 0, 0, 0, 0, 30, 0, 3, 
-    29, 1, 0, 74, 1, 4, 2, 1, 75, 1, 
-    82, 36, 3, 0, 0, 0, 1, 2, 45, 0, 
-    3, 17, 0, 0, 0, 0, 32, 0, 0, 41, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 107, 101, 121, 4, 0, 0, 0, 0, 0, 
-    0, 0, 2, 53, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 95, 109, 97, 107, 101, 95, 114, 101, 108, 
-    97, 120, 95, 99, 97, 115, 101, 46, 95, 114, 
-    101, 108, 97, 120, 95, 99, 97, 115, 101, 46, 
-    54, 55, 58, 56, 3, 12, 0, 0, 0, 0, 
-    0, 0, 0, 80, 89, 84, 72, 79, 78, 67, 
-    65, 83, 69, 79, 75, 2, 12, 0, 0, 0, 
-    0, 0, 0, 0, 80, 89, 84, 72, 79, 78, 
-    67, 65, 83, 69, 79, 75, 2, 53, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 109, 97, 107, 101, 
-    95, 114, 101, 108, 97, 120, 95, 99, 97, 115, 
-    101, 46, 95, 114, 101, 108, 97, 120, 95, 99, 
-    97, 115, 101, 46, 54, 51, 58, 56, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 107, 101, 121, 4, 
+    0, 0, 0, 0, 0, 0, 0, 2, 53, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 95, 109, 97, 107, 
+    101, 95, 114, 101, 108, 97, 120, 95, 99, 97, 
+    115, 101, 46, 95, 114, 101, 108, 97, 120, 95, 
+    99, 97, 115, 101, 46, 54, 55, 58, 56, 3, 
+    12, 0, 0, 0, 0, 0, 0, 0, 80, 89, 
+    84, 72, 79, 78, 67, 65, 83, 69, 79, 75, 
+    2, 12, 0, 0, 0, 0, 0, 0, 0, 80, 
+    89, 84, 72, 79, 78, 67, 65, 83, 69, 79, 
+    75, 2, 53, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    95, 109, 97, 107, 101, 95, 114, 101, 108, 97, 
+    120, 95, 99, 97, 115, 101, 46, 95, 114, 101, 
+    108, 97, 120, 95, 99, 97, 115, 101, 46, 54, 
+    51, 58, 56, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 
-    0, 0, 0, 0, 0, 95, 109, 97, 107, 101, 
-    95, 114, 101, 108, 97, 120, 95, 99, 97, 115, 
-    101, 5, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 115, 121, 115, 
-    27, 0, 0, 0, 0, 0, 0, 0, 95, 67, 
-    65, 83, 69, 95, 73, 78, 83, 69, 78, 83, 
-    73, 84, 73, 86, 69, 95, 80, 76, 65, 84, 
-    70, 79, 82, 77, 83, 35, 0, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 
+    95, 109, 97, 107, 101, 95, 114, 101, 108, 97, 
+    120, 95, 99, 97, 115, 101, 5, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 115, 121, 115, 27, 0, 0, 0, 0, 
     0, 0, 0, 95, 67, 65, 83, 69, 95, 73, 
     78, 83, 69, 78, 83, 73, 84, 73, 86, 69, 
     95, 80, 76, 65, 84, 70, 79, 82, 77, 83, 
-    95, 83, 84, 82, 95, 75, 69, 89, 10, 0, 
-    0, 0, 0, 0, 0, 0, 115, 116, 97, 114, 
-    116, 115, 119, 105, 116, 104, 8, 0, 0, 0, 
-    0, 0, 0, 0, 112, 108, 97, 116, 102, 111, 
-    114, 109, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
-    0, 0, 0, 0, 0, 0, 95, 114, 101, 108, 
-    97, 120, 95, 99, 97, 115, 101, 32, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 60, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 70, 
-    105, 108, 101, 70, 105, 110, 100, 101, 114, 46, 
-    95, 102, 105, 108, 108, 95, 99, 97, 99, 104, 
-    101, 46, 60, 115, 101, 116, 99, 111, 109, 112, 
-    62, 46, 49, 53, 57, 51, 58, 51, 57, 0, 
-    17, 0, 0, 0, 0, 0, 0, 0, 60, 1, 
-    0, 32, 0, 0, 13, 2, 0, 17, 0, 0, 
-    0, 0, 9, 0, 2, 11, 0, 0, 0, 0, 
-    0, 0, 0, 45, 1, 0, 17, 0, 0, 0, 
-    0, 32, 3, 1, 34, 4, 3, 0, 74, 0, 
-    10, 4, 0, 0, 39, 5, 0, 75, 0, 0, 
+    35, 0, 0, 0, 0, 0, 0, 0, 95, 67, 
+    65, 83, 69, 95, 73, 78, 83, 69, 78, 83, 
+    73, 84, 73, 86, 69, 95, 80, 76, 65, 84, 
+    70, 79, 82, 77, 83, 95, 83, 84, 82, 95, 
+    75, 69, 89, 10, 0, 0, 0, 0, 0, 0, 
+    0, 115, 116, 97, 114, 116, 115, 119, 105, 116, 
+    104, 8, 0, 0, 0, 0, 0, 0, 0, 112, 
+    108, 97, 116, 102, 111, 114, 109, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 114, 101, 108, 97, 120, 95, 99, 97, 
+    115, 101, 33, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 70, 105, 108, 101, 70, 105, 
+    110, 100, 101, 114, 46, 95, 102, 105, 108, 108, 
+    95, 99, 97, 99, 104, 101, 46, 60, 115, 101, 
+    116, 99, 111, 109, 112, 62, 46, 49, 53, 57, 
+    51, 58, 51, 57, 0, 17, 0, 0, 0, 0, 
+    0, 0, 0, 60, 1, 0, 32, 0, 0, 13, 
+    2, 0, 17, 0, 0, 0, 0, 9, 0, 2, 
+    11, 0, 0, 0, 0, 0, 0, 0, 45, 1, 
+    0, 17, 0, 0, 0, 0, 32, 3, 1, 34, 
+    4, 3, 0, 1, 32, 74, 0, 38, 4, 32, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 39, 5, 0, 75, 0, 0, 
     59, 1, 5, 17, 0, 0, 0, 0, 9, 0, 
     2, 0, 0, 0, 0, 245, 255, 255, 255, 41, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
-    60, 115, 101, 116, 99, 111, 109, 112, 62, 1, 
-    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
-    0, 0, 0, 0, 0, 108, 111, 119, 101, 114, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    9, 0, 0, 0, 0, 0, 0, 0, 60, 115, 
+    101, 116, 99, 111, 109, 112, 62, 1, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 108, 111, 119, 101, 114, 0, 0, 
     0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 46, 48, 2, 0, 0, 0, 
-    0, 0, 0, 0, 102, 110, 32, 0, 0, 0, 
     0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    35, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 60, 103, 
-    101, 110, 101, 120, 112, 114, 62, 46, 52, 50, 
-    58, 49, 48, 0, 22, 0, 0, 0, 0, 0, 
-    0, 0, 32, 0, 0, 13, 1, 0, 17, 0, 
-    0, 0, 0, 9, 0, 1, 16, 0, 0, 0, 
-    0, 0, 0, 0, 45, 1, 0, 17, 0, 0, 
-    0, 0, 33, 2, 0, 32, 3, 1, 74, 0, 
-    74, 3, 10, 2, 1, 0, 75, 1, 0, 39, 
-    4, 0, 75, 0, 0, 30, 5, 0, 6, 2, 
-    4, 5, 0, 64, 2, 67, 3, 17, 0, 0, 
-    0, 0, 9, 0, 1, 0, 0, 0, 0, 240, 
-    255, 255, 255, 30, 2, 1, 41, 2, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 46, 48, 2, 0, 0, 0, 0, 0, 
+    0, 0, 102, 110, 32, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 35, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 60, 103, 101, 110, 
+    101, 120, 112, 114, 62, 46, 52, 50, 58, 49, 
+    48, 0, 22, 0, 0, 0, 0, 0, 0, 0, 
+    32, 0, 0, 13, 1, 0, 17, 0, 0, 0, 
+    0, 9, 0, 1, 16, 0, 0, 0, 0, 0, 
+    0, 0, 45, 1, 0, 17, 0, 0, 0, 0, 
+    33, 2, 0, 32, 3, 1, 74, 0, 74, 3, 
+    10, 2, 1, 0, 75, 1, 0, 39, 4, 0, 
+    75, 0, 0, 30, 5, 0, 6, 2, 4, 5, 
+    0, 64, 2, 67, 3, 17, 0, 0, 0, 0, 
+    9, 0, 1, 0, 0, 0, 0, 240, 255, 255, 
+    255, 30, 2, 1, 41, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 
+    0, 0, 0, 60, 103, 101, 110, 101, 120, 112, 
+    114, 62, 1, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 108, 101, 
+    110, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 46, 48, 3, 0, 0, 
+    0, 0, 0, 0, 0, 115, 101, 112, 33, 0, 
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 
+    0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    95, 118, 97, 108, 105, 100, 97, 116, 101, 95, 
+    116, 105, 109, 101, 115, 116, 97, 109, 112, 95, 
+    112, 121, 99, 46, 53, 57, 50, 58, 48, 0, 
+    84, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
+    0, 33, 1, 0, 32, 2, 0, 30, 0, 1, 
+    30, 3, 2, 30, 4, 3, 62, 5, 3, 0, 
+    3, 4, 1, 6, 2, 5, 74, 6, 10, 1, 
+    1, 0, 75, 1, 0, 32, 2, 1, 30, 1, 
+    4, 0, 3, 2, 1, 9, 6, 4, 0, 3, 
+    1, 79, 1, 4, 22, 4, 40, 0, 0, 0, 
+    32, 0, 2, 30, 1, 3, 6, 2, 0, 1, 
+    7, 79, 3, 2, 19, 2, 15, 0, 0, 0, 
+    33, 1, 0, 32, 3, 0, 30, 0, 2, 30, 
+    4, 5, 30, 5, 3, 62, 6, 3, 0, 4, 
+    5, 1, 7, 3, 6, 74, 7, 10, 1, 1, 
+    0, 75, 1, 0, 32, 3, 2, 30, 1, 4, 
+    0, 4, 3, 1, 9, 6, 2, 0, 4, 1, 
+    17, 0, 0, 0, 0, 79, 0, 2, 19, 2, 
+    43, 0, 0, 0, 33, 1, 2, 30, 0, 6, 
+    32, 2, 3, 73, 3, 2, 1, 74, 0, 74, 
+    3, 72, 4, 2, 75, 1, 251, 75, 1, 97, 
+    74, 4, 4, 2, 1, 75, 1, 18, 30, 0, 
+    3, 32, 3, 4, 2, 4, 0, 65, 4, 3, 
+    11, 1, 2, 4, 1, 1, 40, 1, 0, 30, 
+    1, 6, 32, 0, 3, 73, 2, 0, 1, 74, 
+    1, 74, 2, 72, 3, 2, 75, 1, 129, 75, 
+    1, 85, 45, 5, 3, 33, 1, 1, 34, 2, 
+    1, 3, 1, 32, 30, 3, 7, 32, 1, 5, 
+    38, 2, 32, 2, 0, 0, 0, 0, 0, 0, 
+    0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 
+    4, 2, 32, 0, 5, 74, 0, 4, 1, 1, 
+    75, 1, 0, 30, 2, 3, 32, 3, 4, 2, 
+    2, 0, 65, 2, 3, 11, 4, 1, 2, 1, 
+    1, 40, 1, 0, 30, 1, 3, 41, 1, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 2, 
+    7, 2, 0, 0, 0, 0, 0, 0, 86, 97, 
+    108, 105, 100, 97, 116, 101, 32, 97, 32, 112, 
+    121, 99, 32, 97, 103, 97, 105, 110, 115, 116, 
+    32, 116, 104, 101, 32, 115, 111, 117, 114, 99, 
+    101, 32, 108, 97, 115, 116, 45, 109, 111, 100, 
+    105, 102, 105, 101, 100, 32, 116, 105, 109, 101, 
+    46, 10, 10, 32, 32, 32, 32, 42, 100, 97, 
+    116, 97, 42, 32, 105, 115, 32, 116, 104, 101, 
+    32, 99, 111, 110, 116, 101, 110, 116, 115, 32, 
+    111, 102, 32, 116, 104, 101, 32, 112, 121, 99, 
+    32, 102, 105, 108, 101, 46, 32, 40, 79, 110, 
+    108, 121, 32, 116, 104, 101, 32, 102, 105, 114, 
+    115, 116, 32, 49, 54, 32, 98, 121, 116, 101, 
+    115, 32, 97, 114, 101, 10, 32, 32, 32, 32, 
+    114, 101, 113, 117, 105, 114, 101, 100, 46, 41, 
+    10, 10, 32, 32, 32, 32, 42, 115, 111, 117, 
+    114, 99, 101, 95, 109, 116, 105, 109, 101, 42, 
+    32, 105, 115, 32, 116, 104, 101, 32, 108, 97, 
+    115, 116, 32, 109, 111, 100, 105, 102, 105, 101, 
+    100, 32, 116, 105, 109, 101, 115, 116, 97, 109, 
+    112, 32, 111, 102, 32, 116, 104, 101, 32, 115, 
+    111, 117, 114, 99, 101, 32, 102, 105, 108, 101, 
+    46, 10, 10, 32, 32, 32, 32, 42, 115, 111, 
+    117, 114, 99, 101, 95, 115, 105, 122, 101, 42, 
+    32, 105, 115, 32, 78, 111, 110, 101, 32, 111, 
+    114, 32, 116, 104, 101, 32, 115, 105, 122, 101, 
+    32, 111, 102, 32, 116, 104, 101, 32, 115, 111, 
+    117, 114, 99, 101, 32, 102, 105, 108, 101, 32, 
+    105, 110, 32, 98, 121, 116, 101, 115, 46, 10, 
+    10, 32, 32, 32, 32, 42, 110, 97, 109, 101, 
+    42, 32, 105, 115, 32, 116, 104, 101, 32, 110, 
+    97, 109, 101, 32, 111, 102, 32, 116, 104, 101, 
+    32, 109, 111, 100, 117, 108, 101, 32, 98, 101, 
+    105, 110, 103, 32, 105, 109, 112, 111, 114, 116, 
+    101, 100, 46, 32, 73, 116, 32, 105, 115, 32, 
+    117, 115, 101, 100, 32, 102, 111, 114, 32, 108, 
+    111, 103, 103, 105, 110, 103, 46, 10, 10, 32, 
+    32, 32, 32, 42, 101, 120, 99, 95, 100, 101, 
+    116, 97, 105, 108, 115, 42, 32, 105, 115, 32, 
+    97, 32, 100, 105, 99, 116, 105, 111, 110, 97, 
+    114, 121, 32, 112, 97, 115, 115, 101, 100, 32, 
+    116, 111, 32, 73, 109, 112, 111, 114, 116, 69, 
+    114, 114, 111, 114, 32, 105, 102, 32, 105, 116, 
+    32, 114, 97, 105, 115, 101, 100, 32, 102, 111, 
+    114, 10, 32, 32, 32, 32, 105, 109, 112, 114, 
+    111, 118, 101, 100, 32, 100, 101, 98, 117, 103, 
+    103, 105, 110, 103, 46, 10, 10, 32, 32, 32, 
+    32, 65, 110, 32, 73, 109, 112, 111, 114, 116, 
+    69, 114, 114, 111, 114, 32, 105, 115, 32, 114, 
+    97, 105, 115, 101, 100, 32, 105, 102, 32, 116, 
+    104, 101, 32, 98, 121, 116, 101, 99, 111, 100, 
+    101, 32, 105, 115, 32, 115, 116, 97, 108, 101, 
+    46, 10, 10, 32, 32, 32, 32, 0, 8, 0, 
+    0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 255, 255, 255, 
+    255, 0, 0, 0, 0, 0, 16, 0, 0, 0, 
+    0, 0, 0, 0, 2, 22, 0, 0, 0, 0, 
+    0, 0, 0, 98, 121, 116, 101, 99, 111, 100, 
+    101, 32, 105, 115, 32, 115, 116, 97, 108, 101, 
+    32, 102, 111, 114, 32, 2, 2, 0, 0, 0, 
+    0, 0, 0, 0, 123, 125, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 9, 
-    0, 0, 0, 0, 0, 0, 0, 60, 103, 101, 
-    110, 101, 120, 112, 114, 62, 1, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 108, 101, 110, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 46, 
-    48, 3, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 112, 32, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 16, 0, 
-    0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 
+    0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 
+    0, 0, 0, 95, 118, 97, 108, 105, 100, 97, 
+    116, 101, 95, 116, 105, 109, 101, 115, 116, 97, 
+    109, 112, 95, 112, 121, 99, 4, 0, 0, 0, 
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 
+    0, 0, 95, 117, 110, 112, 97, 99, 107, 95, 
+    117, 105, 110, 116, 51, 50, 10, 0, 0, 0, 
     0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 95, 118, 97, 108, 105, 100, 
-    97, 116, 101, 95, 116, 105, 109, 101, 115, 116, 
-    97, 109, 112, 95, 112, 121, 99, 46, 53, 57, 
-    50, 58, 48, 0, 88, 0, 0, 0, 0, 0, 
-    0, 0, 30, 0, 0, 33, 1, 0, 32, 2, 
-    0, 30, 0, 1, 30, 3, 2, 30, 4, 3, 
-    62, 5, 3, 0, 3, 4, 1, 6, 2, 5, 
-    74, 6, 10, 1, 1, 0, 75, 1, 0, 32, 
-    2, 1, 30, 1, 4, 0, 3, 2, 1, 9, 
-    6, 4, 0, 3, 1, 79, 1, 4, 22, 4, 
-    40, 0, 0, 0, 32, 0, 2, 30, 1, 3, 
-    6, 2, 0, 1, 7, 79, 3, 2, 19, 2, 
-    15, 0, 0, 0, 33, 1, 0, 32, 3, 0, 
-    30, 0, 2, 30, 4, 5, 30, 5, 3, 62, 
-    6, 3, 0, 4, 5, 1, 7, 3, 6, 74, 
-    7, 10, 1, 1, 0, 75, 1, 0, 32, 3, 
-    2, 30, 1, 4, 0, 4, 3, 1, 9, 6, 
-    2, 0, 4, 1, 17, 0, 0, 0, 0, 79, 
-    0, 2, 19, 2, 47, 0, 0, 0, 33, 1, 
-    2, 30, 0, 6, 32, 2, 3, 73, 3, 2, 
-    1, 74, 0, 74, 3, 72, 4, 2, 75, 1, 
-    251, 75, 1, 97, 74, 4, 4, 2, 1, 75, 
-    1, 18, 30, 0, 3, 32, 3, 4, 2, 4, 
-    0, 65, 4, 3, 11, 1, 2, 4, 1, 1, 
-    40, 1, 0, 30, 1, 6, 32, 0, 3, 73, 
-    2, 0, 1, 74, 1, 74, 2, 72, 3, 2, 
-    75, 1, 129, 75, 1, 85, 45, 5, 3, 33, 
-    1, 1, 34, 2, 1, 3, 30, 3, 7, 32, 
-    1, 5, 74, 3, 74, 1, 10, 2, 2, 0, 
-    75, 1, 173, 75, 1, 29, 33, 4, 2, 32, 
-    0, 5, 74, 0, 4, 1, 1, 75, 1, 0, 
-    30, 2, 3, 32, 3, 4, 2, 2, 0, 65, 
-    2, 3, 11, 4, 1, 2, 1, 1, 40, 1, 
-    0, 30, 1, 3, 41, 1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    116, 114, 97, 112, 11, 0, 0, 0, 0, 0, 
+    0, 0, 73, 109, 112, 111, 114, 116, 69, 114, 
+    114, 111, 114, 16, 0, 0, 0, 0, 0, 0, 
+    0, 95, 118, 101, 114, 98, 111, 115, 101, 95, 
+    109, 101, 115, 115, 97, 103, 101, 0, 0, 0, 
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 100, 97, 116, 97, 12, 0, 0, 0, 0, 
+    0, 0, 0, 115, 111, 117, 114, 99, 101, 95, 
+    109, 116, 105, 109, 101, 11, 0, 0, 0, 0, 
+    0, 0, 0, 115, 111, 117, 114, 99, 101, 95, 
+    115, 105, 122, 101, 4, 0, 0, 0, 0, 0, 
+    0, 0, 110, 97, 109, 101, 11, 0, 0, 0, 
+    0, 0, 0, 0, 101, 120, 99, 95, 100, 101, 
+    116, 97, 105, 108, 115, 7, 0, 0, 0, 0, 
+    0, 0, 0, 109, 101, 115, 115, 97, 103, 101, 
+    33, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
+    0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 
+    0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 115, 111, 117, 114, 99, 101, 95, 102, 
+    114, 111, 109, 95, 99, 97, 99, 104, 101, 46, 
+    52, 51, 49, 58, 48, 0, 215, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 33, 1, 0, 
+    27, 0, 1, 19, 27, 2, 0, 20, 30, 1, 
+    1, 6, 0, 2, 1, 6, 79, 3, 0, 22, 
+    0, 179, 0, 0, 0, 33, 1, 2, 34, 2, 
+    1, 12, 1, 32, 32, 3, 0, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 45, 0, 0, 33, 2, 
+    3, 32, 1, 0, 38, 2, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    8, 0, 0, 0, 0, 0, 0, 0, 2, 7, 
-    2, 0, 0, 0, 0, 0, 0, 86, 97, 108, 
-    105, 100, 97, 116, 101, 32, 97, 32, 112, 121, 
-    99, 32, 97, 103, 97, 105, 110, 115, 116, 32, 
-    116, 104, 101, 32, 115, 111, 117, 114, 99, 101, 
-    32, 108, 97, 115, 116, 45, 109, 111, 100, 105, 
-    102, 105, 101, 100, 32, 116, 105, 109, 101, 46, 
-    10, 10, 32, 32, 32, 32, 42, 100, 97, 116, 
-    97, 42, 32, 105, 115, 32, 116, 104, 101, 32, 
-    99, 111, 110, 116, 101, 110, 116, 115, 32, 111, 
-    102, 32, 116, 104, 101, 32, 112, 121, 99, 32, 
-    102, 105, 108, 101, 46, 32, 40, 79, 110, 108, 
-    121, 32, 116, 104, 101, 32, 102, 105, 114, 115, 
-    116, 32, 49, 54, 32, 98, 121, 116, 101, 115, 
-    32, 97, 114, 101, 10, 32, 32, 32, 32, 114, 
-    101, 113, 117, 105, 114, 101, 100, 46, 41, 10, 
-    10, 32, 32, 32, 32, 42, 115, 111, 117, 114, 
-    99, 101, 95, 109, 116, 105, 109, 101, 42, 32, 
-    105, 115, 32, 116, 104, 101, 32, 108, 97, 115, 
-    116, 32, 109, 111, 100, 105, 102, 105, 101, 100, 
-    32, 116, 105, 109, 101, 115, 116, 97, 109, 112, 
-    32, 111, 102, 32, 116, 104, 101, 32, 115, 111, 
-    117, 114, 99, 101, 32, 102, 105, 108, 101, 46, 
-    10, 10, 32, 32, 32, 32, 42, 115, 111, 117, 
-    114, 99, 101, 95, 115, 105, 122, 101, 42, 32, 
-    105, 115, 32, 78, 111, 110, 101, 32, 111, 114, 
-    32, 116, 104, 101, 32, 115, 105, 122, 101, 32, 
-    111, 102, 32, 116, 104, 101, 32, 115, 111, 117, 
-    114, 99, 101, 32, 102, 105, 108, 101, 32, 105, 
-    110, 32, 98, 121, 116, 101, 115, 46, 10, 10, 
-    32, 32, 32, 32, 42, 110, 97, 109, 101, 42, 
-    32, 105, 115, 32, 116, 104, 101, 32, 110, 97, 
-    109, 101, 32, 111, 102, 32, 116, 104, 101, 32, 
-    109, 111, 100, 117, 108, 101, 32, 98, 101, 105, 
-    110, 103, 32, 105, 109, 112, 111, 114, 116, 101, 
-    100, 46, 32, 73, 116, 32, 105, 115, 32, 117, 
-    115, 101, 100, 32, 102, 111, 114, 32, 108, 111, 
-    103, 103, 105, 110, 103, 46, 10, 10, 32, 32, 
-    32, 32, 42, 101, 120, 99, 95, 100, 101, 116, 
-    97, 105, 108, 115, 42, 32, 105, 115, 32, 97, 
-    32, 100, 105, 99, 116, 105, 111, 110, 97, 114, 
-    121, 32, 112, 97, 115, 115, 101, 100, 32, 116, 
-    111, 32, 73, 109, 112, 111, 114, 116, 69, 114, 
-    114, 111, 114, 32, 105, 102, 32, 105, 116, 32, 
-    114, 97, 105, 115, 101, 100, 32, 102, 111, 114, 
-    10, 32, 32, 32, 32, 105, 109, 112, 114, 111, 
-    118, 101, 100, 32, 100, 101, 98, 117, 103, 103, 
-    105, 110, 103, 46, 10, 10, 32, 32, 32, 32, 
-    65, 110, 32, 73, 109, 112, 111, 114, 116, 69, 
-    114, 114, 111, 114, 32, 105, 115, 32, 114, 97, 
-    105, 115, 101, 100, 32, 105, 102, 32, 116, 104, 
-    101, 32, 98, 121, 116, 101, 99, 111, 100, 101, 
-    32, 105, 115, 32, 115, 116, 97, 108, 101, 46, 
-    10, 10, 32, 32, 32, 32, 0, 8, 0, 0, 
-    0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 
-    0, 0, 0, 0, 5, 0, 255, 255, 255, 255, 
-    0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 
-    0, 0, 0, 2, 22, 0, 0, 0, 0, 0, 
-    0, 0, 98, 121, 116, 101, 99, 111, 100, 101, 
-    32, 105, 115, 32, 115, 116, 97, 108, 101, 32, 
-    102, 111, 114, 32, 2, 2, 0, 0, 0, 0, 
-    0, 0, 0, 123, 125, 0, 0, 0, 0, 0, 
+    0, 0, 50, 2, 0, 0, 0, 0, 0, 0, 
+    0, 3, 4, 0, 45, 1, 3, 45, 2, 4, 
+    30, 1, 2, 45, 3, 1, 33, 2, 0, 27, 
+    0, 2, 21, 30, 1, 1, 6, 2, 0, 1, 
+    7, 79, 3, 2, 19, 2, 29, 0, 0, 0, 
+    33, 0, 0, 27, 1, 0, 21, 34, 2, 1, 
+    13, 1, 32, 33, 3, 4, 38, 2, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 45, 4, 0, 32, 2, 1, 
+    34, 1, 2, 14, 1, 32, 32, 3, 4, 33, 
+    2, 5, 0, 4, 3, 2, 0, 38, 1, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 79, 2, 0, 19, 0, 
+    14, 0, 0, 0, 32, 1, 1, 33, 2, 6, 
+    32, 3, 4, 74, 3, 10, 2, 1, 0, 75, 
+    1, 0, 30, 4, 1, 30, 2, 1, 62, 3, 
+    3, 0, 4, 2, 1, 5, 1, 3, 45, 1, 
+    5, 30, 1, 3, 45, 3, 1, 17, 0, 0, 
+    0, 0, 17, 0, 0, 0, 0, 32, 0, 3, 
+    49, 1, 0, 3, 79, 2, 1, 19, 1, 14, 
+    0, 0, 0, 33, 2, 3, 32, 1, 1, 74, 
+    1, 10, 2, 1, 0, 75, 1, 0, 50, 2, 
+    0, 0, 0, 0, 0, 0, 0, 3, 4, 0, 
+    45, 1, 3, 45, 5, 4, 32, 1, 5, 33, 
+    0, 7, 6, 2, 1, 0, 1, 79, 3, 2, 
+    22, 2, 97, 0, 0, 0, 17, 0, 0, 0, 
+    0, 32, 0, 2, 34, 1, 0, 15, 1, 32, 
+    30, 2, 4, 38, 1, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 
-    0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 
-    0, 0, 95, 118, 97, 108, 105, 100, 97, 116, 
-    101, 95, 116, 105, 109, 101, 115, 116, 97, 109, 
-    112, 95, 112, 121, 99, 4, 0, 0, 0, 0, 
-    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 
-    0, 95, 117, 110, 112, 97, 99, 107, 95, 117, 
-    105, 110, 116, 51, 50, 10, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 11, 0, 0, 0, 0, 0, 0, 
-    0, 73, 109, 112, 111, 114, 116, 69, 114, 114, 
-    111, 114, 16, 0, 0, 0, 0, 0, 0, 0, 
-    95, 118, 101, 114, 98, 111, 115, 101, 95, 109, 
-    101, 115, 115, 97, 103, 101, 0, 0, 0, 0, 
-    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    100, 97, 116, 97, 12, 0, 0, 0, 0, 0, 
-    0, 0, 115, 111, 117, 114, 99, 101, 95, 109, 
-    116, 105, 109, 101, 11, 0, 0, 0, 0, 0, 
-    0, 0, 115, 111, 117, 114, 99, 101, 95, 115, 
-    105, 122, 101, 4, 0, 0, 0, 0, 0, 0, 
-    0, 110, 97, 109, 101, 11, 0, 0, 0, 0, 
-    0, 0, 0, 101, 120, 99, 95, 100, 101, 116, 
-    97, 105, 108, 115, 7, 0, 0, 0, 0, 0, 
-    0, 0, 109, 101, 115, 115, 97, 103, 101, 32, 
-    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 
-    0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 115, 111, 117, 114, 99, 101, 95, 102, 114, 
-    111, 109, 95, 99, 97, 99, 104, 101, 46, 52, 
-    51, 49, 58, 48, 0, 233, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 33, 1, 0, 27, 
-    0, 1, 19, 27, 2, 0, 20, 30, 1, 1, 
-    6, 0, 2, 1, 6, 79, 3, 0, 22, 0, 
-    195, 0, 0, 0, 33, 1, 2, 34, 2, 1, 
-    12, 32, 3, 0, 74, 3, 10, 2, 1, 0, 
-    75, 1, 0, 45, 0, 0, 33, 2, 3, 32, 
-    1, 0, 74, 1, 10, 2, 1, 0, 75, 1, 
-    0, 50, 2, 0, 0, 0, 0, 0, 0, 0, 
-    3, 4, 0, 45, 1, 3, 45, 2, 4, 30, 
-    1, 2, 45, 3, 1, 33, 2, 0, 27, 0, 
-    2, 21, 30, 1, 1, 6, 2, 0, 1, 7, 
-    79, 3, 2, 19, 2, 33, 0, 0, 0, 33, 
-    0, 0, 27, 1, 0, 21, 34, 2, 1, 13, 
-    33, 3, 4, 74, 3, 10, 2, 1, 0, 75, 
-    1, 0, 45, 4, 0, 32, 2, 1, 34, 1, 
-    2, 14, 32, 3, 4, 33, 2, 5, 0, 4, 
-    3, 2, 0, 74, 4, 10, 1, 1, 0, 75, 
-    1, 0, 79, 2, 0, 19, 0, 14, 0, 0, 
-    0, 32, 1, 1, 33, 2, 6, 32, 3, 4, 
-    74, 3, 10, 2, 1, 0, 75, 1, 0, 30, 
+    0, 45, 6, 0, 32, 1, 6, 30, 0, 5, 
+    30, 2, 6, 74, 0, 74, 2, 60, 3, 2, 
+    75, 1, 173, 75, 1, 133, 6, 4, 1, 3, 
+    9, 79, 0, 4, 22, 4, 67, 0, 0, 0, 
+    32, 0, 6, 30, 1, 6, 6, 2, 0, 1, 
+    0, 79, 3, 2, 19, 2, 99, 0, 0, 0, 
+    32, 0, 2, 34, 1, 0, 16, 1, 32, 30, 
+    2, 4, 30, 3, 5, 38, 1, 32, 2, 0, 
+    0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 30, 4, 5, 49, 1, 4, 
+    1, 1, 2, 0, 1, 45, 7, 2, 32, 0, 
+    7, 34, 1, 0, 14, 1, 32, 33, 2, 9, 
+    38, 1, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 49, 3, 
+    0, 3, 79, 1, 3, 22, 3, 33, 0, 0, 
+    0, 32, 1, 7, 33, 2, 6, 33, 3, 9, 
+    74, 3, 10, 2, 1, 0, 75, 1, 172, 30, 
     4, 1, 30, 2, 1, 62, 3, 3, 0, 4, 
-    2, 1, 5, 1, 3, 45, 1, 5, 30, 1, 
-    3, 45, 3, 1, 17, 0, 0, 0, 0, 17, 
-    0, 0, 0, 0, 32, 0, 3, 49, 1, 0, 
-    3, 79, 2, 1, 19, 1, 14, 0, 0, 0, 
-    33, 2, 3, 32, 1, 1, 74, 1, 10, 2, 
-    1, 0, 75, 1, 0, 50, 2, 0, 0, 0, 
-    0, 0, 0, 0, 3, 4, 0, 45, 1, 3, 
-    45, 5, 4, 32, 1, 5, 33, 0, 7, 6, 
-    2, 1, 0, 1, 79, 3, 2, 22, 2, 105, 
-    0, 0, 0, 17, 0, 0, 0, 0, 32, 0, 
-    2, 34, 1, 0, 15, 30, 2, 4, 74, 2, 
-    10, 1, 1, 0, 75, 1, 248, 45, 6, 0, 
-    32, 1, 6, 30, 0, 5, 30, 2, 6, 74, 
-    0, 74, 2, 60, 3, 2, 75, 1, 173, 75, 
-    1, 133, 6, 4, 1, 3, 9, 79, 0, 4, 
-    22, 4, 73, 0, 0, 0, 32, 0, 6, 30, 
-    1, 6, 6, 2, 0, 1, 0, 79, 3, 2, 
-    19, 2, 105, 0, 0, 0, 32, 0, 2, 34, 
-    1, 0, 16, 30, 2, 4, 30, 3, 5, 74, 
-    2, 74, 3, 10, 1, 2, 0, 75, 1, 173, 
-    75, 1, 194, 30, 4, 5, 49, 1, 4, 1, 
-    1, 2, 0, 1, 45, 7, 2, 32, 0, 7, 
-    34, 1, 0, 14, 33, 2, 9, 74, 2, 10, 
-    1, 1, 0, 75, 1, 173, 49, 3, 0, 3, 
-    79, 1, 3, 22, 3, 33, 0, 0, 0, 32, 
-    1, 7, 33, 2, 6, 33, 3, 9, 74, 3, 
-    10, 2, 1, 0, 75, 1, 172, 30, 4, 1, 
-    30, 2, 1, 62, 3, 3, 0, 4, 2, 1, 
-    5, 1, 3, 45, 8, 5, 32, 1, 8, 34, 
-    2, 1, 17, 10, 2, 0, 0, 49, 1, 0, 
-    3, 79, 2, 1, 19, 1, 65, 0, 0, 0, 
-    33, 2, 8, 30, 1, 7, 32, 0, 7, 73, 
-    3, 0, 1, 30, 4, 8, 74, 1, 74, 3, 
-    74, 4, 72, 5, 3, 75, 1, 173, 75, 1, 
-    0, 75, 1, 2, 74, 5, 10, 2, 1, 0, 
-    75, 1, 172, 40, 1, 0, 33, 1, 8, 30, 
-    2, 9, 33, 0, 9, 73, 3, 0, 1, 74, 
-    2, 74, 3, 72, 4, 2, 75, 1, 203, 75, 
-    1, 173, 74, 4, 10, 1, 1, 0, 75, 1, 
-    173, 40, 1, 0, 33, 1, 8, 30, 2, 10, 
-    32, 0, 2, 73, 3, 0, 1, 74, 2, 74, 
-    3, 72, 4, 2, 75, 1, 24, 75, 1, 173, 
-    74, 4, 10, 1, 1, 0, 75, 1, 173, 40, 
-    1, 0, 33, 1, 8, 33, 0, 7, 73, 2, 
-    0, 0, 30, 3, 11, 32, 0, 0, 73, 4, 
-    0, 1, 74, 2, 74, 3, 74, 4, 72, 5, 
-    3, 75, 1, 0, 75, 1, 234, 75, 1, 173, 
-    74, 5, 10, 1, 1, 0, 75, 1, 173, 40, 
-    1, 0, 33, 1, 1, 30, 2, 12, 74, 2, 
-    10, 1, 1, 0, 75, 1, 173, 40, 1, 0, 
-    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
-    32, 0, 2, 34, 1, 0, 18, 30, 2, 4, 
-    74, 2, 10, 1, 1, 0, 75, 1, 172, 30, 
-    3, 13, 1, 1, 0, 3, 45, 9, 1, 33, 
-    3, 10, 32, 1, 1, 32, 2, 9, 33, 0, 
-    11, 30, 4, 13, 1, 5, 0, 4, 0, 6, 
-    2, 5, 0, 74, 1, 74, 6, 10, 3, 2, 
-    0, 75, 1, 90, 75, 1, 173, 41, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    2, 1, 5, 1, 3, 45, 8, 5, 32, 1, 
+    8, 34, 2, 1, 17, 1, 32, 38, 2, 32, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 49, 1, 0, 3, 79, 2, 
+    1, 19, 1, 65, 0, 0, 0, 33, 2, 8, 
+    30, 1, 7, 32, 0, 7, 73, 3, 0, 1, 
+    30, 4, 8, 74, 1, 74, 3, 74, 4, 72, 
+    5, 3, 75, 1, 173, 75, 1, 0, 75, 1, 
+    2, 74, 5, 10, 2, 1, 0, 75, 1, 172, 
+    40, 1, 0, 33, 1, 8, 30, 2, 9, 33, 
+    0, 9, 73, 3, 0, 1, 74, 2, 74, 3, 
+    72, 4, 2, 75, 1, 203, 75, 1, 173, 74, 
+    4, 10, 1, 1, 0, 75, 1, 173, 40, 1, 
+    0, 33, 1, 8, 30, 2, 10, 32, 0, 2, 
+    73, 3, 0, 1, 74, 2, 74, 3, 72, 4, 
+    2, 75, 1, 24, 75, 1, 173, 74, 4, 10, 
+    1, 1, 0, 75, 1, 173, 40, 1, 0, 33, 
+    1, 8, 33, 0, 7, 73, 2, 0, 0, 30, 
+    3, 11, 32, 0, 0, 73, 4, 0, 1, 74, 
+    2, 74, 3, 74, 4, 72, 5, 3, 75, 1, 
+    0, 75, 1, 234, 75, 1, 173, 74, 5, 10, 
+    1, 1, 0, 75, 1, 173, 40, 1, 0, 33, 
+    1, 1, 30, 2, 12, 74, 2, 10, 1, 1, 
+    0, 75, 1, 173, 40, 1, 0, 17, 0, 0, 
+    0, 0, 17, 0, 0, 0, 0, 32, 0, 2, 
+    34, 1, 0, 18, 1, 32, 30, 2, 4, 38, 
+    1, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 30, 3, 13, 
+    1, 1, 0, 3, 45, 9, 1, 33, 3, 10, 
+    32, 1, 1, 32, 2, 9, 33, 0, 11, 30, 
+    4, 13, 1, 5, 0, 4, 0, 6, 2, 5, 
+    0, 74, 1, 74, 6, 10, 3, 2, 0, 75, 
+    1, 90, 75, 1, 173, 41, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 
-    0, 2, 110, 1, 0, 0, 0, 0, 0, 0, 
-    71, 105, 118, 101, 110, 32, 116, 104, 101, 32, 
-    112, 97, 116, 104, 32, 116, 111, 32, 97, 32, 
-    46, 112, 121, 99, 46, 32, 102, 105, 108, 101, 
-    44, 32, 114, 101, 116, 117, 114, 110, 32, 116, 
-    104, 101, 32, 112, 97, 116, 104, 32, 116, 111, 
-    32, 105, 116, 115, 32, 46, 112, 121, 32, 102, 
-    105, 108, 101, 46, 10, 10, 32, 32, 32, 32, 
-    84, 104, 101, 32, 46, 112, 121, 99, 32, 102, 
-    105, 108, 101, 32, 100, 111, 101, 115, 32, 110, 
-    111, 116, 32, 110, 101, 101, 100, 32, 116, 111, 
-    32, 101, 120, 105, 115, 116, 59, 32, 116, 104, 
-    105, 115, 32, 115, 105, 109, 112, 108, 121, 32, 
-    114, 101, 116, 117, 114, 110, 115, 32, 116, 104, 
-    101, 32, 112, 97, 116, 104, 32, 116, 111, 10, 
-    32, 32, 32, 32, 116, 104, 101, 32, 46, 112, 
-    121, 32, 102, 105, 108, 101, 32, 99, 97, 108, 
-    99, 117, 108, 97, 116, 101, 100, 32, 116, 111, 
-    32, 99, 111, 114, 114, 101, 115, 112, 111, 110, 
-    100, 32, 116, 111, 32, 116, 104, 101, 32, 46, 
-    112, 121, 99, 32, 102, 105, 108, 101, 46, 32, 
-    32, 73, 102, 32, 112, 97, 116, 104, 32, 100, 
-    111, 101, 115, 10, 32, 32, 32, 32, 110, 111, 
-    116, 32, 99, 111, 110, 102, 111, 114, 109, 32, 
-    116, 111, 32, 80, 69, 80, 32, 51, 49, 52, 
-    55, 47, 52, 56, 56, 32, 102, 111, 114, 109, 
-    97, 116, 44, 32, 86, 97, 108, 117, 101, 69, 
-    114, 114, 111, 114, 32, 119, 105, 108, 108, 32, 
-    98, 101, 32, 114, 97, 105, 115, 101, 100, 46, 
-    32, 73, 102, 10, 32, 32, 32, 32, 115, 121, 
-    115, 46, 105, 109, 112, 108, 101, 109, 101, 110, 
-    116, 97, 116, 105, 111, 110, 46, 99, 97, 99, 
-    104, 101, 95, 116, 97, 103, 32, 105, 115, 32, 
-    78, 111, 110, 101, 32, 116, 104, 101, 110, 32, 
-    78, 111, 116, 73, 109, 112, 108, 101, 109, 101, 
-    110, 116, 101, 100, 69, 114, 114, 111, 114, 32, 
-    105, 115, 32, 114, 97, 105, 115, 101, 100, 46, 
-    10, 10, 32, 32, 32, 32, 5, 6, 0, 6, 
-    1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 
-    46, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 2, 
-    19, 0, 0, 0, 0, 0, 0, 0, 111, 112, 
-    116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 
-    32, 108, 101, 118, 101, 108, 32, 2, 29, 0, 
-    0, 0, 0, 0, 0, 0, 32, 105, 115, 32, 
-    110, 111, 116, 32, 97, 110, 32, 97, 108, 112, 
-    104, 97, 110, 117, 109, 101, 114, 105, 99, 32, 
-    118, 97, 108, 117, 101, 2, 53, 0, 0, 0, 
-    0, 0, 0, 0, 111, 112, 116, 105, 109, 105, 
-    122, 97, 116, 105, 111, 110, 32, 112, 111, 114, 
-    116, 105, 111, 110, 32, 111, 102, 32, 102, 105, 
-    108, 101, 110, 97, 109, 101, 32, 100, 111, 101, 
-    115, 32, 110, 111, 116, 32, 115, 116, 97, 114, 
-    116, 32, 119, 105, 116, 104, 32, 2, 29, 0, 
-    0, 0, 0, 0, 0, 0, 101, 120, 112, 101, 
-    99, 116, 101, 100, 32, 111, 110, 108, 121, 32, 
-    50, 32, 111, 114, 32, 51, 32, 100, 111, 116, 
-    115, 32, 105, 110, 32, 2, 31, 0, 0, 0, 
-    0, 0, 0, 0, 32, 110, 111, 116, 32, 98, 
-    111, 116, 116, 111, 109, 45, 108, 101, 118, 101, 
-    108, 32, 100, 105, 114, 101, 99, 116, 111, 114, 
-    121, 32, 105, 110, 32, 2, 36, 0, 0, 0, 
-    0, 0, 0, 0, 115, 121, 115, 46, 105, 109, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 
+    0, 0, 0, 0, 0, 0, 0, 2, 110, 1, 
+    0, 0, 0, 0, 0, 0, 71, 105, 118, 101, 
+    110, 32, 116, 104, 101, 32, 112, 97, 116, 104, 
+    32, 116, 111, 32, 97, 32, 46, 112, 121, 99, 
+    46, 32, 102, 105, 108, 101, 44, 32, 114, 101, 
+    116, 117, 114, 110, 32, 116, 104, 101, 32, 112, 
+    97, 116, 104, 32, 116, 111, 32, 105, 116, 115, 
+    32, 46, 112, 121, 32, 102, 105, 108, 101, 46, 
+    10, 10, 32, 32, 32, 32, 84, 104, 101, 32, 
+    46, 112, 121, 99, 32, 102, 105, 108, 101, 32, 
+    100, 111, 101, 115, 32, 110, 111, 116, 32, 110, 
+    101, 101, 100, 32, 116, 111, 32, 101, 120, 105, 
+    115, 116, 59, 32, 116, 104, 105, 115, 32, 115, 
+    105, 109, 112, 108, 121, 32, 114, 101, 116, 117, 
+    114, 110, 115, 32, 116, 104, 101, 32, 112, 97, 
+    116, 104, 32, 116, 111, 10, 32, 32, 32, 32, 
+    116, 104, 101, 32, 46, 112, 121, 32, 102, 105, 
+    108, 101, 32, 99, 97, 108, 99, 117, 108, 97, 
+    116, 101, 100, 32, 116, 111, 32, 99, 111, 114, 
+    114, 101, 115, 112, 111, 110, 100, 32, 116, 111, 
+    32, 116, 104, 101, 32, 46, 112, 121, 99, 32, 
+    102, 105, 108, 101, 46, 32, 32, 73, 102, 32, 
+    112, 97, 116, 104, 32, 100, 111, 101, 115, 10, 
+    32, 32, 32, 32, 110, 111, 116, 32, 99, 111, 
+    110, 102, 111, 114, 109, 32, 116, 111, 32, 80, 
+    69, 80, 32, 51, 49, 52, 55, 47, 52, 56, 
+    56, 32, 102, 111, 114, 109, 97, 116, 44, 32, 
+    86, 97, 108, 117, 101, 69, 114, 114, 111, 114, 
+    32, 119, 105, 108, 108, 32, 98, 101, 32, 114, 
+    97, 105, 115, 101, 100, 46, 32, 73, 102, 10, 
+    32, 32, 32, 32, 115, 121, 115, 46, 105, 109, 
     112, 108, 101, 109, 101, 110, 116, 97, 116, 105, 
     111, 110, 46, 99, 97, 99, 104, 101, 95, 116, 
     97, 103, 32, 105, 115, 32, 78, 111, 110, 101, 
+    32, 116, 104, 101, 110, 32, 78, 111, 116, 73, 
+    109, 112, 108, 101, 109, 101, 110, 116, 101, 100, 
+    69, 114, 114, 111, 114, 32, 105, 115, 32, 114, 
+    97, 105, 115, 101, 100, 46, 10, 10, 32, 32, 
+    32, 32, 5, 6, 0, 6, 1, 2, 1, 0, 
+    0, 0, 0, 0, 0, 0, 46, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 2, 19, 0, 0, 0, 
+    0, 0, 0, 0, 111, 112, 116, 105, 109, 105, 
+    122, 97, 116, 105, 111, 110, 32, 108, 101, 118, 
+    101, 108, 32, 2, 29, 0, 0, 0, 0, 0, 
+    0, 0, 32, 105, 115, 32, 110, 111, 116, 32, 
+    97, 110, 32, 97, 108, 112, 104, 97, 110, 117, 
+    109, 101, 114, 105, 99, 32, 118, 97, 108, 117, 
+    101, 2, 53, 0, 0, 0, 0, 0, 0, 0, 
+    111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 
+    111, 110, 32, 112, 111, 114, 116, 105, 111, 110, 
+    32, 111, 102, 32, 102, 105, 108, 101, 110, 97, 
+    109, 101, 32, 100, 111, 101, 115, 32, 110, 111, 
+    116, 32, 115, 116, 97, 114, 116, 32, 119, 105, 
+    116, 104, 32, 2, 29, 0, 0, 0, 0, 0, 
+    0, 0, 101, 120, 112, 101, 99, 116, 101, 100, 
+    32, 111, 110, 108, 121, 32, 50, 32, 111, 114, 
+    32, 51, 32, 100, 111, 116, 115, 32, 105, 110, 
+    32, 2, 31, 0, 0, 0, 0, 0, 0, 0, 
+    32, 110, 111, 116, 32, 98, 111, 116, 116, 111, 
+    109, 45, 108, 101, 118, 101, 108, 32, 100, 105, 
+    114, 101, 99, 116, 111, 114, 121, 32, 105, 110, 
+    32, 2, 36, 0, 0, 0, 0, 0, 0, 0, 
+    115, 121, 115, 46, 105, 109, 112, 108, 101, 109, 
+    101, 110, 116, 97, 116, 105, 111, 110, 46, 99, 
+    97, 99, 104, 101, 95, 116, 97, 103, 32, 105, 
+    115, 32, 78, 111, 110, 101, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    41, 0, 0, 0, 0, 0, 0, 0, 17, 0, 
-    0, 0, 0, 0, 0, 0, 115, 111, 117, 114, 
-    99, 101, 95, 102, 114, 111, 109, 95, 99, 97, 
-    99, 104, 101, 22, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 115, 
-    121, 115, 19, 0, 0, 0, 0, 0, 0, 0, 
-    78, 111, 116, 73, 109, 112, 108, 101, 109, 101, 
-    110, 116, 101, 100, 69, 114, 114, 111, 114, 3, 
-    0, 0, 0, 0, 0, 0, 0, 95, 111, 115, 
-    11, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
-    97, 116, 104, 95, 115, 112, 108, 105, 116, 15, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
-    104, 95, 115, 101, 112, 97, 114, 97, 116, 111, 
-    114, 115, 8, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 95, 115, 101, 112, 3, 0, 
-    0, 0, 0, 0, 0, 0, 108, 101, 110, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 80, 89, 
-    67, 65, 67, 72, 69, 10, 0, 0, 0, 0, 
-    0, 0, 0, 86, 97, 108, 117, 101, 69, 114, 
-    114, 111, 114, 4, 0, 0, 0, 0, 0, 0, 
-    0, 95, 79, 80, 84, 10, 0, 0, 0, 0, 
-    0, 0, 0, 95, 112, 97, 116, 104, 95, 106, 
-    111, 105, 110, 15, 0, 0, 0, 0, 0, 0, 
-    0, 83, 79, 85, 82, 67, 69, 95, 83, 85, 
-    70, 70, 73, 88, 69, 83, 6, 0, 0, 0, 
-    0, 0, 0, 0, 102, 115, 112, 97, 116, 104, 
-    6, 0, 0, 0, 0, 0, 0, 0, 114, 115, 
-    116, 114, 105, 112, 10, 0, 0, 0, 0, 0, 
-    0, 0, 115, 116, 97, 114, 116, 115, 119, 105, 
-    116, 104, 5, 0, 0, 0, 0, 0, 0, 0, 
-    99, 111, 117, 110, 116, 6, 0, 0, 0, 0, 
-    0, 0, 0, 114, 115, 112, 108, 105, 116, 7, 
-    0, 0, 0, 0, 0, 0, 0, 105, 115, 97, 
-    108, 110, 117, 109, 9, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 114, 116, 105, 116, 105, 111, 
-    110, 14, 0, 0, 0, 0, 0, 0, 0, 105, 
-    109, 112, 108, 101, 109, 101, 110, 116, 97, 116, 
-    105, 111, 110, 9, 0, 0, 0, 0, 0, 0, 
-    0, 99, 97, 99, 104, 101, 95, 116, 97, 103, 
-    14, 0, 0, 0, 0, 0, 0, 0, 112, 121, 
-    99, 97, 99, 104, 101, 95, 112, 114, 101, 102, 
-    105, 120, 0, 0, 0, 0, 0, 0, 0, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
+    0, 0, 115, 111, 117, 114, 99, 101, 95, 102, 
+    114, 111, 109, 95, 99, 97, 99, 104, 101, 22, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 115, 121, 115, 19, 0, 
+    0, 0, 0, 0, 0, 0, 78, 111, 116, 73, 
+    109, 112, 108, 101, 109, 101, 110, 116, 101, 100, 
+    69, 114, 114, 111, 114, 3, 0, 0, 0, 0, 
+    0, 0, 0, 95, 111, 115, 11, 0, 0, 0, 
+    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
+    115, 112, 108, 105, 116, 15, 0, 0, 0, 0, 
+    0, 0, 0, 112, 97, 116, 104, 95, 115, 101, 
+    112, 97, 114, 97, 116, 111, 114, 115, 8, 0, 
     0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    4, 0, 0, 0, 0, 0, 0, 0, 104, 101, 
-    97, 100, 16, 0, 0, 0, 0, 0, 0, 0, 
-    112, 121, 99, 97, 99, 104, 101, 95, 102, 105, 
-    108, 101, 110, 97, 109, 101, 23, 0, 0, 0, 
-    0, 0, 0, 0, 102, 111, 117, 110, 100, 95, 
-    105, 110, 95, 112, 121, 99, 97, 99, 104, 101, 
-    95, 112, 114, 101, 102, 105, 120, 13, 0, 0, 
-    0, 0, 0, 0, 0, 115, 116, 114, 105, 112, 
-    112, 101, 100, 95, 112, 97, 116, 104, 7, 0, 
-    0, 0, 0, 0, 0, 0, 112, 121, 99, 97, 
-    99, 104, 101, 9, 0, 0, 0, 0, 0, 0, 
-    0, 100, 111, 116, 95, 99, 111, 117, 110, 116, 
-    12, 0, 0, 0, 0, 0, 0, 0, 111, 112, 
-    116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 
-    9, 0, 0, 0, 0, 0, 0, 0, 111, 112, 
-    116, 95, 108, 101, 118, 101, 108, 13, 0, 0, 
-    0, 0, 0, 0, 0, 98, 97, 115, 101, 95, 
-    102, 105, 108, 101, 110, 97, 109, 101, 32, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    95, 115, 101, 112, 3, 0, 0, 0, 0, 0, 
+    0, 0, 108, 101, 110, 8, 0, 0, 0, 0, 
+    0, 0, 0, 95, 80, 89, 67, 65, 67, 72, 
+    69, 10, 0, 0, 0, 0, 0, 0, 0, 86, 
+    97, 108, 117, 101, 69, 114, 114, 111, 114, 4, 
+    0, 0, 0, 0, 0, 0, 0, 95, 79, 80, 
+    84, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    112, 97, 116, 104, 95, 106, 111, 105, 110, 15, 
+    0, 0, 0, 0, 0, 0, 0, 83, 79, 85, 
+    82, 67, 69, 95, 83, 85, 70, 70, 73, 88, 
+    69, 83, 6, 0, 0, 0, 0, 0, 0, 0, 
+    102, 115, 112, 97, 116, 104, 6, 0, 0, 0, 
+    0, 0, 0, 0, 114, 115, 116, 114, 105, 112, 
+    10, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+    97, 114, 116, 115, 119, 105, 116, 104, 5, 0, 
+    0, 0, 0, 0, 0, 0, 99, 111, 117, 110, 
+    116, 6, 0, 0, 0, 0, 0, 0, 0, 114, 
+    115, 112, 108, 105, 116, 7, 0, 0, 0, 0, 
+    0, 0, 0, 105, 115, 97, 108, 110, 117, 109, 
+    9, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    114, 116, 105, 116, 105, 111, 110, 14, 0, 0, 
+    0, 0, 0, 0, 0, 105, 109, 112, 108, 101, 
+    109, 101, 110, 116, 97, 116, 105, 111, 110, 9, 
+    0, 0, 0, 0, 0, 0, 0, 99, 97, 99, 
+    104, 101, 95, 116, 97, 103, 14, 0, 0, 0, 
+    0, 0, 0, 0, 112, 121, 99, 97, 99, 104, 
+    101, 95, 112, 114, 101, 102, 105, 120, 0, 0, 
+    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
     0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    95, 112, 97, 116, 104, 95, 105, 115, 95, 109, 
-    111, 100, 101, 95, 116, 121, 112, 101, 46, 49, 
-    52, 52, 58, 48, 0, 25, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 42, 1, 0, 0, 
-    0, 17, 7, 0, 0, 0, 33, 0, 1, 21, 
-    0, 4, 0, 0, 0, 30, 1, 1, 5, 17, 
-    0, 0, 0, 0, 41, 1, 52, 33, 1, 0, 
-    32, 2, 0, 74, 2, 10, 1, 1, 0, 75, 
-    1, 0, 45, 2, 0, 54, 17, 0, 0, 0, 
+    0, 0, 112, 97, 116, 104, 4, 0, 0, 0, 
+    0, 0, 0, 0, 104, 101, 97, 100, 16, 0, 
+    0, 0, 0, 0, 0, 0, 112, 121, 99, 97, 
+    99, 104, 101, 95, 102, 105, 108, 101, 110, 97, 
+    109, 101, 23, 0, 0, 0, 0, 0, 0, 0, 
+    102, 111, 117, 110, 100, 95, 105, 110, 95, 112, 
+    121, 99, 97, 99, 104, 101, 95, 112, 114, 101, 
+    102, 105, 120, 13, 0, 0, 0, 0, 0, 0, 
+    0, 115, 116, 114, 105, 112, 112, 101, 100, 95, 
+    112, 97, 116, 104, 7, 0, 0, 0, 0, 0, 
+    0, 0, 112, 121, 99, 97, 99, 104, 101, 9, 
+    0, 0, 0, 0, 0, 0, 0, 100, 111, 116, 
+    95, 99, 111, 117, 110, 116, 12, 0, 0, 0, 
+    0, 0, 0, 0, 111, 112, 116, 105, 109, 105, 
+    122, 97, 116, 105, 111, 110, 9, 0, 0, 0, 
+    0, 0, 0, 0, 111, 112, 116, 95, 108, 101, 
+    118, 101, 108, 13, 0, 0, 0, 0, 0, 0, 
+    0, 98, 97, 115, 101, 95, 102, 105, 108, 101, 
+    110, 97, 109, 101, 32, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 44, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 95, 112, 97, 116, 
+    104, 95, 105, 115, 95, 109, 111, 100, 101, 95, 
+    116, 121, 112, 101, 46, 49, 52, 52, 58, 48, 
+    0, 23, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 17, 7, 0, 0, 0, 33, 0, 1, 
+    21, 0, 4, 0, 0, 0, 30, 1, 1, 5, 
+    17, 0, 0, 0, 0, 41, 1, 52, 33, 1, 
+    0, 32, 2, 0, 74, 2, 10, 1, 1, 0, 
+    75, 1, 0, 45, 2, 0, 17, 0, 0, 0, 
     0, 32, 0, 2, 27, 1, 0, 2, 30, 2, 
     2, 0, 0, 1, 2, 9, 32, 3, 1, 6, 
-    1, 0, 3, 0, 41, 1, 0, 0, 0, 0, 
+    1, 0, 3, 0, 41, 1, 2, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
+    0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 
     0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 2, 49, 
-    0, 0, 0, 0, 0, 0, 0, 84, 101, 115, 
-    116, 32, 119, 104, 101, 116, 104, 101, 114, 32, 
-    116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 
-    115, 32, 116, 104, 101, 32, 115, 112, 101, 99, 
-    105, 102, 105, 101, 100, 32, 109, 111, 100, 101, 
-    32, 116, 121, 112, 101, 46, 6, 0, 0, 0, 
-    240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 2, 49, 0, 0, 0, 0, 
+    0, 0, 0, 84, 101, 115, 116, 32, 119, 104, 
+    101, 116, 104, 101, 114, 32, 116, 104, 101, 32, 
+    112, 97, 116, 104, 32, 105, 115, 32, 116, 104, 
+    101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 
+    100, 32, 109, 111, 100, 101, 32, 116, 121, 112, 
+    101, 46, 6, 0, 0, 0, 240, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 
-    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    105, 115, 95, 109, 111, 100, 101, 95, 116, 121, 
-    112, 101, 3, 0, 0, 0, 0, 0, 0, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
-    97, 116, 104, 95, 115, 116, 97, 116, 7, 0, 
-    0, 0, 0, 0, 0, 0, 79, 83, 69, 114, 
-    114, 111, 114, 7, 0, 0, 0, 0, 0, 0, 
-    0, 115, 116, 95, 109, 111, 100, 101, 0, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
     0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 116, 104, 4, 0, 0, 0, 
-    0, 0, 0, 0, 109, 111, 100, 101, 9, 0, 
-    0, 0, 0, 0, 0, 0, 115, 116, 97, 116, 
-    95, 105, 110, 102, 111, 32, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 53, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 83, 111, 117, 
-    114, 99, 101, 76, 111, 97, 100, 101, 114, 46, 
-    115, 111, 117, 114, 99, 101, 95, 116, 111, 95, 
-    99, 111, 100, 101, 46, 57, 48, 55, 58, 52, 
-    0, 11, 0, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 33, 1, 0, 34, 2, 1, 2, 33, 
-    3, 1, 32, 1, 1, 32, 4, 2, 30, 5, 
-    1, 30, 6, 2, 32, 7, 3, 12, 2, 4, 
-    0, 0, 0, 0, 0, 0, 0, 3, 1, 4, 
-    5, 2, 0, 0, 0, 0, 0, 0, 0, 6, 
-    7, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
-    4, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 95, 105, 115, 95, 109, 
+    111, 100, 101, 95, 116, 121, 112, 101, 3, 0, 
+    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
+    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
+    115, 116, 97, 116, 7, 0, 0, 0, 0, 0, 
+    0, 0, 79, 83, 69, 114, 114, 111, 114, 7, 
+    0, 0, 0, 0, 0, 0, 0, 115, 116, 95, 
+    109, 111, 100, 101, 0, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    116, 104, 4, 0, 0, 0, 0, 0, 0, 0, 
+    109, 111, 100, 101, 9, 0, 0, 0, 0, 0, 
+    0, 0, 115, 116, 97, 116, 95, 105, 110, 102, 
+    111, 32, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 83, 111, 117, 114, 99, 101, 76, 
+    111, 97, 100, 101, 114, 46, 115, 111, 117, 114, 
+    99, 101, 95, 116, 111, 95, 99, 111, 100, 101, 
+    46, 57, 48, 55, 58, 52, 0, 11, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
+    0, 34, 2, 1, 2, 0, 0, 33, 3, 1, 
+    32, 1, 1, 32, 4, 2, 30, 5, 1, 30, 
+    6, 2, 32, 7, 3, 12, 2, 4, 0, 0, 
+    0, 0, 0, 0, 0, 3, 1, 4, 5, 2, 
+    0, 0, 0, 0, 0, 0, 0, 6, 7, 2, 
+    0, 0, 0, 0, 0, 0, 0, 3, 4, 41, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 2, 130, 0, 0, 0, 
-    0, 0, 0, 0, 82, 101, 116, 117, 114, 110, 
-    32, 116, 104, 101, 32, 99, 111, 100, 101, 32, 
-    111, 98, 106, 101, 99, 116, 32, 99, 111, 109, 
-    112, 105, 108, 101, 100, 32, 102, 114, 111, 109, 
-    32, 115, 111, 117, 114, 99, 101, 46, 10, 10, 
-    32, 32, 32, 32, 32, 32, 32, 32, 84, 104, 
-    101, 32, 39, 100, 97, 116, 97, 39, 32, 97, 
-    114, 103, 117, 109, 101, 110, 116, 32, 99, 97, 
-    110, 32, 98, 101, 32, 97, 110, 121, 32, 111, 
-    98, 106, 101, 99, 116, 32, 116, 121, 112, 101, 
-    32, 116, 104, 97, 116, 32, 99, 111, 109, 112, 
-    105, 108, 101, 40, 41, 32, 115, 117, 112, 112, 
-    111, 114, 116, 115, 46, 10, 32, 32, 32, 32, 
-    32, 32, 32, 32, 2, 4, 0, 0, 0, 0, 
-    0, 0, 0, 101, 120, 101, 99, 6, 1, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 2, 130, 0, 0, 0, 0, 0, 0, 0, 
+    82, 101, 116, 117, 114, 110, 32, 116, 104, 101, 
+    32, 99, 111, 100, 101, 32, 111, 98, 106, 101, 
+    99, 116, 32, 99, 111, 109, 112, 105, 108, 101, 
+    100, 32, 102, 114, 111, 109, 32, 115, 111, 117, 
+    114, 99, 101, 46, 10, 10, 32, 32, 32, 32, 
+    32, 32, 32, 32, 84, 104, 101, 32, 39, 100, 
+    97, 116, 97, 39, 32, 97, 114, 103, 117, 109, 
+    101, 110, 116, 32, 99, 97, 110, 32, 98, 101, 
+    32, 97, 110, 121, 32, 111, 98, 106, 101, 99, 
+    116, 32, 116, 121, 112, 101, 32, 116, 104, 97, 
+    116, 32, 99, 111, 109, 112, 105, 108, 101, 40, 
+    41, 32, 115, 117, 112, 112, 111, 114, 116, 115, 
+    46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+    2, 4, 0, 0, 0, 0, 0, 0, 0, 101, 
+    120, 101, 99, 6, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 14, 0, 
-    0, 0, 0, 0, 0, 0, 115, 111, 117, 114, 
-    99, 101, 95, 116, 111, 95, 99, 111, 100, 101, 
-    5, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 7, 0, 0, 0, 
-    0, 0, 0, 0, 99, 111, 109, 112, 105, 108, 
-    101, 25, 0, 0, 0, 0, 0, 0, 0, 95, 
-    99, 97, 108, 108, 95, 119, 105, 116, 104, 95, 
-    102, 114, 97, 109, 101, 115, 95, 114, 101, 109, 
-    111, 118, 101, 100, 12, 0, 0, 0, 0, 0, 
-    0, 0, 100, 111, 110, 116, 95, 105, 110, 104, 
-    101, 114, 105, 116, 8, 0, 0, 0, 0, 0, 
-    0, 0, 111, 112, 116, 105, 109, 105, 122, 101, 
-    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
     0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 101, 108, 102, 4, 0, 
-    0, 0, 0, 0, 0, 0, 100, 97, 116, 97, 
-    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 9, 0, 0, 0, 0, 0, 0, 0, 
-    95, 111, 112, 116, 105, 109, 105, 122, 101, 32, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 95, 95, 99, 108, 97, 115, 115, 95, 95, 
-    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
-    80, 97, 116, 104, 95, 95, 46, 49, 50, 48, 
-    52, 58, 48, 0, 43, 0, 0, 0, 0, 0, 
-    0, 0, 33, 0, 0, 47, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 109, 111, 100, 
-    117, 108, 101, 95, 95, 30, 2, 0, 47, 2, 
-    12, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    113, 117, 97, 108, 110, 97, 109, 101, 95, 95, 
-    30, 1, 1, 30, 0, 2, 47, 0, 6, 0, 
-    0, 0, 0, 0, 0, 0, 95, 101, 112, 111, 
-    99, 104, 30, 2, 3, 36, 0, 2, 0, 0, 
-    0, 0, 47, 0, 8, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 105, 110, 105, 116, 95, 95, 
-    30, 2, 4, 36, 0, 2, 0, 0, 0, 0, 
-    47, 0, 23, 0, 0, 0, 0, 0, 0, 0, 
-    95, 102, 105, 110, 100, 95, 112, 97, 114, 101, 
-    110, 116, 95, 112, 97, 116, 104, 95, 110, 97, 
-    109, 101, 115, 30, 2, 5, 36, 0, 2, 0, 
-    0, 0, 0, 47, 0, 16, 0, 0, 0, 0, 
-    0, 0, 0, 95, 103, 101, 116, 95, 112, 97, 
-    114, 101, 110, 116, 95, 112, 97, 116, 104, 30, 
-    2, 6, 36, 0, 2, 0, 0, 0, 0, 47, 
-    0, 12, 0, 0, 0, 0, 0, 0, 0, 95, 
-    114, 101, 99, 97, 108, 99, 117, 108, 97, 116, 
-    101, 30, 2, 7, 36, 0, 2, 0, 0, 0, 
-    0, 47, 0, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 105, 116, 101, 114, 95, 95, 30, 
-    2, 8, 36, 0, 2, 0, 0, 0, 0, 47, 
-    0, 11, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 103, 101, 116, 105, 116, 101, 109, 95, 95, 
-    30, 2, 9, 36, 0, 2, 0, 0, 0, 0, 
-    47, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 115, 101, 116, 105, 116, 101, 109, 95, 
-    95, 30, 2, 10, 36, 0, 2, 0, 0, 0, 
-    0, 47, 0, 7, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 108, 101, 110, 95, 95, 30, 2, 
-    11, 36, 0, 2, 0, 0, 0, 0, 47, 0, 
-    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    114, 101, 112, 114, 95, 95, 30, 2, 12, 36, 
-    0, 2, 0, 0, 0, 0, 47, 0, 12, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 99, 111, 
-    110, 116, 97, 105, 110, 115, 95, 95, 30, 2, 
-    13, 36, 0, 2, 0, 0, 0, 0, 47, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 97, 112, 
-    112, 101, 110, 100, 17, 0, 0, 0, 0, 29, 
-    0, 0, 41, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 
+    0, 0, 115, 111, 117, 114, 99, 101, 95, 116, 
+    111, 95, 99, 111, 100, 101, 5, 0, 0, 0, 
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 7, 0, 0, 0, 0, 0, 0, 0, 
+    99, 111, 109, 112, 105, 108, 101, 25, 0, 0, 
+    0, 0, 0, 0, 0, 95, 99, 97, 108, 108, 
+    95, 119, 105, 116, 104, 95, 102, 114, 97, 109, 
+    101, 115, 95, 114, 101, 109, 111, 118, 101, 100, 
+    12, 0, 0, 0, 0, 0, 0, 0, 100, 111, 
+    110, 116, 95, 105, 110, 104, 101, 114, 105, 116, 
+    8, 0, 0, 0, 0, 0, 0, 0, 111, 112, 
+    116, 105, 109, 105, 122, 101, 0, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 4, 0, 0, 0, 0, 0, 
+    0, 0, 100, 97, 116, 97, 4, 0, 0, 0, 
+    0, 0, 0, 0, 112, 97, 116, 104, 9, 0, 
+    0, 0, 0, 0, 0, 0, 95, 111, 112, 116, 
+    105, 109, 105, 122, 101, 32, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 99, 108, 97, 115, 
-    115, 95, 95, 14, 0, 0, 0, 0, 0, 0, 
-    0, 2, 14, 0, 0, 0, 0, 0, 0, 0, 
-    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
-    80, 97, 116, 104, 2, 38, 1, 0, 0, 0, 
-    0, 0, 0, 82, 101, 112, 114, 101, 115, 101, 
-    110, 116, 115, 32, 97, 32, 110, 97, 109, 101, 
-    115, 112, 97, 99, 101, 32, 112, 97, 99, 107, 
-    97, 103, 101, 39, 115, 32, 112, 97, 116, 104, 
-    46, 32, 32, 73, 116, 32, 117, 115, 101, 115, 
-    32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 
-    101, 32, 110, 97, 109, 101, 10, 32, 32, 32, 
-    32, 116, 111, 32, 102, 105, 110, 100, 32, 105, 
-    116, 115, 32, 112, 97, 114, 101, 110, 116, 32, 
-    109, 111, 100, 117, 108, 101, 44, 32, 97, 110, 
-    100, 32, 102, 114, 111, 109, 32, 116, 104, 101, 
-    114, 101, 32, 105, 116, 32, 108, 111, 111, 107, 
-    115, 32, 117, 112, 32, 116, 104, 101, 32, 112, 
-    97, 114, 101, 110, 116, 39, 115, 10, 32, 32, 
-    32, 32, 95, 95, 112, 97, 116, 104, 95, 95, 
-    46, 32, 32, 87, 104, 101, 110, 32, 116, 104, 
-    105, 115, 32, 99, 104, 97, 110, 103, 101, 115, 
-    44, 32, 116, 104, 101, 32, 109, 111, 100, 117, 
-    108, 101, 39, 115, 32, 111, 119, 110, 32, 112, 
-    97, 116, 104, 32, 105, 115, 32, 114, 101, 99, 
-    111, 109, 112, 117, 116, 101, 100, 44, 10, 32, 
-    32, 32, 32, 117, 115, 105, 110, 103, 32, 112, 
-    97, 116, 104, 95, 102, 105, 110, 100, 101, 114, 
-    46, 32, 32, 70, 111, 114, 32, 116, 111, 112, 
-    45, 108, 101, 118, 101, 108, 32, 109, 111, 100, 
-    117, 108, 101, 115, 44, 32, 116, 104, 101, 32, 
-    112, 97, 114, 101, 110, 116, 32, 109, 111, 100, 
-    117, 108, 101, 39, 115, 32, 112, 97, 116, 104, 
-    10, 32, 32, 32, 32, 105, 115, 32, 115, 121, 
-    115, 46, 112, 97, 116, 104, 46, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 50, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
-    115, 112, 97, 99, 101, 80, 97, 116, 104, 46, 
-    95, 95, 105, 110, 105, 116, 95, 95, 46, 49, 
-    50, 49, 53, 58, 52, 2, 65, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 95, 78, 97, 109, 101, 115, 
-    112, 97, 99, 101, 80, 97, 116, 104, 46, 95, 
-    102, 105, 110, 100, 95, 112, 97, 114, 101, 110, 
-    116, 95, 112, 97, 116, 104, 95, 110, 97, 109, 
-    101, 115, 46, 49, 50, 50, 50, 58, 52, 2, 
-    58, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 95, 78, 
-    97, 109, 101, 115, 112, 97, 99, 101, 80, 97, 
-    116, 104, 46, 95, 103, 101, 116, 95, 112, 97, 
-    114, 101, 110, 116, 95, 112, 97, 116, 104, 46, 
-    49, 50, 51, 50, 58, 52, 2, 54, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
-    115, 112, 97, 99, 101, 80, 97, 116, 104, 46, 
-    95, 114, 101, 99, 97, 108, 99, 117, 108, 97, 
-    116, 101, 46, 49, 50, 51, 54, 58, 52, 2, 
-    50, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 95, 78, 
-    97, 109, 101, 115, 112, 97, 99, 101, 80, 97, 
-    116, 104, 46, 95, 95, 105, 116, 101, 114, 95, 
-    95, 46, 49, 50, 53, 48, 58, 52, 2, 53, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
     111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 95, 78, 97, 
-    109, 101, 115, 112, 97, 99, 101, 80, 97, 116, 
-    104, 46, 95, 95, 103, 101, 116, 105, 116, 101, 
-    109, 95, 95, 46, 49, 50, 53, 51, 58, 52, 
-    2, 53, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
-    78, 97, 109, 101, 115, 112, 97, 99, 101, 80, 
-    97, 116, 104, 46, 95, 95, 115, 101, 116, 105, 
-    116, 101, 109, 95, 95, 46, 49, 50, 53, 54, 
-    58, 52, 2, 49, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 95, 78, 97, 109, 101, 115, 112, 97, 99, 
-    101, 80, 97, 116, 104, 46, 95, 95, 108, 101, 
-    110, 95, 95, 46, 49, 50, 53, 57, 58, 52, 
+    116, 101, 114, 110, 97, 108, 46, 95, 95, 99, 
+    108, 97, 115, 115, 95, 95, 95, 78, 97, 109, 
+    101, 115, 112, 97, 99, 101, 80, 97, 116, 104, 
+    95, 95, 46, 49, 50, 48, 52, 58, 48, 0, 
+    43, 0, 0, 0, 0, 0, 0, 0, 33, 0, 
+    0, 47, 0, 10, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 109, 111, 100, 117, 108, 101, 95, 
+    95, 30, 2, 0, 47, 2, 12, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 113, 117, 97, 108, 
+    110, 97, 109, 101, 95, 95, 30, 1, 1, 30, 
+    0, 2, 47, 0, 6, 0, 0, 0, 0, 0, 
+    0, 0, 95, 101, 112, 111, 99, 104, 30, 2, 
+    3, 36, 0, 2, 0, 0, 0, 0, 47, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    105, 110, 105, 116, 95, 95, 30, 2, 4, 36, 
+    0, 2, 0, 0, 0, 0, 47, 0, 23, 0, 
+    0, 0, 0, 0, 0, 0, 95, 102, 105, 110, 
+    100, 95, 112, 97, 114, 101, 110, 116, 95, 112, 
+    97, 116, 104, 95, 110, 97, 109, 101, 115, 30, 
+    2, 5, 36, 0, 2, 0, 0, 0, 0, 47, 
+    0, 16, 0, 0, 0, 0, 0, 0, 0, 95, 
+    103, 101, 116, 95, 112, 97, 114, 101, 110, 116, 
+    95, 112, 97, 116, 104, 30, 2, 6, 36, 0, 
+    2, 0, 0, 0, 0, 47, 0, 12, 0, 0, 
+    0, 0, 0, 0, 0, 95, 114, 101, 99, 97, 
+    108, 99, 117, 108, 97, 116, 101, 30, 2, 7, 
+    36, 0, 2, 0, 0, 0, 0, 47, 0, 8, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 
+    116, 101, 114, 95, 95, 30, 2, 8, 36, 0, 
+    2, 0, 0, 0, 0, 47, 0, 11, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 103, 101, 116, 
+    105, 116, 101, 109, 95, 95, 30, 2, 9, 36, 
+    0, 2, 0, 0, 0, 0, 47, 0, 11, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 115, 101, 
+    116, 105, 116, 101, 109, 95, 95, 30, 2, 10, 
+    36, 0, 2, 0, 0, 0, 0, 47, 0, 7, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 108, 
+    101, 110, 95, 95, 30, 2, 11, 36, 0, 2, 
+    0, 0, 0, 0, 47, 0, 8, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 114, 101, 112, 114, 
+    95, 95, 30, 2, 12, 36, 0, 2, 0, 0, 
+    0, 0, 47, 0, 12, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 99, 111, 110, 116, 97, 105, 
+    110, 115, 95, 95, 30, 2, 13, 36, 0, 2, 
+    0, 0, 0, 0, 47, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 97, 112, 112, 101, 110, 100, 
+    17, 0, 0, 0, 0, 29, 0, 0, 41, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    9, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    99, 108, 97, 115, 115, 95, 95, 14, 0, 0, 
+    0, 0, 0, 0, 0, 2, 14, 0, 0, 0, 
+    0, 0, 0, 0, 95, 78, 97, 109, 101, 115, 
+    112, 97, 99, 101, 80, 97, 116, 104, 2, 38, 
+    1, 0, 0, 0, 0, 0, 0, 82, 101, 112, 
+    114, 101, 115, 101, 110, 116, 115, 32, 97, 32, 
+    110, 97, 109, 101, 115, 112, 97, 99, 101, 32, 
+    112, 97, 99, 107, 97, 103, 101, 39, 115, 32, 
+    112, 97, 116, 104, 46, 32, 32, 73, 116, 32, 
+    117, 115, 101, 115, 32, 116, 104, 101, 32, 109, 
+    111, 100, 117, 108, 101, 32, 110, 97, 109, 101, 
+    10, 32, 32, 32, 32, 116, 111, 32, 102, 105, 
+    110, 100, 32, 105, 116, 115, 32, 112, 97, 114, 
+    101, 110, 116, 32, 109, 111, 100, 117, 108, 101, 
+    44, 32, 97, 110, 100, 32, 102, 114, 111, 109, 
+    32, 116, 104, 101, 114, 101, 32, 105, 116, 32, 
+    108, 111, 111, 107, 115, 32, 117, 112, 32, 116, 
+    104, 101, 32, 112, 97, 114, 101, 110, 116, 39, 
+    115, 10, 32, 32, 32, 32, 95, 95, 112, 97, 
+    116, 104, 95, 95, 46, 32, 32, 87, 104, 101, 
+    110, 32, 116, 104, 105, 115, 32, 99, 104, 97, 
+    110, 103, 101, 115, 44, 32, 116, 104, 101, 32, 
+    109, 111, 100, 117, 108, 101, 39, 115, 32, 111, 
+    119, 110, 32, 112, 97, 116, 104, 32, 105, 115, 
+    32, 114, 101, 99, 111, 109, 112, 117, 116, 101, 
+    100, 44, 10, 32, 32, 32, 32, 117, 115, 105, 
+    110, 103, 32, 112, 97, 116, 104, 95, 102, 105, 
+    110, 100, 101, 114, 46, 32, 32, 70, 111, 114, 
+    32, 116, 111, 112, 45, 108, 101, 118, 101, 108, 
+    32, 109, 111, 100, 117, 108, 101, 115, 44, 32, 
+    116, 104, 101, 32, 112, 97, 114, 101, 110, 116, 
+    32, 109, 111, 100, 117, 108, 101, 39, 115, 32, 
+    112, 97, 116, 104, 10, 32, 32, 32, 32, 105, 
+    115, 32, 115, 121, 115, 46, 112, 97, 116, 104, 
+    46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     2, 50, 0, 0, 0, 0, 0, 0, 0, 95, 
     98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
     101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
     78, 97, 109, 101, 115, 112, 97, 99, 101, 80, 
-    97, 116, 104, 46, 95, 95, 114, 101, 112, 114, 
-    95, 95, 46, 49, 50, 54, 50, 58, 52, 2, 
-    54, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    97, 116, 104, 46, 95, 95, 105, 110, 105, 116, 
+    95, 95, 46, 49, 50, 49, 53, 58, 52, 2, 
+    65, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
     111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
     120, 116, 101, 114, 110, 97, 108, 46, 95, 78, 
     97, 109, 101, 115, 112, 97, 99, 101, 80, 97, 
-    116, 104, 46, 95, 95, 99, 111, 110, 116, 97, 
-    105, 110, 115, 95, 95, 46, 49, 50, 54, 53, 
-    58, 52, 2, 48, 0, 0, 0, 0, 0, 0, 
+    116, 104, 46, 95, 102, 105, 110, 100, 95, 112, 
+    97, 114, 101, 110, 116, 95, 112, 97, 116, 104, 
+    95, 110, 97, 109, 101, 115, 46, 49, 50, 50, 
+    50, 58, 52, 2, 58, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 95, 78, 97, 109, 101, 115, 112, 97, 
+    99, 101, 80, 97, 116, 104, 46, 95, 103, 101, 
+    116, 95, 112, 97, 114, 101, 110, 116, 95, 112, 
+    97, 116, 104, 46, 49, 50, 51, 50, 58, 52, 
+    2, 54, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
+    78, 97, 109, 101, 115, 112, 97, 99, 101, 80, 
+    97, 116, 104, 46, 95, 114, 101, 99, 97, 108, 
+    99, 117, 108, 97, 116, 101, 46, 49, 50, 51, 
+    54, 58, 52, 2, 50, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 95, 78, 97, 109, 101, 115, 112, 97, 
+    99, 101, 80, 97, 116, 104, 46, 95, 95, 105, 
+    116, 101, 114, 95, 95, 46, 49, 50, 53, 48, 
+    58, 52, 2, 53, 0, 0, 0, 0, 0, 0, 
     0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
     112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
     46, 95, 78, 97, 109, 101, 115, 112, 97, 99, 
-    101, 80, 97, 116, 104, 46, 97, 112, 112, 101, 
-    110, 100, 46, 49, 50, 54, 56, 58, 52, 0, 
+    101, 80, 97, 116, 104, 46, 95, 95, 103, 101, 
+    116, 105, 116, 101, 109, 95, 95, 46, 49, 50, 
+    53, 51, 58, 52, 2, 53, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 95, 78, 97, 109, 101, 115, 112, 
+    97, 99, 101, 80, 97, 116, 104, 46, 95, 95, 
+    115, 101, 116, 105, 116, 101, 109, 95, 95, 46, 
+    49, 50, 53, 54, 58, 52, 2, 49, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
+    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
+    115, 112, 97, 99, 101, 80, 97, 116, 104, 46, 
+    95, 95, 108, 101, 110, 95, 95, 46, 49, 50, 
+    53, 57, 58, 52, 2, 50, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 95, 78, 97, 109, 101, 115, 112, 
+    97, 99, 101, 80, 97, 116, 104, 46, 95, 95, 
+    114, 101, 112, 114, 95, 95, 46, 49, 50, 54, 
+    50, 58, 52, 2, 54, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 95, 78, 97, 109, 101, 115, 112, 97, 
+    99, 101, 80, 97, 116, 104, 46, 95, 95, 99, 
+    111, 110, 116, 97, 105, 110, 115, 95, 95, 46, 
+    49, 50, 54, 53, 58, 52, 2, 48, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
+    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
+    115, 112, 97, 99, 101, 80, 97, 116, 104, 46, 
+    97, 112, 112, 101, 110, 100, 46, 49, 50, 54, 
+    56, 58, 52, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 99, 108, 
-    97, 115, 115, 95, 95, 95, 78, 97, 109, 101, 
-    115, 112, 97, 99, 101, 80, 97, 116, 104, 95, 
-    95, 1, 0, 0, 0, 0, 0, 0, 0, 8, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 110, 
-    97, 109, 101, 95, 95, 0, 0, 0, 0, 0, 
+    0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 99, 108, 97, 115, 115, 95, 95, 95, 
+    78, 97, 109, 101, 115, 112, 97, 99, 101, 80, 
+    97, 116, 104, 95, 95, 1, 0, 0, 0, 0, 
+    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 110, 97, 109, 101, 95, 95, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 32, 0, 0, 0, 0, 0, 0, 0, 5, 
-    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 
-    0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 43, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 95, 99, 111, 
+    109, 112, 105, 108, 101, 95, 98, 121, 116, 101, 
+    99, 111, 100, 101, 46, 54, 52, 52, 58, 48, 
+    0, 42, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 33, 1, 0, 34, 2, 1, 6, 1, 
+    32, 32, 3, 0, 38, 2, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 45, 4, 0, 33, 2, 1, 32, 1, 
+    4, 33, 3, 2, 38, 2, 32, 2, 0, 0, 
+    0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 79, 4, 0, 22, 0, 12, 0, 
+    0, 0, 33, 1, 5, 30, 0, 1, 34, 2, 
+    0, 9, 1, 32, 32, 3, 2, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 32, 4, 1, 32, 2, 
+    2, 74, 0, 12, 1, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 4, 2, 2, 0, 0, 0, 0, 0, 
+    0, 0, 10, 11, 39, 3, 0, 75, 0, 0, 
+    40, 1, 3, 33, 0, 3, 34, 1, 0, 7, 
+    1, 32, 30, 2, 2, 32, 3, 2, 38, 1, 
+    32, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 32, 4, 3, 
+    30, 0, 3, 6, 1, 4, 0, 7, 79, 2, 
+    1, 19, 1, 6, 0, 0, 0, 33, 0, 4, 
+    34, 1, 0, 8, 1, 32, 32, 2, 4, 32, 
+    3, 3, 38, 1, 32, 2, 0, 0, 0, 0, 
+    0, 0, 0, 2, 3, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 17, 0, 0, 0, 0, 32, 0, 4, 41, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 2, 35, 0, 0, 0, 0, 0, 0, 0, 
+    67, 111, 109, 112, 105, 108, 101, 32, 98, 121, 
+    116, 101, 99, 111, 100, 101, 32, 97, 115, 32, 
+    102, 111, 117, 110, 100, 32, 105, 110, 32, 97, 
+    32, 112, 121, 99, 46, 2, 23, 0, 0, 0, 
+    0, 0, 0, 0, 78, 111, 110, 45, 99, 111, 
+    100, 101, 32, 111, 98, 106, 101, 99, 116, 32, 
+    105, 110, 32, 123, 33, 114, 125, 2, 21, 0, 
+    0, 0, 0, 0, 0, 0, 99, 111, 100, 101, 
+    32, 111, 98, 106, 101, 99, 116, 32, 102, 114, 
+    111, 109, 32, 123, 33, 114, 125, 5, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 
+    0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 0, 0, 0, 95, 99, 111, 109, 112, 
+    105, 108, 101, 95, 98, 121, 116, 101, 99, 111, 
+    100, 101, 12, 0, 0, 0, 0, 0, 0, 0, 
+    7, 0, 0, 0, 0, 0, 0, 0, 109, 97, 
+    114, 115, 104, 97, 108, 10, 0, 0, 0, 0, 
+    0, 0, 0, 105, 115, 105, 110, 115, 116, 97, 
+    110, 99, 101, 10, 0, 0, 0, 0, 0, 0, 
+    0, 95, 99, 111, 100, 101, 95, 116, 121, 112, 
+    101, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 4, 
+    0, 0, 0, 0, 0, 0, 0, 95, 105, 109, 
+    112, 11, 0, 0, 0, 0, 0, 0, 0, 73, 
+    109, 112, 111, 114, 116, 69, 114, 114, 111, 114, 
+    5, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
+    97, 100, 115, 16, 0, 0, 0, 0, 0, 0, 
+    0, 95, 118, 101, 114, 98, 111, 115, 101, 95, 
+    109, 101, 115, 115, 97, 103, 101, 16, 0, 0, 
+    0, 0, 0, 0, 0, 95, 102, 105, 120, 95, 
+    99, 111, 95, 102, 105, 108, 101, 110, 97, 109, 
+    101, 6, 0, 0, 0, 0, 0, 0, 0, 102, 
+    111, 114, 109, 97, 116, 4, 0, 0, 0, 0, 
+    0, 0, 0, 110, 97, 109, 101, 4, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 0, 
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 100, 97, 116, 97, 4, 0, 0, 
+    0, 0, 0, 0, 0, 110, 97, 109, 101, 13, 
+    0, 0, 0, 0, 0, 0, 0, 98, 121, 116, 
+    101, 99, 111, 100, 101, 95, 112, 97, 116, 104, 
+    11, 0, 0, 0, 0, 0, 0, 0, 115, 111, 
+    117, 114, 99, 101, 95, 112, 97, 116, 104, 4, 
+    0, 0, 0, 0, 0, 0, 0, 99, 111, 100, 
+    101, 33, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
+    0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 
     0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
     114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 95, 99, 111, 109, 112, 105, 108, 
-    101, 95, 98, 121, 116, 101, 99, 111, 100, 101, 
-    46, 54, 52, 52, 58, 48, 0, 58, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
-    0, 34, 2, 1, 6, 32, 3, 0, 74, 3, 
-    10, 2, 1, 0, 75, 1, 0, 45, 4, 0, 
-    33, 2, 1, 32, 1, 4, 33, 3, 2, 74, 
-    1, 74, 3, 10, 2, 2, 0, 75, 1, 0, 
-    75, 1, 0, 79, 4, 0, 22, 0, 14, 0, 
-    0, 0, 33, 1, 5, 30, 0, 1, 34, 2, 
-    0, 9, 32, 3, 2, 74, 3, 10, 2, 1, 
-    0, 75, 1, 0, 32, 4, 1, 32, 2, 2, 
-    74, 0, 12, 1, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 4, 2, 2, 0, 0, 0, 0, 0, 0, 
-    0, 10, 11, 39, 3, 0, 75, 0, 0, 40, 
-    1, 3, 33, 0, 3, 34, 1, 0, 7, 30, 
-    2, 2, 32, 3, 2, 74, 2, 74, 3, 10, 
-    1, 2, 0, 75, 1, 0, 75, 1, 0, 32, 
-    4, 3, 30, 0, 3, 6, 1, 4, 0, 7, 
-    79, 2, 1, 19, 1, 10, 0, 0, 0, 33, 
-    0, 4, 34, 1, 0, 8, 32, 2, 4, 32, 
-    3, 3, 74, 2, 74, 3, 10, 1, 2, 0, 
-    75, 1, 172, 75, 1, 172, 17, 0, 0, 0, 
-    0, 32, 0, 4, 41, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    97, 108, 46, 95, 103, 101, 116, 95, 99, 97, 
+    99, 104, 101, 100, 46, 52, 57, 48, 58, 48, 
+    0, 46, 0, 0, 0, 0, 0, 0, 0, 32, 
+    0, 0, 34, 1, 0, 5, 1, 32, 33, 2, 
+    0, 33, 3, 1, 74, 3, 10, 2, 1, 0, 
+    75, 1, 0, 74, 0, 38, 1, 32, 1, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 2, 35, 
-    0, 0, 0, 0, 0, 0, 0, 67, 111, 109, 
-    112, 105, 108, 101, 32, 98, 121, 116, 101, 99, 
-    111, 100, 101, 32, 97, 115, 32, 102, 111, 117, 
-    110, 100, 32, 105, 110, 32, 97, 32, 112, 121, 
-    99, 46, 2, 23, 0, 0, 0, 0, 0, 0, 
-    0, 78, 111, 110, 45, 99, 111, 100, 101, 32, 
-    111, 98, 106, 101, 99, 116, 32, 105, 110, 32, 
-    123, 33, 114, 125, 2, 21, 0, 0, 0, 0, 
-    0, 0, 0, 99, 111, 100, 101, 32, 111, 98, 
-    106, 101, 99, 116, 32, 102, 114, 111, 109, 32, 
-    123, 33, 114, 125, 5, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 39, 4, 0, 75, 0, 0, 79, 
+    2, 4, 22, 4, 15, 0, 0, 0, 32, 0, 
+    0, 34, 1, 0, 5, 1, 32, 33, 2, 0, 
+    33, 3, 4, 74, 3, 10, 2, 1, 0, 75, 
+    1, 0, 74, 0, 38, 1, 32, 1, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 
-    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
-    0, 0, 95, 99, 111, 109, 112, 105, 108, 101, 
-    95, 98, 121, 116, 101, 99, 111, 100, 101, 12, 
-    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
-    0, 0, 0, 0, 0, 109, 97, 114, 115, 104, 
-    97, 108, 10, 0, 0, 0, 0, 0, 0, 0, 
-    105, 115, 105, 110, 115, 116, 97, 110, 99, 101, 
-    10, 0, 0, 0, 0, 0, 0, 0, 95, 99, 
-    111, 100, 101, 95, 116, 121, 112, 101, 10, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 4, 0, 0, 0, 
-    0, 0, 0, 0, 95, 105, 109, 112, 11, 0, 
-    0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 
-    114, 116, 69, 114, 114, 111, 114, 5, 0, 0, 
-    0, 0, 0, 0, 0, 108, 111, 97, 100, 115, 
-    16, 0, 0, 0, 0, 0, 0, 0, 95, 118, 
-    101, 114, 98, 111, 115, 101, 95, 109, 101, 115, 
-    115, 97, 103, 101, 16, 0, 0, 0, 0, 0, 
-    0, 0, 95, 102, 105, 120, 95, 99, 111, 95, 
-    102, 105, 108, 101, 110, 97, 109, 101, 6, 0, 
-    0, 0, 0, 0, 0, 0, 102, 111, 114, 109, 
-    97, 116, 4, 0, 0, 0, 0, 0, 0, 0, 
-    110, 97, 109, 101, 4, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 116, 104, 0, 0, 0, 0, 
-    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    100, 97, 116, 97, 4, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 13, 0, 0, 0, 
-    0, 0, 0, 0, 98, 121, 116, 101, 99, 111, 
-    100, 101, 95, 112, 97, 116, 104, 11, 0, 0, 
-    0, 0, 0, 0, 0, 115, 111, 117, 114, 99, 
-    101, 95, 112, 97, 116, 104, 4, 0, 0, 0, 
-    0, 0, 0, 0, 99, 111, 100, 101, 32, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
-    0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    95, 103, 101, 116, 95, 99, 97, 99, 104, 101, 
-    100, 46, 52, 57, 48, 58, 48, 0, 51, 0, 
-    0, 0, 0, 0, 0, 0, 32, 0, 0, 34, 
-    1, 0, 5, 33, 2, 0, 33, 3, 1, 74, 
-    3, 10, 2, 1, 0, 75, 1, 0, 74, 0, 
-    74, 0, 10, 1, 1, 0, 75, 1, 0, 39, 
-    4, 0, 75, 0, 0, 79, 2, 4, 22, 4, 
-    17, 0, 0, 0, 32, 0, 0, 34, 1, 0, 
-    5, 33, 2, 0, 33, 3, 4, 74, 3, 10, 
-    2, 1, 0, 75, 1, 0, 74, 0, 74, 0, 
-    10, 1, 1, 0, 75, 1, 0, 39, 4, 0, 
-    75, 0, 0, 79, 2, 4, 19, 4, 12, 0, 
-    0, 0, 32, 0, 0, 41, 0, 42, 1, 0, 
-    0, 0, 17, 10, 0, 0, 0, 33, 0, 3, 
+    0, 0, 39, 4, 0, 75, 0, 0, 79, 2, 
+    4, 19, 4, 11, 0, 0, 0, 32, 0, 0, 
+    41, 0, 17, 10, 0, 0, 0, 33, 0, 3, 
     21, 0, 5, 0, 0, 0, 5, 17, 0, 0, 
     0, 0, 17, 0, 0, 0, 0, 30, 0, 0, 
     41, 0, 52, 30, 0, 0, 41, 0, 33, 1, 
     2, 32, 2, 0, 74, 2, 10, 1, 1, 0, 
     75, 1, 58, 17, 0, 0, 0, 0, 41, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 28, 0, 
+    0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 
+    0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 
+    0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 
+    46, 0, 0, 0, 0, 0, 0, 0, 29, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
-    0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
-    95, 103, 101, 116, 95, 99, 97, 99, 104, 101, 
-    100, 6, 0, 0, 0, 0, 0, 0, 0, 5, 
-    0, 0, 0, 0, 0, 0, 0, 116, 117, 112, 
-    108, 101, 15, 0, 0, 0, 0, 0, 0, 0, 
-    83, 79, 85, 82, 67, 69, 95, 83, 85, 70, 
-    70, 73, 88, 69, 83, 17, 0, 0, 0, 0, 
-    0, 0, 0, 99, 97, 99, 104, 101, 95, 102, 
-    114, 111, 109, 95, 115, 111, 117, 114, 99, 101, 
-    19, 0, 0, 0, 0, 0, 0, 0, 78, 111, 
-    116, 73, 109, 112, 108, 101, 109, 101, 110, 116, 
-    101, 100, 69, 114, 114, 111, 114, 17, 0, 0, 
-    0, 0, 0, 0, 0, 66, 89, 84, 69, 67, 
-    79, 68, 69, 95, 83, 85, 70, 70, 73, 88, 
-    69, 83, 8, 0, 0, 0, 0, 0, 0, 0, 
-    101, 110, 100, 115, 119, 105, 116, 104, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
-    0, 0, 102, 105, 108, 101, 110, 97, 109, 101, 
-    32, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 80, 97, 116, 104, 70, 105, 110, 100, 
-    101, 114, 46, 102, 105, 110, 100, 95, 109, 111, 
-    100, 117, 108, 101, 46, 49, 52, 51, 56, 58, 
-    52, 0, 21, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 32, 1, 0, 34, 2, 1, 0, 
-    32, 3, 1, 32, 1, 2, 74, 3, 74, 1, 
-    10, 2, 2, 0, 75, 1, 0, 75, 1, 0, 
-    45, 3, 0, 32, 1, 3, 30, 0, 1, 6, 
-    2, 1, 0, 6, 79, 3, 2, 22, 2, 3, 
-    0, 0, 0, 32, 0, 3, 27, 1, 0, 1, 
-    41, 1, 30, 0, 1, 41, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
-    170, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
-    110, 100, 32, 116, 104, 101, 32, 109, 111, 100, 
-    117, 108, 101, 32, 111, 110, 32, 115, 121, 115, 
-    46, 112, 97, 116, 104, 32, 111, 114, 32, 39, 
-    112, 97, 116, 104, 39, 32, 98, 97, 115, 101, 
-    100, 32, 111, 110, 32, 115, 121, 115, 46, 112, 
-    97, 116, 104, 95, 104, 111, 111, 107, 115, 32, 
-    97, 110, 100, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 115, 121, 115, 46, 112, 97, 116, 104, 
-    95, 105, 109, 112, 111, 114, 116, 101, 114, 95, 
-    99, 97, 99, 104, 101, 46, 10, 10, 32, 32, 
-    32, 32, 32, 32, 32, 32, 84, 104, 105, 115, 
-    32, 109, 101, 116, 104, 111, 100, 32, 105, 115, 
-    32, 100, 101, 112, 114, 101, 99, 97, 116, 101, 
-    100, 46, 32, 32, 85, 115, 101, 32, 102, 105, 
-    110, 100, 95, 115, 112, 101, 99, 40, 41, 32, 
-    105, 110, 115, 116, 101, 97, 100, 46, 10, 10, 
-    32, 32, 32, 32, 32, 32, 32, 32, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
+    0, 0, 0, 0, 0, 0, 95, 103, 101, 116, 
+    95, 99, 97, 99, 104, 101, 100, 6, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 116, 117, 112, 108, 101, 15, 0, 
+    0, 0, 0, 0, 0, 0, 83, 79, 85, 82, 
+    67, 69, 95, 83, 85, 70, 70, 73, 88, 69, 
+    83, 17, 0, 0, 0, 0, 0, 0, 0, 99, 
+    97, 99, 104, 101, 95, 102, 114, 111, 109, 95, 
+    115, 111, 117, 114, 99, 101, 19, 0, 0, 0, 
+    0, 0, 0, 0, 78, 111, 116, 73, 109, 112, 
+    108, 101, 109, 101, 110, 116, 101, 100, 69, 114, 
+    114, 111, 114, 17, 0, 0, 0, 0, 0, 0, 
+    0, 66, 89, 84, 69, 67, 79, 68, 69, 95, 
+    83, 85, 70, 70, 73, 88, 69, 83, 8, 0, 
+    0, 0, 0, 0, 0, 0, 101, 110, 100, 115, 
+    119, 105, 116, 104, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
+    108, 101, 110, 97, 109, 101, 33, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
+    49, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 80, 97, 
+    116, 104, 70, 105, 110, 100, 101, 114, 46, 102, 
+    105, 110, 100, 95, 109, 111, 100, 117, 108, 101, 
+    46, 49, 52, 51, 56, 58, 52, 0, 17, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 32, 
+    1, 0, 34, 2, 1, 0, 1, 32, 32, 3, 
+    1, 32, 1, 2, 38, 2, 32, 2, 0, 0, 
+    0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 45, 3, 0, 32, 1, 3, 30, 
+    0, 1, 6, 2, 1, 0, 6, 79, 3, 2, 
+    22, 2, 3, 0, 0, 0, 32, 0, 3, 27, 
+    1, 0, 1, 41, 1, 30, 0, 1, 41, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 170, 0, 0, 0, 0, 0, 0, 0, 102, 
+    105, 110, 100, 32, 116, 104, 101, 32, 109, 111, 
+    100, 117, 108, 101, 32, 111, 110, 32, 115, 121, 
+    115, 46, 112, 97, 116, 104, 32, 111, 114, 32, 
+    39, 112, 97, 116, 104, 39, 32, 98, 97, 115, 
+    101, 100, 32, 111, 110, 32, 115, 121, 115, 46, 
+    112, 97, 116, 104, 95, 104, 111, 111, 107, 115, 
+    32, 97, 110, 100, 10, 32, 32, 32, 32, 32, 
+    32, 32, 32, 115, 121, 115, 46, 112, 97, 116, 
+    104, 95, 105, 109, 112, 111, 114, 116, 101, 114, 
+    95, 99, 97, 99, 104, 101, 46, 10, 10, 32, 
+    32, 32, 32, 32, 32, 32, 32, 84, 104, 105, 
+    115, 32, 109, 101, 116, 104, 111, 100, 32, 105, 
+    115, 32, 100, 101, 112, 114, 101, 99, 97, 116, 
+    101, 100, 46, 32, 32, 85, 115, 101, 32, 102, 
+    105, 110, 100, 95, 115, 112, 101, 99, 40, 41, 
+    32, 105, 110, 115, 116, 101, 97, 100, 46, 10, 
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 5, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
-    0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 
-    95, 109, 111, 100, 117, 108, 101, 2, 0, 0, 
-    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 
-    0, 0, 0, 102, 105, 110, 100, 95, 115, 112, 
-    101, 99, 6, 0, 0, 0, 0, 0, 0, 0, 
-    108, 111, 97, 100, 101, 114, 0, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    99, 108, 115, 8, 0, 0, 0, 0, 0, 0, 
-    0, 102, 117, 108, 108, 110, 97, 109, 101, 4, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
-    104, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    112, 101, 99, 32, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
-    115, 112, 97, 99, 101, 80, 97, 116, 104, 46, 
-    95, 95, 105, 116, 101, 114, 95, 95, 46, 49, 
-    50, 53, 48, 58, 52, 0, 11, 0, 0, 0, 
-    0, 0, 0, 0, 33, 1, 0, 32, 2, 0, 
-    34, 3, 2, 1, 10, 3, 0, 0, 74, 0, 
-    74, 0, 10, 1, 1, 0, 75, 1, 0, 39, 
-    2, 0, 75, 0, 0, 41, 2, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 11, 
+    0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 
+    100, 95, 109, 111, 100, 117, 108, 101, 2, 0, 
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 
+    0, 0, 0, 0, 102, 105, 110, 100, 95, 115, 
+    112, 101, 99, 6, 0, 0, 0, 0, 0, 0, 
+    0, 108, 111, 97, 100, 101, 114, 0, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 99, 108, 115, 8, 0, 0, 0, 0, 0, 
+    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
+    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    116, 104, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 112, 101, 99, 33, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 50, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 95, 78, 97, 109, 
+    101, 115, 112, 97, 99, 101, 80, 97, 116, 104, 
+    46, 95, 95, 105, 116, 101, 114, 95, 95, 46, 
+    49, 50, 53, 48, 58, 52, 0, 11, 0, 0, 
+    0, 0, 0, 0, 0, 33, 1, 0, 32, 2, 
+    0, 34, 3, 2, 1, 1, 32, 38, 3, 32, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 74, 0, 74, 0, 10, 1, 
+    1, 0, 75, 1, 0, 39, 2, 0, 75, 0, 
+    0, 41, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 105, 116, 
-    101, 114, 95, 95, 2, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    105, 116, 101, 114, 12, 0, 0, 0, 0, 0, 
-    0, 0, 95, 114, 101, 99, 97, 108, 99, 117, 
-    108, 97, 116, 101, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
-    108, 102, 32, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
-    0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 95, 99, 104, 101, 99, 107, 
-    95, 110, 97, 109, 101, 46, 95, 99, 104, 101, 
-    99, 107, 95, 110, 97, 109, 101, 95, 119, 114, 
-    97, 112, 112, 101, 114, 46, 53, 50, 50, 58, 
-    52, 0, 45, 0, 0, 0, 0, 0, 0, 0, 
-    32, 0, 1, 30, 1, 0, 6, 2, 0, 1, 
-    6, 79, 3, 2, 22, 2, 21, 0, 0, 0, 
-    32, 0, 0, 27, 1, 0, 1, 32, 2, 1, 
-    6, 0, 1, 2, 1, 79, 3, 0, 19, 0, 
-    14, 0, 0, 0, 33, 1, 0, 30, 0, 1, 
-    32, 2, 0, 27, 3, 2, 1, 32, 4, 1, 
-    74, 3, 74, 4, 4, 2, 2, 75, 1, 0, 
-    75, 1, 0, 0, 5, 0, 2, 2, 32, 3, 
-    1, 12, 1, 1, 0, 0, 0, 0, 0, 0, 
-    0, 5, 1, 0, 0, 0, 0, 0, 0, 0, 
-    3, 1, 0, 0, 0, 0, 0, 0, 0, 1, 
-    40, 1, 0, 17, 4, 0, 0, 0, 32, 0, 
-    0, 27, 1, 0, 1, 45, 1, 1, 17, 0, 
-    0, 0, 0, 31, 1, 0, 32, 0, 0, 32, 
-    2, 1, 32, 3, 2, 3, 4, 0, 58, 4, 
-    0, 58, 4, 2, 24, 4, 3, 25, 2, 4, 
-    30, 0, 0, 32, 3, 3, 2, 4, 0, 65, 
-    4, 3, 11, 1, 2, 4, 1, 1, 41, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 5, 2, 30, 0, 0, 0, 0, 0, 
-    0, 0, 108, 111, 97, 100, 101, 114, 32, 102, 
-    111, 114, 32, 37, 115, 32, 99, 97, 110, 110, 
-    111, 116, 32, 104, 97, 110, 100, 108, 101, 32, 
-    37, 115, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 12, 1, 
-    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
-    0, 0, 0, 0, 0, 109, 101, 116, 104, 111, 
-    100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
-    0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 
-    0, 0, 0, 95, 99, 104, 101, 99, 107, 95, 
-    110, 97, 109, 101, 95, 119, 114, 97, 112, 112, 
-    101, 114, 2, 0, 0, 0, 0, 0, 0, 0, 
-    11, 0, 0, 0, 0, 0, 0, 0, 73, 109, 
-    112, 111, 114, 116, 69, 114, 114, 111, 114, 4, 
-    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
-    101, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 115, 101, 108, 102, 4, 
-    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
-    101, 4, 0, 0, 0, 0, 0, 0, 0, 97, 
-    114, 103, 115, 6, 0, 0, 0, 0, 0, 0, 
-    0, 107, 119, 97, 114, 103, 115, 32, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 37, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
-    112, 97, 116, 104, 95, 105, 115, 100, 105, 114, 
-    46, 49, 53, 56, 58, 48, 0, 19, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 32, 1, 
-    0, 49, 0, 1, 3, 79, 2, 0, 19, 0, 
-    5, 0, 0, 0, 33, 1, 0, 34, 2, 1, 
-    2, 10, 2, 0, 0, 45, 0, 0, 17, 0, 
-    0, 0, 0, 33, 1, 1, 32, 2, 0, 30, 
-    3, 1, 74, 2, 74, 3, 10, 1, 2, 0, 
-    75, 1, 0, 75, 1, 0, 41, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 105, 116, 101, 114, 95, 95, 2, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 105, 116, 101, 114, 12, 0, 
+    0, 0, 0, 0, 0, 0, 95, 114, 101, 99, 
+    97, 108, 99, 117, 108, 97, 116, 101, 0, 0, 
     0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 115, 101, 108, 102, 32, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
+    57, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 95, 99, 
+    104, 101, 99, 107, 95, 110, 97, 109, 101, 46, 
+    95, 99, 104, 101, 99, 107, 95, 110, 97, 109, 
+    101, 95, 119, 114, 97, 112, 112, 101, 114, 46, 
+    53, 50, 50, 58, 52, 0, 45, 0, 0, 0, 
+    0, 0, 0, 0, 32, 0, 1, 30, 1, 0, 
+    6, 2, 0, 1, 6, 79, 3, 2, 22, 2, 
+    21, 0, 0, 0, 32, 0, 0, 27, 1, 0, 
+    1, 32, 2, 1, 6, 0, 1, 2, 1, 79, 
+    3, 0, 19, 0, 14, 0, 0, 0, 33, 1, 
+    0, 30, 0, 1, 32, 2, 0, 27, 3, 2, 
+    1, 32, 4, 1, 74, 3, 74, 4, 4, 2, 
+    2, 75, 1, 0, 75, 1, 0, 0, 5, 0, 
+    2, 2, 32, 3, 1, 12, 1, 1, 0, 0, 
+    0, 0, 0, 0, 0, 5, 1, 0, 0, 0, 
+    0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 
+    0, 0, 0, 1, 40, 1, 0, 17, 4, 0, 
+    0, 0, 32, 0, 0, 27, 1, 0, 1, 45, 
+    1, 1, 17, 0, 0, 0, 0, 31, 1, 0, 
+    32, 0, 0, 32, 2, 1, 32, 3, 2, 3, 
+    4, 0, 58, 4, 0, 58, 4, 2, 24, 4, 
+    3, 25, 2, 4, 30, 0, 0, 32, 3, 3, 
+    2, 4, 0, 65, 4, 3, 11, 1, 2, 4, 
+    1, 1, 41, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 5, 2, 30, 0, 0, 0, 
+    0, 0, 0, 0, 108, 111, 97, 100, 101, 114, 
+    32, 102, 111, 114, 32, 37, 115, 32, 99, 97, 
+    110, 110, 111, 116, 32, 104, 97, 110, 100, 108, 
+    101, 32, 37, 115, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    12, 1, 0, 0, 0, 0, 0, 0, 0, 6, 
+    0, 0, 0, 0, 0, 0, 0, 109, 101, 116, 
+    104, 111, 100, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 
+    0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 
+    0, 0, 0, 0, 0, 95, 99, 104, 101, 99, 
+    107, 95, 110, 97, 109, 101, 95, 119, 114, 97, 
+    112, 112, 101, 114, 2, 0, 0, 0, 0, 0, 
+    0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
+    73, 109, 112, 111, 114, 116, 69, 114, 114, 111, 
+    114, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
+    97, 109, 101, 0, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
+    97, 109, 101, 4, 0, 0, 0, 0, 0, 0, 
+    0, 97, 114, 103, 115, 6, 0, 0, 0, 0, 
+    0, 0, 0, 107, 119, 97, 114, 103, 115, 33, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 95, 112, 97, 116, 104, 95, 105, 115, 100, 
+    105, 114, 46, 49, 53, 56, 58, 48, 0, 19, 
+    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
+    32, 1, 0, 49, 0, 1, 3, 79, 2, 0, 
+    19, 0, 5, 0, 0, 0, 33, 1, 0, 34, 
+    2, 1, 2, 1, 32, 38, 2, 32, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 45, 0, 0, 17, 0, 0, 0, 0, 
+    33, 1, 1, 32, 2, 0, 30, 3, 1, 74, 
+    2, 74, 3, 10, 1, 2, 0, 75, 1, 0, 
+    75, 1, 0, 41, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 2, 30, 0, 0, 0, 
+    0, 0, 0, 0, 82, 101, 112, 108, 97, 99, 
+    101, 109, 101, 110, 116, 32, 102, 111, 114, 32, 
+    111, 115, 46, 112, 97, 116, 104, 46, 105, 115, 
+    100, 105, 114, 46, 0, 0, 64, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    2, 30, 0, 0, 0, 0, 0, 0, 0, 82, 
-    101, 112, 108, 97, 99, 101, 109, 101, 110, 116, 
-    32, 102, 111, 114, 32, 111, 115, 46, 112, 97, 
-    116, 104, 46, 105, 115, 100, 105, 114, 46, 0, 
-    0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 
-    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
-    95, 105, 115, 100, 105, 114, 3, 0, 0, 0, 
     0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 95, 111, 115, 18, 0, 0, 0, 0, 
-    0, 0, 0, 95, 112, 97, 116, 104, 95, 105, 
-    115, 95, 109, 111, 100, 101, 95, 116, 121, 112, 
-    101, 6, 0, 0, 0, 0, 0, 0, 0, 103, 
-    101, 116, 99, 119, 100, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
-    97, 116, 104, 32, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 99, 97, 108, 99, 
-    95, 109, 111, 100, 101, 46, 53, 48, 50, 58, 
-    48, 0, 25, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 42, 1, 0, 0, 0, 17, 7, 
+    0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 95, 105, 115, 100, 105, 
+    114, 3, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 95, 111, 115, 
+    18, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
+    97, 116, 104, 95, 105, 115, 95, 109, 111, 100, 
+    101, 95, 116, 121, 112, 101, 6, 0, 0, 0, 
+    0, 0, 0, 0, 103, 101, 116, 99, 119, 100, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 112, 97, 116, 104, 32, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    95, 99, 97, 108, 99, 95, 109, 111, 100, 101, 
+    46, 53, 48, 50, 58, 48, 0, 23, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 17, 7, 
     0, 0, 0, 33, 0, 1, 21, 0, 4, 0, 
     0, 0, 30, 1, 1, 45, 1, 1, 5, 17, 
-    10, 0, 0, 0, 52, 33, 1, 0, 32, 2, 
+    9, 0, 0, 0, 52, 33, 1, 0, 32, 2, 
     0, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
-    27, 3, 0, 2, 45, 1, 3, 54, 17, 0, 
-    0, 0, 0, 32, 0, 1, 30, 1, 2, 63, 
-    0, 1, 10, 45, 1, 0, 32, 1, 1, 41, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    27, 3, 0, 2, 45, 1, 3, 17, 0, 0, 
+    0, 0, 32, 0, 1, 30, 1, 2, 63, 0, 
+    1, 10, 45, 1, 0, 32, 1, 1, 41, 1, 
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
+    16, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 2, 51, 0, 0, 0, 0, 0, 
-    0, 0, 67, 97, 108, 99, 117, 108, 97, 116, 
-    101, 32, 116, 104, 101, 32, 109, 111, 100, 101, 
-    32, 112, 101, 114, 109, 105, 115, 115, 105, 111, 
-    110, 115, 32, 102, 111, 114, 32, 97, 32, 98, 
-    121, 116, 101, 99, 111, 100, 101, 32, 102, 105, 
-    108, 101, 46, 0, 182, 1, 0, 0, 0, 0, 
-    0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 2, 51, 
+    0, 0, 0, 0, 0, 0, 0, 67, 97, 108, 
+    99, 117, 108, 97, 116, 101, 32, 116, 104, 101, 
+    32, 109, 111, 100, 101, 32, 112, 101, 114, 109, 
+    105, 115, 115, 105, 111, 110, 115, 32, 102, 111, 
+    114, 32, 97, 32, 98, 121, 116, 101, 99, 111, 
+    100, 101, 32, 102, 105, 108, 101, 46, 0, 182, 
+    1, 0, 0, 0, 0, 0, 0, 0, 128, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 95, 99, 
-    97, 108, 99, 95, 109, 111, 100, 101, 3, 0, 
-    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
-    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    115, 116, 97, 116, 7, 0, 0, 0, 0, 0, 
-    0, 0, 79, 83, 69, 114, 114, 111, 114, 7, 
-    0, 0, 0, 0, 0, 0, 0, 115, 116, 95, 
-    109, 111, 100, 101, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 4, 0, 0, 0, 0, 0, 0, 0, 
-    109, 111, 100, 101, 32, 0, 0, 0, 0, 0, 
-    0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 
-    62, 0, 0, 0, 0, 0, 0, 0, 47, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 83, 111, 117, 114, 
-    99, 101, 76, 111, 97, 100, 101, 114, 46, 103, 
-    101, 116, 95, 99, 111, 100, 101, 46, 57, 49, 
-    53, 58, 52, 0, 104, 1, 0, 0, 0, 0, 
-    0, 0, 30, 0, 0, 32, 1, 0, 34, 2, 
-    1, 18, 32, 3, 1, 74, 3, 10, 2, 1, 
-    0, 75, 1, 0, 45, 2, 0, 30, 2, 1, 
-    45, 3, 2, 30, 1, 1, 45, 4, 1, 30, 
-    2, 1, 45, 5, 2, 30, 1, 2, 45, 6, 
-    1, 30, 2, 3, 45, 7, 2, 42, 1, 0, 
-    0, 0, 17, 7, 0, 0, 0, 33, 0, 1, 
-    21, 0, 4, 0, 0, 0, 30, 1, 1, 45, 
-    8, 1, 5, 17, 79, 0, 0, 0, 52, 33, 
-    1, 0, 32, 2, 2, 74, 2, 10, 1, 1, 
-    0, 75, 1, 0, 45, 8, 0, 54, 17, 0, 
-    0, 0, 0, 42, 1, 0, 0, 0, 17, 5, 
-    0, 0, 0, 33, 0, 2, 21, 0, 2, 0, 
-    0, 0, 5, 17, 63, 0, 0, 0, 52, 32, 
-    0, 0, 34, 1, 0, 19, 32, 2, 2, 74, 
-    2, 10, 1, 1, 0, 75, 1, 68, 45, 9, 
-    0, 54, 17, 0, 0, 0, 0, 33, 1, 3, 
-    32, 2, 9, 30, 3, 4, 1, 4, 2, 3, 
-    74, 4, 10, 1, 1, 0, 75, 1, 4, 45, 
-    3, 0, 42, 1, 0, 0, 0, 17, 5, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 95, 99, 97, 108, 99, 95, 109, 
+    111, 100, 101, 3, 0, 0, 0, 0, 0, 0, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    112, 97, 116, 104, 95, 115, 116, 97, 116, 7, 
+    0, 0, 0, 0, 0, 0, 0, 79, 83, 69, 
+    114, 114, 111, 114, 7, 0, 0, 0, 0, 0, 
+    0, 0, 115, 116, 95, 109, 111, 100, 101, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 112, 97, 116, 104, 4, 0, 0, 
+    0, 0, 0, 0, 0, 109, 111, 100, 101, 34, 
+    0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 
+    0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 
+    0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 83, 111, 117, 114, 99, 101, 76, 111, 97, 
+    100, 101, 114, 46, 103, 101, 116, 95, 99, 111, 
+    100, 101, 46, 57, 49, 53, 58, 52, 0, 50, 
+    1, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
+    32, 1, 0, 34, 2, 1, 18, 1, 32, 32, 
+    3, 1, 38, 2, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    45, 2, 0, 30, 2, 1, 45, 3, 2, 30, 
+    1, 1, 45, 4, 1, 30, 2, 1, 45, 5, 
+    2, 30, 1, 2, 45, 6, 1, 30, 2, 3, 
+    45, 7, 2, 17, 7, 0, 0, 0, 33, 0, 
+    1, 21, 0, 4, 0, 0, 0, 30, 1, 1, 
+    45, 8, 1, 5, 17, 69, 0, 0, 0, 52, 
+    33, 1, 0, 32, 2, 2, 74, 2, 10, 1, 
+    1, 0, 75, 1, 0, 45, 8, 0, 17, 0, 
+    0, 0, 0, 17, 5, 0, 0, 0, 33, 0, 
+    2, 21, 0, 2, 0, 0, 0, 5, 17, 55, 
+    0, 0, 0, 52, 32, 0, 0, 34, 1, 0, 
+    19, 1, 32, 32, 2, 2, 38, 1, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 45, 9, 0, 17, 0, 0, 
+    0, 0, 33, 1, 3, 32, 2, 9, 30, 3, 
+    4, 1, 4, 2, 3, 74, 4, 10, 1, 1, 
+    0, 75, 1, 4, 45, 3, 0, 17, 5, 0, 
     0, 0, 33, 0, 2, 21, 0, 2, 0, 0, 
-    0, 5, 17, 38, 0, 0, 0, 52, 32, 0, 
-    0, 34, 1, 0, 20, 32, 2, 8, 74, 2, 
-    10, 1, 1, 0, 75, 1, 173, 45, 10, 0, 
-    54, 17, 0, 0, 0, 0, 30, 0, 1, 30, 
+    0, 5, 17, 34, 0, 0, 0, 52, 32, 0, 
+    0, 34, 1, 0, 20, 1, 32, 32, 2, 8, 
+    38, 1, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 45, 10, 
+    0, 17, 0, 0, 0, 0, 30, 0, 1, 30, 
     1, 5, 32, 0, 1, 30, 2, 6, 32, 3, 
     8, 74, 1, 74, 2, 74, 0, 74, 3, 2, 
     4, 2, 75, 1, 137, 75, 1, 173, 75, 1, 
-    0, 75, 1, 128, 45, 11, 4, 42, 1, 0, 
-    0, 0, 17, 135, 0, 0, 0, 33, 0, 10, 
-    33, 1, 11, 74, 0, 74, 1, 4, 2, 2, 
-    75, 1, 173, 75, 1, 0, 21, 2, 89, 0, 
-    0, 0, 5, 17, 0, 0, 0, 0, 17, 0, 
+    0, 75, 1, 128, 45, 11, 4, 17, 115, 0, 
+    0, 0, 33, 0, 10, 33, 1, 11, 74, 0, 
+    74, 1, 4, 2, 2, 75, 1, 173, 75, 1, 
+    0, 21, 2, 77, 0, 0, 0, 5, 17, 0, 
     0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 
-    0, 0, 0, 32, 0, 4, 30, 1, 1, 6, 
-    2, 0, 1, 6, 79, 3, 2, 19, 2, 8, 
-    0, 0, 0, 32, 0, 0, 34, 1, 0, 20, 
-    32, 2, 2, 74, 2, 10, 1, 1, 0, 75, 
-    1, 173, 45, 4, 0, 17, 0, 0, 0, 0, 
-    32, 0, 0, 34, 1, 0, 23, 32, 2, 4, 
-    32, 3, 2, 74, 2, 74, 3, 10, 1, 2, 
-    0, 75, 1, 71, 75, 1, 173, 45, 14, 0, 
-    33, 1, 12, 34, 2, 1, 22, 30, 3, 7, 
-    32, 1, 2, 74, 3, 74, 1, 10, 2, 2, 
-    0, 75, 1, 172, 75, 1, 173, 33, 4, 14, 
+    0, 0, 0, 17, 0, 0, 0, 0, 32, 0, 
+    4, 30, 1, 1, 6, 2, 0, 1, 6, 79, 
+    3, 2, 19, 2, 6, 0, 0, 0, 32, 0, 
+    0, 34, 1, 0, 20, 1, 32, 32, 2, 2, 
+    38, 1, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 45, 4, 
+    0, 17, 0, 0, 0, 0, 32, 0, 0, 34, 
+    1, 0, 23, 1, 32, 32, 2, 4, 32, 3, 
+    2, 38, 1, 32, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    45, 14, 0, 33, 1, 12, 34, 2, 1, 22, 
+    1, 32, 30, 3, 7, 32, 1, 2, 38, 2, 
+    32, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 33, 4, 14, 
     27, 0, 4, 25, 49, 1, 0, 3, 79, 2, 
     1, 19, 1, 9, 0, 0, 0, 32, 0, 8, 
     30, 2, 1, 6, 1, 0, 2, 7, 79, 3, 
     1, 19, 1, 4, 0, 0, 0, 32, 0, 3, 
     30, 2, 1, 6, 1, 0, 2, 7, 17, 0, 
-    0, 0, 0, 79, 0, 1, 19, 1, 72, 0, 
+    0, 0, 0, 79, 0, 1, 19, 1, 62, 0, 
     0, 0, 32, 0, 6, 79, 1, 0, 22, 0, 
     20, 0, 0, 0, 33, 1, 16, 32, 2, 14, 
     32, 3, 3, 33, 4, 17, 32, 5, 4, 74, 
     5, 10, 4, 1, 0, 75, 1, 172, 74, 0, 
     74, 2, 74, 3, 74, 0, 10, 1, 3, 0, 
     75, 1, 173, 75, 1, 173, 75, 1, 173, 39, 
-    6, 0, 75, 0, 0, 45, 10, 6, 17, 27, 
+    6, 0, 75, 0, 0, 45, 10, 6, 17, 25, 
     0, 0, 0, 32, 0, 5, 30, 1, 1, 6, 
-    2, 0, 1, 6, 79, 3, 2, 19, 2, 9, 
+    2, 0, 1, 6, 79, 3, 2, 19, 2, 7, 
     0, 0, 0, 33, 0, 6, 34, 1, 0, 21, 
-    32, 2, 4, 74, 2, 10, 1, 1, 0, 75, 
-    1, 173, 45, 5, 0, 17, 1, 0, 0, 0, 
-    52, 33, 1, 15, 32, 2, 14, 32, 3, 5, 
-    32, 4, 7, 74, 2, 74, 3, 74, 4, 10, 
-    1, 3, 0, 75, 1, 124, 75, 1, 172, 75, 
-    1, 173, 45, 10, 0, 17, 0, 0, 0, 0, 
-    42, 1, 0, 0, 0, 17, 5, 0, 0, 0, 
-    33, 0, 1, 21, 0, 2, 0, 0, 0, 5, 
-    17, 15, 0, 0, 0, 52, 32, 0, 0, 34, 
-    1, 0, 24, 32, 2, 2, 32, 3, 8, 32, 
-    4, 10, 74, 2, 74, 3, 74, 4, 10, 1, 
-    3, 0, 75, 1, 173, 75, 1, 255, 75, 1, 
-    172, 54, 17, 0, 0, 0, 0, 17, 0, 0, 
-    0, 0, 32, 0, 14, 41, 0, 33, 1, 4, 
-    32, 2, 10, 32, 3, 1, 32, 4, 11, 74, 
-    2, 74, 3, 74, 4, 10, 1, 3, 0, 75, 
-    1, 172, 75, 1, 173, 75, 1, 76, 45, 12, 
-    0, 33, 1, 5, 32, 2, 10, 74, 2, 10, 
-    1, 1, 0, 75, 1, 246, 30, 3, 8, 30, 
-    1, 1, 30, 2, 1, 62, 4, 3, 3, 1, 
-    2, 1, 5, 0, 4, 45, 13, 5, 32, 0, 
-    12, 30, 1, 9, 0, 2, 0, 1, 9, 30, 
-    3, 10, 6, 0, 2, 3, 1, 45, 6, 0, 
-    32, 2, 6, 79, 0, 2, 22, 2, 20, 0, 
-    0, 0, 33, 1, 9, 32, 2, 10, 32, 3, 
-    3, 32, 0, 9, 30, 4, 11, 1, 5, 0, 
-    4, 32, 6, 1, 32, 4, 11, 74, 2, 74, 
-    3, 74, 5, 74, 6, 74, 4, 10, 1, 5, 
-    0, 75, 1, 172, 75, 1, 173, 75, 1, 0, 
-    75, 1, 77, 75, 1, 172, 17, 56, 0, 0, 
-    0, 32, 0, 12, 30, 1, 12, 0, 2, 0, 
-    1, 9, 30, 3, 10, 6, 0, 2, 3, 1, 
-    45, 7, 0, 33, 2, 6, 27, 0, 2, 26, 
-    30, 1, 13, 6, 2, 0, 1, 1, 79, 3, 
-    2, 19, 2, 9, 0, 0, 0, 32, 2, 7, 
-    79, 0, 2, 22, 2, 5, 0, 0, 0, 33, 
-    0, 6, 27, 1, 0, 26, 30, 3, 14, 6, 
-    2, 1, 3, 0, 17, 0, 0, 0, 0, 17, 
-    0, 0, 0, 0, 79, 0, 2, 19, 2, 32, 
-    0, 0, 0, 32, 0, 0, 34, 1, 0, 20, 
-    32, 2, 2, 74, 2, 10, 1, 1, 0, 75, 
-    1, 0, 45, 4, 0, 33, 1, 6, 34, 2, 
-    1, 21, 33, 3, 7, 32, 1, 4, 74, 3, 
-    74, 1, 10, 2, 2, 0, 75, 1, 150, 75, 
-    1, 172, 45, 5, 0, 33, 1, 8, 32, 2, 
-    10, 32, 3, 5, 32, 4, 1, 32, 5, 11, 
-    74, 2, 74, 3, 74, 4, 74, 5, 10, 1, 
-    4, 0, 75, 1, 172, 75, 1, 173, 75, 1, 
-    96, 75, 1, 172, 17, 0, 0, 0, 0, 17, 
-    0, 0, 0, 0, 54, 17, 0, 0, 0, 0, 
-    33, 0, 12, 34, 1, 0, 22, 30, 2, 15, 
-    32, 3, 8, 32, 4, 2, 74, 2, 74, 3, 
-    74, 4, 10, 1, 3, 0, 75, 1, 172, 75, 
-    1, 173, 75, 1, 0, 33, 5, 13, 32, 1, 
-    13, 32, 2, 1, 32, 3, 8, 32, 4, 2, 
-    12, 5, 1, 0, 0, 0, 0, 0, 0, 0, 
-    1, 3, 0, 0, 0, 0, 0, 0, 0, 2, 
-    3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
-    27, 28, 29, 17, 0, 0, 0, 0, 17, 0, 
+    1, 32, 32, 2, 4, 38, 1, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 45, 5, 0, 17, 1, 0, 0, 
+    0, 52, 33, 1, 15, 32, 2, 14, 32, 3, 
+    5, 32, 4, 7, 74, 2, 74, 3, 74, 4, 
+    10, 1, 3, 0, 75, 1, 124, 75, 1, 172, 
+    75, 1, 173, 45, 10, 0, 17, 0, 0, 0, 
+    0, 17, 5, 0, 0, 0, 33, 0, 1, 21, 
+    0, 2, 0, 0, 0, 5, 17, 8, 0, 0, 
+    0, 52, 32, 0, 0, 34, 1, 0, 24, 1, 
+    32, 32, 2, 2, 32, 3, 8, 32, 4, 10, 
+    38, 1, 32, 3, 0, 0, 0, 0, 0, 0, 
+    0, 2, 3, 4, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    32, 0, 14, 41, 0, 33, 1, 4, 32, 2, 
+    10, 32, 3, 1, 32, 4, 11, 74, 2, 74, 
+    3, 74, 4, 10, 1, 3, 0, 75, 1, 172, 
+    75, 1, 173, 75, 1, 76, 45, 12, 0, 33, 
+    1, 5, 32, 2, 10, 74, 2, 10, 1, 1, 
+    0, 75, 1, 246, 30, 3, 8, 30, 1, 1, 
+    30, 2, 1, 62, 4, 3, 3, 1, 2, 1, 
+    5, 0, 4, 45, 13, 5, 32, 0, 12, 30, 
+    1, 9, 0, 2, 0, 1, 9, 30, 3, 10, 
+    6, 0, 2, 3, 1, 45, 6, 0, 32, 2, 
+    6, 79, 0, 2, 22, 2, 20, 0, 0, 0, 
+    33, 1, 9, 32, 2, 10, 32, 3, 3, 32, 
+    0, 9, 30, 4, 11, 1, 5, 0, 4, 32, 
+    6, 1, 32, 4, 11, 74, 2, 74, 3, 74, 
+    5, 74, 6, 74, 4, 10, 1, 5, 0, 75, 
+    1, 172, 75, 1, 173, 75, 1, 0, 75, 1, 
+    77, 75, 1, 172, 17, 42, 0, 0, 0, 32, 
+    0, 12, 30, 1, 12, 0, 2, 0, 1, 9, 
+    30, 3, 10, 6, 0, 2, 3, 1, 45, 7, 
+    0, 33, 2, 6, 27, 0, 2, 26, 30, 1, 
+    13, 6, 2, 0, 1, 1, 79, 3, 2, 19, 
+    2, 9, 0, 0, 0, 32, 2, 7, 79, 0, 
+    2, 22, 2, 5, 0, 0, 0, 33, 0, 6, 
+    27, 1, 0, 26, 30, 3, 14, 6, 2, 1, 
+    3, 0, 17, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 79, 0, 2, 19, 2, 18, 0, 0, 
+    0, 32, 0, 0, 34, 1, 0, 20, 1, 32, 
+    32, 2, 2, 38, 1, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 45, 4, 0, 33, 1, 6, 34, 2, 1, 
+    21, 1, 33, 33, 3, 7, 32, 1, 4, 38, 
+    2, 33, 2, 0, 0, 0, 0, 0, 0, 0, 
+    3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 45, 5, 
+    0, 33, 1, 8, 32, 2, 10, 32, 3, 5, 
+    32, 4, 1, 32, 5, 11, 38, 1, 32, 4, 
+    0, 0, 0, 0, 0, 0, 0, 2, 3, 4, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 33, 0, 12, 34, 1, 0, 22, 1, 
+    32, 30, 2, 15, 32, 3, 8, 32, 4, 2, 
+    38, 1, 32, 3, 0, 0, 0, 0, 0, 0, 
+    0, 2, 3, 4, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    33, 5, 13, 32, 1, 13, 32, 2, 1, 32, 
+    3, 8, 32, 4, 2, 12, 5, 1, 0, 0, 
+    0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 
+    0, 0, 0, 0, 2, 3, 4, 3, 0, 0, 
+    0, 0, 0, 0, 0, 27, 28, 29, 17, 0, 
     0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 
-    0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 17, 0, 0, 0, 0, 41, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 16, 0, 
+    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
+    0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 
+    30, 0, 0, 0, 0, 0, 0, 0, 17, 0, 
+    0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 
+    0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 
+    0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 
+    37, 0, 0, 0, 0, 0, 0, 0, 42, 0, 
+    0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 
+    0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 
+    0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 
+    52, 0, 0, 0, 0, 0, 0, 0, 57, 0, 
+    0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 
+    0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 
+    0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 
+    79, 0, 0, 0, 0, 0, 0, 0, 79, 0, 
+    0, 0, 0, 0, 0, 0, 178, 0, 0, 0, 
+    0, 0, 0, 0, 179, 0, 0, 0, 0, 0, 
+    0, 0, 179, 0, 0, 0, 0, 0, 0, 0, 
+    184, 0, 0, 0, 0, 0, 0, 0, 190, 0, 
+    0, 0, 0, 0, 0, 0, 179, 0, 0, 0, 
+    0, 0, 0, 0, 194, 0, 0, 0, 0, 0, 
+    0, 0, 32, 1, 0, 0, 0, 0, 0, 0, 
+    79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 
+    2, 190, 0, 0, 0, 0, 0, 0, 0, 67, 
+    111, 110, 99, 114, 101, 116, 101, 32, 105, 109, 
+    112, 108, 101, 109, 101, 110, 116, 97, 116, 105, 
+    111, 110, 32, 111, 102, 32, 73, 110, 115, 112, 
+    101, 99, 116, 76, 111, 97, 100, 101, 114, 46, 
+    103, 101, 116, 95, 99, 111, 100, 101, 46, 10, 
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 82, 
+    101, 97, 100, 105, 110, 103, 32, 111, 102, 32, 
+    98, 121, 116, 101, 99, 111, 100, 101, 32, 114, 
+    101, 113, 117, 105, 114, 101, 115, 32, 112, 97, 
+    116, 104, 95, 115, 116, 97, 116, 115, 32, 116, 
+    111, 32, 98, 101, 32, 105, 109, 112, 108, 101, 
+    109, 101, 110, 116, 101, 100, 46, 32, 84, 111, 
+    32, 119, 114, 105, 116, 101, 10, 32, 32, 32, 
+    32, 32, 32, 32, 32, 98, 121, 116, 101, 99, 
+    111, 100, 101, 44, 32, 115, 101, 116, 95, 100, 
+    97, 116, 97, 32, 109, 117, 115, 116, 32, 97, 
+    108, 115, 111, 32, 98, 101, 32, 105, 109, 112, 
+    108, 101, 109, 101, 110, 116, 101, 100, 46, 10, 
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 5, 
+    6, 0, 6, 1, 2, 5, 0, 0, 0, 0, 
+    0, 0, 0, 109, 116, 105, 109, 101, 2, 4, 
+    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
+    101, 2, 4, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 2, 19, 0, 0, 0, 0, 
+    0, 0, 0, 99, 111, 100, 101, 32, 111, 98, 
+    106, 101, 99, 116, 32, 102, 114, 111, 109, 32, 
+    123, 125, 0, 16, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 105, 
+    122, 101, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 2, 5, 0, 0, 0, 0, 0, 0, 0, 
+    110, 101, 118, 101, 114, 2, 6, 0, 0, 0, 
+    0, 0, 0, 0, 97, 108, 119, 97, 121, 115, 
+    2, 13, 0, 0, 0, 0, 0, 0, 0, 123, 
+    125, 32, 109, 97, 116, 99, 104, 101, 115, 32, 
+    123, 125, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 103, 
+    101, 116, 95, 99, 111, 100, 101, 30, 0, 0, 
+    0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    0, 0, 0, 99, 97, 99, 104, 101, 95, 102, 
+    114, 111, 109, 95, 115, 111, 117, 114, 99, 101, 
+    19, 0, 0, 0, 0, 0, 0, 0, 78, 111, 
+    116, 73, 109, 112, 108, 101, 109, 101, 110, 116, 
+    101, 100, 69, 114, 114, 111, 114, 7, 0, 0, 
+    0, 0, 0, 0, 0, 79, 83, 69, 114, 114, 
+    111, 114, 3, 0, 0, 0, 0, 0, 0, 0, 
+    105, 110, 116, 13, 0, 0, 0, 0, 0, 0, 
+    0, 95, 99, 108, 97, 115, 115, 105, 102, 121, 
+    95, 112, 121, 99, 10, 0, 0, 0, 0, 0, 
+    0, 0, 109, 101, 109, 111, 114, 121, 118, 105, 
+    101, 119, 4, 0, 0, 0, 0, 0, 0, 0, 
+    95, 105, 109, 112, 17, 0, 0, 0, 0, 0, 
+    0, 0, 95, 82, 65, 87, 95, 77, 65, 71, 
+    73, 67, 95, 78, 85, 77, 66, 69, 82, 18, 
+    0, 0, 0, 0, 0, 0, 0, 95, 118, 97, 
+    108, 105, 100, 97, 116, 101, 95, 104, 97, 115, 
+    104, 95, 112, 121, 99, 23, 0, 0, 0, 0, 
+    0, 0, 0, 95, 118, 97, 108, 105, 100, 97, 
+    116, 101, 95, 116, 105, 109, 101, 115, 116, 97, 
+    109, 112, 95, 112, 121, 99, 11, 0, 0, 0, 
+    0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 
+    69, 114, 114, 111, 114, 8, 0, 0, 0, 0, 
+    0, 0, 0, 69, 79, 70, 69, 114, 114, 111, 
+    114, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 17, 
+    0, 0, 0, 0, 0, 0, 0, 95, 99, 111, 
+    109, 112, 105, 108, 101, 95, 98, 121, 116, 101, 
+    99, 111, 100, 101, 3, 0, 0, 0, 0, 0, 
+    0, 0, 115, 121, 115, 17, 0, 0, 0, 0, 
+    0, 0, 0, 95, 99, 111, 100, 101, 95, 116, 
+    111, 95, 104, 97, 115, 104, 95, 112, 121, 99, 
+    22, 0, 0, 0, 0, 0, 0, 0, 95, 99, 
+    111, 100, 101, 95, 116, 111, 95, 116, 105, 109, 
+    101, 115, 116, 97, 109, 112, 95, 112, 121, 99, 
+    3, 0, 0, 0, 0, 0, 0, 0, 108, 101, 
+    110, 12, 0, 0, 0, 0, 0, 0, 0, 103, 
+    101, 116, 95, 102, 105, 108, 101, 110, 97, 109, 
+    101, 10, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 95, 115, 116, 97, 116, 115, 8, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    95, 100, 97, 116, 97, 11, 0, 0, 0, 0, 
+    0, 0, 0, 115, 111, 117, 114, 99, 101, 95, 
+    104, 97, 115, 104, 16, 0, 0, 0, 0, 0, 
+    0, 0, 95, 118, 101, 114, 98, 111, 115, 101, 
+    95, 109, 101, 115, 115, 97, 103, 101, 14, 0, 
+    0, 0, 0, 0, 0, 0, 115, 111, 117, 114, 
+    99, 101, 95, 116, 111, 95, 99, 111, 100, 101, 
+    15, 0, 0, 0, 0, 0, 0, 0, 95, 99, 
+    97, 99, 104, 101, 95, 98, 121, 116, 101, 99, 
+    111, 100, 101, 19, 0, 0, 0, 0, 0, 0, 
+    0, 100, 111, 110, 116, 95, 119, 114, 105, 116, 
+    101, 95, 98, 121, 116, 101, 99, 111, 100, 101, 
+    21, 0, 0, 0, 0, 0, 0, 0, 99, 104, 
+    101, 99, 107, 95, 104, 97, 115, 104, 95, 98, 
+    97, 115, 101, 100, 95, 112, 121, 99, 115, 4, 
+    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
+    101, 13, 0, 0, 0, 0, 0, 0, 0, 98, 
+    121, 116, 101, 99, 111, 100, 101, 95, 112, 97, 
+    116, 104, 11, 0, 0, 0, 0, 0, 0, 0, 
+    115, 111, 117, 114, 99, 101, 95, 112, 97, 116, 
+    104, 0, 0, 0, 0, 0, 0, 0, 0, 15, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 101, 108, 102, 8, 
+    0, 0, 0, 0, 0, 0, 0, 102, 117, 108, 
+    108, 110, 97, 109, 101, 11, 0, 0, 0, 0, 
+    0, 0, 0, 115, 111, 117, 114, 99, 101, 95, 
+    112, 97, 116, 104, 12, 0, 0, 0, 0, 0, 
+    0, 0, 115, 111, 117, 114, 99, 101, 95, 109, 
+    116, 105, 109, 101, 12, 0, 0, 0, 0, 0, 
+    0, 0, 115, 111, 117, 114, 99, 101, 95, 98, 
+    121, 116, 101, 115, 11, 0, 0, 0, 0, 0, 
+    0, 0, 115, 111, 117, 114, 99, 101, 95, 104, 
+    97, 115, 104, 10, 0, 0, 0, 0, 0, 0, 
+    0, 104, 97, 115, 104, 95, 98, 97, 115, 101, 
+    100, 12, 0, 0, 0, 0, 0, 0, 0, 99, 
+    104, 101, 99, 107, 95, 115, 111, 117, 114, 99, 
+    101, 13, 0, 0, 0, 0, 0, 0, 0, 98, 
+    121, 116, 101, 99, 111, 100, 101, 95, 112, 97, 
+    116, 104, 2, 0, 0, 0, 0, 0, 0, 0, 
+    115, 116, 4, 0, 0, 0, 0, 0, 0, 0, 
+    100, 97, 116, 97, 11, 0, 0, 0, 0, 0, 
+    0, 0, 101, 120, 99, 95, 100, 101, 116, 97, 
+    105, 108, 115, 5, 0, 0, 0, 0, 0, 0, 
+    0, 102, 108, 97, 103, 115, 10, 0, 0, 0, 
+    0, 0, 0, 0, 98, 121, 116, 101, 115, 95, 
+    100, 97, 116, 97, 11, 0, 0, 0, 0, 0, 
+    0, 0, 99, 111, 100, 101, 95, 111, 98, 106, 
+    101, 99, 116, 33, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
+    114, 110, 97, 108, 46, 83, 111, 117, 114, 99, 
+    101, 76, 111, 97, 100, 101, 114, 46, 112, 97, 
+    116, 104, 95, 115, 116, 97, 116, 115, 46, 56, 
+    54, 54, 58, 52, 0, 13, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 30, 1, 1, 30, 
+    2, 2, 32, 0, 0, 34, 1, 0, 0, 1, 
+    32, 32, 3, 1, 38, 1, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 74, 2, 74, 0, 2, 4, 1, 75, 
+    1, 172, 75, 1, 172, 41, 4, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 
-    0, 0, 0, 0, 0, 0, 0, 2, 190, 0, 
-    0, 0, 0, 0, 0, 0, 67, 111, 110, 99, 
-    114, 101, 116, 101, 32, 105, 109, 112, 108, 101, 
-    109, 101, 110, 116, 97, 116, 105, 111, 110, 32, 
-    111, 102, 32, 73, 110, 115, 112, 101, 99, 116, 
-    76, 111, 97, 100, 101, 114, 46, 103, 101, 116, 
-    95, 99, 111, 100, 101, 46, 10, 10, 32, 32, 
-    32, 32, 32, 32, 32, 32, 82, 101, 97, 100, 
-    105, 110, 103, 32, 111, 102, 32, 98, 121, 116, 
-    101, 99, 111, 100, 101, 32, 114, 101, 113, 117, 
-    105, 114, 101, 115, 32, 112, 97, 116, 104, 95, 
-    115, 116, 97, 116, 115, 32, 116, 111, 32, 98, 
-    101, 32, 105, 109, 112, 108, 101, 109, 101, 110, 
-    116, 101, 100, 46, 32, 84, 111, 32, 119, 114, 
-    105, 116, 101, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 98, 121, 116, 101, 99, 111, 100, 101, 
-    44, 32, 115, 101, 116, 95, 100, 97, 116, 97, 
-    32, 109, 117, 115, 116, 32, 97, 108, 115, 111, 
-    32, 98, 101, 32, 105, 109, 112, 108, 101, 109, 
-    101, 110, 116, 101, 100, 46, 10, 10, 32, 32, 
-    32, 32, 32, 32, 32, 32, 5, 6, 0, 6, 
-    1, 2, 5, 0, 0, 0, 0, 0, 0, 0, 
-    109, 116, 105, 109, 101, 2, 4, 0, 0, 0, 
-    0, 0, 0, 0, 110, 97, 109, 101, 2, 4, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
-    104, 2, 19, 0, 0, 0, 0, 0, 0, 0, 
-    99, 111, 100, 101, 32, 111, 98, 106, 101, 99, 
-    116, 32, 102, 114, 111, 109, 32, 123, 125, 0, 
-    16, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 2, 158, 1, 
+    0, 0, 0, 0, 0, 0, 79, 112, 116, 105, 
+    111, 110, 97, 108, 32, 109, 101, 116, 104, 111, 
+    100, 32, 114, 101, 116, 117, 114, 110, 105, 110, 
+    103, 32, 97, 32, 109, 101, 116, 97, 100, 97, 
+    116, 97, 32, 100, 105, 99, 116, 32, 102, 111, 
+    114, 32, 116, 104, 101, 32, 115, 112, 101, 99, 
+    105, 102, 105, 101, 100, 10, 32, 32, 32, 32, 
+    32, 32, 32, 32, 112, 97, 116, 104, 32, 40, 
+    97, 32, 115, 116, 114, 41, 46, 10, 10, 32, 
+    32, 32, 32, 32, 32, 32, 32, 80, 111, 115, 
+    115, 105, 98, 108, 101, 32, 107, 101, 121, 115, 
+    58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+    45, 32, 39, 109, 116, 105, 109, 101, 39, 32, 
+    40, 109, 97, 110, 100, 97, 116, 111, 114, 121, 
+    41, 32, 105, 115, 32, 116, 104, 101, 32, 110, 
+    117, 109, 101, 114, 105, 99, 32, 116, 105, 109, 
+    101, 115, 116, 97, 109, 112, 32, 111, 102, 32, 
+    108, 97, 115, 116, 32, 115, 111, 117, 114, 99, 
+    101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+    32, 32, 99, 111, 100, 101, 32, 109, 111, 100, 
+    105, 102, 105, 99, 97, 116, 105, 111, 110, 59, 
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 45, 
+    32, 39, 115, 105, 122, 101, 39, 32, 40, 111, 
+    112, 116, 105, 111, 110, 97, 108, 41, 32, 105, 
+    115, 32, 116, 104, 101, 32, 115, 105, 122, 101, 
+    32, 105, 110, 32, 98, 121, 116, 101, 115, 32, 
+    111, 102, 32, 116, 104, 101, 32, 115, 111, 117, 
+    114, 99, 101, 32, 99, 111, 100, 101, 46, 10, 
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 73, 
+    109, 112, 108, 101, 109, 101, 110, 116, 105, 110, 
+    103, 32, 116, 104, 105, 115, 32, 109, 101, 116, 
+    104, 111, 100, 32, 97, 108, 108, 111, 119, 115, 
+    32, 116, 104, 101, 32, 108, 111, 97, 100, 101, 
+    114, 32, 116, 111, 32, 114, 101, 97, 100, 32, 
+    98, 121, 116, 101, 99, 111, 100, 101, 32, 102, 
+    105, 108, 101, 115, 46, 10, 32, 32, 32, 32, 
+    32, 32, 32, 32, 82, 97, 105, 115, 101, 115, 
+    32, 79, 83, 69, 114, 114, 111, 114, 32, 119, 
+    104, 101, 110, 32, 116, 104, 101, 32, 112, 97, 
+    116, 104, 32, 99, 97, 110, 110, 111, 116, 32, 
+    98, 101, 32, 104, 97, 110, 100, 108, 101, 100, 
+    46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+    5, 2, 5, 0, 0, 0, 0, 0, 0, 0, 
+    109, 116, 105, 109, 101, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 116, 104, 95, 115, 116, 97, 
+    116, 115, 1, 0, 0, 0, 0, 0, 0, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    116, 104, 95, 109, 116, 105, 109, 101, 0, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 115, 101, 108, 102, 4, 0, 0, 0, 
+    0, 0, 0, 0, 112, 97, 116, 104, 33, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    95, 112, 97, 116, 104, 95, 106, 111, 105, 110, 
+    46, 60, 108, 105, 115, 116, 99, 111, 109, 112, 
+    62, 46, 49, 50, 50, 58, 50, 57, 0, 22, 
+    0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 
+    32, 0, 0, 13, 2, 0, 17, 0, 0, 0, 
+    0, 9, 0, 2, 16, 0, 0, 0, 0, 0, 
+    0, 0, 45, 1, 0, 17, 0, 0, 0, 0, 
+    32, 3, 1, 79, 4, 3, 22, 3, 1, 0, 
+    0, 0, 17, 9, 0, 0, 0, 32, 3, 1, 
+    34, 4, 3, 1, 1, 32, 33, 5, 0, 74, 
+    0, 38, 4, 32, 1, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 
+    3, 0, 75, 0, 0, 58, 1, 3, 17, 0, 
+    0, 0, 0, 9, 0, 2, 0, 0, 0, 0, 
+    240, 255, 255, 255, 41, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 60, 108, 105, 115, 116, 99, 111, 
+    109, 112, 62, 2, 0, 0, 0, 0, 0, 0, 
+    0, 15, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 95, 115, 101, 112, 97, 114, 97, 
+    116, 111, 114, 115, 6, 0, 0, 0, 0, 0, 
+    0, 0, 114, 115, 116, 114, 105, 112, 0, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 46, 48, 4, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 114, 116, 33, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    37, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 95, 112, 
+    97, 99, 107, 95, 117, 105, 110, 116, 51, 50, 
+    46, 55, 51, 58, 48, 0, 13, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 33, 1, 0, 
+    32, 2, 0, 74, 2, 10, 1, 1, 0, 75, 
+    1, 0, 30, 3, 1, 0, 1, 0, 3, 9, 
+    34, 2, 1, 1, 1, 32, 30, 3, 2, 30, 
+    1, 3, 38, 2, 32, 2, 0, 0, 0, 0, 
+    0, 0, 0, 3, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 2, 42, 0, 0, 0, 0, 0, 
+    0, 0, 67, 111, 110, 118, 101, 114, 116, 32, 
+    97, 32, 51, 50, 45, 98, 105, 116, 32, 105, 
+    110, 116, 101, 103, 101, 114, 32, 116, 111, 32, 
+    108, 105, 116, 116, 108, 101, 45, 101, 110, 100, 
+    105, 97, 110, 46, 0, 255, 255, 255, 255, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 2, 6, 0, 0, 0, 0, 0, 0, 
+    0, 108, 105, 116, 116, 108, 101, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 4, 0, 0, 
-    0, 0, 0, 0, 0, 115, 105, 122, 101, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 5, 
-    0, 0, 0, 0, 0, 0, 0, 110, 101, 118, 
-    101, 114, 2, 6, 0, 0, 0, 0, 0, 0, 
-    0, 97, 108, 119, 97, 121, 115, 2, 13, 0, 
-    0, 0, 0, 0, 0, 0, 123, 125, 32, 109, 
-    97, 116, 99, 104, 101, 115, 32, 123, 125, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 
+    0, 0, 0, 0, 95, 112, 97, 99, 107, 95, 
+    117, 105, 110, 116, 51, 50, 2, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 105, 110, 116, 8, 0, 0, 0, 0, 
+    0, 0, 0, 116, 111, 95, 98, 121, 116, 101, 
+    115, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 120, 33, 0, 0, 0, 
+    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 
+    52, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 83, 111, 
+    117, 114, 99, 101, 70, 105, 108, 101, 76, 111, 
+    97, 100, 101, 114, 46, 115, 101, 116, 95, 100, 
+    97, 116, 97, 46, 49, 48, 56, 54, 58, 52, 
+    0, 124, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 33, 1, 0, 32, 2, 1, 74, 2, 
+    10, 1, 1, 0, 75, 1, 0, 50, 2, 0, 
+    0, 0, 0, 0, 0, 0, 3, 4, 0, 45, 
+    4, 3, 45, 5, 4, 3, 1, 0, 45, 6, 
+    1, 17, 0, 0, 0, 0, 32, 1, 4, 79, 
+    0, 1, 19, 1, 7, 0, 0, 0, 33, 2, 
+    1, 32, 3, 4, 74, 3, 10, 2, 1, 0, 
+    75, 1, 0, 49, 1, 0, 3, 17, 0, 0, 
+    0, 0, 79, 0, 1, 22, 1, 87, 0, 0, 
+    0, 33, 2, 2, 32, 1, 6, 74, 1, 10, 
+    2, 1, 0, 75, 1, 0, 13, 3, 0, 17, 
+    0, 0, 0, 0, 9, 0, 3, 46, 0, 0, 
+    0, 0, 0, 0, 0, 45, 7, 0, 17, 0, 
+    0, 0, 0, 33, 1, 3, 32, 2, 4, 32, 
+    4, 7, 74, 0, 74, 2, 74, 4, 10, 1, 
+    2, 0, 75, 1, 0, 75, 1, 0, 39, 5, 
+    0, 75, 0, 0, 45, 4, 5, 17, 21, 0, 
+    0, 0, 33, 1, 5, 21, 1, 2, 0, 0, 
+    0, 17, 0, 0, 0, 0, 17, 26, 0, 0, 
+    0, 33, 1, 6, 46, 7, 1, 21, 1, 13, 
+    0, 0, 0, 33, 2, 8, 34, 1, 2, 12, 
+    1, 32, 30, 4, 1, 32, 2, 4, 33, 5, 
+    7, 74, 0, 38, 1, 32, 3, 0, 0, 0, 
+    0, 0, 0, 0, 4, 2, 5, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 39, 6, 0, 75, 0, 0, 30, 
+    7, 2, 5, 17, 0, 0, 0, 0, 41, 7, 
+    52, 33, 1, 4, 34, 2, 1, 11, 1, 32, 
+    32, 4, 4, 74, 0, 38, 2, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 39, 1, 0, 75, 0, 0, 17, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 9, 
+    0, 3, 0, 0, 0, 0, 210, 255, 255, 255, 
+    17, 0, 0, 0, 0, 17, 12, 0, 0, 0, 
+    33, 0, 6, 46, 7, 0, 21, 0, 8, 0, 
+    0, 0, 33, 1, 8, 34, 2, 1, 12, 1, 
+    32, 30, 3, 1, 32, 1, 1, 33, 4, 7, 
+    38, 2, 32, 3, 0, 0, 0, 0, 0, 0, 
+    0, 3, 1, 4, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    5, 17, 18, 0, 0, 0, 52, 33, 1, 9, 
+    32, 2, 1, 32, 3, 2, 32, 4, 3, 74, 
+    2, 74, 3, 74, 4, 10, 1, 3, 0, 75, 
+    1, 0, 75, 1, 0, 75, 1, 0, 33, 5, 
+    8, 34, 1, 5, 12, 1, 32, 30, 2, 3, 
+    32, 3, 1, 38, 1, 32, 2, 0, 0, 0, 
+    0, 0, 0, 0, 2, 3, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 17, 0, 0, 0, 0, 30, 0, 2, 
+    41, 0, 33, 1, 0, 32, 2, 4, 74, 2, 
+    10, 1, 1, 0, 75, 1, 0, 50, 2, 0, 
+    0, 0, 0, 0, 0, 0, 3, 4, 0, 45, 
+    4, 3, 45, 7, 4, 32, 1, 6, 34, 2, 
+    1, 10, 1, 32, 32, 3, 7, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 17, 144, 255, 255, 255, 
+    4, 0, 0, 0, 0, 0, 0, 0, 46, 0, 
+    0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 
+    0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 
+    0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 
+    75, 0, 0, 0, 0, 0, 0, 0, 47, 0, 
+    0, 0, 0, 0, 0, 0, 79, 0, 0, 0, 
+    0, 0, 0, 0, 80, 0, 0, 0, 0, 0, 
+    0, 0, 80, 0, 0, 0, 0, 0, 0, 0, 
+    92, 0, 0, 0, 0, 0, 0, 0, 108, 0, 
+    0, 0, 0, 0, 0, 0, 80, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 2, 27, 0, 0, 
+    0, 0, 0, 0, 0, 87, 114, 105, 116, 101, 
+    32, 98, 121, 116, 101, 115, 32, 100, 97, 116, 
+    97, 32, 116, 111, 32, 97, 32, 102, 105, 108, 
+    101, 46, 2, 27, 0, 0, 0, 0, 0, 0, 
+    0, 99, 111, 117, 108, 100, 32, 110, 111, 116, 
+    32, 99, 114, 101, 97, 116, 101, 32, 123, 33, 
+    114, 125, 58, 32, 123, 33, 114, 125, 5, 2, 
+    12, 0, 0, 0, 0, 0, 0, 0, 99, 114, 
+    101, 97, 116, 101, 100, 32, 123, 33, 114, 125, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 0, 0, 0, 0, 0, 8, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 
+    95, 100, 97, 116, 97, 13, 0, 0, 0, 0, 
+    0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 115, 112, 108, 
+    105, 116, 11, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 95, 105, 115, 100, 105, 
+    114, 8, 0, 0, 0, 0, 0, 0, 0, 114, 
+    101, 118, 101, 114, 115, 101, 100, 10, 0, 0, 
+    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
+    95, 106, 111, 105, 110, 3, 0, 0, 0, 0, 
+    0, 0, 0, 95, 111, 115, 15, 0, 0, 0, 
+    0, 0, 0, 0, 70, 105, 108, 101, 69, 120, 
+    105, 115, 116, 115, 69, 114, 114, 111, 114, 7, 
+    0, 0, 0, 0, 0, 0, 0, 79, 83, 69, 
+    114, 114, 111, 114, 3, 0, 0, 0, 0, 0, 
+    0, 0, 101, 120, 99, 10, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 13, 0, 0, 0, 0, 0, 0, 
+    0, 95, 119, 114, 105, 116, 101, 95, 97, 116, 
+    111, 109, 105, 99, 6, 0, 0, 0, 0, 0, 
+    0, 0, 97, 112, 112, 101, 110, 100, 5, 0, 
+    0, 0, 0, 0, 0, 0, 109, 107, 100, 105, 
+    114, 16, 0, 0, 0, 0, 0, 0, 0, 95, 
+    118, 101, 114, 98, 111, 115, 101, 95, 109, 101, 
+    115, 115, 97, 103, 101, 0, 0, 0, 0, 0, 
+    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+    101, 108, 102, 4, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 116, 104, 4, 0, 0, 0, 0, 
+    0, 0, 0, 100, 97, 116, 97, 5, 0, 0, 
+    0, 0, 0, 0, 0, 95, 109, 111, 100, 101, 
+    6, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    114, 101, 110, 116, 8, 0, 0, 0, 0, 0, 
+    0, 0, 102, 105, 108, 101, 110, 97, 109, 101, 
+    10, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    116, 104, 95, 112, 97, 114, 116, 115, 4, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 114, 116, 
+    32, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 70, 105, 108, 101, 70, 105, 110, 100, 
+    101, 114, 46, 95, 95, 105, 110, 105, 116, 95, 
+    95, 46, 60, 103, 101, 110, 101, 120, 112, 114, 
+    62, 46, 49, 52, 56, 48, 58, 50, 54, 0, 
+    19, 0, 0, 0, 0, 0, 0, 0, 32, 0, 
+    0, 13, 1, 0, 17, 0, 0, 0, 0, 9, 
+    0, 1, 13, 0, 0, 0, 0, 0, 0, 0, 
+    45, 1, 0, 17, 0, 0, 0, 0, 32, 2, 
+    1, 31, 3, 0, 74, 2, 74, 3, 4, 4, 
+    2, 75, 1, 0, 75, 1, 0, 64, 4, 67, 
+    5, 17, 0, 0, 0, 0, 9, 0, 1, 0, 
+    0, 0, 0, 243, 255, 255, 255, 30, 2, 0, 
+    41, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
+    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
+    101, 114, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 
+    0, 0, 0, 0, 60, 103, 101, 110, 101, 120, 
+    112, 114, 62, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 46, 48, 6, 0, 0, 
+    0, 0, 0, 0, 0, 115, 117, 102, 102, 105, 
+    120, 32, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 70, 105, 108, 101, 76, 111, 97, 
+    100, 101, 114, 46, 95, 95, 105, 110, 105, 116, 
+    95, 95, 46, 49, 48, 48, 53, 58, 52, 0, 
+    9, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
+    0, 32, 1, 1, 32, 0, 0, 43, 0, 1, 
+    0, 32, 2, 2, 32, 0, 0, 43, 0, 2, 
+    1, 30, 1, 1, 41, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 2, 75, 0, 0, 
+    0, 0, 0, 0, 0, 67, 97, 99, 104, 101, 
+    32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 
+    101, 32, 110, 97, 109, 101, 32, 97, 110, 100, 
+    32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 
+    116, 111, 32, 116, 104, 101, 32, 102, 105, 108, 
+    101, 32, 102, 111, 117, 110, 100, 32, 98, 121, 
+    32, 116, 104, 101, 10, 32, 32, 32, 32, 32, 
+    32, 32, 32, 102, 105, 110, 100, 101, 114, 46, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    62, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
-    99, 111, 100, 101, 30, 0, 0, 0, 0, 0, 
-    0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 
-    99, 97, 99, 104, 101, 95, 102, 114, 111, 109, 
-    95, 115, 111, 117, 114, 99, 101, 19, 0, 0, 
-    0, 0, 0, 0, 0, 78, 111, 116, 73, 109, 
-    112, 108, 101, 109, 101, 110, 116, 101, 100, 69, 
-    114, 114, 111, 114, 7, 0, 0, 0, 0, 0, 
-    0, 0, 79, 83, 69, 114, 114, 111, 114, 3, 
-    0, 0, 0, 0, 0, 0, 0, 105, 110, 116, 
-    13, 0, 0, 0, 0, 0, 0, 0, 95, 99, 
-    108, 97, 115, 115, 105, 102, 121, 95, 112, 121, 
-    99, 10, 0, 0, 0, 0, 0, 0, 0, 109, 
-    101, 109, 111, 114, 121, 118, 105, 101, 119, 4, 
-    0, 0, 0, 0, 0, 0, 0, 95, 105, 109, 
-    112, 17, 0, 0, 0, 0, 0, 0, 0, 95, 
-    82, 65, 87, 95, 77, 65, 71, 73, 67, 95, 
-    78, 85, 77, 66, 69, 82, 18, 0, 0, 0, 
-    0, 0, 0, 0, 95, 118, 97, 108, 105, 100, 
-    97, 116, 101, 95, 104, 97, 115, 104, 95, 112, 
-    121, 99, 23, 0, 0, 0, 0, 0, 0, 0, 
-    95, 118, 97, 108, 105, 100, 97, 116, 101, 95, 
-    116, 105, 109, 101, 115, 116, 97, 109, 112, 95, 
-    112, 121, 99, 11, 0, 0, 0, 0, 0, 0, 
-    0, 73, 109, 112, 111, 114, 116, 69, 114, 114, 
-    111, 114, 8, 0, 0, 0, 0, 0, 0, 0, 
-    69, 79, 70, 69, 114, 114, 111, 114, 10, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 17, 0, 0, 0, 
-    0, 0, 0, 0, 95, 99, 111, 109, 112, 105, 
-    108, 101, 95, 98, 121, 116, 101, 99, 111, 100, 
-    101, 3, 0, 0, 0, 0, 0, 0, 0, 115, 
-    121, 115, 17, 0, 0, 0, 0, 0, 0, 0, 
-    95, 99, 111, 100, 101, 95, 116, 111, 95, 104, 
-    97, 115, 104, 95, 112, 121, 99, 22, 0, 0, 
-    0, 0, 0, 0, 0, 95, 99, 111, 100, 101, 
-    95, 116, 111, 95, 116, 105, 109, 101, 115, 116, 
-    97, 109, 112, 95, 112, 121, 99, 3, 0, 0, 
-    0, 0, 0, 0, 0, 108, 101, 110, 12, 0, 
-    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
-    102, 105, 108, 101, 110, 97, 109, 101, 10, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    95, 115, 116, 97, 116, 115, 8, 0, 0, 0, 
-    0, 0, 0, 0, 103, 101, 116, 95, 100, 97, 
-    116, 97, 11, 0, 0, 0, 0, 0, 0, 0, 
-    115, 111, 117, 114, 99, 101, 95, 104, 97, 115, 
-    104, 16, 0, 0, 0, 0, 0, 0, 0, 95, 
-    118, 101, 114, 98, 111, 115, 101, 95, 109, 101, 
-    115, 115, 97, 103, 101, 14, 0, 0, 0, 0, 
-    0, 0, 0, 115, 111, 117, 114, 99, 101, 95, 
-    116, 111, 95, 99, 111, 100, 101, 15, 0, 0, 
-    0, 0, 0, 0, 0, 95, 99, 97, 99, 104, 
-    101, 95, 98, 121, 116, 101, 99, 111, 100, 101, 
-    19, 0, 0, 0, 0, 0, 0, 0, 100, 111, 
-    110, 116, 95, 119, 114, 105, 116, 101, 95, 98, 
-    121, 116, 101, 99, 111, 100, 101, 21, 0, 0, 
-    0, 0, 0, 0, 0, 99, 104, 101, 99, 107, 
-    95, 104, 97, 115, 104, 95, 98, 97, 115, 101, 
-    100, 95, 112, 121, 99, 115, 4, 0, 0, 0, 
-    0, 0, 0, 0, 110, 97, 109, 101, 13, 0, 
-    0, 0, 0, 0, 0, 0, 98, 121, 116, 101, 
-    99, 111, 100, 101, 95, 112, 97, 116, 104, 11, 
-    0, 0, 0, 0, 0, 0, 0, 115, 111, 117, 
-    114, 99, 101, 95, 112, 97, 116, 104, 0, 0, 
-    0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    105, 110, 105, 116, 95, 95, 2, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 110, 97, 109, 101, 4, 0, 0, 0, 
+    0, 0, 0, 0, 112, 97, 116, 104, 0, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
     0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
     0, 0, 115, 101, 108, 102, 8, 0, 0, 0, 
     0, 0, 0, 0, 102, 117, 108, 108, 110, 97, 
-    109, 101, 11, 0, 0, 0, 0, 0, 0, 0, 
-    115, 111, 117, 114, 99, 101, 95, 112, 97, 116, 
-    104, 12, 0, 0, 0, 0, 0, 0, 0, 115, 
-    111, 117, 114, 99, 101, 95, 109, 116, 105, 109, 
-    101, 12, 0, 0, 0, 0, 0, 0, 0, 115, 
-    111, 117, 114, 99, 101, 95, 98, 121, 116, 101, 
-    115, 11, 0, 0, 0, 0, 0, 0, 0, 115, 
-    111, 117, 114, 99, 101, 95, 104, 97, 115, 104, 
-    10, 0, 0, 0, 0, 0, 0, 0, 104, 97, 
-    115, 104, 95, 98, 97, 115, 101, 100, 12, 0, 
-    0, 0, 0, 0, 0, 0, 99, 104, 101, 99, 
-    107, 95, 115, 111, 117, 114, 99, 101, 13, 0, 
-    0, 0, 0, 0, 0, 0, 98, 121, 116, 101, 
-    99, 111, 100, 101, 95, 112, 97, 116, 104, 2, 
-    0, 0, 0, 0, 0, 0, 0, 115, 116, 4, 
-    0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 
-    97, 11, 0, 0, 0, 0, 0, 0, 0, 101, 
-    120, 99, 95, 100, 101, 116, 97, 105, 108, 115, 
-    5, 0, 0, 0, 0, 0, 0, 0, 102, 108, 
-    97, 103, 115, 10, 0, 0, 0, 0, 0, 0, 
-    0, 98, 121, 116, 101, 115, 95, 100, 97, 116, 
-    97, 11, 0, 0, 0, 0, 0, 0, 0, 99, 
-    111, 100, 101, 95, 111, 98, 106, 101, 99, 116, 
-    32, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
-    0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 83, 111, 117, 114, 99, 101, 76, 111, 
-    97, 100, 101, 114, 46, 112, 97, 116, 104, 95, 
-    115, 116, 97, 116, 115, 46, 56, 54, 54, 58, 
-    52, 0, 15, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 30, 1, 1, 30, 2, 2, 32, 
-    0, 0, 34, 1, 0, 0, 32, 3, 1, 74, 
-    3, 10, 1, 1, 0, 75, 1, 172, 74, 2, 
-    74, 0, 2, 4, 1, 75, 1, 172, 75, 1, 
-    172, 41, 4, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 2, 158, 1, 0, 0, 
-    0, 0, 0, 0, 79, 112, 116, 105, 111, 110, 
-    97, 108, 32, 109, 101, 116, 104, 111, 100, 32, 
-    114, 101, 116, 117, 114, 110, 105, 110, 103, 32, 
-    97, 32, 109, 101, 116, 97, 100, 97, 116, 97, 
-    32, 100, 105, 99, 116, 32, 102, 111, 114, 32, 
-    116, 104, 101, 32, 115, 112, 101, 99, 105, 102, 
-    105, 101, 100, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 112, 97, 116, 104, 32, 40, 97, 32, 
-    115, 116, 114, 41, 46, 10, 10, 32, 32, 32, 
-    32, 32, 32, 32, 32, 80, 111, 115, 115, 105, 
-    98, 108, 101, 32, 107, 101, 121, 115, 58, 10, 
-    32, 32, 32, 32, 32, 32, 32, 32, 45, 32, 
-    39, 109, 116, 105, 109, 101, 39, 32, 40, 109, 
-    97, 110, 100, 97, 116, 111, 114, 121, 41, 32, 
-    105, 115, 32, 116, 104, 101, 32, 110, 117, 109, 
-    101, 114, 105, 99, 32, 116, 105, 109, 101, 115, 
-    116, 97, 109, 112, 32, 111, 102, 32, 108, 97, 
-    115, 116, 32, 115, 111, 117, 114, 99, 101, 10, 
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
-    99, 111, 100, 101, 32, 109, 111, 100, 105, 102, 
-    105, 99, 97, 116, 105, 111, 110, 59, 10, 32, 
-    32, 32, 32, 32, 32, 32, 32, 45, 32, 39, 
-    115, 105, 122, 101, 39, 32, 40, 111, 112, 116, 
-    105, 111, 110, 97, 108, 41, 32, 105, 115, 32, 
-    116, 104, 101, 32, 115, 105, 122, 101, 32, 105, 
-    110, 32, 98, 121, 116, 101, 115, 32, 111, 102, 
-    32, 116, 104, 101, 32, 115, 111, 117, 114, 99, 
-    101, 32, 99, 111, 100, 101, 46, 10, 10, 32, 
-    32, 32, 32, 32, 32, 32, 32, 73, 109, 112, 
-    108, 101, 109, 101, 110, 116, 105, 110, 103, 32, 
-    116, 104, 105, 115, 32, 109, 101, 116, 104, 111, 
-    100, 32, 97, 108, 108, 111, 119, 115, 32, 116, 
-    104, 101, 32, 108, 111, 97, 100, 101, 114, 32, 
-    116, 111, 32, 114, 101, 97, 100, 32, 98, 121, 
-    116, 101, 99, 111, 100, 101, 32, 102, 105, 108, 
-    101, 115, 46, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 82, 97, 105, 115, 101, 115, 32, 79, 
-    83, 69, 114, 114, 111, 114, 32, 119, 104, 101, 
-    110, 32, 116, 104, 101, 32, 112, 97, 116, 104, 
-    32, 99, 97, 110, 110, 111, 116, 32, 98, 101, 
-    32, 104, 97, 110, 100, 108, 101, 100, 46, 10, 
-    32, 32, 32, 32, 32, 32, 32, 32, 5, 2, 
-    5, 0, 0, 0, 0, 0, 0, 0, 109, 116, 
-    105, 109, 101, 0, 0, 0, 0, 0, 0, 0, 
+    109, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 33, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    6, 0, 0, 0, 0, 0, 0, 0, 35, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 95, 105, 110, 115, 
+    116, 97, 108, 108, 46, 49, 55, 49, 48, 58, 
+    48, 0, 32, 0, 0, 0, 0, 0, 0, 0, 
+    30, 0, 0, 33, 1, 0, 32, 2, 0, 74, 
+    2, 10, 1, 1, 0, 75, 1, 0, 33, 3, 
+    1, 10, 3, 0, 0, 45, 1, 0, 33, 2, 
+    2, 27, 0, 2, 8, 34, 1, 0, 5, 1, 
+    32, 33, 2, 3, 34, 3, 2, 6, 0, 0, 
+    32, 0, 1, 3, 2, 0, 24, 2, 0, 25, 
+    4, 2, 30, 0, 1, 2, 2, 0, 11, 3, 
+    4, 0, 1, 0, 74, 0, 3, 2, 1, 75, 
+    1, 0, 38, 1, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    33, 3, 2, 27, 0, 3, 9, 34, 1, 0, 
+    7, 1, 32, 33, 2, 4, 38, 1, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 30, 3, 1, 41, 3, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
-    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 95, 115, 116, 97, 116, 115, 
-    1, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    95, 109, 116, 105, 109, 101, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 4, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 116, 104, 32, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    48, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 95, 112, 
-    97, 116, 104, 95, 106, 111, 105, 110, 46, 60, 
-    108, 105, 115, 116, 99, 111, 109, 112, 62, 46, 
-    49, 50, 50, 58, 50, 57, 0, 24, 0, 0, 
-    0, 0, 0, 0, 0, 3, 1, 0, 32, 0, 
-    0, 13, 2, 0, 17, 0, 0, 0, 0, 9, 
-    0, 2, 18, 0, 0, 0, 0, 0, 0, 0, 
-    45, 1, 0, 17, 0, 0, 0, 0, 32, 3, 
-    1, 79, 4, 3, 22, 3, 1, 0, 0, 0, 
-    17, 11, 0, 0, 0, 32, 3, 1, 34, 4, 
-    3, 1, 33, 5, 0, 74, 0, 74, 5, 10, 
-    4, 1, 0, 75, 1, 24, 39, 3, 0, 75, 
-    0, 0, 58, 1, 3, 17, 0, 0, 0, 0, 
-    9, 0, 2, 0, 0, 0, 0, 238, 255, 255, 
-    255, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    41, 0, 0, 0, 0, 0, 0, 0, 73, 110, 
+    115, 116, 97, 108, 108, 32, 116, 104, 101, 32, 
+    112, 97, 116, 104, 45, 98, 97, 115, 101, 100, 
+    32, 105, 109, 112, 111, 114, 116, 32, 99, 111, 
+    109, 112, 111, 110, 101, 110, 116, 115, 46, 5, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 
-    0, 0, 60, 108, 105, 115, 116, 99, 111, 109, 
-    112, 62, 2, 0, 0, 0, 0, 0, 0, 0, 
-    15, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 95, 115, 101, 112, 97, 114, 97, 116, 
-    111, 114, 115, 6, 0, 0, 0, 0, 0, 0, 
-    0, 114, 115, 116, 114, 105, 112, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 8, 
+    0, 0, 0, 0, 0, 0, 0, 95, 105, 110, 
+    115, 116, 97, 108, 108, 10, 0, 0, 0, 0, 
+    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
+    0, 95, 115, 101, 116, 117, 112, 27, 0, 0, 
+    0, 0, 0, 0, 0, 95, 103, 101, 116, 95, 
+    115, 117, 112, 112, 111, 114, 116, 101, 100, 95, 
+    102, 105, 108, 101, 95, 108, 111, 97, 100, 101, 
+    114, 115, 3, 0, 0, 0, 0, 0, 0, 0, 
+    115, 121, 115, 10, 0, 0, 0, 0, 0, 0, 
+    0, 70, 105, 108, 101, 70, 105, 110, 100, 101, 
+    114, 10, 0, 0, 0, 0, 0, 0, 0, 80, 
+    97, 116, 104, 70, 105, 110, 100, 101, 114, 6, 
+    0, 0, 0, 0, 0, 0, 0, 101, 120, 116, 
+    101, 110, 100, 9, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 116, 104, 95, 104, 111, 111, 107, 
+    6, 0, 0, 0, 0, 0, 0, 0, 97, 112, 
+    112, 101, 110, 100, 10, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 116, 104, 95, 104, 111, 111, 
+    107, 115, 9, 0, 0, 0, 0, 0, 0, 0, 
+    109, 101, 116, 97, 95, 112, 97, 116, 104, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 109, 111, 100, 117, 108, 101, 
+    17, 0, 0, 0, 0, 0, 0, 0, 115, 117, 
+    112, 112, 111, 114, 116, 101, 100, 95, 108, 111, 
+    97, 100, 101, 114, 115, 32, 0, 0, 0, 0, 
     0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 46, 48, 4, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 114, 116, 32, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 37, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 68, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
     111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 95, 112, 97, 
-    99, 107, 95, 117, 105, 110, 116, 51, 50, 46, 
-    55, 51, 58, 48, 0, 17, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 33, 1, 0, 32, 
-    2, 0, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 30, 3, 1, 0, 1, 0, 3, 9, 34, 
-    2, 1, 1, 30, 3, 2, 30, 1, 3, 74, 
-    3, 74, 1, 10, 2, 2, 0, 75, 1, 173, 
-    75, 1, 0, 41, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 2, 42, 0, 
-    0, 0, 0, 0, 0, 0, 67, 111, 110, 118, 
-    101, 114, 116, 32, 97, 32, 51, 50, 45, 98, 
-    105, 116, 32, 105, 110, 116, 101, 103, 101, 114, 
-    32, 116, 111, 32, 108, 105, 116, 116, 108, 101, 
-    45, 101, 110, 100, 105, 97, 110, 46, 0, 255, 
-    255, 255, 255, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 2, 6, 0, 0, 
-    0, 0, 0, 0, 0, 108, 105, 116, 116, 108, 
-    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    116, 101, 114, 110, 97, 108, 46, 69, 120, 116, 
+    101, 110, 115, 105, 111, 110, 70, 105, 108, 101, 
+    76, 111, 97, 100, 101, 114, 46, 105, 115, 95, 
+    112, 97, 99, 107, 97, 103, 101, 46, 60, 103, 
+    101, 110, 101, 120, 112, 114, 62, 46, 49, 49, 
+    56, 55, 58, 49, 56, 0, 17, 0, 0, 0, 
+    0, 0, 0, 0, 32, 0, 0, 13, 1, 0, 
+    17, 0, 0, 0, 0, 9, 0, 1, 11, 0, 
+    0, 0, 0, 0, 0, 0, 45, 1, 0, 17, 
+    0, 0, 0, 0, 31, 2, 0, 30, 3, 0, 
+    32, 4, 1, 0, 5, 3, 4, 0, 6, 6, 
+    2, 5, 0, 64, 6, 67, 3, 17, 0, 0, 
+    0, 0, 9, 0, 1, 0, 0, 0, 0, 245, 
+    255, 255, 255, 30, 2, 1, 41, 2, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 2, 8, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 
+    110, 105, 116, 95, 95, 5, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    12, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
-    97, 99, 107, 95, 117, 105, 110, 116, 51, 50, 
-    2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 105, 110, 116, 8, 
-    0, 0, 0, 0, 0, 0, 0, 116, 111, 95, 
-    98, 121, 116, 101, 115, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 120, 
-    32, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 
-    0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 83, 111, 117, 114, 99, 101, 70, 105, 
-    108, 101, 76, 111, 97, 100, 101, 114, 46, 115, 
-    101, 116, 95, 100, 97, 116, 97, 46, 49, 48, 
-    56, 54, 58, 52, 0, 148, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 33, 1, 0, 32, 
-    2, 1, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 50, 2, 0, 0, 0, 0, 0, 0, 0, 
-    3, 4, 0, 45, 4, 3, 45, 5, 4, 3, 
-    1, 0, 45, 6, 1, 17, 0, 0, 0, 0, 
-    32, 1, 4, 79, 0, 1, 19, 1, 7, 0, 
-    0, 0, 33, 2, 1, 32, 3, 4, 74, 3, 
-    10, 2, 1, 0, 75, 1, 0, 49, 1, 0, 
-    3, 17, 0, 0, 0, 0, 79, 0, 1, 22, 
-    1, 109, 0, 0, 0, 33, 2, 2, 32, 1, 
-    6, 74, 1, 10, 2, 1, 0, 75, 1, 0, 
-    13, 3, 0, 17, 0, 0, 0, 0, 9, 0, 
-    3, 56, 0, 0, 0, 0, 0, 0, 0, 45, 
-    7, 0, 17, 0, 0, 0, 0, 33, 1, 3, 
-    32, 2, 4, 32, 4, 7, 74, 0, 74, 2, 
-    74, 4, 10, 1, 2, 0, 75, 1, 0, 75, 
-    1, 0, 39, 5, 0, 75, 0, 0, 45, 4, 
-    5, 42, 1, 0, 0, 0, 17, 27, 0, 0, 
-    0, 33, 1, 5, 21, 1, 2, 0, 0, 0, 
-    17, 0, 0, 0, 0, 17, 35, 0, 0, 0, 
-    33, 1, 6, 46, 7, 1, 21, 1, 19, 0, 
-    0, 0, 33, 2, 8, 34, 1, 2, 12, 30, 
-    4, 1, 32, 2, 4, 33, 5, 7, 74, 0, 
-    74, 4, 74, 2, 74, 5, 10, 1, 3, 0, 
-    75, 1, 0, 75, 1, 0, 75, 1, 0, 39, 
-    6, 0, 75, 0, 0, 30, 7, 2, 5, 17, 
-    0, 0, 0, 0, 41, 7, 52, 33, 1, 4, 
-    34, 2, 1, 11, 32, 4, 4, 74, 0, 74, 
-    4, 10, 2, 1, 0, 75, 1, 0, 39, 1, 
-    0, 75, 0, 0, 54, 17, 0, 0, 0, 0, 
-    17, 0, 0, 0, 0, 9, 0, 3, 0, 0, 
-    0, 0, 200, 255, 255, 255, 17, 0, 0, 0, 
-    0, 42, 1, 0, 0, 0, 17, 18, 0, 0, 
-    0, 33, 0, 6, 46, 7, 0, 21, 0, 14, 
-    0, 0, 0, 33, 1, 8, 34, 2, 1, 12, 
-    30, 3, 1, 32, 1, 1, 33, 4, 7, 74, 
-    3, 74, 1, 74, 4, 10, 2, 3, 0, 75, 
-    1, 0, 75, 1, 0, 75, 1, 0, 5, 17, 
-    23, 0, 0, 0, 52, 33, 1, 9, 32, 2, 
-    1, 32, 3, 2, 32, 4, 3, 74, 2, 74, 
-    3, 74, 4, 10, 1, 3, 0, 75, 1, 0, 
-    75, 1, 0, 75, 1, 0, 33, 5, 8, 34, 
-    1, 5, 12, 30, 2, 3, 32, 3, 1, 74, 
-    2, 74, 3, 10, 1, 2, 0, 75, 1, 0, 
-    75, 1, 0, 54, 17, 0, 0, 0, 0, 30, 
-    0, 2, 41, 0, 33, 1, 0, 32, 2, 4, 
-    74, 2, 10, 1, 1, 0, 75, 1, 0, 50, 
+    0, 0, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
+    105, 108, 101, 95, 110, 97, 109, 101, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
+    60, 103, 101, 110, 101, 120, 112, 114, 62, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 46, 48, 6, 0, 0, 0, 0, 0, 0, 
+    0, 115, 117, 102, 102, 105, 120, 33, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
+    0, 54, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
+    78, 97, 109, 101, 115, 112, 97, 99, 101, 80, 
+    97, 116, 104, 46, 95, 114, 101, 99, 97, 108, 
+    99, 117, 108, 97, 116, 101, 46, 49, 50, 51, 
+    54, 58, 52, 0, 65, 0, 0, 0, 0, 0, 
+    0, 0, 33, 1, 0, 32, 2, 0, 34, 3, 
+    2, 1, 1, 32, 38, 3, 32, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 74, 0, 74, 0, 10, 1, 1, 0, 75, 
+    1, 0, 39, 2, 0, 75, 0, 0, 45, 1, 
+    2, 32, 0, 1, 32, 1, 0, 27, 2, 1, 
+    4, 6, 3, 0, 2, 1, 79, 1, 3, 22, 
+    3, 6, 0, 0, 0, 32, 0, 0, 27, 1, 
+    0, 6, 32, 2, 0, 27, 0, 2, 5, 6, 
+    3, 1, 0, 1, 17, 0, 0, 0, 0, 79, 
+    0, 3, 19, 3, 37, 0, 0, 0, 32, 0, 
+    0, 34, 1, 0, 2, 1, 32, 32, 2, 0, 
+    27, 3, 2, 7, 32, 4, 1, 38, 1, 32, 
     2, 0, 0, 0, 0, 0, 0, 0, 3, 4, 
-    0, 45, 4, 3, 45, 7, 4, 32, 1, 6, 
-    34, 2, 1, 10, 32, 3, 7, 74, 3, 10, 
-    2, 1, 0, 75, 1, 25, 17, 120, 255, 255, 
-    255, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 2, 27, 0, 0, 0, 0, 0, 
-    0, 0, 87, 114, 105, 116, 101, 32, 98, 121, 
-    116, 101, 115, 32, 100, 97, 116, 97, 32, 116, 
-    111, 32, 97, 32, 102, 105, 108, 101, 46, 2, 
-    27, 0, 0, 0, 0, 0, 0, 0, 99, 111, 
-    117, 108, 100, 32, 110, 111, 116, 32, 99, 114, 
-    101, 97, 116, 101, 32, 123, 33, 114, 125, 58, 
-    32, 123, 33, 114, 125, 5, 2, 12, 0, 0, 
-    0, 0, 0, 0, 0, 99, 114, 101, 97, 116, 
-    101, 100, 32, 123, 33, 114, 125, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 45, 2, 0, 32, 
+    1, 2, 30, 0, 0, 6, 2, 1, 0, 7, 
+    79, 3, 2, 19, 2, 5, 0, 0, 0, 32, 
+    0, 2, 27, 1, 0, 8, 30, 3, 0, 6, 
+    2, 1, 3, 6, 17, 0, 0, 0, 0, 79, 
+    0, 2, 19, 2, 10, 0, 0, 0, 32, 0, 
+    2, 27, 1, 0, 9, 79, 2, 1, 19, 1, 
+    5, 0, 0, 0, 32, 0, 2, 27, 1, 0, 
+    9, 32, 2, 0, 43, 2, 1, 3, 17, 0, 
+    0, 0, 0, 17, 0, 0, 0, 0, 32, 0, 
+    1, 32, 1, 0, 43, 1, 0, 4, 32, 2, 
+    0, 27, 0, 2, 6, 32, 1, 0, 43, 1, 
+    0, 5, 17, 0, 0, 0, 0, 32, 0, 0, 
+    27, 1, 0, 3, 41, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
-    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
-    0, 0, 0, 0, 115, 101, 116, 95, 100, 97, 
-    116, 97, 13, 0, 0, 0, 0, 0, 0, 0, 
-    11, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
-    97, 116, 104, 95, 115, 112, 108, 105, 116, 11, 
-    0, 0, 0, 0, 0, 0, 0, 95, 112, 97, 
-    116, 104, 95, 105, 115, 100, 105, 114, 8, 0, 
-    0, 0, 0, 0, 0, 0, 114, 101, 118, 101, 
-    114, 115, 101, 100, 10, 0, 0, 0, 0, 0, 
-    0, 0, 95, 112, 97, 116, 104, 95, 106, 111, 
-    105, 110, 3, 0, 0, 0, 0, 0, 0, 0, 
-    95, 111, 115, 15, 0, 0, 0, 0, 0, 0, 
-    0, 70, 105, 108, 101, 69, 120, 105, 115, 116, 
-    115, 69, 114, 114, 111, 114, 7, 0, 0, 0, 
-    0, 0, 0, 0, 79, 83, 69, 114, 114, 111, 
-    114, 3, 0, 0, 0, 0, 0, 0, 0, 101, 
-    120, 99, 10, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    13, 0, 0, 0, 0, 0, 0, 0, 95, 119, 
-    114, 105, 116, 101, 95, 97, 116, 111, 109, 105, 
-    99, 6, 0, 0, 0, 0, 0, 0, 0, 97, 
-    112, 112, 101, 110, 100, 5, 0, 0, 0, 0, 
-    0, 0, 0, 109, 107, 100, 105, 114, 16, 0, 
-    0, 0, 0, 0, 0, 0, 95, 118, 101, 114, 
-    98, 111, 115, 101, 95, 109, 101, 115, 115, 97, 
-    103, 101, 0, 0, 0, 0, 0, 0, 0, 0, 
-    8, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 115, 101, 108, 102, 
-    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 4, 0, 0, 0, 0, 0, 0, 0, 
-    100, 97, 116, 97, 5, 0, 0, 0, 0, 0, 
-    0, 0, 95, 109, 111, 100, 101, 6, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 114, 101, 110, 
-    116, 8, 0, 0, 0, 0, 0, 0, 0, 102, 
-    105, 108, 101, 110, 97, 109, 101, 10, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 95, 
-    112, 97, 114, 116, 115, 4, 0, 0, 0, 0, 
-    0, 0, 0, 112, 97, 114, 116, 32, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 57, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 70, 
-    105, 108, 101, 70, 105, 110, 100, 101, 114, 46, 
-    95, 95, 105, 110, 105, 116, 95, 95, 46, 60, 
-    103, 101, 110, 101, 120, 112, 114, 62, 46, 49, 
-    52, 56, 48, 58, 50, 54, 0, 19, 0, 0, 
-    0, 0, 0, 0, 0, 32, 0, 0, 13, 1, 
-    0, 17, 0, 0, 0, 0, 9, 0, 1, 13, 
-    0, 0, 0, 0, 0, 0, 0, 45, 1, 0, 
-    17, 0, 0, 0, 0, 32, 2, 1, 31, 3, 
-    0, 74, 2, 74, 3, 4, 4, 2, 75, 1, 
-    0, 75, 1, 0, 64, 4, 67, 5, 17, 0, 
-    0, 0, 0, 9, 0, 1, 0, 0, 0, 0, 
-    243, 255, 255, 255, 30, 2, 0, 41, 2, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 32, 1, 
-    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
-    0, 0, 0, 0, 0, 108, 111, 97, 100, 101, 
-    114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 
-    0, 0, 0, 60, 103, 101, 110, 101, 120, 112, 
-    114, 62, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 
+    0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 
+    0, 0, 0, 0, 95, 114, 101, 99, 97, 108, 
+    99, 117, 108, 97, 116, 101, 10, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 116, 117, 112, 108, 101, 16, 0, 0, 
+    0, 0, 0, 0, 0, 95, 103, 101, 116, 95, 
+    112, 97, 114, 101, 110, 116, 95, 112, 97, 116, 
+    104, 12, 0, 0, 0, 0, 0, 0, 0, 95, 
+    112, 97, 116, 104, 95, 102, 105, 110, 100, 101, 
+    114, 5, 0, 0, 0, 0, 0, 0, 0, 95, 
+    112, 97, 116, 104, 17, 0, 0, 0, 0, 0, 
+    0, 0, 95, 108, 97, 115, 116, 95, 112, 97, 
+    114, 101, 110, 116, 95, 112, 97, 116, 104, 11, 
+    0, 0, 0, 0, 0, 0, 0, 95, 108, 97, 
+    115, 116, 95, 101, 112, 111, 99, 104, 6, 0, 
+    0, 0, 0, 0, 0, 0, 95, 101, 112, 111, 
+    99, 104, 5, 0, 0, 0, 0, 0, 0, 0, 
+    95, 110, 97, 109, 101, 6, 0, 0, 0, 0, 
+    0, 0, 0, 108, 111, 97, 100, 101, 114, 26, 
+    0, 0, 0, 0, 0, 0, 0, 115, 117, 98, 
+    109, 111, 100, 117, 108, 101, 95, 115, 101, 97, 
+    114, 99, 104, 95, 108, 111, 99, 97, 116, 105, 
+    111, 110, 115, 0, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 11, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 114, 101, 110, 116, 95, 112, 97, 116, 104, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 112, 
+    101, 99, 33, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 95, 78, 97, 109, 101, 115, 
+    112, 97, 99, 101, 80, 97, 116, 104, 46, 97, 
+    112, 112, 101, 110, 100, 46, 49, 50, 54, 56, 
+    58, 52, 0, 7, 0, 0, 0, 0, 0, 0, 
+    0, 32, 0, 0, 27, 1, 0, 1, 34, 2, 
+    1, 0, 1, 32, 32, 3, 1, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 30, 1, 0, 41, 1, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 46, 48, 6, 0, 0, 0, 
-    0, 0, 0, 0, 115, 117, 102, 102, 105, 120, 
-    32, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 70, 105, 108, 101, 76, 111, 97, 100, 
-    101, 114, 46, 95, 95, 105, 110, 105, 116, 95, 
-    95, 46, 49, 48, 48, 53, 58, 52, 0, 9, 
-    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
-    32, 1, 1, 32, 0, 0, 43, 0, 1, 0, 
-    32, 2, 2, 32, 0, 0, 43, 0, 2, 1, 
-    30, 1, 1, 41, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 75, 0, 
-    0, 0, 0, 0, 0, 0, 67, 97, 99, 104, 
-    101, 32, 116, 104, 101, 32, 109, 111, 100, 117, 
-    108, 101, 32, 110, 97, 109, 101, 32, 97, 110, 
-    100, 32, 116, 104, 101, 32, 112, 97, 116, 104, 
-    32, 116, 111, 32, 116, 104, 101, 32, 102, 105, 
-    108, 101, 32, 102, 111, 117, 110, 100, 32, 98, 
-    121, 32, 116, 104, 101, 10, 32, 32, 32, 32, 
-    32, 32, 32, 32, 102, 105, 110, 100, 101, 114, 
-    46, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 105, 110, 105, 116, 95, 95, 2, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    6, 0, 0, 0, 0, 0, 0, 0, 97, 112, 
+    112, 101, 110, 100, 2, 0, 0, 0, 0, 0, 
+    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
+    97, 112, 112, 101, 110, 100, 5, 0, 0, 0, 
+    0, 0, 0, 0, 95, 112, 97, 116, 104, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 110, 97, 109, 101, 4, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 0, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 115, 101, 108, 102, 4, 0, 0, 
+    0, 0, 0, 0, 0, 105, 116, 101, 109, 32, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 115, 101, 108, 102, 8, 0, 0, 
-    0, 0, 0, 0, 0, 102, 117, 108, 108, 110, 
-    97, 109, 101, 4, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 32, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 6, 0, 0, 0, 0, 0, 0, 0, 35, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 95, 105, 110, 
-    115, 116, 97, 108, 108, 46, 49, 55, 49, 48, 
-    58, 48, 0, 36, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 33, 1, 0, 32, 2, 0, 
-    74, 2, 10, 1, 1, 0, 75, 1, 0, 33, 
-    3, 1, 10, 3, 0, 0, 45, 1, 0, 33, 
-    2, 2, 27, 0, 2, 8, 34, 1, 0, 5, 
-    33, 2, 3, 34, 3, 2, 6, 32, 0, 1, 
-    3, 2, 0, 24, 2, 0, 25, 4, 2, 30, 
-    0, 1, 2, 2, 0, 11, 3, 4, 0, 1, 
-    0, 74, 0, 3, 2, 1, 75, 1, 0, 74, 
-    2, 10, 1, 1, 0, 75, 1, 0, 33, 3, 
-    2, 27, 0, 3, 9, 34, 1, 0, 7, 33, 
-    2, 4, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 30, 3, 1, 41, 3, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 95, 115, 101, 116, 117, 112, 46, 60, 115, 
+    101, 116, 99, 111, 109, 112, 62, 46, 49, 54, 
+    56, 56, 58, 52, 57, 0, 19, 0, 0, 0, 
+    0, 0, 0, 0, 60, 0, 0, 32, 1, 0, 
+    13, 2, 1, 17, 0, 0, 0, 0, 9, 1, 
+    2, 13, 0, 0, 0, 0, 0, 0, 0, 45, 
+    1, 1, 17, 0, 0, 0, 0, 30, 3, 0, 
+    32, 4, 1, 73, 5, 4, 0, 74, 3, 74, 
+    5, 72, 6, 2, 75, 1, 94, 75, 1, 173, 
+    59, 0, 6, 17, 0, 0, 0, 0, 9, 1, 
+    2, 0, 0, 0, 0, 243, 255, 255, 255, 41, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 41, 
-    0, 0, 0, 0, 0, 0, 0, 73, 110, 115, 
-    116, 97, 108, 108, 32, 116, 104, 101, 32, 112, 
-    97, 116, 104, 45, 98, 97, 115, 101, 100, 32, 
-    105, 109, 112, 111, 114, 116, 32, 99, 111, 109, 
-    112, 111, 110, 101, 110, 116, 115, 46, 5, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 
+    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 105, 110, 115, 
-    116, 97, 108, 108, 10, 0, 0, 0, 0, 0, 
-    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
-    95, 115, 101, 116, 117, 112, 27, 0, 0, 0, 
-    0, 0, 0, 0, 95, 103, 101, 116, 95, 115, 
-    117, 112, 112, 111, 114, 116, 101, 100, 95, 102, 
-    105, 108, 101, 95, 108, 111, 97, 100, 101, 114, 
-    115, 3, 0, 0, 0, 0, 0, 0, 0, 115, 
-    121, 115, 10, 0, 0, 0, 0, 0, 0, 0, 
-    70, 105, 108, 101, 70, 105, 110, 100, 101, 114, 
-    10, 0, 0, 0, 0, 0, 0, 0, 80, 97, 
-    116, 104, 70, 105, 110, 100, 101, 114, 6, 0, 
-    0, 0, 0, 0, 0, 0, 101, 120, 116, 101, 
-    110, 100, 9, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 95, 104, 111, 111, 107, 6, 
-    0, 0, 0, 0, 0, 0, 0, 97, 112, 112, 
-    101, 110, 100, 10, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 95, 104, 111, 111, 107, 
-    115, 9, 0, 0, 0, 0, 0, 0, 0, 109, 
-    101, 116, 97, 95, 112, 97, 116, 104, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    9, 0, 0, 0, 0, 0, 0, 0, 60, 115, 
+    101, 116, 99, 111, 109, 112, 62, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 46, 
+    48, 1, 0, 0, 0, 0, 0, 0, 0, 115, 
+    33, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 
     0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 109, 111, 100, 117, 108, 101, 17, 
-    0, 0, 0, 0, 0, 0, 0, 115, 117, 112, 
-    112, 111, 114, 116, 101, 100, 95, 108, 111, 97, 
-    100, 101, 114, 115, 32, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 68, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 69, 120, 116, 101, 
-    110, 115, 105, 111, 110, 70, 105, 108, 101, 76, 
-    111, 97, 100, 101, 114, 46, 105, 115, 95, 112, 
-    97, 99, 107, 97, 103, 101, 46, 60, 103, 101, 
-    110, 101, 120, 112, 114, 62, 46, 49, 49, 56, 
-    55, 58, 49, 56, 0, 17, 0, 0, 0, 0, 
-    0, 0, 0, 32, 0, 0, 13, 1, 0, 17, 
-    0, 0, 0, 0, 9, 0, 1, 11, 0, 0, 
-    0, 0, 0, 0, 0, 45, 1, 0, 17, 0, 
-    0, 0, 0, 31, 2, 0, 30, 3, 0, 32, 
-    4, 1, 0, 5, 3, 4, 0, 6, 6, 2, 
-    5, 0, 64, 6, 67, 3, 17, 0, 0, 0, 
-    0, 9, 0, 1, 0, 0, 0, 0, 245, 255, 
-    255, 255, 30, 2, 1, 41, 2, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 95, 112, 97, 116, 104, 95, 115, 112, 
+    108, 105, 116, 46, 60, 103, 101, 110, 101, 120, 
+    112, 114, 62, 46, 49, 50, 56, 58, 49, 49, 
+    0, 19, 0, 0, 0, 0, 0, 0, 0, 32, 
+    0, 0, 13, 1, 0, 17, 0, 0, 0, 0, 
+    9, 0, 1, 13, 0, 0, 0, 0, 0, 0, 
+    0, 45, 1, 0, 17, 0, 0, 0, 0, 31, 
+    2, 0, 34, 3, 2, 0, 1, 32, 32, 4, 
+    1, 74, 0, 38, 3, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
-    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    105, 110, 105, 116, 95, 95, 5, 0, 0, 0, 
+    0, 39, 2, 0, 75, 0, 0, 64, 2, 67, 
+    5, 17, 0, 0, 0, 0, 9, 0, 1, 0, 
+    0, 0, 0, 243, 255, 255, 255, 30, 2, 0, 
+    41, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 32, 1, 0, 0, 0, 0, 0, 
-    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 108, 101, 95, 110, 97, 109, 101, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
+    0, 0, 60, 103, 101, 110, 101, 120, 112, 114, 
+    62, 1, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 114, 102, 105, 
+    110, 100, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 46, 48, 1, 0, 
+    0, 0, 0, 0, 0, 0, 112, 32, 0, 0, 
     0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
-    0, 60, 103, 101, 110, 101, 120, 112, 114, 62, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 44, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 70, 
+    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
+    95, 95, 101, 113, 95, 95, 46, 49, 48, 49, 
+    49, 58, 52, 0, 14, 0, 0, 0, 0, 0, 
+    0, 0, 32, 0, 0, 27, 1, 0, 0, 32, 
+    2, 1, 27, 0, 2, 0, 6, 3, 1, 0, 
+    0, 79, 2, 3, 19, 3, 6, 0, 0, 0, 
+    32, 0, 0, 27, 1, 0, 1, 32, 2, 1, 
+    27, 0, 2, 1, 6, 3, 1, 0, 0, 17, 
+    0, 0, 0, 0, 41, 3, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 46, 48, 6, 0, 0, 0, 0, 0, 
-    0, 0, 115, 117, 102, 102, 105, 120, 32, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
-    0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
-    80, 97, 116, 104, 46, 95, 114, 101, 99, 97, 
-    108, 99, 117, 108, 97, 116, 101, 46, 49, 50, 
-    51, 54, 58, 52, 0, 69, 0, 0, 0, 0, 
-    0, 0, 0, 33, 1, 0, 32, 2, 0, 34, 
-    3, 2, 1, 10, 3, 0, 0, 74, 0, 74, 
-    0, 10, 1, 1, 0, 75, 1, 0, 39, 2, 
-    0, 75, 0, 0, 45, 1, 2, 32, 0, 1, 
-    32, 1, 0, 27, 2, 1, 4, 6, 3, 0, 
-    2, 1, 79, 1, 3, 22, 3, 6, 0, 0, 
-    0, 32, 0, 0, 27, 1, 0, 6, 32, 2, 
-    0, 27, 0, 2, 5, 6, 3, 1, 0, 1, 
-    17, 0, 0, 0, 0, 79, 0, 3, 19, 3, 
-    41, 0, 0, 0, 32, 0, 0, 34, 1, 0, 
-    2, 32, 2, 0, 27, 3, 2, 7, 32, 4, 
-    1, 74, 3, 74, 4, 10, 1, 2, 0, 75, 
-    1, 172, 75, 1, 80, 45, 2, 0, 32, 1, 
-    2, 30, 0, 0, 6, 2, 1, 0, 7, 79, 
-    3, 2, 19, 2, 5, 0, 0, 0, 32, 0, 
-    2, 27, 1, 0, 8, 30, 3, 0, 6, 2, 
-    1, 3, 6, 17, 0, 0, 0, 0, 79, 0, 
-    2, 19, 2, 10, 0, 0, 0, 32, 0, 2, 
-    27, 1, 0, 9, 79, 2, 1, 19, 1, 5, 
-    0, 0, 0, 32, 0, 2, 27, 1, 0, 9, 
-    32, 2, 0, 43, 2, 1, 3, 17, 0, 0, 
-    0, 0, 17, 0, 0, 0, 0, 32, 0, 1, 
-    32, 1, 0, 43, 1, 0, 4, 32, 2, 0, 
-    27, 0, 2, 6, 32, 1, 0, 43, 1, 0, 
-    5, 17, 0, 0, 0, 0, 32, 0, 0, 27, 
-    1, 0, 3, 41, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 
-    0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 
-    0, 0, 0, 0, 0, 95, 114, 101, 99, 97, 
-    108, 99, 117, 108, 97, 116, 101, 10, 0, 0, 
-    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
-    0, 0, 0, 116, 117, 112, 108, 101, 16, 0, 
-    0, 0, 0, 0, 0, 0, 95, 103, 101, 116, 
-    95, 112, 97, 114, 101, 110, 116, 95, 112, 97, 
-    116, 104, 12, 0, 0, 0, 0, 0, 0, 0, 
-    95, 112, 97, 116, 104, 95, 102, 105, 110, 100, 
-    101, 114, 5, 0, 0, 0, 0, 0, 0, 0, 
-    95, 112, 97, 116, 104, 17, 0, 0, 0, 0, 
-    0, 0, 0, 95, 108, 97, 115, 116, 95, 112, 
-    97, 114, 101, 110, 116, 95, 112, 97, 116, 104, 
-    11, 0, 0, 0, 0, 0, 0, 0, 95, 108, 
-    97, 115, 116, 95, 101, 112, 111, 99, 104, 6, 
-    0, 0, 0, 0, 0, 0, 0, 95, 101, 112, 
-    111, 99, 104, 5, 0, 0, 0, 0, 0, 0, 
-    0, 95, 110, 97, 109, 101, 6, 0, 0, 0, 
-    0, 0, 0, 0, 108, 111, 97, 100, 101, 114, 
-    26, 0, 0, 0, 0, 0, 0, 0, 115, 117, 
-    98, 109, 111, 100, 117, 108, 101, 95, 115, 101, 
-    97, 114, 99, 104, 95, 108, 111, 99, 97, 116, 
-    105, 111, 110, 115, 0, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
-    108, 102, 11, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 114, 101, 110, 116, 95, 112, 97, 116, 
-    104, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    112, 101, 99, 32, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
-    115, 112, 97, 99, 101, 80, 97, 116, 104, 46, 
-    97, 112, 112, 101, 110, 100, 46, 49, 50, 54, 
-    56, 58, 52, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 32, 0, 0, 27, 1, 0, 1, 34, 
-    2, 1, 0, 32, 3, 1, 74, 3, 10, 2, 
-    1, 0, 75, 1, 0, 30, 1, 0, 41, 1, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 101, 113, 95, 95, 2, 
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 99, 108, 97, 
+    115, 115, 95, 95, 8, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 100, 105, 99, 116, 95, 95, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 115, 101, 108, 102, 5, 0, 
+    0, 0, 0, 0, 0, 0, 111, 116, 104, 101, 
+    114, 33, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 95, 76, 111, 97, 100, 101, 114, 
+    66, 97, 115, 105, 99, 115, 46, 108, 111, 97, 
+    100, 95, 109, 111, 100, 117, 108, 101, 46, 56, 
+    53, 49, 58, 52, 0, 7, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 33, 1, 0, 34, 
+    2, 1, 1, 1, 32, 32, 3, 0, 32, 1, 
+    1, 38, 2, 32, 2, 0, 0, 0, 0, 0, 
+    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 26, 0, 0, 0, 0, 0, 0, 
+    0, 84, 104, 105, 115, 32, 109, 111, 100, 117, 
+    108, 101, 32, 105, 115, 32, 100, 101, 112, 114, 
+    101, 99, 97, 116, 101, 100, 46, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
-    97, 112, 112, 101, 110, 100, 2, 0, 0, 0, 
-    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
-    0, 0, 97, 112, 112, 101, 110, 100, 5, 0, 
-    0, 0, 0, 0, 0, 0, 95, 112, 97, 116, 
-    104, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 115, 101, 108, 102, 4, 
-    0, 0, 0, 0, 0, 0, 0, 105, 116, 101, 
-    109, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 95, 115, 101, 116, 117, 112, 46, 
-    60, 115, 101, 116, 99, 111, 109, 112, 62, 46, 
-    49, 54, 56, 56, 58, 52, 57, 0, 19, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
+    0, 0, 0, 0, 108, 111, 97, 100, 95, 109, 
+    111, 100, 117, 108, 101, 2, 0, 0, 0, 0, 
+    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 17, 0, 0, 0, 0, 0, 0, 0, 95, 
+    108, 111, 97, 100, 95, 109, 111, 100, 117, 108, 
+    101, 95, 115, 104, 105, 109, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 8, 0, 0, 0, 0, 0, 
+    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
+    32, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 60, 115, 101, 116, 99, 111, 109, 112, 
+    62, 46, 52, 54, 58, 50, 51, 0, 19, 0, 
     0, 0, 0, 0, 0, 0, 60, 0, 0, 32, 
     1, 0, 13, 2, 1, 17, 0, 0, 0, 0, 
     9, 1, 2, 13, 0, 0, 0, 0, 0, 0, 
     0, 45, 1, 1, 17, 0, 0, 0, 0, 30, 
     3, 0, 32, 4, 1, 73, 5, 4, 0, 74, 
-    3, 74, 5, 72, 6, 2, 75, 1, 94, 75, 
-    1, 173, 59, 0, 6, 17, 0, 0, 0, 0, 
+    3, 74, 5, 72, 6, 2, 75, 1, 173, 75, 
+    1, 1, 59, 0, 6, 17, 0, 0, 0, 0, 
     9, 1, 2, 0, 0, 0, 0, 243, 255, 255, 
     255, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 
-    0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 
+    0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 60, 115, 101, 116, 99, 111, 109, 112, 
-    62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 46, 48, 1, 0, 0, 0, 0, 
-    0, 0, 0, 115, 32, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 48, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 95, 112, 97, 116, 
-    104, 95, 115, 112, 108, 105, 116, 46, 60, 103, 
-    101, 110, 101, 120, 112, 114, 62, 46, 49, 50, 
-    56, 58, 49, 49, 0, 21, 0, 0, 0, 0, 
-    0, 0, 0, 32, 0, 0, 13, 1, 0, 17, 
-    0, 0, 0, 0, 9, 0, 1, 15, 0, 0, 
-    0, 0, 0, 0, 0, 45, 1, 0, 17, 0, 
-    0, 0, 0, 31, 2, 0, 34, 3, 2, 0, 
-    32, 4, 1, 74, 0, 74, 4, 10, 3, 1, 
-    0, 75, 1, 0, 39, 2, 0, 75, 0, 0, 
-    64, 2, 67, 5, 17, 0, 0, 0, 0, 9, 
-    0, 1, 0, 0, 0, 0, 241, 255, 255, 255, 
-    30, 2, 0, 41, 2, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 32, 1, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
+    60, 115, 101, 116, 99, 111, 109, 112, 62, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 9, 
-    0, 0, 0, 0, 0, 0, 0, 60, 103, 101, 
-    110, 101, 120, 112, 114, 62, 1, 0, 0, 0, 
-    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
-    0, 0, 114, 102, 105, 110, 100, 0, 0, 0, 
     0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
     0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
     0, 46, 48, 1, 0, 0, 0, 0, 0, 0, 
-    0, 112, 32, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 
+    0, 115, 34, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 17, 0, 
+    0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 
     0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
     116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 70, 105, 108, 101, 76, 111, 
-    97, 100, 101, 114, 46, 95, 95, 101, 113, 95, 
-    95, 46, 49, 48, 49, 49, 58, 52, 0, 14, 
-    0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 
-    27, 1, 0, 0, 32, 2, 1, 27, 0, 2, 
-    0, 6, 3, 1, 0, 0, 79, 2, 3, 19, 
-    3, 6, 0, 0, 0, 32, 0, 0, 27, 1, 
-    0, 1, 32, 2, 1, 27, 0, 2, 1, 6, 
-    3, 1, 0, 0, 17, 0, 0, 0, 0, 41, 
-    3, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    110, 97, 108, 46, 95, 99, 111, 100, 101, 95, 
+    116, 111, 95, 116, 105, 109, 101, 115, 116, 97, 
+    109, 112, 95, 112, 121, 99, 46, 54, 53, 55, 
+    58, 48, 0, 52, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 33, 1, 0, 33, 2, 1, 
+    74, 2, 10, 1, 1, 0, 75, 1, 0, 45, 
+    3, 0, 32, 1, 3, 34, 2, 1, 4, 1, 
+    32, 33, 3, 2, 30, 1, 1, 74, 1, 10, 
+    3, 1, 0, 75, 1, 0, 74, 0, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 39, 4, 0, 75, 
+    0, 0, 32, 1, 3, 34, 2, 1, 4, 1, 
+    32, 33, 3, 2, 32, 1, 1, 74, 1, 10, 
+    3, 1, 0, 75, 1, 0, 74, 0, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 39, 4, 0, 75, 
+    0, 0, 32, 1, 3, 34, 2, 1, 4, 1, 
+    32, 33, 3, 2, 32, 1, 2, 74, 1, 10, 
+    3, 1, 0, 75, 1, 0, 74, 0, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 39, 4, 0, 75, 
+    0, 0, 32, 1, 3, 34, 2, 1, 4, 1, 
+    32, 33, 0, 3, 34, 1, 0, 5, 1, 33, 
+    32, 3, 0, 38, 1, 33, 1, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 74, 0, 38, 2, 32, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 39, 4, 0, 75, 0, 0, 32, 1, 3, 
+    41, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 101, 113, 95, 95, 2, 0, 0, 0, 
-    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 99, 108, 97, 115, 115, 95, 
-    95, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 100, 105, 99, 116, 95, 95, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 101, 108, 102, 5, 0, 0, 0, 0, 
-    0, 0, 0, 111, 116, 104, 101, 114, 32, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    95, 76, 111, 97, 100, 101, 114, 66, 97, 115, 
-    105, 99, 115, 46, 108, 111, 97, 100, 95, 109, 
-    111, 100, 117, 108, 101, 46, 56, 53, 49, 58, 
-    52, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 33, 1, 0, 34, 2, 1, 1, 
-    32, 3, 0, 32, 1, 1, 74, 3, 74, 1, 
-    10, 2, 2, 0, 75, 1, 96, 75, 1, 6, 
-    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 2, 26, 0, 0, 0, 0, 
-    0, 0, 0, 84, 104, 105, 115, 32, 109, 111, 
-    100, 117, 108, 101, 32, 105, 115, 32, 100, 101, 
-    112, 114, 101, 99, 97, 116, 101, 100, 46, 0, 
+    0, 0, 2, 43, 0, 0, 0, 0, 0, 0, 
+    0, 80, 114, 111, 100, 117, 99, 101, 32, 116, 
+    104, 101, 32, 100, 97, 116, 97, 32, 102, 111, 
+    114, 32, 97, 32, 116, 105, 109, 101, 115, 116, 
+    97, 109, 112, 45, 98, 97, 115, 101, 100, 32, 
+    112, 121, 99, 46, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
-    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
-    95, 109, 111, 100, 117, 108, 101, 2, 0, 0, 
-    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
+    0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 
+    95, 99, 111, 100, 101, 95, 116, 111, 95, 116, 
+    105, 109, 101, 115, 116, 97, 109, 112, 95, 112, 
+    121, 99, 6, 0, 0, 0, 0, 0, 0, 0, 
+    9, 0, 0, 0, 0, 0, 0, 0, 98, 121, 
+    116, 101, 97, 114, 114, 97, 121, 12, 0, 0, 
+    0, 0, 0, 0, 0, 77, 65, 71, 73, 67, 
+    95, 78, 85, 77, 66, 69, 82, 12, 0, 0, 
+    0, 0, 0, 0, 0, 95, 112, 97, 99, 107, 
+    95, 117, 105, 110, 116, 51, 50, 7, 0, 0, 
+    0, 0, 0, 0, 0, 109, 97, 114, 115, 104, 
+    97, 108, 6, 0, 0, 0, 0, 0, 0, 0, 
+    101, 120, 116, 101, 110, 100, 5, 0, 0, 0, 
+    0, 0, 0, 0, 100, 117, 109, 112, 115, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 99, 111, 100, 101, 5, 0, 0, 
+    0, 0, 0, 0, 0, 109, 116, 105, 109, 101, 
+    11, 0, 0, 0, 0, 0, 0, 0, 115, 111, 
+    117, 114, 99, 101, 95, 115, 105, 122, 101, 4, 
+    0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 
+    97, 33, 0, 0, 0, 0, 0, 0, 0, 6, 
+    0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 
+    0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 
     0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 17, 0, 0, 0, 0, 0, 0, 
-    0, 95, 108, 111, 97, 100, 95, 109, 111, 100, 
-    117, 108, 101, 95, 115, 104, 105, 109, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 108, 102, 8, 0, 0, 0, 
-    0, 0, 0, 0, 102, 117, 108, 108, 110, 97, 
-    109, 101, 32, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 60, 115, 101, 116, 99, 111, 
-    109, 112, 62, 46, 52, 54, 58, 50, 51, 0, 
-    19, 0, 0, 0, 0, 0, 0, 0, 60, 0, 
-    0, 32, 1, 0, 13, 2, 1, 17, 0, 0, 
-    0, 0, 9, 1, 2, 13, 0, 0, 0, 0, 
-    0, 0, 0, 45, 1, 1, 17, 0, 0, 0, 
-    0, 30, 3, 0, 32, 4, 1, 73, 5, 4, 
-    0, 74, 3, 74, 5, 72, 6, 2, 75, 1, 
-    173, 75, 1, 1, 59, 0, 6, 17, 0, 0, 
-    0, 0, 9, 1, 2, 0, 0, 0, 0, 243, 
-    255, 255, 255, 41, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 
-    0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 
-    0, 0, 0, 0, 60, 115, 101, 116, 99, 111, 
-    109, 112, 62, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 46, 48, 1, 0, 0, 
-    0, 0, 0, 0, 0, 115, 32, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 
-    48, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 95, 99, 
-    111, 100, 101, 95, 116, 111, 95, 116, 105, 109, 
-    101, 115, 116, 97, 109, 112, 95, 112, 121, 99, 
-    46, 54, 53, 55, 58, 48, 0, 62, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
-    0, 33, 2, 1, 74, 2, 10, 1, 1, 0, 
-    75, 1, 0, 45, 3, 0, 32, 1, 3, 34, 
-    2, 1, 4, 33, 3, 2, 30, 1, 1, 74, 
-    1, 10, 3, 1, 0, 75, 1, 0, 74, 0, 
-    74, 0, 10, 2, 1, 0, 75, 1, 0, 39, 
-    4, 0, 75, 0, 0, 32, 1, 3, 34, 2, 
-    1, 4, 33, 3, 2, 32, 1, 1, 74, 1, 
-    10, 3, 1, 0, 75, 1, 0, 74, 0, 74, 
-    0, 10, 2, 1, 0, 75, 1, 0, 39, 4, 
-    0, 75, 0, 0, 32, 1, 3, 34, 2, 1, 
-    4, 33, 3, 2, 32, 1, 2, 74, 1, 10, 
-    3, 1, 0, 75, 1, 0, 74, 0, 74, 0, 
-    10, 2, 1, 0, 75, 1, 0, 39, 4, 0, 
-    75, 0, 0, 32, 1, 3, 34, 2, 1, 4, 
-    33, 0, 3, 34, 1, 0, 5, 32, 3, 0, 
-    74, 3, 10, 1, 1, 0, 75, 1, 80, 74, 
-    0, 74, 0, 10, 2, 1, 0, 75, 1, 245, 
-    39, 4, 0, 75, 0, 0, 32, 1, 3, 41, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 95, 119, 114, 105, 116, 101, 95, 
+    97, 116, 111, 109, 105, 99, 46, 49, 55, 57, 
+    58, 48, 0, 89, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 30, 1, 1, 34, 2, 1, 
+    4, 1, 32, 32, 3, 0, 33, 1, 0, 32, 
+    4, 0, 74, 4, 10, 1, 1, 0, 75, 1, 
+    0, 74, 0, 38, 2, 32, 2, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 2, 43, 0, 0, 0, 0, 0, 
-    0, 0, 80, 114, 111, 100, 117, 99, 101, 32, 
-    116, 104, 101, 32, 100, 97, 116, 97, 32, 102, 
-    111, 114, 32, 97, 32, 116, 105, 109, 101, 115, 
-    116, 97, 109, 112, 45, 98, 97, 115, 101, 100, 
-    32, 112, 121, 99, 46, 0, 0, 0, 0, 0, 
+    0, 0, 39, 5, 0, 75, 0, 0, 45, 3, 
+    5, 33, 0, 1, 34, 1, 0, 5, 1, 32, 
+    32, 2, 3, 33, 0, 1, 27, 3, 0, 12, 
+    33, 4, 1, 27, 0, 4, 13, 0, 5, 3, 
+    0, 10, 33, 4, 1, 27, 0, 4, 14, 0, 
+    3, 5, 0, 10, 32, 4, 2, 30, 5, 2, 
+    0, 6, 4, 5, 9, 38, 1, 32, 3, 0, 
+    0, 0, 0, 0, 0, 0, 2, 3, 6, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 45, 4, 0, 17, 15, 
+    0, 0, 0, 33, 0, 3, 21, 0, 12, 0, 
+    0, 0, 17, 5, 0, 0, 0, 33, 0, 3, 
+    21, 0, 2, 0, 0, 0, 5, 17, 6, 0, 
+    0, 0, 52, 33, 0, 1, 34, 1, 0, 11, 
+    1, 32, 32, 2, 3, 38, 1, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 17, 0, 0, 0, 0, 52, 52, 
+    33, 0, 2, 34, 1, 0, 6, 1, 32, 32, 
+    2, 4, 30, 3, 3, 38, 1, 32, 2, 0, 
+    0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 34, 4, 0, 7, 1, 32, 
+    74, 0, 38, 4, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 
+    1, 0, 75, 0, 0, 45, 5, 1, 17, 10, 
+    0, 0, 0, 34, 1, 0, 8, 0, 0, 74, 
+    0, 53, 2, 1, 39, 2, 0, 75, 0, 0, 
+    79, 3, 2, 22, 2, 1, 0, 0, 0, 52, 
+    5, 17, 13, 0, 0, 0, 32, 1, 5, 34, 
+    2, 1, 9, 1, 32, 32, 3, 1, 74, 0, 
+    38, 2, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 1, 
+    0, 75, 0, 0, 17, 0, 0, 0, 0, 34, 
+    1, 0, 8, 1, 32, 30, 2, 4, 38, 1, 
+    32, 3, 0, 0, 0, 0, 0, 0, 0, 2, 
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 17, 
+    0, 0, 0, 0, 33, 0, 1, 34, 1, 0, 
+    10, 1, 32, 32, 2, 3, 32, 3, 0, 38, 
+    1, 32, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 
+    0, 0, 0, 30, 0, 4, 41, 0, 8, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 
+    0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 
+    0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 
+    33, 0, 0, 0, 0, 0, 0, 0, 34, 0, 
+    0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 
+    0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 
+    0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 
+    34, 0, 0, 0, 0, 0, 0, 0, 46, 0, 
+    0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 
+    0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 
+    0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 
+    58, 0, 0, 0, 0, 0, 0, 0, 58, 0, 
+    0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 
+    0, 0, 0, 0, 68, 0, 0, 0, 0, 0, 
+    0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 
+    68, 0, 0, 0, 0, 0, 0, 0, 75, 0, 
+    0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 
+    0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 
+    0, 0, 86, 0, 0, 0, 0, 0, 0, 0, 
+    31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    2, 162, 0, 0, 0, 0, 0, 0, 0, 66, 
+    101, 115, 116, 45, 101, 102, 102, 111, 114, 116, 
+    32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 
+    116, 111, 32, 119, 114, 105, 116, 101, 32, 100, 
+    97, 116, 97, 32, 116, 111, 32, 97, 32, 112, 
+    97, 116, 104, 32, 97, 116, 111, 109, 105, 99, 
+    97, 108, 108, 121, 46, 10, 32, 32, 32, 32, 
+    66, 101, 32, 112, 114, 101, 112, 97, 114, 101, 
+    100, 32, 116, 111, 32, 104, 97, 110, 100, 108, 
+    101, 32, 97, 32, 70, 105, 108, 101, 69, 120, 
+    105, 115, 116, 115, 69, 114, 114, 111, 114, 32, 
+    105, 102, 32, 99, 111, 110, 99, 117, 114, 114, 
+    101, 110, 116, 32, 119, 114, 105, 116, 105, 110, 
+    103, 32, 111, 102, 32, 116, 104, 101, 10, 32, 
+    32, 32, 32, 116, 101, 109, 112, 111, 114, 97, 
+    114, 121, 32, 102, 105, 108, 101, 32, 105, 115, 
+    32, 97, 116, 116, 101, 109, 112, 116, 101, 100, 
+    46, 2, 5, 0, 0, 0, 0, 0, 0, 0, 
+    123, 125, 46, 123, 125, 0, 182, 1, 0, 0, 
+    0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 
+    0, 0, 0, 119, 98, 5, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
-    0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 
-    0, 95, 99, 111, 100, 101, 95, 116, 111, 95, 
-    116, 105, 109, 101, 115, 116, 97, 109, 112, 95, 
-    112, 121, 99, 6, 0, 0, 0, 0, 0, 0, 
-    0, 9, 0, 0, 0, 0, 0, 0, 0, 98, 
-    121, 116, 101, 97, 114, 114, 97, 121, 12, 0, 
-    0, 0, 0, 0, 0, 0, 77, 65, 71, 73, 
-    67, 95, 78, 85, 77, 66, 69, 82, 12, 0, 
-    0, 0, 0, 0, 0, 0, 95, 112, 97, 99, 
-    107, 95, 117, 105, 110, 116, 51, 50, 7, 0, 
-    0, 0, 0, 0, 0, 0, 109, 97, 114, 115, 
-    104, 97, 108, 6, 0, 0, 0, 0, 0, 0, 
-    0, 101, 120, 116, 101, 110, 100, 5, 0, 0, 
-    0, 0, 0, 0, 0, 100, 117, 109, 112, 115, 
-    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 99, 111, 100, 101, 5, 0, 
-    0, 0, 0, 0, 0, 0, 109, 116, 105, 109, 
-    101, 11, 0, 0, 0, 0, 0, 0, 0, 115, 
-    111, 117, 114, 99, 101, 95, 115, 105, 122, 101, 
-    4, 0, 0, 0, 0, 0, 0, 0, 100, 97, 
-    116, 97, 32, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 25, 0, 
-    0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 95, 119, 114, 105, 116, 101, 
-    95, 97, 116, 111, 109, 105, 99, 46, 49, 55, 
-    57, 58, 48, 0, 123, 0, 0, 0, 0, 0, 
-    0, 0, 30, 0, 0, 30, 1, 1, 34, 2, 
-    1, 4, 32, 3, 0, 33, 1, 0, 32, 4, 
-    0, 74, 4, 10, 1, 1, 0, 75, 1, 0, 
-    74, 0, 74, 3, 74, 0, 10, 2, 2, 0, 
-    75, 1, 0, 75, 1, 0, 39, 5, 0, 75, 
-    0, 0, 45, 3, 5, 33, 0, 1, 34, 1, 
-    0, 5, 32, 2, 3, 33, 0, 1, 27, 3, 
-    0, 12, 33, 4, 1, 27, 0, 4, 13, 0, 
-    5, 3, 0, 10, 33, 4, 1, 27, 0, 4, 
-    14, 0, 3, 5, 0, 10, 32, 4, 2, 30, 
-    5, 2, 0, 6, 4, 5, 9, 74, 2, 74, 
-    3, 74, 6, 10, 1, 3, 0, 75, 1, 0, 
-    75, 1, 0, 75, 1, 0, 45, 4, 0, 42, 
-    1, 0, 0, 0, 17, 19, 0, 0, 0, 33, 
-    0, 3, 21, 0, 16, 0, 0, 0, 42, 1, 
-    0, 0, 0, 17, 5, 0, 0, 0, 33, 0, 
-    3, 21, 0, 2, 0, 0, 0, 5, 17, 9, 
-    0, 0, 0, 52, 33, 0, 1, 34, 1, 0, 
-    11, 32, 2, 3, 74, 2, 10, 1, 1, 0, 
-    75, 1, 0, 54, 17, 0, 0, 0, 0, 52, 
-    52, 33, 0, 2, 34, 1, 0, 6, 32, 2, 
-    4, 30, 3, 3, 74, 2, 74, 3, 10, 1, 
-    2, 0, 75, 1, 184, 75, 1, 143, 34, 4, 
-    0, 7, 74, 0, 10, 4, 0, 0, 39, 1, 
-    0, 75, 0, 0, 45, 5, 1, 56, 1, 0, 
-    0, 0, 17, 10, 0, 0, 0, 34, 1, 0, 
-    8, 74, 0, 53, 2, 1, 39, 2, 0, 75, 
-    0, 0, 79, 3, 2, 22, 2, 1, 0, 0, 
-    0, 52, 5, 17, 22, 0, 0, 0, 32, 1, 
-    5, 34, 2, 1, 9, 32, 3, 1, 74, 0, 
-    74, 3, 10, 2, 1, 0, 75, 1, 172, 39, 
-    1, 0, 75, 0, 0, 54, 17, 0, 0, 0, 
-    0, 34, 1, 0, 8, 30, 2, 4, 74, 2, 
-    74, 2, 74, 2, 10, 1, 3, 0, 75, 1, 
-    88, 75, 1, 0, 75, 1, 118, 5, 17, 0, 
-    0, 0, 0, 33, 0, 1, 34, 1, 0, 10, 
-    32, 2, 3, 32, 3, 0, 74, 2, 74, 3, 
-    10, 1, 2, 0, 75, 1, 231, 75, 1, 0, 
-    54, 17, 0, 0, 0, 0, 30, 0, 4, 41, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
-    0, 0, 0, 2, 162, 0, 0, 0, 0, 0, 
-    0, 0, 66, 101, 115, 116, 45, 101, 102, 102, 
-    111, 114, 116, 32, 102, 117, 110, 99, 116, 105, 
-    111, 110, 32, 116, 111, 32, 119, 114, 105, 116, 
-    101, 32, 100, 97, 116, 97, 32, 116, 111, 32, 
-    97, 32, 112, 97, 116, 104, 32, 97, 116, 111, 
-    109, 105, 99, 97, 108, 108, 121, 46, 10, 32, 
-    32, 32, 32, 66, 101, 32, 112, 114, 101, 112, 
-    97, 114, 101, 100, 32, 116, 111, 32, 104, 97, 
-    110, 100, 108, 101, 32, 97, 32, 70, 105, 108, 
-    101, 69, 120, 105, 115, 116, 115, 69, 114, 114, 
-    111, 114, 32, 105, 102, 32, 99, 111, 110, 99, 
-    117, 114, 114, 101, 110, 116, 32, 119, 114, 105, 
-    116, 105, 110, 103, 32, 111, 102, 32, 116, 104, 
-    101, 10, 32, 32, 32, 32, 116, 101, 109, 112, 
-    111, 114, 97, 114, 121, 32, 102, 105, 108, 101, 
-    32, 105, 115, 32, 97, 116, 116, 101, 109, 112, 
-    116, 101, 100, 46, 2, 5, 0, 0, 0, 0, 
-    0, 0, 0, 123, 125, 46, 123, 125, 0, 182, 
-    1, 0, 0, 0, 0, 0, 0, 2, 2, 0, 
-    0, 0, 0, 0, 0, 0, 119, 98, 5, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    25, 0, 0, 0, 0, 0, 0, 0, 13, 0, 
-    0, 0, 0, 0, 0, 0, 95, 119, 114, 105, 
-    116, 101, 95, 97, 116, 111, 109, 105, 99, 15, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 105, 100, 3, 0, 0, 
-    0, 0, 0, 0, 0, 95, 111, 115, 3, 0, 
-    0, 0, 0, 0, 0, 0, 95, 105, 111, 7, 
-    0, 0, 0, 0, 0, 0, 0, 79, 83, 69, 
-    114, 114, 111, 114, 6, 0, 0, 0, 0, 0, 
-    0, 0, 102, 111, 114, 109, 97, 116, 4, 0, 
-    0, 0, 0, 0, 0, 0, 111, 112, 101, 110, 
-    6, 0, 0, 0, 0, 0, 0, 0, 70, 105, 
-    108, 101, 73, 79, 9, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 101, 110, 116, 101, 114, 95, 
-    95, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 101, 120, 105, 116, 95, 95, 5, 0, 0, 
-    0, 0, 0, 0, 0, 119, 114, 105, 116, 101, 
-    7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 
-    112, 108, 97, 99, 101, 6, 0, 0, 0, 0, 
-    0, 0, 0, 117, 110, 108, 105, 110, 107, 6, 
-    0, 0, 0, 0, 0, 0, 0, 79, 95, 69, 
-    88, 67, 76, 7, 0, 0, 0, 0, 0, 0, 
-    0, 79, 95, 67, 82, 69, 65, 84, 8, 0, 
-    0, 0, 0, 0, 0, 0, 79, 95, 87, 82, 
-    79, 78, 76, 89, 0, 0, 0, 0, 0, 0, 
-    0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 4, 0, 0, 0, 0, 0, 0, 0, 
-    100, 97, 116, 97, 4, 0, 0, 0, 0, 0, 
-    0, 0, 109, 111, 100, 101, 8, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 95, 116, 
-    109, 112, 2, 0, 0, 0, 0, 0, 0, 0, 
-    102, 100, 4, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 108, 101, 32, 0, 0, 0, 0, 0, 
-    0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 
-    42, 0, 0, 0, 0, 0, 0, 0, 43, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 99, 97, 99, 104, 
-    101, 95, 102, 114, 111, 109, 95, 115, 111, 117, 
-    114, 99, 101, 46, 51, 54, 48, 58, 48, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 30, 0, 
-    0, 32, 1, 1, 30, 0, 1, 6, 2, 1, 
-    0, 7, 79, 3, 2, 19, 2, 23, 0, 0, 
-    0, 33, 0, 0, 34, 1, 0, 15, 30, 2, 
-    2, 33, 3, 1, 74, 2, 74, 3, 10, 1, 
-    2, 0, 75, 1, 0, 75, 1, 172, 32, 4, 
-    2, 30, 0, 1, 6, 1, 4, 0, 7, 79, 
-    2, 1, 22, 1, 207, 0, 0, 0, 32, 0, 
-    1, 79, 1, 0, 22, 0, 2, 0, 0, 0, 
-    30, 1, 3, 17, 2, 0, 0, 0, 30, 1, 
-    4, 17, 0, 0, 0, 0, 45, 2, 1, 17, 
-    0, 0, 0, 0, 33, 0, 3, 34, 1, 0, 
-    16, 32, 2, 0, 74, 2, 10, 1, 1, 0, 
-    75, 1, 37, 45, 0, 0, 33, 1, 4, 32, 
-    2, 0, 74, 2, 10, 1, 1, 0, 75, 1, 
-    138, 50, 2, 0, 0, 0, 0, 0, 0, 0, 
-    3, 4, 0, 45, 4, 3, 45, 5, 4, 32, 
-    1, 5, 34, 2, 1, 17, 30, 3, 5, 74, 
-    3, 10, 2, 1, 0, 75, 1, 240, 50, 3, 
-    0, 0, 0, 0, 0, 0, 0, 1, 4, 5, 
-    0, 45, 6, 1, 45, 7, 4, 45, 8, 5, 
-    33, 0, 5, 27, 1, 0, 23, 27, 2, 1, 
-    24, 45, 9, 2, 32, 1, 9, 30, 0, 1, 
-    6, 2, 1, 0, 6, 79, 3, 2, 22, 2, 
-    158, 0, 0, 0, 30, 0, 4, 34, 1, 0, 
-    18, 32, 2, 6, 79, 0, 2, 22, 2, 2, 
-    0, 0, 0, 32, 3, 8, 17, 2, 0, 0, 
-    0, 32, 3, 6, 17, 0, 0, 0, 0, 32, 
-    2, 7, 32, 4, 9, 74, 3, 74, 2, 74, 
-    4, 3, 5, 3, 75, 1, 150, 75, 1, 173, 
-    75, 1, 247, 74, 5, 10, 1, 1, 0, 75, 
-    1, 0, 45, 10, 0, 32, 1, 2, 30, 0, 
-    1, 6, 2, 1, 0, 6, 79, 3, 2, 19, 
-    2, 16, 0, 0, 0, 33, 0, 5, 27, 1, 
-    0, 25, 27, 2, 1, 26, 30, 0, 6, 6, 
-    1, 2, 0, 0, 79, 3, 1, 22, 1, 5, 
-    0, 0, 0, 33, 0, 5, 27, 1, 0, 25, 
-    27, 2, 1, 26, 45, 2, 2, 17, 3, 0, 
-    0, 0, 30, 0, 4, 45, 2, 0, 17, 0, 
-    0, 0, 0, 17, 0, 0, 0, 0, 33, 1, 
-    7, 32, 2, 2, 74, 2, 10, 1, 1, 0, 
-    75, 1, 143, 45, 2, 0, 32, 1, 2, 30, 
-    0, 4, 6, 2, 1, 0, 1, 79, 3, 2, 
-    19, 2, 20, 0, 0, 0, 32, 1, 2, 34, 
-    2, 1, 19, 10, 2, 0, 0, 49, 1, 0, 
-    3, 79, 2, 1, 22, 1, 84, 0, 0, 0, 
-    30, 0, 7, 34, 1, 0, 20, 32, 2, 10, 
-    33, 3, 9, 32, 4, 2, 74, 2, 74, 3, 
-    74, 4, 10, 1, 3, 0, 75, 1, 149, 75, 
-    1, 173, 75, 1, 0, 45, 10, 0, 17, 0, 
-    0, 0, 0, 32, 0, 10, 33, 1, 10, 30, 
-    2, 6, 1, 3, 1, 2, 0, 4, 0, 3, 
-    0, 45, 11, 4, 33, 0, 5, 27, 1, 0, 
-    27, 30, 2, 1, 6, 0, 1, 2, 7, 79, 
-    3, 0, 22, 0, 12, 0, 0, 0, 33, 1, 
-    12, 32, 2, 4, 33, 3, 14, 32, 4, 11, 
-    74, 2, 74, 3, 74, 4, 10, 1, 3, 0, 
-    75, 1, 172, 75, 1, 173, 75, 1, 110, 41, 
-    0, 33, 1, 11, 32, 2, 4, 74, 2, 10, 
-    1, 1, 0, 75, 1, 173, 49, 3, 0, 3, 
-    79, 1, 3, 19, 3, 15, 0, 0, 0, 33, 
-    1, 12, 33, 2, 3, 34, 3, 2, 21, 10, 
-    3, 0, 0, 32, 2, 4, 74, 0, 74, 0, 
+    0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 
+    0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 
+    0, 0, 0, 95, 119, 114, 105, 116, 101, 95, 
+    97, 116, 111, 109, 105, 99, 15, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 105, 100, 3, 0, 0, 0, 0, 0, 
+    0, 0, 95, 111, 115, 3, 0, 0, 0, 0, 
+    0, 0, 0, 95, 105, 111, 7, 0, 0, 0, 
+    0, 0, 0, 0, 79, 83, 69, 114, 114, 111, 
+    114, 6, 0, 0, 0, 0, 0, 0, 0, 102, 
+    111, 114, 109, 97, 116, 4, 0, 0, 0, 0, 
+    0, 0, 0, 111, 112, 101, 110, 6, 0, 0, 
+    0, 0, 0, 0, 0, 70, 105, 108, 101, 73, 
+    79, 9, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 101, 110, 116, 101, 114, 95, 95, 8, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 101, 120, 
+    105, 116, 95, 95, 5, 0, 0, 0, 0, 0, 
+    0, 0, 119, 114, 105, 116, 101, 7, 0, 0, 
+    0, 0, 0, 0, 0, 114, 101, 112, 108, 97, 
+    99, 101, 6, 0, 0, 0, 0, 0, 0, 0, 
+    117, 110, 108, 105, 110, 107, 6, 0, 0, 0, 
+    0, 0, 0, 0, 79, 95, 69, 88, 67, 76, 
+    7, 0, 0, 0, 0, 0, 0, 0, 79, 95, 
+    67, 82, 69, 65, 84, 8, 0, 0, 0, 0, 
+    0, 0, 0, 79, 95, 87, 82, 79, 78, 76, 
+    89, 0, 0, 0, 0, 0, 0, 0, 0, 6, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 4, 
+    0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 
+    97, 4, 0, 0, 0, 0, 0, 0, 0, 109, 
+    111, 100, 101, 8, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 116, 104, 95, 116, 109, 112, 2, 
+    0, 0, 0, 0, 0, 0, 0, 102, 100, 4, 
+    0, 0, 0, 0, 0, 0, 0, 102, 105, 108, 
+    101, 33, 0, 0, 0, 0, 0, 0, 0, 12, 
+    0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 
+    0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 99, 97, 99, 104, 101, 95, 102, 
+    114, 111, 109, 95, 115, 111, 117, 114, 99, 101, 
+    46, 51, 54, 48, 58, 48, 0, 236, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 32, 1, 
+    1, 30, 0, 1, 6, 2, 1, 0, 7, 79, 
+    3, 2, 19, 2, 19, 0, 0, 0, 33, 0, 
+    0, 34, 1, 0, 15, 1, 32, 30, 2, 2, 
+    33, 3, 1, 38, 1, 32, 2, 0, 0, 0, 
+    0, 0, 0, 0, 2, 3, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 32, 4, 2, 30, 0, 1, 6, 1, 
+    4, 0, 7, 79, 2, 1, 22, 1, 193, 0, 
+    0, 0, 32, 0, 1, 79, 1, 0, 22, 0, 
+    2, 0, 0, 0, 30, 1, 3, 17, 2, 0, 
+    0, 0, 30, 1, 4, 17, 0, 0, 0, 0, 
+    45, 2, 1, 17, 0, 0, 0, 0, 33, 0, 
+    3, 34, 1, 0, 16, 1, 32, 32, 2, 0, 
+    38, 1, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 
+    0, 33, 1, 4, 32, 2, 0, 38, 1, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 50, 2, 0, 0, 0, 
+    0, 0, 0, 0, 3, 4, 0, 45, 4, 3, 
+    45, 5, 4, 32, 1, 5, 34, 2, 1, 17, 
+    1, 32, 30, 3, 5, 38, 2, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 50, 3, 0, 0, 0, 0, 0, 
+    0, 0, 1, 4, 5, 0, 45, 6, 1, 45, 
+    7, 4, 45, 8, 5, 33, 0, 5, 27, 1, 
+    0, 23, 27, 2, 1, 24, 45, 9, 2, 32, 
+    1, 9, 30, 0, 1, 6, 2, 1, 0, 6, 
+    79, 3, 2, 22, 2, 150, 0, 0, 0, 30, 
+    0, 4, 34, 1, 0, 18, 0, 0, 32, 2, 
+    6, 79, 0, 2, 22, 2, 2, 0, 0, 0, 
+    32, 3, 8, 17, 2, 0, 0, 0, 32, 3, 
+    6, 17, 0, 0, 0, 0, 32, 2, 7, 32, 
+    4, 9, 74, 3, 74, 2, 74, 4, 3, 5, 
+    3, 75, 1, 150, 75, 1, 173, 75, 1, 247, 
+    74, 5, 10, 1, 1, 0, 75, 1, 0, 45, 
+    10, 0, 32, 1, 2, 30, 0, 1, 6, 2, 
+    1, 0, 6, 79, 3, 2, 19, 2, 16, 0, 
+    0, 0, 33, 0, 5, 27, 1, 0, 25, 27, 
+    2, 1, 26, 30, 0, 6, 6, 1, 2, 0, 
+    0, 79, 3, 1, 22, 1, 5, 0, 0, 0, 
+    33, 0, 5, 27, 1, 0, 25, 27, 2, 1, 
+    26, 45, 2, 2, 17, 3, 0, 0, 0, 30, 
+    0, 4, 45, 2, 0, 17, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 33, 1, 7, 32, 2, 
+    2, 74, 2, 10, 1, 1, 0, 75, 1, 143, 
+    45, 2, 0, 32, 1, 2, 30, 0, 4, 6, 
+    2, 1, 0, 1, 79, 3, 2, 19, 2, 14, 
+    0, 0, 0, 32, 1, 2, 34, 2, 1, 19, 
+    1, 32, 38, 2, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 
+    1, 0, 3, 79, 2, 1, 22, 1, 78, 0, 
+    0, 0, 30, 0, 7, 34, 1, 0, 20, 1, 
+    32, 32, 2, 10, 33, 3, 9, 32, 4, 2, 
+    38, 1, 32, 3, 0, 0, 0, 0, 0, 0, 
+    0, 2, 3, 4, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    45, 10, 0, 17, 0, 0, 0, 0, 32, 0, 
+    10, 33, 1, 10, 30, 2, 6, 1, 3, 1, 
+    2, 0, 4, 0, 3, 0, 45, 11, 4, 33, 
+    0, 5, 27, 1, 0, 27, 30, 2, 1, 6, 
+    0, 1, 2, 7, 79, 3, 0, 22, 0, 12, 
+    0, 0, 0, 33, 1, 12, 32, 2, 4, 33, 
+    3, 14, 32, 4, 11, 74, 2, 74, 3, 74, 
+    4, 10, 1, 3, 0, 75, 1, 172, 75, 1, 
+    173, 75, 1, 110, 41, 0, 33, 1, 11, 32, 
+    2, 4, 74, 2, 10, 1, 1, 0, 75, 1, 
+    173, 49, 3, 0, 3, 79, 1, 3, 19, 3, 
+    15, 0, 0, 0, 33, 1, 12, 33, 2, 3, 
+    34, 3, 2, 21, 1, 32, 38, 3, 32, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 32, 2, 4, 74, 0, 74, 0, 
     74, 2, 10, 1, 2, 0, 75, 1, 172, 75, 
     1, 173, 39, 3, 0, 75, 0, 0, 45, 4, 
     3, 17, 0, 0, 0, 0, 32, 0, 4, 30, 
@@ -5684,24 +6075,29 @@ std::vector<uint8_t> _bootstrap_external
     0, 0, 0, 32, 1, 4, 30, 2, 6, 1, 
     3, 1, 2, 33, 4, 13, 6, 0, 3, 4, 
     9, 17, 0, 0, 0, 0, 79, 1, 0, 19, 
-    0, 36, 0, 0, 0, 32, 1, 4, 30, 0, 
+    0, 34, 0, 0, 0, 32, 1, 4, 30, 0, 
     9, 30, 2, 1, 30, 3, 1, 62, 4, 3, 
     0, 2, 3, 1, 5, 1, 4, 45, 4, 5, 
-    17, 28, 0, 0, 0, 33, 1, 8, 30, 0, 
-    10, 34, 2, 0, 20, 32, 3, 2, 74, 3, 
-    10, 2, 1, 0, 75, 1, 172, 74, 0, 74, 
-    0, 10, 1, 1, 0, 75, 1, 152, 39, 4, 
-    0, 75, 0, 0, 40, 1, 4, 33, 1, 6, 
-    30, 2, 11, 74, 2, 10, 1, 1, 0, 75, 
-    1, 173, 40, 1, 0, 30, 1, 12, 45, 3, 
-    1, 33, 2, 2, 32, 1, 3, 74, 1, 10, 
-    2, 1, 0, 75, 1, 173, 40, 1, 0, 33, 
-    1, 12, 33, 0, 5, 27, 2, 0, 27, 32, 
-    3, 4, 34, 4, 3, 22, 33, 5, 13, 74, 
-    5, 10, 4, 1, 0, 75, 1, 173, 32, 3, 
-    11, 74, 0, 74, 2, 74, 0, 74, 3, 10, 
-    1, 3, 0, 75, 1, 173, 75, 1, 141, 75, 
-    1, 173, 39, 4, 0, 75, 0, 0, 41, 4, 
+    17, 26, 0, 0, 0, 33, 1, 8, 30, 0, 
+    10, 34, 2, 0, 20, 1, 32, 32, 3, 2, 
+    38, 2, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 
+    74, 0, 10, 1, 1, 0, 75, 1, 152, 39, 
+    4, 0, 75, 0, 0, 40, 1, 4, 33, 1, 
+    6, 30, 2, 11, 74, 2, 10, 1, 1, 0, 
+    75, 1, 173, 40, 1, 0, 30, 1, 12, 45, 
+    3, 1, 33, 2, 2, 32, 1, 3, 74, 1, 
+    10, 2, 1, 0, 75, 1, 173, 40, 1, 0, 
+    33, 1, 12, 33, 0, 5, 27, 2, 0, 27, 
+    32, 3, 4, 34, 4, 3, 22, 1, 32, 33, 
+    5, 13, 38, 4, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    32, 3, 11, 74, 0, 74, 2, 74, 0, 74, 
+    3, 10, 1, 3, 0, 75, 1, 173, 75, 1, 
+    141, 75, 1, 173, 39, 4, 0, 75, 0, 0, 
+    41, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 
@@ -5886,7 +6282,7 @@ std::vector<uint8_t> _bootstrap_external
     0, 0, 0, 0, 97, 108, 109, 111, 115, 116, 
     95, 102, 105, 108, 101, 110, 97, 109, 101, 8, 
     0, 0, 0, 0, 0, 0, 0, 102, 105, 108, 
-    101, 110, 97, 109, 101, 32, 0, 0, 0, 0, 
+    101, 110, 97, 109, 101, 35, 0, 0, 0, 0, 
     0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
     0, 15, 0, 0, 0, 0, 0, 0, 0, 56, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
@@ -5895,27 +6291,35 @@ std::vector<uint8_t> _bootstrap_external
     114, 99, 101, 108, 101, 115, 115, 70, 105, 108, 
     101, 76, 111, 97, 100, 101, 114, 46, 103, 101, 
     116, 95, 99, 111, 100, 101, 46, 49, 49, 50, 
-    49, 58, 52, 0, 55, 0, 0, 0, 0, 0, 
-    0, 0, 32, 0, 0, 34, 1, 0, 3, 32, 
-    2, 1, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 45, 2, 0, 32, 1, 0, 34, 2, 1, 
-    4, 32, 3, 2, 74, 3, 10, 2, 1, 0, 
-    75, 1, 0, 45, 3, 0, 30, 2, 0, 30, 
-    0, 1, 32, 1, 1, 30, 2, 2, 32, 3, 
-    2, 74, 0, 74, 2, 74, 1, 74, 3, 2, 
-    4, 2, 75, 1, 0, 75, 1, 0, 75, 1, 
-    0, 75, 1, 0, 45, 4, 4, 33, 1, 0, 
-    32, 2, 3, 32, 3, 1, 32, 4, 4, 74, 
-    2, 74, 3, 74, 4, 10, 1, 3, 0, 75, 
-    1, 0, 75, 1, 0, 75, 1, 0, 33, 5, 
-    1, 33, 1, 2, 32, 2, 3, 74, 2, 10, 
-    1, 1, 0, 75, 1, 172, 30, 3, 3, 30, 
-    1, 0, 30, 2, 0, 62, 4, 3, 3, 1, 
-    2, 1, 6, 0, 4, 32, 1, 1, 32, 2, 
-    2, 12, 5, 1, 0, 0, 0, 0, 0, 0, 
-    0, 6, 2, 0, 0, 0, 0, 0, 0, 0, 
-    1, 2, 2, 0, 0, 0, 0, 0, 0, 0, 
-    5, 6, 41, 0, 0, 0, 0, 0, 0, 0, 
+    49, 58, 52, 0, 43, 0, 0, 0, 0, 0, 
+    0, 0, 32, 0, 0, 34, 1, 0, 3, 1, 
+    32, 32, 2, 1, 38, 1, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 45, 2, 0, 32, 1, 0, 34, 2, 
+    1, 4, 1, 34, 32, 3, 2, 38, 2, 34, 
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 45, 3, 0, 30, 2, 
+    0, 30, 0, 1, 32, 1, 1, 30, 2, 2, 
+    32, 3, 2, 74, 0, 74, 2, 74, 1, 74, 
+    3, 2, 4, 2, 75, 1, 0, 75, 1, 0, 
+    75, 1, 0, 75, 1, 0, 45, 4, 4, 33, 
+    1, 0, 32, 2, 3, 32, 3, 1, 32, 4, 
+    4, 38, 1, 32, 3, 0, 0, 0, 0, 0, 
+    0, 0, 2, 3, 4, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 33, 5, 1, 33, 1, 2, 32, 2, 3, 
+    38, 1, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 30, 3, 
+    3, 30, 1, 0, 30, 2, 0, 62, 4, 3, 
+    3, 1, 2, 1, 6, 0, 4, 32, 1, 1, 
+    32, 2, 2, 12, 5, 1, 0, 0, 0, 0, 
+    0, 0, 0, 6, 2, 0, 0, 0, 0, 0, 
+    0, 0, 1, 2, 2, 0, 0, 0, 0, 0, 
+    0, 0, 5, 6, 41, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
     0, 0, 0, 0, 0, 0, 5, 2, 4, 0, 
@@ -5951,223 +6355,241 @@ std::vector<uint8_t> _bootstrap_external
     112, 97, 116, 104, 4, 0, 0, 0, 0, 0, 
     0, 0, 100, 97, 116, 97, 11, 0, 0, 0, 
     0, 0, 0, 0, 101, 120, 99, 95, 100, 101, 
-    116, 97, 105, 108, 115, 32, 0, 0, 0, 0, 
+    116, 97, 105, 108, 115, 33, 0, 0, 0, 0, 
     0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
     0, 8, 0, 0, 0, 0, 0, 0, 0, 37, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
     111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
     116, 101, 114, 110, 97, 108, 46, 95, 112, 97, 
     116, 104, 95, 105, 115, 97, 98, 115, 46, 49, 
-    54, 54, 58, 52, 0, 50, 0, 0, 0, 0, 
+    54, 54, 58, 52, 0, 40, 0, 0, 0, 0, 
     0, 0, 0, 30, 0, 0, 32, 1, 0, 49, 
-    0, 1, 3, 79, 2, 0, 22, 0, 43, 0, 
-    0, 0, 33, 1, 0, 34, 2, 1, 2, 32, 
-    3, 0, 74, 3, 10, 2, 1, 0, 75, 1, 
-    0, 30, 1, 1, 1, 2, 0, 1, 34, 3, 
-    2, 3, 30, 1, 2, 30, 2, 3, 74, 1, 
-    74, 2, 10, 3, 2, 0, 75, 1, 0, 75, 
-    1, 0, 45, 1, 0, 33, 1, 1, 32, 2, 
-    1, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
-    30, 3, 4, 6, 0, 0, 3, 4, 79, 1, 
-    0, 19, 0, 16, 0, 0, 0, 32, 0, 1, 
-    34, 1, 0, 4, 30, 2, 5, 74, 2, 10, 
-    1, 1, 0, 75, 1, 0, 79, 0, 0, 22, 
-    0, 7, 0, 0, 0, 32, 0, 1, 34, 1, 
-    0, 5, 30, 2, 3, 74, 2, 10, 1, 1, 
-    0, 75, 1, 0, 17, 0, 0, 0, 0, 17, 
-    0, 0, 0, 0, 41, 0, 30, 1, 6, 41, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 1, 3, 79, 2, 0, 22, 0, 33, 0, 
+    0, 0, 33, 1, 0, 34, 2, 1, 2, 1, 
+    32, 32, 3, 0, 38, 2, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
-    0, 0, 0, 2, 30, 0, 0, 0, 0, 0, 
-    0, 0, 82, 101, 112, 108, 97, 99, 101, 109, 
-    101, 110, 116, 32, 102, 111, 114, 32, 111, 115, 
-    46, 112, 97, 116, 104, 46, 105, 115, 97, 98, 
-    115, 46, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 
-    47, 2, 1, 0, 0, 0, 0, 0, 0, 0, 
-    92, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    2, 2, 0, 0, 0, 0, 0, 0, 0, 92, 
-    92, 6, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 30, 1, 1, 1, 2, 0, 1, 34, 
+    3, 2, 3, 1, 32, 30, 1, 2, 30, 2, 
+    3, 38, 3, 32, 2, 0, 0, 0, 0, 0, 
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    45, 1, 0, 33, 1, 1, 32, 2, 1, 74, 
+    2, 10, 1, 1, 0, 75, 1, 0, 30, 3, 
+    4, 6, 0, 0, 3, 4, 79, 1, 0, 19, 
+    0, 12, 0, 0, 0, 32, 0, 1, 34, 1, 
+    0, 4, 1, 32, 30, 2, 5, 38, 1, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 79, 0, 0, 22, 0, 
+    5, 0, 0, 0, 32, 0, 1, 34, 1, 0, 
+    5, 1, 32, 30, 2, 3, 38, 1, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
-    0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
-    95, 112, 97, 116, 104, 95, 105, 115, 97, 98, 
-    115, 6, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 95, 111, 115, 
-    3, 0, 0, 0, 0, 0, 0, 0, 108, 101, 
-    110, 15, 0, 0, 0, 0, 0, 0, 0, 95, 
-    112, 97, 116, 104, 95, 115, 112, 108, 105, 116, 
-    114, 111, 111, 116, 7, 0, 0, 0, 0, 0, 
-    0, 0, 114, 101, 112, 108, 97, 99, 101, 10, 
-    0, 0, 0, 0, 0, 0, 0, 115, 116, 97, 
-    114, 116, 115, 119, 105, 116, 104, 8, 0, 0, 
-    0, 0, 0, 0, 0, 101, 110, 100, 115, 119, 
-    105, 116, 104, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
-    104, 4, 0, 0, 0, 0, 0, 0, 0, 114, 
-    111, 111, 116, 32, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 117, 110, 112, 97, 
-    99, 107, 95, 117, 105, 110, 116, 49, 54, 46, 
-    56, 51, 58, 48, 0, 23, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 33, 1, 0, 32, 
-    2, 0, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 30, 3, 1, 6, 1, 0, 3, 0, 79, 
-    2, 1, 22, 1, 3, 0, 0, 0, 26, 2, 
-    10, 2, 0, 0, 40, 1, 0, 33, 1, 1, 
-    34, 2, 1, 2, 32, 3, 0, 30, 1, 2, 
-    74, 3, 74, 1, 10, 2, 2, 0, 75, 1, 
-    199, 75, 1, 173, 41, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 
+    0, 0, 0, 0, 41, 0, 30, 1, 6, 41, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 2, 47, 
-    0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 
-    118, 101, 114, 116, 32, 50, 32, 98, 121, 116, 
-    101, 115, 32, 105, 110, 32, 108, 105, 116, 116, 
-    108, 101, 45, 101, 110, 100, 105, 97, 110, 32, 
-    116, 111, 32, 97, 110, 32, 105, 110, 116, 101, 
-    103, 101, 114, 46, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 2, 6, 0, 0, 0, 0, 0, 
-    0, 0, 108, 105, 116, 116, 108, 101, 0, 0, 
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
+    0, 2, 30, 0, 0, 0, 0, 0, 0, 0, 
+    82, 101, 112, 108, 97, 99, 101, 109, 101, 110, 
+    116, 32, 102, 111, 114, 32, 111, 115, 46, 112, 
+    97, 116, 104, 46, 105, 115, 97, 98, 115, 46, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    1, 0, 0, 0, 0, 0, 0, 0, 47, 2, 
+    1, 0, 0, 0, 0, 0, 0, 0, 92, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 2, 
+    0, 0, 0, 0, 0, 0, 0, 92, 92, 6, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 
-    0, 0, 0, 0, 0, 95, 117, 110, 112, 97, 
-    99, 107, 95, 117, 105, 110, 116, 49, 54, 3, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    11, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
+    97, 116, 104, 95, 105, 115, 97, 98, 115, 6, 
     0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 108, 101, 110, 3, 0, 
-    0, 0, 0, 0, 0, 0, 105, 110, 116, 10, 
-    0, 0, 0, 0, 0, 0, 0, 102, 114, 111, 
-    109, 95, 98, 121, 116, 101, 115, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 100, 97, 116, 97, 32, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 47, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 70, 105, 108, 
-    101, 70, 105, 110, 100, 101, 114, 46, 112, 97, 
-    116, 104, 95, 104, 111, 111, 107, 46, 49, 53, 
-    57, 53, 58, 52, 0, 13, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 30, 1, 1, 29, 
-    0, 0, 29, 2, 1, 74, 0, 74, 2, 4, 
-    3, 2, 75, 1, 0, 75, 1, 142, 36, 4, 
-    1, 0, 0, 1, 3, 45, 2, 4, 32, 1, 
-    2, 41, 1, 2, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 95, 111, 115, 3, 0, 
+    0, 0, 0, 0, 0, 0, 108, 101, 110, 15, 
+    0, 0, 0, 0, 0, 0, 0, 95, 112, 97, 
+    116, 104, 95, 115, 112, 108, 105, 116, 114, 111, 
+    111, 116, 7, 0, 0, 0, 0, 0, 0, 0, 
+    114, 101, 112, 108, 97, 99, 101, 10, 0, 0, 
+    0, 0, 0, 0, 0, 115, 116, 97, 114, 116, 
+    115, 119, 105, 116, 104, 8, 0, 0, 0, 0, 
+    0, 0, 0, 101, 110, 100, 115, 119, 105, 116, 
+    104, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 4, 
+    0, 0, 0, 0, 0, 0, 0, 114, 111, 111, 
+    116, 33, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 95, 117, 110, 112, 97, 99, 107, 
+    95, 117, 105, 110, 116, 49, 54, 46, 56, 51, 
+    58, 48, 0, 19, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 33, 1, 0, 32, 2, 0, 
+    74, 2, 10, 1, 1, 0, 75, 1, 0, 30, 
+    3, 1, 6, 1, 0, 3, 0, 79, 2, 1, 
+    22, 1, 3, 0, 0, 0, 26, 2, 10, 2, 
+    0, 0, 40, 1, 0, 33, 1, 1, 34, 2, 
+    1, 2, 1, 32, 32, 3, 0, 30, 1, 2, 
+    38, 2, 32, 2, 0, 0, 0, 0, 0, 0, 
+    0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 99, 108, 115, 14, 0, 0, 0, 0, 0, 
-    0, 0, 108, 111, 97, 100, 101, 114, 95, 100, 
-    101, 116, 97, 105, 108, 115, 2, 0, 0, 0, 
-    0, 0, 0, 0, 2, 20, 1, 0, 0, 0, 
-    0, 0, 0, 65, 32, 99, 108, 97, 115, 115, 
-    32, 109, 101, 116, 104, 111, 100, 32, 119, 104, 
-    105, 99, 104, 32, 114, 101, 116, 117, 114, 110, 
-    115, 32, 97, 32, 99, 108, 111, 115, 117, 114, 
-    101, 32, 116, 111, 32, 117, 115, 101, 32, 111, 
-    110, 32, 115, 121, 115, 46, 112, 97, 116, 104, 
-    95, 104, 111, 111, 107, 10, 32, 32, 32, 32, 
-    32, 32, 32, 32, 119, 104, 105, 99, 104, 32, 
-    119, 105, 108, 108, 32, 114, 101, 116, 117, 114, 
-    110, 32, 97, 110, 32, 105, 110, 115, 116, 97, 
-    110, 99, 101, 32, 117, 115, 105, 110, 103, 32, 
-    116, 104, 101, 32, 115, 112, 101, 99, 105, 102, 
-    105, 101, 100, 32, 108, 111, 97, 100, 101, 114, 
-    115, 32, 97, 110, 100, 32, 116, 104, 101, 32, 
-    112, 97, 116, 104, 10, 32, 32, 32, 32, 32, 
-    32, 32, 32, 99, 97, 108, 108, 101, 100, 32, 
-    111, 110, 32, 116, 104, 101, 32, 99, 108, 111, 
-    115, 117, 114, 101, 46, 10, 10, 32, 32, 32, 
-    32, 32, 32, 32, 32, 73, 102, 32, 116, 104, 
-    101, 32, 112, 97, 116, 104, 32, 99, 97, 108, 
-    108, 101, 100, 32, 111, 110, 32, 116, 104, 101, 
-    32, 99, 108, 111, 115, 117, 114, 101, 32, 105, 
-    115, 32, 110, 111, 116, 32, 97, 32, 100, 105, 
-    114, 101, 99, 116, 111, 114, 121, 44, 32, 73, 
-    109, 112, 111, 114, 116, 69, 114, 114, 111, 114, 
-    32, 105, 115, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 114, 97, 105, 115, 101, 100, 46, 10, 
-    10, 32, 32, 32, 32, 32, 32, 32, 32, 2, 
-    72, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
-    108, 101, 70, 105, 110, 100, 101, 114, 46, 112, 
-    97, 116, 104, 95, 104, 111, 111, 107, 46, 112, 
-    97, 116, 104, 95, 104, 111, 111, 107, 95, 102, 
-    111, 114, 95, 70, 105, 108, 101, 70, 105, 110, 
-    100, 101, 114, 46, 49, 54, 48, 53, 58, 56, 
+    0, 2, 47, 0, 0, 0, 0, 0, 0, 0, 
+    67, 111, 110, 118, 101, 114, 116, 32, 50, 32, 
+    98, 121, 116, 101, 115, 32, 105, 110, 32, 108, 
+    105, 116, 116, 108, 101, 45, 101, 110, 100, 105, 
+    97, 110, 32, 116, 111, 32, 97, 110, 32, 105, 
+    110, 116, 101, 103, 101, 114, 46, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 2, 6, 0, 0, 
+    0, 0, 0, 0, 0, 108, 105, 116, 116, 108, 
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    14, 0, 0, 0, 0, 0, 0, 0, 95, 117, 
+    110, 112, 97, 99, 107, 95, 117, 105, 110, 116, 
+    49, 54, 3, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 108, 101, 
+    110, 3, 0, 0, 0, 0, 0, 0, 0, 105, 
+    110, 116, 10, 0, 0, 0, 0, 0, 0, 0, 
+    102, 114, 111, 109, 95, 98, 121, 116, 101, 115, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
     0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 100, 97, 116, 97, 32, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    70, 105, 108, 101, 70, 105, 110, 100, 101, 114, 
+    46, 112, 97, 116, 104, 95, 104, 111, 111, 107, 
+    46, 49, 53, 57, 53, 58, 52, 0, 13, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 30, 
+    1, 1, 29, 0, 0, 29, 2, 1, 74, 0, 
+    74, 2, 4, 3, 2, 75, 1, 0, 75, 1, 
+    142, 36, 4, 1, 0, 0, 1, 3, 45, 2, 
+    4, 32, 1, 2, 41, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 99, 108, 115, 14, 0, 0, 0, 0, 
+    0, 0, 0, 108, 111, 97, 100, 101, 114, 95, 
+    100, 101, 116, 97, 105, 108, 115, 2, 0, 0, 
+    0, 0, 0, 0, 0, 2, 20, 1, 0, 0, 
+    0, 0, 0, 0, 65, 32, 99, 108, 97, 115, 
+    115, 32, 109, 101, 116, 104, 111, 100, 32, 119, 
+    104, 105, 99, 104, 32, 114, 101, 116, 117, 114, 
+    110, 115, 32, 97, 32, 99, 108, 111, 115, 117, 
+    114, 101, 32, 116, 111, 32, 117, 115, 101, 32, 
+    111, 110, 32, 115, 121, 115, 46, 112, 97, 116, 
+    104, 95, 104, 111, 111, 107, 10, 32, 32, 32, 
+    32, 32, 32, 32, 32, 119, 104, 105, 99, 104, 
+    32, 119, 105, 108, 108, 32, 114, 101, 116, 117, 
+    114, 110, 32, 97, 110, 32, 105, 110, 115, 116, 
+    97, 110, 99, 101, 32, 117, 115, 105, 110, 103, 
+    32, 116, 104, 101, 32, 115, 112, 101, 99, 105, 
+    102, 105, 101, 100, 32, 108, 111, 97, 100, 101, 
+    114, 115, 32, 97, 110, 100, 32, 116, 104, 101, 
+    32, 112, 97, 116, 104, 10, 32, 32, 32, 32, 
+    32, 32, 32, 32, 99, 97, 108, 108, 101, 100, 
+    32, 111, 110, 32, 116, 104, 101, 32, 99, 108, 
+    111, 115, 117, 114, 101, 46, 10, 10, 32, 32, 
+    32, 32, 32, 32, 32, 32, 73, 102, 32, 116, 
+    104, 101, 32, 112, 97, 116, 104, 32, 99, 97, 
+    108, 108, 101, 100, 32, 111, 110, 32, 116, 104, 
+    101, 32, 99, 108, 111, 115, 117, 114, 101, 32, 
+    105, 115, 32, 110, 111, 116, 32, 97, 32, 100, 
+    105, 114, 101, 99, 116, 111, 114, 121, 44, 32, 
+    73, 109, 112, 111, 114, 116, 69, 114, 114, 111, 
+    114, 32, 105, 115, 10, 32, 32, 32, 32, 32, 
+    32, 32, 32, 114, 97, 105, 115, 101, 100, 46, 
+    10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+    2, 72, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 70, 
+    105, 108, 101, 70, 105, 110, 100, 101, 114, 46, 
+    112, 97, 116, 104, 95, 104, 111, 111, 107, 46, 
+    112, 97, 116, 104, 95, 104, 111, 111, 107, 95, 
+    102, 111, 114, 95, 70, 105, 108, 101, 70, 105, 
+    110, 100, 101, 114, 46, 49, 54, 48, 53, 58, 
+    56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 9, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
-    104, 95, 104, 111, 111, 107, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 99, 108, 
-    115, 14, 0, 0, 0, 0, 0, 0, 0, 108, 
-    111, 97, 100, 101, 114, 95, 100, 101, 116, 97, 
-    105, 108, 115, 24, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 95, 104, 111, 111, 107, 
-    95, 102, 111, 114, 95, 70, 105, 108, 101, 70, 
-    105, 110, 100, 101, 114, 32, 0, 0, 0, 0, 
-    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
-    0, 24, 0, 0, 0, 0, 0, 0, 0, 49, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 115, 112, 101, 
-    99, 95, 102, 114, 111, 109, 95, 102, 105, 108, 
-    101, 95, 108, 111, 99, 97, 116, 105, 111, 110, 
-    46, 54, 57, 53, 58, 48, 0, 178, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 32, 1, 
-    1, 30, 0, 1, 6, 2, 1, 0, 6, 79, 
-    3, 2, 22, 2, 8, 0, 0, 0, 33, 0, 
-    2, 34, 1, 0, 16, 32, 2, 1, 74, 2, 
-    10, 1, 1, 0, 75, 1, 0, 45, 1, 0, 
-    17, 30, 0, 0, 0, 30, 0, 2, 45, 1, 
-    0, 33, 2, 0, 32, 1, 2, 30, 3, 3, 
-    74, 1, 74, 3, 10, 2, 2, 0, 75, 1, 
-    0, 75, 1, 0, 79, 4, 0, 19, 0, 17, 
-    0, 0, 0, 42, 1, 0, 0, 0, 17, 5, 
-    0, 0, 0, 33, 0, 1, 21, 0, 2, 0, 
-    0, 0, 5, 17, 10, 0, 0, 0, 52, 32, 
-    0, 2, 34, 1, 0, 8, 32, 2, 0, 74, 
-    2, 10, 1, 1, 0, 75, 1, 0, 45, 1, 
-    0, 54, 17, 0, 0, 0, 0, 17, 0, 0, 
-    0, 0, 17, 0, 0, 0, 0, 33, 0, 3, 
-    34, 1, 0, 9, 32, 2, 0, 32, 3, 2, 
-    32, 4, 1, 12, 1, 2, 0, 0, 0, 0, 
-    0, 0, 0, 2, 3, 1, 0, 0, 0, 0, 
-    0, 0, 0, 4, 1, 0, 0, 0, 0, 0, 
-    0, 0, 17, 45, 4, 0, 30, 1, 4, 32, 
-    0, 4, 43, 0, 1, 10, 32, 2, 2, 30, 
-    0, 1, 6, 1, 2, 0, 6, 79, 3, 1, 
-    19, 1, 46, 0, 0, 0, 33, 2, 4, 10, 
-    2, 0, 0, 13, 1, 0, 17, 0, 0, 0, 
-    0, 9, 0, 1, 24, 0, 0, 0, 0, 0, 
-    0, 0, 50, 2, 0, 0, 0, 0, 0, 0, 
-    0, 2, 3, 0, 45, 6, 2, 45, 5, 3, 
-    17, 0, 0, 0, 0, 32, 2, 1, 34, 3, 
-    2, 11, 33, 4, 5, 32, 2, 5, 74, 0, 
-    74, 2, 10, 4, 1, 0, 75, 1, 111, 39, 
-    5, 0, 75, 0, 0, 74, 0, 74, 5, 10, 
-    3, 1, 0, 75, 1, 0, 39, 6, 0, 75, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    9, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    116, 104, 95, 104, 111, 111, 107, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
+    108, 115, 14, 0, 0, 0, 0, 0, 0, 0, 
+    108, 111, 97, 100, 101, 114, 95, 100, 101, 116, 
+    97, 105, 108, 115, 24, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 116, 104, 95, 104, 111, 111, 
+    107, 95, 102, 111, 114, 95, 70, 105, 108, 101, 
+    70, 105, 110, 100, 101, 114, 33, 0, 0, 0, 
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
+    0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 
+    49, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 115, 112, 
+    101, 99, 95, 102, 114, 111, 109, 95, 102, 105, 
+    108, 101, 95, 108, 111, 99, 97, 116, 105, 111, 
+    110, 46, 54, 57, 53, 58, 48, 0, 164, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 32, 
+    1, 1, 30, 0, 1, 6, 2, 1, 0, 6, 
+    79, 3, 2, 22, 2, 6, 0, 0, 0, 33, 
+    0, 2, 34, 1, 0, 16, 1, 32, 32, 2, 
+    1, 38, 1, 32, 1, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 
+    1, 0, 17, 26, 0, 0, 0, 30, 0, 2, 
+    45, 1, 0, 33, 2, 0, 32, 1, 2, 30, 
+    3, 3, 74, 1, 74, 3, 10, 2, 2, 0, 
+    75, 1, 0, 75, 1, 0, 79, 4, 0, 19, 
+    0, 13, 0, 0, 0, 17, 5, 0, 0, 0, 
+    33, 0, 1, 21, 0, 2, 0, 0, 0, 5, 
+    17, 7, 0, 0, 0, 52, 32, 0, 2, 34, 
+    1, 0, 8, 1, 32, 32, 2, 0, 38, 1, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 45, 1, 0, 17, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 
+    0, 0, 0, 0, 33, 0, 3, 34, 1, 0, 
+    9, 0, 0, 32, 2, 0, 32, 3, 2, 32, 
+    4, 1, 12, 1, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 3, 1, 0, 0, 0, 0, 0, 
+    0, 0, 4, 1, 0, 0, 0, 0, 0, 0, 
+    0, 17, 45, 4, 0, 30, 1, 4, 32, 0, 
+    4, 43, 0, 1, 10, 32, 2, 2, 30, 0, 
+    1, 6, 1, 2, 0, 6, 79, 3, 1, 19, 
+    1, 44, 0, 0, 0, 33, 2, 4, 10, 2, 
+    0, 0, 13, 1, 0, 17, 0, 0, 0, 0, 
+    9, 0, 1, 22, 0, 0, 0, 0, 0, 0, 
+    0, 50, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 3, 0, 45, 6, 2, 45, 5, 3, 17, 
+    0, 0, 0, 0, 32, 2, 1, 34, 3, 2, 
+    11, 1, 32, 33, 4, 5, 32, 2, 5, 74, 
+    0, 74, 2, 10, 4, 1, 0, 75, 1, 111, 
+    39, 5, 0, 75, 0, 0, 74, 0, 38, 3, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 39, 6, 0, 75, 
     0, 0, 79, 2, 6, 22, 6, 4, 0, 0, 
     0, 17, 0, 0, 0, 0, 9, 0, 1, 0, 
-    0, 0, 0, 232, 255, 255, 255, 30, 2, 1, 
+    0, 0, 0, 234, 255, 255, 255, 30, 2, 1, 
     41, 2, 32, 1, 6, 32, 2, 0, 32, 3, 
     1, 74, 2, 74, 3, 10, 1, 2, 0, 75, 
     1, 172, 75, 1, 227, 45, 2, 0, 32, 1, 
@@ -6176,30 +6598,44 @@ std::vector<uint8_t> _bootstrap_external
     0, 0, 0, 32, 0, 3, 33, 1, 6, 6, 
     2, 0, 1, 6, 79, 3, 2, 22, 2, 4, 
     0, 0, 0, 32, 0, 3, 32, 1, 4, 43, 
-    1, 0, 14, 17, 36, 0, 0, 0, 33, 1, 
+    1, 0, 14, 17, 32, 0, 0, 0, 33, 1, 
     0, 32, 2, 2, 30, 3, 5, 74, 2, 74, 
     3, 10, 1, 2, 0, 75, 1, 172, 75, 1, 
-    173, 79, 4, 0, 19, 0, 25, 0, 0, 0, 
-    42, 1, 0, 0, 0, 17, 5, 0, 0, 0, 
-    33, 0, 1, 21, 0, 2, 0, 0, 0, 5, 
-    17, 18, 0, 0, 0, 52, 32, 0, 2, 34, 
-    1, 0, 13, 32, 2, 0, 74, 2, 10, 1, 
-    1, 0, 75, 1, 173, 45, 7, 0, 54, 17, 
-    0, 0, 0, 0, 32, 0, 7, 79, 1, 0, 
-    19, 0, 4, 0, 0, 0, 3, 1, 0, 32, 
-    0, 4, 43, 0, 1, 14, 17, 0, 0, 0, 
+    173, 79, 4, 0, 19, 0, 21, 0, 0, 0, 
+    17, 5, 0, 0, 0, 33, 0, 1, 21, 0, 
+    2, 0, 0, 0, 5, 17, 15, 0, 0, 0, 
+    52, 32, 0, 2, 34, 1, 0, 13, 1, 32, 
+    32, 2, 0, 38, 1, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 45, 7, 0, 17, 0, 0, 0, 0, 32, 
+    0, 7, 79, 1, 0, 19, 0, 4, 0, 0, 
+    0, 3, 1, 0, 32, 0, 4, 43, 0, 1, 
+    14, 17, 0, 0, 0, 0, 17, 0, 0, 0, 
     0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 
-    0, 17, 0, 0, 0, 0, 32, 0, 4, 27, 
-    1, 0, 14, 3, 2, 0, 6, 0, 1, 2, 
-    0, 79, 3, 0, 19, 0, 20, 0, 0, 0, 
-    32, 1, 1, 79, 0, 1, 19, 1, 16, 0, 
-    0, 0, 33, 2, 7, 32, 1, 1, 74, 1, 
-    10, 2, 1, 0, 75, 1, 12, 30, 3, 6, 
-    1, 1, 0, 3, 45, 8, 1, 32, 0, 4, 
-    27, 1, 0, 14, 34, 2, 1, 15, 32, 3, 
-    8, 74, 3, 10, 2, 1, 0, 75, 1, 172, 
-    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
-    32, 0, 4, 41, 0, 0, 0, 0, 0, 0, 
+    0, 32, 0, 4, 27, 1, 0, 14, 3, 2, 
+    0, 6, 0, 1, 2, 0, 79, 3, 0, 19, 
+    0, 18, 0, 0, 0, 32, 1, 1, 79, 0, 
+    1, 19, 1, 14, 0, 0, 0, 33, 2, 7, 
+    32, 1, 1, 74, 1, 10, 2, 1, 0, 75, 
+    1, 12, 30, 3, 6, 1, 1, 0, 3, 45, 
+    8, 1, 32, 0, 4, 27, 1, 0, 14, 34, 
+    2, 1, 15, 1, 32, 32, 3, 8, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 17, 0, 0, 0, 0, 32, 0, 4, 41, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 24, 
+    0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 
+    0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 
+    0, 35, 0, 0, 0, 0, 0, 0, 0, 25, 
+    0, 0, 0, 0, 0, 0, 0, 116, 0, 0, 
+    0, 0, 0, 0, 0, 117, 0, 0, 0, 0, 
+    0, 0, 0, 117, 0, 0, 0, 0, 0, 0, 
+    0, 122, 0, 0, 0, 0, 0, 0, 0, 127, 
+    0, 0, 0, 0, 0, 0, 0, 117, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 
     0, 0, 0, 0, 0, 0, 0, 2, 61, 1, 
@@ -6308,19 +6744,24 @@ std::vector<uint8_t> _bootstrap_external
     116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
     101, 114, 110, 97, 108, 46, 95, 99, 104, 101, 
     99, 107, 95, 110, 97, 109, 101, 46, 53, 49, 
-    52, 58, 48, 0, 36, 0, 0, 0, 0, 0, 
+    52, 58, 48, 0, 34, 0, 0, 0, 0, 0, 
     0, 0, 30, 0, 0, 30, 1, 1, 30, 0, 
     2, 29, 2, 0, 74, 2, 4, 3, 1, 75, 
     1, 0, 74, 1, 36, 4, 0, 1, 0, 1, 
-    3, 75, 1, 0, 45, 1, 4, 42, 1, 0, 
-    0, 0, 17, 8, 0, 0, 0, 33, 0, 1, 
-    21, 0, 5, 0, 0, 0, 30, 1, 3, 36, 
-    0, 1, 0, 0, 0, 0, 45, 2, 0, 5, 
-    17, 6, 0, 0, 0, 52, 33, 0, 0, 27, 
-    1, 0, 2, 45, 2, 1, 54, 17, 0, 0, 
-    0, 0, 32, 1, 2, 32, 2, 1, 31, 3, 
-    0, 74, 2, 74, 3, 10, 1, 2, 0, 75, 
-    1, 173, 75, 1, 0, 32, 4, 1, 41, 4, 
+    3, 75, 1, 0, 45, 1, 4, 17, 8, 0, 
+    0, 0, 33, 0, 1, 21, 0, 5, 0, 0, 
+    0, 30, 1, 3, 36, 0, 1, 0, 0, 0, 
+    0, 45, 2, 0, 5, 17, 5, 0, 0, 0, 
+    52, 33, 0, 0, 27, 1, 0, 2, 45, 2, 
+    1, 17, 0, 0, 0, 0, 32, 1, 2, 32, 
+    2, 1, 31, 3, 0, 74, 2, 74, 3, 10, 
+    1, 2, 0, 75, 1, 173, 75, 1, 0, 32, 
+    4, 1, 41, 4, 2, 0, 0, 0, 0, 0, 
+    0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
+    12, 0, 0, 0, 0, 0, 0, 0, 12, 0, 
+    0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 
+    0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 
+    0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 
     1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
@@ -6383,7 +6824,7 @@ std::vector<uint8_t> _bootstrap_external
     0, 0, 0, 0, 0, 0, 95, 99, 104, 101, 
     99, 107, 95, 110, 97, 109, 101, 95, 119, 114, 
     97, 112, 112, 101, 114, 5, 0, 0, 0, 0, 
-    0, 0, 0, 95, 119, 114, 97, 112, 32, 0, 
+    0, 0, 0, 95, 119, 114, 97, 112, 33, 0, 
     0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 
@@ -6392,765 +6833,817 @@ std::vector<uint8_t> _bootstrap_external
     95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
     80, 97, 116, 104, 46, 95, 95, 114, 101, 112, 
     114, 95, 95, 46, 49, 50, 54, 50, 58, 52, 
-    0, 8, 0, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 34, 1, 0, 0, 32, 2, 0, 27, 
-    3, 2, 1, 74, 3, 10, 1, 1, 0, 75, 
-    1, 0, 41, 0, 0, 0, 0, 0, 0, 0, 
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 34, 1, 0, 0, 1, 32, 32, 2, 
+    0, 27, 3, 2, 1, 38, 1, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 2, 20, 0, 0, 0, 
+    0, 0, 0, 0, 95, 78, 97, 109, 101, 115, 
+    112, 97, 99, 101, 80, 97, 116, 104, 40, 123, 
+    33, 114, 125, 41, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 114, 101, 112, 114, 95, 95, 2, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 102, 111, 114, 109, 97, 
+    116, 5, 0, 0, 0, 0, 0, 0, 0, 95, 
+    112, 97, 116, 104, 0, 0, 0, 0, 0, 0, 
     0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 33, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 95, 117, 110, 112, 97, 99, 
+    107, 95, 117, 105, 110, 116, 51, 50, 46, 55, 
+    56, 58, 48, 0, 19, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 33, 1, 0, 32, 2, 
+    0, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
+    30, 3, 1, 6, 1, 0, 3, 0, 79, 2, 
+    1, 22, 1, 3, 0, 0, 0, 26, 2, 10, 
+    2, 0, 0, 40, 1, 0, 33, 1, 1, 34, 
+    2, 1, 2, 1, 32, 32, 3, 0, 30, 1, 
+    2, 38, 2, 32, 2, 0, 0, 0, 0, 0, 
+    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 2, 20, 0, 0, 
-    0, 0, 0, 0, 0, 95, 78, 97, 109, 101, 
-    115, 112, 97, 99, 101, 80, 97, 116, 104, 40, 
-    123, 33, 114, 125, 41, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 2, 47, 0, 0, 0, 0, 0, 0, 
+    0, 67, 111, 110, 118, 101, 114, 116, 32, 52, 
+    32, 98, 121, 116, 101, 115, 32, 105, 110, 32, 
+    108, 105, 116, 116, 108, 101, 45, 101, 110, 100, 
+    105, 97, 110, 32, 116, 111, 32, 97, 110, 32, 
+    105, 110, 116, 101, 103, 101, 114, 46, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 2, 6, 0, 
+    0, 0, 0, 0, 0, 0, 108, 105, 116, 116, 
+    108, 101, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 114, 101, 112, 114, 95, 95, 
-    2, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
-    0, 0, 0, 0, 0, 0, 102, 111, 114, 109, 
-    97, 116, 5, 0, 0, 0, 0, 0, 0, 0, 
-    95, 112, 97, 116, 104, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 32, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 117, 110, 112, 97, 
-    99, 107, 95, 117, 105, 110, 116, 51, 50, 46, 
-    55, 56, 58, 48, 0, 23, 0, 0, 0, 0, 
-    0, 0, 0, 30, 0, 0, 33, 1, 0, 32, 
-    2, 0, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 30, 3, 1, 6, 1, 0, 3, 0, 79, 
-    2, 1, 22, 1, 3, 0, 0, 0, 26, 2, 
-    10, 2, 0, 0, 40, 1, 0, 33, 1, 1, 
-    34, 2, 1, 2, 32, 3, 0, 30, 1, 2, 
-    74, 3, 74, 1, 10, 2, 2, 0, 75, 1, 
-    80, 75, 1, 173, 41, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 2, 47, 
-    0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 
-    118, 101, 114, 116, 32, 52, 32, 98, 121, 116, 
-    101, 115, 32, 105, 110, 32, 108, 105, 116, 116, 
-    108, 101, 45, 101, 110, 100, 105, 97, 110, 32, 
-    116, 111, 32, 97, 110, 32, 105, 110, 116, 101, 
-    103, 101, 114, 46, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 2, 6, 0, 0, 0, 0, 0, 
-    0, 0, 108, 105, 116, 116, 108, 101, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 95, 
+    117, 110, 112, 97, 99, 107, 95, 117, 105, 110, 
+    116, 51, 50, 3, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 108, 
+    101, 110, 3, 0, 0, 0, 0, 0, 0, 0, 
+    105, 110, 116, 10, 0, 0, 0, 0, 0, 0, 
+    0, 102, 114, 111, 109, 95, 98, 121, 116, 101, 
+    115, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 100, 97, 116, 97, 32, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 70, 105, 108, 101, 76, 111, 97, 100, 101, 
+    114, 46, 95, 95, 104, 97, 115, 104, 95, 95, 
+    46, 49, 48, 49, 53, 58, 52, 0, 17, 0, 
+    0, 0, 0, 0, 0, 0, 33, 1, 0, 32, 
+    2, 0, 27, 3, 2, 1, 74, 3, 10, 1, 
+    1, 0, 75, 1, 0, 33, 2, 0, 32, 1, 
+    0, 27, 3, 1, 2, 74, 0, 74, 3, 10, 
+    2, 1, 0, 75, 1, 0, 39, 4, 0, 75, 
+    0, 0, 0, 1, 0, 4, 11, 41, 1, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 
-    0, 0, 0, 0, 0, 95, 117, 110, 112, 97, 
-    99, 107, 95, 117, 105, 110, 116, 51, 50, 3, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 108, 101, 110, 3, 0, 
-    0, 0, 0, 0, 0, 0, 105, 110, 116, 10, 
-    0, 0, 0, 0, 0, 0, 0, 102, 114, 111, 
-    109, 95, 98, 121, 116, 101, 115, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 104, 97, 
+    115, 104, 95, 95, 3, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    104, 97, 115, 104, 4, 0, 0, 0, 0, 0, 
+    0, 0, 110, 97, 109, 101, 4, 0, 0, 0, 
+    0, 0, 0, 0, 112, 97, 116, 104, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 115, 101, 108, 102, 33, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    57, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
+    108, 101, 76, 111, 97, 100, 101, 114, 46, 103, 
+    101, 116, 95, 114, 101, 115, 111, 117, 114, 99, 
+    101, 95, 114, 101, 97, 100, 101, 114, 46, 49, 
+    48, 52, 54, 58, 52, 0, 10, 0, 0, 0, 
+    0, 0, 0, 0, 32, 0, 0, 34, 1, 0, 
+    0, 1, 32, 32, 2, 1, 38, 1, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 79, 3, 0, 22, 0, 2, 
+    0, 0, 0, 30, 1, 0, 41, 1, 32, 0, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 100, 97, 116, 97, 32, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 46, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 70, 105, 108, 
-    101, 76, 111, 97, 100, 101, 114, 46, 95, 95, 
-    104, 97, 115, 104, 95, 95, 46, 49, 48, 49, 
-    53, 58, 52, 0, 17, 0, 0, 0, 0, 0, 
-    0, 0, 33, 1, 0, 32, 2, 0, 27, 3, 
-    2, 1, 74, 3, 10, 1, 1, 0, 75, 1, 
-    0, 33, 2, 0, 32, 1, 0, 27, 3, 1, 
-    2, 74, 0, 74, 3, 10, 2, 1, 0, 75, 
-    1, 0, 39, 4, 0, 75, 0, 0, 0, 1, 
-    0, 4, 11, 41, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 
+    0, 103, 101, 116, 95, 114, 101, 115, 111, 117, 
+    114, 99, 101, 95, 114, 101, 97, 100, 101, 114, 
+    1, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
+    0, 0, 0, 0, 0, 0, 105, 115, 95, 112, 
+    97, 99, 107, 97, 103, 101, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 6, 0, 0, 0, 0, 0, 
+    0, 0, 109, 111, 100, 117, 108, 101, 33, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
+    0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
+    46, 111, 112, 101, 110, 95, 114, 101, 115, 111, 
+    117, 114, 99, 101, 46, 49, 48, 53, 50, 58, 
+    52, 0, 22, 0, 0, 0, 0, 0, 0, 0, 
+    33, 1, 0, 33, 2, 1, 32, 3, 0, 27, 
+    4, 3, 4, 74, 4, 10, 2, 1, 0, 75, 
+    1, 0, 30, 3, 0, 1, 2, 0, 3, 32, 
+    4, 1, 74, 2, 74, 4, 10, 1, 2, 0, 
+    75, 1, 0, 75, 1, 0, 45, 2, 0, 33, 
+    1, 2, 34, 2, 1, 3, 1, 32, 32, 3, 
+    2, 30, 1, 1, 38, 2, 32, 2, 0, 0, 
+    0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 
+    0, 0, 0, 114, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 104, 97, 115, 104, 
-    95, 95, 3, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 104, 97, 
-    115, 104, 4, 0, 0, 0, 0, 0, 0, 0, 
-    110, 97, 109, 101, 4, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 
+    0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 
+    0, 111, 112, 101, 110, 95, 114, 101, 115, 111, 
+    117, 114, 99, 101, 5, 0, 0, 0, 0, 0, 
+    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 95, 106, 111, 105, 110, 
+    11, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
+    97, 116, 104, 95, 115, 112, 108, 105, 116, 3, 
+    0, 0, 0, 0, 0, 0, 0, 95, 105, 111, 
+    6, 0, 0, 0, 0, 0, 0, 0, 70, 105, 
+    108, 101, 73, 79, 4, 0, 0, 0, 0, 0, 
     0, 0, 112, 97, 116, 104, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
     0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 32, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 57, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 70, 105, 108, 101, 
-    76, 111, 97, 100, 101, 114, 46, 103, 101, 116, 
-    95, 114, 101, 115, 111, 117, 114, 99, 101, 95, 
-    114, 101, 97, 100, 101, 114, 46, 49, 48, 52, 
-    54, 58, 52, 0, 12, 0, 0, 0, 0, 0, 
-    0, 0, 32, 0, 0, 34, 1, 0, 0, 32, 
-    2, 1, 74, 2, 10, 1, 1, 0, 75, 1, 
-    0, 79, 3, 0, 22, 0, 2, 0, 0, 0, 
-    30, 1, 0, 41, 1, 32, 0, 0, 41, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    115, 101, 108, 102, 8, 0, 0, 0, 0, 0, 
+    0, 0, 114, 101, 115, 111, 117, 114, 99, 101, 
+    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    116, 104, 34, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
+    0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 95, 102, 105, 110, 100, 95, 
+    109, 111, 100, 117, 108, 101, 95, 115, 104, 105, 
+    109, 46, 53, 52, 50, 58, 48, 0, 39, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 32, 
+    1, 0, 34, 2, 1, 3, 1, 32, 32, 3, 
+    1, 38, 2, 32, 1, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 4, 
+    0, 45, 2, 1, 45, 3, 4, 32, 1, 2, 
+    30, 2, 1, 6, 0, 1, 2, 6, 79, 3, 
+    0, 19, 0, 6, 0, 0, 0, 33, 1, 0, 
+    32, 2, 3, 74, 2, 10, 1, 1, 0, 75, 
+    1, 0, 17, 0, 0, 0, 0, 79, 1, 0, 
+    19, 0, 16, 0, 0, 0, 30, 1, 2, 45, 
+    4, 1, 33, 2, 1, 34, 1, 2, 4, 1, 
+    32, 32, 0, 4, 34, 2, 0, 5, 1, 33, 
+    32, 3, 3, 30, 4, 3, 1, 5, 3, 4, 
+    38, 2, 33, 1, 0, 0, 0, 0, 0, 0, 
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 33, 3, 
+    2, 74, 0, 38, 1, 32, 2, 0, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 39, 2, 0, 75, 0, 0, 17, 0, 
+    0, 0, 0, 32, 0, 2, 41, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 
-    103, 101, 116, 95, 114, 101, 115, 111, 117, 114, 
-    99, 101, 95, 114, 101, 97, 100, 101, 114, 1, 
-    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 105, 115, 95, 112, 97, 
-    99, 107, 97, 103, 101, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 6, 0, 0, 0, 0, 0, 0, 
-    0, 109, 111, 100, 117, 108, 101, 32, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
-    0, 51, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 70, 
-    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
-    111, 112, 101, 110, 95, 114, 101, 115, 111, 117, 
-    114, 99, 101, 46, 49, 48, 53, 50, 58, 52, 
-    0, 26, 0, 0, 0, 0, 0, 0, 0, 33, 
-    1, 0, 33, 2, 1, 32, 3, 0, 27, 4, 
-    3, 4, 74, 4, 10, 2, 1, 0, 75, 1, 
-    0, 30, 3, 0, 1, 2, 0, 3, 32, 4, 
-    1, 74, 2, 74, 4, 10, 1, 2, 0, 75, 
-    1, 0, 75, 1, 0, 45, 2, 0, 33, 1, 
-    2, 34, 2, 1, 3, 32, 3, 2, 30, 1, 
-    1, 74, 3, 74, 1, 10, 2, 2, 0, 75, 
-    1, 172, 75, 1, 172, 41, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 2, 155, 
+    0, 0, 0, 0, 0, 0, 0, 84, 114, 121, 
+    32, 116, 111, 32, 102, 105, 110, 100, 32, 97, 
+    32, 108, 111, 97, 100, 101, 114, 32, 102, 111, 
+    114, 32, 116, 104, 101, 32, 115, 112, 101, 99, 
+    105, 102, 105, 101, 100, 32, 109, 111, 100, 117, 
+    108, 101, 32, 98, 121, 32, 100, 101, 108, 101, 
+    103, 97, 116, 105, 110, 103, 32, 116, 111, 10, 
+    32, 32, 32, 32, 115, 101, 108, 102, 46, 102, 
+    105, 110, 100, 95, 108, 111, 97, 100, 101, 114, 
+    40, 41, 46, 10, 10, 32, 32, 32, 32, 84, 
+    104, 105, 115, 32, 109, 101, 116, 104, 111, 100, 
+    32, 105, 115, 32, 100, 101, 112, 114, 101, 99, 
+    97, 116, 101, 100, 32, 105, 110, 32, 102, 97, 
+    118, 111, 114, 32, 111, 102, 32, 102, 105, 110, 
+    100, 101, 114, 46, 102, 105, 110, 100, 95, 115, 
+    112, 101, 99, 40, 41, 46, 10, 10, 32, 32, 
+    32, 32, 5, 2, 44, 0, 0, 0, 0, 0, 
+    0, 0, 78, 111, 116, 32, 105, 109, 112, 111, 
+    114, 116, 105, 110, 103, 32, 100, 105, 114, 101, 
+    99, 116, 111, 114, 121, 32, 123, 125, 58, 32, 
+    109, 105, 115, 115, 105, 110, 103, 32, 95, 95, 
+    105, 110, 105, 116, 95, 95, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 
-    0, 0, 0, 0, 0, 0, 0, 114, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 
-    0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 
-    0, 0, 0, 0, 0, 111, 112, 101, 110, 95, 
-    114, 101, 115, 111, 117, 114, 99, 101, 5, 0, 
-    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
-    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    106, 111, 105, 110, 11, 0, 0, 0, 0, 0, 
-    0, 0, 95, 112, 97, 116, 104, 95, 115, 112, 
-    108, 105, 116, 3, 0, 0, 0, 0, 0, 0, 
-    0, 95, 105, 111, 6, 0, 0, 0, 0, 0, 
-    0, 0, 70, 105, 108, 101, 73, 79, 4, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 101, 108, 102, 8, 0, 
-    0, 0, 0, 0, 0, 0, 114, 101, 115, 111, 
-    117, 114, 99, 101, 4, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 116, 104, 32, 0, 0, 0, 
-    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
-    0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
-    43, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 95, 102, 
-    105, 110, 100, 95, 109, 111, 100, 117, 108, 101, 
-    95, 115, 104, 105, 109, 46, 53, 52, 50, 58, 
-    48, 0, 47, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 32, 1, 0, 34, 2, 1, 3, 
-    32, 3, 1, 74, 3, 10, 2, 1, 0, 75, 
-    1, 0, 50, 2, 0, 0, 0, 0, 0, 0, 
-    0, 1, 4, 0, 45, 2, 1, 45, 3, 4, 
-    32, 1, 2, 30, 2, 1, 6, 0, 1, 2, 
-    6, 79, 3, 0, 19, 0, 6, 0, 0, 0, 
-    33, 1, 0, 32, 2, 3, 74, 2, 10, 1, 
-    1, 0, 75, 1, 0, 17, 0, 0, 0, 0, 
-    79, 1, 0, 19, 0, 22, 0, 0, 0, 30, 
-    1, 2, 45, 4, 1, 33, 2, 1, 34, 1, 
-    2, 4, 32, 0, 4, 34, 2, 0, 5, 32, 
-    3, 3, 30, 4, 3, 1, 5, 3, 4, 74, 
-    5, 10, 2, 1, 0, 75, 1, 0, 33, 3, 
-    2, 74, 0, 74, 0, 74, 3, 10, 1, 2, 
-    0, 75, 1, 0, 75, 1, 0, 39, 2, 0, 
-    75, 0, 0, 17, 0, 0, 0, 0, 32, 0, 
-    2, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
+    0, 0, 95, 102, 105, 110, 100, 95, 109, 111, 
+    100, 117, 108, 101, 95, 115, 104, 105, 109, 6, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 108, 101, 110, 9, 0, 
+    0, 0, 0, 0, 0, 0, 95, 119, 97, 114, 
+    110, 105, 110, 103, 115, 13, 0, 0, 0, 0, 
+    0, 0, 0, 73, 109, 112, 111, 114, 116, 87, 
+    97, 114, 110, 105, 110, 103, 11, 0, 0, 0, 
+    0, 0, 0, 0, 102, 105, 110, 100, 95, 108, 
+    111, 97, 100, 101, 114, 4, 0, 0, 0, 0, 
+    0, 0, 0, 119, 97, 114, 110, 6, 0, 0, 
+    0, 0, 0, 0, 0, 102, 111, 114, 109, 97, 
+    116, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
     0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 2, 155, 0, 0, 0, 
-    0, 0, 0, 0, 84, 114, 121, 32, 116, 111, 
-    32, 102, 105, 110, 100, 32, 97, 32, 108, 111, 
-    97, 100, 101, 114, 32, 102, 111, 114, 32, 116, 
-    104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 
-    101, 100, 32, 109, 111, 100, 117, 108, 101, 32, 
-    98, 121, 32, 100, 101, 108, 101, 103, 97, 116, 
-    105, 110, 103, 32, 116, 111, 10, 32, 32, 32, 
-    32, 115, 101, 108, 102, 46, 102, 105, 110, 100, 
-    95, 108, 111, 97, 100, 101, 114, 40, 41, 46, 
-    10, 10, 32, 32, 32, 32, 84, 104, 105, 115, 
-    32, 109, 101, 116, 104, 111, 100, 32, 105, 115, 
-    32, 100, 101, 112, 114, 101, 99, 97, 116, 101, 
-    100, 32, 105, 110, 32, 102, 97, 118, 111, 114, 
-    32, 111, 102, 32, 102, 105, 110, 100, 101, 114, 
-    46, 102, 105, 110, 100, 95, 115, 112, 101, 99, 
-    40, 41, 46, 10, 10, 32, 32, 32, 32, 5, 
-    2, 44, 0, 0, 0, 0, 0, 0, 0, 78, 
-    111, 116, 32, 105, 109, 112, 111, 114, 116, 105, 
-    110, 103, 32, 100, 105, 114, 101, 99, 116, 111, 
-    114, 121, 32, 123, 125, 58, 32, 109, 105, 115, 
-    115, 105, 110, 103, 32, 95, 95, 105, 110, 105, 
-    116, 95, 95, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 115, 101, 108, 102, 8, 
+    0, 0, 0, 0, 0, 0, 0, 102, 117, 108, 
+    108, 110, 97, 109, 101, 6, 0, 0, 0, 0, 
+    0, 0, 0, 108, 111, 97, 100, 101, 114, 8, 
+    0, 0, 0, 0, 0, 0, 0, 112, 111, 114, 
+    116, 105, 111, 110, 115, 3, 0, 0, 0, 0, 
+    0, 0, 0, 109, 115, 103, 32, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    55, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 95, 78, 
+    97, 109, 101, 115, 112, 97, 99, 101, 76, 111, 
+    97, 100, 101, 114, 46, 101, 120, 101, 99, 95, 
+    109, 111, 100, 117, 108, 101, 46, 49, 50, 57, 
+    56, 58, 52, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 41, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 
-    0, 17, 0, 0, 0, 0, 0, 0, 0, 95, 
-    102, 105, 110, 100, 95, 109, 111, 100, 117, 108, 
-    101, 95, 115, 104, 105, 109, 6, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 108, 101, 110, 9, 0, 0, 0, 0, 
-    0, 0, 0, 95, 119, 97, 114, 110, 105, 110, 
-    103, 115, 13, 0, 0, 0, 0, 0, 0, 0, 
-    73, 109, 112, 111, 114, 116, 87, 97, 114, 110, 
-    105, 110, 103, 11, 0, 0, 0, 0, 0, 0, 
-    0, 102, 105, 110, 100, 95, 108, 111, 97, 100, 
-    101, 114, 4, 0, 0, 0, 0, 0, 0, 0, 
-    119, 97, 114, 110, 6, 0, 0, 0, 0, 0, 
-    0, 0, 102, 111, 114, 109, 97, 116, 0, 0, 
-    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 108, 102, 8, 0, 0, 0, 
-    0, 0, 0, 0, 102, 117, 108, 108, 110, 97, 
-    109, 101, 6, 0, 0, 0, 0, 0, 0, 0, 
-    108, 111, 97, 100, 101, 114, 8, 0, 0, 0, 
-    0, 0, 0, 0, 112, 111, 114, 116, 105, 111, 
-    110, 115, 3, 0, 0, 0, 0, 0, 0, 0, 
-    109, 115, 103, 32, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
-    115, 112, 97, 99, 101, 76, 111, 97, 100, 101, 
-    114, 46, 101, 120, 101, 99, 95, 109, 111, 100, 
-    117, 108, 101, 46, 49, 50, 57, 56, 58, 52, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 
+    0, 0, 0, 0, 0, 101, 120, 101, 99, 95, 
+    109, 111, 100, 117, 108, 101, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 6, 0, 0, 0, 0, 0, 0, 0, 
+    109, 111, 100, 117, 108, 101, 33, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    58, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 80, 97, 
+    116, 104, 70, 105, 110, 100, 101, 114, 46, 95, 
+    112, 97, 116, 104, 95, 105, 109, 112, 111, 114, 
+    116, 101, 114, 95, 99, 97, 99, 104, 101, 46, 
+    49, 51, 52, 53, 58, 52, 0, 44, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 32, 1, 
+    1, 30, 0, 1, 6, 2, 1, 0, 0, 79, 
+    3, 2, 19, 2, 14, 0, 0, 0, 17, 7, 
+    0, 0, 0, 33, 0, 1, 21, 0, 4, 0, 
+    0, 0, 30, 1, 2, 5, 17, 0, 0, 0, 
+    0, 41, 1, 52, 33, 1, 0, 34, 2, 1, 
+    4, 1, 32, 38, 2, 32, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
-    0, 0, 0, 0, 101, 120, 101, 99, 95, 109, 
-    111, 100, 117, 108, 101, 0, 0, 0, 0, 0, 
+    45, 1, 0, 17, 0, 0, 0, 0, 17, 0, 
+    0, 0, 0, 17, 15, 0, 0, 0, 33, 0, 
+    3, 21, 0, 12, 0, 0, 0, 32, 1, 0, 
+    34, 2, 1, 5, 1, 32, 32, 3, 1, 38, 
+    2, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 45, 2, 0, 
+    32, 2, 2, 33, 0, 2, 27, 1, 0, 6, 
+    32, 3, 1, 48, 1, 3, 2, 5, 17, 7, 
+    0, 0, 0, 52, 33, 0, 2, 27, 1, 0, 
+    6, 32, 2, 1, 1, 0, 1, 2, 45, 2, 
+    0, 17, 0, 0, 0, 0, 32, 0, 2, 41, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 6, 
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
+    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 
+    0, 18, 0, 0, 0, 0, 0, 0, 0, 7, 
+    0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 
+    0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 
+    0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 
+    0, 36, 0, 0, 0, 0, 0, 0, 0, 41, 
+    0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
-    102, 6, 0, 0, 0, 0, 0, 0, 0, 109, 
-    111, 100, 117, 108, 101, 32, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 58, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 80, 97, 116, 
-    104, 70, 105, 110, 100, 101, 114, 46, 95, 112, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 2, 210, 0, 
+    0, 0, 0, 0, 0, 0, 71, 101, 116, 32, 
+    116, 104, 101, 32, 102, 105, 110, 100, 101, 114, 
+    32, 102, 111, 114, 32, 116, 104, 101, 32, 112, 
+    97, 116, 104, 32, 101, 110, 116, 114, 121, 32, 
+    102, 114, 111, 109, 32, 115, 121, 115, 46, 112, 
     97, 116, 104, 95, 105, 109, 112, 111, 114, 116, 
-    101, 114, 95, 99, 97, 99, 104, 101, 46, 49, 
-    51, 52, 53, 58, 52, 0, 50, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 32, 1, 1, 
-    30, 0, 1, 6, 2, 1, 0, 0, 79, 3, 
-    2, 19, 2, 16, 0, 0, 0, 42, 1, 0, 
-    0, 0, 17, 7, 0, 0, 0, 33, 0, 1, 
-    21, 0, 4, 0, 0, 0, 30, 1, 2, 5, 
-    17, 0, 0, 0, 0, 41, 1, 52, 33, 1, 
-    0, 34, 2, 1, 4, 10, 2, 0, 0, 45, 
-    1, 0, 54, 17, 0, 0, 0, 0, 17, 0, 
-    0, 0, 0, 42, 1, 0, 0, 0, 17, 17, 
-    0, 0, 0, 33, 0, 3, 21, 0, 14, 0, 
-    0, 0, 32, 1, 0, 34, 2, 1, 5, 32, 
-    3, 1, 74, 3, 10, 2, 1, 0, 75, 1, 
-    0, 45, 2, 0, 32, 2, 2, 33, 0, 2, 
-    27, 1, 0, 6, 32, 3, 1, 48, 1, 3, 
-    2, 5, 17, 8, 0, 0, 0, 52, 33, 0, 
-    2, 27, 1, 0, 6, 32, 2, 1, 1, 0, 
-    1, 2, 45, 2, 0, 54, 17, 0, 0, 0, 
-    0, 32, 0, 2, 41, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 2, 210, 
-    0, 0, 0, 0, 0, 0, 0, 71, 101, 116, 
-    32, 116, 104, 101, 32, 102, 105, 110, 100, 101, 
-    114, 32, 102, 111, 114, 32, 116, 104, 101, 32, 
-    112, 97, 116, 104, 32, 101, 110, 116, 114, 121, 
-    32, 102, 114, 111, 109, 32, 115, 121, 115, 46, 
-    112, 97, 116, 104, 95, 105, 109, 112, 111, 114, 
-    116, 101, 114, 95, 99, 97, 99, 104, 101, 46, 
-    10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
-    73, 102, 32, 116, 104, 101, 32, 112, 97, 116, 
-    104, 32, 101, 110, 116, 114, 121, 32, 105, 115, 
-    32, 110, 111, 116, 32, 105, 110, 32, 116, 104, 
-    101, 32, 99, 97, 99, 104, 101, 44, 32, 102, 
-    105, 110, 100, 32, 116, 104, 101, 32, 97, 112, 
-    112, 114, 111, 112, 114, 105, 97, 116, 101, 32, 
-    102, 105, 110, 100, 101, 114, 10, 32, 32, 32, 
-    32, 32, 32, 32, 32, 97, 110, 100, 32, 99, 
-    97, 99, 104, 101, 32, 105, 116, 46, 32, 73, 
-    102, 32, 110, 111, 32, 102, 105, 110, 100, 101, 
-    114, 32, 105, 115, 32, 97, 118, 97, 105, 108, 
-    97, 98, 108, 101, 44, 32, 115, 116, 111, 114, 
-    101, 32, 78, 111, 110, 101, 46, 10, 10, 32, 
-    32, 32, 32, 32, 32, 32, 32, 2, 0, 0, 
-    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    101, 114, 95, 99, 97, 99, 104, 101, 46, 10, 
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 73, 
+    102, 32, 116, 104, 101, 32, 112, 97, 116, 104, 
+    32, 101, 110, 116, 114, 121, 32, 105, 115, 32, 
+    110, 111, 116, 32, 105, 110, 32, 116, 104, 101, 
+    32, 99, 97, 99, 104, 101, 44, 32, 102, 105, 
+    110, 100, 32, 116, 104, 101, 32, 97, 112, 112, 
+    114, 111, 112, 114, 105, 97, 116, 101, 32, 102, 
+    105, 110, 100, 101, 114, 10, 32, 32, 32, 32, 
+    32, 32, 32, 32, 97, 110, 100, 32, 99, 97, 
+    99, 104, 101, 32, 105, 116, 46, 32, 73, 102, 
+    32, 110, 111, 32, 102, 105, 110, 100, 101, 114, 
+    32, 105, 115, 32, 97, 118, 97, 105, 108, 97, 
+    98, 108, 101, 44, 32, 115, 116, 111, 114, 101, 
+    32, 78, 111, 110, 101, 46, 10, 10, 32, 32, 
+    32, 32, 32, 32, 32, 32, 2, 0, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 
-    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 
+    0, 0, 0, 95, 112, 97, 116, 104, 95, 105, 
+    109, 112, 111, 114, 116, 101, 114, 95, 99, 97, 
+    99, 104, 101, 7, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 95, 
+    111, 115, 17, 0, 0, 0, 0, 0, 0, 0, 
+    70, 105, 108, 101, 78, 111, 116, 70, 111, 117, 
+    110, 100, 69, 114, 114, 111, 114, 3, 0, 0, 
+    0, 0, 0, 0, 0, 115, 121, 115, 8, 0, 
+    0, 0, 0, 0, 0, 0, 75, 101, 121, 69, 
+    114, 114, 111, 114, 6, 0, 0, 0, 0, 0, 
+    0, 0, 103, 101, 116, 99, 119, 100, 11, 0, 
+    0, 0, 0, 0, 0, 0, 95, 112, 97, 116, 
+    104, 95, 104, 111, 111, 107, 115, 19, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 95, 
     105, 109, 112, 111, 114, 116, 101, 114, 95, 99, 
-    97, 99, 104, 101, 7, 0, 0, 0, 0, 0, 
+    97, 99, 104, 101, 0, 0, 0, 0, 0, 0, 
     0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    95, 111, 115, 17, 0, 0, 0, 0, 0, 0, 
-    0, 70, 105, 108, 101, 78, 111, 116, 70, 111, 
-    117, 110, 100, 69, 114, 114, 111, 114, 3, 0, 
-    0, 0, 0, 0, 0, 0, 115, 121, 115, 8, 
-    0, 0, 0, 0, 0, 0, 0, 75, 101, 121, 
-    69, 114, 114, 111, 114, 6, 0, 0, 0, 0, 
-    0, 0, 0, 103, 101, 116, 99, 119, 100, 11, 
-    0, 0, 0, 0, 0, 0, 0, 95, 112, 97, 
-    116, 104, 95, 104, 111, 111, 107, 115, 19, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    95, 105, 109, 112, 111, 114, 116, 101, 114, 95, 
-    99, 97, 99, 104, 101, 0, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
-    108, 115, 4, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 6, 0, 0, 0, 0, 0, 
-    0, 0, 102, 105, 110, 100, 101, 114, 32, 0, 
-    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 
-    0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    95, 102, 105, 120, 95, 117, 112, 95, 109, 111, 
-    100, 117, 108, 101, 46, 49, 54, 49, 57, 58, 
-    48, 0, 90, 0, 0, 0, 0, 0, 0, 0, 
-    32, 0, 0, 34, 1, 0, 4, 30, 2, 0, 
-    74, 2, 10, 1, 1, 0, 75, 1, 230, 45, 
-    4, 0, 32, 1, 0, 34, 2, 1, 4, 30, 
-    3, 1, 74, 3, 10, 2, 1, 0, 75, 1, 
-    0, 45, 5, 0, 32, 2, 4, 49, 0, 2, 
-    3, 79, 1, 0, 19, 0, 34, 0, 0, 0, 
-    32, 1, 5, 79, 0, 1, 22, 1, 26, 0, 
-    0, 0, 32, 0, 2, 32, 1, 3, 6, 2, 
-    0, 1, 0, 79, 3, 2, 22, 2, 10, 0, 
-    0, 0, 33, 1, 1, 32, 2, 1, 32, 3, 
-    2, 74, 2, 74, 3, 10, 1, 2, 0, 75, 
-    1, 229, 75, 1, 104, 45, 4, 0, 17, 10, 
-    0, 0, 0, 33, 1, 0, 32, 2, 1, 32, 
-    3, 2, 74, 2, 74, 3, 10, 1, 2, 0, 
-    75, 1, 236, 75, 1, 173, 45, 4, 0, 17, 
-    0, 0, 0, 0, 17, 4, 0, 0, 0, 32, 
-    0, 5, 27, 1, 0, 5, 45, 4, 1, 17, 
-    0, 0, 0, 0, 17, 0, 0, 0, 0, 32, 
-    0, 5, 49, 1, 0, 3, 79, 2, 1, 19, 
-    1, 7, 0, 0, 0, 33, 2, 2, 32, 1, 
-    1, 32, 3, 2, 32, 4, 4, 12, 2, 2, 
-    0, 0, 0, 0, 0, 0, 0, 1, 3, 1, 
-    0, 0, 0, 0, 0, 0, 0, 4, 1, 0, 
-    0, 0, 0, 0, 0, 0, 5, 45, 5, 0, 
-    17, 0, 0, 0, 0, 42, 1, 0, 0, 0, 
-    17, 5, 0, 0, 0, 33, 0, 3, 21, 0, 
-    2, 0, 0, 0, 5, 17, 19, 0, 0, 0, 
-    52, 32, 0, 5, 32, 1, 0, 30, 2, 1, 
-    48, 1, 2, 0, 32, 3, 4, 32, 0, 0, 
-    30, 1, 0, 48, 0, 1, 3, 32, 2, 2, 
-    32, 0, 0, 30, 1, 2, 48, 0, 1, 2, 
-    32, 3, 3, 32, 0, 0, 30, 1, 3, 48, 
-    0, 1, 3, 54, 17, 0, 0, 0, 0, 30, 
-    0, 4, 41, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
-    0, 0, 0, 0, 0, 0, 2, 10, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 108, 111, 97, 
-    100, 101, 114, 95, 95, 2, 8, 0, 0, 0, 
-    0, 0, 0, 0, 95, 95, 115, 112, 101, 99, 
-    95, 95, 2, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 102, 105, 108, 101, 95, 95, 2, 
-    10, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
-    99, 97, 99, 104, 101, 100, 95, 95, 5, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 99, 108, 
+    115, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 6, 0, 0, 0, 0, 0, 0, 
+    0, 102, 105, 110, 100, 101, 114, 33, 0, 0, 
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
+    0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
+    102, 105, 120, 95, 117, 112, 95, 109, 111, 100, 
+    117, 108, 101, 46, 49, 54, 49, 57, 58, 48, 
+    0, 84, 0, 0, 0, 0, 0, 0, 0, 32, 
+    0, 0, 34, 1, 0, 4, 1, 32, 30, 2, 
+    0, 38, 1, 32, 1, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 
+    4, 0, 32, 1, 0, 34, 2, 1, 4, 1, 
+    32, 30, 3, 1, 38, 2, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 45, 5, 0, 32, 2, 4, 49, 0, 
+    2, 3, 79, 1, 0, 19, 0, 34, 0, 0, 
+    0, 32, 1, 5, 79, 0, 1, 22, 1, 26, 
+    0, 0, 0, 32, 0, 2, 32, 1, 3, 6, 
+    2, 0, 1, 0, 79, 3, 2, 22, 2, 10, 
+    0, 0, 0, 33, 1, 1, 32, 2, 1, 32, 
+    3, 2, 74, 2, 74, 3, 10, 1, 2, 0, 
+    75, 1, 229, 75, 1, 104, 45, 4, 0, 17, 
+    10, 0, 0, 0, 33, 1, 0, 32, 2, 1, 
+    32, 3, 2, 74, 2, 74, 3, 10, 1, 2, 
+    0, 75, 1, 236, 75, 1, 173, 45, 4, 0, 
+    17, 0, 0, 0, 0, 17, 4, 0, 0, 0, 
+    32, 0, 5, 27, 1, 0, 5, 45, 4, 1, 
+    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    32, 0, 5, 49, 1, 0, 3, 79, 2, 1, 
+    19, 1, 7, 0, 0, 0, 33, 2, 2, 32, 
+    1, 1, 32, 3, 2, 32, 4, 4, 12, 2, 
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 3, 
+    1, 0, 0, 0, 0, 0, 0, 0, 4, 1, 
+    0, 0, 0, 0, 0, 0, 0, 5, 45, 5, 
+    0, 17, 0, 0, 0, 0, 17, 5, 0, 0, 
+    0, 33, 0, 3, 21, 0, 2, 0, 0, 0, 
+    5, 17, 18, 0, 0, 0, 52, 32, 0, 5, 
+    32, 1, 0, 30, 2, 1, 48, 1, 2, 0, 
+    32, 3, 4, 32, 0, 0, 30, 1, 0, 48, 
+    0, 1, 3, 32, 2, 2, 32, 0, 0, 30, 
+    1, 2, 48, 0, 1, 2, 32, 3, 3, 32, 
+    0, 0, 30, 1, 3, 48, 0, 1, 3, 17, 
+    0, 0, 0, 0, 30, 0, 4, 41, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 
+    0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 
+    0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 
+    0, 65, 0, 0, 0, 0, 0, 0, 0, 81, 
+    0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+    0, 0, 0, 0, 0, 0, 0, 2, 10, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 108, 111, 
+    97, 100, 101, 114, 95, 95, 2, 8, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 115, 112, 101, 
+    99, 95, 95, 2, 8, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 102, 105, 108, 101, 95, 95, 
+    2, 10, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 99, 97, 99, 104, 101, 100, 95, 95, 5, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    12, 0, 0, 0, 0, 0, 0, 0, 14, 0, 
-    0, 0, 0, 0, 0, 0, 95, 102, 105, 120, 
-    95, 117, 112, 95, 109, 111, 100, 117, 108, 101, 
-    6, 0, 0, 0, 0, 0, 0, 0, 20, 0, 
-    0, 0, 0, 0, 0, 0, 83, 111, 117, 114, 
-    99, 101, 108, 101, 115, 115, 70, 105, 108, 101, 
-    76, 111, 97, 100, 101, 114, 16, 0, 0, 0, 
-    0, 0, 0, 0, 83, 111, 117, 114, 99, 101, 
-    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
-    23, 0, 0, 0, 0, 0, 0, 0, 115, 112, 
-    101, 99, 95, 102, 114, 111, 109, 95, 102, 105, 
-    108, 101, 95, 108, 111, 99, 97, 116, 105, 111, 
-    110, 9, 0, 0, 0, 0, 0, 0, 0, 69, 
-    120, 99, 101, 112, 116, 105, 111, 110, 3, 0, 
-    0, 0, 0, 0, 0, 0, 103, 101, 116, 6, 
-    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
-    100, 101, 114, 0, 0, 0, 0, 0, 0, 0, 
-    0, 6, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 110, 115, 4, 
-    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
-    101, 8, 0, 0, 0, 0, 0, 0, 0, 112, 
-    97, 116, 104, 110, 97, 109, 101, 9, 0, 0, 
-    0, 0, 0, 0, 0, 99, 112, 97, 116, 104, 
-    110, 97, 109, 101, 6, 0, 0, 0, 0, 0, 
-    0, 0, 108, 111, 97, 100, 101, 114, 4, 0, 
-    0, 0, 0, 0, 0, 0, 115, 112, 101, 99, 
-    32, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
-    0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 70, 105, 108, 101, 76, 111, 97, 100, 
-    101, 114, 46, 105, 115, 95, 114, 101, 115, 111, 
-    117, 114, 99, 101, 46, 49, 48, 54, 50, 58, 
-    52, 0, 29, 0, 0, 0, 0, 0, 0, 0, 
-    33, 0, 0, 32, 1, 1, 6, 2, 0, 1, 
-    8, 79, 3, 2, 22, 2, 22, 0, 0, 0, 
-    33, 1, 1, 33, 2, 2, 32, 3, 0, 27, 
-    4, 3, 4, 74, 4, 10, 2, 1, 0, 75, 
-    1, 0, 30, 3, 0, 1, 2, 0, 3, 32, 
-    4, 1, 74, 2, 74, 4, 10, 1, 2, 0, 
-    75, 1, 0, 75, 1, 0, 45, 2, 0, 33, 
-    1, 3, 32, 2, 2, 74, 2, 10, 1, 1, 
-    0, 75, 1, 0, 41, 0, 30, 1, 1, 41, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 12, 0, 0, 0, 0, 0, 0, 0, 14, 
+    0, 0, 0, 0, 0, 0, 0, 95, 102, 105, 
+    120, 95, 117, 112, 95, 109, 111, 100, 117, 108, 
+    101, 6, 0, 0, 0, 0, 0, 0, 0, 20, 
+    0, 0, 0, 0, 0, 0, 0, 83, 111, 117, 
+    114, 99, 101, 108, 101, 115, 115, 70, 105, 108, 
+    101, 76, 111, 97, 100, 101, 114, 16, 0, 0, 
+    0, 0, 0, 0, 0, 83, 111, 117, 114, 99, 
+    101, 70, 105, 108, 101, 76, 111, 97, 100, 101, 
+    114, 23, 0, 0, 0, 0, 0, 0, 0, 115, 
+    112, 101, 99, 95, 102, 114, 111, 109, 95, 102, 
+    105, 108, 101, 95, 108, 111, 99, 97, 116, 105, 
+    111, 110, 9, 0, 0, 0, 0, 0, 0, 0, 
+    69, 120, 99, 101, 112, 116, 105, 111, 110, 3, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    6, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
+    97, 100, 101, 114, 0, 0, 0, 0, 0, 0, 
     0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
-    0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 
-    0, 105, 115, 95, 114, 101, 115, 111, 117, 114, 
-    99, 101, 5, 0, 0, 0, 0, 0, 0, 0, 
-    8, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 95, 115, 101, 112, 10, 0, 0, 0, 
-    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    106, 111, 105, 110, 11, 0, 0, 0, 0, 0, 
-    0, 0, 95, 112, 97, 116, 104, 95, 115, 112, 
-    108, 105, 116, 12, 0, 0, 0, 0, 0, 0, 
-    0, 95, 112, 97, 116, 104, 95, 105, 115, 102, 
-    105, 108, 101, 4, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 0, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 4, 0, 0, 0, 0, 0, 0, 
-    0, 110, 97, 109, 101, 4, 0, 0, 0, 0, 
-    0, 0, 0, 112, 97, 116, 104, 32, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
-    0, 46, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 70, 
-    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
-    99, 111, 110, 116, 101, 110, 116, 115, 46, 49, 
-    48, 54, 56, 58, 52, 0, 21, 0, 0, 0, 
-    0, 0, 0, 0, 33, 1, 0, 33, 0, 1, 
-    34, 2, 0, 3, 33, 3, 2, 32, 4, 0, 
-    27, 5, 4, 4, 74, 5, 10, 3, 1, 0, 
-    75, 1, 0, 30, 4, 0, 1, 3, 0, 4, 
-    74, 3, 10, 2, 1, 0, 75, 1, 173, 74, 
+    2, 0, 0, 0, 0, 0, 0, 0, 110, 115, 
+    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+    109, 101, 8, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 110, 97, 109, 101, 9, 0, 
+    0, 0, 0, 0, 0, 0, 99, 112, 97, 116, 
+    104, 110, 97, 109, 101, 6, 0, 0, 0, 0, 
+    0, 0, 0, 108, 111, 97, 100, 101, 114, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 112, 101, 
+    99, 32, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 70, 105, 108, 101, 76, 111, 97, 
+    100, 101, 114, 46, 105, 115, 95, 114, 101, 115, 
+    111, 117, 114, 99, 101, 46, 49, 48, 54, 50, 
+    58, 52, 0, 29, 0, 0, 0, 0, 0, 0, 
+    0, 33, 0, 0, 32, 1, 1, 6, 2, 0, 
+    1, 8, 79, 3, 2, 22, 2, 22, 0, 0, 
+    0, 33, 1, 1, 33, 2, 2, 32, 3, 0, 
+    27, 4, 3, 4, 74, 4, 10, 2, 1, 0, 
+    75, 1, 0, 30, 3, 0, 1, 2, 0, 3, 
+    32, 4, 1, 74, 2, 74, 4, 10, 1, 2, 
+    0, 75, 1, 0, 75, 1, 0, 45, 2, 0, 
+    33, 1, 3, 32, 2, 2, 74, 2, 10, 1, 
+    1, 0, 75, 1, 0, 41, 0, 30, 1, 1, 
+    41, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
+    0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
+    105, 115, 95, 114, 101, 115, 111, 117, 114, 99, 
+    101, 5, 0, 0, 0, 0, 0, 0, 0, 8, 
+    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
+    104, 95, 115, 101, 112, 10, 0, 0, 0, 0, 
+    0, 0, 0, 95, 112, 97, 116, 104, 95, 106, 
+    111, 105, 110, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 115, 112, 108, 
+    105, 116, 12, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 95, 105, 115, 102, 105, 
+    108, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 0, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 4, 0, 0, 0, 0, 0, 0, 0, 
+    110, 97, 109, 101, 4, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 116, 104, 33, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    46, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
+    108, 101, 76, 111, 97, 100, 101, 114, 46, 99, 
+    111, 110, 116, 101, 110, 116, 115, 46, 49, 48, 
+    54, 56, 58, 52, 0, 19, 0, 0, 0, 0, 
+    0, 0, 0, 33, 1, 0, 33, 0, 1, 34, 
+    2, 0, 3, 1, 32, 33, 3, 2, 32, 4, 
+    0, 27, 5, 4, 4, 74, 5, 10, 3, 1, 
+    0, 75, 1, 0, 30, 4, 0, 1, 3, 0, 
+    4, 38, 2, 32, 1, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 
     0, 74, 0, 10, 1, 1, 0, 75, 1, 173, 
     39, 4, 0, 75, 0, 0, 41, 4, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    5, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 99, 111, 110, 116, 
-    101, 110, 116, 115, 5, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    105, 116, 101, 114, 3, 0, 0, 0, 0, 0, 
-    0, 0, 95, 111, 115, 11, 0, 0, 0, 0, 
-    0, 0, 0, 95, 112, 97, 116, 104, 95, 115, 
-    112, 108, 105, 116, 7, 0, 0, 0, 0, 0, 
-    0, 0, 108, 105, 115, 116, 100, 105, 114, 4, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
-    104, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 115, 101, 108, 102, 32, 
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
+    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
+    0, 0, 0, 0, 99, 111, 110, 116, 101, 110, 
+    116, 115, 5, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 105, 116, 
+    101, 114, 3, 0, 0, 0, 0, 0, 0, 0, 
+    95, 111, 115, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 115, 112, 108, 
+    105, 116, 7, 0, 0, 0, 0, 0, 0, 0, 
+    108, 105, 115, 116, 100, 105, 114, 4, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 0, 
     0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 95, 78, 97, 109, 101, 115, 112, 97, 99, 
-    101, 80, 97, 116, 104, 46, 95, 95, 108, 101, 
-    110, 95, 95, 46, 49, 50, 53, 57, 58, 52, 
-    0, 11, 0, 0, 0, 0, 0, 0, 0, 33, 
-    1, 0, 32, 2, 0, 34, 3, 2, 1, 10, 
-    3, 0, 0, 74, 0, 74, 0, 10, 1, 1, 
-    0, 75, 1, 0, 39, 2, 0, 75, 0, 0, 
-    41, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 115, 101, 108, 102, 33, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 49, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
+    78, 97, 109, 101, 115, 112, 97, 99, 101, 80, 
+    97, 116, 104, 46, 95, 95, 108, 101, 110, 95, 
+    95, 46, 49, 50, 53, 57, 58, 52, 0, 11, 
+    0, 0, 0, 0, 0, 0, 0, 33, 1, 0, 
+    32, 2, 0, 34, 3, 2, 1, 1, 32, 38, 
+    3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 74, 0, 74, 0, 
+    10, 1, 1, 0, 75, 1, 0, 39, 2, 0, 
+    75, 0, 0, 41, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 108, 101, 110, 95, 95, 2, 0, 
     0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 108, 101, 110, 12, 0, 0, 
-    0, 0, 0, 0, 0, 95, 114, 101, 99, 97, 
-    108, 99, 117, 108, 97, 116, 101, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 101, 108, 102, 32, 0, 0, 0, 0, 
+    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 108, 101, 110, 95, 95, 2, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 108, 101, 110, 12, 0, 
+    0, 0, 0, 0, 0, 0, 95, 114, 101, 99, 
+    97, 108, 99, 117, 108, 97, 116, 101, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 115, 101, 108, 102, 32, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 48, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 95, 95, 99, 
-    108, 97, 115, 115, 95, 95, 70, 105, 108, 101, 
-    76, 111, 97, 100, 101, 114, 95, 95, 46, 49, 
-    48, 48, 48, 58, 48, 0, 64, 0, 0, 0, 
-    0, 0, 0, 0, 33, 0, 0, 47, 0, 10, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 109, 
-    111, 100, 117, 108, 101, 95, 95, 30, 2, 0, 
-    47, 2, 12, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 113, 117, 97, 108, 110, 97, 109, 101, 
-    95, 95, 30, 1, 1, 30, 0, 2, 36, 1, 
-    0, 0, 0, 0, 0, 47, 1, 8, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 105, 110, 105, 
-    116, 95, 95, 30, 0, 3, 36, 1, 0, 0, 
-    0, 0, 0, 47, 1, 6, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 101, 113, 95, 95, 30, 
-    0, 4, 36, 1, 0, 0, 0, 0, 0, 47, 
-    1, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 104, 97, 115, 104, 95, 95, 33, 3, 1, 
-    30, 0, 5, 29, 1, 0, 74, 1, 4, 2, 
-    1, 75, 1, 0, 36, 4, 0, 0, 0, 1, 
-    2, 47, 4, 11, 0, 0, 0, 0, 0, 0, 
-    0, 108, 111, 97, 100, 95, 109, 111, 100, 117, 
-    108, 101, 35, 2, 11, 0, 0, 0, 0, 0, 
-    0, 0, 108, 111, 97, 100, 95, 109, 111, 100, 
-    117, 108, 101, 74, 2, 10, 3, 1, 0, 75, 
-    1, 0, 47, 0, 11, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    48, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 95, 95, 
+    99, 108, 97, 115, 115, 95, 95, 70, 105, 108, 
+    101, 76, 111, 97, 100, 101, 114, 95, 95, 46, 
+    49, 48, 48, 48, 58, 48, 0, 64, 0, 0, 
+    0, 0, 0, 0, 0, 33, 0, 0, 47, 0, 
+    10, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    109, 111, 100, 117, 108, 101, 95, 95, 30, 2, 
+    0, 47, 2, 12, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 113, 117, 97, 108, 110, 97, 109, 
+    101, 95, 95, 30, 1, 1, 30, 0, 2, 36, 
+    1, 0, 0, 0, 0, 0, 47, 1, 8, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 105, 110, 
+    105, 116, 95, 95, 30, 0, 3, 36, 1, 0, 
+    0, 0, 0, 0, 47, 1, 6, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 101, 113, 95, 95, 
+    30, 0, 4, 36, 1, 0, 0, 0, 0, 0, 
+    47, 1, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 104, 97, 115, 104, 95, 95, 33, 3, 
+    1, 30, 0, 5, 29, 1, 0, 74, 1, 4, 
+    2, 1, 75, 1, 0, 36, 4, 0, 0, 0, 
+    1, 2, 47, 4, 11, 0, 0, 0, 0, 0, 
     0, 0, 108, 111, 97, 100, 95, 109, 111, 100, 
-    117, 108, 101, 33, 2, 1, 30, 0, 6, 36, 
-    1, 0, 0, 0, 0, 0, 47, 1, 12, 0, 
-    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
-    102, 105, 108, 101, 110, 97, 109, 101, 35, 4, 
-    12, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
-    116, 95, 102, 105, 108, 101, 110, 97, 109, 101, 
-    74, 4, 10, 2, 1, 0, 75, 1, 0, 47, 
-    0, 12, 0, 0, 0, 0, 0, 0, 0, 103, 
+    117, 108, 101, 35, 2, 2, 74, 2, 10, 3, 
+    1, 0, 75, 1, 0, 47, 0, 11, 0, 0, 
+    0, 0, 0, 0, 0, 108, 111, 97, 100, 95, 
+    109, 111, 100, 117, 108, 101, 33, 2, 1, 30, 
+    0, 6, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 12, 0, 0, 0, 0, 0, 0, 0, 103, 
     101, 116, 95, 102, 105, 108, 101, 110, 97, 109, 
-    101, 30, 2, 7, 36, 0, 2, 0, 0, 0, 
-    0, 47, 0, 8, 0, 0, 0, 0, 0, 0, 
-    0, 103, 101, 116, 95, 100, 97, 116, 97, 33, 
-    2, 1, 30, 0, 8, 36, 1, 0, 0, 0, 
-    0, 0, 47, 1, 19, 0, 0, 0, 0, 0, 
-    0, 0, 103, 101, 116, 95, 114, 101, 115, 111, 
-    117, 114, 99, 101, 95, 114, 101, 97, 100, 101, 
-    114, 35, 4, 19, 0, 0, 0, 0, 0, 0, 
-    0, 103, 101, 116, 95, 114, 101, 115, 111, 117, 
-    114, 99, 101, 95, 114, 101, 97, 100, 101, 114, 
-    74, 4, 10, 2, 1, 0, 75, 1, 0, 47, 
-    0, 19, 0, 0, 0, 0, 0, 0, 0, 103, 
-    101, 116, 95, 114, 101, 115, 111, 117, 114, 99, 
-    101, 95, 114, 101, 97, 100, 101, 114, 30, 2, 
-    9, 36, 0, 2, 0, 0, 0, 0, 47, 0, 
-    13, 0, 0, 0, 0, 0, 0, 0, 111, 112, 
-    101, 110, 95, 114, 101, 115, 111, 117, 114, 99, 
-    101, 30, 2, 10, 36, 0, 2, 0, 0, 0, 
-    0, 47, 0, 13, 0, 0, 0, 0, 0, 0, 
-    0, 114, 101, 115, 111, 117, 114, 99, 101, 95, 
-    112, 97, 116, 104, 30, 2, 11, 36, 0, 2, 
-    0, 0, 0, 0, 47, 0, 11, 0, 0, 0, 
-    0, 0, 0, 0, 105, 115, 95, 114, 101, 115, 
-    111, 117, 114, 99, 101, 30, 2, 12, 36, 0, 
+    101, 35, 4, 3, 74, 4, 10, 2, 1, 0, 
+    75, 1, 0, 47, 0, 12, 0, 0, 0, 0, 
+    0, 0, 0, 103, 101, 116, 95, 102, 105, 108, 
+    101, 110, 97, 109, 101, 30, 2, 7, 36, 0, 
     2, 0, 0, 0, 0, 47, 0, 8, 0, 0, 
-    0, 0, 0, 0, 0, 99, 111, 110, 116, 101, 
-    110, 116, 115, 17, 0, 0, 0, 0, 29, 0, 
-    0, 47, 0, 13, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 99, 108, 97, 115, 115, 99, 101, 
-    108, 108, 95, 95, 41, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 103, 101, 116, 95, 100, 
+    97, 116, 97, 33, 2, 1, 30, 0, 8, 36, 
+    1, 0, 0, 0, 0, 0, 47, 1, 19, 0, 
+    0, 0, 0, 0, 0, 0, 103, 101, 116, 95, 
+    114, 101, 115, 111, 117, 114, 99, 101, 95, 114, 
+    101, 97, 100, 101, 114, 35, 4, 4, 74, 4, 
+    10, 2, 1, 0, 75, 1, 0, 47, 0, 19, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    95, 114, 101, 115, 111, 117, 114, 99, 101, 95, 
+    114, 101, 97, 100, 101, 114, 30, 2, 9, 36, 
+    0, 2, 0, 0, 0, 0, 47, 0, 13, 0, 
+    0, 0, 0, 0, 0, 0, 111, 112, 101, 110, 
+    95, 114, 101, 115, 111, 117, 114, 99, 101, 30, 
+    2, 10, 36, 0, 2, 0, 0, 0, 0, 47, 
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 114, 
+    101, 115, 111, 117, 114, 99, 101, 95, 112, 97, 
+    116, 104, 30, 2, 11, 36, 0, 2, 0, 0, 
+    0, 0, 47, 0, 11, 0, 0, 0, 0, 0, 
+    0, 0, 105, 115, 95, 114, 101, 115, 111, 117, 
+    114, 99, 101, 30, 2, 12, 36, 0, 2, 0, 
+    0, 0, 0, 47, 0, 8, 0, 0, 0, 0, 
+    0, 0, 0, 99, 111, 110, 116, 101, 110, 116, 
+    115, 17, 0, 0, 0, 0, 29, 0, 0, 47, 
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 99, 108, 97, 115, 115, 99, 101, 108, 108, 
+    95, 95, 41, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 99, 108, 
-    97, 115, 115, 95, 95, 13, 0, 0, 0, 0, 
-    0, 0, 0, 2, 10, 0, 0, 0, 0, 0, 
-    0, 0, 70, 105, 108, 101, 76, 111, 97, 100, 
-    101, 114, 2, 103, 0, 0, 0, 0, 0, 0, 
-    0, 66, 97, 115, 101, 32, 102, 105, 108, 101, 
-    32, 108, 111, 97, 100, 101, 114, 32, 99, 108, 
-    97, 115, 115, 32, 119, 104, 105, 99, 104, 32, 
-    105, 109, 112, 108, 101, 109, 101, 110, 116, 115, 
-    32, 116, 104, 101, 32, 108, 111, 97, 100, 101, 
-    114, 32, 112, 114, 111, 116, 111, 99, 111, 108, 
-    32, 109, 101, 116, 104, 111, 100, 115, 32, 116, 
-    104, 97, 116, 10, 32, 32, 32, 32, 114, 101, 
-    113, 117, 105, 114, 101, 32, 102, 105, 108, 101, 
-    32, 115, 121, 115, 116, 101, 109, 32, 117, 115, 
-    97, 103, 101, 46, 2, 46, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 70, 105, 108, 101, 76, 111, 97, 
-    100, 101, 114, 46, 95, 95, 105, 110, 105, 116, 
-    95, 95, 46, 49, 48, 48, 53, 58, 52, 2, 
-    44, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
-    108, 101, 76, 111, 97, 100, 101, 114, 46, 95, 
-    95, 101, 113, 95, 95, 46, 49, 48, 49, 49, 
-    58, 52, 2, 46, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 70, 105, 108, 101, 76, 111, 97, 100, 101, 
-    114, 46, 95, 95, 104, 97, 115, 104, 95, 95, 
-    46, 49, 48, 49, 53, 58, 52, 2, 49, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 70, 105, 108, 101, 
-    76, 111, 97, 100, 101, 114, 46, 108, 111, 97, 
-    100, 95, 109, 111, 100, 117, 108, 101, 46, 49, 
-    48, 49, 56, 58, 52, 2, 50, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 70, 105, 108, 101, 76, 111, 
-    97, 100, 101, 114, 46, 103, 101, 116, 95, 102, 
-    105, 108, 101, 110, 97, 109, 101, 46, 49, 48, 
-    51, 48, 58, 52, 2, 46, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 70, 105, 108, 101, 76, 111, 97, 
-    100, 101, 114, 46, 103, 101, 116, 95, 100, 97, 
-    116, 97, 46, 49, 48, 51, 53, 58, 52, 2, 
-    57, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
-    108, 101, 76, 111, 97, 100, 101, 114, 46, 103, 
-    101, 116, 95, 114, 101, 115, 111, 117, 114, 99, 
-    101, 95, 114, 101, 97, 100, 101, 114, 46, 49, 
-    48, 52, 54, 58, 52, 2, 51, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 70, 105, 108, 101, 76, 111, 
-    97, 100, 101, 114, 46, 111, 112, 101, 110, 95, 
-    114, 101, 115, 111, 117, 114, 99, 101, 46, 49, 
-    48, 53, 50, 58, 52, 2, 51, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 70, 105, 108, 101, 76, 111, 
-    97, 100, 101, 114, 46, 114, 101, 115, 111, 117, 
-    114, 99, 101, 95, 112, 97, 116, 104, 46, 49, 
-    48, 53, 54, 58, 52, 2, 49, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 99, 108, 97, 115, 115, 95, 
+    95, 13, 0, 0, 0, 0, 0, 0, 0, 2, 
+    10, 0, 0, 0, 0, 0, 0, 0, 70, 105, 
+    108, 101, 76, 111, 97, 100, 101, 114, 2, 103, 
+    0, 0, 0, 0, 0, 0, 0, 66, 97, 115, 
+    101, 32, 102, 105, 108, 101, 32, 108, 111, 97, 
+    100, 101, 114, 32, 99, 108, 97, 115, 115, 32, 
+    119, 104, 105, 99, 104, 32, 105, 109, 112, 108, 
+    101, 109, 101, 110, 116, 115, 32, 116, 104, 101, 
+    32, 108, 111, 97, 100, 101, 114, 32, 112, 114, 
+    111, 116, 111, 99, 111, 108, 32, 109, 101, 116, 
+    104, 111, 100, 115, 32, 116, 104, 97, 116, 10, 
+    32, 32, 32, 32, 114, 101, 113, 117, 105, 114, 
+    101, 32, 102, 105, 108, 101, 32, 115, 121, 115, 
+    116, 101, 109, 32, 117, 115, 97, 103, 101, 46, 
+    2, 46, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 70, 
+    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
+    95, 95, 105, 110, 105, 116, 95, 95, 46, 49, 
+    48, 48, 53, 58, 52, 2, 44, 0, 0, 0, 
     0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
     116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
     110, 97, 108, 46, 70, 105, 108, 101, 76, 111, 
-    97, 100, 101, 114, 46, 105, 115, 95, 114, 101, 
-    115, 111, 117, 114, 99, 101, 46, 49, 48, 54, 
-    50, 58, 52, 2, 46, 0, 0, 0, 0, 0, 
+    97, 100, 101, 114, 46, 95, 95, 101, 113, 95, 
+    95, 46, 49, 48, 49, 49, 58, 52, 2, 46, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 70, 105, 108, 
+    101, 76, 111, 97, 100, 101, 114, 46, 95, 95, 
+    104, 97, 115, 104, 95, 95, 46, 49, 48, 49, 
+    53, 58, 52, 2, 49, 0, 0, 0, 0, 0, 
     0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
     97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
     108, 46, 70, 105, 108, 101, 76, 111, 97, 100, 
-    101, 114, 46, 99, 111, 110, 116, 101, 110, 116, 
-    115, 46, 49, 48, 54, 56, 58, 52, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 
+    101, 114, 46, 108, 111, 97, 100, 95, 109, 111, 
+    100, 117, 108, 101, 46, 49, 48, 49, 56, 58, 
+    52, 2, 50, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
+    46, 103, 101, 116, 95, 102, 105, 108, 101, 110, 
+    97, 109, 101, 46, 49, 48, 51, 48, 58, 52, 
+    2, 46, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 70, 
+    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
+    103, 101, 116, 95, 100, 97, 116, 97, 46, 49, 
+    48, 51, 53, 58, 52, 2, 57, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 70, 105, 108, 101, 76, 111, 
+    97, 100, 101, 114, 46, 103, 101, 116, 95, 114, 
+    101, 115, 111, 117, 114, 99, 101, 95, 114, 101, 
+    97, 100, 101, 114, 46, 49, 48, 52, 54, 58, 
+    52, 2, 51, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
+    46, 111, 112, 101, 110, 95, 114, 101, 115, 111, 
+    117, 114, 99, 101, 46, 49, 48, 53, 50, 58, 
+    52, 2, 51, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
+    46, 114, 101, 115, 111, 117, 114, 99, 101, 95, 
+    112, 97, 116, 104, 46, 49, 48, 53, 54, 58, 
+    52, 2, 49, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
+    46, 105, 115, 95, 114, 101, 115, 111, 117, 114, 
+    99, 101, 46, 49, 48, 54, 50, 58, 52, 2, 
+    46, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
+    108, 101, 76, 111, 97, 100, 101, 114, 46, 99, 
+    111, 110, 116, 101, 110, 116, 115, 46, 49, 48, 
+    54, 56, 58, 52, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 99, 108, 97, 
-    115, 115, 95, 95, 70, 105, 108, 101, 76, 111, 
-    97, 100, 101, 114, 95, 95, 2, 0, 0, 0, 
-    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 110, 97, 109, 101, 95, 95, 
-    11, 0, 0, 0, 0, 0, 0, 0, 95, 99, 
-    104, 101, 99, 107, 95, 110, 97, 109, 101, 0, 
+    128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 
-    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
-    0, 6, 0, 0, 0, 0, 0, 0, 0, 59, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 83, 111, 117, 
-    114, 99, 101, 70, 105, 108, 101, 76, 111, 97, 
-    100, 101, 114, 46, 95, 99, 97, 99, 104, 101, 
-    95, 98, 121, 116, 101, 99, 111, 100, 101, 46, 
-    49, 48, 56, 49, 58, 52, 0, 13, 0, 0, 
-    0, 0, 0, 0, 0, 33, 1, 0, 32, 2, 
-    1, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
-    45, 4, 0, 32, 1, 0, 34, 2, 1, 1, 
-    32, 3, 2, 32, 1, 3, 32, 4, 4, 12, 
-    2, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
-    1, 1, 0, 0, 0, 0, 0, 0, 0, 4, 
-    1, 0, 0, 0, 0, 0, 0, 0, 2, 41, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 
+    0, 95, 95, 99, 108, 97, 115, 115, 95, 95, 
+    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
+    95, 95, 5, 0, 0, 0, 0, 0, 0, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    110, 97, 109, 101, 95, 95, 11, 0, 0, 0, 
+    0, 0, 0, 0, 95, 99, 104, 101, 99, 107, 
+    95, 110, 97, 109, 101, 11, 0, 0, 0, 0, 
+    0, 0, 0, 108, 111, 97, 100, 95, 109, 111, 
+    100, 117, 108, 101, 12, 0, 0, 0, 0, 0, 
+    0, 0, 103, 101, 116, 95, 102, 105, 108, 101, 
+    110, 97, 109, 101, 19, 0, 0, 0, 0, 0, 
+    0, 0, 103, 101, 116, 95, 114, 101, 115, 111, 
+    117, 114, 99, 101, 95, 114, 101, 97, 100, 101, 
+    114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
+    0, 59, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 83, 
+    111, 117, 114, 99, 101, 70, 105, 108, 101, 76, 
+    111, 97, 100, 101, 114, 46, 95, 99, 97, 99, 
+    104, 101, 95, 98, 121, 116, 101, 99, 111, 100, 
+    101, 46, 49, 48, 56, 49, 58, 52, 0, 13, 
+    0, 0, 0, 0, 0, 0, 0, 33, 1, 0, 
+    32, 2, 1, 74, 2, 10, 1, 1, 0, 75, 
+    1, 0, 45, 4, 0, 32, 1, 0, 34, 2, 
+    1, 1, 0, 0, 32, 3, 2, 32, 1, 3, 
+    32, 4, 4, 12, 2, 2, 0, 0, 0, 0, 
+    0, 0, 0, 3, 1, 1, 0, 0, 0, 0, 
+    0, 0, 0, 4, 1, 0, 0, 0, 0, 0, 
+    0, 0, 2, 41, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
-    0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 
-    95, 99, 97, 99, 104, 101, 95, 98, 121, 116, 
-    101, 99, 111, 100, 101, 3, 0, 0, 0, 0, 
-    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
-    0, 95, 99, 97, 108, 99, 95, 109, 111, 100, 
-    101, 8, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 116, 95, 100, 97, 116, 97, 5, 0, 0, 
-    0, 0, 0, 0, 0, 95, 109, 111, 100, 101, 
-    0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 101, 108, 102, 11, 0, 
-    0, 0, 0, 0, 0, 0, 115, 111, 117, 114, 
-    99, 101, 95, 112, 97, 116, 104, 13, 0, 0, 
-    0, 0, 0, 0, 0, 98, 121, 116, 101, 99, 
-    111, 100, 101, 95, 112, 97, 116, 104, 4, 0, 
-    0, 0, 0, 0, 0, 0, 100, 97, 116, 97, 
-    4, 0, 0, 0, 0, 0, 0, 0, 109, 111, 
-    100, 101, 32, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 83, 111, 117, 114, 99, 101, 
-    108, 101, 115, 115, 70, 105, 108, 101, 76, 111, 
-    97, 100, 101, 114, 46, 103, 101, 116, 95, 115, 
-    111, 117, 114, 99, 101, 46, 49, 49, 51, 55, 
-    58, 52, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 30, 1, 1, 41, 1, 0, 
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 
+    0, 0, 95, 99, 97, 99, 104, 101, 95, 98, 
+    121, 116, 101, 99, 111, 100, 101, 3, 0, 0, 
+    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 95, 99, 97, 108, 99, 95, 109, 
+    111, 100, 101, 8, 0, 0, 0, 0, 0, 0, 
+    0, 115, 101, 116, 95, 100, 97, 116, 97, 5, 
+    0, 0, 0, 0, 0, 0, 0, 95, 109, 111, 
+    100, 101, 0, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 115, 101, 108, 102, 
+    11, 0, 0, 0, 0, 0, 0, 0, 115, 111, 
+    117, 114, 99, 101, 95, 112, 97, 116, 104, 13, 
+    0, 0, 0, 0, 0, 0, 0, 98, 121, 116, 
+    101, 99, 111, 100, 101, 95, 112, 97, 116, 104, 
+    4, 0, 0, 0, 0, 0, 0, 0, 100, 97, 
+    116, 97, 4, 0, 0, 0, 0, 0, 0, 0, 
+    109, 111, 100, 101, 32, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 58, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 83, 111, 117, 114, 
+    99, 101, 108, 101, 115, 115, 70, 105, 108, 101, 
+    76, 111, 97, 100, 101, 114, 46, 103, 101, 116, 
+    95, 115, 111, 117, 114, 99, 101, 46, 49, 49, 
+    51, 55, 58, 52, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 30, 1, 1, 41, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
@@ -7197,29 +7690,23 @@ std::vector<uint8_t> _bootstrap_external
     2, 1, 30, 0, 5, 36, 1, 0, 0, 0, 
     0, 0, 47, 1, 14, 0, 0, 0, 0, 0, 
     0, 0, 95, 111, 112, 101, 110, 95, 114, 101, 
-    103, 105, 115, 116, 114, 121, 35, 4, 14, 0, 
-    0, 0, 0, 0, 0, 0, 95, 111, 112, 101, 
-    110, 95, 114, 101, 103, 105, 115, 116, 114, 121, 
-    74, 4, 10, 2, 1, 0, 75, 1, 0, 47, 
-    0, 14, 0, 0, 0, 0, 0, 0, 0, 95, 
-    111, 112, 101, 110, 95, 114, 101, 103, 105, 115, 
-    116, 114, 121, 33, 2, 1, 30, 0, 6, 36, 
-    1, 0, 0, 0, 0, 0, 47, 1, 16, 0, 
-    0, 0, 0, 0, 0, 0, 95, 115, 101, 97, 
-    114, 99, 104, 95, 114, 101, 103, 105, 115, 116, 
-    114, 121, 35, 4, 16, 0, 0, 0, 0, 0, 
-    0, 0, 95, 115, 101, 97, 114, 99, 104, 95, 
-    114, 101, 103, 105, 115, 116, 114, 121, 74, 4, 
-    10, 2, 1, 0, 75, 1, 0, 47, 0, 16, 
-    0, 0, 0, 0, 0, 0, 0, 95, 115, 101, 
-    97, 114, 99, 104, 95, 114, 101, 103, 105, 115, 
-    116, 114, 121, 33, 2, 1, 30, 0, 7, 30, 
-    1, 7, 30, 3, 8, 74, 0, 74, 1, 36, 
-    4, 3, 2, 0, 0, 0, 75, 1, 0, 75, 
-    1, 0, 47, 4, 9, 0, 0, 0, 0, 0, 
-    0, 0, 102, 105, 110, 100, 95, 115, 112, 101, 
-    99, 35, 1, 9, 0, 0, 0, 0, 0, 0, 
-    0, 102, 105, 110, 100, 95, 115, 112, 101, 99, 
+    103, 105, 115, 116, 114, 121, 35, 4, 2, 74, 
+    4, 10, 2, 1, 0, 75, 1, 0, 47, 0, 
+    14, 0, 0, 0, 0, 0, 0, 0, 95, 111, 
+    112, 101, 110, 95, 114, 101, 103, 105, 115, 116, 
+    114, 121, 33, 2, 1, 30, 0, 6, 36, 1, 
+    0, 0, 0, 0, 0, 47, 1, 16, 0, 0, 
+    0, 0, 0, 0, 0, 95, 115, 101, 97, 114, 
+    99, 104, 95, 114, 101, 103, 105, 115, 116, 114, 
+    121, 35, 4, 3, 74, 4, 10, 2, 1, 0, 
+    75, 1, 0, 47, 0, 16, 0, 0, 0, 0, 
+    0, 0, 0, 95, 115, 101, 97, 114, 99, 104, 
+    95, 114, 101, 103, 105, 115, 116, 114, 121, 33, 
+    2, 1, 30, 0, 7, 30, 1, 7, 30, 3, 
+    8, 74, 0, 74, 1, 36, 4, 3, 2, 0, 
+    0, 0, 75, 1, 0, 75, 1, 0, 47, 4, 
+    9, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
+    110, 100, 95, 115, 112, 101, 99, 35, 1, 4, 
     74, 1, 10, 2, 1, 0, 75, 1, 0, 47, 
     0, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
     105, 110, 100, 95, 115, 112, 101, 99, 33, 1, 
@@ -7227,12 +7714,11 @@ std::vector<uint8_t> _bootstrap_external
     3, 2, 1, 0, 0, 0, 75, 1, 0, 47, 
     3, 11, 0, 0, 0, 0, 0, 0, 0, 102, 
     105, 110, 100, 95, 109, 111, 100, 117, 108, 101, 
-    35, 2, 11, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 110, 100, 95, 109, 111, 100, 117, 108, 
-    101, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
-    47, 0, 11, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 110, 100, 95, 109, 111, 100, 117, 108, 
-    101, 17, 0, 0, 0, 0, 29, 0, 0, 41, 
+    35, 2, 5, 74, 2, 10, 1, 1, 0, 75, 
+    1, 0, 47, 0, 11, 0, 0, 0, 0, 0, 
+    0, 0, 102, 105, 110, 100, 95, 109, 111, 100, 
+    117, 108, 101, 17, 0, 0, 0, 0, 29, 0, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
@@ -7300,31 +7786,43 @@ std::vector<uint8_t> _bootstrap_external
     95, 99, 108, 97, 115, 115, 95, 95, 87, 105, 
     110, 100, 111, 119, 115, 82, 101, 103, 105, 115, 
     116, 114, 121, 70, 105, 110, 100, 101, 114, 95, 
-    95, 2, 0, 0, 0, 0, 0, 0, 0, 8, 
+    95, 6, 0, 0, 0, 0, 0, 0, 0, 8, 
     0, 0, 0, 0, 0, 0, 0, 95, 95, 110, 
     97, 109, 101, 95, 95, 11, 0, 0, 0, 0, 
     0, 0, 0, 99, 108, 97, 115, 115, 109, 101, 
-    116, 104, 111, 100, 0, 0, 0, 0, 0, 0, 
+    116, 104, 111, 100, 14, 0, 0, 0, 0, 0, 
+    0, 0, 95, 111, 112, 101, 110, 95, 114, 101, 
+    103, 105, 115, 116, 114, 121, 16, 0, 0, 0, 
+    0, 0, 0, 0, 95, 115, 101, 97, 114, 99, 
+    104, 95, 114, 101, 103, 105, 115, 116, 114, 121, 
+    9, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
+    110, 100, 95, 115, 112, 101, 99, 11, 0, 0, 
+    0, 0, 0, 0, 0, 102, 105, 110, 100, 95, 
+    109, 111, 100, 117, 108, 101, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
+    0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 69, 120, 116, 101, 110, 115, 
+    105, 111, 110, 70, 105, 108, 101, 76, 111, 97, 
+    100, 101, 114, 46, 99, 114, 101, 97, 116, 101, 
+    95, 109, 111, 100, 117, 108, 101, 46, 49, 49, 
+    55, 48, 58, 52, 0, 18, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 33, 1, 0, 34, 
+    2, 1, 2, 1, 32, 33, 0, 1, 27, 1, 
+    0, 4, 32, 3, 1, 38, 2, 32, 2, 0, 
+    0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 45, 2, 0, 33, 1, 0, 
+    34, 2, 1, 3, 1, 32, 30, 3, 1, 32, 
+    0, 1, 27, 1, 0, 5, 32, 4, 0, 27, 
+    5, 4, 6, 38, 2, 32, 3, 0, 0, 0, 
+    0, 0, 0, 0, 3, 1, 5, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 32, 4, 2, 41, 4, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    32, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
-    0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 69, 120, 116, 101, 110, 115, 105, 111, 
-    110, 70, 105, 108, 101, 76, 111, 97, 100, 101, 
-    114, 46, 99, 114, 101, 97, 116, 101, 95, 109, 
-    111, 100, 117, 108, 101, 46, 49, 49, 55, 48, 
-    58, 52, 0, 28, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 33, 1, 0, 34, 2, 1, 
-    2, 33, 0, 1, 27, 1, 0, 4, 32, 3, 
-    1, 74, 1, 74, 3, 10, 2, 2, 0, 75, 
-    1, 0, 75, 1, 0, 45, 2, 0, 33, 1, 
-    0, 34, 2, 1, 3, 30, 3, 1, 32, 0, 
-    1, 27, 1, 0, 5, 32, 4, 0, 27, 5, 
-    4, 6, 74, 3, 74, 1, 74, 5, 10, 2, 
-    3, 0, 75, 1, 220, 75, 1, 69, 75, 1, 
-    173, 32, 4, 2, 41, 4, 0, 0, 0, 0, 
     0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     2, 0, 0, 0, 0, 0, 0, 0, 2, 38, 
@@ -7363,7 +7861,7 @@ std::vector<uint8_t> _bootstrap_external
     0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
     102, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
     112, 101, 99, 6, 0, 0, 0, 0, 0, 0, 
-    0, 109, 111, 100, 117, 108, 101, 32, 0, 0, 
+    0, 109, 111, 100, 117, 108, 101, 33, 0, 0, 
     0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
     0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
     0, 58, 0, 0, 0, 0, 0, 0, 0, 95, 
@@ -7372,559 +7870,719 @@ std::vector<uint8_t> _bootstrap_external
     120, 116, 101, 110, 115, 105, 111, 110, 70, 105, 
     108, 101, 76, 111, 97, 100, 101, 114, 46, 101, 
     120, 101, 99, 95, 109, 111, 100, 117, 108, 101, 
-    46, 49, 49, 55, 56, 58, 52, 0, 27, 0, 
+    46, 49, 49, 55, 56, 58, 52, 0, 17, 0, 
     0, 0, 0, 0, 0, 0, 30, 0, 0, 33, 
-    1, 0, 34, 2, 1, 2, 33, 0, 1, 27, 
-    1, 0, 4, 32, 3, 1, 74, 1, 74, 3, 
-    10, 2, 2, 0, 75, 1, 0, 75, 1, 0, 
-    33, 4, 0, 34, 1, 4, 3, 30, 2, 1, 
-    32, 0, 0, 27, 3, 0, 5, 32, 4, 0, 
-    27, 5, 4, 6, 74, 2, 74, 3, 74, 5, 
-    10, 1, 3, 0, 75, 1, 172, 75, 1, 172, 
-    75, 1, 175, 30, 4, 2, 41, 4, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    1, 0, 34, 2, 1, 2, 1, 32, 33, 0, 
+    1, 27, 1, 0, 4, 32, 3, 1, 38, 2, 
+    32, 2, 0, 0, 0, 0, 0, 0, 0, 1, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 33, 4, 0, 
+    34, 1, 4, 3, 1, 32, 30, 2, 1, 32, 
+    0, 0, 27, 3, 0, 5, 32, 4, 0, 27, 
+    5, 4, 6, 38, 1, 32, 3, 0, 0, 0, 
+    0, 0, 0, 0, 2, 3, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    2, 30, 0, 0, 0, 0, 0, 0, 0, 73, 
-    110, 105, 116, 105, 97, 108, 105, 122, 101, 32, 
-    97, 110, 32, 101, 120, 116, 101, 110, 115, 105, 
-    111, 110, 32, 109, 111, 100, 117, 108, 101, 2, 
-    40, 0, 0, 0, 0, 0, 0, 0, 101, 120, 
-    116, 101, 110, 115, 105, 111, 110, 32, 109, 111, 
-    100, 117, 108, 101, 32, 123, 33, 114, 125, 32, 
-    101, 120, 101, 99, 117, 116, 101, 100, 32, 102, 
-    114, 111, 109, 32, 123, 33, 114, 125, 5, 0, 
+    0, 0, 0, 30, 4, 2, 41, 4, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 2, 30, 
+    0, 0, 0, 0, 0, 0, 0, 73, 110, 105, 
+    116, 105, 97, 108, 105, 122, 101, 32, 97, 110, 
+    32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 
+    32, 109, 111, 100, 117, 108, 101, 2, 40, 0, 
+    0, 0, 0, 0, 0, 0, 101, 120, 116, 101, 
+    110, 115, 105, 111, 110, 32, 109, 111, 100, 117, 
+    108, 101, 32, 123, 33, 114, 125, 32, 101, 120, 
+    101, 99, 117, 116, 101, 100, 32, 102, 114, 111, 
+    109, 32, 123, 33, 114, 125, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    7, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
-    0, 0, 0, 0, 0, 0, 101, 120, 101, 99, 
-    95, 109, 111, 100, 117, 108, 101, 7, 0, 0, 
-    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 4, 0, 0, 0, 0, 0, 0, 
-    0, 95, 105, 109, 112, 25, 0, 0, 0, 0, 
-    0, 0, 0, 95, 99, 97, 108, 108, 95, 119, 
-    105, 116, 104, 95, 102, 114, 97, 109, 101, 115, 
-    95, 114, 101, 109, 111, 118, 101, 100, 16, 0, 
-    0, 0, 0, 0, 0, 0, 95, 118, 101, 114, 
-    98, 111, 115, 101, 95, 109, 101, 115, 115, 97, 
-    103, 101, 12, 0, 0, 0, 0, 0, 0, 0, 
-    101, 120, 101, 99, 95, 100, 121, 110, 97, 109, 
-    105, 99, 4, 0, 0, 0, 0, 0, 0, 0, 
-    110, 97, 109, 101, 4, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 116, 104, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 
+    0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 
+    0, 0, 0, 0, 101, 120, 101, 99, 95, 109, 
+    111, 100, 117, 108, 101, 7, 0, 0, 0, 0, 
+    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 4, 0, 0, 0, 0, 0, 0, 0, 95, 
+    105, 109, 112, 25, 0, 0, 0, 0, 0, 0, 
+    0, 95, 99, 97, 108, 108, 95, 119, 105, 116, 
+    104, 95, 102, 114, 97, 109, 101, 115, 95, 114, 
+    101, 109, 111, 118, 101, 100, 16, 0, 0, 0, 
+    0, 0, 0, 0, 95, 118, 101, 114, 98, 111, 
+    115, 101, 95, 109, 101, 115, 115, 97, 103, 101, 
+    12, 0, 0, 0, 0, 0, 0, 0, 101, 120, 
+    101, 99, 95, 100, 121, 110, 97, 109, 105, 99, 
+    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+    109, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 6, 0, 0, 0, 0, 0, 0, 0, 
+    109, 111, 100, 117, 108, 101, 32, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
     0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 6, 0, 0, 0, 0, 0, 
-    0, 0, 109, 111, 100, 117, 108, 101, 32, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    69, 120, 116, 101, 110, 115, 105, 111, 110, 70, 
-    105, 108, 101, 76, 111, 97, 100, 101, 114, 46, 
-    95, 95, 104, 97, 115, 104, 95, 95, 46, 49, 
-    49, 54, 55, 58, 52, 0, 17, 0, 0, 0, 
-    0, 0, 0, 0, 33, 1, 0, 32, 2, 0, 
-    27, 3, 2, 1, 74, 3, 10, 1, 1, 0, 
-    75, 1, 0, 33, 2, 0, 32, 1, 0, 27, 
-    3, 1, 2, 74, 0, 74, 3, 10, 2, 1, 
-    0, 75, 1, 172, 39, 4, 0, 75, 0, 0, 
-    0, 1, 0, 4, 11, 41, 1, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    55, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 69, 120, 
+    116, 101, 110, 115, 105, 111, 110, 70, 105, 108, 
+    101, 76, 111, 97, 100, 101, 114, 46, 95, 95, 
+    104, 97, 115, 104, 95, 95, 46, 49, 49, 54, 
+    55, 58, 52, 0, 17, 0, 0, 0, 0, 0, 
+    0, 0, 33, 1, 0, 32, 2, 0, 27, 3, 
+    2, 1, 74, 3, 10, 1, 1, 0, 75, 1, 
+    0, 33, 2, 0, 32, 1, 0, 27, 3, 1, 
+    2, 74, 0, 74, 3, 10, 2, 1, 0, 75, 
+    1, 172, 39, 4, 0, 75, 0, 0, 0, 1, 
+    0, 4, 11, 41, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 104, 97, 
-    115, 104, 95, 95, 3, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    104, 97, 115, 104, 4, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 4, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 108, 102, 32, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 
-    57, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 69, 120, 
-    116, 101, 110, 115, 105, 111, 110, 70, 105, 108, 
-    101, 76, 111, 97, 100, 101, 114, 46, 105, 115, 
-    95, 112, 97, 99, 107, 97, 103, 101, 46, 49, 
-    49, 56, 52, 58, 52, 0, 28, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 33, 1, 0, 
-    32, 2, 0, 27, 3, 2, 3, 74, 3, 10, 
-    1, 1, 0, 75, 1, 0, 30, 2, 1, 1, 
-    1, 0, 2, 44, 0, 1, 33, 2, 1, 30, 
-    0, 2, 29, 1, 0, 74, 1, 4, 3, 1, 
-    75, 1, 172, 36, 4, 0, 0, 0, 1, 3, 
-    33, 1, 2, 74, 1, 10, 4, 1, 0, 75, 
-    1, 172, 74, 0, 74, 0, 10, 2, 1, 0, 
-    75, 1, 172, 39, 3, 0, 75, 0, 0, 41, 
-    3, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
-    0, 102, 105, 108, 101, 95, 110, 97, 109, 101, 
-    3, 0, 0, 0, 0, 0, 0, 0, 2, 49, 
-    0, 0, 0, 0, 0, 0, 0, 82, 101, 116, 
-    117, 114, 110, 32, 84, 114, 117, 101, 32, 105, 
-    102, 32, 116, 104, 101, 32, 101, 120, 116, 101, 
-    110, 115, 105, 111, 110, 32, 109, 111, 100, 117, 
-    108, 101, 32, 105, 115, 32, 97, 32, 112, 97, 
-    99, 107, 97, 103, 101, 46, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 2, 68, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 104, 97, 115, 104, 95, 95, 
+    3, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 104, 97, 115, 104, 
+    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+    109, 101, 4, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 32, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 7, 0, 
+    0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 
     0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
     116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
     110, 97, 108, 46, 69, 120, 116, 101, 110, 115, 
     105, 111, 110, 70, 105, 108, 101, 76, 111, 97, 
     100, 101, 114, 46, 105, 115, 95, 112, 97, 99, 
-    107, 97, 103, 101, 46, 60, 103, 101, 110, 101, 
-    120, 112, 114, 62, 46, 49, 49, 56, 55, 58, 
-    49, 56, 0, 0, 0, 0, 0, 0, 0, 0, 
+    107, 97, 103, 101, 46, 49, 49, 56, 52, 58, 
+    52, 0, 28, 0, 0, 0, 0, 0, 0, 0, 
+    30, 0, 0, 33, 1, 0, 32, 2, 0, 27, 
+    3, 2, 3, 74, 3, 10, 1, 1, 0, 75, 
+    1, 0, 30, 2, 1, 1, 1, 0, 2, 44, 
+    0, 1, 33, 2, 1, 30, 0, 2, 29, 1, 
+    0, 74, 1, 4, 3, 1, 75, 1, 172, 36, 
+    4, 0, 0, 0, 1, 3, 33, 1, 2, 74, 
+    1, 10, 4, 1, 0, 75, 1, 172, 74, 0, 
+    74, 0, 10, 2, 1, 0, 75, 1, 172, 39, 
+    3, 0, 75, 0, 0, 41, 3, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
+    0, 0, 0, 0, 0, 102, 105, 108, 101, 95, 
+    110, 97, 109, 101, 3, 0, 0, 0, 0, 0, 
+    0, 0, 2, 49, 0, 0, 0, 0, 0, 0, 
+    0, 82, 101, 116, 117, 114, 110, 32, 84, 114, 
+    117, 101, 32, 105, 102, 32, 116, 104, 101, 32, 
+    101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 
+    109, 111, 100, 117, 108, 101, 32, 105, 115, 32, 
+    97, 32, 112, 97, 99, 107, 97, 103, 101, 46, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    68, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 69, 120, 
+    116, 101, 110, 115, 105, 111, 110, 70, 105, 108, 
+    101, 76, 111, 97, 100, 101, 114, 46, 105, 115, 
+    95, 112, 97, 99, 107, 97, 103, 101, 46, 60, 
+    103, 101, 110, 101, 120, 112, 114, 62, 46, 49, 
+    49, 56, 55, 58, 49, 56, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
-    0, 10, 0, 0, 0, 0, 0, 0, 0, 105, 
-    115, 95, 112, 97, 99, 107, 97, 103, 101, 4, 
-    0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 
-    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
-    95, 115, 112, 108, 105, 116, 3, 0, 0, 0, 
-    0, 0, 0, 0, 97, 110, 121, 18, 0, 0, 
-    0, 0, 0, 0, 0, 69, 88, 84, 69, 78, 
-    83, 73, 79, 78, 95, 83, 85, 70, 70, 73, 
-    88, 69, 83, 4, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 8, 0, 0, 0, 0, 0, 0, 
-    0, 102, 117, 108, 108, 110, 97, 109, 101, 32, 
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 105, 115, 95, 112, 97, 99, 107, 
+    97, 103, 101, 4, 0, 0, 0, 0, 0, 0, 
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 95, 
+    112, 97, 116, 104, 95, 115, 112, 108, 105, 116, 
+    3, 0, 0, 0, 0, 0, 0, 0, 97, 110, 
+    121, 18, 0, 0, 0, 0, 0, 0, 0, 69, 
+    88, 84, 69, 78, 83, 73, 79, 78, 95, 83, 
+    85, 70, 70, 73, 88, 69, 83, 4, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 0, 
     0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 115, 101, 108, 102, 8, 0, 0, 
+    0, 0, 0, 0, 0, 102, 117, 108, 108, 110, 
+    97, 109, 101, 32, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
+    114, 110, 97, 108, 46, 69, 120, 116, 101, 110, 
+    115, 105, 111, 110, 70, 105, 108, 101, 76, 111, 
+    97, 100, 101, 114, 46, 103, 101, 116, 95, 115, 
+    111, 117, 114, 99, 101, 46, 49, 49, 57, 52, 
+    58, 52, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 30, 1, 1, 41, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 69, 120, 116, 101, 110, 115, 105, 111, 110, 
-    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
-    46, 103, 101, 116, 95, 115, 111, 117, 114, 99, 
-    101, 46, 49, 49, 57, 52, 58, 52, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
-    30, 1, 1, 41, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    53, 0, 0, 0, 0, 0, 0, 0, 82, 101, 
+    116, 117, 114, 110, 32, 78, 111, 110, 101, 32, 
+    97, 115, 32, 101, 120, 116, 101, 110, 115, 105, 
+    111, 110, 32, 109, 111, 100, 117, 108, 101, 115, 
+    32, 104, 97, 118, 101, 32, 110, 111, 32, 115, 
+    111, 117, 114, 99, 101, 32, 99, 111, 100, 101, 
+    46, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 103, 
+    101, 116, 95, 115, 111, 117, 114, 99, 101, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 115, 101, 108, 102, 8, 0, 0, 0, 0, 
+    0, 0, 0, 102, 117, 108, 108, 110, 97, 109, 
+    101, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 69, 120, 116, 101, 110, 115, 105, 
+    111, 110, 70, 105, 108, 101, 76, 111, 97, 100, 
+    101, 114, 46, 103, 101, 116, 95, 102, 105, 108, 
+    101, 110, 97, 109, 101, 46, 49, 49, 57, 56, 
+    58, 52, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 32, 1, 0, 27, 0, 1, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 53, 0, 
-    0, 0, 0, 0, 0, 0, 82, 101, 116, 117, 
-    114, 110, 32, 78, 111, 110, 101, 32, 97, 115, 
-    32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 
-    32, 109, 111, 100, 117, 108, 101, 115, 32, 104, 
-    97, 118, 101, 32, 110, 111, 32, 115, 111, 117, 
-    114, 99, 101, 32, 99, 111, 100, 101, 46, 5, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 2, 58, 0, 0, 0, 0, 0, 
+    0, 0, 82, 101, 116, 117, 114, 110, 32, 116, 
+    104, 101, 32, 112, 97, 116, 104, 32, 116, 111, 
+    32, 116, 104, 101, 32, 115, 111, 117, 114, 99, 
+    101, 32, 102, 105, 108, 101, 32, 97, 115, 32, 
+    102, 111, 117, 110, 100, 32, 98, 121, 32, 116, 
+    104, 101, 32, 102, 105, 110, 100, 101, 114, 46, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 12, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    95, 102, 105, 108, 101, 110, 97, 109, 101, 1, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 115, 101, 108, 102, 8, 0, 0, 
+    0, 0, 0, 0, 0, 102, 117, 108, 108, 110, 
+    97, 109, 101, 33, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 12, 
+    0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
+    114, 110, 97, 108, 46, 95, 103, 101, 116, 95, 
+    115, 117, 112, 112, 111, 114, 116, 101, 100, 95, 
+    102, 105, 108, 101, 95, 108, 111, 97, 100, 101, 
+    114, 115, 46, 49, 54, 52, 50, 58, 48, 0, 
+    38, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
+    0, 33, 1, 0, 33, 2, 1, 34, 3, 2, 
+    6, 1, 32, 38, 3, 32, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    74, 1, 74, 0, 4, 2, 2, 75, 1, 0, 
+    75, 1, 0, 45, 0, 2, 33, 0, 2, 33, 
+    1, 3, 74, 0, 74, 1, 4, 2, 2, 75, 
+    1, 0, 75, 1, 0, 45, 1, 2, 33, 0, 
+    4, 33, 1, 5, 74, 0, 74, 1, 4, 2, 
+    2, 75, 1, 135, 75, 1, 0, 45, 2, 2, 
+    32, 0, 0, 32, 1, 1, 32, 2, 2, 74, 
+    0, 74, 1, 74, 2, 3, 3, 3, 75, 1, 
+    172, 75, 1, 172, 75, 1, 182, 41, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    95, 0, 0, 0, 0, 0, 0, 0, 82, 101, 
+    116, 117, 114, 110, 115, 32, 97, 32, 108, 105, 
+    115, 116, 32, 111, 102, 32, 102, 105, 108, 101, 
+    45, 98, 97, 115, 101, 100, 32, 109, 111, 100, 
+    117, 108, 101, 32, 108, 111, 97, 100, 101, 114, 
+    115, 46, 10, 10, 32, 32, 32, 32, 69, 97, 
+    99, 104, 32, 105, 116, 101, 109, 32, 105, 115, 
+    32, 97, 32, 116, 117, 112, 108, 101, 32, 40, 
+    108, 111, 97, 100, 101, 114, 44, 32, 115, 117, 
+    102, 102, 105, 120, 101, 115, 41, 46, 10, 32, 
+    32, 32, 32, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 
+    0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 
+    95, 103, 101, 116, 95, 115, 117, 112, 112, 111, 
+    114, 116, 101, 100, 95, 102, 105, 108, 101, 95, 
+    108, 111, 97, 100, 101, 114, 115, 7, 0, 0, 
+    0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 
+    0, 0, 0, 69, 120, 116, 101, 110, 115, 105, 
+    111, 110, 70, 105, 108, 101, 76, 111, 97, 100, 
+    101, 114, 4, 0, 0, 0, 0, 0, 0, 0, 
+    95, 105, 109, 112, 16, 0, 0, 0, 0, 0, 
+    0, 0, 83, 111, 117, 114, 99, 101, 70, 105, 
+    108, 101, 76, 111, 97, 100, 101, 114, 15, 0, 
+    0, 0, 0, 0, 0, 0, 83, 79, 85, 82, 
+    67, 69, 95, 83, 85, 70, 70, 73, 88, 69, 
+    83, 20, 0, 0, 0, 0, 0, 0, 0, 83, 
+    111, 117, 114, 99, 101, 108, 101, 115, 115, 70, 
+    105, 108, 101, 76, 111, 97, 100, 101, 114, 17, 
+    0, 0, 0, 0, 0, 0, 0, 66, 89, 84, 
+    69, 67, 79, 68, 69, 95, 83, 85, 70, 70, 
+    73, 88, 69, 83, 18, 0, 0, 0, 0, 0, 
+    0, 0, 101, 120, 116, 101, 110, 115, 105, 111, 
+    110, 95, 115, 117, 102, 102, 105, 120, 101, 115, 
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
+    0, 0, 0, 0, 101, 120, 116, 101, 110, 115, 
+    105, 111, 110, 115, 6, 0, 0, 0, 0, 0, 
+    0, 0, 115, 111, 117, 114, 99, 101, 8, 0, 
+    0, 0, 0, 0, 0, 0, 98, 121, 116, 101, 
+    99, 111, 100, 101, 32, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 49, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 83, 111, 117, 114, 
+    99, 101, 76, 111, 97, 100, 101, 114, 46, 112, 
+    97, 116, 104, 95, 109, 116, 105, 109, 101, 46, 
+    56, 53, 56, 58, 52, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 33, 1, 0, 
+    40, 1, 1, 30, 0, 1, 41, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 2, 165, 
+    0, 0, 0, 0, 0, 0, 0, 79, 112, 116, 
+    105, 111, 110, 97, 108, 32, 109, 101, 116, 104, 
+    111, 100, 32, 116, 104, 97, 116, 32, 114, 101, 
+    116, 117, 114, 110, 115, 32, 116, 104, 101, 32, 
+    109, 111, 100, 105, 102, 105, 99, 97, 116, 105, 
+    111, 110, 32, 116, 105, 109, 101, 32, 40, 97, 
+    110, 32, 105, 110, 116, 41, 32, 102, 111, 114, 
+    32, 116, 104, 101, 10, 32, 32, 32, 32, 32, 
+    32, 32, 32, 115, 112, 101, 99, 105, 102, 105, 
+    101, 100, 32, 112, 97, 116, 104, 32, 40, 97, 
+    32, 115, 116, 114, 41, 46, 10, 10, 32, 32, 
+    32, 32, 32, 32, 32, 32, 82, 97, 105, 115, 
+    101, 115, 32, 79, 83, 69, 114, 114, 111, 114, 
+    32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 
+    112, 97, 116, 104, 32, 99, 97, 110, 110, 111, 
+    116, 32, 98, 101, 32, 104, 97, 110, 100, 108, 
+    101, 100, 46, 10, 32, 32, 32, 32, 32, 32, 
+    32, 32, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 95, 109, 116, 105, 109, 101, 
+    1, 0, 0, 0, 0, 0, 0, 0, 7, 0, 
+    0, 0, 0, 0, 0, 0, 79, 83, 69, 114, 
+    114, 111, 114, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 33, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 6, 
+    0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
+    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
+    115, 112, 97, 99, 101, 80, 97, 116, 104, 46, 
+    95, 95, 105, 110, 105, 116, 95, 95, 46, 49, 
+    50, 49, 53, 58, 52, 0, 27, 0, 0, 0, 
+    0, 0, 0, 0, 32, 0, 1, 32, 1, 0, 
+    43, 1, 0, 1, 32, 2, 2, 32, 0, 0, 
+    43, 0, 2, 2, 33, 1, 0, 32, 2, 0, 
+    34, 3, 2, 3, 1, 32, 38, 3, 32, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 74, 0, 74, 0, 10, 1, 1, 
+    0, 75, 1, 0, 39, 2, 0, 75, 0, 0, 
+    32, 3, 0, 43, 3, 2, 4, 32, 0, 0, 
+    27, 1, 0, 7, 32, 2, 0, 43, 2, 1, 
+    5, 32, 0, 3, 32, 1, 0, 43, 1, 0, 
+    6, 30, 2, 0, 41, 2, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
+    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
+    0, 0, 0, 0, 95, 95, 105, 110, 105, 116, 
+    95, 95, 8, 0, 0, 0, 0, 0, 0, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 116, 117, 
+    112, 108, 101, 5, 0, 0, 0, 0, 0, 0, 
+    0, 95, 110, 97, 109, 101, 5, 0, 0, 0, 
+    0, 0, 0, 0, 95, 112, 97, 116, 104, 16, 
+    0, 0, 0, 0, 0, 0, 0, 95, 103, 101, 
+    116, 95, 112, 97, 114, 101, 110, 116, 95, 112, 
+    97, 116, 104, 17, 0, 0, 0, 0, 0, 0, 
+    0, 95, 108, 97, 115, 116, 95, 112, 97, 114, 
+    101, 110, 116, 95, 112, 97, 116, 104, 11, 0, 
+    0, 0, 0, 0, 0, 0, 95, 108, 97, 115, 
+    116, 95, 101, 112, 111, 99, 104, 12, 0, 0, 
+    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
+    95, 102, 105, 110, 100, 101, 114, 6, 0, 0, 
+    0, 0, 0, 0, 0, 95, 101, 112, 111, 99, 
+    104, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 101, 108, 102, 4, 
+    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
+    101, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 11, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 116, 104, 95, 102, 105, 110, 100, 
+    101, 114, 33, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
+    0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 95, 78, 97, 109, 101, 115, 
+    112, 97, 99, 101, 80, 97, 116, 104, 46, 95, 
+    102, 105, 110, 100, 95, 112, 97, 114, 101, 110, 
+    116, 95, 112, 97, 116, 104, 95, 110, 97, 109, 
+    101, 115, 46, 49, 50, 50, 50, 58, 52, 0, 
+    31, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
+    0, 32, 1, 0, 27, 0, 1, 1, 34, 2, 
+    0, 0, 1, 32, 30, 1, 1, 38, 2, 32, 
+    1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 50, 3, 0, 0, 0, 
+    0, 0, 0, 0, 3, 4, 5, 0, 45, 1, 
+    3, 45, 2, 4, 45, 3, 5, 32, 0, 2, 
+    30, 1, 2, 6, 2, 0, 1, 0, 79, 3, 
+    2, 22, 2, 8, 0, 0, 0, 32, 0, 1, 
+    30, 1, 3, 74, 0, 74, 1, 4, 2, 2, 
+    75, 1, 0, 75, 1, 0, 41, 2, 30, 0, 
+    4, 30, 1, 5, 74, 0, 74, 1, 4, 2, 
+    2, 75, 1, 0, 75, 1, 184, 41, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 2, 
+    62, 0, 0, 0, 0, 0, 0, 0, 82, 101, 
+    116, 117, 114, 110, 115, 32, 97, 32, 116, 117, 
+    112, 108, 101, 32, 111, 102, 32, 40, 112, 97, 
+    114, 101, 110, 116, 45, 109, 111, 100, 117, 108, 
+    101, 45, 110, 97, 109, 101, 44, 32, 112, 97, 
+    114, 101, 110, 116, 45, 112, 97, 116, 104, 45, 
+    97, 116, 116, 114, 45, 110, 97, 109, 101, 41, 
+    2, 1, 0, 0, 0, 0, 0, 0, 0, 46, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    112, 97, 116, 104, 95, 95, 2, 3, 0, 0, 
+    0, 0, 0, 0, 0, 115, 121, 115, 2, 4, 
+    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
+    104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 10, 
-    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
-    95, 115, 111, 117, 114, 99, 101, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 8, 0, 0, 0, 0, 0, 0, 
-    0, 102, 117, 108, 108, 110, 97, 109, 101, 32, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 69, 120, 116, 101, 110, 115, 105, 111, 110, 
-    70, 105, 108, 101, 76, 111, 97, 100, 101, 114, 
-    46, 103, 101, 116, 95, 102, 105, 108, 101, 110, 
-    97, 109, 101, 46, 49, 49, 57, 56, 58, 52, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 32, 1, 0, 27, 0, 1, 0, 41, 
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
+    23, 0, 0, 0, 0, 0, 0, 0, 95, 102, 
+    105, 110, 100, 95, 112, 97, 114, 101, 110, 116, 
+    95, 112, 97, 116, 104, 95, 110, 97, 109, 101, 
+    115, 2, 0, 0, 0, 0, 0, 0, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 114, 112, 97, 
+    114, 116, 105, 116, 105, 111, 110, 5, 0, 0, 
+    0, 0, 0, 0, 0, 95, 110, 97, 109, 101, 
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 115, 101, 108, 102, 6, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 114, 101, 
+    110, 116, 3, 0, 0, 0, 0, 0, 0, 0, 
+    100, 111, 116, 2, 0, 0, 0, 0, 0, 0, 
+    0, 109, 101, 32, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
+    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
+    115, 112, 97, 99, 101, 76, 111, 97, 100, 101, 
+    114, 46, 103, 101, 116, 95, 115, 111, 117, 114, 
+    99, 101, 46, 49, 50, 56, 57, 58, 52, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 2, 58, 0, 0, 0, 0, 0, 
-    0, 0, 82, 101, 116, 117, 114, 110, 32, 116, 
-    104, 101, 32, 112, 97, 116, 104, 32, 116, 111, 
-    32, 116, 104, 101, 32, 115, 111, 117, 114, 99, 
-    101, 32, 102, 105, 108, 101, 32, 97, 115, 32, 
-    102, 111, 117, 110, 100, 32, 98, 121, 32, 116, 
-    104, 101, 32, 102, 105, 110, 100, 101, 114, 46, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 12, 
-    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
-    95, 102, 105, 108, 101, 110, 97, 109, 101, 1, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 115, 101, 108, 102, 8, 0, 0, 
-    0, 0, 0, 0, 0, 102, 117, 108, 108, 110, 
-    97, 109, 101, 32, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 12, 
-    0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 103, 101, 116, 95, 
-    115, 117, 112, 112, 111, 114, 116, 101, 100, 95, 
-    102, 105, 108, 101, 95, 108, 111, 97, 100, 101, 
-    114, 115, 46, 49, 54, 52, 50, 58, 48, 0, 
-    38, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
-    0, 33, 1, 0, 33, 2, 1, 34, 3, 2, 
-    6, 10, 3, 0, 0, 74, 1, 74, 0, 4, 
-    2, 2, 75, 1, 0, 75, 1, 0, 45, 0, 
-    2, 33, 0, 2, 33, 1, 3, 74, 0, 74, 
-    1, 4, 2, 2, 75, 1, 0, 75, 1, 0, 
-    45, 1, 2, 33, 0, 4, 33, 1, 5, 74, 
-    0, 74, 1, 4, 2, 2, 75, 1, 135, 75, 
-    1, 0, 45, 2, 2, 32, 0, 0, 32, 1, 
-    1, 32, 2, 2, 74, 0, 74, 1, 74, 2, 
-    3, 3, 3, 75, 1, 172, 75, 1, 172, 75, 
-    1, 182, 41, 3, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 103, 
+    101, 116, 95, 115, 111, 117, 114, 99, 101, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 115, 101, 108, 102, 8, 0, 0, 0, 0, 
+    0, 0, 0, 102, 117, 108, 108, 110, 97, 109, 
+    101, 33, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
+    0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 95, 78, 97, 109, 101, 115, 112, 
+    97, 99, 101, 80, 97, 116, 104, 46, 95, 103, 
+    101, 116, 95, 112, 97, 114, 101, 110, 116, 95, 
+    112, 97, 116, 104, 46, 49, 50, 51, 50, 58, 
+    52, 0, 18, 0, 0, 0, 0, 0, 0, 0, 
+    32, 1, 0, 34, 2, 1, 2, 1, 32, 38, 
+    2, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 50, 2, 0, 0, 
+    0, 0, 0, 0, 0, 1, 3, 0, 45, 1, 
+    1, 45, 2, 3, 33, 1, 0, 33, 0, 1, 
+    27, 2, 0, 3, 32, 3, 1, 1, 4, 2, 
+    3, 32, 5, 2, 74, 4, 74, 5, 10, 1, 
+    2, 0, 75, 1, 0, 75, 1, 121, 41, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 2, 95, 0, 0, 
-    0, 0, 0, 0, 0, 82, 101, 116, 117, 114, 
-    110, 115, 32, 97, 32, 108, 105, 115, 116, 32, 
-    111, 102, 32, 102, 105, 108, 101, 45, 98, 97, 
-    115, 101, 100, 32, 109, 111, 100, 117, 108, 101, 
-    32, 108, 111, 97, 100, 101, 114, 115, 46, 10, 
-    10, 32, 32, 32, 32, 69, 97, 99, 104, 32, 
-    105, 116, 101, 109, 32, 105, 115, 32, 97, 32, 
-    116, 117, 112, 108, 101, 32, 40, 108, 111, 97, 
-    100, 101, 114, 44, 32, 115, 117, 102, 102, 105, 
-    120, 101, 115, 41, 46, 10, 32, 32, 32, 32, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 12, 0, 0, 0, 0, 0, 0, 0, 27, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 16, 
     0, 0, 0, 0, 0, 0, 0, 95, 103, 101, 
-    116, 95, 115, 117, 112, 112, 111, 114, 116, 101, 
-    100, 95, 102, 105, 108, 101, 95, 108, 111, 97, 
-    100, 101, 114, 115, 7, 0, 0, 0, 0, 0, 
-    0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 
-    69, 120, 116, 101, 110, 115, 105, 111, 110, 70, 
-    105, 108, 101, 76, 111, 97, 100, 101, 114, 4, 
-    0, 0, 0, 0, 0, 0, 0, 95, 105, 109, 
-    112, 16, 0, 0, 0, 0, 0, 0, 0, 83, 
-    111, 117, 114, 99, 101, 70, 105, 108, 101, 76, 
-    111, 97, 100, 101, 114, 15, 0, 0, 0, 0, 
-    0, 0, 0, 83, 79, 85, 82, 67, 69, 95, 
-    83, 85, 70, 70, 73, 88, 69, 83, 20, 0, 
-    0, 0, 0, 0, 0, 0, 83, 111, 117, 114, 
-    99, 101, 108, 101, 115, 115, 70, 105, 108, 101, 
-    76, 111, 97, 100, 101, 114, 17, 0, 0, 0, 
-    0, 0, 0, 0, 66, 89, 84, 69, 67, 79, 
-    68, 69, 95, 83, 85, 70, 70, 73, 88, 69, 
-    83, 18, 0, 0, 0, 0, 0, 0, 0, 101, 
-    120, 116, 101, 110, 115, 105, 111, 110, 95, 115, 
-    117, 102, 102, 105, 120, 101, 115, 0, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
-    0, 101, 120, 116, 101, 110, 115, 105, 111, 110, 
-    115, 6, 0, 0, 0, 0, 0, 0, 0, 115, 
-    111, 117, 114, 99, 101, 8, 0, 0, 0, 0, 
-    0, 0, 0, 98, 121, 116, 101, 99, 111, 100, 
-    101, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
+    116, 95, 112, 97, 114, 101, 110, 116, 95, 112, 
+    97, 116, 104, 4, 0, 0, 0, 0, 0, 0, 
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 103, 
+    101, 116, 97, 116, 116, 114, 3, 0, 0, 0, 
+    0, 0, 0, 0, 115, 121, 115, 23, 0, 0, 
+    0, 0, 0, 0, 0, 95, 102, 105, 110, 100, 
+    95, 112, 97, 114, 101, 110, 116, 95, 112, 97, 
+    116, 104, 95, 110, 97, 109, 101, 115, 7, 0, 
+    0, 0, 0, 0, 0, 0, 109, 111, 100, 117, 
+    108, 101, 115, 0, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 18, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 114, 101, 110, 116, 95, 109, 111, 100, 117, 
+    108, 101, 95, 110, 97, 109, 101, 14, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 95, 
+    97, 116, 116, 114, 95, 110, 97, 109, 101, 33, 
     0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 83, 111, 117, 114, 99, 101, 76, 
-    111, 97, 100, 101, 114, 46, 112, 97, 116, 104, 
-    95, 109, 116, 105, 109, 101, 46, 56, 53, 56, 
-    58, 52, 0, 5, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 33, 1, 0, 40, 1, 1, 
-    30, 0, 1, 41, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 165, 0, 
-    0, 0, 0, 0, 0, 0, 79, 112, 116, 105, 
-    111, 110, 97, 108, 32, 109, 101, 116, 104, 111, 
-    100, 32, 116, 104, 97, 116, 32, 114, 101, 116, 
-    117, 114, 110, 115, 32, 116, 104, 101, 32, 109, 
-    111, 100, 105, 102, 105, 99, 97, 116, 105, 111, 
-    110, 32, 116, 105, 109, 101, 32, 40, 97, 110, 
-    32, 105, 110, 116, 41, 32, 102, 111, 114, 32, 
-    116, 104, 101, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 115, 112, 101, 99, 105, 102, 105, 101, 
-    100, 32, 112, 97, 116, 104, 32, 40, 97, 32, 
-    115, 116, 114, 41, 46, 10, 10, 32, 32, 32, 
-    32, 32, 32, 32, 32, 82, 97, 105, 115, 101, 
-    115, 32, 79, 83, 69, 114, 114, 111, 114, 32, 
-    119, 104, 101, 110, 32, 116, 104, 101, 32, 112, 
-    97, 116, 104, 32, 99, 97, 110, 110, 111, 116, 
-    32, 98, 101, 32, 104, 97, 110, 100, 108, 101, 
-    100, 46, 10, 32, 32, 32, 32, 32, 32, 32, 
-    32, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
+    0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 95, 78, 97, 109, 101, 115, 112, 97, 99, 
+    101, 76, 111, 97, 100, 101, 114, 46, 108, 111, 
+    97, 100, 95, 109, 111, 100, 117, 108, 101, 46, 
+    49, 51, 48, 49, 58, 52, 0, 13, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
+    0, 34, 2, 1, 1, 1, 32, 30, 3, 1, 
+    32, 1, 0, 27, 4, 1, 3, 38, 2, 32, 
+    2, 0, 0, 0, 0, 0, 0, 0, 3, 4, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 33, 1, 0, 34, 
+    2, 1, 2, 1, 32, 32, 3, 0, 32, 1, 
+    1, 38, 2, 32, 2, 0, 0, 0, 0, 0, 
+    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 10, 0, 0, 0, 0, 0, 0, 0, 112, 
-    97, 116, 104, 95, 109, 116, 105, 109, 101, 1, 
-    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
-    0, 0, 0, 0, 0, 79, 83, 69, 114, 114, 
-    111, 114, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 98, 0, 0, 0, 0, 0, 0, 
+    0, 76, 111, 97, 100, 32, 97, 32, 110, 97, 
+    109, 101, 115, 112, 97, 99, 101, 32, 109, 111, 
+    100, 117, 108, 101, 46, 10, 10, 32, 32, 32, 
+    32, 32, 32, 32, 32, 84, 104, 105, 115, 32, 
+    109, 101, 116, 104, 111, 100, 32, 105, 115, 32, 
+    100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 
+    46, 32, 32, 85, 115, 101, 32, 101, 120, 101, 
+    99, 95, 109, 111, 100, 117, 108, 101, 40, 41, 
+    32, 105, 110, 115, 116, 101, 97, 100, 46, 10, 
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 2, 
+    38, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+    109, 101, 115, 112, 97, 99, 101, 32, 109, 111, 
+    100, 117, 108, 101, 32, 108, 111, 97, 100, 101, 
+    100, 32, 119, 105, 116, 104, 32, 112, 97, 116, 
+    104, 32, 123, 33, 114, 125, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 
+    0, 0, 0, 108, 111, 97, 100, 95, 109, 111, 
+    100, 117, 108, 101, 4, 0, 0, 0, 0, 0, 
+    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    16, 0, 0, 0, 0, 0, 0, 0, 95, 118, 
+    101, 114, 98, 111, 115, 101, 95, 109, 101, 115, 
+    115, 97, 103, 101, 17, 0, 0, 0, 0, 0, 
+    0, 0, 95, 108, 111, 97, 100, 95, 109, 111, 
+    100, 117, 108, 101, 95, 115, 104, 105, 109, 5, 
+    0, 0, 0, 0, 0, 0, 0, 95, 112, 97, 
+    116, 104, 0, 0, 0, 0, 0, 0, 0, 0, 
     2, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
     0, 0, 0, 0, 0, 0, 115, 101, 108, 102, 
-    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 32, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
-    0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 95, 78, 97, 109, 101, 115, 
-    112, 97, 99, 101, 80, 97, 116, 104, 46, 95, 
-    95, 105, 110, 105, 116, 95, 95, 46, 49, 50, 
-    49, 53, 58, 52, 0, 27, 0, 0, 0, 0, 
-    0, 0, 0, 32, 0, 1, 32, 1, 0, 43, 
-    1, 0, 1, 32, 2, 2, 32, 0, 0, 43, 
-    0, 2, 2, 33, 1, 0, 32, 2, 0, 34, 
-    3, 2, 3, 10, 3, 0, 0, 74, 0, 74, 
-    0, 10, 1, 1, 0, 75, 1, 0, 39, 2, 
-    0, 75, 0, 0, 32, 3, 0, 43, 3, 2, 
-    4, 32, 0, 0, 27, 1, 0, 7, 32, 2, 
-    0, 43, 2, 1, 5, 32, 0, 3, 32, 1, 
-    0, 43, 1, 0, 6, 30, 2, 0, 41, 2, 
-    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 102, 117, 
+    108, 108, 110, 97, 109, 101, 33, 0, 0, 0, 
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    53, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 95, 78, 
+    97, 109, 101, 115, 112, 97, 99, 101, 80, 97, 
+    116, 104, 46, 95, 95, 103, 101, 116, 105, 116, 
+    101, 109, 95, 95, 46, 49, 50, 53, 51, 58, 
+    52, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
+    32, 1, 0, 34, 2, 1, 0, 1, 32, 38, 
+    2, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 32, 1, 1, 1, 
+    2, 0, 1, 41, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
-    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 105, 110, 105, 116, 95, 95, 8, 0, 
-    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
-    0, 0, 0, 0, 116, 117, 112, 108, 101, 5, 
-    0, 0, 0, 0, 0, 0, 0, 95, 110, 97, 
-    109, 101, 5, 0, 0, 0, 0, 0, 0, 0, 
-    95, 112, 97, 116, 104, 16, 0, 0, 0, 0, 
-    0, 0, 0, 95, 103, 101, 116, 95, 112, 97, 
-    114, 101, 110, 116, 95, 112, 97, 116, 104, 17, 
-    0, 0, 0, 0, 0, 0, 0, 95, 108, 97, 
-    115, 116, 95, 112, 97, 114, 101, 110, 116, 95, 
-    112, 97, 116, 104, 11, 0, 0, 0, 0, 0, 
-    0, 0, 95, 108, 97, 115, 116, 95, 101, 112, 
-    111, 99, 104, 12, 0, 0, 0, 0, 0, 0, 
-    0, 95, 112, 97, 116, 104, 95, 102, 105, 110, 
-    100, 101, 114, 6, 0, 0, 0, 0, 0, 0, 
-    0, 95, 101, 112, 111, 99, 104, 0, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 101, 108, 102, 4, 0, 0, 0, 0, 
-    0, 0, 0, 110, 97, 109, 101, 4, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 11, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
-    104, 95, 102, 105, 110, 100, 101, 114, 32, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
-    80, 97, 116, 104, 46, 95, 102, 105, 110, 100, 
-    95, 112, 97, 114, 101, 110, 116, 95, 112, 97, 
-    116, 104, 95, 110, 97, 109, 101, 115, 46, 49, 
-    50, 50, 50, 58, 52, 0, 33, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 32, 1, 0, 
-    27, 0, 1, 1, 34, 2, 0, 0, 30, 1, 
-    1, 74, 1, 10, 2, 1, 0, 75, 1, 0, 
-    50, 3, 0, 0, 0, 0, 0, 0, 0, 3, 
-    4, 5, 0, 45, 1, 3, 45, 2, 4, 45, 
-    3, 5, 32, 0, 2, 30, 1, 2, 6, 2, 
-    0, 1, 0, 79, 3, 2, 22, 2, 8, 0, 
-    0, 0, 32, 0, 1, 30, 1, 3, 74, 0, 
-    74, 1, 4, 2, 2, 75, 1, 0, 75, 1, 
-    0, 41, 2, 30, 0, 4, 30, 1, 5, 74, 
-    0, 74, 1, 4, 2, 2, 75, 1, 0, 75, 
-    1, 184, 41, 2, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
-    0, 0, 0, 0, 0, 0, 2, 62, 0, 0, 
-    0, 0, 0, 0, 0, 82, 101, 116, 117, 114, 
-    110, 115, 32, 97, 32, 116, 117, 112, 108, 101, 
-    32, 111, 102, 32, 40, 112, 97, 114, 101, 110, 
-    116, 45, 109, 111, 100, 117, 108, 101, 45, 110, 
-    97, 109, 101, 44, 32, 112, 97, 114, 101, 110, 
-    116, 45, 112, 97, 116, 104, 45, 97, 116, 116, 
-    114, 45, 110, 97, 109, 101, 41, 2, 1, 0, 
-    0, 0, 0, 0, 0, 0, 46, 2, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 8, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 112, 97, 116, 
-    104, 95, 95, 2, 3, 0, 0, 0, 0, 0, 
-    0, 0, 115, 121, 115, 2, 4, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 
-    0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 
-    0, 0, 0, 0, 0, 95, 102, 105, 110, 100, 
-    95, 112, 97, 114, 101, 110, 116, 95, 112, 97, 
-    116, 104, 95, 110, 97, 109, 101, 115, 2, 0, 
-    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
-    0, 0, 0, 0, 114, 112, 97, 114, 116, 105, 
-    116, 105, 111, 110, 5, 0, 0, 0, 0, 0, 
-    0, 0, 95, 110, 97, 109, 101, 0, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 101, 108, 102, 6, 0, 0, 0, 0, 
-    0, 0, 0, 112, 97, 114, 101, 110, 116, 3, 
-    0, 0, 0, 0, 0, 0, 0, 100, 111, 116, 
-    2, 0, 0, 0, 0, 0, 0, 0, 109, 101, 
-    32, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 95, 78, 97, 109, 101, 115, 112, 97, 
-    99, 101, 76, 111, 97, 100, 101, 114, 46, 103, 
-    101, 116, 95, 115, 111, 117, 114, 99, 101, 46, 
-    49, 50, 56, 57, 58, 52, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 41, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 103, 101, 116, 105, 116, 101, 
+    109, 95, 95, 1, 0, 0, 0, 0, 0, 0, 
+    0, 12, 0, 0, 0, 0, 0, 0, 0, 95, 
+    114, 101, 99, 97, 108, 99, 117, 108, 97, 116, 
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 115, 101, 108, 102, 5, 
+    0, 0, 0, 0, 0, 0, 0, 105, 110, 100, 
+    101, 120, 32, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 95, 78, 97, 109, 101, 115, 
+    112, 97, 99, 101, 80, 97, 116, 104, 46, 95, 
+    95, 115, 101, 116, 105, 116, 101, 109, 95, 95, 
+    46, 49, 50, 53, 54, 58, 52, 0, 7, 0, 
+    0, 0, 0, 0, 0, 0, 32, 0, 2, 32, 
+    1, 0, 27, 2, 1, 0, 32, 3, 1, 48, 
+    2, 3, 0, 30, 1, 0, 41, 1, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
-    116, 95, 115, 111, 117, 114, 99, 101, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 8, 0, 0, 0, 0, 0, 
-    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
-    32, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
-    0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 95, 78, 97, 109, 101, 115, 112, 97, 
-    99, 101, 80, 97, 116, 104, 46, 95, 103, 101, 
-    116, 95, 112, 97, 114, 101, 110, 116, 95, 112, 
-    97, 116, 104, 46, 49, 50, 51, 50, 58, 52, 
-    0, 18, 0, 0, 0, 0, 0, 0, 0, 32, 
-    1, 0, 34, 2, 1, 2, 10, 2, 0, 0, 
-    50, 2, 0, 0, 0, 0, 0, 0, 0, 1, 
-    3, 0, 45, 1, 1, 45, 2, 3, 33, 1, 
-    0, 33, 0, 1, 27, 2, 0, 3, 32, 3, 
-    1, 1, 4, 2, 3, 32, 5, 2, 74, 4, 
-    74, 5, 10, 1, 2, 0, 75, 1, 0, 75, 
-    1, 121, 41, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
+    0, 0, 0, 0, 0, 0, 95, 95, 115, 101, 
+    116, 105, 116, 101, 109, 95, 95, 1, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 95, 112, 97, 116, 104, 0, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 115, 101, 108, 102, 5, 0, 0, 0, 
+    0, 0, 0, 0, 105, 110, 100, 101, 120, 4, 
+    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
+    104, 33, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 80, 97, 116, 104, 70, 105, 110, 
+    100, 101, 114, 46, 95, 112, 97, 116, 104, 95, 
+    104, 111, 111, 107, 115, 46, 49, 51, 51, 50, 
+    58, 52, 0, 44, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 33, 1, 0, 27, 0, 1, 
+    5, 30, 2, 1, 6, 1, 0, 2, 7, 79, 
+    3, 1, 19, 1, 4, 0, 0, 0, 33, 0, 
+    0, 27, 2, 0, 5, 49, 1, 2, 3, 17, 
+    0, 0, 0, 0, 79, 0, 1, 19, 1, 6, 
+    0, 0, 0, 33, 0, 1, 34, 1, 0, 4, 
+    1, 32, 30, 2, 2, 33, 3, 2, 38, 1, 
+    32, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 33, 0, 0, 27, 1, 0, 5, 13, 
+    2, 1, 17, 0, 0, 0, 0, 9, 0, 2, 
+    8, 0, 0, 0, 0, 0, 0, 0, 45, 2, 
+    0, 17, 0, 0, 0, 0, 17, 10, 0, 0, 
+    0, 33, 1, 3, 21, 1, 5, 0, 0, 0, 
+    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    9, 0, 2, 0, 0, 0, 0, 248, 255, 255, 
+    255, 30, 1, 1, 41, 1, 52, 30, 0, 1, 
+    41, 0, 32, 1, 2, 32, 2, 1, 74, 2, 
+    10, 1, 1, 0, 75, 1, 173, 17, 0, 0, 
+    0, 0, 41, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 
+    27, 0, 0, 0, 0, 0, 0, 0, 27, 0, 
+    0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 
+    0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 
+    0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 2, 46, 0, 0, 0, 0, 0, 0, 
+    0, 83, 101, 97, 114, 99, 104, 32, 115, 121, 
+    115, 46, 112, 97, 116, 104, 95, 104, 111, 111, 
+    107, 115, 32, 102, 111, 114, 32, 97, 32, 102, 
+    105, 110, 100, 101, 114, 32, 102, 111, 114, 32, 
+    39, 112, 97, 116, 104, 39, 46, 5, 2, 23, 
+    0, 0, 0, 0, 0, 0, 0, 115, 121, 115, 
+    46, 112, 97, 116, 104, 95, 104, 111, 111, 107, 
+    115, 32, 105, 115, 32, 101, 109, 112, 116, 121, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 
-    0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 
-    0, 0, 0, 95, 103, 101, 116, 95, 112, 97, 
-    114, 101, 110, 116, 95, 112, 97, 116, 104, 4, 
-    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
-    0, 0, 0, 0, 0, 103, 101, 116, 97, 116, 
-    116, 114, 3, 0, 0, 0, 0, 0, 0, 0, 
-    115, 121, 115, 23, 0, 0, 0, 0, 0, 0, 
-    0, 95, 102, 105, 110, 100, 95, 112, 97, 114, 
-    101, 110, 116, 95, 112, 97, 116, 104, 95, 110, 
-    97, 109, 101, 115, 7, 0, 0, 0, 0, 0, 
-    0, 0, 109, 111, 100, 117, 108, 101, 115, 0, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
-    0, 0, 0, 115, 101, 108, 102, 18, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 114, 101, 110, 
-    116, 95, 109, 111, 100, 117, 108, 101, 95, 110, 
-    97, 109, 101, 14, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 95, 97, 116, 116, 114, 
-    95, 110, 97, 109, 101, 32, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 6, 0, 0, 0, 0, 0, 0, 0, 55, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 95, 78, 97, 
-    109, 101, 115, 112, 97, 99, 101, 76, 111, 97, 
-    100, 101, 114, 46, 108, 111, 97, 100, 95, 109, 
-    111, 100, 117, 108, 101, 46, 49, 51, 48, 49, 
-    58, 52, 0, 21, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 33, 1, 0, 34, 2, 1, 
-    1, 30, 3, 1, 32, 1, 0, 27, 4, 1, 
-    3, 74, 3, 74, 4, 10, 2, 2, 0, 75, 
-    1, 0, 75, 1, 0, 33, 1, 0, 34, 2, 
-    1, 2, 32, 3, 0, 32, 1, 1, 74, 3, 
-    74, 1, 10, 2, 2, 0, 75, 1, 0, 75, 
-    1, 0, 41, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 2, 98, 0, 0, 
-    0, 0, 0, 0, 0, 76, 111, 97, 100, 32, 
-    97, 32, 110, 97, 109, 101, 115, 112, 97, 99, 
-    101, 32, 109, 111, 100, 117, 108, 101, 46, 10, 
-    10, 32, 32, 32, 32, 32, 32, 32, 32, 84, 
-    104, 105, 115, 32, 109, 101, 116, 104, 111, 100, 
-    32, 105, 115, 32, 100, 101, 112, 114, 101, 99, 
-    97, 116, 101, 100, 46, 32, 32, 85, 115, 101, 
-    32, 101, 120, 101, 99, 95, 109, 111, 100, 117, 
-    108, 101, 40, 41, 32, 105, 110, 115, 116, 101, 
-    97, 100, 46, 10, 10, 32, 32, 32, 32, 32, 
-    32, 32, 32, 2, 38, 0, 0, 0, 0, 0, 
-    0, 0, 110, 97, 109, 101, 115, 112, 97, 99, 
-    101, 32, 109, 111, 100, 117, 108, 101, 32, 108, 
-    111, 97, 100, 101, 100, 32, 119, 105, 116, 104, 
-    32, 112, 97, 116, 104, 32, 123, 33, 114, 125, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 11, 
+    0, 0, 0, 0, 0, 0, 0, 95, 112, 97, 
+    116, 104, 95, 104, 111, 111, 107, 115, 6, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 115, 121, 115, 9, 0, 0, 
+    0, 0, 0, 0, 0, 95, 119, 97, 114, 110, 
+    105, 110, 103, 115, 13, 0, 0, 0, 0, 0, 
+    0, 0, 73, 109, 112, 111, 114, 116, 87, 97, 
+    114, 110, 105, 110, 103, 11, 0, 0, 0, 0, 
+    0, 0, 0, 73, 109, 112, 111, 114, 116, 69, 
+    114, 114, 111, 114, 4, 0, 0, 0, 0, 0, 
+    0, 0, 119, 97, 114, 110, 10, 0, 0, 0, 
+    0, 0, 0, 0, 112, 97, 116, 104, 95, 104, 
+    111, 111, 107, 115, 0, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 99, 108, 
+    115, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 4, 0, 0, 0, 0, 0, 0, 
+    0, 104, 111, 111, 107, 33, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 54, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 95, 78, 97, 
+    109, 101, 115, 112, 97, 99, 101, 80, 97, 116, 
+    104, 46, 95, 95, 99, 111, 110, 116, 97, 105, 
+    110, 115, 95, 95, 46, 49, 50, 54, 53, 58, 
+    52, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
+    32, 1, 1, 32, 2, 0, 34, 3, 2, 0, 
+    1, 32, 38, 3, 32, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 
+    2, 1, 0, 8, 41, 2, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 6, 0, 0, 0, 0, 0, 0, 0, 11, 
-    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
-    100, 95, 109, 111, 100, 117, 108, 101, 4, 0, 
-    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 16, 0, 0, 0, 0, 0, 
-    0, 0, 95, 118, 101, 114, 98, 111, 115, 101, 
-    95, 109, 101, 115, 115, 97, 103, 101, 17, 0, 
-    0, 0, 0, 0, 0, 0, 95, 108, 111, 97, 
-    100, 95, 109, 111, 100, 117, 108, 101, 95, 115, 
-    104, 105, 109, 5, 0, 0, 0, 0, 0, 0, 
-    0, 95, 112, 97, 116, 104, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 8, 0, 0, 0, 0, 0, 
-    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
-    32, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 95, 78, 97, 109, 101, 115, 112, 97, 
-    99, 101, 80, 97, 116, 104, 46, 95, 95, 103, 
-    101, 116, 105, 116, 101, 109, 95, 95, 46, 49, 
-    50, 53, 51, 58, 52, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 32, 1, 0, 34, 2, 1, 
-    0, 10, 2, 0, 0, 32, 1, 1, 1, 2, 
-    0, 1, 41, 2, 0, 0, 0, 0, 0, 0, 
     0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
@@ -7932,283 +8590,186 @@ std::vector<uint8_t> _bootstrap_external
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 103, 101, 116, 105, 116, 
-    101, 109, 95, 95, 1, 0, 0, 0, 0, 0, 
-    0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 
-    95, 114, 101, 99, 97, 108, 99, 117, 108, 97, 
-    116, 101, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 115, 101, 108, 102, 
-    5, 0, 0, 0, 0, 0, 0, 0, 105, 110, 
-    100, 101, 120, 32, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 
+    0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 
+    0, 0, 0, 95, 95, 99, 111, 110, 116, 97, 
+    105, 110, 115, 95, 95, 1, 0, 0, 0, 0, 
+    0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 
+    0, 95, 114, 101, 99, 97, 108, 99, 117, 108, 
+    97, 116, 101, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 4, 0, 0, 0, 0, 0, 0, 0, 105, 
+    116, 101, 109, 34, 0, 0, 0, 0, 0, 0, 
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 26, 
+    0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 
     0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
     115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
-    115, 112, 97, 99, 101, 80, 97, 116, 104, 46, 
-    95, 95, 115, 101, 116, 105, 116, 101, 109, 95, 
-    95, 46, 49, 50, 53, 54, 58, 52, 0, 7, 
-    0, 0, 0, 0, 0, 0, 0, 32, 0, 2, 
-    32, 1, 0, 27, 2, 1, 0, 32, 3, 1, 
-    48, 2, 3, 0, 30, 1, 0, 41, 1, 0, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    114, 110, 97, 108, 46, 70, 105, 108, 101, 70, 
+    105, 110, 100, 101, 114, 46, 95, 102, 105, 108, 
+    108, 95, 99, 97, 99, 104, 101, 46, 49, 53, 
+    54, 52, 58, 52, 0, 127, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 32, 1, 0, 27, 
+    0, 1, 16, 45, 1, 0, 17, 16, 0, 0, 
+    0, 33, 0, 1, 33, 1, 2, 33, 2, 3, 
+    74, 0, 74, 1, 74, 2, 4, 3, 3, 75, 
+    1, 0, 75, 1, 0, 75, 1, 0, 21, 3, 
+    4, 0, 0, 0, 3, 0, 0, 45, 2, 0, 
+    5, 17, 18, 0, 0, 0, 52, 33, 1, 0, 
+    34, 2, 1, 7, 0, 0, 32, 0, 1, 79, 
+    1, 0, 22, 0, 4, 0, 0, 0, 33, 1, 
+    0, 34, 3, 1, 8, 1, 32, 38, 3, 32, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 74, 
+    0, 74, 0, 10, 2, 1, 0, 75, 1, 0, 
+    39, 1, 0, 75, 0, 0, 45, 2, 1, 17, 
+    0, 0, 0, 0, 33, 0, 4, 27, 1, 0, 
+    17, 34, 2, 1, 9, 1, 32, 30, 3, 1, 
+    38, 2, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 49, 1, 
+    0, 3, 79, 2, 1, 22, 1, 55, 0, 0, 
+    0, 33, 2, 5, 10, 2, 0, 0, 45, 3, 
+    0, 32, 2, 2, 13, 0, 2, 17, 0, 0, 
+    0, 0, 9, 1, 0, 43, 0, 0, 0, 0, 
+    0, 0, 0, 45, 4, 1, 17, 0, 0, 0, 
+    0, 32, 2, 4, 34, 3, 2, 12, 1, 32, 
+    30, 4, 2, 74, 0, 38, 3, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 39, 2, 0, 75, 0, 0, 50, 
+    3, 0, 0, 0, 0, 0, 0, 0, 6, 7, 
+    5, 2, 45, 5, 6, 45, 6, 7, 45, 7, 
+    5, 32, 2, 6, 79, 3, 2, 22, 2, 3, 
+    0, 0, 0, 32, 3, 5, 45, 8, 3, 17, 
+    15, 0, 0, 0, 30, 2, 3, 34, 3, 2, 
+    13, 1, 32, 32, 4, 5, 32, 2, 7, 34, 
+    5, 2, 14, 1, 33, 74, 0, 38, 5, 33, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 39, 6, 0, 75, 0, 0, 
+    74, 0, 38, 3, 32, 2, 0, 0, 0, 0, 
+    0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 39, 2, 0, 75, 0, 0, 45, 8, 2, 
+    17, 0, 0, 0, 0, 32, 2, 3, 34, 3, 
+    2, 15, 1, 32, 32, 4, 8, 74, 0, 38, 
+    3, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 39, 2, 0, 
+    75, 0, 0, 17, 0, 0, 0, 0, 9, 1, 
+    0, 0, 0, 0, 0, 213, 255, 255, 255, 17, 
+    0, 0, 0, 0, 32, 0, 3, 32, 1, 0, 
+    43, 1, 0, 10, 17, 8, 0, 0, 0, 33, 
+    1, 5, 32, 2, 2, 74, 2, 10, 1, 1, 
+    0, 75, 1, 0, 32, 3, 0, 43, 3, 0, 
+    10, 17, 0, 0, 0, 0, 33, 0, 4, 27, 
+    1, 0, 17, 34, 2, 1, 9, 1, 32, 33, 
+    3, 6, 38, 2, 32, 1, 0, 0, 0, 0, 
     0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 11, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 115, 101, 116, 105, 116, 101, 109, 95, 95, 
-    1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
-    0, 0, 0, 0, 0, 0, 95, 112, 97, 116, 
-    104, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 115, 101, 108, 102, 5, 
-    0, 0, 0, 0, 0, 0, 0, 105, 110, 100, 
-    101, 120, 4, 0, 0, 0, 0, 0, 0, 0, 
-    112, 97, 116, 104, 32, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 49, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 80, 97, 116, 104, 
-    70, 105, 110, 100, 101, 114, 46, 95, 112, 97, 
-    116, 104, 95, 104, 111, 111, 107, 115, 46, 49, 
-    51, 51, 50, 58, 52, 0, 49, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 33, 1, 0, 
-    27, 0, 1, 5, 30, 2, 1, 6, 1, 0, 
-    2, 7, 79, 3, 1, 19, 1, 4, 0, 0, 
-    0, 33, 0, 0, 27, 2, 0, 5, 49, 1, 
-    2, 3, 17, 0, 0, 0, 0, 79, 0, 1, 
-    19, 1, 10, 0, 0, 0, 33, 0, 1, 34, 
-    1, 0, 4, 30, 2, 2, 33, 3, 2, 74, 
-    2, 74, 3, 10, 1, 2, 0, 75, 1, 95, 
-    75, 1, 33, 17, 0, 0, 0, 0, 33, 0, 
-    0, 27, 1, 0, 5, 13, 2, 1, 17, 0, 
-    0, 0, 0, 9, 0, 2, 9, 0, 0, 0, 
-    0, 0, 0, 0, 45, 2, 0, 17, 0, 0, 
-    0, 0, 42, 1, 0, 0, 0, 17, 10, 0, 
-    0, 0, 33, 1, 3, 21, 1, 5, 0, 0, 
-    0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 
-    0, 9, 0, 2, 0, 0, 0, 0, 247, 255, 
-    255, 255, 30, 1, 1, 41, 1, 52, 30, 0, 
-    1, 41, 0, 32, 1, 2, 32, 2, 1, 74, 
-    2, 10, 1, 1, 0, 75, 1, 173, 17, 0, 
-    0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 2, 46, 0, 
-    0, 0, 0, 0, 0, 0, 83, 101, 97, 114, 
-    99, 104, 32, 115, 121, 115, 46, 112, 97, 116, 
-    104, 95, 104, 111, 111, 107, 115, 32, 102, 111, 
-    114, 32, 97, 32, 102, 105, 110, 100, 101, 114, 
-    32, 102, 111, 114, 32, 39, 112, 97, 116, 104, 
-    39, 46, 5, 2, 23, 0, 0, 0, 0, 0, 
-    0, 0, 115, 121, 115, 46, 112, 97, 116, 104, 
-    95, 104, 111, 111, 107, 115, 32, 105, 115, 32, 
-    101, 109, 112, 116, 121, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 
-    0, 0, 95, 112, 97, 116, 104, 95, 104, 111, 
-    111, 107, 115, 6, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 115, 
-    121, 115, 9, 0, 0, 0, 0, 0, 0, 0, 
-    95, 119, 97, 114, 110, 105, 110, 103, 115, 13, 
-    0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 
-    111, 114, 116, 87, 97, 114, 110, 105, 110, 103, 
-    11, 0, 0, 0, 0, 0, 0, 0, 73, 109, 
-    112, 111, 114, 116, 69, 114, 114, 111, 114, 4, 
-    0, 0, 0, 0, 0, 0, 0, 119, 97, 114, 
-    110, 10, 0, 0, 0, 0, 0, 0, 0, 112, 
-    97, 116, 104, 95, 104, 111, 111, 107, 115, 0, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 99, 108, 115, 4, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 4, 0, 
-    0, 0, 0, 0, 0, 0, 104, 111, 111, 107, 
-    32, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 95, 78, 97, 109, 101, 115, 112, 97, 
-    99, 101, 80, 97, 116, 104, 46, 95, 95, 99, 
-    111, 110, 116, 97, 105, 110, 115, 95, 95, 46, 
-    49, 50, 54, 53, 58, 52, 0, 6, 0, 0, 
-    0, 0, 0, 0, 0, 32, 1, 1, 32, 2, 
-    0, 34, 3, 2, 0, 10, 3, 0, 0, 6, 
-    2, 1, 0, 8, 41, 2, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    79, 1, 0, 19, 0, 9, 0, 0, 0, 30, 
+    1, 4, 36, 2, 1, 0, 0, 0, 0, 32, 
+    3, 2, 74, 3, 10, 2, 1, 0, 75, 1, 
+    0, 32, 1, 0, 43, 1, 0, 11, 17, 0, 
+    0, 0, 0, 30, 0, 5, 41, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 
+    21, 0, 0, 0, 0, 0, 0, 0, 37, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 
+    0, 0, 0, 0, 0, 0, 2, 68, 0, 0, 
+    0, 0, 0, 0, 0, 70, 105, 108, 108, 32, 
+    116, 104, 101, 32, 99, 97, 99, 104, 101, 32, 
+    111, 102, 32, 112, 111, 116, 101, 110, 116, 105, 
+    97, 108, 32, 109, 111, 100, 117, 108, 101, 115, 
+    32, 97, 110, 100, 32, 112, 97, 99, 107, 97, 
+    103, 101, 115, 32, 102, 111, 114, 32, 116, 104, 
+    105, 115, 32, 100, 105, 114, 101, 99, 116, 111, 
+    114, 121, 46, 2, 3, 0, 0, 0, 0, 0, 
+    0, 0, 119, 105, 110, 2, 1, 0, 0, 0, 
+    0, 0, 0, 0, 46, 2, 5, 0, 0, 0, 
+    0, 0, 0, 0, 123, 125, 46, 123, 125, 2, 
+    60, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
+    108, 101, 70, 105, 110, 100, 101, 114, 46, 95, 
+    102, 105, 108, 108, 95, 99, 97, 99, 104, 101, 
+    46, 60, 115, 101, 116, 99, 111, 109, 112, 62, 
+    46, 49, 53, 57, 51, 58, 51, 57, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 
-    0, 0, 0, 0, 0, 95, 95, 99, 111, 110, 
-    116, 97, 105, 110, 115, 95, 95, 1, 0, 0, 
-    0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 
-    0, 0, 0, 95, 114, 101, 99, 97, 108, 99, 
-    117, 108, 97, 116, 101, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 4, 0, 0, 0, 0, 0, 0, 
-    0, 105, 116, 101, 109, 32, 0, 0, 0, 0, 
-    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
-    0, 26, 0, 0, 0, 0, 0, 0, 0, 49, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 70, 105, 108, 
-    101, 70, 105, 110, 100, 101, 114, 46, 95, 102, 
-    105, 108, 108, 95, 99, 97, 99, 104, 101, 46, 
-    49, 53, 54, 52, 58, 52, 0, 141, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 32, 1, 
-    0, 27, 0, 1, 16, 45, 1, 0, 42, 1, 
-    0, 0, 0, 17, 16, 0, 0, 0, 33, 0, 
-    1, 33, 1, 2, 33, 2, 3, 74, 0, 74, 
-    1, 74, 2, 4, 3, 3, 75, 1, 0, 75, 
-    1, 0, 75, 1, 0, 21, 3, 4, 0, 0, 
-    0, 3, 0, 0, 45, 2, 0, 5, 17, 19, 
-    0, 0, 0, 52, 33, 1, 0, 34, 2, 1, 
-    7, 32, 0, 1, 79, 1, 0, 22, 0, 4, 
-    0, 0, 0, 33, 1, 0, 34, 3, 1, 8, 
-    10, 3, 0, 0, 17, 0, 0, 0, 0, 74, 
-    0, 74, 0, 10, 2, 1, 0, 75, 1, 0, 
-    39, 1, 0, 75, 0, 0, 45, 2, 1, 54, 
-    17, 0, 0, 0, 0, 33, 0, 4, 27, 1, 
-    0, 17, 34, 2, 1, 9, 30, 3, 1, 74, 
-    3, 10, 2, 1, 0, 75, 1, 0, 49, 1, 
-    0, 3, 79, 2, 1, 22, 1, 63, 0, 0, 
-    0, 33, 2, 5, 10, 2, 0, 0, 45, 3, 
-    0, 32, 2, 2, 13, 0, 2, 17, 0, 0, 
-    0, 0, 9, 1, 0, 51, 0, 0, 0, 0, 
-    0, 0, 0, 45, 4, 1, 17, 0, 0, 0, 
-    0, 32, 2, 4, 34, 3, 2, 12, 30, 4, 
-    2, 74, 0, 74, 4, 10, 3, 1, 0, 75, 
-    1, 0, 39, 2, 0, 75, 0, 0, 50, 3, 
-    0, 0, 0, 0, 0, 0, 0, 6, 7, 5, 
-    2, 45, 5, 6, 45, 6, 7, 45, 7, 5, 
-    32, 2, 6, 79, 3, 2, 22, 2, 3, 0, 
-    0, 0, 32, 3, 5, 45, 8, 3, 17, 19, 
-    0, 0, 0, 30, 2, 3, 34, 3, 2, 13, 
-    32, 4, 5, 32, 2, 7, 34, 5, 2, 14, 
-    74, 0, 10, 5, 0, 0, 39, 6, 0, 75, 
-    0, 0, 74, 0, 74, 4, 74, 6, 10, 3, 
-    2, 0, 75, 1, 0, 75, 1, 0, 39, 2, 
-    0, 75, 0, 0, 45, 8, 2, 17, 0, 0, 
-    0, 0, 32, 2, 3, 34, 3, 2, 15, 32, 
-    4, 8, 74, 0, 74, 4, 10, 3, 1, 0, 
-    75, 1, 0, 39, 2, 0, 75, 0, 0, 17, 
-    0, 0, 0, 0, 9, 1, 0, 0, 0, 0, 
-    0, 205, 255, 255, 255, 17, 0, 0, 0, 0, 
-    32, 0, 3, 32, 1, 0, 43, 1, 0, 10, 
-    17, 8, 0, 0, 0, 33, 1, 5, 32, 2, 
-    2, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
-    32, 3, 0, 43, 3, 0, 10, 17, 0, 0, 
-    0, 0, 33, 0, 4, 27, 1, 0, 17, 34, 
-    2, 1, 9, 33, 3, 6, 74, 3, 10, 2, 
-    1, 0, 75, 1, 0, 79, 1, 0, 19, 0, 
-    9, 0, 0, 0, 30, 1, 4, 36, 2, 1, 
-    0, 0, 0, 0, 32, 3, 2, 74, 3, 10, 
-    2, 1, 0, 75, 1, 0, 32, 1, 0, 43, 
-    1, 0, 11, 17, 0, 0, 0, 0, 30, 0, 
-    5, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
-    0, 0, 0, 0, 0, 2, 68, 0, 0, 0, 
-    0, 0, 0, 0, 70, 105, 108, 108, 32, 116, 
-    104, 101, 32, 99, 97, 99, 104, 101, 32, 111, 
-    102, 32, 112, 111, 116, 101, 110, 116, 105, 97, 
-    108, 32, 109, 111, 100, 117, 108, 101, 115, 32, 
-    97, 110, 100, 32, 112, 97, 99, 107, 97, 103, 
-    101, 115, 32, 102, 111, 114, 32, 116, 104, 105, 
-    115, 32, 100, 105, 114, 101, 99, 116, 111, 114, 
-    121, 46, 2, 3, 0, 0, 0, 0, 0, 0, 
-    0, 119, 105, 110, 2, 1, 0, 0, 0, 0, 
-    0, 0, 0, 46, 2, 5, 0, 0, 0, 0, 
-    0, 0, 0, 123, 125, 46, 123, 125, 2, 60, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 70, 105, 108, 
-    101, 70, 105, 110, 100, 101, 114, 46, 95, 102, 
-    105, 108, 108, 95, 99, 97, 99, 104, 101, 46, 
-    60, 115, 101, 116, 99, 111, 109, 112, 62, 46, 
-    49, 53, 57, 51, 58, 51, 57, 5, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    26, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
+    0, 0, 0, 0, 0, 0, 95, 102, 105, 108, 
+    108, 95, 99, 97, 99, 104, 101, 18, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 95, 111, 115, 17, 0, 0, 0, 
+    0, 0, 0, 0, 70, 105, 108, 101, 78, 111, 
+    116, 70, 111, 117, 110, 100, 69, 114, 114, 111, 
+    114, 15, 0, 0, 0, 0, 0, 0, 0, 80, 
+    101, 114, 109, 105, 115, 115, 105, 111, 110, 69, 
+    114, 114, 111, 114, 18, 0, 0, 0, 0, 0, 
+    0, 0, 78, 111, 116, 65, 68, 105, 114, 101, 
+    99, 116, 111, 114, 121, 69, 114, 114, 111, 114, 
+    3, 0, 0, 0, 0, 0, 0, 0, 115, 121, 
+    115, 3, 0, 0, 0, 0, 0, 0, 0, 115, 
+    101, 116, 27, 0, 0, 0, 0, 0, 0, 0, 
+    95, 67, 65, 83, 69, 95, 73, 78, 83, 69, 
+    78, 83, 73, 84, 73, 86, 69, 95, 80, 76, 
+    65, 84, 70, 79, 82, 77, 83, 7, 0, 0, 
+    0, 0, 0, 0, 0, 108, 105, 115, 116, 100, 
+    105, 114, 6, 0, 0, 0, 0, 0, 0, 0, 
+    103, 101, 116, 99, 119, 100, 10, 0, 0, 0, 
+    0, 0, 0, 0, 115, 116, 97, 114, 116, 115, 
+    119, 105, 116, 104, 11, 0, 0, 0, 0, 0, 
+    0, 0, 95, 112, 97, 116, 104, 95, 99, 97, 
+    99, 104, 101, 19, 0, 0, 0, 0, 0, 0, 
+    0, 95, 114, 101, 108, 97, 120, 101, 100, 95, 
+    112, 97, 116, 104, 95, 99, 97, 99, 104, 101, 
+    9, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+    114, 116, 105, 116, 105, 111, 110, 6, 0, 0, 
+    0, 0, 0, 0, 0, 102, 111, 114, 109, 97, 
+    116, 5, 0, 0, 0, 0, 0, 0, 0, 108, 
+    111, 119, 101, 114, 3, 0, 0, 0, 0, 0, 
+    0, 0, 97, 100, 100, 4, 0, 0, 0, 0, 
+    0, 0, 0, 112, 97, 116, 104, 8, 0, 0, 
+    0, 0, 0, 0, 0, 112, 108, 97, 116, 102, 
+    111, 114, 109, 0, 0, 0, 0, 0, 0, 0, 
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 8, 0, 0, 0, 0, 0, 0, 
+    0, 99, 111, 110, 116, 101, 110, 116, 115, 21, 
+    0, 0, 0, 0, 0, 0, 0, 108, 111, 119, 
+    101, 114, 95, 115, 117, 102, 102, 105, 120, 95, 
+    99, 111, 110, 116, 101, 110, 116, 115, 4, 0, 
+    0, 0, 0, 0, 0, 0, 105, 116, 101, 109, 
+    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+    109, 101, 3, 0, 0, 0, 0, 0, 0, 0, 
+    100, 111, 116, 6, 0, 0, 0, 0, 0, 0, 
+    0, 115, 117, 102, 102, 105, 120, 8, 0, 0, 
+    0, 0, 0, 0, 0, 110, 101, 119, 95, 110, 
+    97, 109, 101, 33, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
+    114, 110, 97, 108, 46, 95, 78, 97, 109, 101, 
+    115, 112, 97, 99, 101, 76, 111, 97, 100, 101, 
+    114, 46, 109, 111, 100, 117, 108, 101, 95, 114, 
+    101, 112, 114, 46, 49, 50, 55, 55, 58, 52, 
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 30, 1, 1, 34, 2, 1, 0, 1, 
+    32, 32, 3, 1, 27, 1, 3, 1, 38, 2, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 
-    0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 
-    0, 0, 0, 0, 0, 95, 102, 105, 108, 108, 
-    95, 99, 97, 99, 104, 101, 18, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 95, 111, 115, 17, 0, 0, 0, 0, 
-    0, 0, 0, 70, 105, 108, 101, 78, 111, 116, 
-    70, 111, 117, 110, 100, 69, 114, 114, 111, 114, 
-    15, 0, 0, 0, 0, 0, 0, 0, 80, 101, 
-    114, 109, 105, 115, 115, 105, 111, 110, 69, 114, 
-    114, 111, 114, 18, 0, 0, 0, 0, 0, 0, 
-    0, 78, 111, 116, 65, 68, 105, 114, 101, 99, 
-    116, 111, 114, 121, 69, 114, 114, 111, 114, 3, 
-    0, 0, 0, 0, 0, 0, 0, 115, 121, 115, 
-    3, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
-    116, 27, 0, 0, 0, 0, 0, 0, 0, 95, 
-    67, 65, 83, 69, 95, 73, 78, 83, 69, 78, 
-    83, 73, 84, 73, 86, 69, 95, 80, 76, 65, 
-    84, 70, 79, 82, 77, 83, 7, 0, 0, 0, 
-    0, 0, 0, 0, 108, 105, 115, 116, 100, 105, 
-    114, 6, 0, 0, 0, 0, 0, 0, 0, 103, 
-    101, 116, 99, 119, 100, 10, 0, 0, 0, 0, 
-    0, 0, 0, 115, 116, 97, 114, 116, 115, 119, 
-    105, 116, 104, 11, 0, 0, 0, 0, 0, 0, 
-    0, 95, 112, 97, 116, 104, 95, 99, 97, 99, 
-    104, 101, 19, 0, 0, 0, 0, 0, 0, 0, 
-    95, 114, 101, 108, 97, 120, 101, 100, 95, 112, 
-    97, 116, 104, 95, 99, 97, 99, 104, 101, 9, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 
-    116, 105, 116, 105, 111, 110, 6, 0, 0, 0, 
-    0, 0, 0, 0, 102, 111, 114, 109, 97, 116, 
-    5, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
-    119, 101, 114, 3, 0, 0, 0, 0, 0, 0, 
-    0, 97, 100, 100, 4, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 116, 104, 8, 0, 0, 0, 
-    0, 0, 0, 0, 112, 108, 97, 116, 102, 111, 
-    114, 109, 0, 0, 0, 0, 0, 0, 0, 0, 
-    9, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 115, 101, 108, 102, 
-    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 8, 0, 0, 0, 0, 0, 0, 0, 
-    99, 111, 110, 116, 101, 110, 116, 115, 21, 0, 
-    0, 0, 0, 0, 0, 0, 108, 111, 119, 101, 
-    114, 95, 115, 117, 102, 102, 105, 120, 95, 99, 
-    111, 110, 116, 101, 110, 116, 115, 4, 0, 0, 
-    0, 0, 0, 0, 0, 105, 116, 101, 109, 4, 
-    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
-    101, 3, 0, 0, 0, 0, 0, 0, 0, 100, 
-    111, 116, 6, 0, 0, 0, 0, 0, 0, 0, 
-    115, 117, 102, 102, 105, 120, 8, 0, 0, 0, 
-    0, 0, 0, 0, 110, 101, 119, 95, 110, 97, 
-    109, 101, 32, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 95, 78, 97, 109, 101, 115, 
-    112, 97, 99, 101, 76, 111, 97, 100, 101, 114, 
-    46, 109, 111, 100, 117, 108, 101, 95, 114, 101, 
-    112, 114, 46, 49, 50, 55, 55, 58, 52, 0, 
-    9, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
-    0, 30, 1, 1, 34, 2, 1, 0, 32, 3, 
-    1, 27, 1, 3, 1, 74, 1, 10, 2, 1, 
-    0, 75, 1, 0, 41, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     2, 0, 0, 0, 0, 0, 0, 0, 2, 115, 
@@ -8242,7 +8803,7 @@ std::vector<uint8_t> _bootstrap_external
     2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
     0, 0, 0, 0, 0, 0, 99, 108, 115, 6, 
     0, 0, 0, 0, 0, 0, 0, 109, 111, 100, 
-    117, 108, 101, 32, 0, 0, 0, 0, 0, 0, 
+    117, 108, 101, 33, 0, 0, 0, 0, 0, 0, 
     0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 
     0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
@@ -8250,381 +8811,406 @@ std::vector<uint8_t> _bootstrap_external
     114, 110, 97, 108, 46, 70, 105, 108, 101, 70, 
     105, 110, 100, 101, 114, 46, 95, 95, 114, 101, 
     112, 114, 95, 95, 46, 49, 54, 49, 51, 58, 
-    52, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 34, 1, 0, 0, 32, 2, 0, 
-    27, 3, 2, 1, 74, 3, 10, 1, 1, 0, 
-    75, 1, 19, 41, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 2, 16, 0, 
-    0, 0, 0, 0, 0, 0, 70, 105, 108, 101, 
-    70, 105, 110, 100, 101, 114, 40, 123, 33, 114, 
-    125, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    52, 0, 6, 0, 0, 0, 0, 0, 0, 0, 
+    30, 0, 0, 34, 1, 0, 0, 1, 32, 32, 
+    2, 0, 27, 3, 2, 1, 38, 1, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
-    0, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
-    95, 114, 101, 112, 114, 95, 95, 2, 0, 0, 
-    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
-    0, 0, 0, 102, 111, 114, 109, 97, 116, 4, 
-    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
-    104, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
-    0, 0, 0, 0, 0, 115, 101, 108, 102, 32, 
-    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
-    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 
-    0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 70, 105, 108, 101, 70, 105, 110, 100, 101, 
-    114, 46, 95, 103, 101, 116, 95, 115, 112, 101, 
-    99, 46, 49, 53, 48, 56, 58, 52, 0, 16, 
-    0, 0, 0, 0, 0, 0, 0, 32, 1, 1, 
-    32, 2, 2, 32, 3, 3, 74, 2, 74, 3, 
-    10, 1, 2, 0, 75, 1, 0, 75, 1, 0, 
-    45, 6, 0, 33, 1, 0, 32, 2, 2, 32, 
-    3, 3, 32, 4, 6, 32, 5, 4, 12, 1, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 3, 
-    2, 0, 0, 0, 0, 0, 0, 0, 4, 5, 
-    2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 2, 16, 0, 0, 
+    0, 0, 0, 0, 0, 70, 105, 108, 101, 70, 
+    105, 110, 100, 101, 114, 40, 123, 33, 114, 125, 
     41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    114, 101, 112, 114, 95, 95, 2, 0, 0, 0, 
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
+    0, 0, 102, 111, 114, 109, 97, 116, 4, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 115, 101, 108, 102, 32, 0, 
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
+    0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    70, 105, 108, 101, 70, 105, 110, 100, 101, 114, 
+    46, 95, 103, 101, 116, 95, 115, 112, 101, 99, 
+    46, 49, 53, 48, 56, 58, 52, 0, 16, 0, 
+    0, 0, 0, 0, 0, 0, 32, 1, 1, 32, 
+    2, 2, 32, 3, 3, 74, 2, 74, 3, 10, 
+    1, 2, 0, 75, 1, 0, 75, 1, 0, 45, 
+    6, 0, 33, 1, 0, 32, 2, 2, 32, 3, 
+    3, 32, 4, 6, 32, 5, 4, 12, 1, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 3, 2, 
+    0, 0, 0, 0, 0, 0, 0, 4, 5, 2, 
+    0, 0, 0, 0, 0, 0, 0, 1, 2, 41, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 
-    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
-    0, 95, 103, 101, 116, 95, 115, 112, 101, 99, 
-    3, 0, 0, 0, 0, 0, 0, 0, 23, 0, 
-    0, 0, 0, 0, 0, 0, 115, 112, 101, 99, 
-    95, 102, 114, 111, 109, 95, 102, 105, 108, 101, 
-    95, 108, 111, 99, 97, 116, 105, 111, 110, 6, 
-    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
-    100, 101, 114, 26, 0, 0, 0, 0, 0, 0, 
-    0, 115, 117, 98, 109, 111, 100, 117, 108, 101, 
-    95, 115, 101, 97, 114, 99, 104, 95, 108, 111, 
-    99, 97, 116, 105, 111, 110, 115, 0, 0, 0, 
-    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 101, 108, 102, 12, 0, 0, 0, 0, 
-    0, 0, 0, 108, 111, 97, 100, 101, 114, 95, 
-    99, 108, 97, 115, 115, 8, 0, 0, 0, 0, 
-    0, 0, 0, 102, 117, 108, 108, 110, 97, 109, 
-    101, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
-    97, 116, 104, 4, 0, 0, 0, 0, 0, 0, 
-    0, 115, 109, 115, 108, 6, 0, 0, 0, 0, 
-    0, 0, 0, 116, 97, 114, 103, 101, 116, 6, 
-    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
-    100, 101, 114, 32, 0, 0, 0, 0, 0, 0, 
-    0, 5, 0, 0, 0, 0, 0, 0, 0, 14, 
-    0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 70, 105, 108, 101, 70, 
-    105, 110, 100, 101, 114, 46, 95, 95, 105, 110, 
-    105, 116, 95, 95, 46, 49, 52, 55, 52, 58, 
-    52, 0, 85, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 3, 1, 0, 45, 3, 1, 32, 
-    2, 2, 13, 0, 2, 17, 0, 0, 0, 0, 
-    9, 1, 0, 27, 0, 0, 0, 0, 0, 0, 
-    0, 50, 2, 0, 0, 0, 0, 0, 0, 0, 
-    2, 3, 1, 44, 0, 2, 45, 4, 3, 17, 
-    0, 0, 0, 0, 32, 2, 3, 34, 3, 2, 
-    4, 30, 4, 1, 29, 2, 0, 74, 2, 4, 
-    5, 1, 75, 1, 74, 36, 6, 4, 0, 0, 
-    1, 5, 32, 2, 4, 74, 0, 74, 2, 10, 
-    6, 1, 0, 75, 1, 0, 39, 4, 0, 75, 
-    0, 0, 74, 0, 74, 4, 10, 3, 1, 0, 
-    75, 1, 204, 39, 5, 0, 75, 0, 0, 17, 
-    0, 0, 0, 0, 9, 1, 0, 0, 0, 0, 
-    0, 229, 255, 255, 255, 17, 0, 0, 0, 0, 
-    32, 0, 3, 32, 1, 0, 43, 1, 0, 5, 
-    32, 2, 1, 79, 0, 2, 22, 2, 2, 0, 
-    0, 0, 30, 2, 2, 17, 0, 0, 0, 0, 
-    32, 0, 0, 43, 0, 2, 6, 33, 1, 0, 
-    32, 2, 0, 27, 3, 2, 6, 74, 3, 10, 
-    1, 1, 0, 75, 1, 232, 49, 2, 0, 3, 
-    79, 1, 2, 19, 2, 17, 0, 0, 0, 33, 
-    1, 1, 33, 2, 2, 34, 3, 2, 7, 10, 
-    3, 0, 0, 32, 2, 0, 27, 3, 2, 6, 
-    74, 0, 74, 0, 74, 3, 10, 1, 2, 0, 
-    75, 1, 197, 75, 1, 192, 39, 4, 0, 75, 
-    0, 0, 32, 2, 0, 43, 2, 4, 6, 17, 
-    0, 0, 0, 0, 30, 0, 3, 49, 1, 0, 
-    1, 32, 2, 0, 43, 2, 1, 8, 33, 3, 
-    3, 10, 3, 0, 0, 32, 1, 0, 43, 1, 
-    0, 9, 33, 2, 3, 10, 2, 0, 0, 32, 
-    1, 0, 43, 1, 0, 10, 30, 2, 4, 41, 
-    2, 1, 0, 0, 0, 0, 0, 0, 0, 3, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
-    0, 108, 111, 97, 100, 101, 114, 5, 0, 0, 
-    0, 0, 0, 0, 0, 2, 154, 0, 0, 0, 
-    0, 0, 0, 0, 73, 110, 105, 116, 105, 97, 
-    108, 105, 122, 101, 32, 119, 105, 116, 104, 32, 
-    116, 104, 101, 32, 112, 97, 116, 104, 32, 116, 
-    111, 32, 115, 101, 97, 114, 99, 104, 32, 111, 
-    110, 32, 97, 110, 100, 32, 97, 32, 118, 97, 
-    114, 105, 97, 98, 108, 101, 32, 110, 117, 109, 
-    98, 101, 114, 32, 111, 102, 10, 32, 32, 32, 
-    32, 32, 32, 32, 32, 50, 45, 116, 117, 112, 
-    108, 101, 115, 32, 99, 111, 110, 116, 97, 105, 
-    110, 105, 110, 103, 32, 116, 104, 101, 32, 108, 
-    111, 97, 100, 101, 114, 32, 97, 110, 100, 32, 
-    116, 104, 101, 32, 102, 105, 108, 101, 32, 115, 
-    117, 102, 102, 105, 120, 101, 115, 32, 116, 104, 
-    101, 32, 108, 111, 97, 100, 101, 114, 10, 32, 
-    32, 32, 32, 32, 32, 32, 32, 114, 101, 99, 
-    111, 103, 110, 105, 122, 101, 115, 46, 2, 57, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 70, 105, 108, 
-    101, 70, 105, 110, 100, 101, 114, 46, 95, 95, 
-    105, 110, 105, 116, 95, 95, 46, 60, 103, 101, 
-    110, 101, 120, 112, 114, 62, 46, 49, 52, 56, 
-    48, 58, 50, 54, 2, 1, 0, 0, 0, 0, 
-    0, 0, 0, 46, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 
-    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 105, 110, 105, 116, 95, 95, 11, 
-    0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 
-    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
-    95, 105, 115, 97, 98, 115, 10, 0, 0, 0, 
-    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    106, 111, 105, 110, 3, 0, 0, 0, 0, 0, 
-    0, 0, 95, 111, 115, 3, 0, 0, 0, 0, 
-    0, 0, 0, 115, 101, 116, 6, 0, 0, 0, 
-    0, 0, 0, 0, 101, 120, 116, 101, 110, 100, 
-    8, 0, 0, 0, 0, 0, 0, 0, 95, 108, 
-    111, 97, 100, 101, 114, 115, 4, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 6, 0, 
-    0, 0, 0, 0, 0, 0, 103, 101, 116, 99, 
-    119, 100, 11, 0, 0, 0, 0, 0, 0, 0, 
-    95, 112, 97, 116, 104, 95, 109, 116, 105, 109, 
-    101, 11, 0, 0, 0, 0, 0, 0, 0, 95, 
-    112, 97, 116, 104, 95, 99, 97, 99, 104, 101, 
-    19, 0, 0, 0, 0, 0, 0, 0, 95, 114, 
-    101, 108, 97, 120, 101, 100, 95, 112, 97, 116, 
-    104, 95, 99, 97, 99, 104, 101, 0, 0, 0, 
-    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
+    9, 0, 0, 0, 0, 0, 0, 0, 95, 103, 
+    101, 116, 95, 115, 112, 101, 99, 3, 0, 0, 
+    0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 
+    0, 0, 0, 115, 112, 101, 99, 95, 102, 114, 
+    111, 109, 95, 102, 105, 108, 101, 95, 108, 111, 
+    99, 97, 116, 105, 111, 110, 6, 0, 0, 0, 
+    0, 0, 0, 0, 108, 111, 97, 100, 101, 114, 
+    26, 0, 0, 0, 0, 0, 0, 0, 115, 117, 
+    98, 109, 111, 100, 117, 108, 101, 95, 115, 101, 
+    97, 114, 99, 104, 95, 108, 111, 99, 97, 116, 
+    105, 111, 110, 115, 0, 0, 0, 0, 0, 0, 
+    0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 12, 0, 0, 0, 0, 0, 0, 0, 
+    108, 111, 97, 100, 101, 114, 95, 99, 108, 97, 
+    115, 115, 8, 0, 0, 0, 0, 0, 0, 0, 
+    102, 117, 108, 108, 110, 97, 109, 101, 4, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 109, 
+    115, 108, 6, 0, 0, 0, 0, 0, 0, 0, 
+    116, 97, 114, 103, 101, 116, 6, 0, 0, 0, 
+    0, 0, 0, 0, 108, 111, 97, 100, 101, 114, 
+    33, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 
+    0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 70, 105, 108, 101, 70, 105, 110, 100, 
+    101, 114, 46, 95, 95, 105, 110, 105, 116, 95, 
+    95, 46, 49, 52, 55, 52, 58, 52, 0, 83, 
+    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
+    3, 1, 0, 45, 3, 1, 32, 2, 2, 13, 
+    0, 2, 17, 0, 0, 0, 0, 9, 1, 0, 
+    25, 0, 0, 0, 0, 0, 0, 0, 50, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 3, 1, 
+    44, 0, 2, 45, 4, 3, 17, 0, 0, 0, 
+    0, 32, 2, 3, 34, 3, 2, 4, 1, 32, 
+    30, 4, 1, 29, 2, 0, 74, 2, 4, 5, 
+    1, 75, 1, 74, 36, 6, 4, 0, 0, 1, 
+    5, 32, 2, 4, 74, 0, 74, 2, 10, 6, 
+    1, 0, 75, 1, 0, 39, 4, 0, 75, 0, 
+    0, 74, 0, 38, 3, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 39, 5, 0, 75, 0, 0, 17, 0, 0, 
+    0, 0, 9, 1, 0, 0, 0, 0, 0, 231, 
+    255, 255, 255, 17, 0, 0, 0, 0, 32, 0, 
+    3, 32, 1, 0, 43, 1, 0, 5, 32, 2, 
+    1, 79, 0, 2, 22, 2, 2, 0, 0, 0, 
+    30, 2, 2, 17, 0, 0, 0, 0, 32, 0, 
+    0, 43, 0, 2, 6, 33, 1, 0, 32, 2, 
+    0, 27, 3, 2, 6, 74, 3, 10, 1, 1, 
+    0, 75, 1, 232, 49, 2, 0, 3, 79, 1, 
+    2, 19, 2, 17, 0, 0, 0, 33, 1, 1, 
+    33, 2, 2, 34, 3, 2, 7, 1, 32, 38, 
+    3, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 32, 2, 0, 27, 
+    3, 2, 6, 74, 0, 74, 0, 74, 3, 10, 
+    1, 2, 0, 75, 1, 197, 75, 1, 192, 39, 
+    4, 0, 75, 0, 0, 32, 2, 0, 43, 2, 
+    4, 6, 17, 0, 0, 0, 0, 30, 0, 3, 
+    49, 1, 0, 1, 32, 2, 0, 43, 2, 1, 
+    8, 33, 3, 3, 10, 3, 0, 0, 32, 1, 
+    0, 43, 1, 0, 9, 33, 2, 3, 10, 2, 
+    0, 0, 32, 1, 0, 43, 1, 0, 10, 30, 
+    2, 4, 41, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
+    0, 0, 108, 111, 97, 100, 101, 114, 5, 0, 
+    0, 0, 0, 0, 0, 0, 2, 154, 0, 0, 
+    0, 0, 0, 0, 0, 73, 110, 105, 116, 105, 
+    97, 108, 105, 122, 101, 32, 119, 105, 116, 104, 
+    32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 
+    116, 111, 32, 115, 101, 97, 114, 99, 104, 32, 
+    111, 110, 32, 97, 110, 100, 32, 97, 32, 118, 
+    97, 114, 105, 97, 98, 108, 101, 32, 110, 117, 
+    109, 98, 101, 114, 32, 111, 102, 10, 32, 32, 
+    32, 32, 32, 32, 32, 32, 50, 45, 116, 117, 
+    112, 108, 101, 115, 32, 99, 111, 110, 116, 97, 
+    105, 110, 105, 110, 103, 32, 116, 104, 101, 32, 
+    108, 111, 97, 100, 101, 114, 32, 97, 110, 100, 
+    32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 
+    115, 117, 102, 102, 105, 120, 101, 115, 32, 116, 
+    104, 101, 32, 108, 111, 97, 100, 101, 114, 10, 
+    32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 
+    99, 111, 103, 110, 105, 122, 101, 115, 46, 2, 
+    57, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
+    108, 101, 70, 105, 110, 100, 101, 114, 46, 95, 
+    95, 105, 110, 105, 116, 95, 95, 46, 60, 103, 
+    101, 110, 101, 120, 112, 114, 62, 46, 49, 52, 
+    56, 48, 58, 50, 54, 2, 1, 0, 0, 0, 
+    0, 0, 0, 0, 46, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 
+    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
+    0, 0, 95, 95, 105, 110, 105, 116, 95, 95, 
+    11, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
+    0, 0, 0, 0, 0, 0, 95, 112, 97, 116, 
+    104, 95, 105, 115, 97, 98, 115, 10, 0, 0, 
+    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
+    95, 106, 111, 105, 110, 3, 0, 0, 0, 0, 
+    0, 0, 0, 95, 111, 115, 3, 0, 0, 0, 
+    0, 0, 0, 0, 115, 101, 116, 6, 0, 0, 
+    0, 0, 0, 0, 0, 101, 120, 116, 101, 110, 
+    100, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
+    108, 111, 97, 100, 101, 114, 115, 4, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 6, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    99, 119, 100, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 109, 116, 105, 
+    109, 101, 11, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 95, 99, 97, 99, 104, 
+    101, 19, 0, 0, 0, 0, 0, 0, 0, 95, 
+    114, 101, 108, 97, 120, 101, 100, 95, 112, 97, 
+    116, 104, 95, 99, 97, 99, 104, 101, 0, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 115, 101, 108, 102, 4, 0, 0, 0, 
+    0, 0, 0, 0, 112, 97, 116, 104, 14, 0, 
+    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
+    101, 114, 95, 100, 101, 116, 97, 105, 108, 115, 
+    7, 0, 0, 0, 0, 0, 0, 0, 108, 111, 
+    97, 100, 101, 114, 115, 8, 0, 0, 0, 0, 
+    0, 0, 0, 115, 117, 102, 102, 105, 120, 101, 
+    115, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 57, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 95, 78, 97, 109, 101, 115, 112, 
+    97, 99, 101, 76, 111, 97, 100, 101, 114, 46, 
+    99, 114, 101, 97, 116, 101, 95, 109, 111, 100, 
+    117, 108, 101, 46, 49, 50, 57, 53, 58, 52, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 30, 1, 1, 41, 1, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 42, 0, 
+    0, 0, 0, 0, 0, 0, 85, 115, 101, 32, 
+    100, 101, 102, 97, 117, 108, 116, 32, 115, 101, 
+    109, 97, 110, 116, 105, 99, 115, 32, 102, 111, 
+    114, 32, 109, 111, 100, 117, 108, 101, 32, 99, 
+    114, 101, 97, 116, 105, 111, 110, 46, 5, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 13, 0, 
+    0, 0, 0, 0, 0, 0, 99, 114, 101, 97, 
+    116, 101, 95, 109, 111, 100, 117, 108, 101, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
     0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
     0, 115, 101, 108, 102, 4, 0, 0, 0, 0, 
-    0, 0, 0, 112, 97, 116, 104, 14, 0, 0, 
-    0, 0, 0, 0, 0, 108, 111, 97, 100, 101, 
-    114, 95, 100, 101, 116, 97, 105, 108, 115, 7, 
-    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
-    100, 101, 114, 115, 8, 0, 0, 0, 0, 0, 
-    0, 0, 115, 117, 102, 102, 105, 120, 101, 115, 
-    32, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
-    108, 46, 95, 78, 97, 109, 101, 115, 112, 97, 
-    99, 101, 76, 111, 97, 100, 101, 114, 46, 99, 
-    114, 101, 97, 116, 101, 95, 109, 111, 100, 117, 
-    108, 101, 46, 49, 50, 57, 53, 58, 52, 0, 
-    3, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
-    0, 30, 1, 1, 41, 1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 42, 
-    0, 0, 0, 0, 0, 0, 0, 85, 115, 101, 
-    32, 100, 101, 102, 97, 117, 108, 116, 32, 115, 
-    101, 109, 97, 110, 116, 105, 99, 115, 32, 102, 
-    111, 114, 32, 109, 111, 100, 117, 108, 101, 32, 
-    99, 114, 101, 97, 116, 105, 111, 110, 46, 5, 
+    0, 0, 0, 115, 112, 101, 99, 33, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
+    0, 55, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 80, 
+    97, 116, 104, 70, 105, 110, 100, 101, 114, 46, 
+    105, 110, 118, 97, 108, 105, 100, 97, 116, 101, 
+    95, 99, 97, 99, 104, 101, 115, 46, 49, 51, 
+    49, 57, 58, 52, 0, 60, 0, 0, 0, 0, 
+    0, 0, 0, 30, 0, 0, 33, 1, 0, 33, 
+    0, 1, 27, 2, 0, 7, 34, 3, 2, 4, 
+    1, 32, 38, 3, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 
+    0, 74, 0, 10, 1, 1, 0, 75, 1, 0, 
+    39, 2, 0, 75, 0, 0, 13, 3, 2, 17, 
+    0, 0, 0, 0, 9, 0, 3, 37, 0, 0, 
+    0, 0, 0, 0, 0, 50, 2, 0, 0, 0, 
+    0, 0, 0, 0, 1, 2, 0, 45, 2, 1, 
+    45, 1, 2, 17, 0, 0, 0, 0, 32, 1, 
+    1, 30, 2, 1, 6, 4, 1, 2, 6, 79, 
+    5, 4, 22, 4, 21, 0, 0, 0, 33, 1, 
+    2, 32, 2, 1, 30, 4, 2, 74, 0, 74, 
+    2, 74, 4, 10, 1, 2, 0, 75, 1, 216, 
+    75, 1, 32, 39, 5, 0, 75, 0, 0, 79, 
+    6, 5, 19, 5, 7, 0, 0, 0, 32, 1, 
+    1, 34, 2, 1, 5, 1, 32, 74, 0, 38, 
+    2, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 39, 4, 0, 75, 
+    0, 0, 17, 0, 0, 0, 0, 17, 5, 0, 
+    0, 0, 33, 1, 1, 27, 2, 1, 7, 32, 
+    4, 2, 55, 2, 4, 17, 0, 0, 0, 0, 
+    17, 0, 0, 0, 0, 9, 0, 3, 0, 0, 
+    0, 0, 219, 255, 255, 255, 17, 0, 0, 0, 
+    0, 33, 0, 3, 27, 1, 0, 6, 30, 2, 
+    3, 63, 1, 2, 0, 43, 0, 1, 6, 30, 
+    2, 1, 41, 2, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 2, 125, 0, 0, 0, 0, 
+    0, 0, 0, 67, 97, 108, 108, 32, 116, 104, 
+    101, 32, 105, 110, 118, 97, 108, 105, 100, 97, 
+    116, 101, 95, 99, 97, 99, 104, 101, 115, 40, 
+    41, 32, 109, 101, 116, 104, 111, 100, 32, 111, 
+    110, 32, 97, 108, 108, 32, 112, 97, 116, 104, 
+    32, 101, 110, 116, 114, 121, 32, 102, 105, 110, 
+    100, 101, 114, 115, 10, 32, 32, 32, 32, 32, 
+    32, 32, 32, 115, 116, 111, 114, 101, 100, 32, 
+    105, 110, 32, 115, 121, 115, 46, 112, 97, 116, 
+    104, 95, 105, 109, 112, 111, 114, 116, 101, 114, 
+    95, 99, 97, 99, 104, 101, 115, 32, 40, 119, 
+    104, 101, 114, 101, 32, 105, 109, 112, 108, 101, 
+    109, 101, 110, 116, 101, 100, 41, 46, 5, 2, 
+    17, 0, 0, 0, 0, 0, 0, 0, 105, 110, 
+    118, 97, 108, 105, 100, 97, 116, 101, 95, 99, 
+    97, 99, 104, 101, 115, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 13, 
-    0, 0, 0, 0, 0, 0, 0, 99, 114, 101, 
-    97, 116, 101, 95, 109, 111, 100, 117, 108, 101, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 108, 102, 4, 0, 0, 0, 
-    0, 0, 0, 0, 115, 112, 101, 99, 32, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    80, 97, 116, 104, 70, 105, 110, 100, 101, 114, 
-    46, 105, 110, 118, 97, 108, 105, 100, 97, 116, 
-    101, 95, 99, 97, 99, 104, 101, 115, 46, 49, 
-    51, 49, 57, 58, 52, 0, 60, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 33, 1, 0, 
-    33, 0, 1, 27, 2, 0, 7, 34, 3, 2, 
-    4, 10, 3, 0, 0, 74, 0, 74, 0, 10, 
-    1, 1, 0, 75, 1, 0, 39, 2, 0, 75, 
-    0, 0, 13, 3, 2, 17, 0, 0, 0, 0, 
-    9, 0, 3, 37, 0, 0, 0, 0, 0, 0, 
-    0, 50, 2, 0, 0, 0, 0, 0, 0, 0, 
-    1, 2, 0, 45, 2, 1, 45, 1, 2, 17, 
-    0, 0, 0, 0, 32, 1, 1, 30, 2, 1, 
-    6, 4, 1, 2, 6, 79, 5, 4, 22, 4, 
-    21, 0, 0, 0, 33, 1, 2, 32, 2, 1, 
-    30, 4, 2, 74, 0, 74, 2, 74, 4, 10, 
-    1, 2, 0, 75, 1, 216, 75, 1, 32, 39, 
-    5, 0, 75, 0, 0, 79, 6, 5, 19, 5, 
-    7, 0, 0, 0, 32, 1, 1, 34, 2, 1, 
-    5, 74, 0, 10, 2, 0, 0, 39, 4, 0, 
-    75, 0, 0, 17, 0, 0, 0, 0, 17, 5, 
-    0, 0, 0, 33, 1, 1, 27, 2, 1, 7, 
-    32, 4, 2, 55, 2, 4, 17, 0, 0, 0, 
-    0, 17, 0, 0, 0, 0, 9, 0, 3, 0, 
-    0, 0, 0, 219, 255, 255, 255, 17, 0, 0, 
-    0, 0, 33, 0, 3, 27, 1, 0, 6, 30, 
-    2, 3, 63, 1, 2, 0, 43, 0, 1, 6, 
-    30, 2, 1, 41, 2, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 2, 125, 0, 
-    0, 0, 0, 0, 0, 0, 67, 97, 108, 108, 
-    32, 116, 104, 101, 32, 105, 110, 118, 97, 108, 
-    105, 100, 97, 116, 101, 95, 99, 97, 99, 104, 
-    101, 115, 40, 41, 32, 109, 101, 116, 104, 111, 
-    100, 32, 111, 110, 32, 97, 108, 108, 32, 112, 
-    97, 116, 104, 32, 101, 110, 116, 114, 121, 32, 
-    102, 105, 110, 100, 101, 114, 115, 10, 32, 32, 
-    32, 32, 32, 32, 32, 32, 115, 116, 111, 114, 
-    101, 100, 32, 105, 110, 32, 115, 121, 115, 46, 
-    112, 97, 116, 104, 95, 105, 109, 112, 111, 114, 
-    116, 101, 114, 95, 99, 97, 99, 104, 101, 115, 
-    32, 40, 119, 104, 101, 114, 101, 32, 105, 109, 
-    112, 108, 101, 109, 101, 110, 116, 101, 100, 41, 
-    46, 5, 2, 17, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 
+    0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 
     0, 105, 110, 118, 97, 108, 105, 100, 97, 116, 
-    101, 95, 99, 97, 99, 104, 101, 115, 0, 1, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    101, 95, 99, 97, 99, 104, 101, 115, 8, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 108, 105, 115, 116, 3, 0, 
+    0, 0, 0, 0, 0, 0, 115, 121, 115, 7, 
+    0, 0, 0, 0, 0, 0, 0, 104, 97, 115, 
+    97, 116, 116, 114, 14, 0, 0, 0, 0, 0, 
+    0, 0, 95, 78, 97, 109, 101, 115, 112, 97, 
+    99, 101, 80, 97, 116, 104, 5, 0, 0, 0, 
+    0, 0, 0, 0, 105, 116, 101, 109, 115, 17, 
+    0, 0, 0, 0, 0, 0, 0, 105, 110, 118, 
+    97, 108, 105, 100, 97, 116, 101, 95, 99, 97, 
+    99, 104, 101, 115, 6, 0, 0, 0, 0, 0, 
+    0, 0, 95, 101, 112, 111, 99, 104, 19, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
+    95, 105, 109, 112, 111, 114, 116, 101, 114, 95, 
+    99, 97, 99, 104, 101, 0, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
+    108, 115, 6, 0, 0, 0, 0, 0, 0, 0, 
+    102, 105, 110, 100, 101, 114, 4, 0, 0, 0, 
+    0, 0, 0, 0, 110, 97, 109, 101, 32, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    95, 109, 97, 107, 101, 95, 114, 101, 108, 97, 
+    120, 95, 99, 97, 115, 101, 46, 95, 114, 101, 
+    108, 97, 120, 95, 99, 97, 115, 101, 46, 54, 
+    55, 58, 56, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 30, 0, 0, 30, 1, 1, 41, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
-    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
-    0, 0, 0, 0, 105, 110, 118, 97, 108, 105, 
-    100, 97, 116, 101, 95, 99, 97, 99, 104, 101, 
-    115, 8, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 108, 105, 115, 
-    116, 3, 0, 0, 0, 0, 0, 0, 0, 115, 
-    121, 115, 7, 0, 0, 0, 0, 0, 0, 0, 
-    104, 97, 115, 97, 116, 116, 114, 14, 0, 0, 
-    0, 0, 0, 0, 0, 95, 78, 97, 109, 101, 
-    115, 112, 97, 99, 101, 80, 97, 116, 104, 5, 
-    0, 0, 0, 0, 0, 0, 0, 105, 116, 101, 
-    109, 115, 17, 0, 0, 0, 0, 0, 0, 0, 
-    105, 110, 118, 97, 108, 105, 100, 97, 116, 101, 
-    95, 99, 97, 99, 104, 101, 115, 6, 0, 0, 
-    0, 0, 0, 0, 0, 95, 101, 112, 111, 99, 
-    104, 19, 0, 0, 0, 0, 0, 0, 0, 112, 
-    97, 116, 104, 95, 105, 109, 112, 111, 114, 116, 
-    101, 114, 95, 99, 97, 99, 104, 101, 0, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 99, 108, 115, 6, 0, 0, 0, 0, 
-    0, 0, 0, 102, 105, 110, 100, 101, 114, 4, 
-    0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
-    101, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 95, 109, 97, 107, 101, 95, 114, 
-    101, 108, 97, 120, 95, 99, 97, 115, 101, 46, 
-    95, 114, 101, 108, 97, 120, 95, 99, 97, 115, 
-    101, 46, 54, 55, 58, 56, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 30, 1, 
-    1, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 2, 53, 0, 0, 0, 
-    0, 0, 0, 0, 84, 114, 117, 101, 32, 105, 
-    102, 32, 102, 105, 108, 101, 110, 97, 109, 101, 
-    115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 
-    99, 104, 101, 99, 107, 101, 100, 32, 99, 97, 
-    115, 101, 45, 105, 110, 115, 101, 110, 115, 105, 
-    116, 105, 118, 101, 108, 121, 46, 6, 0, 0, 
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
+    2, 53, 0, 0, 0, 0, 0, 0, 0, 84, 
+    114, 117, 101, 32, 105, 102, 32, 102, 105, 108, 
+    101, 110, 97, 109, 101, 115, 32, 109, 117, 115, 
+    116, 32, 98, 101, 32, 99, 104, 101, 99, 107, 
+    101, 100, 32, 99, 97, 115, 101, 45, 105, 110, 
+    115, 101, 110, 115, 105, 116, 105, 118, 101, 108, 
+    121, 46, 6, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
-    0, 0, 0, 0, 0, 0, 95, 114, 101, 108, 
-    97, 120, 95, 99, 97, 115, 101, 0, 0, 0, 
+    0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 114, 101, 108, 97, 120, 95, 99, 97, 
+    115, 101, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 
+    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 
+    0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 
+    47, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
+    108, 101, 70, 105, 110, 100, 101, 114, 46, 102, 
+    105, 110, 100, 95, 115, 112, 101, 99, 46, 49, 
+    53, 49, 51, 58, 52, 0, 236, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 30, 1, 1, 
+    45, 3, 1, 32, 2, 1, 34, 1, 2, 9, 
+    1, 32, 30, 3, 2, 38, 1, 32, 1, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 32, 0, 0, 0, 0, 0, 0, 0, 14, 
-    0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 
-    0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 70, 105, 108, 101, 70, 105, 110, 
-    100, 101, 114, 46, 102, 105, 110, 100, 95, 115, 
-    112, 101, 99, 46, 49, 53, 49, 51, 58, 52, 
-    0, 14, 1, 0, 0, 0, 0, 0, 0, 30, 
-    0, 0, 30, 1, 1, 45, 3, 1, 32, 2, 
-    1, 34, 1, 2, 9, 30, 3, 2, 74, 3, 
-    10, 1, 1, 0, 75, 1, 54, 30, 2, 3, 
-    1, 1, 0, 2, 45, 4, 1, 42, 1, 0, 
-    0, 0, 17, 8, 0, 0, 0, 33, 0, 2, 
-    21, 0, 5, 0, 0, 0, 30, 1, 4, 49, 
-    0, 1, 1, 45, 5, 0, 5, 17, 20, 0, 
-    0, 0, 52, 33, 1, 0, 32, 2, 0, 27, 
-    0, 2, 18, 79, 3, 0, 22, 0, 4, 0, 
-    0, 0, 33, 2, 1, 34, 3, 2, 10, 10, 
-    3, 0, 0, 17, 0, 0, 0, 0, 74, 0, 
-    74, 0, 10, 1, 1, 0, 75, 1, 0, 39, 
-    2, 0, 75, 0, 0, 27, 3, 2, 19, 45, 
-    5, 3, 54, 17, 0, 0, 0, 0, 32, 0, 
-    5, 32, 1, 0, 27, 2, 1, 12, 6, 3, 
-    0, 2, 1, 79, 1, 3, 19, 3, 7, 0, 
-    0, 0, 32, 1, 0, 34, 2, 1, 11, 10, 
-    2, 0, 0, 32, 1, 5, 32, 0, 0, 43, 
+    0, 0, 0, 30, 2, 3, 1, 1, 0, 2, 
+    45, 4, 1, 17, 8, 0, 0, 0, 33, 0, 
+    2, 21, 0, 5, 0, 0, 0, 30, 1, 4, 
+    49, 0, 1, 1, 45, 5, 0, 5, 17, 19, 
+    0, 0, 0, 52, 33, 1, 0, 32, 2, 0, 
+    27, 0, 2, 18, 79, 3, 0, 22, 0, 4, 
+    0, 0, 0, 33, 2, 1, 34, 3, 2, 10, 
+    1, 32, 38, 3, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 
+    0, 0, 0, 0, 74, 0, 74, 0, 10, 1, 
+    1, 0, 75, 1, 0, 39, 2, 0, 75, 0, 
+    0, 27, 3, 2, 19, 45, 5, 3, 17, 0, 
+    0, 0, 0, 32, 0, 5, 32, 1, 0, 27, 
+    2, 1, 12, 6, 3, 0, 2, 1, 79, 1, 
+    3, 19, 3, 7, 0, 0, 0, 32, 1, 0, 
+    34, 2, 1, 11, 1, 32, 38, 2, 32, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 32, 1, 5, 32, 0, 0, 43, 
     0, 1, 12, 17, 0, 0, 0, 0, 33, 1, 
     3, 10, 1, 0, 0, 79, 2, 0, 22, 0, 
     6, 0, 0, 0, 32, 1, 0, 27, 0, 1, 
     20, 45, 6, 0, 32, 1, 4, 45, 7, 1, 
     17, 8, 0, 0, 0, 32, 0, 0, 27, 1, 
     0, 21, 45, 6, 1, 32, 3, 4, 34, 1, 
-    3, 13, 10, 1, 0, 0, 45, 7, 0, 17, 
-    0, 0, 0, 0, 32, 0, 7, 32, 1, 6, 
-    6, 2, 0, 1, 8, 79, 3, 2, 19, 2, 
-    55, 0, 0, 0, 33, 1, 4, 32, 0, 0, 
-    27, 2, 0, 18, 32, 3, 4, 74, 2, 74, 
-    3, 10, 1, 2, 0, 75, 1, 172, 75, 1, 
-    173, 45, 8, 0, 32, 1, 0, 27, 0, 1, 
-    22, 13, 2, 0, 17, 0, 0, 0, 0, 9, 
-    0, 2, 32, 0, 0, 0, 0, 0, 0, 0, 
-    50, 2, 0, 0, 0, 0, 0, 0, 0, 1, 
-    3, 0, 45, 9, 1, 45, 12, 3, 17, 0, 
-    0, 0, 0, 30, 1, 5, 32, 3, 9, 0, 
-    4, 1, 3, 0, 45, 10, 4, 33, 1, 4, 
-    32, 3, 8, 32, 4, 10, 74, 0, 74, 3, 
-    74, 4, 10, 1, 2, 0, 75, 1, 172, 75, 
-    1, 173, 39, 5, 0, 75, 0, 0, 45, 11, 
-    5, 33, 1, 5, 32, 3, 11, 74, 0, 74, 
-    3, 10, 1, 1, 0, 75, 1, 172, 39, 4, 
-    0, 75, 0, 0, 79, 5, 4, 22, 4, 126, 
-    0, 0, 0, 17, 0, 0, 0, 0, 9, 0, 
-    2, 0, 0, 0, 0, 224, 255, 255, 255, 33, 
-    1, 6, 32, 2, 8, 74, 2, 10, 1, 1, 
-    0, 75, 1, 173, 45, 3, 0, 17, 0, 0, 
-    0, 0, 17, 0, 0, 0, 0, 32, 0, 0, 
-    27, 1, 0, 22, 13, 2, 1, 17, 0, 0, 
-    0, 0, 9, 0, 2, 59, 0, 0, 0, 0, 
-    0, 0, 0, 50, 2, 0, 0, 0, 0, 0, 
-    0, 0, 1, 3, 0, 45, 9, 1, 45, 12, 
-    3, 17, 0, 0, 0, 0, 42, 1, 0, 0, 
+    3, 13, 1, 32, 38, 1, 32, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 45, 7, 0, 17, 0, 0, 0, 0, 32, 
+    0, 7, 32, 1, 6, 6, 2, 0, 1, 8, 
+    79, 3, 2, 19, 2, 55, 0, 0, 0, 33, 
+    1, 4, 32, 0, 0, 27, 2, 0, 18, 32, 
+    3, 4, 74, 2, 74, 3, 10, 1, 2, 0, 
+    75, 1, 172, 75, 1, 173, 45, 8, 0, 32, 
+    1, 0, 27, 0, 1, 22, 13, 2, 0, 17, 
+    0, 0, 0, 0, 9, 0, 2, 32, 0, 0, 
+    0, 0, 0, 0, 0, 50, 2, 0, 0, 0, 
+    0, 0, 0, 0, 1, 3, 0, 45, 9, 1, 
+    45, 12, 3, 17, 0, 0, 0, 0, 30, 1, 
+    5, 32, 3, 9, 0, 4, 1, 3, 0, 45, 
+    10, 4, 33, 1, 4, 32, 3, 8, 32, 4, 
+    10, 74, 0, 74, 3, 74, 4, 10, 1, 2, 
+    0, 75, 1, 172, 75, 1, 173, 39, 5, 0, 
+    75, 0, 0, 45, 11, 5, 33, 1, 5, 32, 
+    3, 11, 74, 0, 74, 3, 10, 1, 1, 0, 
+    75, 1, 172, 39, 4, 0, 75, 0, 0, 79, 
+    5, 4, 22, 4, 106, 0, 0, 0, 17, 0, 
+    0, 0, 0, 9, 0, 2, 0, 0, 0, 0, 
+    224, 255, 255, 255, 33, 1, 6, 32, 2, 8, 
+    74, 2, 10, 1, 1, 0, 75, 1, 173, 45, 
+    3, 0, 17, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 32, 0, 0, 27, 1, 0, 22, 13, 
+    2, 1, 17, 0, 0, 0, 0, 9, 0, 2, 
+    57, 0, 0, 0, 0, 0, 0, 0, 50, 2, 
+    0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 
+    45, 9, 1, 45, 12, 3, 17, 0, 0, 0, 
     0, 17, 7, 0, 0, 0, 33, 1, 7, 21, 
     1, 4, 0, 0, 0, 30, 3, 6, 5, 17, 
     0, 0, 0, 0, 41, 3, 52, 33, 1, 4, 
@@ -8632,895 +9218,963 @@ std::vector<uint8_t> _bootstrap_external
     32, 3, 9, 0, 6, 5, 3, 0, 74, 0, 
     74, 4, 74, 6, 10, 1, 2, 0, 75, 1, 
     44, 75, 1, 172, 39, 7, 0, 75, 0, 0, 
-    45, 11, 7, 54, 17, 0, 0, 0, 0, 33, 
-    1, 8, 34, 3, 1, 15, 30, 4, 7, 32, 
-    1, 11, 30, 5, 3, 74, 0, 12, 3, 2, 
-    0, 0, 0, 0, 0, 0, 0, 4, 1, 1, 
-    0, 0, 0, 0, 0, 0, 0, 5, 1, 0, 
-    0, 0, 0, 0, 0, 0, 23, 39, 6, 0, 
-    75, 0, 0, 32, 7, 7, 32, 1, 9, 0, 
-    3, 7, 1, 0, 32, 4, 6, 6, 1, 3, 
-    4, 8, 79, 5, 1, 19, 1, 11, 0, 0, 
-    0, 33, 3, 5, 32, 1, 11, 74, 0, 74, 
-    1, 10, 3, 1, 0, 75, 1, 172, 39, 4, 
-    0, 75, 0, 0, 79, 5, 4, 22, 4, 36, 
-    0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 
-    0, 0, 0, 9, 0, 2, 0, 0, 0, 0, 
-    197, 255, 255, 255, 17, 0, 0, 0, 0, 32, 
-    0, 3, 79, 1, 0, 22, 0, 2, 0, 0, 
-    0, 30, 1, 6, 41, 1, 33, 0, 8, 34, 
-    1, 0, 15, 30, 2, 8, 32, 3, 8, 74, 
-    2, 74, 3, 10, 1, 2, 0, 75, 1, 172, 
-    75, 1, 173, 33, 4, 8, 34, 1, 4, 16, 
-    32, 2, 1, 30, 3, 6, 74, 2, 74, 3, 
-    10, 1, 2, 0, 75, 1, 173, 75, 1, 172, 
-    45, 13, 0, 32, 1, 8, 74, 1, 3, 0, 
-    1, 75, 1, 172, 32, 2, 13, 43, 2, 0, 
-    17, 32, 1, 13, 41, 1, 32, 0, 0, 34, 
-    1, 0, 14, 32, 2, 12, 32, 3, 1, 32, 
-    4, 11, 30, 5, 6, 32, 6, 2, 74, 2, 
-    74, 3, 74, 4, 74, 5, 74, 6, 10, 1, 
-    5, 0, 75, 1, 172, 75, 1, 173, 75, 1, 
-    173, 75, 1, 172, 75, 1, 172, 41, 0, 32, 
-    1, 0, 34, 2, 1, 14, 32, 3, 12, 32, 
-    1, 1, 32, 4, 11, 32, 0, 8, 74, 0, 
-    3, 5, 1, 75, 1, 172, 32, 6, 2, 74, 
-    3, 74, 1, 74, 4, 74, 5, 74, 6, 10, 
-    2, 5, 0, 75, 1, 112, 75, 1, 172, 75, 
-    1, 172, 75, 1, 172, 75, 1, 172, 41, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+    45, 11, 7, 17, 0, 0, 0, 0, 33, 1, 
+    8, 34, 3, 1, 15, 0, 0, 30, 4, 7, 
+    32, 1, 11, 30, 5, 3, 74, 0, 12, 3, 
+    2, 0, 0, 0, 0, 0, 0, 0, 4, 1, 
+    1, 0, 0, 0, 0, 0, 0, 0, 5, 1, 
+    0, 0, 0, 0, 0, 0, 0, 23, 39, 6, 
+    0, 75, 0, 0, 32, 7, 7, 32, 1, 9, 
+    0, 3, 7, 1, 0, 32, 4, 6, 6, 1, 
+    3, 4, 8, 79, 5, 1, 19, 1, 11, 0, 
+    0, 0, 33, 3, 5, 32, 1, 11, 74, 0, 
+    74, 1, 10, 3, 1, 0, 75, 1, 172, 39, 
+    4, 0, 75, 0, 0, 79, 5, 4, 22, 4, 
+    28, 0, 0, 0, 17, 0, 0, 0, 0, 17, 
+    0, 0, 0, 0, 9, 0, 2, 0, 0, 0, 
+    0, 199, 255, 255, 255, 17, 0, 0, 0, 0, 
+    32, 0, 3, 79, 1, 0, 22, 0, 2, 0, 
+    0, 0, 30, 1, 6, 41, 1, 33, 0, 8, 
+    34, 1, 0, 15, 1, 32, 30, 2, 8, 32, 
+    3, 8, 38, 1, 32, 2, 0, 0, 0, 0, 
+    0, 0, 0, 2, 3, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 33, 4, 8, 34, 1, 4, 16, 1, 32, 
+    32, 2, 1, 30, 3, 6, 38, 1, 32, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 45, 13, 0, 32, 1, 
+    8, 74, 1, 3, 0, 1, 75, 1, 172, 32, 
+    2, 13, 43, 2, 0, 17, 32, 1, 13, 41, 
+    1, 32, 0, 0, 34, 1, 0, 14, 1, 32, 
+    32, 2, 12, 32, 3, 1, 32, 4, 11, 30, 
+    5, 6, 32, 6, 2, 38, 1, 32, 5, 0, 
+    0, 0, 0, 0, 0, 0, 2, 3, 4, 5, 
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 41, 0, 32, 
+    1, 0, 34, 2, 1, 14, 1, 32, 32, 3, 
+    12, 32, 1, 1, 32, 4, 11, 32, 0, 8, 
+    74, 0, 3, 5, 1, 75, 1, 172, 32, 6, 
+    2, 38, 2, 32, 5, 0, 0, 0, 0, 0, 
+    0, 0, 3, 1, 4, 5, 6, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 41, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 11, 
+    0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 
+    0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 
+    0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 
+    0, 137, 0, 0, 0, 0, 0, 0, 0, 138, 
+    0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 
+    0, 0, 0, 0, 0, 145, 0, 0, 0, 0, 
+    0, 0, 0, 160, 0, 0, 0, 0, 0, 0, 
+    0, 138, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 2, 111, 0, 0, 0, 0, 0, 0, 
-    0, 84, 114, 121, 32, 116, 111, 32, 102, 105, 
-    110, 100, 32, 97, 32, 115, 112, 101, 99, 32, 
-    102, 111, 114, 32, 116, 104, 101, 32, 115, 112, 
-    101, 99, 105, 102, 105, 101, 100, 32, 109, 111, 
-    100, 117, 108, 101, 46, 10, 10, 32, 32, 32, 
-    32, 32, 32, 32, 32, 82, 101, 116, 117, 114, 
-    110, 115, 32, 116, 104, 101, 32, 109, 97, 116, 
-    99, 104, 105, 110, 103, 32, 115, 112, 101, 99, 
-    44, 32, 111, 114, 32, 78, 111, 110, 101, 32, 
-    105, 102, 32, 110, 111, 116, 32, 102, 111, 117, 
-    110, 100, 46, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 6, 0, 2, 1, 0, 0, 0, 0, 
-    0, 0, 0, 46, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 2, 8, 0, 0, 0, 0, 0, 0, 
-    0, 95, 95, 105, 110, 105, 116, 95, 95, 5, 
-    2, 9, 0, 0, 0, 0, 0, 0, 0, 116, 
-    114, 121, 105, 110, 103, 32, 123, 125, 2, 25, 
-    0, 0, 0, 0, 0, 0, 0, 112, 111, 115, 
-    115, 105, 98, 108, 101, 32, 110, 97, 109, 101, 
-    115, 112, 97, 99, 101, 32, 102, 111, 114, 32, 
-    123, 125, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 
+    0, 2, 111, 0, 0, 0, 0, 0, 0, 0, 
+    84, 114, 121, 32, 116, 111, 32, 102, 105, 110, 
+    100, 32, 97, 32, 115, 112, 101, 99, 32, 102, 
+    111, 114, 32, 116, 104, 101, 32, 115, 112, 101, 
+    99, 105, 102, 105, 101, 100, 32, 109, 111, 100, 
+    117, 108, 101, 46, 10, 10, 32, 32, 32, 32, 
+    32, 32, 32, 32, 82, 101, 116, 117, 114, 110, 
+    115, 32, 116, 104, 101, 32, 109, 97, 116, 99, 
+    104, 105, 110, 103, 32, 115, 112, 101, 99, 44, 
+    32, 111, 114, 32, 78, 111, 110, 101, 32, 105, 
+    102, 32, 110, 111, 116, 32, 102, 111, 117, 110, 
+    100, 46, 10, 32, 32, 32, 32, 32, 32, 32, 
+    32, 6, 0, 2, 1, 0, 0, 0, 0, 0, 
+    0, 0, 46, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 8, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 105, 110, 105, 116, 95, 95, 5, 2, 
+    9, 0, 0, 0, 0, 0, 0, 0, 116, 114, 
+    121, 105, 110, 103, 32, 123, 125, 2, 25, 0, 
+    0, 0, 0, 0, 0, 0, 112, 111, 115, 115, 
+    105, 98, 108, 101, 32, 110, 97, 109, 101, 115, 
+    112, 97, 99, 101, 32, 102, 111, 114, 32, 123, 
+    125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 
-    0, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
-    105, 110, 100, 95, 115, 112, 101, 99, 24, 0, 
-    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
+    0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 
+    9, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
+    110, 100, 95, 115, 112, 101, 99, 24, 0, 0, 
+    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 95, 112, 97, 116, 104, 95, 115, 
+    116, 97, 116, 3, 0, 0, 0, 0, 0, 0, 
+    0, 95, 111, 115, 7, 0, 0, 0, 0, 0, 
+    0, 0, 79, 83, 69, 114, 114, 111, 114, 11, 
+    0, 0, 0, 0, 0, 0, 0, 95, 114, 101, 
+    108, 97, 120, 95, 99, 97, 115, 101, 10, 0, 
+    0, 0, 0, 0, 0, 0, 95, 112, 97, 116, 
+    104, 95, 106, 111, 105, 110, 12, 0, 0, 0, 
     0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    115, 116, 97, 116, 3, 0, 0, 0, 0, 0, 
-    0, 0, 95, 111, 115, 7, 0, 0, 0, 0, 
-    0, 0, 0, 79, 83, 69, 114, 114, 111, 114, 
-    11, 0, 0, 0, 0, 0, 0, 0, 95, 114, 
-    101, 108, 97, 120, 95, 99, 97, 115, 101, 10, 
-    0, 0, 0, 0, 0, 0, 0, 95, 112, 97, 
-    116, 104, 95, 106, 111, 105, 110, 12, 0, 0, 
-    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
-    95, 105, 115, 102, 105, 108, 101, 11, 0, 0, 
-    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
-    95, 105, 115, 100, 105, 114, 10, 0, 0, 0, 
-    0, 0, 0, 0, 86, 97, 108, 117, 101, 69, 
-    114, 114, 111, 114, 10, 0, 0, 0, 0, 0, 
-    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
-    97, 112, 10, 0, 0, 0, 0, 0, 0, 0, 
-    114, 112, 97, 114, 116, 105, 116, 105, 111, 110, 
-    6, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
-    116, 99, 119, 100, 11, 0, 0, 0, 0, 0, 
-    0, 0, 95, 102, 105, 108, 108, 95, 99, 97, 
-    99, 104, 101, 11, 0, 0, 0, 0, 0, 0, 
-    0, 95, 112, 97, 116, 104, 95, 109, 116, 105, 
-    109, 101, 5, 0, 0, 0, 0, 0, 0, 0, 
-    108, 111, 119, 101, 114, 9, 0, 0, 0, 0, 
-    0, 0, 0, 95, 103, 101, 116, 95, 115, 112, 
-    101, 99, 16, 0, 0, 0, 0, 0, 0, 0, 
-    95, 118, 101, 114, 98, 111, 115, 101, 95, 109, 
-    101, 115, 115, 97, 103, 101, 10, 0, 0, 0, 
-    0, 0, 0, 0, 77, 111, 100, 117, 108, 101, 
-    83, 112, 101, 99, 26, 0, 0, 0, 0, 0, 
-    0, 0, 115, 117, 98, 109, 111, 100, 117, 108, 
-    101, 95, 115, 101, 97, 114, 99, 104, 95, 108, 
-    111, 99, 97, 116, 105, 111, 110, 115, 4, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    8, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
-    95, 109, 116, 105, 109, 101, 11, 0, 0, 0, 
+    105, 115, 102, 105, 108, 101, 11, 0, 0, 0, 
     0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    99, 97, 99, 104, 101, 19, 0, 0, 0, 0, 
-    0, 0, 0, 95, 114, 101, 108, 97, 120, 101, 
-    100, 95, 112, 97, 116, 104, 95, 99, 97, 99, 
-    104, 101, 8, 0, 0, 0, 0, 0, 0, 0, 
-    95, 108, 111, 97, 100, 101, 114, 115, 9, 0, 
-    0, 0, 0, 0, 0, 0, 118, 101, 114, 98, 
-    111, 115, 105, 116, 121, 0, 0, 0, 0, 0, 
-    0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 
-    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
-    101, 108, 102, 8, 0, 0, 0, 0, 0, 0, 
-    0, 102, 117, 108, 108, 110, 97, 109, 101, 6, 
-    0, 0, 0, 0, 0, 0, 0, 116, 97, 114, 
-    103, 101, 116, 12, 0, 0, 0, 0, 0, 0, 
-    0, 105, 115, 95, 110, 97, 109, 101, 115, 112, 
-    97, 99, 101, 11, 0, 0, 0, 0, 0, 0, 
-    0, 116, 97, 105, 108, 95, 109, 111, 100, 117, 
-    108, 101, 5, 0, 0, 0, 0, 0, 0, 0, 
-    109, 116, 105, 109, 101, 5, 0, 0, 0, 0, 
-    0, 0, 0, 99, 97, 99, 104, 101, 12, 0, 
-    0, 0, 0, 0, 0, 0, 99, 97, 99, 104, 
-    101, 95, 109, 111, 100, 117, 108, 101, 9, 0, 
-    0, 0, 0, 0, 0, 0, 98, 97, 115, 101, 
-    95, 112, 97, 116, 104, 6, 0, 0, 0, 0, 
-    0, 0, 0, 115, 117, 102, 102, 105, 120, 13, 
-    0, 0, 0, 0, 0, 0, 0, 105, 110, 105, 
-    116, 95, 102, 105, 108, 101, 110, 97, 109, 101, 
-    9, 0, 0, 0, 0, 0, 0, 0, 102, 117, 
-    108, 108, 95, 112, 97, 116, 104, 12, 0, 0, 
-    0, 0, 0, 0, 0, 108, 111, 97, 100, 101, 
-    114, 95, 99, 108, 97, 115, 115, 4, 0, 0, 
-    0, 0, 0, 0, 0, 115, 112, 101, 99, 32, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
-    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
-    0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 
+    105, 115, 100, 105, 114, 10, 0, 0, 0, 0, 
+    0, 0, 0, 86, 97, 108, 117, 101, 69, 114, 
+    114, 111, 114, 10, 0, 0, 0, 0, 0, 0, 
     0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 95, 112, 97, 116, 104, 95, 105, 115, 102, 
-    105, 108, 101, 46, 49, 53, 51, 58, 48, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 30, 0, 
-    0, 33, 1, 0, 32, 2, 0, 30, 3, 1, 
-    74, 2, 74, 3, 10, 1, 2, 0, 75, 1, 
-    0, 75, 1, 171, 41, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    112, 10, 0, 0, 0, 0, 0, 0, 0, 114, 
+    112, 97, 114, 116, 105, 116, 105, 111, 110, 6, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    99, 119, 100, 11, 0, 0, 0, 0, 0, 0, 
+    0, 95, 102, 105, 108, 108, 95, 99, 97, 99, 
+    104, 101, 11, 0, 0, 0, 0, 0, 0, 0, 
+    95, 112, 97, 116, 104, 95, 109, 116, 105, 109, 
+    101, 5, 0, 0, 0, 0, 0, 0, 0, 108, 
+    111, 119, 101, 114, 9, 0, 0, 0, 0, 0, 
+    0, 0, 95, 103, 101, 116, 95, 115, 112, 101, 
+    99, 16, 0, 0, 0, 0, 0, 0, 0, 95, 
+    118, 101, 114, 98, 111, 115, 101, 95, 109, 101, 
+    115, 115, 97, 103, 101, 10, 0, 0, 0, 0, 
+    0, 0, 0, 77, 111, 100, 117, 108, 101, 83, 
+    112, 101, 99, 26, 0, 0, 0, 0, 0, 0, 
+    0, 115, 117, 98, 109, 111, 100, 117, 108, 101, 
+    95, 115, 101, 97, 114, 99, 104, 95, 108, 111, 
+    99, 97, 116, 105, 111, 110, 115, 4, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 8, 
+    0, 0, 0, 0, 0, 0, 0, 115, 116, 95, 
+    109, 116, 105, 109, 101, 11, 0, 0, 0, 0, 
+    0, 0, 0, 95, 112, 97, 116, 104, 95, 99, 
+    97, 99, 104, 101, 19, 0, 0, 0, 0, 0, 
+    0, 0, 95, 114, 101, 108, 97, 120, 101, 100, 
+    95, 112, 97, 116, 104, 95, 99, 97, 99, 104, 
+    101, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
+    108, 111, 97, 100, 101, 114, 115, 9, 0, 0, 
+    0, 0, 0, 0, 0, 118, 101, 114, 98, 111, 
+    115, 105, 116, 121, 0, 0, 0, 0, 0, 0, 
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+    108, 102, 8, 0, 0, 0, 0, 0, 0, 0, 
+    102, 117, 108, 108, 110, 97, 109, 101, 6, 0, 
+    0, 0, 0, 0, 0, 0, 116, 97, 114, 103, 
+    101, 116, 12, 0, 0, 0, 0, 0, 0, 0, 
+    105, 115, 95, 110, 97, 109, 101, 115, 112, 97, 
+    99, 101, 11, 0, 0, 0, 0, 0, 0, 0, 
+    116, 97, 105, 108, 95, 109, 111, 100, 117, 108, 
+    101, 5, 0, 0, 0, 0, 0, 0, 0, 109, 
+    116, 105, 109, 101, 5, 0, 0, 0, 0, 0, 
+    0, 0, 99, 97, 99, 104, 101, 12, 0, 0, 
+    0, 0, 0, 0, 0, 99, 97, 99, 104, 101, 
+    95, 109, 111, 100, 117, 108, 101, 9, 0, 0, 
+    0, 0, 0, 0, 0, 98, 97, 115, 101, 95, 
+    112, 97, 116, 104, 6, 0, 0, 0, 0, 0, 
+    0, 0, 115, 117, 102, 102, 105, 120, 13, 0, 
+    0, 0, 0, 0, 0, 0, 105, 110, 105, 116, 
+    95, 102, 105, 108, 101, 110, 97, 109, 101, 9, 
+    0, 0, 0, 0, 0, 0, 0, 102, 117, 108, 
+    108, 95, 112, 97, 116, 104, 12, 0, 0, 0, 
+    0, 0, 0, 0, 108, 111, 97, 100, 101, 114, 
+    95, 99, 108, 97, 115, 115, 4, 0, 0, 0, 
+    0, 0, 0, 0, 115, 112, 101, 99, 32, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    95, 112, 97, 116, 104, 95, 105, 115, 102, 105, 
+    108, 101, 46, 49, 53, 51, 58, 48, 0, 10, 
+    0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 
+    33, 1, 0, 32, 2, 0, 30, 3, 1, 74, 
+    2, 74, 3, 10, 1, 2, 0, 75, 1, 0, 
+    75, 1, 171, 41, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 31, 
-    0, 0, 0, 0, 0, 0, 0, 82, 101, 112, 
-    108, 97, 99, 101, 109, 101, 110, 116, 32, 102, 
-    111, 114, 32, 111, 115, 46, 112, 97, 116, 104, 
-    46, 105, 115, 102, 105, 108, 101, 46, 0, 0, 
-    128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 2, 31, 0, 0, 0, 
+    0, 0, 0, 0, 82, 101, 112, 108, 97, 99, 
+    101, 109, 101, 110, 116, 32, 102, 111, 114, 32, 
+    111, 115, 46, 112, 97, 116, 104, 46, 105, 115, 
+    102, 105, 108, 101, 46, 0, 0, 128, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 105, 115, 102, 
+    105, 108, 101, 1, 0, 0, 0, 0, 0, 0, 
+    0, 18, 0, 0, 0, 0, 0, 0, 0, 95, 
+    112, 97, 116, 104, 95, 105, 115, 95, 109, 111, 
+    100, 101, 95, 116, 121, 112, 101, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 116, 104, 33, 0, 0, 0, 0, 
+    0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 54, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 80, 97, 116, 
+    104, 70, 105, 110, 100, 101, 114, 46, 95, 108, 
+    101, 103, 97, 99, 121, 95, 103, 101, 116, 95, 
+    115, 112, 101, 99, 46, 49, 51, 54, 55, 58, 
+    52, 0, 48, 0, 0, 0, 0, 0, 0, 0, 
+    33, 1, 0, 32, 2, 2, 30, 3, 0, 74, 
+    2, 74, 3, 10, 1, 2, 0, 75, 1, 0, 
+    75, 1, 0, 79, 4, 0, 22, 0, 8, 0, 
+    0, 0, 32, 1, 2, 34, 2, 1, 6, 1, 
+    32, 32, 3, 1, 38, 2, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 45, 3, 0, 3, 2, 0, 45, 4, 
+    2, 17, 8, 0, 0, 0, 32, 0, 2, 34, 
+    1, 0, 2, 1, 32, 32, 2, 1, 38, 1, 
+    32, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 50, 2, 0, 0, 
+    0, 0, 0, 0, 0, 3, 4, 0, 45, 3, 
+    3, 45, 4, 4, 17, 0, 0, 0, 0, 32, 
+    0, 3, 30, 1, 1, 6, 2, 0, 1, 7, 
+    79, 3, 2, 22, 2, 11, 0, 0, 0, 33, 
+    0, 1, 34, 1, 0, 4, 1, 32, 32, 2, 
+    1, 30, 3, 1, 38, 1, 32, 2, 0, 0, 
+    0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 45, 5, 0, 32, 1, 4, 32, 
+    0, 5, 43, 0, 1, 5, 32, 2, 5, 41, 
+    2, 33, 0, 1, 34, 1, 0, 3, 1, 32, 
+    32, 2, 1, 32, 3, 3, 38, 1, 32, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 11, 0, 
+    0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 
+    95, 108, 111, 97, 100, 101, 114, 5, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 
+    0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 
+    0, 0, 0, 0, 0, 95, 108, 101, 103, 97, 
+    99, 121, 95, 103, 101, 116, 95, 115, 112, 101, 
+    99, 7, 0, 0, 0, 0, 0, 0, 0, 7, 
+    0, 0, 0, 0, 0, 0, 0, 104, 97, 115, 
+    97, 116, 116, 114, 10, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 11, 0, 0, 0, 0, 0, 0, 0, 
+    102, 105, 110, 100, 95, 108, 111, 97, 100, 101, 
+    114, 16, 0, 0, 0, 0, 0, 0, 0, 115, 
+    112, 101, 99, 95, 102, 114, 111, 109, 95, 108, 
+    111, 97, 100, 101, 114, 10, 0, 0, 0, 0, 
+    0, 0, 0, 77, 111, 100, 117, 108, 101, 83, 
+    112, 101, 99, 26, 0, 0, 0, 0, 0, 0, 
+    0, 115, 117, 98, 109, 111, 100, 117, 108, 101, 
+    95, 115, 101, 97, 114, 99, 104, 95, 108, 111, 
+    99, 97, 116, 105, 111, 110, 115, 11, 0, 0, 
+    0, 0, 0, 0, 0, 102, 105, 110, 100, 95, 
+    109, 111, 100, 117, 108, 101, 0, 0, 0, 0, 
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    99, 108, 115, 8, 0, 0, 0, 0, 0, 0, 
+    0, 102, 117, 108, 108, 110, 97, 109, 101, 6, 
+    0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 
+    100, 101, 114, 6, 0, 0, 0, 0, 0, 0, 
+    0, 108, 111, 97, 100, 101, 114, 8, 0, 0, 
+    0, 0, 0, 0, 0, 112, 111, 114, 116, 105, 
+    111, 110, 115, 4, 0, 0, 0, 0, 0, 0, 
+    0, 115, 112, 101, 99, 33, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 49, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 83, 111, 117, 
+    114, 99, 101, 76, 111, 97, 100, 101, 114, 46, 
+    103, 101, 116, 95, 115, 111, 117, 114, 99, 101, 
+    46, 56, 57, 55, 58, 52, 0, 29, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 32, 1, 
+    0, 34, 2, 1, 4, 1, 32, 32, 3, 1, 
+    38, 2, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 45, 2, 
+    0, 17, 10, 0, 0, 0, 33, 0, 0, 46, 
+    1, 0, 21, 0, 6, 0, 0, 0, 33, 1, 
+    2, 30, 2, 1, 32, 3, 1, 12, 1, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 
+    0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 
+    0, 0, 0, 0, 0, 6, 33, 4, 1, 40, 
+    2, 0, 4, 52, 32, 0, 0, 34, 1, 0, 
+    5, 1, 32, 32, 2, 2, 38, 1, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 45, 3, 0, 17, 0, 0, 
+    0, 0, 33, 1, 3, 32, 2, 3, 74, 2, 
+    10, 1, 1, 0, 75, 1, 0, 41, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 
+    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
+    0, 17, 0, 0, 0, 0, 0, 0, 0, 22, 
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 2, 52, 0, 
+    0, 0, 0, 0, 0, 0, 67, 111, 110, 99, 
+    114, 101, 116, 101, 32, 105, 109, 112, 108, 101, 
+    109, 101, 110, 116, 97, 116, 105, 111, 110, 32, 
+    111, 102, 32, 73, 110, 115, 112, 101, 99, 116, 
+    76, 111, 97, 100, 101, 114, 46, 103, 101, 116, 
+    95, 115, 111, 117, 114, 99, 101, 46, 2, 39, 
+    0, 0, 0, 0, 0, 0, 0, 115, 111, 117, 
+    114, 99, 101, 32, 110, 111, 116, 32, 97, 118, 
+    97, 105, 108, 97, 98, 108, 101, 32, 116, 104, 
+    114, 111, 117, 103, 104, 32, 103, 101, 116, 95, 
+    100, 97, 116, 97, 40, 41, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
-    0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 
-    0, 0, 0, 0, 95, 112, 97, 116, 104, 95, 
-    105, 115, 102, 105, 108, 101, 1, 0, 0, 0, 
-    0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 
-    0, 0, 95, 112, 97, 116, 104, 95, 105, 115, 
-    95, 109, 111, 100, 101, 95, 116, 121, 112, 101, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 32, 0, 
-    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 
-    0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    80, 97, 116, 104, 70, 105, 110, 100, 101, 114, 
-    46, 95, 108, 101, 103, 97, 99, 121, 95, 103, 
-    101, 116, 95, 115, 112, 101, 99, 46, 49, 51, 
-    54, 55, 58, 52, 0, 60, 0, 0, 0, 0, 
-    0, 0, 0, 33, 1, 0, 32, 2, 2, 30, 
-    3, 0, 74, 2, 74, 3, 10, 1, 2, 0, 
-    75, 1, 0, 75, 1, 0, 79, 4, 0, 22, 
-    0, 10, 0, 0, 0, 32, 1, 2, 34, 2, 
-    1, 6, 32, 3, 1, 74, 3, 10, 2, 1, 
-    0, 75, 1, 0, 45, 3, 0, 3, 2, 0, 
-    45, 4, 2, 17, 10, 0, 0, 0, 32, 0, 
-    2, 34, 1, 0, 2, 32, 2, 1, 74, 2, 
-    10, 1, 1, 0, 75, 1, 0, 50, 2, 0, 
-    0, 0, 0, 0, 0, 0, 3, 4, 0, 45, 
-    3, 3, 45, 4, 4, 17, 0, 0, 0, 0, 
-    32, 0, 3, 30, 1, 1, 6, 2, 0, 1, 
-    7, 79, 3, 2, 22, 2, 15, 0, 0, 0, 
-    33, 0, 1, 34, 1, 0, 4, 32, 2, 1, 
-    30, 3, 1, 74, 2, 74, 3, 10, 1, 2, 
-    0, 75, 1, 0, 75, 1, 0, 45, 5, 0, 
-    32, 1, 4, 32, 0, 5, 43, 0, 1, 5, 
-    32, 2, 5, 41, 2, 33, 0, 1, 34, 1, 
-    0, 3, 32, 2, 1, 32, 3, 3, 74, 2, 
-    74, 3, 10, 1, 2, 0, 75, 1, 0, 75, 
-    1, 0, 41, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 103, 101, 116, 95, 115, 111, 117, 
+    114, 99, 101, 7, 0, 0, 0, 0, 0, 0, 
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 79, 
+    83, 69, 114, 114, 111, 114, 3, 0, 0, 0, 
+    0, 0, 0, 0, 101, 120, 99, 11, 0, 0, 
+    0, 0, 0, 0, 0, 73, 109, 112, 111, 114, 
+    116, 69, 114, 114, 111, 114, 13, 0, 0, 0, 
+    0, 0, 0, 0, 100, 101, 99, 111, 100, 101, 
+    95, 115, 111, 117, 114, 99, 101, 12, 0, 0, 
+    0, 0, 0, 0, 0, 103, 101, 116, 95, 102, 
+    105, 108, 101, 110, 97, 109, 101, 8, 0, 0, 
+    0, 0, 0, 0, 0, 103, 101, 116, 95, 100, 
+    97, 116, 97, 4, 0, 0, 0, 0, 0, 0, 
+    0, 110, 97, 109, 101, 0, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+    101, 108, 102, 8, 0, 0, 0, 0, 0, 0, 
+    0, 102, 117, 108, 108, 110, 97, 109, 101, 4, 
+    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
+    104, 12, 0, 0, 0, 0, 0, 0, 0, 115, 
+    111, 117, 114, 99, 101, 95, 98, 121, 116, 101, 
+    115, 33, 0, 0, 0, 0, 0, 0, 0, 6, 
+    0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 
+    0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 
+    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
+    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
+    97, 108, 46, 80, 97, 116, 104, 70, 105, 110, 
+    100, 101, 114, 46, 102, 105, 110, 100, 95, 115, 
+    112, 101, 99, 46, 49, 52, 49, 52, 58, 52, 
+    0, 59, 0, 0, 0, 0, 0, 0, 0, 30, 
+    0, 0, 32, 1, 2, 30, 0, 1, 6, 2, 
+    1, 0, 6, 79, 3, 2, 19, 2, 4, 0, 
+    0, 0, 33, 0, 0, 27, 1, 0, 5, 45, 
+    2, 1, 17, 0, 0, 0, 0, 32, 0, 0, 
+    34, 1, 0, 2, 1, 32, 32, 2, 1, 32, 
+    3, 2, 32, 4, 3, 38, 1, 32, 3, 0, 
+    0, 0, 0, 0, 0, 0, 2, 3, 4, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 45, 4, 0, 32, 1, 
+    4, 30, 0, 1, 6, 2, 1, 0, 6, 79, 
+    3, 2, 22, 2, 35, 0, 0, 0, 32, 0, 
+    4, 27, 1, 0, 6, 30, 2, 1, 6, 0, 
+    1, 2, 6, 79, 3, 0, 22, 0, 2, 0, 
+    0, 0, 32, 1, 4, 41, 1, 32, 0, 4, 
+    27, 1, 0, 4, 45, 5, 1, 32, 0, 5, 
+    79, 1, 0, 22, 0, 2, 0, 0, 0, 30, 
+    1, 1, 41, 1, 30, 0, 1, 32, 1, 4, 
+    43, 1, 0, 3, 33, 2, 1, 32, 1, 1, 
+    32, 3, 5, 32, 4, 0, 27, 5, 4, 2, 
+    74, 1, 74, 3, 74, 5, 10, 2, 3, 0, 
+    75, 1, 0, 75, 1, 0, 75, 1, 0, 32, 
+    4, 4, 43, 4, 0, 4, 32, 1, 4, 41, 
+    1, 30, 0, 1, 41, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 2, 11, 0, 0, 
-    0, 0, 0, 0, 0, 102, 105, 110, 100, 95, 
-    108, 111, 97, 100, 101, 114, 5, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 2, 141, 0, 0, 
+    0, 0, 0, 0, 0, 84, 114, 121, 32, 116, 
+    111, 32, 102, 105, 110, 100, 32, 97, 32, 115, 
+    112, 101, 99, 32, 102, 111, 114, 32, 39, 102, 
+    117, 108, 108, 110, 97, 109, 101, 39, 32, 111, 
+    110, 32, 115, 121, 115, 46, 112, 97, 116, 104, 
+    32, 111, 114, 32, 39, 112, 97, 116, 104, 39, 
+    46, 10, 10, 32, 32, 32, 32, 32, 32, 32, 
+    32, 84, 104, 101, 32, 115, 101, 97, 114, 99, 
+    104, 32, 105, 115, 32, 98, 97, 115, 101, 100, 
+    32, 111, 110, 32, 115, 121, 115, 46, 112, 97, 
+    116, 104, 95, 104, 111, 111, 107, 115, 32, 97, 
+    110, 100, 32, 115, 121, 115, 46, 112, 97, 116, 
+    104, 95, 105, 109, 112, 111, 114, 116, 101, 114, 
+    95, 99, 97, 99, 104, 101, 46, 10, 32, 32, 
+    32, 32, 32, 32, 32, 32, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 
-    0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 
-    0, 0, 0, 0, 95, 108, 101, 103, 97, 99, 
-    121, 95, 103, 101, 116, 95, 115, 112, 101, 99, 
-    7, 0, 0, 0, 0, 0, 0, 0, 7, 0, 
-    0, 0, 0, 0, 0, 0, 104, 97, 115, 97, 
-    116, 116, 114, 10, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 11, 0, 0, 0, 0, 0, 0, 0, 102, 
-    105, 110, 100, 95, 108, 111, 97, 100, 101, 114, 
-    16, 0, 0, 0, 0, 0, 0, 0, 115, 112, 
-    101, 99, 95, 102, 114, 111, 109, 95, 108, 111, 
-    97, 100, 101, 114, 10, 0, 0, 0, 0, 0, 
-    0, 0, 77, 111, 100, 117, 108, 101, 83, 112, 
-    101, 99, 26, 0, 0, 0, 0, 0, 0, 0, 
-    115, 117, 98, 109, 111, 100, 117, 108, 101, 95, 
-    115, 101, 97, 114, 99, 104, 95, 108, 111, 99, 
-    97, 116, 105, 111, 110, 115, 11, 0, 0, 0, 
-    0, 0, 0, 0, 102, 105, 110, 100, 95, 109, 
-    111, 100, 117, 108, 101, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 
+    0, 0, 0, 0, 102, 105, 110, 100, 95, 115, 
+    112, 101, 99, 7, 0, 0, 0, 0, 0, 0, 
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 115, 
+    121, 115, 14, 0, 0, 0, 0, 0, 0, 0, 
+    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
+    80, 97, 116, 104, 9, 0, 0, 0, 0, 0, 
+    0, 0, 95, 103, 101, 116, 95, 115, 112, 101, 
+    99, 6, 0, 0, 0, 0, 0, 0, 0, 111, 
+    114, 105, 103, 105, 110, 26, 0, 0, 0, 0, 
+    0, 0, 0, 115, 117, 98, 109, 111, 100, 117, 
+    108, 101, 95, 115, 101, 97, 114, 99, 104, 95, 
+    108, 111, 99, 97, 116, 105, 111, 110, 115, 4, 
+    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
+    104, 6, 0, 0, 0, 0, 0, 0, 0, 108, 
+    111, 97, 100, 101, 114, 0, 0, 0, 0, 0, 
     0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 
     0, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
     108, 115, 8, 0, 0, 0, 0, 0, 0, 0, 
-    102, 117, 108, 108, 110, 97, 109, 101, 6, 0, 
-    0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 
-    101, 114, 6, 0, 0, 0, 0, 0, 0, 0, 
-    108, 111, 97, 100, 101, 114, 8, 0, 0, 0, 
-    0, 0, 0, 0, 112, 111, 114, 116, 105, 111, 
-    110, 115, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 112, 101, 99, 32, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    7, 0, 0, 0, 0, 0, 0, 0, 49, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 83, 111, 117, 114, 
-    99, 101, 76, 111, 97, 100, 101, 114, 46, 103, 
-    101, 116, 95, 115, 111, 117, 114, 99, 101, 46, 
-    56, 57, 55, 58, 52, 0, 35, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 32, 1, 0, 
-    34, 2, 1, 4, 32, 3, 1, 74, 3, 10, 
-    2, 1, 0, 75, 1, 0, 45, 2, 0, 42, 
-    1, 0, 0, 0, 17, 10, 0, 0, 0, 33, 
-    0, 0, 46, 1, 0, 21, 0, 6, 0, 0, 
-    0, 33, 1, 2, 30, 2, 1, 32, 3, 1, 
-    12, 1, 1, 0, 0, 0, 0, 0, 0, 0, 
-    2, 1, 0, 0, 0, 0, 0, 0, 0, 3, 
-    1, 0, 0, 0, 0, 0, 0, 0, 6, 33, 
-    4, 1, 40, 2, 0, 4, 52, 32, 0, 0, 
-    34, 1, 0, 5, 32, 2, 2, 74, 2, 10, 
-    1, 1, 0, 75, 1, 0, 45, 3, 0, 54, 
-    17, 0, 0, 0, 0, 33, 1, 3, 32, 2, 
-    3, 74, 2, 10, 1, 1, 0, 75, 1, 0, 
-    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 2, 52, 0, 0, 0, 0, 
-    0, 0, 0, 67, 111, 110, 99, 114, 101, 116, 
-    101, 32, 105, 109, 112, 108, 101, 109, 101, 110, 
-    116, 97, 116, 105, 111, 110, 32, 111, 102, 32, 
-    73, 110, 115, 112, 101, 99, 116, 76, 111, 97, 
-    100, 101, 114, 46, 103, 101, 116, 95, 115, 111, 
-    117, 114, 99, 101, 46, 2, 39, 0, 0, 0, 
-    0, 0, 0, 0, 115, 111, 117, 114, 99, 101, 
-    32, 110, 111, 116, 32, 97, 118, 97, 105, 108, 
-    97, 98, 108, 101, 32, 116, 104, 114, 111, 117, 
-    103, 104, 32, 103, 101, 116, 95, 100, 97, 116, 
-    97, 40, 41, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
-    0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
-    103, 101, 116, 95, 115, 111, 117, 114, 99, 101, 
-    7, 0, 0, 0, 0, 0, 0, 0, 7, 0, 
-    0, 0, 0, 0, 0, 0, 79, 83, 69, 114, 
-    114, 111, 114, 3, 0, 0, 0, 0, 0, 0, 
-    0, 101, 120, 99, 11, 0, 0, 0, 0, 0, 
-    0, 0, 73, 109, 112, 111, 114, 116, 69, 114, 
-    114, 111, 114, 13, 0, 0, 0, 0, 0, 0, 
-    0, 100, 101, 99, 111, 100, 101, 95, 115, 111, 
-    117, 114, 99, 101, 12, 0, 0, 0, 0, 0, 
-    0, 0, 103, 101, 116, 95, 102, 105, 108, 101, 
-    110, 97, 109, 101, 8, 0, 0, 0, 0, 0, 
-    0, 0, 103, 101, 116, 95, 100, 97, 116, 97, 
-    4, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
-    109, 101, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 115, 101, 108, 102, 
-    8, 0, 0, 0, 0, 0, 0, 0, 102, 117, 
-    108, 108, 110, 97, 109, 101, 4, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 12, 0, 
-    0, 0, 0, 0, 0, 0, 115, 111, 117, 114, 
-    99, 101, 95, 98, 121, 116, 101, 115, 32, 0, 
-    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
-    0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 
-    0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 
+    102, 117, 108, 108, 110, 97, 109, 101, 4, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
+    6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 
+    114, 103, 101, 116, 4, 0, 0, 0, 0, 0, 
+    0, 0, 115, 112, 101, 99, 14, 0, 0, 0, 
+    0, 0, 0, 0, 110, 97, 109, 101, 115, 112, 
+    97, 99, 101, 95, 112, 97, 116, 104, 32, 0, 
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 
     95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
     95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
     80, 97, 116, 104, 70, 105, 110, 100, 101, 114, 
-    46, 102, 105, 110, 100, 95, 115, 112, 101, 99, 
-    46, 49, 52, 49, 52, 58, 52, 0, 65, 0, 
-    0, 0, 0, 0, 0, 0, 30, 0, 0, 32, 
-    1, 2, 30, 0, 1, 6, 2, 1, 0, 6, 
-    79, 3, 2, 19, 2, 4, 0, 0, 0, 33, 
-    0, 0, 27, 1, 0, 5, 45, 2, 1, 17, 
-    0, 0, 0, 0, 32, 0, 0, 34, 1, 0, 
-    2, 32, 2, 1, 32, 3, 2, 32, 4, 3, 
-    74, 2, 74, 3, 74, 4, 10, 1, 3, 0, 
-    75, 1, 0, 75, 1, 0, 75, 1, 0, 45, 
-    4, 0, 32, 1, 4, 30, 0, 1, 6, 2, 
-    1, 0, 6, 79, 3, 2, 22, 2, 35, 0, 
-    0, 0, 32, 0, 4, 27, 1, 0, 6, 30, 
-    2, 1, 6, 0, 1, 2, 6, 79, 3, 0, 
-    22, 0, 2, 0, 0, 0, 32, 1, 4, 41, 
-    1, 32, 0, 4, 27, 1, 0, 4, 45, 5, 
-    1, 32, 0, 5, 79, 1, 0, 22, 0, 2, 
-    0, 0, 0, 30, 1, 1, 41, 1, 30, 0, 
-    1, 32, 1, 4, 43, 1, 0, 3, 33, 2, 
-    1, 32, 1, 1, 32, 3, 5, 32, 4, 0, 
-    27, 5, 4, 2, 74, 1, 74, 3, 74, 5, 
-    10, 2, 3, 0, 75, 1, 0, 75, 1, 0, 
-    75, 1, 0, 32, 4, 4, 43, 4, 0, 4, 
-    32, 1, 4, 41, 1, 30, 0, 1, 41, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 2, 141, 0, 0, 0, 0, 0, 0, 
-    0, 84, 114, 121, 32, 116, 111, 32, 102, 105, 
-    110, 100, 32, 97, 32, 115, 112, 101, 99, 32, 
-    102, 111, 114, 32, 39, 102, 117, 108, 108, 110, 
-    97, 109, 101, 39, 32, 111, 110, 32, 115, 121, 
-    115, 46, 112, 97, 116, 104, 32, 111, 114, 32, 
-    39, 112, 97, 116, 104, 39, 46, 10, 10, 32, 
-    32, 32, 32, 32, 32, 32, 32, 84, 104, 101, 
-    32, 115, 101, 97, 114, 99, 104, 32, 105, 115, 
-    32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 
-    115, 121, 115, 46, 112, 97, 116, 104, 95, 104, 
-    111, 111, 107, 115, 32, 97, 110, 100, 32, 115, 
-    121, 115, 46, 112, 97, 116, 104, 95, 105, 109, 
-    112, 111, 114, 116, 101, 114, 95, 99, 97, 99, 
-    104, 101, 46, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 5, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    46, 102, 105, 110, 100, 95, 100, 105, 115, 116, 
+    114, 105, 98, 117, 116, 105, 111, 110, 115, 46, 
+    49, 52, 53, 49, 58, 52, 0, 21, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 30, 1, 
+    1, 30, 0, 2, 74, 0, 4, 2, 1, 75, 
+    1, 0, 14, 3, 1, 2, 1, 61, 0, 2, 
+    3, 45, 3, 0, 32, 2, 3, 34, 1, 2, 
+    0, 0, 0, 32, 0, 1, 3, 2, 0, 24, 
+    2, 0, 25, 3, 2, 30, 0, 3, 32, 2, 
+    2, 2, 4, 0, 65, 4, 2, 11, 1, 3, 
+    4, 1, 1, 41, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 
-    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
-    102, 105, 110, 100, 95, 115, 112, 101, 99, 7, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 115, 121, 115, 14, 0, 
-    0, 0, 0, 0, 0, 0, 95, 78, 97, 109, 
-    101, 115, 112, 97, 99, 101, 80, 97, 116, 104, 
-    9, 0, 0, 0, 0, 0, 0, 0, 95, 103, 
-    101, 116, 95, 115, 112, 101, 99, 6, 0, 0, 
-    0, 0, 0, 0, 0, 111, 114, 105, 103, 105, 
-    110, 26, 0, 0, 0, 0, 0, 0, 0, 115, 
-    117, 98, 109, 111, 100, 117, 108, 101, 95, 115, 
-    101, 97, 114, 99, 104, 95, 108, 111, 99, 97, 
-    116, 105, 111, 110, 115, 4, 0, 0, 0, 0, 
-    0, 0, 0, 112, 97, 116, 104, 6, 0, 0, 
-    0, 0, 0, 0, 0, 108, 111, 97, 100, 101, 
-    114, 0, 0, 0, 0, 0, 0, 0, 0, 6, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 99, 108, 115, 8, 0, 
-    0, 0, 0, 0, 0, 0, 102, 117, 108, 108, 
-    110, 97, 109, 101, 4, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 116, 104, 6, 0, 0, 0, 
-    0, 0, 0, 0, 116, 97, 114, 103, 101, 116, 
-    4, 0, 0, 0, 0, 0, 0, 0, 115, 112, 
-    101, 99, 14, 0, 0, 0, 0, 0, 0, 0, 
-    110, 97, 109, 101, 115, 112, 97, 99, 101, 95, 
-    112, 97, 116, 104, 32, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    5, 0, 0, 0, 0, 0, 0, 0, 56, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 80, 97, 116, 104, 
-    70, 105, 110, 100, 101, 114, 46, 102, 105, 110, 
-    100, 95, 100, 105, 115, 116, 114, 105, 98, 117, 
-    116, 105, 111, 110, 115, 46, 49, 52, 53, 49, 
-    58, 52, 0, 21, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 30, 1, 1, 30, 0, 2, 
-    74, 0, 4, 2, 1, 75, 1, 0, 14, 3, 
-    1, 2, 1, 61, 0, 2, 3, 45, 3, 0, 
-    32, 2, 3, 34, 1, 2, 0, 32, 0, 1, 
-    3, 2, 0, 24, 2, 0, 25, 3, 2, 30, 
-    0, 3, 32, 2, 2, 2, 4, 0, 65, 4, 
-    2, 11, 1, 3, 4, 1, 1, 41, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 2, 32, 1, 0, 0, 
+    0, 0, 0, 0, 10, 32, 32, 32, 32, 32, 
+    32, 32, 32, 70, 105, 110, 100, 32, 100, 105, 
+    115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 
+    115, 46, 10, 10, 32, 32, 32, 32, 32, 32, 
+    32, 32, 82, 101, 116, 117, 114, 110, 32, 97, 
+    110, 32, 105, 116, 101, 114, 97, 98, 108, 101, 
+    32, 111, 102, 32, 97, 108, 108, 32, 68, 105, 
+    115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 
+    32, 105, 110, 115, 116, 97, 110, 99, 101, 115, 
+    32, 99, 97, 112, 97, 98, 108, 101, 32, 111, 
+    102, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+    108, 111, 97, 100, 105, 110, 103, 32, 116, 104, 
+    101, 32, 109, 101, 116, 97, 100, 97, 116, 97, 
+    32, 102, 111, 114, 32, 112, 97, 99, 107, 97, 
+    103, 101, 115, 32, 109, 97, 116, 99, 104, 105, 
+    110, 103, 32, 96, 96, 99, 111, 110, 116, 101, 
+    120, 116, 46, 110, 97, 109, 101, 96, 96, 10, 
+    32, 32, 32, 32, 32, 32, 32, 32, 40, 111, 
+    114, 32, 97, 108, 108, 32, 110, 97, 109, 101, 
+    115, 32, 105, 102, 32, 96, 96, 78, 111, 110, 
+    101, 96, 96, 32, 105, 110, 100, 105, 99, 97, 
+    116, 101, 100, 41, 32, 97, 108, 111, 110, 103, 
+    32, 116, 104, 101, 32, 112, 97, 116, 104, 115, 
+    32, 105, 110, 32, 116, 104, 101, 32, 108, 105, 
+    115, 116, 10, 32, 32, 32, 32, 32, 32, 32, 
+    32, 111, 102, 32, 100, 105, 114, 101, 99, 116, 
+    111, 114, 105, 101, 115, 32, 96, 96, 99, 111, 
+    110, 116, 101, 120, 116, 46, 112, 97, 116, 104, 
+    96, 96, 46, 10, 32, 32, 32, 32, 32, 32, 
+    32, 32, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 18, 0, 0, 0, 0, 0, 0, 0, 
+    77, 101, 116, 97, 100, 97, 116, 97, 80, 97, 
+    116, 104, 70, 105, 110, 100, 101, 114, 5, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
-    0, 2, 32, 1, 0, 0, 0, 0, 0, 0, 
-    10, 32, 32, 32, 32, 32, 32, 32, 32, 70, 
-    105, 110, 100, 32, 100, 105, 115, 116, 114, 105, 
-    98, 117, 116, 105, 111, 110, 115, 46, 10, 10, 
-    32, 32, 32, 32, 32, 32, 32, 32, 82, 101, 
-    116, 117, 114, 110, 32, 97, 110, 32, 105, 116, 
-    101, 114, 97, 98, 108, 101, 32, 111, 102, 32, 
-    97, 108, 108, 32, 68, 105, 115, 116, 114, 105, 
-    98, 117, 116, 105, 111, 110, 32, 105, 110, 115, 
-    116, 97, 110, 99, 101, 115, 32, 99, 97, 112, 
-    97, 98, 108, 101, 32, 111, 102, 10, 32, 32, 
-    32, 32, 32, 32, 32, 32, 108, 111, 97, 100, 
-    105, 110, 103, 32, 116, 104, 101, 32, 109, 101, 
-    116, 97, 100, 97, 116, 97, 32, 102, 111, 114, 
-    32, 112, 97, 99, 107, 97, 103, 101, 115, 32, 
-    109, 97, 116, 99, 104, 105, 110, 103, 32, 96, 
-    96, 99, 111, 110, 116, 101, 120, 116, 46, 110, 
-    97, 109, 101, 96, 96, 10, 32, 32, 32, 32, 
-    32, 32, 32, 32, 40, 111, 114, 32, 97, 108, 
-    108, 32, 110, 97, 109, 101, 115, 32, 105, 102, 
-    32, 96, 96, 78, 111, 110, 101, 96, 96, 32, 
-    105, 110, 100, 105, 99, 97, 116, 101, 100, 41, 
-    32, 97, 108, 111, 110, 103, 32, 116, 104, 101, 
-    32, 112, 97, 116, 104, 115, 32, 105, 110, 32, 
-    116, 104, 101, 32, 108, 105, 115, 116, 10, 32, 
-    32, 32, 32, 32, 32, 32, 32, 111, 102, 32, 
-    100, 105, 114, 101, 99, 116, 111, 114, 105, 101, 
-    115, 32, 96, 96, 99, 111, 110, 116, 101, 120, 
-    116, 46, 112, 97, 116, 104, 96, 96, 46, 10, 
-    32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 18, 0, 
-    0, 0, 0, 0, 0, 0, 77, 101, 116, 97, 
-    100, 97, 116, 97, 80, 97, 116, 104, 70, 105, 
-    110, 100, 101, 114, 5, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
-    0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 
-    0, 0, 102, 105, 110, 100, 95, 100, 105, 115, 
-    116, 114, 105, 98, 117, 116, 105, 111, 110, 115, 
-    3, 0, 0, 0, 0, 0, 0, 0, 18, 0, 
+    5, 0, 0, 0, 0, 0, 0, 0, 18, 0, 
     0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 
     95, 100, 105, 115, 116, 114, 105, 98, 117, 116, 
-    105, 111, 110, 115, 18, 0, 0, 0, 0, 0, 
-    0, 0, 105, 109, 112, 111, 114, 116, 108, 105, 
-    98, 46, 109, 101, 116, 97, 100, 97, 116, 97, 
-    18, 0, 0, 0, 0, 0, 0, 0, 77, 101, 
-    116, 97, 100, 97, 116, 97, 80, 97, 116, 104, 
-    70, 105, 110, 100, 101, 114, 0, 0, 0, 0, 
-    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
-    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    99, 108, 115, 4, 0, 0, 0, 0, 0, 0, 
-    0, 97, 114, 103, 115, 6, 0, 0, 0, 0, 
-    0, 0, 0, 107, 119, 97, 114, 103, 115, 18, 
-    0, 0, 0, 0, 0, 0, 0, 77, 101, 116, 
-    97, 100, 97, 116, 97, 80, 97, 116, 104, 70, 
-    105, 110, 100, 101, 114, 32, 0, 0, 0, 0, 
+    105, 111, 110, 115, 3, 0, 0, 0, 0, 0, 
+    0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 
+    102, 105, 110, 100, 95, 100, 105, 115, 116, 114, 
+    105, 98, 117, 116, 105, 111, 110, 115, 18, 0, 
+    0, 0, 0, 0, 0, 0, 105, 109, 112, 111, 
+    114, 116, 108, 105, 98, 46, 109, 101, 116, 97, 
+    100, 97, 116, 97, 18, 0, 0, 0, 0, 0, 
+    0, 0, 77, 101, 116, 97, 100, 97, 116, 97, 
+    80, 97, 116, 104, 70, 105, 110, 100, 101, 114, 
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+    0, 0, 0, 0, 99, 108, 115, 4, 0, 0, 
+    0, 0, 0, 0, 0, 97, 114, 103, 115, 6, 
+    0, 0, 0, 0, 0, 0, 0, 107, 119, 97, 
+    114, 103, 115, 18, 0, 0, 0, 0, 0, 0, 
+    0, 77, 101, 116, 97, 100, 97, 116, 97, 80, 
+    97, 116, 104, 70, 105, 110, 100, 101, 114, 32, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 70, 105, 108, 101, 70, 105, 110, 100, 101, 
+    114, 46, 105, 110, 118, 97, 108, 105, 100, 97, 
+    116, 101, 95, 99, 97, 99, 104, 101, 115, 46, 
+    49, 52, 57, 48, 58, 52, 0, 7, 0, 0, 
+    0, 0, 0, 0, 0, 30, 0, 0, 30, 1, 
+    1, 49, 0, 1, 1, 32, 2, 0, 43, 2, 
+    0, 0, 30, 1, 2, 41, 1, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 55, 
-    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
-    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
-    116, 101, 114, 110, 97, 108, 46, 70, 105, 108, 
-    101, 70, 105, 110, 100, 101, 114, 46, 105, 110, 
-    118, 97, 108, 105, 100, 97, 116, 101, 95, 99, 
-    97, 99, 104, 101, 115, 46, 49, 52, 57, 48, 
-    58, 52, 0, 7, 0, 0, 0, 0, 0, 0, 
-    0, 30, 0, 0, 30, 1, 1, 49, 0, 1, 
-    1, 32, 2, 0, 43, 2, 0, 0, 30, 1, 
-    2, 41, 1, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
-    0, 0, 0, 0, 0, 2, 31, 0, 0, 0, 
-    0, 0, 0, 0, 73, 110, 118, 97, 108, 105, 
-    100, 97, 116, 101, 32, 116, 104, 101, 32, 100, 
-    105, 114, 101, 99, 116, 111, 114, 121, 32, 109, 
-    116, 105, 109, 101, 46, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 2, 31, 0, 
+    0, 0, 0, 0, 0, 0, 73, 110, 118, 97, 
+    108, 105, 100, 97, 116, 101, 32, 116, 104, 101, 
+    32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 
+    32, 109, 116, 105, 109, 101, 46, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
+    0, 0, 0, 0, 105, 110, 118, 97, 108, 105, 
+    100, 97, 116, 101, 95, 99, 97, 99, 104, 101, 
+    115, 1, 0, 0, 0, 0, 0, 0, 0, 11, 
+    0, 0, 0, 0, 0, 0, 0, 95, 112, 97, 
+    116, 104, 95, 109, 116, 105, 109, 101, 0, 0, 
     0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
-    0, 0, 105, 110, 118, 97, 108, 105, 100, 97, 
-    116, 101, 95, 99, 97, 99, 104, 101, 115, 1, 
-    0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 
-    0, 0, 0, 0, 0, 95, 112, 97, 116, 104, 
-    95, 109, 116, 105, 109, 101, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 32, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 115, 101, 108, 102, 33, 0, 0, 0, 
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
+    49, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 70, 105, 
+    108, 101, 70, 105, 110, 100, 101, 114, 46, 102, 
+    105, 110, 100, 95, 108, 111, 97, 100, 101, 114, 
+    46, 49, 52, 57, 54, 58, 52, 0, 33, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 32, 
+    1, 0, 34, 2, 1, 0, 1, 32, 32, 3, 
+    1, 38, 2, 32, 1, 0, 0, 0, 0, 0, 
     0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
-    8, 0, 0, 0, 0, 0, 0, 0, 49, 0, 
-    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
-    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
-    101, 114, 110, 97, 108, 46, 70, 105, 108, 101, 
-    70, 105, 110, 100, 101, 114, 46, 102, 105, 110, 
-    100, 95, 108, 111, 97, 100, 101, 114, 46, 49, 
-    52, 57, 54, 58, 52, 0, 35, 0, 0, 0, 
-    0, 0, 0, 0, 30, 0, 0, 32, 1, 0, 
-    34, 2, 1, 0, 32, 3, 1, 74, 3, 10, 
-    2, 1, 0, 75, 1, 0, 45, 2, 0, 32, 
-    2, 2, 30, 0, 1, 6, 1, 2, 0, 6, 
-    79, 3, 1, 22, 1, 14, 0, 0, 0, 32, 
-    0, 2, 27, 1, 0, 1, 32, 2, 2, 27, 
-    0, 2, 2, 79, 3, 0, 22, 0, 2, 0, 
-    0, 0, 3, 0, 0, 17, 0, 0, 0, 0, 
-    74, 1, 74, 0, 4, 2, 2, 75, 1, 2, 
-    75, 1, 0, 41, 2, 30, 0, 1, 3, 1, 
-    0, 74, 0, 74, 1, 4, 2, 2, 75, 1, 
-    152, 75, 1, 67, 41, 2, 0, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 
+    2, 0, 32, 2, 2, 30, 0, 1, 6, 1, 
+    2, 0, 6, 79, 3, 1, 22, 1, 14, 0, 
+    0, 0, 32, 0, 2, 27, 1, 0, 1, 32, 
+    2, 2, 27, 0, 2, 2, 79, 3, 0, 22, 
+    0, 2, 0, 0, 0, 3, 0, 0, 17, 0, 
+    0, 0, 0, 74, 1, 74, 0, 4, 2, 2, 
+    75, 1, 2, 75, 1, 0, 41, 2, 30, 0, 
+    1, 3, 1, 0, 74, 0, 74, 1, 4, 2, 
+    2, 75, 1, 152, 75, 1, 67, 41, 2, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 2, 197, 
-    0, 0, 0, 0, 0, 0, 0, 84, 114, 121, 
-    32, 116, 111, 32, 102, 105, 110, 100, 32, 97, 
-    32, 108, 111, 97, 100, 101, 114, 32, 102, 111, 
-    114, 32, 116, 104, 101, 32, 115, 112, 101, 99, 
-    105, 102, 105, 101, 100, 32, 109, 111, 100, 117, 
-    108, 101, 44, 32, 111, 114, 32, 116, 104, 101, 
-    32, 110, 97, 109, 101, 115, 112, 97, 99, 101, 
-    10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 
-    97, 99, 107, 97, 103, 101, 32, 112, 111, 114, 
-    116, 105, 111, 110, 115, 46, 32, 82, 101, 116, 
-    117, 114, 110, 115, 32, 40, 108, 111, 97, 100, 
-    101, 114, 44, 32, 108, 105, 115, 116, 45, 111, 
-    102, 45, 112, 111, 114, 116, 105, 111, 110, 115, 
-    41, 46, 10, 10, 32, 32, 32, 32, 32, 32, 
-    32, 32, 84, 104, 105, 115, 32, 109, 101, 116, 
-    104, 111, 100, 32, 105, 115, 32, 100, 101, 112, 
-    114, 101, 99, 97, 116, 101, 100, 46, 32, 32, 
-    85, 115, 101, 32, 102, 105, 110, 100, 95, 115, 
-    112, 101, 99, 40, 41, 32, 105, 110, 115, 116, 
-    101, 97, 100, 46, 10, 10, 32, 32, 32, 32, 
-    32, 32, 32, 32, 5, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    197, 0, 0, 0, 0, 0, 0, 0, 84, 114, 
+    121, 32, 116, 111, 32, 102, 105, 110, 100, 32, 
+    97, 32, 108, 111, 97, 100, 101, 114, 32, 102, 
+    111, 114, 32, 116, 104, 101, 32, 115, 112, 101, 
+    99, 105, 102, 105, 101, 100, 32, 109, 111, 100, 
+    117, 108, 101, 44, 32, 111, 114, 32, 116, 104, 
+    101, 32, 110, 97, 109, 101, 115, 112, 97, 99, 
+    101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+    112, 97, 99, 107, 97, 103, 101, 32, 112, 111, 
+    114, 116, 105, 111, 110, 115, 46, 32, 82, 101, 
+    116, 117, 114, 110, 115, 32, 40, 108, 111, 97, 
+    100, 101, 114, 44, 32, 108, 105, 115, 116, 45, 
+    111, 102, 45, 112, 111, 114, 116, 105, 111, 110, 
+    115, 41, 46, 10, 10, 32, 32, 32, 32, 32, 
+    32, 32, 32, 84, 104, 105, 115, 32, 109, 101, 
+    116, 104, 111, 100, 32, 105, 115, 32, 100, 101, 
+    112, 114, 101, 99, 97, 116, 101, 100, 46, 32, 
+    32, 85, 115, 101, 32, 102, 105, 110, 100, 95, 
+    115, 112, 101, 99, 40, 41, 32, 105, 110, 115, 
+    116, 101, 97, 100, 46, 10, 10, 32, 32, 32, 
+    32, 32, 32, 32, 32, 5, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 
-    0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 
-    0, 0, 102, 105, 110, 100, 95, 108, 111, 97, 
-    100, 101, 114, 3, 0, 0, 0, 0, 0, 0, 
-    0, 9, 0, 0, 0, 0, 0, 0, 0, 102, 
-    105, 110, 100, 95, 115, 112, 101, 99, 6, 0, 
-    0, 0, 0, 0, 0, 0, 108, 111, 97, 100, 
-    101, 114, 26, 0, 0, 0, 0, 0, 0, 0, 
-    115, 117, 98, 109, 111, 100, 117, 108, 101, 95, 
-    115, 101, 97, 114, 99, 104, 95, 108, 111, 99, 
-    97, 116, 105, 111, 110, 115, 0, 0, 0, 0, 
-    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 108, 102, 8, 0, 0, 0, 0, 0, 
-    0, 0, 102, 117, 108, 108, 110, 97, 109, 101, 
-    4, 0, 0, 0, 0, 0, 0, 0, 115, 112, 
-    101, 99, 32, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 70, 105, 108, 101, 70, 105, 
-    110, 100, 101, 114, 46, 112, 97, 116, 104, 95, 
-    104, 111, 111, 107, 46, 112, 97, 116, 104, 95, 
-    104, 111, 111, 107, 95, 102, 111, 114, 95, 70, 
-    105, 108, 101, 70, 105, 110, 100, 101, 114, 46, 
-    49, 54, 48, 53, 58, 56, 0, 25, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
-    0, 32, 2, 0, 74, 2, 10, 1, 1, 0, 
-    75, 1, 0, 49, 3, 0, 3, 79, 1, 3, 
-    19, 3, 5, 0, 0, 0, 33, 1, 1, 30, 
-    2, 1, 32, 3, 0, 12, 1, 1, 0, 0, 
-    0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 
-    0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 
-    0, 0, 0, 2, 40, 1, 0, 31, 1, 0, 
-    32, 0, 0, 31, 2, 1, 3, 3, 0, 58, 
-    3, 0, 24, 3, 2, 25, 4, 3, 30, 0, 
-    2, 2, 2, 0, 11, 1, 4, 0, 1, 0, 
-    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
-    0, 0, 0, 0, 2, 45, 0, 0, 0, 0, 
-    0, 0, 0, 80, 97, 116, 104, 32, 104, 111, 
-    111, 107, 32, 102, 111, 114, 32, 105, 109, 112, 
-    111, 114, 116, 108, 105, 98, 46, 109, 97, 99, 
-    104, 105, 110, 101, 114, 121, 46, 70, 105, 108, 
-    101, 70, 105, 110, 100, 101, 114, 46, 2, 30, 
-    0, 0, 0, 0, 0, 0, 0, 111, 110, 108, 
-    121, 32, 100, 105, 114, 101, 99, 116, 111, 114, 
-    105, 101, 115, 32, 97, 114, 101, 32, 115, 117, 
-    112, 112, 111, 114, 116, 101, 100, 5, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 99, 108, 115, 14, 0, 0, 0, 0, 0, 
-    0, 0, 108, 111, 97, 100, 101, 114, 95, 100, 
-    101, 116, 97, 105, 108, 115, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 
+    0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 
+    0, 0, 0, 102, 105, 110, 100, 95, 108, 111, 
+    97, 100, 101, 114, 3, 0, 0, 0, 0, 0, 
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 
+    102, 105, 110, 100, 95, 115, 112, 101, 99, 6, 
+    0, 0, 0, 0, 0, 0, 0, 108, 111, 97, 
+    100, 101, 114, 26, 0, 0, 0, 0, 0, 0, 
+    0, 115, 117, 98, 109, 111, 100, 117, 108, 101, 
+    95, 115, 101, 97, 114, 99, 104, 95, 108, 111, 
+    99, 97, 116, 105, 111, 110, 115, 0, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
+    0, 115, 101, 108, 102, 8, 0, 0, 0, 0, 
+    0, 0, 0, 102, 117, 108, 108, 110, 97, 109, 
+    101, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+    112, 101, 99, 32, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
+    114, 110, 97, 108, 46, 70, 105, 108, 101, 70, 
+    105, 110, 100, 101, 114, 46, 112, 97, 116, 104, 
+    95, 104, 111, 111, 107, 46, 112, 97, 116, 104, 
+    95, 104, 111, 111, 107, 95, 102, 111, 114, 95, 
+    70, 105, 108, 101, 70, 105, 110, 100, 101, 114, 
+    46, 49, 54, 48, 53, 58, 56, 0, 25, 0, 
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 33, 
+    1, 0, 32, 2, 0, 74, 2, 10, 1, 1, 
+    0, 75, 1, 0, 49, 3, 0, 3, 79, 1, 
+    3, 19, 3, 5, 0, 0, 0, 33, 1, 1, 
+    30, 2, 1, 32, 3, 0, 12, 1, 1, 0, 
+    0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 
+    0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 
+    0, 0, 0, 0, 2, 40, 1, 0, 31, 1, 
+    0, 32, 0, 0, 31, 2, 1, 3, 3, 0, 
+    58, 3, 0, 24, 3, 2, 25, 4, 3, 30, 
+    0, 2, 2, 2, 0, 11, 1, 4, 0, 1, 
+    0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+    0, 0, 0, 2, 45, 0, 0, 0, 0, 0, 
+    0, 0, 80, 97, 116, 104, 32, 104, 111, 111, 
+    107, 32, 102, 111, 114, 32, 105, 109, 112, 111, 
+    114, 116, 108, 105, 98, 46, 109, 97, 99, 104, 
+    105, 110, 101, 114, 121, 46, 70, 105, 108, 101, 
+    70, 105, 110, 100, 101, 114, 46, 2, 30, 0, 
+    0, 0, 0, 0, 0, 0, 111, 110, 108, 121, 
+    32, 100, 105, 114, 101, 99, 116, 111, 114, 105, 
+    101, 115, 32, 97, 114, 101, 32, 115, 117, 112, 
+    112, 111, 114, 116, 101, 100, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    24, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 95, 104, 111, 111, 107, 95, 102, 111, 
-    114, 95, 70, 105, 108, 101, 70, 105, 110, 100, 
-    101, 114, 3, 0, 0, 0, 0, 0, 0, 0, 
-    11, 0, 0, 0, 0, 0, 0, 0, 95, 112, 
-    97, 116, 104, 95, 105, 115, 100, 105, 114, 11, 
-    0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 
-    111, 114, 116, 69, 114, 114, 111, 114, 4, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
-    0, 0, 0, 0, 112, 97, 116, 104, 32, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
     0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    95, 112, 97, 116, 104, 95, 115, 116, 97, 116, 
-    46, 49, 51, 52, 58, 48, 0, 8, 0, 0, 
-    0, 0, 0, 0, 0, 30, 0, 0, 33, 1, 
-    0, 34, 2, 1, 1, 32, 3, 0, 74, 3, 
-    10, 2, 1, 0, 75, 1, 0, 41, 0, 0, 
+    0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+    99, 108, 115, 14, 0, 0, 0, 0, 0, 0, 
+    0, 108, 111, 97, 100, 101, 114, 95, 100, 101, 
+    116, 97, 105, 108, 115, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 24, 
+    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
+    104, 95, 104, 111, 111, 107, 95, 102, 111, 114, 
+    95, 70, 105, 108, 101, 70, 105, 110, 100, 101, 
+    114, 3, 0, 0, 0, 0, 0, 0, 0, 11, 
+    0, 0, 0, 0, 0, 0, 0, 95, 112, 97, 
+    116, 104, 95, 105, 115, 100, 105, 114, 11, 0, 
+    0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 
+    114, 116, 69, 114, 114, 111, 114, 4, 0, 0, 
+    0, 0, 0, 0, 0, 112, 97, 116, 104, 0, 
     0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 
+    0, 0, 0, 112, 97, 116, 104, 33, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 36, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
+    112, 97, 116, 104, 95, 115, 116, 97, 116, 46, 
+    49, 51, 52, 58, 48, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 33, 1, 0, 
+    34, 2, 1, 1, 1, 32, 32, 3, 0, 38, 
+    2, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 2, 126, 0, 0, 0, 0, 0, 0, 0, 
-    83, 116, 97, 116, 32, 116, 104, 101, 32, 112, 
-    97, 116, 104, 46, 10, 10, 32, 32, 32, 32, 
-    77, 97, 100, 101, 32, 97, 32, 115, 101, 112, 
-    97, 114, 97, 116, 101, 32, 102, 117, 110, 99, 
-    116, 105, 111, 110, 32, 116, 111, 32, 109, 97, 
-    107, 101, 32, 105, 116, 32, 101, 97, 115, 105, 
-    101, 114, 32, 116, 111, 32, 111, 118, 101, 114, 
-    114, 105, 100, 101, 32, 105, 110, 32, 101, 120, 
-    112, 101, 114, 105, 109, 101, 110, 116, 115, 10, 
-    32, 32, 32, 32, 40, 101, 46, 103, 46, 32, 
-    99, 97, 99, 104, 101, 32, 115, 116, 97, 116, 
-    32, 114, 101, 115, 117, 108, 116, 115, 41, 46, 
-    10, 10, 32, 32, 32, 32, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    126, 0, 0, 0, 0, 0, 0, 0, 83, 116, 
+    97, 116, 32, 116, 104, 101, 32, 112, 97, 116, 
+    104, 46, 10, 10, 32, 32, 32, 32, 77, 97, 
+    100, 101, 32, 97, 32, 115, 101, 112, 97, 114, 
+    97, 116, 101, 32, 102, 117, 110, 99, 116, 105, 
+    111, 110, 32, 116, 111, 32, 109, 97, 107, 101, 
+    32, 105, 116, 32, 101, 97, 115, 105, 101, 114, 
+    32, 116, 111, 32, 111, 118, 101, 114, 114, 105, 
+    100, 101, 32, 105, 110, 32, 101, 120, 112, 101, 
+    114, 105, 109, 101, 110, 116, 115, 10, 32, 32, 
+    32, 32, 40, 101, 46, 103, 46, 32, 99, 97, 
+    99, 104, 101, 32, 115, 116, 97, 116, 32, 114, 
+    101, 115, 117, 108, 116, 115, 41, 46, 10, 10, 
+    32, 32, 32, 32, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+    0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 
+    0, 95, 112, 97, 116, 104, 95, 115, 116, 97, 
+    116, 2, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 0, 0, 0, 0, 0, 0, 95, 111, 115, 
+    4, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+    97, 116, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
+    34, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
+    0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 
+    0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 95, 115, 101, 116, 117, 112, 46, 49, 
+    54, 53, 51, 58, 48, 0, 18, 1, 0, 0, 
+    0, 0, 0, 0, 30, 0, 0, 32, 1, 0, 
+    46, 0, 1, 33, 2, 0, 27, 0, 2, 1, 
+    46, 1, 0, 33, 2, 0, 27, 0, 2, 2, 
+    46, 2, 0, 33, 2, 1, 27, 0, 2, 17, 
+    33, 1, 3, 1, 2, 0, 1, 45, 1, 2, 
+    30, 0, 1, 30, 1, 2, 74, 1, 3, 2, 
+    1, 75, 1, 0, 74, 0, 74, 2, 4, 3, 
+    2, 75, 1, 0, 75, 1, 0, 30, 1, 3, 
+    30, 0, 4, 30, 2, 2, 74, 0, 74, 2, 
+    3, 4, 2, 75, 1, 236, 75, 1, 236, 74, 
+    1, 74, 4, 4, 5, 2, 75, 1, 126, 75, 
+    1, 120, 74, 3, 74, 5, 4, 0, 2, 75, 
+    1, 72, 75, 1, 231, 45, 2, 0, 32, 2, 
+    2, 13, 0, 2, 17, 0, 0, 0, 0, 9, 
+    1, 0, 44, 0, 0, 0, 0, 0, 0, 0, 
+    50, 2, 0, 0, 0, 0, 0, 0, 0, 2, 
+    3, 1, 45, 5, 2, 45, 3, 3, 17, 0, 
+    0, 0, 0, 33, 2, 4, 30, 3, 5, 36, 
+    4, 3, 0, 0, 0, 0, 32, 5, 3, 74, 
+    0, 74, 5, 10, 4, 1, 0, 75, 1, 128, 
+    39, 3, 0, 75, 0, 0, 74, 0, 74, 3, 
+    10, 2, 1, 0, 75, 1, 0, 39, 6, 0, 
+    75, 0, 0, 79, 4, 6, 22, 6, 6, 0, 
+    0, 0, 26, 2, 74, 0, 10, 2, 0, 0, 
+    39, 3, 0, 75, 0, 0, 40, 1, 3, 32, 
+    2, 3, 30, 3, 6, 1, 4, 2, 3, 45, 
+    4, 4, 32, 2, 5, 33, 3, 1, 27, 4, 
+    3, 17, 6, 5, 2, 4, 8, 79, 3, 5, 
+    22, 5, 20, 0, 0, 0, 17, 12, 0, 0, 
+    0, 33, 2, 5, 21, 2, 9, 0, 0, 0, 
+    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    9, 1, 0, 0, 0, 0, 0, 212, 255, 255, 
+    255, 33, 2, 5, 30, 1, 7, 74, 1, 10, 
+    2, 1, 0, 75, 1, 199, 40, 1, 0, 52, 
+    33, 0, 0, 34, 1, 0, 11, 1, 32, 32, 
+    2, 5, 38, 1, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    45, 6, 0, 17, 0, 0, 0, 0, 17, 7, 
+    0, 0, 0, 33, 0, 1, 27, 1, 0, 17, 
+    32, 2, 5, 1, 0, 1, 2, 45, 6, 0, 
+    17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 
+    33, 1, 6, 32, 2, 1, 30, 3, 8, 32, 
+    4, 6, 74, 2, 74, 3, 74, 4, 10, 1, 
+    3, 0, 75, 1, 172, 75, 1, 173, 75, 1, 
+    76, 33, 5, 6, 32, 1, 1, 30, 2, 9, 
+    32, 3, 4, 74, 1, 74, 2, 74, 3, 10, 
+    5, 3, 0, 75, 1, 108, 75, 1, 173, 75, 
+    1, 0, 33, 4, 6, 32, 1, 1, 30, 2, 
+    10, 30, 0, 11, 34, 3, 0, 12, 1, 32, 
+    32, 5, 3, 38, 3, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 74, 0, 74, 1, 74, 2, 74, 0, 10, 
+    4, 3, 0, 75, 1, 63, 75, 1, 173, 75, 
+    1, 0, 39, 6, 0, 75, 0, 0, 33, 3, 
+    6, 32, 1, 1, 30, 2, 12, 30, 0, 13, 
+    36, 4, 0, 0, 0, 0, 0, 32, 5, 3, 
+    74, 5, 10, 4, 1, 0, 75, 1, 173, 74, 
+    0, 38, 3, 32, 3, 0, 0, 0, 0, 0, 
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 39, 6, 0, 75, 0, 0, 30, 4, 14, 
+    30, 0, 15, 30, 1, 16, 74, 4, 74, 0, 
+    74, 1, 3, 2, 3, 75, 1, 173, 75, 1, 
+    173, 75, 1, 0, 45, 7, 2, 32, 0, 5, 
+    30, 1, 3, 6, 2, 0, 1, 0, 79, 3, 
+    2, 19, 2, 5, 0, 0, 0, 32, 0, 7, 
+    34, 1, 0, 13, 1, 32, 30, 2, 17, 38, 
+    1, 32, 1, 0, 0, 0, 0, 0, 0, 0, 
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 
+    0, 0, 32, 0, 7, 13, 1, 0, 17, 0, 
+    0, 0, 0, 9, 0, 1, 39, 0, 0, 0, 
+    0, 0, 0, 0, 45, 8, 0, 17, 0, 0, 
+    0, 0, 32, 2, 8, 33, 3, 1, 27, 4, 
+    3, 17, 6, 5, 2, 4, 9, 79, 3, 5, 
+    22, 5, 6, 0, 0, 0, 33, 2, 1, 27, 
+    3, 2, 17, 32, 4, 8, 1, 2, 3, 4, 
+    45, 9, 2, 17, 9, 0, 0, 0, 33, 2, 
+    0, 34, 3, 2, 11, 1, 32, 32, 4, 8, 
+    74, 0, 38, 3, 32, 1, 0, 0, 0, 0, 
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
-    0, 0, 0, 95, 112, 97, 116, 104, 95, 115, 
-    116, 97, 116, 2, 0, 0, 0, 0, 0, 0, 
-    0, 3, 0, 0, 0, 0, 0, 0, 0, 95, 
-    111, 115, 4, 0, 0, 0, 0, 0, 0, 0, 
-    115, 116, 97, 116, 0, 0, 0, 0, 0, 0, 
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 32, 0, 0, 0, 0, 0, 0, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 59, 0, 
-    0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 95, 115, 101, 116, 117, 112, 
-    46, 49, 54, 53, 51, 58, 48, 0, 37, 1, 
-    0, 0, 0, 0, 0, 0, 30, 0, 0, 32, 
-    1, 0, 46, 0, 1, 33, 2, 0, 27, 0, 
-    2, 1, 46, 1, 0, 33, 2, 0, 27, 0, 
-    2, 2, 46, 2, 0, 33, 2, 1, 27, 0, 
-    2, 17, 33, 1, 3, 1, 2, 0, 1, 45, 
-    1, 2, 30, 0, 1, 30, 1, 2, 74, 1, 
-    3, 2, 1, 75, 1, 0, 74, 0, 74, 2, 
-    4, 3, 2, 75, 1, 0, 75, 1, 0, 30, 
-    1, 3, 30, 0, 4, 30, 2, 2, 74, 0, 
-    74, 2, 3, 4, 2, 75, 1, 236, 75, 1, 
-    236, 74, 1, 74, 4, 4, 5, 2, 75, 1, 
-    126, 75, 1, 120, 74, 3, 74, 5, 4, 0, 
-    2, 75, 1, 72, 75, 1, 231, 45, 2, 0, 
-    32, 2, 2, 13, 0, 2, 17, 0, 0, 0, 
-    0, 9, 1, 0, 45, 0, 0, 0, 0, 0, 
-    0, 0, 50, 2, 0, 0, 0, 0, 0, 0, 
-    0, 2, 3, 1, 45, 5, 2, 45, 3, 3, 
-    17, 0, 0, 0, 0, 33, 2, 4, 30, 3, 
-    5, 36, 4, 3, 0, 0, 0, 0, 32, 5, 
-    3, 74, 0, 74, 5, 10, 4, 1, 0, 75, 
-    1, 128, 39, 3, 0, 75, 0, 0, 74, 0, 
-    74, 3, 10, 2, 1, 0, 75, 1, 0, 39, 
-    6, 0, 75, 0, 0, 79, 4, 6, 22, 6, 
-    6, 0, 0, 0, 26, 2, 74, 0, 10, 2, 
-    0, 0, 39, 3, 0, 75, 0, 0, 40, 1, 
-    3, 32, 2, 3, 30, 3, 6, 1, 4, 2, 
-    3, 45, 4, 4, 32, 2, 5, 33, 3, 1, 
-    27, 4, 3, 17, 6, 5, 2, 4, 8, 79, 
-    3, 5, 22, 5, 23, 0, 0, 0, 42, 1, 
-    0, 0, 0, 17, 12, 0, 0, 0, 33, 2, 
-    5, 21, 2, 9, 0, 0, 0, 17, 0, 0, 
-    0, 0, 17, 0, 0, 0, 0, 9, 1, 0, 
-    0, 0, 0, 0, 211, 255, 255, 255, 33, 2, 
-    5, 30, 1, 7, 74, 1, 10, 2, 1, 0, 
-    75, 1, 199, 40, 1, 0, 52, 33, 0, 0, 
-    34, 1, 0, 11, 32, 2, 5, 74, 2, 10, 
-    1, 1, 0, 75, 1, 173, 45, 6, 0, 17, 
-    0, 0, 0, 0, 17, 7, 0, 0, 0, 33, 
-    0, 1, 27, 1, 0, 17, 32, 2, 5, 1, 
-    0, 1, 2, 45, 6, 0, 17, 0, 0, 0, 
-    0, 17, 0, 0, 0, 0, 33, 1, 6, 32, 
-    2, 1, 30, 3, 8, 32, 4, 6, 74, 2, 
-    74, 3, 74, 4, 10, 1, 3, 0, 75, 1, 
-    172, 75, 1, 173, 75, 1, 76, 33, 5, 6, 
-    32, 1, 1, 30, 2, 9, 32, 3, 4, 74, 
-    1, 74, 2, 74, 3, 10, 5, 3, 0, 75, 
-    1, 108, 75, 1, 173, 75, 1, 0, 33, 4, 
-    6, 32, 1, 1, 30, 2, 10, 30, 0, 11, 
-    34, 3, 0, 12, 32, 5, 3, 74, 5, 10, 
-    3, 1, 0, 75, 1, 173, 74, 0, 74, 1, 
-    74, 2, 74, 0, 10, 4, 3, 0, 75, 1, 
-    63, 75, 1, 173, 75, 1, 0, 39, 6, 0, 
-    75, 0, 0, 33, 3, 6, 32, 1, 1, 30, 
-    2, 12, 30, 0, 13, 36, 4, 0, 0, 0, 
-    0, 0, 32, 5, 3, 74, 5, 10, 4, 1, 
-    0, 75, 1, 173, 74, 0, 74, 1, 74, 2, 
-    74, 0, 10, 3, 3, 0, 75, 1, 253, 75, 
-    1, 173, 75, 1, 0, 39, 6, 0, 75, 0, 
-    0, 30, 4, 14, 30, 0, 15, 30, 1, 16, 
-    74, 4, 74, 0, 74, 1, 3, 2, 3, 75, 
-    1, 173, 75, 1, 173, 75, 1, 0, 45, 7, 
-    2, 32, 0, 5, 30, 1, 3, 6, 2, 0, 
-    1, 0, 79, 3, 2, 19, 2, 7, 0, 0, 
-    0, 32, 0, 7, 34, 1, 0, 13, 30, 2, 
-    17, 74, 2, 10, 1, 1, 0, 75, 1, 173, 
-    17, 0, 0, 0, 0, 32, 0, 7, 13, 1, 
-    0, 17, 0, 0, 0, 0, 9, 0, 1, 41, 
-    0, 0, 0, 0, 0, 0, 0, 45, 8, 0, 
-    17, 0, 0, 0, 0, 32, 2, 8, 33, 3, 
-    1, 27, 4, 3, 17, 6, 5, 2, 4, 9, 
-    79, 3, 5, 22, 5, 6, 0, 0, 0, 33, 
-    2, 1, 27, 3, 2, 17, 32, 4, 8, 1, 
-    2, 3, 4, 45, 9, 2, 17, 11, 0, 0, 
-    0, 33, 2, 0, 34, 3, 2, 11, 32, 4, 
-    8, 74, 0, 74, 4, 10, 3, 1, 0, 75, 
-    1, 172, 39, 2, 0, 75, 0, 0, 45, 9, 
-    2, 17, 0, 0, 0, 0, 33, 2, 6, 32, 
-    3, 1, 32, 4, 8, 32, 5, 9, 74, 0, 
-    74, 3, 74, 4, 74, 5, 10, 2, 3, 0, 
-    75, 1, 173, 75, 1, 96, 75, 1, 172, 39, 
-    6, 0, 75, 0, 0, 17, 0, 0, 0, 0, 
-    9, 0, 1, 0, 0, 0, 0, 215, 255, 255, 
-    255, 17, 0, 0, 0, 0, 33, 1, 6, 32, 
-    2, 1, 30, 3, 18, 33, 4, 7, 10, 4, 
-    0, 0, 74, 0, 74, 2, 74, 3, 74, 0, 
-    10, 1, 3, 0, 75, 1, 76, 75, 1, 172, 
-    75, 1, 172, 39, 5, 0, 75, 0, 0, 33, 
-    4, 8, 34, 1, 4, 14, 33, 2, 2, 34, 
-    3, 2, 15, 10, 3, 0, 0, 74, 0, 74, 
-    0, 10, 1, 1, 0, 75, 1, 172, 39, 2, 
-    0, 75, 0, 0, 32, 3, 5, 30, 0, 3, 
-    6, 1, 3, 0, 0, 79, 2, 1, 19, 1, 
-    16, 0, 0, 0, 33, 0, 9, 34, 1, 0, 
-    13, 30, 2, 19, 74, 2, 10, 1, 1, 0, 
-    75, 1, 172, 30, 3, 20, 33, 0, 8, 6, 
-    1, 3, 0, 8, 79, 2, 1, 19, 1, 4, 
-    0, 0, 0, 30, 0, 21, 33, 1, 10, 43, 
-    1, 0, 16, 17, 0, 0, 0, 0, 17, 0, 
-    0, 0, 0, 30, 0, 22, 41, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    39, 2, 0, 75, 0, 0, 45, 9, 2, 17, 
+    0, 0, 0, 0, 33, 2, 6, 32, 3, 1, 
+    32, 4, 8, 32, 5, 9, 74, 0, 74, 3, 
+    74, 4, 74, 5, 10, 2, 3, 0, 75, 1, 
+    173, 75, 1, 96, 75, 1, 172, 39, 6, 0, 
+    75, 0, 0, 17, 0, 0, 0, 0, 9, 0, 
+    1, 0, 0, 0, 0, 217, 255, 255, 255, 17, 
+    0, 0, 0, 0, 33, 1, 6, 32, 2, 1, 
+    30, 3, 18, 33, 4, 7, 10, 4, 0, 0, 
+    74, 0, 74, 2, 74, 3, 74, 0, 10, 1, 
+    3, 0, 75, 1, 76, 75, 1, 172, 75, 1, 
+    172, 39, 5, 0, 75, 0, 0, 33, 4, 8, 
+    34, 1, 4, 14, 1, 32, 33, 2, 2, 34, 
+    3, 2, 15, 1, 33, 38, 3, 33, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 74, 0, 38, 1, 32, 1, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 39, 2, 0, 75, 0, 0, 32, 3, 
+    5, 30, 0, 3, 6, 1, 3, 0, 0, 79, 
+    2, 1, 19, 1, 14, 0, 0, 0, 33, 0, 
+    9, 34, 1, 0, 13, 1, 32, 30, 2, 19, 
+    38, 1, 32, 1, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 30, 3, 
+    20, 33, 0, 8, 6, 1, 3, 0, 8, 79, 
+    2, 1, 19, 1, 4, 0, 0, 0, 30, 0, 
+    21, 33, 1, 10, 43, 1, 0, 16, 17, 0, 
+    0, 0, 0, 17, 0, 0, 0, 0, 30, 0, 
+    22, 41, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 85, 0, 0, 0, 0, 0, 0, 0, 86, 
+    0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 
+    0, 0, 0, 0, 0, 98, 0, 0, 0, 0, 
+    0, 0, 0, 105, 0, 0, 0, 0, 0, 0, 
+    0, 86, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 
-    2, 205, 0, 0, 0, 0, 0, 0, 0, 83, 
-    101, 116, 117, 112, 32, 116, 104, 101, 32, 112, 
-    97, 116, 104, 45, 98, 97, 115, 101, 100, 32, 
-    105, 109, 112, 111, 114, 116, 101, 114, 115, 32, 
-    102, 111, 114, 32, 105, 109, 112, 111, 114, 116, 
-    108, 105, 98, 32, 98, 121, 32, 105, 109, 112, 
-    111, 114, 116, 105, 110, 103, 32, 110, 101, 101, 
-    100, 101, 100, 10, 32, 32, 32, 32, 98, 117, 
-    105, 108, 116, 45, 105, 110, 32, 109, 111, 100, 
-    117, 108, 101, 115, 32, 97, 110, 100, 32, 105, 
-    110, 106, 101, 99, 116, 105, 110, 103, 32, 116, 
-    104, 101, 109, 32, 105, 110, 116, 111, 32, 116, 
-    104, 101, 32, 103, 108, 111, 98, 97, 108, 32, 
-    110, 97, 109, 101, 115, 112, 97, 99, 101, 46, 
-    10, 10, 32, 32, 32, 32, 79, 116, 104, 101, 
-    114, 32, 99, 111, 109, 112, 111, 110, 101, 110, 
-    116, 115, 32, 97, 114, 101, 32, 101, 120, 116, 
-    114, 97, 99, 116, 101, 100, 32, 102, 114, 111, 
-    109, 32, 116, 104, 101, 32, 99, 111, 114, 101, 
-    32, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    32, 109, 111, 100, 117, 108, 101, 46, 10, 10, 
-    32, 32, 32, 32, 2, 5, 0, 0, 0, 0, 
-    0, 0, 0, 112, 111, 115, 105, 120, 2, 1, 
-    0, 0, 0, 0, 0, 0, 0, 47, 2, 2, 
-    0, 0, 0, 0, 0, 0, 0, 110, 116, 2, 
-    1, 0, 0, 0, 0, 0, 0, 0, 92, 2, 
-    44, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 95, 115, 
-    101, 116, 117, 112, 46, 60, 103, 101, 110, 101, 
-    120, 112, 114, 62, 46, 49, 54, 55, 49, 58, 
-    49, 56, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 30, 0, 0, 0, 0, 0, 0, 0, 
-    105, 109, 112, 111, 114, 116, 108, 105, 98, 32, 
-    114, 101, 113, 117, 105, 114, 101, 115, 32, 112, 
-    111, 115, 105, 120, 32, 111, 114, 32, 110, 116, 
-    2, 3, 0, 0, 0, 0, 0, 0, 0, 95, 
-    111, 115, 2, 8, 0, 0, 0, 0, 0, 0, 
-    0, 112, 97, 116, 104, 95, 115, 101, 112, 2, 
-    15, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
-    116, 104, 95, 115, 101, 112, 97, 114, 97, 116, 
-    111, 114, 115, 2, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 20, 0, 0, 0, 0, 0, 0, 
-    0, 95, 112, 97, 116, 104, 115, 101, 112, 115, 
-    95, 119, 105, 116, 104, 95, 99, 111, 108, 111, 
-    110, 2, 44, 0, 0, 0, 0, 0, 0, 0, 
-    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
-    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
-    95, 115, 101, 116, 117, 112, 46, 60, 115, 101, 
-    116, 99, 111, 109, 112, 62, 46, 49, 54, 56, 
-    56, 58, 52, 57, 2, 3, 0, 0, 0, 0, 
-    0, 0, 0, 95, 105, 111, 2, 9, 0, 0, 
-    0, 0, 0, 0, 0, 95, 119, 97, 114, 110, 
-    105, 110, 103, 115, 2, 7, 0, 0, 0, 0, 
-    0, 0, 0, 109, 97, 114, 115, 104, 97, 108, 
-    2, 6, 0, 0, 0, 0, 0, 0, 0, 119, 
-    105, 110, 114, 101, 103, 2, 11, 0, 0, 0, 
-    0, 0, 0, 0, 95, 114, 101, 108, 97, 120, 
-    95, 99, 97, 115, 101, 2, 4, 0, 0, 0, 
-    0, 0, 0, 0, 46, 112, 121, 119, 2, 6, 
-    0, 0, 0, 0, 0, 0, 0, 95, 100, 46, 
-    112, 121, 100, 6, 1, 5, 0, 0, 0, 0, 
+    0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 
+    0, 2, 205, 0, 0, 0, 0, 0, 0, 0, 
+    83, 101, 116, 117, 112, 32, 116, 104, 101, 32, 
+    112, 97, 116, 104, 45, 98, 97, 115, 101, 100, 
+    32, 105, 109, 112, 111, 114, 116, 101, 114, 115, 
+    32, 102, 111, 114, 32, 105, 109, 112, 111, 114, 
+    116, 108, 105, 98, 32, 98, 121, 32, 105, 109, 
+    112, 111, 114, 116, 105, 110, 103, 32, 110, 101, 
+    101, 100, 101, 100, 10, 32, 32, 32, 32, 98, 
+    117, 105, 108, 116, 45, 105, 110, 32, 109, 111, 
+    100, 117, 108, 101, 115, 32, 97, 110, 100, 32, 
+    105, 110, 106, 101, 99, 116, 105, 110, 103, 32, 
+    116, 104, 101, 109, 32, 105, 110, 116, 111, 32, 
+    116, 104, 101, 32, 103, 108, 111, 98, 97, 108, 
+    32, 110, 97, 109, 101, 115, 112, 97, 99, 101, 
+    46, 10, 10, 32, 32, 32, 32, 79, 116, 104, 
+    101, 114, 32, 99, 111, 109, 112, 111, 110, 101, 
+    110, 116, 115, 32, 97, 114, 101, 32, 101, 120, 
+    116, 114, 97, 99, 116, 101, 100, 32, 102, 114, 
+    111, 109, 32, 116, 104, 101, 32, 99, 111, 114, 
+    101, 32, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 32, 109, 111, 100, 117, 108, 101, 46, 10, 
+    10, 32, 32, 32, 32, 2, 5, 0, 0, 0, 
+    0, 0, 0, 0, 112, 111, 115, 105, 120, 2, 
+    1, 0, 0, 0, 0, 0, 0, 0, 47, 2, 
+    2, 0, 0, 0, 0, 0, 0, 0, 110, 116, 
+    2, 1, 0, 0, 0, 0, 0, 0, 0, 92, 
+    2, 44, 0, 0, 0, 0, 0, 0, 0, 95, 
+    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
+    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
+    115, 101, 116, 117, 112, 46, 60, 103, 101, 110, 
+    101, 120, 112, 114, 62, 46, 49, 54, 55, 49, 
+    58, 49, 56, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 2, 30, 0, 0, 0, 0, 0, 0, 
+    0, 105, 109, 112, 111, 114, 116, 108, 105, 98, 
+    32, 114, 101, 113, 117, 105, 114, 101, 115, 32, 
+    112, 111, 115, 105, 120, 32, 111, 114, 32, 110, 
+    116, 2, 3, 0, 0, 0, 0, 0, 0, 0, 
+    95, 111, 115, 2, 8, 0, 0, 0, 0, 0, 
+    0, 0, 112, 97, 116, 104, 95, 115, 101, 112, 
+    2, 15, 0, 0, 0, 0, 0, 0, 0, 112, 
+    97, 116, 104, 95, 115, 101, 112, 97, 114, 97, 
+    116, 111, 114, 115, 2, 0, 0, 0, 0, 0, 
+    0, 0, 0, 2, 20, 0, 0, 0, 0, 0, 
+    0, 0, 95, 112, 97, 116, 104, 115, 101, 112, 
+    115, 95, 119, 105, 116, 104, 95, 99, 111, 108, 
+    111, 110, 2, 44, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 95, 115, 101, 116, 117, 112, 46, 60, 115, 
+    101, 116, 99, 111, 109, 112, 62, 46, 49, 54, 
+    56, 56, 58, 52, 57, 2, 3, 0, 0, 0, 
+    0, 0, 0, 0, 95, 105, 111, 2, 9, 0, 
+    0, 0, 0, 0, 0, 0, 95, 119, 97, 114, 
+    110, 105, 110, 103, 115, 2, 7, 0, 0, 0, 
+    0, 0, 0, 0, 109, 97, 114, 115, 104, 97, 
+    108, 2, 6, 0, 0, 0, 0, 0, 0, 0, 
+    119, 105, 110, 114, 101, 103, 2, 11, 0, 0, 
+    0, 0, 0, 0, 0, 95, 114, 101, 108, 97, 
+    120, 95, 99, 97, 115, 101, 2, 4, 0, 0, 
+    0, 0, 0, 0, 0, 46, 112, 121, 119, 2, 
+    6, 0, 0, 0, 0, 0, 0, 0, 95, 100, 
+    46, 112, 121, 100, 6, 1, 5, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 
-    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 
-    0, 0, 0, 95, 115, 101, 116, 117, 112, 18, 
-    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 3, 0, 0, 0, 0, 
-    0, 0, 0, 115, 121, 115, 4, 0, 0, 0, 
-    0, 0, 0, 0, 95, 105, 109, 112, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 110, 97, 
-    109, 101, 95, 95, 3, 0, 0, 0, 0, 0, 
-    0, 0, 97, 108, 108, 11, 0, 0, 0, 0, 
-    0, 0, 0, 73, 109, 112, 111, 114, 116, 69, 
-    114, 114, 111, 114, 7, 0, 0, 0, 0, 0, 
-    0, 0, 115, 101, 116, 97, 116, 116, 114, 16, 
-    0, 0, 0, 0, 0, 0, 0, 95, 109, 97, 
-    107, 101, 95, 114, 101, 108, 97, 120, 95, 99, 
-    97, 115, 101, 18, 0, 0, 0, 0, 0, 0, 
-    0, 69, 88, 84, 69, 78, 83, 73, 79, 78, 
-    95, 83, 85, 70, 70, 73, 88, 69, 83, 15, 
-    0, 0, 0, 0, 0, 0, 0, 83, 79, 85, 
-    82, 67, 69, 95, 83, 85, 70, 70, 73, 88, 
-    69, 83, 21, 0, 0, 0, 0, 0, 0, 0, 
-    87, 105, 110, 100, 111, 119, 115, 82, 101, 103, 
-    105, 115, 116, 114, 121, 70, 105, 110, 100, 101, 
-    114, 18, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 117, 105, 108, 116, 105, 110, 95, 102, 114, 
-    111, 109, 95, 110, 97, 109, 101, 4, 0, 0, 
-    0, 0, 0, 0, 0, 106, 111, 105, 110, 6, 
-    0, 0, 0, 0, 0, 0, 0, 97, 112, 112, 
-    101, 110, 100, 6, 0, 0, 0, 0, 0, 0, 
-    0, 101, 120, 116, 101, 110, 100, 18, 0, 0, 
-    0, 0, 0, 0, 0, 101, 120, 116, 101, 110, 
-    115, 105, 111, 110, 95, 115, 117, 102, 102, 105, 
-    120, 101, 115, 11, 0, 0, 0, 0, 0, 0, 
-    0, 68, 69, 66, 85, 71, 95, 66, 85, 73, 
-    76, 68, 7, 0, 0, 0, 0, 0, 0, 0, 
-    109, 111, 100, 117, 108, 101, 115, 0, 0, 0, 
-    0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 
-    0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 109, 111, 100, 117, 108, 101, 11, 0, 
-    0, 0, 0, 0, 0, 0, 115, 101, 108, 102, 
-    95, 109, 111, 100, 117, 108, 101, 10, 0, 0, 
-    0, 0, 0, 0, 0, 111, 115, 95, 100, 101, 
-    116, 97, 105, 108, 115, 15, 0, 0, 0, 0, 
-    0, 0, 0, 112, 97, 116, 104, 95, 115, 101, 
-    112, 97, 114, 97, 116, 111, 114, 115, 8, 0, 
-    0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    95, 115, 101, 112, 10, 0, 0, 0, 0, 0, 
-    0, 0, 98, 117, 105, 108, 116, 105, 110, 95, 
-    111, 115, 9, 0, 0, 0, 0, 0, 0, 0, 
-    111, 115, 95, 109, 111, 100, 117, 108, 101, 13, 
-    0, 0, 0, 0, 0, 0, 0, 98, 117, 105, 
-    108, 116, 105, 110, 95, 110, 97, 109, 101, 115, 
-    12, 0, 0, 0, 0, 0, 0, 0, 98, 117, 
+    0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
+    0, 0, 0, 0, 95, 115, 101, 116, 117, 112, 
+    18, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 3, 0, 0, 0, 
+    0, 0, 0, 0, 115, 121, 115, 4, 0, 0, 
+    0, 0, 0, 0, 0, 95, 105, 109, 112, 8, 
+    0, 0, 0, 0, 0, 0, 0, 95, 95, 110, 
+    97, 109, 101, 95, 95, 3, 0, 0, 0, 0, 
+    0, 0, 0, 97, 108, 108, 11, 0, 0, 0, 
+    0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 
+    69, 114, 114, 111, 114, 7, 0, 0, 0, 0, 
+    0, 0, 0, 115, 101, 116, 97, 116, 116, 114, 
+    16, 0, 0, 0, 0, 0, 0, 0, 95, 109, 
+    97, 107, 101, 95, 114, 101, 108, 97, 120, 95, 
+    99, 97, 115, 101, 18, 0, 0, 0, 0, 0, 
+    0, 0, 69, 88, 84, 69, 78, 83, 73, 79, 
+    78, 95, 83, 85, 70, 70, 73, 88, 69, 83, 
+    15, 0, 0, 0, 0, 0, 0, 0, 83, 79, 
+    85, 82, 67, 69, 95, 83, 85, 70, 70, 73, 
+    88, 69, 83, 21, 0, 0, 0, 0, 0, 0, 
+    0, 87, 105, 110, 100, 111, 119, 115, 82, 101, 
+    103, 105, 115, 116, 114, 121, 70, 105, 110, 100, 
+    101, 114, 18, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 117, 105, 108, 116, 105, 110, 95, 102, 
+    114, 111, 109, 95, 110, 97, 109, 101, 4, 0, 
+    0, 0, 0, 0, 0, 0, 106, 111, 105, 110, 
+    6, 0, 0, 0, 0, 0, 0, 0, 97, 112, 
+    112, 101, 110, 100, 6, 0, 0, 0, 0, 0, 
+    0, 0, 101, 120, 116, 101, 110, 100, 18, 0, 
+    0, 0, 0, 0, 0, 0, 101, 120, 116, 101, 
+    110, 115, 105, 111, 110, 95, 115, 117, 102, 102, 
+    105, 120, 101, 115, 11, 0, 0, 0, 0, 0, 
+    0, 0, 68, 69, 66, 85, 71, 95, 66, 85, 
+    73, 76, 68, 7, 0, 0, 0, 0, 0, 0, 
+    0, 109, 111, 100, 117, 108, 101, 115, 0, 0, 
+    0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 109, 111, 100, 117, 108, 101, 11, 
+    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
+    102, 95, 109, 111, 100, 117, 108, 101, 10, 0, 
+    0, 0, 0, 0, 0, 0, 111, 115, 95, 100, 
+    101, 116, 97, 105, 108, 115, 15, 0, 0, 0, 
+    0, 0, 0, 0, 112, 97, 116, 104, 95, 115, 
+    101, 112, 97, 114, 97, 116, 111, 114, 115, 8, 
+    0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 
+    104, 95, 115, 101, 112, 10, 0, 0, 0, 0, 
+    0, 0, 0, 98, 117, 105, 108, 116, 105, 110, 
+    95, 111, 115, 9, 0, 0, 0, 0, 0, 0, 
+    0, 111, 115, 95, 109, 111, 100, 117, 108, 101, 
+    13, 0, 0, 0, 0, 0, 0, 0, 98, 117, 
     105, 108, 116, 105, 110, 95, 110, 97, 109, 101, 
-    14, 0, 0, 0, 0, 0, 0, 0, 98, 117, 
-    105, 108, 116, 105, 110, 95, 109, 111, 100, 117, 
-    108, 101, 32, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
-    0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 
-    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
-    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
-    110, 97, 108, 46, 95, 112, 97, 116, 104, 95, 
-    105, 115, 97, 98, 115, 46, 49, 55, 52, 58, 
-    52, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
-    30, 0, 0, 32, 1, 0, 34, 2, 1, 1, 
-    33, 3, 0, 74, 3, 10, 2, 1, 0, 75, 
-    1, 0, 41, 0, 0, 0, 0, 0, 0, 0, 
+    115, 12, 0, 0, 0, 0, 0, 0, 0, 98, 
+    117, 105, 108, 116, 105, 110, 95, 110, 97, 109, 
+    101, 14, 0, 0, 0, 0, 0, 0, 0, 98, 
+    117, 105, 108, 116, 105, 110, 95, 109, 111, 100, 
+    117, 108, 101, 33, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 
+    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
+    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
+    114, 110, 97, 108, 46, 95, 112, 97, 116, 104, 
+    95, 105, 115, 97, 98, 115, 46, 49, 55, 52, 
+    58, 52, 0, 6, 0, 0, 0, 0, 0, 0, 
+    0, 30, 0, 0, 32, 1, 0, 34, 2, 1, 
+    1, 1, 32, 33, 3, 0, 38, 2, 32, 1, 
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
     0, 0, 0, 0, 0, 0, 2, 30, 0, 0, 
@@ -9542,7 +10196,7 @@ std::vector<uint8_t> _bootstrap_external
     116, 104, 0, 0, 0, 0, 0, 0, 0, 0, 
     1, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
     0, 0, 0, 0, 0, 0, 112, 97, 116, 104, 
-    32, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    33, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
     0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
     0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 
     0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
@@ -9550,203 +10204,208 @@ std::vector<uint8_t> _bootstrap_external
     108, 46, 95, 112, 97, 116, 104, 95, 106, 111, 
     105, 110, 46, 60, 108, 105, 115, 116, 99, 111, 
     109, 112, 62, 46, 49, 49, 51, 58, 49, 53, 
-    0, 24, 0, 0, 0, 0, 0, 0, 0, 3, 
+    0, 22, 0, 0, 0, 0, 0, 0, 0, 3, 
     1, 0, 32, 0, 0, 13, 2, 0, 17, 0, 
-    0, 0, 0, 9, 0, 2, 18, 0, 0, 0, 
+    0, 0, 0, 9, 0, 2, 16, 0, 0, 0, 
     0, 0, 0, 0, 45, 1, 0, 17, 0, 0, 
     0, 0, 32, 3, 1, 79, 4, 3, 22, 3, 
-    1, 0, 0, 0, 17, 11, 0, 0, 0, 32, 
-    3, 1, 34, 4, 3, 1, 33, 5, 0, 74, 
-    0, 74, 5, 10, 4, 1, 0, 75, 1, 248, 
-    39, 3, 0, 75, 0, 0, 58, 1, 3, 17, 
-    0, 0, 0, 0, 9, 0, 2, 0, 0, 0, 
-    0, 238, 255, 255, 255, 41, 1, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    1, 0, 0, 0, 17, 9, 0, 0, 0, 32, 
+    3, 1, 34, 4, 3, 1, 1, 32, 33, 5, 
+    0, 74, 0, 38, 4, 32, 1, 0, 0, 0, 
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 39, 3, 0, 75, 0, 0, 58, 1, 3, 
+    17, 0, 0, 0, 0, 9, 0, 2, 0, 0, 
+    0, 0, 240, 255, 255, 255, 41, 1, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 10, 0, 
-    0, 0, 0, 0, 0, 0, 60, 108, 105, 115, 
-    116, 99, 111, 109, 112, 62, 2, 0, 0, 0, 
-    0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 
-    0, 0, 112, 97, 116, 104, 95, 115, 101, 112, 
-    97, 114, 97, 116, 111, 114, 115, 6, 0, 0, 
-    0, 0, 0, 0, 0, 114, 115, 116, 114, 105, 
-    112, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
-    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 46, 48, 1, 0, 0, 
-    0, 0, 0, 0, 0, 112, 32, 0, 0, 0, 
-    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 
-    44, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 95, 115, 
-    101, 116, 117, 112, 46, 60, 103, 101, 110, 101, 
-    120, 112, 114, 62, 46, 49, 54, 55, 49, 58, 
-    49, 56, 0, 22, 0, 0, 0, 0, 0, 0, 
-    0, 32, 0, 0, 13, 1, 0, 17, 0, 0, 
-    0, 0, 9, 0, 1, 16, 0, 0, 0, 0, 
-    0, 0, 0, 45, 1, 0, 17, 0, 0, 0, 
-    0, 33, 2, 0, 32, 3, 1, 74, 0, 74, 
-    3, 10, 2, 1, 0, 75, 1, 0, 39, 4, 
-    0, 75, 0, 0, 30, 5, 0, 6, 2, 4, 
-    5, 0, 64, 2, 67, 3, 17, 0, 0, 0, 
-    0, 9, 0, 1, 0, 0, 0, 0, 240, 255, 
-    255, 255, 30, 2, 1, 41, 2, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
-    1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 
+    0, 0, 0, 0, 0, 60, 108, 105, 115, 116, 
+    99, 111, 109, 112, 62, 2, 0, 0, 0, 0, 
+    0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 
+    0, 112, 97, 116, 104, 95, 115, 101, 112, 97, 
+    114, 97, 116, 111, 114, 115, 6, 0, 0, 0, 
+    0, 0, 0, 0, 114, 115, 116, 114, 105, 112, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 46, 48, 1, 0, 0, 0, 
+    0, 0, 0, 0, 112, 32, 0, 0, 0, 0, 
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 44, 
+    0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
+    111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
+    116, 101, 114, 110, 97, 108, 46, 95, 115, 101, 
+    116, 117, 112, 46, 60, 103, 101, 110, 101, 120, 
+    112, 114, 62, 46, 49, 54, 55, 49, 58, 49, 
+    56, 0, 22, 0, 0, 0, 0, 0, 0, 0, 
+    32, 0, 0, 13, 1, 0, 17, 0, 0, 0, 
+    0, 9, 0, 1, 16, 0, 0, 0, 0, 0, 
+    0, 0, 45, 1, 0, 17, 0, 0, 0, 0, 
+    33, 2, 0, 32, 3, 1, 74, 0, 74, 3, 
+    10, 2, 1, 0, 75, 1, 0, 39, 4, 0, 
+    75, 0, 0, 30, 5, 0, 6, 2, 4, 5, 
+    0, 64, 2, 67, 3, 17, 0, 0, 0, 0, 
+    9, 0, 1, 0, 0, 0, 0, 240, 255, 255, 
+    255, 30, 2, 1, 41, 2, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    4, 0, 0, 0, 0, 0, 0, 0, 9, 0, 
-    0, 0, 0, 0, 0, 0, 60, 103, 101, 110, 
-    101, 120, 112, 114, 62, 1, 0, 0, 0, 0, 
-    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
-    0, 108, 101, 110, 0, 0, 0, 0, 0, 0, 
-    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 46, 48, 
-    3, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
-    112, 32, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 
+    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 
+    0, 0, 0, 60, 103, 101, 110, 101, 120, 112, 
+    114, 62, 1, 0, 0, 0, 0, 0, 0, 0, 
+    3, 0, 0, 0, 0, 0, 0, 0, 108, 101, 
+    110, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
     0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
-    0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 95, 78, 97, 109, 101, 115, 112, 
-    97, 99, 101, 76, 111, 97, 100, 101, 114, 46, 
-    103, 101, 116, 95, 99, 111, 100, 101, 46, 49, 
-    50, 57, 50, 58, 52, 0, 7, 0, 0, 0, 
-    0, 0, 0, 0, 33, 1, 0, 30, 2, 0, 
-    30, 3, 1, 30, 4, 2, 30, 5, 3, 12, 
-    1, 3, 0, 0, 0, 0, 0, 0, 0, 2, 
-    3, 4, 1, 0, 0, 0, 0, 0, 0, 0, 
-    5, 1, 0, 0, 0, 0, 0, 0, 0, 1, 
-    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+    0, 0, 0, 0, 0, 46, 48, 3, 0, 0, 
+    0, 0, 0, 0, 0, 115, 101, 112, 32, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
     0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
-    0, 0, 0, 2, 8, 0, 0, 0, 0, 0, 
-    0, 0, 60, 115, 116, 114, 105, 110, 103, 62, 
-    2, 4, 0, 0, 0, 0, 0, 0, 0, 101, 
-    120, 101, 99, 6, 1, 0, 0, 0, 0, 0, 
+    0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    95, 78, 97, 109, 101, 115, 112, 97, 99, 101, 
+    76, 111, 97, 100, 101, 114, 46, 103, 101, 116, 
+    95, 99, 111, 100, 101, 46, 49, 50, 57, 50, 
+    58, 52, 0, 7, 0, 0, 0, 0, 0, 0, 
+    0, 33, 1, 0, 30, 2, 0, 30, 3, 1, 
+    30, 4, 2, 30, 5, 3, 12, 1, 3, 0, 
+    0, 0, 0, 0, 0, 0, 2, 3, 4, 1, 
+    0, 0, 0, 0, 0, 0, 0, 5, 1, 0, 
+    0, 0, 0, 0, 0, 0, 1, 41, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 2, 
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 8, 
+    0, 0, 0, 0, 0, 0, 0, 60, 115, 116, 
+    114, 105, 110, 103, 62, 2, 4, 0, 0, 0, 
+    0, 0, 0, 0, 101, 120, 101, 99, 6, 1, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
-    0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 
-    0, 0, 103, 101, 116, 95, 99, 111, 100, 101, 
-    2, 0, 0, 0, 0, 0, 0, 0, 7, 0, 
-    0, 0, 0, 0, 0, 0, 99, 111, 109, 112, 
-    105, 108, 101, 12, 0, 0, 0, 0, 0, 0, 
-    0, 100, 111, 110, 116, 95, 105, 110, 104, 101, 
-    114, 105, 116, 0, 0, 0, 0, 0, 0, 0, 
-    0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 
-    0, 0, 0, 0, 0, 0, 0, 115, 101, 108, 
-    102, 8, 0, 0, 0, 0, 0, 0, 0, 102, 
-    117, 108, 108, 110, 97, 109, 101, 32, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0, 49, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 95, 
-    95, 99, 108, 97, 115, 115, 95, 95, 83, 111, 
-    117, 114, 99, 101, 76, 111, 97, 100, 101, 114, 
-    95, 95, 46, 56, 53, 54, 58, 48, 0, 32, 
-    0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 8, 
+    0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+    95, 99, 111, 100, 101, 2, 0, 0, 0, 0, 
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
+    0, 99, 111, 109, 112, 105, 108, 101, 12, 0, 
+    0, 0, 0, 0, 0, 0, 100, 111, 110, 116, 
+    95, 105, 110, 104, 101, 114, 105, 116, 0, 0, 
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 
+    0, 0, 115, 101, 108, 102, 8, 0, 0, 0, 
+    0, 0, 0, 0, 102, 117, 108, 108, 110, 97, 
+    109, 101, 32, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 
+    0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
+    116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
+    110, 97, 108, 46, 95, 95, 99, 108, 97, 115, 
+    115, 95, 95, 83, 111, 117, 114, 99, 101, 76, 
+    111, 97, 100, 101, 114, 95, 95, 46, 56, 53, 
+    54, 58, 48, 0, 32, 0, 0, 0, 0, 0, 
+    0, 0, 33, 0, 0, 47, 0, 10, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 109, 111, 100, 
+    117, 108, 101, 95, 95, 30, 2, 0, 47, 2, 
+    12, 0, 0, 0, 0, 0, 0, 0, 95, 95, 
+    113, 117, 97, 108, 110, 97, 109, 101, 95, 95, 
+    30, 1, 1, 36, 0, 1, 0, 0, 0, 0, 
     47, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
-    95, 95, 109, 111, 100, 117, 108, 101, 95, 95, 
-    30, 2, 0, 47, 2, 12, 0, 0, 0, 0, 
-    0, 0, 0, 95, 95, 113, 117, 97, 108, 110, 
-    97, 109, 101, 95, 95, 30, 1, 1, 36, 0, 
-    1, 0, 0, 0, 0, 47, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 95, 
-    109, 116, 105, 109, 101, 30, 1, 2, 36, 0, 
-    1, 0, 0, 0, 0, 47, 0, 10, 0, 0, 
-    0, 0, 0, 0, 0, 112, 97, 116, 104, 95, 
-    115, 116, 97, 116, 115, 30, 1, 3, 36, 0, 
-    1, 0, 0, 0, 0, 47, 0, 15, 0, 0, 
-    0, 0, 0, 0, 0, 95, 99, 97, 99, 104, 
-    101, 95, 98, 121, 116, 101, 99, 111, 100, 101, 
-    30, 1, 4, 36, 0, 1, 0, 0, 0, 0, 
-    47, 0, 8, 0, 0, 0, 0, 0, 0, 0, 
-    115, 101, 116, 95, 100, 97, 116, 97, 30, 1, 
-    5, 36, 0, 1, 0, 0, 0, 0, 47, 0, 
-    10, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
-    116, 95, 115, 111, 117, 114, 99, 101, 30, 1, 
-    6, 49, 0, 1, 1, 30, 2, 7, 74, 0, 
-    36, 1, 2, 0, 1, 0, 0, 75, 1, 0, 
-    47, 1, 14, 0, 0, 0, 0, 0, 0, 0, 
-    115, 111, 117, 114, 99, 101, 95, 116, 111, 95, 
-    99, 111, 100, 101, 30, 0, 8, 36, 1, 0, 
-    0, 0, 0, 0, 47, 1, 8, 0, 0, 0, 
-    0, 0, 0, 0, 103, 101, 116, 95, 99, 111, 
-    100, 101, 17, 0, 0, 0, 0, 29, 0, 0, 
-    41, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 95, 109, 116, 105, 109, 101, 
+    30, 1, 2, 36, 0, 1, 0, 0, 0, 0, 
+    47, 0, 10, 0, 0, 0, 0, 0, 0, 0, 
+    112, 97, 116, 104, 95, 115, 116, 97, 116, 115, 
+    30, 1, 3, 36, 0, 1, 0, 0, 0, 0, 
+    47, 0, 15, 0, 0, 0, 0, 0, 0, 0, 
+    95, 99, 97, 99, 104, 101, 95, 98, 121, 116, 
+    101, 99, 111, 100, 101, 30, 1, 4, 36, 0, 
+    1, 0, 0, 0, 0, 47, 0, 8, 0, 0, 
+    0, 0, 0, 0, 0, 115, 101, 116, 95, 100, 
+    97, 116, 97, 30, 1, 5, 36, 0, 1, 0, 
+    0, 0, 0, 47, 0, 10, 0, 0, 0, 0, 
+    0, 0, 0, 103, 101, 116, 95, 115, 111, 117, 
+    114, 99, 101, 30, 1, 6, 49, 0, 1, 1, 
+    30, 2, 7, 74, 0, 36, 1, 2, 0, 1, 
+    0, 0, 75, 1, 0, 47, 1, 14, 0, 0, 
+    0, 0, 0, 0, 0, 115, 111, 117, 114, 99, 
+    101, 95, 116, 111, 95, 99, 111, 100, 101, 30, 
+    0, 8, 36, 1, 0, 0, 0, 0, 0, 47, 
+    1, 8, 0, 0, 0, 0, 0, 0, 0, 103, 
+    101, 116, 95, 99, 111, 100, 101, 17, 0, 0, 
+    0, 0, 29, 0, 0, 41, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
-    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 
-    0, 0, 95, 95, 99, 108, 97, 115, 115, 95, 
-    95, 9, 0, 0, 0, 0, 0, 0, 0, 2, 
-    12, 0, 0, 0, 0, 0, 0, 0, 83, 111, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 
+    0, 0, 0, 0, 0, 95, 95, 99, 108, 97, 
+    115, 115, 95, 95, 9, 0, 0, 0, 0, 0, 
+    0, 0, 2, 12, 0, 0, 0, 0, 0, 0, 
+    0, 83, 111, 117, 114, 99, 101, 76, 111, 97, 
+    100, 101, 114, 2, 49, 0, 0, 0, 0, 0, 
+    0, 0, 95, 98, 111, 111, 116, 115, 116, 114, 
+    97, 112, 95, 101, 120, 116, 101, 114, 110, 97, 
+    108, 46, 83, 111, 117, 114, 99, 101, 76, 111, 
+    97, 100, 101, 114, 46, 112, 97, 116, 104, 95, 
+    109, 116, 105, 109, 101, 46, 56, 53, 56, 58, 
+    52, 2, 49, 0, 0, 0, 0, 0, 0, 0, 
+    95, 98, 111, 111, 116, 115, 116, 114, 97, 112, 
+    95, 101, 120, 116, 101, 114, 110, 97, 108, 46, 
+    83, 111, 117, 114, 99, 101, 76, 111, 97, 100, 
+    101, 114, 46, 112, 97, 116, 104, 95, 115, 116, 
+    97, 116, 115, 46, 56, 54, 54, 58, 52, 2, 
+    54, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
+    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
+    120, 116, 101, 114, 110, 97, 108, 46, 83, 111, 
     117, 114, 99, 101, 76, 111, 97, 100, 101, 114, 
-    2, 49, 0, 0, 0, 0, 0, 0, 0, 95, 
-    98, 111, 111, 116, 115, 116, 114, 97, 112, 95, 
-    101, 120, 116, 101, 114, 110, 97, 108, 46, 83, 
-    111, 117, 114, 99, 101, 76, 111, 97, 100, 101, 
-    114, 46, 112, 97, 116, 104, 95, 109, 116, 105, 
-    109, 101, 46, 56, 53, 56, 58, 52, 2, 49, 
+    46, 95, 99, 97, 99, 104, 101, 95, 98, 121, 
+    116, 101, 99, 111, 100, 101, 46, 56, 56, 48, 
+    58, 52, 2, 47, 0, 0, 0, 0, 0, 0, 
+    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
+    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
+    46, 83, 111, 117, 114, 99, 101, 76, 111, 97, 
+    100, 101, 114, 46, 115, 101, 116, 95, 100, 97, 
+    116, 97, 46, 56, 57, 48, 58, 52, 2, 49, 
     0, 0, 0, 0, 0, 0, 0, 95, 98, 111, 
     111, 116, 115, 116, 114, 97, 112, 95, 101, 120, 
     116, 101, 114, 110, 97, 108, 46, 83, 111, 117, 
     114, 99, 101, 76, 111, 97, 100, 101, 114, 46, 
-    112, 97, 116, 104, 95, 115, 116, 97, 116, 115, 
-    46, 56, 54, 54, 58, 52, 2, 54, 0, 0, 
-    0, 0, 0, 0, 0, 95, 98, 111, 111, 116, 
-    115, 116, 114, 97, 112, 95, 101, 120, 116, 101, 
-    114, 110, 97, 108, 46, 83, 111, 117, 114, 99, 
-    101, 76, 111, 97, 100, 101, 114, 46, 95, 99, 
-    97, 99, 104, 101, 95, 98, 121, 116, 101, 99, 
-    111, 100, 101, 46, 56, 56, 48, 58, 52, 2, 
-    47, 0, 0, 0, 0, 0, 0, 0, 95, 98, 
-    111, 111, 116, 115, 116, 114, 97, 112, 95, 101, 
-    120, 116, 101, 114, 110, 97, 108, 46, 83, 111, 
-    117, 114, 99, 101, 76, 111, 97, 100, 101, 114, 
-    46, 115, 101, 116, 95, 100, 97, 116, 97, 46, 
-    56, 57, 48, 58, 52, 2, 49, 0, 0, 0, 
+    103, 101, 116, 95, 115, 111, 117, 114, 99, 101, 
+    46, 56, 57, 55, 58, 52, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 2, 53, 0, 0, 0, 
     0, 0, 0, 0, 95, 98, 111, 111, 116, 115, 
     116, 114, 97, 112, 95, 101, 120, 116, 101, 114, 
     110, 97, 108, 46, 83, 111, 117, 114, 99, 101, 
-    76, 111, 97, 100, 101, 114, 46, 103, 101, 116, 
-    95, 115, 111, 117, 114, 99, 101, 46, 56, 57, 
-    55, 58, 52, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 2, 53, 0, 0, 0, 0, 0, 0, 
-    0, 95, 98, 111, 111, 116, 115, 116, 114, 97, 
-    112, 95, 101, 120, 116, 101, 114, 110, 97, 108, 
-    46, 83, 111, 117, 114, 99, 101, 76, 111, 97, 
-    100, 101, 114, 46, 115, 111, 117, 114, 99, 101, 
-    95, 116, 111, 95, 99, 111, 100, 101, 46, 57, 
-    48, 55, 58, 52, 2, 47, 0, 0, 0, 0, 
-    0, 0, 0, 95, 98, 111, 111, 116, 115, 116, 
-    114, 97, 112, 95, 101, 120, 116, 101, 114, 110, 
-    97, 108, 46, 83, 111, 117, 114, 99, 101, 76, 
-    111, 97, 100, 101, 114, 46, 103, 101, 116, 95, 
-    99, 111, 100, 101, 46, 57, 49, 53, 58, 52, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 
+    76, 111, 97, 100, 101, 114, 46, 115, 111, 117, 
+    114, 99, 101, 95, 116, 111, 95, 99, 111, 100, 
+    101, 46, 57, 48, 55, 58, 52, 2, 47, 0, 
+    0, 0, 0, 0, 0, 0, 95, 98, 111, 111, 
+    116, 115, 116, 114, 97, 112, 95, 101, 120, 116, 
+    101, 114, 110, 97, 108, 46, 83, 111, 117, 114, 
+    99, 101, 76, 111, 97, 100, 101, 114, 46, 103, 
+    101, 116, 95, 99, 111, 100, 101, 46, 57, 49, 
+    53, 58, 52, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 23, 
-    0, 0, 0, 0, 0, 0, 0, 95, 95, 99, 
-    108, 97, 115, 115, 95, 95, 83, 111, 117, 114, 
-    99, 101, 76, 111, 97, 100, 101, 114, 95, 95, 
-    1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 
-    0, 0, 0, 0, 0, 0, 95, 95, 110, 97, 
-    109, 101, 95, 95, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+    0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 
+    95, 95, 99, 108, 97, 115, 115, 95, 95, 83, 
+    111, 117, 114, 99, 101, 76, 111, 97, 100, 101, 
+    114, 95, 95, 1, 0, 0, 0, 0, 0, 0, 
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 95, 
+    95, 110, 97, 109, 101, 95, 95, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    
+    0, 0, 0, 
 };
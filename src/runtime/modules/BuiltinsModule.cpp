@@ -30,10 +30,12 @@
 #include "runtime/PyTuple.hpp"
 #include "runtime/PyType.hpp"
 #include "runtime/RuntimeError.hpp"
+#include "runtime/Shape.hpp"
 #include "runtime/StopIteration.hpp"
 #include "runtime/SyntaxError.hpp"
 #include "runtime/TypeError.hpp"
 #include "runtime/UnboundLocalError.hpp"
+#include "runtime/UnicodeDecodeError.hpp"
 #include "runtime/Value.hpp"
 #include "runtime/ValueError.hpp"
 #include "runtime/modules/Modules.hpp"
@@ -132,30 +134,27 @@ PyResult<PyObject *> print(const PyTuple *args, const PyDict *kwargs, Interprete
 }
 
 
-PyResult<PyObject *> iter(const PyTuple *args, const PyDict *kwargs, Interpreter &)
+PyResult<PyObject *> iter(std::span<const Value> args, std::span<const std::string_view> kwnames)
 {
-	ASSERT(args->size() == 1)
-	const auto &arg = args->operator[](0);
-	if (kwargs) { return Err(type_error("iter() takes no keyword arguments")); }
-	return arg.and_then([](auto *obj) { return obj->iter(); });
+	ASSERT(args.size() == 1)
+	if (!kwnames.empty()) { return Err(type_error("iter() takes no keyword arguments")); }
+	return PyObject::from(args[0]).and_then([](auto *obj) { return obj->iter(); });
 }
 
-PyResult<PyObject *> hash(const PyTuple *args, const PyDict *kwargs, Interpreter &)
+PyResult<PyObject *> hash(std::span<const Value> args, std::span<const std::string_view> kwnames)
 {
-	ASSERT(args->size() == 1)
-	const auto &arg = args->operator[](0);
-	if (kwargs) { return Err(type_error("hash() takes no keyword arguments")); }
-	return arg.and_then([](auto *obj) { return obj->hash(); }).and_then([](const size_t h) {
-		return PyInteger::create(h);
-	});
+	ASSERT(args.size() == 1)
+	if (!kwnames.empty()) { return Err(type_error("hash() takes no keyword arguments")); }
+	return PyObject::from(args[0])
+		.and_then([](auto *obj) { return obj->hash(); })
+		.and_then([](const size_t h) { return PyInteger::create(h); });
 }
 
-PyResult<PyObject *> next(const PyTuple *args, const PyDict *kwargs, Interpreter &)
+PyResult<PyObject *> next(std::span<const Value> args, std::span<const std::string_view> kwnames)
 {
-	ASSERT(args->size() == 1)
-	if (kwargs) { return Err(type_error("next() takes no keyword arguments")); }
-	const auto &arg = args->operator[](0);
-	return arg.and_then([](auto *obj) { return obj->next(); });
+	ASSERT(args.size() == 1)
+	if (!kwnames.empty()) { return Err(type_error("next() takes no keyword arguments")); }
+	return PyObject::from(args[0]).and_then([](auto *obj) { return obj->next(); });
 }
 
 
@@ -321,14 +320,7 @@ PyResult<PyObject *>
 	// call with frame keeps a reference to locals in a ns
 	// so we have a reference to all class attributes and methods
 	// i.e. {__module__: __name__, __qualname__: 'A', foo: <function A.foo>}
-	auto args_ = PyTuple::create();
-	if (args_.is_err()) { return args_; }
-	auto *empty_args = args_.unwrap();
-
-	auto kwargs_ = PyDict::create();
-	if (kwargs_.is_err()) { return kwargs_; }
-	auto *empty_kwargs = kwargs_.unwrap();
-	auto classcell = callable.unwrap()->call_with_frame(ns, empty_args, empty_kwargs);
+	auto classcell = callable.unwrap()->call_with_frame(ns, {}, {});
 	if (classcell.is_err()) { return classcell; }
 
 	auto call_args = PyTuple::create(class_name, bases, ns);
@@ -356,16 +348,14 @@ PyResult<PyObject *> locals(const PyTuple *, const PyDict *, Interpreter &interp
 }
 
 
-PyResult<PyObject *> len(const PyTuple *args, const PyDict *kwargs, Interpreter &)
+PyResult<PyObject *> len(std::span<const Value> args, std::span<const std::string_view> kwnames)
 {
-	if (args->size() != 1) {
-		return Err(type_error("len() takes exactly one argument ({} given)", args->size()));
-	}
-	if (kwargs && !kwargs->map().empty()) {
-		return Err(type_error("len() takes no keyword arguments"));
+	if (!kwnames.empty()) { return Err(type_error("len() takes no keyword arguments")); }
+	if (args.size() != 1) {
+		return Err(type_error("len() takes exactly one argument ({} given)", args.size()));
 	}
 
-	return PyObject::from(args->elements()[0]).and_then([](PyObject *o) -> PyResult<PyObject *> {
+	return PyObject::from(args[0]).and_then([](PyObject *o) -> PyResult<PyObject *> {
 		auto mapping = o->as_mapping();
 		if (mapping.is_err()) { return Err(mapping.unwrap_err()); }
 		if (auto r = mapping.unwrap().len(); r.is_ok()) {
@@ -376,10 +366,10 @@ PyResult<PyObject *> len(const PyTuple *args, const PyDict *kwargs, Interpreter
 	});
 }
 
-PyResult<PyObject *> id(const PyTuple *args, const PyDict *, Interpreter &)
+PyResult<PyObject *> id(std::span<const Value> args, std::span<const std::string_view>)
 {
-	ASSERT(args->size() == 1)
-	auto obj = args->operator[](0);
+	ASSERT(args.size() == 1)
+	auto obj = PyObject::from(args[0]);
 	if (obj.is_err()) return obj;
 	return PyInteger::create(bit_cast<intptr_t>(obj.unwrap()));
 }
@@ -467,15 +457,15 @@ PyResult<PyObject *> import(const PyTuple *args, const PyDict *, Interpreter &)
 		static_cast<uint32_t>(as<PyInteger>(level)->as_size_t()));
 }
 
-PyResult<PyObject *> hasattr(const PyTuple *args, const PyDict *, Interpreter &)
+PyResult<PyObject *> hasattr(std::span<const Value> args, std::span<const std::string_view>)
 {
-	if (args->size() != 2) {
-		return Err(type_error("hasattr expected 2 arguments, got {}", args->size()));
+	if (args.size() != 2) {
+		return Err(type_error("hasattr expected 2 arguments, got {}", args.size()));
 	}
-	auto obj_ = PyObject::from(args->elements()[0]);
+	auto obj_ = PyObject::from(args[0]);
 	if (obj_.is_err()) return obj_;
 	auto *obj = obj_.unwrap();
-	auto name_ = PyObject::from(args->elements()[1]);
+	auto name_ = PyObject::from(args[1]);
 	if (name_.is_err()) return name_;
 	auto *name = name_.unwrap();
 	if (!as<PyString>(name)) { return Err(type_error("hasattr(): attribute name must be string")); }
@@ -490,25 +480,25 @@ PyResult<PyObject *> hasattr(const PyTuple *args, const PyDict *, Interpreter &)
 	}
 }
 
-PyResult<PyObject *> getattr(const PyTuple *args, const PyDict *, Interpreter &)
+PyResult<PyObject *> getattr(std::span<const Value> args, std::span<const std::string_view>)
 {
-	if (args->size() != 2 && args->size() != 3) {
-		return Err(type_error("getattr expected 2 or 3 arguments, got {}", args->size()));
+	if (args.size() != 2 && args.size() != 3) {
+		return Err(type_error("getattr expected 2 or 3 arguments, got {}", args.size()));
 	}
-	auto obj_ = PyObject::from(args->elements()[0]);
+	auto obj_ = PyObject::from(args[0]);
 	if (obj_.is_err()) return obj_;
 	auto *obj = obj_.unwrap();
-	auto name_ = PyObject::from(args->elements()[1]);
+	auto name_ = PyObject::from(args[1]);
 	if (name_.is_err()) return name_;
 	auto *name = name_.unwrap();
 	if (!as<PyString>(name)) { return Err(type_error("getattr(): attribute name must be string")); }
 
-	if (args->size() == 2) {
+	if (args.size() == 2) {
 		auto result = obj->getattribute(name);
 		if (result.is_ok()) { ASSERT(result.unwrap()); }
 		return result;
 	} else {
-		auto default_value_ = PyObject::from(args->elements()[2]);
+		auto default_value_ = PyObject::from(args[2]);
 		if (default_value_.is_err()) return default_value_;
 		auto *default_value = default_value_.unwrap();
 
@@ -526,18 +516,18 @@ PyResult<PyObject *> getattr(const PyTuple *args, const PyDict *, Interpreter &)
 	}
 }
 
-PyResult<PyObject *> setattr(const PyTuple *args, const PyDict *, Interpreter &)
+PyResult<PyObject *> setattr(std::span<const Value> args, std::span<const std::string_view>)
 {
-	if (args->size() != 3) {
-		return Err(type_error("setattr expected 3 arguments, got {}", args->size()));
+	if (args.size() != 3) {
+		return Err(type_error("setattr expected 3 arguments, got {}", args.size()));
 	}
-	auto obj_ = PyObject::from(args->elements()[0]);
+	auto obj_ = PyObject::from(args[0]);
 	if (obj_.is_err()) return obj_;
 	auto *obj = obj_.unwrap();
-	auto name_ = PyObject::from(args->elements()[1]);
+	auto name_ = PyObject::from(args[1]);
 	if (name_.is_err()) return name_;
 	auto *name = name_.unwrap();
-	auto value_ = PyObject::from(args->elements()[2]);
+	auto value_ = PyObject::from(args[2]);
 	if (value_.is_err()) return value_;
 	auto *value = value_.unwrap();
 
@@ -557,9 +547,9 @@ PyResult<PyObject *> hex(const PyTuple *args, const PyDict *, Interpreter &)
 	if (obj_.is_err()) return obj_;
 	auto *obj = obj_.unwrap();
 	if (auto pynumber = PyNumber::as_number(obj)) {
-		if (std::holds_alternative<BigIntType>(pynumber->value().value)) {
+		if (pynumber->value().is_integer()) {
 			std::ostringstream os;
-			os << std::hex << std::ios::showbase << std::get<BigIntType>(pynumber->value().value);
+			os << std::hex << std::ios::showbase << pynumber->value().as_big_int();
 			return PyString::create(os.str());
 		} else {
 			// FIXME: when float is separated from integer fix this
@@ -572,10 +562,10 @@ PyResult<PyObject *> hex(const PyTuple *args, const PyDict *, Interpreter &)
 	}
 }
 
-PyResult<PyObject *> ord(const PyTuple *args, const PyDict *, Interpreter &)
+PyResult<PyObject *> ord(std::span<const Value> args, std::span<const std::string_view>)
 {
-	ASSERT(args->size() == 1)
-	auto obj_ = args->operator[](0);
+	ASSERT(args.size() == 1)
+	auto obj_ = PyObject::from(args[0]);
 	if (obj_.is_err()) return obj_;
 	auto *obj = obj_.unwrap();
 	if (auto pystr = as<PyString>(obj)) {
@@ -595,10 +585,10 @@ PyResult<PyObject *> ord(const PyTuple *args, const PyDict *, Interpreter &)
 	}
 }
 
-PyResult<PyObject *> chr(const PyTuple *args, const PyDict *, Interpreter &)
+PyResult<PyObject *> chr(std::span<const Value> args, std::span<const std::string_view>)
 {
-	ASSERT(args->size() == 1)
-	auto obj_ = args->operator[](0);
+	ASSERT(args.size() == 1)
+	auto obj_ = PyObject::from(args[0]);
 	if (obj_.is_err()) return obj_;
 	auto *obj = obj_.unwrap();
 
@@ -606,7 +596,7 @@ PyResult<PyObject *> chr(const PyTuple *args, const PyDict *, Interpreter &)
 		if (std::holds_alternative<double>(cp->value().value)) {
 			return Err(type_error("'float' object cannot be interpreted as an integer"));
 		}
-		return PyString::chr(std::get<BigIntType>(cp->value().value));
+		return PyString::chr(cp->value().as_big_int());
 	} else {
 		return Err(
 			type_error("'{}' object cannot be interpreted as an integer", obj->type()->name()));
@@ -624,7 +614,7 @@ PyResult<PyObject *> dir(const PyTuple *args, const PyDict *, Interpreter &inter
 		for (const auto &[k, _] : as<PyDict>(interpreter.execution_frame()->locals())->map()) {
 			auto obj_ = PyObject::from(k);
 			if (obj_.is_err()) return obj_;
-			dir_list->elements().push_back(obj_.unwrap());
+			dir_list->storage().push_back(obj_.unwrap());
 		}
 	} else {
 		const auto &arg = args->elements()[0];
@@ -633,7 +623,7 @@ PyResult<PyObject *> dir(const PyTuple *args, const PyDict *, Interpreter &inter
 		if (std::holds_alternative<PyObject *>(arg) && as<PyModule>(std::get<PyObject *>(arg))) {
 			auto *pymodule = as<PyModule>(std::get<PyObject *>(arg));
 			for (const auto &[k, _] : pymodule->symbol_table()->map()) {
-				dir_list->elements().push_back(k);
+				dir_list->storage().push_back(k);
 			}
 		}
 		// If the object is a type or class object, the list contains the names of its attributes,
@@ -645,33 +635,41 @@ PyResult<PyObject *> dir(const PyTuple *args, const PyDict *, Interpreter &inter
 			auto object_ = PyObject::from(arg);
 			if (object_.is_err()) return object_;
 			auto *object = object_.unwrap();
-			for (const auto &[k, _] : object->attributes()->map()) {
-				dir_list->elements().push_back(k);
+			if (auto *shape = object->shape()) {
+				for (const auto &key : shape->keys()) {
+					auto name = PyString::create(key);
+					if (name.is_err()) { return name; }
+					dir_list->storage().push_back(name.unwrap());
+				}
+			} else if (object->attributes()) {
+				for (const auto &[k, _] : object->attributes()->map()) {
+					dir_list->storage().push_back(k);
+				}
 			}
 		}
 	}
 
-	dir_list->sort();
+	if (auto sort_result = dir_list->sort(nullptr, false); sort_result.is_err()) {
+		return sort_result;
+	}
 	return Ok(static_cast<PyObject *>(dir_list_.unwrap()));
 }
 
-PyResult<PyObject *> repr(const PyTuple *args, const PyDict *, Interpreter &)
+PyResult<PyObject *> repr(std::span<const Value> args, std::span<const std::string_view>)
 {
-	if (args->size() != 1) {
-		return Err(type_error("repr() takes exactly one argument ({} given)", args->size()));
+	if (args.size() != 1) {
+		return Err(type_error("repr() takes exactly one argument ({} given)", args.size()));
 	}
-	return PyObject::from(args->elements()[0]).and_then([](auto *obj) { return obj->repr(); });
+	return PyObject::from(args[0]).and_then([](auto *obj) { return obj->repr(); });
 }
 
-PyResult<PyObject *> abs(const PyTuple *args, const PyDict *kwargs, Interpreter &)
+PyResult<PyObject *> abs(std::span<const Value> args, std::span<const std::string_view> kwnames)
 {
-	if (args->size() != 1) {
-		return Err(type_error("abs() takes exactly one argument ({} given)", args->size()));
-	}
-	if (kwargs && !kwargs->map().empty()) {
-		return Err(type_error("abs() takes no keyword arguments"));
+	if (args.size() != 1) {
+		return Err(type_error("abs() takes exactly one argument ({} given)", args.size()));
 	}
-	return PyObject::from(args->elements()[0]).and_then([](auto *obj) { return obj->abs(); });
+	if (!kwnames.empty()) { return Err(type_error("abs() takes no keyword arguments")); }
+	return PyObject::from(args[0]).and_then([](auto *obj) { return obj->abs(); });
 }
 
 PyResult<PyObject *> max(const PyTuple *args, const PyDict *kwargs, Interpreter &interpreter)
@@ -772,19 +770,18 @@ PyResult<PyObject *> min(const PyTuple *args, const PyDict *kwargs, Interpreter
 	}
 }
 
-PyResult<PyObject *> isinstance(const PyTuple *args, const PyDict *kwargs, Interpreter &)
+PyResult<PyObject *> isinstance(std::span<const Value> args,
+	std::span<const std::string_view> kwnames)
 {
-	if (args->size() != 2) {
-		return Err(type_error("isinstance expected 2 arguments, got {}", args->size()));
+	if (!kwnames.empty()) { return Err(type_error("isinstance() takes no keyword arguments")); }
+	if (args.size() != 2) {
+		return Err(type_error("isinstance expected 2 arguments, got {}", args.size()));
 	}
 
-	if (kwargs && !kwargs->map().empty()) {
-		return Err(type_error("isinstance() takes no keyword arguments"));
-	}
-	auto object_ = PyObject::from(args->elements()[0]);
+	auto object_ = PyObject::from(args[0]);
 	if (object_.is_err()) return object_;
 	auto *object = object_.unwrap();
-	auto classinfo_ = PyObject::from(args->elements()[1]);
+	auto classinfo_ = PyObject::from(args[1]);
 	if (classinfo_.is_err()) return classinfo_;
 	auto *classinfo = classinfo_.unwrap();
 
@@ -812,19 +809,18 @@ PyResult<PyObject *> isinstance(const PyTuple *args, const PyDict *kwargs, Inter
 	return Ok(result ? py_true() : py_false());
 }
 
-PyResult<PyObject *> issubclass(const PyTuple *args, const PyDict *kwargs, Interpreter &)
+PyResult<PyObject *> issubclass(std::span<const Value> args,
+	std::span<const std::string_view> kwnames)
 {
-	if (args->size() != 2) {
-		return Err(type_error("issubclass expected 2 arguments, got {}", args->size()));
+	if (args.size() != 2) {
+		return Err(type_error("issubclass expected 2 arguments, got {}", args.size()));
 	}
 
-	if (kwargs && !kwargs->map().empty()) {
-		return Err(type_error("issubclass() takes no keyword arguments"));
-	}
-	auto c = PyObject::from(args->elements()[0]);
+	if (!kwnames.empty()) { return Err(type_error("issubclass() takes no keyword arguments")); }
+	auto c = PyObject::from(args[0]);
 	if (c.is_err()) return c;
 	auto *class_ = c.unwrap();
-	auto classinfo_ = PyObject::from(args->elements()[1]);
+	auto classinfo_ = PyObject::from(args[1]);
 	if (classinfo_.is_err()) return classinfo_;
 	auto *classinfo = classinfo_.unwrap();
 
@@ -953,8 +949,8 @@ PyResult<PyObject *> exec(const PyTuple *args, const PyDict *, Interpreter &inte
 		if (!as<PyDict>(locals)) { TODO(); }
 		return code->eval(as<PyDict>(globals),
 			as<PyDict>(locals),
-			PyTuple::create().unwrap(),
-			PyDict::create().unwrap(),
+			{},
+			{},
 			{},
 			{},
 			{},
@@ -1005,8 +1001,8 @@ PyResult<PyObject *> eval(PyTuple *args, PyDict *kwargs, Interpreter &interprete
 	if (auto code = as<PyCode>(source)) {
 		return code->eval(as<PyDict>(globals),
 			as<PyDict>(locals),
-			PyTuple::create().unwrap(),
-			PyDict::create().unwrap(),
+			{},
+			{},
 			{},
 			{},
 			{},
@@ -1022,8 +1018,8 @@ PyResult<PyObject *> eval(PyTuple *args, PyDict *kwargs, Interpreter &interprete
 		ASSERT(as<PyCode>(code));
 		return as<PyCode>(code)->eval(as<PyDict>(globals),
 			as<PyDict>(locals),
-			PyTuple::create().unwrap(),
-			PyDict::create().unwrap(),
+			{},
+			{},
 			{},
 			{},
 			{},
@@ -1121,19 +1117,16 @@ PyResult<PyObject *> compile(const PyTuple *args, const PyDict *, Interpreter &)
 	}
 }
 
-PyResult<PyObject *> callable(const PyTuple *args, const PyDict *kwargs, Interpreter &)
+PyResult<PyObject *> callable(std::span<const Value> args,
+	std::span<const std::string_view> kwnames)
 {
-	if (!args) {
-		return Err(type_error("callable() takes exactly one argument (0 given)"));
-	} else if (args->size() != 1) {
-		return Err(type_error("callable() takes exactly one argument ({} given)", args->size()));
+	if (args.size() != 1) {
+		return Err(type_error("callable() takes exactly one argument ({} given)", args.size()));
 	}
 
-	if (kwargs && kwargs->size() != 0) {
-		return Err(type_error("callable() takes no keyword arguments", args->size()));
-	}
+	if (!kwnames.empty()) { return Err(type_error("callable() takes no keyword arguments")); }
 
-	auto obj = args->elements()[0];
+	const auto &obj = args[0];
 	return std::visit(overloaded{
 						  [](auto) { return false; },
 						  [](PyObject *obj) { return obj->type_prototype().__call__.has_value(); },
@@ -1175,7 +1168,8 @@ PyResult<PyObject *> sorted(PyTuple *args, PyDict *kwargs, Interpreter &interpre
 		if (auto it = kwargs->map().find(String{ "key" }); it != kwargs->map().end()) {
 			auto key_ = PyObject::from(it->second);
 			if (key_.is_err()) { return key_; }
-			if (!key_.unwrap()->type_prototype().__call__.has_value()) {
+			if (key_.unwrap() != py_none()
+				&& !key_.unwrap()->type_prototype().__call__.has_value()) {
 				return Err(type_error("'{}' objects not callable", key_.unwrap()->type()->name()));
 			}
 			key = key_.unwrap();
@@ -1191,90 +1185,105 @@ PyResult<PyObject *> sorted(PyTuple *args, PyDict *kwargs, Interpreter &interpre
 	if (result_.is_err()) { return result_; }
 	auto *result = result_.unwrap();
 
-	PyList *cmp_list = nullptr;
-	if (key != py_none()) {
-		auto cmp_list_ = PyList::create();
-		if (cmp_list_.is_err()) { return cmp_list_; }
-		cmp_list = cmp_list_.unwrap();
-	}
-
 	auto iter_ = iterable->iter();
 	if (iter_.is_err()) { return iter_; }
 	auto *iter = iter_.unwrap();
 
 	auto value = iter->next();
 	while (value.is_ok()) {
-		if (key != py_none()) {
-			ASSERT(cmp_list);
-			auto cmp_value = key->call(PyTuple::create(value.unwrap()).unwrap(), nullptr);
-			if (cmp_value.is_err()) { return cmp_value; }
-			cmp_list->elements().push_back(cmp_value.unwrap());
-		}
-		result->elements().push_back(value.unwrap());
+		result->storage().push_back(value.unwrap());
 		value = iter->next();
 	}
 
 	if (!value.unwrap_err()->type()->issubclass(types::stop_iteration())) { return value; }
 
-	if (key == py_none()) {
-		// FIXME: should throw exception when comparing, as returning true is
-		// probably messing up the C++ Compare requirment
-		PyResult<PyObject *> err = Ok(py_none());
-		auto cmp = [&err](const Value &lhs, const Value &rhs) -> bool {
-			if (auto cmp = less_than(lhs, rhs, VirtualMachine::the().interpreter()); cmp.is_ok()) {
-				auto is_true = truthy(cmp.unwrap(), VirtualMachine::the().interpreter());
-				if (is_true.is_err()) {
-					err = Err(is_true.unwrap_err());
-					return true;
-				}
-				return is_true.unwrap();
-			} else {
-				return false;
+	if (auto sort_result = result->sort(key, reverse); sort_result.is_err()) { return sort_result; }
+
+	return Ok(result);
+}
+
+PyResult<PyObject *> sum(PyTuple *args, PyDict *kwargs, Interpreter &interpreter)
+{
+	auto result = PyArgsParser<PyObject *, PyObject *>::unpack_tuple(args,
+		nullptr,
+		"sum",
+		std::integral_constant<size_t, 1>{},
+		std::integral_constant<size_t, 2>{},
+		nullptr /* start */);
+
+	if (result.is_err()) { return Err(result.unwrap_err()); }
+	auto [iterable, start_obj] = result.unwrap();
+
+	if (kwargs) {
+		for (const auto &[name, value] : kwargs->map()) {
+			if (name != Value{ String{ "start" } }) {
+				auto name_obj = PyObject::from(name);
+				if (name_obj.is_err()) { return name_obj; }
+				return Err(type_error("sum() got an unexpected keyword argument '{}'",
+					name_obj.unwrap()->to_string()));
 			}
-		};
-		if (reverse) {
-			std::stable_sort(result->elements().rbegin(), result->elements().rend(), cmp);
-		} else {
-			std::stable_sort(result->elements().begin(), result->elements().end(), cmp);
+			if (start_obj) {
+				return Err(type_error("sum() got multiple values for argument 'start'"));
+			}
+			auto start_ = PyObject::from(value);
+			if (start_.is_err()) { return start_; }
+			start_obj = start_.unwrap();
 		}
+	}
 
-		if (err.is_err()) { return err; }
-	} else {
-		PyResult<PyObject *> err = Ok(py_none());
-		std::vector<size_t> indices(cmp_list->elements().size());
-		std::iota(indices.begin(), indices.end(), 0);
-		// FIXME: should throw exception when comparing, as returning true is
-		// probably messing up the C++ Compare requirment
-		auto cmp = [&err, cmp_list](size_t lhs_index, size_t rhs_index) -> bool {
-			const auto &lhs = cmp_list->elements()[lhs_index];
-			const auto &rhs = cmp_list->elements()[rhs_index];
-			if (auto cmp = less_than(lhs, rhs, VirtualMachine::the().interpreter()); cmp.is_ok()) {
-				auto is_true = truthy(cmp.unwrap(), VirtualMachine::the().interpreter());
-				if (is_true.is_err()) {
-					err = Err(is_true.unwrap_err());
-					return true;
-				}
-				return is_true.unwrap();
-			} else {
-				return false;
+	if (start_obj && start_obj->type()->issubclass(types::str())) {
+		return Err(type_error("sum() can't sum strings [use ''.join(seq) instead]"));
+	}
+	if (start_obj && start_obj->type()->issubclass(types::bytes())) {
+		return Err(type_error("sum() can't sum bytes [use b''.join(seq) instead]"));
+	}
+
+	Value total = start_obj ? Value{ start_obj } : Value{ Number{ int64_t{ 0 } } };
+
+	// lists with the int or float strategy are summed without boxing their elements
+	if (auto *list = as<PyList>(iterable)) {
+		const auto &storage = list->storage();
+		size_t i = 0;
+		if (auto *ints = storage.as_ints(); ints && ListStorage::unbox_int(total).has_value()) {
+			auto int_total = *ListStorage::unbox_int(total);
+			for (; i < ints->size(); ++i) {
+				int64_t next_total;
+				if (__builtin_add_overflow(int_total, (*ints)[i], &next_total)) { break; }
+				int_total = next_total;
 			}
-		};
-		if (reverse) {
-			std::stable_sort(indices.rbegin(), indices.rend(), cmp);
-		} else {
-			std::stable_sort(indices.begin(), indices.end(), cmp);
+			total = Number{ int_total };
+		} else if (auto *floats = storage.as_floats();
+				   floats
+				   && (ListStorage::unbox_int(total).has_value()
+					   || ListStorage::unbox_float(total).has_value())) {
+			double float_total = ListStorage::unbox_float(total).value_or(
+				static_cast<double>(ListStorage::unbox_int(total).value_or(0)));
+			for (; i < floats->size(); ++i) { float_total += (*floats)[i]; }
+			total = Number{ float_total };
+		}
+		// the rest of an int list that overflowed int64_t, or any other list
+		for (; i < storage.size(); ++i) {
+			auto next_total = add(total, storage[i], interpreter);
+			if (next_total.is_err()) { return Err(next_total.unwrap_err()); }
+			total = next_total.unwrap();
 		}
+		return PyObject::from(total);
+	}
 
-		if (err.is_err()) { return err; }
+	auto iterator = iterable->iter();
+	if (iterator.is_err()) { return iterator; }
 
-		cmp_list->elements().clear();
-		for (const auto &index : indices) {
-			cmp_list->elements().push_back(result->elements()[index]);
-		}
-		result = cmp_list;
+	auto value = iterator.unwrap()->next();
+	while (value.is_ok()) {
+		auto next_total = add(total, value.unwrap(), interpreter);
+		if (next_total.is_err()) { return Err(next_total.unwrap_err()); }
+		total = next_total.unwrap();
+		value = iterator.unwrap()->next();
 	}
 
-	return Ok(result);
+	if (!value.unwrap_err()->type()->issubclass(types::stop_iteration())) { return value; }
+
+	return PyObject::from(total);
 }
 
 auto builtin_types()
@@ -1339,6 +1348,8 @@ auto builtin_exceptions()
 		types::memory_error(),
 		types::stop_iteration(),
 		types::unbound_local_error(),
+		types::unicode_decode_error(),
+		types::recursion_error(),
 	};
 }
 
@@ -1388,9 +1399,7 @@ PyModule *builtins_module(Interpreter &interpreter)
 			}));
 
 	s_builtin_module->add_symbol(PyString::create("abs").unwrap(),
-		heap.allocate<PyNativeFunction>("abs", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return abs(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("abs", VectorCallFunctionType{ abs }));
 
 	s_builtin_module->add_symbol(PyString::create("all").unwrap(),
 		heap.allocate<PyNativeFunction>("all", [&interpreter](PyTuple *args, PyDict *kwargs) {
@@ -1408,9 +1417,7 @@ PyModule *builtins_module(Interpreter &interpreter)
 		}));
 
 	s_builtin_module->add_symbol(PyString::create("getattr").unwrap(),
-		heap.allocate<PyNativeFunction>("getattr", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return getattr(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("getattr", VectorCallFunctionType{ getattr }));
 
 	s_builtin_module->add_symbol(PyString::create("globals").unwrap(),
 		heap.allocate<PyNativeFunction>("globals", [&interpreter](PyTuple *args, PyDict *kwargs) {
@@ -1418,14 +1425,10 @@ PyModule *builtins_module(Interpreter &interpreter)
 		}));
 
 	s_builtin_module->add_symbol(PyString::create("hasattr").unwrap(),
-		heap.allocate<PyNativeFunction>("hasattr", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return hasattr(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("hasattr", VectorCallFunctionType{ hasattr }));
 
 	s_builtin_module->add_symbol(PyString::create("hash").unwrap(),
-		heap.allocate<PyNativeFunction>("hash", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return hash(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("hash", VectorCallFunctionType{ hash }));
 
 	s_builtin_module->add_symbol(PyString::create("hex").unwrap(),
 		heap.allocate<PyNativeFunction>("hex", [&interpreter](PyTuple *args, PyDict *kwargs) {
@@ -1433,26 +1436,16 @@ PyModule *builtins_module(Interpreter &interpreter)
 		}));
 
 	s_builtin_module->add_symbol(PyString::create("id").unwrap(),
-		heap.allocate<PyNativeFunction>("id", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return id(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("id", VectorCallFunctionType{ id }));
 
 	s_builtin_module->add_symbol(PyString::create("iter").unwrap(),
-		heap.allocate<PyNativeFunction>("iter", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return iter(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("iter", VectorCallFunctionType{ iter }));
 
 	s_builtin_module->add_symbol(PyString::create("isinstance").unwrap(),
-		heap.allocate<PyNativeFunction>(
-			"isinstance", [&interpreter](PyTuple *args, PyDict *kwargs) {
-				return isinstance(args, kwargs, interpreter);
-			}));
+		heap.allocate<PyNativeFunction>("isinstance", VectorCallFunctionType{ isinstance }));
 
 	s_builtin_module->add_symbol(PyString::create("issubclass").unwrap(),
-		heap.allocate<PyNativeFunction>(
-			"issubclass", [&interpreter](PyTuple *args, PyDict *kwargs) {
-				return issubclass(args, kwargs, interpreter);
-			}));
+		heap.allocate<PyNativeFunction>("issubclass", VectorCallFunctionType{ issubclass }));
 
 	s_builtin_module->add_symbol(PyString::create("locals").unwrap(),
 		heap.allocate<PyNativeFunction>("locals", [&interpreter](PyTuple *args, PyDict *kwargs) {
@@ -1460,24 +1453,16 @@ PyModule *builtins_module(Interpreter &interpreter)
 		}));
 
 	s_builtin_module->add_symbol(PyString::create("len").unwrap(),
-		heap.allocate<PyNativeFunction>("len", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return len(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("len", VectorCallFunctionType{ len }));
 
 	s_builtin_module->add_symbol(PyString::create("next").unwrap(),
-		heap.allocate<PyNativeFunction>("next", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return next(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("next", VectorCallFunctionType{ next }));
 
 	s_builtin_module->add_symbol(PyString::create("ord").unwrap(),
-		heap.allocate<PyNativeFunction>("ord", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return ord(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("ord", VectorCallFunctionType{ ord }));
 
 	s_builtin_module->add_symbol(PyString::create("chr").unwrap(),
-		heap.allocate<PyNativeFunction>("chr", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return chr(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("chr", VectorCallFunctionType{ chr }));
 
 	s_builtin_module->add_symbol(PyString::create("print").unwrap(),
 		heap.allocate<PyNativeFunction>("print", [&interpreter](PyTuple *args, PyDict *kwargs) {
@@ -1485,14 +1470,10 @@ PyModule *builtins_module(Interpreter &interpreter)
 		}));
 
 	s_builtin_module->add_symbol(PyString::create("repr").unwrap(),
-		heap.allocate<PyNativeFunction>("repr", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return repr(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("repr", VectorCallFunctionType{ repr }));
 
 	s_builtin_module->add_symbol(PyString::create("setattr").unwrap(),
-		heap.allocate<PyNativeFunction>("setattr", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return setattr(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("setattr", VectorCallFunctionType{ setattr }));
 
 	s_builtin_module->add_symbol(PyString::create("exec").unwrap(),
 		heap.allocate<PyNativeFunction>("exec", [&interpreter](PyTuple *args, PyDict *kwargs) {
@@ -1500,9 +1481,7 @@ PyModule *builtins_module(Interpreter &interpreter)
 		}));
 
 	s_builtin_module->add_symbol(PyString::create("callable").unwrap(),
-		heap.allocate<PyNativeFunction>("callable", [&interpreter](PyTuple *args, PyDict *kwargs) {
-			return callable(args, kwargs, interpreter);
-		}));
+		heap.allocate<PyNativeFunction>("callable", VectorCallFunctionType{ callable }));
 
 	s_builtin_module->add_symbol(PyString::create("compile").unwrap(),
 		heap.allocate<PyNativeFunction>("compile", [&interpreter](PyTuple *args, PyDict *kwargs) {
@@ -1534,6 +1513,11 @@ PyModule *builtins_module(Interpreter &interpreter)
 			return sorted(args, kwargs, interpreter);
 		}));
 
+	s_builtin_module->add_symbol(PyString::create("sum").unwrap(),
+		heap.allocate<PyNativeFunction>("sum", [&interpreter](PyTuple *args, PyDict *kwargs) {
+			return sum(args, kwargs, interpreter);
+		}));
+
 	return s_builtin_module;
 }
 
@@ -262,7 +262,7 @@ class IOBase : public PyBaseObject
 				}
 			}
 
-			result->elements().push_back(line.unwrap());
+			result->storage().push_back(line.unwrap());
 			if (hint > 0) {
 				if (auto m = result->as_mapping(); m.is_ok()) {
 					if (auto size = m.unwrap().len(); size.is_err()) {
@@ -250,7 +250,7 @@ PyModule *posix_module()
 				for (const auto &d : fs::directory_iterator{ dir }) {
 					auto name = PyString::create(d.path().filename());
 					if (name.is_err()) return name;
-					result.unwrap()->elements().push_back(name.unwrap());
+					result.unwrap()->storage().push_back(name.unwrap());
 				}
 				return result;
 			})
@@ -11,6 +11,8 @@
 #include "runtime/PyTraceback.hpp"
 #include "runtime/PyTuple.hpp"
 #include "runtime/PyType.hpp"
+#include "runtime/RecursionError.hpp"
+#include "runtime/ValueError.hpp"
 #include "runtime/types/api.hpp"
 
 #include "config.hpp"
@@ -46,7 +48,7 @@ PyResult<PyList *> create_sys_argv(Interpreter &interpreter)
 	for (const auto &arg : interpreter.argv()) {
 		auto arg_str = PyString::create(arg);
 		if (arg_str.is_err()) { return Err(arg_str.unwrap_err()); }
-		argv_list.unwrap()->elements().push_back(arg_str.unwrap());
+		argv_list.unwrap()->storage().push_back(arg_str.unwrap());
 	}
 
 	return argv_list;
@@ -60,9 +62,9 @@ PyResult<PyTuple *> builtin_module_names()
 	for (const auto &[name, _] : builtin_modules) {
 		auto name_str = PyString::create(std::string{ name });
 		if (name_str.is_err()) return Err(name_str.unwrap_err());
-		module_names->elements().push_back(name_str.unwrap());
+		module_names->storage().push_back(name_str.unwrap());
 	}
-	return PyTuple::create(module_names->elements());
+	return PyTuple::create(module_names->storage().values());
 }
 
 constexpr std::string_view platform()
@@ -289,7 +291,43 @@ PyResult<PyObject *> exc_info(Interpreter &interpreter)
 {
 	auto exc = interpreter.execution_frame()->exception_info();
 	if (!exc.has_value()) { return PyTuple::create(py_none(), py_none(), py_none()); }
-	return PyTuple::create(exc->exception_type, exc->exception, exc->traceback);
+	auto *traceback = exc->exception->traceback();
+	return PyTuple::create(exc->exception_type,
+		exc->exception,
+		traceback ? static_cast<PyObject *>(traceback) : py_none());
+}
+
+PyResult<PyObject *> setrecursionlimit(PyTuple *args, PyDict *kwargs)
+{
+	auto result = PyArgsParser<PyInteger *>::unpack_tuple(args,
+		kwargs,
+		"sys.setrecursionlimit",
+		std::integral_constant<size_t, 1>{},
+		std::integral_constant<size_t, 1>{});
+	if (result.is_err()) { return Err(result.unwrap_err()); }
+	auto [limit] = result.unwrap();
+
+	const auto new_limit = limit->as_big_int();
+	if (new_limit < 1) {
+		return Err(value_error("recursion limit must be greater or equal than 1"));
+	}
+	if (!new_limit.fits_slong_p()) { return Err(value_error("recursion limit is too large")); }
+
+	auto &vm = VirtualMachine::the();
+	const auto depth = vm.stack().size();
+	if (static_cast<size_t>(new_limit.get_si()) <= depth) {
+		return Err(recursion_error(
+			"cannot set the recursion limit to {} at the recursion depth {}: the limit is too low",
+			new_limit.get_si(),
+			depth));
+	}
+	vm.set_recursion_limit(static_cast<size_t>(new_limit.get_si()));
+	return Ok(py_none());
+}
+
+PyResult<PyObject *> getrecursionlimit()
+{
+	return PyInteger::create(VirtualMachine::the().recursion_limit());
 }
 
 PyResult<PyObject *> getfilesystemencoding() { return PyString::create("utf-8"); }
@@ -394,11 +432,22 @@ PyModule *sys_module(Interpreter &interpreter)
 					std::integral_constant<size_t, 1>{});
 				if (result.is_err()) { return Err(result.unwrap_err()); }
 				auto [string] = result.unwrap();
-				// TODO: add string to intern table when this is implemented
-				return Ok(string);
+				return PyString::intern(string);
 			})
 			.unwrap());
 
+	s_sys_module->add_symbol(PyString::create("setrecursionlimit").unwrap(),
+		PyNativeFunction::create("setrecursionlimit", [](PyTuple *args, PyDict *kwargs) {
+			return setrecursionlimit(args, kwargs);
+		}).unwrap());
+
+	s_sys_module->add_symbol(PyString::create("getrecursionlimit").unwrap(),
+		PyNativeFunction::create("getrecursionlimit", [](PyTuple *args, PyDict *kwargs) {
+			ASSERT(!args || args->elements().empty());
+			ASSERT(!kwargs || kwargs->map().empty());
+			return getrecursionlimit();
+		}).unwrap());
+
 	s_sys_module->add_symbol(PyString::create("getfilesystemencoding").unwrap(),
 		PyNativeFunction::create("getfilesystemencoding", [](PyTuple *, PyDict *) {
 			return getfilesystemencoding();
@@ -21,7 +21,7 @@ namespace itertools {
 
 	Permutations::Permutations(PyList *pool, size_t length)
 		: PyBaseObject(s_itertools_permutations), m_pool(pool), m_length(length),
-		  m_iterator_length(m_pool->elements().size()), m_inner_iteration(m_length - 1),
+		  m_iterator_length(m_pool->storage().size()), m_inner_iteration(m_length - 1),
 		  m_indices(m_iterator_length), m_done(m_length > m_iterator_length)
 	{
 		std::iota(m_indices.begin(), m_indices.end(), 0);
@@ -42,7 +42,7 @@ namespace itertools {
 
 			auto value_ = iterator->next();
 			while (value_.is_ok()) {
-				pool->elements().push_back(value_.unwrap());
+				pool->storage().push_back(value_.unwrap());
 				value_ = iterator->next();
 			}
 
@@ -52,7 +52,7 @@ namespace itertools {
 
 
 			auto *obj = VirtualMachine::the().heap().allocate<Permutations>(
-				pool, length.value_or(pool->elements().size()));
+				pool, length.value_or(pool->storage().size()));
 			if (!obj) { return Err(memory_error(sizeof(Permutations))); }
 			return Ok(obj);
 		});
@@ -91,7 +91,7 @@ namespace itertools {
 			m_first = false;
 			std::vector<Value> result;
 			result.reserve(m_length);
-			for (size_t i = 0; i < m_length; ++i) { result.push_back(m_pool->elements()[i]); }
+			for (size_t i = 0; i < m_length; ++i) { result.push_back(m_pool->storage()[i]); }
 			return PyTuple::create(std::move(result));
 		}
 
@@ -116,7 +116,7 @@ namespace itertools {
 		std::vector<Value> result;
 		result.reserve(m_length);
 		for (size_t i = 0; i < m_length; ++i) {
-			result.push_back(m_pool->elements()[m_indices[i]]);
+			result.push_back(m_pool->storage()[m_indices[i]]);
 		}
 		m_inner_iteration = m_length - 1;
 		return PyTuple::create(std::move(result));
@@ -44,7 +44,7 @@ namespace itertools {
 						auto *pool = pool_.unwrap();
 						auto value_ = iterator->next();
 						while (value_.is_ok()) {
-							pool->elements().push_back(value_.unwrap());
+							pool->storage().push_back(value_.unwrap());
 							value_ = iterator->next();
 						}
 
@@ -54,12 +54,12 @@ namespace itertools {
 						return Ok(pool);
 					});
 				if (pool.is_err()) { return pool; }
-				pools->elements().push_back(pool.unwrap());
+				pools->storage().push_back(pool.unwrap());
 				value_ = iterator->next();
 			}
-			const size_t pool_size = pools->elements().size();
+			const size_t pool_size = pools->storage().size();
 			for (size_t i = 0; i < repeat.value_or(1) - 1; ++i) {
-				auto &els = pools->elements();
+				auto &els = pools->as_object_storage();
 				els.insert(els.end(), els.begin(), els.begin() + pool_size);
 			}
 			auto *obj = VirtualMachine::the().heap().allocate<Product>(pools, repeat.value_or(1));
@@ -76,7 +76,7 @@ namespace itertools {
 		std::optional<size_t> length_;
 		if (kwargs) {
 			if (auto it = kwargs->map().find(String{ "repeat" }); it != kwargs->map().end()) {
-				auto obj = PyObject::from(it.value());
+				auto obj = PyObject::from(it->second);
 				if (obj.is_err()) { return obj; }
 				if (!obj.unwrap()->type()->issubclass(types::integer())) {
 					return Err(type_error("'{}' object cannot be interpreted as an integer",
@@ -102,15 +102,17 @@ namespace itertools {
 
 		if (m_result.empty()) {
 			m_result.emplace_back();
-			for (const auto &pool : m_pools->elements()) {
+			const auto &pools = m_pools->storage();
+			for (size_t i = 0; i < pools.size(); ++i) {
+				const auto pool = pools[i];
 				ASSERT(std::holds_alternative<PyObject *>(pool));
 				ASSERT(as<PyList>(std::get<PyObject *>(pool)));
 				std::vector<std::vector<Value>> result;
-				auto *pool_list = as<PyList>(std::get<PyObject *>(pool));
+				const auto &pool_storage = as<PyList>(std::get<PyObject *>(pool))->storage();
 				for (auto x : m_result) {
-					for (auto y : pool_list->elements()) {
+					for (size_t j = 0; j < pool_storage.size(); ++j) {
 						auto tmp = x;
-						tmp.push_back(y);
+						tmp.push_back(pool_storage[j]);
 						result.push_back(std::move(tmp));
 					}
 				}
@@ -58,13 +58,13 @@ namespace itertools {
 		auto *args = args_.unwrap();
 		auto next = current_args_iterator.unwrap()->next();
 		while (next.is_ok()) {
-			args->elements().push_back(next.unwrap());
+			args->storage().push_back(next.unwrap());
 			next = current_args_iterator.unwrap()->next();
 		}
 
 		if (next.unwrap_err()->type() != stop_iteration()->type()) { return next; }
 
-		auto args_tuple = PyTuple::create(args->elements());
+		auto args_tuple = PyTuple::create(args->storage().values());
 		if (args_tuple.is_err()) { return args_tuple; }
 		return m_function->call(args_tuple.unwrap(), nullptr);
 	}
@@ -59,10 +59,12 @@
 #include "runtime/PyTuple.hpp"
 #include "runtime/PyType.hpp"
 #include "runtime/PyZip.hpp"
+#include "runtime/RecursionError.hpp"
 #include "runtime/RuntimeError.hpp"
 #include "runtime/StopIteration.hpp"
 #include "runtime/SyntaxError.hpp"
 #include "runtime/UnboundLocalError.hpp"
+#include "runtime/UnicodeDecodeError.hpp"
 #include "runtime/ValueError.hpp"
 #include "runtime/warnings/DeprecationWarning.hpp"
 #include "runtime/warnings/ImportWarning.hpp"
@@ -128,7 +130,9 @@ BuiltinTypes::BuiltinTypes()
 	  m_resource_warning(ResourceWarning::type_factory()),
 	  m_syntax_error(SyntaxError::type_factory()), m_memory_error(MemoryError::type_factory()),
 	  m_stop_iteration(StopIteration::type_factory()),
-	  m_unbound_local_error(UnboundLocalError::type_factory())
+	  m_unbound_local_error(UnboundLocalError::type_factory()),
+	  m_unicode_decode_error(UnicodeDecodeError::type_factory()),
+	  m_recursion_error(RecursionError::type_factory())
 {}
 
 #define INITIALIZE_TYPE(TYPENAME)                                                         \
@@ -250,5 +254,7 @@ INITIALIZE_TYPE(syntax_error)
 INITIALIZE_TYPE(memory_error)
 INITIALIZE_TYPE(stop_iteration)
 INITIALIZE_TYPE(unbound_local_error)
+INITIALIZE_TYPE(unicode_decode_error)
+INITIALIZE_TYPE(recursion_error)
 
 }// namespace py::types
@@ -121,6 +121,8 @@ namespace types {
 		mutable Type m_memory_error;
 		mutable Type m_stop_iteration;
 		mutable Type m_unbound_local_error;
+		mutable Type m_unicode_decode_error;
+		mutable Type m_recursion_error;
 
 		BuiltinTypes();
 
@@ -251,6 +253,8 @@ namespace types {
 		TypePrototype &memory_error() const { return get_type(m_memory_error); }
 		TypePrototype &stop_iteration() const { return get_type(m_stop_iteration); }
 		TypePrototype &unbound_local_error() const { return get_type(m_unbound_local_error); }
+		TypePrototype &unicode_decode_error() const { return get_type(m_unicode_decode_error); }
+		TypePrototype &recursion_error() const { return get_type(m_recursion_error); }
 	};
 
 	PyType *type();
@@ -342,5 +346,7 @@ namespace types {
 	PyType *memory_error();
 	PyType *stop_iteration();
 	PyType *unbound_local_error();
+	PyType *unicode_decode_error();
+	PyType *recursion_error();
 }// namespace types
 }// namespace py
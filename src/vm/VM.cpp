@@ -9,7 +9,6 @@
 #include "runtime/PyFrame.hpp"
 #include "runtime/PyObject.hpp"
 #include "runtime/PyString.hpp"
-#include "runtime/PyTraceback.hpp"
 #include <iterator>
 #include <spdlog/spdlog.h>
 
@@ -21,65 +20,56 @@ StackFrame::StackFrame(size_t register_count,
 	size_t stack_size,
 	InstructionVector::const_iterator return_address,
 	VirtualMachine *vm_)
-	: registers(register_count, nullptr),
-	  locals(vm_->m_stack_pointer, vm_->m_stack_pointer + stack_size),
-	  return_address(return_address), base_pointer(vm_->m_stack_pointer + locals_count),
-	  stack_pointer(vm_->m_stack_pointer + locals_count), vm(vm_)
+	: return_address(return_address), vm(vm_)
 {
-	state = std::make_unique<State>();
+	// the values pushed by a frame are copied out of its registers, so reserve as many operand
+	// slots as there are registers
+	const size_t locals_size = std::max(locals_count, stack_size);
+	auto *start = vm->reserve_stack(2 * register_count + locals_size, segment);
+	registers = Registers{ start, register_count };
+	locals = std::span{ start + register_count, stack_size };
+	base_pointer = start + register_count + locals_size;
+	stack_pointer = start + register_count + locals_size;
+
 	spdlog::debug("Added frame with {} registers and stack size {}. New stack frame count: {}",
 		registers.size(),
 		locals.size(),
 		vm->m_stack_frames.size());
 	// have to wipe the new stack frame, to avoid finding PyObject pointers and GC'ing objects that
 	// were valid in an already popped stack frame, but have at this point already been deallocated
+	for (auto &r : registers) { r = nullptr; }
 	for (auto &local : locals) { local = nullptr; }
 }
 
-StackFrame::StackFrame(StackFrame &&other)
-	: registers(std::move(other.registers)), locals_storage(std::move(other.locals_storage)),
-	  return_address(other.return_address), base_pointer(other.base_pointer),
-	  stack_pointer(other.stack_pointer), vm(std::exchange(other.vm, nullptr)),
-	  state(std::exchange(other.state, nullptr))
-{
-	if (!locals_storage.empty()) {
-		locals = std::span{ locals_storage.begin(), locals_storage.end() };
-		other.locals = std::span<py::Value>{};
-	} else if (!locals.empty()) {
-		locals = std::move(other.locals);
-	}
-}
-
 StackFrame::~StackFrame()
 {
 	if (vm) {
 		spdlog::debug("Popping frame. New stack frame count: {}", vm->m_stack_frames.size());
 	}
+	for (auto &r : registers) { r = nullptr; }
 	for (auto &local : locals) { local = nullptr; }
 }
 
-StackFrame StackFrame::clone() const
+std::unique_ptr<StackFrame>
+	StackFrame::create_resumable(size_t register_count, size_t stack_size, VirtualMachine *vm)
 {
-	StackFrame stack_frame;
-	stack_frame.registers = registers;
-	stack_frame.locals_storage = std::vector<py::Value>{ locals.begin(), locals.end() };
-	stack_frame.locals =
-		std::span{ stack_frame.locals_storage.begin(), stack_frame.locals_storage.end() };
-	stack_frame.return_address = return_address;
-	stack_frame.last_instruction_pointer = last_instruction_pointer;
-	stack_frame.base_pointer = base_pointer;
-	stack_frame.stack_pointer = stack_pointer;
-	stack_frame.vm = vm;
-	stack_frame.state = std::make_unique<State>(*state);
-	return stack_frame;
+	auto frame = std::unique_ptr<StackFrame>(new StackFrame{});
+	frame->registers_storage.resize(register_count, nullptr);
+	frame->locals_storage.resize(stack_size, nullptr);
+	frame->registers = Registers{ frame->registers_storage };
+	frame->locals = std::span{ frame->locals_storage };
+	frame->vm = vm;
+	return frame;
 }
 
-
 StackFrame &StackFrame::restore()
 {
 	ASSERT(vm);
-	auto start = vm->m_stack_pointer;
-	for (const auto &el : locals_storage) { *start++ = el; }
+	// registers and locals are kept in this frame's own storage, so the VM stack only has to hold
+	// the operand stack of the resumed frame
+	auto *start = vm->reserve_stack(registers.size(), segment);
+	base_pointer = start;
+	stack_pointer = start;
 	vm->push_frame(*this);
 	return vm->stack().top();
 }
@@ -91,41 +81,42 @@ void StackFrame::leave()
 	vm->pop_frame(true);
 }
 
-VirtualMachine::VirtualMachine()
-	: m_stack(10'000, nullptr), m_stack_pointer(m_stack.begin()), m_base_pointer(m_stack_pointer),
-	  m_heap(Heap::create())
+VirtualMachine::VirtualMachine() : m_heap(Heap::create())
 {
 	uintptr_t *rbp;
 	asm volatile("movq %%rbp, %0" : "=r"(rbp));
 	m_heap->set_start_stack_pointer(rbp);
 }
 
+py::Value *VirtualMachine::grow_stack(size_t slot_count, size_t &segment)
+{
+	segment = m_stack_frames.empty() ? 0 : m_active_segment + 1;
+	if (segment >= m_stack_segments.size() || m_stack_segments[segment].size < slot_count) {
+		const size_t size = std::max(kStackSegmentSize, slot_count);
+		m_stack_segments.resize(segment + 1);
+		m_stack_segments[segment] =
+			StackSegment{ std::make_unique<py::Value[]>(size), size };
+	}
+	return m_stack_segments[segment].values.get();
+}
+
+void VirtualMachine::activate_segment(size_t segment)
+{
+	m_active_segment = segment;
+	const auto &active = m_stack_segments[segment];
+	m_stack_limit = active.values.get() + active.size;
+	// keep one spare segment, so that calls going back and forth across a segment boundary don't
+	// allocate every time
+	if (m_stack_segments.size() > segment + 2) { m_stack_segments.resize(segment + 2); }
+}
+
 std::unique_ptr<StackFrame>
 	VirtualMachine::setup_call_stack(size_t register_count, size_t locals_count, size_t stack_size)
 {
 	return push_frame(register_count, locals_count, stack_size);
 }
 
-void VirtualMachine::ret()
-{
-	if (m_state->cleanup.top().has_value()
-		&& m_state->cleanup.top()->first == State::CleanupLogic::WITH_EXIT) {
-		m_state->cleanup.pop();
-		ret();
-	} else if (m_state->cleanup.top().has_value()
-			   && m_state->cleanup.top()->first == State::CleanupLogic::CATCH_EXCEPTION) {
-		if (auto exc = m_interpreter->execution_frame()->exception_info(); exc.has_value()) {
-			// Make sure that we don't leave the current frame in an exception state when we have
-			// exception handlers
-			ASSERT(exc->traceback->m_tb_frame != m_interpreter->execution_frame());
-		}
-		m_state->cleanup.pop();
-		ret();
-	} else {
-		ASSERT(m_state->cleanup.size() == 1)
-		pop_frame(true);
-	}
-}
+void VirtualMachine::ret() { pop_frame(true); }
 
 int VirtualMachine::execute(std::shared_ptr<Program> program) { return program->execute(this); }
 
@@ -235,18 +226,6 @@ void VirtualMachine::clear()
 	// m_instruction_pointer = nullptr;
 }
 
-void VirtualMachine::set_cleanup(State::CleanupLogic cleanup_type,
-	InstructionVector::const_iterator exit_instruction)
-{
-	m_state->cleanup.push(std::make_pair(cleanup_type, exit_instruction));
-}
-
-void VirtualMachine::leave_cleanup_handling()
-{
-	ASSERT(m_state->cleanup.size() > 1)
-	m_state->cleanup.pop();
-}
-
 std::unique_ptr<StackFrame>
 	VirtualMachine::push_frame(size_t register_count, size_t locals_count, size_t stack_size)
 {
@@ -266,46 +245,27 @@ void VirtualMachine::push_frame(StackFrame &frame)
 	if (!m_stack_frames.empty()) {
 		// stash the current stack pointer so we can restore it later
 		m_stack_frames.top().get().stack_pointer = m_stack_pointer;
+		frame.caller = &m_stack_frames.top().get();
+	} else {
+		frame.caller = nullptr;
 	}
 	m_stack_frames.push(frame);
-	// set a new state for this stack frame
-	m_state = m_stack_frames.top().get().state.get();
-
-	const auto &r = registers();
-	auto &stack_objects = m_stack_objects.emplace_back();
-	if (r.has_value()) {
-		for (const auto &v : r->get()) { stack_objects.push_back(&v); }
-		for (const auto &v : stack_locals()) { stack_objects.push_back(&v); }
-	}
-
-	ASSERT(std::distance(m_stack_pointer, frame.stack_pointer) >= 0);
-	ASSERT(std::distance(m_base_pointer, frame.base_pointer) >= 0);
-
-	if (std::distance(m_stack.begin(), frame.stack_pointer)
-		>= static_cast<int64_t>(m_stack.size())) {
-		ASSERT(false && "Stack overflow!");
-	}
 
+	if (frame.segment != m_active_segment || !m_stack_limit) { activate_segment(frame.segment); }
 	m_stack_pointer = frame.stack_pointer;
 	m_base_pointer = frame.base_pointer;
 
 	spdlog::debug("Pushing frame. New stack frame count: {}", m_stack_frames.size());
 }
 
-std::deque<std::vector<const py::Value *>> VirtualMachine::stack_objects() const
-{
-	return m_stack_objects;
-}
-
 void VirtualMachine::pop_frame(bool should_return_value)
 {
 	if (m_stack_frames.size() > 1) {
-		const size_t locals_size = m_stack_frames.top().get().locals.size();
+		const size_t segment = m_stack_frames.top().get().segment;
 
 		auto return_value = m_stack_frames.top().get().registers[0];
 		ASSERT((*m_stack_frames.top().get().return_address).get());
 		m_instruction_pointer = m_stack_frames.top().get().return_address;
-		auto f = m_stack_frames.top();
 		m_stack_frames.pop();
 		if (should_return_value) {
 			// returning a value may not be always desirable (e.g. leaving a function in an
@@ -313,21 +273,13 @@ void VirtualMachine::pop_frame(bool should_return_value)
 			m_stack_frames.top().get().registers[0] = std::move(return_value);
 		}
 
-		// restore stack frame state
-		m_state = m_stack_frames.top().get().state.get();
-		m_stack_objects.pop_back();
-
-		f.get().locals_storage.resize(locals_size, nullptr);
-		for (size_t i = 0; i < locals_size; ++i) { f.get().locals_storage[i] = f.get().locals[i]; }
-		f.get().locals = std::span{ f.get().locals_storage.begin(), f.get().locals_storage.end() };
-
-		ASSERT(std::distance(m_stack_frames.top().get().stack_pointer, m_stack_pointer) >= 0);
-		ASSERT(std::distance(m_stack_frames.top().get().base_pointer, m_base_pointer) >= 0);
+		if (m_stack_frames.top().get().segment != segment) {
+			activate_segment(m_stack_frames.top().get().segment);
+		}
 		m_base_pointer = m_stack_frames.top().get().base_pointer;
 		m_stack_pointer = m_stack_frames.top().get().stack_pointer;
 	} else {
 		m_stack_frames.pop();
-		m_stack_objects.pop_back();
 	}
 }
 
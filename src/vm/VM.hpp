@@ -10,22 +10,15 @@
 #include <stack>
 
 class VirtualMachine;
+struct ScopedStack;
 
-using Registers = std::vector<py::Value>;
-
-struct State
-{
-	enum class CleanupLogic {
-		CATCH_EXCEPTION,
-		WITH_EXIT,
-	};
-	std::stack<std::optional<std::pair<CleanupLogic, InstructionVector::const_iterator>>> cleanup{
-		{ std::nullopt }
-	};
-};
+// register file of a frame, laid out in the VM stack next to the frame's locals
+using Registers = std::span<py::Value>;
 
 struct StackFrame : NonCopyable
 {
+	friend ScopedStack;
+
   private:
 	StackFrame() = default;
 
@@ -35,28 +28,33 @@ struct StackFrame : NonCopyable
 		InstructionVector::const_iterator return_address,
 		VirtualMachine *);
 
-	StackFrame(StackFrame &&);
-
   public:
 	template<typename... Args> static std::unique_ptr<StackFrame> create(Args &&...args)
 	{
 		return std::unique_ptr<StackFrame>(new StackFrame{ std::forward<Args>(args)... });
 	}
 
+	// creates a frame that owns its registers and locals instead of borrowing them from the VM
+	// stack, so that it can be suspended and resumed in place (e.g. by a generator)
+	static std::unique_ptr<StackFrame>
+		create_resumable(size_t register_count, size_t stack_size, VirtualMachine *);
+
 	Registers registers;
+	std::vector<py::Value> registers_storage;
 	std::vector<py::Value> locals_storage;
 	std::span<py::Value> locals;
 	InstructionVector::const_iterator return_address;
 	InstructionVector::const_iterator last_instruction_pointer;
-	std::vector<py::Value>::const_iterator base_pointer;
-	std::vector<py::Value>::iterator stack_pointer;
+	const py::Value *base_pointer{ nullptr };
+	py::Value *stack_pointer{ nullptr };
+	// the VM stack segment that holds this frame's operand stack
+	size_t segment{ 0 };
 	VirtualMachine *vm{ nullptr };
-	std::unique_ptr<State> state;
+	// the frame below this one in the VM stack, while this frame is pushed
+	const StackFrame *caller{ nullptr };
 
 	~StackFrame();
 
-	StackFrame clone() const;
-
 	StackFrame &restore();
 	void leave();
 };
@@ -65,16 +63,27 @@ class VirtualMachine
 	: NonCopyable
 	, NonMoveable
 {
-	std::vector<py::Value> m_stack;
+	// The VM stack is split in segments that are allocated when a frame does not fit in the current
+	// one, and released again when the frames using them are popped. A frame never straddles two
+	// segments, so pointers into the stack remain valid while the frame is alive.
+	struct StackSegment
+	{
+		std::unique_ptr<py::Value[]> values;
+		size_t size;
+	};
+	static constexpr size_t kStackSegmentSize = 16 * 1024;
+
+	std::vector<StackSegment> m_stack_segments;
+	size_t m_active_segment{ 0 };
 	std::stack<std::reference_wrapper<StackFrame>> m_stack_frames;
-	std::deque<std::vector<const py::Value *>> m_stack_objects;
 
 	InstructionVector::const_iterator m_instruction_pointer;
-	std::vector<py::Value>::iterator m_stack_pointer;
-	std::vector<py::Value>::const_iterator m_base_pointer;
+	py::Value *m_stack_pointer{ nullptr };
+	const py::Value *m_base_pointer{ nullptr };
+	const py::Value *m_stack_limit{ nullptr };
 	std::unique_ptr<Interpreter> m_interpreter;
 	std::unique_ptr<Heap> m_heap;
-	State *m_state{ nullptr };
+	size_t m_recursion_limit{ 1000 };
 
 	friend StackFrame;
 
@@ -143,8 +152,6 @@ class VirtualMachine
 	}
 
 	const std::stack<std::reference_wrapper<StackFrame>> &stack() const { return m_stack_frames; }
-	const State &state() const { return *m_state; }
-	State &state() { return *m_state; }
 
 	Heap &heap() { return *m_heap; }
 
@@ -164,8 +171,11 @@ class VirtualMachine
 		return m_instruction_pointer;
 	}
 
-	const py::Value *sp() const { return &*m_stack_pointer; }
-	const py::Value *bp() const { return &*m_base_pointer; }
+	const py::Value *sp() const { return m_stack_pointer; }
+	const py::Value *bp() const { return m_base_pointer; }
+
+	size_t recursion_limit() const { return m_recursion_limit; }
+	void set_recursion_limit(size_t limit) { m_recursion_limit = limit; }
 
 	void clear();
 
@@ -176,9 +186,6 @@ class VirtualMachine
 		size_t stack_size);
 
 	void ret();
-	void set_cleanup(State::CleanupLogic cleanup_type,
-		InstructionVector::const_iterator exit_instruction);
-	void leave_cleanup_handling();
 
 	[[nodiscard]] std::unique_ptr<StackFrame>
 		push_frame(size_t register_count, size_t locals_count, size_t stack_size);
@@ -186,17 +193,44 @@ class VirtualMachine
 
 	void pop_frame(bool should_return_value);
 
-	void push(py::Value value) { *m_stack_pointer++ = value; }
+	void push(py::Value value)
+	{
+		ASSERT(m_stack_pointer < m_stack_limit);
+		*m_stack_pointer++ = value;
+	}
 
 	py::Value pop() { return *--m_stack_pointer; }
 
-	std::deque<std::vector<const py::Value *>> stack_objects() const;
+	// calls `visitor` with the register file and the locals of each frame in the VM stack, which are
+	// the roots the garbage collector has to scan
+	template<typename FunctionType> void visit_stack_frames(FunctionType &&visitor) const
+	{
+		if (m_stack_frames.empty()) { return; }
+		for (const auto *frame = &m_stack_frames.top().get(); frame; frame = frame->caller) {
+			visitor(std::span<const py::Value>{ frame->registers });
+			visitor(std::span<const py::Value>{ frame->locals });
+		}
+	}
 
 	py::PyModule *import(py::PyString *path);
 
   private:
 	VirtualMachine();
 
+	// returns the start of `slot_count` contiguous free slots in the VM stack, and the index of the
+	// segment they belong to
+	py::Value *reserve_stack(size_t slot_count, size_t &segment)
+	{
+		if (static_cast<size_t>(m_stack_limit - m_stack_pointer) >= slot_count) {
+			segment = m_active_segment;
+			return m_stack_pointer;
+		}
+		return grow_stack(slot_count, segment);
+	}
+
+	py::Value *grow_stack(size_t slot_count, size_t &segment);
+	void activate_segment(size_t segment);
+
 	int execute_internal(std::shared_ptr<Program> program);
 
 	void show_current_instruction(size_t index, size_t window) const;